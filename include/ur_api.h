@@ -230,6 +230,28 @@ typedef enum ur_function_t {
     UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP = 243,             ///< Enumerator for ::urCommandBufferUpdateSignalEventExp
     UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP = 244,              ///< Enumerator for ::urCommandBufferUpdateWaitEventsExp
     UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP = 245,     ///< Enumerator for ::urBindlessImagesMapExternalLinearMemoryExp
+    UR_FUNCTION_USM_POOL_TRIM_EXP = 246,                                  ///< Enumerator for ::urUSMPoolTrimExp
+    UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP = 247,      ///< Enumerator for ::urCommandBufferUpdateKernelLaunchBatchExp
+    UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP = 248,                       ///< Enumerator for ::urEnqueueUSMDeviceAllocExp
+    UR_FUNCTION_ENQUEUE_USM_FREE_EXP = 249,                               ///< Enumerator for ::urEnqueueUSMFreeExp
+    UR_FUNCTION_USM_GROWABLE_ALLOC_EXP = 250,                             ///< Enumerator for ::urUSMGrowableAllocExp
+    UR_FUNCTION_USM_GROW_EXP = 251,                                       ///< Enumerator for ::urUSMGrowExp
+    UR_FUNCTION_KERNEL_SET_ARGS_EXP = 252,                                ///< Enumerator for ::urKernelSetArgsExp
+    UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP = 253,                    ///< Enumerator for ::urEnqueueKernelLaunchMultiExp
+    UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP = 254,                            ///< Enumerator for ::urProgramBuildAsyncExp
+    UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP = 255,               ///< Enumerator for ::urBindlessImagesImageCopyBatchExp
+    UR_FUNCTION_LOADER_INVALIDATE_ENUMERATION_CACHE_EXP = 256,            ///< Enumerator for ::urLoaderInvalidateEnumerationCacheExp
+    UR_FUNCTION_EVENT_WAIT_ANY_EXP = 257,                                 ///< Enumerator for ::urEventWaitAnyExp
+    UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP = 258,                            ///< Enumerator for ::urQueueBeginCaptureExp
+    UR_FUNCTION_QUEUE_END_CAPTURE_EXP = 259,                              ///< Enumerator for ::urQueueEndCaptureExp
+    UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP = 260,                          ///< Enumerator for ::urCommandBufferUploadExp
+    UR_FUNCTION_ENQUEUE_HOST_TASK_EXP = 261,                              ///< Enumerator for ::urEnqueueHostTaskExp
+    UR_FUNCTION_EVENT_CREATE_IPC_EXP = 262,                               ///< Enumerator for ::urEventCreateIPCExp
+    UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP = 263,                           ///< Enumerator for ::urEventGetIPCHandleExp
+    UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP = 264,                          ///< Enumerator for ::urEventOpenIPCHandleExp
+    UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP = 265,                       ///< Enumerator for ::urEnqueueIPCEventSignalExp
+    UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP = 266,                         ///< Enumerator for ::urEnqueueIPCEventWaitExp
+    UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP = 267,                       ///< Enumerator for ::urEnqueueUSMMemcpyBatchExp
     /// @cond
     UR_FUNCTION_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -279,6 +301,7 @@ typedef enum ur_structure_type_t {
     UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_MEMOBJ_ARG_DESC = 0x1002,    ///< ::ur_exp_command_buffer_update_memobj_arg_desc_t
     UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_POINTER_ARG_DESC = 0x1003,   ///< ::ur_exp_command_buffer_update_pointer_arg_desc_t
     UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_VALUE_ARG_DESC = 0x1004,     ///< ::ur_exp_command_buffer_update_value_arg_desc_t
+    UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_LAUNCH_CHAINS_DESC = 0x1005,        ///< ::ur_exp_command_buffer_launch_chains_desc_t
     UR_STRUCTURE_TYPE_EXP_SAMPLER_MIP_PROPERTIES = 0x2000,                   ///< ::ur_exp_sampler_mip_properties_t
     UR_STRUCTURE_TYPE_EXP_EXTERNAL_MEM_DESC = 0x2001,                        ///< ::ur_exp_external_mem_desc_t
     UR_STRUCTURE_TYPE_EXP_EXTERNAL_SEMAPHORE_DESC = 0x2002,                  ///< ::ur_exp_external_semaphore_desc_t
@@ -288,6 +311,8 @@ typedef enum ur_structure_type_t {
     UR_STRUCTURE_TYPE_EXP_SAMPLER_CUBEMAP_PROPERTIES = 0x2006,               ///< ::ur_exp_sampler_cubemap_properties_t
     UR_STRUCTURE_TYPE_EXP_IMAGE_COPY_REGION = 0x2007,                        ///< ::ur_exp_image_copy_region_t
     UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES = 0x3000,        ///< ::ur_exp_enqueue_native_command_properties_t
+    UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC = 0x4000,                      ///< ::ur_exp_usm_pool_arena_desc_t
+    UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC = 0x4001,                       ///< ::ur_exp_usm_host_numa_desc_t
     /// @cond
     UR_STRUCTURE_TYPE_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -965,6 +990,11 @@ typedef enum ur_adapter_info_t {
                                          ///< The reference count returned should be considered immediately stale.
                                          ///< It is unsuitable for general use in applications. This feature is
                                          ///< provided for identifying memory leaks.
+    UR_ADAPTER_INFO_PERF_COUNTERS = 2,   ///< [char[]] Null-terminated list of the performance counters of the
+                                         ///< adapter, one per line as its name followed by a space and its value.
+                                         ///< The values returned should be considered immediately stale. This
+                                         ///< feature is provided for identifying configurations which defeat the
+                                         ///< caches of the adapter.
     /// @cond
     UR_ADAPTER_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -986,7 +1016,7 @@ typedef enum ur_adapter_info_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hAdapter`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_ADAPTER_INFO_REFERENCE_COUNT < propName`
+///         + `::UR_ADAPTER_INFO_PERF_COUNTERS < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -1697,6 +1727,14 @@ typedef enum ur_device_info_t {
                                                                      ///< backed 2D sampled image data.
     UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP = 0x2020,      ///< [::ur_bool_t] returns true if the device supports enqueueing of native
                                                                      ///< work
+    UR_DEVICE_INFO_HOST_NUMA_NODE_EXP = 0x2021,                      ///< [uint32_t] returns the NUMA node of the host closest to the device, as
+                                                                     ///< found from the PCI topology of the system
+    UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP = 0x2022,           ///< [::ur_bool_t] returns true if the device supports enqueueing host tasks
+    UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP = 0x2023,                   ///< [::ur_bool_t] returns true if the device supports events shared between
+                                                                     ///< processes
+    UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP = 0x2024,               ///< [::ur_bool_t] returns true if the device supports zero-initialized USM
+                                                                     ///< device and shared allocations, see
+                                                                     ///< ::UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP
     /// @cond
     UR_DEVICE_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -1722,7 +1760,7 @@ typedef enum ur_device_info_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hDevice`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP < propName`
+///         + `::UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -2283,6 +2321,13 @@ typedef enum ur_context_info_t {
     UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES = 8,  ///< [::ur_memory_scope_capability_flags_t] return a bit-field of atomic
                                                           ///< memory fence scope capabilities.
                                                           ///< Zero is returned if the backend does not support context-level fences.
+    UR_CONTEXT_INFO_MEMORY_USED_EXP = 0x2000,             ///< [uint64_t[]] bytes the context holds from the driver, element i
+                                                          ///< counting the memory of ::ur_exp_context_memory_type_t i. Pools count
+                                                          ///< the memory they hold, allocated or not.
+    UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP = 0x2001,        ///< [uint64_t[]] highest value each element of
+                                                          ///< ::UR_CONTEXT_INFO_MEMORY_USED_EXP reached.
+    UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP = 0x2002,  ///< [uint64_t] highest number of bytes the context held from the driver,
+                                                          ///< of all types at once.
     /// @cond
     UR_CONTEXT_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -2332,7 +2377,7 @@ urContextRelease(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hContext`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES < propName`
+///         + `::UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -3331,13 +3376,16 @@ typedef enum ur_usm_device_mem_flag_t {
     UR_USM_DEVICE_MEM_FLAG_INITIAL_PLACEMENT = UR_BIT(1), ///< Optimize shared allocation for first access on the device
     UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY = UR_BIT(2),  ///< Memory is only possibly modified from the host, but read-only in all
                                                           ///< device code
+    UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP = UR_BIT(3),     ///< Memory is zeroed once the allocation returns. If the device doesn't
+                                                          ///< support it, see ::UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP, the
+                                                          ///< allocation fails with ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE.
     /// @cond
     UR_USM_DEVICE_MEM_FLAG_FORCE_UINT32 = 0x7fffffff
     /// @endcond
 
 } ur_usm_device_mem_flag_t;
 /// @brief Bit Mask for validating ur_usm_device_mem_flags_t
-#define UR_USM_DEVICE_MEM_FLAGS_MASK 0xfffffff8
+#define UR_USM_DEVICE_MEM_FLAGS_MASK 0xfffffff0
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief USM memory property flags
@@ -3759,11 +3807,20 @@ urUSMPoolRelease(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Get USM memory pool information
 typedef enum ur_usm_pool_info_t {
-    UR_USM_POOL_INFO_REFERENCE_COUNT = 0, ///< [uint32_t] Reference count of the pool object.
-                                          ///< The reference count returned should be considered immediately stale.
-                                          ///< It is unsuitable for general use in applications. This feature is
-                                          ///< provided for identifying memory leaks.
-    UR_USM_POOL_INFO_CONTEXT = 1,         ///< [::ur_context_handle_t] USM memory pool context info
+    UR_USM_POOL_INFO_REFERENCE_COUNT = 0,             ///< [uint32_t] Reference count of the pool object.
+                                                      ///< The reference count returned should be considered immediately stale.
+                                                      ///< It is unsuitable for general use in applications. This feature is
+                                                      ///< provided for identifying memory leaks.
+    UR_USM_POOL_INFO_CONTEXT = 1,                     ///< [::ur_context_handle_t] USM memory pool context info
+    UR_USM_POOL_INFO_USED_SIZE_EXP = 0x2000,          ///< [size_t] bytes requested by the live allocations of the pool
+    UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP = 0x2001,     ///< [size_t] highest value of ::UR_USM_POOL_INFO_USED_SIZE_EXP so far
+    UR_USM_POOL_INFO_RESERVED_SIZE_EXP = 0x2002,      ///< [size_t] bytes the pool holds from the driver, including the free blocks of its slabs
+    UR_USM_POOL_INFO_PEAK_RESERVED_SIZE_EXP = 0x2003, ///< [size_t] highest value of ::UR_USM_POOL_INFO_RESERVED_SIZE_EXP so far
+    UR_USM_POOL_INFO_SLAB_COUNT_EXP = 0x2004,         ///< [uint64_t] number of allocations the pool holds from the driver
+    UR_USM_POOL_INFO_BUCKET_HITS_EXP = 0x2005,        ///< [uint64_t[]] number of allocations served from memory the pool already held, by size. Element i
+                                                      ///< counts the allocations of more than 2^(i-1) and up to 2^i bytes
+    UR_USM_POOL_INFO_BUCKET_MISSES_EXP = 0x2006,      ///< [uint64_t[]] number of allocations which had to allocate from the driver, by size, counted like
+                                                      ///< ::UR_USM_POOL_INFO_BUCKET_HITS_EXP
     /// @cond
     UR_USM_POOL_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -3781,7 +3838,7 @@ typedef enum ur_usm_pool_info_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hPool`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_USM_POOL_INFO_CONTEXT < propName`
+///         + `::UR_USM_POOL_INFO_BUCKET_MISSES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -5380,21 +5437,32 @@ urKernelGetSuggestedLocalWorkSize(
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Query queue info
 typedef enum ur_queue_info_t {
-    UR_QUEUE_INFO_CONTEXT = 0,         ///< [::ur_context_handle_t] context associated with this queue.
-    UR_QUEUE_INFO_DEVICE = 1,          ///< [::ur_device_handle_t] device associated with this queue.
-    UR_QUEUE_INFO_DEVICE_DEFAULT = 2,  ///< [::ur_queue_handle_t] the current default queue of the underlying
-                                       ///< device.
-    UR_QUEUE_INFO_FLAGS = 3,           ///< [::ur_queue_flags_t] the properties associated with
-                                       ///< ::ur_queue_properties_t::flags.
-    UR_QUEUE_INFO_REFERENCE_COUNT = 4, ///< [uint32_t] Reference count of the queue object.
-                                       ///< The reference count returned should be considered immediately stale.
-                                       ///< It is unsuitable for general use in applications. This feature is
-                                       ///< provided for identifying memory leaks.
-    UR_QUEUE_INFO_SIZE = 5,            ///< [uint32_t] The size of the queue on the device. Only a valid query
-                                       ///< if the queue was created with the `ON_DEVICE` queue flag, otherwise
-                                       ///< `::urQueueGetInfo` will return `::UR_RESULT_ERROR_INVALID_QUEUE`.
-    UR_QUEUE_INFO_EMPTY = 6,           ///< [::ur_bool_t] return true if the queue was empty at the time of the
-                                       ///< query
+    UR_QUEUE_INFO_CONTEXT = 0,                               ///< [::ur_context_handle_t] context associated with this queue.
+    UR_QUEUE_INFO_DEVICE = 1,                                ///< [::ur_device_handle_t] device associated with this queue.
+    UR_QUEUE_INFO_DEVICE_DEFAULT = 2,                        ///< [::ur_queue_handle_t] the current default queue of the underlying
+                                                             ///< device.
+    UR_QUEUE_INFO_FLAGS = 3,                                 ///< [::ur_queue_flags_t] the properties associated with
+                                                             ///< ::ur_queue_properties_t::flags.
+    UR_QUEUE_INFO_REFERENCE_COUNT = 4,                       ///< [uint32_t] Reference count of the queue object.
+                                                             ///< The reference count returned should be considered immediately stale.
+                                                             ///< It is unsuitable for general use in applications. This feature is
+                                                             ///< provided for identifying memory leaks.
+    UR_QUEUE_INFO_SIZE = 5,                                  ///< [uint32_t] The size of the queue on the device. Only a valid query
+                                                             ///< if the queue was created with the `ON_DEVICE` queue flag, otherwise
+                                                             ///< `::urQueueGetInfo` will return `::UR_RESULT_ERROR_INVALID_QUEUE`.
+    UR_QUEUE_INFO_EMPTY = 6,                                 ///< [::ur_bool_t] return true if the queue was empty at the time of the
+                                                             ///< query
+    UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP = 0x2000,           ///< [uint64_t] number of commands enqueued to the queue, including the
+                                                             ///< commands the adapter enqueues on its own.
+    UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP = 0x2001,           ///< [uint64_t] number of submissions of commands to the driver, each made
+                                                             ///< of one or more commands.
+    UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP = 0x2002, ///< [double] average number of commands outstanding as each command was
+                                                             ///< enqueued, those enqueued since the queue was last found idle.
+    UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP = 0x2003,     ///< [uint64_t] maximum number of commands outstanding as a command was
+                                                             ///< enqueued.
+    UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP = 0x2004,          ///< [uint64_t] time in nanoseconds spent blocked in ::urQueueFinish.
+    UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP = 0x2005,        ///< [uint64_t] number of commands enqueued to another internal command
+                                                             ///< list or stream than the previous command.
     /// @cond
     UR_QUEUE_INFO_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -5421,13 +5489,19 @@ typedef enum ur_queue_flag_t {
                                                              ///< ignore this flag.
     UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM = UR_BIT(10),     ///< Synchronize with the default stream. Only meaningful for CUDA. Other
                                                              ///< platforms may ignore this flag.
+    UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP = UR_BIT(11),         ///< The application never makes calls concerning the queue, including its
+                                                             ///< events, from more than one thread at a time. Adapters may skip the
+                                                             ///< locks of the queue, or ignore this flag.
+    UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP = UR_BIT(12),        ///< Hint: hand the commands over to a thread of the queue, which submits
+                                                             ///< them to the driver, so that enqueue calls return once the command is
+                                                             ///< queued. No change in queue semantics.
     /// @cond
     UR_QUEUE_FLAG_FORCE_UINT32 = 0x7fffffff
     /// @endcond
 
 } ur_queue_flag_t;
 /// @brief Bit Mask for validating ur_queue_flags_t
-#define UR_QUEUE_FLAGS_MASK 0xfffff800
+#define UR_QUEUE_FLAGS_MASK 0xffffe000
 
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Query information about a command queue
@@ -5444,7 +5518,7 @@ typedef enum ur_queue_flag_t {
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_QUEUE_INFO_EMPTY < propName`
+///         + `::UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -5768,6 +5842,10 @@ typedef enum ur_command_t {
     UR_COMMAND_EXTERNAL_SEMAPHORE_SIGNAL_EXP = 0x2001, ///< Event created by ::urBindlessImagesSignalExternalSemaphoreExp
     UR_COMMAND_TIMESTAMP_RECORDING_EXP = 0x2002,       ///< Event created by ::urEnqueueTimestampRecordingExp
     UR_COMMAND_ENQUEUE_NATIVE_EXP = 0x2004,            ///< Event created by ::urEnqueueNativeCommandExp
+    UR_COMMAND_ENQUEUE_HOST_TASK_EXP = 0x2005,         ///< Event created by ::urEnqueueHostTaskExp
+    UR_COMMAND_IPC_EVENT_SIGNAL_EXP = 0x2006,          ///< Event created by ::urEnqueueIPCEventSignalExp
+    UR_COMMAND_IPC_EVENT_WAIT_EXP = 0x2007,            ///< Event created by ::urEnqueueIPCEventWaitExp
+    UR_COMMAND_USM_MEMCPY_BATCH_EXP = 0x2008,          ///< Event created by ::urEnqueueUSMMemcpyBatchExp
     /// @cond
     UR_COMMAND_FORCE_UINT32 = 0x7fffffff
     /// @endcond
@@ -7862,6 +7940,66 @@ urBindlessImagesImageCopyExp(
                                               ///< must not refer to an element of the phEventWaitList array.
 );
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Copy many regions of image data between the same source and
+///        destination
+///
+/// @details
+///     - Copies each region as ::urBindlessImagesImageCopyExp would, with a
+///       single command and event for all of them.
+///     - The regions may be copied in any order or concurrently, so the
+///       destination regions must not overlap each other.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pSrc`
+///         + `NULL == pDst`
+///         + `NULL == pSrcImageDesc`
+///         + `NULL == pDstImageDesc`
+///         + `NULL == pSrcImageFormat`
+///         + `NULL == pDstImageFormat`
+///         + `NULL == pCopyRegions`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numCopyRegions == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///     - ::UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR
+///         + `pSrcImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pSrcImageDesc->type`
+///         + `pDstImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pDstImageDesc->type`
+///     - ::UR_RESULT_ERROR_INVALID_IMAGE_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+UR_APIEXPORT ur_result_t UR_APICALL
+urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue,                       ///< [in] handle of the queue object
+    const void *pSrc,                               ///< [in] location the data will be copied from
+    void *pDst,                                     ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc,           ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc,           ///< [in] pointer to image description
+    const ur_image_format_t *pSrcImageFormat,       ///< [in] pointer to image format specification
+    const ur_image_format_t *pDstImageFormat,       ///< [in] pointer to image format specification
+    uint32_t numCopyRegions,                        ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+                                                    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t imageCopyFlags,       ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList,                   ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList,       ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                                    ///< events that must be complete before this command can be executed.
+                                                    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+                                                    ///< previously enqueued commands
+                                                    ///< must be complete.
+    ur_event_handle_t *phEvent                      ///< [out][optional] return an event object that identifies this particular
+                                                    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+                                                    ///< must not refer to an element of the phEventWaitList array.
+);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Query an image memory handle for specific properties
 ///
@@ -9344,6 +9482,151 @@ urCommandBufferCommandGetInfoExp(
     size_t *pPropSizeRet                             ///< [out][optional] bytes returned in command-buffer command property
 );
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Update a batch of kernel launch commands in a finalized
+///        command-buffer.
+///
+/// @details
+///     - This entry-point is synchronous and may block if the command-buffer
+///       is executing when the entry-point is called.
+///     - Each element of `pUpdateKernelLaunch` describes the update of the
+///       command at the same index in `phCommands`, with the same semantics
+///       as ::urCommandBufferUpdateKernelLaunchExp.
+///     - Adapters may apply the whole batch with a single device operation,
+///       which is cheaper than updating the commands one at a time.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hCommandBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phCommands`
+///         + `NULL == pUpdateKernelLaunch`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numKernelUpdates == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If update functionality is not supported by the device.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If ::ur_exp_command_buffer_desc_t::isUpdatable was not set to true on creation of `hCommandBuffer`.
+///         + If `hCommandBuffer` has not been finalized.
+///     - ::UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_COMMAND_HANDLE_EXP - "If any element of `phCommands` is not a kernel execution command."
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///         + `pUpdateKernelLaunch[i].newWorkDim < 1 || pUpdateKernelLaunch[i].newWorkDim > 3`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If any element of `phCommands` does not belong to `hCommandBuffer`.
+///         + If `pUpdateKernelLaunch[i].hNewKernel` was not passed to the `hKernel` or `phKernelAlternatives` parameters of ::urCommandBufferAppendKernelLaunchExp when `phCommands[i]` was created.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer,                               ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t numKernelUpdates,                                                   ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *phCommands,                    ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                                                                                 ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                                                                                 ///< command is to be updated.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for merging chains of command-buffer launches
+#if !defined(__GNUC__)
+#pragma region command_buffer_launch_chains_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Command-buffer launch chains descriptor type
+///
+/// @details
+///     - Specify these properties in ::urCommandBufferCreateExp via
+///       ::ur_exp_command_buffer_desc_t as part of a `pNext` chain.
+///     - Adapters may ignore this hint.
+typedef struct ur_exp_command_buffer_launch_chains_desc_t {
+    ur_structure_type_t stype;   ///< [in] type of this structure, must be
+                                 ///< ::UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_LAUNCH_CHAINS_DESC
+    const void *pNext;           ///< [in][optional] pointer to extension-specific structure
+    ur_bool_t mergeLaunchChains; ///< [in] the adapter may run commands which only depend on the command
+                                 ///< appended before them together with it, without an event between the
+                                 ///< two, even if this serializes commands which could otherwise run
+                                 ///< concurrently
+
+} ur_exp_command_buffer_launch_chains_desc_t;
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for uploading command-buffers ahead of their first enqueue
+#if !defined(__GNUC__)
+#pragma region command_buffer_upload_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Upload a finalized command-buffer to the device ahead of its first
+///        enqueue.
+///
+/// @details
+///     - Uploads the resources an execution of `hCommandBuffer` needs to the
+///       device of `hQueue`, after the commands already enqueued to `hQueue`,
+///       so that its first enqueue takes no longer than the later ones.
+///     - The upload returns no event, and `hCommandBuffer` may be enqueued to
+///       any queue after it.
+///     - Adapters with nothing to upload return ::UR_RESULT_SUCCESS without
+///       doing anything.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same command-buffer handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hCommandBuffer`
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_EXP
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If `hCommandBuffer` isn't finalized.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t hQueue                       ///< [in] The queue to upload the command-buffer on.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for the memory usage of
+// contexts
+#if !defined(__GNUC__)
+#pragma region context_memory_usage_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kinds of memory the context allocates, indexing the arrays of the
+///        memory usage queries
+typedef enum ur_exp_context_memory_type_t {
+    UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST = 0,   ///< Host USM allocations
+    UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE = 1, ///< Device USM allocations
+    UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED = 2, ///< Shared USM allocations
+    UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER = 3,     ///< Memory of the buffers, on the devices and on the host
+    UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE = 4,      ///< Memory of the images, including bindless images
+    UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL = 5,   ///< Memory the adapter allocates for itself, such as event pools and staging
+                                               ///< memory
+    /// @cond
+    UR_EXP_CONTEXT_MEMORY_TYPE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_context_memory_type_t;
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -9477,159 +9760,73 @@ urEnqueueTimestampRecordingExp(
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
-// Intel 'oneAPI' Unified Runtime Experimental APIs for (kernel) Launch Properties
+// Intel 'oneAPI' Unified Runtime Experimental APIs for waiting for any of several events
 #if !defined(__GNUC__)
-#pragma region launch_properties_(experimental)
+#pragma region event_wait_any_(experimental)
 #endif
 ///////////////////////////////////////////////////////////////////////////////
-#ifndef UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP
-/// @brief The extension string that defines support for the Launch Properties
-///        extension, which is returned when querying device extensions.
-#define UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP "ur_exp_launch_properties"
-#endif // UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Specifies a launch property id
-///
-/// @remarks
-///   _Analogues_
-///     - **CUlaunchAttributeID**
-typedef enum ur_exp_launch_property_id_t {
-    UR_EXP_LAUNCH_PROPERTY_ID_IGNORE = 0,            ///< The property has no effect
-    UR_EXP_LAUNCH_PROPERTY_ID_COOPERATIVE = 1,       ///< Whether to launch a cooperative kernel
-    UR_EXP_LAUNCH_PROPERTY_ID_CLUSTER_DIMENSION = 2, ///< work-group cluster dimensions
-    /// @cond
-    UR_EXP_LAUNCH_PROPERTY_ID_FORCE_UINT32 = 0x7fffffff
-    /// @endcond
-
-} ur_exp_launch_property_id_t;
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Specifies a launch property value
-///
-/// @remarks
-///   _Analogues_
-///     - **CUlaunchAttributeValue**
-typedef union ur_exp_launch_property_value_t {
-    uint32_t clusterDim[3]; ///< [in] dimensions of the cluster (units of work-group) (x, y, z). Each
-                            ///< value must be a divisor of the corresponding global work-size
-                            ///< dimension (in units of work-group).
-    int cooperative;        ///< [in] non-zero value indicates a cooperative kernel
-
-} ur_exp_launch_property_value_t;
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Kernel launch property
-///
-/// @remarks
-///   _Analogues_
-///     - **cuLaunchAttribute**
-typedef struct ur_exp_launch_property_t {
-    ur_exp_launch_property_id_t id;       ///< [in] launch property id
-    ur_exp_launch_property_value_t value; ///< [in][tagged_by(id)] launch property value
-
-} ur_exp_launch_property_t;
-
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Launch kernel with custom launch properties
+/// @brief Wait for any of a list of events to finish.
 ///
 /// @details
-///     - Launches the kernel using the specified launch properties
-///     - If numPropsInLaunchPropList == 0 then a regular kernel launch is used:
-///       `urEnqueueKernelLaunch`
-///     - Consult the appropriate adapter driver documentation for details of
-///       adapter specific behavior and native error codes that may be returned.
-///
-/// @remarks
-///   _Analogues_
-///     - **cuLaunchKernelEx**
+///     - Returns once at least one of the events of `phEventWaitList` has
+///       completed, with `pIndex` set to the index of a completed event.
+///     - The events are polled together, the calling thread backing off
+///       between polls the longer the wait lasts.
+///     - The application may call this function from simultaneous threads.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
 ///     - ::UR_RESULT_ERROR_UNINITIALIZED
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
-///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == hQueue`
-///         + `NULL == hKernel`
-///         + NULL == hQueue
-///         + NULL == hKernel
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pGlobalWorkSize`
-///         + `NULL == launchPropList`
-///         + NULL == pGlobalWorkSize
-///         + numPropsInLaunchpropList != 0 && launchPropList == NULL
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_UNINITIALIZED
-///     - ::UR_RESULT_ERROR_DEVICE_LOST
-///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
-///     - ::UR_RESULT_ERROR_INVALID_QUEUE
-///     - ::UR_RESULT_ERROR_INVALID_KERNEL
-///     - ::UR_RESULT_ERROR_INVALID_EVENT
-///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
-///         + phEventWaitList == NULL && numEventsInWaitList > 0
-///         + phEventWaitList != NULL && numEventsInWaitList == 0
-///         + If event objects in phEventWaitList are not valid events.
-///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
-///         + An event in phEventWaitList has ::UR_EVENT_STATUS_ERROR
-///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
-///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///         + `NULL == phEventWaitList`
+///         + `NULL == pIndex`
 ///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + The event at `pIndex` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
 ///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
 ///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
 UR_APIEXPORT ur_result_t UR_APICALL
-urEnqueueKernelLaunchCustomExp(
-    ur_queue_handle_t hQueue,                       ///< [in] handle of the queue object
-    ur_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
-    uint32_t workDim,                               ///< [in] number of dimensions, from 1 to 3, to specify the global and
-                                                    ///< work-group work-items
-    const size_t *pGlobalWorkSize,                  ///< [in] pointer to an array of workDim unsigned values that specify the
-                                                    ///< number of global work-items in workDim that will execute the kernel
-                                                    ///< function
-    const size_t *pLocalWorkSize,                   ///< [in][optional] pointer to an array of workDim unsigned values that
-                                                    ///< specify the number of local work-items forming a work-group that will
-                                                    ///< execute the kernel function. If nullptr, the runtime implementation
-                                                    ///< will choose the work-group size.
-    uint32_t numPropsInLaunchPropList,              ///< [in] size of the launch prop list
-    const ur_exp_launch_property_t *launchPropList, ///< [in][range(0, numPropsInLaunchPropList)] pointer to a list of launch
-                                                    ///< properties
-    uint32_t numEventsInWaitList,                   ///< [in] size of the event wait list
-    const ur_event_handle_t *phEventWaitList,       ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-                                                    ///< events that must be complete before the kernel execution. If nullptr,
-                                                    ///< the numEventsInWaitList must be 0, indicating that no wait event.
-    ur_event_handle_t *phEvent                      ///< [out][optional] return an event object that identifies this particular
-                                                    ///< kernel execution instance. If phEventWaitList and phEvent are not
-                                                    ///< NULL, phEvent must not refer to an element of the phEventWaitList
-                                                    ///< array.
+urEventWaitAnyExp(
+    uint32_t numEvents,                       ///< [in] number of events in the event list
+    const ur_event_handle_t *phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                                              ///< completion of any of
+    uint32_t *pIndex                          ///< [out] index in `phEventWaitList` of a completed event
 );
 
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
-// Intel 'oneAPI' Unified Runtime Experimental APIs for multi-device compile
+// Intel 'oneAPI' Unified Runtime Experimental APIs for enqueuing host tasks
 #if !defined(__GNUC__)
-#pragma region multi_device_compile_(experimental)
+#pragma region host_task_(experimental)
 #endif
 ///////////////////////////////////////////////////////////////////////////////
-#ifndef UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP
-/// @brief The extension string which defines support for test
-///        which is returned when querying device extensions.
-#define UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP "ur_exp_multi_device_compile"
-#endif // UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP
+/// @brief Function run on the host by a host task.
+typedef void (*ur_exp_host_task_function_t)(
+    void *pUserData ///< [in][out] pointer to data to be passed to callback
+);
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Produces an executable program from one program, negates need for the
-///        linking step.
+/// @brief Enqueue a function to be run on the host, in the order of the
+///        commands of a queue
 ///
 /// @details
-///     - The application may call this function from simultaneous threads.
-///     - Following a successful call to this entry point, the program passed
-///       will contain a binary of the ::UR_PROGRAM_BINARY_TYPE_EXECUTABLE type
-///       for each device in `phDevices`.
-///
-/// @remarks
-///   _Analogues_
-///     - **clBuildProgram**
+///     - `pfnHostTask` is run on a thread of the adapter once the commands it
+///       depends on completed, without blocking the calling thread or any
+///       other application thread.
+///     - The commands it depends on are the ones of `phEventWaitList` and, on
+///       an in-order queue, the commands enqueued to `hQueue` before it.
+///     - The commands enqueued to an in-order queue after it, and the
+///       commands waiting for `phEvent`, start once `pfnHostTask` returned.
+///     - `pfnHostTask` must not call any ur function, nor block on work
+///       enqueued to a queue.
+///     - Host tasks may be run one at a time, so long-running ones delay the
+///       others.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
@@ -9637,13 +9834,512 @@ urEnqueueKernelLaunchCustomExp(
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == hProgram`
+///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == phDevices`
-///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
-///         + If `hProgram` isn't a valid program object.
-///     - ::UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
-///         + If an error occurred when building `hProgram`.
+///         + `NULL == pfnHostTask`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support host tasks, see ::UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    ur_exp_host_task_function_t pfnHostTask,  ///< [in] function run on the host once the host task's dependencies
+                                              ///< completed
+    void *pUserData,                          ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the host task is run.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that is complete once pfnHostTask
+                                              ///< returned.
+                                              ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+                                              ///< an element of the phEventWaitList array.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for events shared between
+// processes
+#if !defined(__GNUC__)
+#pragma region ipc_event_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief IPC handle of an event, which another process opens with
+///        ::urEventOpenIPCHandleExp
+typedef struct ur_exp_ipc_event_handle_t {
+    uint8_t data[128]; ///< [out] opaque data of the handle, which the application copies as is
+
+} ur_exp_ipc_event_handle_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create an event which can be shared with other processes
+///
+/// @details
+///     - The event is signaled by ::urEnqueueIPCEventSignalExp and waited for
+///       by ::urEnqueueIPCEventWaitExp, from queues of this process or of the
+///       processes which opened its IPC handle.
+///     - The event must not be passed to any other function than these two,
+///       ::urEventGetIPCHandleExp, ::urEventRetain and ::urEventRelease.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device of the queues signaling and waiting for the
+                                  ///< event
+    ur_event_handle_t *phEvent    ///< [out] pointer to the handle of the event object created
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the IPC handle of an event, for another process to open it
+///
+/// @details
+///     - The handle is valid for as long as the event isn't released, and may
+///       be sent to other processes by any means.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hEvent`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pIPCHandle`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hEvent` wasn't created with ::urEventCreateIPCExp.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventGetIPCHandleExp(
+    ur_event_handle_t hEvent,             ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *pIPCHandle ///< [out] pointer to the IPC handle of the event
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Open the IPC handle of an event created by another process
+///
+/// @details
+///     - The event returned can be used as the one created with
+///       ::urEventCreateIPCExp, except that its IPC handle can't be taken.
+///     - Releasing the event closes the handle, the event of the other
+///       process remains valid.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pIPCHandle`
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If `pIPCHandle` can't be opened, for instance because it comes from this process.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext,                ///< [in] handle of the context object
+    ur_device_handle_t hDevice,                  ///< [in] handle of the device of the queues signaling and waiting for the
+                                                 ///< event
+    const ur_exp_ipc_event_handle_t *pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                                                 ///< another process
+    ur_event_handle_t *phEvent                   ///< [out] pointer to the handle of the event object created
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command signaling an IPC event
+///
+/// @details
+///     - The event is signaled on the device once the commands the command
+///       depends on completed, without the host waiting for them.
+///     - Each signal is meant for one ::urEnqueueIPCEventWaitExp, which the
+///       application enqueues after this one, for instance once it has told
+///       the other process that it enqueued the signal.
+///     - The event must not be signaled again until that wait completed.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hIPCEvent`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hIPCEvent` wasn't created with ::urEventCreateIPCExp or ::urEventOpenIPCHandleExp.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent,              ///< [in] handle of the IPC event to signal
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the IPC event is signaled.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+                                              ///< events.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies this particular
+                                              ///< command instance.
+                                              ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+                                              ///< an element of the phEventWaitList array.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command waiting for an IPC event to be signaled
+///
+/// @details
+///     - The commands depending on this one start once the last
+///       ::urEnqueueIPCEventSignalExp of the event enqueued before it, in
+///       this or another process, completed on the device.
+///     - The host doesn't wait for the signal.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hIPCEvent`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hIPCEvent` wasn't created with ::urEventCreateIPCExp or ::urEventOpenIPCHandleExp.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent,              ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the command starts waiting.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+                                              ///< events.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that is complete once the IPC
+                                              ///< event was signaled.
+                                              ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+                                              ///< an element of the phEventWaitList array.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for setting many kernel arguments at once
+#if !defined(__GNUC__)
+#pragma region kernel_set_args_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specifies how a kernel argument is set
+typedef enum ur_exp_kernel_arg_type_t {
+    UR_EXP_KERNEL_ARG_TYPE_VALUE = 0,   ///< The argument is set as by ::urKernelSetArgValue
+    UR_EXP_KERNEL_ARG_TYPE_POINTER = 1, ///< The argument is set as by ::urKernelSetArgPointer
+    UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ = 2, ///< The argument is set as by ::urKernelSetArgMemObj
+    UR_EXP_KERNEL_ARG_TYPE_LOCAL = 3,   ///< The argument is set as by ::urKernelSetArgLocal
+    UR_EXP_KERNEL_ARG_TYPE_SAMPLER = 4, ///< The argument is set as by ::urKernelSetArgSampler
+    /// @cond
+    UR_EXP_KERNEL_ARG_TYPE_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_kernel_arg_type_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief A memory object kernel argument and its access flags
+typedef struct ur_exp_kernel_arg_mem_obj_tuple_t {
+    ur_mem_handle_t hMem; ///< [in][optional] handle of the memory object
+    ur_mem_flags_t flags; ///< [in] memory flags of the argument, as the `memoryAccess` member of
+                          ///< ::ur_kernel_arg_mem_obj_properties_t. Zero for the default access.
+
+} ur_exp_kernel_arg_mem_obj_tuple_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specifies the value of a kernel argument
+typedef union ur_exp_kernel_arg_value_t {
+    const void *value;                             ///< [in] pointer to the argument value, of the size of the argument
+    const void *pointer;                           ///< [in][optional] USM pointer passed to the kernel
+    ur_exp_kernel_arg_mem_obj_tuple_t memObjTuple; ///< [in] memory object passed to the kernel
+    ur_sampler_handle_t sampler;                   ///< [in] handle of the sampler passed to the kernel
+
+} ur_exp_kernel_arg_value_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Describes a kernel argument to set
+typedef struct ur_exp_kernel_arg_t {
+    ur_exp_kernel_arg_type_t type;   ///< [in] how the argument is set
+    uint32_t index;                  ///< [in] argument index in range [0, num args - 1]
+    size_t size;                     ///< [in] size of the argument value for ::UR_EXP_KERNEL_ARG_TYPE_VALUE,
+                                     ///< size of the local memory for ::UR_EXP_KERNEL_ARG_TYPE_LOCAL, ignored
+                                     ///< otherwise
+    ur_exp_kernel_arg_value_t value; ///< [in][tagged_by(type)] argument value, unused for
+                                     ///< ::UR_EXP_KERNEL_ARG_TYPE_LOCAL
+
+} ur_exp_kernel_arg_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Set many arguments of a kernel at once
+///
+/// @details
+///     - Each element of `pArgs` sets an argument with the semantics of the
+///       entry-point its `type` names, the arguments being set in order.
+///     - Adapters take the locks of the kernel once for the whole batch, so
+///       setting the arguments of a kernel with many arguments costs one call
+///       instead of one per argument.
+///     - If an argument can't be set, the arguments before it are set and the
+///       arguments after it aren't.
+///     - The application may call this function from simultaneous threads with
+///       the same kernel handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pArgs`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numArgs == 0`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SAMPLER
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `pArgs[i].type > ::UR_EXP_KERNEL_ARG_TYPE_SAMPLER`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel,           ///< [in] handle of the kernel object
+    uint32_t numArgs,                     ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+                                          ///< set
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for (kernel) Launch Properties
+#if !defined(__GNUC__)
+#pragma region launch_properties_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP
+/// @brief The extension string that defines support for the Launch Properties
+///        extension, which is returned when querying device extensions.
+#define UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP "ur_exp_launch_properties"
+#endif // UR_LAUNCH_PROPERTIES_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specifies a launch property id
+///
+/// @remarks
+///   _Analogues_
+///     - **CUlaunchAttributeID**
+typedef enum ur_exp_launch_property_id_t {
+    UR_EXP_LAUNCH_PROPERTY_ID_IGNORE = 0,            ///< The property has no effect
+    UR_EXP_LAUNCH_PROPERTY_ID_COOPERATIVE = 1,       ///< Whether to launch a cooperative kernel
+    UR_EXP_LAUNCH_PROPERTY_ID_CLUSTER_DIMENSION = 2, ///< work-group cluster dimensions
+    /// @cond
+    UR_EXP_LAUNCH_PROPERTY_ID_FORCE_UINT32 = 0x7fffffff
+    /// @endcond
+
+} ur_exp_launch_property_id_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Specifies a launch property value
+///
+/// @remarks
+///   _Analogues_
+///     - **CUlaunchAttributeValue**
+typedef union ur_exp_launch_property_value_t {
+    uint32_t clusterDim[3]; ///< [in] dimensions of the cluster (units of work-group) (x, y, z). Each
+                            ///< value must be a divisor of the corresponding global work-size
+                            ///< dimension (in units of work-group).
+    int cooperative;        ///< [in] non-zero value indicates a cooperative kernel
+
+} ur_exp_launch_property_value_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Kernel launch property
+///
+/// @remarks
+///   _Analogues_
+///     - **cuLaunchAttribute**
+typedef struct ur_exp_launch_property_t {
+    ur_exp_launch_property_id_t id;       ///< [in] launch property id
+    ur_exp_launch_property_value_t value; ///< [in][tagged_by(id)] launch property value
+
+} ur_exp_launch_property_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Launch kernel with custom launch properties
+///
+/// @details
+///     - Launches the kernel using the specified launch properties
+///     - If numPropsInLaunchPropList == 0 then a regular kernel launch is used:
+///       `urEnqueueKernelLaunch`
+///     - Consult the appropriate adapter driver documentation for details of
+///       adapter specific behavior and native error codes that may be returned.
+///
+/// @remarks
+///   _Analogues_
+///     - **cuLaunchKernelEx**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hKernel`
+///         + NULL == hQueue
+///         + NULL == hKernel
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pGlobalWorkSize`
+///         + `NULL == launchPropList`
+///         + NULL == pGlobalWorkSize
+///         + numPropsInLaunchpropList != 0 && launchPropList == NULL
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + phEventWaitList == NULL && numEventsInWaitList > 0
+///         + phEventWaitList != NULL && numEventsInWaitList == 0
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in phEventWaitList has ::UR_EVENT_STATUS_ERROR
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchCustomExp(
+    ur_queue_handle_t hQueue,                       ///< [in] handle of the queue object
+    ur_kernel_handle_t hKernel,                     ///< [in] handle of the kernel object
+    uint32_t workDim,                               ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                                                    ///< work-group work-items
+    const size_t *pGlobalWorkSize,                  ///< [in] pointer to an array of workDim unsigned values that specify the
+                                                    ///< number of global work-items in workDim that will execute the kernel
+                                                    ///< function
+    const size_t *pLocalWorkSize,                   ///< [in][optional] pointer to an array of workDim unsigned values that
+                                                    ///< specify the number of local work-items forming a work-group that will
+                                                    ///< execute the kernel function. If nullptr, the runtime implementation
+                                                    ///< will choose the work-group size.
+    uint32_t numPropsInLaunchPropList,              ///< [in] size of the launch prop list
+    const ur_exp_launch_property_t *launchPropList, ///< [in][range(0, numPropsInLaunchPropList)] pointer to a list of launch
+                                                    ///< properties
+    uint32_t numEventsInWaitList,                   ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList,       ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                                    ///< events that must be complete before the kernel execution. If nullptr,
+                                                    ///< the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *phEvent                      ///< [out][optional] return an event object that identifies this particular
+                                                    ///< kernel execution instance. If phEventWaitList and phEvent are not
+                                                    ///< NULL, phEvent must not refer to an element of the phEventWaitList
+                                                    ///< array.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for the enumeration cache of the loader
+#if !defined(__GNUC__)
+#pragma region loader_enumeration_cache_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Forget the platforms and devices the loader has enumerated
+///
+/// @details
+///     - The loader keeps the platforms returned by ::urPlatformGet and the
+///       devices returned by ::urDeviceGet, so that each adapter is asked for
+///       them once. After this call, the next calls ask the adapters again,
+///       such as after devices were plugged or unplugged.
+///     - Handles returned before this call remain valid.
+///     - Adapters which enumerate their devices once may not report devices
+///       plugged afterwards.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///         + If the loader isn't initialized.
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+UR_APIEXPORT ur_result_t UR_APICALL
+urLoaderInvalidateEnumerationCacheExp(
+    void);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for multi-device compile
+#if !defined(__GNUC__)
+#pragma region multi_device_compile_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+#ifndef UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP
+/// @brief The extension string which defines support for test
+///        which is returned when querying device extensions.
+#define UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP "ur_exp_multi_device_compile"
+#endif // UR_MULTI_DEVICE_COMPILE_EXTENSION_STRING_EXP
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Produces an executable program from one program, negates need for the
+///        linking step.
+///
+/// @details
+///     - The application may call this function from simultaneous threads.
+///     - Following a successful call to this entry point, the program passed
+///       will contain a binary of the ::UR_PROGRAM_BINARY_TYPE_EXECUTABLE type
+///       for each device in `phDevices`.
+///
+/// @remarks
+///   _Analogues_
+///     - **clBuildProgram**
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hProgram`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phDevices`
+///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
+///         + If `hProgram` isn't a valid program object.
+///     - ::UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
+///         + If an error occurred when building `hProgram`.
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramBuildExp(
     ur_program_handle_t hProgram,  ///< [in] Handle of the program to build.
@@ -9723,14 +10419,408 @@ urProgramCompileExp(
 ///     - ::UR_RESULT_ERROR_PROGRAM_LINK_FAILURE
 ///         + If an error occurred while linking `phPrograms`.
 UR_APIEXPORT ur_result_t UR_APICALL
-urProgramLinkExp(
-    ur_context_handle_t hContext,          ///< [in] handle of the context instance.
-    uint32_t numDevices,                   ///< [in] number of devices
-    ur_device_handle_t *phDevices,         ///< [in][range(0, numDevices)] pointer to array of device handles
-    uint32_t count,                        ///< [in] number of program handles in `phPrograms`.
-    const ur_program_handle_t *phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
-    const char *pOptions,                  ///< [in][optional] pointer to linker options null-terminated string.
-    ur_program_handle_t *phProgram         ///< [out] pointer to handle of program object created.
+urProgramLinkExp(
+    ur_context_handle_t hContext,          ///< [in] handle of the context instance.
+    uint32_t numDevices,                   ///< [in] number of devices
+    ur_device_handle_t *phDevices,         ///< [in][range(0, numDevices)] pointer to array of device handles
+    uint32_t count,                        ///< [in] number of program handles in `phPrograms`.
+    const ur_program_handle_t *phPrograms, ///< [in][range(0, count)] pointer to array of program handles.
+    const char *pOptions,                  ///< [in][optional] pointer to linker options null-terminated string.
+    ur_program_handle_t *phProgram         ///< [out] pointer to handle of program object created.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for launching kernels on many queues at once
+#if !defined(__GNUC__)
+#pragma region multi_queue_launch_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Describes a kernel launch of a batch
+typedef struct ur_exp_kernel_launch_t {
+    ur_queue_handle_t hQueue;                 ///< [in] handle of the queue the kernel is launched on
+    ur_kernel_handle_t hKernel;               ///< [in] handle of the kernel object
+    uint32_t workDim;                         ///< [in] number of dimensions, from 1 to 3, to specify the global and
+                                              ///< work-group work-items
+    const size_t *pGlobalWorkOffset;          ///< [in][optional][range(0, workDim)] pointer to an array of workDim
+                                              ///< unsigned values that specify the offset used to calculate the global
+                                              ///< ID of a work-item
+    const size_t *pGlobalWorkSize;            ///< [in][range(0, workDim)] pointer to an array of workDim unsigned values
+                                              ///< that specify the number of global work-items in workDim that will
+                                              ///< execute the kernel function
+    const size_t *pLocalWorkSize;             ///< [in][optional][range(0, workDim)] pointer to an array of workDim
+                                              ///< unsigned values that specify the number of local work-items forming a
+                                              ///< work-group that will execute the kernel function. If nullptr, the
+                                              ///< runtime implementation will choose the work-group size.
+    uint32_t numArgs;                         ///< [in] number of kernel arguments set before the launch
+    const ur_exp_kernel_arg_t *pArgs;         ///< [in][optional][range(0, numArgs)] arguments set as by
+                                              ///< ::urKernelSetArgsExp before the launch
+    uint32_t numEventsInWaitList;             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList; ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the kernel execution. If nullptr,
+                                              ///< the numEventsInWaitList must be 0, indicating that no wait event.
+    ur_event_handle_t *phEvent;               ///< [out][optional] return an event object that identifies this
+                                              ///< particular kernel execution instance.
+
+} ur_exp_kernel_launch_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Launch kernels on many queues at once
+///
+/// @details
+///     - Each element of `pLaunches` sets the arguments it lists on its kernel,
+///       as ::urKernelSetArgsExp, then launches the kernel on its queue, as
+///       ::urEnqueueKernelLaunch.
+///     - The launches are made in order, so a kernel launched several times in
+///       the batch takes the arguments of each launch in turn.
+///     - If a launch fails, the launches before it have been enqueued and the
+///       ones after it haven't.
+///     - All the queues must belong to the same adapter.
+///     - Adapters take the locks of the queues shared by consecutive launches
+///       once, and batch the submissions of the launches where the driver
+///       allows.
+///     - A launch listing every argument of its kernel may set them on a copy
+///       of the kernel instead, which leaves the arguments of the kernel
+///       unchanged, so that launches of one kernel from several threads don't
+///       have to be serialized.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pLaunches`
+///         + `NULL == pLaunches[i].pGlobalWorkSize`
+///         + `pLaunches[i].numArgs != 0 && NULL == pLaunches[i].pArgs`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numLaunches == 0`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == pLaunches[i].hQueue`
+///         + `NULL == pLaunches[i].hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `pLaunches[i].phEventWaitList == NULL && pLaunches[i].numEventsInWaitList > 0`
+///         + `pLaunches[i].phEventWaitList != NULL && pLaunches[i].numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches,                   ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                                            ///< launches
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for building programs asynchronously
+#if !defined(__GNUC__)
+#pragma region program_build_async_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Produces an executable program from one program without blocking
+///        the calling thread
+///
+/// @details
+///     - The build is the one ::urProgramBuild makes, run in the background
+///       where the adapter supports it and before the function returns
+///       otherwise.
+///     - `phEvent` signals the end of the build. It may be waited on with
+///       ::urEventWait and used in the wait lists of commands on any queue of
+///       the context of `hQueue`, such as the launches of the kernels of
+///       `hProgram`.
+///     - The command status of `phEvent` is an error if the build failed, the
+///       build log being available with ::urProgramGetBuildInfo.
+///     - Commands enqueued on `hQueue` after this call may wait for the build
+///       to complete, as they would for any other command.
+///     - The application must not use `hProgram` until `phEvent` has
+///       completed, other than to release it.
+///     - The application may call this function from simultaneous threads.
+///
+/// @remarks
+///   _Analogues_
+///     - **clBuildProgram** with a notification callback
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hProgram`
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
+///         + If `hProgram` isn't a valid program object.
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///         + If `hProgram` and `hQueue` don't belong to the same context.
+///     - ::UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
+///         + If the adapter built `hProgram` before returning and the build
+///           failed.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue `phEvent` is associated with
+    const char *pOptions,         ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *phEvent    ///< [out] return an event object that signals the end of the build.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for capturing the commands of a queue into a command-buffer
+#if !defined(__GNUC__)
+#pragma region queue_capture_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Begin capturing the commands enqueued to a queue.
+///
+/// @details
+///     - Completes the commands already enqueued to `hQueue`, then captures
+///       the commands enqueued to it until ::urQueueEndCaptureExp is called,
+///       instead of submitting them.
+///     - The captured commands execute in the order they are enqueued,
+///       whatever the properties of `hQueue`.
+///     - The events returned by captured commands may only be used in the
+///       wait lists of other commands captured from the same queue, and must
+///       not be waited on or queried.
+///     - Blocking commands and ::urQueueFinish must not be called on `hQueue`
+///       while it is capturing.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same queue handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + `hQueue` is already capturing.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + The adapter can't capture the commands of queues.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueBeginCaptureExp(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to capture the commands of
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief End capturing the commands enqueued to a queue.
+///
+/// @details
+///     - Returns a command-buffer replaying the commands captured since
+///       ::urQueueBeginCaptureExp, and submits the commands enqueued to
+///       `hQueue` afterwards again.
+///     - The command-buffer is finalized, commands can't be appended to it,
+///       and is enqueued with ::urCommandBufferEnqueueExp.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same queue handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phCommandBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + `hQueue` isn't capturing.
+///         + A command invalid during a capture was enqueued to `hQueue`.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + The adapter can't capture the commands of queues.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueEndCaptureExp(
+    ur_queue_handle_t hQueue,                       ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                                                    ///< commands
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Queue-Ordered USM Allocation Extension APIs
+#if !defined(__GNUC__)
+#pragma region usm_async_alloc_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue an allocation of USM device memory
+///
+/// @details
+///     - The memory may be used by the commands enqueued to `hQueue` after this
+///       one, and by the other commands once the returned event is complete.
+///     - The memory may be reused from the allocations freed earlier with
+///       ::urEnqueueUSMFreeExp on the same queue, without synchronizing with
+///       the device.
+///     - The memory is allocated on the device of `hQueue`, and may be freed
+///       with ::urEnqueueUSMFreeExp or ::urUSMFree.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support queue-ordered allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    size_t size,                              ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the memory can be used.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem,                             ///< [out] pointer to USM device memory object
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies the allocation.
+                                              ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+                                              ///< an element of the phEventWaitList array.
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a free of USM memory
+///
+/// @details
+///     - The memory is freed once the commands enqueued to `hQueue` before this
+///       one, and the events of the wait list, are complete.
+///     - The memory must not be used by the commands enqueued after this one.
+///     - The memory may be reused by the later allocations of
+///       ::urEnqueueUSMDeviceAllocExp on the same queue.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support queue-ordered allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    void *pMem,                               ///< [in] pointer to USM memory object
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before the memory can be freed.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that identifies the free. If
+                                              ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+                                              ///< an element of the phEventWaitList array.
+);
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Growable USM Allocation Extension APIs
+#if !defined(__GNUC__)
+#pragma region usm_growable_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocate USM device memory which can grow in place
+///
+/// @details
+///     - Reserves `maxSize` bytes of virtual address space on the device, of
+///       which only the first `size` bytes are backed by physical memory.
+///     - The allocation can be grown with ::urUSMGrowExp up to `maxSize`
+///       bytes without its address changing and without its content being
+///       copied.
+///     - The memory is freed with ::urUSMFree.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `maxSize == 0`
+///         + `size > maxSize`
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support virtual memory.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t maxSize,               ///< [in] size in bytes of the address range reserved for the allocation
+    size_t size,                  ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem                  ///< [out] pointer to USM device memory object
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Grow the memory backing a growable USM allocation
+///
+/// @details
+///     - Backs at least the first `size` bytes of the allocation with physical
+///       memory, which is never copied: the content of the allocation and its
+///       address are preserved.
+///     - Allocations never shrink, growing an allocation to a size it already
+///       has does nothing.
+///     - The memory already backing the allocation may be accessed by the
+///       device and the host while the allocation grows.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If `pMem` wasn't allocated with ::urUSMGrowableAllocExp.
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + If `size` is larger than the `maxSize` the allocation was made with.
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support growable allocations.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size                   ///< [in] size in bytes the allocation must be backed for
 );
 
 #if !defined(__GNUC__)
@@ -9786,6 +10876,67 @@ urUSMReleaseExp(
     void *pMem                    ///< [in] pointer to host memory object
 );
 
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' Unified Runtime Experimental APIs for batched USM copies
+#if !defined(__GNUC__)
+#pragma region usm_memcpy_batch_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to copy a batch of USM memory blocks
+///
+/// @details
+///     - Copies `pSizes[i]` bytes from `ppSrc[i]` to `ppDst[i]`, for each `i`
+///       below `numCopies`, as a single command of the queue with a single
+///       event.
+///     - The copies may run concurrently and in any order. No destination
+///       block may overlap another block of the batch.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppDst`
+///         + `NULL == ppSrc`
+///         + `NULL == pSizes`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numCopies == 0`
+///         + If any of `pSizes` is 0, or higher than the allocation size of its block
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue,                 ///< [in] handle of the queue object
+    bool blocking,                            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,                       ///< [in] number of blocks to copy
+    void **ppDst,                             ///< [in][range(0, numCopies)] pointers to the destination USM memory
+                                              ///< blocks
+    const void **ppSrc,                       ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *pSizes,                     ///< [in][range(0, numCopies)] sizes in bytes of the blocks
+    uint32_t numEventsInWaitList,             ///< [in] size of the event wait list
+    const ur_event_handle_t *phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+                                              ///< events that must be complete before this command can be executed.
+                                              ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+                                              ///< command does not wait on any event to complete.
+    ur_event_handle_t *phEvent                ///< [out][optional] return an event object that is complete once all the
+                                              ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+                                              ///< phEvent must not refer to an element of the phEventWaitList array.
+);
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -9942,6 +11093,97 @@ urUsmP2PPeerAccessGetInfoExp(
     size_t *pPropSizeRet              ///< [out][optional] pointer to the actual size in bytes of the queried propName.
 );
 
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' USM Host NUMA Placement Extension APIs
+#if !defined(__GNUC__)
+#pragma region usm_host_numa_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief USM host allocation NUMA placement descriptor type
+///
+/// @details
+///     - Specify these properties in ::urUSMHostAlloc via ::ur_usm_desc_t as
+///       part of a `pNext` chain.
+///     - The pages of the allocation are placed on NUMA node `numaNode` of the
+///       host, such as the one ::UR_DEVICE_INFO_HOST_NUMA_NODE_EXP returns for
+///       the device which will access them most.
+///     - The placement is a hint, the pages being placed as without this
+///       structure if the adapter or the system can't place them.
+typedef struct ur_exp_usm_host_numa_desc_t {
+    ur_structure_type_t stype; ///< [in] type of this structure, must be
+                               ///< ::UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC
+    const void *pNext;         ///< [in][optional] pointer to extension-specific structure
+    uint32_t numaNode;         ///< [in] NUMA node of the host to place the pages of the allocation on
+
+} ur_exp_usm_host_numa_desc_t;
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' USM Pool Arena Extension APIs
+#if !defined(__GNUC__)
+#pragma region usm_pool_arena_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief USM pool device arena descriptor type
+///
+/// @details
+///     - Specify these properties in ::urUSMPoolCreate via ::ur_usm_pool_desc_t
+///       as part of a `pNext` chain.
+///     - The pool allocates `size` bytes of device memory up front for each
+///       device of the context, and carves its device allocations out of it.
+///     - Device allocations which don't fit in the arena are served by the
+///       pool as usual.
+typedef struct ur_exp_usm_pool_arena_desc_t {
+    ur_structure_type_t stype; ///< [in] type of this structure, must be
+                               ///< ::UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC
+    const void *pNext;         ///< [in][optional] pointer to extension-specific structure
+    size_t size;               ///< [in] size in bytes of the arena of each device, rounded up to a multiple
+                               ///< of `pageSize`
+    size_t pageSize;           ///< [in] size in bytes of the pages backing the arena, a power of two such
+                               ///< as 64KB or 2MB, or 0 to let the adapter choose
+
+} ur_exp_usm_pool_arena_desc_t;
+
+#if !defined(__GNUC__)
+#pragma endregion
+#endif
+// Intel 'oneAPI' USM Pool Trim Extension APIs
+#if !defined(__GNUC__)
+#pragma region usm_pool_trim_(experimental)
+#endif
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release the free memory cached by USM pools
+///
+/// @details
+///     - Returns the free memory kept by the pool for reuse to the device,
+///       until at most `minBytesToKeep` bytes are left cached.
+///     - If `hPool` is NULL, the pools of the context, including the pools
+///       used by ::urUSMHostAlloc, ::urUSMDeviceAlloc and ::urUSMSharedAlloc
+///       when no pool is given, are trimmed instead and share the
+///       `minBytesToKeep` budget.
+///     - Memory which is still allocated is never released.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter can't release the memory cached by its pools.
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t hPool,   ///< [in][optional] handle of the USM memory pool to trim
+    size_t minBytesToKeep         ///< [in] number of bytes of free memory which may be left cached
+);
+
 #if !defined(__GNUC__)
 #pragma endregion
 #endif
@@ -10301,6 +11543,46 @@ typedef struct ur_event_set_callback_params_t {
     void **ppUserData;
 } ur_event_set_callback_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventWaitAnyExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_wait_any_exp_params_t {
+    uint32_t *pnumEvents;
+    const ur_event_handle_t **pphEventWaitList;
+    uint32_t **ppIndex;
+} ur_event_wait_any_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventCreateIPCExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_create_ipc_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_device_handle_t *phDevice;
+    ur_event_handle_t **pphEvent;
+} ur_event_create_ipc_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventGetIPCHandleExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_get_ipc_handle_exp_params_t {
+    ur_event_handle_t *phEvent;
+    ur_exp_ipc_event_handle_t **ppIPCHandle;
+} ur_event_get_ipc_handle_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEventOpenIPCHandleExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_event_open_ipc_handle_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_device_handle_t *phDevice;
+    const ur_exp_ipc_event_handle_t **ppIPCHandle;
+    ur_event_handle_t **pphEvent;
+} ur_event_open_ipc_handle_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urProgramCreateWithIL
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10394,6 +11676,17 @@ typedef struct ur_program_link_exp_params_t {
     ur_program_handle_t **pphProgram;
 } ur_program_link_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urProgramBuildAsyncExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_program_build_async_exp_params_t {
+    ur_program_handle_t *phProgram;
+    ur_queue_handle_t *phQueue;
+    const char **ppOptions;
+    ur_event_handle_t **pphEvent;
+} ur_program_build_async_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urProgramRetain
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10675,6 +11968,16 @@ typedef struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t {
     uint32_t **ppGroupCountRet;
 } ur_kernel_suggest_max_cooperative_group_count_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urKernelSetArgsExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_kernel_set_args_exp_params_t {
+    ur_kernel_handle_t *phKernel;
+    uint32_t *pnumArgs;
+    const ur_exp_kernel_arg_t **ppArgs;
+} ur_kernel_set_args_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urQueueGetInfo
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -10752,6 +12055,23 @@ typedef struct ur_queue_flush_params_t {
     ur_queue_handle_t *phQueue;
 } ur_queue_flush_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueBeginCaptureExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_begin_capture_exp_params_t {
+    ur_queue_handle_t *phQueue;
+} ur_queue_begin_capture_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urQueueEndCaptureExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_queue_end_capture_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    ur_exp_command_buffer_handle_t **pphCommandBuffer;
+} ur_queue_end_capture_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urSamplerCreate
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11445,6 +12765,40 @@ typedef struct ur_enqueue_timestamp_recording_exp_params_t {
     ur_event_handle_t **pphEvent;
 } ur_enqueue_timestamp_recording_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueKernelLaunchMultiExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_kernel_launch_multi_exp_params_t {
+    uint32_t *pnumLaunches;
+    const ur_exp_kernel_launch_t **ppLaunches;
+} ur_enqueue_kernel_launch_multi_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueUSMDeviceAllocExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_usm_device_alloc_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    size_t *psize;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    void ***pppMem;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_usm_device_alloc_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueUSMFreeExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_usm_free_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    void **ppMem;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_usm_free_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urEnqueueNativeCommandExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11461,6 +12815,59 @@ typedef struct ur_enqueue_native_command_exp_params_t {
     ur_event_handle_t **pphEvent;
 } ur_enqueue_native_command_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueHostTaskExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_host_task_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    ur_exp_host_task_function_t *ppfnHostTask;
+    void **ppUserData;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_host_task_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueIPCEventSignalExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_ipc_event_signal_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    ur_event_handle_t *phIPCEvent;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_ipc_event_signal_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueIPCEventWaitExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_ipc_event_wait_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    ur_event_handle_t *phIPCEvent;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_ipc_event_wait_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urEnqueueUSMMemcpyBatchExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_enqueue_usm_memcpy_batch_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    bool *pblocking;
+    uint32_t *pnumCopies;
+    void ***pppDst;
+    const void ***pppSrc;
+    const size_t **ppSizes;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_enqueue_usm_memcpy_batch_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urBindlessImagesUnsampledImageHandleDestroyExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11549,6 +12956,26 @@ typedef struct ur_bindless_images_image_copy_exp_params_t {
     ur_event_handle_t **pphEvent;
 } ur_bindless_images_image_copy_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urBindlessImagesImageCopyBatchExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_bindless_images_image_copy_batch_exp_params_t {
+    ur_queue_handle_t *phQueue;
+    const void **ppSrc;
+    void **ppDst;
+    const ur_image_desc_t **ppSrcImageDesc;
+    const ur_image_desc_t **ppDstImageDesc;
+    const ur_image_format_t **ppSrcImageFormat;
+    const ur_image_format_t **ppDstImageFormat;
+    uint32_t *pnumCopyRegions;
+    const ur_exp_image_copy_region_t **ppCopyRegions;
+    ur_exp_image_copy_flags_t *pimageCopyFlags;
+    uint32_t *pnumEventsInWaitList;
+    const ur_event_handle_t **pphEventWaitList;
+    ur_event_handle_t **pphEvent;
+} ur_bindless_images_image_copy_batch_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urBindlessImagesImageGetInfoExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11796,6 +13223,28 @@ typedef struct ur_usm_pitched_alloc_exp_params_t {
     size_t **ppResultPitch;
 } ur_usm_pitched_alloc_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMGrowableAllocExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_growable_alloc_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_device_handle_t *phDevice;
+    size_t *pmaxSize;
+    size_t *psize;
+    void ***pppMem;
+} ur_usm_growable_alloc_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMGrowExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_grow_exp_params_t {
+    ur_context_handle_t *phContext;
+    void **ppMem;
+    size_t *psize;
+} ur_usm_grow_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urUSMImportExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -11815,6 +13264,16 @@ typedef struct ur_usm_release_exp_params_t {
     void **ppMem;
 } ur_usm_release_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urUSMPoolTrimExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_usm_pool_trim_exp_params_t {
+    ur_context_handle_t *phContext;
+    ur_usm_pool_handle_t *phPool;
+    size_t *pminBytesToKeep;
+} ur_usm_pool_trim_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urCommandBufferCreateExp
 /// @details Each entry is a pointer to the parameter passed to the function;
@@ -12175,6 +13634,26 @@ typedef struct ur_command_buffer_command_get_info_exp_params_t {
     size_t **ppPropSizeRet;
 } ur_command_buffer_command_get_info_exp_params_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urCommandBufferUpdateKernelLaunchBatchExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_command_buffer_update_kernel_launch_batch_exp_params_t {
+    ur_exp_command_buffer_handle_t *phCommandBuffer;
+    uint32_t *pnumKernelUpdates;
+    const ur_exp_command_buffer_command_handle_t **pphCommands;
+    const ur_exp_command_buffer_update_kernel_launch_desc_t **ppUpdateKernelLaunch;
+} ur_command_buffer_update_kernel_launch_batch_exp_params_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function parameters for urCommandBufferUploadExp
+/// @details Each entry is a pointer to the parameter passed to the function;
+///     allowing the callback the ability to modify the parameter's value
+typedef struct ur_command_buffer_upload_exp_params_t {
+    ur_exp_command_buffer_handle_t *phCommandBuffer;
+    ur_queue_handle_t *phQueue;
+} ur_command_buffer_upload_exp_params_t;
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function parameters for urUsmP2PEnablePeerAccessExp
 /// @details Each entry is a pointer to the parameter passed to the function;
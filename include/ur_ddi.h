@@ -271,6 +271,64 @@ typedef ur_result_t(UR_APICALL *ur_pfnGetEventProcAddrTable_t)(
     ur_api_version_t,
     ur_event_dditable_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventWaitAnyExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventWaitAnyExp_t)(
+    uint32_t,
+    const ur_event_handle_t *,
+    uint32_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventCreateIPCExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventCreateIPCExp_t)(
+    ur_context_handle_t,
+    ur_device_handle_t,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventGetIPCHandleExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventGetIPCHandleExp_t)(
+    ur_event_handle_t,
+    ur_exp_ipc_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEventOpenIPCHandleExp
+typedef ur_result_t(UR_APICALL *ur_pfnEventOpenIPCHandleExp_t)(
+    ur_context_handle_t,
+    ur_device_handle_t,
+    const ur_exp_ipc_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of EventExp functions pointers
+typedef struct ur_event_exp_dditable_t {
+    ur_pfnEventWaitAnyExp_t pfnWaitAnyExp;
+    ur_pfnEventCreateIPCExp_t pfnCreateIPCExp;
+    ur_pfnEventGetIPCHandleExp_t pfnGetIPCHandleExp;
+    ur_pfnEventOpenIPCHandleExp_t pfnOpenIPCHandleExp;
+} ur_event_exp_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetEventExpProcAddrTable(
+    ur_api_version_t version,          ///< [in] API version requested
+    ur_event_exp_dditable_t *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urGetEventExpProcAddrTable
+typedef ur_result_t(UR_APICALL *ur_pfnGetEventExpProcAddrTable_t)(
+    ur_api_version_t,
+    ur_event_exp_dditable_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urProgramCreateWithIL
 typedef ur_result_t(UR_APICALL *ur_pfnProgramCreateWithIL_t)(
@@ -447,12 +505,21 @@ typedef ur_result_t(UR_APICALL *ur_pfnProgramLinkExp_t)(
     const char *,
     ur_program_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urProgramBuildAsyncExp
+typedef ur_result_t(UR_APICALL *ur_pfnProgramBuildAsyncExp_t)(
+    ur_program_handle_t,
+    ur_queue_handle_t,
+    const char *,
+    ur_event_handle_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of ProgramExp functions pointers
 typedef struct ur_program_exp_dditable_t {
     ur_pfnProgramBuildExp_t pfnBuildExp;
     ur_pfnProgramCompileExp_t pfnCompileExp;
     ur_pfnProgramLinkExp_t pfnLinkExp;
+    ur_pfnProgramBuildAsyncExp_t pfnBuildAsyncExp;
 } ur_program_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -654,10 +721,18 @@ typedef ur_result_t(UR_APICALL *ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t
     size_t,
     uint32_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urKernelSetArgsExp
+typedef ur_result_t(UR_APICALL *ur_pfnKernelSetArgsExp_t)(
+    ur_kernel_handle_t,
+    uint32_t,
+    const ur_exp_kernel_arg_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of KernelExp functions pointers
 typedef struct ur_kernel_exp_dditable_t {
     ur_pfnKernelSuggestMaxCooperativeGroupCountExp_t pfnSuggestMaxCooperativeGroupCountExp;
+    ur_pfnKernelSetArgsExp_t pfnSetArgsExp;
 } ur_kernel_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -768,6 +843,45 @@ typedef ur_result_t(UR_APICALL *ur_pfnGetQueueProcAddrTable_t)(
     ur_api_version_t,
     ur_queue_dditable_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urQueueBeginCaptureExp
+typedef ur_result_t(UR_APICALL *ur_pfnQueueBeginCaptureExp_t)(
+    ur_queue_handle_t);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urQueueEndCaptureExp
+typedef ur_result_t(UR_APICALL *ur_pfnQueueEndCaptureExp_t)(
+    ur_queue_handle_t,
+    ur_exp_command_buffer_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Table of QueueExp functions pointers
+typedef struct ur_queue_exp_dditable_t {
+    ur_pfnQueueBeginCaptureExp_t pfnBeginCaptureExp;
+    ur_pfnQueueEndCaptureExp_t pfnEndCaptureExp;
+} ur_queue_exp_dditable_t;
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL
+urGetQueueExpProcAddrTable(
+    ur_api_version_t version,          ///< [in] API version requested
+    ur_queue_exp_dditable_t *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urGetQueueExpProcAddrTable
+typedef ur_result_t(UR_APICALL *ur_pfnGetQueueExpProcAddrTable_t)(
+    ur_api_version_t,
+    ur_queue_exp_dditable_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urSamplerCreate
 typedef ur_result_t(UR_APICALL *ur_pfnSamplerCreate_t)(
@@ -1484,6 +1598,31 @@ typedef ur_result_t(UR_APICALL *ur_pfnEnqueueTimestampRecordingExp_t)(
     const ur_event_handle_t *,
     ur_event_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueKernelLaunchMultiExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueKernelLaunchMultiExp_t)(
+    uint32_t,
+    const ur_exp_kernel_launch_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueUSMDeviceAllocExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueUSMDeviceAllocExp_t)(
+    ur_queue_handle_t,
+    size_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    void **,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueUSMFreeExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueUSMFreeExp_t)(
+    ur_queue_handle_t,
+    void *,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urEnqueueNativeCommandExp
 typedef ur_result_t(UR_APICALL *ur_pfnEnqueueNativeCommandExp_t)(
@@ -1497,13 +1636,61 @@ typedef ur_result_t(UR_APICALL *ur_pfnEnqueueNativeCommandExp_t)(
     const ur_event_handle_t *,
     ur_event_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueHostTaskExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueHostTaskExp_t)(
+    ur_queue_handle_t,
+    ur_exp_host_task_function_t,
+    void *,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueIPCEventSignalExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueIPCEventSignalExp_t)(
+    ur_queue_handle_t,
+    ur_event_handle_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueIPCEventWaitExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueIPCEventWaitExp_t)(
+    ur_queue_handle_t,
+    ur_event_handle_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urEnqueueUSMMemcpyBatchExp
+typedef ur_result_t(UR_APICALL *ur_pfnEnqueueUSMMemcpyBatchExp_t)(
+    ur_queue_handle_t,
+    bool,
+    uint32_t,
+    void **,
+    const void **,
+    const size_t *,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of EnqueueExp functions pointers
 typedef struct ur_enqueue_exp_dditable_t {
     ur_pfnEnqueueKernelLaunchCustomExp_t pfnKernelLaunchCustomExp;
     ur_pfnEnqueueCooperativeKernelLaunchExp_t pfnCooperativeKernelLaunchExp;
     ur_pfnEnqueueTimestampRecordingExp_t pfnTimestampRecordingExp;
+    ur_pfnEnqueueKernelLaunchMultiExp_t pfnKernelLaunchMultiExp;
+    ur_pfnEnqueueUSMDeviceAllocExp_t pfnUSMDeviceAllocExp;
+    ur_pfnEnqueueUSMFreeExp_t pfnUSMFreeExp;
     ur_pfnEnqueueNativeCommandExp_t pfnNativeCommandExp;
+    ur_pfnEnqueueHostTaskExp_t pfnHostTaskExp;
+    ur_pfnEnqueueIPCEventSignalExp_t pfnIPCEventSignalExp;
+    ur_pfnEnqueueIPCEventWaitExp_t pfnIPCEventWaitExp;
+    ur_pfnEnqueueUSMMemcpyBatchExp_t pfnUSMMemcpyBatchExp;
 } ur_enqueue_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -1594,6 +1781,23 @@ typedef ur_result_t(UR_APICALL *ur_pfnBindlessImagesImageCopyExp_t)(
     const ur_event_handle_t *,
     ur_event_handle_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urBindlessImagesImageCopyBatchExp
+typedef ur_result_t(UR_APICALL *ur_pfnBindlessImagesImageCopyBatchExp_t)(
+    ur_queue_handle_t,
+    const void *,
+    void *,
+    const ur_image_desc_t *,
+    const ur_image_desc_t *,
+    const ur_image_format_t *,
+    const ur_image_format_t *,
+    uint32_t,
+    const ur_exp_image_copy_region_t *,
+    ur_exp_image_copy_flags_t,
+    uint32_t,
+    const ur_event_handle_t *,
+    ur_event_handle_t *);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urBindlessImagesImageGetInfoExp
 typedef ur_result_t(UR_APICALL *ur_pfnBindlessImagesImageGetInfoExp_t)(
@@ -1704,6 +1908,7 @@ typedef struct ur_bindless_images_exp_dditable_t {
     ur_pfnBindlessImagesUnsampledImageCreateExp_t pfnUnsampledImageCreateExp;
     ur_pfnBindlessImagesSampledImageCreateExp_t pfnSampledImageCreateExp;
     ur_pfnBindlessImagesImageCopyExp_t pfnImageCopyExp;
+    ur_pfnBindlessImagesImageCopyBatchExp_t pfnImageCopyBatchExp;
     ur_pfnBindlessImagesImageGetInfoExp_t pfnImageGetInfoExp;
     ur_pfnBindlessImagesMipmapGetLevelExp_t pfnMipmapGetLevelExp;
     ur_pfnBindlessImagesMipmapFreeExp_t pfnMipmapFreeExp;
@@ -1857,6 +2062,22 @@ typedef ur_result_t(UR_APICALL *ur_pfnUSMPitchedAllocExp_t)(
     void **,
     size_t *);
 
+///////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMGrowableAllocExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMGrowableAllocExp_t)(
+    ur_context_handle_t,
+    ur_device_handle_t,
+    size_t,
+    size_t,
+    void **);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMGrowExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMGrowExp_t)(
+    ur_context_handle_t,
+    void *,
+    size_t);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Function-pointer for urUSMImportExp
 typedef ur_result_t(UR_APICALL *ur_pfnUSMImportExp_t)(
@@ -1870,12 +2091,22 @@ typedef ur_result_t(UR_APICALL *ur_pfnUSMReleaseExp_t)(
     ur_context_handle_t,
     void *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urUSMPoolTrimExp
+typedef ur_result_t(UR_APICALL *ur_pfnUSMPoolTrimExp_t)(
+    ur_context_handle_t,
+    ur_usm_pool_handle_t,
+    size_t);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of USMExp functions pointers
 typedef struct ur_usm_exp_dditable_t {
     ur_pfnUSMPitchedAllocExp_t pfnPitchedAllocExp;
+    ur_pfnUSMGrowableAllocExp_t pfnGrowableAllocExp;
+    ur_pfnUSMGrowExp_t pfnGrowExp;
     ur_pfnUSMImportExp_t pfnImportExp;
     ur_pfnUSMReleaseExp_t pfnReleaseExp;
+    ur_pfnUSMPoolTrimExp_t pfnPoolTrimExp;
 } ur_usm_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2187,6 +2418,20 @@ typedef ur_result_t(UR_APICALL *ur_pfnCommandBufferCommandGetInfoExp_t)(
     void *,
     size_t *);
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urCommandBufferUpdateKernelLaunchBatchExp
+typedef ur_result_t(UR_APICALL *ur_pfnCommandBufferUpdateKernelLaunchBatchExp_t)(
+    ur_exp_command_buffer_handle_t,
+    uint32_t,
+    const ur_exp_command_buffer_command_handle_t *,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *);
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Function-pointer for urCommandBufferUploadExp
+typedef ur_result_t(UR_APICALL *ur_pfnCommandBufferUploadExp_t)(
+    ur_exp_command_buffer_handle_t,
+    ur_queue_handle_t);
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Table of CommandBufferExp functions pointers
 typedef struct ur_command_buffer_exp_dditable_t {
@@ -2214,6 +2459,8 @@ typedef struct ur_command_buffer_exp_dditable_t {
     ur_pfnCommandBufferUpdateWaitEventsExp_t pfnUpdateWaitEventsExp;
     ur_pfnCommandBufferGetInfoExp_t pfnGetInfoExp;
     ur_pfnCommandBufferCommandGetInfoExp_t pfnCommandGetInfoExp;
+    ur_pfnCommandBufferUpdateKernelLaunchBatchExp_t pfnUpdateKernelLaunchBatchExp;
+    ur_pfnCommandBufferUploadExp_t pfnUploadExp;
 } ur_command_buffer_exp_dditable_t;
 
 ///////////////////////////////////////////////////////////////////////////////
@@ -2489,11 +2736,13 @@ typedef struct ur_dditable_t {
     ur_platform_dditable_t Platform;
     ur_context_dditable_t Context;
     ur_event_dditable_t Event;
+    ur_event_exp_dditable_t EventExp;
     ur_program_dditable_t Program;
     ur_program_exp_dditable_t ProgramExp;
     ur_kernel_dditable_t Kernel;
     ur_kernel_exp_dditable_t KernelExp;
     ur_queue_dditable_t Queue;
+    ur_queue_exp_dditable_t QueueExp;
     ur_sampler_dditable_t Sampler;
     ur_mem_dditable_t Mem;
     ur_physical_mem_dditable_t PhysicalMem;
@@ -14,8 +14,14 @@
 #define UR_PRINT_HPP 1
 
 #include "ur_api.h"
+#include <algorithm>
 #include <bitset>
+#include <charconv>
+#include <cstring>
 #include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
 
 namespace ur::details {
 template <typename T>
@@ -58,6 +64,70 @@ template <>
 struct is_handle<ur_exp_command_buffer_command_handle_t> : std::true_type {};
 template <typename T>
 inline constexpr bool is_handle_v = is_handle<T>::value;
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Stream buffer writing into a caller provided buffer, which counts the
+// characters that don't fit instead of allocating for them
+class buffer_streambuf : public std::streambuf {
+  public:
+    buffer_streambuf(char *buffer, size_t size) { reset(buffer, size); }
+
+    // Starts writing over another buffer, so that the stream can be reused
+    void reset(char *buffer, size_t size) {
+        setp(buffer, buffer ? buffer + size : buffer);
+        dropped = 0;
+    }
+
+    // Number of characters written, including those that didn't fit
+    size_t length() const {
+        return static_cast<size_t>(pptr() - pbase()) + dropped;
+    }
+
+  protected:
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+        auto fits = std::min(n, static_cast<std::streamsize>(epptr() - pptr()));
+        if (fits > 0) {
+            std::memcpy(pptr(), s, static_cast<size_t>(fits));
+            pbump(static_cast<int>(fits));
+        }
+        dropped += static_cast<size_t>(n - fits);
+        return n;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            ++dropped;
+        }
+        return traits_type::not_eof(ch);
+    }
+
+  private:
+    size_t dropped = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print an address in hexadecimal through std::to_chars, rather than the
+// stream's locale
+inline void printAddress(std::ostream &os, const void *ptr) {
+    char buffer[2 + sizeof(uintptr_t) * 2] = {'0', 'x'};
+    auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer),
+                                reinterpret_cast<uintptr_t>(ptr), 16);
+    os.write(buffer, result.ptr - buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print a value, integers through std::to_chars rather than the
+// stream's locale. Characters and anything else are left to the stream.
+template <typename T> inline void printValue(std::ostream &os, const T &value) {
+    if constexpr (std::is_integral_v<T> && sizeof(T) > 1) {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        os.write(buffer, result.ptr - buffer);
+    } else {
+        os << value;
+    }
+}
+
 template <typename T>
 inline ur_result_t printPtr(std::ostream &os, const T *ptr);
 template <typename T>
@@ -205,6 +275,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_command
 template <>
 inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_command_buffer_command_info_t value, size_t size);
 
+inline ur_result_t printUnion(
+    std::ostream &os,
+    const union ur_exp_kernel_arg_value_t params,
+    const enum ur_exp_kernel_arg_type_t tag);
+
 inline ur_result_t printUnion(
     std::ostream &os,
     const union ur_exp_launch_property_value_t params,
@@ -345,9 +420,18 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_pointer_arg_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_value_arg_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_update_kernel_launch_desc_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_command_buffer_launch_chains_desc_t params);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_context_memory_type_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_ipc_event_handle_t params);
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_kernel_arg_type_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_arg_mem_obj_tuple_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_arg_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_launch_property_id_t value);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_launch_property_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_kernel_launch_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_usm_host_numa_desc_t params);
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_usm_pool_arena_desc_t params);
 inline std::ostream &operator<<(std::ostream &os, enum ur_exp_enqueue_native_command_flag_t value);
 inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_exp_enqueue_native_command_properties_t params);
 
@@ -954,6 +1038,72 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_function_t value) {
     case UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP:
         os << "UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP";
         break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP:
+        os << "UR_FUNCTION_USM_POOL_TRIM_EXP";
+        break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP:
+        os << "UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP:
+        os << "UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP:
+        os << "UR_FUNCTION_ENQUEUE_USM_FREE_EXP";
+        break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP:
+        os << "UR_FUNCTION_USM_GROWABLE_ALLOC_EXP";
+        break;
+    case UR_FUNCTION_USM_GROW_EXP:
+        os << "UR_FUNCTION_USM_GROW_EXP";
+        break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP:
+        os << "UR_FUNCTION_KERNEL_SET_ARGS_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP:
+        os << "UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP";
+        break;
+    case UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP:
+        os << "UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP";
+        break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP:
+        os << "UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP";
+        break;
+    case UR_FUNCTION_LOADER_INVALIDATE_ENUMERATION_CACHE_EXP:
+        os << "UR_FUNCTION_LOADER_INVALIDATE_ENUMERATION_CACHE_EXP";
+        break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP:
+        os << "UR_FUNCTION_EVENT_WAIT_ANY_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP:
+        os << "UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP";
+        break;
+    case UR_FUNCTION_QUEUE_END_CAPTURE_EXP:
+        os << "UR_FUNCTION_QUEUE_END_CAPTURE_EXP";
+        break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP:
+        os << "UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_HOST_TASK_EXP:
+        os << "UR_FUNCTION_ENQUEUE_HOST_TASK_EXP";
+        break;
+    case UR_FUNCTION_EVENT_CREATE_IPC_EXP:
+        os << "UR_FUNCTION_EVENT_CREATE_IPC_EXP";
+        break;
+    case UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP:
+        os << "UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP";
+        break;
+    case UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP:
+        os << "UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP:
+        os << "UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP:
+        os << "UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP";
+        break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP:
+        os << "UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1086,6 +1236,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_structure_type_t value
     case UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_VALUE_ARG_DESC:
         os << "UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_VALUE_ARG_DESC";
         break;
+    case UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_LAUNCH_CHAINS_DESC:
+        os << "UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_LAUNCH_CHAINS_DESC";
+        break;
     case UR_STRUCTURE_TYPE_EXP_SAMPLER_MIP_PROPERTIES:
         os << "UR_STRUCTURE_TYPE_EXP_SAMPLER_MIP_PROPERTIES";
         break;
@@ -1113,6 +1266,12 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_structure_type_t value
     case UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES:
         os << "UR_STRUCTURE_TYPE_EXP_ENQUEUE_NATIVE_COMMAND_PROPERTIES";
         break;
+    case UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC:
+        os << "UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC";
+        break;
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC:
+        os << "UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1330,6 +1489,11 @@ inline ur_result_t printStruct(std::ostream &os, const void *ptr) {
         printPtr(os, pstruct);
     } break;
 
+    case UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_LAUNCH_CHAINS_DESC: {
+        const ur_exp_command_buffer_launch_chains_desc_t *pstruct = (const ur_exp_command_buffer_launch_chains_desc_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
+
     case UR_STRUCTURE_TYPE_EXP_SAMPLER_MIP_PROPERTIES: {
         const ur_exp_sampler_mip_properties_t *pstruct = (const ur_exp_sampler_mip_properties_t *)ptr;
         printPtr(os, pstruct);
@@ -1374,6 +1538,16 @@ inline ur_result_t printStruct(std::ostream &os, const void *ptr) {
         const ur_exp_enqueue_native_command_properties_t *pstruct = (const ur_exp_enqueue_native_command_properties_t *)ptr;
         printPtr(os, pstruct);
     } break;
+
+    case UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC: {
+        const ur_exp_usm_pool_arena_desc_t *pstruct = (const ur_exp_usm_pool_arena_desc_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
+
+    case UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC: {
+        const ur_exp_usm_host_numa_desc_t *pstruct = (const ur_exp_usm_host_numa_desc_t *)ptr;
+        printPtr(os, pstruct);
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -1630,7 +1804,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_base_propertie
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -1650,7 +1825,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_base_desc_t pa
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -1670,17 +1846,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_rect_offset_t
 
     os << ".x = ";
 
-    os << (params.x);
+    ur::details::printValue(os,
+                            (params.x));
 
     os << ", ";
     os << ".y = ";
 
-    os << (params.y);
+    ur::details::printValue(os,
+                            (params.y));
 
     os << ", ";
     os << ".z = ";
 
-    os << (params.z);
+    ur::details::printValue(os,
+                            (params.z));
 
     os << "}";
     return os;
@@ -1694,17 +1873,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_rect_region_t
 
     os << ".width = ";
 
-    os << (params.width);
+    ur::details::printValue(os,
+                            (params.width));
 
     os << ", ";
     os << ".height = ";
 
-    os << (params.height);
+    ur::details::printValue(os,
+                            (params.height));
 
     os << ", ";
     os << ".depth = ";
 
-    os << (params.depth);
+    ur::details::printValue(os,
+                            (params.depth));
 
     os << "}";
     return os;
@@ -1845,9 +2027,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_loader_conf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -1880,12 +2064,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_code_location_
     os << ", ";
     os << ".lineNumber = ";
 
-    os << (params.lineNumber);
+    ur::details::printValue(os,
+                            (params.lineNumber));
 
     os << ", ";
     os << ".columnNumber = ";
 
-    os << (params.columnNumber);
+    ur::details::printValue(os,
+                            (params.columnNumber));
 
     os << "}";
     return os;
@@ -1902,6 +2088,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_adapter_info_t value)
     case UR_ADAPTER_INFO_REFERENCE_COUNT:
         os << "UR_ADAPTER_INFO_REFERENCE_COUNT";
         break;
+    case UR_ADAPTER_INFO_PERF_COUNTERS:
+        os << "UR_ADAPTER_INFO_PERF_COUNTERS";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -1924,9 +2113,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_adapter_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_adapter_backend_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -1936,12 +2127,19 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_adapter_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
+    case UR_ADAPTER_INFO_PERF_COUNTERS: {
+
+        const char *tptr = (const char *)ptr;
+        printPtr(os, tptr);
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -2051,9 +2249,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_platform_in
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_platform_backend_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2082,7 +2282,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_platform_nativ
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -2093,7 +2294,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_platform_nativ
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -2137,7 +2339,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_binary_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -2643,6 +2846,18 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_device_info_t value) {
     case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
         os << "UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP";
         break;
+    case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP:
+        os << "UR_DEVICE_INFO_HOST_NUMA_NODE_EXP";
+        break;
+    case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP:
+        os << "UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP";
+        break;
+    case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP:
+        os << "UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP";
+        break;
+    case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP:
+        os << "UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -2665,9 +2880,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_type_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2677,9 +2894,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2689,9 +2908,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2701,9 +2922,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2713,9 +2936,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2729,7 +2954,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -2739,9 +2965,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2751,7 +2979,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_fp_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_fp_capability_flag_t>(os,
                                                                *tptr);
@@ -2764,7 +2993,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_fp_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_fp_capability_flag_t>(os,
                                                                *tptr);
@@ -2777,7 +3007,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_fp_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_fp_capability_flag_t>(os,
                                                                *tptr);
@@ -2790,7 +3021,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_queue_flag_t>(os,
                                                 *tptr);
@@ -2803,9 +3035,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2815,9 +3049,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2827,9 +3063,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2839,9 +3077,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2851,9 +3091,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2863,9 +3105,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2875,9 +3119,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2887,9 +3133,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2899,9 +3147,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2911,9 +3161,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2923,9 +3175,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2935,9 +3189,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2947,9 +3203,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2959,9 +3217,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2971,9 +3231,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2983,9 +3245,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -2995,9 +3259,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3007,9 +3273,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3019,9 +3287,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3031,9 +3301,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3043,9 +3315,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3055,9 +3329,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3067,9 +3343,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3079,9 +3357,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3091,9 +3371,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3103,9 +3385,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3115,9 +3399,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3127,9 +3413,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3139,9 +3427,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3151,9 +3441,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3163,9 +3455,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3175,9 +3469,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3187,9 +3483,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_mem_cache_type_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3199,9 +3497,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3211,9 +3511,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3223,9 +3525,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3235,9 +3539,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3247,9 +3553,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3259,9 +3567,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3271,9 +3581,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_local_mem_type_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3283,9 +3595,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3295,9 +3609,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3307,9 +3623,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3319,9 +3637,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3331,9 +3651,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3343,9 +3665,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3355,9 +3679,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3367,9 +3693,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3379,7 +3707,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_exec_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_exec_capability_flag_t>(os,
                                                                  *tptr);
@@ -3392,7 +3721,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_queue_flag_t>(os,
                                                 *tptr);
@@ -3405,7 +3735,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_queue_flag_t>(os,
                                                 *tptr);
@@ -3423,7 +3754,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_platform_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -3436,9 +3768,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3488,9 +3822,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3500,9 +3836,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3512,7 +3850,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -3529,7 +3868,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -3539,9 +3879,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3551,7 +3893,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_affinity_domain_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_affinity_domain_flag_t>(os,
                                                                  *tptr);
@@ -3568,7 +3911,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -3578,9 +3922,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3590,9 +3936,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3606,7 +3954,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -3616,7 +3965,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_usm_access_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_usm_access_capability_flag_t>(os,
                                                                        *tptr);
@@ -3629,7 +3979,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_usm_access_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_usm_access_capability_flag_t>(os,
                                                                        *tptr);
@@ -3642,7 +3993,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_usm_access_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_usm_access_capability_flag_t>(os,
                                                                        *tptr);
@@ -3655,7 +4007,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_usm_access_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_usm_access_capability_flag_t>(os,
                                                                        *tptr);
@@ -3668,7 +4021,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_usm_access_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_usm_access_capability_flag_t>(os,
                                                                        *tptr);
@@ -3685,7 +4039,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -3700,9 +4055,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3712,9 +4069,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3724,9 +4083,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3736,9 +4097,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3748,9 +4111,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3760,9 +4125,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3772,9 +4139,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3784,9 +4153,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3796,9 +4167,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3808,9 +4181,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3820,7 +4195,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_order_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_order_capability_flag_t>(os,
                                                                   *tptr);
@@ -3833,7 +4209,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_scope_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_scope_capability_flag_t>(os,
                                                                   *tptr);
@@ -3846,7 +4223,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_order_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_order_capability_flag_t>(os,
                                                                   *tptr);
@@ -3859,7 +4237,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_scope_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_scope_capability_flag_t>(os,
                                                                   *tptr);
@@ -3872,9 +4251,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3884,9 +4265,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3896,9 +4279,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3908,9 +4293,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3924,7 +4311,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -3934,9 +4322,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3946,9 +4336,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3958,9 +4350,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3970,9 +4364,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3982,9 +4378,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -3994,9 +4392,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4006,9 +4406,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4033,7 +4435,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -4046,9 +4449,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4058,9 +4463,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4070,7 +4477,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_command_buffer_update_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_device_command_buffer_update_capability_flag_t>(os,
                                                                                   *tptr);
@@ -4083,9 +4491,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4095,9 +4505,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4107,9 +4519,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4119,9 +4533,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4131,9 +4547,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4143,9 +4561,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4155,9 +4575,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4167,9 +4589,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4179,9 +4603,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4191,9 +4617,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4203,9 +4631,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4215,9 +4645,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4227,9 +4659,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4239,9 +4673,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4251,9 +4687,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4263,9 +4701,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4275,9 +4715,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4287,9 +4729,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4299,9 +4743,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4311,9 +4757,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4323,9 +4771,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4335,9 +4785,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4347,9 +4799,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4359,9 +4813,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4371,9 +4827,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4383,9 +4841,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4395,9 +4855,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4407,9 +4869,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4419,9 +4883,67 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_device_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP: {
+        const uint32_t *tptr = (const uint32_t *)ptr;
+        if (sizeof(uint32_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP: {
+        const ur_bool_t *tptr = (const ur_bool_t *)ptr;
+        if (sizeof(ur_bool_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP: {
+        const ur_bool_t *tptr = (const ur_bool_t *)ptr;
+        if (sizeof(ur_bool_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP: {
+        const ur_bool_t *tptr = (const ur_bool_t *)ptr;
+        if (sizeof(ur_bool_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -4582,14 +5104,16 @@ inline ur_result_t printUnion(
 
         os << ".equally = ";
 
-        os << (params.equally);
+        ur::details::printValue(os,
+                                (params.equally));
 
         break;
     case UR_DEVICE_PARTITION_BY_COUNTS:
 
         os << ".count = ";
 
-        os << (params.count);
+        ur::details::printValue(os,
+                                (params.count));
 
         break;
     case UR_DEVICE_PARTITION_BY_AFFINITY_DOMAIN:
@@ -4617,7 +5141,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_partiti
 
     os << ".type = ";
 
-    os << (params.type);
+    ur::details::printValue(os,
+                            (params.type));
 
     os << ", ";
     os << ".value = ";
@@ -4635,7 +5160,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_partiti
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -4652,7 +5178,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_partiti
     os << ", ";
     os << ".PropCount = ";
 
-    os << (params.PropCount);
+    ur::details::printValue(os,
+                            (params.PropCount));
 
     os << "}";
     return os;
@@ -4902,7 +5429,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_native_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -4913,7 +5441,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_device_native_
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -5250,7 +5779,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_context_proper
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -5300,6 +5830,15 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_context_info_t value)
     case UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES:
         os << "UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES";
         break;
+    case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+        os << "UR_CONTEXT_INFO_MEMORY_USED_EXP";
+        break;
+    case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+        os << "UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP";
+        break;
+    case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+        os << "UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -5322,9 +5861,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5349,9 +5890,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5361,9 +5904,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5373,9 +5918,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5385,7 +5932,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_order_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_order_capability_flag_t>(os,
                                                                   *tptr);
@@ -5398,7 +5946,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_scope_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_scope_capability_flag_t>(os,
                                                                   *tptr);
@@ -5411,7 +5960,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_order_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_order_capability_flag_t>(os,
                                                                   *tptr);
@@ -5424,13 +5974,58 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_context_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_memory_scope_capability_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_memory_scope_capability_flag_t>(os,
                                                                   *tptr);
 
         os << ")";
     } break;
+    case UR_CONTEXT_INFO_MEMORY_USED_EXP: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            ur::details::printValue(os,
+                                    tptr[i]);
+        }
+        os << "}";
+    } break;
+    case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            ur::details::printValue(os,
+                                    tptr[i]);
+        }
+        os << "}";
+    } break;
+    case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -5448,7 +6043,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_context_native
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -5459,7 +6055,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_context_native
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -5638,9 +6235,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_mem_info_t
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5650,7 +6249,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_mem_info_t
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -5828,9 +6428,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_image_format_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5840,9 +6442,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5852,9 +6456,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5864,9 +6470,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5876,9 +6484,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5888,9 +6498,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5900,9 +6512,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_image_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -5923,12 +6537,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_image_format_t
 
     os << ".channelOrder = ";
 
-    os << (params.channelOrder);
+    ur::details::printValue(os,
+                            (params.channelOrder));
 
     os << ", ";
     os << ".channelType = ";
 
-    os << (params.channelType);
+    ur::details::printValue(os,
+                            (params.channelType));
 
     os << "}";
     return os;
@@ -5942,7 +6558,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_image_desc_t p
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -5953,47 +6570,56 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_image_desc_t p
     os << ", ";
     os << ".type = ";
 
-    os << (params.type);
+    ur::details::printValue(os,
+                            (params.type));
 
     os << ", ";
     os << ".width = ";
 
-    os << (params.width);
+    ur::details::printValue(os,
+                            (params.width));
 
     os << ", ";
     os << ".height = ";
 
-    os << (params.height);
+    ur::details::printValue(os,
+                            (params.height));
 
     os << ", ";
     os << ".depth = ";
 
-    os << (params.depth);
+    ur::details::printValue(os,
+                            (params.depth));
 
     os << ", ";
     os << ".arraySize = ";
 
-    os << (params.arraySize);
+    ur::details::printValue(os,
+                            (params.arraySize));
 
     os << ", ";
     os << ".rowPitch = ";
 
-    os << (params.rowPitch);
+    ur::details::printValue(os,
+                            (params.rowPitch));
 
     os << ", ";
     os << ".slicePitch = ";
 
-    os << (params.slicePitch);
+    ur::details::printValue(os,
+                            (params.slicePitch));
 
     os << ", ";
     os << ".numMipLevel = ";
 
-    os << (params.numMipLevel);
+    ur::details::printValue(os,
+                            (params.numMipLevel));
 
     os << ", ";
     os << ".numSamples = ";
 
-    os << (params.numSamples);
+    ur::details::printValue(os,
+                            (params.numSamples));
 
     os << "}";
     return os;
@@ -6007,7 +6633,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_propert
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6033,7 +6660,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_channel
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6044,7 +6672,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_channel
     os << ", ";
     os << ".channel = ";
 
-    os << (params.channel);
+    ur::details::printValue(os,
+                            (params.channel));
 
     os << "}";
     return os;
@@ -6058,7 +6687,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_alloc_l
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6069,7 +6699,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_alloc_l
     os << ", ";
     os << ".location = ";
 
-    os << (params.location);
+    ur::details::printValue(os,
+                            (params.location));
 
     os << "}";
     return os;
@@ -6083,7 +6714,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_region_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6094,12 +6726,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_buffer_region_
     os << ", ";
     os << ".origin = ";
 
-    os << (params.origin);
+    ur::details::printValue(os,
+                            (params.origin));
 
     os << ", ";
     os << ".size = ";
 
-    os << (params.size);
+    ur::details::printValue(os,
+                            (params.size));
 
     os << "}";
     return os;
@@ -6128,7 +6762,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_mem_native_pro
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6139,7 +6774,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_mem_native_pro
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -6232,9 +6868,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_sampler_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6244,7 +6882,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_sampler_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -6257,9 +6896,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_sampler_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6269,9 +6910,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_sampler_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_sampler_addressing_mode_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6281,9 +6924,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_sampler_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_sampler_filter_mode_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6304,7 +6949,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_sampler_desc_t
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6315,17 +6961,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_sampler_desc_t
     os << ", ";
     os << ".normalizedCoords = ";
 
-    os << (params.normalizedCoords);
+    ur::details::printValue(os,
+                            (params.normalizedCoords));
 
     os << ", ";
     os << ".addressingMode = ";
 
-    os << (params.addressingMode);
+    ur::details::printValue(os,
+                            (params.addressingMode));
 
     os << ", ";
     os << ".filterMode = ";
 
-    os << (params.filterMode);
+    ur::details::printValue(os,
+                            (params.filterMode));
 
     os << "}";
     return os;
@@ -6339,7 +6988,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_sampler_native
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6350,7 +7000,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_sampler_native
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -6415,6 +7066,9 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_usm_device_mem_flag_t
     case UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY:
         os << "UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY";
         break;
+    case UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP:
+        os << "UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -6459,6 +7113,16 @@ inline ur_result_t printFlag<ur_usm_device_mem_flag_t>(std::ostream &os, uint32_
         }
         os << UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY;
     }
+
+    if ((val & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP) == (uint32_t)UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP) {
+        val ^= (uint32_t)UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP;
+        if (!first) {
+            os << " | ";
+        } else {
+            first = false;
+        }
+        os << UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP;
+    }
     if (val != 0) {
         std::bitset<32> bits(val);
         if (!first) {
@@ -6583,9 +7247,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_alloc_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_usm_type_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6595,9 +7261,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_alloc_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(void *) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6607,9 +7275,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_alloc_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -6619,7 +7289,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_alloc_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -6632,7 +7303,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_alloc_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_usm_pool_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -6909,7 +7581,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_desc_t par
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6926,7 +7599,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_desc_t par
     os << ", ";
     os << ".align = ";
 
-    os << (params.align);
+    ur::details::printValue(os,
+                            (params.align));
 
     os << "}";
     return os;
@@ -6940,7 +7614,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_host_desc_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6966,7 +7641,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_device_des
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -6992,7 +7668,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_alloc_loca
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7003,7 +7680,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_alloc_loca
     os << ", ";
     os << ".location = ";
 
-    os << (params.location);
+    ur::details::printValue(os,
+                            (params.location));
 
     os << "}";
     return os;
@@ -7017,7 +7695,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_pool_desc_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7043,7 +7722,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_pool_limit
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7054,12 +7734,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_usm_pool_limit
     os << ", ";
     os << ".maxPoolableSize = ";
 
-    os << (params.maxPoolableSize);
+    ur::details::printValue(os,
+                            (params.maxPoolableSize));
 
     os << ", ";
     os << ".minDriverAllocSize = ";
 
-    os << (params.minDriverAllocSize);
+    ur::details::printValue(os,
+                            (params.minDriverAllocSize));
 
     os << "}";
     return os;
@@ -7076,6 +7758,27 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_usm_pool_info_t value)
     case UR_USM_POOL_INFO_CONTEXT:
         os << "UR_USM_POOL_INFO_CONTEXT";
         break;
+    case UR_USM_POOL_INFO_USED_SIZE_EXP:
+        os << "UR_USM_POOL_INFO_USED_SIZE_EXP";
+        break;
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP:
+        os << "UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP";
+        break;
+    case UR_USM_POOL_INFO_RESERVED_SIZE_EXP:
+        os << "UR_USM_POOL_INFO_RESERVED_SIZE_EXP";
+        break;
+    case UR_USM_POOL_INFO_PEAK_RESERVED_SIZE_EXP:
+        os << "UR_USM_POOL_INFO_PEAK_RESERVED_SIZE_EXP";
+        break;
+    case UR_USM_POOL_INFO_SLAB_COUNT_EXP:
+        os << "UR_USM_POOL_INFO_SLAB_COUNT_EXP";
+        break;
+    case UR_USM_POOL_INFO_BUCKET_HITS_EXP:
+        os << "UR_USM_POOL_INFO_BUCKET_HITS_EXP";
+        break;
+    case UR_USM_POOL_INFO_BUCKET_MISSES_EXP:
+        os << "UR_USM_POOL_INFO_BUCKET_MISSES_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -7098,9 +7801,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_pool_in
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7110,13 +7815,114 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_usm_pool_in
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
 
         os << ")";
     } break;
+    case UR_USM_POOL_INFO_USED_SIZE_EXP: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_RESERVED_SIZE_EXP: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_PEAK_RESERVED_SIZE_EXP: {
+        const size_t *tptr = (const size_t *)ptr;
+        if (sizeof(size_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_SLAB_COUNT_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_USM_POOL_INFO_BUCKET_HITS_EXP: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            ur::details::printValue(os,
+                                    tptr[i]);
+        }
+        os << "}";
+    } break;
+    case UR_USM_POOL_INFO_BUCKET_MISSES_EXP: {
+
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        os << "{";
+        size_t nelems = size / sizeof(uint64_t);
+        for (size_t i = 0; i < nelems; ++i) {
+            if (i != 0) {
+                os << ", ";
+            }
+
+            ur::details::printValue(os,
+                                    tptr[i]);
+        }
+        os << "}";
+    } break;
     default:
         os << "unknown enumerator";
         return UR_RESULT_ERROR_INVALID_ENUMERATION;
@@ -7159,9 +7965,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_virtual_mem
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7171,9 +7979,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_virtual_mem
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7287,7 +8097,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_virtual_mem
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_virtual_mem_access_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_virtual_mem_access_flag_t>(os,
                                                              *tptr);
@@ -7356,7 +8167,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_physical_mem_p
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7412,14 +8224,16 @@ inline ur_result_t printUnion(
 
         os << ".data32 = ";
 
-        os << (params.data32);
+        ur::details::printValue(os,
+                                (params.data32));
 
         break;
     case UR_PROGRAM_METADATA_TYPE_UINT64:
 
         os << ".data64 = ";
 
-        os << (params.data64);
+        ur::details::printValue(os,
+                                (params.data64));
 
         break;
     case UR_PROGRAM_METADATA_TYPE_STRING:
@@ -7461,12 +8275,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_metada
     os << ", ";
     os << ".type = ";
 
-    os << (params.type);
+    ur::details::printValue(os,
+                            (params.type));
 
     os << ", ";
     os << ".size = ";
 
-    os << (params.size);
+    ur::details::printValue(os,
+                            (params.size));
 
     os << ", ";
     os << ".value = ";
@@ -7484,7 +8300,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_proper
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7495,7 +8312,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_proper
     os << ", ";
     os << ".count = ";
 
-    os << (params.count);
+    ur::details::printValue(os,
+                            (params.count));
 
     os << ", ";
     os << ".pMetadatas = {";
@@ -7504,7 +8322,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_proper
             os << ", ";
         }
 
-        os << ((params.pMetadatas))[i];
+        ur::details::printValue(os,
+                                ((params.pMetadatas))[i]);
     }
     os << "}";
 
@@ -7566,9 +8385,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7578,7 +8399,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -7591,9 +8413,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7627,7 +8451,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_inf
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -7642,9 +8467,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_inf
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7749,9 +8576,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_bui
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_program_build_status_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7771,9 +8600,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_program_bui
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_program_binary_type_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7794,12 +8625,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_specialization
 
     os << ".id = ";
 
-    os << (params.id);
+    ur::details::printValue(os,
+                            (params.id));
 
     os << ", ";
     os << ".size = ";
 
-    os << (params.size);
+    ur::details::printValue(os,
+                            (params.size));
 
     os << ", ";
     os << ".pValue = ";
@@ -7819,7 +8652,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_native
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7830,7 +8664,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_program_native
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -7844,7 +8679,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_arg_val
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7864,7 +8700,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_arg_loc
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -7929,9 +8766,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7941,9 +8780,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -7953,7 +8794,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -7966,7 +8808,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_program_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -7984,9 +8827,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_info
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8054,7 +8899,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -8064,9 +8910,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8080,7 +8928,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -8090,9 +8939,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8102,9 +8953,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8114,9 +8967,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8130,7 +8985,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -8140,9 +8996,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_grou
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(size_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8194,9 +9052,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_sub_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8206,9 +9066,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_sub_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8218,9 +9080,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_sub_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8230,9 +9094,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_sub_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8302,9 +9168,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_exec
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8318,7 +9186,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_exec
                 os << ", ";
             }
 
-            os << tptr[i];
+            ur::details::printValue(os,
+                                    tptr[i]);
         }
         os << "}";
     } break;
@@ -8328,9 +9197,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_kernel_exec
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_kernel_cache_config_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8351,7 +9222,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_arg_poi
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8371,7 +9243,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_exec_in
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8391,7 +9264,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_arg_sam
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8411,7 +9285,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_arg_mem
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8437,7 +9312,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_native_
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8448,7 +9324,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_kernel_native_
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -8480,6 +9357,24 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_queue_info_t value) {
     case UR_QUEUE_INFO_EMPTY:
         os << "UR_QUEUE_INFO_EMPTY";
         break;
+    case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+        os << "UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP";
+        break;
+    case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+        os << "UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP";
+        break;
+    case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+        os << "UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP";
+        break;
+    case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+        os << "UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP";
+        break;
+    case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+        os << "UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP";
+        break;
+    case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+        os << "UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -8502,7 +9397,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -8515,7 +9411,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_device_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -8528,7 +9425,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -8541,7 +9439,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_flags_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printFlag<ur_queue_flag_t>(os,
                                                 *tptr);
@@ -8554,9 +9453,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8566,9 +9467,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -8578,38 +9481,124 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_queue_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_bool_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
-    default:
-        os << "unknown enumerator";
-        return UR_RESULT_ERROR_INVALID_ENUMERATION;
-    }
-    return UR_RESULT_SUCCESS;
-}
-} // namespace ur::details
+    case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_queue_flag_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, enum ur_queue_flag_t value) {
-    switch (value) {
-    case UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE:
-        os << "UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE";
-        break;
-    case UR_QUEUE_FLAG_PROFILING_ENABLE:
-        os << "UR_QUEUE_FLAG_PROFILING_ENABLE";
-        break;
-    case UR_QUEUE_FLAG_ON_DEVICE:
-        os << "UR_QUEUE_FLAG_ON_DEVICE";
-        break;
-    case UR_QUEUE_FLAG_ON_DEVICE_DEFAULT:
-        os << "UR_QUEUE_FLAG_ON_DEVICE_DEFAULT";
-        break;
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP: {
+        const double *tptr = (const double *)ptr;
+        if (sizeof(double) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(double) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP: {
+        const uint64_t *tptr = (const uint64_t *)ptr;
+        if (sizeof(uint64_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
+
+        os << ")";
+    } break;
+    default:
+        os << "unknown enumerator";
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::details
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_flag_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_queue_flag_t value) {
+    switch (value) {
+    case UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE:
+        os << "UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE";
+        break;
+    case UR_QUEUE_FLAG_PROFILING_ENABLE:
+        os << "UR_QUEUE_FLAG_PROFILING_ENABLE";
+        break;
+    case UR_QUEUE_FLAG_ON_DEVICE:
+        os << "UR_QUEUE_FLAG_ON_DEVICE";
+        break;
+    case UR_QUEUE_FLAG_ON_DEVICE_DEFAULT:
+        os << "UR_QUEUE_FLAG_ON_DEVICE_DEFAULT";
+        break;
     case UR_QUEUE_FLAG_DISCARD_EVENTS:
         os << "UR_QUEUE_FLAG_DISCARD_EVENTS";
         break;
@@ -8631,6 +9620,12 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_queue_flag_t value) {
     case UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM:
         os << "UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM";
         break;
+    case UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP:
+        os << "UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP";
+        break;
+    case UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP:
+        os << "UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -8755,6 +9750,26 @@ inline ur_result_t printFlag<ur_queue_flag_t>(std::ostream &os, uint32_t flag) {
         }
         os << UR_QUEUE_FLAG_SYNC_WITH_DEFAULT_STREAM;
     }
+
+    if ((val & UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP) == (uint32_t)UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP) {
+        val ^= (uint32_t)UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP;
+        if (!first) {
+            os << " | ";
+        } else {
+            first = false;
+        }
+        os << UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP;
+    }
+
+    if ((val & UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP) == (uint32_t)UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP) {
+        val ^= (uint32_t)UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP;
+        if (!first) {
+            os << " | ";
+        } else {
+            first = false;
+        }
+        os << UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP;
+    }
     if (val != 0) {
         std::bitset<32> bits(val);
         if (!first) {
@@ -8776,7 +9791,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_properti
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8802,7 +9818,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_index_pr
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8813,7 +9830,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_index_pr
     os << ", ";
     os << ".computeIndex = ";
 
-    os << (params.computeIndex);
+    ur::details::printValue(os,
+                            (params.computeIndex));
 
     os << "}";
     return os;
@@ -8827,7 +9845,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_native_d
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8853,7 +9872,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_native_p
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -8864,7 +9884,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_queue_native_p
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -8965,6 +9986,18 @@ inline std::ostream &operator<<(std::ostream &os, enum ur_command_t value) {
     case UR_COMMAND_ENQUEUE_NATIVE_EXP:
         os << "UR_COMMAND_ENQUEUE_NATIVE_EXP";
         break;
+    case UR_COMMAND_ENQUEUE_HOST_TASK_EXP:
+        os << "UR_COMMAND_ENQUEUE_HOST_TASK_EXP";
+        break;
+    case UR_COMMAND_IPC_EVENT_SIGNAL_EXP:
+        os << "UR_COMMAND_IPC_EVENT_SIGNAL_EXP";
+        break;
+    case UR_COMMAND_IPC_EVENT_WAIT_EXP:
+        os << "UR_COMMAND_IPC_EVENT_WAIT_EXP";
+        break;
+    case UR_COMMAND_USM_MEMCPY_BATCH_EXP:
+        os << "UR_COMMAND_USM_MEMCPY_BATCH_EXP";
+        break;
     default:
         os << "unknown enumerator";
         break;
@@ -9041,7 +10074,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_event_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_queue_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -9054,7 +10088,8 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_event_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_context_handle_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
         ur::details::printPtr(os,
                               *tptr);
@@ -9067,9 +10102,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_event_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_command_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9079,9 +10116,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_event_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(ur_event_status_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9091,9 +10130,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_event_info_
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9148,9 +10189,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9160,9 +10203,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9172,9 +10217,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9184,9 +10231,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9196,9 +10245,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_profiling_i
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint64_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9219,7 +10270,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_event_native_p
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9230,7 +10282,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_event_native_p
     os << ", ";
     os << ".isNativeHandleOwned = ";
 
-    os << (params.isNativeHandleOwned);
+    ur::details::printValue(os,
+                            (params.isNativeHandleOwned));
 
     os << "}";
     return os;
@@ -9515,7 +10568,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_file_descr
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9526,7 +10580,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_file_descr
     os << ", ";
     os << ".fd = ";
 
-    os << (params.fd);
+    ur::details::printValue(os,
+                            (params.fd));
 
     os << "}";
     return os;
@@ -9540,7 +10595,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_win32_hand
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9566,7 +10622,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_mi
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9577,22 +10634,26 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_mi
     os << ", ";
     os << ".minMipmapLevelClamp = ";
 
-    os << (params.minMipmapLevelClamp);
+    ur::details::printValue(os,
+                            (params.minMipmapLevelClamp));
 
     os << ", ";
     os << ".maxMipmapLevelClamp = ";
 
-    os << (params.maxMipmapLevelClamp);
+    ur::details::printValue(os,
+                            (params.maxMipmapLevelClamp));
 
     os << ", ";
     os << ".maxAnisotropy = ";
 
-    os << (params.maxAnisotropy);
+    ur::details::printValue(os,
+                            (params.maxAnisotropy));
 
     os << ", ";
     os << ".mipFilterMode = ";
 
-    os << (params.mipFilterMode);
+    ur::details::printValue(os,
+                            (params.mipFilterMode));
 
     os << "}";
     return os;
@@ -9606,7 +10667,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_ad
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9621,7 +10683,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_ad
             os << ", ";
         }
 
-        os << (params.addrModes[i]);
+        ur::details::printValue(os,
+                                (params.addrModes[i]));
     }
     os << "}";
 
@@ -9637,7 +10700,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_cu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9648,7 +10712,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_sampler_cu
     os << ", ";
     os << ".cubemapFilterMode = ";
 
-    os << (params.cubemapFilterMode);
+    ur::details::printValue(os,
+                            (params.cubemapFilterMode));
 
     os << "}";
     return os;
@@ -9662,7 +10727,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_external_m
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9682,7 +10748,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_external_s
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9702,7 +10769,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_image_copy
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9713,17 +10781,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_image_copy
     os << ", ";
     os << ".srcOffset = ";
 
-    os << (params.srcOffset);
+    ur::details::printValue(os,
+                            (params.srcOffset));
 
     os << ", ";
     os << ".dstOffset = ";
 
-    os << (params.dstOffset);
+    ur::details::printValue(os,
+                            (params.dstOffset));
 
     os << ", ";
     os << ".copyExtent = ";
 
-    os << (params.copyExtent);
+    ur::details::printValue(os,
+                            (params.copyExtent));
 
     os << "}";
     return os;
@@ -9869,9 +10940,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_command
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9914,9 +10987,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_command
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -9937,7 +11012,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9948,17 +11024,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     os << ", ";
     os << ".isUpdatable = ";
 
-    os << (params.isUpdatable);
+    ur::details::printValue(os,
+                            (params.isUpdatable));
 
     os << ", ";
     os << ".isInOrder = ";
 
-    os << (params.isInOrder);
+    ur::details::printValue(os,
+                            (params.isInOrder));
 
     os << ", ";
     os << ".enableProfiling = ";
 
-    os << (params.enableProfiling);
+    ur::details::printValue(os,
+                            (params.enableProfiling));
 
     os << "}";
     return os;
@@ -9972,7 +11051,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -9983,12 +11063,14 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     os << ", ";
     os << ".argIndex = ";
 
-    os << (params.argIndex);
+    ur::details::printValue(os,
+                            (params.argIndex));
 
     os << ", ";
     os << ".pProperties = ";
 
-    os << (params.pProperties);
+    ur::details::printValue(os,
+                            (params.pProperties));
 
     os << ", ";
     os << ".hNewMemObjArg = ";
@@ -10008,7 +11090,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -10019,17 +11102,20 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     os << ", ";
     os << ".argIndex = ";
 
-    os << (params.argIndex);
+    ur::details::printValue(os,
+                            (params.argIndex));
 
     os << ", ";
     os << ".pProperties = ";
 
-    os << (params.pProperties);
+    ur::details::printValue(os,
+                            (params.pProperties));
 
     os << ", ";
     os << ".pNewPointerArg = ";
 
-    os << (params.pNewPointerArg);
+    ur::details::printValue(os,
+                            (params.pNewPointerArg));
 
     os << "}";
     return os;
@@ -10043,7 +11129,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -10054,22 +11141,26 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     os << ", ";
     os << ".argIndex = ";
 
-    os << (params.argIndex);
+    ur::details::printValue(os,
+                            (params.argIndex));
 
     os << ", ";
     os << ".argSize = ";
 
-    os << (params.argSize);
+    ur::details::printValue(os,
+                            (params.argSize));
 
     os << ", ";
     os << ".pProperties = ";
 
-    os << (params.pProperties);
+    ur::details::printValue(os,
+                            (params.pProperties));
 
     os << ", ";
     os << ".pNewValueArg = ";
 
-    os << (params.pNewValueArg);
+    ur::details::printValue(os,
+                            (params.pNewValueArg));
 
     os << "}";
     return os;
@@ -10083,7 +11174,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -10100,22 +11192,26 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
     os << ", ";
     os << ".numNewMemObjArgs = ";
 
-    os << (params.numNewMemObjArgs);
+    ur::details::printValue(os,
+                            (params.numNewMemObjArgs));
 
     os << ", ";
     os << ".numNewPointerArgs = ";
 
-    os << (params.numNewPointerArgs);
+    ur::details::printValue(os,
+                            (params.numNewPointerArgs));
 
     os << ", ";
     os << ".numNewValueArgs = ";
 
-    os << (params.numNewValueArgs);
+    ur::details::printValue(os,
+                            (params.numNewValueArgs));
 
     os << ", ";
     os << ".newWorkDim = ";
 
-    os << (params.newWorkDim);
+    ur::details::printValue(os,
+                            (params.newWorkDim));
 
     os << ", ";
     os << ".pNewMemObjArgList = {";
@@ -10124,7 +11220,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewMemObjArgList))[i];
+        ur::details::printValue(os,
+                                ((params.pNewMemObjArgList))[i]);
     }
     os << "}";
 
@@ -10135,7 +11232,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewPointerArgList))[i];
+        ur::details::printValue(os,
+                                ((params.pNewPointerArgList))[i]);
     }
     os << "}";
 
@@ -10146,7 +11244,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewValueArgList))[i];
+        ur::details::printValue(os,
+                                ((params.pNewValueArgList))[i]);
     }
     os << "}";
 
@@ -10157,7 +11256,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewGlobalWorkOffset))[i];
+        ur::details::printValue(os,
+                                ((params.pNewGlobalWorkOffset))[i]);
     }
     os << "}";
 
@@ -10168,7 +11268,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewGlobalWorkSize))[i];
+        ur::details::printValue(os,
+                                ((params.pNewGlobalWorkSize))[i]);
     }
     os << "}";
 
@@ -10179,9 +11280,218 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_bu
             os << ", ";
         }
 
-        os << ((params.pNewLocalWorkSize))[i];
+        ur::details::printValue(os,
+                                ((params.pNewLocalWorkSize))[i]);
+    }
+    os << "}";
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_command_buffer_launch_chains_desc_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_command_buffer_launch_chains_desc_t params) {
+    os << "(struct ur_exp_command_buffer_launch_chains_desc_t){";
+
+    os << ".stype = ";
+
+    ur::details::printValue(os,
+                            (params.stype));
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".mergeLaunchChains = ";
+
+    ur::details::printValue(os,
+                            (params.mergeLaunchChains));
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_context_memory_type_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_context_memory_type_t value) {
+    switch (value) {
+    case UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST";
+        break;
+    case UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE";
+        break;
+    case UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED";
+        break;
+    case UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER";
+        break;
+    case UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE";
+        break;
+    case UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL:
+        os << "UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_ipc_event_handle_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_ipc_event_handle_t params) {
+    os << "(struct ur_exp_ipc_event_handle_t){";
+
+    os << ".data = {";
+    for (auto i = 0; i < 128; i++) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (params.data[i]));
+    }
+    os << "}";
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_type_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_kernel_arg_type_t value) {
+    switch (value) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+        os << "UR_EXP_KERNEL_ARG_TYPE_VALUE";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+        os << "UR_EXP_KERNEL_ARG_TYPE_POINTER";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+        os << "UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+        os << "UR_EXP_KERNEL_ARG_TYPE_LOCAL";
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+        os << "UR_EXP_KERNEL_ARG_TYPE_SAMPLER";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_mem_obj_tuple_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_arg_mem_obj_tuple_t params) {
+    os << "(struct ur_exp_kernel_arg_mem_obj_tuple_t){";
+
+    os << ".hMem = ";
+
+    ur::details::printPtr(os,
+                          (params.hMem));
+
+    os << ", ";
+    os << ".flags = ";
+
+    ur::details::printFlag<ur_mem_flag_t>(os,
+                                          (params.flags));
+
+    os << "}";
+    return os;
+}
+namespace ur::details {
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print ur_exp_kernel_arg_value_t union
+inline ur_result_t printUnion(
+    std::ostream &os,
+    const union ur_exp_kernel_arg_value_t params,
+    const enum ur_exp_kernel_arg_type_t tag) {
+    os << "(union ur_exp_kernel_arg_value_t){";
+
+    switch (tag) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+
+        os << ".value = ";
+
+        ur::details::printValue(os,
+                                (params.value));
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+
+        os << ".pointer = ";
+
+        ur::details::printValue(os,
+                                (params.pointer));
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+
+        os << ".memObjTuple = ";
+
+        ur::details::printValue(os,
+                                (params.memObjTuple));
+
+        break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+
+        os << ".sampler = ";
+
+        ur::details::printPtr(os,
+                              (params.sampler));
+
+        break;
+    default:
+        os << "<unknown>";
+        return UR_RESULT_ERROR_INVALID_ENUMERATION;
     }
     os << "}";
+    return UR_RESULT_SUCCESS;
+}
+} // namespace ur::details
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_kernel_arg_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_arg_t params) {
+    os << "(struct ur_exp_kernel_arg_t){";
+
+    os << ".type = ";
+
+    ur::details::printValue(os,
+                            (params.type));
+
+    os << ", ";
+    os << ".index = ";
+
+    ur::details::printValue(os,
+                            (params.index));
+
+    os << ", ";
+    os << ".size = ";
+
+    ur::details::printValue(os,
+                            (params.size));
+
+    os << ", ";
+    os << ".value = ";
+    ur::details::printUnion(os, (params.value), params.type);
 
     os << "}";
     return os;
@@ -10226,7 +11536,8 @@ inline ur_result_t printUnion(
                 os << ", ";
             }
 
-            os << (params.clusterDim[i]);
+            ur::details::printValue(os,
+                                    (params.clusterDim[i]));
         }
         os << "}";
 
@@ -10235,7 +11546,8 @@ inline ur_result_t printUnion(
 
         os << ".cooperative = ";
 
-        os << (params.cooperative);
+        ur::details::printValue(os,
+                                (params.cooperative));
 
         break;
     default:
@@ -10255,7 +11567,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_launch_pro
 
     os << ".id = ";
 
-    os << (params.id);
+    ur::details::printValue(os,
+                            (params.id));
 
     os << ", ";
     os << ".value = ";
@@ -10265,42 +11578,149 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_launch_pro
     return os;
 }
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_exp_peer_info_t type
+/// @brief Print operator for the ur_exp_kernel_launch_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value) {
-    switch (value) {
-    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED:
-        os << "UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED";
-        break;
-    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED:
-        os << "UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED";
-        break;
-    default:
-        os << "unknown enumerator";
-        break;
-    }
-    return os;
-}
-namespace ur::details {
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print ur_exp_peer_info_t enum value
-template <>
-inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_info_t value, size_t size) {
-    if (ptr == NULL) {
-        return printPtr(os, ptr);
-    }
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_kernel_launch_t params) {
+    os << "(struct ur_exp_kernel_launch_t){";
 
-    switch (value) {
-    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
-        const uint32_t *tptr = (const uint32_t *)ptr;
-        if (sizeof(uint32_t) > size) {
-            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
-            return UR_RESULT_ERROR_INVALID_SIZE;
-        }
-        os << (const void *)(tptr) << " (";
+    os << ".hQueue = ";
 
-        os << *tptr;
+    ur::details::printPtr(os,
+                          (params.hQueue));
+
+    os << ", ";
+    os << ".hKernel = ";
+
+    ur::details::printPtr(os,
+                          (params.hKernel));
+
+    os << ", ";
+    os << ".workDim = ";
+
+    ur::details::printValue(os,
+                            (params.workDim));
+
+    os << ", ";
+    os << ".pGlobalWorkOffset = {";
+    for (size_t i = 0; (params.pGlobalWorkOffset) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                ((params.pGlobalWorkOffset))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pGlobalWorkSize = {";
+    for (size_t i = 0; (params.pGlobalWorkSize) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                ((params.pGlobalWorkSize))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pLocalWorkSize = {";
+    for (size_t i = 0; (params.pLocalWorkSize) != NULL && i < params.workDim; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                ((params.pLocalWorkSize))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".numArgs = ";
+
+    ur::details::printValue(os,
+                            (params.numArgs));
+
+    os << ", ";
+    os << ".pArgs = {";
+    for (size_t i = 0; (params.pArgs) != NULL && i < params.numArgs; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                ((params.pArgs))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            (params.numEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; (params.phEventWaitList) != NULL && i < params.numEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              ((params.phEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          (params.phEvent));
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_peer_info_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, enum ur_exp_peer_info_t value) {
+    switch (value) {
+    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED:
+        os << "UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED";
+        break;
+    case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED:
+        os << "UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED";
+        break;
+    default:
+        os << "unknown enumerator";
+        break;
+    }
+    return os;
+}
+namespace ur::details {
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print ur_exp_peer_info_t enum value
+template <>
+inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_info_t value, size_t size) {
+    if (ptr == NULL) {
+        return printPtr(os, ptr);
+    }
+
+    switch (value) {
+    case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
+        const uint32_t *tptr = (const uint32_t *)ptr;
+        if (sizeof(uint32_t) > size) {
+            os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        ur::details::printAddress(os, tptr);
+        os << " (";
+
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -10310,9 +11730,11 @@ inline ur_result_t printTagged(std::ostream &os, const void *ptr, ur_exp_peer_in
             os << "invalid size (is: " << size << ", expected: >=" << sizeof(uint32_t) << ")";
             return UR_RESULT_ERROR_INVALID_SIZE;
         }
-        os << (const void *)(tptr) << " (";
+        ur::details::printAddress(os, tptr);
+        os << " (";
 
-        os << *tptr;
+        ur::details::printValue(os,
+                                *tptr);
 
         os << ")";
     } break;
@@ -10370,6 +11792,66 @@ inline ur_result_t printFlag<ur_exp_enqueue_native_command_flag_t>(std::ostream
 }
 } // namespace ur::details
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_usm_host_numa_desc_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_usm_host_numa_desc_t params) {
+    os << "(struct ur_exp_usm_host_numa_desc_t){";
+
+    os << ".stype = ";
+
+    ur::details::printValue(os,
+                            (params.stype));
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".numaNode = ";
+
+    ur::details::printValue(os,
+                            (params.numaNode));
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_exp_usm_pool_arena_desc_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_usm_pool_arena_desc_t params) {
+    os << "(struct ur_exp_usm_pool_arena_desc_t){";
+
+    os << ".stype = ";
+
+    ur::details::printValue(os,
+                            (params.stype));
+
+    os << ", ";
+    os << ".pNext = ";
+
+    ur::details::printStruct(os,
+                             (params.pNext));
+
+    os << ", ";
+    os << ".size = ";
+
+    ur::details::printValue(os,
+                            (params.size));
+
+    os << ", ";
+    os << ".pageSize = ";
+
+    ur::details::printValue(os,
+                            (params.pageSize));
+
+    os << "}";
+    return os;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_exp_enqueue_native_command_properties_t type
 /// @returns
 ///     std::ostream &
@@ -10378,7 +11860,8 @@ inline std::ostream &operator<<(std::ostream &os, const struct ur_exp_enqueue_na
 
     os << ".stype = ";
 
-    os << (params.stype);
+    ur::details::printValue(os,
+                            (params.stype));
 
     os << ", ";
     os << ".pNext = ";
@@ -10452,12 +11935,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -10506,8 +11991,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".pfnCodeloc = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnCodeloc));
+    ur::details::printAddress(os, reinterpret_cast<void *>(
+                                  *(params->ppfnCodeloc)));
 
     os << ", ";
     os << ".pUserData = ";
@@ -10532,7 +12017,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".enable = ";
 
-    os << *(params->penable);
+    ur::details::printValue(os,
+                            *(params->penable));
 
     return os;
 }
@@ -10557,12 +12043,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".NumAdapters = ";
 
-    os << *(params->pNumAdapters);
+    ur::details::printValue(os,
+                            *(params->pNumAdapters));
 
     os << ", ";
     os << ".NumEntries = ";
 
-    os << *(params->pNumEntries);
+    ur::details::printValue(os,
+                            *(params->pNumEntries));
 
     os << ", ";
     os << ".phPlatforms = {";
@@ -10599,12 +12087,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -10725,7 +12215,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 
     os << ".DeviceCount = ";
 
-    os << *(params->pDeviceCount);
+    ur::details::printValue(os,
+                            *(params->pDeviceCount));
 
     os << ", ";
     os << ".phDevices = {";
@@ -10796,12 +12287,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -10856,7 +12349,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numDevices = ";
 
-    os << *(params->pnumDevices);
+    ur::details::printValue(os,
+                            *(params->pnumDevices));
 
     os << ", ";
     os << ".phDevices = {";
@@ -10899,8 +12393,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".pfnDeleter = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnDeleter));
+    ur::details::printAddress(os, reinterpret_cast<void *>(
+                                  *(params->ppfnDeleter)));
 
     os << ", ";
     os << ".pUserData = ";
@@ -10925,12 +12419,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -10959,12 +12455,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -10987,7 +12485,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 
     os << ".numEvents = ";
 
-    os << *(params->pnumEvents);
+    ur::details::printValue(os,
+                            *(params->pnumEvents));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -11098,13 +12597,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".execStatus = ";
 
-    os << *(params->pexecStatus);
+    ur::details::printValue(os,
+                            *(params->pexecStatus));
 
     os << ", ";
     os << ".pfnNotify = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnNotify));
+    ur::details::printAddress(os, reinterpret_cast<void *>(
+                                  *(params->ppfnNotify)));
 
     os << ", ";
     os << ".pUserData = ";
@@ -11115,6 +12615,116 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_event_wait_any_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_wait_any_exp_params_t *params) {
+
+    os << ".numEvents = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEvents));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEvents; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pIndex = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppIndex));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_event_create_ipc_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_create_ipc_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hDevice = ";
+
+    ur::details::printPtr(os,
+                          *(params->phDevice));
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_event_get_ipc_handle_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_get_ipc_handle_exp_params_t *params) {
+
+    os << ".hEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->phEvent));
+
+    os << ", ";
+    os << ".pIPCHandle = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppIPCHandle));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_event_open_ipc_handle_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_event_open_ipc_handle_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hDevice = ";
+
+    ur::details::printPtr(os,
+                          *(params->phDevice));
+
+    os << ", ";
+    os << ".pIPCHandle = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppIPCHandle));
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_program_create_with_il_params_t type
 /// @returns
@@ -11135,7 +12745,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".length = ";
 
-    os << *(params->plength);
+    ur::details::printValue(os,
+                            *(params->plength));
 
     os << ", ";
     os << ".pProperties = ";
@@ -11172,7 +12783,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pBinary = ";
@@ -11235,7 +12847,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numDevices = ";
 
-    os << *(params->pnumDevices);
+    ur::details::printValue(os,
+                            *(params->pnumDevices));
 
     os << ", ";
     os << ".phDevices = {";
@@ -11298,7 +12911,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numDevices = ";
 
-    os << *(params->pnumDevices);
+    ur::details::printValue(os,
+                            *(params->pnumDevices));
 
     os << ", ";
     os << ".phDevices = {";
@@ -11335,7 +12949,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".phPrograms = {";
@@ -11378,7 +12993,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numDevices = ";
 
-    os << *(params->pnumDevices);
+    ur::details::printValue(os,
+                            *(params->pnumDevices));
 
     os << ", ";
     os << ".phDevices = {";
@@ -11395,7 +13011,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".phPrograms = {";
@@ -11425,29 +13042,61 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_retain_params_t type
+/// @brief Print operator for the ur_program_build_async_exp_params_t type
 /// @returns
 ///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_retain_params_t *params) {
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_build_async_exp_params_t *params) {
 
     os << ".hProgram = ";
 
     ur::details::printPtr(os,
                           *(params->phProgram));
 
-    return os;
-}
+    os << ", ";
+    os << ".hQueue = ";
 
-///////////////////////////////////////////////////////////////////////////////
-/// @brief Print operator for the ur_program_release_params_t type
-/// @returns
-///     std::ostream &
-inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_release_params_t *params) {
+    ur::details::printPtr(os,
+                          *(params->phQueue));
 
-    os << ".hProgram = ";
+    os << ", ";
+    os << ".pOptions = ";
 
     ur::details::printPtr(os,
-                          *(params->phProgram));
+                          *(params->ppOptions));
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_program_retain_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_retain_params_t *params) {
+
+    os << ".hProgram = ";
+
+    ur::details::printPtr(os,
+                          *(params->phProgram));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_program_release_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_program_release_params_t *params) {
+
+    os << ".hProgram = ";
+
+    ur::details::printPtr(os,
+                          *(params->phProgram));
 
     return os;
 }
@@ -11536,12 +13185,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -11576,12 +13227,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -11610,7 +13263,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".pSpecConstants = {";
@@ -11619,7 +13273,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
             os << ", ";
         }
 
-        os << (*(params->ppSpecConstants))[i];
+        ur::details::printValue(os,
+                                (*(params->ppSpecConstants))[i]);
     }
     os << "}";
 
@@ -11718,12 +13373,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -11758,12 +13415,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -11798,12 +13457,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -11924,7 +13585,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numWorkDim = ";
 
-    os << *(params->pnumWorkDim);
+    ur::details::printValue(os,
+                            *(params->pnumWorkDim));
 
     os << ", ";
     os << ".pGlobalWorkOffset = ";
@@ -11961,12 +13623,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".argIndex = ";
 
-    os << *(params->pargIndex);
+    ur::details::printValue(os,
+                            *(params->pargIndex));
 
     os << ", ";
     os << ".argSize = ";
 
-    os << *(params->pargSize);
+    ur::details::printValue(os,
+                            *(params->pargSize));
 
     os << ", ";
     os << ".pProperties = ";
@@ -11997,12 +13661,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".argIndex = ";
 
-    os << *(params->pargIndex);
+    ur::details::printValue(os,
+                            *(params->pargIndex));
 
     os << ", ";
     os << ".argSize = ";
 
-    os << *(params->pargSize);
+    ur::details::printValue(os,
+                            *(params->pargSize));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12027,7 +13693,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".argIndex = ";
 
-    os << *(params->pargIndex);
+    ur::details::printValue(os,
+                            *(params->pargIndex));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12058,12 +13725,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12092,7 +13761,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".argIndex = ";
 
-    os << *(params->pargIndex);
+    ur::details::printValue(os,
+                            *(params->pargIndex));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12123,7 +13793,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".argIndex = ";
 
-    os << *(params->pargIndex);
+    ur::details::printValue(os,
+                            *(params->pargIndex));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12154,7 +13825,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".pSpecConstants = ";
@@ -12179,12 +13851,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".localWorkSize = ";
 
-    os << *(params->plocalWorkSize);
+    ur::details::printValue(os,
+                            *(params->plocalWorkSize));
 
     os << ", ";
     os << ".dynamicSharedMemorySize = ";
 
-    os << *(params->pdynamicSharedMemorySize);
+    ur::details::printValue(os,
+                            *(params->pdynamicSharedMemorySize));
 
     os << ", ";
     os << ".pGroupCountRet = ";
@@ -12195,6 +13869,38 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_kernel_set_args_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_kernel_set_args_exp_params_t *params) {
+
+    os << ".hKernel = ";
+
+    ur::details::printPtr(os,
+                          *(params->phKernel));
+
+    os << ", ";
+    os << ".numArgs = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumArgs));
+
+    os << ", ";
+    os << ".pArgs = {";
+    for (size_t i = 0; *(params->ppArgs) != NULL && i < *params->pnumArgs; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (*(params->ppArgs))[i]);
+    }
+    os << "}";
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_queue_get_info_params_t type
 /// @returns
@@ -12209,12 +13915,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -12381,6 +14089,40 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_begin_capture_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_begin_capture_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_queue_end_capture_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_queue_end_capture_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".phCommandBuffer = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphCommandBuffer));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_sampler_create_params_t type
 /// @returns
@@ -12449,12 +14191,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -12585,7 +14329,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12650,7 +14395,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".bufferCreateType = ";
 
-    os << *(params->pbufferCreateType);
+    ur::details::printValue(os,
+                            *(params->pbufferCreateType));
 
     os << ", ";
     os << ".pRegion = ";
@@ -12783,12 +14529,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -12817,12 +14565,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -12857,7 +14607,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pProperties = ";
@@ -12910,7 +14661,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
 
     os << ".NumEntries = ";
 
-    os << *(params->pNumEntries);
+    ur::details::printValue(os,
+                            *(params->pNumEntries));
 
     os << ", ";
     os << ".phAdapters = {";
@@ -13001,12 +14753,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -13041,7 +14795,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".workDim = ";
 
-    os << *(params->pworkDim);
+    ur::details::printValue(os,
+                            *(params->pworkDim));
 
     os << ", ";
     os << ".pGlobalWorkOffset = ";
@@ -13064,7 +14819,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13101,7 +14857,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13138,7 +14895,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13181,17 +14939,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingRead = ";
 
-    os << *(params->pblockingRead);
+    ur::details::printValue(os,
+                            *(params->pblockingRead));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pDst = ";
@@ -13202,7 +14963,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13245,17 +15007,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingWrite = ";
 
-    os << *(params->pblockingWrite);
+    ur::details::printValue(os,
+                            *(params->pblockingWrite));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pSrc = ";
@@ -13266,7 +15031,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13309,42 +15075,50 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingRead = ";
 
-    os << *(params->pblockingRead);
+    ur::details::printValue(os,
+                            *(params->pblockingRead));
 
     os << ", ";
     os << ".bufferOrigin = ";
 
-    os << *(params->pbufferOrigin);
+    ur::details::printValue(os,
+                            *(params->pbufferOrigin));
 
     os << ", ";
     os << ".hostOrigin = ";
 
-    os << *(params->phostOrigin);
+    ur::details::printValue(os,
+                            *(params->phostOrigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".bufferRowPitch = ";
 
-    os << *(params->pbufferRowPitch);
+    ur::details::printValue(os,
+                            *(params->pbufferRowPitch));
 
     os << ", ";
     os << ".bufferSlicePitch = ";
 
-    os << *(params->pbufferSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pbufferSlicePitch));
 
     os << ", ";
     os << ".hostRowPitch = ";
 
-    os << *(params->phostRowPitch);
+    ur::details::printValue(os,
+                            *(params->phostRowPitch));
 
     os << ", ";
     os << ".hostSlicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    ur::details::printValue(os,
+                            *(params->phostSlicePitch));
 
     os << ", ";
     os << ".pDst = ";
@@ -13355,7 +15129,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13398,42 +15173,50 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingWrite = ";
 
-    os << *(params->pblockingWrite);
+    ur::details::printValue(os,
+                            *(params->pblockingWrite));
 
     os << ", ";
     os << ".bufferOrigin = ";
 
-    os << *(params->pbufferOrigin);
+    ur::details::printValue(os,
+                            *(params->pbufferOrigin));
 
     os << ", ";
     os << ".hostOrigin = ";
 
-    os << *(params->phostOrigin);
+    ur::details::printValue(os,
+                            *(params->phostOrigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".bufferRowPitch = ";
 
-    os << *(params->pbufferRowPitch);
+    ur::details::printValue(os,
+                            *(params->pbufferRowPitch));
 
     os << ", ";
     os << ".bufferSlicePitch = ";
 
-    os << *(params->pbufferSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pbufferSlicePitch));
 
     os << ", ";
     os << ".hostRowPitch = ";
 
-    os << *(params->phostRowPitch);
+    ur::details::printValue(os,
+                            *(params->phostRowPitch));
 
     os << ", ";
     os << ".hostSlicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    ur::details::printValue(os,
+                            *(params->phostSlicePitch));
 
     os << ", ";
     os << ".pSrc = ";
@@ -13444,7 +15227,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13493,22 +15277,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcOffset = ";
 
-    os << *(params->psrcOffset);
+    ur::details::printValue(os,
+                            *(params->psrcOffset));
 
     os << ", ";
     os << ".dstOffset = ";
 
-    os << *(params->pdstOffset);
+    ur::details::printValue(os,
+                            *(params->pdstOffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13557,42 +15345,50 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcOrigin = ";
 
-    os << *(params->psrcOrigin);
+    ur::details::printValue(os,
+                            *(params->psrcOrigin));
 
     os << ", ";
     os << ".dstOrigin = ";
 
-    os << *(params->pdstOrigin);
+    ur::details::printValue(os,
+                            *(params->pdstOrigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".srcRowPitch = ";
 
-    os << *(params->psrcRowPitch);
+    ur::details::printValue(os,
+                            *(params->psrcRowPitch));
 
     os << ", ";
     os << ".srcSlicePitch = ";
 
-    os << *(params->psrcSlicePitch);
+    ur::details::printValue(os,
+                            *(params->psrcSlicePitch));
 
     os << ", ";
     os << ".dstRowPitch = ";
 
-    os << *(params->pdstRowPitch);
+    ur::details::printValue(os,
+                            *(params->pdstRowPitch));
 
     os << ", ";
     os << ".dstSlicePitch = ";
 
-    os << *(params->pdstSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pdstSlicePitch));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13641,22 +15437,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".patternSize = ";
 
-    os << *(params->ppatternSize);
+    ur::details::printValue(os,
+                            *(params->ppatternSize));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13699,27 +15499,32 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingRead = ";
 
-    os << *(params->pblockingRead);
+    ur::details::printValue(os,
+                            *(params->pblockingRead));
 
     os << ", ";
     os << ".origin = ";
 
-    os << *(params->porigin);
+    ur::details::printValue(os,
+                            *(params->porigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".rowPitch = ";
 
-    os << *(params->prowPitch);
+    ur::details::printValue(os,
+                            *(params->prowPitch));
 
     os << ", ";
     os << ".slicePitch = ";
 
-    os << *(params->pslicePitch);
+    ur::details::printValue(os,
+                            *(params->pslicePitch));
 
     os << ", ";
     os << ".pDst = ";
@@ -13730,7 +15535,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13773,27 +15579,32 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingWrite = ";
 
-    os << *(params->pblockingWrite);
+    ur::details::printValue(os,
+                            *(params->pblockingWrite));
 
     os << ", ";
     os << ".origin = ";
 
-    os << *(params->porigin);
+    ur::details::printValue(os,
+                            *(params->porigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".rowPitch = ";
 
-    os << *(params->prowPitch);
+    ur::details::printValue(os,
+                            *(params->prowPitch));
 
     os << ", ";
     os << ".slicePitch = ";
 
-    os << *(params->pslicePitch);
+    ur::details::printValue(os,
+                            *(params->pslicePitch));
 
     os << ", ";
     os << ".pSrc = ";
@@ -13804,7 +15615,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13853,22 +15665,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcOrigin = ";
 
-    os << *(params->psrcOrigin);
+    ur::details::printValue(os,
+                            *(params->psrcOrigin));
 
     os << ", ";
     os << ".dstOrigin = ";
 
-    os << *(params->pdstOrigin);
+    ur::details::printValue(os,
+                            *(params->pdstOrigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13911,7 +15727,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingMap = ";
 
-    os << *(params->pblockingMap);
+    ur::details::printValue(os,
+                            *(params->pblockingMap));
 
     os << ", ";
     os << ".mapFlags = ";
@@ -13922,17 +15739,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -13987,7 +15807,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14030,7 +15851,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".patternSize = ";
 
-    os << *(params->ppatternSize);
+    ur::details::printValue(os,
+                            *(params->ppatternSize));
 
     os << ", ";
     os << ".pPattern = ";
@@ -14041,12 +15863,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14083,7 +15907,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blocking = ";
 
-    os << *(params->pblocking);
+    ur::details::printValue(os,
+                            *(params->pblocking));
 
     os << ", ";
     os << ".pDst = ";
@@ -14100,12 +15925,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14148,7 +15975,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".flags = ";
@@ -14159,7 +15987,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14202,7 +16031,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".advice = ";
@@ -14239,12 +16069,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".pitch = ";
 
-    os << *(params->ppitch);
+    ur::details::printValue(os,
+                            *(params->ppitch));
 
     os << ", ";
     os << ".patternSize = ";
 
-    os << *(params->ppatternSize);
+    ur::details::printValue(os,
+                            *(params->ppatternSize));
 
     os << ", ";
     os << ".pPattern = ";
@@ -14255,17 +16087,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".width = ";
 
-    os << *(params->pwidth);
+    ur::details::printValue(os,
+                            *(params->pwidth));
 
     os << ", ";
     os << ".height = ";
 
-    os << *(params->pheight);
+    ur::details::printValue(os,
+                            *(params->pheight));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14302,7 +16137,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blocking = ";
 
-    os << *(params->pblocking);
+    ur::details::printValue(os,
+                            *(params->pblocking));
 
     os << ", ";
     os << ".pDst = ";
@@ -14313,7 +16149,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".dstPitch = ";
 
-    os << *(params->pdstPitch);
+    ur::details::printValue(os,
+                            *(params->pdstPitch));
 
     os << ", ";
     os << ".pSrc = ";
@@ -14324,22 +16161,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcPitch = ";
 
-    os << *(params->psrcPitch);
+    ur::details::printValue(os,
+                            *(params->psrcPitch));
 
     os << ", ";
     os << ".width = ";
 
-    os << *(params->pwidth);
+    ur::details::printValue(os,
+                            *(params->pwidth));
 
     os << ", ";
     os << ".height = ";
 
-    os << *(params->pheight);
+    ur::details::printValue(os,
+                            *(params->pheight));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14388,17 +16229,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingWrite = ";
 
-    os << *(params->pblockingWrite);
+    ur::details::printValue(os,
+                            *(params->pblockingWrite));
 
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".pSrc = ";
@@ -14409,7 +16253,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14458,17 +16303,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blockingRead = ";
 
-    os << *(params->pblockingRead);
+    ur::details::printValue(os,
+                            *(params->pblockingRead));
 
     os << ", ";
     os << ".count = ";
 
-    os << *(params->pcount);
+    ur::details::printValue(os,
+                            *(params->pcount));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".pDst = ";
@@ -14479,7 +16327,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14528,7 +16377,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blocking = ";
 
-    os << *(params->pblocking);
+    ur::details::printValue(os,
+                            *(params->pblocking));
 
     os << ", ";
     os << ".pDst = ";
@@ -14539,12 +16389,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14593,7 +16445,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blocking = ";
 
-    os << *(params->pblocking);
+    ur::details::printValue(os,
+                            *(params->pblocking));
 
     os << ", ";
     os << ".pSrc = ";
@@ -14604,12 +16457,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14652,7 +16507,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".workDim = ";
 
-    os << *(params->pworkDim);
+    ur::details::printValue(os,
+                            *(params->pworkDim));
 
     os << ", ";
     os << ".pGlobalWorkSize = ";
@@ -14669,7 +16525,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numPropsInLaunchPropList = ";
 
-    os << *(params->pnumPropsInLaunchPropList);
+    ur::details::printValue(os,
+                            *(params->pnumPropsInLaunchPropList));
 
     os << ", ";
     os << ".launchPropList = {";
@@ -14678,14 +16535,16 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
             os << ", ";
         }
 
-        os << (*(params->plaunchPropList))[i];
+        ur::details::printValue(os,
+                                (*(params->plaunchPropList))[i]);
     }
     os << "}";
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14728,7 +16587,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".workDim = ";
 
-    os << *(params->pworkDim);
+    ur::details::printValue(os,
+                            *(params->pworkDim));
 
     os << ", ";
     os << ".pGlobalWorkOffset = ";
@@ -14751,7 +16611,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14788,12 +16649,134 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".blocking = ";
 
-    os << *(params->pblocking);
+    ur::details::printValue(os,
+                            *(params->pblocking));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_kernel_launch_multi_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_kernel_launch_multi_exp_params_t *params) {
+
+    os << ".numLaunches = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumLaunches));
+
+    os << ", ";
+    os << ".pLaunches = {";
+    for (size_t i = 0; *(params->ppLaunches) != NULL && i < *params->pnumLaunches; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (*(params->ppLaunches))[i]);
+    }
+    os << "}";
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_usm_device_alloc_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_device_alloc_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".size = ";
+
+    ur::details::printValue(os,
+                            *(params->psize));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".ppMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppMem));
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_usm_free_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_free_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".pMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppMem));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -14830,8 +16813,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".pfnNativeEnqueue = ";
 
-    os << reinterpret_cast<void *>(
-        *(params->ppfnNativeEnqueue));
+    ur::details::printAddress(os, reinterpret_cast<void *>(
+                                  *(params->ppfnNativeEnqueue)));
 
     os << ", ";
     os << ".data = ";
@@ -14842,7 +16825,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numMemsInMemList = ";
 
-    os << *(params->pnumMemsInMemList);
+    ur::details::printValue(os,
+                            *(params->pnumMemsInMemList));
 
     os << ", ";
     os << ".phMemList = {";
@@ -14865,7 +16849,220 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_host_task_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_host_task_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".pfnHostTask = ";
+
+    ur::details::printAddress(os, reinterpret_cast<void *>(
+                                  *(params->ppfnHostTask)));
+
+    os << ", ";
+    os << ".pUserData = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppUserData));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_ipc_event_signal_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_ipc_event_signal_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".hIPCEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->phIPCEvent));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_ipc_event_wait_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_ipc_event_wait_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".hIPCEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->phIPCEvent));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_enqueue_usm_memcpy_batch_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_enqueue_usm_memcpy_batch_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".blocking = ";
+
+    ur::details::printValue(os,
+                            *(params->pblocking));
+
+    os << ", ";
+    os << ".numCopies = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumCopies));
+
+    os << ", ";
+    os << ".ppDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppDst));
+
+    os << ", ";
+    os << ".ppSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppSrc));
+
+    os << ", ";
+    os << ".pSizes = {";
+    for (size_t i = 0; *(params->ppSizes) != NULL && i < *params->pnumCopies; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (*(params->ppSizes))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -15160,7 +17357,106 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
+
+    os << ", ";
+    os << ".phEventWaitList = {";
+    for (size_t i = 0; *(params->pphEventWaitList) != NULL && i < *params->pnumEventsInWaitList; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphEventWaitList))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".phEvent = ";
+
+    ur::details::printPtr(os,
+                          *(params->pphEvent));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_bindless_images_image_copy_batch_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_bindless_images_image_copy_batch_exp_params_t *params) {
+
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    os << ", ";
+    os << ".pSrc = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppSrc));
+
+    os << ", ";
+    os << ".pDst = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppDst));
+
+    os << ", ";
+    os << ".pSrcImageDesc = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppSrcImageDesc));
+
+    os << ", ";
+    os << ".pDstImageDesc = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppDstImageDesc));
+
+    os << ", ";
+    os << ".pSrcImageFormat = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppSrcImageFormat));
+
+    os << ", ";
+    os << ".pDstImageFormat = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppDstImageFormat));
+
+    os << ", ";
+    os << ".numCopyRegions = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumCopyRegions));
+
+    os << ", ";
+    os << ".pCopyRegions = {";
+    for (size_t i = 0; *(params->ppCopyRegions) != NULL && i < *params->pnumCopyRegions; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (*(params->ppCopyRegions))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".imageCopyFlags = ";
+
+    ur::details::printFlag<ur_exp_image_copy_flag_t>(os,
+                                                     *(params->pimageCopyFlags));
+
+    os << ", ";
+    os << ".numEventsInWaitList = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -15203,7 +17499,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -15246,7 +17543,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".mipmapLevel = ";
 
-    os << *(params->pmipmapLevel);
+    ur::details::printValue(os,
+                            *(params->pmipmapLevel));
 
     os << ", ";
     os << ".phImageMem = ";
@@ -15303,12 +17601,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".memHandleType = ";
 
-    os << *(params->pmemHandleType);
+    ur::details::printValue(os,
+                            *(params->pmemHandleType));
 
     os << ", ";
     os << ".pExternalMemDesc = ";
@@ -15389,12 +17689,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".hExternalMem = ";
@@ -15457,7 +17759,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".semHandleType = ";
 
-    os << *(params->psemHandleType);
+    ur::details::printValue(os,
+                            *(params->psemHandleType));
 
     os << ", ";
     os << ".pExternalSemaphoreDesc = ";
@@ -15520,17 +17823,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".hasWaitValue = ";
 
-    os << *(params->phasWaitValue);
+    ur::details::printValue(os,
+                            *(params->phasWaitValue));
 
     os << ", ";
     os << ".waitValue = ";
 
-    os << *(params->pwaitValue);
+    ur::details::printValue(os,
+                            *(params->pwaitValue));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -15573,17 +17879,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".hasSignalValue = ";
 
-    os << *(params->phasSignalValue);
+    ur::details::printValue(os,
+                            *(params->phasSignalValue));
 
     os << ", ";
     os << ".signalValue = ";
 
-    os << *(params->psignalValue);
+    ur::details::printValue(os,
+                            *(params->psignalValue));
 
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -15632,7 +17941,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".ppMem = ";
@@ -15675,7 +17985,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".ppMem = ";
@@ -15718,7 +18029,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".ppMem = ";
@@ -15769,12 +18081,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -15857,12 +18171,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -15909,17 +18225,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".widthInBytes = ";
 
-    os << *(params->pwidthInBytes);
+    ur::details::printValue(os,
+                            *(params->pwidthInBytes));
 
     os << ", ";
     os << ".height = ";
 
-    os << *(params->pheight);
+    ur::details::printValue(os,
+                            *(params->pheight));
 
     os << ", ";
     os << ".elementSizeBytes = ";
 
-    os << *(params->pelementSizeBytes);
+    ur::details::printValue(os,
+                            *(params->pelementSizeBytes));
 
     os << ", ";
     os << ".ppMem = ";
@@ -15936,6 +18255,70 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_growable_alloc_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_growable_alloc_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hDevice = ";
+
+    ur::details::printPtr(os,
+                          *(params->phDevice));
+
+    os << ", ";
+    os << ".maxSize = ";
+
+    ur::details::printValue(os,
+                            *(params->pmaxSize));
+
+    os << ", ";
+    os << ".size = ";
+
+    ur::details::printValue(os,
+                            *(params->psize));
+
+    os << ", ";
+    os << ".ppMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->pppMem));
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_grow_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_grow_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".pMem = ";
+
+    ur::details::printPtr(os,
+                          *(params->ppMem));
+
+    os << ", ";
+    os << ".size = ";
+
+    ur::details::printValue(os,
+                            *(params->psize));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_usm_import_exp_params_t type
 /// @returns
@@ -15956,7 +18339,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     return os;
 }
@@ -15981,6 +18365,32 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_usm_pool_trim_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_usm_pool_trim_exp_params_t *params) {
+
+    os << ".hContext = ";
+
+    ur::details::printPtr(os,
+                          *(params->phContext));
+
+    os << ", ";
+    os << ".hPool = ";
+
+    ur::details::printPtr(os,
+                          *(params->phPool));
+
+    os << ", ";
+    os << ".minBytesToKeep = ";
+
+    ur::details::printValue(os,
+                            *(params->pminBytesToKeep));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_command_buffer_create_exp_params_t type
 /// @returns
@@ -16075,7 +18485,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".workDim = ";
 
-    os << *(params->pworkDim);
+    ur::details::printValue(os,
+                            *(params->pworkDim));
 
     os << ", ";
     os << ".pGlobalWorkOffset = ";
@@ -16098,7 +18509,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numKernelAlternatives = ";
 
-    os << *(params->pnumKernelAlternatives);
+    ur::details::printValue(os,
+                            *(params->pnumKernelAlternatives));
 
     os << ", ";
     os << ".phKernelAlternatives = {";
@@ -16115,7 +18527,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16126,7 +18539,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16187,12 +18601,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16203,7 +18619,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16264,17 +18681,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".patternSize = ";
 
-    os << *(params->ppatternSize);
+    ur::details::printValue(os,
+                            *(params->ppatternSize));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16285,7 +18705,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16346,22 +18767,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcOffset = ";
 
-    os << *(params->psrcOffset);
+    ur::details::printValue(os,
+                            *(params->psrcOffset));
 
     os << ", ";
     os << ".dstOffset = ";
 
-    os << *(params->pdstOffset);
+    ur::details::printValue(os,
+                            *(params->pdstOffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16372,7 +18797,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16427,12 +18853,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pSrc = ";
@@ -16443,7 +18871,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16454,7 +18883,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16509,12 +18939,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".pDst = ";
@@ -16525,7 +18957,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16536,7 +18969,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16597,42 +19031,50 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".srcOrigin = ";
 
-    os << *(params->psrcOrigin);
+    ur::details::printValue(os,
+                            *(params->psrcOrigin));
 
     os << ", ";
     os << ".dstOrigin = ";
 
-    os << *(params->pdstOrigin);
+    ur::details::printValue(os,
+                            *(params->pdstOrigin));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".srcRowPitch = ";
 
-    os << *(params->psrcRowPitch);
+    ur::details::printValue(os,
+                            *(params->psrcRowPitch));
 
     os << ", ";
     os << ".srcSlicePitch = ";
 
-    os << *(params->psrcSlicePitch);
+    ur::details::printValue(os,
+                            *(params->psrcSlicePitch));
 
     os << ", ";
     os << ".dstRowPitch = ";
 
-    os << *(params->pdstRowPitch);
+    ur::details::printValue(os,
+                            *(params->pdstRowPitch));
 
     os << ", ";
     os << ".dstSlicePitch = ";
 
-    os << *(params->pdstSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pdstSlicePitch));
 
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16643,7 +19085,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16698,37 +19141,44 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".bufferOffset = ";
 
-    os << *(params->pbufferOffset);
+    ur::details::printValue(os,
+                            *(params->pbufferOffset));
 
     os << ", ";
     os << ".hostOffset = ";
 
-    os << *(params->phostOffset);
+    ur::details::printValue(os,
+                            *(params->phostOffset));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".bufferRowPitch = ";
 
-    os << *(params->pbufferRowPitch);
+    ur::details::printValue(os,
+                            *(params->pbufferRowPitch));
 
     os << ", ";
     os << ".bufferSlicePitch = ";
 
-    os << *(params->pbufferSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pbufferSlicePitch));
 
     os << ", ";
     os << ".hostRowPitch = ";
 
-    os << *(params->phostRowPitch);
+    ur::details::printValue(os,
+                            *(params->phostRowPitch));
 
     os << ", ";
     os << ".hostSlicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    ur::details::printValue(os,
+                            *(params->phostSlicePitch));
 
     os << ", ";
     os << ".pSrc = ";
@@ -16739,7 +19189,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16750,7 +19201,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16805,37 +19257,44 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".bufferOffset = ";
 
-    os << *(params->pbufferOffset);
+    ur::details::printValue(os,
+                            *(params->pbufferOffset));
 
     os << ", ";
     os << ".hostOffset = ";
 
-    os << *(params->phostOffset);
+    ur::details::printValue(os,
+                            *(params->phostOffset));
 
     os << ", ";
     os << ".region = ";
 
-    os << *(params->pregion);
+    ur::details::printValue(os,
+                            *(params->pregion));
 
     os << ", ";
     os << ".bufferRowPitch = ";
 
-    os << *(params->pbufferRowPitch);
+    ur::details::printValue(os,
+                            *(params->pbufferRowPitch));
 
     os << ", ";
     os << ".bufferSlicePitch = ";
 
-    os << *(params->pbufferSlicePitch);
+    ur::details::printValue(os,
+                            *(params->pbufferSlicePitch));
 
     os << ", ";
     os << ".hostRowPitch = ";
 
-    os << *(params->phostRowPitch);
+    ur::details::printValue(os,
+                            *(params->phostRowPitch));
 
     os << ", ";
     os << ".hostSlicePitch = ";
 
-    os << *(params->phostSlicePitch);
+    ur::details::printValue(os,
+                            *(params->phostSlicePitch));
 
     os << ", ";
     os << ".pDst = ";
@@ -16846,7 +19305,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16857,7 +19317,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16918,22 +19379,26 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".patternSize = ";
 
-    os << *(params->ppatternSize);
+    ur::details::printValue(os,
+                            *(params->ppatternSize));
 
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -16944,7 +19409,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -16999,7 +19465,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".flags = ";
@@ -17010,7 +19477,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -17021,7 +19489,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -17076,7 +19545,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".advice = ";
@@ -17087,7 +19557,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numSyncPointsInWaitList = ";
 
-    os << *(params->pnumSyncPointsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumSyncPointsInWaitList));
 
     os << ", ";
     os << ".pSyncPointWaitList = ";
@@ -17098,7 +19569,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -17153,7 +19625,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -17258,7 +19731,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".numEventsInWaitList = ";
 
-    os << *(params->pnumEventsInWaitList);
+    ur::details::printValue(os,
+                            *(params->pnumEventsInWaitList));
 
     os << ", ";
     os << ".phEventWaitList = {";
@@ -17289,12 +19763,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17323,12 +19799,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17343,6 +19821,70 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_command_buffer_update_kernel_launch_batch_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_command_buffer_update_kernel_launch_batch_exp_params_t *params) {
+
+    os << ".hCommandBuffer = ";
+
+    ur::details::printPtr(os,
+                          *(params->phCommandBuffer));
+
+    os << ", ";
+    os << ".numKernelUpdates = ";
+
+    ur::details::printValue(os,
+                            *(params->pnumKernelUpdates));
+
+    os << ", ";
+    os << ".phCommands = {";
+    for (size_t i = 0; *(params->pphCommands) != NULL && i < *params->pnumKernelUpdates; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printPtr(os,
+                              (*(params->pphCommands))[i]);
+    }
+    os << "}";
+
+    os << ", ";
+    os << ".pUpdateKernelLaunch = {";
+    for (size_t i = 0; *(params->ppUpdateKernelLaunch) != NULL && i < *params->pnumKernelUpdates; ++i) {
+        if (i != 0) {
+            os << ", ";
+        }
+
+        ur::details::printValue(os,
+                                (*(params->ppUpdateKernelLaunch))[i]);
+    }
+    os << "}";
+
+    return os;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_command_buffer_upload_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_command_buffer_upload_exp_params_t *params) {
+
+    os << ".hCommandBuffer = ";
+
+    ur::details::printPtr(os,
+                          *(params->phCommandBuffer));
+
+    os << ", ";
+    os << ".hQueue = ";
+
+    ur::details::printPtr(os,
+                          *(params->phQueue));
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_usm_p2p_enable_peer_access_exp_params_t type
 /// @returns
@@ -17403,12 +19945,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17452,6 +19996,15 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     return os;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print operator for the ur_loader_invalidate_enumeration_cache_exp_params_t type
+/// @returns
+///     std::ostream &
+inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct ur_loader_invalidate_enumeration_cache_exp_params_t *params) {
+
+    return os;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Print operator for the ur_virtual_mem_granularity_get_info_params_t type
 /// @returns
@@ -17472,12 +20025,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17512,7 +20067,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".ppStart = ";
@@ -17543,7 +20099,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     return os;
 }
@@ -17568,7 +20125,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".hPhysicalMem = ";
@@ -17579,7 +20137,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".offset = ";
 
-    os << *(params->poffset);
+    ur::details::printValue(os,
+                            *(params->poffset));
 
     os << ", ";
     os << ".flags = ";
@@ -17610,7 +20169,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     return os;
 }
@@ -17635,7 +20195,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".flags = ";
@@ -17666,17 +20227,20 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".size = ";
 
-    os << *(params->psize);
+    ur::details::printValue(os,
+                            *(params->psize));
 
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17705,12 +20269,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".DeviceType = ";
 
-    os << *(params->pDeviceType);
+    ur::details::printValue(os,
+                            *(params->pDeviceType));
 
     os << ", ";
     os << ".NumEntries = ";
 
-    os << *(params->pNumEntries);
+    ur::details::printValue(os,
+                            *(params->pNumEntries));
 
     os << ", ";
     os << ".phDevices = {";
@@ -17747,12 +20313,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".DeviceType = ";
 
-    os << *(params->pDeviceType);
+    ur::details::printValue(os,
+                            *(params->pDeviceType));
 
     os << ", ";
     os << ".NumEntries = ";
 
-    os << *(params->pNumEntries);
+    ur::details::printValue(os,
+                            *(params->pNumEntries));
 
     os << ", ";
     os << ".phDevices = {";
@@ -17789,12 +20357,14 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".propName = ";
 
-    os << *(params->ppropName);
+    ur::details::printValue(os,
+                            *(params->ppropName));
 
     os << ", ";
     os << ".propSize = ";
 
-    os << *(params->ppropSize);
+    ur::details::printValue(os,
+                            *(params->ppropSize));
 
     os << ", ";
     os << ".pPropValue = ";
@@ -17857,7 +20427,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".NumDevices = ";
 
-    os << *(params->pNumDevices);
+    ur::details::printValue(os,
+                            *(params->pNumDevices));
 
     os << ", ";
     os << ".phSubDevices = {";
@@ -17900,7 +20471,8 @@ inline std::ostream &operator<<(std::ostream &os, [[maybe_unused]] const struct
     os << ", ";
     os << ".NumBinaries = ";
 
-    os << *(params->pNumBinaries);
+    ur::details::printValue(os,
+                            *(params->pNumBinaries));
 
     os << ", ";
     os << ".pSelectedBinary = ";
@@ -18002,18 +20574,21 @@ inline ur_result_t printPtr(std::ostream &os, const T *ptr) {
     if (ptr == nullptr) {
         os << "nullptr";
     } else if constexpr (std::is_pointer_v<T>) {
-        os << (const void *)(ptr) << " (";
+        printAddress(os, ptr);
+        os << " (";
         printPtr(os, *ptr);
         os << ")";
     } else if constexpr (std::is_void_v<T> || is_handle_v<T *>) {
-        os << (const void *)ptr;
+        printAddress(os, ptr);
     } else if constexpr (std::is_same_v<std::remove_cv_t<T>, char>) {
-        os << (const void *)(ptr) << " (";
+        printAddress(os, ptr);
+        os << " (";
         os << ptr;
         os << ")";
     } else {
-        os << (const void *)(ptr) << " (";
-        os << *ptr;
+        printAddress(os, ptr);
+        os << " (";
+        printValue(os, *ptr);
         os << ")";
     }
 
@@ -18119,6 +20694,18 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_EVENT_SET_CALLBACK: {
         os << (const struct ur_event_set_callback_params_t *)params;
     } break;
+    case UR_FUNCTION_EVENT_WAIT_ANY_EXP: {
+        os << (const struct ur_event_wait_any_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_EVENT_CREATE_IPC_EXP: {
+        os << (const struct ur_event_create_ipc_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP: {
+        os << (const struct ur_event_get_ipc_handle_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP: {
+        os << (const struct ur_event_open_ipc_handle_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
         os << (const struct ur_program_create_with_il_params_t *)params;
     } break;
@@ -18143,6 +20730,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_PROGRAM_LINK_EXP: {
         os << (const struct ur_program_link_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP: {
+        os << (const struct ur_program_build_async_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_PROGRAM_RETAIN: {
         os << (const struct ur_program_retain_params_t *)params;
     } break;
@@ -18221,6 +20811,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP: {
         os << (const struct ur_kernel_suggest_max_cooperative_group_count_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_KERNEL_SET_ARGS_EXP: {
+        os << (const struct ur_kernel_set_args_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_QUEUE_GET_INFO: {
         os << (const struct ur_queue_get_info_params_t *)params;
     } break;
@@ -18245,6 +20838,12 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_QUEUE_FLUSH: {
         os << (const struct ur_queue_flush_params_t *)params;
     } break;
+    case UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP: {
+        os << (const struct ur_queue_begin_capture_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_QUEUE_END_CAPTURE_EXP: {
+        os << (const struct ur_queue_end_capture_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_SAMPLER_CREATE: {
         os << (const struct ur_sampler_create_params_t *)params;
     } break;
@@ -18401,9 +21000,30 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP: {
         os << (const struct ur_enqueue_timestamp_recording_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP: {
+        os << (const struct ur_enqueue_kernel_launch_multi_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP: {
+        os << (const struct ur_enqueue_usm_device_alloc_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FREE_EXP: {
+        os << (const struct ur_enqueue_usm_free_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP: {
         os << (const struct ur_enqueue_native_command_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_ENQUEUE_HOST_TASK_EXP: {
+        os << (const struct ur_enqueue_host_task_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP: {
+        os << (const struct ur_enqueue_ipc_event_signal_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP: {
+        os << (const struct ur_enqueue_ipc_event_wait_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP: {
+        os << (const struct ur_enqueue_usm_memcpy_batch_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP: {
         os << (const struct ur_bindless_images_unsampled_image_handle_destroy_exp_params_t *)params;
     } break;
@@ -18425,6 +21045,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP: {
         os << (const struct ur_bindless_images_image_copy_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP: {
+        os << (const struct ur_bindless_images_image_copy_batch_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP: {
         os << (const struct ur_bindless_images_image_get_info_exp_params_t *)params;
     } break;
@@ -18488,12 +21111,21 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_USM_PITCHED_ALLOC_EXP: {
         os << (const struct ur_usm_pitched_alloc_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_USM_GROWABLE_ALLOC_EXP: {
+        os << (const struct ur_usm_growable_alloc_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_USM_GROW_EXP: {
+        os << (const struct ur_usm_grow_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_USM_IMPORT_EXP: {
         os << (const struct ur_usm_import_exp_params_t *)params;
     } break;
     case UR_FUNCTION_USM_RELEASE_EXP: {
         os << (const struct ur_usm_release_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_USM_POOL_TRIM_EXP: {
+        os << (const struct ur_usm_pool_trim_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP: {
         os << (const struct ur_command_buffer_create_exp_params_t *)params;
     } break;
@@ -18566,6 +21198,12 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP: {
         os << (const struct ur_command_buffer_command_get_info_exp_params_t *)params;
     } break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP: {
+        os << (const struct ur_command_buffer_update_kernel_launch_batch_exp_params_t *)params;
+    } break;
+    case UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP: {
+        os << (const struct ur_command_buffer_upload_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP: {
         os << (const struct ur_usm_p2p_enable_peer_access_exp_params_t *)params;
     } break;
@@ -18581,6 +21219,9 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     case UR_FUNCTION_LOADER_TEAR_DOWN: {
         os << (const struct ur_loader_tear_down_params_t *)params;
     } break;
+    case UR_FUNCTION_LOADER_INVALIDATE_ENUMERATION_CACHE_EXP: {
+        os << (const struct ur_loader_invalidate_enumeration_cache_exp_params_t *)params;
+    } break;
     case UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO: {
         os << (const struct ur_virtual_mem_granularity_get_info_params_t *)params;
     } break;
@@ -18637,6 +21278,50 @@ inline ur_result_t UR_APICALL printFunctionParams(std::ostream &os, ur_function_
     }
     return UR_RESULT_SUCCESS;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters into a caller provided buffer, without
+///        allocating
+/// @details The text is cut short when it doesn't fit, `*length` still being
+///          set to its full length. No terminating null character is written.
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+inline ur_result_t UR_APICALL printFunctionParams(char *buffer, size_t size, ur_function_t function, const void *params, size_t *length) {
+    details::buffer_streambuf buf(buffer, size);
+    std::ostream os(&buf);
+    ur_result_t result = printFunctionParams(os, function, params);
+    if (length) {
+        *length = buf.length();
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters into a buffer kept by the calling thread,
+///        which only allocates when it has to grow
+/// @returns
+///     The printed parameters, valid until the next call from the same thread,
+///     or an empty string if they couldn't be printed
+inline std::string_view printFunctionParams(ur_function_t function, const void *params) {
+    // Setting up a stream costs as much as printing most parameters
+    thread_local std::string buffer(256, '\0');
+    thread_local details::buffer_streambuf buf(buffer.data(), buffer.size());
+    thread_local std::ostream os(&buf);
+
+    buf.reset(buffer.data(), buffer.size());
+    if (printFunctionParams(os, function, params) != UR_RESULT_SUCCESS) {
+        return {};
+    }
+    if (buf.length() > buffer.size()) {
+        buffer.resize(buf.length());
+        buf.reset(buffer.data(), buffer.size());
+        printFunctionParams(os, function, params);
+    }
+    return std::string_view(buffer.data(), std::min(buf.length(), buffer.size()));
+}
 } // namespace ur::extras
 
 #endif /* UR_PRINT_HPP */
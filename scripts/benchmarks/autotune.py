@@ -0,0 +1,274 @@
+#!/usr/bin/env python3
+
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Searches the performance environment variables of the Level Zero adapter for
+# the configuration a workload runs fastest with. The workload is either a
+# trace captured with `urtrace --capture` and replayed with urreplay, or any
+# command, timed or with its result read from its output.
+
+from utils.utils import run
+from utils.stats import compare, median, median_ci, ratio_ci, relative_noise
+from benches.base import Benchmark
+from benches.options import options
+import argparse
+import json
+import os
+import re
+import subprocess # nosec B404
+import sys
+import time
+
+# Values tried for each knob, None leaving it unset for the adapter's default.
+# The defaults depend on the device, so unset is always a candidate of its own.
+KNOBS = {
+    'UR_L0_USE_IMMEDIATE_COMMANDLISTS': [None, '0', '1', '2'],
+    'UR_L0_BATCH_SIZE': [None, '1', '4', '16', '64'],
+    'UR_L0_USE_COPY_ENGINE': [None, '0', '1', '0:0'],
+    'UR_L0_USE_COPY_ENGINE_FOR_IN_ORDER_QUEUE': [None, '0', '1'],
+    'UR_L0_REUSE_DISCARDED_EVENTS': [None, '0', '1'],
+    'UR_L0_MAX_NUMBER_OF_EVENTS_PER_EVENT_POOL': [None, '64', '1024', '4096'],
+    # The same configs as the pool replay benchmark, and no pooling at all
+    'UR_L0_USM_ALLOCATOR': [None, '1;;device:4M,4,2M', '1;;device:4M,16,64K', '0'],
+}
+
+def describe(config):
+    if not config:
+        return "(defaults)"
+    return ' '.join(f"{knob}={value}" for knob, value in sorted(config.items()))
+
+class Workload:
+    def __init__(self, trace, command, metric, higher_is_better):
+        self.trace = trace
+        self.command = command
+        self.metric = re.compile(metric) if metric else None
+        self.lower_is_better = not higher_is_better
+
+        if trace:
+            self.unit = "μs"
+            self.replay_bin = os.path.join(options.ur_dir, 'bin', 'urreplay')
+            if not os.path.isfile(self.replay_bin):
+                raise FileNotFoundError(f"{self.replay_bin} does not exist")
+        else:
+            self.unit = "" if self.metric else "s"
+
+    # One sample of the workload with the knobs of config set, or None if it
+    # failed
+    def sample(self, config) -> float:
+        library_path = os.path.join(options.ur_dir, 'lib') + os.pathsep + os.environ.get('LD_LIBRARY_PATH', '')
+        env_vars = {
+            'UR_ADAPTERS_FORCE_LOAD': Benchmark.get_adapter_full_path(),
+            'LD_LIBRARY_PATH': library_path,
+            **config,
+        }
+        command = [self.replay_bin, '--no-gaps', '--csv', self.trace] if self.trace else self.command
+        try:
+            start = time.perf_counter()
+            output = run(command, env_vars=env_vars, cwd=options.benchmark_cwd).stdout.decode()
+            elapsed = time.perf_counter() - start
+        except (subprocess.CalledProcessError, subprocess.TimeoutExpired) as e:
+            print(f"failed: {e}")
+            return None
+
+        if self.trace:
+            # The replayed time of all the functions, the gaps between the
+            # calls aren't the adapter's
+            rows = [line.split(',') for line in output.splitlines()[1:] if line]
+            return sum(float(row[5]) for row in rows)
+        if self.metric:
+            match = self.metric.search(output)
+            if not match:
+                print("failed: the output doesn't match the metric")
+                return None
+            return float(match.group(1) if match.groups() else match.group(0))
+        return elapsed
+
+class Tuner:
+    def __init__(self, workload, knobs, budget):
+        self.workload = workload
+        self.knobs = knobs
+        self.budget = budget
+        # Samples of each config measured, by its description
+        self.samples = {}
+        self.failed = set()
+
+    def measure(self, config, iterations):
+        key = describe(config)
+        if key in self.failed:
+            return None
+        samples = self.samples.setdefault(key, [])
+        for iter in range(options.warmup + iterations):
+            warmup = iter < options.warmup
+            print(f"running {key}, {'warm-up' if warmup else 'iteration'} {iter if warmup else iter - options.warmup}... ", end='', flush=True)
+            value = self.workload.sample(config)
+            if value is None:
+                self.failed.add(key)
+                del self.samples[key]
+                return None
+            if warmup:
+                print("complete (discarded).")
+            else:
+                print(f"complete ({value:.3f} {self.workload.unit}).")
+                samples.append(value)
+        return samples
+
+    # Coordinate descent from the defaults: each knob in turn takes the value
+    # that is significantly better than the best config so far, until a pass
+    # over all of them changes nothing. Knobs mostly act on different parts of
+    # the adapter, so this finds what an exhaustive search would on a small
+    # fraction of its configs.
+    def search(self, passes):
+        best = {}
+        best_samples = self.measure(best, options.iterations)
+        if best_samples is None:
+            raise RuntimeError("the workload fails with the defaults")
+
+        tried = 1
+        for _ in range(passes):
+            changed = False
+            for knob, values in self.knobs.items():
+                for value in values:
+                    if value == best.get(knob):
+                        continue
+                    if tried >= self.budget:
+                        print(f"stopping the search after {tried} configs")
+                        return best
+                    candidate = {k: v for k, v in {**best, knob: value}.items() if v is not None}
+                    if describe(candidate) in self.samples:
+                        continue
+                    tried += 1
+                    samples = self.measure(candidate, options.iterations)
+                    if samples is None:
+                        continue
+                    comparison = compare(samples, best_samples, self.workload.lower_is_better, options.alpha, options.epsilon)
+                    if comparison and comparison.improved:
+                        print(f"{describe(candidate)} is {comparison.ratio:.3f}x the best so far (p={comparison.p_value})")
+                        best, best_samples = candidate, samples
+                        changed = True
+            if not changed:
+                break
+        return best
+
+    # Runs the defaults and the best config alternately, so that both see the
+    # same drift of the system, and reports how they compare
+    def confirm(self, best, iterations):
+        default_samples, best_samples = [], []
+        for iter in range(iterations):
+            for config, samples in (({}, default_samples), (best, best_samples)):
+                print(f"confirming {describe(config)}, iteration {iter}... ", end='', flush=True)
+                value = self.workload.sample(config)
+                if value is None:
+                    raise RuntimeError(f"{describe(config)} failed while confirming it")
+                print(f"complete ({value:.3f} {self.workload.unit}).")
+                samples.append(value)
+        return default_samples, best_samples
+
+def report(workload, best, default_samples, best_samples, level):
+    unit = workload.unit
+    print()
+    for name, samples in (("defaults", default_samples), ("best", best_samples)):
+        low, high = median_ci(samples, level)
+        print(f"{name:>8}: {median(samples):.3f} {unit} median, [{low:.3f}, {high:.3f}] {level:.0%} CI, {relative_noise(samples):.1%} noise")
+
+    # Speedup over the defaults, above 1 whichever way the metric goes
+    numerator, denominator = (default_samples, best_samples) if workload.lower_is_better else (best_samples, default_samples)
+    low, high = ratio_ci(numerator, denominator, level)
+    comparison = compare(best_samples, default_samples, workload.lower_is_better, options.alpha, options.epsilon)
+    speedup = comparison.ratio if comparison else 1.0
+    print(f" speedup: {speedup:.3f}x, [{low:.3f}, {high:.3f}] {level:.0%} CI", end='')
+    if comparison and comparison.p_value is not None:
+        print(f", p={comparison.p_value:.4f}", end='')
+    print(" (significant)" if comparison and comparison.significant else " (not significant)")
+
+    print("\nBest configuration:")
+    if not best or not (comparison and comparison.improved):
+        print(f"  the defaults, {describe(best)} wasn't confirmed better")
+    else:
+        for knob, value in sorted(best.items()):
+            print(f"  export {knob}='{value}'")
+
+    low, high = median_ci(best_samples, level)
+    return {
+        'config': best,
+        'unit': unit,
+        'lower_is_better': workload.lower_is_better,
+        'defaults': default_samples,
+        'best': best_samples,
+        'median': median(best_samples),
+        'median_ci': [low, high],
+        'speedup': speedup,
+        'speedup_ci': list(ratio_ci(numerator, denominator, level)),
+        'p_value': comparison.p_value if comparison else None,
+        'significant': bool(comparison and comparison.improved),
+    }
+
+def parse_knobs(knob_args, skip):
+    knobs = {knob: list(values) for knob, values in KNOBS.items() if knob not in skip}
+    for arg in knob_args:
+        if '=' not in arg:
+            raise ValueError(f"Knob argument '{arg}' is not in the form Variable=Value,Value...")
+        knob, values = arg.split('=', 1)
+        # The values of USM allocator configs use commas, ';' lists them then
+        separator = '|' if '|' in values else ','
+        knobs[knob] = [None if value == 'default' else value for value in values.split(separator)]
+        if None not in knobs[knob]:
+            knobs[knob].insert(0, None)
+    return knobs
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(description='Level Zero adapter configuration autotuner',
+                                     usage='%(prog)s [options] ur_dir (--trace TRACE | -- command...)',
+                                     epilog='Runs the command after -- as the workload when no --trace is given.')
+    parser.add_argument('ur_dir', type=str, help='UR install prefix path')
+    parser.add_argument('--trace', type=str, help='Replay this urtrace capture with urreplay as the workload.')
+    parser.add_argument('--metric', type=str, help='Regex whose first group is the result in the output of the command, instead of its run time.')
+    parser.add_argument('--higher-is-better', help='The metric is a throughput rather than a time.', action="store_true")
+    parser.add_argument('--knob', type=str, help="Values to try for a variable, as Variable=Value,Value... ('|' separated if the values have commas), 'default' leaving it unset.", action="append", default=[])
+    parser.add_argument('--skip', type=str, help='Variable not to tune.', action="append", default=[])
+    parser.add_argument('--budget', type=int, help='Maximum number of configurations to measure.', default=50)
+    parser.add_argument('--passes', type=int, help='Maximum number of passes over all the variables.', default=2)
+    parser.add_argument("--iterations", type=int, help='Number of times to run each configuration.', default=5)
+    parser.add_argument("--confirm", type=int, help='Number of alternate runs of the defaults and the best configuration to report.', default=10)
+    parser.add_argument("--warmup", type=int, help='Number of runs of each configuration to discard before the iterations.', default=1)
+    parser.add_argument("--alpha", type=float, help='Significance level a configuration must beat the best so far at.', default=0.05)
+    parser.add_argument("--epsilon", type=float, help='Threshold to consider change of performance significant', default=0.01)
+    parser.add_argument("--level", type=float, help='Level of the reported confidence intervals.', default=0.95)
+    parser.add_argument("--timeout", type=int, help='Timeout for individual runs in seconds.', default=600)
+    parser.add_argument("--output", type=str, help='Write the best configuration and its samples to this JSON file.')
+    parser.add_argument("--verbose", help='Print output of all the commands.', action="store_true")
+
+    # Everything after -- is the command, whatever options it takes
+    argv = sys.argv[1:]
+    command = argv[argv.index('--') + 1:] if '--' in argv else []
+    args = parser.parse_args(argv[:argv.index('--')] if '--' in argv else argv)
+    if bool(args.trace) == bool(command):
+        parser.error("give either --trace or a command after --")
+    # The samples must beat the best so far at alpha, the exact test needs
+    # enough of them to get there
+    if args.iterations < 4:
+        parser.error("--iterations must be at least 4 to tell configurations apart")
+
+    options.ur_dir = args.ur_dir
+    options.ur_adapter_name = 'level_zero'
+    options.iterations = args.iterations
+    options.warmup = args.warmup
+    options.alpha = args.alpha
+    options.epsilon = args.epsilon
+    options.timeout = args.timeout
+    options.verbose = args.verbose
+    options.benchmark_cwd = os.getcwd()
+
+    workload = Workload(args.trace, command, args.metric, args.higher_is_better)
+    tuner = Tuner(workload, parse_knobs(args.knob, args.skip), args.budget)
+    best = tuner.search(args.passes)
+    default_samples, best_samples = tuner.confirm(best, args.confirm)
+    result = report(workload, best, default_samples, best_samples, args.level)
+
+    if args.output:
+        result['measured'] = tuner.samples
+        with open(args.output, 'w') as file:
+            json.dump(result, file, indent=4)
+        print(f"Autotuning results have been written to {args.output}")
@@ -0,0 +1,56 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+from .base import Benchmark
+from .result import Result
+from .options import options
+
+# Runs tools/ur_api_bench, installed with UR, on the adapter under test. It
+# only uses the UR API, so changes inside an adapter are measured without a
+# SYCL runtime on top.
+class ApiBenchmark(Benchmark):
+    def __init__(self, directory, filter):
+        self.filter = filter
+        super().__init__(directory)
+
+    def name(self):
+        return f"ur_api_bench {self.filter}"
+
+    def unit(self):
+        return "μs"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur_dir, 'bin', 'ur_api_bench')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"{self.benchmark_bin} does not exist")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [
+            f"{self.benchmark_bin}",
+            "--csv",
+            "--filter", self.filter,
+        ]
+        result = self.run_bench(command, env_vars)
+        return [ Result(label=f"ur_api_bench {label}", value=value, command=command, env=env_vars, stdout=result, lower_is_better=self.lower_is_better()) for (label, value) in self.parse_output(result) ]
+
+    def parse_output(self, output):
+        csv_file = io.StringIO(output)
+        reader = csv.reader(csv_file)
+        next(reader, None)
+        rows = []
+        for row in reader:
+            try:
+                rows.append((row[0], float(row[1])))
+            except (ValueError, IndexError) as e:
+                raise ValueError(f"Error parsing output: {e}")
+        if not rows:
+            raise ValueError("Benchmark output does not contain data.")
+        return rows
+
+    def teardown(self):
+        return
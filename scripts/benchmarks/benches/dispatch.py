@@ -0,0 +1,85 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+import itertools
+from utils.utils import run
+from .base import Benchmark
+from .result import Result
+from .options import options
+
+# Layers whose combinations are measured, when the loader was built with them
+LAYERS = [
+    "UR_LAYER_PARAMETER_VALIDATION",
+    "UR_LAYER_LEAK_CHECKING",
+    "UR_LAYER_TRACING",
+]
+
+# Runs tools/ur_dispatch_bench, installed with UR, which measures the loader
+# and layers on the mock adapter. The layers are set when the loader is
+# initialized, so each combination of layers is a separate run of the binary.
+class DispatchOverhead(Benchmark):
+    def __init__(self, directory):
+        super().__init__(directory)
+
+    def name(self):
+        return "ur_dispatch_bench"
+
+    def unit(self):
+        return "ns"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur_dir, 'bin', 'ur_dispatch_bench')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"{self.benchmark_bin} does not exist")
+        available = run([self.benchmark_bin, "--available-layers"], env_vars=self.loader_env({})).stdout.decode().split()
+        self.layers = [layer for layer in LAYERS if layer in available]
+        cpus = os.cpu_count()
+        self.threads = sorted(set([1, 4, cpus] if cpus > 4 else [1, cpus]))
+
+    # The mock adapter is enabled through the loader config, so no adapter is
+    # forced, but the loader must be the one installed with the binary
+    def loader_env(self, env_vars):
+        library_path = os.path.join(options.ur_dir, 'lib') + os.pathsep + os.environ.get('LD_LIBRARY_PATH', '')
+        return {**env_vars, 'LD_LIBRARY_PATH': library_path}
+
+    def layer_combinations(self):
+        for count in range(len(self.layers) + 1):
+            yield from itertools.combinations(self.layers, count)
+
+    def run(self, env_vars) -> list[Result]:
+        results = []
+        for layers in self.layer_combinations():
+            command = [
+                f"{self.benchmark_bin}",
+                "--csv",
+                "--threads", ",".join(map(str, self.threads)),
+            ]
+            if layers:
+                command += ["--layers", ",".join(layers)]
+            result = run(command, env_vars=self.loader_env(env_vars), cwd=options.benchmark_cwd).stdout.decode()
+            suffix = " ".join(layer.removeprefix("UR_LAYER_").lower() for layer in layers) or "loader"
+            for (label, value) in self.parse_output(result):
+                results.append(Result(label=f"ur_dispatch_bench {label} {suffix}", value=value, command=command, env=env_vars, stdout=result, lower_is_better=self.lower_is_better()))
+        return results
+
+    def parse_output(self, output):
+        csv_file = io.StringIO(output)
+        reader = csv.reader(csv_file)
+        next(reader, None)
+        rows = []
+        for row in reader:
+            try:
+                rows.append((row[0], float(row[1])))
+            except (ValueError, IndexError) as e:
+                raise ValueError(f"Error parsing output: {e}")
+        if not rows:
+            raise ValueError("Benchmark output does not contain data.")
+        return rows
+
+    def teardown(self):
+        return
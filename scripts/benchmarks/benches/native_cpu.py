@@ -0,0 +1,78 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+from .base import Benchmark
+from .result import Result
+from .options import options
+
+# Runs tools/native_cpu_bench, installed with UR when the Native CPU adapter is
+# built. The adapter sizes its thread pool when it is loaded, so each thread
+# count is a separate run of the binary.
+class NativeCPUBenchmark(Benchmark):
+    def __init__(self, directory, threads):
+        self.threads = threads
+        super().__init__(directory)
+
+    def unit(self):
+        return "μs"
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur_dir, 'bin', 'native_cpu_bench')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"{self.benchmark_bin} does not exist")
+
+    def run_threads(self, threads, env_vars):
+        command = [
+            f"{self.benchmark_bin}",
+            "--csv",
+        ]
+        env_vars = {**env_vars, 'SYCL_NATIVE_CPU_HOST_THREADS': str(threads)}
+        result = self.run_bench(command, env_vars)
+        return (command, env_vars, result, self.parse_output(result))
+
+    def parse_output(self, output):
+        csv_file = io.StringIO(output)
+        reader = csv.reader(csv_file)
+        next(reader, None)
+        rows = {}
+        for row in reader:
+            try:
+                rows[row[0]] = float(row[1])
+            except (ValueError, IndexError) as e:
+                raise ValueError(f"Error parsing output: {e}")
+        if not rows:
+            raise ValueError("Benchmark output does not contain data.")
+        return rows
+
+    def teardown(self):
+        return
+
+class NativeCPULaunch(NativeCPUBenchmark):
+    def name(self):
+        return f"native_cpu_bench {self.threads} threads"
+
+    def run(self, env_vars) -> list[Result]:
+        (command, env, stdout, rows) = self.run_threads(self.threads, env_vars)
+        return [ Result(label=f"native_cpu_bench {label} {self.threads} threads", value=value, command=command, env=env, stdout=stdout, lower_is_better=self.lower_is_better()) for (label, value) in rows.items() ]
+
+# Speedup of each benchmark on the given number of threads over a single
+# thread, divided by the number of threads
+class NativeCPUScaling(NativeCPUBenchmark):
+    def name(self):
+        return f"native_cpu_bench scaling efficiency {self.threads} threads"
+
+    def unit(self):
+        return "%"
+
+    def lower_is_better(self):
+        return False
+
+    def run(self, env_vars) -> list[Result]:
+        (_, _, _, single) = self.run_threads(1, env_vars)
+        (command, env, stdout, rows) = self.run_threads(self.threads, env_vars)
+        return [ Result(label=f"native_cpu_bench {label} efficiency {self.threads} threads", value=single[label] / (self.threads * value) * 100, command=command, env=env, stdout=stdout, lower_is_better=self.lower_is_better()) for (label, value) in rows.items() if label in single and value > 0 ]
@@ -8,6 +8,10 @@ class Options:
     timeout: float = 600
     iterations: int = 5
     verbose: bool = False
+    epsilon: float = 0.005
+    alpha: float = 0.05
+    warmup: int = 1
+    history: int = 10
 
 options = Options()
 
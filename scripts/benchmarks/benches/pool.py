@@ -0,0 +1,75 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+import os
+import csv
+import io
+from utils.utils import run
+from .base import Benchmark
+from .result import Result
+from .options import options
+
+# Pool configs replayed, as UR_L0_USM_ALLOCATOR takes them: the built-in
+# defaults, larger slabs, and a bigger bucket capacity
+CONFIGS = [
+    "",
+    "1;;device:4M,4,2M",
+    "1;;device:4M,16,64K",
+]
+
+# Unit and direction of each metric ur_pool_bench reports
+METRICS = {
+    "throughput": ("Mops/s", False),
+    "footprint": ("MB", True),
+    "fragmentation": ("%", True),
+}
+
+# Runs tools/ur_pool_bench, installed with UR, which replays synthetic USM
+# allocation patterns through the adapters' disjoint pools for each config.
+# The pools allocate host memory, so no adapter is needed.
+class PoolReplay(Benchmark):
+    def __init__(self, directory, metric):
+        self.metric = metric
+        super().__init__(directory)
+
+    def name(self):
+        return f"ur_pool_bench {self.metric}"
+
+    def unit(self):
+        return METRICS[self.metric][0]
+
+    def lower_is_better(self):
+        return METRICS[self.metric][1]
+
+    def setup(self):
+        self.benchmark_bin = os.path.join(options.ur_dir, 'bin', 'ur_pool_bench')
+        if not os.path.isfile(self.benchmark_bin):
+            raise FileNotFoundError(f"{self.benchmark_bin} does not exist")
+
+    def run(self, env_vars) -> list[Result]:
+        command = [f"{self.benchmark_bin}", "--csv"]
+        for config in CONFIGS:
+            command += ["--config", config]
+        library_path = os.path.join(options.ur_dir, 'lib') + os.pathsep + os.environ.get('LD_LIBRARY_PATH', '')
+        result = run(command, env_vars={**env_vars, 'LD_LIBRARY_PATH': library_path}, cwd=options.benchmark_cwd).stdout.decode()
+        return [ Result(label=f"ur_pool_bench {label}", value=value, command=command, env=env_vars, stdout=result, lower_is_better=self.lower_is_better()) for (label, value) in self.parse_output(result) ]
+
+    def parse_output(self, output):
+        csv_file = io.StringIO(output)
+        reader = csv.reader(csv_file)
+        next(reader, None)
+        rows = []
+        for row in reader:
+            try:
+                if row[0].endswith(f" {self.metric}"):
+                    rows.append((row[0], float(row[1])))
+            except (ValueError, IndexError) as e:
+                raise ValueError(f"Error parsing output: {e}")
+        if not rows:
+            raise ValueError("Benchmark output does not contain data.")
+        return rows
+
+    def teardown(self):
+        return
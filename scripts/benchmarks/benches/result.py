@@ -3,7 +3,7 @@
 # See LICENSE.TXT
 # SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-from dataclasses import dataclass
+from dataclasses import dataclass, field
 from dataclasses_json import dataclass_json
 
 @dataclass_json
@@ -18,3 +18,5 @@ class Result:
     unit: str = ""
     name: str = ""
     lower_is_better: bool = True
+    # Values of the iterations the median value was taken from
+    samples: list[float] = field(default_factory=list)
@@ -5,7 +5,7 @@
 # See LICENSE.TXT
 # SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
-from utils.utils import prepare_workdir, load_benchmark_results, save_benchmark_results;
+from utils.utils import prepare_workdir, load_benchmark_results, save_benchmark_results, append_benchmark_history, load_benchmark_history;
 from benches.compute import *
 from benches.hashtable import Hashtable
 from benches.bitcracker import Bitcracker
@@ -15,6 +15,10 @@ from benches.quicksilver import QuickSilver
 from benches.SobelFilter import SobelFilter
 from benches.velocity import VelocityBench
 from benches.syclbench import *
+from benches.native_cpu import NativeCPULaunch, NativeCPUScaling
+from benches.dispatch import DispatchOverhead
+from benches.api import ApiBenchmark
+from benches.pool import PoolReplay
 from benches.options import options
 from output import generate_markdown
 import argparse
@@ -91,8 +95,31 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         Sf(sb),
         Syr2k(sb),
         Syrk(sb),
+
+        # *** UR API benchmarks
+        ApiBenchmark(directory, "event"),
+        ApiBenchmark(directory, "usm alloc"),
+        ApiBenchmark(directory, "copy"),
+        ApiBenchmark(directory, "command-buffer"),
+        ApiBenchmark(directory, "queues"),
+
+        # *** Loader and layers on the mock adapter
+        DispatchOverhead(directory),
+
+        # *** USM pool configs on synthetic allocation patterns
+        PoolReplay(directory, "throughput"),
+        PoolReplay(directory, "footprint"),
+        PoolReplay(directory, "fragmentation"),
     ]
 
+    if options.ur_adapter_name == 'native_cpu':
+        threads = os.cpu_count()
+        benchmarks += [
+            NativeCPULaunch(directory, 1),
+            NativeCPULaunch(directory, threads),
+            NativeCPUScaling(directory, threads),
+        ]
+
     if filter:
         benchmarks = [benchmark for benchmark in benchmarks if filter.search(benchmark.name())]
 
@@ -113,10 +140,18 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
         try:
             merged_env_vars = {**additional_env_vars}
             iteration_results = []
-            for iter in range(options.iterations):
-                print(f"running {benchmark.name()}, iteration {iter}... ", end='', flush=True)
+            for iter in range(options.warmup + options.iterations):
+                warmup = iter < options.warmup
+                if warmup:
+                    print(f"running {benchmark.name()}, warm-up {iter}... ", end='', flush=True)
+                else:
+                    print(f"running {benchmark.name()}, iteration {iter - options.warmup}... ", end='', flush=True)
                 bench_results = benchmark.run(merged_env_vars)
-                if bench_results is not None:
+                if bench_results is not None and warmup:
+                    # Warm-up runs fill caches and wake devices up, only
+                    # whether they finished matters
+                    print("complete (discarded).")
+                elif bench_results is not None:
                     for bench_result in bench_results:
                         if bench_result.passed:
                             print(f"complete ({bench_result.label}: {bench_result.value:.3f} {benchmark.unit()}).")
@@ -139,6 +174,7 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
 
                     median_result.unit = benchmark.unit()
                     median_result.name = label
+                    median_result.samples = [res.value for res in label_results]
 
                     results.append(median_result)
         except Exception as e:
@@ -162,8 +198,11 @@ def main(directory, additional_env_vars, save_name, compare_names, filter):
 
     if save_name:
         save_benchmark_results(directory, save_name, results)
+        append_benchmark_history(directory, save_name, results)
+
+    history = load_benchmark_history(directory, options.history)
 
-    markdown_content = generate_markdown(chart_data)
+    markdown_content = generate_markdown(chart_data, history)
 
     with open('benchmark_results.md', 'w') as file:
         file.write(markdown_content)
@@ -193,6 +232,9 @@ if __name__ == "__main__":
     parser.add_argument("--timeout", type=int, help='Timeout for individual benchmarks in seconds.', default=600)
     parser.add_argument("--filter", type=str, help='Regex pattern to filter benchmarks by name.', default=None)
     parser.add_argument("--epsilon", type=float, help='Threshold to consider change of performance significant', default=0.005)
+    parser.add_argument("--alpha", type=float, help='Significance level of the Mann-Whitney test comparing the iterations of two runs', default=0.05)
+    parser.add_argument("--warmup", type=int, help='Number of runs of each benchmark to discard before the iterations.', default=1)
+    parser.add_argument("--history", type=int, help='Number of saved runs to show the trends of.', default=10)
     parser.add_argument("--verbose", help='Print output of all the commands.', action="store_true")
     parser.add_argument("--exit_on_failure", help='Exit on first failure.', action="store_true")
 
@@ -205,6 +247,9 @@ if __name__ == "__main__":
     options.iterations = args.iterations
     options.timeout = args.timeout
     options.epsilon = args.epsilon
+    options.alpha = args.alpha
+    options.warmup = args.warmup
+    options.history = args.history
     options.ur_dir = args.ur_dir
     options.ur_adapter_name = args.ur_adapter_name
     options.exit_on_failure = args.exit_on_failure
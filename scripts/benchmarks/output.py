@@ -6,12 +6,14 @@
 import collections, re
 from benches.base import Result
 from benches.options import options
+from utils import stats
 import math
 
 class OutputLine:
     def __init__(self, name):
         self.label = name
         self.diff = None
+        self.comparison = None
         self.bars = None
         self.row = ""
 
@@ -100,17 +102,16 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
             key0 = list(chart_data.keys())[0]
             key1 = list(chart_data.keys())[1]
             if (key0 in results) and (key1 in results):
-                v0 = results[key0].value
-                v1 = results[key1].value
-                diff = None
-                if v0 != 0 and results[key0].lower_is_better:
-                    diff = v1/v0
-                elif v1 != 0 and not results[key0].lower_is_better:
-                    diff = v0/v1
-
-                if diff != None:
-                    oln.row += f"{(diff * 100):.2f}%"
-                    oln.diff = diff
+                # Results saved before the samples were kept only have the
+                # median, which compares against epsilon alone
+                s0 = results[key0].samples or [results[key0].value]
+                s1 = results[key1].samples or [results[key1].value]
+                comparison = stats.compare(s0, s1, results[key0].lower_is_better, options.alpha, options.epsilon)
+
+                if comparison != None:
+                    oln.row += f"{(comparison.ratio * 100):.2f}%"
+                    oln.diff = comparison.ratio
+                    oln.comparison = comparison
 
         output_detailed_list.append(oln)
 
@@ -124,10 +125,12 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
 
         for oln in sorted_detailed_list:
             if oln.diff != None:
+                comparison = oln.comparison
                 oln.row += f" | {(oln.diff - 1)*100:.2f}%"
-                delta = oln.diff - 1
-                oln.bars = round(10*(oln.diff - 1)/max_diff)
-                if oln.bars == 0 or abs(delta) < options.epsilon:
+                if comparison.p_value != None:
+                    oln.row += f" (p={comparison.p_value:.3f})"
+                oln.bars = round(10*(oln.diff - 1)/max_diff) if max_diff > 0 else 0
+                if oln.bars == 0 or not comparison.significant:
                     oln.row += " | . |"
                 elif oln.bars > 0:
                     oln.row += f" | {'+' * oln.bars} |"
@@ -135,11 +138,10 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
                     oln.row += f" | {'-' * (-oln.bars)} |"
 
                 mean_cnt += 1
-                if abs(delta) > options.epsilon:
-                    if delta > 0:
-                        improved+=1
-                    else:
-                        regressed+=1
+                if comparison.improved:
+                    improved+=1
+                elif comparison.regressed:
+                    regressed+=1
                 else:
                     no_change+=1
 
@@ -168,7 +170,7 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
     if mean_cnt > 0:
         global_mean = global_product ** (1/mean_cnt)
         summary_line = f"Total {mean_cnt} benchmarks in mean. "
-        summary_line += "\n" + f"Geomean {global_mean*100:.3f}%. \nImproved {improved} Regressed {regressed} (threshold {options.epsilon*100:.2f}%)"
+        summary_line += "\n" + f"Geomean {global_mean*100:.3f}%. \nImproved {improved} Regressed {regressed} (Mann-Whitney p < {options.alpha}, beyond the noise of either run and at least {options.epsilon*100:.2f}%)"
     else:
         summary_line = f"No diffs to calculate performance change"
 
@@ -211,7 +213,52 @@ def generate_summary_table_and_chart(chart_data: dict[str, list[Result]]):
 
     return summary_line, summary_table
 
-def generate_markdown(chart_data: dict[str, list[Result]]):
+# Table of the saved runs in the history, oldest first, next to this run. The
+# trend compares this run with the median of the history, and flags results
+# better or worse than all of it.
+def generate_trends(results: list[Result], history: list[dict]):
+    if not history:
+        return ""
+
+    runs = [{res['name']: res for res in entry['results']} for entry in history]
+    table = "| Benchmark | " + " | ".join(f"{entry['name']} {entry['date'][:10]}" for entry in history) + " | This PR | vs history median | - |\n"
+    table += "|---" * (len(history) + 4) + "|\n"
+
+    for res in sorted(results, key=lambda res: res.name):
+        values = [run[res.name]['value'] for run in runs if res.name in run]
+        if not values:
+            continue
+        row = f"| {res.name} |"
+        for run in runs:
+            row += f" {run[res.name]['value']:.3f} |" if res.name in run else " - |"
+        row += f" {res.value:.3f} {res.unit} |"
+
+        center = stats.median(values)
+        if center != 0 and res.value != 0:
+            ratio = center / res.value if res.lower_is_better else res.value / center
+            row += f" {(ratio - 1) * 100:.2f}% |"
+        else:
+            row += " - |"
+        best, worst = (min(values), max(values)) if res.lower_is_better else (max(values), min(values))
+        if len(values) > 1 and (res.value < best if res.lower_is_better else res.value > best):
+            row += " best |"
+        elif len(values) > 1 and (res.value > worst if res.lower_is_better else res.value < worst):
+            row += " worst |"
+        else:
+            row += "   |"
+        table += row + "\n"
+
+    return f"""
+## Trends over the last {len(history)} saved runs
+
+<details>
+<summary>History</summary>
+
+{table}
+</details>
+"""
+
+def generate_markdown(chart_data: dict[str, list[Result]], history: list[dict] = []):
     (summary_line, summary_table) = generate_summary_table_and_chart(chart_data)
 
     return f"""
@@ -219,6 +266,7 @@ def generate_markdown(chart_data: dict[str, list[Result]]):
 {summary_line}\n
 (<ins>result</ins> is better)\n
 {summary_table}
+{generate_trends(chart_data["This PR"], history)}
 # Details
 {generate_markdown_details(chart_data["This PR"])}
 """
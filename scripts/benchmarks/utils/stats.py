@@ -0,0 +1,156 @@
+# Copyright (C) 2024 Intel Corporation
+# Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+# See LICENSE.TXT
+# SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+# Statistics to tell performance changes from noise, on the few samples a
+# benchmark run gives. Only the standard library is used, so that the scripts
+# keep running on bare benchmark nodes.
+
+import math
+import random
+import statistics
+from dataclasses import dataclass
+from typing import Optional
+
+# Below this many samples on either side, the comparison falls back to the
+# relative change against epsilon
+MIN_SAMPLES = 3
+
+def median(samples: list[float]) -> float:
+    return statistics.median(samples)
+
+# Median absolute deviation relative to the median, which isn't thrown off by
+# the odd outlier the way the standard deviation is
+def relative_noise(samples: list[float]) -> float:
+    if len(samples) < 2:
+        return 0.0
+    center = median(samples)
+    if center == 0:
+        return 0.0
+    return median([abs(s - center) for s in samples]) / abs(center)
+
+def _ranks(values: list[float]) -> list[float]:
+    order = sorted(range(len(values)), key=lambda i: values[i])
+    ranks = [0.0] * len(values)
+    i = 0
+    while i < len(order):
+        j = i
+        while j + 1 < len(order) and values[order[j + 1]] == values[order[i]]:
+            j += 1
+        # Tied values share the mean of their ranks, 1-based
+        for k in range(i, j + 1):
+            ranks[order[k]] = (i + j) / 2 + 1
+        i = j + 1
+    return ranks
+
+# Number of ways to get each U statistic value with n1 and n2 samples and no
+# ties, U counting the pairs where the first sample is the smaller
+def _u_distribution(n1: int, n2: int) -> list[int]:
+    # counts[n][m] for the current sizes, built up one sample at a time
+    counts = {(0, m): [1] for m in range(n2 + 1)}
+    for n in range(1, n1 + 1):
+        counts[(n, 0)] = [1]
+        for m in range(1, n2 + 1):
+            # The largest sample is either from the first set, which adds m
+            # to U, or from the second, which adds nothing
+            a = [0] * m + counts[(n - 1, m)]
+            b = counts[(n, m - 1)]
+            size = max(len(a), len(b))
+            counts[(n, m)] = [(a[u] if u < len(a) else 0) + (b[u] if u < len(b) else 0) for u in range(size)]
+    return counts[(n1, n2)]
+
+# Two-sided p-value of the Mann-Whitney U test that a and b come from the same
+# distribution. Exact for small samples without ties, from the normal
+# approximation with a tie correction otherwise.
+def mann_whitney_p(a: list[float], b: list[float]) -> float:
+    n1, n2 = len(a), len(b)
+    ranks = _ranks(a + b)
+    u1 = sum(ranks[:n1]) - n1 * (n1 + 1) / 2
+    mean = n1 * n2 / 2
+    ties = len(set(a + b)) != n1 + n2
+
+    if not ties and n1 * n2 <= 400:
+        distribution = _u_distribution(n1, n2)
+        total = sum(distribution)
+        # The distribution is symmetric, count the tail beyond u1 on its side
+        u = min(u1, n1 * n2 - u1)
+        tail = sum(distribution[:int(u) + 1])
+        return min(1.0, 2 * tail / total)
+
+    n = n1 + n2
+    tie_sizes = [(a + b).count(v) for v in set(a + b)]
+    tie_term = sum(t ** 3 - t for t in tie_sizes) / (n * (n - 1))
+    variance = n1 * n2 / 12 * ((n + 1) - tie_term)
+    if variance == 0:
+        return 1.0
+    # Continuity correction
+    z = (abs(u1 - mean) - 0.5) / math.sqrt(variance)
+    return min(1.0, math.erfc(max(z, 0) / math.sqrt(2)))
+
+@dataclass
+class Comparison:
+    # How many times better the current median is than the baseline's, so
+    # that above 1 is an improvement whichever way the benchmark goes
+    ratio: float
+    # None when there weren't enough samples for the test
+    p_value: Optional[float]
+    # The relative change below which a difference is noise for this benchmark
+    threshold: float
+    significant: bool
+
+    @property
+    def improved(self) -> bool:
+        return self.significant and self.ratio > 1
+
+    @property
+    def regressed(self) -> bool:
+        return self.significant and self.ratio < 1
+
+# Compares a benchmark's samples against the baseline's. A change is
+# significant when the test rejects equal distributions at alpha and it is
+# larger than either run's noise and than epsilon.
+def compare(current: list[float], baseline: list[float], lower_is_better: bool, alpha: float, epsilon: float) -> Optional[Comparison]:
+    if not current or not baseline:
+        return None
+    current_median, baseline_median = median(current), median(baseline)
+    if current_median == 0 or baseline_median == 0:
+        return None
+    ratio = baseline_median / current_median if lower_is_better else current_median / baseline_median
+
+    threshold = max(epsilon, relative_noise(current), relative_noise(baseline))
+    large_enough = abs(ratio - 1) > threshold
+    if len(current) < MIN_SAMPLES or len(baseline) < MIN_SAMPLES:
+        return Comparison(ratio, None, epsilon, abs(ratio - 1) > epsilon)
+
+    p_value = mann_whitney_p(current, baseline)
+    return Comparison(ratio, p_value, threshold, p_value < alpha and large_enough)
+
+# Percentile bootstrap confidence interval, at the given level, of the median
+# of samples. The resampling is seeded, so that the same samples always give
+# the same interval.
+def median_ci(samples: list[float], level: float = 0.95, resamples: int = 2000) -> tuple[float, float]:
+    return ratio_ci(samples, None, level, resamples)
+
+# Bootstrap confidence interval of the ratio between the medians of a and b,
+# resampling both sides independently. With b None, the interval of the median
+# of a alone.
+def ratio_ci(a: list[float], b: Optional[list[float]], level: float = 0.95, resamples: int = 2000) -> tuple[float, float]:
+    if len(a) < 2 or (b is not None and len(b) < 2):
+        value = median(a) / median(b) if b is not None else median(a)
+        return (value, value)
+    rng = random.Random(0)
+    values = []
+    for _ in range(resamples):
+        value = median(rng.choices(a, k=len(a)))
+        if b is not None:
+            denominator = median(rng.choices(b, k=len(b)))
+            if denominator == 0:
+                continue
+            value /= denominator
+        values.append(value)
+    values.sort()
+    tail = (1 - level) / 2
+    low = values[int(tail * (len(values) - 1))]
+    high = values[int(math.ceil((1 - tail) * (len(values) - 1)))]
+    return (low, high)
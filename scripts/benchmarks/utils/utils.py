@@ -7,6 +7,7 @@ import os
 import json
 import shutil
 import subprocess # nosec B404
+from datetime import datetime, timezone
 from pathlib import Path
 from benches.result import Result
 from benches.options import options
@@ -70,6 +71,37 @@ def load_benchmark_results(dir, compare_name) -> list[Result]:
     else:
         return None
 
+# The history keeps every saved run, without the outputs, to show trends over
+# more runs than --compare does
+def append_benchmark_history(dir, save_name, benchmark_data: list[Result]):
+    results_dir = Path(os.path.join(dir, 'results'))
+    os.makedirs(results_dir, exist_ok=True)
+
+    entry = {
+        'name': save_name,
+        'date': datetime.now(timezone.utc).isoformat(timespec='seconds'),
+        'results': [{
+            'name': res.name,
+            'value': res.value,
+            'unit': res.unit,
+            'lower_is_better': res.lower_is_better,
+            'samples': res.samples,
+        } for res in benchmark_data],
+    }
+    file_path = Path(os.path.join(results_dir, 'history.jsonl'))
+    with file_path.open('a') as file:
+        file.write(json.dumps(entry) + '\n')
+    print(f"Benchmark results added to the history in {file_path}")
+
+# The last count saved runs, oldest first
+def load_benchmark_history(dir, count) -> list[dict]:
+    file_path = Path(os.path.join(dir, 'results', 'history.jsonl'))
+    if count <= 0 or not file_path.exists():
+        return []
+    with file_path.open('r') as file:
+        lines = [line for line in file if line.strip()]
+    return [json.loads(line) for line in lines[-count:]]
+
 def prepare_bench_cwd(dir):
     # we need 2 deep to workaround a problem with a fixed relative path in cudaSift
     options.benchmark_cwd = os.path.join(dir, 'bcwd', 'bcwd')
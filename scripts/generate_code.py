@@ -426,6 +426,30 @@ def _mako_interface_loader_api(path, adapter, ext, namespace, tags, version, spe
         specs=specs,
         meta=meta,)
 
+"""
+    generates c/c++ files from the specification documents
+"""
+def _mako_mock_functions_hpp(path, namespace, tags, version, specs, meta):
+    dstpath = os.path.join(path, "mock")
+    os.makedirs(dstpath, exist_ok=True)
+
+    template = "mock_functions.hpp.mako"
+    fin = os.path.join(templates_dir, template)
+
+    name = "%s_mock_functions"%(namespace)
+    filename = "%s.hpp"%(name)
+    fout = os.path.join(dstpath, filename)
+
+    print("Generating %s..."%fout)
+    return util.makoWrite(
+        fin, fout,
+        name=name,
+        ver=version,
+        namespace=namespace,
+        tags=tags,
+        specs=specs,
+        meta=meta)
+
 """
 Entry-point:
     generates adapter for unified_runtime
@@ -436,6 +460,7 @@ def generate_adapters(path, section, namespace, tags, version, specs, meta):
 
     loc = 0
     loc += _mako_mock_adapter_cpp(dstpath, namespace, tags, version, specs, meta)
+    loc += _mako_mock_functions_hpp(path, namespace, tags, version, specs, meta)
     loc += _mako_linker_scripts(
         dstpath, "adapter", "map", namespace, tags, version, specs, meta
     )
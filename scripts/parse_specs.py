@@ -268,6 +268,13 @@ def _validate_doc(f, d, tags, line_num, meta):
             elif type_traits.is_properties(d['name']) and not d.get('base', "").endswith("base_properties_t"):
                 raise Exception("'base' must be '%s_base_properties_t': %s"%(namespace, d['name']))
 
+    # Structures whose handles the loader template converts explicitly, rather
+    # than through the generic conversion of struct parameters, so that they
+    # may hold ranges of handles and output handles
+    loader_converted_structs = [
+        "$x_exp_kernel_launch_t"
+        ]
+
     def __validate_struct_range_members(name, members, meta):
         def has_handle(members, meta):
             for m in members:
@@ -330,7 +337,7 @@ def _validate_doc(f, d, tags, line_num, meta):
                 __validate_struct_range_members(item['name'], member_members,
                                                 meta)
 
-            if type_traits.is_handle(item['type']) and param_traits.is_output(item):
+            if type_traits.is_handle(item['type']) and param_traits.is_output(item) and d['name'] not in loader_converted_structs:
                 raise Exception(prefix + f"struct member {item['name']} is an object handle, so it must not be have the [out] tag")
 
             ver = __validate_version(item, prefix=prefix, base_version=d_ver)
@@ -386,7 +393,7 @@ def _validate_doc(f, d, tags, line_num, meta):
                     raise Exception(prefix+"bounds must only be used on entry points which take a `hQueue` parameter")
 
             if type_traits.is_struct(item['type'],
-                                     meta) and param_traits.is_range(item):
+                                     meta) and param_traits.is_range(item) and type_traits.base(item['type']) not in loader_converted_structs:
                 members = type_traits.get_struct_members(item['type'], meta)
                 __validate_struct_range_members(item['name'], members, meta)
 
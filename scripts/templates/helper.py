@@ -1661,6 +1661,42 @@ def get_handle_create_get_retain_release_functions(specs, namespace, tags):
 
     return records
 
+"""
+Public:
+    returns the intercept_features_t of the validation layer's intercept of a
+    function, what it does besides parameter validation
+"""
+def get_validation_intercept_features(namespace, tags, obj, handle_funcs):
+    func_name = make_func_name(namespace, tags, obj)
+    bounds_funcs = [namespace + f for f in [
+        "USMFree", "MemBufferCreate", "MemBufferPartition", "MemImageCreate",
+        "MemBufferCreateWithNativeHandle", "MemImageCreateWithNativeHandle",
+        "USMHostAlloc", "USMDeviceAlloc", "USMSharedAlloc", "USMPitchedAllocExp"]]
+
+    leaks = False
+    lifetime = False
+    for p in obj['params']:
+        ptype = subt(namespace, tags, p['type'])
+        input_funcs = next((hf for hf in handle_funcs if ptype == hf['handle'] and "[in]" in p['desc']), None)
+        if input_funcs and not any(func_name in funcs for funcs in input_funcs.values()):
+            lifetime = True
+        funcs = next((hf for hf in handle_funcs if ptype in [hf['handle'], hf['handle'] + "*"]), None)
+        if funcs and any(func_name in funcs[k] for k in ['create', 'get', 'retain', 'release']):
+            leaks = True
+
+    # The handles of its launch descriptors are checked too
+    if func_name == namespace + "EnqueueKernelLaunchMultiExp":
+        lifetime = True
+
+    features = []
+    if func_name in bounds_funcs:
+        features.append("INTERCEPT_BOUNDS")
+    if leaks:
+        features.append("INTERCEPT_LEAKS")
+    if lifetime:
+        features.append("INTERCEPT_LIFETIME")
+    return " | ".join(features) if features else "0"
+
 """
 Public:
     returns a list of objects representing functions that accept $x_queue_handle_t as a first param 
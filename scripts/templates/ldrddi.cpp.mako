@@ -41,6 +41,11 @@ namespace ur_loader
     %>${th.get_initial_null_set(obj)}
 
         [[maybe_unused]] auto context = getContext();
+        %if re.match(r"\w+AdapterRelease$", th.make_func_name(n, tags, obj)):
+
+        // the adapter may destroy its platforms and devices once released
+        context->invalidateEnumeration( ${obj['params'][0]['name']} );
+        %endif
         %if re.match(r"\w+AdapterGet$", th.make_func_name(n, tags, obj)):
         
         size_t adapterIndex = 0;
@@ -67,6 +72,10 @@ namespace ur_loader
                     break;
                 }
             }
+
+            // initialize the adapters' drivers concurrently
+            if( ${X}_RESULT_SUCCESS == result )
+                context->prefetchPlatforms( ${obj['params'][1]['name']}, static_cast<uint32_t>(adapterIndex) );
         }
 
         if( ${obj['params'][2]['name']} != nullptr )
@@ -79,37 +88,23 @@ namespace ur_loader
 
         for( uint32_t adapter_index = 0; adapter_index < ${obj['params'][1]['name']}; adapter_index++)
         {
-            // extract adapter's function pointer table
-            auto dditable =
-                reinterpret_cast<${n}_platform_object_t *>( ${obj['params'][0]['name']}[adapter_index])->dditable;
-
             if( ( 0 < ${obj['params'][2]['name']} ) && ( ${obj['params'][2]['name']} == total_platform_handle_count))
                 break;
 
-            uint32_t library_platform_handle_count = 0;
-
-            result = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( &${obj['params'][0]['name']}[adapter_index], 1, 0, nullptr, &library_platform_handle_count );
+            // the adapter is only asked once, see UR_LOADER_ENUMERATION_CACHE
+            std::vector<${n}_platform_handle_t> platforms;
+            result = context->getPlatforms( ${obj['params'][0]['name']}[adapter_index], platforms );
             if( ${X}_RESULT_SUCCESS != result ) break;
 
+            uint32_t library_platform_handle_count = static_cast<uint32_t>( platforms.size() );
+
             if( nullptr != ${obj['params'][3]['name']} && ${obj['params'][2]['name']} !=0)
             {
                 if( total_platform_handle_count + library_platform_handle_count > ${obj['params'][2]['name']}) {
                     library_platform_handle_count = ${obj['params'][2]['name']} - total_platform_handle_count;
                 }
-                result = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)}( &${obj['params'][0]['name']}[adapter_index], 1, library_platform_handle_count, &${obj['params'][3]['name']}[ total_platform_handle_count ], nullptr );
-                if( ${X}_RESULT_SUCCESS != result ) break;
-
-                try
-                {
-                    for( uint32_t i = 0; i < library_platform_handle_count; ++i ) {
-                        uint32_t platform_index = total_platform_handle_count + i;
-                        ${obj['params'][3]['name']}[ platform_index ] = reinterpret_cast<${n}_platform_handle_t>(
-                            context->factories.${n}_platform_factory.getInstance( ${obj['params'][3]['name']}[ platform_index ], dditable ) );
-                    }
-                }
-                catch( std::bad_alloc& )
-                {
-                    result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+                for( uint32_t i = 0; i < library_platform_handle_count; ++i ) {
+                    ${obj['params'][3]['name']}[ total_platform_handle_count + i ] = platforms[ i ];
                 }
             }
 
@@ -119,6 +114,114 @@ namespace ur_loader
         if( ${X}_RESULT_SUCCESS == result && ${obj['params'][4]['name']} != nullptr )
             *${obj['params'][4]['name']} = total_platform_handle_count;
 
+        %elif re.match(r"\w+DeviceGet$", th.make_func_name(n, tags, obj)):
+        if( 0 == ${obj['params'][2]['name']} && nullptr != ${obj['params'][3]['name']} )
+            return ${X}_RESULT_ERROR_INVALID_SIZE;
+
+        // the adapter is only asked once, see UR_LOADER_ENUMERATION_CACHE
+        std::vector<${n}_device_handle_t> devices;
+        result = context->getDevices( ${obj['params'][0]['name']}, ${obj['params'][1]['name']}, devices );
+        if( ${X}_RESULT_SUCCESS != result )
+            return result;
+
+        for( size_t i = 0; ( nullptr != ${obj['params'][3]['name']} ) && ( i < ${obj['params'][2]['name']} ) && ( i < devices.size() ); ++i )
+            ${obj['params'][3]['name']}[ i ] = devices[ i ];
+
+        if( nullptr != ${obj['params'][4]['name']} )
+            *${obj['params'][4]['name']} = static_cast<uint32_t>( devices.size() );
+
+        %elif re.match(r"\w+KernelSetArgsExp$", th.make_func_name(n, tags, obj)):
+        // extract platform's function pointer table
+        auto dditable = reinterpret_cast<${n}_kernel_object_t *>( hKernel )->dditable;
+        auto ${th.make_pfn_name(n, tags, obj)} = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNINITIALIZED;
+
+        // convert loader handle to platform handle
+        hKernel = reinterpret_cast<${n}_kernel_object_t *>( hKernel )->handle;
+
+        // Deal with any struct parameters that have handle members we need to convert.
+        std::vector<${x}_exp_kernel_arg_t> pArgsLocal( pArgs, pArgs + numArgs );
+        for( auto &Arg : pArgsLocal ) {
+            if( Arg.type == ${X}_EXP_KERNEL_ARG_TYPE_MEM_OBJ && Arg.value.memObjTuple.hMem ) {
+                Arg.value.memObjTuple.hMem = reinterpret_cast<${n}_mem_object_t *>( Arg.value.memObjTuple.hMem )->handle;
+            } else if( Arg.type == ${X}_EXP_KERNEL_ARG_TYPE_SAMPLER ) {
+                Arg.value.sampler = reinterpret_cast<${n}_sampler_object_t *>( Arg.value.sampler )->handle;
+            }
+        }
+
+        // Now that we've converted all the members update the param pointers
+        pArgs = pArgsLocal.data();
+
+        // forward to device-platform
+        result = ${th.make_pfn_name(n, tags, obj)}( hKernel, numArgs, pArgs );
+
+        %elif re.match(r"\w+EnqueueKernelLaunchMultiExp$", th.make_func_name(n, tags, obj)):
+        if( 0 == numLaunches )
+            return ${X}_RESULT_ERROR_INVALID_SIZE;
+
+        // extract platform's function pointer table, all the queues belonging to
+        // the same adapter
+        auto dditable = reinterpret_cast<${n}_queue_object_t *>( pLaunches[0].hQueue )->dditable;
+        auto ${th.make_pfn_name(n, tags, obj)} = dditable->${n}.${th.get_table_name(n, tags, obj)}.${th.make_pfn_name(n, tags, obj)};
+        if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
+            return ${X}_RESULT_ERROR_UNINITIALIZED;
+
+        // Deal with any struct parameters that have handle members we need to convert.
+        std::vector<${x}_exp_kernel_launch_t> pLaunchesLocal( pLaunches, pLaunches + numLaunches );
+        std::vector<std::vector<${x}_exp_kernel_arg_t>> pArgsLocal( numLaunches );
+        std::vector<std::vector<${x}_event_handle_t>> phEventWaitListLocal( numLaunches );
+        // The adapter's events are written here, so that the events of the
+        // launches made before a failing one are still wrapped
+        std::vector<${x}_event_handle_t> phEventLocal( numLaunches, nullptr );
+        for( uint32_t i = 0; i < numLaunches; ++i ) {
+            auto &Launch = pLaunchesLocal[i];
+            Launch.hQueue = reinterpret_cast<${n}_queue_object_t *>( Launch.hQueue )->handle;
+            Launch.hKernel = reinterpret_cast<${n}_kernel_object_t *>( Launch.hKernel )->handle;
+
+            if( Launch.pArgs ) {
+                pArgsLocal[i].assign( Launch.pArgs, Launch.pArgs + Launch.numArgs );
+                for( auto &Arg : pArgsLocal[i] ) {
+                    if( Arg.type == ${X}_EXP_KERNEL_ARG_TYPE_MEM_OBJ && Arg.value.memObjTuple.hMem ) {
+                        Arg.value.memObjTuple.hMem = reinterpret_cast<${n}_mem_object_t *>( Arg.value.memObjTuple.hMem )->handle;
+                    } else if( Arg.type == ${X}_EXP_KERNEL_ARG_TYPE_SAMPLER ) {
+                        Arg.value.sampler = reinterpret_cast<${n}_sampler_object_t *>( Arg.value.sampler )->handle;
+                    }
+                }
+                Launch.pArgs = pArgsLocal[i].data();
+            }
+
+            if( Launch.phEventWaitList ) {
+                phEventWaitListLocal[i].resize( Launch.numEventsInWaitList );
+                for( uint32_t j = 0; j < Launch.numEventsInWaitList; ++j ) {
+                    phEventWaitListLocal[i][j] = reinterpret_cast<${n}_event_object_t *>( Launch.phEventWaitList[j] )->handle;
+                }
+                Launch.phEventWaitList = phEventWaitListLocal[i].data();
+            }
+
+            if( Launch.phEvent ) {
+                Launch.phEvent = &phEventLocal[i];
+            }
+        }
+
+        // forward to device-platform
+        result = ${th.make_pfn_name(n, tags, obj)}( numLaunches, pLaunchesLocal.data() );
+
+        try
+        {
+            for( uint32_t i = 0; i < numLaunches; ++i ) {
+                if( nullptr == phEventLocal[i] )
+                    continue;
+                // convert platform handle to loader handle
+                *pLaunches[i].phEvent = reinterpret_cast<${x}_event_handle_t>(
+                    context->factories.${n}_event_factory.getInstance( phEventLocal[i], dditable ) );
+            }
+        }
+        catch( std::bad_alloc& )
+        {
+            result = ${X}_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+
         %else:
         <%param_replacements={}%>
         %for i, item in enumerate(th.get_loader_prologue(n, tags, obj, meta)):
@@ -380,7 +483,7 @@ ${tbl['export']['name']}(
 
     if( ${X}_RESULT_SUCCESS == result )
     {
-        if( ur_loader::getContext()->platforms.size() != 1 || ur_loader::getContext()->forceIntercept )
+        if( ur_loader::getContext()->intercept_enabled )
         {
             // return pointers to loader's DDIs
             %for obj in tbl['functions']:
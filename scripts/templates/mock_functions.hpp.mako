@@ -0,0 +1,40 @@
+<%!
+import re
+from templates import helper as th
+%><%
+    n=namespace
+    N=n.upper()
+
+    x=tags['$x']
+    X=x.upper()
+%>/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ${name}.hpp
+ *
+ */
+
+#pragma once
+
+#include "${x}_api.h"
+
+namespace mock {
+
+struct function_id_t {
+    const char *name;
+    ${x}_function_t id;
+};
+
+// The entry points of the mock adapter which callbacks can intercept
+inline constexpr function_id_t functionIds[] = {
+    %for obj in th.get_adapter_functions(specs):
+    {"${th.make_func_name(n, tags, obj)}", ${th.make_func_etor(n, tags, obj)}},
+    %endfor
+};
+
+} // namespace mock
@@ -22,36 +22,37 @@ from templates import print_helper as tph
 #include "${n}_print.h"
 #include "${n}_print.hpp"
 
-#include <algorithm>
-#include <sstream>
-#include <string.h>
+#include <ostream>
 
 <%def name="ss_copy(item_name)">\
-    std::stringstream ss;
-    ss << ${item_name};
-    return str_copy(&ss, buffer, buff_size, out_size);
+    return str_copy(${item_name}, buffer, buff_size, out_size);
 </%def>
 
-${x}_result_t str_copy(std::stringstream *ss, char *buff, const size_t buff_size, size_t *out_size) {
-    size_t c_str_size = strlen(ss->str().c_str()) + 1;
+// Reports the size of the printed text with its terminating null character,
+// and terminates it if it fit into the buffer
+${x}_result_t str_terminate(size_t length, char *buff, const size_t buff_size, size_t *out_size) {
     if (out_size) {
-        *out_size = c_str_size;
+        *out_size = length + 1;
     }
 
     if (buff) {
-        if (buff_size < c_str_size) {
+        if (buff_size < length + 1) {
             return ${X}_RESULT_ERROR_INVALID_SIZE;
         }
-
-#if defined(_WIN32)
-        strncpy_s(buff, buff_size, ss->str().c_str(), c_str_size);
-#else
-        strncpy(buff, ss->str().c_str(), std::min(buff_size, c_str_size));
-#endif
+        buff[length] = '\0';
     }
     return ${X}_RESULT_SUCCESS;
 }
 
+// Prints straight into the caller's buffer, only counting what doesn't fit
+template <typename T>
+${x}_result_t str_copy(const T &value, char *buff, const size_t buff_size, size_t *out_size) {
+    ${x}::details::buffer_streambuf buf(buff, buff_size);
+    std::ostream os(&buf);
+    os << value;
+    return str_terminate(buf.length(), buff, buff_size, out_size);
+}
+
 <%
     api_types_funcs = tph.get_api_types_funcs(specs, meta, n, tags)
 %>
@@ -63,10 +64,10 @@ ${x}_result_t ${func.c_name}(${func.c_args}) {
 %endfor
 
 ${x}_result_t ${x}PrintFunctionParams(enum ${x}_function_t function, const void *params, char *buffer, const size_t buff_size, size_t *out_size) {
-    std::stringstream ss;
-    ${x}_result_t result = ${x}::extras::printFunctionParams(ss, function, params);
+    size_t length = 0;
+    ${x}_result_t result = ${x}::extras::printFunctionParams(buffer, buff_size, function, params, &length);
     if (result != ${X}_RESULT_SUCCESS) {
         return result;
     }
-    return str_copy(&ss, buffer, buff_size, out_size);
+    return str_terminate(length, buffer, buff_size, out_size);
 }
@@ -23,8 +23,14 @@ from templates import helper as th
 #define ${X}_PRINT_HPP 1
 
 #include "${x}_api.h"
-#include <ostream>
+#include <algorithm>
 #include <bitset>
+#include <charconv>
+#include <cstring>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <string_view>
 
 ## Mako helper functions ######################################################
 <%def name="member(iname, itype, loop)">
@@ -41,9 +47,9 @@ from templates import helper as th
     %elif th.type_traits.is_handle(itype):
         ${x}::details::printPtr(os, ${caller.body()});
     %elif iname and iname.startswith("pfn"):
-        os << reinterpret_cast<void*>(${caller.body()});
+        ${x}::details::printAddress(os, reinterpret_cast<void*>(${caller.body()}));
     %else:
-        os << ${caller.body()};
+        ${x}::details::printValue(os, ${caller.body()});
     %endif
 </%def>
 
@@ -122,6 +128,70 @@ template <> struct is_handle<${th.make_type_name(n, tags, obj)}> : std::true_typ
 %endfor
 template <typename T>
 inline constexpr bool is_handle_v = is_handle<T>::value;
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Stream buffer writing into a caller provided buffer, which counts the
+// characters that don't fit instead of allocating for them
+class buffer_streambuf : public std::streambuf {
+  public:
+    buffer_streambuf(char *buffer, size_t size) { reset(buffer, size); }
+
+    // Starts writing over another buffer, so that the stream can be reused
+    void reset(char *buffer, size_t size) {
+        setp(buffer, buffer ? buffer + size : buffer);
+        dropped = 0;
+    }
+
+    // Number of characters written, including those that didn't fit
+    size_t length() const {
+        return static_cast<size_t>(pptr() - pbase()) + dropped;
+    }
+
+  protected:
+    std::streamsize xsputn(const char *s, std::streamsize n) override {
+        auto fits = std::min(n, static_cast<std::streamsize>(epptr() - pptr()));
+        if (fits > 0) {
+            std::memcpy(pptr(), s, static_cast<size_t>(fits));
+            pbump(static_cast<int>(fits));
+        }
+        dropped += static_cast<size_t>(n - fits);
+        return n;
+    }
+
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            ++dropped;
+        }
+        return traits_type::not_eof(ch);
+    }
+
+  private:
+    size_t dropped = 0;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print an address in hexadecimal through std::to_chars, rather than the
+// stream's locale
+inline void printAddress(std::ostream &os, const void *ptr) {
+    char buffer[2 + sizeof(uintptr_t) * 2] = {'0', 'x'};
+    auto result = std::to_chars(buffer + 2, buffer + sizeof(buffer),
+                                reinterpret_cast<uintptr_t>(ptr), 16);
+    os.write(buffer, result.ptr - buffer);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// @brief Print a value, integers through std::to_chars rather than the
+// stream's locale. Characters and anything else are left to the stream.
+template <typename T> inline void printValue(std::ostream &os, const T &value) {
+    if constexpr (std::is_integral_v<T> && sizeof(T) > 1) {
+        char buffer[24];
+        auto result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+        os.write(buffer, result.ptr - buffer);
+    } else {
+        os << value;
+    }
+}
+
 template <typename T> inline ${x}_result_t printPtr(std::ostream &os, const T *ptr);
 template <typename T> inline ${x}_result_t printFlag(std::ostream &os, uint32_t flag);
 template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const void *ptr, T value, size_t size);
@@ -244,7 +314,8 @@ template <typename T> inline ${x}_result_t printTagged(std::ostream &os, const v
                         os << "invalid size (is: " << size << ", expected: >=" << sizeof(${vtype}) << ")";
                         return ${X}_RESULT_ERROR_INVALID_SIZE;
                     }
-                    os << (const void *)(tptr) << " (";
+                    ${x}::details::printAddress(os, tptr);
+                    os << " (";
                     <%call expr="member(tptr, vtype, False)">
                         *tptr
                     </%call>
@@ -423,18 +494,21 @@ template <typename T> inline ${x}_result_t printPtr(std::ostream &os, const T *p
     if (ptr == nullptr) {
         os << "nullptr";
     } else if constexpr (std::is_pointer_v<T>) {
-        os << (const void *)(ptr) << " (";
+        printAddress(os, ptr);
+        os << " (";
         printPtr(os, *ptr);
         os << ")";
     } else if constexpr (std::is_void_v<T> || is_handle_v<T *>) {
-        os << (const void *)ptr;
+        printAddress(os, ptr);
     } else if constexpr (std::is_same_v<std::remove_cv_t< T >, char>) {
-        os << (const void *)(ptr) << " (";
+        printAddress(os, ptr);
+        os << " (";
         os << ptr;
         os << ")";
     } else {
-        os << (const void *)(ptr) << " (";
-        os << *ptr;
+        printAddress(os, ptr);
+        os << " (";
+        printValue(os, *ptr);
         os << ")";
     }
 
@@ -467,6 +541,50 @@ inline ${x}_result_t ${X}_APICALL printFunctionParams(std::ostream &os, ur_funct
     }
     return ${X}_RESULT_SUCCESS;
 }
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters into a caller provided buffer, without
+///        allocating
+/// @details The text is cut short when it doesn't fit, `*length` still being
+///          set to its full length. No terminating null character is written.
+/// @returns
+///     - ::${X}_RESULT_SUCCESS
+///     - ::${X}_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::${X}_RESULT_ERROR_INVALID_NULL_POINTER
+///         - `NULL == params`
+inline ${x}_result_t ${X}_APICALL printFunctionParams(char *buffer, size_t size, ur_function_t function, const void *params, size_t *length) {
+    details::buffer_streambuf buf(buffer, size);
+    std::ostream os(&buf);
+    ${x}_result_t result = printFunctionParams(os, function, params);
+    if (length) {
+        *length = buf.length();
+    }
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Print function parameters into a buffer kept by the calling thread,
+///        which only allocates when it has to grow
+/// @returns
+///     The printed parameters, valid until the next call from the same thread,
+///     or an empty string if they couldn't be printed
+inline std::string_view printFunctionParams(ur_function_t function, const void *params) {
+    // Setting up a stream costs as much as printing most parameters
+    thread_local std::string buffer(256, '\0');
+    thread_local details::buffer_streambuf buf(buffer.data(), buffer.size());
+    thread_local std::ostream os(&buf);
+
+    buf.reset(buffer.data(), buffer.size());
+    if (printFunctionParams(os, function, params) != ${X}_RESULT_SUCCESS) {
+        return {};
+    }
+    if (buf.length() > buffer.size()) {
+        buffer.resize(buf.length());
+        buf.reset(buffer.data(), buffer.size());
+        printFunctionParams(os, function, params);
+    }
+    return std::string_view(buffer.data(), std::min(buf.length(), buffer.size()));
+}
 } // namespace ${x}::extras
 
 #endif /* ${X}_PRINT_HPP */
@@ -19,6 +19,7 @@ from templates import helper as th
  *
  */
 
+#include "latency_tracker.hpp"
 #include "queue_api.hpp"
 
 ur_queue_handle_t_::~ur_queue_handle_t_() {}
@@ -33,6 +34,7 @@ ${th.make_func_name(n, tags, obj)}(
     %endfor
     )
 {
+    TRACK_SCOPE_LATENCY("ur_queue_handle_t_::${th.transform_queue_related_function_name(n, tags, obj, format=["name"]).split("(")[0]}");
     return ${obj['params'][0]['name']}->${th.transform_queue_related_function_name(n, tags, obj, format=["name"])};
 }
 %endfor
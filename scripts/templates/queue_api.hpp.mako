@@ -22,10 +22,19 @@ from templates import helper as th
 #pragma once
 
 #include <ur_api.h>
+#include <ze_api.h>
 
 struct ur_queue_handle_t_ {
     virtual ~ur_queue_handle_t_();
     %for obj in th.get_queue_related_functions(specs, n, tags):
     virtual ${x}_result_t ${th.transform_queue_related_function_name(n, tags, obj, format=["type"])} = 0;
     %endfor
+
+    // Appends zeCommandList, the regular command list of a finalized
+    // command-buffer, to the queue.
+    virtual ${x}_result_t enqueueCommandBuffer(ze_command_list_handle_t, uint32_t, const ${x}_event_handle_t *, ${x}_event_handle_t *) = 0;
+
+    // Sets the arguments of and launches the kernels of launches, which all
+    // target the queue, locking the queue once for them.
+    virtual ${x}_result_t enqueueKernelLaunchBatch(uint32_t, const ${x}_exp_kernel_launch_t *) = 0;
 };
@@ -42,6 +42,9 @@ namespace ur_tracing_layer
         if( nullptr == ${th.make_pfn_name(n, tags, obj)} )
             return ${X}_RESULT_ERROR_UNSUPPORTED_FEATURE;
 
+        if( !getContext()->isTraced(${th.make_func_etor(n, tags, obj)}) )
+            return ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
+
         ${th.make_pfncb_param_type(n, tags, obj)} params = { &${",&".join(th.make_param_lines(n, tags, obj, format=["name"]))} };
         uint64_t instance = getContext()->notify_begin(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params);
 
@@ -53,9 +56,8 @@ namespace ur_tracing_layer
         getContext()->notify_end(${th.make_func_etor(n, tags, obj)}, "${th.make_func_name(n, tags, obj)}", &params, &result, instance);
 
         if (logger.getLevel() <= logger::Level::INFO) {
-            std::ostringstream args_str;
-            ur::extras::printFunctionParams(args_str, ${th.make_func_etor(n, tags, obj)}, &params);
-            logger.info("   <--- ${th.make_func_name(n, tags, obj)}({}) -> {};\n", args_str.str(), result);
+            auto args_str = ur::extras::printFunctionParams(${th.make_func_etor(n, tags, obj)}, &params);
+            logger.info("   <--- ${th.make_func_name(n, tags, obj)}({}) -> {};\n", args_str, result);
         }
 
         return result;
@@ -82,13 +84,14 @@ namespace ur_tracing_layer
         %endfor
         )
     {
-        auto& dditable = ur_tracing_layer::getContext()->${n}DdiTable.${tbl['name']};
+        auto context = ur_tracing_layer::getContext();
+        auto& dditable = context->${n}DdiTable.${tbl['name']};
 
         if( nullptr == pDdiTable )
             return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
 
-        if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) != UR_MAJOR_VERSION(version) ||
-            UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) > UR_MINOR_VERSION(version))
+        if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+            UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version))
             return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
 
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
@@ -98,7 +101,8 @@ namespace ur_tracing_layer
     #if ${th.subt(n, tags, obj['condition'])}
         %endif
         dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = pDdiTable->${th.make_pfn_name(n, tags, obj)};
-        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_tracing_layer::${th.make_func_name(n, tags, obj)};
+        if( context->isIntercepted(${th.make_func_etor(n, tags, obj)}) )
+            pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_tracing_layer::${th.make_func_name(n, tags, obj)};
         %if 'condition' in obj:
     #else
         dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = nullptr;
@@ -94,6 +94,13 @@ namespace ur_validation_layer
             %endif
             %endfor
 
+        %if func_name == n + "USMFree":
+        if( getContext()->enableBoundsChecking )
+        {
+            getContext()->allocSizes.eraseUSM(pMem);
+        }
+
+        %endif
         ${x}_result_t result = ${th.make_pfn_name(n, tags, obj)}( ${", ".join(th.make_param_lines(n, tags, obj, format=["name"]))} );
 
         %for tp in tracked_params:
@@ -126,6 +133,37 @@ namespace ur_validation_layer
         %endif
         %endfor
 
+        %if func_name == n + "MemBufferCreate":
+        if( getContext()->enableBoundsChecking && result == ${X}_RESULT_SUCCESS )
+        {
+            getContext()->allocSizes.insertBuffer(*phBuffer, size);
+        }
+
+        %elif func_name == n + "MemBufferPartition":
+        if( getContext()->enableBoundsChecking && result == ${X}_RESULT_SUCCESS )
+        {
+            getContext()->allocSizes.insertBuffer(*phMem, pRegion->size);
+        }
+
+        %elif func_name in [n + "MemImageCreate", n + "MemBufferCreateWithNativeHandle", n + "MemImageCreateWithNativeHandle"]:
+        if( getContext()->enableBoundsChecking && result == ${X}_RESULT_SUCCESS )
+        {
+            getContext()->allocSizes.eraseBuffer(*phMem);
+        }
+
+        %elif func_name in [n + "USMHostAlloc", n + "USMDeviceAlloc", n + "USMSharedAlloc"]:
+        if( getContext()->enableBoundsChecking && result == ${X}_RESULT_SUCCESS )
+        {
+            getContext()->allocSizes.insertUSM(*ppMem, size);
+        }
+
+        %elif func_name == n + "USMPitchedAllocExp":
+        if( getContext()->enableBoundsChecking && result == ${X}_RESULT_SUCCESS )
+        {
+            getContext()->allocSizes.insertUSM(*ppMem, *pResultPitch * height);
+        }
+
+        %endif
         return result;
     }
     %if 'condition' in obj:
@@ -149,13 +187,14 @@ namespace ur_validation_layer
         %endfor
         )
     {
-        auto& dditable = ur_validation_layer::getContext()->${n}DdiTable.${tbl['name']};
+        auto context = ur_validation_layer::getContext();
+        auto& dditable = context->${n}DdiTable.${tbl['name']};
 
         if( nullptr == pDdiTable )
             return ${X}_RESULT_ERROR_INVALID_NULL_POINTER;
 
-        if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) != UR_MAJOR_VERSION(version) ||
-            UR_MINOR_VERSION(ur_validation_layer::getContext()->version) > UR_MINOR_VERSION(version))
+        if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+            UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version))
             return ${X}_RESULT_ERROR_UNSUPPORTED_VERSION;
 
         ${x}_result_t result = ${X}_RESULT_SUCCESS;
@@ -165,7 +204,8 @@ namespace ur_validation_layer
     #if ${th.subt(n, tags, obj['condition'])}
         %endif
         dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = pDdiTable->${th.make_pfn_name(n, tags, obj)};
-        pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_validation_layer::${th.make_func_name(n, tags, obj)};
+        if( context->isIntercepted(${th.get_validation_intercept_features(n, tags, obj, handle_create_get_retain_release_funcs)}) )
+            pDdiTable->${th.append_ws(th.make_pfn_name(n, tags, obj), 41)} = ur_validation_layer::${th.make_func_name(n, tags, obj)};
         %if 'condition' in obj:
     #else
         dditable.${th.append_ws(th.make_pfn_name(n, tags, obj), 43)} = nullptr;
@@ -13,6 +13,7 @@
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
 #include "tracing.hpp"
+#include "ur_perf_counters.hpp"
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
@@ -82,6 +83,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t) {
 UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
   std::lock_guard<std::mutex> Lock{adapter.Mutex};
   if (--adapter.RefCount == 0) {
+    UR_LOG_L(adapter.logger, INFO, "Performance counters:\n{}",
+             ur::perf_counters::get().dump());
     disableCUDATracing(adapter.TracingCtx);
     freeCUDATracingContext(adapter.TracingCtx);
     adapter.TracingCtx = nullptr;
@@ -108,6 +111,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
     return ReturnValue(UR_ADAPTER_BACKEND_CUDA);
   case UR_ADAPTER_INFO_REFERENCE_COUNT:
     return ReturnValue(adapter.RefCount.load());
+  case UR_ADAPTER_INFO_PERF_COUNTERS:
+    return ReturnValue(ur::perf_counters::get().dump().c_str());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -17,6 +17,7 @@
 #include "memory.hpp"
 #include "queue.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 namespace {
@@ -26,6 +27,8 @@ commandBufferReleaseInternal(ur_exp_command_buffer_handle_t CommandBuffer) {
     return UR_RESULT_SUCCESS;
   }
 
+  CommandBuffer->releaseSignalNodes();
+
   // Release the memory allocated to the CudaGraph
   UR_CHECK_ERROR(cuGraphDestroy(CommandBuffer->CudaGraph));
 
@@ -34,6 +37,10 @@ commandBufferReleaseInternal(ur_exp_command_buffer_handle_t CommandBuffer) {
     UR_CHECK_ERROR(cuGraphExecDestroy(CommandBuffer->CudaGraphExec));
   }
 
+  for (auto Event : CommandBuffer->WaitEvents) {
+    UR_TRACE(urEventRelease(Event));
+  }
+
   delete CommandBuffer;
   return UR_RESULT_SUCCESS;
 }
@@ -90,8 +97,51 @@ ur_exp_command_buffer_handle_t_::addSignalNode(CUgraphNode DepNode,
   UR_CHECK_ERROR(
       cuGraphAddEventRecordNode(&SignalNode, CudaGraph, &DepNode, 1, Event));
 
-  return std::unique_ptr<ur_event_handle_t_>(
+  auto SignalEvent = std::unique_ptr<ur_event_handle_t_>(
       ur_event_handle_t_::makeWithNative(Context, Event));
+
+  // Signal nodes of updatable command-buffers are kept, as their event may be
+  // queried through a command handle after finalization.
+  if (!IsUpdatable) {
+    SignalEvent->incrementReferenceCount();
+    PendingSignalNodes.emplace_back(SignalNode, SignalEvent.get());
+  }
+  return SignalEvent;
+}
+
+void ur_exp_command_buffer_handle_t_::elideSignalNodes() {
+  for (auto &[Node, Event] : PendingSignalNodes) {
+    // The reference held by the command-buffer is the last one left.
+    if (Event->getReferenceCount() != 1) {
+      continue;
+    }
+    for (auto Command : CommandHandles) {
+      if (Command->SignalNode == Node) {
+        Command->SignalNode = nullptr;
+      }
+    }
+    UR_CHECK_ERROR(cuGraphDestroyNode(Node));
+    // The event doesn't own its native event, see
+    // commandHandleReleaseInternal.
+    UR_CHECK_ERROR(cuEventDestroy(Event->get()));
+  }
+  releaseSignalNodes();
+}
+
+void ur_exp_command_buffer_handle_t_::releaseSignalNodes() {
+  for (auto &SignalNode : PendingSignalNodes) {
+    UR_TRACE(urEventRelease(SignalNode.second));
+  }
+  PendingSignalNodes.clear();
+}
+
+void ur_exp_command_buffer_handle_t_::retainWaitEvents(
+    uint32_t NumEvents, const ur_event_handle_t *Events) {
+  WaitEvents.reserve(WaitEvents.size() + NumEvents);
+  for (uint32_t i = 0; i < NumEvents; i++) {
+    Events[i]->incrementReferenceCount();
+    WaitEvents.push_back(Events[i]);
+  }
 }
 
 ur_result_t ur_exp_command_buffer_handle_t_::addWaitNodes(
@@ -103,6 +153,7 @@ ur_result_t ur_exp_command_buffer_handle_t_::addWaitNodes(
     UR_CHECK_ERROR(cuGraphAddEventWaitNode(
         &WaitNodes[i], CudaGraph, DepsList.data(), DepsList.size(), Event));
   }
+  retainWaitEvents(NumEventsInWaitList, EventWaitList);
   // Set DepsLists as an output parameter for communicating the list of wait
   // nodes created.
   DepsList = WaitNodes;
@@ -169,13 +220,19 @@ static ur_result_t getNodesFromSyncPoints(
     size_t NumSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *SyncPointWaitList,
     std::vector<CUgraphNode> &CuNodesList) {
-  // Map of ur_exp_command_buffer_sync_point_t to ur_event_handle_t defining
-  // the event associated with each sync-point
-  auto SyncPoints = CommandBuffer->SyncPoints;
+  // Map of ur_exp_command_buffer_sync_point_t to the graph node associated
+  // with each sync-point
+  const auto &SyncPoints = CommandBuffer->SyncPoints;
+
+  // Sync-points which another of the list already depends on would only add
+  // redundant edges to the graph
+  std::vector<ur_exp_command_buffer_sync_point_t> WaitList;
+  CommandBuffer->SyncPointGraph.reduce(SyncPointWaitList,
+                                       NumSyncPointsInWaitList, WaitList);
 
   // For each sync-point add associated CUDA graph node to the return list.
-  for (size_t i = 0; i < NumSyncPointsInWaitList; i++) {
-    if (auto NodeHandle = SyncPoints.find(SyncPointWaitList[i]);
+  for (auto SyncPoint : WaitList) {
+    if (auto NodeHandle = SyncPoints.find(SyncPoint);
         NodeHandle != SyncPoints.end()) {
       CuNodesList.push_back(NodeHandle->second);
     } else {
@@ -331,9 +388,10 @@ static ur_result_t enqueueCommandBufferFillHelper(
       *RetEvent = SignalEvent.release();
     }
 
-    // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = CommandBuffer->addSyncPoint(SyncPointNode);
+    // Get sync point and register the cuNode with it. Dependent commands are
+    // ordered after the command itself rather than its signal node, so that
+    // the signal node can be elided.
+    auto SyncPoint = CommandBuffer->addSyncPoint(GraphNode);
     if (RetSyncPoint) {
       *RetSyncPoint = SyncPoint;
     }
@@ -402,6 +460,8 @@ urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   try {
+    hCommandBuffer->elideSignalNodes();
+
     const unsigned long long flags = 0;
 #if CUDA_VERSION >= 12000
     UR_CHECK_ERROR(cuGraphInstantiate(&hCommandBuffer->CudaGraphExec,
@@ -456,22 +516,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
 
     if (*pGlobalWorkSize == 0) {
       // Create an empty node if the kernel workload size is zero
-      if (!phEvent) {
-        UR_CHECK_ERROR(cuGraphAddEmptyNode(&GraphNode,
-                                           hCommandBuffer->CudaGraph,
-                                           DepsList.data(), DepsList.size()));
-      } else {
-        CUevent Event = nullptr;
-        UR_CHECK_ERROR(cuEventCreate(&Event, CU_EVENT_DEFAULT));
-        UR_CHECK_ERROR(
-            cuGraphAddEventRecordNode(&GraphNode, hCommandBuffer->CudaGraph,
-                                      DepsList.data(), DepsList.size(), Event));
-
-        auto RetEventUP = std::unique_ptr<ur_event_handle_t_>(
-            ur_event_handle_t_::makeWithNative(hCommandBuffer->Context, Event));
-
-        *phEvent = RetEventUP.release();
-      }
+      UR_CHECK_ERROR(cuGraphAddEmptyNode(&GraphNode, hCommandBuffer->CudaGraph,
+                                         DepsList.data(), DepsList.size()));
 
       // Add signal node if external return event is used.
       CUgraphNode SignalNode = nullptr;
@@ -481,8 +527,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
       }
 
       // Get sync point and register the cuNode with it.
-      CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-      auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+      auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
       if (pSyncPoint) {
         *pSyncPoint = SyncPoint;
       }
@@ -530,8 +575,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -588,8 +632,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -656,8 +699,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -720,8 +762,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -781,8 +822,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -841,8 +881,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -906,8 +945,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -971,8 +1009,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -1027,8 +1064,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -1083,8 +1119,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     }
 
     // Get sync point and register the cuNode with it.
-    CUgraphNode SyncPointNode = SignalNode ? SignalNode : GraphNode;
-    auto SyncPoint = hCommandBuffer->addSyncPoint(SyncPointNode);
+    auto SyncPoint = hCommandBuffer->addSyncPoint(GraphNode);
     if (pSyncPoint) {
       *pSyncPoint = SyncPoint;
     }
@@ -1191,6 +1226,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue) {
+  if (!hCommandBuffer->CudaGraphExec) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+#if CUDA_VERSION >= 11010
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    CUstream CuStream = hQueue->getNextComputeStream();
+
+    // Moves the work of the first launch, such as copying the graph to the
+    // device, onto the stream now rather than on the first enqueue.
+    UR_CHECK_ERROR(cuGraphUpload(hCommandBuffer->CudaGraphExec, CuStream));
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+#else
+  std::ignore = hQueue;
+#endif
+
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
@@ -1347,18 +1406,19 @@ updateCommand(kernel_command_handle *Command,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
-    ur_exp_command_buffer_command_handle_t hCommand,
+/**
+ * Updates the command and the kernel arguments, and computes the new node
+ * parameters of the command in its Params.
+ * @param[in] KernelCommandHandle The command to be updated.
+ * @param[in] pUpdateKernelLaunch The update command description.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+ur_result_t updateKernelNodeParams(
+    kernel_command_handle *KernelCommandHandle,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
-
-  ur_exp_command_buffer_handle_t CommandBuffer = hCommand->CommandBuffer;
-
-  if (hCommand->getCommandType() != CommandType::Kernel) {
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  }
-
-  auto KernelCommandHandle = static_cast<kernel_command_handle *>(hCommand);
+  ur_exp_command_buffer_handle_t CommandBuffer =
+      KernelCommandHandle->CommandBuffer;
 
   UR_CHECK_ERROR(validateCommandDesc(KernelCommandHandle, pUpdateKernelLaunch));
   UR_CHECK_ERROR(
@@ -1397,10 +1457,29 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   Params.sharedMemBytes = KernelCommandHandle->Kernel->getLocalSize();
   Params.kernelParams =
       const_cast<void **>(KernelCommandHandle->Kernel->getArgIndices().data());
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  if (hCommand->getCommandType() != CommandType::Kernel) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  auto KernelCommandHandle = static_cast<kernel_command_handle *>(hCommand);
+  auto Result =
+      updateKernelNodeParams(KernelCommandHandle, pUpdateKernelLaunch);
+  if (Result != UR_RESULT_SUCCESS) {
+    return Result;
+  }
 
   CUgraphNode Node = KernelCommandHandle->Node;
-  CUgraphExec CudaGraphExec = CommandBuffer->CudaGraphExec;
-  UR_CHECK_ERROR(cuGraphExecKernelNodeSetParams(CudaGraphExec, Node, &Params));
+  CUgraphExec CudaGraphExec = hCommand->CommandBuffer->CudaGraphExec;
+  UR_CHECK_ERROR(cuGraphExecKernelNodeSetParams(CudaGraphExec, Node,
+                                                &KernelCommandHandle->Params));
+  KernelCommandHandle->IsGraphNodeOutdated = true;
   return UR_RESULT_SUCCESS;
 }
 
@@ -1465,7 +1544,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
     ur_event_handle_t WaitEvent = phEventWaitList[i];
     UR_CHECK_ERROR(cuGraphExecEventWaitNodeSetEvent(CudaGraphExec, WaitNodes[i],
                                                     WaitEvent->get()));
+    // Also updated in the graph, so that updates of the whole executable
+    // graph don't revert it
+    UR_CHECK_ERROR(
+        cuGraphEventWaitNodeSetEvent(WaitNodes[i], WaitEvent->get()));
   }
+  CommandBuffer->retainWaitEvents(NumEventsInWaitList, phEventWaitList);
 
   return UR_RESULT_SUCCESS;
 }
@@ -1501,3 +1585,91 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, uint32_t numKernelUpdates,
+    const ur_exp_command_buffer_command_handle_t *phCommands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  // All the updates are validated before any is applied, so that an invalid
+  // one doesn't leave the batch partially applied
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    if (phCommands[i]->CommandBuffer != hCommandBuffer ||
+        phCommands[i]->getCommandType() != CommandType::Kernel) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    auto Result =
+        validateCommandDesc(static_cast<kernel_command_handle *>(phCommands[i]),
+                            &pUpdateKernelLaunch[i]);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+
+  // When the batch updates at least half of the kernels, the nodes are
+  // updated in the graph instead, which doesn't touch the executable graph,
+  // and the executable graph is then updated once from the graph. That is
+  // only possible when the graph has all the earlier updates, or when the
+  // batch updates all the nodes which don't have them.
+  const auto &CommandHandles = hCommandBuffer->CommandHandles;
+  const auto NumKernelCommands = std::count_if(
+      CommandHandles.begin(), CommandHandles.end(), [](auto Command) {
+        return Command->getCommandType() == CommandType::Kernel;
+      });
+  bool UpdateWholeGraph =
+      numKernelUpdates > 1 &&
+      2 * static_cast<size_t>(numKernelUpdates) >=
+          static_cast<size_t>(NumKernelCommands);
+  if (UpdateWholeGraph) {
+    std::unordered_set<ur_exp_command_buffer_command_handle_t> Updated(
+        phCommands, phCommands + numKernelUpdates);
+    UpdateWholeGraph = std::none_of(
+        CommandHandles.begin(), CommandHandles.end(), [&](auto Command) {
+          return Command->getCommandType() == CommandType::Kernel &&
+                 static_cast<kernel_command_handle *>(Command)
+                     ->IsGraphNodeOutdated &&
+                 !Updated.count(Command);
+        });
+  }
+
+  if (!UpdateWholeGraph) {
+    for (uint32_t i = 0; i < numKernelUpdates; i++) {
+      auto Result = urCommandBufferUpdateKernelLaunchExp(
+          phCommands[i], &pUpdateKernelLaunch[i]);
+      if (Result != UR_RESULT_SUCCESS) {
+        return Result;
+      }
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    auto KernelCommandHandle =
+        static_cast<kernel_command_handle *>(phCommands[i]);
+    auto Result =
+        updateKernelNodeParams(KernelCommandHandle, &pUpdateKernelLaunch[i]);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    UR_CHECK_ERROR(cuGraphKernelNodeSetParams(KernelCommandHandle->Node,
+                                              &KernelCommandHandle->Params));
+  }
+
+#if CUDA_VERSION >= 12000
+  CUgraphExecUpdateResultInfo ResultInfo;
+  UR_CHECK_ERROR(cuGraphExecUpdate(hCommandBuffer->CudaGraphExec,
+                                   hCommandBuffer->CudaGraph, &ResultInfo));
+#else
+  CUgraphNode ErrorNode;
+  CUgraphExecUpdateResult UpdateResult;
+  UR_CHECK_ERROR(cuGraphExecUpdate(hCommandBuffer->CudaGraphExec,
+                                   hCommandBuffer->CudaGraph, &ErrorNode,
+                                   &UpdateResult));
+#endif
+
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    static_cast<kernel_command_handle *>(phCommands[i])->IsGraphNodeOutdated =
+        false;
+  }
+  return UR_RESULT_SUCCESS;
+}
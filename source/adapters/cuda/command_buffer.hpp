@@ -13,6 +13,7 @@
 #include <ur_print.hpp>
 
 #include "context.hpp"
+#include "ur_sync_point_graph.hpp"
 #include "logger/ur_logger.hpp"
 #include <cuda.h>
 #include <memory>
@@ -156,6 +157,10 @@ struct kernel_command_handle : ur_exp_command_buffer_command_handle_t_ {
   size_t GlobalWorkOffset[3];
   size_t GlobalWorkSize[3];
   size_t LocalWorkSize[3];
+
+  // Whether Node was updated in the executable graph only, which an update of
+  // the whole executable graph from CudaGraph would revert.
+  bool IsGraphNodeOutdated = false;
 };
 
 struct usm_memcpy_command_handle : ur_exp_command_buffer_command_handle_t_ {
@@ -292,6 +297,7 @@ struct ur_exp_command_buffer_handle_t_ {
   void registerSyncPoint(ur_exp_command_buffer_sync_point_t SyncPoint,
                          CUgraphNode CuNode) {
     SyncPoints[SyncPoint] = CuNode;
+    SyncPointGraph.add(SyncPoint);
     NextSyncPoint++;
   }
 
@@ -307,6 +313,20 @@ struct ur_exp_command_buffer_handle_t_ {
   std::unique_ptr<ur_event_handle_t_> addSignalNode(CUgraphNode DepNode,
                                                     CUgraphNode &SignalNode);
 
+  // Removes the signal nodes whose event has been released by the user
+  // before finalization, as nothing can wait on the event they record.
+  // Releases the references held on the events of the other signal nodes.
+  void elideSignalNodes();
+
+  // Releases the references held on the events of signal nodes which
+  // haven't been elided yet.
+  void releaseSignalNodes();
+
+  // Holds a reference on events waited on by the graph until it is
+  // destroyed, so that the command-buffer which recorded them can't elide
+  // their signal node and destroy their native event.
+  void retainWaitEvents(uint32_t NumEvents, const ur_event_handle_t *Events);
+
   // Adds a cuGraphAddEventWaitNodes node to the graph
   // @param[in,out] Dependencies for each of the wait nodes created. Set to the
   // list of wait nodes created on success.
@@ -367,7 +387,17 @@ struct ur_exp_command_buffer_handle_t_ {
   // Next sync_point value (may need to consider ways to reuse values if 32-bits
   // is not enough)
   ur_exp_command_buffer_sync_point_t NextSyncPoint;
+  // Dependencies between the sync points, to drop those of a wait list which
+  // are implied by the others before they become graph edges
+  ur::sync_point_graph SyncPointGraph;
 
   // Handles to individual commands in the command-buffer
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
+
+  // Signal nodes added to a non-updatable command-buffer with the event they
+  // record, on which a reference is held until finalization.
+  std::vector<std::pair<CUgraphNode, ur_event_handle_t>> PendingSignalNodes;
+
+  // Events waited on by wait nodes of the graph, see retainWaitEvents.
+  std::vector<ur_event_handle_t> WaitEvents;
 };
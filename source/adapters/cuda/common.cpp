@@ -13,6 +13,8 @@
 
 #include <cuda.h>
 
+#include <chrono>
+#include <cstdlib>
 #include <sstream>
 
 ur_result_t mapErrorUR(CUresult Result) {
@@ -92,6 +94,35 @@ std::string getCudaVersionString() {
   return stream.str();
 }
 
+namespace {
+const std::chrono::microseconds HostSyncSpinTime = [] {
+  const char *SpinStr = std::getenv("UR_CUDA_HOST_SYNC_SPIN_US");
+  int Spin = SpinStr ? std::atoi(SpinStr) : 0;
+  return std::chrono::microseconds(Spin > 0 ? Spin : 0);
+}();
+
+template <typename T, typename QueryFn, typename SyncFn>
+CUresult hostSynchronizeImpl(T Handle, QueryFn Query, SyncFn Sync) {
+  if (HostSyncSpinTime.count() > 0) {
+    auto Deadline = std::chrono::steady_clock::now() + HostSyncSpinTime;
+    do {
+      CUresult Result = Query(Handle);
+      if (Result != CUDA_ERROR_NOT_READY)
+        return Result;
+    } while (std::chrono::steady_clock::now() < Deadline);
+  }
+  return Sync(Handle);
+}
+} // namespace
+
+CUresult hostSynchronize(CUevent Event) {
+  return hostSynchronizeImpl(Event, cuEventQuery, cuEventSynchronize);
+}
+
+CUresult hostSynchronize(CUstream Stream) {
+  return hostSynchronizeImpl(Stream, cuStreamQuery, cuStreamSynchronize);
+}
+
 void detail::ur::die(const char *Message) {
   logger::always("ur_die:{}", Message);
   std::terminate();
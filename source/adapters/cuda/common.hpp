@@ -32,6 +32,13 @@ void checkErrorUR(ur_result_t Result, const char *Function, int Line,
 
 std::string getCudaVersionString();
 
+/// Waits for the work recorded in an event, or submitted to a stream, to
+/// complete. Polls for up to UR_CUDA_HOST_SYNC_SPIN_US microseconds before
+/// blocking, since waking up from a blocking wait takes longer than short
+/// kernels do.
+CUresult hostSynchronize(CUevent Event);
+CUresult hostSynchronize(CUstream Stream);
+
 constexpr size_t MaxMessageSize = 256;
 extern thread_local ur_result_t ErrorMessageCode;
 extern thread_local char ErrorMessage[MaxMessageSize];
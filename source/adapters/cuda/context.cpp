@@ -9,9 +9,65 @@
 //===----------------------------------------------------------------------===//
 
 #include "context.hpp"
+#include "image.hpp"
+#include "logger/ur_logger.hpp"
 #include "usm.hpp"
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
+#include <iterator>
+
+namespace {
+// Whether the context ScopedContext made current last is trusted to still be
+// current. Off by default, as the application changing the current context
+// itself between two calls on a thread, through cudaSetDevice for instance,
+// would then go unnoticed.
+const bool CacheCurrentContext = [] {
+  const char *CacheStr = std::getenv("UR_CUDA_CACHE_CURRENT_CONTEXT");
+  return CacheStr && std::atoi(CacheStr) != 0;
+}();
+
+thread_local CUcontext CurrentContext = nullptr;
+} // namespace
+
+size_t getPhysicalMemPoolCapacity() {
+  static const size_t Capacity = [] {
+    const char *CapacityStr = std::getenv("UR_CUDA_PHYSICAL_MEM_POOL_MB");
+    long long MiB = CapacityStr ? std::atoll(CapacityStr) : 256;
+    return MiB > 0 ? static_cast<size_t>(MiB) << 20 : size_t{0};
+  }();
+  return Capacity;
+}
+
+void setCurrentContext(CUcontext Desired) {
+  if (CacheCurrentContext && Desired == CurrentContext) {
+#ifdef NDEBUG
+    return;
+#else
+    CUcontext Original = nullptr;
+    UR_CHECK_ERROR(cuCtxGetCurrent(&Original));
+    if (Original == Desired) {
+      return;
+    }
+    logger::warning("The current CUDA context was changed outside of the "
+                    "adapter, which UR_CUDA_CACHE_CURRENT_CONTEXT doesn't "
+                    "notice in release builds");
+#endif
+  }
+
+  CUcontext Original = nullptr;
+  UR_CHECK_ERROR(cuCtxGetCurrent(&Original));
+
+  // Make sure the desired context is active on the current thread, setting
+  // it if necessary
+  if (Original != Desired) {
+    UR_CHECK_ERROR(cuCtxSetCurrent(Desired));
+  }
+  CurrentContext = Desired;
+}
+
+void forgetCurrentContext() { CurrentContext = nullptr; }
 
 void ur_context_handle_t_::addPool(ur_usm_pool_handle_t Pool) {
   std::lock_guard<std::mutex> Lock(Mutex);
@@ -34,6 +90,289 @@ ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
   return nullptr;
 }
 
+void ur_context_handle_t_::addGrowableAllocation(
+    std::unique_ptr<GrowableAllocation> Allocation) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto Ptr = Allocation->get();
+  GrowableAllocations.emplace(Ptr, std::move(Allocation));
+}
+
+ur_result_t ur_context_handle_t_::growGrowableAllocation(void *Ptr,
+                                                         size_t Size) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = GrowableAllocations.find(Ptr);
+  if (It == GrowableAllocations.end()) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  try {
+    It->second->grow(Size);
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+std::unique_ptr<GrowableAllocation>
+ur_context_handle_t_::takeGrowableAllocation(void *Ptr) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = GrowableAllocations.find(Ptr);
+  if (It == GrowableAllocations.end()) {
+    return nullptr;
+  }
+  auto Allocation = std::move(It->second);
+  GrowableAllocations.erase(It);
+  return Allocation;
+}
+
+void ur_context_handle_t_::addImageMem(
+    ur_exp_image_mem_native_handle_t hImageMem, size_t Size) {
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    ImageMemSizes[hImageMem] = Size;
+  }
+  MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE, Size);
+}
+
+void ur_context_handle_t_::removeImageMem(
+    ur_exp_image_mem_native_handle_t hImageMem) {
+  size_t Size = 0;
+  {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto It = ImageMemSizes.find(hImageMem);
+    if (It == ImageMemSizes.end()) {
+      return;
+    }
+    Size = It->second;
+    ImageMemSizes.erase(It);
+  }
+  MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE, Size);
+}
+
+std::shared_ptr<const std::vector<char>>
+ur_context_handle_t_::findCubin(const std::string &Key) {
+  std::lock_guard<std::mutex> Lock(CubinsMutex);
+  auto It = Cubins.find(Key);
+  return It == Cubins.end() ? nullptr : It->second.lock();
+}
+
+void ur_context_handle_t_::addCubin(
+    const std::string &Key, std::shared_ptr<const std::vector<char>> Cubin) {
+  std::lock_guard<std::mutex> Lock(CubinsMutex);
+  // Forget the cubins of the programs released since
+  for (auto It = Cubins.begin(); It != Cubins.end();) {
+    It = It->second.expired() ? Cubins.erase(It) : std::next(It);
+  }
+  Cubins[Key] = std::move(Cubin);
+}
+
+void ur_context_handle_t_::trimPools(size_t MinBytesToKeep) {
+  freeDeferredBuffers(/*Wait=*/false);
+  std::lock_guard<std::mutex> Lock(Mutex);
+  for (auto &Pool : PoolHandles) {
+    MinBytesToKeep -= Pool->trim(MinBytesToKeep);
+  }
+  for (auto &Pool : BufferMemPools) {
+    if (Pool) {
+      MinBytesToKeep -=
+          std::min(umf::poolTrim(Pool.get(), MinBytesToKeep), MinBytesToKeep);
+    }
+  }
+#if CUDA_VERSION >= 11030
+  for (auto Pool : QueueOrderedPools) {
+    if (!Pool) {
+      continue;
+    }
+    UR_CHECK_ERROR(cuMemPoolTrimTo(Pool, MinBytesToKeep));
+    cuuint64_t Reserved = 0, Used = 0;
+    UR_CHECK_ERROR(cuMemPoolGetAttribute(
+        Pool, CU_MEMPOOL_ATTR_RESERVED_MEM_CURRENT, &Reserved));
+    UR_CHECK_ERROR(
+        cuMemPoolGetAttribute(Pool, CU_MEMPOOL_ATTR_USED_MEM_CURRENT, &Used));
+    MinBytesToKeep -=
+        std::min(static_cast<size_t>(Reserved - Used), MinBytesToKeep);
+  }
+#endif
+}
+
+#if CUDA_VERSION >= 11030
+CUmemoryPool
+ur_context_handle_t_::getQueueOrderedPool(ur_device_handle_t hDevice) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto &Pool = QueueOrderedPools[getDeviceIndex(hDevice)];
+  if (Pool) {
+    return Pool;
+  }
+
+  int Supported = 0;
+  UR_CHECK_ERROR(cuDeviceGetAttribute(
+      &Supported, CU_DEVICE_ATTRIBUTE_MEMORY_POOLS_SUPPORTED, hDevice->get()));
+  if (!Supported) {
+    throw UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  CUmemPoolProps Props{};
+  Props.allocType = CU_MEM_ALLOCATION_TYPE_PINNED;
+  Props.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  Props.location.id = static_cast<int>(hDevice->getIndex());
+  UR_CHECK_ERROR(cuMemPoolCreate(&Pool, &Props));
+
+  // The freed memory is kept for the later allocations rather than released
+  // at every synchronization, urUSMPoolTrimExp gives it back to the driver
+  cuuint64_t ReleaseThreshold = UINT64_MAX;
+  UR_CHECK_ERROR(cuMemPoolSetAttribute(
+      Pool, CU_MEMPOOL_ATTR_RELEASE_THRESHOLD, &ReleaseThreshold));
+  return Pool;
+}
+#endif
+
+umf_memory_pool_handle_t
+ur_context_handle_t_::getBufferMemPool(ur_device_handle_t hDevice) {
+  if (!DisjointPoolConfigInstance.EnableBuffers) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto &Pool =
+      BufferMemPools[hDevice ? getDeviceIndex(hDevice) : Devices.size()];
+  if (Pool) {
+    return Pool.get();
+  }
+
+  auto MemProvider =
+      hDevice ? umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(
+                    this, hDevice, UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER)
+                    .second
+              : umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+                    this, nullptr, UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER)
+                    .second;
+  auto [Result, NewPool] = DisjointPoolConfigInstance.makePool(
+      std::move(MemProvider), hDevice ? usm::DisjointPoolMemType::Device
+                                      : usm::DisjointPoolMemType::Host);
+  if (Result != UMF_RESULT_SUCCESS) {
+    throw umf::umf2urResult(Result);
+  }
+  Pool = std::move(NewPool);
+  return Pool.get();
+}
+
+bool ur_context_handle_t_::usesBufferMemPools() const noexcept {
+  return DisjointPoolConfigInstance.EnableBuffers;
+}
+
+void ur_context_handle_t_::deferBufferFree(
+    std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations,
+    std::vector<device_event_t> UseEvents) {
+  if (UseEvents.empty()) {
+    for (auto [Pool, Ptr] : Allocations) {
+      umfPoolFree(Pool, Ptr);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> Lock(DeferredBufferFreesMutex);
+  DeferredBufferFrees.push_back(
+      deferred_buffer_free{std::move(Allocations), std::move(UseEvents)});
+}
+
+void ur_context_handle_t_::freeDeferredBuffers(bool Wait) {
+  std::vector<deferred_buffer_free> Completed;
+  {
+    std::lock_guard<std::mutex> Lock(DeferredBufferFreesMutex);
+    if (DeferredBufferFrees.empty()) {
+      return;
+    }
+    auto IsCompleted = [Wait](const device_event_t &Event) {
+      auto Result = Wait ? cuEventSynchronize(Event.second)
+                         : cuEventQuery(Event.second);
+      return Result != CUDA_ERROR_NOT_READY;
+    };
+    auto IsPending = [&](const deferred_buffer_free &Free) {
+      return !std::all_of(Free.UseEvents.begin(), Free.UseEvents.end(),
+                          IsCompleted);
+    };
+    auto It = std::stable_partition(DeferredBufferFrees.begin(),
+                                    DeferredBufferFrees.end(), IsPending);
+    std::move(It, DeferredBufferFrees.end(), std::back_inserter(Completed));
+    DeferredBufferFrees.erase(It, DeferredBufferFrees.end());
+  }
+
+  for (auto &Free : Completed) {
+    for (auto [Pool, Ptr] : Free.Allocations) {
+      umfPoolFree(Pool, Ptr);
+    }
+    for (auto [Device, Event] : Free.UseEvents) {
+      try {
+        releaseNativeEvent(Device, /*Timing=*/false, Event);
+      } catch (ur_result_t) {
+        // the event is lost, the allocations are returned anyway
+      }
+    }
+  }
+}
+
+CUevent ur_context_handle_t_::acquireNativeEvent(ur_device_handle_t hDevice,
+                                                 bool Timing) {
+  {
+    std::lock_guard<std::mutex> Lock(NativeEventsMutex);
+    auto &Events = NativeEvents[getDeviceIndex(hDevice)][Timing];
+    if (!Events.empty()) {
+      CUevent Event = Events.back();
+      Events.pop_back();
+      return Event;
+    }
+  }
+
+  CUevent Event = nullptr;
+  UR_CHECK_ERROR(cuEventCreate(&Event, Timing ? CU_EVENT_DEFAULT
+                                              : CU_EVENT_DISABLE_TIMING));
+  return Event;
+}
+
+ur_context_handle_t_::~ur_context_handle_t_() {
+  freeDeferredBuffers(/*Wait=*/true);
+  BufferMemPools.clear();
+  for (auto &Chunk : PhysicalMemPool.trim(0)) {
+    cuMemRelease(Chunk.second);
+  }
+#if CUDA_VERSION >= 11030
+  for (auto Pool : QueueOrderedPools) {
+    if (Pool) {
+      cuMemPoolDestroy(Pool);
+    }
+  }
+#endif
+  // The recycled events were created in the native contexts of their devices
+  for (size_t I = 0; I < NativeEvents.size(); ++I) {
+    ScopedContext Active(Devices[I]);
+    for (auto &Events : NativeEvents[I]) {
+      for (auto Event : Events) {
+        cuEventDestroy(Event);
+      }
+    }
+  }
+  for (auto &Dev : Devices) {
+    urDeviceRelease(Dev);
+  }
+}
+
+void ur_context_handle_t_::releaseNativeEvent(ur_device_handle_t hDevice,
+                                              bool Timing, CUevent Event) {
+  // Enough for the events in flight of a few busy queues, without holding on
+  // to every event of a burst
+  static constexpr size_t MaxNativeEvents = 1024;
+
+  {
+    std::lock_guard<std::mutex> Lock(NativeEventsMutex);
+    auto &Events = NativeEvents[getDeviceIndex(hDevice)][Timing];
+    if (Events.size() < MaxNativeEvents) {
+      Events.push_back(Event);
+      return;
+    }
+  }
+
+  UR_CHECK_ERROR(cuEventDestroy(Event));
+}
+
 /// Create a UR CUDA context.
 ///
 /// By default creates a scoped context and keeps the last active CUDA context
@@ -104,6 +443,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextGetInfo(
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
     // 2D USM operations currently not supported.
     return ReturnValue(false);
+  case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+  case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+  case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+    return hContext->MemoryAccounting.getInfo(ContextInfoType, ReturnValue);
 
   default:
     break;
@@ -118,6 +461,7 @@ urContextRelease(ur_context_handle_t hContext) {
     return UR_RESULT_SUCCESS;
   }
   hContext->invokeExtendedDeleters();
+  destroyAllImageHandles(hContext);
 
   std::unique_ptr<ur_context_handle_t_> Context{hContext};
 
@@ -12,15 +12,25 @@
 #include <cuda.h>
 #include <ur_api.h>
 
+#include <array>
 #include <atomic>
+#include <memory>
 #include <mutex>
 #include <set>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 #include "common.hpp"
 #include "device.hpp"
+#include "growable_mem.hpp"
+#include "ur_event_notifier.hpp"
+#include "ur_image_handle_cache.hpp"
+#include "ur_memory_accounting.hpp"
+#include "ur_physical_mem_pool.hpp"
 
 #include <umf/memory_pool.h>
+#include <umf_helpers.hpp>
 
 typedef void (*ur_context_extended_deleter_t)(void *user_data);
 
@@ -74,6 +84,10 @@ typedef void (*ur_context_extended_deleter_t)(void *user_data);
 ///  if necessary.
 ///
 ///
+/// Bytes of physical memory a context keeps for reuse once released, from
+/// UR_CUDA_PHYSICAL_MEM_POOL_MB, 256 MiB by default
+size_t getPhysicalMemPoolCapacity();
+
 struct ur_context_handle_t_ {
 
   struct deleter_data {
@@ -86,18 +100,20 @@ struct ur_context_handle_t_ {
   std::vector<ur_device_handle_t> Devices;
   std::atomic_uint32_t RefCount;
 
+  // Memory the context holds from the driver, declared before the pools,
+  // which return theirs as they're destroyed
+  ur::memory_accounting MemoryAccounting{this};
+
   ur_context_handle_t_(const ur_device_handle_t *Devs, uint32_t NumDevices)
-      : Devices{Devs, Devs + NumDevices}, RefCount{1} {
+      : Devices{Devs, Devs + NumDevices}, RefCount{1},
+        NativeEvents(NumDevices), QueueOrderedPools(NumDevices, nullptr),
+        BufferMemPools(NumDevices + 1) {
     for (auto &Dev : Devices) {
       urDeviceRetain(Dev);
     }
   };
 
-  ~ur_context_handle_t_() {
-    for (auto &Dev : Devices) {
-      urDeviceRelease(Dev);
-    }
-  }
+  ~ur_context_handle_t_();
 
   void invokeExtendedDeleters() {
     std::lock_guard<std::mutex> Guard(Mutex);
@@ -135,12 +151,135 @@ struct ur_context_handle_t_ {
 
   ur_usm_pool_handle_t getOwningURPool(umf_memory_pool_t *UMFPool);
 
+  // Trims every pool of the context, which share the budget
+  void trimPools(size_t MinBytesToKeep);
+
+  void addGrowableAllocation(std::unique_ptr<GrowableAllocation> Allocation);
+
+  // Grows the growable allocation starting at Ptr to Size bytes. The
+  // allocation is grown with the lock held, so urUSMFree can't destroy it
+  // meanwhile.
+  ur_result_t growGrowableAllocation(void *Ptr, size_t Size);
+
+  // Removes the growable allocation starting at Ptr, if any, from the context
+  std::unique_ptr<GrowableAllocation> takeGrowableAllocation(void *Ptr);
+
+  // Counts the Size bytes of the bindless image memory hImageMem allocated
+  void addImageMem(ur_exp_image_mem_native_handle_t hImageMem, size_t Size);
+
+  // Uncounts the bindless image memory hImageMem freed, unless the context
+  // didn't allocate it
+  void removeImageMem(ur_exp_image_mem_native_handle_t hImageMem);
+
+#if CUDA_VERSION >= 11030
+  // Returns the memory pool of hDevice serving the queue-ordered allocations,
+  // which is created on first use. Throws UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+  // if the device doesn't support memory pools.
+  CUmemoryPool getQueueOrderedPool(ur_device_handle_t hDevice);
+#endif
+
+  // Returns the UMF pool the buffers of the context allocate from in the
+  // memory of hDevice, or in pinned host memory if hDevice is null, which is
+  // created on first use. Returns nullptr if buffers aren't pooled.
+  umf_memory_pool_handle_t getBufferMemPool(ur_device_handle_t hDevice);
+
+  // Whether the buffers of the context allocate from getBufferMemPool
+  bool usesBufferMemPools() const noexcept;
+
+  // A native event of a device along with it
+  using device_event_t = std::pair<ur_device_handle_t, CUevent>;
+
+  // Returns the pooled allocations of a released buffer to their pools once
+  // UseEvents, recorded after the work which may still use them, have
+  // completed. Unlike cuMemFree, umfPoolFree doesn't wait for that work.
+  void deferBufferFree(
+      std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations,
+      std::vector<device_event_t> UseEvents);
+
+  // Returns the allocations deferred by deferBufferFree whose uses have
+  // completed to their pools, waiting for all of them if Wait is set
+  void freeDeferredBuffers(bool Wait);
+
+  // Returns the cubin JIT compiled for Key, see ProgramCache::makeKey, by a
+  // program of the context still alive, if any
+  std::shared_ptr<const std::vector<char>> findCubin(const std::string &Key);
+
+  // Shares Cubin, JIT compiled for Key, with the programs of the context
+  // built later from the same binary for devices of the same compute
+  // capability, for as long as a program holds it
+  void addCubin(const std::string &Key,
+                std::shared_ptr<const std::vector<char>> Cubin);
+
+  // Takes a native event of hDevice released earlier, or creates one in the
+  // current CUDA context, which must be the one of hDevice.
+  CUevent acquireNativeEvent(ur_device_handle_t hDevice, bool Timing);
+
+  // Keeps a native event of hDevice for the later acquireNativeEvent calls,
+  // destroying it if enough events are kept already.
+  void releaseNativeEvent(ur_device_handle_t hDevice, bool Timing,
+                          CUevent Event);
+
+  // Runs the callbacks set on the events of the context with
+  // urEventSetCallback
+  ur::event_notifier EventNotifier{urEventGetInfo, urEventRetain,
+                                   urEventRelease};
+
+  // Surface and texture objects of the bindless images, kept apart as a
+  // surface and a texture may have the same handle
+  ur::image_handle_cache SurfaceHandles;
+  ur::image_handle_cache TextureHandles;
+
+  // Physical memory released by urPhysicalMemRelease, which
+  // urPhysicalMemCreate and other users of physical memory in the adapter
+  // take from before creating more
+  ur::physical_mem_pool<CUmemGenericAllocationHandle> PhysicalMemPool{
+      getPhysicalMemPoolCapacity()};
+
 private:
   std::mutex Mutex;
   std::vector<deleter_data> ExtendedDeleters;
   std::set<ur_usm_pool_handle_t> PoolHandles;
+  std::unordered_map<void *, std::unique_ptr<GrowableAllocation>>
+      GrowableAllocations;
+  // Sizes of the bindless image memory counted by addImageMem
+  std::unordered_map<ur_exp_image_mem_native_handle_t, size_t> ImageMemSizes;
+
+  // Released native events indexed by device, then by whether they record
+  // timings, as the flags of a CUevent can't be changed
+  std::mutex NativeEventsMutex;
+  std::vector<std::array<std::vector<CUevent>, 2>> NativeEvents;
+
+  // Created by getQueueOrderedPool, indexed by device and guarded by Mutex
+  std::vector<CUmemoryPool> QueueOrderedPools;
+
+  // Created by getBufferMemPool, indexed by device then for the host, and
+  // guarded by Mutex
+  std::vector<umf::pool_unique_handle_t> BufferMemPools;
+
+  struct deferred_buffer_free {
+    std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations;
+    std::vector<device_event_t> UseEvents;
+  };
+  std::mutex DeferredBufferFreesMutex;
+  std::vector<deferred_buffer_free> DeferredBufferFrees;
+
+  // Held by the programs compiled from them, as the identical devices of a
+  // context usually get the same programs built at once
+  std::mutex CubinsMutex;
+  std::unordered_map<std::string, std::weak_ptr<const std::vector<char>>>
+      Cubins;
 };
 
+/// Makes Desired the current context of the calling thread. The context made
+/// current last is remembered per thread and, with
+/// UR_CUDA_CACHE_CURRENT_CONTEXT set, trusted to still be current without
+/// asking the driver. Debug builds check it anyway.
+void setCurrentContext(CUcontext Desired);
+
+/// Forgets the context remembered as current on the calling thread, after
+/// code outside the adapter may have changed it.
+void forgetCurrentContext();
+
 namespace {
 class ScopedContext {
 public:
@@ -156,16 +295,6 @@ public:
   ~ScopedContext() {}
 
 private:
-  void setContext(CUcontext Desired) {
-    CUcontext Original = nullptr;
-
-    UR_CHECK_ERROR(cuCtxGetCurrent(&Original));
-
-    // Make sure the desired context is active on the current thread, setting
-    // it if necessary
-    if (Original != Desired) {
-      UR_CHECK_ERROR(cuCtxSetCurrent(Desired));
-    }
-  }
+  void setContext(CUcontext Desired) { setCurrentContext(Desired); }
 };
 } // namespace
@@ -38,11 +38,9 @@ uint64_t ur_device_handle_t_::getElapsedTime(CUevent ev) const {
   return static_cast<uint64_t>(Milliseconds * 1.0e6);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) try {
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) try {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   static constexpr uint32_t MaxWorkItemDimensions = 3u;
@@ -954,6 +952,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     // CUDA supports enqueueing native work through the urNativeEnqueueExp
     return ReturnValue(static_cast<ur_bool_t>(true));
   }
+  case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP: {
+    // CUDA runs host tasks in stream order through cuLaunchHostFunc
+    return ReturnValue(static_cast<ur_bool_t>(true));
+  }
+  case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP: {
+    // Through events created with CU_EVENT_INTERPROCESS
+    return ReturnValue(static_cast<ur_bool_t>(true));
+  }
+  case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP: {
+    return ReturnValue(static_cast<ur_bool_t>(false));
+  }
   case UR_DEVICE_INFO_DEVICE_ID: {
     int Value = 0;
     UR_CHECK_ERROR(cuDeviceGetAttribute(
@@ -1105,6 +1114,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
                              CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR) >= 9;
     return ReturnValue(static_cast<bool>(Value));
   }
+  case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP: {
+    if (hDevice->getNumaNode() < 0) {
+      return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+    return ReturnValue(static_cast<uint32_t>(hDevice->getNumaNode()));
+  }
 
   default:
     break;
@@ -1114,6 +1129,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   return exceptionToResult(std::current_exception());
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
+                                                    ur_device_info_t propName,
+                                                    size_t propSize,
+                                                    void *pPropValue,
+                                                    size_t *pPropSizeRet) {
+  return hDevice->InfoCache.get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [&](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
 /// \return PI_SUCCESS if the function is executed successfully
 /// CUDA devices are always root devices so retain always returns success.
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
@@ -33,6 +33,8 @@ private:
   int MaxChosenLocalMem{0};
   bool MaxLocalMemSizeChosen{false};
   uint32_t NumComputeUnits{0};
+  int NumaNode{-1};
+  bool ConcurrentManagedAccess{false};
 
 public:
   ur_device_handle_t_(native_type cuDevice, CUcontext cuContext, CUevent evBase,
@@ -59,6 +61,12 @@ public:
         reinterpret_cast<int *>(&NumComputeUnits),
         CU_DEVICE_ATTRIBUTE_MULTIPROCESSOR_COUNT, cuDevice));
 
+    int ConcurrentManagedAccessAttr = 0;
+    UR_CHECK_ERROR(cuDeviceGetAttribute(
+        &ConcurrentManagedAccessAttr,
+        CU_DEVICE_ATTRIBUTE_CONCURRENT_MANAGED_ACCESS, cuDevice));
+    ConcurrentManagedAccess = ConcurrentManagedAccessAttr != 0;
+
     // Set local mem max size if env var is present
     static const char *LocalMemSizePtrUR =
         std::getenv("UR_CUDA_MAX_LOCAL_MEM_SIZE");
@@ -79,6 +87,12 @@ public:
     // CUDA doesn't really have this concept, and could allow almost 100% of
     // global memory in one allocation, but is dependent on device usage.
     UR_CHECK_ERROR(cuDeviceTotalMem(&MaxAllocSize, cuDevice));
+
+    char PciBusId[16];
+    if (cuDeviceGetPCIBusId(PciBusId, sizeof(PciBusId), cuDevice) ==
+        CUDA_SUCCESS) {
+      NumaNode = ur_pci_numa_node(PciBusId);
+    }
   }
 
   ~ur_device_handle_t_() { cuDevicePrimaryCtxRelease(CuDevice); }
@@ -107,6 +121,12 @@ public:
 
   size_t getMaxAllocSize() const noexcept { return MaxAllocSize; };
 
+  // Whether shared USM can be prefetched to the device, which the device can
+  // access while the host does
+  bool hasConcurrentManagedAccess() const noexcept {
+    return ConcurrentManagedAccess;
+  }
+
   int getMaxCapacityLocalMem() const noexcept { return MaxCapacityLocalMem; };
 
   int getMaxChosenLocalMem() const noexcept { return MaxChosenLocalMem; };
@@ -114,6 +134,12 @@ public:
   bool maxLocalMemSizeChosen() { return MaxLocalMemSizeChosen; };
 
   uint32_t getNumComputeUnits() const noexcept { return NumComputeUnits; };
+
+  // NUMA node of the host memory closest to the device, or -1 if unknown
+  int getNumaNode() const noexcept { return NumaNode; };
+
+  // Values of the immutable properties already returned by urDeviceGetInfo
+  ur::DeviceInfoCache InfoCache;
 };
 
 int getAttribute(ur_device_handle_t Device, CUdevice_attribute Attribute);
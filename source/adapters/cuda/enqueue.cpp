@@ -15,8 +15,13 @@
 #include "kernel.hpp"
 #include "memory.hpp"
 #include "queue.hpp"
+#include "usm.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <memory>
+#include <optional>
 #include <cuda.h>
 #include <ur/ur.hpp>
 
@@ -46,6 +51,79 @@ ur_result_t enqueueEventsWait(ur_queue_handle_t CommandQueue, CUstream Stream,
   }
 }
 
+namespace {
+// See ur_mem_handle_t_::recordUse
+void recordMemObjArgUses(ur_queue_handle_t hQueue,
+                         ur_kernel_handle_t hKernel) {
+  if (!hQueue->getContext()->usesBufferMemPools()) {
+    return;
+  }
+  for (auto &MemArg : hKernel->Args.MemObjArgs) {
+    MemArg.Mem->recordUse(hQueue);
+  }
+}
+
+// Copies of at most this many bytes, such as parameter blocks and counters,
+// go on the compute stream their dependencies are on rather than on the next
+// transfer stream, which would have to wait for that one. The driver copies
+// from pageable memory this small into the command itself. 0 disables it.
+const size_t InlineWriteThreshold = [] {
+  const char *ThresholdStr = std::getenv("UR_CUDA_INLINE_WRITE_THRESHOLD");
+  long long Threshold = ThresholdStr ? std::atoll(ThresholdStr) : 256;
+  return Threshold > 0 ? static_cast<size_t>(Threshold) : size_t{0};
+}();
+
+// Returns the stream to copy Size bytes on, with StreamToken and Guard set
+// as getNextComputeStream does when it is a compute stream
+CUstream getCopyStream(ur_queue_handle_t Queue, size_t Size,
+                       uint32_t NumEventsInWaitList,
+                       const ur_event_handle_t *EventWaitList,
+                       ur_stream_guard_ &Guard, uint32_t &StreamToken) {
+  if (Size > InlineWriteThreshold)
+    return Queue->getNextTransferStream();
+  return Queue->getNextComputeStream(NumEventsInWaitList, EventWaitList, Guard,
+                                     &StreamToken);
+}
+
+// Copies the blocks of a batch on Stream, with a single driver call where
+// CUDA has one
+void memcpyBatchAsync(uint32_t NumCopies, void **Dsts, const void **Srcs,
+                      const size_t *Sizes, CUstream Stream) {
+#if CUDA_VERSION >= 12080
+  std::vector<CUdeviceptr> DstPtrs(NumCopies);
+  std::vector<CUdeviceptr> SrcPtrs(NumCopies);
+  std::vector<size_t> BatchSizes(Sizes, Sizes + NumCopies);
+  for (uint32_t i = 0; i < NumCopies; i++) {
+    DstPtrs[i] = reinterpret_cast<CUdeviceptr>(Dsts[i]);
+    SrcPtrs[i] = reinterpret_cast<CUdeviceptr>(Srcs[i]);
+  }
+  // All the copies read their source in stream order
+  CUmemcpyAttributes Attrs{};
+  Attrs.srcAccessOrder = CU_MEMCPY_SRC_ACCESS_ORDER_STREAM;
+  size_t AttrsIdx = 0;
+#if CUDA_VERSION >= 13000
+  CUresult Res =
+      cuMemcpyBatchAsync(DstPtrs.data(), SrcPtrs.data(), BatchSizes.data(),
+                         NumCopies, &Attrs, &AttrsIdx, 1, Stream);
+#else
+  size_t FailIdx = 0;
+  CUresult Res = cuMemcpyBatchAsync(DstPtrs.data(), SrcPtrs.data(),
+                                    BatchSizes.data(), NumCopies, &Attrs,
+                                    &AttrsIdx, 1, &FailIdx, Stream);
+#endif
+  if (Res != CUDA_ERROR_NOT_SUPPORTED) {
+    UR_CHECK_ERROR(Res);
+    return;
+  }
+#endif
+  for (uint32_t i = 0; i < NumCopies; i++) {
+    UR_CHECK_ERROR(cuMemcpyAsync(reinterpret_cast<CUdeviceptr>(Dsts[i]),
+                                 reinterpret_cast<CUdeviceptr>(Srcs[i]),
+                                 Sizes[i], Stream));
+  }
+}
+} // namespace
+
 template <typename PtrT>
 void getUSMHostOrDevicePtr(PtrT USMPtr, CUmemorytype *OutMemType,
                            CUdeviceptr *OutDevPtr, PtrT *OutHostPtr) {
@@ -152,6 +230,18 @@ void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
     GlobalSizeNormalized[i] = GlobalWorkSize[i];
   }
 
+  const std::array<size_t, 4> Key = {
+      GlobalSizeNormalized[0], GlobalSizeNormalized[1],
+      GlobalSizeNormalized[2], Kernel->getLocalSize()};
+  auto &GuessedLocalSizes = Kernel->GuessedLocalSizes;
+  {
+    std::lock_guard<std::mutex> Lock(Kernel->GuessedLocalSizesMutex);
+    if (auto It = GuessedLocalSizes.find(Key); It != GuessedLocalSizes.end()) {
+      std::copy(It->second.begin(), It->second.end(), ThreadsPerBlock);
+      return;
+    }
+  }
+
   size_t MaxBlockDim[3];
   MaxBlockDim[0] = Device->getMaxWorkItemSizes(0);
   MaxBlockDim[1] = Device->getMaxWorkItemSizes(1);
@@ -164,6 +254,29 @@ void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
 
   roundToHighestFactorOfGlobalSizeIn3d(ThreadsPerBlock, GlobalSizeNormalized,
                                        MaxBlockDim, MaxBlockSize);
+
+  std::lock_guard<std::mutex> Lock(Kernel->GuessedLocalSizesMutex);
+  if (GuessedLocalSizes.size() >= ur_kernel_handle_t_::MaxGuessedLocalSizes) {
+    GuessedLocalSizes.clear();
+  }
+  GuessedLocalSizes[Key] = {ThreadsPerBlock[0], ThreadsPerBlock[1],
+                            ThreadsPerBlock[2]};
+}
+
+// Prefetches the shared USM allocations the kernel was given to the device of
+// the queue, ahead of the launch on Stream, so that they don't migrate a page
+// fault at a time.
+void prefetchSharedUSMArgs(ur_queue_handle_t Queue, ur_kernel_handle_t Kernel,
+                           CUstream Stream) {
+  ur_device_handle_t Device = Queue->getDevice();
+  if (Kernel->Args.SharedUSMArgs.empty() ||
+      !Device->hasConcurrentManagedAccess()) {
+    return;
+  }
+  for (auto &Arg : Kernel->Args.SharedUSMArgs) {
+    UR_CHECK_ERROR(
+        cuMemPrefetchAsync(Arg.Base, Arg.Size, Device->get(), Stream));
+  }
 }
 
 // Helper to verify out-of-registers case (exceeded block max registers).
@@ -314,13 +427,9 @@ setKernelParams([[maybe_unused]] const ur_context_handle_t Context,
             UR_RESULT_ERROR_ADAPTER_SPECIFIC);
         return UR_RESULT_ERROR_ADAPTER_SPECIFIC;
       }
-      UR_CHECK_ERROR(cuFuncSetAttribute(
-          CuFunc, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES,
-          Device->getMaxChosenLocalMem()));
-
+      Kernel->setMaxDynamicSharedSize(CuFunc, Device->getMaxChosenLocalMem());
     } else {
-      UR_CHECK_ERROR(cuFuncSetAttribute(
-          CuFunc, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, LocalSize));
+      Kernel->setMaxDynamicSharedSize(CuFunc, static_cast<int>(LocalSize));
     }
 
   } catch (ur_result_t Err) {
@@ -344,8 +453,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_stream_guard_ Guard;
     CUstream CuStream = hQueue->getNextComputeStream(
         numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
-    {
-      std::lock_guard<std::mutex> GuardBarrier(hQueue->BarrierMutex);
+    // The commands of a capture are all on its stream, in order, so they
+    // already wait on the commands captured before them
+    if (!hQueue->isCapturing()) {
+      std::lock_guard<ur_mutex> GuardBarrier(hQueue->BarrierMutex);
       if (hQueue->BarrierEvent == nullptr) {
         UR_CHECK_ERROR(
             cuEventCreate(&hQueue->BarrierEvent, CU_EVENT_DISABLE_TIMING));
@@ -414,6 +525,138 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
                                         phEventWaitList, phEvent);
 }
 
+void submitQueuedLaunch(ur_queue_handle_t Queue,
+                        ur_queued_launch_ &Launch) noexcept {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  try {
+    ScopedContext Active(Queue->getDevice());
+    uint32_t NumEventsInWaitList =
+        static_cast<uint32_t>(Launch.WaitList.size());
+    const ur_event_handle_t *EventWaitList =
+        NumEventsInWaitList ? Launch.WaitList.data() : nullptr;
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = Queue->getNextComputeStream(
+        NumEventsInWaitList, EventWaitList, Guard, &StreamToken);
+
+    UR_CHECK_ERROR(enqueueEventsWait(Queue, CuStream, NumEventsInWaitList,
+                                     EventWaitList));
+
+    if (Launch.Event) {
+      Launch.Event->setStream(CuStream, StreamToken);
+      UR_CHECK_ERROR(Launch.Event->start());
+    }
+
+    UR_CHECK_ERROR(cuLaunchKernel(
+        Launch.Func, Launch.BlocksPerGrid[0], Launch.BlocksPerGrid[1],
+        Launch.BlocksPerGrid[2], Launch.ThreadsPerBlock[0],
+        Launch.ThreadsPerBlock[1], Launch.ThreadsPerBlock[2], Launch.LocalSize,
+        CuStream, Launch.ArgPointers.data(), nullptr));
+
+    if (Launch.Event) {
+      UR_CHECK_ERROR(Launch.Event->record());
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (...) {
+    Result = UR_RESULT_ERROR_UNKNOWN;
+  }
+  if (Result != UR_RESULT_SUCCESS) {
+    ur_result_t Expected = UR_RESULT_SUCCESS;
+    Queue->SubmissionError.compare_exchange_strong(Expected, Result);
+    if (Launch.Event) {
+      Launch.Event->setSubmissionError(Result);
+    }
+  }
+
+  // The queue goes last, as it may be the last reference on it, which
+  // destroys it
+  for (ur_event_handle_t Event : Launch.WaitList) {
+    urEventRelease(Event);
+  }
+  Launch.WaitList.clear();
+  urKernelRelease(Launch.Kernel);
+  Launch.Kernel = nullptr;
+  if (Launch.Event) {
+    urEventRelease(Launch.Event);
+    Launch.Event = nullptr;
+  }
+  urQueueRelease(Queue);
+}
+
+namespace {
+// Hands the launch over to the submission thread of the queue, with a copy of
+// the arguments of the kernel, see UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP
+ur_result_t queueLaunch(ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel,
+                        CUfunction CuFunc, const size_t (&ThreadsPerBlock)[3],
+                        const size_t (&BlocksPerGrid)[3], uint32_t LocalSize,
+                        uint32_t numEventsInWaitList,
+                        const ur_event_handle_t *phEventWaitList,
+                        ur_event_handle_t *phEvent) {
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+  if (phEvent) {
+    // The stream is set by the submission thread
+    RetImplEvent =
+        std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+            UR_COMMAND_KERNEL_LAUNCH, hQueue, nullptr));
+  }
+
+  // The last index is the one of the implicit offset argument, which doesn't
+  // have a size of its own
+  auto &ArgIndices = hKernel->getArgIndices();
+  auto &ParamSizes = hKernel->Args.ParamSizes;
+  auto argSize = [&](size_t I) {
+    return I < ParamSizes.size() ? ParamSizes[I]
+                                 : sizeof(hKernel->Args.ImplicitOffsetArgs);
+  };
+
+  std::lock_guard<ur_mutex> Lock(hQueue->SubmitterMutex);
+  uint64_t Seq = hQueue->Submitter->push([&](ur_queued_launch_ &Launch) {
+    size_t StorageSize = 0;
+    for (size_t I = 0; I < ArgIndices.size(); I++) {
+      StorageSize += argSize(I);
+    }
+    Launch.ArgStorage.resize(StorageSize);
+    Launch.ArgPointers.resize(ArgIndices.size());
+    size_t Offset = 0;
+    for (size_t I = 0; I < ArgIndices.size(); I++) {
+      std::memcpy(Launch.ArgStorage.data() + Offset, ArgIndices[I],
+                  argSize(I));
+      Launch.ArgPointers[I] = Launch.ArgStorage.data() + Offset;
+      Offset += argSize(I);
+    }
+
+    Launch.WaitList.assign(phEventWaitList,
+                           phEventWaitList + numEventsInWaitList);
+    for (ur_event_handle_t Event : Launch.WaitList) {
+      urEventRetain(Event);
+    }
+    Launch.Func = CuFunc;
+    std::copy(std::begin(ThreadsPerBlock), std::end(ThreadsPerBlock),
+              Launch.ThreadsPerBlock);
+    std::copy(std::begin(BlocksPerGrid), std::end(BlocksPerGrid),
+              Launch.BlocksPerGrid);
+    Launch.LocalSize = LocalSize;
+    urKernelRetain(hKernel);
+    Launch.Kernel = hKernel;
+    if (RetImplEvent) {
+      urEventRetain(RetImplEvent.get());
+      Launch.Event = RetImplEvent.get();
+    }
+    urQueueRetain(hQueue);
+  });
+
+  if (LocalSize != 0)
+    hKernel->clearLocalSize();
+
+  if (phEvent) {
+    RetImplEvent->setSubmission(Seq);
+    *phEvent = RetImplEvent.release();
+  }
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
@@ -448,6 +691,24 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       Ret != UR_RESULT_SUCCESS)
     return Ret;
 
+  recordMemObjArgUses(hQueue, hKernel);
+
+  // Launches which don't need the memory of their arguments to be migrated or
+  // prefetched first are submitted by the submission thread of the queue
+  if (hQueue->Submitter && !hQueue->isCapturing() &&
+      hQueue->getContext()->Devices.size() == 1 &&
+      hKernel->Args.SharedUSMArgs.empty()) {
+    try {
+      return queueLaunch(hQueue, hKernel, CuFunc, ThreadsPerBlock,
+                         BlocksPerGrid, LocalSize, numEventsInWaitList,
+                         phEventWaitList, phEvent);
+    } catch (ur_result_t Err) {
+      return Err;
+    } catch (std::bad_alloc &) {
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+  }
+
   try {
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
@@ -472,6 +733,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
       }
     }
 
+    prefetchSharedUSMArgs(hQueue, hKernel, CuStream);
+
     if (phEvent) {
       RetImplEvent =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
@@ -516,6 +779,43 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                                numEventsInWaitList, phEventWaitList, phEvent);
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches) {
+  try {
+    // The context of a device is made current once for the consecutive
+    // launches on it, the launches then finding it active. CUDA has no call
+    // submitting many launches, so each launch picks its stream and is
+    // submitted as urEnqueueKernelLaunch does.
+    std::optional<ScopedContext> Active;
+    ur_device_handle_t ActiveDevice = nullptr;
+    for (uint32_t i = 0; i < numLaunches; i++) {
+      const auto &Launch = pLaunches[i];
+      if (Launch.hQueue->getDevice() != ActiveDevice) {
+        ActiveDevice = Launch.hQueue->getDevice();
+        Active.emplace(ActiveDevice);
+      }
+
+      if (Launch.numArgs) {
+        if (ur_result_t Ret = urKernelSetArgsExp(Launch.hKernel, Launch.numArgs,
+                                                 Launch.pArgs);
+            Ret != UR_RESULT_SUCCESS)
+          return Ret;
+      }
+      if (ur_result_t Ret = urEnqueueKernelLaunch(
+              Launch.hQueue, Launch.hKernel, Launch.workDim,
+              Launch.pGlobalWorkOffset, Launch.pGlobalWorkSize,
+              Launch.pLocalWorkSize, Launch.numEventsInWaitList,
+              Launch.phEventWaitList, Launch.phEvent);
+          Ret != UR_RESULT_SUCCESS)
+        return Ret;
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -615,6 +915,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
       Ret != UR_RESULT_SUCCESS)
     return Ret;
 
+  recordMemObjArgUses(hQueue, hKernel);
+
   try {
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
@@ -639,6 +941,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
       }
     }
 
+    prefetchSharedUSMArgs(hQueue, hKernel, CuStream);
+
     if (phEvent) {
       RetImplEvent =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
@@ -775,6 +1079,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         hBuffer->LastQueueWritingToMemObj->getDevice() != hQueue->getDevice()) {
       hQueue = hBuffer->LastQueueWritingToMemObj;
     }
+    hBuffer->recordUse(hQueue);
 
     auto Device = hQueue->getDevice();
     ScopedContext Active(Device);
@@ -825,6 +1130,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
       std::get<BufferMem>(hBuffer->Mem).getPtr(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedContext Active(hQueue->getDevice());
@@ -873,6 +1179,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hBufferSrc->recordUse(hQueue);
+  hBufferDst->recordUse(hQueue);
+
   try {
     ScopedContext Active(hQueue->getDevice());
     ur_result_t Result = UR_RESULT_SUCCESS;
@@ -921,6 +1230,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   CUdeviceptr DstPtr =
       std::get<BufferMem>(hBufferDst->Mem).getPtr(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+  hBufferSrc->recordUse(hQueue);
+  hBufferDst->recordUse(hQueue);
 
   try {
     ScopedContext Active(hQueue->getDevice());
@@ -951,15 +1262,49 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   return Result;
 }
 
+// Counts the commands of a fill by copies, which writes the pattern once and
+// then copies the filled part after itself, doubling it each time.
+static size_t getNumFillCopies(uint32_t PatternSize, size_t Size) {
+  size_t NumCopies = 1;
+  for (size_t Filled = PatternSize; Filled < Size; Filled *= 2) {
+    ++NumCopies;
+  }
+  return NumCopies;
+}
+
 // CUDA has no memset functions that allow setting values more than 4 bytes. UR
 // API lets you pass an arbitrary "pattern" to the buffer fill, which can be
 // more than 4 bytes. We must break up the pattern into 1 byte values, and set
 // the buffer using multiple strided calls.  The first 4 patterns are set using
 // cuMemsetD32Async then all subsequent 1 byte patterns are set using
 // cuMemset2DAsync which is called for each pattern.
+//
+// That is one command per byte of the pattern, so when it takes fewer
+// commands the buffer is filled by copies instead: the pattern is copied from
+// the host once, and the filled part is then copied after itself until the
+// buffer is full, each copy running at device bandwidth. The pattern is copied
+// from a copy of its own, which the stream frees once the copy completed, as
+// the caller's may be gone by then.
+static void CUDA_CB freeFillPattern(void *Pattern) {
+  delete[] static_cast<uint8_t *>(Pattern);
+}
+
 ur_result_t commonMemSetLargePattern(CUstream Stream, uint32_t PatternSize,
                                      size_t Size, const void *pPattern,
                                      CUdeviceptr Ptr) {
+  if (getNumFillCopies(PatternSize, Size) < PatternSize - 3) {
+    std::unique_ptr<uint8_t[]> Pattern{new uint8_t[PatternSize]};
+    std::memcpy(Pattern.get(), pPattern, PatternSize);
+    UR_CHECK_ERROR(cuMemcpyHtoDAsync(Ptr, Pattern.get(), PatternSize, Stream));
+    UR_CHECK_ERROR(cuLaunchHostFunc(Stream, freeFillPattern, Pattern.get()));
+    Pattern.release();
+    for (size_t Filled = PatternSize; Filled < Size; Filled *= 2) {
+      UR_CHECK_ERROR(cuMemcpyDtoDAsync(
+          Ptr + Filled, Ptr, std::min(Filled, Size - Filled), Stream));
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
   // Calculate the number of patterns, stride, number of times the pattern
   // needs to be applied, and the number of times the first 32 bit pattern
   // needs to be applied.
@@ -994,6 +1339,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
             UR_RESULT_ERROR_INVALID_SIZE);
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedContext Active(hQueue->getDevice());
@@ -1505,8 +1851,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
           CuStream));
       break;
     default:
-      commonMemSetLargePattern(CuStream, patternSize, size, pPattern,
-                               (CUdeviceptr)ptr);
+      UR_CHECK_ERROR(commonMemSetLargePattern(CuStream, patternSize, size,
+                                              pPattern, (CUdeviceptr)ptr));
       break;
     }
     if (phEvent) {
@@ -1515,6 +1861,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     }
   } catch (ur_result_t Err) {
     Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   }
   return Result;
 }
@@ -1529,13 +1877,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
   try {
     ScopedContext Active(hQueue->getDevice());
-    CUstream CuStream = hQueue->getNextTransferStream();
+    uint32_t StreamToken = std::numeric_limits<uint32_t>::max();
+    ur_stream_guard_ Guard;
+    CUstream CuStream = getCopyStream(hQueue, size, numEventsInWaitList,
+                                      phEventWaitList, Guard, StreamToken);
     Result = enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
                                phEventWaitList);
     if (phEvent) {
       EventPtr =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
-              UR_COMMAND_USM_MEMCPY, hQueue, CuStream));
+              UR_COMMAND_USM_MEMCPY, hQueue, CuStream, StreamToken));
       UR_CHECK_ERROR(EventPtr->start());
     }
     UR_CHECK_ERROR(
@@ -1555,6 +1906,50 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   return Result;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+
+  std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    size_t TotalSize = 0;
+    for (uint32_t i = 0; i < numCopies; i++) {
+      TotalSize += pSizes[i];
+    }
+    uint32_t StreamToken = std::numeric_limits<uint32_t>::max();
+    ur_stream_guard_ Guard;
+    CUstream CuStream = getCopyStream(hQueue, TotalSize, numEventsInWaitList,
+                                      phEventWaitList, Guard, StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      EventPtr =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_USM_MEMCPY_BATCH_EXP, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(EventPtr->start());
+    }
+    memcpyBatchAsync(numCopies, ppDst, ppSrc, pSizes, CuStream);
+    if (phEvent) {
+      UR_CHECK_ERROR(EventPtr->record());
+    }
+    if (blocking) {
+      UR_CHECK_ERROR(cuStreamSynchronize(CuStream));
+    }
+    if (phEvent) {
+      *phEvent = EventPtr.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return Result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, const void *pMem, size_t size,
     ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
@@ -1771,6 +2166,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
         hBuffer->LastQueueWritingToMemObj->getDevice() != hQueue->getDevice()) {
       hQueue = hBuffer->LastQueueWritingToMemObj;
     }
+    hBuffer->recordUse(hQueue);
 
     auto Device = hQueue->getDevice();
     ScopedContext Active(Device);
@@ -1821,10 +2217,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
       std::get<BufferMem>(hBuffer->Mem).getPtr(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedContext Active(hQueue->getDevice());
-    CUstream CuStream = hQueue->getNextTransferStream();
+    uint32_t StreamToken = std::numeric_limits<uint32_t>::max();
+    ur_stream_guard_ Guard;
+    CUstream CuStream = getCopyStream(hQueue, size, numEventsInWaitList,
+                                      phEventWaitList, Guard, StreamToken);
 
     UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
                                      phEventWaitList));
@@ -1832,7 +2232,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     if (phEvent) {
       RetImplEvent =
           std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
-              UR_COMMAND_MEM_BUFFER_WRITE, hQueue, CuStream));
+              UR_COMMAND_MEM_BUFFER_WRITE, hQueue, CuStream, StreamToken));
       UR_CHECK_ERROR(RetImplEvent->start());
     }
 
@@ -1966,3 +2366,256 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   }
   return Result;
 }
+
+namespace {
+struct host_task_t {
+  ur_exp_host_task_function_t Fn;
+  void *UserData;
+};
+
+// Called by the CUDA driver once the commands before the task in its stream
+// completed. The stream's later commands start once it returned.
+void CUDA_CB runHostTask(void *Data) {
+  std::unique_ptr<host_task_t> Task{static_cast<host_task_t *>(Data)};
+  Task->Fn(Task->UserData);
+}
+} // namespace
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ur_exp_host_task_function_t pfnHostTask,
+    void *pUserData, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_ENQUEUE_HOST_TASK_EXP, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    auto Task =
+        std::make_unique<host_task_t>(host_task_t{pfnHostTask, pUserData});
+    UR_CHECK_ERROR(cuLaunchHostFunc(CuStream, runHostTask, Task.get()));
+    Task.release();
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return Result;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue, ur_event_handle_t hIPCEvent,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hIPCEvent->isIPC(), UR_RESULT_ERROR_INVALID_EVENT);
+
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_IPC_EVENT_SIGNAL_EXP, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    // A wait enqueued later, in any process, waits for this record
+    UR_CHECK_ERROR(cuEventRecord(hIPCEvent->get(), CuStream));
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return Result;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ur_event_handle_t hIPCEvent,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hIPCEvent->isIPC(), UR_RESULT_ERROR_INVALID_EVENT);
+
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_IPC_EVENT_WAIT_EXP, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    // Waits for the last record of the event enqueued before, in any process
+    UR_CHECK_ERROR(cuStreamWaitEvent(CuStream, hIPCEvent->get(), 0));
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return Result;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, void **ppMem,
+    ur_event_handle_t *phEvent) {
+#if CUDA_VERSION >= 11030
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    CUmemoryPool Pool =
+        hQueue->getContext()->getQueueOrderedPool(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      EventPtr =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_EVENTS_WAIT, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(EventPtr->start());
+    }
+
+    UR_CHECK_ERROR(
+        cuMemAllocFromPoolAsync((CUdeviceptr *)ppMem, size, Pool, CuStream));
+    hQueue->getContext()->MemoryAccounting.onAlloc(
+        UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, getUSMAllocSize(*ppMem, size));
+
+    if (phEvent) {
+      UR_CHECK_ERROR(EventPtr->record());
+      *phEvent = EventPtr.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+#else
+  (void)hQueue;
+  (void)size;
+  (void)numEventsInWaitList;
+  (void)phEventWaitList;
+  (void)ppMem;
+  (void)phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue, void *pMem, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+#if CUDA_VERSION >= 11030
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    uint32_t StreamToken;
+    ur_stream_guard_ Guard;
+    CUstream CuStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, CuStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      EventPtr =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_EVENTS_WAIT, hQueue, CuStream, StreamToken));
+      UR_CHECK_ERROR(EventPtr->start());
+    }
+
+    // The memory may still be used by the commands enqueued so far on any
+    // stream of the queue, the free waits for them as a barrier would,
+    // without holding back the commands enqueued after it
+    if (!hQueue->isCapturing()) {
+      std::lock_guard<ur_mutex> GuardBarrier(hQueue->BarrierMutex);
+      if (hQueue->BarrierTmpEvent == nullptr) {
+        UR_CHECK_ERROR(
+            cuEventCreate(&hQueue->BarrierTmpEvent, CU_EVENT_DISABLE_TIMING));
+      }
+      hQueue->syncStreams(
+          [CuStream, TmpEvent = hQueue->BarrierTmpEvent](CUstream s) {
+            if (CuStream != s) {
+              UR_CHECK_ERROR(cuEventRecord(TmpEvent, s));
+              UR_CHECK_ERROR(cuStreamWaitEvent(CuStream, TmpEvent, 0));
+            }
+          });
+    }
+
+    CUmemoryPool Pool = nullptr;
+    UR_CHECK_ERROR(cuPointerGetAttribute(
+        &Pool, CU_POINTER_ATTRIBUTE_MEMPOOL_HANDLE, (CUdeviceptr)pMem));
+    if (Pool) {
+      size_t Size = getUSMAllocSize(pMem, 0);
+      UR_CHECK_ERROR(cuMemFreeAsync((CUdeviceptr)pMem, CuStream));
+      hQueue->getContext()->MemoryAccounting.onFree(
+          UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, Size);
+    } else {
+      // Only the memory of the memory pools can be freed in stream order,
+      // anything else is freed once the stream is done with it
+      UR_CHECK_ERROR(cuStreamSynchronize(CuStream));
+      UR_CHECK_ERROR(urUSMFree(hQueue->getContext(), pMem));
+    }
+
+    if (phEvent) {
+      UR_CHECK_ERROR(EventPtr->record());
+      *phEvent = EventPtr.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  }
+  return Result;
+#else
+  (void)hQueue;
+  (void)pMem;
+  (void)numEventsInWaitList;
+  (void)phEventWaitList;
+  (void)phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
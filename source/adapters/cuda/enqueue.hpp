@@ -17,6 +17,13 @@ ur_result_t enqueueEventsWait(ur_queue_handle_t CommandQueue, CUstream Stream,
                               uint32_t NumEventsInWaitList,
                               const ur_event_handle_t *EventWaitList);
 
+struct ur_queued_launch_;
+
+// Handler of the submission thread of Queue, which submits Launch and drops
+// the references it holds
+void submitQueuedLaunch(ur_queue_handle_t Queue,
+                        ur_queued_launch_ &Launch) noexcept;
+
 void guessLocalWorkSize(ur_device_handle_t Device, size_t *ThreadsPerBlock,
                         const size_t *GlobalWorkSize, const uint32_t WorkDim,
                         ur_kernel_handle_t Kernel);
@@ -28,6 +28,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     ScopedStream ActiveStream(hQueue, NumEventsInWaitList, phEventWaitList);
     std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+    for (auto i = 0u; i < NumMemsInMemList; ++i) {
+      phMemList[i]->recordUse(hQueue);
+    }
     if (hQueue->getContext()->getDevices().size() > 1) {
       for (auto i = 0u; i < NumMemsInMemList; ++i) {
         enqueueMigrateMemoryToDeviceIfNeeded(phMemList[i], hQueue->getDevice(),
@@ -46,6 +49,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     pfnNativeEnqueue(hQueue, data); // This is using urQueueGetNativeHandle to
                                     // get the CUDA stream. It must be the
                                     // same stream as is used before and after
+    forgetCurrentContext();
 
     if (phEvent) {
       UR_CHECK_ERROR(RetImplEvent->record());
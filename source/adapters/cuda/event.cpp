@@ -16,6 +16,7 @@
 #include "ur_util.hpp"
 
 #include <cassert>
+#include <cstring>
 #include <cuda.h>
 
 ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
@@ -25,7 +26,7 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        native_type EvStart, CUstream Stream,
                                        uint32_t StreamToken)
     : CommandType{Type}, RefCount{1}, HasOwnership{true},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       StreamToken{StreamToken}, EventID{0}, EvEnd{EvEnd}, EvStart{EvStart},
       EvQueued{EvQueued}, Queue{Queue}, Stream{Stream}, Context{Context} {
   urQueueRetain(Queue);
@@ -35,7 +36,7 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
 ur_event_handle_t_::ur_event_handle_t_(ur_context_handle_t Context,
                                        CUevent EventNative)
     : CommandType{UR_COMMAND_EVENTS_WAIT}, RefCount{1}, HasOwnership{false},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       IsInterop{true}, StreamToken{std::numeric_limits<uint32_t>::max()},
       EventID{0}, EvEnd{EventNative}, EvStart{nullptr}, EvQueued{nullptr},
       Queue{nullptr}, Stream{nullptr}, Context{Context} {
@@ -67,10 +68,17 @@ ur_result_t ur_event_handle_t_::start() {
 }
 
 bool ur_event_handle_t_::isCompleted() const noexcept try {
+  if (!isSubmitted()) {
+    return false;
+  }
+  // A command which failed to be submitted won't run, its event is done with
+  if (SubmissionError != UR_RESULT_SUCCESS) {
+    return true;
+  }
   if (!IsRecorded) {
     return false;
   }
-  if (!HasBeenWaitedOn) {
+  if (!HasCompleted) {
     const CUresult Result = cuEventQuery(EvEnd);
     if (Result != CUDA_SUCCESS && Result != CUDA_ERROR_NOT_READY) {
       UR_CHECK_ERROR(Result);
@@ -79,6 +87,7 @@ bool ur_event_handle_t_::isCompleted() const noexcept try {
     if (Result == CUDA_ERROR_NOT_READY) {
       return false;
     }
+    HasCompleted = true;
   }
   return true;
 } catch (...) {
@@ -129,10 +138,15 @@ ur_result_t ur_event_handle_t_::record() {
 }
 
 ur_result_t ur_event_handle_t_::wait() {
+  // The native event of a command which failed to be submitted was never
+  // recorded, which the synchronization wouldn't tell
+  if (SubmissionError != UR_RESULT_SUCCESS) {
+    return SubmissionError;
+  }
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
-    UR_CHECK_ERROR(cuEventSynchronize(EvEnd));
-    HasBeenWaitedOn = true;
+    UR_CHECK_ERROR(hostSynchronize(EvEnd));
+    HasCompleted = true;
   } catch (ur_result_t error) {
     Result = error;
   }
@@ -141,16 +155,26 @@ ur_result_t ur_event_handle_t_::wait() {
 }
 
 ur_result_t ur_event_handle_t_::release() {
+  if (isIPC()) {
+    UR_CHECK_ERROR(cuEventDestroy(EvEnd));
+    return UR_RESULT_SUCCESS;
+  }
+
   if (!backendHasOwnership())
     return UR_RESULT_SUCCESS;
 
   assert(Queue != nullptr);
 
-  UR_CHECK_ERROR(cuEventDestroy(EvEnd));
+  // The native events are recycled by the context, a later record replaces
+  // whatever this event recorded
+  const bool Timing =
+      Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent();
+  auto Device = Queue->getDevice();
+  Context->releaseNativeEvent(Device, Timing, EvEnd);
 
-  if (Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent()) {
-    UR_CHECK_ERROR(cuEventDestroy(EvQueued));
-    UR_CHECK_ERROR(cuEventDestroy(EvStart));
+  if (Timing) {
+    Context->releaseNativeEvent(Device, true, EvQueued);
+    Context->releaseNativeEvent(Device, true, EvStart);
   }
 
   return UR_RESULT_SUCCESS;
@@ -203,6 +227,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
                            !hEvent->isTimestampEvent())) {
     return UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE;
   }
+  hEvent->waitSubmitted();
 
   switch (propName) {
   case UR_PROFILING_INFO_COMMAND_QUEUED:
@@ -219,11 +244,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventSetCallback(ur_event_handle_t,
-                                                       ur_execution_info_t,
-                                                       ur_event_callback_t,
-                                                       void *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+/// The events are polled with cuEventQuery from the notifier thread of the
+/// context, as cuLaunchHostFunc would only tell when the command completes,
+/// and not for interop events.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
+                   ur_event_callback_t pfnNotify, void *pUserData) {
+  return hEvent->getContext()->EventNotifier.add(hEvent, execStatus, pfnNotify,
+                                                 pUserData);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -238,7 +266,41 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
 
       return Event->wait();
     };
-    return forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    ur_result_t Result =
+        forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the events have run once the wait returns
+      for (uint32_t i = 0; i < numEvents; i++) {
+        phEventWaitList[i]->getContext()->EventNotifier.flush(
+            phEventWaitList[i]);
+      }
+    }
+    return Result;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventWaitAnyExp(uint32_t numEvents, const ur_event_handle_t *phEventWaitList,
+                  uint32_t *pIndex) {
+  UR_ASSERT(numEvents > 0, UR_RESULT_ERROR_INVALID_VALUE);
+  try {
+    ScopedContext Active(phEventWaitList[0]->getContext()->getDevices()[0]);
+
+    auto QueryFunc = [&](uint32_t i, bool &Completed) -> ur_result_t {
+      Completed = phEventWaitList[i]->isCompleted();
+      return UR_RESULT_SUCCESS;
+    };
+    ur_result_t Result = ur::waitAnyEvent(numEvents, QueryFunc, *pIndex);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the event have run once the wait returns
+      phEventWaitList[*pIndex]->getContext()->EventNotifier.flush(
+          phEventWaitList[*pIndex]);
+    }
+    return Result;
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -304,3 +366,77 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
   return UR_RESULT_SUCCESS;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    ur_event_handle_t *phEvent) {
+  try {
+    ScopedContext Active(hDevice);
+    CUevent EventNative;
+    UR_CHECK_ERROR(cuEventCreate(&EventNative, CU_EVENT_INTERPROCESS |
+                                                   CU_EVENT_DISABLE_TIMING));
+    try {
+      *phEvent = ur_event_handle_t_::makeIPC(hContext, EventNative, false);
+    } catch (...) {
+      cuEventDestroy(EventNative);
+      throw;
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t hEvent, ur_exp_ipc_event_handle_t *pIPCHandle) {
+  static_assert(sizeof(CUipcEventHandle) <= sizeof(pIPCHandle->data),
+                "CUipcEventHandle doesn't fit in ur_exp_ipc_event_handle_t");
+  // The handle of an opened event can't be passed on
+  UR_ASSERT(hEvent->isIPC() && !hEvent->isIPCImported(),
+            UR_RESULT_ERROR_INVALID_EVENT);
+
+  try {
+    CUipcEventHandle Handle;
+    UR_CHECK_ERROR(cuIpcGetEventHandle(&Handle, hEvent->get()));
+    std::memset(pIPCHandle->data, 0, sizeof(pIPCHandle->data));
+    std::memcpy(pIPCHandle->data, &Handle, sizeof(Handle));
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_exp_ipc_event_handle_t *pIPCHandle, ur_event_handle_t *phEvent) {
+  try {
+    ScopedContext Active(hDevice);
+    CUipcEventHandle Handle;
+    std::memcpy(&Handle, pIPCHandle->data, sizeof(Handle));
+    CUevent EventNative;
+    // CUDA can't open the handles of the process itself
+    CUresult Res = cuIpcOpenEventHandle(&EventNative, Handle);
+    if (Res == CUDA_ERROR_INVALID_VALUE || Res == CUDA_ERROR_INVALID_HANDLE ||
+        Res == CUDA_ERROR_INVALID_CONTEXT) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    UR_CHECK_ERROR(Res);
+    try {
+      *phEvent = ur_event_handle_t_::makeIPC(hContext, EventNative, true);
+    } catch (...) {
+      cuEventDestroy(EventNative);
+      throw;
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (const std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
@@ -13,6 +13,7 @@
 #include <ur/ur.hpp>
 
 #include "common.hpp"
+#include "context.hpp"
 #include "queue.hpp"
 
 /// UR Event mapping to CUevent
@@ -45,10 +46,58 @@ public:
 
   bool isCompleted() const noexcept;
 
+  // Whether the event was found complete before, without querying it again
+  bool isKnownCompleted() const noexcept { return HasCompleted; }
+
   bool isInterop() const noexcept { return IsInterop; };
 
+  // Whether the event is shared with other processes, created by
+  // urEventCreateIPCExp or opened by urEventOpenIPCHandleExp
+  bool isIPC() const noexcept { return IsIPC; }
+
+  bool isIPCImported() const noexcept { return IsIPCImported; }
+
+  // Whether the command of the event was submitted to the driver, which the
+  // submission thread of its queue may not have done yet. The members set
+  // by the submission are valid once it was.
+  bool isSubmitted() const noexcept {
+    return !Queue || !Queue->Submitter ||
+           Queue->Submitter->isSubmitted(SubmissionSeq);
+  }
+
+  void waitSubmitted() const noexcept {
+    if (Queue && Queue->Submitter) {
+      Queue->Submitter->waitSubmitted(SubmissionSeq);
+    }
+  }
+
+  // Called by the submission thread, once it picked the stream of the
+  // command pushed with SubmissionSeq
+  void setSubmission(uint64_t Seq) noexcept { SubmissionSeq = Seq; }
+
+  void setStream(CUstream NewStream, uint32_t NewStreamToken) noexcept {
+    Stream = NewStream;
+    StreamToken = NewStreamToken;
+  }
+
+  // Called by the submission thread when it failed to submit the command,
+  // which the waits on the event then return
+  void setSubmissionError(ur_result_t Error) noexcept {
+    SubmissionError = Error;
+  }
+
+  ur_result_t getSubmissionError() const noexcept { return SubmissionError; }
+
   uint32_t getExecutionStatus() const noexcept {
 
+    if (!isSubmitted()) {
+      return UR_EVENT_STATUS_QUEUED;
+    }
+
+    if (SubmissionError != UR_RESULT_SUCCESS) {
+      return UR_EVENT_STATUS_ERROR;
+    }
+
     if (!isRecorded()) {
       return UR_EVENT_STATUS_SUBMITTED;
     }
@@ -95,16 +144,17 @@ public:
     if (RequiresTimings) {
       Queue->createHostSubmitTimeStream();
     }
+    auto Context = Queue->getContext();
+    auto Device = Queue->getDevice();
     native_type EvEnd = nullptr, EvQueued = nullptr, EvStart = nullptr;
-    UR_CHECK_ERROR(cuEventCreate(
-        &EvEnd, RequiresTimings ? CU_EVENT_DEFAULT : CU_EVENT_DISABLE_TIMING));
+    EvEnd = Context->acquireNativeEvent(Device, RequiresTimings);
 
     if (RequiresTimings) {
-      UR_CHECK_ERROR(cuEventCreate(&EvQueued, CU_EVENT_DEFAULT));
-      UR_CHECK_ERROR(cuEventCreate(&EvStart, CU_EVENT_DEFAULT));
+      EvQueued = Context->acquireNativeEvent(Device, true);
+      EvStart = Context->acquireNativeEvent(Device, true);
     }
-    return new ur_event_handle_t_(Type, Queue->getContext(), Queue, EvEnd,
-                                  EvQueued, EvStart, Stream, StreamToken);
+    return new ur_event_handle_t_(Type, Context, Queue, EvEnd, EvQueued,
+                                  EvStart, Stream, StreamToken);
   }
 
   static ur_event_handle_t makeWithNative(ur_context_handle_t context,
@@ -112,6 +162,16 @@ public:
     return new ur_event_handle_t_(context, eventNative);
   }
 
+  // The event is destroyed with the handle, whether it was created with
+  // CU_EVENT_INTERPROCESS or opened from another process
+  static ur_event_handle_t makeIPC(ur_context_handle_t context,
+                                   CUevent eventNative, bool imported) {
+    auto Event = new ur_event_handle_t_(context, eventNative);
+    Event->IsIPC = true;
+    Event->IsIPCImported = imported;
+    return Event;
+  }
+
   ur_result_t release();
 
   ~ur_event_handle_t_();
@@ -134,9 +194,9 @@ private:
 
   bool HasOwnership; // Signifies if event owns the native type.
 
-  bool HasBeenWaitedOn; // Signifies whether the event has been waited
-                        // on through a call to wait(), which implies
-                        // that it has completed.
+  // Signifies whether the event is known to have completed, from a call to
+  // wait() or from a query that found it complete.
+  mutable std::atomic_bool HasCompleted;
 
   bool IsRecorded; // Signifies wether a native CUDA event has been recorded
                    // yet.
@@ -145,9 +205,19 @@ private:
 
   const bool IsInterop{false}; // Made with urEventCreateWithNativeHandle
 
+  bool IsIPC{false};         // Made with makeIPC
+  bool IsIPCImported{false}; // Opened from the IPC handle of another process
+
   uint32_t StreamToken;
   uint32_t EventID; // Queue identifier of the event.
 
+  // Sequence number of the command on the submission thread of the queue, 0
+  // if it was submitted by the enqueue call
+  uint64_t SubmissionSeq{0};
+
+  // Error the submission thread failed to submit the command with
+  std::atomic<ur_result_t> SubmissionError{UR_RESULT_SUCCESS};
+
   native_type EvEnd; // CUDA event handle. If this ur_event_handle_t represents
                      // a user event, this will be nullptr.
 
@@ -167,10 +237,24 @@ private:
                                // same context associated with the queue member.
 };
 
-// Iterate over `event_wait_list` and apply the given callback `f` to the
-// latest event on each queue therein. The callback must take a single
-// ur_event_handle_t argument and return a ur_result_t. If the callback returns
-// an error, the iteration terminates and the error is returned.
+// Describes the events of wait lists to ur::normalizeEventWaitList. The
+// commands of a stream run in order, interop events aren't on any of ours.
+struct ur_event_wait_traits_ {
+  static const void *sequence(ur_event_handle_t Event) {
+    return Event->isInterop() ? nullptr
+                              : static_cast<const void *>(Event->getStream());
+  }
+  static uint64_t order(ur_event_handle_t Event) { return Event->getEventID(); }
+  static bool isCompleted(ur_event_handle_t Event) {
+    return Event->isKnownCompleted();
+  }
+};
+
+// Iterate over `EventWaitList` and apply the given callback `F` to the
+// latest event on each stream therein, skipping duplicates and events known to
+// have completed. The callback must take a single ur_event_handle_t argument
+// and return a ur_result_t. If the callback returns an error, the iteration
+// terminates and the error is returned.
 template <typename Func>
 ur_result_t forLatestEvents(const ur_event_handle_t *EventWaitList,
                             std::size_t NumEventsInWaitList, Func &&F) {
@@ -179,33 +263,25 @@ ur_result_t forLatestEvents(const ur_event_handle_t *EventWaitList,
     return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
   }
 
+  // The streams of events are known once their commands were submitted
+  for (std::size_t i = 0; i < NumEventsInWaitList; i++) {
+    if (EventWaitList[i]) {
+      EventWaitList[i]->waitSubmitted();
+    }
+  }
+
   // Fast path if we only have a single event
   if (NumEventsInWaitList == 1) {
+    if (EventWaitList[0] && EventWaitList[0]->isKnownCompleted()) {
+      return UR_RESULT_SUCCESS;
+    }
     return F(EventWaitList[0]);
   }
 
-  std::vector<ur_event_handle_t> Events{EventWaitList,
-                                        EventWaitList + NumEventsInWaitList};
-  std::sort(Events.begin(), Events.end(),
-            [](ur_event_handle_t Event0, ur_event_handle_t Event1) {
-              // Tiered sort creating sublists of streams (smallest value first)
-              // in which the corresponding events are sorted into a sequence of
-              // newest first.
-              return Event0->getStream() < Event1->getStream() ||
-                     (Event0->getStream() == Event1->getStream() &&
-                      Event0->getEventID() > Event1->getEventID());
-            });
-
-  CUstream LastSeenStream = 0;
-  for (size_t i = 0; i < Events.size(); i++) {
-    auto Event = Events[i];
-    if (!Event || (i != 0 && !Event->isInterop() &&
-                   Event->getStream() == LastSeenStream)) {
-      continue;
-    }
-
-    LastSeenStream = Event->getStream();
-
+  std::vector<ur_event_handle_t> Events;
+  ur::normalizeEventWaitList<ur_event_wait_traits_>(
+      EventWaitList, NumEventsInWaitList, Events);
+  for (auto Event : Events) {
     auto Result = F(Event);
     if (Result != UR_RESULT_SUCCESS) {
       return Result;
@@ -0,0 +1,105 @@
+//===--------- growable_mem.cpp - CUDA Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "growable_mem.hpp"
+#include "common.hpp"
+#include "context.hpp"
+#include "device.hpp"
+
+namespace {
+size_t roundUp(size_t Size, size_t Granularity) {
+  return (Size + Granularity - 1) / Granularity * Granularity;
+}
+
+CUmemAllocationProp getAllocationProps(ur_device_handle_t Device) {
+  CUmemAllocationProp AllocProps = {};
+  AllocProps.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+  AllocProps.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+  AllocProps.location.id = Device->getIndex();
+  return AllocProps;
+}
+} // namespace
+
+GrowableAllocation::GrowableAllocation(ur_device_handle_t Device,
+                                       size_t MaxSize, size_t Size)
+    : Device(Device), MaxSize(MaxSize) {
+  ScopedContext Active(Device);
+  int VMMSupported = 0;
+  UR_CHECK_ERROR(cuDeviceGetAttribute(
+      &VMMSupported, CU_DEVICE_ATTRIBUTE_VIRTUAL_MEMORY_MANAGEMENT_SUPPORTED,
+      Device->get()));
+  if (!VMMSupported) {
+    throw UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  // Growing by less than the recommended granularity maps many small chunks
+  CUmemAllocationProp AllocProps = getAllocationProps(Device);
+  UR_CHECK_ERROR(cuMemGetAllocationGranularity(
+      &Granularity, &AllocProps, CU_MEM_ALLOC_GRANULARITY_RECOMMENDED));
+  ReservedSize = roundUp(MaxSize, Granularity);
+  UR_CHECK_ERROR(cuMemAddressReserve(&Base, ReservedSize, 0, 0, 0));
+
+  try {
+    grow(Size);
+  } catch (...) {
+    cuMemAddressFree(Base, ReservedSize);
+    throw;
+  }
+}
+
+GrowableAllocation::~GrowableAllocation() {
+  ScopedContext Active(Device);
+  if (MappedSize) {
+    cuMemUnmap(Base, MappedSize);
+  }
+  for (auto Chunk : Chunks) {
+    cuMemRelease(Chunk);
+  }
+  cuMemAddressFree(Base, ReservedSize);
+}
+
+void GrowableAllocation::grow(size_t Size) {
+  if (Size > MaxSize) {
+    throw UR_RESULT_ERROR_INVALID_USM_SIZE;
+  }
+
+  std::lock_guard<std::mutex> Lock(Mutex);
+  if (Size <= MappedSize) {
+    return;
+  }
+
+  ScopedContext Active(Device);
+  size_t ChunkSize = roundUp(Size - MappedSize, Granularity);
+  CUmemAllocationProp AllocProps = getAllocationProps(Device);
+  CUmemGenericAllocationHandle Chunk;
+  switch (auto Result = cuMemCreate(&Chunk, ChunkSize, &AllocProps, 0)) {
+  case CUDA_ERROR_OUT_OF_MEMORY:
+    throw UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+  default:
+    UR_CHECK_ERROR(Result);
+  }
+
+  CUdeviceptr ChunkStart = Base + MappedSize;
+  if (auto Result = cuMemMap(ChunkStart, ChunkSize, 0, Chunk, 0)) {
+    cuMemRelease(Chunk);
+    UR_CHECK_ERROR(Result);
+  }
+  CUmemAccessDesc AccessDesc = {};
+  AccessDesc.location = AllocProps.location;
+  AccessDesc.flags = CU_MEM_ACCESS_FLAGS_PROT_READWRITE;
+  if (auto Result = cuMemSetAccess(ChunkStart, ChunkSize, &AccessDesc, 1)) {
+    cuMemUnmap(ChunkStart, ChunkSize);
+    cuMemRelease(Chunk);
+    UR_CHECK_ERROR(Result);
+  }
+
+  Chunks.push_back(Chunk);
+  MappedSize += ChunkSize;
+}
@@ -0,0 +1,46 @@
+//===--------- growable_mem.hpp - CUDA Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cuda.h>
+#include <ur_api.h>
+
+#include <mutex>
+#include <vector>
+
+// Device allocation reserving the address range of its maximum size, whose
+// beginning is backed by physical memory mapped as it grows. Growing never
+// moves nor copies the memory already backing the allocation.
+class GrowableAllocation {
+public:
+  // Reserves MaxSize bytes of addresses and backs the first Size bytes
+  GrowableAllocation(ur_device_handle_t Device, size_t MaxSize, size_t Size);
+  ~GrowableAllocation();
+
+  GrowableAllocation(const GrowableAllocation &) = delete;
+  GrowableAllocation &operator=(const GrowableAllocation &) = delete;
+
+  // Backs at least the first Size bytes, throws ur_result_t on failure
+  void grow(size_t Size);
+
+  void *get() const noexcept { return reinterpret_cast<void *>(Base); }
+
+private:
+  ur_device_handle_t Device;
+  size_t MaxSize;
+  size_t Granularity = 0;
+  size_t ReservedSize = 0;
+  CUdeviceptr Base = 0;
+
+  std::mutex Mutex;
+  size_t MappedSize = 0;
+  // Physical memory mapped one after the other from Base
+  std::vector<CUmemGenericAllocationHandle> Chunks;
+};
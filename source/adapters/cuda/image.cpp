@@ -8,9 +8,12 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cstring>
 #include <cuda.h>
 #include <map>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "common.hpp"
 #include "context.hpp"
@@ -23,6 +26,7 @@
 #include "sampler.hpp"
 #include "ur/ur.hpp"
 #include "ur_api.h"
+#include "usm.hpp"
 
 ur_result_t urCalculateNumChannels(ur_image_channel_order_t order,
                                    unsigned int *NumChannels) {
@@ -154,7 +158,10 @@ cudaToUrImageChannelFormat(CUarray_format cuda_format,
   }
 }
 
-ur_result_t urTextureCreate(ur_sampler_handle_t hSampler,
+ur_result_t urTextureCreate(ur_context_handle_t hContext,
+                            ur_device_handle_t hDevice,
+                            ur_exp_image_mem_native_handle_t hImageMem,
+                            ur_sampler_handle_t hSampler,
                             const ur_image_desc_t *pImageDesc,
                             const CUDA_RESOURCE_DESC &ResourceDesc,
                             const unsigned int normalized_dtype_flag,
@@ -175,7 +182,9 @@ ur_result_t urTextureCreate(ur_sampler_handle_t hSampler,
     /// |     4 3 2      | addressing mode 1
     /// |       1        | filter mode
     /// |       0        | normalize coords
-    CUDA_TEXTURE_DESC ImageTexDesc = {};
+    // Zeroed along with its padding, as it keys the cached textures
+    CUDA_TEXTURE_DESC ImageTexDesc;
+    std::memset(&ImageTexDesc, 0, sizeof(ImageTexDesc));
     CUaddress_mode AddrMode[3] = {};
     for (size_t i = 0; i < 3; i++) {
       ur_sampler_addressing_mode_t AddrModeProp =
@@ -245,10 +254,22 @@ ur_result_t urTextureCreate(ur_sampler_handle_t hSampler,
 #endif
     }
 
+    std::string Desc;
+    ur::image_handle_cache::append(Desc, ResourceDesc);
+    ur::image_handle_cache::append(Desc, ImageTexDesc);
+    if (hContext->TextureHandles.acquire(hDevice, hImageMem, Desc,
+                                         *phRetImage)) {
+      return UR_RESULT_SUCCESS;
+    }
+
     CUtexObject Texture;
     UR_CHECK_ERROR(
         cuTexObjectCreate(&Texture, &ResourceDesc, &ImageTexDesc, nullptr));
     *phRetImage = (ur_exp_image_native_handle_t)Texture;
+    if (!hContext->TextureHandles.insert(hDevice, hImageMem, Desc,
+                                         *phRetImage)) {
+      UR_CHECK_ERROR(cuTexObjectDestroy(Texture));
+    }
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -257,6 +278,65 @@ ur_result_t urTextureCreate(ur_sampler_handle_t hSampler,
   return UR_RESULT_SUCCESS;
 }
 
+namespace {
+// Errors are ignored as the handles are gone from the caches anyway
+void destroyPurged(
+    const std::vector<ur::image_handle_cache::device_handle_t> &Surfaces,
+    const std::vector<ur::image_handle_cache::device_handle_t> &Textures) {
+  for (auto &[Device, Handle] : Surfaces) {
+    try {
+      ScopedContext Active(Device);
+      cuSurfObjectDestroy((CUsurfObject)Handle);
+    } catch (ur_result_t) {
+    }
+  }
+  for (auto &[Device, Handle] : Textures) {
+    try {
+      ScopedContext Active(Device);
+      cuTexObjectDestroy((CUtexObject)Handle);
+    } catch (ur_result_t) {
+    }
+  }
+}
+
+// Bytes of the NumLevels levels of the image described by Desc, of
+// PixelSizeBytes pixels, each level halving the dimensions of the previous
+// one but for the layers
+size_t getImageMemSize(const CUDA_ARRAY3D_DESCRIPTOR &Desc,
+                       size_t PixelSizeBytes, unsigned int NumLevels) {
+  bool Layered = Desc.Flags & (CUDA_ARRAY3D_LAYERED | CUDA_ARRAY3D_CUBEMAP);
+  size_t Width = Desc.Width;
+  size_t Height = std::max<size_t>(Desc.Height, 1);
+  size_t Depth = std::max<size_t>(Desc.Depth, 1);
+  size_t Size = 0;
+  for (unsigned int Level = 0; Level < NumLevels; ++Level) {
+    Size += Width * Height * Depth * PixelSizeBytes;
+    Width = std::max<size_t>(Width / 2, 1);
+    Height = std::max<size_t>(Height / 2, 1);
+    if (!Layered) {
+      Depth = std::max<size_t>(Depth / 2, 1);
+    }
+  }
+  return Size;
+}
+} // namespace
+
+void destroyImageHandles(ur_context_handle_t hContext,
+                         ur_exp_image_mem_native_handle_t hImageMem) {
+  destroyPurged(hContext->SurfaceHandles.purge(hImageMem),
+                hContext->TextureHandles.purge(hImageMem));
+}
+
+void destroyUnusedImageHandles(ur_context_handle_t hContext) {
+  destroyPurged(hContext->SurfaceHandles.purgeUnused(),
+                hContext->TextureHandles.purgeUnused());
+}
+
+void destroyAllImageHandles(ur_context_handle_t hContext) {
+  destroyPurged(hContext->SurfaceHandles.purgeAll(),
+                hContext->TextureHandles.purgeAll());
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urUSMPitchedAllocExp(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
@@ -286,6 +366,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPitchedAllocExp(
     ScopedContext Active(hDevice);
     UR_CHECK_ERROR(cuMemAllocPitch((CUdeviceptr *)ppMem, pResultPitch,
                                    widthInBytes, height, elementSizeBytes));
+    // Freed with urUSMFree as device USM
+    hContext->MemoryAccounting.onAlloc(
+        UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+        getUSMAllocSize(*ppMem, *pResultPitch * height));
   } catch (ur_result_t error) {
     Result = error;
   } catch (...) {
@@ -304,6 +388,9 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
                       hDevice) != hContext->getDevices().end(),
             UR_RESULT_ERROR_INVALID_CONTEXT);
 
+  if (hContext->SurfaceHandles.release(hDevice, hImage)) {
+    return UR_RESULT_SUCCESS;
+  }
   UR_CHECK_ERROR(cuSurfObjectDestroy((CUsurfObject)hImage));
   return UR_RESULT_SUCCESS;
 }
@@ -317,6 +404,9 @@ urBindlessImagesSampledImageHandleDestroyExp(
                       hDevice) != hContext->getDevices().end(),
             UR_RESULT_ERROR_INVALID_CONTEXT);
 
+  if (hContext->TextureHandles.release(hDevice, hImage)) {
+    return UR_RESULT_SUCCESS;
+  }
   UR_CHECK_ERROR(cuTexObjectDestroy((CUtexObject)hImage));
   return UR_RESULT_SUCCESS;
 }
@@ -336,9 +426,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
   UR_CHECK_ERROR(urCalculateNumChannels(pImageFormat->channelOrder,
                                         &array_desc.NumChannels));
 
+  size_t PixelSizeBytes = 0;
   UR_CHECK_ERROR(urToCudaImageChannelFormat(
       pImageFormat->channelType, pImageFormat->channelOrder, &array_desc.Format,
-      nullptr, nullptr));
+      &PixelSizeBytes, nullptr));
 
   array_desc.Flags = 0; // No flags required
   array_desc.Width = pImageDesc->width;
@@ -383,6 +474,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     try {
       UR_CHECK_ERROR(cuArray3DCreate(&ImageArray, &array_desc));
       *phImageMem = (ur_exp_image_mem_native_handle_t)ImageArray;
+      hContext->addImageMem(*phImageMem,
+                            getImageMemSize(array_desc, PixelSizeBytes, 1));
     } catch (ur_result_t Err) {
       if (ImageArray != CUarray{}) {
         UR_CHECK_ERROR(cuArrayDestroy(ImageArray));
@@ -403,6 +496,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
       UR_CHECK_ERROR(cuMipmappedArrayCreate(&mip_array, &array_desc,
                                             pImageDesc->numMipLevel));
       *phImageMem = (ur_exp_image_mem_native_handle_t)mip_array;
+      hContext->addImageMem(*phImageMem,
+                            getImageMemSize(array_desc, PixelSizeBytes,
+                                            pImageDesc->numMipLevel));
     } catch (ur_result_t Err) {
       if (mip_array) {
         UR_CHECK_ERROR(cuMipmappedArrayDestroy(mip_array));
@@ -427,9 +523,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
                       hDevice) != hContext->getDevices().end(),
             UR_RESULT_ERROR_INVALID_CONTEXT);
 
+  destroyImageHandles(hContext, hImageMem);
+
   ScopedContext Active(hDevice);
   try {
     UR_CHECK_ERROR(cuArrayDestroy((CUarray)hImageMem));
+    hContext->removeImageMem(hImageMem);
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -463,17 +562,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
 
     ScopedContext Active(hDevice);
 
-    CUDA_RESOURCE_DESC image_res_desc = {};
+    // Zeroed along with its padding, as it keys the cached surfaces
+    CUDA_RESOURCE_DESC image_res_desc;
+    std::memset(&image_res_desc, 0, sizeof(image_res_desc));
 
     // We have a CUarray
     image_res_desc.resType = CU_RESOURCE_TYPE_ARRAY;
     image_res_desc.res.array.hArray = (CUarray)hImageMem;
 
+    std::string Desc;
+    ur::image_handle_cache::append(Desc, image_res_desc);
+    if (hContext->SurfaceHandles.acquire(hDevice, hImageMem, Desc, *phImage)) {
+      return UR_RESULT_SUCCESS;
+    }
+
     // We create surfaces in the unsampled images case as it conforms to how
     // CUDA deals with unsampled images.
     CUsurfObject surface;
     UR_CHECK_ERROR(cuSurfObjectCreate(&surface, &image_res_desc));
     *phImage = (ur_exp_image_native_handle_t)surface;
+    if (!hContext->SurfaceHandles.insert(hDevice, hImageMem, Desc, *phImage)) {
+      UR_CHECK_ERROR(cuSurfObjectDestroy(surface));
+    }
 
   } catch (ur_result_t Err) {
     return Err;
@@ -508,7 +618,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
       &PixelSizeBytes, &normalized_dtype_flag));
 
   try {
-    CUDA_RESOURCE_DESC image_res_desc = {};
+    // Zeroed along with its padding, as it keys the cached textures
+    CUDA_RESOURCE_DESC image_res_desc;
+    std::memset(&image_res_desc, 0, sizeof(image_res_desc));
 
     unsigned int mem_type;
     // If this function doesn't return successfully, we assume that hImageMem is
@@ -554,7 +666,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
       return UR_RESULT_ERROR_INVALID_VALUE;
     }
 
-    UR_CHECK_ERROR(urTextureCreate(hSampler, pImageDesc, image_res_desc,
+    UR_CHECK_ERROR(urTextureCreate(hContext, hDevice, hImageMem, hSampler,
+                                   pImageDesc, image_res_desc,
                                    normalized_dtype_flag, phImage));
 
   } catch (ur_result_t Err) {
@@ -566,14 +679,296 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
-    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
-    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
-    const ur_image_format_t *pSrcImageFormat,
-    const ur_image_format_t *pDstImageFormat,
-    ur_exp_image_copy_region_t *pCopyRegion,
-    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+// Copies pCopyRegion of pSrc to pDst on Stream, pixels of PixelSizeBytes
+static ur_result_t
+imageCopyRegion(CUstream Stream, const void *pSrc, void *pDst,
+                const ur_image_desc_t *pSrcImageDesc,
+                const ur_image_desc_t *pDstImageDesc, size_t PixelSizeBytes,
+                const ur_exp_image_copy_region_t *pCopyRegion,
+                ur_exp_image_copy_flags_t imageCopyFlags) {
+  auto as_CUArray = [](const void *ptr) {
+    return static_cast<CUarray>(const_cast<void *>(ptr));
+  };
+
+  // We have to use a different copy function for each image dimensionality.
+
+  if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_HOST_TO_DEVICE) {
+    if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
+      CUmemorytype memType;
+
+      // Check what type of memory is pDst. If cuPointerGetAttribute returns
+      // somthing different from CUDA_SUCCESS then we know that pDst memory
+      // type is a CuArray. Otherwise, it's CU_MEMORYTYPE_DEVICE.
+      bool isCudaArray =
+          cuPointerGetAttribute(&memType, CU_POINTER_ATTRIBUTE_MEMORY_TYPE,
+                                (CUdeviceptr)pDst) != CUDA_SUCCESS;
+
+      size_t CopyExtentBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      const char *SrcWithOffset = static_cast<const char *>(pSrc) +
+                                  (pCopyRegion->srcOffset.x * PixelSizeBytes);
+
+      if (isCudaArray) {
+        UR_CHECK_ERROR(cuMemcpyHtoAAsync(
+            (CUarray)pDst, pCopyRegion->dstOffset.x * PixelSizeBytes,
+            static_cast<const void *>(SrcWithOffset), CopyExtentBytes,
+            Stream));
+      } else if (memType == CU_MEMORYTYPE_DEVICE) {
+        void *DstWithOffset =
+            static_cast<void *>(static_cast<char *>(pDst) +
+                                (PixelSizeBytes * pCopyRegion->dstOffset.x));
+        UR_CHECK_ERROR(
+            cuMemcpyHtoDAsync((CUdeviceptr)DstWithOffset,
+                              static_cast<const void *>(SrcWithOffset),
+                              CopyExtentBytes, Stream));
+      } else {
+        // This should be unreachable.
+        return UR_RESULT_ERROR_INVALID_VALUE;
+      }
+    } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
+      CUDA_MEMCPY2D cpy_desc = {};
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.srcHost = pSrc;
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
+      if (pDstImageDesc->rowPitch == 0) {
+        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+        cpy_desc.dstArray = (CUarray)pDst;
+      } else {
+        // Pitched memory
+        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
+        cpy_desc.dstDevice = (CUdeviceptr)pDst;
+        cpy_desc.dstPitch = pDstImageDesc->rowPitch;
+      }
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
+    } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.srcHost = pSrc;
+      cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
+      cpy_desc.srcHeight = pSrcImageDesc->height;
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
+               pDstImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
+               pDstImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.srcHost = pSrc;
+      cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
+      cpy_desc.srcHeight = std::max(uint64_t{1}, pSrcImageDesc->height);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    }
+  } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_HOST) {
+    if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
+      CUmemorytype memType;
+      // Check what type of memory is pSrc. If cuPointerGetAttribute returns
+      // somthing different from CUDA_SUCCESS then we know that pSrc memory
+      // type is a CuArray. Otherwise, it's CU_MEMORYTYPE_DEVICE.
+      bool isCudaArray =
+          cuPointerGetAttribute(&memType, CU_POINTER_ATTRIBUTE_MEMORY_TYPE,
+                                (CUdeviceptr)pSrc) != CUDA_SUCCESS;
+
+      size_t CopyExtentBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      void *DstWithOffset =
+          static_cast<void *>(static_cast<char *>(pDst) +
+                              (PixelSizeBytes * pCopyRegion->dstOffset.x));
+
+      if (isCudaArray) {
+        UR_CHECK_ERROR(
+            cuMemcpyAtoHAsync(DstWithOffset, as_CUArray(pSrc),
+                              PixelSizeBytes * pCopyRegion->srcOffset.x,
+                              CopyExtentBytes, Stream));
+      } else if (memType == CU_MEMORYTYPE_DEVICE) {
+        const char *SrcWithOffset =
+            static_cast<const char *>(pSrc) +
+            (pCopyRegion->srcOffset.x * PixelSizeBytes);
+        UR_CHECK_ERROR(cuMemcpyDtoHAsync(DstWithOffset,
+                                         (CUdeviceptr)SrcWithOffset,
+                                         CopyExtentBytes, Stream));
+      } else {
+        // This should be unreachable.
+        return UR_RESULT_ERROR_INVALID_VALUE;
+      }
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
+      CUDA_MEMCPY2D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.dstHost = pDst;
+      if (pSrcImageDesc->rowPitch == 0) {
+        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+        cpy_desc.srcArray = as_CUArray(pSrc);
+      } else {
+        // Pitched memory
+        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
+        cpy_desc.srcPitch = pSrcImageDesc->rowPitch;
+        cpy_desc.srcDevice = (CUdeviceptr)pSrc;
+      }
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.dstHost = pDst;
+      cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.dstHost = pDst;
+      cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
+      cpy_desc.dstHeight = pDstImageDesc->height;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
+               pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
+               pSrcImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
+      cpy_desc.dstHost = pDst;
+      cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
+      cpy_desc.dstHeight = std::max(uint64_t{1}, pDstImageDesc->height);
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    }
+  } else {
+    // imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE
+
+    // we don't support copying between different image types.
+    if (pSrcImageDesc->type != pDstImageDesc->type) {
+      logger::error(
+          "Unsupported copy operation between different type of images");
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    // All the following async copy function calls should be treated as
+    // synchronous because of the explicit call to cuStreamSynchronize by the
+    // callers
+    if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
+      CUDA_MEMCPY2D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = 0;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = 0;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = 1;
+      UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
+      CUDA_MEMCPY2D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = pCopyRegion->copyExtent.height;
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
+               pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
+               pSrcImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
+      CUDA_MEMCPY3D cpy_desc = {};
+      cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
+      cpy_desc.srcY = pCopyRegion->srcOffset.y;
+      cpy_desc.srcZ = pCopyRegion->srcOffset.z;
+      cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
+      cpy_desc.dstY = pCopyRegion->dstOffset.y;
+      cpy_desc.dstZ = pCopyRegion->dstOffset.z;
+      cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.srcArray = as_CUArray(pSrc);
+      cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
+      cpy_desc.dstArray = (CUarray)pDst;
+      cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
+      cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
+      cpy_desc.Depth = pCopyRegion->copyExtent.depth;
+      UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// Copies the numCopyRegions regions of pCopyRegions in a single stream of
+// hQueue, which phEvent is recorded on once they are all done
+static ur_result_t
+imageCopyRegions(ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+                 const ur_image_desc_t *pSrcImageDesc,
+                 const ur_image_desc_t *pDstImageDesc,
+                 const ur_image_format_t *pSrcImageFormat,
+                 const ur_image_format_t *pDstImageFormat,
+                 uint32_t numCopyRegions,
+                 const ur_exp_image_copy_region_t *pCopyRegions,
+                 ur_exp_image_copy_flags_t imageCopyFlags,
+                 uint32_t numEventsInWaitList,
+                 const ur_event_handle_t *phEventWaitList,
+                 ur_event_handle_t *phEvent) {
   UR_ASSERT((imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_HOST_TO_DEVICE ||
              imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_HOST ||
              imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE),
@@ -581,10 +976,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
   UR_ASSERT(pSrcImageFormat->channelOrder == pDstImageFormat->channelOrder,
             UR_RESULT_ERROR_INVALID_ARGUMENT);
 
-  auto as_CUArray = [](const void *ptr) {
-    return static_cast<CUarray>(const_cast<void *>(ptr));
-  };
-
   unsigned int NumChannels = 0;
   size_t PixelSizeBytes = 0;
 
@@ -602,267 +993,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     CUstream Stream = hQueue->getNextTransferStream();
     enqueueEventsWait(hQueue, Stream, numEventsInWaitList, phEventWaitList);
 
-    // We have to use a different copy function for each image dimensionality.
-
-    if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_HOST_TO_DEVICE) {
-      if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
-        CUmemorytype memType;
-
-        // Check what type of memory is pDst. If cuPointerGetAttribute returns
-        // somthing different from CUDA_SUCCESS then we know that pDst memory
-        // type is a CuArray. Otherwise, it's CU_MEMORYTYPE_DEVICE.
-        bool isCudaArray =
-            cuPointerGetAttribute(&memType, CU_POINTER_ATTRIBUTE_MEMORY_TYPE,
-                                  (CUdeviceptr)pDst) != CUDA_SUCCESS;
-
-        size_t CopyExtentBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        const char *SrcWithOffset = static_cast<const char *>(pSrc) +
-                                    (pCopyRegion->srcOffset.x * PixelSizeBytes);
-
-        if (isCudaArray) {
-          UR_CHECK_ERROR(cuMemcpyHtoAAsync(
-              (CUarray)pDst, pCopyRegion->dstOffset.x * PixelSizeBytes,
-              static_cast<const void *>(SrcWithOffset), CopyExtentBytes,
-              Stream));
-        } else if (memType == CU_MEMORYTYPE_DEVICE) {
-          void *DstWithOffset =
-              static_cast<void *>(static_cast<char *>(pDst) +
-                                  (PixelSizeBytes * pCopyRegion->dstOffset.x));
-          UR_CHECK_ERROR(
-              cuMemcpyHtoDAsync((CUdeviceptr)DstWithOffset,
-                                static_cast<const void *>(SrcWithOffset),
-                                CopyExtentBytes, Stream));
-        } else {
-          // This should be unreachable.
-          return UR_RESULT_ERROR_INVALID_VALUE;
-        }
-      } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
-        CUDA_MEMCPY2D cpy_desc = {};
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.srcHost = pSrc;
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
-        if (pDstImageDesc->rowPitch == 0) {
-          cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-          cpy_desc.dstArray = (CUarray)pDst;
-        } else {
-          // Pitched memory
-          cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
-          cpy_desc.dstDevice = (CUdeviceptr)pDst;
-          cpy_desc.dstPitch = pDstImageDesc->rowPitch;
-        }
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
-      } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.srcHost = pSrc;
-        cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
-        cpy_desc.srcHeight = pSrcImageDesc->height;
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      } else if (pDstImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
-                 pDstImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
-                 pDstImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.srcHost = pSrc;
-        cpy_desc.srcPitch = pSrcImageDesc->width * PixelSizeBytes;
-        cpy_desc.srcHeight = std::max(uint64_t{1}, pSrcImageDesc->height);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      }
-    } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_HOST) {
-      if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
-        CUmemorytype memType;
-        // Check what type of memory is pSrc. If cuPointerGetAttribute returns
-        // somthing different from CUDA_SUCCESS then we know that pSrc memory
-        // type is a CuArray. Otherwise, it's CU_MEMORYTYPE_DEVICE.
-        bool isCudaArray =
-            cuPointerGetAttribute(&memType, CU_POINTER_ATTRIBUTE_MEMORY_TYPE,
-                                  (CUdeviceptr)pSrc) != CUDA_SUCCESS;
-
-        size_t CopyExtentBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        void *DstWithOffset =
-            static_cast<void *>(static_cast<char *>(pDst) +
-                                (PixelSizeBytes * pCopyRegion->dstOffset.x));
-
-        if (isCudaArray) {
-          UR_CHECK_ERROR(
-              cuMemcpyAtoHAsync(DstWithOffset, as_CUArray(pSrc),
-                                PixelSizeBytes * pCopyRegion->srcOffset.x,
-                                CopyExtentBytes, Stream));
-        } else if (memType == CU_MEMORYTYPE_DEVICE) {
-          const char *SrcWithOffset =
-              static_cast<const char *>(pSrc) +
-              (pCopyRegion->srcOffset.x * PixelSizeBytes);
-          UR_CHECK_ERROR(cuMemcpyDtoHAsync(DstWithOffset,
-                                           (CUdeviceptr)SrcWithOffset,
-                                           CopyExtentBytes, Stream));
-        } else {
-          // This should be unreachable.
-          return UR_RESULT_ERROR_INVALID_VALUE;
-        }
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
-        CUDA_MEMCPY2D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.dstHost = pDst;
-        if (pSrcImageDesc->rowPitch == 0) {
-          cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-          cpy_desc.srcArray = as_CUArray(pSrc);
-        } else {
-          // Pitched memory
-          cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_DEVICE;
-          cpy_desc.srcPitch = pSrcImageDesc->rowPitch;
-          cpy_desc.srcDevice = (CUdeviceptr)pSrc;
-        }
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.dstHost = pDst;
-        cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.dstHost = pDst;
-        cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
-        cpy_desc.dstHeight = pDstImageDesc->height;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
-                 pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
-                 pSrcImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_HOST;
-        cpy_desc.dstHost = pDst;
-        cpy_desc.dstPitch = pDstImageDesc->width * PixelSizeBytes;
-        cpy_desc.dstHeight = std::max(uint64_t{1}, pDstImageDesc->height);
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      }
-    } else {
-      // imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE
-
-      // we don't support copying between different image types.
-      if (pSrcImageDesc->type != pDstImageDesc->type) {
-        logger::error(
-            "Unsupported copy operation between different type of images");
-        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-      }
+    for (uint32_t i = 0; i < numCopyRegions; ++i) {
+      UR_CHECK_ERROR(imageCopyRegion(Stream, pSrc, pDst, pSrcImageDesc,
+                                     pDstImageDesc, PixelSizeBytes,
+                                     &pCopyRegions[i], imageCopyFlags));
+    }
 
-      // All the following async copy function calls should be treated as
-      // synchronous because of the explicit call to cuStreamSynchronize at
-      // the end
-      if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D) {
-        CUDA_MEMCPY2D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = 0;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = 0;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = 1;
-        UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D) {
-        CUDA_MEMCPY2D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        UR_CHECK_ERROR(cuMemcpy2DAsync(&cpy_desc, Stream));
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE3D) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = pCopyRegion->copyExtent.height;
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      } else if (pSrcImageDesc->type == UR_MEM_TYPE_IMAGE1D_ARRAY ||
-                 pSrcImageDesc->type == UR_MEM_TYPE_IMAGE2D_ARRAY ||
-                 pSrcImageDesc->type == UR_MEM_TYPE_IMAGE_CUBEMAP_EXP) {
-        CUDA_MEMCPY3D cpy_desc = {};
-        cpy_desc.srcXInBytes = pCopyRegion->srcOffset.x * PixelSizeBytes;
-        cpy_desc.srcY = pCopyRegion->srcOffset.y;
-        cpy_desc.srcZ = pCopyRegion->srcOffset.z;
-        cpy_desc.dstXInBytes = pCopyRegion->dstOffset.x * PixelSizeBytes;
-        cpy_desc.dstY = pCopyRegion->dstOffset.y;
-        cpy_desc.dstZ = pCopyRegion->dstOffset.z;
-        cpy_desc.srcMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.srcArray = as_CUArray(pSrc);
-        cpy_desc.dstMemoryType = CUmemorytype_enum::CU_MEMORYTYPE_ARRAY;
-        cpy_desc.dstArray = (CUarray)pDst;
-        cpy_desc.WidthInBytes = PixelSizeBytes * pCopyRegion->copyExtent.width;
-        cpy_desc.Height = std::max(uint64_t{1}, pCopyRegion->copyExtent.height);
-        cpy_desc.Depth = pCopyRegion->copyExtent.depth;
-        UR_CHECK_ERROR(cuMemcpy3DAsync(&cpy_desc, Stream));
-      }
+    if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE) {
       // Synchronization is required here to handle the case of copying data
       // from host to device, then device to device and finally device to host.
       // Without it, there is a risk of the copies not being executed in the
@@ -885,6 +1022,34 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return imageCopyRegions(hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+                          pSrcImageFormat, pDstImageFormat, 1, pCopyRegion,
+                          imageCopyFlags, numEventsInWaitList, phEventWaitList,
+                          phEvent);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return imageCopyRegions(hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+                          pSrcImageFormat, pDstImageFormat, numCopyRegions,
+                          pCopyRegions, imageCopyFlags, numEventsInWaitList,
+                          phEventWaitList, phEvent);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     ur_context_handle_t, ur_exp_image_mem_native_handle_t hImageMem,
     ur_image_info_t propName, void *pPropValue, size_t *pPropSizeRet) {
@@ -989,9 +1154,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
                       hDevice) != hContext->getDevices().end(),
             UR_RESULT_ERROR_INVALID_CONTEXT);
 
+  // The arrays of its levels go with the mipmapped array, without the
+  // context knowing which they were
+  destroyImageHandles(hContext, hMem);
+  destroyUnusedImageHandles(hContext);
+
   ScopedContext Active(hDevice);
   try {
     UR_CHECK_ERROR(cuMipmappedArrayDestroy((CUmipmappedArray)hMem));
+    hContext->removeImageMem(hMem);
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -1153,6 +1324,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
                       hDevice) != hContext->getDevices().end(),
             UR_RESULT_ERROR_INVALID_CONTEXT);
 
+  // The arrays and buffers mapped from it go with the external memory
+  destroyUnusedImageHandles(hContext);
+
   try {
     ScopedContext Active(hDevice);
     UR_CHECK_ERROR(cuDestroyExternalMemory((CUexternalMemory)hExternalMem));
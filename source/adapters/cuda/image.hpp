@@ -28,8 +28,23 @@ ur_result_t
 cudaToUrImageChannelFormat(CUarray_format cuda_format,
                            ur_image_channel_type_t *return_image_channel_type);
 
-ur_result_t urTextureCreate(ur_sampler_handle_t hSampler,
+ur_result_t urTextureCreate(ur_context_handle_t hContext,
+                            ur_device_handle_t hDevice,
+                            ur_exp_image_mem_native_handle_t hImageMem,
+                            ur_sampler_handle_t hSampler,
                             const ur_image_desc_t *pImageDesc,
                             const CUDA_RESOURCE_DESC &ResourceDesc,
                             const unsigned int normalized_dtype_flag,
                             ur_exp_image_native_handle_t *phRetImage);
+
+// Destroys the surface and texture objects of hContext viewing hImageMem,
+// which is being freed
+void destroyImageHandles(ur_context_handle_t hContext,
+                         ur_exp_image_mem_native_handle_t hImageMem);
+
+// Destroys the surface and texture objects of hContext which aren't in use,
+// as memory they view was freed without the context knowing which
+void destroyUnusedImageHandles(ur_context_handle_t hContext);
+
+// Destroys every surface and texture object of hContext
+void destroyAllImageHandles(ur_context_handle_t hContext);
@@ -15,6 +15,16 @@
 #include "sampler.hpp"
 #include "ur_api.h"
 
+namespace {
+// Whether the shared USM allocations given to kernels are prefetched to the
+// device before the launches. Off by default, as the launches then pay for a
+// prefetch per allocation even when it is resident already.
+const bool AutoPrefetchSharedUSM = [] {
+  const char *PrefetchStr = std::getenv("UR_CUDA_USM_AUTO_PREFETCH");
+  return PrefetchStr && std::atoi(PrefetchStr) != 0;
+}();
+} // namespace
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
                ur_kernel_handle_t *phKernel) {
@@ -234,6 +244,47 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   }
   return UR_RESULT_SUCCESS;
 }
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                   const ur_exp_kernel_arg_t *pArgs) {
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const auto &Arg = pArgs[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      Result = urKernelSetArgValue(hKernel, Arg.index, Arg.size, nullptr,
+                                   Arg.value.value);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      Result =
+          urKernelSetArgPointer(hKernel, Arg.index, nullptr, Arg.value.pointer);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      ur_kernel_arg_mem_obj_properties_t Properties = {
+          UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+          Arg.value.memObjTuple.flags ? Arg.value.memObjTuple.flags
+                                      : UR_MEM_FLAG_READ_WRITE};
+      Result = urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                    Arg.value.memObjTuple.hMem);
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      Result = urKernelSetArgLocal(hKernel, Arg.index, Arg.size, nullptr);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      Result =
+          urKernelSetArgSampler(hKernel, Arg.index, nullptr, Arg.value.sampler);
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
@@ -350,6 +401,23 @@ urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
   std::ignore = pProperties;
   // setKernelArg is expecting a pointer to our argument
   hKernel->setKernelArg(argIndex, sizeof(pArgValue), &pArgValue);
+  if (AutoPrefetchSharedUSM && pArgValue) {
+    // Pointers CUDA doesn't know of, to host memory for instance, fail the
+    // query and aren't prefetched
+    unsigned int IsManaged = 0;
+    CUdeviceptr Base = 0;
+    size_t Size = 0;
+    CUpointer_attribute Attributes[] = {CU_POINTER_ATTRIBUTE_IS_MANAGED,
+                                        CU_POINTER_ATTRIBUTE_RANGE_START_ADDR,
+                                        CU_POINTER_ATTRIBUTE_RANGE_SIZE};
+    void *Values[] = {&IsManaged, &Base, &Size};
+    if (cuPointerGetAttributes(3, Attributes, Values,
+                               reinterpret_cast<CUdeviceptr>(pArgValue)) ==
+            CUDA_SUCCESS &&
+        IsManaged) {
+      hKernel->Args.addSharedUSMArg(argIndex, Base, Size);
+    }
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -370,6 +438,11 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
     ur_mem_flags_t MemAccess =
         Properties ? Properties->memoryAccess
                    : static_cast<ur_mem_flags_t>(UR_MEM_FLAG_READ_WRITE);
+    // Kernels don't write to read-only memory objects, so the copies made on
+    // the other devices of the context stay valid whatever the access given
+    if (hArgValue->MemFlags & UR_MEM_FLAG_READ_ONLY) {
+      MemAccess = UR_MEM_FLAG_READ_ONLY;
+    }
     hKernel->Args.addMemObjArg(argIndex, hArgValue, MemAccess);
     if (hArgValue->isImage()) {
       CUDA_ARRAY3D_DESCRIPTOR arrayDesc;
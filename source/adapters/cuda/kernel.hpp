@@ -12,9 +12,12 @@
 #include <cuda.h>
 #include <ur_api.h>
 
+#include <algorithm>
 #include <array>
 #include <atomic>
 #include <cassert>
+#include <map>
+#include <mutex>
 #include <numeric>
 
 #include "program.hpp"
@@ -50,6 +53,15 @@ struct ur_kernel_handle_t_ {
   size_t MaxLinearThreadsPerBlock{0};
   int RegsPerThread{0};
 
+  /// Local sizes guessed for the launches without one, keyed by the global
+  /// size and the local memory size, as the occupancy depends on both. The
+  /// cache is cleared when full, for kernels launched with many sizes, and is
+  /// guarded by GuessedLocalSizesMutex as the kernel may be launched from
+  /// several threads.
+  static constexpr size_t MaxGuessedLocalSizes = 16u;
+  std::mutex GuessedLocalSizesMutex;
+  std::map<std::array<size_t, 4>, std::array<size_t, 3>> GuessedLocalSizes;
+
   /// Structure that holds the arguments to the kernel.
   /// Note each argument size is known, since it comes
   /// from the kernel signature.
@@ -73,6 +85,14 @@ struct ur_kernel_handle_t_ {
       ur_mem_flags_t AccessFlags;
     };
     std::vector<mem_obj_arg> MemObjArgs;
+    // Shared USM allocations that pointer arguments point into, prefetched to
+    // the device before each launch with UR_CUDA_USM_AUTO_PREFETCH
+    struct shared_usm_arg {
+      size_t Index;
+      CUdeviceptr Base;
+      size_t Size;
+    };
+    std::vector<shared_usm_arg> SharedUSMArgs;
 
     std::uint32_t ImplicitOffsetArgs[3] = {0, 0, 0};
 
@@ -96,6 +116,14 @@ struct ur_kernel_handle_t_ {
         OffsetPerIndex.resize(Index + 1);
       }
       ParamSizes[Index] = Size;
+      if (!SharedUSMArgs.empty()) {
+        SharedUSMArgs.erase(
+            std::remove_if(SharedUSMArgs.begin(), SharedUSMArgs.end(),
+                           [Index](const shared_usm_arg &Arg) {
+                             return Arg.Index == Index;
+                           }),
+            SharedUSMArgs.end());
+      }
       // calculate the insertion point on the array
       size_t InsertPos = std::accumulate(std::begin(ParamSizes),
                                          std::begin(ParamSizes) + Index, 0);
@@ -105,6 +133,12 @@ struct ur_kernel_handle_t_ {
       OffsetPerIndex[Index] = LocalSize;
     }
 
+    /// Records that the argument at Index, which was just set, points into a
+    /// shared USM allocation. Setting the argument again forgets it.
+    void addSharedUSMArg(size_t Index, CUdeviceptr Base, size_t Size) {
+      SharedUSMArgs.push_back(shared_usm_arg{Index, Base, Size});
+    }
+
     void addLocalArg(size_t Index, size_t Size) {
       size_t LocalOffset = this->getLocalSize();
 
@@ -243,4 +277,25 @@ struct ur_kernel_handle_t_ {
   void clearLocalSize() { Args.clearLocalSize(); }
 
   size_t getRegsPerThread() const noexcept { return RegsPerThread; };
+
+  /// Makes the maximum dynamic shared memory size of Func, which is either of
+  /// the functions of the kernel, at least Size, calling into the driver only
+  /// when it grows. The size is never lowered, so that launches of other
+  /// threads needing more still fit once they've set it.
+  void setMaxDynamicSharedSize(CUfunction Func, int Size) {
+    std::lock_guard<std::mutex> Lock(MaxDynamicSharedSizeMutex);
+    int &AppliedSize = Func == Function ? MaxDynamicSharedSize[0]
+                                        : MaxDynamicSharedSize[1];
+    if (AppliedSize < Size) {
+      UR_CHECK_ERROR(cuFuncSetAttribute(
+          Func, CU_FUNC_ATTRIBUTE_MAX_DYNAMIC_SHARED_SIZE_BYTES, Size));
+      AppliedSize = Size;
+    }
+  }
+
+private:
+  /// Largest sizes set by setMaxDynamicSharedSize for Function and
+  /// FunctionWithOffsetParam, -1 when never set
+  std::mutex MaxDynamicSharedSizeMutex;
+  int MaxDynamicSharedSize[2] = {-1, -1};
 };
@@ -14,6 +14,33 @@
 #include "context.hpp"
 #include "enqueue.hpp"
 #include "memory.hpp"
+#include "platform.hpp"
+
+namespace {
+// Allocates Size bytes of a buffer from Pool, aligned as cuMemAlloc does to
+// keep the sub-buffers at UR_DEVICE_INFO_MEM_BASE_ADDR_ALIGN offsets aligned.
+// Host allocations, hDevice being null, are aligned for every device of the
+// context.
+void *allocateFromBufferMemPool(ur_context_handle_t hContext,
+                                umf_memory_pool_handle_t Pool,
+                                ur_device_handle_t hDevice, size_t Size) {
+  hContext->freeDeferredBuffers(/*Wait=*/false);
+
+  int Alignment = 1;
+  for (auto Device : hContext->getDevices()) {
+    if (!hDevice || Device == hDevice) {
+      Alignment = std::max(
+          Alignment,
+          getAttribute(Device, CU_DEVICE_ATTRIBUTE_TEXTURE_ALIGNMENT));
+    }
+  }
+  void *Ptr = umfPoolAlignedMalloc(Pool, Size, Alignment);
+  if (Ptr == nullptr) {
+    throw umf::umf2urResult(umfPoolGetLastAllocationError(Pool));
+  }
+  return Ptr;
+}
+} // namespace
 
 /// Creates a UR Memory object using a CUDA memory allocation.
 /// Can trigger a manual copy depending on the mode.
@@ -48,7 +75,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
           cuMemHostRegister(HostPtr, size, CU_MEMHOSTREGISTER_DEVICEMAP));
       AllocMode = BufferMem::AllocMode::UseHostPtr;
     } else if (flags & UR_MEM_FLAG_ALLOC_HOST_POINTER) {
-      UR_CHECK_ERROR(cuMemAllocHost(&HostPtr, size));
+      if (auto Pool = hContext->getBufferMemPool(nullptr)) {
+        HostPtr = allocateFromBufferMemPool(hContext, Pool, nullptr, size);
+      } else {
+        UR_CHECK_ERROR(cuMemAllocHost(&HostPtr, size));
+        hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                           size);
+      }
       AllocMode = BufferMem::AllocMode::AllocHostPtr;
     } else if (flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER) {
       AllocMode = BufferMem::AllocMode::CopyIn;
@@ -392,15 +425,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferPartition(
   UR_ASSERT(((pRegion->origin + pRegion->size) <= BufferImpl.getSize()),
             UR_RESULT_ERROR_INVALID_BUFFER_SIZE);
 
+  // The sub-buffer resolves its pointers from the parent's allocations on
+  // use, so nothing is allocated or locked here
   std::unique_ptr<ur_mem_handle_t_> RetMemObj{nullptr};
   try {
-    for (auto Device : hBuffer->Context->getDevices()) {
-      BufferImpl.getPtr(
-          Device); // This is allocating a dev ptr behind the scenes
-                   // which is necessary before SubBuffer partition
-    }
     RetMemObj = std::unique_ptr<ur_mem_handle_t_>{
-        new ur_mem_handle_t_{hBuffer, pRegion->origin}};
+        new ur_mem_handle_t_{hBuffer, pRegion->origin, pRegion->size}};
   } catch (ur_result_t Err) {
     *phMem = nullptr;
     return Err;
@@ -435,8 +465,14 @@ ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
       UR_CHECK_ERROR(cuMemHostRegister(Buffer.HostPtr, Buffer.Size,
                                        CU_MEMHOSTALLOC_DEVICEMAP));
       UR_CHECK_ERROR(cuMemHostGetDevicePointer(&DevPtr, Buffer.HostPtr, 0));
+    } else if (auto Pool = Mem->getContext()->getBufferMemPool(hDevice)) {
+      DevPtr = reinterpret_cast<CUdeviceptr>(
+          allocateFromBufferMemPool(Mem->getContext(), Pool, hDevice,
+                                    Buffer.Size));
     } else {
       UR_CHECK_ERROR(cuMemAlloc(&DevPtr, Buffer.Size));
+      Mem->getContext()->MemoryAccounting.onAlloc(
+          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Buffer.Size);
     }
   } else {
     CUarray ImageArray{};
@@ -449,6 +485,8 @@ ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
       }
       UR_CHECK_ERROR(cuArray3DCreate(&ImageArray, &Image.ArrayDesc));
       Image.Arrays[DeviceIdx] = ImageArray;
+      Mem->getContext()->MemoryAccounting.onAlloc(
+          UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE, Image.getArraySize());
 
       // CUDA_RESOURCE_DESC is a union of different structs, shown here
       // https://docs.nvidia.com/cuda/cuda-driver-api/group__CUDA__TEXOBJECT.html
@@ -480,6 +518,39 @@ ur_result_t allocateMemObjOnDeviceIfNeeded(ur_mem_handle_t Mem,
 }
 
 namespace {
+// Migrations of this size or more between devices without peer access are
+// routed through a device with peer access to both, as copies without it go
+// through the host
+constexpr size_t MinRoutedMigrationSize = 1 << 20;
+
+// Finds a device of the context to migrate Mem from hSrcDevice to hDstDevice
+// through, which already has an allocation of Mem to stage the copy in
+ur_device_handle_t findMigrationRoute(ur_mem_handle_t Mem,
+                                      ur_device_handle_t hSrcDevice,
+                                      ur_device_handle_t hDstDevice) {
+  auto &Buffer = std::get<BufferMem>(Mem->Mem);
+  const auto &Devices = Mem->getContext()->getDevices();
+  auto FindDevice = [&](size_t Index) -> ur_device_handle_t {
+    for (auto hDevice : Devices) {
+      if (hDevice->getIndex() == Index) {
+        return hDevice;
+      }
+    }
+    return nullptr;
+  };
+  size_t Via;
+  if (!hSrcDevice->getPlatform()->getPeerTopology().findRoute(
+          hSrcDevice->getIndex(), hDstDevice->getIndex(),
+          [&](size_t Index) {
+            auto hDevice = FindDevice(Index);
+            return hDevice && Buffer.isAllocatedOn(hDevice);
+          },
+          Via)) {
+    return nullptr;
+  }
+  return FindDevice(Via);
+}
+
 ur_result_t enqueueMigrateBufferToDevice(ur_mem_handle_t Mem,
                                          ur_device_handle_t hDevice,
                                          CUstream Stream) {
@@ -491,10 +562,25 @@ ur_result_t enqueueMigrateBufferToDevice(ur_mem_handle_t Mem,
                                        Buffer.Size, Stream));
     }
   } else if (Mem->LastQueueWritingToMemObj->getDevice() != hDevice) {
-    UR_CHECK_ERROR(cuMemcpyDtoDAsync(
-        Buffer.getPtr(hDevice),
-        Buffer.getPtr(Mem->LastQueueWritingToMemObj->getDevice()), Buffer.Size,
-        Stream));
+    ur_device_handle_t hSrcDevice = Mem->LastQueueWritingToMemObj->getDevice();
+    ur_device_handle_t hViaDevice = nullptr;
+    if (Buffer.Size >= MinRoutedMigrationSize &&
+        (Buffer.MemAllocMode == BufferMem::AllocMode::Classic ||
+         Buffer.MemAllocMode == BufferMem::AllocMode::CopyIn)) {
+      hViaDevice = findMigrationRoute(Mem, hSrcDevice, hDevice);
+    }
+    if (hViaDevice) {
+      UR_CHECK_ERROR(cuMemcpyDtoDAsync(Buffer.getPtr(hViaDevice),
+                                       Buffer.getPtr(hSrcDevice), Buffer.Size,
+                                       Stream));
+      UR_CHECK_ERROR(cuMemcpyDtoDAsync(Buffer.getPtr(hDevice),
+                                       Buffer.getPtr(hViaDevice), Buffer.Size,
+                                       Stream));
+    } else {
+      UR_CHECK_ERROR(cuMemcpyDtoDAsync(Buffer.getPtr(hDevice),
+                                       Buffer.getPtr(hSrcDevice), Buffer.Size,
+                                       Stream));
+    }
   }
   return UR_RESULT_SUCCESS;
 }
@@ -598,8 +684,23 @@ ur_result_t enqueueMigrateMemoryToDeviceIfNeeded(
   return UR_RESULT_SUCCESS;
 }
 
+BufferMem::BufferMem(ur_mem_handle_t Parent, ur_mem_handle_t OuterMemStruct,
+                     size_t Offset, size_t Size)
+    : Context{Parent->getContext()}, Parent{Parent},
+      OuterMemStruct{OuterMemStruct}, Size{Size},
+      MemAllocMode{std::get<BufferMem>(Parent->Mem).MemAllocMode},
+      SubBufferOffset{Offset} {
+  void *ParentHostPtr = std::get<BufferMem>(Parent->Mem).HostPtr;
+  HostPtr = ParentHostPtr ? static_cast<char *>(ParentHostPtr) + Offset
+                          : nullptr;
+}
+
 BufferMem::native_type
 BufferMem::getPtrWithOffset(const ur_device_handle_t Device, size_t Offset) {
+  if (Parent) {
+    return std::get<BufferMem>(Parent->Mem)
+        .getPtrWithOffset(Device, SubBufferOffset + Offset);
+  }
   if (ur_result_t Err = allocateMemObjOnDeviceIfNeeded(OuterMemStruct, Device);
       Err != UR_RESULT_SUCCESS) {
     throw Err;
@@ -610,6 +711,15 @@ BufferMem::getPtrWithOffset(const ur_device_handle_t Device, size_t Offset) {
       Offset);
 }
 
+bool BufferMem::isAllocatedOn(const ur_device_handle_t Device) {
+  if (Parent) {
+    return std::get<BufferMem>(Parent->Mem).isAllocatedOn(Device);
+  }
+  ur_lock LockGuard(OuterMemStruct->MemoryAllocationMutex);
+  return Ptrs[OuterMemStruct->getContext()->getDeviceIndex(Device)] !=
+         native_type{0};
+}
+
 CUarray SurfaceMem::getArray(const ur_device_handle_t Device) {
   if (ur_result_t Err = allocateMemObjOnDeviceIfNeeded(OuterMemStruct, Device);
       Err != UR_RESULT_SUCCESS) {
@@ -625,3 +735,45 @@ CUsurfObject SurfaceMem::getSurface(const ur_device_handle_t Device) {
   }
   return SurfObjs[OuterMemStruct->getContext()->getDeviceIndex(Device)];
 }
+
+void ur_mem_handle_t_::recordUse(ur_queue_handle_t hQueue) {
+  if (!isBuffer() || !Context->usesBufferMemPools()) {
+    return;
+  }
+  auto Owner = isSubBuffer() ? std::get<BufferMem>(Mem).Parent : this;
+  if (std::get<BufferMem>(Owner->Mem).MemAllocMode ==
+          BufferMem::AllocMode::UseHostPtr ||
+      Owner->LastUseQueue.load(std::memory_order_relaxed) == hQueue) {
+    return;
+  }
+  std::lock_guard<std::mutex> Lock(Owner->UseQueuesMutex);
+  auto &Queues = Owner->UseQueues;
+  if (std::find(Queues.begin(), Queues.end(), hQueue) == Queues.end()) {
+    urQueueRetain(hQueue);
+    Queues.push_back(hQueue);
+  }
+  Owner->LastUseQueue.store(hQueue, std::memory_order_relaxed);
+}
+
+std::vector<ur_context_handle_t_::device_event_t>
+ur_mem_handle_t_::takeUseEvents() {
+  std::vector<ur_context_handle_t_::device_event_t> Events;
+  std::lock_guard<std::mutex> Lock(UseQueuesMutex);
+  for (auto Queue : UseQueues) {
+    auto Device = Queue->getDevice();
+    ScopedContext Active(Device);
+    Queue->forEachStream([&](CUstream Stream) {
+      // Nothing submitted to an idle stream can still use the buffer
+      if (cuStreamQuery(Stream) == CUDA_SUCCESS) {
+        return;
+      }
+      CUevent Event = Context->acquireNativeEvent(Device, /*Timing=*/false);
+      UR_CHECK_ERROR(cuEventRecord(Event, Stream));
+      Events.emplace_back(Device, Event);
+    });
+    urQueueRelease(Queue);
+  }
+  UseQueues.clear();
+  LastUseQueue.store(nullptr, std::memory_order_relaxed);
+  return Events;
+}
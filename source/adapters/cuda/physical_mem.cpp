@@ -15,26 +15,47 @@
 
 #include <cassert>
 #include <cuda.h>
+#include <utility>
+#include <vector>
+
+namespace {
+void releaseChunks(
+    const std::vector<std::pair<ur_device_handle_t,
+                                CUmemGenericAllocationHandle>> &Chunks) {
+  for (auto &[Device, Chunk] : Chunks) {
+    ScopedContext Active(Device);
+    UR_CHECK_ERROR(cuMemRelease(Chunk));
+  }
+}
+} // namespace
 
 UR_APIEXPORT ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     [[maybe_unused]] const ur_physical_mem_properties_t *pProperties,
     ur_physical_mem_handle_t *phPhysicalMem) {
-  CUmemAllocationProp AllocProps = {};
-  AllocProps.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
-  AllocProps.type = CU_MEM_ALLOCATION_TYPE_PINNED;
-  AllocProps.location.id = hDevice->getIndex();
-
   CUmemGenericAllocationHandle ResHandle;
-  switch (auto Result = cuMemCreate(&ResHandle, size, &AllocProps, 0)) {
-  case CUDA_ERROR_INVALID_VALUE:
-    return UR_RESULT_ERROR_INVALID_SIZE;
-  default:
-    UR_CHECK_ERROR(Result);
+  if (!hContext->PhysicalMemPool.take(hDevice, size, ResHandle)) {
+    CUmemAllocationProp AllocProps = {};
+    AllocProps.location.type = CU_MEM_LOCATION_TYPE_DEVICE;
+    AllocProps.type = CU_MEM_ALLOCATION_TYPE_PINNED;
+    AllocProps.location.id = hDevice->getIndex();
+
+    auto Result = cuMemCreate(&ResHandle, size, &AllocProps, 0);
+    if (Result == CUDA_ERROR_OUT_OF_MEMORY) {
+      // The device may only be short of the memory kept for reuse
+      releaseChunks(hContext->PhysicalMemPool.trim(0));
+      Result = cuMemCreate(&ResHandle, size, &AllocProps, 0);
+    }
+    switch (Result) {
+    case CUDA_ERROR_INVALID_VALUE:
+      return UR_RESULT_ERROR_INVALID_SIZE;
+    default:
+      UR_CHECK_ERROR(Result);
+    }
   }
   try {
     *phPhysicalMem =
-        new ur_physical_mem_handle_t_(ResHandle, hContext, hDevice);
+        new ur_physical_mem_handle_t_(ResHandle, hContext, hDevice, size);
   } catch (std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -57,8 +78,9 @@ urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
   try {
     std::unique_ptr<ur_physical_mem_handle_t_> PhysicalMemGuard(hPhysicalMem);
 
-    ScopedContext Active(hPhysicalMem->getDevice());
-    UR_CHECK_ERROR(cuMemRelease(hPhysicalMem->get()));
+    releaseChunks(hPhysicalMem->getContext()->PhysicalMemPool.put(
+        hPhysicalMem->getDevice(), hPhysicalMem->getSize(),
+        hPhysicalMem->get()));
   } catch (ur_result_t err) {
     return err;
   } catch (...) {
@@ -27,10 +27,12 @@ struct ur_physical_mem_handle_t_ {
   native_type PhysicalMem;
   ur_context_handle_t_ *Context;
   ur_device_handle_t Device;
+  size_t Size;
 
   ur_physical_mem_handle_t_(native_type PhysMem, ur_context_handle_t_ *Ctx,
-                            ur_device_handle_t Device)
-      : RefCount(1), PhysicalMem(PhysMem), Context(Ctx), Device(Device) {
+                            ur_device_handle_t Device, size_t Size)
+      : RefCount(1), PhysicalMem(PhysMem), Context(Ctx), Device(Device),
+        Size(Size) {
     urContextRetain(Context);
     urDeviceRetain(Device);
   }
@@ -46,6 +48,8 @@ struct ur_physical_mem_handle_t_ {
 
   ur_device_handle_t_ *getDevice() const noexcept { return Device; }
 
+  size_t getSize() const noexcept { return Size; }
+
   uint32_t incrementReferenceCount() noexcept { return ++RefCount; }
 
   uint32_t decrementReferenceCount() noexcept { return --RefCount; }
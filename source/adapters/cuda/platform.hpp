@@ -10,8 +10,15 @@
 #pragma once
 
 #include <ur/ur.hpp>
+#include <ur_peer_topology.hpp>
 #include <vector>
 
 struct ur_platform_handle_t_ {
   std::vector<std::unique_ptr<ur_device_handle_t_>> Devices;
+
+  /// Peer links between the devices, queried on first use
+  ur::peer_topology &getPeerTopology();
+
+private:
+  ur::peer_topology PeerTopology;
 };
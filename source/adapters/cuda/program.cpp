@@ -9,6 +9,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "program.hpp"
+#include "program_cache.hpp"
+#include "queue.hpp"
 #include "ur_util.hpp"
 
 #include <algorithm>
@@ -17,6 +19,7 @@
 #include <cstring>
 #include <memory>
 #include <new>
+#include <optional>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -113,6 +116,72 @@ ur_result_t ur_program_handle_t_::setBinary(const char *Source, size_t Length) {
   return UR_RESULT_SUCCESS;
 }
 
+namespace {
+// Returns the JIT input type of Binary, or nothing for a cubin, which is
+// loaded without compilation
+std::optional<CUjitInputType> getJitInputType(const char *Binary,
+                                              size_t Size) {
+  constexpr uint32_t FatbinMagic = 0xBA55ED50;
+  if (Size >= 4 && std::memcmp(Binary, "\x7f" "ELF", 4) == 0) {
+    return std::nullopt;
+  }
+  uint32_t Magic = 0;
+  if (Size >= sizeof(Magic)) {
+    std::memcpy(&Magic, Binary, sizeof(Magic));
+  }
+  return Magic == FatbinMagic ? CU_JIT_INPUT_FATBINARY : CU_JIT_INPUT_PTX;
+}
+} // namespace
+
+// Compiles the program with a link of its binary alone, which returns the
+// cubin the driver would otherwise compile and throw away in
+// cuModuleLoadDataEx. The cubin is shared with the programs of the context
+// built from the same binary for identical devices, which load it instead of
+// compiling it again, and kept in the program cache if there is one.
+void ur_program_handle_t_::buildProgramCached(
+    ProgramCache *Cache, CUjitInputType InputType,
+    const std::string &JitOptions, std::vector<CUjit_option> &Options,
+    std::vector<void *> &OptionVals) {
+  auto Key = ProgramCache::makeKey(Device, Binary, BinarySizeInBytes,
+                                   JitOptions);
+  Cubin = Context->findCubin(Key);
+  if (!Cubin && Cache) {
+    if (auto Stored = Cache->load(Key)) {
+      Cubin = std::make_shared<const std::vector<char>>(std::move(*Stored));
+      Context->addCubin(Key, Cubin);
+    }
+  }
+  if (Cubin) {
+    UR_CHECK_ERROR(cuModuleLoadDataEx(&Module, Cubin->data(), Options.size(),
+                                      Options.data(), OptionVals.data()));
+    return;
+  }
+
+  CUlinkState State;
+  UR_CHECK_ERROR(
+      cuLinkCreate(Options.size(), Options.data(), OptionVals.data(), &State));
+  try {
+    UR_CHECK_ERROR(cuLinkAddData(State, InputType, const_cast<char *>(Binary),
+                                 BinarySizeInBytes, nullptr, 0, nullptr,
+                                 nullptr));
+    void *LinkedCubin = nullptr;
+    size_t CubinSize = 0;
+    UR_CHECK_ERROR(cuLinkComplete(State, &LinkedCubin, &CubinSize));
+    UR_CHECK_ERROR(
+        cuModuleLoadDataEx(&Module, LinkedCubin, 0, nullptr, nullptr));
+    auto Bytes = static_cast<const char *>(LinkedCubin);
+    Cubin = std::make_shared<const std::vector<char>>(Bytes, Bytes + CubinSize);
+    Context->addCubin(Key, Cubin);
+    if (Cache) {
+      Cache->store(Key, Bytes, CubinSize);
+    }
+  } catch (...) {
+    cuLinkDestroy(State);
+    throw;
+  }
+  UR_CHECK_ERROR(cuLinkDestroy(State));
+}
+
 ur_result_t ur_program_handle_t_::buildProgram(const char *BuildOptions) {
   if (BuildOptions) {
     this->BuildOptions = BuildOptions;
@@ -136,6 +205,8 @@ ur_result_t ur_program_handle_t_::buildProgram(const char *BuildOptions) {
   Options[3] = CU_JIT_ERROR_LOG_BUFFER_SIZE_BYTES;
   OptionVals[3] = (void *)(long)MaxLogSize;
 
+  // The JIT options changing the generated code, which key the program cache
+  std::string JitOptions;
   if (!this->BuildOptions.empty()) {
     unsigned int MaxRegs;
     const bool Valid =
@@ -144,12 +215,20 @@ ur_result_t ur_program_handle_t_::buildProgram(const char *BuildOptions) {
       Options.push_back(CU_JIT_MAX_REGISTERS);
       OptionVals.push_back(
           reinterpret_cast<void *>(static_cast<std::uintptr_t>(MaxRegs)));
+      JitOptions = "maxrregcount=" + std::to_string(MaxRegs);
     }
   }
 
-  UR_CHECK_ERROR(cuModuleLoadDataEx(&Module, static_cast<const void *>(Binary),
-                                    Options.size(), Options.data(),
-                                    OptionVals.data()));
+  auto InputType = getJitInputType(Binary, BinarySizeInBytes);
+  if (InputType) {
+    buildProgramCached(ProgramCache::get(), *InputType, JitOptions, Options,
+                       OptionVals);
+  } else {
+    UR_CHECK_ERROR(cuModuleLoadDataEx(&Module,
+                                      static_cast<const void *>(Binary),
+                                      Options.size(), Options.data(),
+                                      OptionVals.data()));
+  }
 
   BuildStatus = UR_PROGRAM_BUILD_STATUS_SUCCESS;
 
@@ -161,18 +240,30 @@ ur_result_t ur_program_handle_t_::getGlobalVariablePointer(
     const char *name, CUdeviceptr *DeviceGlobal, size_t *DeviceGlobalSize) {
   /* Since CUDA requires a global variable to be referenced by name, we use
    * metadata to find the correct name to access it by. */
-  auto DeviceGlobalNameIt = this->GlobalIDMD.find(name);
-  if (DeviceGlobalNameIt == this->GlobalIDMD.end())
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  std::string DeviceGlobalName = DeviceGlobalNameIt->second;
-
-  try {
-    UR_CHECK_ERROR(cuModuleGetGlobal(DeviceGlobal, DeviceGlobalSize,
-                                     this->get(), DeviceGlobalName.c_str()));
-  } catch (ur_result_t Err) {
-    return Err;
+  std::lock_guard<std::mutex> Lock(GlobalVariablesMutex);
+  auto CachedIt = GlobalVariables.find(name);
+  if (CachedIt == GlobalVariables.end()) {
+    auto DeviceGlobalNameIt = this->GlobalIDMD.find(name);
+    if (DeviceGlobalNameIt == this->GlobalIDMD.end())
+      return UR_RESULT_ERROR_INVALID_VALUE;
+
+    CUdeviceptr Ptr{};
+    size_t Size = 0;
+    try {
+      UR_CHECK_ERROR(cuModuleGetGlobal(&Ptr, &Size, this->get(),
+                                       DeviceGlobalNameIt->second.c_str()));
+      CachedIt = GlobalVariables.emplace(name, std::make_pair(Ptr, Size)).first;
+    } catch (ur_result_t Err) {
+      return Err;
+    } catch (std::bad_alloc &) {
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
   }
 
+  if (DeviceGlobal)
+    *DeviceGlobal = CachedIt->second.first;
+  if (DeviceGlobalSize)
+    *DeviceGlobalSize = CachedIt->second.second;
   return UR_RESULT_SUCCESS;
 }
 
@@ -287,6 +378,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t hContext,
   return Result;
 }
 
+/// cuModuleLoadDataEx blocks until the module is loaded and can't be called from a
+/// host function of the stream, so the program can't be built in the
+/// background, and urProgramBuild is to be used instead.
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(ur_program_handle_t, ur_queue_handle_t, const char *,
+                       ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
     ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
     const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
@@ -13,10 +13,16 @@
 #include <ur_api.h>
 
 #include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "context.hpp"
 
+class ProgramCache;
+
 struct ur_program_handle_t_ {
   using native_type = CUmodule;
   native_type Module;
@@ -40,6 +46,16 @@ struct ur_program_handle_t_ {
       KernelMaxWorkGroupSizeMD;
   std::unordered_map<std::string, uint64_t> KernelMaxLinearWorkGroupSizeMD;
 
+  // Addresses and sizes of the device globals looked up so far, by the names
+  // they are enqueued with, as they don't move for the lifetime of the module.
+  std::unordered_map<std::string, std::pair<CUdeviceptr, size_t>>
+      GlobalVariables;
+  std::mutex GlobalVariablesMutex;
+
+  // The cubin JIT compiled from Binary, shared with the programs of the
+  // context built from it for devices of the same compute capability
+  std::shared_ptr<const std::vector<char>> Cubin;
+
   constexpr static size_t MaxLogSize = 8192u;
 
   char ErrorLog[MaxLogSize], InfoLog[MaxLogSize];
@@ -64,6 +80,10 @@ struct ur_program_handle_t_ {
   ur_result_t setBinary(const char *Binary, size_t BinarySizeInBytes);
 
   ur_result_t buildProgram(const char *BuildOptions);
+  void buildProgramCached(ProgramCache *Cache, CUjitInputType InputType,
+                          const std::string &JitOptions,
+                          std::vector<CUjit_option> &Options,
+                          std::vector<void *> &OptionVals);
   ur_context_handle_t getContext() const { return Context; };
   ur_device_handle_t getDevice() const noexcept { return Device; };
 
@@ -0,0 +1,56 @@
+//===--------- program_cache.cpp - CUDA Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <memory>
+#include <sstream>
+
+#include <cuda.h>
+
+#include "common.hpp"
+#include "device.hpp"
+#include "program_cache.hpp"
+#include "ur_util.hpp"
+
+namespace {
+
+constexpr const char *CacheMagic = "ur-cuda-program-cache-v1";
+
+} // namespace
+
+ProgramCache::ProgramCache(filesystem::path Dir)
+    : Files(std::move(Dir), CacheMagic, ".cubin") {}
+
+ProgramCache *ProgramCache::get() {
+  static std::unique_ptr<ProgramCache> Cache =
+      []() -> std::unique_ptr<ProgramCache> {
+    auto Dir = ur_getenv("UR_CUDA_PROGRAM_CACHE_DIR");
+    if (!Dir || Dir->empty())
+      return nullptr;
+    return std::make_unique<ProgramCache>(filesystem::path(*Dir));
+  }();
+  return Cache.get();
+}
+
+std::string ProgramCache::makeKey(ur_device_handle_t Device,
+                                  const char *Binary, size_t BinarySize,
+                                  const std::string &JitOptions) {
+  int DriverVersion = 0;
+  UR_CHECK_ERROR(cuDriverGetVersion(&DriverVersion));
+  int Major = 0, Minor = 0;
+  UR_CHECK_ERROR(cuDeviceGetAttribute(
+      &Major, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MAJOR, Device->get()));
+  UR_CHECK_ERROR(cuDeviceGetAttribute(
+      &Minor, CU_DEVICE_ATTRIBUTE_COMPUTE_CAPABILITY_MINOR, Device->get()));
+
+  std::ostringstream Key;
+  Key << DriverVersion << ";sm_" << Major << Minor << ';' << BinarySize << ':'
+      << std::hex << ur::hashBytes(Binary, BinarySize) << ';' << JitOptions;
+  return Key.str();
+}
@@ -0,0 +1,52 @@
+//===--------- program_cache.hpp - CUDA Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "ur_binary_file_cache.hpp"
+
+// On-disk cache of the cubins JIT compiled from the PTX of programs, enabled
+// by pointing UR_CUDA_PROGRAM_CACHE_DIR at a directory. A cubin is keyed by
+// all its compilation depends on: the PTX, the JIT options, the compute
+// capability of the device and the driver version. The key is stored along
+// with the cubin, so that a hash collision can't load the wrong one.
+class ProgramCache {
+public:
+  explicit ProgramCache(filesystem::path Dir);
+
+  // Returns the cache selected by UR_CUDA_PROGRAM_CACHE_DIR, or nullptr
+  static ProgramCache *get();
+
+  // Describes the JIT compilation of Binary with the given JIT options, which
+  // are only the ones changing the generated code, for Device
+  static std::string makeKey(ur_device_handle_t Device, const char *Binary,
+                             size_t BinarySize, const std::string &JitOptions);
+
+  // Returns the cubin stored for Key, if any
+  std::optional<std::vector<char>> load(const std::string &Key) const {
+    return Files.load<char>(Key);
+  }
+
+  // Stores Cubin for Key. Concurrent stores of the same key don't see
+  // partial files.
+  void store(const std::string &Key, const char *Cubin,
+             size_t CubinSize) const {
+    Files.store(Key, Cubin, CubinSize);
+  }
+
+private:
+  ur::binary_file_cache Files;
+};
@@ -9,9 +9,12 @@
 //===----------------------------------------------------------------------===//
 
 #include "queue.hpp"
+#include "command_buffer.hpp"
 #include "common.hpp"
 #include "context.hpp"
+#include "enqueue.hpp"
 #include "event.hpp"
+#include "ur_perf_counters.hpp"
 
 #include <cassert>
 #include <cuda.h>
@@ -33,14 +36,31 @@ void ur_queue_handle_t_::transferStreamWaitForBarrierIfNeeded(
 }
 
 CUstream ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
+  waitForSubmissionThread();
+  return recordSubmission(pickComputeStream(StreamToken));
+}
+
+CUstream ur_queue_handle_t_::pickComputeStream(uint32_t *StreamToken) {
+  // Number of busy streams skipped at most to find an idle one
+  constexpr unsigned int MaxBusyStreamProbes = 4;
+
   if (getThreadLocalStream() != CUstream{0})
     return getThreadLocalStream();
+  // The commands of a capture are kept on its stream, in the order they are
+  // enqueued
+  if (CUstream Stream = CaptureStream) {
+    if (StreamToken) {
+      *StreamToken = std::numeric_limits<uint32_t>::max();
+    }
+    return Stream;
+  }
   uint32_t StreamI;
   uint32_t Token;
+  unsigned int BusyStreamProbes = 0;
   while (true) {
     if (NumComputeStreams < ComputeStreams.size()) {
       // the check above is for performance - so as not to lock mutex every time
-      std::lock_guard<std::mutex> guard(ComputeStreamMutex);
+      std::lock_guard<ur_mutex> guard(ComputeStreamMutex);
       // The second check is done after mutex is locked so other threads can not
       // change NumComputeStreams after that
       if (NumComputeStreams < ComputeStreams.size()) {
@@ -56,10 +76,21 @@ CUstream ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
     // that is more likely to have completed all the enqueued work.
     if (DelayCompute[StreamI]) {
       DelayCompute[StreamI] = false;
-    } else {
-      break;
+      continue;
+    }
+    // Once all the streams are created, independent work goes to a stream
+    // that has completed its work if one is found within a few streams,
+    // rather than waiting behind the work of a busy one
+    if (ComputeStreams.size() > 1 &&
+        NumComputeStreams == ComputeStreams.size() &&
+        BusyStreamProbes < MaxBusyStreamProbes &&
+        cuStreamQuery(ComputeStreams[StreamI]) == CUDA_ERROR_NOT_READY) {
+      ++BusyStreamProbes;
+      continue;
     }
+    break;
   }
+  ComputeStreamLastToken[StreamI].store(Token, std::memory_order_relaxed);
   if (StreamToken) {
     *StreamToken = Token;
   }
@@ -68,17 +99,27 @@ CUstream ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
   return res;
 }
 
+// Commands with a wait list, which either run on the stream of an event they
+// wait on or need another stream
+static ur::perf_counter StreamReuseHits{"stream_reuse.hits"};
+static ur::perf_counter StreamReuseMisses{"stream_reuse.misses"};
+
 CUstream ur_queue_handle_t_::getNextComputeStream(
     uint32_t NumEventsInWaitList, const ur_event_handle_t *EventWaitList,
     ur_stream_guard_ &Guard, uint32_t *StreamToken) {
   if (getThreadLocalStream() != CUstream{0})
-    return getThreadLocalStream();
+    return recordSubmission(getThreadLocalStream());
+  waitForSubmissionThread();
   for (uint32_t i = 0; i < NumEventsInWaitList; i++) {
+    // The streams of the events of other queues may still be set by their
+    // submission threads
+    if (reinterpret_cast<ur_queue_handle_t>(EventWaitList[i]->getQueue()) !=
+        this) {
+      continue;
+    }
     uint32_t Token = EventWaitList[i]->getComputeStreamToken();
-    if (reinterpret_cast<ur_queue_handle_t>(EventWaitList[i]->getQueue()) ==
-            this &&
-        canReuseStream(Token)) {
-      std::unique_lock<std::mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
+    if (canReuseStream(Token)) {
+      std::unique_lock<ur_mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
       // redo the check after lock to avoid data races on
       // LastSyncComputeStreams
       if (canReuseStream(Token)) {
@@ -88,25 +129,32 @@ CUstream ur_queue_handle_t_::getNextComputeStream(
           *StreamToken = Token;
         }
         Guard = ur_stream_guard_{std::move(ComputeSyncGuard)};
+        StreamReuseHits.add();
         CUstream Result = EventWaitList[i]->getStream();
         computeStreamWaitForBarrierIfNeeded(Result, StreamI);
-        return Result;
+        return recordSubmission(Result);
       }
     }
   }
+  if (NumEventsInWaitList) {
+    StreamReuseMisses.add();
+  }
   Guard = {};
   return getNextComputeStream(StreamToken);
 }
 
 CUstream ur_queue_handle_t_::getNextTransferStream() {
   if (getThreadLocalStream() != CUstream{0})
-    return getThreadLocalStream();
-  if (TransferStreams.empty()) { // for example in in-order queue
+    return recordSubmission(getThreadLocalStream());
+  waitForSubmissionThread();
+  // The transfers of a capture go to its stream as well, and queues without
+  // transfer streams, in-order ones for example, use their compute streams
+  if (isCapturing() || TransferStreams.empty()) {
     return getNextComputeStream();
   }
   if (NumTransferStreams < TransferStreams.size()) {
     // the check above is for performance - so as not to lock mutex every time
-    std::lock_guard<std::mutex> Guuard(TransferStreamMutex);
+    std::lock_guard<ur_mutex> Guuard(TransferStreamMutex);
     // The second check is done after mutex is locked so other threads can not
     // change NumTransferStreams after that
     if (NumTransferStreams < TransferStreams.size()) {
@@ -118,7 +166,7 @@ CUstream ur_queue_handle_t_::getNextTransferStream() {
   uint32_t StreamI = TransferStreamIndex++ % TransferStreams.size();
   CUstream Result = TransferStreams[StreamI];
   transferStreamWaitForBarrierIfNeeded(Result, StreamI);
-  return Result;
+  return recordSubmission(Result);
 }
 
 /// Creates a `ur_queue_handle_t` object on the CUDA backend.
@@ -171,6 +219,15 @@ urQueueCreate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
         std::move(ComputeCuStreams), std::move(TransferCuStreams), hContext,
         hDevice, Flags, URFlags, Priority});
 
+    if (URFlags & UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP) {
+      Queue->Submitter =
+          std::make_unique<ur::submission_thread<ur_queued_launch_>>(
+              ur_queue_handle_t_::SubmissionThreadCapacity,
+              [Q = Queue.get()](ur_queued_launch_ &Launch) {
+                submitQueuedLaunch(Q, Launch);
+              });
+    }
+
     *phQueue = Queue.release();
 
     return UR_RESULT_SUCCESS;
@@ -223,12 +280,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
   ur_result_t Result = UR_RESULT_SUCCESS;
+  ur::queue_stats::finish_scope Finish(hQueue->Stats);
 
   try {
     ScopedContext active(hQueue->getDevice());
 
     hQueue->syncStreams</*ResetUsed=*/true>(
-        [](CUstream s) { UR_CHECK_ERROR(cuStreamSynchronize(s)); });
+        [](CUstream s) { UR_CHECK_ERROR(hostSynchronize(s)); });
+    Finish.finished();
+
+    // Errors of the launches submitted by the submission thread are reported
+    // once
+    Result = hQueue->SubmissionError.exchange(UR_RESULT_SUCCESS);
 
   } catch (ur_result_t Err) {
 
@@ -329,6 +392,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
         UR_CHECK_ERROR(Ret);
         return false;
       });
+      if (IsReady) {
+        hQueue->Stats.onIdle();
+      }
       return ReturnValue(IsReady);
     } catch (ur_result_t Err) {
       return Err;
@@ -336,6 +402,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
       return UR_RESULT_ERROR_OUT_OF_RESOURCES;
     }
   }
+  case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+  case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+  case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+  case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+    return ur::queue_stats::getInfo(hQueue->Stats.snapshot(), propName,
+                                    ReturnValue);
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
   case UR_QUEUE_INFO_SIZE:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
@@ -343,3 +417,76 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueBeginCaptureExp(ur_queue_handle_t hQueue) {
+  if (hQueue->isCapturing()) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  // The commands enqueued before the capture are neither part of it nor
+  // waited on by it
+  ur_result_t Result = urQueueFinish(hQueue);
+  if (Result != UR_RESULT_SUCCESS) {
+    return Result;
+  }
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    CUstream Stream = hQueue->getNextComputeStream();
+    // Relaxed, so that the calls made for other queues meanwhile, unsafe
+    // during a capture in the other modes, don't invalidate it
+    UR_CHECK_ERROR(
+        cuStreamBeginCapture(Stream, CU_STREAM_CAPTURE_MODE_RELAXED));
+    hQueue->CaptureStream = Stream;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t hQueue, ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  CUstream Stream = hQueue->CaptureStream.exchange(nullptr);
+  if (!Stream) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  try {
+    ScopedContext Active(hQueue->getDevice());
+    CUgraph Graph = nullptr;
+    CUresult Err = cuStreamEndCapture(Stream, &Graph);
+    if (Err == CUDA_ERROR_STREAM_CAPTURE_INVALIDATED ||
+        Err == CUDA_ERROR_STREAM_CAPTURE_UNJOINED) {
+      if (Graph) {
+        UR_CHECK_ERROR(cuGraphDestroy(Graph));
+      }
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    UR_CHECK_ERROR(Err);
+
+    ur_exp_command_buffer_handle_t CommandBuffer;
+    try {
+      CommandBuffer = new ur_exp_command_buffer_handle_t_(
+          hQueue->getContext(), hQueue->getDevice(), /*IsUpdatable=*/false);
+    } catch (const std::bad_alloc &) {
+      UR_CHECK_ERROR(cuGraphDestroy(Graph));
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CommandBuffer->CudaGraph = Graph;
+
+    ur_result_t Result = urCommandBufferFinalizeExp(CommandBuffer);
+    if (Result != UR_RESULT_SUCCESS) {
+      urCommandBufferReleaseExp(CommandBuffer);
+      return Result;
+    }
+    *phCommandBuffer = CommandBuffer;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
@@ -11,13 +11,33 @@
 
 #include "common.hpp"
 #include <ur/ur.hpp>
+#include "ur_queue_stats.hpp"
+#include "ur_submission_thread.hpp"
 
 #include <algorithm>
+#include <atomic>
 #include <cuda.h>
+#include <memory>
 #include <mutex>
 #include <vector>
 
-using ur_stream_guard_ = std::unique_lock<std::mutex>;
+using ur_stream_guard_ = std::unique_lock<ur_mutex>;
+
+/// Kernel launch handed over to the submission thread of a queue, see
+/// UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP. It holds references on the queue, the
+/// kernel and the events it waits on and signals, and a copy of the arguments
+/// of the kernel, which ArgPointers point into.
+struct ur_queued_launch_ {
+  ur_kernel_handle_t Kernel = nullptr;
+  CUfunction Func = nullptr;
+  size_t ThreadsPerBlock[3] = {1u, 1u, 1u};
+  size_t BlocksPerGrid[3] = {1u, 1u, 1u};
+  uint32_t LocalSize = 0;
+  std::vector<char> ArgStorage;
+  std::vector<void *> ArgPointers;
+  std::vector<ur_event_handle_t> WaitList;
+  ur_event_handle_t Event = nullptr;
+};
 
 /// UR queue mapping on to CUstream objects.
 ///
@@ -26,6 +46,7 @@ struct ur_queue_handle_t_ {
   using native_type = CUstream;
   static constexpr int DefaultNumComputeStreams = 128;
   static constexpr int DefaultNumTransferStreams = 64;
+  static constexpr size_t SubmissionThreadCapacity = 256;
 
   std::vector<native_type> ComputeStreams;
   std::vector<native_type> TransferStreams;
@@ -38,6 +59,10 @@ struct ur_queue_handle_t_ {
   // will be skipped the next time it would be selected round-robin style. When
   // skipped, its delay flag is cleared.
   std::vector<bool> DelayCompute;
+  // Token of the last command given each compute stream, so a command can be
+  // put on the stream of its dependency only when nothing else was put there
+  // in between. Atomic as it is read without ComputeStreamMutex.
+  std::vector<std::atomic<uint32_t>> ComputeStreamLastToken;
   // keep track of which streams have applied barrier
   std::vector<bool> ComputeAppliedBarrier;
   std::vector<bool> TransferAppliedBarrier;
@@ -58,12 +83,27 @@ struct ur_queue_handle_t_ {
   int Priority;
   // When ComputeStreamSyncMutex and ComputeStreamMutex both need to be
   // locked at the same time, ComputeStreamSyncMutex should be locked first
-  // to avoid deadlocks
-  std::mutex ComputeStreamSyncMutex;
-  std::mutex ComputeStreamMutex;
-  std::mutex TransferStreamMutex;
-  std::mutex BarrierMutex;
+  // to avoid deadlocks. None of them are locked for queues created with
+  // UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP.
+  ur_mutex ComputeStreamSyncMutex;
+  ur_mutex ComputeStreamMutex;
+  ur_mutex TransferStreamMutex;
+  ur_mutex BarrierMutex;
   bool HasOwnership;
+  // Every command gets a stream of its own, so each is a submission
+  ur::queue_stats Stats;
+  std::atomic<native_type> LastStream{nullptr};
+  // Stream all the commands go to while the queue is capturing, null when it
+  // isn't
+  std::atomic<native_type> CaptureStream{nullptr};
+  // Thread submitting the kernel launches of a queue created with
+  // UR_QUEUE_FLAG_SUBMISSION_THREAD_EXP, null for other queues. Pushes to it
+  // are serialized by SubmitterMutex.
+  std::unique_ptr<ur::submission_thread<ur_queued_launch_>> Submitter;
+  ur_mutex SubmitterMutex;
+  // First error met by the submission thread, which the next urQueueFinish
+  // returns
+  std::atomic<ur_result_t> SubmissionError{UR_RESULT_SUCCESS};
 
   ur_queue_handle_t_(std::vector<CUstream> &&ComputeStreams,
                      std::vector<CUstream> &&TransferStreams,
@@ -73,26 +113,60 @@ struct ur_queue_handle_t_ {
       : ComputeStreams{std::move(ComputeStreams)}, TransferStreams{std::move(
                                                        TransferStreams)},
         DelayCompute(this->ComputeStreams.size(), false),
+        ComputeStreamLastToken(this->ComputeStreams.size()),
         ComputeAppliedBarrier(this->ComputeStreams.size()),
         TransferAppliedBarrier(this->TransferStreams.size()), Context{Context},
         Device{Device}, RefCount{1}, EventCount{0}, ComputeStreamIndex{0},
         TransferStreamIndex{0}, NumComputeStreams{0}, NumTransferStreams{0},
         LastSyncComputeStreams{0}, LastSyncTransferStreams{0}, Flags(Flags),
         URFlags(URFlags), Priority(Priority), HasOwnership{BackendOwns} {
+    if (URFlags & UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP) {
+      ComputeStreamSyncMutex.setSingleThreaded();
+      ComputeStreamMutex.setSingleThreaded();
+      TransferStreamMutex.setSingleThreaded();
+      BarrierMutex.setSingleThreaded();
+      SubmitterMutex.setSingleThreaded();
+    }
     urContextRetain(Context);
     urDeviceRetain(Device);
   }
 
   ~ur_queue_handle_t_() {
+    Submitter.reset();
     urContextRelease(Context);
     urDeviceRelease(Device);
   }
 
+  // Commands submitted from the calling thread first wait for the submission
+  // thread to have submitted the ones enqueued before them, so that they
+  // reach the driver in order. The streams and their bookkeeping are then not
+  // used by the submission thread.
+  void waitForSubmissionThread() const noexcept {
+    if (Submitter && !Submitter->onThread()) {
+      Submitter->drain();
+    }
+  }
+
   void computeStreamWaitForBarrierIfNeeded(CUstream Strean, uint32_t StreamI);
   void transferStreamWaitForBarrierIfNeeded(CUstream Stream, uint32_t StreamI);
 
+  native_type pickComputeStream(uint32_t *StreamToken);
+
+  // Counts a command put on Stream in Stats
+  native_type recordSubmission(native_type Stream) {
+    Stats.onCommand();
+    Stats.onSubmission();
+    native_type Previous =
+        LastStream.exchange(Stream, std::memory_order_relaxed);
+    if (Previous && Previous != Stream) {
+      Stats.onSwitch();
+    }
+    return Stream;
+  }
+
   // get_next_compute/transfer_stream() functions return streams from
-  // appropriate pools in round-robin fashion
+  // appropriate pools in round-robin fashion, compute streams still busy with
+  // earlier work being skipped for a few idle ones
   native_type getNextComputeStream(uint32_t *StreamToken = nullptr);
   // this overload tries select a stream that was used by one of dependencies.
   // If that is not possible returns a new stream. If a stream is reused it
@@ -110,6 +184,7 @@ struct ur_queue_handle_t_ {
 
   native_type getNextTransferStream();
   native_type get() { return getNextComputeStream(); };
+  bool isCapturing() const noexcept { return CaptureStream != nullptr; }
   ur_device_handle_t getDevice() const noexcept { return Device; };
 
   // Function which creates the profiling stream. Called only from makeNative
@@ -140,9 +215,12 @@ struct ur_queue_handle_t_ {
     // If the command represented by the stream token was not the last command
     // enqueued to the stream we can not reuse the stream - we need to allow for
     // commands enqueued after it and the one we are about to enqueue to run
-    // concurrently
+    // concurrently. Commands reusing the stream keep the token, so a chain of
+    // dependent commands stays on one stream however much other work is
+    // enqueued to the other streams in between.
     bool IsLastCommand =
-        (ComputeStreamIndex - StreamToken) <= ComputeStreams.size();
+        ComputeStreamLastToken[StreamToken % ComputeStreams.size()].load(
+            std::memory_order_relaxed) == StreamToken;
     // If there was a barrier enqueued to the queue after the command
     // represented by the stream token we should not reuse the stream, as we can
     // not take that stream into account for the bookkeeping for the next
@@ -155,15 +233,16 @@ struct ur_queue_handle_t_ {
   }
 
   template <typename T> bool allOf(T &&F) {
+    waitForSubmissionThread();
     {
-      std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
+      std::lock_guard<ur_mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int End = std::min(
           static_cast<unsigned int>(ComputeStreams.size()), NumComputeStreams);
       if (!std::all_of(ComputeStreams.begin(), ComputeStreams.begin() + End, F))
         return false;
     }
     {
-      std::lock_guard<std::mutex> TransferGuard(TransferStreamMutex);
+      std::lock_guard<ur_mutex> TransferGuard(TransferStreamMutex);
       unsigned int End =
           std::min(static_cast<unsigned int>(TransferStreams.size()),
                    NumTransferStreams);
@@ -175,8 +254,9 @@ struct ur_queue_handle_t_ {
   }
 
   template <typename T> void forEachStream(T &&F) {
+    waitForSubmissionThread();
     {
-      std::lock_guard<std::mutex> compute_guard(ComputeStreamMutex);
+      std::lock_guard<ur_mutex> compute_guard(ComputeStreamMutex);
       unsigned int End = std::min(
           static_cast<unsigned int>(ComputeStreams.size()), NumComputeStreams);
       for (unsigned int i = 0; i < End; i++) {
@@ -184,7 +264,7 @@ struct ur_queue_handle_t_ {
       }
     }
     {
-      std::lock_guard<std::mutex> transfer_guard(TransferStreamMutex);
+      std::lock_guard<ur_mutex> transfer_guard(TransferStreamMutex);
       unsigned int End =
           std::min(static_cast<unsigned int>(TransferStreams.size()),
                    NumTransferStreams);
@@ -195,6 +275,7 @@ struct ur_queue_handle_t_ {
   }
 
   template <bool ResetUsed = false, typename T> void syncStreams(T &&F) {
+    waitForSubmissionThread();
     auto SyncCompute = [&F, &Streams = ComputeStreams, &Delay = DelayCompute](
                            unsigned int Start, unsigned int Stop) {
       for (unsigned int i = Start; i < Stop; i++) {
@@ -210,8 +291,8 @@ struct ur_queue_handle_t_ {
     };
     {
       unsigned int Size = static_cast<unsigned int>(ComputeStreams.size());
-      std::lock_guard<std::mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
-      std::lock_guard<std::mutex> ComputeGuard(ComputeStreamMutex);
+      std::lock_guard<ur_mutex> ComputeSyncGuard(ComputeStreamSyncMutex);
+      std::lock_guard<ur_mutex> ComputeGuard(ComputeStreamMutex);
       unsigned int Start = LastSyncComputeStreams;
       unsigned int End = NumComputeStreams < Size ? NumComputeStreams
                                                   : ComputeStreamIndex.load();
@@ -236,7 +317,7 @@ struct ur_queue_handle_t_ {
       if (!Size) {
         return;
       }
-      std::lock_guard<std::mutex> TransferGuard(TransferStreamMutex);
+      std::lock_guard<ur_mutex> TransferGuard(TransferStreamMutex);
       unsigned int Start = LastSyncTransferStreams;
       unsigned int End = NumTransferStreams < Size ? NumTransferStreams
                                                    : TransferStreamIndex.load();
@@ -20,8 +20,12 @@
 
 #include "tracing.hpp"
 #include "ur_lib_loader.hpp"
+#include <atomic>
+#include <cstdlib>
 #include <exception>
 #include <iostream>
+#include <map>
+#include <mutex>
 
 #ifdef XPTI_ENABLE_INSTRUMENTATION
 using tracing_event_t = xpti_td *;
@@ -42,6 +46,28 @@ using cuptiEnableCallback_fn =
     CUptiResult(CUPTIAPI *)(uint32_t enable, CUpti_SubscriberHandle subscriber,
                             CUpti_CallbackDomain domain, CUpti_CallbackId cbid);
 
+using cuptiActivityEnable_fn = CUptiResult(CUPTIAPI *)(CUpti_ActivityKind kind);
+
+using cuptiActivityDisable_fn =
+    CUptiResult(CUPTIAPI *)(CUpti_ActivityKind kind);
+
+using cuptiActivityRegisterCallbacks_fn = CUptiResult(CUPTIAPI *)(
+    CUpti_BuffersCallbackRequestFunc funcBufferRequested,
+    CUpti_BuffersCallbackCompleteFunc funcBufferCompleted);
+
+using cuptiActivityGetNextRecord_fn =
+    CUptiResult(CUPTIAPI *)(uint8_t *buffer, size_t validBufferSizeBytes,
+                            CUpti_Activity **record);
+
+using cuptiActivityFlushAll_fn = CUptiResult(CUPTIAPI *)(uint32_t flag);
+
+using cuptiActivityPushExternalCorrelationId_fn =
+    CUptiResult(CUPTIAPI *)(CUpti_ExternalCorrelationKind kind, uint64_t id);
+
+using cuptiActivityPopExternalCorrelationId_fn =
+    CUptiResult(CUPTIAPI *)(CUpti_ExternalCorrelationKind kind,
+                            uint64_t *lastId);
+
 #define LOAD_CUPTI_SYM(p, lib, x)                                              \
   p.x = (cupti##x##_fn)ur_loader::LibLoader::getFunctionPtr(lib.get(),         \
                                                             "cupti" #x);
@@ -53,6 +79,13 @@ using cuptiSubscribe_fn = void *;
 using cuptiUnsubscribe_fn = void *;
 using cuptiEnableDomain_fn = void *;
 using cuptiEnableCallback_fn = void *;
+using cuptiActivityEnable_fn = void *;
+using cuptiActivityDisable_fn = void *;
+using cuptiActivityRegisterCallbacks_fn = void *;
+using cuptiActivityGetNextRecord_fn = void *;
+using cuptiActivityFlushAll_fn = void *;
+using cuptiActivityPushExternalCorrelationId_fn = void *;
+using cuptiActivityPopExternalCorrelationId_fn = void *;
 #endif // XPTI_ENABLE_INSTRUMENTATION
 
 struct cupti_table_t_ {
@@ -61,12 +94,27 @@ struct cupti_table_t_ {
   cuptiEnableDomain_fn EnableDomain = nullptr;
   cuptiEnableCallback_fn EnableCallback = nullptr;
 
+  // Only needed for UR_CUDA_TRACE_ACTIVITY
+  cuptiActivityEnable_fn ActivityEnable = nullptr;
+  cuptiActivityDisable_fn ActivityDisable = nullptr;
+  cuptiActivityRegisterCallbacks_fn ActivityRegisterCallbacks = nullptr;
+  cuptiActivityGetNextRecord_fn ActivityGetNextRecord = nullptr;
+  cuptiActivityFlushAll_fn ActivityFlushAll = nullptr;
+  cuptiActivityPushExternalCorrelationId_fn ActivityPushExternalCorrelationId =
+      nullptr;
+  cuptiActivityPopExternalCorrelationId_fn ActivityPopExternalCorrelationId =
+      nullptr;
+
   bool isInitialized() const;
+  bool isActivityInitialized() const;
 };
 
 struct cuda_tracing_context_t_ {
   tracing_event_t CallEvent = nullptr;
   tracing_event_t DebugEvent = nullptr;
+  tracing_event_t ActivityEvent = nullptr;
+  // Read by the callbacks of all the threads making driver calls
+  std::atomic<bool> ActivityEnabled = false;
   subscriber_handle_t Subscriber = nullptr;
   ur_loader::LibLoader::Lib Library;
   cupti_table_t_ Cupti;
@@ -75,6 +123,7 @@ struct cuda_tracing_context_t_ {
 #ifdef XPTI_ENABLE_INSTRUMENTATION
 constexpr auto CUDA_CALL_STREAM_NAME = "sycl.experimental.cuda.call";
 constexpr auto CUDA_DEBUG_STREAM_NAME = "sycl.experimental.cuda.debug";
+constexpr auto CUDA_ACTIVITY_STREAM_NAME = "sycl.experimental.cuda.activity";
 
 thread_local uint64_t CallCorrelationID = 0;
 thread_local uint64_t DebugCorrelationID = 0;
@@ -95,6 +144,19 @@ static void cuptiCallback(void *UserData, CUpti_CallbackDomain,
       DebugCorrelationID = xptiGetUniqueId();
     }
 
+    // Tag the device activity of the call with its call stream correlation
+    // id, CUPTI reports the association in external correlation records.
+    if (Ctx->ActivityEnabled) {
+      if (CBInfo->callbackSite == CUPTI_API_ENTER) {
+        Ctx->Cupti.ActivityPushExternalCorrelationId(
+            CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, CallCorrelationID);
+      } else {
+        uint64_t LastID;
+        Ctx->Cupti.ActivityPopExternalCorrelationId(
+            CUPTI_EXTERNAL_CORRELATION_KIND_CUSTOM0, &LastID);
+      }
+    }
+
     const char *FuncName = CBInfo->functionName;
     uint32_t FuncID = static_cast<uint32_t>(CBID);
     uint16_t TraceTypeArgs = CBInfo->callbackSite == CUPTI_API_ENTER
@@ -117,6 +179,143 @@ static void cuptiCallback(void *UserData, CUpti_CallbackDomain,
                           nullptr, DebugCorrelationID, &Payload);
   }
 }
+
+// CUPTI buffer callbacks don't take user data, and run on a thread of CUPTI
+static std::atomic<cuda_tracing_context_t_ *> ActivityCtx = nullptr;
+
+// Activity records are delivered in a few large buffers, so their collection
+// only costs a record write in the driver per kernel or copy.
+constexpr size_t ActivityBufferSize = 1 << 20;
+constexpr size_t ActivityRecordAlignment = 8;
+
+// Maps the CUPTI correlation ids of driver calls to their call stream
+// correlation ids, until the activity records they correlate are seen. Driver
+// calls without kernel or copy records still have a correlation record, so
+// the oldest ids are dropped past MaxActivityCorrelations, the records of the
+// kernels and copies of those calls being long delivered by then.
+constexpr size_t MaxActivityCorrelations = 1 << 16;
+static std::mutex ActivityCorrelationMutex;
+static std::map<uint32_t, uint64_t> ActivityCorrelation;
+
+static void CUPTIAPI cuptiBufferRequested(uint8_t **Buffer, size_t *Size,
+                                          size_t *MaxNumRecords) {
+  *Buffer = static_cast<uint8_t *>(
+      std::aligned_alloc(ActivityRecordAlignment, ActivityBufferSize));
+  *Size = *Buffer ? ActivityBufferSize : 0;
+  *MaxNumRecords = 0;
+}
+
+static uint64_t takeActivityCorrelation(uint32_t CorrelationID) {
+  std::lock_guard<std::mutex> Guard(ActivityCorrelationMutex);
+  auto It = ActivityCorrelation.find(CorrelationID);
+  if (It == ActivityCorrelation.end())
+    return 0;
+  uint64_t ID = It->second;
+  ActivityCorrelation.erase(It);
+  return ID;
+}
+
+static void CUPTIAPI cuptiBufferCompleted(CUcontext, uint32_t, uint8_t *Buffer,
+                                          size_t, size_t ValidSize) {
+  cuda_tracing_context_t_ *Ctx = ActivityCtx.load();
+  uint8_t ActivityStreamID = xptiRegisterStream(CUDA_ACTIVITY_STREAM_NAME);
+  CUpti_Activity *Record = nullptr;
+  while (Ctx && Ctx->Cupti.ActivityGetNextRecord(Buffer, ValidSize, &Record) ==
+                    CUPTI_SUCCESS) {
+    cuda_activity_record_t Activity{};
+    uint32_t CorrelationID = 0;
+    switch (Record->kind) {
+    case CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION: {
+      auto *Correlation =
+          reinterpret_cast<CUpti_ActivityExternalCorrelation *>(Record);
+      std::lock_guard<std::mutex> Guard(ActivityCorrelationMutex);
+      ActivityCorrelation[Correlation->correlationId] =
+          Correlation->externalId;
+      if (ActivityCorrelation.size() > MaxActivityCorrelations)
+        ActivityCorrelation.erase(ActivityCorrelation.begin());
+      continue;
+    }
+    // Newer versions of the records only append fields, so reading the
+    // oldest ones is valid whatever the version of CUPTI.
+    case CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL: {
+      auto *Kernel = reinterpret_cast<CUpti_ActivityKernel4 *>(Record);
+      Activity = {cuda_activity_record_t::Kernel,
+                  Kernel->name,
+                  Kernel->start,
+                  Kernel->end,
+                  Kernel->deviceId,
+                  Kernel->streamId,
+                  0};
+      CorrelationID = Kernel->correlationId;
+      break;
+    }
+    case CUPTI_ACTIVITY_KIND_MEMCPY: {
+      auto *Memcpy = reinterpret_cast<CUpti_ActivityMemcpy *>(Record);
+      Activity = {cuda_activity_record_t::Memcpy,
+                  nullptr,
+                  Memcpy->start,
+                  Memcpy->end,
+                  Memcpy->deviceId,
+                  Memcpy->streamId,
+                  Memcpy->bytes};
+      CorrelationID = Memcpy->correlationId;
+      break;
+    }
+    default:
+      continue;
+    }
+    xptiNotifySubscribers(ActivityStreamID, xpti::trace_signal,
+                          Ctx->ActivityEvent, nullptr,
+                          takeActivityCorrelation(CorrelationID), &Activity);
+  }
+  std::free(Buffer);
+}
+
+static void enableCUDAActivity(cuda_tracing_context_t_ *Ctx) {
+  if (std::getenv("UR_CUDA_TRACE_ACTIVITY") == nullptr ||
+      !Ctx->Cupti.isActivityInitialized())
+    return;
+
+  xptiRegisterStream(CUDA_ACTIVITY_STREAM_NAME);
+  xptiInitialize(CUDA_ACTIVITY_STREAM_NAME, GMajVer, GMinVer, GVerStr);
+
+  uint64_t Dummy;
+  xpti::payload_t CUDAActivityPayload("CUDA Plugin Activity Layer");
+  Ctx->ActivityEvent =
+      xptiMakeEvent("CUDA Plugin Activity Layer", &CUDAActivityPayload,
+                    xpti::trace_algorithm_event, xpti_at::active, &Dummy);
+
+  ActivityCtx = Ctx;
+  if (Ctx->Cupti.ActivityRegisterCallbacks(cuptiBufferRequested,
+                                           cuptiBufferCompleted) !=
+      CUPTI_SUCCESS) {
+    ActivityCtx = nullptr;
+    return;
+  }
+  Ctx->Cupti.ActivityEnable(CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION);
+  Ctx->Cupti.ActivityEnable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL);
+  Ctx->Cupti.ActivityEnable(CUPTI_ACTIVITY_KIND_MEMCPY);
+  Ctx->ActivityEnabled = true;
+}
+
+static void disableCUDAActivity(cuda_tracing_context_t_ *Ctx) {
+  if (!Ctx->ActivityEnabled)
+    return;
+
+  Ctx->ActivityEnabled = false;
+  Ctx->Cupti.ActivityDisable(CUPTI_ACTIVITY_KIND_MEMCPY);
+  Ctx->Cupti.ActivityDisable(CUPTI_ACTIVITY_KIND_CONCURRENT_KERNEL);
+  Ctx->Cupti.ActivityDisable(CUPTI_ACTIVITY_KIND_EXTERNAL_CORRELATION);
+  // Deliver the records of the activity which already completed
+  Ctx->Cupti.ActivityFlushAll(CUPTI_ACTIVITY_FLAG_FLUSH_FORCED);
+  ActivityCtx = nullptr;
+  {
+    std::lock_guard<std::mutex> Guard(ActivityCorrelationMutex);
+    ActivityCorrelation.clear();
+  }
+
+  xptiFinalize(CUDA_ACTIVITY_STREAM_NAME);
+}
 #endif
 
 cuda_tracing_context_t_ *createCUDATracingContext() {
@@ -142,6 +341,12 @@ bool cupti_table_t_::isInitialized() const {
   return Subscribe && Unsubscribe && EnableDomain && EnableCallback;
 }
 
+bool cupti_table_t_::isActivityInitialized() const {
+  return ActivityEnable && ActivityDisable && ActivityRegisterCallbacks &&
+         ActivityGetNextRecord && ActivityFlushAll &&
+         ActivityPushExternalCorrelationId && ActivityPopExternalCorrelationId;
+}
+
 bool loadCUDATracingLibrary(cuda_tracing_context_t_ *Ctx) {
 #if defined(XPTI_ENABLE_INSTRUMENTATION) && defined(CUPTI_LIB_PATH)
   if (!Ctx)
@@ -156,6 +361,13 @@ bool loadCUDATracingLibrary(cuda_tracing_context_t_ *Ctx) {
   LOAD_CUPTI_SYM(Table, Lib, Unsubscribe)
   LOAD_CUPTI_SYM(Table, Lib, EnableDomain)
   LOAD_CUPTI_SYM(Table, Lib, EnableCallback)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityEnable)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityDisable)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityRegisterCallbacks)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityGetNextRecord)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityFlushAll)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityPushExternalCorrelationId)
+  LOAD_CUPTI_SYM(Table, Lib, ActivityPopExternalCorrelationId)
   if (!Table.isInitialized()) {
     return false;
   }
@@ -202,6 +414,8 @@ void enableCUDATracing(cuda_tracing_context_t_ *Ctx) {
       xptiMakeEvent("CUDA Plugin Debug Layer", &CUDADebugPayload,
                     xpti::trace_algorithm_event, xpti_at::active, &Dummy);
 
+  enableCUDAActivity(Ctx);
+
   Ctx->Cupti.Subscribe(&Ctx->Subscriber, cuptiCallback, Ctx);
   Ctx->Cupti.EnableDomain(1, Ctx->Subscriber, CUPTI_CB_DOMAIN_DRIVER_API);
   Ctx->Cupti.EnableCallback(0, Ctx->Subscriber, CUPTI_CB_DOMAIN_DRIVER_API,
@@ -223,6 +437,8 @@ void disableCUDATracing(cuda_tracing_context_t_ *Ctx) {
     Ctx->Subscriber = nullptr;
   }
 
+  disableCUDAActivity(Ctx);
+
   xptiFinalize(CUDA_CALL_STREAM_NAME);
   xptiFinalize(CUDA_DEBUG_STREAM_NAME);
 #else
@@ -8,8 +8,31 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cstdint>
+
 struct cuda_tracing_context_t_;
 
+// Device activity notified with xpti::trace_signal on the
+// "sycl.experimental.cuda.activity" stream when UR_CUDA_TRACE_ACTIVITY is set.
+// The instance of a notification is the correlation id of the call stream
+// notifications of the driver call which enqueued the activity, or 0 if the
+// call is unknown. Records are collected by CUPTI and notified in bulk, some
+// time after the activity completed.
+struct cuda_activity_record_t {
+  enum kind_t : uint32_t { Kernel, Memcpy };
+
+  kind_t Kind;
+  // Name of the kernel, nullptr for memory copies
+  const char *Name;
+  // CUPTI timestamps in nanoseconds
+  uint64_t Start;
+  uint64_t End;
+  uint32_t DeviceId;
+  uint32_t StreamId;
+  // Size of memory copies, 0 for kernels
+  uint64_t Bytes;
+};
+
 cuda_tracing_context_t_ *createCUDATracingContext();
 void freeCUDATracingContext(cuda_tracing_context_t_ *Ctx);
 
@@ -80,6 +80,19 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = urEventWaitAnyExp;
+  pDdiTable->pfnCreateIPCExp = urEventCreateIPCExp;
+  pDdiTable->pfnGetIPCHandleExp = urEventGetIPCHandleExp;
+  pDdiTable->pfnOpenIPCHandleExp = urEventOpenIPCHandleExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_api_version_t version, ur_program_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -230,6 +243,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnBeginCaptureExp = urQueueBeginCaptureExp;
+  pDdiTable->pfnEndCaptureExp = urQueueEndCaptureExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL
 urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -299,6 +323,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
   pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
   pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnUpdateKernelLaunchBatchExp =
+      urCommandBufferUpdateKernelLaunchBatchExp;
+  pDdiTable->pfnUploadExp = urCommandBufferUploadExp;
   pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
   pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
   pDdiTable->pfnUpdateWaitEventsExp = urCommandBufferUpdateWaitEventsExp;
@@ -335,6 +362,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
       urBindlessImagesUnsampledImageCreateExp;
   pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
   pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageCopyBatchExp = urBindlessImagesImageCopyBatchExp;
   pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
   pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
   pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
@@ -363,6 +391,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     return result;
   }
   pDdiTable->pfnPitchedAllocExp = urUSMPitchedAllocExp;
+  pDdiTable->pfnGrowableAllocExp = urUSMGrowableAllocExp;
+  pDdiTable->pfnGrowExp = urUSMGrowExp;
+  pDdiTable->pfnPoolTrimExp = urUSMPoolTrimExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -414,8 +445,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   pDdiTable->pfnCooperativeKernelLaunchExp =
       urEnqueueCooperativeKernelLaunchExp;
   pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchMultiExp = urEnqueueKernelLaunchMultiExp;
   pDdiTable->pfnKernelLaunchCustomExp = urEnqueueKernelLaunchCustomExp;
   pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+  pDdiTable->pfnHostTaskExp = urEnqueueHostTaskExp;
+  pDdiTable->pfnIPCEventSignalExp = urEnqueueIPCEventSignalExp;
+  pDdiTable->pfnIPCEventWaitExp = urEnqueueIPCEventWaitExp;
+  pDdiTable->pfnUSMMemcpyBatchExp = urEnqueueUSMMemcpyBatchExp;
+  pDdiTable->pfnUSMDeviceAllocExp = urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = urEnqueueUSMFreeExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -429,6 +467,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
       urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -443,6 +482,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   pDdiTable->pfnBuildExp = urProgramBuildExp;
   pDdiTable->pfnCompileExp = urProgramCompileExp;
   pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildAsyncExp = urProgramBuildAsyncExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -8,13 +8,16 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 
 #include "adapter.hpp"
 #include "common.hpp"
 #include "context.hpp"
 #include "device.hpp"
 #include "event.hpp"
+#include "image.hpp"
 #include "platform.hpp"
 #include "queue.hpp"
 #include "ur_util.hpp"
@@ -29,6 +32,24 @@ ur_result_t getProviderNativeError(const char *, int32_t) {
 }
 } // namespace umf
 
+usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig() {
+  const char *PoolTraceVal = std::getenv("UR_CUDA_USM_ALLOCATOR_TRACE");
+  int PoolTrace = 0;
+  if (PoolTraceVal != nullptr) {
+    PoolTrace = std::atoi(PoolTraceVal);
+  }
+
+  const char *PoolConfigVal = std::getenv("UR_CUDA_USM_ALLOCATOR");
+  if (PoolConfigVal == nullptr) {
+    return usm::DisjointPoolAllConfigs(PoolTrace);
+  }
+
+  return usm::parseDisjointPoolConfig(PoolConfigVal, PoolTrace);
+}
+
+usm::DisjointPoolAllConfigs DisjointPoolConfigInstance =
+    InitializeDisjointPoolConfig();
+
 /// USM: Implements USM Host allocations using CUDA Pinned Memory
 /// https://docs.nvidia.com/cuda/cuda-c-programming-guide/index.html#page-locked-host-memory
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -39,11 +60,28 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *NumaDesc =
+      pUSMDesc ? find_stype_node<ur_exp_usm_host_numa_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+
   if (!hPool) {
-    return USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
+    ur_numa_bind_scope NumaBind(NumaDesc ? int(NumaDesc->numaNode) : -1);
+    auto Result =
+        USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
   }
 
   auto UMFPool = hPool->HostMemPool.get();
+  if (NumaDesc) {
+    auto NumaPool = hPool->NumaHostMemPools.find(NumaDesc->numaNode);
+    if (NumaPool != hPool->NumaHostMemPools.end()) {
+      UMFPool = NumaPool->second.get();
+    }
+  }
   *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
@@ -63,9 +101,22 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   if (!hPool) {
-    return USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0, size,
-                              alignment);
+    auto Result = USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0,
+                                     size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
   }
 
   auto UMFPool = hPool->DeviceMemPool.get();
@@ -88,9 +139,23 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                 (alignment == 0 || ((alignment & (alignment - 1)) == 0)),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   if (!hPool) {
-    return USMSharedAllocImpl(ppMem, hContext, hDevice, /*host flags*/ 0,
-                              /*device flags*/ 0, size, alignment);
+    auto Result = USMSharedAllocImpl(ppMem, hContext, hDevice,
+                                     /*host flags*/ 0, /*device flags*/ 0,
+                                     size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
   }
 
   auto UMFPool = hPool->SharedMemPool.get();
@@ -102,23 +167,31 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   return UR_RESULT_SUCCESS;
 }
 
-ur_result_t USMFreeImpl(ur_context_handle_t, void *Pointer) {
+ur_result_t USMFreeImpl(ur_context_handle_t, void *Pointer,
+                        ur_exp_context_memory_type_t *FreedType,
+                        size_t *FreedSize) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     unsigned int IsManaged;
     unsigned int Type;
-    void *AttributeValues[2] = {&IsManaged, &Type};
-    CUpointer_attribute Attributes[2] = {CU_POINTER_ATTRIBUTE_IS_MANAGED,
-                                         CU_POINTER_ATTRIBUTE_MEMORY_TYPE};
-    UR_CHECK_ERROR(cuPointerGetAttributes(2, Attributes, AttributeValues,
+    size_t Size = 0;
+    void *AttributeValues[3] = {&IsManaged, &Type, &Size};
+    CUpointer_attribute Attributes[3] = {CU_POINTER_ATTRIBUTE_IS_MANAGED,
+                                         CU_POINTER_ATTRIBUTE_MEMORY_TYPE,
+                                         CU_POINTER_ATTRIBUTE_RANGE_SIZE};
+    UR_CHECK_ERROR(cuPointerGetAttributes(3, Attributes, AttributeValues,
                                           (CUdeviceptr)Pointer));
     UR_ASSERT(Type == CU_MEMORYTYPE_DEVICE || Type == CU_MEMORYTYPE_HOST,
               UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+    *FreedSize = Size;
     if (IsManaged || Type == CU_MEMORYTYPE_DEVICE) {
+      *FreedType = IsManaged ? UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED
+                             : UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE;
       // Memory allocated with cuMemAlloc and cuMemAllocManaged must be freed
       // with cuMemFree
       UR_CHECK_ERROR(cuMemFree((CUdeviceptr)Pointer));
     } else {
+      *FreedType = UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST;
       // Memory allocated with cuMemAllocHost must be freed with cuMemFreeHost
       UR_CHECK_ERROR(cuMemFreeHost(Pointer));
     }
@@ -128,13 +201,37 @@ ur_result_t USMFreeImpl(ur_context_handle_t, void *Pointer) {
   return Result;
 }
 
+size_t getUSMAllocSize(const void *Pointer, size_t RequestedSize) {
+  size_t Size = 0;
+  if (cuPointerGetAttribute(&Size, CU_POINTER_ATTRIBUTE_RANGE_SIZE,
+                            (CUdeviceptr)Pointer) != CUDA_SUCCESS) {
+    return RequestedSize;
+  }
+  return Size;
+}
+
 /// USM: Frees the given USM pointer associated with the context.
 ///
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
                                               void *pMem) {
+  // Sampled images may view USM
+  destroyImageHandles(hContext,
+                      reinterpret_cast<ur_exp_image_mem_native_handle_t>(pMem));
   if (auto Pool = umfPoolByPtr(pMem))
     return umf::umf2urResult(umfPoolFree(Pool, pMem));
-  return USMFreeImpl(hContext, pMem);
+  try {
+    if (hContext->takeGrowableAllocation(pMem))
+      return UR_RESULT_SUCCESS;
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  ur_exp_context_memory_type_t Type;
+  size_t Size;
+  auto Result = USMFreeImpl(hContext, pMem, &Type, &Size);
+  if (Result == UR_RESULT_SUCCESS) {
+    hContext->MemoryAccounting.onFree(Type, Size);
+  }
+  return Result;
 }
 
 ur_result_t USMDeviceAllocImpl(void **ResultPtr, ur_context_handle_t,
@@ -310,9 +407,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
 }
 
 umf_result_t USMMemoryProvider::initialize(ur_context_handle_t Ctx,
-                                           ur_device_handle_t Dev) {
+                                           ur_device_handle_t Dev,
+                                           ur_exp_context_memory_type_t Type) {
   Context = Ctx;
   Device = Dev;
+  MemoryType = Type;
   // There isn't a way to query this in cuda, and there isn't much info on
   // cuda's approach to alignment or transfer granularity between host and
   // device. Within UMF this is only used to influence alignment, and since we
@@ -331,18 +430,22 @@ enum umf_result_t USMMemoryProvider::alloc(size_t Size, size_t Align,
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onAlloc(MemoryType, getUSMAllocSize(*Ptr, Size));
   return UMF_RESULT_SUCCESS;
 }
 
 enum umf_result_t USMMemoryProvider::free(void *Ptr, size_t Size) {
   (void)Size;
 
-  auto Res = USMFreeImpl(Context, Ptr);
+  ur_exp_context_memory_type_t FreedType;
+  size_t FreedSize;
+  auto Res = USMFreeImpl(Context, Ptr, &FreedType, &FreedSize);
   if (Res != UR_RESULT_SUCCESS) {
     getLastStatusRef() = Res;
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onFree(MemoryType, FreedSize);
   return UMF_RESULT_SUCCESS;
 }
 
@@ -373,6 +476,9 @@ ur_result_t USMDeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
 
 ur_result_t USMHostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                 uint32_t Alignment) {
+  // The driver allocates the pages, and pins them, under the memory policy of
+  // the calling thread
+  ur_numa_bind_scope NumaBind(Device ? Device->getNumaNode() : -1);
   return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
 }
 
@@ -392,6 +498,13 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
       }
       break;
     }
+    case UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC: {
+      const ur_exp_usm_pool_arena_desc_t *Arena =
+          reinterpret_cast<const ur_exp_usm_pool_arena_desc_t *>(BaseDesc);
+      DisjointPoolConfigs.Arenas[usm::DisjointPoolMemType::Device] = {
+          Arena->size, Arena->pageSize};
+      break;
+    }
     default: {
       throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
     }
@@ -400,39 +513,76 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
   }
 
   auto MemProvider =
-      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(Context, nullptr)
+      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+          Context, nullptr, UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST)
           .second;
 
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+  HostMemPool = this->DisjointPoolConfigs
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::Host, &Stats)
+                .second;
+
+  for (const auto &Device : Context->getDevices()) {
+    int NumaNode = Device->getNumaNode();
+    if (NumaNode < 0 || NumaHostMemPools.count(NumaNode))
+      continue;
+    MemProvider =
+        umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST)
+            .second;
+    NumaHostMemPools.emplace(
+        NumaNode, this->DisjointPoolConfigs
+                      .makePool(std::move(MemProvider),
+                                usm::DisjointPoolMemType::Host, &Stats)
+                      .second);
+  }
 
   for (const auto &Device : Context->getDevices()) {
     MemProvider =
-        umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(Context, Device)
+        umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE)
             .second;
-    DeviceMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Device])
+    DeviceMemPool = this->DisjointPoolConfigs
+                        .makePool(std::move(MemProvider),
+                                  usm::DisjointPoolMemType::Device, &Stats)
                         .second;
     MemProvider =
-        umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(Context, Device)
+        umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED)
             .second;
-    SharedMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Shared])
+    SharedMemPool = this->DisjointPoolConfigs
+                        .makePool(std::move(MemProvider),
+                                  usm::DisjointPoolMemType::Shared, &Stats)
                         .second;
     Context->addPool(this);
   }
 }
 
 bool ur_usm_pool_handle_t_::hasUMFPool(umf_memory_pool_t *umf_pool) {
-  return DeviceMemPool.get() == umf_pool || SharedMemPool.get() == umf_pool ||
-         HostMemPool.get() == umf_pool;
+  if (DeviceMemPool.get() == umf_pool || SharedMemPool.get() == umf_pool ||
+      HostMemPool.get() == umf_pool) {
+    return true;
+  }
+  for (auto &NumaPool : NumaHostMemPools) {
+    if (NumaPool.second.get() == umf_pool) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t ur_usm_pool_handle_t_::trim(size_t MinBytesToKeep) {
+  size_t KeptSize = 0;
+  for (auto *UMFPool :
+       {DeviceMemPool.get(), SharedMemPool.get(), HostMemPool.get()}) {
+    auto Budget = MinBytesToKeep - KeptSize;
+    KeptSize += std::min(umf::poolTrim(UMFPool, Budget), Budget);
+  }
+  for (auto &NumaPool : NumaHostMemPools) {
+    auto Budget = MinBytesToKeep - KeptSize;
+    KeptSize += std::min(umf::poolTrim(NumaPool.second.get(), Budget), Budget);
+  }
+  return KeptSize;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
@@ -499,7 +649,44 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
     return ReturnValue(hPool->Context);
   }
   default: {
-    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    return umf::getPoolStatsInfo(hPool->Stats, propName, ReturnValue);
   }
   }
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMGrowableAllocExp(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                      size_t maxSize, size_t size, void **ppMem) {
+  try {
+    auto Allocation =
+        std::make_unique<GrowableAllocation>(hDevice, maxSize, size);
+    *ppMem = Allocation->get();
+    hContext->addGrowableAllocation(std::move(Allocation));
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urUSMGrowExp(ur_context_handle_t hContext,
+                                                 void *pMem, size_t size) {
+  return hContext->growGrowableAllocation(pMem, size);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t minBytesToKeep ///< [in] number of bytes of free memory which may be
+                          ///< left cached
+) {
+  // Allocations without a pool aren't pooled, only the pools are trimmed
+  if (hPool) {
+    hPool->trim(minBytesToKeep);
+  } else {
+    hContext->trimPools(minBytesToKeep);
+  }
+  return UR_RESULT_SUCCESS;
+}
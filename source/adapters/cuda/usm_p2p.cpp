@@ -10,12 +10,38 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "platform.hpp"
+
+ur::peer_topology &ur_platform_handle_t_::getPeerTopology() {
+  PeerTopology.init(
+      Devices.size(),
+      [this](size_t Src, size_t Dst, ur::peer_topology::link_t &Link) {
+        CUdevice SrcDevice = Devices[Src]->get();
+        CUdevice DstDevice = Devices[Dst]->get();
+        int Value = 0;
+        UR_CHECK_ERROR(cuDeviceGetP2PAttribute(
+            &Value, CU_DEVICE_P2P_ATTRIBUTE_ACCESS_SUPPORTED, SrcDevice,
+            DstDevice));
+        Link.accessSupported = Value != 0;
+        UR_CHECK_ERROR(cuDeviceGetP2PAttribute(
+            &Value, CU_DEVICE_P2P_ATTRIBUTE_NATIVE_ATOMIC_SUPPORTED, SrcDevice,
+            DstDevice));
+        Link.atomicsSupported = Value != 0;
+        UR_CHECK_ERROR(cuDeviceGetP2PAttribute(
+            &Value, CU_DEVICE_P2P_ATTRIBUTE_PERFORMANCE_RANK, SrcDevice,
+            DstDevice));
+        Link.performanceRank = Value;
+      });
+  return PeerTopology;
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
   try {
     ScopedContext active(commandDevice);
     UR_CHECK_ERROR(cuCtxEnablePeerAccess(peerDevice->getNativeContext(), 0));
+    commandDevice->getPlatform()->getPeerTopology().setEnabled(
+        commandDevice->getIndex(), peerDevice->getIndex(), true);
   } catch (ur_result_t err) {
     return err;
   }
@@ -27,6 +53,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
   try {
     ScopedContext active(commandDevice);
     UR_CHECK_ERROR(cuCtxDisablePeerAccess(peerDevice->getNativeContext()));
+    commandDevice->getPlatform()->getPeerTopology().setEnabled(
+        commandDevice->getIndex(), peerDevice->getIndex(), false);
   } catch (ur_result_t err) {
     return err;
   }
@@ -41,25 +69,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   int value;
-  CUdevice_P2PAttribute cuAttr;
   try {
     ScopedContext active(commandDevice);
+    const auto &Link = commandDevice->getPlatform()->getPeerTopology().get(
+        commandDevice->getIndex(), peerDevice->getIndex());
     switch (propName) {
     case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
-      cuAttr = CU_DEVICE_P2P_ATTRIBUTE_ACCESS_SUPPORTED;
+      value = Link.accessSupported;
       break;
     }
     case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED: {
-      cuAttr = CU_DEVICE_P2P_ATTRIBUTE_NATIVE_ATOMIC_SUPPORTED;
+      value = Link.atomicsSupported;
       break;
     }
     default: {
       return UR_RESULT_ERROR_INVALID_ENUMERATION;
     }
     }
-
-    UR_CHECK_ERROR(cuDeviceGetP2PAttribute(&value, cuAttr, commandDevice->get(),
-                                           peerDevice->get()));
   } catch (ur_result_t err) {
     return err;
   }
@@ -92,6 +92,7 @@ urVirtualMemMap(ur_context_handle_t hContext, const void *pStart, size_t size,
   ScopedContext Active(hContext->getDevices()[0]);
   UR_CHECK_ERROR(
       cuMemMap((CUdeviceptr)pStart, size, offset, hPhysicalMem->get(), 0));
+  hContext->PhysicalMemPool.map(pStart, hPhysicalMem->get());
   if (flags)
     UR_CHECK_ERROR(urVirtualMemSetAccess(hContext, pStart, size, flags));
   return UR_RESULT_SUCCESS;
@@ -102,6 +103,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urVirtualMemUnmap(
   // Unmap the virtual mem. Only need to do once for arbitrary context
   ScopedContext Active(hContext->getDevices()[0]);
   UR_CHECK_ERROR(cuMemUnmap((CUdeviceptr)pStart, size));
+  hContext->PhysicalMemPool.unmap(pStart, size);
   return UR_RESULT_SUCCESS;
 }
 
@@ -11,6 +11,7 @@
 #include "adapter.hpp"
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
+#include "ur_perf_counters.hpp"
 
 #include <atomic>
 #include <ur_api.h>
@@ -67,8 +68,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGet(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
-  // No state to clean up so we don't need to check for 0 references
-  adapter.RefCount--;
+  // No state to clean up, the counters are only logged
+  if (--adapter.RefCount == 0) {
+    UR_LOG_L(adapter.logger, INFO, "Performance counters:\n{}",
+             ur::perf_counters::get().dump());
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -96,6 +100,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
     return ReturnValue(UR_ADAPTER_BACKEND_HIP);
   case UR_ADAPTER_INFO_REFERENCE_COUNT:
     return ReturnValue(adapter.RefCount.load());
+  case UR_ADAPTER_INFO_PERF_COUNTERS:
+    return ReturnValue(ur::perf_counters::get().dump().c_str());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
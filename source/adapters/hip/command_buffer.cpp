@@ -19,6 +19,7 @@
 #include "memory.hpp"
 #include "queue.hpp"
 
+#include <algorithm>
 #include <cstring>
 
 namespace {
@@ -124,13 +125,19 @@ static ur_result_t getNodesFromSyncPoints(
     size_t NumSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *SyncPointWaitList,
     std::vector<hipGraphNode_t> &HIPNodesList) {
-  // Map of ur_exp_command_buffer_sync_point_t to ur_event_handle_t defining
-  // the event associated with each sync-point
-  auto SyncPoints = CommandBuffer->SyncPoints;
+  // Map of ur_exp_command_buffer_sync_point_t to the graph node associated
+  // with each sync-point
+  const auto &SyncPoints = CommandBuffer->SyncPoints;
+
+  // Sync-points which another of the list already depends on would only add
+  // redundant edges to the graph
+  std::vector<ur_exp_command_buffer_sync_point_t> WaitList;
+  CommandBuffer->SyncPointGraph.reduce(SyncPointWaitList,
+                                       NumSyncPointsInWaitList, WaitList);
 
   // For each sync-point add associated HIP graph node to the return list.
-  for (size_t i = 0; i < NumSyncPointsInWaitList; i++) {
-    if (auto NodeHandle = SyncPoints.find(SyncPointWaitList[i]);
+  for (auto SyncPoint : WaitList) {
+    if (auto NodeHandle = SyncPoints.find(SyncPoint);
         NodeHandle != SyncPoints.end()) {
       HIPNodesList.push_back(NodeHandle->second);
     } else {
@@ -902,6 +909,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue) {
+  if (!hCommandBuffer->HIPGraphExec) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    hipStream_t HIPStream = hQueue->getNextComputeStream();
+
+    // Moves the work of the first launch, such as copying the graph to the
+    // device, onto the stream now rather than on the first enqueue.
+    UR_CHECK_ERROR(hipGraphUpload(hCommandBuffer->HIPGraphExec, HIPStream));
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
@@ -1056,11 +1083,17 @@ updateCommand(ur_exp_command_buffer_command_handle_t Command,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+/**
+ * Updates the command and the kernel arguments, and computes the new node
+ * parameters of the command in its Params.
+ * @param[in] hCommand The command to be updated.
+ * @param[in] pUpdateKernelLaunch The update command description.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+ur_result_t updateKernelNodeParams(
     ur_exp_command_buffer_command_handle_t hCommand,
     const ur_exp_command_buffer_update_kernel_launch_desc_t
         *pUpdateKernelLaunch) {
-
   ur_exp_command_buffer_handle_t CommandBuffer = hCommand->CommandBuffer;
 
   UR_CHECK_ERROR(validateCommandDesc(hCommand, pUpdateKernelLaunch));
@@ -1068,6 +1101,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
       updateKernelArguments(CommandBuffer->Device, pUpdateKernelLaunch));
   UR_CHECK_ERROR(updateCommand(hCommand, pUpdateKernelLaunch));
 
+  hipKernelNodeParams &Params = hCommand->Params;
+
+  // Updates of the arguments only, the most common in iterative algorithms,
+  // keep the function and launch dimensions computed for the node before.
+  // The implicit offset is still set, as it is an argument of the kernel,
+  // which other commands may have changed.
+  if (!pUpdateKernelLaunch->hNewKernel &&
+      !pUpdateKernelLaunch->pNewGlobalWorkOffset &&
+      !pUpdateKernelLaunch->pNewGlobalWorkSize &&
+      !pUpdateKernelLaunch->pNewLocalWorkSize) {
+    ur_kernel_handle_t Kernel = hCommand->Kernel;
+    if (Kernel->getWithOffsetParameter()) {
+      std::uint32_t ImplicitOffset[3] = {0, 0, 0};
+      for (size_t i = 0; i < hCommand->WorkDim; i++) {
+        ImplicitOffset[i] =
+            static_cast<std::uint32_t>(hCommand->GlobalWorkOffset[i]);
+      }
+      Kernel->setImplicitOffsetArg(sizeof(ImplicitOffset), ImplicitOffset);
+    }
+    Params.sharedMemBytes = Kernel->getLocalSize();
+    Params.kernelParams = const_cast<void **>(Kernel->getArgIndices().data());
+    return UR_RESULT_SUCCESS;
+  }
+
   // If no worksize is provided make sure we pass nullptr to setKernelParams
   // so it can guess the local work size.
   const bool ProvidedLocalSize = !hCommand->isNullLocalSize();
@@ -1083,8 +1140,6 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
       hCommand->GlobalWorkSize, LocalWorkSize, hCommand->Kernel, HIPFunc,
       ThreadsPerBlock, BlocksPerGrid));
 
-  hipKernelNodeParams &Params = hCommand->Params;
-
   Params.func = HIPFunc;
   Params.gridDim.x = BlocksPerGrid[0];
   Params.gridDim.y = BlocksPerGrid[1];
@@ -1095,10 +1150,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   Params.sharedMemBytes = hCommand->Kernel->getLocalSize();
   Params.kernelParams =
       const_cast<void **>(hCommand->Kernel->getArgIndices().data());
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
+    ur_exp_command_buffer_command_handle_t hCommand,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  UR_CHECK_ERROR(updateKernelNodeParams(hCommand, pUpdateKernelLaunch));
 
   hipGraphNode_t Node = hCommand->Node;
-  hipGraphExec_t HipGraphExec = CommandBuffer->HIPGraphExec;
-  UR_CHECK_ERROR(hipGraphExecKernelNodeSetParams(HipGraphExec, Node, &Params));
+  hipGraphExec_t HipGraphExec = hCommand->CommandBuffer->HIPGraphExec;
+  UR_CHECK_ERROR(
+      hipGraphExecKernelNodeSetParams(HipGraphExec, Node, &hCommand->Params));
+  hCommand->IsGraphNodeOutdated = true;
   return UR_RESULT_SUCCESS;
 }
 
@@ -1150,3 +1215,65 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, uint32_t numKernelUpdates,
+    const ur_exp_command_buffer_command_handle_t *phCommands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    if (phCommands[i]->CommandBuffer != hCommandBuffer) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+  }
+
+  // When the batch updates at least half of the kernels, the nodes are
+  // updated in the graph instead, which doesn't touch the executable graph,
+  // and the executable graph is then updated once from the graph. That is
+  // only possible when the graph has all the earlier updates, or when the
+  // batch updates all the nodes which don't have them.
+  const auto &CommandHandles = hCommandBuffer->CommandHandles;
+  bool UpdateWholeGraph =
+      numKernelUpdates > 1 &&
+      2 * static_cast<size_t>(numKernelUpdates) >= CommandHandles.size();
+  if (UpdateWholeGraph) {
+    std::unordered_set<ur_exp_command_buffer_command_handle_t> Updated(
+        phCommands, phCommands + numKernelUpdates);
+    UpdateWholeGraph = std::none_of(
+        CommandHandles.begin(), CommandHandles.end(), [&](auto Command) {
+          return Command->IsGraphNodeOutdated && !Updated.count(Command);
+        });
+  }
+
+  if (!UpdateWholeGraph) {
+    for (uint32_t i = 0; i < numKernelUpdates; i++) {
+      auto Result = urCommandBufferUpdateKernelLaunchExp(
+          phCommands[i], &pUpdateKernelLaunch[i]);
+      if (Result != UR_RESULT_SUCCESS) {
+        return Result;
+      }
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    auto Result =
+        updateKernelNodeParams(phCommands[i], &pUpdateKernelLaunch[i]);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+    UR_CHECK_ERROR(hipGraphKernelNodeSetParams(phCommands[i]->Node,
+                                               &phCommands[i]->Params));
+  }
+
+  hipGraphNode_t ErrorNode;
+  hipGraphExecUpdateResult UpdateResult;
+  UR_CHECK_ERROR(hipGraphExecUpdate(hCommandBuffer->HIPGraphExec,
+                                    hCommandBuffer->HIPGraph, &ErrorNode,
+                                    &UpdateResult));
+
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    phCommands[i]->IsGraphNodeOutdated = false;
+  }
+  return UR_RESULT_SUCCESS;
+}
@@ -13,6 +13,7 @@
 #include <ur_print.hpp>
 
 #include "context.hpp"
+#include "ur_sync_point_graph.hpp"
 #include <hip/hip_runtime.h>
 #include <memory>
 #include <unordered_set>
@@ -116,6 +117,10 @@ struct ur_exp_command_buffer_command_handle_t_ {
   size_t GlobalWorkSize[3];
   size_t LocalWorkSize[3];
 
+  // Whether Node was updated in the executable graph only, which an update of
+  // the whole executable graph from HIPGraph would revert.
+  bool IsGraphNodeOutdated = false;
+
 private:
   std::atomic_uint32_t RefCountInternal;
   std::atomic_uint32_t RefCountExternal;
@@ -131,6 +136,7 @@ struct ur_exp_command_buffer_handle_t_ {
   void registerSyncPoint(ur_exp_command_buffer_sync_point_t SyncPoint,
                          hipGraphNode_t HIPNode) {
     SyncPoints[SyncPoint] = std::move(HIPNode);
+    SyncPointGraph.add(SyncPoint);
     NextSyncPoint++;
   }
 
@@ -187,6 +193,9 @@ struct ur_exp_command_buffer_handle_t_ {
   // Next sync_point value (may need to consider ways to reuse values if 32-bits
   // is not enough)
   ur_exp_command_buffer_sync_point_t NextSyncPoint;
+  // Dependencies between the sync points, to drop those of a wait list which
+  // are implied by the others before they become graph edges
+  ur::sync_point_graph SyncPointGraph;
 
   // Handles to individual commands in the command-buffer
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
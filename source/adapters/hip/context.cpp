@@ -11,6 +11,9 @@
 #include "context.hpp"
 #include "usm.hpp"
 
+#include <algorithm>
+#include <iterator>
+
 void ur_context_handle_t_::addPool(ur_usm_pool_handle_t Pool) {
   std::lock_guard<std::mutex> Lock(Mutex);
   PoolHandles.insert(Pool);
@@ -32,6 +35,49 @@ ur_context_handle_t_::getOwningURPool(umf_memory_pool_t *UMFPool) {
   return nullptr;
 }
 
+void ur_context_handle_t_::trimPools(size_t MinBytesToKeep) {
+  freeDeferredBuffers(/*Wait=*/false);
+  std::lock_guard<std::mutex> Lock(Mutex);
+  for (auto &Pool : PoolHandles) {
+    MinBytesToKeep -= Pool->trim(MinBytesToKeep);
+  }
+  for (auto &Pool : BufferMemPools) {
+    if (Pool) {
+      MinBytesToKeep -=
+          std::min(umf::poolTrim(Pool.get(), MinBytesToKeep), MinBytesToKeep);
+    }
+  }
+}
+
+umf_memory_pool_handle_t
+ur_context_handle_t_::getBufferMemPool(ur_device_handle_t hDevice) {
+  if (!DisjointPoolConfigInstance.EnableBuffers) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto &Pool =
+      BufferMemPools[hDevice ? getDeviceIndex(hDevice) : Devices.size()];
+  if (Pool) {
+    return Pool.get();
+  }
+
+  auto MemProvider =
+      hDevice ? umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(
+                    this, hDevice, UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER)
+                    .second
+              : umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+                    this, nullptr, UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER)
+                    .second;
+  auto [Result, NewPool] = DisjointPoolConfigInstance.makePool(
+      std::move(MemProvider), hDevice ? usm::DisjointPoolMemType::Device
+                                      : usm::DisjointPoolMemType::Host);
+  if (Result != UMF_RESULT_SUCCESS) {
+    throw umf::umf2urResult(Result);
+  }
+  Pool = std::move(NewPool);
+  return Pool.get();
+}
+
 /// Create a UR context.
 ///
 UR_APIEXPORT ur_result_t UR_APICALL urContextCreate(
@@ -83,6 +129,10 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
     // 2D USM operations currently not supported.
     return ReturnValue(false);
+  case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+  case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+  case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+    return hContext->MemoryAccounting.getInfo(propName, ReturnValue);
 
   default:
     break;
@@ -135,3 +185,54 @@ UR_APIEXPORT ur_result_t UR_APICALL urContextSetExtendedDeleter(
   hContext->setExtendedDeleter(pfnDeleter, pUserData);
   return UR_RESULT_SUCCESS;
 }
+
+bool ur_context_handle_t_::usesBufferMemPools() const noexcept {
+  return DisjointPoolConfigInstance.EnableBuffers;
+}
+
+void ur_context_handle_t_::deferBufferFree(
+    std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations,
+    std::vector<device_event_t> UseEvents) {
+  if (UseEvents.empty()) {
+    for (auto [Pool, Ptr] : Allocations) {
+      umfPoolFree(Pool, Ptr);
+    }
+    return;
+  }
+  std::lock_guard<std::mutex> Lock(DeferredBufferFreesMutex);
+  DeferredBufferFrees.push_back(
+      deferred_buffer_free{std::move(Allocations), std::move(UseEvents)});
+}
+
+void ur_context_handle_t_::freeDeferredBuffers(bool Wait) {
+  std::vector<deferred_buffer_free> Completed;
+  {
+    std::lock_guard<std::mutex> Lock(DeferredBufferFreesMutex);
+    if (DeferredBufferFrees.empty()) {
+      return;
+    }
+    auto IsCompleted = [Wait](const device_event_t &Event) {
+      auto Result = Wait ? hipEventSynchronize(Event.second)
+                         : hipEventQuery(Event.second);
+      return Result != hipErrorNotReady;
+    };
+    auto IsPending = [&](const deferred_buffer_free &Free) {
+      return !std::all_of(Free.UseEvents.begin(), Free.UseEvents.end(),
+                          IsCompleted);
+    };
+    auto It = std::stable_partition(DeferredBufferFrees.begin(),
+                                    DeferredBufferFrees.end(), IsPending);
+    std::move(It, DeferredBufferFrees.end(), std::back_inserter(Completed));
+    DeferredBufferFrees.erase(It, DeferredBufferFrees.end());
+  }
+
+  for (auto &Free : Completed) {
+    for (auto [Pool, Ptr] : Free.Allocations) {
+      umfPoolFree(Pool, Ptr);
+    }
+    for (auto [Device, Event] : Free.UseEvents) {
+      ScopedDevice Active(Device);
+      hipEventDestroy(Event);
+    }
+  }
+}
@@ -9,13 +9,19 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <mutex>
 #include <set>
+#include <utility>
+#include <vector>
 
 #include "common.hpp"
 #include "device.hpp"
 #include "platform.hpp"
+#include "ur_event_notifier.hpp"
+#include "ur_memory_accounting.hpp"
 
 #include <umf/memory_pool.h>
+#include <umf_helpers.hpp>
 
 typedef void (*ur_context_extended_deleter_t)(void *UserData);
 
@@ -89,14 +95,22 @@ struct ur_context_handle_t_ {
 
   std::atomic_uint32_t RefCount;
 
+  // Memory the context holds from the driver, declared before the pools,
+  // which return theirs as they're destroyed
+  ur::memory_accounting MemoryAccounting{this};
+
   ur_context_handle_t_(const ur_device_handle_t *Devs, uint32_t NumDevices)
-      : Devices{Devs, Devs + NumDevices}, RefCount{1} {
+      : Devices{Devs, Devs + NumDevices}, RefCount{1},
+        BufferMemPools(NumDevices + 1) {
     for (auto &Dev : Devices) {
       urDeviceRetain(Dev);
     }
   };
 
-  ~ur_context_handle_t_() {}
+  ~ur_context_handle_t_() {
+    freeDeferredBuffers(/*Wait=*/true);
+    BufferMemPools.clear();
+  }
 
   void invokeExtendedDeleters() {
     std::lock_guard<std::mutex> Guard(Mutex);
@@ -134,8 +148,49 @@ struct ur_context_handle_t_ {
 
   ur_usm_pool_handle_t getOwningURPool(umf_memory_pool_t *UMFPool);
 
+  // Trims every pool of the context, which share the budget
+  void trimPools(size_t MinBytesToKeep);
+
+  // Returns the UMF pool the buffers of the context allocate from in the
+  // memory of hDevice, or in pinned host memory if hDevice is null, which is
+  // created on first use. Returns nullptr if buffers aren't pooled.
+  umf_memory_pool_handle_t getBufferMemPool(ur_device_handle_t hDevice);
+
+  // Whether the buffers of the context allocate from getBufferMemPool
+  bool usesBufferMemPools() const noexcept;
+
+  // A native event of a device along with it
+  using device_event_t = std::pair<ur_device_handle_t, hipEvent_t>;
+
+  // Returns the pooled allocations of a released buffer to their pools once
+  // UseEvents, recorded after the work which may still use them, have
+  // completed. Unlike hipFree, umfPoolFree doesn't wait for that work.
+  void deferBufferFree(
+      std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations,
+      std::vector<device_event_t> UseEvents);
+
+  // Returns the allocations deferred by deferBufferFree whose uses have
+  // completed to their pools, waiting for all of them if Wait is set
+  void freeDeferredBuffers(bool Wait);
+
+  // Runs the callbacks set on the events of the context with
+  // urEventSetCallback
+  ur::event_notifier EventNotifier{urEventGetInfo, urEventRetain,
+                                   urEventRelease};
+
 private:
   std::mutex Mutex;
   std::vector<deleter_data> ExtendedDeleters;
   std::set<ur_usm_pool_handle_t> PoolHandles;
+
+  // Created by getBufferMemPool, indexed by device then for the host, and
+  // guarded by Mutex
+  std::vector<umf::pool_unique_handle_t> BufferMemPools;
+
+  struct deferred_buffer_free {
+    std::vector<std::pair<umf_memory_pool_handle_t, void *>> Allocations;
+    std::vector<device_event_t> UseEvents;
+  };
+  std::mutex DeferredBufferFreesMutex;
+  std::vector<deferred_buffer_free> DeferredBufferFrees;
 };
@@ -12,8 +12,45 @@
 #include "adapter.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "logger/ur_logger.hpp"
 
+#include <cstdlib>
 #include <sstream>
+#include <tuple>
+
+namespace {
+// Whether the device ScopedDevice made current last is trusted to still be
+// current. Off by default, as the application changing the current device
+// itself between two calls on a thread would then go unnoticed.
+const bool CacheCurrentDevice = [] {
+  const char *CacheStr = std::getenv("UR_HIP_CACHE_CURRENT_DEVICE");
+  return CacheStr && std::atoi(CacheStr) != 0;
+}();
+
+thread_local int CurrentDevice = -1;
+} // namespace
+
+void setCurrentDevice(int DeviceIndex) {
+  if (CacheCurrentDevice && DeviceIndex == CurrentDevice) {
+#ifdef NDEBUG
+    return;
+#else
+    int Original = -1;
+    UR_CHECK_ERROR(hipGetDevice(&Original));
+    if (Original == DeviceIndex) {
+      return;
+    }
+    logger::warning("The current HIP device was changed outside of the "
+                    "adapter, which UR_HIP_CACHE_CURRENT_DEVICE doesn't notice "
+                    "in release builds");
+#endif
+  }
+
+  UR_CHECK_ERROR(hipSetDevice(DeviceIndex));
+  CurrentDevice = DeviceIndex;
+}
+
+void forgetCurrentDevice() { CurrentDevice = -1; }
 
 int getAttribute(ur_device_handle_t Device, hipDeviceAttribute_t Attribute) {
   int Value;
@@ -21,6 +58,86 @@ int getAttribute(ur_device_handle_t Device, hipDeviceAttribute_t Attribute) {
   return Value;
 }
 
+ur_device_handle_t_::~ur_device_handle_t_() noexcept(false) {
+  // Devices go with the platform at the end of the process, when the HIP
+  // runtime may be gone already, so failures are ignored
+  if (hipSetDevice(DeviceIndex) != hipSuccess) {
+    return;
+  }
+  forgetCurrentDevice();
+  for (auto &[Key, Streams] : IdleStreams) {
+    for (hipStream_t Stream : Streams) {
+      std::ignore = hipStreamDestroy(Stream);
+    }
+  }
+  for (auto &Events : IdleEvents) {
+    for (hipEvent_t Event : Events) {
+      std::ignore = hipEventDestroy(Event);
+    }
+  }
+}
+
+hipStream_t ur_device_handle_t_::acquireStream(unsigned int Flags,
+                                               int Priority) {
+  {
+    std::lock_guard<std::mutex> Guard(IdleStreamsMutex);
+    auto It = IdleStreams.find({Flags, Priority});
+    if (It != IdleStreams.end() && !It->second.empty()) {
+      hipStream_t Stream = It->second.back();
+      It->second.pop_back();
+      NumIdleStreams--;
+      return Stream;
+    }
+  }
+  hipStream_t Stream;
+  UR_CHECK_ERROR(hipStreamCreateWithPriority(&Stream, Flags, Priority));
+  return Stream;
+}
+
+void ur_device_handle_t_::releaseStream(hipStream_t Stream, unsigned int Flags,
+                                        int Priority) {
+  // Bounds the hardware queues held by a device after a burst of queues
+  constexpr size_t MaxIdleStreams = 256;
+  {
+    std::lock_guard<std::mutex> Guard(IdleStreamsMutex);
+    if (NumIdleStreams < MaxIdleStreams) {
+      IdleStreams[{Flags, Priority}].push_back(Stream);
+      NumIdleStreams++;
+      return;
+    }
+  }
+  UR_CHECK_ERROR(hipStreamDestroy(Stream));
+}
+
+hipEvent_t ur_device_handle_t_::acquireEvent(bool Timing) {
+  {
+    std::lock_guard<std::mutex> Guard(IdleEventsMutex);
+    auto &Events = IdleEvents[Timing];
+    if (!Events.empty()) {
+      hipEvent_t Event = Events.back();
+      Events.pop_back();
+      return Event;
+    }
+  }
+  hipEvent_t Event;
+  UR_CHECK_ERROR(hipEventCreateWithFlags(
+      &Event, Timing ? hipEventDefault : hipEventDisableTiming));
+  return Event;
+}
+
+void ur_device_handle_t_::releaseEvent(hipEvent_t Event, bool Timing) {
+  constexpr size_t MaxIdleEvents = 4096;
+  {
+    std::lock_guard<std::mutex> Guard(IdleEventsMutex);
+    auto &Events = IdleEvents[Timing];
+    if (Events.size() < MaxIdleEvents) {
+      Events.push_back(Event);
+      return;
+    }
+  }
+  UR_CHECK_ERROR(hipEventDestroy(Event));
+}
+
 uint64_t ur_device_handle_t_::getElapsedTime(hipEvent_t ev) const {
   float Milliseconds = 0.0f;
 
@@ -33,11 +150,9 @@ uint64_t ur_device_handle_t_::getElapsedTime(hipEvent_t ev) const {
   return static_cast<uint64_t>(Milliseconds * 1.0e6);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   static constexpr uint32_t MaxWorkItemDimensions = 3u;
@@ -886,6 +1001,17 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     // HIP supports enqueueing native work through the urNativeEnqueueExp
     return ReturnValue(ur_bool_t{true});
   }
+  case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP: {
+    // HIP runs host tasks in stream order through hipLaunchHostFunc
+    return ReturnValue(ur_bool_t{true});
+  }
+  case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP: {
+    // The IPC event entry points aren't implemented by the HIP adapter
+    return ReturnValue(ur_bool_t{false});
+  }
+  case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP: {
+    return ReturnValue(ur_bool_t{false});
+  }
 
   case UR_DEVICE_INFO_GLOBAL_VARIABLE_SUPPORT:
     return ReturnValue(ur_bool_t{false});
@@ -933,12 +1059,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   }
   case UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP:
     return ReturnValue(false);
+  case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP: {
+    if (hDevice->getNumaNode() < 0) {
+      return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+    return ReturnValue(static_cast<uint32_t>(hDevice->getNumaNode()));
+  }
   default:
     break;
   }
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
+                                                    ur_device_info_t propName,
+                                                    size_t propSize,
+                                                    void *pPropValue,
+                                                    size_t *pPropSizeRet) {
+  return hDevice->InfoCache.get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [&](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
 /// \return UR_RESULT_SUCCESS if the function is executed successfully
 /// HIP devices are always root devices so retain always returns success.
 UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t) {
@@ -1083,13 +1227,13 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(ur_device_handle_t hDevice,
   if (!pDeviceTimestamp && !pHostTimestamp)
     return UR_RESULT_SUCCESS;
 
-  ur_event_handle_t_::native_type Event;
   ScopedDevice Active(hDevice);
 
   if (pDeviceTimestamp) {
-    UR_CHECK_ERROR(hipEventCreateWithFlags(&Event, hipEventDefault));
+    hipEvent_t Event = hDevice->acquireEvent(true);
     UR_CHECK_ERROR(hipEventRecord(Event));
     *pDeviceTimestamp = hDevice->getElapsedTime(Event);
+    hDevice->releaseEvent(Event, true);
   }
 
   if (pHostTimestamp) {
@@ -13,6 +13,11 @@
 
 #include <ur/ur.hpp>
 
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
 /// UR device mapping to a hipDevice_t.
 /// Includes an observer pointer to the platform,
 /// and implements the reference counting semantics since
@@ -34,6 +39,18 @@ private:
   int DeviceMaxLocalMem{0};
   int ManagedMemSupport{0};
   int ConcurrentManagedAccess{0};
+  int NumaNode{-1};
+
+  // Streams of released queues, by creation flags and priority, which the
+  // next queues on the device use instead of creating their own
+  std::mutex IdleStreamsMutex;
+  std::map<std::pair<unsigned int, int>, std::vector<hipStream_t>> IdleStreams;
+  size_t NumIdleStreams{0};
+
+  // Native events of released UR events, without and with timing, which
+  // the next events on the device use instead of creating their own
+  std::mutex IdleEventsMutex;
+  std::vector<hipEvent_t> IdleEvents[2];
 
 public:
   ur_device_handle_t_(native_type HipDevice, hipEvent_t EvBase,
@@ -57,9 +74,15 @@ public:
     UR_CHECK_ERROR(hipDeviceGetAttribute(
         &ConcurrentManagedAccess, hipDeviceAttributeConcurrentManagedAccess,
         HIPDevice));
+
+    char PciBusId[16];
+    if (hipDeviceGetPCIBusId(PciBusId, sizeof(PciBusId), HIPDevice) ==
+        hipSuccess) {
+      NumaNode = ur_pci_numa_node(PciBusId);
+    }
   }
 
-  ~ur_device_handle_t_() noexcept(false) {}
+  ~ur_device_handle_t_() noexcept(false);
 
   native_type get() const noexcept { return HIPDevice; };
 
@@ -88,10 +111,43 @@ public:
   int getConcurrentManagedAccess() const noexcept {
     return ConcurrentManagedAccess;
   };
+
+  // NUMA node of the host memory closest to the device, or -1 if unknown
+  int getNumaNode() const noexcept { return NumaNode; };
+
+  // Returns an idle stream with the given creation flags and priority,
+  // creating one if there is none. Must be called with the device active.
+  hipStream_t acquireStream(unsigned int Flags, int Priority);
+
+  // Keeps Stream, which must have no pending work, for a later
+  // acquireStream, or destroys it if enough streams are already idle
+  void releaseStream(hipStream_t Stream, unsigned int Flags, int Priority);
+
+  // Returns an idle native event, created with timing disabled unless
+  // Timing is set, creating one if there is none
+  hipEvent_t acquireEvent(bool Timing);
+
+  // Keeps Event, created as acquireEvent(Timing) would, for a later
+  // acquireEvent, or destroys it if enough events are already idle. Event may
+  // still be pending, as recording it again replaces its previous record.
+  void releaseEvent(hipEvent_t Event, bool Timing);
+
+  // Values of the immutable properties already returned by urDeviceGetInfo
+  ur::DeviceInfoCache InfoCache;
 };
 
 int getAttribute(ur_device_handle_t Device, hipDeviceAttribute_t Attribute);
 
+/// Makes the device of index DeviceIndex the current device of the calling
+/// thread. The device made current last is remembered per thread and, with
+/// UR_HIP_CACHE_CURRENT_DEVICE set, trusted to still be current without
+/// setting it again. Debug builds check it anyway.
+void setCurrentDevice(int DeviceIndex);
+
+/// Forgets the device remembered as current on the calling thread, after code
+/// outside the adapter may have changed it.
+void forgetCurrentDevice();
+
 namespace {
 /// Scoped Device is used across all UR HIP plugin implementation to activate
 /// the native Device on the current thread. The ScopedDevice does not
@@ -104,7 +160,7 @@ public:
     if (!hDevice) {
       throw UR_RESULT_ERROR_INVALID_DEVICE;
     }
-    UR_CHECK_ERROR(hipSetDevice(hDevice->getIndex()));
+    setCurrentDevice(hDevice->getIndex());
   }
 };
 } // namespace
@@ -17,6 +17,9 @@
 #include "queue.hpp"
 #include "ur_api.h"
 
+#include <algorithm>
+#include <cstring>
+#include <memory>
 #include <ur/ur.hpp>
 
 extern size_t imageElementByteSize(hipArray_Format ArrayFormat);
@@ -158,6 +161,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedDevice Active(hQueue->getDevice());
@@ -214,6 +218,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
         hBuffer->LastQueueWritingToMemObj->getDevice() != hQueue->getDevice()) {
       hQueue = hBuffer->LastQueueWritingToMemObj;
     }
+    hBuffer->recordUse(hQueue);
 
     auto Device = hQueue->getDevice();
     ScopedDevice Active(Device);
@@ -296,6 +301,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
                                      phEventWaitList));
 
+    if (hQueue->getContext()->usesBufferMemPools()) {
+      for (auto &MemArg : hKernel->Args.MemObjArgs) {
+        MemArg.Mem->recordUse(hQueue);
+      }
+    }
+
     // For memory migration across devices in the same context
     if (hQueue->getContext()->Devices.size() > 1) {
       for (auto &MemArg : hKernel->Args.MemObjArgs) {
@@ -346,6 +357,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                                numEventsInWaitList, phEventWaitList, phEvent);
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches) {
+  // There are no queue locks to share, so the launches are made in turn
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    const auto &Launch = pLaunches[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    if (Launch.numArgs) {
+      Result = urKernelSetArgsExp(Launch.hKernel, Launch.numArgs, Launch.pArgs);
+      if (Result != UR_RESULT_SUCCESS) {
+        return Result;
+      }
+    }
+    Result = urEnqueueKernelLaunch(
+        Launch.hQueue, Launch.hKernel, Launch.workDim, Launch.pGlobalWorkOffset,
+        Launch.pGlobalWorkSize, Launch.pLocalWorkSize,
+        Launch.numEventsInWaitList, Launch.phEventWaitList, Launch.phEvent);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 /// Enqueues a wait on the given queue for all events.
 /// See \ref enqueueEventWait
 ///
@@ -381,7 +416,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         numEventsInWaitList,
         reinterpret_cast<const ur_event_handle_t *>(phEventWaitList), Guard,
         &StreamToken);
-    {
+    // The commands of a capture are all on its stream, in order, so they
+    // already wait on the commands captured before them
+    if (!hQueue->isCapturing()) {
       std::lock_guard<std::mutex> Guard(hQueue->BarrierMutex);
       if (hQueue->BarrierEvent == nullptr) {
         UR_CHECK_ERROR(hipEventCreate(&hQueue->BarrierEvent));
@@ -527,6 +564,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         hBuffer->LastQueueWritingToMemObj->getDevice() != hQueue->getDevice()) {
       hQueue = hBuffer->LastQueueWritingToMemObj;
     }
+    hBuffer->recordUse(hQueue);
 
     auto Device = hQueue->getDevice();
     ScopedDevice Active(Device);
@@ -576,6 +614,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   void *DevPtr = std::get<BufferMem>(hBuffer->Mem).getVoid(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedDevice Active(hQueue->getDevice());
@@ -624,6 +663,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
 
+  hBufferSrc->recordUse(hQueue);
+  hBufferDst->recordUse(hQueue);
+
   try {
     ScopedDevice Active(hQueue->getDevice());
     auto Stream = hQueue->getNextTransferStream();
@@ -672,6 +714,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
   void *DstPtr =
       std::get<BufferMem>(hBufferDst->Mem).getVoid(hQueue->getDevice());
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+  hBufferSrc->recordUse(hQueue);
+  hBufferDst->recordUse(hQueue);
 
   try {
     ScopedDevice Active(hQueue->getDevice());
@@ -726,15 +770,53 @@ static inline void memsetRemainPattern(hipStream_t Stream, uint32_t PatternSize,
   }
 }
 
+// Counts the commands of a fill by copies, which writes the pattern once and
+// then copies the filled part after itself, doubling it each time.
+static size_t getNumFillCopies(uint32_t PatternSize, size_t Size) {
+  size_t NumCopies = 1;
+  for (size_t Filled = PatternSize; Filled < Size; Filled *= 2) {
+    ++NumCopies;
+  }
+  return NumCopies;
+}
+
 // HIP has no memset functions that allow setting values more than 4 bytes. UR
 // API lets you pass an arbitrary "pattern" to the buffer fill, which can be
 // more than 4 bytes. We must break up the pattern into 1 byte values, and set
 // the buffer using multiple strided calls.  The first 4 patterns are set
 // using hipMemsetD32Async then all subsequent 1 byte patterns are set using
 // hipMemset2DAsync which is called for each pattern.
+//
+// That is one command per byte of the pattern, so when it takes fewer
+// commands the buffer is filled by copies instead: the pattern is copied from
+// the host once, and the filled part is then copied after itself until the
+// buffer is full, each copy running at device bandwidth. As it doesn't use
+// hipMemset2D, this also avoids the ROCm bug worked around below. The pattern
+// is copied from a copy of its own, which the stream frees once the copy
+// completed, as the caller's may be gone by then.
+static void freeFillPattern(void *Pattern) {
+  delete[] static_cast<uint8_t *>(Pattern);
+}
+
 ur_result_t commonMemSetLargePattern(hipStream_t Stream, uint32_t PatternSize,
                                      size_t Size, const void *pPattern,
                                      hipDeviceptr_t Ptr) {
+  if (getNumFillCopies(PatternSize, Size) < PatternSize - 3) {
+    auto Dst = static_cast<uint8_t *>(Ptr);
+    std::unique_ptr<uint8_t[]> Pattern{new uint8_t[PatternSize]};
+    std::memcpy(Pattern.get(), pPattern, PatternSize);
+    UR_CHECK_ERROR(hipMemcpyAsync(Dst, Pattern.get(), PatternSize,
+                                  hipMemcpyDefault, Stream));
+    UR_CHECK_ERROR(hipLaunchHostFunc(Stream, freeFillPattern, Pattern.get()));
+    Pattern.release();
+    for (size_t Filled = PatternSize; Filled < Size; Filled *= 2) {
+      UR_CHECK_ERROR(hipMemcpyAsync(Dst + Filled, Dst,
+                                    std::min(Filled, Size - Filled),
+                                    hipMemcpyDefault, Stream));
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
 
   // Get 4-byte chunk of the pattern and call hipMemsetD32Async
   auto Count32 = Size / sizeof(uint32_t);
@@ -786,6 +868,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
 
   std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
   hBuffer->setLastQueueWritingToMemObj(hQueue);
+  hBuffer->recordUse(hQueue);
 
   try {
     ScopedDevice Active(hQueue->getDevice());
@@ -1273,6 +1356,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     }
   } catch (ur_result_t Err) {
     return Err;
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   }
 
   return UR_RESULT_SUCCESS;
@@ -1312,6 +1397,43 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::unique_ptr<ur_event_handle_t_> EventPtr{nullptr};
+
+  try {
+    // The copies are put on a single stream, behind a single wait and event
+    ScopedDevice Active(hQueue->getDevice());
+    hipStream_t HIPStream = hQueue->getNextTransferStream();
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      EventPtr =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_USM_MEMCPY_BATCH_EXP, hQueue, HIPStream));
+      UR_CHECK_ERROR(EventPtr->start());
+    }
+    for (uint32_t i = 0; i < numCopies; i++) {
+      UR_CHECK_ERROR(hipMemcpyAsync(ppDst[i], ppSrc[i], pSizes[i],
+                                    hipMemcpyDefault, HIPStream));
+    }
+    if (phEvent) {
+      UR_CHECK_ERROR(EventPtr->record());
+    }
+    if (blocking) {
+      UR_CHECK_ERROR(hipStreamSynchronize(HIPStream));
+    }
+    if (phEvent) {
+      *phEvent = EventPtr.release();
+    }
+  } catch (ur_result_t Err) {
+    return Err;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, const void *pMem, size_t size,
     ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
@@ -1914,3 +2036,70 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
   }
   return Result;
 }
+
+namespace {
+struct host_task_t {
+  ur_exp_host_task_function_t Fn;
+  void *UserData;
+};
+
+// Called by the HIP runtime once the commands before the task in its stream
+// completed. The stream's later commands start once it returned.
+void runHostTask(void *Data) {
+  std::unique_ptr<host_task_t> Task{static_cast<host_task_t *>(Data)};
+  Task->Fn(Task->UserData);
+}
+} // namespace
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ur_exp_host_task_function_t pfnHostTask,
+    void *pUserData, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  ur_result_t Result = UR_RESULT_SUCCESS;
+  std::unique_ptr<ur_event_handle_t_> RetImplEvent{nullptr};
+
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+
+    uint32_t StreamToken;
+    ur_stream_guard Guard;
+    hipStream_t HIPStream = hQueue->getNextComputeStream(
+        numEventsInWaitList, phEventWaitList, Guard, &StreamToken);
+    UR_CHECK_ERROR(enqueueEventsWait(hQueue, HIPStream, numEventsInWaitList,
+                                     phEventWaitList));
+    if (phEvent) {
+      RetImplEvent =
+          std::unique_ptr<ur_event_handle_t_>(ur_event_handle_t_::makeNative(
+              UR_COMMAND_ENQUEUE_HOST_TASK_EXP, hQueue, HIPStream,
+              StreamToken));
+      UR_CHECK_ERROR(RetImplEvent->start());
+    }
+
+    auto Task =
+        std::make_unique<host_task_t>(host_task_t{pfnHostTask, pUserData});
+    UR_CHECK_ERROR(hipLaunchHostFunc(HIPStream, runHostTask, Task.get()));
+    Task.release();
+
+    if (phEvent) {
+      UR_CHECK_ERROR(RetImplEvent->record());
+      *phEvent = RetImplEvent.release();
+    }
+  } catch (ur_result_t Err) {
+    Result = Err;
+  } catch (std::bad_alloc &) {
+    Result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return Result;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
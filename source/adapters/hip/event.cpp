@@ -20,7 +20,7 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
                                        hipEvent_t EvStart, hipStream_t Stream,
                                        uint32_t StreamToken)
     : CommandType{Type}, RefCount{1}, HasOwnership{true},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       StreamToken{StreamToken}, EventId{0}, EvEnd{EvEnd}, EvStart{EvStart},
       EvQueued{EvQueued}, Queue{Queue}, Stream{Stream}, Context{Context} {
   urQueueRetain(Queue);
@@ -30,7 +30,7 @@ ur_event_handle_t_::ur_event_handle_t_(ur_command_t Type,
 ur_event_handle_t_::ur_event_handle_t_(ur_context_handle_t Context,
                                        hipEvent_t EventNative)
     : CommandType{UR_COMMAND_EVENTS_WAIT}, RefCount{1}, HasOwnership{false},
-      HasBeenWaitedOn{false}, IsRecorded{false}, IsStarted{false},
+      HasCompleted{false}, IsRecorded{false}, IsStarted{false},
       IsInterop{true}, StreamToken{std::numeric_limits<uint32_t>::max()},
       EventId{0}, EvEnd{EventNative}, EvStart{nullptr}, EvQueued{nullptr},
       Queue{nullptr}, Stream{nullptr}, Context{Context} {
@@ -66,7 +66,7 @@ bool ur_event_handle_t_::isCompleted() const {
   if (!IsRecorded) {
     return false;
   }
-  if (!HasBeenWaitedOn) {
+  if (!HasCompleted) {
     const hipError_t Result = hipEventQuery(EvEnd);
     if (Result != hipSuccess && Result != hipErrorNotReady) {
       UR_CHECK_ERROR(Result);
@@ -75,6 +75,7 @@ bool ur_event_handle_t_::isCompleted() const {
     if (Result == hipErrorNotReady) {
       return false;
     }
+    HasCompleted = true;
   }
   return true;
 }
@@ -127,7 +128,7 @@ ur_result_t ur_event_handle_t_::wait() {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     UR_CHECK_ERROR(hipEventSynchronize(EvEnd));
-    HasBeenWaitedOn = true;
+    HasCompleted = true;
   } catch (ur_result_t Error) {
     Result = Error;
   }
@@ -140,11 +141,16 @@ ur_result_t ur_event_handle_t_::release() {
     return UR_RESULT_SUCCESS;
 
   assert(Queue != nullptr);
-  UR_CHECK_ERROR(hipEventDestroy(EvEnd));
-
-  if (Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent()) {
-    UR_CHECK_ERROR(hipEventDestroy(EvQueued));
-    UR_CHECK_ERROR(hipEventDestroy(EvStart));
+  // The native events go back to the device for the next UR events, as
+  // creating them is expensive on ROCm
+  const bool Timing =
+      Queue->URFlags & UR_QUEUE_FLAG_PROFILING_ENABLE || isTimestampEvent();
+  ur_device_handle_t Device = Queue->getDevice();
+  Device->releaseEvent(EvEnd, Timing);
+
+  if (Timing) {
+    Device->releaseEvent(EvQueued, true);
+    Device->releaseEvent(EvStart, true);
   }
 
   return UR_RESULT_SUCCESS;
@@ -161,7 +167,16 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
 
       return Event->wait();
     };
-    return forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    ur_result_t Result =
+        forLatestEvents(phEventWaitList, numEvents, WaitFunc);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the events have run once the wait returns
+      for (uint32_t i = 0; i < numEvents; i++) {
+        phEventWaitList[i]->getContext()->EventNotifier.flush(
+            phEventWaitList[i]);
+      }
+    }
+    return Result;
   } catch (ur_result_t Err) {
     return Err;
   } catch (...) {
@@ -240,11 +255,39 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
   return {};
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventSetCallback(ur_event_handle_t,
-                                                       ur_execution_info_t,
-                                                       ur_event_callback_t,
-                                                       void *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+/// The events are polled with hipEventQuery from the notifier thread of the
+/// context, as hipLaunchHostFunc would only tell when the command completes,
+/// and not for interop events.
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
+                   ur_event_callback_t pfnNotify, void *pUserData) {
+  return hEvent->getContext()->EventNotifier.add(hEvent, execStatus, pfnNotify,
+                                                 pUserData);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventWaitAnyExp(uint32_t numEvents, const ur_event_handle_t *phEventWaitList,
+                  uint32_t *pIndex) {
+  UR_ASSERT(numEvents > 0, UR_RESULT_ERROR_INVALID_VALUE);
+  try {
+    ScopedDevice Active(phEventWaitList[0]->getContext()->getDevices()[0]);
+
+    auto QueryFunc = [&](uint32_t i, bool &Completed) -> ur_result_t {
+      Completed = phEventWaitList[i]->isCompleted();
+      return UR_RESULT_SUCCESS;
+    };
+    ur_result_t Result = ur::waitAnyEvent(numEvents, QueryFunc, *pIndex);
+    if (Result == UR_RESULT_SUCCESS) {
+      // The callbacks of the event have run once the wait returns
+      phEventWaitList[*pIndex]->getContext()->EventNotifier.flush(
+          phEventWaitList[*pIndex]);
+    }
+    return Result;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
@@ -317,3 +360,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
   return UR_RESULT_SUCCESS;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventCreateIPCExp(ur_context_handle_t,
+                                                        ur_device_handle_t,
+                                                        ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventGetIPCHandleExp(ur_event_handle_t, ur_exp_ipc_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t, ur_device_handle_t, const ur_exp_ipc_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
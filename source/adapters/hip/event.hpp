@@ -10,6 +10,7 @@
 #pragma once
 
 #include "common.hpp"
+#include "device.hpp"
 #include "queue.hpp"
 
 /// UR Event mapping to hipEvent_t
@@ -42,6 +43,9 @@ public:
 
   bool isCompleted() const;
 
+  // Whether the event was found complete before, without querying it again
+  bool isKnownCompleted() const noexcept { return HasCompleted; }
+
   bool isInterop() const noexcept { return IsInterop; };
 
   uint32_t getExecutionStatus() const {
@@ -88,13 +92,13 @@ public:
     if (RequiresTimings) {
       Queue->createHostSubmitTimeStream();
     }
+    ur_device_handle_t Device = Queue->getDevice();
     native_type EvEnd{nullptr}, EvQueued{nullptr}, EvStart{nullptr};
-    UR_CHECK_ERROR(hipEventCreateWithFlags(
-        &EvEnd, RequiresTimings ? hipEventDefault : hipEventDisableTiming));
+    EvEnd = Device->acquireEvent(RequiresTimings);
 
     if (RequiresTimings) {
-      UR_CHECK_ERROR(hipEventCreateWithFlags(&EvQueued, hipEventDefault));
-      UR_CHECK_ERROR(hipEventCreateWithFlags(&EvStart, hipEventDefault));
+      EvQueued = Device->acquireEvent(true);
+      EvStart = Device->acquireEvent(true);
     }
 
     return new ur_event_handle_t_(Type, Queue->getContext(), Queue, EvEnd,
@@ -128,9 +132,9 @@ private:
 
   bool HasOwnership; // Signifies if event owns the native type.
 
-  bool HasBeenWaitedOn; // Signifies whether the event has been waited
-                        // on through a call to wait(), which implies
-                        // that it has completed.
+  // Signifies whether the event is known to have completed, from a call to
+  // wait() or from a query that found it complete.
+  mutable std::atomic_bool HasCompleted;
 
   bool IsRecorded; // Signifies wether a native HIP event has been recorded
                    // yet.
@@ -161,10 +165,24 @@ private:
                                // same context associated with the Queue member.
 };
 
+// Describes the events of wait lists to ur::normalizeEventWaitList. The
+// commands of a stream run in order, interop events aren't on any of ours.
+struct ur_event_wait_traits_ {
+  static const void *sequence(ur_event_handle_t Event) {
+    return Event->isInterop() ? nullptr
+                              : static_cast<const void *>(Event->getStream());
+  }
+  static uint64_t order(ur_event_handle_t Event) { return Event->getEventId(); }
+  static bool isCompleted(ur_event_handle_t Event) {
+    return Event->isKnownCompleted();
+  }
+};
+
 // Iterate over `EventWaitList` and apply the given callback `F` to the
-// latest event on each queue therein. The callback must take a single
-// ur_event_handle_t argument and return a ur_result_t. If the callback returns
-// an error, the iteration terminates and the error is returned.
+// latest event on each stream therein, skipping duplicates and events known to
+// have completed. The callback must take a single ur_event_handle_t argument
+// and return a ur_result_t. If the callback returns an error, the iteration
+// terminates and the error is returned.
 template <typename Func>
 ur_result_t forLatestEvents(const ur_event_handle_t *EventWaitList,
                             size_t NumEventsInWaitList, Func &&F) {
@@ -175,31 +193,16 @@ ur_result_t forLatestEvents(const ur_event_handle_t *EventWaitList,
 
   // Fast path if we only have a single event
   if (NumEventsInWaitList == 1) {
+    if (EventWaitList[0] && EventWaitList[0]->isKnownCompleted()) {
+      return UR_RESULT_SUCCESS;
+    }
     return F(EventWaitList[0]);
   }
 
-  std::vector<ur_event_handle_t> Events{EventWaitList,
-                                        EventWaitList + NumEventsInWaitList};
-  std::sort(Events.begin(), Events.end(),
-            [](ur_event_handle_t E0, ur_event_handle_t E1) {
-              // Tiered sort creating sublists of streams (smallest value first)
-              // in which the corresponding events are sorted into a sequence of
-              // newest first.
-              return E0->getStream() < E1->getStream() ||
-                     (E0->getStream() == E1->getStream() &&
-                      E0->getEventId() > E1->getEventId());
-            });
-
-  hipStream_t LastSeenStream = 0;
-  for (size_t i = 0; i < Events.size(); i++) {
-    auto Event = Events[i];
-    if (!Event || (i != 0 && !Event->isInterop() &&
-                   Event->getStream() == LastSeenStream)) {
-      continue;
-    }
-
-    LastSeenStream = Event->getStream();
-
+  std::vector<ur_event_handle_t> Events;
+  ur::normalizeEventWaitList<ur_event_wait_traits_>(
+      EventWaitList, NumEventsInWaitList, Events);
+  for (auto Event : Events) {
     auto Result = F(Event);
     if (Result != UR_RESULT_SUCCESS) {
       return Result;
@@ -177,6 +177,47 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
   std::ignore = pGroupCountRet;
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                   const ur_exp_kernel_arg_t *pArgs) {
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const auto &Arg = pArgs[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      Result = urKernelSetArgValue(hKernel, Arg.index, Arg.size, nullptr,
+                                   Arg.value.value);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      Result =
+          urKernelSetArgPointer(hKernel, Arg.index, nullptr, Arg.value.pointer);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      ur_kernel_arg_mem_obj_properties_t Properties = {
+          UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+          Arg.value.memObjTuple.flags ? Arg.value.memObjTuple.flags
+                                      : UR_MEM_FLAG_READ_WRITE};
+      Result = urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                    Arg.value.memObjTuple.hMem);
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      Result = urKernelSetArgLocal(hKernel, Arg.index, Arg.size, nullptr);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      Result =
+          urKernelSetArgSampler(hKernel, Arg.index, nullptr, Arg.value.sampler);
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
@@ -298,8 +339,13 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     auto Device = hKernel->getProgram()->getDevice();
-    hKernel->Args.addMemObjArg(argIndex, hArgValue,
-                               Properties ? Properties->memoryAccess : 0);
+    ur_mem_flags_t MemAccess = Properties ? Properties->memoryAccess : 0;
+    // Kernels don't write to read-only memory objects, so the copies made on
+    // the other devices of the context stay valid whatever the access given
+    if (hArgValue->MemFlags & UR_MEM_FLAG_READ_ONLY) {
+      MemAccess = UR_MEM_FLAG_READ_ONLY;
+    }
+    hKernel->Args.addMemObjArg(argIndex, hArgValue, MemAccess);
     if (hArgValue->isImage()) {
       auto array = std::get<SurfaceMem>(hArgValue->Mem).getArray(Device);
       hipArray_Format Format{};
@@ -12,8 +12,11 @@
 #include "common.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include <algorithm>
+#include <atomic>
 #include <cassert>
 #include <memory>
+#include <mutex>
 #include <unordered_map>
 #include <variant>
 
@@ -76,16 +79,26 @@ struct BufferMem {
 
   AllocMode MemAllocMode;
 
+  /// Offset of a sub-buffer in its parent
+  size_t SubBufferOffset = 0;
+
 private:
   // Vector of HIP pointers
   std::vector<native_type> Ptrs;
+  // Context the allocations are made in, from its buffer pools if any
+  ur_context_handle_t Context;
 
 public:
   BufferMem(ur_context_handle_t Context, ur_mem_handle_t OuterMemStruct,
             AllocMode Mode, void *HostPtr, size_t Size)
       : OuterMemStruct{OuterMemStruct}, HostPtr{HostPtr}, Size{Size},
         PtrToBufferMap{}, MemAllocMode{Mode},
-        Ptrs(Context->Devices.size(), native_type{0}){};
+        Ptrs(Context->Devices.size(), native_type{0}), Context{Context} {};
+
+  // Sub-buffer constructor, a view of Size bytes at Offset in the buffer
+  // Parent, whose allocations it resolves on use
+  BufferMem(ur_mem_handle_t Parent, ur_mem_handle_t OuterMemStruct,
+            size_t Offset, size_t Size);
 
   // This will allocate memory on device if there isn't already an active
   // allocation on the device
@@ -93,6 +106,9 @@ public:
     return getPtrWithOffset(Device, 0);
   }
 
+  // Whether there is an allocation on Device already, without making one
+  bool isAllocatedOn(const ur_device_handle_t Device);
+
   // This will allocate memory on device with index Index if there isn't already
   // an active allocation on the device
   native_type getPtrWithOffset(const ur_device_handle_t Device, size_t Offset);
@@ -144,17 +160,28 @@ public:
     PtrToBufferMap.erase(MapPtr);
   }
 
-  ur_result_t clear() {
+  /// Frees the allocations, the pooled ones once UseEvents have completed,
+  /// see ur_mem_handle_t_::recordUse
+  ur_result_t
+  clear(std::vector<ur_context_handle_t_::device_event_t> UseEvents) {
     if (Parent != nullptr) {
       return UR_RESULT_SUCCESS;
     }
 
+    std::vector<std::pair<umf_memory_pool_handle_t, void *>> Pooled;
     switch (MemAllocMode) {
     case AllocMode::CopyIn:
     case AllocMode::Classic:
-      for (auto &DevPtr : Ptrs) {
-        if (DevPtr != native_type{0}) {
-          UR_CHECK_ERROR(hipFree(DevPtr));
+      for (size_t I = 0; I < Ptrs.size(); ++I) {
+        if (Ptrs[I] == native_type{0}) {
+          continue;
+        }
+        if (auto Pool = Context->getBufferMemPool(Context->getDevices()[I])) {
+          Pooled.emplace_back(Pool, Ptrs[I]);
+        } else {
+          UR_CHECK_ERROR(hipFree(Ptrs[I]));
+          Context->MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                           Size);
         }
       }
       break;
@@ -162,7 +189,16 @@ public:
       UR_CHECK_ERROR(hipHostUnregister(HostPtr));
       break;
     case AllocMode::AllocHostPtr:
-      UR_CHECK_ERROR(hipHostFree(HostPtr));
+      if (auto Pool = Context->getBufferMemPool(nullptr)) {
+        Pooled.emplace_back(Pool, HostPtr);
+      } else {
+        UR_CHECK_ERROR(hipHostFree(HostPtr));
+        Context->MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                         Size);
+      }
+    }
+    if (!Pooled.empty() || !UseEvents.empty()) {
+      Context->deferBufferFree(std::move(Pooled), std::move(UseEvents));
     }
     return UR_RESULT_SUCCESS;
   }
@@ -177,6 +213,8 @@ struct SurfaceMem {
 private:
   std::vector<hipArray *> Arrays;
   std::vector<hipSurfaceObject_t> SurfObjs;
+  /// Context the arrays are counted in
+  ur_context_handle_t Context;
 
 public:
   ur_mem_handle_t OuterMemStruct;
@@ -191,7 +229,7 @@ public:
              ur_image_format_t ImageFormat, ur_image_desc_t ImageDesc,
              void *HostPtr)
       : Arrays(Context->Devices.size(), nullptr),
-        SurfObjs(Context->Devices.size(), nullptr),
+        SurfObjs(Context->Devices.size(), nullptr), Context{Context},
         OuterMemStruct{OuterMemStruct}, ImageFormat{ImageFormat},
         ImageDesc{ImageDesc}, ArrayDesc{}, HostPtr{HostPtr} {
     // We have to use hipArray3DCreate, which has some caveats. The height and
@@ -261,10 +299,19 @@ public:
 
   ur_mem_type_t getImageType() const noexcept { return ImageDesc.type; }
 
+  // Bytes of the array of each device, the unused dimensions being 0
+  size_t getArraySize() const {
+    return ArrayDesc.Width * std::max<size_t>(ArrayDesc.Height, 1) *
+           std::max<size_t>(ArrayDesc.Depth, 1) * ArrayDesc.NumChannels *
+           PixelTypeSizeBytes;
+  }
+
   ur_result_t clear() {
     for (auto Array : Arrays) {
       if (Array) {
         UR_CHECK_ERROR(hipFreeArray(Array));
+        Context->MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE,
+                                         getArraySize());
       }
     }
     for (auto Surf : SurfObjs) {
@@ -307,6 +354,10 @@ public:
 /// Migrations will occur in both cases if the most recent version of data
 /// is on a different device, marked by LastQueueWritingToMemObj->getDevice().
 ///
+/// Kernels don't write to UR_MEM_FLAG_READ_ONLY memory objects, so these are
+/// copied to each device once, on first use, and only again after a write
+/// from the host such as urEnqueueMemBufferWrite.
+///
 struct ur_mem_handle_t_ {
 
   // TODO: Move as much shared data up as possible
@@ -337,6 +388,12 @@ struct ur_mem_handle_t_ {
 
   ur_mutex MemoryAllocationMutex; // A mutex for allocations
 
+  // Queues which may use the pooled allocations of the buffer, retained until
+  // its release, see recordUse
+  std::mutex UseQueuesMutex;
+  std::vector<ur_queue_handle_t> UseQueues;
+  std::atomic<ur_queue_handle_t> LastUseQueue{nullptr};
+
   /// A UR Memory object represents either plain memory allocations ("Buffers"
   /// in OpenCL) or typed allocations ("Images" in OpenCL).
   /// In HIP their API handlers are different. Whereas "Buffers" are allocated
@@ -354,23 +411,13 @@ struct ur_mem_handle_t_ {
   }
 
   // Subbuffer constructor
-  ur_mem_handle_t_(ur_mem Parent, size_t SubBufferOffset)
+  ur_mem_handle_t_(ur_mem Parent, size_t SubBufferOffset,
+                   size_t SubBufferSize)
       : Context{Parent->Context}, RefCount{1}, MemFlags{Parent->MemFlags},
         HaveMigratedToDeviceSinceLastWrite(Parent->Context->Devices.size(),
                                            false),
-        Mem{BufferMem{std::get<BufferMem>(Parent->Mem)}} {
-    auto &SubBuffer = std::get<BufferMem>(Mem);
-    SubBuffer.Parent = Parent;
-    SubBuffer.OuterMemStruct = this;
-    if (SubBuffer.HostPtr) {
-      SubBuffer.HostPtr =
-          static_cast<char *>(SubBuffer.HostPtr) + SubBufferOffset;
-    }
-    for (auto &DevPtr : SubBuffer.Ptrs) {
-      if (DevPtr) {
-        DevPtr = static_cast<char *>(DevPtr) + SubBufferOffset;
-      }
-    }
+        Mem{std::in_place_type<BufferMem>, Parent, this, SubBufferOffset,
+            SubBufferSize} {
     urMemRetain(Parent);
   }
 
@@ -412,7 +459,9 @@ struct ur_mem_handle_t_ {
 
   ur_result_t clear() {
     if (isBuffer()) {
-      return std::get<BufferMem>(Mem).clear();
+      return std::get<BufferMem>(Mem).clear(
+          isSubBuffer() ? std::vector<ur_context_handle_t_::device_event_t>{}
+                        : takeUseEvents());
     }
     return std::get<SurfaceMem>(Mem).clear();
   }
@@ -425,6 +474,15 @@ struct ur_mem_handle_t_ {
 
   uint32_t getReferenceCount() const noexcept { return RefCount; }
 
+  /// Called for every command of hQueue using the buffer. A pooled allocation
+  /// goes back to its pool right away when released, so it is only released
+  /// once the work submitted to these queues by then has completed.
+  void recordUse(ur_queue_handle_t hQueue);
+
+  /// Records an event on each busy stream of the queues recorded by
+  /// recordUse, and releases them
+  std::vector<ur_context_handle_t_::device_event_t> takeUseEvents();
+
   void setLastQueueWritingToMemObj(ur_queue_handle_t WritingQueue) {
     if (LastQueueWritingToMemObj != nullptr) {
       urQueueRelease(LastQueueWritingToMemObj);
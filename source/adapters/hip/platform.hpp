@@ -12,6 +12,7 @@
 #include "common.hpp"
 #include "device.hpp"
 
+#include <ur_peer_topology.hpp>
 #include <vector>
 
 /// A UR platform stores all known UR devices,
@@ -21,4 +22,10 @@
 ///
 struct ur_platform_handle_t_ {
   std::vector<std::unique_ptr<ur_device_handle_t_>> Devices;
+
+  /// Peer links between the devices, queried on first use
+  ur::peer_topology &getPeerTopology();
+
+private:
+  ur::peer_topology PeerTopology;
 };
@@ -9,6 +9,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "program.hpp"
+#include "program_cache.hpp"
+#include "queue.hpp"
 #include "ur_util.hpp"
 
 #ifdef SYCL_ENABLE_KERNEL_FUSION
@@ -141,6 +143,26 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
   return UR_RESULT_ERROR_UNKNOWN;
 #else
   assert(IsRelocatable && "Not a relocatable input");
+  std::string ISA = "amdgcn-amd-amdhsa--";
+  hipDeviceProp_t Props;
+  detail::ur::assertion(hipGetDeviceProperties(&Props, getDevice()->get()) ==
+                        hipSuccess);
+  ISA += Props.gcnArchName;
+
+  // The link is the only compilation of HIP programs, kept in the program
+  // cache as other processes would redo it
+  auto Cache = ProgramCache::get();
+  std::string Key;
+  if (Cache) {
+    Key = ProgramCache::makeKey(ISA, Binary, BinarySizeInBytes);
+    if (auto CodeObject = Cache->load(Key)) {
+      ExecutableCache.assign(CodeObject->begin(), CodeObject->end());
+      Binary = ExecutableCache.data();
+      BinarySizeInBytes = ExecutableCache.size();
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   amd_comgr_data_t ComgrData;
   amd_comgr_data_set_t RelocatableData;
   UR_CHECK_ERROR(amd_comgr_create_data_set(&RelocatableData));
@@ -160,11 +182,6 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
   UR_CHECK_ERROR(amd_comgr_create_action_info(&Action));
   COMgrActionInfoCleanUp ActionCleanUp{Action};
 
-  std::string ISA = "amdgcn-amd-amdhsa--";
-  hipDeviceProp_t Props;
-  detail::ur::assertion(hipGetDeviceProperties(&Props, getDevice()->get()) ==
-                        hipSuccess);
-  ISA += Props.gcnArchName;
   UR_CHECK_ERROR(amd_comgr_action_info_set_isa_name(Action, ISA.data()));
 
   UR_CHECK_ERROR(amd_comgr_action_info_set_logging(Action, true));
@@ -194,6 +211,9 @@ ur_result_t ur_program_handle_t_::finalizeRelocatable() {
     UR_CHECK_ERROR(
         amd_comgr_get_data(binaryData, &binarySize, ExecutableCache.data()));
   }
+  if (Cache) {
+    Cache->store(Key, ExecutableCache.data(), ExecutableCache.size());
+  }
   Binary = ExecutableCache.data();
   BinarySizeInBytes = ExecutableCache.size();
   return UR_RESULT_SUCCESS;
@@ -244,18 +264,30 @@ ur_result_t ur_program_handle_t_::getGlobalVariablePointer(
     const char *name, hipDeviceptr_t *DeviceGlobal, size_t *DeviceGlobalSize) {
   // Since HIP requires a the global variable to be referenced by name, we use
   // metadata to find the correct name to access it by.
-  auto DeviceGlobalNameIt = this->GlobalIDMD.find(name);
-  if (DeviceGlobalNameIt == this->GlobalIDMD.end())
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  std::string DeviceGlobalName = DeviceGlobalNameIt->second;
-
-  try {
-    UR_CHECK_ERROR(hipModuleGetGlobal(DeviceGlobal, DeviceGlobalSize,
-                                      this->get(), DeviceGlobalName.c_str()));
-  } catch (ur_result_t Err) {
-    return Err;
+  std::lock_guard<std::mutex> Lock(GlobalVariablesMutex);
+  auto CachedIt = GlobalVariables.find(name);
+  if (CachedIt == GlobalVariables.end()) {
+    auto DeviceGlobalNameIt = this->GlobalIDMD.find(name);
+    if (DeviceGlobalNameIt == this->GlobalIDMD.end())
+      return UR_RESULT_ERROR_INVALID_VALUE;
+
+    hipDeviceptr_t Ptr{};
+    size_t Size = 0;
+    try {
+      UR_CHECK_ERROR(hipModuleGetGlobal(&Ptr, &Size, this->get(),
+                                        DeviceGlobalNameIt->second.c_str()));
+      CachedIt = GlobalVariables.emplace(name, std::make_pair(Ptr, Size)).first;
+    } catch (ur_result_t Err) {
+      return Err;
+    } catch (std::bad_alloc &) {
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
   }
 
+  if (DeviceGlobal)
+    *DeviceGlobal = CachedIt->second.first;
+  if (DeviceGlobalSize)
+    *DeviceGlobalSize = CachedIt->second.second;
   return UR_RESULT_SUCCESS;
 }
 
@@ -324,6 +356,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuild(ur_context_handle_t,
   return Result;
 }
 
+/// hipModuleLoadDataEx blocks until the module is loaded and can't be called from a
+/// host function of the stream, so the program can't be built in the
+/// background, and urProgramBuild is to be used instead.
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(ur_program_handle_t, ur_queue_handle_t, const char *,
+                       ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
     ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
     const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
@@ -12,6 +12,8 @@
 #include <ur_api.h>
 
 #include <atomic>
+#include <mutex>
+#include <string>
 #include <unordered_map>
 
 #include "context.hpp"
@@ -40,6 +42,12 @@ struct ur_program_handle_t_ {
   std::unordered_map<std::string, std::tuple<uint32_t, uint32_t, uint32_t>>
       KernelReqdWorkGroupSizeMD;
 
+  // Addresses and sizes of the device globals looked up so far, by the names
+  // they are enqueued with, as they don't move for the lifetime of the module.
+  std::unordered_map<std::string, std::pair<hipDeviceptr_t, size_t>>
+      GlobalVariables;
+  std::mutex GlobalVariablesMutex;
+
   constexpr static size_t MAX_LOG_SIZE = 8192u;
 
   char ErrorLog[MAX_LOG_SIZE], InfoLog[MAX_LOG_SIZE];
@@ -0,0 +1,51 @@
+//===--------- program_cache.cpp - HIP Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <memory>
+#include <sstream>
+
+#include <hip/hip_runtime.h>
+
+#include "common.hpp"
+#include "program_cache.hpp"
+#include "ur_util.hpp"
+
+namespace {
+
+constexpr const char *CacheMagic = "ur-hip-program-cache-v1";
+
+} // namespace
+
+ProgramCache::ProgramCache(filesystem::path Dir)
+    : Files(std::move(Dir), CacheMagic, ".hsaco") {}
+
+ProgramCache *ProgramCache::get() {
+  static std::unique_ptr<ProgramCache> Cache =
+      []() -> std::unique_ptr<ProgramCache> {
+    auto Dir = ur_getenv("UR_HIP_PROGRAM_CACHE_DIR");
+    if (!Dir || Dir->empty())
+      return nullptr;
+    return std::make_unique<ProgramCache>(filesystem::path(*Dir));
+  }();
+  return Cache.get();
+}
+
+std::string ProgramCache::makeKey(const std::string &ISA, const char *Binary,
+                                  size_t BinarySize) {
+  int RuntimeVersion = 0;
+  UR_CHECK_ERROR(hipRuntimeGetVersion(&RuntimeVersion));
+  int DriverVersion = 0;
+  UR_CHECK_ERROR(hipDriverGetVersion(&DriverVersion));
+
+  std::ostringstream Key;
+  Key << RuntimeVersion << ';' << DriverVersion << ';' << ISA << ';'
+      << BinarySize << ':' << std::hex << ur::hashBytes(Binary, BinarySize);
+  return Key.str();
+}
@@ -0,0 +1,52 @@
+//===--------- program_cache.hpp - HIP Adapter ----------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "ur_binary_file_cache.hpp"
+
+// On-disk cache of the code objects linked from the relocatable objects of
+// programs, enabled by pointing UR_HIP_PROGRAM_CACHE_DIR at a directory. A
+// code object is keyed by all its link depends on: the relocatable object,
+// the ISA of the device and the ROCm runtime and driver versions. The key is
+// stored along with the code object, so that a hash collision can't load the
+// wrong one.
+class ProgramCache {
+public:
+  explicit ProgramCache(filesystem::path Dir);
+
+  // Returns the cache selected by UR_HIP_PROGRAM_CACHE_DIR, or nullptr
+  static ProgramCache *get();
+
+  // Describes the link of Binary for the given ISA
+  static std::string makeKey(const std::string &ISA, const char *Binary,
+                             size_t BinarySize);
+
+  // Returns the code object stored for Key, if any
+  std::optional<std::vector<char>> load(const std::string &Key) const {
+    return Files.load<char>(Key);
+  }
+
+  // Stores CodeObject for Key. Concurrent stores of the same key don't see
+  // partial files.
+  void store(const std::string &Key, const char *CodeObject,
+             size_t CodeObjectSize) const {
+    Files.store(Key, CodeObject, CodeObjectSize);
+  }
+
+private:
+  ur::binary_file_cache Files;
+};
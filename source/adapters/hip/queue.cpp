@@ -9,8 +9,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "queue.hpp"
+#include "command_buffer.hpp"
 #include "context.hpp"
 #include "event.hpp"
+#include "ur_perf_counters.hpp"
 
 void ur_queue_handle_t_::computeStreamWaitForBarrierIfNeeded(
     hipStream_t Stream, uint32_t Stream_i) {
@@ -29,8 +31,20 @@ void ur_queue_handle_t_::transferStreamWaitForBarrierIfNeeded(
 }
 
 hipStream_t ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
+  return recordSubmission(pickComputeStream(StreamToken));
+}
+
+hipStream_t ur_queue_handle_t_::pickComputeStream(uint32_t *StreamToken) {
   if (getThreadLocalStream() != hipStream_t{0})
     return getThreadLocalStream();
+  // The commands of a capture are kept on its stream, in the order they are
+  // enqueued
+  if (hipStream_t Stream = CaptureStream) {
+    if (StreamToken) {
+      *StreamToken = std::numeric_limits<uint32_t>::max();
+    }
+    return Stream;
+  }
   uint32_t Stream_i;
   uint32_t Token;
   while (true) {
@@ -40,8 +54,8 @@ hipStream_t ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
       // The second check is done after mutex is locked so other threads can not
       // change NumComputeStreams after that
       if (NumComputeStreams < ComputeStreams.size()) {
-        UR_CHECK_ERROR(hipStreamCreateWithPriority(
-            &ComputeStreams[NumComputeStreams++], Flags, Priority));
+        ComputeStreams[NumComputeStreams++] =
+            Device->acquireStream(Flags, Priority);
       }
     }
     Token = ComputeStreamIdx++;
@@ -63,11 +77,16 @@ hipStream_t ur_queue_handle_t_::getNextComputeStream(uint32_t *StreamToken) {
   return Res;
 }
 
+// Commands with a wait list, which either run on the stream of an event they
+// wait on or need another stream
+static ur::perf_counter StreamReuseHits{"stream_reuse.hits"};
+static ur::perf_counter StreamReuseMisses{"stream_reuse.misses"};
+
 hipStream_t ur_queue_handle_t_::getNextComputeStream(
     uint32_t NumEventsInWaitList, const ur_event_handle_t *EventWaitList,
     ur_stream_guard &Guard, uint32_t *StreamToken) {
   if (getThreadLocalStream() != hipStream_t{0})
-    return getThreadLocalStream();
+    return recordSubmission(getThreadLocalStream());
   for (uint32_t i = 0; i < NumEventsInWaitList; i++) {
     uint32_t Token = EventWaitList[i]->getComputeStreamToken();
     if (EventWaitList[i]->getQueue() == this && canReuseStream(Token)) {
@@ -81,20 +100,26 @@ hipStream_t ur_queue_handle_t_::getNextComputeStream(
           *StreamToken = Token;
         }
         Guard = ur_stream_guard{std::move(ComputeSyncGuard)};
+        StreamReuseHits.add();
         hipStream_t Res = EventWaitList[i]->getStream();
         computeStreamWaitForBarrierIfNeeded(Res, Stream_i);
-        return Res;
+        return recordSubmission(Res);
       }
     }
   }
+  if (NumEventsInWaitList) {
+    StreamReuseMisses.add();
+  }
   Guard = {};
   return getNextComputeStream(StreamToken);
 }
 
 hipStream_t ur_queue_handle_t_::getNextTransferStream() {
   if (getThreadLocalStream() != hipStream_t{0})
-    return getThreadLocalStream();
-  if (TransferStreams.empty()) { // for example in in-order queue
+    return recordSubmission(getThreadLocalStream());
+  // The transfers of a capture go to its stream as well, and queues without
+  // transfer streams, in-order ones for example, use their compute streams
+  if (isCapturing() || TransferStreams.empty()) {
     return getNextComputeStream();
   }
   if (NumTransferStreams < TransferStreams.size()) {
@@ -103,14 +128,14 @@ hipStream_t ur_queue_handle_t_::getNextTransferStream() {
     // The second check is done after mutex is locked so other threads can not
     // change NumTransferStreams after that
     if (NumTransferStreams < TransferStreams.size()) {
-      UR_CHECK_ERROR(hipStreamCreateWithPriority(
-          &TransferStreams[NumTransferStreams++], Flags, Priority));
+      TransferStreams[NumTransferStreams++] =
+          Device->acquireStream(Flags, Priority);
     }
   }
   uint32_t Stream_i = TransferStreamIdx++ % TransferStreams.size();
   hipStream_t Res = TransferStreams[Stream_i];
   transferStreamWaitForBarrierIfNeeded(Res, Stream_i);
-  return Res;
+  return recordSubmission(Res);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
@@ -197,8 +222,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
 
       return false;
     });
+    if (IsReady) {
+      hQueue->Stats.onIdle();
+    }
     return ReturnValue(IsReady);
   }
+  case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+  case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+  case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+  case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+    return ur::queue_stats::getInfo(hQueue->Stats.snapshot(), propName,
+                                    ReturnValue);
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
   case UR_QUEUE_INFO_SIZE:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
@@ -227,9 +263,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
 
     ScopedDevice Active(hQueue->getDevice());
 
-    hQueue->forEachStream([](hipStream_t S) {
+    // The streams go back to the device for the next queues, which saves
+    // applications creating many short-lived queues recreating them
+    hQueue->forEachStream([hQueue](hipStream_t S) {
       UR_CHECK_ERROR(hipStreamSynchronize(S));
-      UR_CHECK_ERROR(hipStreamDestroy(S));
+      hQueue->getDevice()->releaseStream(S, hQueue->Flags, hQueue->Priority);
     });
 
     if (hQueue->getHostSubmitTimeStream() != hipStream_t{0}) {
@@ -248,6 +286,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueRelease(ur_queue_handle_t hQueue) {
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
   // set default result to a negative result (avoid false-positve tests)
   ur_result_t Result = UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  ur::queue_stats::finish_scope Finish(hQueue->Stats);
 
   try {
 
@@ -257,6 +296,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
       UR_CHECK_ERROR(hipStreamSynchronize(S));
       Result = UR_RESULT_SUCCESS;
     });
+    Finish.finished();
 
   } catch (ur_result_t Err) {
     Result = Err;
@@ -333,3 +373,75 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 
   return UR_RESULT_SUCCESS;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueBeginCaptureExp(ur_queue_handle_t hQueue) {
+  if (hQueue->isCapturing()) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  // The commands enqueued before the capture are neither part of it nor
+  // waited on by it
+  ur_result_t Result = urQueueFinish(hQueue);
+  if (Result != UR_RESULT_SUCCESS) {
+    return Result;
+  }
+
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    hipStream_t Stream = hQueue->getNextComputeStream();
+    // Relaxed, so that the calls made for other queues meanwhile, unsafe
+    // during a capture in the other modes, don't invalidate it
+    UR_CHECK_ERROR(hipStreamBeginCapture(Stream, hipStreamCaptureModeRelaxed));
+    hQueue->CaptureStream = Stream;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t hQueue, ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  hipStream_t Stream = hQueue->CaptureStream.exchange(nullptr);
+  if (!Stream) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  try {
+    ScopedDevice Active(hQueue->getDevice());
+    hipGraph_t Graph = nullptr;
+    hipError_t Err = hipStreamEndCapture(Stream, &Graph);
+    if (Err == hipErrorStreamCaptureInvalidated ||
+        Err == hipErrorStreamCaptureUnjoined) {
+      if (Graph) {
+        UR_CHECK_ERROR(hipGraphDestroy(Graph));
+      }
+      return UR_RESULT_ERROR_INVALID_OPERATION;
+    }
+    UR_CHECK_ERROR(Err);
+
+    ur_exp_command_buffer_handle_t CommandBuffer;
+    try {
+      CommandBuffer = new ur_exp_command_buffer_handle_t_(
+          hQueue->getContext(), hQueue->getDevice(), /*IsUpdatable=*/false);
+    } catch (const std::bad_alloc &) {
+      UR_CHECK_ERROR(hipGraphDestroy(Graph));
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+    CommandBuffer->HIPGraph = Graph;
+
+    ur_result_t Result = urCommandBufferFinalizeExp(CommandBuffer);
+    if (Result != UR_RESULT_SUCCESS) {
+      urCommandBufferReleaseExp(CommandBuffer);
+      return Result;
+    }
+    *phCommandBuffer = CommandBuffer;
+  } catch (ur_result_t Err) {
+    return Err;
+  } catch (...) {
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+  return UR_RESULT_SUCCESS;
+}
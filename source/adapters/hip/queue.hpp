@@ -10,6 +10,7 @@
 #pragma once
 
 #include "common.hpp"
+#include "ur_queue_stats.hpp"
 #include <hip/hip_runtime.h>
 #include <mutex>
 #include <vector>
@@ -60,6 +61,12 @@ struct ur_queue_handle_t_ {
   std::mutex TransferStreamMutex;
   std::mutex BarrierMutex;
   bool HasOwnership;
+  // Every command gets a stream of its own, so each is a submission
+  ur::queue_stats Stats;
+  std::atomic<native_type> LastStream{nullptr};
+  // Stream all the commands go to while the queue is capturing, null when it
+  // isn't
+  std::atomic<native_type> CaptureStream{nullptr};
 
   ur_queue_handle_t_(std::vector<native_type> &&ComputeStreams,
                      std::vector<native_type> &&TransferStreams,
@@ -89,6 +96,20 @@ struct ur_queue_handle_t_ {
   void transferStreamWaitForBarrierIfNeeded(hipStream_t Stream,
                                             uint32_t Stream_i);
 
+  native_type pickComputeStream(uint32_t *StreamToken);
+
+  // Counts a command put on Stream in Stats
+  native_type recordSubmission(native_type Stream) {
+    Stats.onCommand();
+    Stats.onSubmission();
+    native_type Previous =
+        LastStream.exchange(Stream, std::memory_order_relaxed);
+    if (Previous && Previous != Stream) {
+      Stats.onSwitch();
+    }
+    return Stream;
+  }
+
   // getNextCompute/TransferStream() functions return streams from
   // appropriate pools in round-robin fashion
   native_type getNextComputeStream(uint32_t *StreamToken = nullptr);
@@ -101,6 +122,7 @@ struct ur_queue_handle_t_ {
                                    uint32_t *StreamToken = nullptr);
   native_type getNextTransferStream();
   native_type get() { return getNextComputeStream(); };
+  bool isCapturing() const noexcept { return CaptureStream != nullptr; }
 
   // Function which creates the profiling stream. Called only from makeNative
   // event when profiling is required.
@@ -80,6 +80,19 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = urEventWaitAnyExp;
+  pDdiTable->pfnCreateIPCExp = urEventCreateIPCExp;
+  pDdiTable->pfnGetIPCHandleExp = urEventGetIPCHandleExp;
+  pDdiTable->pfnOpenIPCHandleExp = urEventOpenIPCHandleExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_api_version_t version, ur_program_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -230,6 +243,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnBeginCaptureExp = urQueueBeginCaptureExp;
+  pDdiTable->pfnEndCaptureExp = urQueueEndCaptureExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL
 urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -296,6 +320,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
   pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
   pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnUpdateKernelLaunchBatchExp =
+      urCommandBufferUpdateKernelLaunchBatchExp;
+  pDdiTable->pfnUploadExp = urCommandBufferUploadExp;
   pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
   pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
   pDdiTable->pfnUpdateWaitEventsExp = urCommandBufferUpdateWaitEventsExp;
@@ -325,11 +352,13 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
-// TODO: Implement
-UR_DLLEXPORT ur_result_t UR_APICALL
-urGetUSMExpProcAddrTable(ur_api_version_t, ur_usm_exp_dditable_t *) {
-  // This needs to return UR_RESULT_SUCCESS or else the platform can't be
-  // initialized
+UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
+    ur_api_version_t version, ur_usm_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnPoolTrimExp = urUSMPoolTrimExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -381,7 +410,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   pDdiTable->pfnCooperativeKernelLaunchExp =
       urEnqueueCooperativeKernelLaunchExp;
   pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchMultiExp = urEnqueueKernelLaunchMultiExp;
   pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+  pDdiTable->pfnHostTaskExp = urEnqueueHostTaskExp;
+  pDdiTable->pfnIPCEventSignalExp = urEnqueueIPCEventSignalExp;
+  pDdiTable->pfnIPCEventWaitExp = urEnqueueIPCEventWaitExp;
+  pDdiTable->pfnUSMMemcpyBatchExp = urEnqueueUSMMemcpyBatchExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -395,6 +429,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
       urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -409,6 +444,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   pDdiTable->pfnBuildExp = urProgramBuildExp;
   pDdiTable->pfnCompileExp = urProgramCompileExp;
   pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildAsyncExp = urProgramBuildAsyncExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -8,7 +8,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 
 #include "adapter.hpp"
 #include "common.hpp"
@@ -25,6 +27,24 @@ ur_result_t getProviderNativeError(const char *, int32_t) {
 }
 } // namespace umf
 
+usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig() {
+  const char *PoolTraceVal = std::getenv("UR_HIP_USM_ALLOCATOR_TRACE");
+  int PoolTrace = 0;
+  if (PoolTraceVal != nullptr) {
+    PoolTrace = std::atoi(PoolTraceVal);
+  }
+
+  const char *PoolConfigVal = std::getenv("UR_HIP_USM_ALLOCATOR");
+  if (PoolConfigVal == nullptr) {
+    return usm::DisjointPoolAllConfigs(PoolTrace);
+  }
+
+  return usm::parseDisjointPoolConfig(PoolConfigVal, PoolTrace);
+}
+
+usm::DisjointPoolAllConfigs DisjointPoolConfigInstance =
+    InitializeDisjointPoolConfig();
+
 /// USM: Implements USM Host allocations using HIP Pinned Memory
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
@@ -33,8 +53,27 @@ urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *NumaDesc =
+      pUSMDesc ? find_stype_node<ur_exp_usm_host_numa_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+
   if (!hPool) {
-    return USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
+    ur_numa_bind_scope NumaBind(NumaDesc ? int(NumaDesc->numaNode) : -1);
+    auto Result =
+        USMHostAllocImpl(ppMem, hContext, /* flags */ 0, size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
+  }
+
+  if (NumaDesc) {
+    auto NumaPool = hPool->NumaHostMemPools.find(NumaDesc->numaNode);
+    if (NumaPool != hPool->NumaHostMemPools.end()) {
+      return umfPoolMallocHelper(NumaPool->second.get(), ppMem, size,
+                                 alignment);
+    }
   }
 
   return umfPoolMallocHelper(hPool, ppMem, size, alignment);
@@ -49,9 +88,22 @@ urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   if (!hPool) {
-    return USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0, size,
-                              alignment);
+    auto Result = USMDeviceAllocImpl(ppMem, hContext, hDevice, /* flags */ 0,
+                                     size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
   }
 
   return umfPoolMallocHelper(hPool, ppMem, size, alignment);
@@ -66,16 +118,31 @@ urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
   UR_ASSERT(checkUSMAlignment(alignment, pUSMDesc),
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   if (!hPool) {
-    return USMSharedAllocImpl(ppMem, hContext, hDevice, /*host flags*/ 0,
-                              /*device flags*/ 0, size, alignment);
+    auto Result = USMSharedAllocImpl(ppMem, hContext, hDevice,
+                                     /*host flags*/ 0, /*device flags*/ 0,
+                                     size, alignment);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED,
+                                         getUSMAllocSize(*ppMem, size));
+    }
+    return Result;
   }
 
   return umfPoolMallocHelper(hPool, ppMem, size, alignment);
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext, void *pMem) {
+ur_result_t USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext,
+                        void *pMem, ur_exp_context_memory_type_t *FreedType,
+                        size_t *FreedSize) {
   ur_result_t Result = UR_RESULT_SUCCESS;
   try {
     hipPointerAttribute_t hipPointerAttributeType;
@@ -88,10 +155,15 @@ USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext, void *pMem) {
     UR_ASSERT(Type == hipMemoryTypeDevice || Type == hipMemoryTypeHost ||
                   Type == hipMemoryTypeManaged,
               UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+    *FreedSize = getUSMAllocSize(pMem, 0);
     if (Type == hipMemoryTypeDevice || Type == hipMemoryTypeManaged) {
+      *FreedType = Type == hipMemoryTypeManaged
+                       ? UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED
+                       : UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE;
       UR_CHECK_ERROR(hipFree(pMem));
     }
     if (Type == hipMemoryTypeHost) {
+      *FreedType = UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST;
       UR_CHECK_ERROR(hipHostFree(pMem));
     }
   } catch (ur_result_t Error) {
@@ -100,13 +172,28 @@ USMFreeImpl([[maybe_unused]] ur_context_handle_t hContext, void *pMem) {
   return Result;
 }
 
+size_t getUSMAllocSize(void *Pointer, size_t RequestedSize) {
+  hipDeviceptr_t Base = nullptr;
+  size_t Size = 0;
+  if (hipMemGetAddressRange(&Base, &Size, Pointer) != hipSuccess) {
+    return RequestedSize;
+  }
+  return Size;
+}
+
 /// USM: Frees the given USM pointer associated with the context.
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
                                               void *pMem) {
   if (auto Pool = umfPoolByPtr(pMem)) {
     return umf::umf2urResult(umfPoolFree(Pool, pMem));
   } else {
-    return USMFreeImpl(hContext, pMem);
+    ur_exp_context_memory_type_t Type;
+    size_t Size;
+    auto Result = USMFreeImpl(hContext, pMem, &Type, &Size);
+    if (Result == UR_RESULT_SUCCESS) {
+      hContext->MemoryAccounting.onFree(Type, Size);
+    }
+    return Result;
   }
 }
 
@@ -261,9 +348,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMReleaseExp(ur_context_handle_t Context,
 }
 
 umf_result_t USMMemoryProvider::initialize(ur_context_handle_t Ctx,
-                                           ur_device_handle_t Dev) {
+                                           ur_device_handle_t Dev,
+                                           ur_exp_context_memory_type_t Type) {
   Context = Ctx;
   Device = Dev;
+  MemoryType = Type;
   // There isn't a way to query this in cuda, and there isn't much info on
   // cuda's approach to alignment or transfer granularity between host and
   // device. Within UMF this is only used to influence alignment, and since we
@@ -282,18 +371,22 @@ enum umf_result_t USMMemoryProvider::alloc(size_t Size, size_t Align,
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onAlloc(MemoryType, getUSMAllocSize(*Ptr, Size));
   return UMF_RESULT_SUCCESS;
 }
 
 enum umf_result_t USMMemoryProvider::free(void *Ptr, size_t Size) {
   (void)Size;
 
-  auto Res = USMFreeImpl(Context, Ptr);
+  ur_exp_context_memory_type_t FreedType;
+  size_t FreedSize;
+  auto Res = USMFreeImpl(Context, Ptr, &FreedType, &FreedSize);
   if (Res != UR_RESULT_SUCCESS) {
     getLastStatusRef() = Res;
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onFree(MemoryType, FreedSize);
   return UMF_RESULT_SUCCESS;
 }
 
@@ -324,6 +417,9 @@ ur_result_t USMDeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
 
 ur_result_t USMHostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                 uint32_t Alignment) {
+  // The driver allocates the pages, and pins them, under the memory policy of
+  // the calling thread
+  ur_numa_bind_scope NumaBind(Device ? Device->getNumaNode() : -1);
   return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
 }
 
@@ -331,51 +427,95 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
                                              ur_usm_pool_desc_t *PoolDesc)
     : Context(Context) {
   if (PoolDesc) {
-    if (auto *Limits = find_stype_node<ur_usm_pool_limits_desc_t>(PoolDesc)) {
+    auto *Limits = find_stype_node<ur_usm_pool_limits_desc_t>(PoolDesc);
+    auto *Arena = find_stype_node<ur_exp_usm_pool_arena_desc_t>(PoolDesc);
+    if (!Limits && !Arena) {
+      throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
+    }
+    if (Limits) {
       for (auto &config : DisjointPoolConfigs.Configs) {
         config.MaxPoolableSize = Limits->maxPoolableSize;
         config.SlabMinSize = Limits->minDriverAllocSize;
       }
-    } else {
-      throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
+    }
+    if (Arena) {
+      DisjointPoolConfigs.Arenas[usm::DisjointPoolMemType::Device] = {
+          Arena->size, Arena->pageSize};
     }
   }
 
   auto MemProvider =
-      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(Context, nullptr)
+      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+          Context, nullptr, UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST)
           .second;
 
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+  HostMemPool = this->DisjointPoolConfigs
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::Host, &Stats)
+                .second;
 
   for (const auto &Device : Context->getDevices()) {
+    int NumaNode = Device->getNumaNode();
+    if (NumaNode < 0 || NumaHostMemPools.count(NumaNode))
+      continue;
     MemProvider =
-        umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(Context, Device)
+        umf::memoryProviderMakeUnique<USMHostMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST)
             .second;
-    DeviceMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Device])
+    NumaHostMemPools.emplace(
+        NumaNode, this->DisjointPoolConfigs
+                      .makePool(std::move(MemProvider),
+                                usm::DisjointPoolMemType::Host, &Stats)
+                      .second);
+  }
+
+  for (const auto &Device : Context->getDevices()) {
+    MemProvider =
+        umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE)
+            .second;
+    DeviceMemPool = this->DisjointPoolConfigs
+                        .makePool(std::move(MemProvider),
+                                  usm::DisjointPoolMemType::Device, &Stats)
                         .second;
 
     MemProvider =
-        umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(Context, Device)
+        umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(
+            Context, Device, UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED)
             .second;
-    SharedMemPool = umf::poolMakeUniqueFromOps(
-                        umfDisjointPoolOps(), std::move(MemProvider),
-                        &this->DisjointPoolConfigs
-                             .Configs[usm::DisjointPoolMemType::Shared])
+    SharedMemPool = this->DisjointPoolConfigs
+                        .makePool(std::move(MemProvider),
+                                  usm::DisjointPoolMemType::Shared, &Stats)
                         .second;
     Context->addPool(this);
   }
 }
 
 bool ur_usm_pool_handle_t_::hasUMFPool(umf_memory_pool_t *umf_pool) {
-  return DeviceMemPool.get() == umf_pool || SharedMemPool.get() == umf_pool ||
-         HostMemPool.get() == umf_pool;
+  if (DeviceMemPool.get() == umf_pool || SharedMemPool.get() == umf_pool ||
+      HostMemPool.get() == umf_pool) {
+    return true;
+  }
+  for (auto &NumaPool : NumaHostMemPools) {
+    if (NumaPool.second.get() == umf_pool) {
+      return true;
+    }
+  }
+  return false;
+}
+
+size_t ur_usm_pool_handle_t_::trim(size_t MinBytesToKeep) {
+  size_t KeptSize = 0;
+  for (auto *UMFPool :
+       {DeviceMemPool.get(), SharedMemPool.get(), HostMemPool.get()}) {
+    auto Budget = MinBytesToKeep - KeptSize;
+    KeptSize += std::min(umf::poolTrim(UMFPool, Budget), Budget);
+  }
+  for (auto &NumaPool : NumaHostMemPools) {
+    auto Budget = MinBytesToKeep - KeptSize;
+    KeptSize += std::min(umf::poolTrim(NumaPool.second.get(), Budget), Budget);
+  }
+  return KeptSize;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolCreate(
@@ -442,11 +582,27 @@ UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolGetInfo(
     return ReturnValue(hPool->Context);
   }
   default: {
-    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    return umf::getPoolStatsInfo(hPool->Stats, propName, ReturnValue);
   }
   }
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t minBytesToKeep ///< [in] number of bytes of free memory which may be
+                          ///< left cached
+) {
+  // Allocations without a pool aren't pooled, only the pools are trimmed
+  if (hPool) {
+    hPool->trim(minBytesToKeep);
+  } else {
+    hContext->trimPools(minBytesToKeep);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 bool checkUSMAlignment(uint32_t &alignment, const ur_usm_desc_t *pUSMDesc) {
   alignment = pUSMDesc ? pUSMDesc->align : 0u;
   return (!pUSMDesc ||
@@ -460,7 +616,12 @@ bool checkUSMImplAlignment(uint32_t Alignment, void **ResultPtr) {
 
 ur_result_t umfPoolMallocHelper(ur_usm_pool_handle_t hPool, void **ppMem,
                                 size_t size, uint32_t alignment) {
-  auto UMFPool = hPool->DeviceMemPool.get();
+  return umfPoolMallocHelper(hPool->DeviceMemPool.get(), ppMem, size,
+                             alignment);
+}
+
+ur_result_t umfPoolMallocHelper(umf_memory_pool_handle_t UMFPool, void **ppMem,
+                                size_t size, uint32_t alignment) {
   *ppMem = umfPoolAlignedMalloc(UMFPool, size, alignment);
   if (*ppMem == nullptr) {
     auto umfErr = umfPoolGetLastAllocationError(UMFPool);
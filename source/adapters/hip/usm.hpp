@@ -15,6 +15,10 @@
 
 usm::DisjointPoolAllConfigs InitializeDisjointPoolConfig();
 
+// Configuration of the pools the buffers of every context allocate from, see
+// ur_context_handle_t_::getBufferMemPool
+extern usm::DisjointPoolAllConfigs DisjointPoolConfigInstance;
+
 struct ur_usm_pool_handle_t_ {
   std::atomic_uint32_t RefCount = 1;
 
@@ -23,9 +27,13 @@ struct ur_usm_pool_handle_t_ {
   usm::DisjointPoolAllConfigs DisjointPoolConfigs =
       usm::DisjointPoolAllConfigs();
 
+  umf::pool_stats_t Stats;
+
   umf::pool_unique_handle_t DeviceMemPool;
   umf::pool_unique_handle_t SharedMemPool;
   umf::pool_unique_handle_t HostMemPool;
+  // Host pools placed on the NUMA node of a device, by node
+  std::unordered_map<uint32_t, umf::pool_unique_handle_t> NumaHostMemPools;
 
   ur_usm_pool_handle_t_(ur_context_handle_t Context,
                         ur_usm_pool_desc_t *PoolDesc);
@@ -37,6 +45,9 @@ struct ur_usm_pool_handle_t_ {
   uint32_t getReferenceCount() const noexcept { return RefCount; }
 
   bool hasUMFPool(umf_memory_pool_t *umf_pool);
+
+  // Returns the bytes of free memory left cached, at most MinBytesToKeep
+  size_t trim(size_t MinBytesToKeep);
 };
 
 // Exception type to pass allocation errors
@@ -60,6 +71,8 @@ protected:
   ur_context_handle_t Context;
   ur_device_handle_t Device;
   size_t MinPageSize;
+  // What the memory of the provider counts as in the context
+  ur_exp_context_memory_type_t MemoryType;
 
   // Internal allocation routine which must be implemented for each allocation
   // type
@@ -67,7 +80,8 @@ protected:
                                    uint32_t Alignment) = 0;
 
 public:
-  umf_result_t initialize(ur_context_handle_t Ctx, ur_device_handle_t Dev);
+  umf_result_t initialize(ur_context_handle_t Ctx, ur_device_handle_t Dev,
+                          ur_exp_context_memory_type_t Type);
   umf_result_t alloc(size_t Size, size_t Align, void **Ptr);
   umf_result_t free(void *Ptr, size_t Size);
   void get_last_native_error(const char **ErrMsg, int32_t *ErrCode);
@@ -137,9 +151,23 @@ ur_result_t USMHostAllocImpl(void **ResultPtr, ur_context_handle_t Context,
                              ur_usm_host_mem_flags_t Flags, size_t Size,
                              uint32_t Alignment);
 
+// Frees Pointer, allocated by one of the functions above, returning the kind
+// of USM it was and its size, see getUSMAllocSize. The callers count the
+// memory in the context, as the allocating ones do.
+ur_result_t USMFreeImpl(ur_context_handle_t Context, void *Pointer,
+                        ur_exp_context_memory_type_t *FreedType,
+                        size_t *FreedSize);
+
+// Size of the driver allocation starting at Pointer, which the context counts
+// as the frees only know this one, or RequestedSize if the driver can't tell
+size_t getUSMAllocSize(void *Pointer, size_t RequestedSize);
+
 bool checkUSMAlignment(uint32_t &alignment, const ur_usm_desc_t *pUSMDesc);
 
 bool checkUSMImplAlignment(uint32_t Alignment, void **ResultPtr);
 
 ur_result_t umfPoolMallocHelper(ur_usm_pool_handle_t hPool, void **ppMem,
                                 size_t size, uint32_t alignment);
+
+ur_result_t umfPoolMallocHelper(umf_memory_pool_handle_t UMFPool, void **ppMem,
+                                size_t size, uint32_t alignment);
@@ -10,12 +10,35 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "platform.hpp"
+
+ur::peer_topology &ur_platform_handle_t_::getPeerTopology() {
+  PeerTopology.init(
+      Devices.size(),
+      [this](size_t Src, size_t Dst, ur::peer_topology::link_t &Link) {
+        hipDevice_t SrcDevice = Devices[Src]->get();
+        hipDevice_t DstDevice = Devices[Dst]->get();
+        int Value = 0;
+        UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
+            &Value, hipDevP2PAttrAccessSupported, SrcDevice, DstDevice));
+        Link.accessSupported = Value != 0;
+        UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
+            &Value, hipDevP2PAttrNativeAtomicSupported, SrcDevice, DstDevice));
+        Link.atomicsSupported = Value != 0;
+        UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
+            &Value, hipDevP2PAttrPerformanceRank, SrcDevice, DstDevice));
+        Link.performanceRank = Value;
+      });
+  return PeerTopology;
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     ur_device_handle_t commandDevice, ur_device_handle_t peerDevice) {
   try {
     ScopedDevice active(commandDevice);
     UR_CHECK_ERROR(hipDeviceEnablePeerAccess(peerDevice->get(), 0));
+    commandDevice->getPlatform()->getPeerTopology().setEnabled(
+        commandDevice->getIndex(), peerDevice->getIndex(), true);
   } catch (ur_result_t err) {
     return err;
   }
@@ -27,6 +50,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
   try {
     ScopedDevice active(commandDevice);
     UR_CHECK_ERROR(hipDeviceDisablePeerAccess(peerDevice->get()));
+    commandDevice->getPlatform()->getPeerTopology().setEnabled(
+        commandDevice->getIndex(), peerDevice->getIndex(), false);
   } catch (ur_result_t err) {
     return err;
   }
@@ -40,24 +65,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
   int value;
-  hipDeviceP2PAttr hipAttr;
   try {
     ScopedDevice active(commandDevice);
+    const auto &Link = commandDevice->getPlatform()->getPeerTopology().get(
+        commandDevice->getIndex(), peerDevice->getIndex());
     switch (propName) {
     case UR_EXP_PEER_INFO_UR_PEER_ACCESS_SUPPORTED: {
-      hipAttr = hipDevP2PAttrAccessSupported;
+      value = Link.accessSupported;
       break;
     }
     case UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED: {
-      hipAttr = hipDevP2PAttrNativeAtomicSupported;
+      value = Link.atomicsSupported;
       break;
     }
     default: {
       return UR_RESULT_ERROR_INVALID_ENUMERATION;
     }
     }
-    UR_CHECK_ERROR(hipDeviceGetP2PAttribute(
-        &value, hipAttr, commandDevice->get(), peerDevice->get()));
   } catch (ur_result_t err) {
     return err;
   }
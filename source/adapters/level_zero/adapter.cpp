@@ -9,7 +9,10 @@
 //===----------------------------------------------------------------------===//
 
 #include "adapter.hpp"
+#include "latency_tracker.hpp"
+#include "tracing.hpp"
 #include "ur_level_zero.hpp"
+#include "ur_perf_counters.hpp"
 #include <iomanip>
 
 // As windows order of unloading dlls is reversed from linux, windows will call
@@ -78,6 +81,7 @@ ur_result_t getZesDeviceHandle(zes_uuid_t coreDeviceUuid,
 
 ur_result_t initPlatforms(PlatformVec &platforms,
                           ze_result_t ZesResult) noexcept try {
+  TRACK_SCOPE_LATENCY("ur::level_zero::initPlatforms");
   uint32_t ZeDriverCount = 0;
   ZE2UR_CALL(zeDriverGet, (&ZeDriverCount, nullptr));
   if (ZeDriverCount == 0) {
@@ -141,11 +145,14 @@ ur_result_t adapterStateInit() {
   umfInit();
 #endif
 
+  enableL0Activity();
+
   return UR_RESULT_SUCCESS;
 }
 
 ur_adapter_handle_t_::ur_adapter_handle_t_()
     : logger(logger::get_logger("level_zero")) {
+  TRACK_SCOPE_LATENCY("ur_adapter_handle_t_::ur_adapter_handle_t_");
 
   if (UrL0Debug & UR_L0_DEBUG_BASIC) {
     logger.setLegacySink(std::make_unique<ur_legacy_sink>());
@@ -260,6 +267,8 @@ void globalAdapterOnDemandCleanup() {
 }
 
 ur_result_t adapterStateTeardown() {
+  disableL0Activity();
+
   // Print the balance of various create/destroy native calls.
   // The idea is to verify if the number of create(+) and destroy(-) calls are
   // matched.
@@ -408,6 +417,8 @@ ur_result_t urAdapterRelease(ur_adapter_handle_t) {
   if (GlobalAdapter) {
     std::lock_guard<std::mutex> Lock{GlobalAdapter->Mutex};
     if (--GlobalAdapter->RefCount == 0) {
+      UR_LOG_L(GlobalAdapter->logger, INFO, "Performance counters:\n{}",
+               ur::perf_counters::get().dump());
       return adapterStateTeardown();
     }
   }
@@ -447,6 +458,8 @@ ur_result_t urAdapterGetInfo(ur_adapter_handle_t, ur_adapter_info_t PropName,
     return ReturnValue(UR_ADAPTER_BACKEND_LEVEL_ZERO);
   case UR_ADAPTER_INFO_REFERENCE_COUNT:
     return ReturnValue(GlobalAdapter->RefCount.load());
+  case UR_ADAPTER_INFO_PERF_COUNTERS:
+    return ReturnValue(ur::perf_counters::get().dump().c_str());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -7,11 +7,14 @@
 // See LICENSE.TXT SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include <algorithm>
+
 #include "command_buffer.hpp"
 #include "helpers/kernel_helpers.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
+#include "ur_util.hpp"
 
 /* L0 Command-buffer Extension Doc see:
 https://github.com/intel/llvm/blob/sycl/sycl/doc/design/CommandGraph.md#level-zero
@@ -97,12 +100,15 @@ ur_result_t getEventsFromSyncPoints(
     size_t NumSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *SyncPointWaitList,
     std::vector<ze_event_handle_t> &ZeEventList) {
-  if (!SyncPointWaitList || NumSyncPointsInWaitList == 0)
-    return UR_RESULT_SUCCESS;
+  // Sync-points which another of the list already depends on would only add
+  // redundant waits
+  std::vector<ur_exp_command_buffer_sync_point_t> WaitList;
+  CommandBuffer->SyncPointGraph.reduce(SyncPointWaitList,
+                                       NumSyncPointsInWaitList, WaitList);
 
   // For each sync-point add associated L0 event to the return list.
-  for (size_t i = 0; i < NumSyncPointsInWaitList; i++) {
-    if (auto EventHandle = CommandBuffer->SyncPoints.find(SyncPointWaitList[i]);
+  for (auto SyncPoint : WaitList) {
+    if (auto EventHandle = CommandBuffer->SyncPoints.find(SyncPoint);
         EventHandle != CommandBuffer->SyncPoints.end()) {
       ZeEventList.push_back(EventHandle->second->ZeEvent);
     } else {
@@ -141,6 +147,11 @@ ur_result_t createSyncPointAndGetZeEvents(
   ZeLaunchEvent = nullptr;
 
   if (CommandBuffer->IsInOrderCmdList) {
+    // The command-list orders the command after those it depends on, so its
+    // sync point needs no event.
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
     return UR_RESULT_SUCCESS;
   }
 
@@ -300,6 +311,10 @@ ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
       IsUpdatable(Desc ? Desc->isUpdatable : false),
       IsProfilingEnabled(Desc ? Desc->enableProfiling : false),
       IsInOrderCmdList(IsInOrderCmdList) {
+  auto *LaunchChains =
+      find_stype_node<ur_exp_command_buffer_launch_chains_desc_t>(Desc);
+  MergeLaunchChains =
+      IsInOrderCmdList && LaunchChains && LaunchChains->mergeLaunchChains;
   ur::level_zero::urContextRetain(Context);
   ur::level_zero::urDeviceRetain(Device);
 }
@@ -361,24 +376,12 @@ void ur_exp_command_buffer_handle_t_::cleanupCommandBufferResources() {
     if (IndirectAccessTrackingEnabled) {
       // urKernelRelease is called by CleanupCompletedEvent(Event) as soon as
       // kernel execution has finished. This is the place where we need to
-      // release memory allocations. If kernel is not in use (not submitted by
-      // some other thread) then release referenced memory allocations. As a
+      // perform the frees deferred while the kernel was in flight. As a
       // result, memory can be deallocated and context can be removed from
-      // container in the platform. That's why we need to lock a mutex here.
-      ur_platform_handle_t Platform = Kernel->Program->Context->getPlatform();
-      std::scoped_lock<ur_shared_mutex> ContextsLock(Platform->ContextsMutex);
-
-      if (--Kernel->SubmissionsCount == 0) {
-        // Kernel is not submitted for execution, release referenced memory
-        // allocations.
-        for (auto &MemAlloc : Kernel->MemAllocs) {
-          // std::pair<void *const, MemAllocRecord> *, Hash
-          USMFreeHelper(MemAlloc->second.Context, MemAlloc->first,
-                        MemAlloc->second.OwnNativeHandle);
-        }
-        Kernel->MemAllocs.clear();
-      }
+      // container in the platform.
+      return IndirectAccessKernelCompleted(Kernel);
     }
+    return UR_RESULT_SUCCESS;
   };
 
   for (auto &AssociatedKernel : KernelsList) {
@@ -409,6 +412,7 @@ ur_exp_command_buffer_command_handle_t_::
 void ur_exp_command_buffer_handle_t_::registerSyncPoint(
     ur_exp_command_buffer_sync_point_t SyncPoint, ur_event_handle_t Event) {
   SyncPoints[SyncPoint] = Event;
+  SyncPointGraph.add(SyncPoint);
   NextSyncPoint++;
   ZeEventsList.push_back(Event->ZeEvent);
 }
@@ -496,9 +500,16 @@ bool canBeInOrder(ur_context_handle_t Context,
   // In-order command-lists are not available in old driver version.
   bool CompatibleDriver = Context->getPlatform()->isDriverVersionNewerOrSimilar(
       1, 3, L0_DRIVER_INORDER_MIN_VERSION);
-  return CompatibleDriver
-             ? (CommandBufferDesc ? CommandBufferDesc->isInOrder : false)
-             : false;
+  if (!CompatibleDriver || !CommandBufferDesc) {
+    return false;
+  }
+  // Chains of launches run back to back in an in-order command-list, instead
+  // of each waiting on an event signaled by the one before.
+  auto *LaunchChains =
+      find_stype_node<ur_exp_command_buffer_launch_chains_desc_t>(
+          CommandBufferDesc);
+  return CommandBufferDesc->isInOrder ||
+         (LaunchChains && LaunchChains->mergeLaunchChains);
 }
 
 ur_result_t
@@ -631,6 +642,12 @@ urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t CommandBuffer) {
     ZE2UR_CALL(zeCommandListClose, (CommandBuffer->ZeCopyCommandList));
   }
 
+  if (CommandBuffer->MergeLaunchChains) {
+    logger::info("Command-buffer merged {} kernel launches into the launches "
+                 "they depend on",
+                 CommandBuffer->MergedLaunches);
+  }
+
   CommandBuffer->IsFinalized = true;
 
   return UR_RESULT_SUCCESS;
@@ -683,8 +700,9 @@ setKernelPendingArguments(ur_exp_command_buffer_handle_t CommandBuffer,
       UR_CALL(Arg.Value->getZeHandlePtr(ZeHandlePtr, Arg.AccessMode,
                                         CommandBuffer->Device, nullptr, 0u));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (Kernel->ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult = Kernel->setZeArgument(Kernel->ZeKernel, Arg.Index,
+                                              Arg.Size, ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
@@ -795,6 +813,10 @@ ur_result_t urCommandBufferAppendKernelLaunchExp(
       UR_COMMAND_KERNEL_LAUNCH, CommandBuffer, NumSyncPointsInWaitList,
       SyncPointWaitList, false, RetSyncPoint, ZeEventList, ZeLaunchEvent));
 
+  if (CommandBuffer->MergeLaunchChains && NumSyncPointsInWaitList > 0) {
+    CommandBuffer->MergedLaunches++;
+  }
+
   ZE2UR_CALL(zeCommandListAppendLaunchKernel,
              (CommandBuffer->ZeComputeCommandList, Kernel->ZeKernel,
               &ZeThreadGroupDimensions, ZeLaunchEvent, ZeEventList.size(),
@@ -1035,6 +1057,9 @@ ur_result_t urCommandBufferAppendUSMPrefetchExp(
   std::ignore = Flags;
 
   if (CommandBuffer->IsInOrderCmdList) {
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
     // Add the prefetch command to the command buffer.
     // Note that L0 does not handle migration flags.
     ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
@@ -1105,6 +1130,9 @@ ur_result_t urCommandBufferAppendUSMAdviseExp(
   ze_memory_advice_t ZeAdvice = static_cast<ze_memory_advice_t>(Value);
 
   if (CommandBuffer->IsInOrderCmdList) {
+    if (RetSyncPoint) {
+      *RetSyncPoint = CommandBuffer->NextSyncPoint++;
+    }
     ZE2UR_CALL(zeCommandListAppendMemAdvise,
                (CommandBuffer->ZeComputeCommandList,
                 CommandBuffer->Device->ZeDevice, Mem, Size, ZeAdvice));
@@ -1304,6 +1332,82 @@ ur_result_t createUserEvent(ur_exp_command_buffer_handle_t CommandBuffer,
   return UR_RESULT_SUCCESS;
 }
 
+/**
+ * Checks whether the command buffer can be enqueued with
+ * enqueueImmediateAppend.
+ * @param[in] CommandBuffer The command buffer.
+ * @param[in] Queue The UR queue used to submit the command buffer.
+ * @return Returns true if the main command-list can be appended to an
+ * immediate command-list of the queue.
+ */
+bool canEnqueueImmediateAppend(ur_exp_command_buffer_handle_t CommandBuffer,
+                               ur_queue_handle_t Queue) {
+  // Updates synchronize with the fence of the last enqueue, which an append
+  // doesn't have.
+  return CommandBuffer->IsInOrderCmdList && !CommandBuffer->IsUpdatable &&
+         Queue->UsingImmCmdLists && Queue->isInOrderQueue() &&
+         CommandBuffer->Context->getPlatform()
+             ->ZeDriverImmediateCommandListAppendFound;
+}
+
+/**
+ * Enqueues the command buffer by appending its main command-list to an
+ * immediate command-list of the queue, which waits for the dependencies and
+ * signals the returned event itself. No fence, reset command-list or signal
+ * command-list is needed: the wait-event and all-reset-event the main
+ * command-list starts by waiting for are left signaled.
+ * @param[in] CommandBuffer The command buffer.
+ * @param[in] Queue The UR queue used to submit the command buffer.
+ * @param[in] NumEventsInWaitList The number of events to wait for.
+ * @param[in] EventWaitList List of events to wait for.
+ * @param[out][optional] Event The event which will be returned to the user.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+ur_result_t enqueueImmediateAppend(ur_exp_command_buffer_handle_t CommandBuffer,
+                                   ur_queue_handle_t Queue,
+                                   uint32_t NumEventsInWaitList,
+                                   const ur_event_handle_t *EventWaitList,
+                                   ur_event_handle_t *Event) {
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumEventsInWaitList, EventWaitList, Queue, false /*UseCopyEngine*/));
+
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, false /*UseCopyEngine*/, NumEventsInWaitList,
+      EventWaitList, false /*AllowBatching*/, nullptr /*ForcedCmdQueue*/));
+
+  // An enqueue through command queues resets them once it completes, so
+  // signal them again after it.
+  if (!CommandBuffer->PreconditionsSignaled) {
+    ZE2UR_CALL(zeCommandListAppendSignalEvent,
+               (CommandList->first, CommandBuffer->WaitEvent->ZeEvent));
+    ZE2UR_CALL(zeCommandListAppendSignalEvent,
+               (CommandList->first, CommandBuffer->AllResetEvent->ZeEvent));
+    CommandBuffer->PreconditionsSignaled = true;
+  }
+
+  ur_event_handle_t RetEvent{};
+  bool IsInternal = Event == nullptr;
+  UR_CALL(createEventAndAssociateQueue(Queue, &RetEvent,
+                                       UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP,
+                                       CommandList, IsInternal, false));
+  RetEvent->WaitList = TmpWaitList;
+
+  ZE2UR_CALL(zeCommandListImmediateAppendCommandListsExp,
+             (CommandList->first, 1, &CommandBuffer->ZeComputeCommandList,
+              RetEvent->ZeEvent, RetEvent->WaitList.Length,
+              RetEvent->WaitList.ZeEventList));
+
+  UR_CALL(Queue->executeCommandList(CommandList, false /*IsBlocking*/,
+                                    false /*OKToBatchCommand*/));
+
+  if (Event) {
+    *Event = RetEvent;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t
 urCommandBufferEnqueueExp(ur_exp_command_buffer_handle_t CommandBuffer,
                           ur_queue_handle_t Queue, uint32_t NumEventsInWaitList,
@@ -1311,6 +1415,12 @@ urCommandBufferEnqueueExp(ur_exp_command_buffer_handle_t CommandBuffer,
                           ur_event_handle_t *Event) {
   std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
 
+  if (canEnqueueImmediateAppend(CommandBuffer, Queue)) {
+    return enqueueImmediateAppend(CommandBuffer, Queue, NumEventsInWaitList,
+                                  EventWaitList, Event);
+  }
+  CommandBuffer->PreconditionsSignaled = false;
+
   ze_command_queue_handle_t ZeCommandQueue;
   getZeCommandQueue(Queue, false, ZeCommandQueue);
 
@@ -1371,6 +1481,17 @@ urCommandBufferEnqueueExp(ur_exp_command_buffer_handle_t CommandBuffer,
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t
+urCommandBufferUploadExp(ur_exp_command_buffer_handle_t CommandBuffer,
+                         ur_queue_handle_t Queue) {
+  std::ignore = Queue;
+  UR_ASSERT(CommandBuffer->IsFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // The commands were appended to device command lists when recorded, and
+  // those were closed on finalize, so there is nothing left to upload.
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t Command) {
   Command->RefCount.increment();
@@ -1450,28 +1571,30 @@ ur_result_t validateCommandDesc(
   return UR_RESULT_SUCCESS;
 }
 
+// Storage for the descriptors chained by appendKernelUpdateDescs, which need
+// to live till the point when zeCommandListUpdateMutableCommandsExp is called.
+using MutableDescStorage = std::vector<std::variant<
+    std::unique_ptr<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>,
+    std::unique_ptr<ZeStruct<ze_mutable_global_offset_exp_desc_t>>,
+    std::unique_ptr<ZeStruct<ze_mutable_group_size_exp_desc_t>>,
+    std::unique_ptr<ZeStruct<ze_mutable_group_count_exp_desc_t>>,
+    std::unique_ptr<ze_group_count_t>>>;
+
 /**
- * Update the kernel command with the new values.
+ * Creates the mutable command descriptors updating the kernel command with
+ * the new values and prepends them to the descriptor chain.
  * @param[in] Command The command which is being updated.
  * @param[in] CommandDesc The update command description.
+ * @param[in,out] Descs Storage owning the created descriptors.
+ * @param[in,out] NextDesc The head of the descriptor chain.
  * @return UR_RESULT_SUCCESS or an error code on failure
  */
-ur_result_t updateKernelCommand(
+ur_result_t appendKernelUpdateDescs(
     ur_exp_command_buffer_command_handle_t Command,
-    const ur_exp_command_buffer_update_kernel_launch_desc_t *CommandDesc) {
-
-  // We need the created descriptors to live till the point when
-  // zeCommandListUpdateMutableCommandsExp is called at the end of the
-  // function.
-  std::vector<std::variant<
-      std::unique_ptr<ZeStruct<ze_mutable_kernel_argument_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_global_offset_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_group_size_exp_desc_t>>,
-      std::unique_ptr<ZeStruct<ze_mutable_group_count_exp_desc_t>>>>
-      Descs;
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *CommandDesc,
+    MutableDescStorage &Descs, const void *&NextDesc) {
 
   const auto CommandBuffer = Command->CommandBuffer;
-  const void *NextDesc = nullptr;
 
   uint32_t Dim = CommandDesc->newWorkDim;
   size_t *NewGlobalWorkOffset = CommandDesc->pNewGlobalWorkOffset;
@@ -1518,17 +1641,19 @@ ur_result_t updateKernelCommand(
 
   // Check if a new global size is provided and if we need to update the group
   // count.
-  ze_group_count_t ZeThreadGroupDimensions{1, 1, 1};
   if (NewGlobalWorkSize && Dim > 0) {
     // If a new global work size is provided but a new local work size is not
     // then we still need to update local work size based on the size suggested
     // by the driver for the kernel.
     bool UpdateWGSize = NewLocalWorkSize == nullptr;
 
+    auto ZeThreadGroupDimensions =
+        std::make_unique<ze_group_count_t>(ze_group_count_t{1, 1, 1});
     uint32_t WG[3];
     UR_CALL(calculateKernelWorkDimensions(
         Command->Kernel->ZeKernel, CommandBuffer->Device,
-        ZeThreadGroupDimensions, WG, Dim, NewGlobalWorkSize, NewLocalWorkSize));
+        *ZeThreadGroupDimensions, WG, Dim, NewGlobalWorkSize,
+        NewLocalWorkSize));
 
     auto MutableGroupCountDesc =
         std::make_unique<ZeStruct<ze_mutable_group_count_exp_desc_t>>();
@@ -1536,13 +1661,14 @@ ur_result_t updateKernelCommand(
     DEBUG_LOG(MutableGroupCountDesc->commandId);
     MutableGroupCountDesc->pNext = NextDesc;
     DEBUG_LOG(MutableGroupCountDesc->pNext);
-    MutableGroupCountDesc->pGroupCount = &ZeThreadGroupDimensions;
+    MutableGroupCountDesc->pGroupCount = ZeThreadGroupDimensions.get();
     DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountX);
     DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountY);
     DEBUG_LOG(MutableGroupCountDesc->pGroupCount->groupCountZ);
 
     NextDesc = MutableGroupCountDesc.get();
     Descs.push_back(std::move(MutableGroupCountDesc));
+    Descs.push_back(std::move(ZeThreadGroupDimensions));
 
     if (UpdateWGSize) {
       auto MutableGroupSizeDesc =
@@ -1672,6 +1798,43 @@ ur_result_t updateKernelCommand(
     Descs.push_back(std::move(ZeMutableArgDesc));
   }
 
+  return UR_RESULT_SUCCESS;
+}
+
+/**
+ * Update a batch of kernel commands of a command-buffer with the new values.
+ * The descriptors of all the commands are chained into a single
+ * zeCommandListUpdateMutableCommandsExp call followed by a single close of
+ * the command-list, rather than one of each per command.
+ * @param[in] CommandBuffer The command-buffer the commands belong to.
+ * @param[in] NumUpdates The number of commands to update.
+ * @param[in] Commands The commands which are being updated.
+ * @param[in] CommandDescs The update command descriptions.
+ * @return UR_RESULT_SUCCESS or an error code on failure
+ */
+ur_result_t updateKernelCommands(
+    ur_exp_command_buffer_handle_t CommandBuffer, uint32_t NumUpdates,
+    const ur_exp_command_buffer_command_handle_t *Commands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *CommandDescs) {
+  UR_ASSERT(CommandBuffer->IsUpdatable, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT(CommandBuffer->IsFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  for (uint32_t I = 0; I < NumUpdates; ++I) {
+    UR_CALL(validateCommandDesc(Commands[I], &CommandDescs[I]));
+  }
+
+  // We must synchronize mutable command list execution before mutating.
+  if (ze_fence_handle_t &ZeFence = CommandBuffer->ZeActiveFence) {
+    ZE2UR_CALL(zeFenceHostSynchronize, (ZeFence, UINT64_MAX));
+  }
+
+  MutableDescStorage Descs;
+  const void *NextDesc = nullptr;
+  for (uint32_t I = 0; I < NumUpdates; ++I) {
+    UR_CALL(appendKernelUpdateDescs(Commands[I], &CommandDescs[I], Descs,
+                                    NextDesc));
+  }
+
   ZeStruct<ze_mutable_commands_exp_desc_t> MutableCommandDesc;
   MutableCommandDesc.pNext = NextDesc;
   MutableCommandDesc.flags = 0;
@@ -1681,6 +1844,8 @@ ur_result_t updateKernelCommand(
       Platform->ZeMutableCmdListExt.zexCommandListUpdateMutableCommandsExp,
       (CommandBuffer->ZeComputeCommandListTranslated, &MutableCommandDesc));
 
+  ZE2UR_CALL(zeCommandListClose, (CommandBuffer->ZeComputeCommandList));
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -1693,24 +1858,37 @@ ur_result_t urCommandBufferUpdateKernelLaunchExp(
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Guard(
       Command->Mutex, Command->CommandBuffer->Mutex, Command->Kernel->Mutex);
 
-  UR_ASSERT(Command->CommandBuffer->IsUpdatable,
-            UR_RESULT_ERROR_INVALID_OPERATION);
-  UR_ASSERT(Command->CommandBuffer->IsFinalized,
-            UR_RESULT_ERROR_INVALID_OPERATION);
-
-  UR_CALL(validateCommandDesc(Command, CommandDesc));
+  return updateKernelCommands(Command->CommandBuffer, 1, &Command,
+                              CommandDesc);
+}
 
-  // We must synchronize mutable command list execution before mutating.
-  if (ze_fence_handle_t &ZeFence = Command->CommandBuffer->ZeActiveFence) {
-    ZE2UR_CALL(zeFenceHostSynchronize, (ZeFence, UINT64_MAX));
+ur_result_t urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t CommandBuffer, uint32_t NumKernelUpdates,
+    const ur_exp_command_buffer_command_handle_t *Commands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *CommandDescs) {
+  // The same kernel may be used by many of the commands, so collect the
+  // distinct mutexes and lock them in address order.
+  std::vector<ur_shared_mutex *> Mutexes;
+  for (uint32_t I = 0; I < NumKernelUpdates; ++I) {
+    auto Command = Commands[I];
+    UR_ASSERT(Command->Kernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+    UR_ASSERT(Command->CommandBuffer == CommandBuffer,
+              UR_RESULT_ERROR_INVALID_VALUE);
+    Mutexes.push_back(&Command->Mutex);
+    Mutexes.push_back(&Command->Kernel->Mutex);
   }
+  std::sort(Mutexes.begin(), Mutexes.end());
+  Mutexes.erase(std::unique(Mutexes.begin(), Mutexes.end()), Mutexes.end());
 
-  UR_CALL(updateKernelCommand(Command, CommandDesc));
-
-  ZE2UR_CALL(zeCommandListClose,
-             (Command->CommandBuffer->ZeComputeCommandList));
+  std::scoped_lock<ur_shared_mutex> Guard(CommandBuffer->Mutex);
+  std::vector<std::unique_lock<ur_shared_mutex>> Locks;
+  Locks.reserve(Mutexes.size());
+  for (auto Mutex : Mutexes) {
+    Locks.emplace_back(*Mutex);
+  }
 
-  return UR_RESULT_SUCCESS;
+  return updateKernelCommands(CommandBuffer, NumKernelUpdates, Commands,
+                              CommandDescs);
 }
 
 ur_result_t urCommandBufferUpdateSignalEventExp(
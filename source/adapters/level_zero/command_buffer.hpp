@@ -19,6 +19,7 @@
 #include "context.hpp"
 #include "kernel.hpp"
 #include "queue.hpp"
+#include "ur_sync_point_graph.hpp"
 
 struct command_buffer_profiling_t {
   ur_exp_command_buffer_sync_point_t NumEvents;
@@ -106,6 +107,9 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   // Next sync_point value (may need to consider ways to reuse values if 32-bits
   // is not enough)
   ur_exp_command_buffer_sync_point_t NextSyncPoint;
+  // Dependencies between the sync points, to drop those of a wait list which
+  // are implied by the others before they become event waits
+  ur::sync_point_graph SyncPointGraph;
   // List of Level Zero events associated with submitted commands.
   std::vector<ze_event_handle_t> ZeEventsList;
 
@@ -117,6 +121,15 @@ struct ur_exp_command_buffer_handle_t_ : public _ur_object {
   bool IsProfilingEnabled = false;
   // Command-buffer can be submitted to an in-order command-list.
   bool IsInOrderCmdList = false;
+  // Command-buffer was created with the launch chains hint and is recorded
+  // in-order.
+  bool MergeLaunchChains = false;
+  // Number of kernel launches with dependencies recorded without an event
+  // wait, logged at finalization.
+  uint32_t MergedLaunches = 0;
+  // WaitEvent and AllResetEvent were left signaled by the last enqueue, which
+  // appended the main command-list to an immediate command-list.
+  bool PreconditionsSignaled = false;
   // This list is needed to release all kernels retained by the
   // command_buffer.
   std::vector<ur_kernel_handle_t> KernelsList;
@@ -8,6 +8,11 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <atomic>
+#include <system_error>
+#include <thread>
+
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
 #include "usm.hpp"
@@ -143,7 +148,7 @@ inline void zeParseError(ze_result_t ZeError, const char *&ErrorString) {
 
 ze_result_t ZeCall::doCall(ze_result_t ZeResult, const char *ZeName,
                            const char *ZeArgs, bool TraceError) {
-  logger::debug("ZE ---> {}{}", ZeName, ZeArgs);
+  logger::debug(UR_LOG_FMT("ZE ---> {}{}"), ZeName, ZeArgs);
 
   if (ZeResult == ZE_RESULT_SUCCESS) {
     if (UrL0LeaksDebug) {
@@ -155,7 +160,7 @@ ze_result_t ZeCall::doCall(ze_result_t ZeResult, const char *ZeName,
   if (TraceError) {
     const char *ErrorString = "Unknown";
     zeParseError(ZeResult, ErrorString);
-    logger::error("Error ({}) in {}", ErrorString, ZeName);
+    logger::error(UR_LOG_FMT("Error ({}) in {}"), ErrorString, ZeName);
   }
   return ZeResult;
 }
@@ -345,6 +350,27 @@ thread_local int32_t ErrorAdapterNativeCode;
   ErrorAdapterNativeCode = AdapterErrorCode;
 }
 
+void forEachConcurrently(uint32_t Count, uint32_t MaxThreads,
+                         const std::function<void(uint32_t)> &Fn) {
+  std::atomic<uint32_t> Next{0};
+  auto Worker = [&] {
+    for (uint32_t I = Next++; I < Count; I = Next++)
+      Fn(I);
+  };
+  // The calling thread runs Fn too
+  std::vector<std::thread> Threads;
+  for (uint32_t I = 1; I < std::min(Count, MaxThreads); I++) {
+    try {
+      Threads.emplace_back(Worker);
+    } catch (const std::system_error &) {
+      break;
+    }
+  }
+  Worker();
+  for (auto &Thread : Threads)
+    Thread.join();
+}
+
 ur_result_t zerPluginGetLastError(char **message) {
   *message = &ErrorMessage[0];
   return ErrorMessageCode;
@@ -10,6 +10,7 @@
 #pragma once
 
 #include <cassert>
+#include <functional>
 #include <list>
 #include <map>
 #include <mutex>
@@ -174,10 +175,11 @@ static auto getUrResultString = [](ur_result_t Result) {
 #define UR_CALL(Call)                                                          \
   {                                                                            \
     if (PrintTrace)                                                            \
-      logger::always("UR ---> {}", #Call);                                     \
+      logger::always(UR_LOG_FMT("UR ---> {}"), #Call);                         \
     ur_result_t Result = (Call);                                               \
     if (PrintTrace)                                                            \
-      logger::always("UR <--- {}({})", #Call, getUrResultString(Result));      \
+      logger::always(UR_LOG_FMT("UR <--- {}({})"), #Call,                      \
+                     getUrResultString(Result));                               \
     if (Result != UR_RESULT_SUCCESS)                                           \
       return Result;                                                           \
   }
@@ -186,10 +188,11 @@ static auto getUrResultString = [](ur_result_t Result) {
 #define UR_CALL_THROWS(Call)                                                   \
   {                                                                            \
     if (PrintTrace)                                                            \
-      logger::always("UR ---> {}", #Call);                                     \
+      logger::always(UR_LOG_FMT("UR ---> {}"), #Call);                         \
     ur_result_t Result = (Call);                                               \
     if (PrintTrace)                                                            \
-      logger::always("UR <--- {}({})", #Call, getUrResultString(Result));      \
+      logger::always(UR_LOG_FMT("UR <--- {}({})"), #Call,                      \
+                     getUrResultString(Result));                               \
     if (Result != UR_RESULT_SUCCESS)                                           \
       throw Result;                                                            \
   }
@@ -378,6 +381,15 @@ struct ReferenceCounter {
   // Used when retaining an object.
   void increment() { RefCount++; }
 
+  // Used when retaining an object through a reference which doesn't keep it
+  // alive. Fails, leaving the count at zero, if the object is being released.
+  bool tryIncrement() {
+    uint32_t Count = RefCount.load();
+    while (Count != 0 && !RefCount.compare_exchange_weak(Count, Count + 1)) {
+    }
+    return Count != 0;
+  }
+
   // Supposed to be used in ur*GetInfo* methods where ref count value is
   // requested.
   uint32_t load() { return RefCount.load(); }
@@ -406,6 +418,8 @@ private:
 // Base class to store common data
 struct _ur_object {
   _ur_object() : RefCount{} {}
+  // Names Mutex in the lock counters of UR_ENABLE_LOCK_STATS builds
+  explicit _ur_object(const char *LockName) : RefCount{}, Mutex{LockName} {}
 
   // Must be atomic to prevent data race when incrementing/decrementing.
   ReferenceCounter RefCount;
@@ -503,7 +517,8 @@ public:
   ZeUSMImportExtension() : Supported{false}, Enabled{false} {}
 
   void setZeUSMImport(ur_platform_handle_t_ *Platform);
-  void doZeUSMImport(ze_driver_handle_t DriverHandle, void *HostPtr,
+  // Returns whether the memory was imported
+  bool doZeUSMImport(ze_driver_handle_t DriverHandle, void *HostPtr,
                      size_t Size);
   void doZeUSMRelease(ze_driver_handle_t DriverHandle, void *HostPtr);
 };
@@ -530,4 +545,10 @@ extern thread_local int32_t ErrorAdapterNativeCode;
                                       ur_result_t ErrorCode,
                                       int32_t AdapterErrorCode);
 
+// Runs Fn for each index below Count, on up to MaxThreads threads at once
+// including the calling one, which returns once all of them are done. Fewer
+// threads are used if they can't be created. Fn must not throw.
+void forEachConcurrently(uint32_t Count, uint32_t MaxThreads,
+                         const std::function<void(uint32_t)> &Fn);
+
 #define L0_DRIVER_INORDER_MIN_VERSION 29534
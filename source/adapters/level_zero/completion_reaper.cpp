@@ -0,0 +1,105 @@
+//===--------- completion_reaper.cpp - Level Zero Adapter -----------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <chrono>
+#include <cstdlib>
+#include <vector>
+
+#include "completion_reaper.hpp"
+#include "context.hpp"
+
+namespace {
+
+// Interval between two passes over the queues of a context, in microseconds
+const std::chrono::microseconds ReaperInterval = [] {
+  const char *IntervalStr = std::getenv("UR_L0_COMPLETION_REAPER_INTERVAL_US");
+  static constexpr int Default = 200;
+  int Interval = IntervalStr ? std::atoi(IntervalStr) : Default;
+  return std::chrono::microseconds(Interval > 0 ? Interval : Default);
+}();
+
+// Cleans up what completed in Queue, unless another thread is using it, in
+// which case the queue is left for the next pass.
+void reapQueue(ur_queue_handle_t Queue) {
+  std::unique_lock<ur_shared_mutex> Lock(Queue->Mutex, std::try_to_lock);
+  if (!Lock.owns_lock())
+    return;
+  if (auto Res = resetCommandLists(Queue)) {
+    UR_LOG(WARN, "completion reaper: failed to clean up a queue, error {}",
+           static_cast<int>(Res));
+  }
+}
+
+} // namespace
+
+bool CompletionReaper::isEnabled() {
+  // The queues' mutexes are no-ops in single-threaded mode
+  static const bool Enabled = [] {
+    const char *ReaperStr = std::getenv("UR_L0_COMPLETION_REAPER");
+    return !SingleThreadMode && ReaperStr && std::atoi(ReaperStr) != 0;
+  }();
+  return Enabled;
+}
+
+void CompletionReaper::registerQueue(ur_queue_handle_t Queue) {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+  Queues.insert(Queue);
+  if (!Thread.joinable() && !Stopping) {
+    Thread = std::thread([this] { run(); });
+  }
+}
+
+void CompletionReaper::unregisterQueue(ur_queue_handle_t Queue) {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+  Queues.erase(Queue);
+}
+
+void CompletionReaper::stop() {
+  {
+    std::scoped_lock<std::mutex> Lock(Mutex);
+    Stopping = true;
+  }
+  Cond.notify_one();
+  if (Thread.joinable()) {
+    Thread.join();
+  }
+}
+
+void CompletionReaper::run() {
+  std::vector<ur_queue_handle_t> Retained;
+  std::unique_lock<std::mutex> Lock(Mutex);
+  while (!Stopping) {
+    Cond.wait_for(Lock, ReaperInterval, [this] {
+      return Stopping || Woken.load(std::memory_order_relaxed);
+    });
+    if (Stopping)
+      break;
+    Woken.store(false, std::memory_order_relaxed);
+
+    // Retain the queues for the pass, so that a queue released meanwhile
+    // can't be destroyed under our feet. A queue whose last reference is gone
+    // is being destroyed already and is skipped.
+    for (auto Queue : Queues) {
+      if (Queue->RefCount.tryIncrement())
+        Retained.push_back(Queue);
+    }
+    // Unlocked, since reaping a queue may release the queue or others
+    Lock.unlock();
+    for (auto Queue : Retained) {
+      reapQueue(Queue);
+      if (auto Res = urQueueReleaseInternal(Queue)) {
+        UR_LOG(WARN, "completion reaper: failed to release a queue, error {}",
+               static_cast<int>(Res));
+      }
+    }
+    Retained.clear();
+    Lock.lock();
+  }
+}
@@ -0,0 +1,63 @@
+//===--------- completion_reaper.hpp - Level Zero Adapter -----------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#include <unordered_set>
+
+#include <ur_api.h>
+
+// Thread of a context which polls the queues of the context for completed
+// commands, resets their command lists and releases their events, so that the
+// threads submitting to the queues don't have to. Contexts only reap their
+// queues in the background when UR_L0_COMPLETION_REAPER is set.
+class CompletionReaper {
+public:
+  CompletionReaper() = default;
+  ~CompletionReaper() { stop(); }
+
+  CompletionReaper(const CompletionReaper &) = delete;
+  CompletionReaper &operator=(const CompletionReaper &) = delete;
+
+  static bool isEnabled();
+
+  // Starts reaping Queue, which must be fully initialized. The thread is
+  // started along with the first queue.
+  void registerQueue(ur_queue_handle_t Queue);
+
+  // Stops reaping Queue, once its reference count dropped to zero.
+  void unregisterQueue(ur_queue_handle_t Queue);
+
+  // Asks for a pass ahead of the next poll, e.g. because a command list has
+  // many events left to clean up. Doesn't lock, and may be missed, in which
+  // case the pass is only delayed until the next poll.
+  void wake() {
+    if (!Woken.exchange(true, std::memory_order_relaxed)) {
+      Cond.notify_one();
+    }
+  }
+
+  // Stops the thread, after the pass in progress if any
+  void stop();
+
+private:
+  void run();
+
+  std::mutex Mutex;
+  std::condition_variable Cond;
+  // Queues which may still have commands in flight, not retained
+  std::unordered_set<ur_queue_handle_t> Queues;
+  std::atomic<bool> Woken{false};
+  bool Stopping = false;
+  std::thread Thread;
+};
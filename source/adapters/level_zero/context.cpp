@@ -14,9 +14,12 @@
 #include <string.h>
 
 #include "context.hpp"
+#include "helpers/memory_helpers.hpp"
+#include "image.hpp"
 #include "logger/ur_logger.hpp"
 #include "queue.hpp"
 #include "ur_level_zero.hpp"
+#include "ur_perf_counters.hpp"
 
 namespace ur::level_zero {
 
@@ -126,6 +129,10 @@ ur_result_t urContextGetInfo(
         UR_MEMORY_ORDER_CAPABILITY_FLAG_SEQ_CST;
     return ReturnValue(Capabilities);
   }
+  case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+  case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+  case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+    return Context->MemoryAccounting.getInfo(ContextInfoType, ReturnValue);
 
   default:
     // TODO: implement other parameters
@@ -195,10 +202,9 @@ ur_result_t ur_context_handle_t_::initialize() {
                            .second;
     DeviceMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &DisjointPoolConfigInstance
-                                 .Configs[usm::DisjointPoolMemType::Device])
+        std::make_tuple(DisjointPoolConfigInstance
+                            .makePool(std::move(MemProvider),
+                                      usm::DisjointPoolMemType::Device)
                             .second));
 
     MemProvider = umf::memoryProviderMakeUnique<L0SharedMemoryProvider>(
@@ -206,10 +212,9 @@ ur_result_t ur_context_handle_t_::initialize() {
                       .second;
     SharedMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &DisjointPoolConfigInstance
-                                 .Configs[usm::DisjointPoolMemType::Shared])
+        std::make_tuple(DisjointPoolConfigInstance
+                            .makePool(std::move(MemProvider),
+                                      usm::DisjointPoolMemType::Shared)
                             .second));
 
     MemProvider = umf::memoryProviderMakeUnique<L0SharedReadOnlyMemoryProvider>(
@@ -218,10 +223,9 @@ ur_result_t ur_context_handle_t_::initialize() {
     SharedReadOnlyMemPools.emplace(
         std::piecewise_construct, std::make_tuple(Device->ZeDevice),
         std::make_tuple(
-            umf::poolMakeUniqueFromOps(
-                umfDisjointPoolOps(), std::move(MemProvider),
-                &DisjointPoolConfigInstance
-                     .Configs[usm::DisjointPoolMemType::SharedReadOnly])
+            DisjointPoolConfigInstance
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::SharedReadOnly)
                 .second));
 
     MemProvider = umf::memoryProviderMakeUnique<L0DeviceMemoryProvider>(
@@ -270,11 +274,10 @@ ur_result_t ur_context_handle_t_::initialize() {
   auto MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
                          reinterpret_cast<ur_context_handle_t>(this), nullptr)
                          .second;
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &DisjointPoolConfigInstance.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+  HostMemPool = DisjointPoolConfigInstance
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::Host)
+                .second;
 
   MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
                     reinterpret_cast<ur_context_handle_t>(this), nullptr)
@@ -282,6 +285,28 @@ ur_result_t ur_context_handle_t_::initialize() {
   HostMemProxyPool =
       umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second;
 
+  // The host memory providers with a device place their pages on its NUMA
+  // node. The devices on the same node share the pools.
+  for (auto &Device : Devices) {
+    int NumaNode = Device->ZeNumaNode->value;
+    if (NumaNode < 0 || NumaHostMemPools.count(NumaNode))
+      continue;
+    MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                      reinterpret_cast<ur_context_handle_t>(this), Device)
+                      .second;
+    NumaHostMemPools.emplace(
+        NumaNode, DisjointPoolConfigInstance
+                      .makePool(std::move(MemProvider),
+                                usm::DisjointPoolMemType::Host)
+                      .second);
+    MemProvider = umf::memoryProviderMakeUnique<L0HostMemoryProvider>(
+                      reinterpret_cast<ur_context_handle_t>(this), Device)
+                      .second;
+    NumaHostMemProxyPools.emplace(
+        NumaNode,
+        umf::poolMakeUnique<USMProxyPool>(std::move(MemProvider)).second);
+  }
+
   // We may allocate memory to this root device so create allocators.
   if (SingleRootDevice &&
       DeviceMemPools.find(SingleRootDevice->ZeDevice) == DeviceMemPools.end()) {
@@ -292,14 +317,17 @@ ur_result_t ur_context_handle_t_::initialize() {
   // Created as synchronous so level-zero performs implicit synchronization and
   // there is no need to query for completion in the plugin
   //
-  // TODO: we use Device[0] here as the single immediate command-list
-  // for buffer creation and migration. Initialization is in
-  // in sync and is always performed to Devices[0] as well but
-  // D2D migartion, if no P2P, is broken since it should use
-  // immediate command-list for the specfic devices, and this single one.
+  // We use Device[0] here as the single immediate command-list for buffer
+  // creation. Initialization is in sync and is always performed to Devices[0]
+  // as well. Migrations to the other devices use command-lists of their own,
+  // see getMigrationCommandList.
   //
   ur_device_handle_t Device = SingleRootDevice ? SingleRootDevice : Devices[0];
+  return createSyncCopyCommandList(Device, ZeCommandListInit);
+}
 
+ur_result_t ur_context_handle_t_::createSyncCopyCommandList(
+    ur_device_handle_t Device, ze_command_list_handle_t &ZeCommandList) {
   // Prefer to use copy engine for initialization copies,
   // if available and allowed (main copy engine with index 0).
   ZeStruct<ze_command_queue_desc_t> ZeCommandQueueDesc;
@@ -318,7 +346,209 @@ ur_result_t ur_context_handle_t_::initialize() {
   ZeCommandQueueDesc.mode = ZE_COMMAND_QUEUE_MODE_SYNCHRONOUS;
   ZE2UR_CALL(
       zeCommandListCreateImmediate,
-      (ZeContext, Device->ZeDevice, &ZeCommandQueueDesc, &ZeCommandListInit));
+      (ZeContext, Device->ZeDevice, &ZeCommandQueueDesc, &ZeCommandList));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_context_handle_t_::getMigrationCommandList(
+    ur_device_handle_t Device, ze_command_list_handle_t &ZeCommandList) {
+  if (Device == (SingleRootDevice ? SingleRootDevice : Devices[0])) {
+    ZeCommandList = ZeCommandListInit;
+    return UR_RESULT_SUCCESS;
+  }
+  auto &ZeMigrationCommandList = ZeMigrationCommandLists[Device];
+  if (!ZeMigrationCommandList)
+    UR_CALL(createSyncCopyCommandList(Device, ZeMigrationCommandList));
+  ZeCommandList = ZeMigrationCommandList;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_context_handle_t_::getP2PDevices(
+    ur_device_handle_t Device, const std::list<ur_device_handle_t> *&Peers) {
+  std::scoped_lock<ur_mutex> Lock(P2PDeviceCacheMutex);
+  // Check if the P2P devices are already cached
+  auto It = P2PDeviceCache.find(Device);
+  if (It == P2PDeviceCache.end()) {
+    // Query for P2P devices and update the cache
+    std::list<ur_device_handle_t> P2PDevices;
+    ze_bool_t P2P;
+    for (const auto &D : Devices) {
+      if (D == Device)
+        continue;
+      ZE2UR_CALL(zeDeviceCanAccessPeer, (D->ZeDevice, Device->ZeDevice, &P2P));
+      if (P2P)
+        P2PDevices.push_back(D);
+    }
+    It = P2PDeviceCache.emplace(Device, std::move(P2PDevices)).first;
+  }
+  Peers = &It->second;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_context_handle_t_::canAccessPeer(ur_device_handle_t Device,
+                                                ur_device_handle_t Peer,
+                                                bool &CanAccess) {
+  // The cache only knows of the devices of the context, not of their
+  // sub-devices
+  if (std::find(Devices.begin(), Devices.end(), Device) == Devices.end()) {
+    ze_bool_t P2P = false;
+    ZE2UR_CALL(zeDeviceCanAccessPeer, (Device->ZeDevice, Peer->ZeDevice, &P2P));
+    CanAccess = P2P;
+    return UR_RESULT_SUCCESS;
+  }
+  const std::list<ur_device_handle_t> *Peers = nullptr;
+  UR_CALL(getP2PDevices(Peer, Peers));
+  CanAccess = std::find(Peers->begin(), Peers->end(), Device) != Peers->end();
+  return UR_RESULT_SUCCESS;
+}
+
+// Copies of pageable host memory larger than two chunks are staged through
+// pinned chunks of this size by the adapter if set.
+const size_t ur_context_handle_t_::StagingChunkSize = [] {
+  const char *UrRet = std::getenv("UR_L0_STAGE_PAGEABLE_COPIES");
+  if (!UrRet || std::atoi(UrRet) == 0)
+    return size_t{0};
+  static constexpr size_t Default = 4 * 1024 * 1024;
+  const char *SizeStr = std::getenv("UR_L0_STAGING_CHUNK_SIZE");
+  long long Size = SizeStr ? std::atoll(SizeStr) : 0;
+  return Size > 0 ? static_cast<size_t>(Size) : Default;
+}();
+
+const size_t ur_context_handle_t_::PhysicalMemPoolCapacity = [] {
+  const char *UrRet = std::getenv("UR_L0_PHYSICAL_MEM_POOL_MB");
+  long long MiB = UrRet ? std::atoll(UrRet) : 256;
+  return MiB > 0 ? static_cast<size_t>(MiB) << 20 : size_t{0};
+}();
+
+ur_result_t ur_context_handle_t_::getStagingChunk(void *&Chunk) {
+  {
+    std::scoped_lock<ur_mutex> Lock(StagingChunksMutex);
+    if (!StagingChunks.empty()) {
+      Chunk = StagingChunks.back();
+      StagingChunks.pop_back();
+      return UR_RESULT_SUCCESS;
+    }
+  }
+  ZeStruct<ze_host_mem_alloc_desc_t> ZeDesc;
+  ZE2UR_CALL(zeMemAllocHost,
+             (ZeContext, &ZeDesc, StagingChunkSize, 4096, &Chunk));
+  MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+                           StagingChunkSize);
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_context_handle_t_::releaseStagingChunk(void *Chunk) {
+  std::scoped_lock<ur_mutex> Lock(StagingChunksMutex);
+  StagingChunks.push_back(Chunk);
+}
+
+bool ur_context_handle_t_::isIntegrated() const {
+  return std::all_of(Devices.begin(), Devices.end(),
+                     [](ur_device_handle_t Device) {
+                       return Device->isIntegrated();
+                     });
+}
+
+bool ur_context_handle_t_::importHostPtr(void *Ptr, size_t Size) {
+  // Integrated devices access the imported memory in place, which saves the
+  // copies to and from a host allocation of the buffer
+  if (!Ptr || !(ZeUSMImport.Enabled ||
+                (ZeUSMImport.Supported && isIntegrated())))
+    return false;
+
+  auto *Begin = static_cast<char *>(Ptr);
+  std::scoped_lock<ur_mutex> Lock(ImportedHostRangesMutex);
+  auto It = ImportedHostRanges.upper_bound(Begin);
+  if (It != ImportedHostRanges.begin()) {
+    --It;
+    if (Begin + Size <= It->first + It->second.Size) {
+      ++It->second.RefCount;
+      return true;
+    }
+  }
+  // Memory overlapping an imported range isn't imported, as it's known to
+  // the driver already
+  if (getMemoryType(ZeContext, Ptr) != ZE_MEMORY_TYPE_UNKNOWN ||
+      !ZeUSMImport.doZeUSMImport(getPlatform()->ZeDriverHandleExpTranslated,
+                                 Ptr, Size))
+    return false;
+  ImportedHostRanges[Begin] = {Size, 1};
+  return true;
+}
+
+void ur_context_handle_t_::releaseHostPtr(void *Ptr) {
+  auto *Begin = static_cast<char *>(Ptr);
+  std::scoped_lock<ur_mutex> Lock(ImportedHostRangesMutex);
+  auto It = ImportedHostRanges.upper_bound(Begin);
+  if (It == ImportedHostRanges.begin())
+    return;
+  --It;
+  if (Begin >= It->first + It->second.Size || --It->second.RefCount > 0)
+    return;
+  // Not kept imported once unused: the application may free the memory and
+  // get other pages at the same addresses
+  ZeUSMImport.doZeUSMRelease(getPlatform()->ZeDriverHandleExpTranslated,
+                             It->first);
+  ImportedHostRanges.erase(It);
+}
+
+// Mappings of IPC handles are closed at the last close if this is 0.
+const std::chrono::milliseconds ur_context_handle_t_::IpcHandleIdleTimeout =
+    [] {
+      const char *UrRet = std::getenv("UR_L0_IPC_HANDLE_IDLE_TIMEOUT");
+      long long Timeout = UrRet ? std::atoll(UrRet) : 0;
+      return std::chrono::milliseconds(Timeout > 0 ? Timeout : 0);
+    }();
+
+ur_result_t ur_context_handle_t_::openIpcHandle(
+    ur_device_handle_t Device, const void *AllocId, size_t AllocIdSize,
+    const std::function<ur_result_t(void *&)> &Open, void *&Ptr) {
+  std::pair<ze_device_handle_t, std::string> Key{
+      Device->ZeDevice,
+      std::string(static_cast<const char *>(AllocId), AllocIdSize)};
+
+  std::scoped_lock<ur_mutex> Lock(OpenedIpcHandlesMutex);
+  auto It = OpenedIpcHandles.find(Key);
+  if (It != OpenedIpcHandles.end()) {
+    ++It->second.RefCount;
+    Ptr = It->second.Ptr;
+    return UR_RESULT_SUCCESS;
+  }
+  UR_CALL(closeIdleIpcHandles(false));
+
+  UR_CALL(Open(Ptr));
+  OpenedIpcHandles[std::move(Key)] = {Ptr, 1, {}};
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_context_handle_t_::closeIpcHandle(void *Ptr) {
+  std::scoped_lock<ur_mutex> Lock(OpenedIpcHandlesMutex);
+  auto It = std::find_if(
+      OpenedIpcHandles.begin(), OpenedIpcHandles.end(),
+      [Ptr](const auto &Opened) { return Opened.second.Ptr == Ptr; });
+  UR_ASSERT(It != OpenedIpcHandles.end() && It->second.RefCount > 0,
+            UR_RESULT_ERROR_INVALID_VALUE);
+  if (--It->second.RefCount == 0)
+    It->second.LastClose = std::chrono::steady_clock::now();
+  return closeIdleIpcHandles(false);
+}
+
+ur_result_t ur_context_handle_t_::closeIdleIpcHandles(bool All) {
+  auto Now = std::chrono::steady_clock::now();
+  for (auto It = OpenedIpcHandles.begin(); It != OpenedIpcHandles.end();) {
+    auto &Opened = It->second;
+    if (Opened.RefCount > 0 ||
+        (!All && Now - Opened.LastClose < IpcHandleIdleTimeout)) {
+      ++It;
+      continue;
+    }
+    auto ZeResult =
+        ZE_CALL_NOCHECK(zeMemCloseIpcHandle, (ZeContext, Opened.Ptr));
+    // Gracefully handle the case that L0 was already unloaded.
+    if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
+      return ze2urResult(ZeResult);
+    It = OpenedIpcHandles.erase(It);
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -368,6 +598,10 @@ ur_result_t ContextReleaseHelper(ur_context_handle_t Context) {
   ze_context_handle_t DestroyZeContext =
       Context->OwnNativeHandle ? Context->ZeContext : nullptr;
 
+  // The events of the callbacks still outstanding go back to the caches and
+  // pools of the context
+  Context->EventNotifier.shutdown();
+
   // Clean up any live memory associated with Context
   ur_result_t Result = Context->finalize();
 
@@ -394,29 +628,79 @@ ur_platform_handle_t ur_context_handle_t_::getPlatform() const {
   return Devices[0]->Platform;
 }
 
+ur_result_t ur_context_handle_t_::growAllocation(void *Ptr,
+                                                 GrowableAllocation &Allocation,
+                                                 size_t Size) {
+  UR_ASSERT(Size <= Allocation.MaxSize, UR_RESULT_ERROR_INVALID_USM_SIZE);
+  if (Size <= Allocation.MappedSize)
+    return UR_RESULT_SUCCESS;
+
+  size_t PageSize = Allocation.PageSize;
+  ZeStruct<ze_physical_mem_desc_t> PhysicalMemDesc;
+  PhysicalMemDesc.flags = 0;
+  PhysicalMemDesc.size =
+      (Size - Allocation.MappedSize + PageSize - 1) / PageSize * PageSize;
+
+  ze_physical_mem_handle_t ZePhysicalMem;
+  ZE2UR_CALL(zePhysicalMemCreate, (ZeContext, Allocation.ZeDevice,
+                                   &PhysicalMemDesc, &ZePhysicalMem));
+  void *ChunkStart = static_cast<char *>(Ptr) + Allocation.MappedSize;
+  auto ZeResult = ZE_CALL_NOCHECK(
+      zeVirtualMemMap, (ZeContext, ChunkStart, PhysicalMemDesc.size,
+                        ZePhysicalMem, 0, ZE_MEMORY_ACCESS_ATTRIBUTE_READWRITE));
+  if (ZeResult) {
+    ZE_CALL_NOCHECK(zePhysicalMemDestroy, (ZeContext, ZePhysicalMem));
+    return ze2urResult(ZeResult);
+  }
+
+  Allocation.Chunks.push_back(ZePhysicalMem);
+  Allocation.MappedSize += PhysicalMemDesc.size;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_context_handle_t_::releaseGrowableAllocation(
+    void *Ptr, GrowableAllocation &Allocation) {
+  if (Allocation.MappedSize)
+    ZE2UR_CALL(zeVirtualMemUnmap, (ZeContext, Ptr, Allocation.MappedSize));
+  for (auto ZePhysicalMem : Allocation.Chunks)
+    ZE2UR_CALL(zePhysicalMemDestroy, (ZeContext, ZePhysicalMem));
+  ZE2UR_CALL(zeVirtualMemFree, (ZeContext, Ptr, Allocation.ReservedSize));
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_context_handle_t_::finalize() {
   // This function is called when ur_context_handle_t is deallocated,
   // urContextRelease. There could be some memory that may have not been
   // deallocated. For example, event and event pool caches would be still alive.
 
+  // The reaper may still be releasing the events of the last queues
+  Reaper.stop();
+
+  destroyAllImageHandles(this);
+
+  for (auto &Chunk : PhysicalMemPool.trim(0))
+    ZE_CALL_NOCHECK(zePhysicalMemDestroy, (ZeContext, Chunk.second));
+
+  // Release the last uses of the allocations still tracked, before the event
+  // caches they may go back to are destroyed.
+  for (auto &Event : Residency.takeAll())
+    UR_CALL(urEventReleaseInternal(Event));
+
   if (!DisableEventsCaching) {
-    std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
-    for (auto &EventCache : EventCaches) {
-      for (auto &Event : EventCache) {
-        auto ZeResult = ZE_CALL_NOCHECK(zeEventDestroy, (Event->ZeEvent));
-        // Gracefully handle the case that L0 was already unloaded.
-        if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
-          return ze2urResult(ZeResult);
-        delete Event;
-      }
-      EventCache.clear();
+    for (auto &Event : EventCaches.takeAll()) {
+      auto ZeResult = ZE_CALL_NOCHECK(zeEventDestroy, (Event->ZeEvent));
+      // Gracefully handle the case that L0 was already unloaded.
+      if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
+        return ze2urResult(ZeResult);
+      delete Event;
     }
   }
   {
     std::scoped_lock<ur_mutex> Lock(ZeEventPoolCacheMutex);
     for (auto &ZePoolCache : ZeEventPoolCache) {
-      for (auto &ZePool : ZePoolCache) {
-        auto ZeResult = ZE_CALL_NOCHECK(zeEventPoolDestroy, (ZePool));
+      for (auto &Pool : ZePoolCache) {
+        auto ZeResult =
+            ZE_CALL_NOCHECK(zeEventPoolDestroy, (Pool->getZeHandle()));
         // Gracefully handle the case that L0 was already unloaded.
         if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
           return ze2urResult(ZeResult);
@@ -430,31 +714,125 @@ ur_result_t ur_context_handle_t_::finalize() {
   // Gracefully handle the case that L0 was already unloaded.
   if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
     return ze2urResult(ZeResult);
+  for (auto &[Device, ZeCommandList] : ZeMigrationCommandLists) {
+    auto ZeResult = ZE_CALL_NOCHECK(zeCommandListDestroy, (ZeCommandList));
+    // Gracefully handle the case that L0 was already unloaded.
+    if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
+      return ze2urResult(ZeResult);
+  }
+
+  for (auto Chunk : StagingChunks) {
+    auto ZeResult = ZE_CALL_NOCHECK(zeMemFree, (ZeContext, Chunk));
+    // Gracefully handle the case that L0 was already unloaded.
+    if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
+      return ze2urResult(ZeResult);
+    MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+                            StagingChunkSize);
+  }
+  StagingChunks.clear();
+
+  {
+    std::scoped_lock<ur_mutex> Lock(OpenedIpcHandlesMutex);
+    UR_CALL(closeIdleIpcHandles(true));
+  }
+
+  {
+    std::scoped_lock<ur_mutex> Lock(GrowableAllocationsMutex);
+    for (auto &[Ptr, Allocation] : GrowableAllocations)
+      UR_CALL(releaseGrowableAllocation(Ptr, Allocation));
+    GrowableAllocations.clear();
+  }
 
   std::scoped_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  for (auto &List : ZeComputeCommandListCache) {
-    for (auto &Item : List.second) {
-      ze_command_list_handle_t ZeCommandList = Item.first;
-      if (ZeCommandList) {
-        auto ZeResult = ZE_CALL_NOCHECK(zeCommandListDestroy, (ZeCommandList));
-        // Gracefully handle the case that L0 was already unloaded.
-        if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
-          return ze2urResult(ZeResult);
+  for (auto *Caches : {&ZeComputeCommandListCache, &ZeCopyCommandListCache}) {
+    for (auto &Cache : *Caches) {
+      for (ze_command_list_handle_t ZeCommandList : Cache.second->takeAll()) {
+        if (ZeCommandList) {
+          auto ZeResult =
+              ZE_CALL_NOCHECK(zeCommandListDestroy, (ZeCommandList));
+          // Gracefully handle the case that L0 was already unloaded.
+          if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
+            return ze2urResult(ZeResult);
+        }
       }
     }
   }
-  for (auto &List : ZeCopyCommandListCache) {
-    for (auto &Item : List.second) {
-      ze_command_list_handle_t ZeCommandList = Item.first;
-      if (ZeCommandList) {
-        auto ZeResult = ZE_CALL_NOCHECK(zeCommandListDestroy, (ZeCommandList));
-        // Gracefully handle the case that L0 was already unloaded.
-        if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
-          return ze2urResult(ZeResult);
-      }
+  return UR_RESULT_SUCCESS;
+}
+
+l0_command_list_cache_t::key_t
+l0_command_list_cache_t::makeKey(bool IsImmediate, bool InOrder,
+                                 const ze_command_queue_desc_t &Desc) {
+  if (!IsImmediate)
+    return key_t{false, InOrder, 0, 0, 0, ZE_COMMAND_QUEUE_MODE_DEFAULT,
+                 ZE_COMMAND_QUEUE_PRIORITY_NORMAL};
+  // The flags of the queue tell whether it is in order
+  return key_t{true,       false,     Desc.ordinal, Desc.index,
+               Desc.flags, Desc.mode, Desc.priority};
+}
+
+ze_command_list_handle_t
+l0_command_list_cache_t::takeImmediate(const ze_command_queue_desc_t &Desc) {
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  auto It = Lists.find(makeKey(true, false, Desc));
+  if (It == Lists.end() || It->second.empty())
+    return nullptr;
+  ze_command_list_handle_t ZeCommandList = It->second.back().first;
+  It->second.pop_back();
+  return ZeCommandList;
+}
+
+bool l0_command_list_cache_t::takeRegular(
+    bool InOrder, const std::function<bool(ze_command_list_handle_t)> &Usable,
+    entry_t &Entry) {
+  ZeStruct<ze_command_queue_desc_t> NoDesc;
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  // In-order lists also serve the queues which don't need them
+  for (bool ListInOrder : {InOrder, true}) {
+    auto It = Lists.find(makeKey(false, ListInOrder, NoDesc));
+    if (It == Lists.end())
+      continue;
+    auto &Entries = It->second;
+    for (auto Rit = Entries.rbegin(); Rit != Entries.rend(); ++Rit) {
+      if (!Usable(Rit->first))
+        continue;
+      Entry = *Rit;
+      Entries.erase(std::next(Rit).base());
+      return true;
     }
+    if (InOrder)
+      break;
   }
-  return UR_RESULT_SUCCESS;
+  return false;
+}
+
+void l0_command_list_cache_t::add(ze_command_list_handle_t ZeCommandList,
+                                  const l0_command_list_cache_info &Info) {
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  Lists[makeKey(Info.IsImmediate, Info.InOrderList, Info.ZeQueueDesc)]
+      .emplace_back(ZeCommandList, Info);
+}
+
+std::vector<ze_command_list_handle_t> l0_command_list_cache_t::takeAll() {
+  std::vector<ze_command_list_handle_t> ZeCommandLists;
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  for (auto &[Key, Entries] : Lists) {
+    for (auto &Entry : Entries)
+      ZeCommandLists.push_back(Entry.first);
+  }
+  Lists.clear();
+  return ZeCommandLists;
+}
+
+l0_command_list_cache_t &
+ur_context_handle_t_::getCommandListCache(ze_device_handle_t ZeDevice,
+                                          bool IsCopy) {
+  std::scoped_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
+  auto &Cache = (IsCopy ? ZeCopyCommandListCache
+                        : ZeComputeCommandListCache)[ZeDevice];
+  if (!Cache)
+    Cache = std::make_unique<l0_command_list_cache_t>();
+  return *Cache;
 }
 
 // Maximum number of events that can be present in an event ZePool is captured
@@ -473,9 +851,9 @@ static const uint32_t MaxNumEventsPerPool = [] {
 }();
 
 ur_result_t ur_context_handle_t_::getFreeSlotInExistingOrNewPool(
-    ze_event_pool_handle_t &Pool, size_t &Index, bool HostVisible,
-    bool ProfilingEnabled, ur_device_handle_t Device,
-    bool CounterBasedEventEnabled, bool UsingImmCmdList) {
+    EventPool *&Pool, size_t &Index, bool HostVisible, bool ProfilingEnabled,
+    ur_device_handle_t Device, bool CounterBasedEventEnabled,
+    bool UsingImmCmdList) {
   // Lock while updating event pool machinery.
   std::scoped_lock<ur_mutex> Lock(ZeEventPoolCacheMutex);
 
@@ -484,33 +862,22 @@ ur_result_t ur_context_handle_t_::getFreeSlotInExistingOrNewPool(
   if (Device) {
     ZeDevice = Device->ZeDevice;
   }
-  std::list<ze_event_pool_handle_t> *ZePoolCache =
+  std::list<std::unique_ptr<EventPool>> *ZePoolCache =
       getZeEventPoolCache(HostVisible, ProfilingEnabled,
                           CounterBasedEventEnabled, UsingImmCmdList, ZeDevice);
 
-  if (!ZePoolCache->empty()) {
-    if (NumEventsAvailableInEventPool[ZePoolCache->front()] == 0) {
-      if (DisableEventsCaching) {
-        // Remove full pool from the cache if events caching is disabled.
-        ZePoolCache->erase(ZePoolCache->begin());
-      } else {
-        // If event caching is enabled then we don't destroy events so there is
-        // no need to remove pool from the cache and add it back when it has
-        // available slots. Just keep it in the tail of the cache so that all
-        // pools can be destroyed during context destruction.
-        ZePoolCache->push_front(nullptr);
-      }
+  // Full pools are kept in the cache, so that all pools can be destroyed
+  // during context destruction; their slots are taken again once released.
+  for (auto It = ZePoolCache->begin(); It != ZePoolCache->end(); ++It) {
+    if ((*It)->acquireSlot(Index)) {
+      ZePoolCache->splice(ZePoolCache->begin(), *ZePoolCache, It);
+      Pool = It->get();
+      return UR_RESULT_SUCCESS;
     }
   }
-  if (ZePoolCache->empty()) {
-    ZePoolCache->push_back(nullptr);
-  }
 
-  // We shall be adding an event to the front pool.
-  ze_event_pool_handle_t *ZePool = &ZePoolCache->front();
-  Index = 0;
   // Create one event ZePool per MaxNumEventsPerPool events
-  if (*ZePool == nullptr) {
+  {
     ze_event_pool_counter_based_exp_desc_t counterBasedExt = {
         ZE_STRUCTURE_TYPE_COUNTER_BASED_EVENT_POOL_EXP_DESC, nullptr, 0};
     ZeStruct<ze_event_pool_desc_t> ZeEventPoolDesc;
@@ -545,83 +912,56 @@ ur_result_t ur_context_handle_t_::getFreeSlotInExistingOrNewPool(
                     });
     }
 
+    ze_event_pool_handle_t ZePool = nullptr;
     ZE2UR_CALL(zeEventPoolCreate, (ZeContext, &ZeEventPoolDesc,
-                                   ZeDevices.size(), &ZeDevices[0], ZePool));
-    NumEventsAvailableInEventPool[*ZePool] = MaxNumEventsPerPool - 1;
-    NumEventsUnreleasedInEventPool[*ZePool] = 1;
-  } else {
-    Index = MaxNumEventsPerPool - NumEventsAvailableInEventPool[*ZePool];
-    --NumEventsAvailableInEventPool[*ZePool];
-    ++NumEventsUnreleasedInEventPool[*ZePool];
+                                   ZeDevices.size(), &ZeDevices[0], &ZePool));
+    try {
+      ZePoolCache->push_front(
+          std::make_unique<EventPool>(ZePool, MaxNumEventsPerPool));
+    } catch (...) {
+      ZE_CALL_NOCHECK(zeEventPoolDestroy, (ZePool));
+      return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
   }
-  Pool = *ZePool;
+  Pool = ZePoolCache->front().get();
+  Pool->acquireSlot(Index);
   return UR_RESULT_SUCCESS;
 }
 
+static ur::perf_counter EventCacheHits{"event_cache.hits"};
+static ur::perf_counter EventCacheMisses{"event_cache.misses"};
+
 ur_event_handle_t ur_context_handle_t_::getEventFromContextCache(
     bool HostVisible, bool WithProfiling, ur_device_handle_t Device,
     bool CounterBasedEventEnabled) {
-  std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
-  auto Cache = getEventCache(HostVisible, WithProfiling, Device);
-  if (Cache->empty())
-    return nullptr;
-
-  auto It = Cache->begin();
-  ur_event_handle_t Event = *It;
-  if (Event->CounterBasedEventsEnabled != CounterBasedEventEnabled) {
-    return nullptr;
-  }
-  Cache->erase(It);
-  // We have to reset event before using it.
-  Event->reset();
+  ur_event_handle_t Event = EventCaches.get(HostVisible, WithProfiling, Device,
+                                            CounterBasedEventEnabled);
+  (Event ? EventCacheHits : EventCacheMisses).add();
   return Event;
 }
 
 void ur_context_handle_t_::addEventToContextCache(ur_event_handle_t Event) {
-  std::scoped_lock<ur_mutex> Lock(EventCacheMutex);
   ur_device_handle_t Device = nullptr;
 
   if (!Event->IsMultiDevice && Event->UrQueue) {
     Device = Event->UrQueue->Device;
   }
 
-  auto Cache = getEventCache(Event->isHostVisible(),
-                             Event->isProfilingEnabled(), Device);
-  Cache->emplace_back(Event);
+  EventCaches.add(Event, Event->isHostVisible(), Event->isProfilingEnabled(),
+                  Device);
 }
 
 ur_result_t
 ur_context_handle_t_::decrementUnreleasedEventsInPool(ur_event_handle_t Event) {
-  std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex, std::defer_lock);
-  std::scoped_lock<ur_mutex, std::shared_lock<ur_shared_mutex>> LockAll(
-      ZeEventPoolCacheMutex, EventLock);
-  if (!Event->ZeEventPool) {
+  // The pool and the slot of the event are set once, when it is created.
+  if (!Event->Pool) {
     // This must be an interop event created on a users's pool.
     // Do nothing.
     return UR_RESULT_SUCCESS;
   }
 
-  ze_device_handle_t ZeDevice = nullptr;
-  bool UsingImmediateCommandlists =
-      !Event->UrQueue || Event->UrQueue->UsingImmCmdLists;
-
-  if (!Event->IsMultiDevice && Event->UrQueue) {
-    ZeDevice = Event->UrQueue->Device->ZeDevice;
-  }
-
-  std::list<ze_event_pool_handle_t> *ZePoolCache = getZeEventPoolCache(
-      Event->isHostVisible(), Event->isProfilingEnabled(),
-      Event->CounterBasedEventsEnabled, UsingImmediateCommandlists, ZeDevice);
-
-  // Put the empty pool to the cache of the pools.
-  if (NumEventsUnreleasedInEventPool[Event->ZeEventPool] == 0)
-    die("Invalid event release: event pool doesn't have unreleased events");
-  if (--NumEventsUnreleasedInEventPool[Event->ZeEventPool] == 0) {
-    if (ZePoolCache->front() != Event->ZeEventPool) {
-      ZePoolCache->push_back(Event->ZeEventPool);
-    }
-    NumEventsAvailableInEventPool[Event->ZeEventPool] = MaxNumEventsPerPool;
-  }
+  if (!Event->Pool->releaseSlot(Event->PoolIndex))
+    die("Invalid event release: event pool slot isn't in use");
 
   return UR_RESULT_SUCCESS;
 }
@@ -658,9 +998,13 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
     CommandList = Queue->getQueueGroup(UseCopyEngine).getImmCmdList();
     if (CommandList->second.EventList.size() >=
         Queue->getImmdCmmdListsEventCleanupThreshold()) {
-      std::vector<ur_event_handle_t> EventListToCleanup;
-      Queue->resetCommandList(CommandList, false, EventListToCleanup);
-      CleanupEventListFromResetCmdList(EventListToCleanup, true);
+      if (CompletionReaper::isEnabled()) {
+        Reaper.wake();
+      } else {
+        std::vector<ur_event_handle_t> EventListToCleanup;
+        Queue->resetCommandList(CommandList, false, EventListToCleanup);
+        CleanupEventListFromResetCmdList(EventListToCleanup, true);
+      }
     }
     UR_CALL(Queue->insertStartBarrierIfDiscardEventsMode(CommandList));
     if (auto Res = Queue->insertActiveBarriers(CommandList, UseCopyEngine))
@@ -672,7 +1016,10 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
     // for a long time and we want to reclaim the command-lists for
     // use by other queues.
     if (Queue->CommandListMap.size() > CmdListsCleanupThreshold) {
-      resetCommandLists(Queue);
+      if (CompletionReaper::isEnabled())
+        Reaper.wake();
+      else
+        resetCommandLists(Queue);
     }
   }
 
@@ -720,33 +1067,24 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
   // on this device that is available for use. If so, then reuse that
   // Level-Zero Command List and Fence for this PI call.
   {
-    // Make sure to acquire the lock before checking the size, or there
-    // will be a race condition.
-    std::scoped_lock<ur_mutex> Lock(Queue->Context->ZeCommandListCacheMutex);
-    // Under mutex since operator[] does insertion on the first usage for
-    // every unique ZeDevice.
-    auto &ZeCommandListCache =
-        UseCopyEngine
-            ? Queue->Context->ZeCopyCommandListCache[Queue->Device->ZeDevice]
-            : Queue->Context
-                  ->ZeComputeCommandListCache[Queue->Device->ZeDevice];
-
-    for (auto ZeCommandListIt = ZeCommandListCache.begin();
-         ZeCommandListIt != ZeCommandListCache.end(); ++ZeCommandListIt) {
-      // If this is an InOrder Queue, then only allow lists which are in order.
-      if (Queue->Device->useDriverInOrderLists() && Queue->isInOrderQueue() &&
-          !(ZeCommandListIt->second.InOrderList)) {
-        continue;
-      }
-      // Only allow to reuse Regular Command Lists
-      if (ZeCommandListIt->second.IsImmediate) {
-        continue;
-      }
-      auto &ZeCommandList = ZeCommandListIt->first;
+    auto &ZeCommandListCache = Queue->Context->getCommandListCache(
+        Queue->Device->ZeDevice, UseCopyEngine);
+
+    // If this is an InOrder Queue, then only allow lists which are in order.
+    bool InOrder =
+        Queue->Device->useDriverInOrderLists() && Queue->isInOrderQueue();
+    l0_command_list_cache_t::entry_t Entry;
+    if (ZeCommandListCache.takeRegular(
+            InOrder,
+            [&](ze_command_list_handle_t ZeCommandList) {
+              auto it = Queue->CommandListMap.find(ZeCommandList);
+              return !ForcedCmdQueue || it == Queue->CommandListMap.end() ||
+                     *ForcedCmdQueue == it->second.ZeQueue;
+            },
+            Entry)) {
+      auto &ZeCommandList = Entry.first;
       auto it = Queue->CommandListMap.find(ZeCommandList);
       if (it != Queue->CommandListMap.end()) {
-        if (ForcedCmdQueue && *ForcedCmdQueue != it->second.ZeQueue)
-          continue;
         CommandList = it;
         if (CommandList->second.ZeFence != nullptr)
           CommandList->second.ZeFenceInUse = true;
@@ -765,7 +1103,13 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
 
         ze_fence_handle_t ZeFence;
         ZeStruct<ze_fence_desc_t> ZeFenceDesc;
-        ZE2UR_CALL(zeFenceCreate, (ZeCommandQueue, &ZeFenceDesc, &ZeFence));
+        auto ZeResult = ZE_CALL_NOCHECK(
+            zeFenceCreate, (ZeCommandQueue, &ZeFenceDesc, &ZeFence));
+        if (ZeResult) {
+          // Back to the cache, as nothing else holds it
+          ZeCommandListCache.add(ZeCommandList, Entry.second);
+          return ze2urResult(ZeResult);
+        }
         ZeStruct<ze_command_queue_desc_t> ZeQueueDesc;
         ZeQueueDesc.ordinal = QueueGroupOrdinal;
 
@@ -775,11 +1119,10 @@ ur_result_t ur_context_handle_t_::getAvailableCommandList(
                          ur_command_list_info_t(
                              ZeFence, true, false, ZeCommandQueue, ZeQueueDesc,
                              Queue->useCompletionBatching(), true /*CanReuse */,
-                             ZeCommandListIt->second.InOrderList,
-                             ZeCommandListIt->second.IsImmediate))
+                             Entry.second.InOrderList,
+                             Entry.second.IsImmediate))
                 .first;
       }
-      ZeCommandListCache.erase(ZeCommandListIt);
       if (auto Res = Queue->insertStartBarrierIfDiscardEventsMode(CommandList))
         return Res;
       if (auto Res = Queue->insertActiveBarriers(CommandList, UseCopyEngine))
@@ -9,12 +9,17 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <chrono>
+#include <functional>
 #include <list>
 #include <map>
+#include <memory>
 #include <stdarg.h>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <ur/ur.hpp>
@@ -23,9 +28,18 @@
 #include <zes_api.h>
 
 #include "common.hpp"
+#include "completion_reaper.hpp"
+#include "event_cache.hpp"
+#include "event_pool.hpp"
 #include "queue.hpp"
+#include "residency_manager.hpp"
+#include "ur_interface_loader.hpp"
 
 #include <umf_helpers.hpp>
+#include <ur_event_notifier.hpp>
+#include <ur_image_handle_cache.hpp>
+#include <ur_memory_accounting.hpp>
+#include <ur_physical_mem_pool.hpp>
 
 struct l0_command_list_cache_info {
   ZeStruct<ze_command_queue_desc_t> ZeQueueDesc;
@@ -33,15 +47,65 @@ struct l0_command_list_cache_info {
   bool IsImmediate = false;
 };
 
+// Available command lists of a device, either its compute or its copy ones,
+// indexed by what they were created with so that finding one doesn't go
+// through the others. Regular command lists can be executed on any queue of
+// their group, so they are only told apart by whether they are in order,
+// while immediate command lists are bound to the descriptor of their queue.
+class l0_command_list_cache_t {
+public:
+  using entry_t =
+      std::pair<ze_command_list_handle_t, l0_command_list_cache_info>;
+
+  // Takes an immediate command list created with a queue descriptor equal to
+  // Desc, or returns nullptr
+  ze_command_list_handle_t takeImmediate(const ze_command_queue_desc_t &Desc);
+
+  // Takes a regular command list for which Usable returns true, an in-order
+  // one if InOrder, and otherwise preferably not
+  bool takeRegular(bool InOrder,
+                   const std::function<bool(ze_command_list_handle_t)> &Usable,
+                   entry_t &Entry);
+
+  void add(ze_command_list_handle_t ZeCommandList,
+           const l0_command_list_cache_info &Info);
+
+  // Takes every command list, for the caller to destroy
+  std::vector<ze_command_list_handle_t> takeAll();
+
+private:
+  // Whether immediate, whether in order, then for immediate command lists
+  // the ordinal, index, flags, mode and priority of their queue
+  using key_t = std::tuple<bool, bool, uint32_t, uint32_t,
+                           ze_command_queue_flags_t, ze_command_queue_mode_t,
+                           ze_command_queue_priority_t>;
+
+  struct key_hash_t {
+    size_t operator()(const key_t &Key) const {
+      return std::apply(
+          [](const auto &...Values) { return combine_hashes(0, Values...); },
+          Key);
+    }
+  };
+
+  static key_t makeKey(bool IsImmediate, bool InOrder,
+                       const ze_command_queue_desc_t &Desc);
+
+  ur_mutex Mutex{"context.ZeCommandListCache"};
+  // The command lists added last at the back, to reuse them first
+  std::unordered_map<key_t, std::vector<entry_t>, key_hash_t> Lists;
+};
+
 struct ur_context_handle_t_ : _ur_object {
   ur_context_handle_t_(ze_context_handle_t ZeContext, uint32_t NumDevices,
                        const ur_device_handle_t *Devs, bool OwnZeContext)
-      : ZeContext{ZeContext}, Devices{Devs, Devs + NumDevices},
-        NumDevices{NumDevices} {
+      : _ur_object("context"), ZeContext{ZeContext},
+        Devices{Devs, Devs + NumDevices}, NumDevices{NumDevices} {
     OwnNativeHandle = OwnZeContext;
   }
 
-  ur_context_handle_t_(ze_context_handle_t ZeContext) : ZeContext{ZeContext} {}
+  ur_context_handle_t_(ze_context_handle_t ZeContext)
+      : _ur_object("context"), ZeContext{ZeContext} {}
 
   // A L0 context handle is primarily used during creation and management of
   // resources that may be used by multiple devices.
@@ -67,14 +131,19 @@ struct ur_context_handle_t_ : _ur_object {
   // support of the multiple devices per context will be added.
   ze_command_list_handle_t ZeCommandListInit{};
 
-  // Mutex for the immediate command list. Per the Level Zero spec memory copy
+  // Synchronous immediate command lists used to migrate buffers to the
+  // devices other than the one of ZeCommandListInit, created on demand.
+  std::unordered_map<ur_device_handle_t, ze_command_list_handle_t>
+      ZeMigrationCommandLists;
+
+  // Mutex for the immediate command lists. Per the Level Zero spec memory copy
   // operations submitted to an immediate command list are not allowed to be
   // called from simultaneous threads.
-  ur_mutex ImmediateCommandListMutex;
+  ur_mutex ImmediateCommandListMutex{"context.ImmediateCommandList"};
 
-  // Mutex Lock for the Command List Cache. This lock is used to control both
-  // compute and copy command list caches.
-  ur_mutex ZeCommandListCacheMutex;
+  // Guards the maps of the command list caches of the devices, each cache
+  // having its own lock, see getCommandListCache.
+  ur_mutex ZeCommandListCacheMutex{"context.ZeCommandListCaches"};
 
   // If context contains one device or sub-devices of the same device, we want
   // to save this device.
@@ -92,16 +161,65 @@ struct ur_context_handle_t_ : _ur_object {
   // sub-devices, which was provided during creation."
   //
   std::unordered_map<ze_device_handle_t,
-                     std::list<std::pair<ze_command_list_handle_t,
-                                         l0_command_list_cache_info>>>
+                     std::unique_ptr<l0_command_list_cache_t>>
       ZeComputeCommandListCache;
   std::unordered_map<ze_device_handle_t,
-                     std::list<std::pair<ze_command_list_handle_t,
-                                         l0_command_list_cache_info>>>
+                     std::unique_ptr<l0_command_list_cache_t>>
       ZeCopyCommandListCache;
 
+  // Returns the cache of the available copy or compute command lists of
+  // ZeDevice, created on first use
+  l0_command_list_cache_t &getCommandListCache(ze_device_handle_t ZeDevice,
+                                               bool IsCopy);
+
+  // Devices which can access the memory of each device, see getP2PDevices
   std::unordered_map<ur_device_handle_t, std::list<ur_device_handle_t>>
       P2PDeviceCache;
+  ur_mutex P2PDeviceCacheMutex;
+
+  // Memory this context holds from the driver, declared before the pools,
+  // which return their memory as they're destroyed
+  ur::memory_accounting MemoryAccounting{this};
+
+  // Pinned host chunks of StagingChunkSize bytes, free for staging copies
+  // from or to pageable host memory, see getStagingChunk
+  std::vector<void *> StagingChunks;
+  ur_mutex StagingChunksMutex;
+
+  // Host ranges imported to USM, by start address, and the number of buffers
+  // using memory in each, see importHostPtr
+  struct ImportedHostRange {
+    size_t Size;
+    uint32_t RefCount;
+  };
+  std::map<char *, ImportedHostRange> ImportedHostRanges;
+  ur_mutex ImportedHostRangesMutex;
+
+  // IPC handles opened in this context, by device and identity of the
+  // allocation they export, and the number of opens still using each mapping,
+  // see openIpcHandle
+  struct OpenedIpcHandle {
+    void *Ptr;
+    uint32_t RefCount;
+    std::chrono::steady_clock::time_point LastClose;
+  };
+  std::map<std::pair<ze_device_handle_t, std::string>, OpenedIpcHandle>
+      OpenedIpcHandles;
+  ur_mutex OpenedIpcHandlesMutex;
+
+  // Growable USM allocations made in this context, by start address, see
+  // urUSMGrowableAllocExp. Their physical memory is mapped one chunk after
+  // the other from the start.
+  struct GrowableAllocation {
+    ze_device_handle_t ZeDevice;
+    size_t MaxSize;
+    size_t ReservedSize;
+    size_t PageSize;
+    size_t MappedSize;
+    std::vector<ze_physical_mem_handle_t> Chunks;
+  };
+  std::unordered_map<void *, GrowableAllocation> GrowableAllocations;
+  ur_mutex GrowableAllocationsMutex;
 
   // Store USM pool for USM shared and device allocations. There is 1 memory
   // pool per each pair of (context, device) per each memory type.
@@ -115,6 +233,10 @@ struct ur_context_handle_t_ : _ur_object {
   // Store the host memory pool. It does not depend on any device.
   umf::pool_unique_handle_t HostMemPool;
 
+  // Host memory pools placing their pages on the NUMA node of the devices of
+  // the context, by node, for the allocations asking for that node.
+  std::unordered_map<uint32_t, umf::pool_unique_handle_t> NumaHostMemPools;
+
   // Allocation-tracking proxy pools for direct allocations. No pooling used.
   std::unordered_map<ze_device_handle_t, umf::pool_unique_handle_t>
       DeviceMemProxyPools;
@@ -123,6 +245,8 @@ struct ur_context_handle_t_ : _ur_object {
   std::unordered_map<ze_device_handle_t, umf::pool_unique_handle_t>
       SharedReadOnlyMemProxyPools;
   umf::pool_unique_handle_t HostMemProxyPool;
+  std::unordered_map<uint32_t, umf::pool_unique_handle_t>
+      NumaHostMemProxyPools;
 
   // Map associating pools created with urUsmPoolCreate and internal pools
   std::list<ur_usm_pool_handle_t> UsmPoolHandles{};
@@ -136,51 +260,133 @@ struct ur_context_handle_t_ : _ur_object {
 
   // Following member variables are used to manage assignment of events
   // to event pools.
-  //
-  // TODO: Create ur_event_pool class to encapsulate working with pools.
-  // This will avoid needing the use of maps below, and cleanup the
-  // ur_context_handle_t overall.
-  //
-
   // The cache of event pools from where new events are allocated from.
   // The head event pool is where the next event would be added to if there
-  // is still some room there. If there is no room in the head then
-  // the following event pool is taken (guranteed to be empty) and made the
-  // head. In case there is no next pool, a new pool is created and made the
-  // head.
+  // is still some room there. If there is no room in the head then the
+  // first pool with released slots is made the head. In case there is no
+  // such pool, a new pool is created and made the head.
   //
-  // Cache of event pools to which host-visible events are added to.
-  std::vector<std::list<ze_event_pool_handle_t>> ZeEventPoolCache{12};
+  // Pools keep the occupancy of their slots themselves, so that releasing
+  // an event's slot doesn't need the cache.
+  std::vector<std::list<std::unique_ptr<EventPool>>> ZeEventPoolCache{12};
   std::vector<std::unordered_map<ze_device_handle_t, size_t>>
       ZeEventPoolCacheDeviceMap{12};
 
-  // This map will be used to determine if a pool is full or not
-  // by storing number of empty slots available in the pool.
-  std::unordered_map<ze_event_pool_handle_t, uint32_t>
-      NumEventsAvailableInEventPool;
-  // This map will be used to determine number of unreleased events in the pool.
-  // We use separate maps for number of event slots available in the pool from
-  // the number of events unreleased in the pool.
-  // This will help when we try to make the code thread-safe.
-  std::unordered_map<ze_event_pool_handle_t, uint32_t>
-      NumEventsUnreleasedInEventPool;
+  // Mutex to control operations on event pool caches.
+  ur_mutex ZeEventPoolCacheMutex{"context.ZeEventPoolCache"};
 
-  // Mutex to control operations on event pool caches and the helper maps
-  // holding the current pool usage counts.
-  ur_mutex ZeEventPoolCacheMutex;
+  // Caches for events.
+  EventCache EventCaches;
 
-  // Mutex to control operations on event caches.
-  ur_mutex EventCacheMutex;
+  // Cleans up the completed commands of the queues in the background, if
+  // enabled.
+  CompletionReaper Reaper;
 
-  // Caches for events.
-  using EventCache = std::vector<std::list<ur_event_handle_t>>;
-  EventCache EventCaches{4};
-  std::vector<std::unordered_map<ur_device_handle_t, size_t>>
-      EventCachesDeviceMap{4};
+  // Runs the callbacks set on the events of the context with
+  // urEventSetCallback.
+  ur::event_notifier EventNotifier{ur::level_zero::urEventGetInfo,
+                                   ur::level_zero::urEventRetain,
+                                   ur::level_zero::urEventRelease};
+
+  // Bindless image handles, which are the device offsets of images recorded
+  // in the ZeOffsetToImageHandleMap of their devices.
+  ur::image_handle_cache ImageHandles;
+
+  // Bytes of physical memory kept for reuse once released, from
+  // UR_L0_PHYSICAL_MEM_POOL_MB, 256 MiB by default.
+  static const size_t PhysicalMemPoolCapacity;
+
+  // Physical memory released by urPhysicalMemRelease, which
+  // urPhysicalMemCreate and other users of physical memory in the adapter
+  // take from before creating more.
+  ur::physical_mem_pool<ze_physical_mem_handle_t> PhysicalMemPool{
+      PhysicalMemPoolCapacity};
+
+  // Residency of the shared USM allocations on the devices, if managed under
+  // a budget.
+  ResidencyManager Residency;
 
   // Initialize the PI context.
   ur_result_t initialize();
 
+  // Creates a synchronous immediate command list on the main copy engine of
+  // Device, or on its compute engine if copy engines are not to be used.
+  ur_result_t
+  createSyncCopyCommandList(ur_device_handle_t Device,
+                            ze_command_list_handle_t &ZeCommandList);
+
+  // Returns the command list to copy buffer contents to Device with. The
+  // caller must lock ImmediateCommandListMutex.
+  ur_result_t getMigrationCommandList(ur_device_handle_t Device,
+                                      ze_command_list_handle_t &ZeCommandList);
+
+  // Returns the devices of the context which can access the memory of Device
+  // directly. Peer access is queried once per device.
+  ur_result_t getP2PDevices(ur_device_handle_t Device,
+                            const std::list<ur_device_handle_t> *&Peers);
+
+  // Size of the chunks returned by getStagingChunk, 0 if the copies of
+  // pageable host memory aren't staged by the adapter
+  static const size_t StagingChunkSize;
+
+  // Returns a pinned host chunk of StagingChunkSize bytes, to be given back
+  // with releaseStagingChunk. Chunks are freed along with the context.
+  ur_result_t getStagingChunk(void *&Chunk);
+  void releaseStagingChunk(void *Chunk);
+
+  // Imports the Size bytes of host memory at Ptr to USM, if requested with
+  // SYCL_USM_HOSTPTR_IMPORT or if the devices of the context are integrated,
+  // for a buffer to use it directly. A range which was imported already for a
+  // buffer still using it is shared instead. Returns false if the memory isn't
+  // imported.
+  bool importHostPtr(void *Ptr, size_t Size);
+
+  // Whether all the devices of the context are integrated, sharing the
+  // physical memory of the host, so that the buffers of the context can live
+  // in host memory.
+  bool isIntegrated() const;
+
+  // Releases the import of the host memory at Ptr, done by importHostPtr,
+  // once no buffer uses the range it's in anymore.
+  void releaseHostPtr(void *Ptr);
+
+  // How long the mapping of an IPC handle is kept open after its last close,
+  // for a later open of the same handle to reuse it
+  static const std::chrono::milliseconds IpcHandleIdleTimeout;
+
+  // Returns in Ptr the mapping on Device of the IPC handle exporting the
+  // allocation identified by the AllocIdSize bytes at AllocId, which must not
+  // be reused by another allocation while it's exported. The handle is opened
+  // with Open unless a mapping of the allocation is open in the context
+  // already.
+  ur_result_t openIpcHandle(ur_device_handle_t Device, const void *AllocId,
+                            size_t AllocIdSize,
+                            const std::function<ur_result_t(void *&)> &Open,
+                            void *&Ptr);
+
+  // Drops a use of the IPC mapping at Ptr, returned by openIpcHandle. The
+  // mapping is closed once it has been unused for IpcHandleIdleTimeout, when
+  // the next IPC handle is opened or closed in the context.
+  ur_result_t closeIpcHandle(void *Ptr);
+
+  // Closes the IPC mappings unused for IpcHandleIdleTimeout, or all the
+  // unused ones if All is set. The caller must lock OpenedIpcHandlesMutex.
+  ur_result_t closeIdleIpcHandles(bool All);
+
+  // Backs at least the first Size bytes of the growable allocation at Ptr
+  // with physical memory. The caller must lock GrowableAllocationsMutex.
+  ur_result_t growAllocation(void *Ptr, GrowableAllocation &Allocation,
+                             size_t Size);
+
+  // Unmaps and destroys the physical memory of the growable allocation at Ptr
+  // and frees its address range.
+  ur_result_t releaseGrowableAllocation(void *Ptr,
+                                        GrowableAllocation &Allocation);
+
+  // Checks whether Device can access the memory of Peer directly
+  ur_result_t canAccessPeer(ur_device_handle_t Device, ur_device_handle_t Peer,
+                            bool &CanAccess);
+
   // If context contains one device then return this device.
   // If context contains sub-devices of the same device, then return this parent
   // device. Return nullptr if context consists of several devices which are not
@@ -203,7 +409,7 @@ struct ur_context_handle_t_ : _ur_object {
   // pool then create new one. The HostVisible parameter tells if we need a
   // slot for a host-visible event. The ProfilingEnabled tells is we need a
   // slot for an event with profiling capabilities.
-  ur_result_t getFreeSlotInExistingOrNewPool(ze_event_pool_handle_t &, size_t &,
+  ur_result_t getFreeSlotInExistingOrNewPool(EventPool *&, size_t &,
                                              bool HostVisible,
                                              bool ProfilingEnabled,
                                              ur_device_handle_t Device,
@@ -228,7 +434,7 @@ struct ur_context_handle_t_ : _ur_object {
     HostInvisibleCounterBasedImmediateCacheType
   };
 
-  std::list<ze_event_pool_handle_t> *
+  std::list<std::unique_ptr<EventPool>> *
   getZeEventPoolCache(bool HostVisible, bool WithProfiling,
                       bool CounterBasedEventEnabled, bool UsingImmediateCmdList,
                       ze_device_handle_t ZeDevice) {
@@ -275,8 +481,7 @@ struct ur_context_handle_t_ : _ur_object {
     return UR_RESULT_SUCCESS;
   }
 
-  // Decrement number of events living in the pool upon event destroy
-  // and return the pool to the cache if there are no unreleased events.
+  // Release the slot of the event in its pool upon event destroy.
   ur_result_t decrementUnreleasedEventsInPool(ur_event_handle_t Event);
 
   // Retrieves a command list for executing on this device along with
@@ -312,38 +517,6 @@ struct ur_context_handle_t_ : _ur_object {
   // Get handle to the L0 context
   ze_context_handle_t getZeHandle() const;
 
-private:
-  // Get the cache of events for a provided scope and profiling mode.
-  auto getEventCache(bool HostVisible, bool WithProfiling,
-                     ur_device_handle_t Device) {
-    if (HostVisible) {
-      if (Device) {
-        auto EventCachesMap =
-            WithProfiling ? &EventCachesDeviceMap[0] : &EventCachesDeviceMap[1];
-        if (EventCachesMap->find(Device) == EventCachesMap->end()) {
-          EventCaches.emplace_back();
-          EventCachesMap->insert(
-              std::make_pair(Device, EventCaches.size() - 1));
-        }
-        return &EventCaches[(*EventCachesMap)[Device]];
-      } else {
-        return WithProfiling ? &EventCaches[0] : &EventCaches[1];
-      }
-    } else {
-      if (Device) {
-        auto EventCachesMap =
-            WithProfiling ? &EventCachesDeviceMap[2] : &EventCachesDeviceMap[3];
-        if (EventCachesMap->find(Device) == EventCachesMap->end()) {
-          EventCaches.emplace_back();
-          EventCachesMap->insert(
-              std::make_pair(Device, EventCaches.size() - 1));
-        }
-        return &EventCaches[(*EventCachesMap)[Device]];
-      } else {
-        return WithProfiling ? &EventCaches[2] : &EventCaches[3];
-      }
-    }
-  }
 };
 
 // Helper function to release the context, a caller must lock the platform-level
@@ -189,7 +189,7 @@ uint64_t calculateGlobalMemSize(ur_device_handle_t Device) {
   return Device->ZeGlobalMemSize.operator->()->value;
 }
 
-ur_result_t urDeviceGetInfo(
+static ur_result_t getDeviceInfo(
     ur_device_handle_t Device,  ///< [in] handle of the device instance
     ur_device_info_t ParamName, ///< [in] type of the info to retrieve
     size_t propSize,  ///< [in] the number of bytes pointed to by ParamValue.
@@ -952,6 +952,40 @@ ur_result_t urDeviceGetInfo(
     // L0 doesn't support enqueueing native work through the urNativeEnqueueExp
     return ReturnValue(static_cast<ur_bool_t>(false));
   }
+  case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP: {
+#ifdef UR_ADAPTER_LEVEL_ZERO_V2
+    // The v2 queues don't run host tasks
+    return ReturnValue(static_cast<ur_bool_t>(false));
+#else
+    // Host tasks are run by a thread of the context, which single-threaded
+    // mode rules out
+    return ReturnValue(static_cast<ur_bool_t>(!SingleThreadMode));
+#endif
+  }
+  case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP: {
+#ifdef UR_ADAPTER_LEVEL_ZERO_V2
+    // The counter-based events of the v2 queues can't be shared between
+    // processes
+    return ReturnValue(static_cast<ur_bool_t>(false));
+#else
+    // Through event pools created with ZE_EVENT_POOL_FLAG_IPC
+    return ReturnValue(static_cast<ur_bool_t>(true));
+#endif
+  }
+  case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP: {
+#ifdef UR_ADAPTER_LEVEL_ZERO_V2
+    // Device allocations are taken from blocks zeroed ahead on a copy engine
+    return ReturnValue(static_cast<ur_bool_t>(true));
+#else
+    return ReturnValue(static_cast<ur_bool_t>(false));
+#endif
+  }
+  case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP: {
+    int NumaNode = Device->ZeNumaNode->value;
+    if (NumaNode < 0)
+      return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    return ReturnValue(static_cast<uint32_t>(NumaNode));
+  }
 
   case UR_DEVICE_INFO_ESIMD_SUPPORT: {
     // ESIMD is only supported by Intel GPUs.
@@ -1022,6 +1056,10 @@ ur_result_t urDeviceGetInfo(
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
     return ReturnValue(true);
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP: {
+#ifdef UR_ADAPTER_LEVEL_ZERO_V2
+    // The command lists of the v2 command-buffers aren't mutable
+    return ReturnValue(ur_device_command_buffer_update_capability_flags_t{0});
+#else
     const auto ZeMutableCommandFlags =
         Device->ZeDeviceMutableCmdListsProperties->mutableCommandFlags;
 
@@ -1049,6 +1087,7 @@ ur_result_t urDeviceGetInfo(
           UR_DEVICE_COMMAND_BUFFER_UPDATE_CAPABILITY_FLAG_GLOBAL_WORK_OFFSET;
     }
     return ReturnValue(UpdateCapabilities);
+#endif
   }
   case UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP:
     return ReturnValue(false);
@@ -1165,6 +1204,21 @@ ur_result_t urDeviceGetInfo(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urDeviceGetInfo(
+    ur_device_handle_t Device,  ///< [in] handle of the device instance
+    ur_device_info_t ParamName, ///< [in] type of the info to retrieve
+    size_t propSize,  ///< [in] the number of bytes pointed to by ParamValue.
+    void *ParamValue, ///< [out][optional] array of bytes holding the info.
+    size_t *pSize ///< [out][optional] pointer to the actual size in bytes of
+                  ///< the queried infoType.
+) {
+  return Device->InfoCache.get(
+      ParamName, propSize, ParamValue, pSize,
+      [&](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(Device, ParamName, Size, Value, SizeRet);
+      });
+}
+
 bool CopyEngineRequested(const ur_device_handle_t &Device) {
   int LowerCopyQueueIndex = getRangeOfAllowedCopyEngines(Device).first;
   int UpperCopyQueueIndex = getRangeOfAllowedCopyEngines(Device).second;
@@ -1463,6 +1517,38 @@ bool ur_device_handle_t_::useRelaxedAllocationLimits() {
   return EnableRelaxedAllocationLimits;
 }
 
+uint32_t ur_device_handle_t_::placeQueue(uint32_t LowerIndex,
+                                         uint32_t UpperIndex) {
+  // Threads running near each other tend to create their queues in turn, so
+  // keeping the queues of a thread together keeps them near the same engine.
+  thread_local std::unordered_map<ur_device_handle_t_ *, uint32_t>
+      LastPlacement;
+
+  std::scoped_lock<std::mutex> Lock(PlacedQueuesMutex);
+  if (PlacedQueues.size() <= UpperIndex)
+    PlacedQueues.resize(UpperIndex + 1);
+
+  uint32_t Index = LowerIndex;
+  auto Last = LastPlacement.find(this);
+  if (Last != LastPlacement.end() && Last->second >= LowerIndex &&
+      Last->second <= UpperIndex)
+    Index = Last->second;
+  for (uint32_t I = LowerIndex; I <= UpperIndex; I++) {
+    if (PlacedQueues[I] < PlacedQueues[Index])
+      Index = I;
+  }
+
+  PlacedQueues[Index]++;
+  LastPlacement[this] = Index;
+  return Index;
+}
+
+void ur_device_handle_t_::unplaceQueue(uint32_t Index) {
+  std::scoped_lock<std::mutex> Lock(PlacedQueuesMutex);
+  assert(Index < PlacedQueues.size() && PlacedQueues[Index] > 0);
+  PlacedQueues[Index]--;
+}
+
 bool ur_device_handle_t_::useDriverInOrderLists() {
   // Use in-order lists implementation from L0 driver instead
   // of adapter's implementation.
@@ -1513,6 +1599,22 @@ ur_result_t ur_device_handle_t_::initialize(int SubSubDeviceOrdinal,
         ZE_CALL_NOCHECK(zeDeviceGetModuleProperties, (ZeDevice, &Properties));
       };
 
+  ZeNumaNode.Compute = [ZeDevice](struct ze_numa_node &NumaNode) {
+    ZeStruct<ze_pci_ext_properties_t> ZeDevicePciProperties;
+    if (ZE_CALL_NOCHECK(zeDevicePciGetPropertiesExt,
+                        (ZeDevice, &ZeDevicePciProperties)) !=
+        ZE_RESULT_SUCCESS)
+      return;
+    constexpr size_t AddressBufferSize = 13;
+    char AddressBuffer[AddressBufferSize];
+    std::snprintf(AddressBuffer, AddressBufferSize, "%04x:%02x:%02x.%01x",
+                  ZeDevicePciProperties.address.domain,
+                  ZeDevicePciProperties.address.bus,
+                  ZeDevicePciProperties.address.device,
+                  ZeDevicePciProperties.address.function);
+    NumaNode.value = ur_pci_numa_node(AddressBuffer);
+  };
+
   ZeDeviceMemoryProperties.Compute =
       [ZeDevice](
           std::pair<std::vector<ZeStruct<ze_device_memory_properties_t>>,
@@ -1705,10 +1807,10 @@ void ZeUSMImportExtension::setZeUSMImport(ur_platform_handle_t_ *Platform) {
     setEnvVar("SYCL_HOST_UNIFIED_MEMORY", "1");
   }
 }
-void ZeUSMImportExtension::doZeUSMImport(ze_driver_handle_t DriverHandle,
+bool ZeUSMImportExtension::doZeUSMImport(ze_driver_handle_t DriverHandle,
                                          void *HostPtr, size_t Size) {
-  ZE_CALL_NOCHECK(zexDriverImportExternalPointer,
-                  (DriverHandle, HostPtr, Size));
+  return ZE_CALL_NOCHECK(zexDriverImportExternalPointer,
+                         (DriverHandle, HostPtr, Size)) == ZE_RESULT_SUCCESS;
 }
 void ZeUSMImportExtension::doZeUSMRelease(ze_driver_handle_t DriverHandle,
                                           void *HostPtr) {
@@ -45,6 +45,11 @@ struct ze_global_memsize {
   uint64_t value;
 };
 
+struct ze_numa_node {
+  // NUMA node of the host closest to the device, -1 if unknown
+  int value = -1;
+};
+
 enum ur_ze_external_memory_desc_type {
   UR_ZE_EXTERNAL_OPAQUE_FD,
   UR_ZE_EXTERNAL_WIN32,
@@ -202,12 +207,23 @@ struct ur_device_handle_t_ : _ur_object {
                .ZeIndex >= 0;
   }
 
+  // Picks the compute engine in [LowerIndex, UpperIndex] of the queue group
+  // which the fewest placed queues use, preferring the one the calling thread
+  // placed its last queue on, and places a queue on it.
+  uint32_t placeQueue(uint32_t LowerIndex, uint32_t UpperIndex);
+  // Removes a queue placed on the compute engine Index.
+  void unplaceQueue(uint32_t Index);
+
   uint64_t getTimestampMask() {
     auto ValidBits = ZeDeviceProperties->kernelTimestampValidBits;
     assert(ValidBits <= 64);
     return ValidBits == 64 ? ~0ULL : (1ULL << ValidBits) - 1ULL;
   }
 
+  // Number of the queues placed on each compute engine by placeQueue.
+  std::vector<uint32_t> PlacedQueues;
+  std::mutex PlacedQueuesMutex;
+
   // Cache of the immutable device properties.
   ZeCache<ZeStruct<ze_device_properties_t>> ZeDeviceProperties;
   ZeCache<ZeStruct<ze_device_compute_properties_t>> ZeDeviceComputeProperties;
@@ -221,9 +237,13 @@ struct ur_device_handle_t_ : _ur_object {
   ZeCache<ZeStruct<ze_device_cache_properties_t>> ZeDeviceCacheProperties;
   ZeCache<ZeStruct<ze_device_ip_version_ext_t>> ZeDeviceIpVersionExt;
   ZeCache<struct ze_global_memsize> ZeGlobalMemSize;
+  ZeCache<struct ze_numa_node> ZeNumaNode;
   ZeCache<ZeStruct<ze_mutable_command_list_exp_properties_t>>
       ZeDeviceMutableCmdListsProperties;
 
+  // Values of the immutable properties already returned by urDeviceGetInfo
+  ur::DeviceInfoCache InfoCache;
+
   // Map device bindless image offset to corresponding host image handle.
   std::unordered_map<ur_exp_image_native_handle_t, ze_image_handle_t>
       ZeOffsetToImageHandleMap;
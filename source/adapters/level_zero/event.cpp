@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <chrono>
 #include <climits>
 #include <mutex>
 #include <optional>
@@ -649,15 +650,27 @@ ur_result_t urEventGetProfilingInfo(
     }
   }
 
+  // Read the timestamps copied out by the command list of the event, once it
+  // completed, and only query the event when they aren't there.
+  auto queryKernelTimestamp = [&]() -> ur_result_t {
+    auto &Timestamps = Event->KernelTimestamps;
+    if (Timestamps && Timestamps->Ready) {
+      tsResult = Timestamps->Timestamps[Event->KernelTimestampsIndex];
+      return UR_RESULT_SUCCESS;
+    }
+    ZE2UR_CALL(zeEventQueryKernelTimestamp, (Event->ZeEvent, &tsResult));
+    return UR_RESULT_SUCCESS;
+  };
+
   switch (PropName) {
   case UR_PROFILING_INFO_COMMAND_START: {
-    ZE2UR_CALL(zeEventQueryKernelTimestamp, (Event->ZeEvent, &tsResult));
+    UR_CALL(queryKernelTimestamp());
     uint64_t ContextStartTime =
         (tsResult.global.kernelStart & TimestampMaxValue) * ZeTimerResolution;
     return ReturnValue(ContextStartTime);
   }
   case UR_PROFILING_INFO_COMMAND_END: {
-    ZE2UR_CALL(zeEventQueryKernelTimestamp, (Event->ZeEvent, &tsResult));
+    UR_CALL(queryKernelTimestamp());
 
     uint64_t ContextStartTime =
         (tsResult.global.kernelStart & TimestampMaxValue);
@@ -749,6 +762,30 @@ ur_result_t urEnqueueTimestampRecordingExp(
   return UR_RESULT_SUCCESS;
 }
 
+// Submits the open command lists of the queues of the events for execution, so
+// that the events can be waited for. Each queue is flushed once, however many
+// of the events are on it.
+static ur_result_t
+executeOpenCommandListsOfEvents(uint32_t NumEvents,
+                                const ur_event_handle_t *EventWaitList) {
+  std::vector<ur_queue_handle_t> Queues;
+  Queues.reserve(NumEvents);
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    if (auto UrQueue = EventWaitList[I]->UrQueue) {
+      Queues.push_back(UrQueue);
+    }
+  }
+  std::sort(Queues.begin(), Queues.end());
+  Queues.erase(std::unique(Queues.begin(), Queues.end()), Queues.end());
+  for (auto UrQueue : Queues) {
+    // Lock automatically releases when this goes out of scope.
+    std::scoped_lock<ur_shared_mutex> lock(UrQueue->Mutex);
+
+    UR_CALL(UrQueue->executeAllOpenCommandLists());
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t
 urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
             const ur_event_handle_t
@@ -772,17 +809,7 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
         return Res;
     }
   }
-  // Submit dependent open command lists for execution, if any
-  for (uint32_t I = 0; I < NumEvents; I++) {
-    ur_event_handle_t_ *Event = ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
-    auto UrQueue = Event->UrQueue;
-    if (UrQueue) {
-      // Lock automatically releases when this goes out of scope.
-      std::scoped_lock<ur_shared_mutex> lock(UrQueue->Mutex);
-
-      UR_CALL(UrQueue->executeAllOpenCommandLists());
-    }
-  }
+  UR_CALL(executeOpenCommandListsOfEvents(NumEvents, EventWaitList));
   std::unordered_set<ur_queue_handle_t> Queues;
   for (uint32_t I = 0; I < NumEvents; I++) {
     {
@@ -799,7 +826,7 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
             die("The host-visible proxy event missing");
 
           ze_event_handle_t ZeEvent = HostVisibleEvent->ZeEvent;
-          logger::debug("ZeEvent = {}", ur_cast<std::uintptr_t>(ZeEvent));
+          UR_LOG(DEBUG, "ZeEvent = {}", ur_cast<std::uintptr_t>(ZeEvent));
           // If this event was an inner batched event, then sync with
           // the Queue instead of waiting on the event.
           if (HostVisibleEvent->IsInnerBatchedEvent && Event->ZeBatchedQueue) {
@@ -839,9 +866,60 @@ urEventWait(uint32_t NumEvents, ///< [in] number of events in the event list
     resetCommandLists(Q);
   }
 
+  // The callbacks of the events have run once the wait returns
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    EventWaitList[I]->Context->EventNotifier.flush(EventWaitList[I]);
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urEventWaitAnyExp(uint32_t NumEvents,
+                              const ur_event_handle_t *EventWaitList,
+                              uint32_t *Index) {
+  for (uint32_t I = 0; I < NumEvents; I++) {
+    ur_event_handle_t_ *Event = ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
+    if (!Event->hasExternalRefs())
+      die("urEventWaitAnyExp must not be called for an internal event");
+
+    // The host-visible proxy events are queried below, as in urEventWait.
+    auto UrQueue = Event->UrQueue;
+    if (UrQueue && UrQueue->ZeEventsScope == OnDemandHostVisibleProxy) {
+      ze_event_handle_t ZeHostVisibleEvent;
+      if (auto Res = Event->getOrCreateHostVisibleEvent(ZeHostVisibleEvent))
+        return Res;
+    }
+  }
+  UR_CALL(executeOpenCommandListsOfEvents(NumEvents, EventWaitList));
+
+  auto Query = [&](uint32_t I, bool &Completed) {
+    ur_event_handle_t_ *Event = ur_cast<ur_event_handle_t_ *>(EventWaitList[I]);
+    std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+    Completed = Event->Completed;
+    if (!Completed) {
+      auto HostVisibleEvent = Event->HostVisibleEvent;
+      if (!HostVisibleEvent)
+        return UR_RESULT_ERROR_INVALID_EVENT;
+      // Inner batched events are never signaled, their batched queue is
+      // polled instead, as urEventWait synchronizes with it.
+      if (HostVisibleEvent->IsInnerBatchedEvent && Event->ZeBatchedQueue)
+        Completed = ZE_CALL_NOCHECK(zeCommandQueueSynchronize,
+                                    (Event->ZeBatchedQueue, 0)) ==
+                    ZE_RESULT_SUCCESS;
+      else
+        Completed = ZE_CALL_NOCHECK(zeEventQueryStatus,
+                                    (HostVisibleEvent->ZeEvent)) ==
+                    ZE_RESULT_SUCCESS;
+    }
+    return UR_RESULT_SUCCESS;
+  };
+  UR_CALL(ur::waitAnyEvent(NumEvents, Query, *Index));
+
+  // The event has completed, waiting for it marks it so, cleans up after it
+  // and runs its callbacks without blocking.
+  return ur::level_zero::urEventWait(1, &EventWaitList[*Index]);
+}
+
 ur_result_t
 urEventRetain(ur_event_handle_t Event ///< [in] handle of the event object
 ) {
@@ -961,13 +1039,332 @@ ur_result_t urEventSetCallback(
     void *UserData ///< [in][out][optional] pointer to data to be passed to
                    ///< callback.
 ) {
-  std::ignore = Event;
-  std::ignore = ExecStatus;
-  std::ignore = Notify;
-  std::ignore = UserData;
-  logger::error(logger::LegacyMessage("[UR][L0] {} function not implemented!"),
-                "{} function not implemented!", __FUNCTION__);
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  // The events are polled with zeEventQueryStatus, through urEventGetInfo
+  // which also submits the open command lists of their queues, from the
+  // notifier thread of the context.
+  return Event->Context->EventNotifier.add(Event, ExecStatus, Notify,
+                                           UserData);
+}
+
+// A host task whose dependencies are being waited for, with the event the
+// commands after it wait for, signaled by the host once the task returned.
+struct host_task_t {
+  ur_exp_host_task_function_t Fn;
+  void *UserData;
+  ur_event_handle_t Signal;
+};
+
+// Called from the notifier thread of the context once the host task's
+// dependencies completed.
+static void runHostTask(ur_event_handle_t, ur_execution_info_t, void *Data) {
+  std::unique_ptr<host_task_t> Task{static_cast<host_task_t *>(Data)};
+  Task->Fn(Task->UserData);
+  ZE_CALL_NOCHECK(zeEventHostSignal, (Task->Signal->ZeEvent));
+  urEventReleaseInternal(Task->Signal);
+}
+
+// Called when the context is released before the host task's dependencies
+// completed. The task isn't run, but the commands after it are unblocked.
+static void dropHostTask(ur_event_handle_t, ur_execution_info_t, void *Data) {
+  std::unique_ptr<host_task_t> Task{static_cast<host_task_t *>(Data)};
+  ZE_CALL_NOCHECK(zeEventHostSignal, (Task->Signal->ZeEvent));
+  urEventReleaseInternal(Task->Signal);
+}
+
+ur_result_t urEnqueueHostTaskExp(
+    ur_queue_handle_t Queue,                 ///< [in] handle of the queue object
+    ur_exp_host_task_function_t pfnHostTask, ///< [in] function run on the host
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before the host task is run.
+    ur_event_handle_t
+        *OutEvent ///< [out][optional] return an event object that is
+                  ///< complete once pfnHostTask returned.
+) {
+  // The task is run by the notifier thread of the context
+  if (SingleThreadMode)
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+  // The dependencies of the task. Without a wait list, a wait would block the
+  // host until the queue is done, which a barrier doesn't.
+  ur_event_handle_t Ready = nullptr;
+  if (NumEventsInWaitList) {
+    UR_CALL(urEnqueueEventsWait(Queue, NumEventsInWaitList, EventWaitList,
+                                &Ready));
+  } else {
+    UR_CALL(urEnqueueEventsWaitWithBarrier(Queue, 0, nullptr, &Ready));
+  }
+
+  // The commands after the task wait for the host to signal Signal, which the
+  // wait on it retains until it completed.
+  ur_event_handle_t Signal = nullptr;
+  ur_result_t Res = EventCreate(Queue->Context, nullptr /*Queue*/,
+                                false /*IsMultiDevice*/, true /*HostVisible*/,
+                                &Signal, false /*CounterBasedEventEnabled*/,
+                                true /*ForceDisableProfiling*/);
+  if (Res != UR_RESULT_SUCCESS) {
+    urEventRelease(Ready);
+    return Res;
+  }
+  ur_event_handle_t Done = nullptr;
+  Res = urEnqueueEventsWait(Queue, 1, &Signal, &Done);
+  if (Res != UR_RESULT_SUCCESS) {
+    urEventReleaseInternal(Signal);
+    urEventRelease(Ready);
+    return Res;
+  }
+  Done->CommandType = UR_COMMAND_ENQUEUE_HOST_TASK_EXP;
+
+  try {
+    auto Task = std::make_unique<host_task_t>(
+        host_task_t{pfnHostTask, pUserData, Signal});
+    Res = Queue->Context->EventNotifier.add(Ready, UR_EXECUTION_INFO_COMPLETE,
+                                            runHostTask, Task.get(),
+                                            dropHostTask);
+    if (Res == UR_RESULT_SUCCESS)
+      Task.release();
+  } catch (const std::bad_alloc &) {
+    Res = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  if (Res != UR_RESULT_SUCCESS) {
+    // Unblock the commands after the task, which won't run
+    ZE_CALL_NOCHECK(zeEventHostSignal, (Signal->ZeEvent));
+    urEventReleaseInternal(Signal);
+  }
+  urEventRelease(Ready);
+
+  if (OutEvent && Res == UR_RESULT_SUCCESS)
+    *OutEvent = Done;
+  else
+    urEventRelease(Done);
+  return Res;
+}
+
+// The IPC handle of an event is the one of its pool, with the process which
+// created it to duplicate its file descriptor from.
+typedef struct ze_ipc_event_data_t {
+  int pid;
+  ze_ipc_event_pool_handle_t zeHandle;
+} ze_ipc_event_data_t;
+
+static_assert(sizeof(ze_ipc_event_data_t) <=
+                  sizeof(ur_exp_ipc_event_handle_t::data),
+              "ze_ipc_event_data_t doesn't fit in ur_exp_ipc_event_handle_t");
+
+// Creates the event at index 0 of ZeEventPool, the only event of the pool.
+// The pool is released with the event, see urEventReleaseInternal.
+static ur_result_t createIPCEvent(ur_context_handle_t Context,
+                                  ze_event_pool_handle_t ZeEventPool,
+                                  bool Imported, ur_event_handle_t *Event) {
+  ZeStruct<ze_event_desc_t> ZeEventDesc;
+  ZeEventDesc.index = 0;
+  ZeEventDesc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+  ZeEventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+
+  ze_event_handle_t ZeEvent;
+  ZE2UR_CALL(zeEventCreate, (ZeEventPool, &ZeEventDesc, &ZeEvent));
+
+  try {
+    *Event = new ur_event_handle_t_(ZeEvent, ZeEventPool, Context,
+                                    UR_EXT_COMMAND_TYPE_USER, false);
+  } catch (const std::bad_alloc &) {
+    ZE_CALL_NOCHECK(zeEventDestroy, (ZeEvent));
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  } catch (...) {
+    ZE_CALL_NOCHECK(zeEventDestroy, (ZeEvent));
+    return UR_RESULT_ERROR_UNKNOWN;
+  }
+  (*Event)->IsIPC = true;
+  (*Event)->IsIPCImported = Imported;
+  (*Event)->HostVisibleEvent = *Event;
+  // Only the IPC commands use the event, there's nothing to clean up after
+  (*Event)->CleanedUp = true;
+  (*Event)->RefCountExternal++;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventCreateIPCExp(
+    ur_context_handle_t Context, ///< [in] handle of the context object
+    ur_device_handle_t Device,   ///< [in] handle of the device of the queues
+                                 ///< signaling and waiting for the event
+    ur_event_handle_t
+        *Event ///< [out] pointer to the handle of the event object created
+) {
+  ZeStruct<ze_event_pool_desc_t> ZeEventPoolDesc;
+  ZeEventPoolDesc.count = 1;
+  ZeEventPoolDesc.flags =
+      ZE_EVENT_POOL_FLAG_IPC | ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+
+  ze_device_handle_t ZeDevice = Device->ZeDevice;
+  ze_event_pool_handle_t ZeEventPool = nullptr;
+  ZE2UR_CALL(zeEventPoolCreate, (Context->ZeContext, &ZeEventPoolDesc, 1,
+                                 &ZeDevice, &ZeEventPool));
+
+  if (auto Res =
+          createIPCEvent(Context, ZeEventPool, false /*Imported*/, Event)) {
+    ZE_CALL_NOCHECK(zeEventPoolDestroy, (ZeEventPool));
+    return Res;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventGetIPCHandleExp(
+    ur_event_handle_t Event, ///< [in] handle of an event created with
+                             ///< urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t
+        *IPCHandle ///< [out] pointer to the IPC handle of the event
+) {
+  // The handle of an opened event can't be passed on
+  if (!Event->IsIPC || Event->IsIPCImported)
+    return UR_RESULT_ERROR_INVALID_EVENT;
+
+  ze_ipc_event_data_t ZeIpcData{};
+  ZE2UR_CALL(zeEventPoolGetIpcHandle,
+             (Event->ZeEventPool, &ZeIpcData.zeHandle));
+  ZeIpcData.pid = ur_getpid();
+
+  memset(IPCHandle->data, 0, sizeof(IPCHandle->data));
+  memcpy(IPCHandle->data, &ZeIpcData, sizeof(ZeIpcData));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urEventOpenIPCHandleExp(
+    ur_context_handle_t Context, ///< [in] handle of the context object
+    ur_device_handle_t Device,   ///< [in] handle of the device of the queues
+                                 ///< signaling and waiting for the event
+    const ur_exp_ipc_event_handle_t
+        *IPCHandle, ///< [in] pointer to the IPC handle, from
+                    ///< urEventGetIPCHandleExp in another process
+    ur_event_handle_t
+        *Event ///< [out] pointer to the handle of the event object created
+) {
+  std::ignore = Device;
+
+  ze_ipc_event_data_t ZeIpcData;
+  memcpy(&ZeIpcData, IPCHandle->data, sizeof(ZeIpcData));
+
+  // Level Zero opens the handles of other processes only
+  if (ZeIpcData.pid == ur_getpid())
+    return UR_RESULT_ERROR_INVALID_VALUE;
+
+  int fdRemote = -1;
+  memcpy(&fdRemote, &ZeIpcData.zeHandle, sizeof(fdRemote));
+  int fdLocal = ur_duplicate_fd(ZeIpcData.pid, fdRemote);
+  if (fdLocal == -1) {
+    logger::error("duplicating file descriptor from IPC handle failed");
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+  memcpy(&ZeIpcData.zeHandle, &fdLocal, sizeof(fdLocal));
+
+  ze_event_pool_handle_t ZeEventPool = nullptr;
+  auto ZeResult =
+      ZE_CALL_NOCHECK(zeEventPoolOpenIpcHandle,
+                      (Context->ZeContext, ZeIpcData.zeHandle, &ZeEventPool));
+  ur_close_fd(fdLocal);
+  if (ZeResult != ZE_RESULT_SUCCESS)
+    return ze2urResult(ZeResult);
+
+  if (auto Res =
+          createIPCEvent(Context, ZeEventPool, true /*Imported*/, Event)) {
+    ZE_CALL_NOCHECK(zeEventPoolCloseIpcHandle, (ZeEventPool));
+    return Res;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// Appends the signal of an IPC event, or the wait for it, after the wait list
+// and before the signal of the event of the command.
+static ur_result_t enqueueIPCEventCommand(ur_queue_handle_t Queue,
+                                          ur_event_handle_t IPCEvent,
+                                          ur_command_t CommandType,
+                                          uint32_t NumEventsInWaitList,
+                                          const ur_event_handle_t *EventWaitList,
+                                          ur_event_handle_t *OutEvent) {
+  if (!IPCEvent->IsIPC)
+    return UR_RESULT_ERROR_INVALID_EVENT;
+
+  bool UseCopyEngine = false;
+
+  // Lock automatically releases when this goes out of scope.
+  std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
+
+  _ur_ze_event_list_t TmpWaitList = {};
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+  // Get a new command list to be used on this call
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, UseCopyEngine, NumEventsInWaitList, EventWaitList,
+      false /*AllowBatching*/, nullptr /*ForceCmdQueue*/));
+
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = OutEvent == nullptr;
+  ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
+                                       IsInternal, false));
+  (*Event)->WaitList = TmpWaitList;
+
+  const auto &WaitList = (*Event)->WaitList;
+  auto ZeCommandList = CommandList->first;
+  if (WaitList.Length) {
+    ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
+               (ZeCommandList, WaitList.Length, WaitList.ZeEventList));
+  }
+
+  if (CommandType == UR_COMMAND_IPC_EVENT_SIGNAL_EXP) {
+    ZE2UR_CALL(zeCommandListAppendSignalEvent,
+               (ZeCommandList, IPCEvent->ZeEvent));
+  } else {
+    // The wait consumes the signal, so that the next wait is for the next
+    // signal
+    ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
+               (ZeCommandList, 1, &IPCEvent->ZeEvent));
+    ZE2UR_CALL(zeCommandListAppendEventReset,
+               (ZeCommandList, IPCEvent->ZeEvent));
+  }
+
+  ZE2UR_CALL(zeCommandListAppendSignalEvent,
+             (ZeCommandList, (*Event)->ZeEvent));
+
+  return Queue->executeCommandList(CommandList, false /*IsBlocking*/,
+                                   false /*OKToBatchCommand*/);
+}
+
+ur_result_t urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t Queue,      ///< [in] handle of the queue object
+    ur_event_handle_t IPCEvent,   ///< [in] handle of the IPC event to signal
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before the IPC event is signaled.
+    ur_event_handle_t
+        *OutEvent ///< [out][optional] return an event object that identifies
+                  ///< this particular command instance.
+) {
+  return enqueueIPCEventCommand(Queue, IPCEvent,
+                                UR_COMMAND_IPC_EVENT_SIGNAL_EXP,
+                                NumEventsInWaitList, EventWaitList, OutEvent);
+}
+
+ur_result_t urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t Queue,      ///< [in] handle of the queue object
+    ur_event_handle_t IPCEvent,   ///< [in] handle of the IPC event to wait for
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before the command starts waiting.
+    ur_event_handle_t
+        *OutEvent ///< [out][optional] return an event object that is complete
+                  ///< once the IPC event was signaled.
+) {
+  return enqueueIPCEventCommand(Queue, IPCEvent, UR_COMMAND_IPC_EVENT_WAIT_EXP,
+                                NumEventsInWaitList, EventWaitList, OutEvent);
 }
 
 } // namespace ur::level_zero
@@ -1028,8 +1425,11 @@ ur_result_t urEventReleaseInternal(ur_event_handle_t Event) {
 
   if (Event->CommandType == UR_COMMAND_MEM_UNMAP && Event->CommandData) {
     // Free the memory allocated in the urEnqueueMemBufferMap.
+    auto Size = USMAllocSize(Event->Context, Event->CommandData, 0);
     if (auto Res = ZeMemFreeHelper(Event->Context, Event->CommandData))
       return Res;
+    Event->Context->MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+                                            Size);
     Event->CommandData = nullptr;
   }
   if (Event->CommandType == UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP &&
@@ -1041,6 +1441,16 @@ ur_result_t urEventReleaseInternal(ur_event_handle_t Event) {
     delete ProfilingPtr;
     Event->CommandData = nullptr;
   }
+  // Cached events don't keep the timestamps of their last command alive.
+  Event->KernelTimestamps = nullptr;
+  if (Event->IsIPC) {
+    // The pool was created or opened for the event alone
+    ZE_CALL_NOCHECK(zeEventDestroy, (Event->ZeEvent));
+    if (Event->IsIPCImported)
+      ZE_CALL_NOCHECK(zeEventPoolCloseIpcHandle, (Event->ZeEventPool));
+    else
+      ZE_CALL_NOCHECK(zeEventPoolDestroy, (Event->ZeEventPool));
+  }
   if (Event->OwnNativeHandle) {
     if (DisableEventsCaching) {
       auto ZeResult = ZE_CALL_NOCHECK(zeEventDestroy, (Event->ZeEvent));
@@ -1100,12 +1510,32 @@ ur_result_t urEventReleaseInternal(ur_event_handle_t Event) {
   return UR_RESULT_SUCCESS;
 }
 
+// Time a host synchronization polls for completion before blocking, set in
+// microseconds by UR_L0_HOST_SYNC_SPIN_US. Waking up from a blocking wait
+// takes longer than short commands do, so polling first lowers the latency of
+// these waits, at the price of a busy core while polling.
+static const std::chrono::microseconds HostSyncSpinTime = [] {
+  const char *SpinStr = std::getenv("UR_L0_HOST_SYNC_SPIN_US");
+  int Spin = SpinStr ? std::atoi(SpinStr) : 0;
+  return std::chrono::microseconds(Spin > 0 ? Spin : 0);
+}();
+
 // Helper function to implement zeHostSynchronize.
 // The behavior is to avoid infinite wait during host sync under ZE_DEBUG.
 // This allows for a much more responsive debugging of hangs.
 //
 template <typename T, typename Func>
 ze_result_t zeHostSynchronizeImpl(Func Api, T Handle) {
+  if (HostSyncSpinTime.count() > 0) {
+    auto Deadline = std::chrono::steady_clock::now() + HostSyncSpinTime;
+    do {
+      // A zero timeout only queries the status
+      auto R = Api(Handle, 0);
+      if (R != ZE_RESULT_NOT_READY)
+        return R;
+    } while (std::chrono::steady_clock::now() < Deadline);
+  }
+
   if (!UrL0Debug) {
     return Api(Handle, UINT64_MAX);
   }
@@ -1127,6 +1557,49 @@ template <> ze_result_t zeHostSynchronize(ze_event_handle_t Handle) {
 template <> ze_result_t zeHostSynchronize(ze_command_queue_handle_t Handle) {
   return zeHostSynchronizeImpl(zeCommandQueueSynchronize, Handle);
 }
+template <> ze_result_t zeHostSynchronize(ze_command_list_handle_t Handle) {
+  return zeHostSynchronizeImpl(zeCommandListHostSynchronize, Handle);
+}
+
+// Notifies the device activity of the command of a completed event, which the
+// caller locked.
+static void notifyEventActivity(ur_event_handle_t Event) {
+  auto Submit = Event->ActivitySubmit;
+  Event->ActivitySubmit = {};
+  // Inner batched events are signalled after their batch, and command-buffers
+  // keep their timestamps apart.
+  if (Event->IsInnerBatchedEvent || Event->isTimestamped() ||
+      Event->CommandType == UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP)
+    return;
+
+  ze_kernel_timestamp_result_t Timestamps;
+  if (auto &Copied = Event->KernelTimestamps; Copied && Copied->Ready) {
+    Timestamps = Copied->Timestamps[Event->KernelTimestampsIndex];
+  } else if (ZE_CALL_NOCHECK(zeEventQueryKernelTimestamp,
+                             (Event->ZeEvent, &Timestamps)) !=
+             ZE_RESULT_SUCCESS) {
+    return;
+  }
+
+  const char *Name = nullptr;
+  if (Event->CommandType == UR_COMMAND_KERNEL_LAUNCH && Event->CommandData) {
+    auto Kernel = reinterpret_cast<ur_kernel_handle_t>(Event->CommandData);
+    Name = Kernel->ZeKernelName->c_str();
+  }
+  l0_activity_record_t Record{Event->CommandType,
+                              Name,
+                              Submit.Submit,
+                              Submit.Thread,
+                              0,
+                              0,
+                              nullptr,
+                              nullptr,
+                              Submit.Engine,
+                              Submit.Ordinal,
+                              Submit.Index};
+  notifyL0Activity(Event->UrQueue->Device, Record,
+                   Timestamps.global.kernelStart, Timestamps.global.kernelEnd);
+}
 
 // Perform any necessary cleanup after an event has been signalled.
 // This currently makes sure to release any kernel that may have been used by
@@ -1154,6 +1627,9 @@ ur_result_t CleanupCompletedEvent(ur_event_handle_t Event, bool QueueLocked,
 
     AssociatedQueue = Event->UrQueue;
 
+    if (Event->ActivitySubmit.Submit)
+      notifyEventActivity(Event);
+
     // Remember the kernel associated with this event if there is one. We are
     // going to release it later.
     if (Event->CommandType == UR_COMMAND_KERNEL_LAUNCH && Event->CommandData) {
@@ -1174,29 +1650,17 @@ ur_result_t CleanupCompletedEvent(ur_event_handle_t Event, bool QueueLocked,
     if (IndirectAccessTrackingEnabled) {
       // urKernelRelease is called by CleanupCompletedEvent(Event) as soon as
       // kernel execution has finished. This is the place where we need to
-      // release memory allocations. If kernel is not in use (not submitted by
-      // some other thread) then release referenced memory allocations. As a
+      // perform the frees deferred while the kernel was in flight. As a
       // result, memory can be deallocated and context can be removed from
-      // container in the platform. That's why we need to lock a mutex here.
-      ur_platform_handle_t Plt = Kernel->Program->Context->getPlatform();
-      std::scoped_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex);
-
-      if (--Kernel->SubmissionsCount == 0) {
-        // Kernel is not submitted for execution, release referenced memory
-        // allocations.
-        for (auto &MemAlloc : Kernel->MemAllocs) {
-          // std::pair<void *const, MemAllocRecord> *, Hash
-          USMFreeHelper(MemAlloc->second.Context, MemAlloc->first,
-                        MemAlloc->second.OwnNativeHandle);
-        }
-        Kernel->MemAllocs.clear();
-      }
+      // container in the platform.
+      return IndirectAccessKernelCompleted(Kernel);
     }
+    return UR_RESULT_SUCCESS;
   };
 
   // We've reset event data members above, now cleanup resources.
   if (AssociatedKernel) {
-    ReleaseIndirectMem(AssociatedKernel);
+    UR_CALL(ReleaseIndirectMem(AssociatedKernel));
     UR_CALL(ur::level_zero::urKernelRelease(AssociatedKernel));
   }
 
@@ -1255,7 +1719,7 @@ ur_result_t CleanupCompletedEvent(ur_event_handle_t Event, bool QueueLocked,
       }
     }
     if (DepEventKernel) {
-      ReleaseIndirectMem(DepEventKernel);
+      UR_CALL(ReleaseIndirectMem(DepEventKernel));
       UR_CALL(ur::level_zero::urKernelRelease(DepEventKernel));
     }
     UR_CALL(urEventReleaseInternal(DepEvent));
@@ -1291,14 +1755,15 @@ ur_result_t EventCreate(ur_context_handle_t Context, ur_queue_handle_t Queue,
   }
 
   ze_event_handle_t ZeEvent;
-  ze_event_pool_handle_t ZeEventPool = {};
+  EventPool *Pool = nullptr;
 
   size_t Index = 0;
 
   if (auto Res = Context->getFreeSlotInExistingOrNewPool(
-          ZeEventPool, Index, HostVisible, ProfilingEnabled, Device,
+          Pool, Index, HostVisible, ProfilingEnabled, Device,
           CounterBasedEventEnabled, UsingImmediateCommandlists))
     return Res;
+  ze_event_pool_handle_t ZeEventPool = Pool->getZeHandle();
 
   ZeStruct<ze_event_desc_t> ZeEventDesc;
   ZeEventDesc.index = Index;
@@ -1329,6 +1794,8 @@ ur_result_t EventCreate(ur_context_handle_t Context, ur_queue_handle_t Queue,
   } catch (...) {
     return UR_RESULT_ERROR_UNKNOWN;
   }
+  (*RetEvent)->Pool = Pool;
+  (*RetEvent)->PoolIndex = Index;
   (*RetEvent)->CounterBasedEventsEnabled = CounterBasedEventEnabled;
   if (HostVisible)
     (*RetEvent)->HostVisibleEvent =
@@ -1344,6 +1811,8 @@ ur_result_t ur_event_handle_t_::reset() {
   CommandData = nullptr;
   CommandType = UR_EXT_COMMAND_TYPE_USER;
   WaitList = {};
+  KernelTimestamps = nullptr;
+  ActivitySubmit = {};
   RefCountExternal = 0;
   RefCount.reset();
   CommandList = std::nullopt;
@@ -1430,6 +1899,16 @@ ur_result_t _ur_ze_event_list_t::createAndRetainUrZeEventList(
   }
 
   try {
+    // A duplicate would be retained, have its batch executed and be waited on
+    // twice
+    std::vector<ur_event_handle_t> UniqueEventList;
+    if (EventListLength > 1) {
+      ur::normalizeEventWaitList<ur_event_wait_traits_>(
+          EventList, EventListLength, UniqueEventList);
+      EventList = UniqueEventList.data();
+      EventListLength = static_cast<uint32_t>(UniqueEventList.size());
+    }
+
     uint32_t TmpListLength = 0;
 
     if (IncludeLastCommandEvent) {
@@ -25,7 +25,9 @@
 #include <zes_api.h>
 
 #include "common.hpp"
+#include "event_pool.hpp"
 #include "queue.hpp"
+#include "tracing.hpp"
 
 extern "C" {
 ur_result_t urEventReleaseInternal(ur_event_handle_t Event);
@@ -66,6 +68,16 @@ const bool FilterEventWaitList = [] {
   return RetVal;
 }();
 
+// Describes the events of wait lists to ur::normalizeEventWaitList, which then
+// only drops duplicates. Events of one in-order queue aren't collapsed, as they
+// may be in different batches or discarded, and whether an event completed is
+// only known under its lock.
+struct ur_event_wait_traits_ {
+  static const void *sequence(ur_event_handle_t) { return nullptr; }
+  static uint64_t order(ur_event_handle_t) { return 0; }
+  static bool isCompleted(ur_event_handle_t) { return false; }
+};
+
 struct _ur_ze_event_list_t {
   // List of level zero events for this event list.
   ze_event_handle_t *ZeEventList = {nullptr};
@@ -127,8 +139,8 @@ struct ur_event_handle_t_ : _ur_object {
                      ze_event_pool_handle_t ZeEventPool,
                      ur_context_handle_t Context, ur_command_t CommandType,
                      bool OwnZeEvent)
-      : ZeEvent{ZeEvent}, ZeEventPool{ZeEventPool}, Context{Context},
-        CommandType{CommandType}, CommandData{nullptr} {
+      : _ur_object("event"), ZeEvent{ZeEvent}, ZeEventPool{ZeEventPool},
+        Context{Context}, CommandType{CommandType}, CommandData{nullptr} {
     OwnNativeHandle = OwnZeEvent;
   }
 
@@ -138,6 +150,11 @@ struct ur_event_handle_t_ : _ur_object {
   // Level Zero event pool handle.
   ze_event_pool_handle_t ZeEventPool;
 
+  // Pool of the context the slot of ZeEvent was taken from, and the index of
+  // the slot. Null for events not created by the context.
+  EventPool *Pool = nullptr;
+  size_t PoolIndex = 0;
+
   // In case we use device-only events this holds their host-visible
   // counterpart. If this event is itself host-visble then HostVisibleEvent
   // points to this event. If this event is not host-visible then this field can
@@ -193,6 +210,15 @@ struct ur_event_handle_t_ : _ur_object {
   // plugin.
   bool IsDiscarded = {false};
 
+  // Kernel timestamps copied out by the command list of this event, and the
+  // index of this event in them, see ur_kernel_timestamps_t.
+  std::shared_ptr<ur_kernel_timestamps_t> KernelTimestamps;
+  uint32_t KernelTimestampsIndex = 0;
+
+  // Where the command of this event was enqueued, when its device activity is
+  // traced, see l0_activity_record_t.
+  l0_activity_submit_t ActivitySubmit;
+
   // Indicates that this event is needed to be visible by multiple devices.
   // When possible, allocate Event from single device pool for optimal
   // performance
@@ -207,6 +233,12 @@ struct ur_event_handle_t_ : _ur_object {
   // Indicates within creation of proxy event.
   bool IsCreatingHostProxyEvent = {false};
 
+  // Indicates an event shared with other processes, the only one of its
+  // ZeEventPool, which was created for it or opened from the IPC handle of
+  // another process.
+  bool IsIPC = {false};
+  bool IsIPCImported = {false};
+
   // Indicates the recorded start and end timestamps for the event. These are
   // only set for events returned by timestamp recording enqueue functions.
   // A non-zero value for RecordEventStartTimestamp indicates the event was the
@@ -267,6 +299,7 @@ ze_result_t zeHostSynchronizeImpl(Func Api, T Handle);
 template <typename T> ze_result_t zeHostSynchronize(T Handle);
 template <> ze_result_t zeHostSynchronize(ze_event_handle_t Handle);
 template <> ze_result_t zeHostSynchronize(ze_command_queue_handle_t Handle);
+template <> ze_result_t zeHostSynchronize(ze_command_list_handle_t Handle);
 
 // Perform any necessary cleanup after an event has been signalled.
 // This currently makes sure to release any kernel that may have been used by
@@ -0,0 +1,237 @@
+//===--------- event_cache.cpp - Level Zero Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "event_cache.hpp"
+#include "event.hpp"
+
+namespace {
+
+// Event caches alive, by id. Ids are never reused, so that a thread cache
+// left behind by a destroyed context can't be mistaken for a new context's.
+struct LiveEventCaches {
+  std::mutex Mutex;
+  std::unordered_map<uint64_t, EventCache *> Caches;
+  uint64_t NextId = 1;
+};
+
+LiveEventCaches &getLiveEventCaches() {
+  // Never destroyed, threads may exit after the static destructors ran
+  static auto *Live = new LiveEventCaches();
+  return *Live;
+}
+
+struct ThreadEventCaches {
+  // Last cache used by this thread
+  uint64_t LastId = 0;
+  ThreadEventCache *Last = nullptr;
+  std::unordered_map<uint64_t, ThreadEventCache *> Caches;
+
+  ThreadEventCache &get(uint64_t Id, EventCache &Cache);
+  ~ThreadEventCaches();
+};
+
+thread_local ThreadEventCaches CurrentThreadCaches;
+
+ThreadEventCache &ThreadEventCaches::get(uint64_t Id, EventCache &Cache) {
+  if (LastId == Id) {
+    return *Last;
+  }
+  auto It = Caches.find(Id);
+  if (It == Caches.end()) {
+    // Forget the caches of destroyed contexts, which freed them
+    auto &Live = getLiveEventCaches();
+    {
+      std::scoped_lock<std::mutex> Guard(Live.Mutex);
+      for (auto DeadIt = Caches.begin(); DeadIt != Caches.end();) {
+        if (Live.Caches.count(DeadIt->first) == 0) {
+          DeadIt = Caches.erase(DeadIt);
+        } else {
+          ++DeadIt;
+        }
+      }
+    }
+    It = Caches.emplace(Id, Cache.createThreadCache()).first;
+  }
+  LastId = Id;
+  Last = It->second;
+  return *Last;
+}
+
+ThreadEventCaches::~ThreadEventCaches() {
+  auto &Live = getLiveEventCaches();
+  std::scoped_lock<std::mutex> Guard(Live.Mutex);
+  for (auto &[Id, Cache] : Caches) {
+    auto It = Live.Caches.find(Id);
+    if (It != Live.Caches.end()) {
+      It->second->releaseThreadCache(*Cache);
+    }
+  }
+}
+
+size_t getScope(bool HostVisible, bool WithProfiling) {
+  return (HostVisible ? 0 : 2) + (WithProfiling ? 0 : 1);
+}
+
+} // namespace
+
+EventFreeList::~EventFreeList() {
+  auto *Top = Head.load(std::memory_order_acquire);
+  while (Top) {
+    auto *Next = Top->Next;
+    delete Top;
+    Top = Next;
+  }
+}
+
+void EventFreeList::push(std::vector<ur_event_handle_t> &Events) {
+  auto *New =
+      new Batch{std::move(Events), Head.load(std::memory_order_relaxed)};
+  Events = {};
+  while (!Head.compare_exchange_weak(New->Next, New, std::memory_order_release,
+                                     std::memory_order_relaxed)) {
+  }
+}
+
+bool EventFreeList::pop(std::vector<ur_event_handle_t> &Events) {
+  auto *Top = Head.exchange(nullptr, std::memory_order_acquire);
+  if (!Top) {
+    return false;
+  }
+  // Give the other batches back, ahead of the ones pushed meanwhile
+  if (auto *Rest = Top->Next) {
+    auto *Tail = Rest;
+    while (Tail->Next) {
+      Tail = Tail->Next;
+    }
+    Tail->Next = Head.load(std::memory_order_relaxed);
+    while (!Head.compare_exchange_weak(Tail->Next, Rest,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed)) {
+    }
+  }
+  Events = std::move(Top->Events);
+  delete Top;
+  return true;
+}
+
+EventCache::EventCache() {
+  auto &Live = getLiveEventCaches();
+  std::scoped_lock<std::mutex> Guard(Live.Mutex);
+  Id = Live.NextId++;
+  Live.Caches.emplace(Id, this);
+}
+
+EventCache::~EventCache() {
+  auto &Live = getLiveEventCaches();
+  std::scoped_lock<std::mutex> Guard(Live.Mutex);
+  Live.Caches.erase(Id);
+}
+
+ThreadEventCache *EventCache::createThreadCache() {
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  ThreadCaches.push_back(std::make_unique<ThreadEventCache>());
+  return ThreadCaches.back().get();
+}
+
+void EventCache::attachMagazines(ur_device_handle_t Device,
+                                 EventMagazinesByScope &Magazines) {
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  auto &DeviceLists = Lists[Device];
+  for (size_t Scope = 0; Scope < Magazines.size(); ++Scope) {
+    Magazines[Scope].List = &DeviceLists[Scope];
+  }
+}
+
+EventMagazines &EventCache::getMagazines(bool HostVisible, bool WithProfiling,
+                                         ur_device_handle_t Device) {
+  auto &Cache = CurrentThreadCaches.get(Id, *this);
+  auto It = Cache.Magazines.find(Device);
+  if (It == Cache.Magazines.end()) {
+    It = Cache.Magazines.try_emplace(Device).first;
+    attachMagazines(Device, It->second);
+  }
+  return It->second[getScope(HostVisible, WithProfiling)];
+}
+
+ur_event_handle_t EventCache::get(bool HostVisible, bool WithProfiling,
+                                  ur_device_handle_t Device,
+                                  bool CounterBasedEventEnabled) {
+  auto &Magazines = getMagazines(HostVisible, WithProfiling, Device);
+  if (Magazines.Loaded.empty()) {
+    if (!Magazines.Previous.empty()) {
+      std::swap(Magazines.Loaded, Magazines.Previous);
+    } else if (!Magazines.List->pop(Magazines.Loaded)) {
+      return nullptr;
+    }
+  }
+
+  ur_event_handle_t Event = Magazines.Loaded.back();
+  if (Event->CounterBasedEventsEnabled != CounterBasedEventEnabled) {
+    return nullptr;
+  }
+  Magazines.Loaded.pop_back();
+  // We have to reset event before using it.
+  Event->reset();
+  return Event;
+}
+
+void EventCache::add(ur_event_handle_t Event, bool HostVisible,
+                     bool WithProfiling, ur_device_handle_t Device) {
+  auto &Magazines = getMagazines(HostVisible, WithProfiling, Device);
+  if (Magazines.Loaded.size() >= MagazineSize) {
+    if (!Magazines.Previous.empty()) {
+      Magazines.List->push(Magazines.Previous);
+    }
+    std::swap(Magazines.Loaded, Magazines.Previous);
+  }
+  Magazines.Loaded.reserve(MagazineSize);
+  Magazines.Loaded.push_back(Event);
+}
+
+std::vector<ur_event_handle_t> EventCache::takeAll() {
+  // Keeps the exiting threads from releasing their magazines meanwhile
+  std::scoped_lock<std::mutex> Guard(getLiveEventCaches().Mutex);
+  std::scoped_lock<ur_mutex> Lock(Mutex);
+  std::vector<ur_event_handle_t> Events;
+  auto Take = [&](std::vector<ur_event_handle_t> &Magazine) {
+    Events.insert(Events.end(), Magazine.begin(), Magazine.end());
+    Magazine.clear();
+  };
+  for (auto &Cache : ThreadCaches) {
+    for (auto &[Device, Magazines] : Cache->Magazines) {
+      for (auto &Magazine : Magazines) {
+        Take(Magazine.Loaded);
+        Take(Magazine.Previous);
+      }
+    }
+  }
+  for (auto &[Device, DeviceLists] : Lists) {
+    for (auto &List : DeviceLists) {
+      std::vector<ur_event_handle_t> Batch;
+      while (List.pop(Batch)) {
+        Take(Batch);
+      }
+    }
+  }
+  return Events;
+}
+
+void EventCache::releaseThreadCache(ThreadEventCache &Cache) {
+  for (auto &[Device, Magazines] : Cache.Magazines) {
+    for (auto &Magazine : Magazines) {
+      if (!Magazine.Loaded.empty()) {
+        Magazine.List->push(Magazine.Loaded);
+      }
+      if (!Magazine.Previous.empty()) {
+        Magazine.List->push(Magazine.Previous);
+      }
+    }
+  }
+}
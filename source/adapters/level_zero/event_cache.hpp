@@ -0,0 +1,118 @@
+//===--------- event_cache.hpp - Level Zero Adapter -----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ur/ur.hpp>
+#include <ur_api.h>
+
+// Lock-free list of the events cached by the threads of a context, in
+// batches. Batches are only ever pushed one at a time and taken all at once,
+// so that a batch can't be taken and pushed back under a thread's feet.
+class EventFreeList {
+public:
+  EventFreeList() = default;
+  ~EventFreeList();
+
+  EventFreeList(const EventFreeList &) = delete;
+  EventFreeList &operator=(const EventFreeList &) = delete;
+
+  // Takes the events of Events, which is left empty.
+  void push(std::vector<ur_event_handle_t> &Events);
+
+  // Moves a batch of events into the empty Events. Returns false if there
+  // was none.
+  bool pop(std::vector<ur_event_handle_t> &Events);
+
+private:
+  struct Batch {
+    std::vector<ur_event_handle_t> Events;
+    Batch *Next;
+  };
+
+  std::atomic<Batch *> Head{nullptr};
+};
+
+// Magazines of one cache, private to a thread. Events are taken from and
+// released to Loaded; Previous is a full or empty spare, so that a thread
+// going back and forth across a magazine boundary doesn't hit the shared
+// list every time.
+struct EventMagazines {
+  std::vector<ur_event_handle_t> Loaded;
+  std::vector<ur_event_handle_t> Previous;
+  EventFreeList *List = nullptr;
+};
+
+// Caches of events by host visibility and profiling mode
+using EventMagazinesByScope = std::array<EventMagazines, 4>;
+using EventFreeListsByScope = std::array<EventFreeList, 4>;
+
+struct ThreadEventCache {
+  std::unordered_map<ur_device_handle_t, EventMagazinesByScope> Magazines;
+};
+
+// Cache of the events released in a context, for reuse by the next events of
+// the same device, host visibility and profiling mode. Threads release events
+// to and take events from magazines of their own, and only exchange full
+// magazines through the lock-free lists shared by the context.
+class EventCache {
+public:
+  EventCache();
+  ~EventCache();
+
+  EventCache(const EventCache &) = delete;
+  EventCache &operator=(const EventCache &) = delete;
+
+  // Get an event from the cache of Device, or nullptr if there is no event
+  // with the given mode cached. The event is reset.
+  ur_event_handle_t get(bool HostVisible, bool WithProfiling,
+                        ur_device_handle_t Device,
+                        bool CounterBasedEventEnabled);
+
+  void add(ur_event_handle_t Event, bool HostVisible, bool WithProfiling,
+           ur_device_handle_t Device);
+
+  // Removes every event from the cache, including the events cached by
+  // other threads, none of which may use the cache anymore.
+  std::vector<ur_event_handle_t> takeAll();
+
+  // Called when a thread exits, with the live caches locked
+  void releaseThreadCache(ThreadEventCache &Cache);
+
+  // Creates the private cache of the calling thread for this cache
+  ThreadEventCache *createThreadCache();
+
+private:
+  static constexpr size_t MagazineSize = 16;
+
+  // Resolves the shared lists of the magazines of Device
+  void attachMagazines(ur_device_handle_t Device,
+                       EventMagazinesByScope &Magazines);
+
+  EventMagazines &getMagazines(bool HostVisible, bool WithProfiling,
+                               ur_device_handle_t Device);
+
+  uint64_t Id = 0;
+
+  // Guards the creation of the lists and of the thread caches
+  ur_mutex Mutex;
+  // Shared lists by device, null for multi-device events. Never erased, so
+  // that the magazines can keep their addresses.
+  std::unordered_map<ur_device_handle_t, EventFreeListsByScope> Lists;
+  // Owned here, so that they're freed along with the context's events
+  std::vector<std::unique_ptr<ThreadEventCache>> ThreadCaches;
+};
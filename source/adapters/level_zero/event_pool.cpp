@@ -0,0 +1,79 @@
+//===--------- event_pool.cpp - Level Zero Adapter ------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "event_pool.hpp"
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace {
+
+// Index of the lowest set bit of the non-zero Value
+size_t findFirstSet(uint64_t Value) {
+#ifdef _MSC_VER
+  unsigned long Index;
+  _BitScanForward64(&Index, Value);
+  return Index;
+#else
+  return __builtin_ctzll(Value);
+#endif
+}
+
+} // namespace
+
+EventPool::EventPool(ze_event_pool_handle_t ZePool, uint32_t NumSlots)
+    : ZePool(ZePool), NumSlots(NumSlots),
+      NumWords((NumSlots + BitsPerWord - 1) / BitsPerWord),
+      Words(new std::atomic<uint64_t>[NumWords]), NumFree(NumSlots) {
+  for (size_t I = 0; I < NumWords; ++I) {
+    Words[I].store(0, std::memory_order_relaxed);
+  }
+  if (auto Tail = NumSlots % BitsPerWord) {
+    Words[NumWords - 1].store(~uint64_t(0) << Tail, std::memory_order_relaxed);
+  }
+}
+
+bool EventPool::acquireSlot(size_t &Index) {
+  if (isFull()) {
+    return false;
+  }
+  auto First = NextWord.load(std::memory_order_relaxed);
+  for (size_t N = 0; N < NumWords; ++N) {
+    auto I = (First + N) % NumWords;
+    auto Word = Words[I].load(std::memory_order_relaxed);
+    while (~Word != 0) {
+      auto Bit = uint64_t(1) << findFirstSet(~Word);
+      if (Words[I].compare_exchange_weak(Word, Word | Bit,
+                                         std::memory_order_acquire,
+                                         std::memory_order_relaxed)) {
+        NumFree.fetch_sub(1, std::memory_order_relaxed);
+        NextWord.store(I, std::memory_order_relaxed);
+        Index = I * BitsPerWord + findFirstSet(Bit);
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+bool EventPool::releaseSlot(size_t Index) {
+  if (Index >= NumSlots) {
+    return false;
+  }
+  auto Bit = uint64_t(1) << (Index % BitsPerWord);
+  auto Word =
+      Words[Index / BitsPerWord].fetch_and(~Bit, std::memory_order_release);
+  if (!(Word & Bit)) {
+    return false;
+  }
+  NumFree.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
@@ -0,0 +1,54 @@
+//===--------- event_pool.hpp - Level Zero Adapter ------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+#include <ze_api.h>
+
+// An L0 event pool and the occupancy of its slots, one bit per slot. Slots are
+// taken and given back with atomic operations on the bitmap only, so the
+// events released from any thread needn't lock the context.
+class EventPool {
+public:
+  EventPool(ze_event_pool_handle_t ZePool, uint32_t NumSlots);
+
+  EventPool(const EventPool &) = delete;
+  EventPool &operator=(const EventPool &) = delete;
+
+  ze_event_pool_handle_t getZeHandle() const { return ZePool; }
+
+  // Marks a free slot as used and stores its index in Index. Returns false if
+  // the pool is full.
+  bool acquireSlot(size_t &Index);
+
+  // Returns false if the slot wasn't used
+  bool releaseSlot(size_t Index);
+
+  bool isFull() const {
+    return NumFree.load(std::memory_order_relaxed) == 0;
+  }
+
+private:
+  static constexpr size_t BitsPerWord = 64;
+
+  ze_event_pool_handle_t ZePool;
+  uint32_t NumSlots;
+  size_t NumWords;
+  // Set bits are used slots. The bits past NumSlots in the last word are
+  // always set.
+  std::unique_ptr<std::atomic<uint64_t>[]> Words;
+  // An estimate, so that full pools can be skipped without a scan
+  std::atomic<uint32_t> NumFree;
+  // Word to start the next scan from, the last one a slot was found in
+  std::atomic<size_t> NextWord{0};
+};
@@ -462,6 +462,18 @@ uint32_t getPixelSizeBytes(const ur_image_format_t *Format) {
   return NumChannels * ChannelTypeSizeInBytes;
 }
 
+size_t getImageAllocSize(const ur_image_format_t *Format,
+                         const ur_image_desc_t *Desc) {
+  size_t Size = 0;
+  for (uint32_t Level = 0; Level < std::max(Desc->numMipLevel, 1u); ++Level) {
+    Size += std::max<size_t>(Desc->width >> Level, 1) *
+            std::max<size_t>(Desc->height >> Level, 1) *
+            std::max<size_t>(Desc->depth >> Level, 1);
+  }
+  return Size * std::max<size_t>(Desc->arraySize, 1) *
+         getPixelSizeBytes(Format);
+}
+
 ur_result_t bindlessImagesCreateImpl(ur_context_handle_t hContext,
                                      ur_device_handle_t hDevice,
                                      ur_exp_image_mem_native_handle_t hImageMem,
@@ -490,6 +502,26 @@ ur_result_t bindlessImagesCreateImpl(ur_context_handle_t hContext,
     BindlessDesc.flags |= ZE_IMAGE_BINDLESS_EXP_FLAG_SAMPLED_IMAGE;
   }
 
+  // The handles of an image memory differ by their descriptions, which are
+  // spread across the chain.
+  std::string Desc;
+  ur::image_handle_cache::append(Desc, ZeImageDesc.flags);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.type);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.format);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.width);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.height);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.depth);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.arraylevels);
+  ur::image_handle_cache::append(Desc, ZeImageDesc.miplevels);
+  ur::image_handle_cache::append(Desc, BindlessDesc.flags);
+  if (hSampler) {
+    ur::image_handle_cache::append(Desc, ZeSamplerDesc.addressMode);
+    ur::image_handle_cache::append(Desc, ZeSamplerDesc.filterMode);
+    ur::image_handle_cache::append(Desc, ZeSamplerDesc.isNormalized);
+  }
+  if (hContext->ImageHandles.acquire(hDevice, hImageMem, Desc, *phImage))
+    return UR_RESULT_SUCCESS;
+
   ze_image_handle_t ZeImage;
 
   ze_memory_allocation_properties_t MemAllocProperties{
@@ -545,14 +577,235 @@ ur_result_t bindlessImagesCreateImpl(ur_context_handle_t hContext,
   ZE2UR_CALL(zeImageGetDeviceOffsetExpFunctionPtr,
              (ZeImageTranslated, &DeviceOffset));
   *phImage = DeviceOffset;
+  if (!hContext->ImageHandles.insert(hDevice, hImageMem, Desc, *phImage)) {
+    ZE2UR_CALL(zeImageDestroy, (ZeImage));
+    return UR_RESULT_SUCCESS;
+  }
 
   hDevice->ZeOffsetToImageHandleMap[*phImage] = ZeImage;
 
   return UR_RESULT_SUCCESS;
 }
 
+// Appends the copy of one region to ZeCommandList, signalling ZeEvent.
+ur_result_t appendImageCopyRegion(
+    ze_command_list_handle_t ZeCommandList, const ze_image_desc_t &ZeImageDesc,
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, ze_event_handle_t ZeEvent,
+    const _ur_ze_event_list_t &WaitList, const char *FuncName) {
+  if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_HOST_TO_DEVICE) {
+    uint32_t SrcRowPitch =
+        pSrcImageDesc->width * getPixelSizeBytes(pSrcImageFormat);
+    uint32_t SrcSlicePitch = SrcRowPitch * pSrcImageDesc->height;
+    if (pDstImageDesc->rowPitch == 0) {
+      // Copy to Non-USM memory
+      ze_image_region_t DstRegion;
+      UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->dstOffset,
+                                   &pCopyRegion->copyExtent, DstRegion));
+      auto *UrImage = static_cast<_ur_image *>(pDst);
+      const char *SrcPtr =
+          static_cast<const char *>(pSrc) +
+          pCopyRegion->srcOffset.z * SrcSlicePitch +
+          pCopyRegion->srcOffset.y * SrcRowPitch +
+          pCopyRegion->srcOffset.x * getPixelSizeBytes(pSrcImageFormat);
+      ZE2UR_CALL(zeCommandListAppendImageCopyFromMemoryExt,
+                 (ZeCommandList, UrImage->ZeImage, SrcPtr, &DstRegion,
+                  SrcRowPitch, SrcSlicePitch, ZeEvent, WaitList.Length,
+                  WaitList.ZeEventList));
+    } else {
+      // Copy to pitched USM memory
+      uint32_t DstRowPitch = pDstImageDesc->rowPitch;
+      ze_copy_region_t ZeDstRegion = {(uint32_t)pCopyRegion->dstOffset.x,
+                                      (uint32_t)pCopyRegion->dstOffset.y,
+                                      (uint32_t)pCopyRegion->dstOffset.z,
+                                      DstRowPitch,
+                                      (uint32_t)pCopyRegion->copyExtent.height,
+                                      (uint32_t)pCopyRegion->copyExtent.depth};
+      uint32_t DstSlicePitch = 0;
+      ze_copy_region_t ZeSrcRegion = {(uint32_t)pCopyRegion->srcOffset.x,
+                                      (uint32_t)pCopyRegion->srcOffset.y,
+                                      (uint32_t)pCopyRegion->srcOffset.z,
+                                      SrcRowPitch,
+                                      (uint32_t)pCopyRegion->copyExtent.height,
+                                      (uint32_t)pCopyRegion->copyExtent.depth};
+      ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
+                 (ZeCommandList, pDst, &ZeDstRegion, DstRowPitch, DstSlicePitch,
+                  pSrc, &ZeSrcRegion, SrcRowPitch, SrcSlicePitch, ZeEvent,
+                  WaitList.Length, WaitList.ZeEventList));
+    }
+  } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_HOST) {
+    uint32_t DstRowPitch =
+        pDstImageDesc->width * getPixelSizeBytes(pDstImageFormat);
+    uint32_t DstSlicePitch = DstRowPitch * pDstImageDesc->height;
+    if (pSrcImageDesc->rowPitch == 0) {
+      // Copy from Non-USM memory to host
+      ze_image_region_t SrcRegion;
+      UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->srcOffset,
+                                   &pCopyRegion->copyExtent, SrcRegion));
+      auto *UrImage = static_cast<const _ur_image *>(pSrc);
+      char *DstPtr =
+          static_cast<char *>(pDst) + pCopyRegion->dstOffset.z * DstSlicePitch +
+          pCopyRegion->dstOffset.y * DstRowPitch +
+          pCopyRegion->dstOffset.x * getPixelSizeBytes(pDstImageFormat);
+      ZE2UR_CALL(zeCommandListAppendImageCopyToMemoryExt,
+                 (ZeCommandList, DstPtr, UrImage->ZeImage, &SrcRegion,
+                  DstRowPitch, DstSlicePitch, ZeEvent, WaitList.Length,
+                  WaitList.ZeEventList));
+    } else {
+      // Copy from pitched USM memory to host
+      ze_copy_region_t ZeDstRegion = {(uint32_t)pCopyRegion->dstOffset.x,
+                                      (uint32_t)pCopyRegion->dstOffset.y,
+                                      (uint32_t)pCopyRegion->dstOffset.z,
+                                      DstRowPitch,
+                                      (uint32_t)pCopyRegion->copyExtent.height,
+                                      (uint32_t)pCopyRegion->copyExtent.depth};
+      uint32_t SrcRowPitch = pSrcImageDesc->rowPitch;
+      ze_copy_region_t ZeSrcRegion = {(uint32_t)pCopyRegion->srcOffset.x,
+                                      (uint32_t)pCopyRegion->srcOffset.y,
+                                      (uint32_t)pCopyRegion->srcOffset.z,
+                                      SrcRowPitch,
+                                      (uint32_t)pCopyRegion->copyExtent.height,
+                                      (uint32_t)pCopyRegion->copyExtent.depth};
+      uint32_t SrcSlicePitch = 0;
+      ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
+                 (ZeCommandList, pDst, &ZeDstRegion, DstRowPitch, DstSlicePitch,
+                  pSrc, &ZeSrcRegion, SrcRowPitch, SrcSlicePitch, ZeEvent,
+                  WaitList.Length, WaitList.ZeEventList));
+    }
+  } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE) {
+    ze_image_region_t DstRegion;
+    UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->dstOffset,
+                                 &pCopyRegion->copyExtent, DstRegion));
+    ze_image_region_t SrcRegion;
+    UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->srcOffset,
+                                 &pCopyRegion->copyExtent, SrcRegion));
+    auto *UrImageDst = static_cast<_ur_image *>(pDst);
+    auto *UrImageSrc = static_cast<const _ur_image *>(pSrc);
+    ZE2UR_CALL(zeCommandListAppendImageCopyRegion,
+               (ZeCommandList, UrImageDst->ZeImage, UrImageSrc->ZeImage,
+                &DstRegion, &SrcRegion, ZeEvent, WaitList.Length,
+                WaitList.ZeEventList));
+  } else {
+    logger::error("{}: unexpected imageCopyFlags", FuncName);
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t bindlessImagesImageCopyImpl(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    const char *FuncName) {
+  std::scoped_lock<ur_shared_mutex> Lock(hQueue->Mutex);
+
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pDst && pSrc && pSrcImageFormat && pSrcImageDesc && pDstImageDesc &&
+                pCopyRegions,
+            UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(numCopyRegions > 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(pSrcImageDesc->type == pDstImageDesc->type,
+            UR_RESULT_ERROR_INVALID_VALUE);
+  UR_ASSERT(!(UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags),
+            UR_RESULT_ERROR_INVALID_ENUMERATION);
+  UR_ASSERT(!(pSrcImageDesc && UR_MEM_TYPE_IMAGE1D_ARRAY < pSrcImageDesc->type),
+            UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR);
+
+  ZeStruct<ze_image_desc_t> ZeImageDesc;
+  UR_CALL(ur2zeImageDesc(pSrcImageFormat, pSrcImageDesc, ZeImageDesc));
+
+  bool UseCopyEngine = hQueue->useCopyEngine(/*PreferCopyEngine*/ true);
+
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      numEventsInWaitList, phEventWaitList, hQueue, UseCopyEngine));
+
+  bool Blocking = false;
+  // We want to batch these commands to avoid extra submissions (costly)
+  bool OkToBatch = true;
+
+  // Get a new command list to be used on this call
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(hQueue->Context->getAvailableCommandList(
+      hQueue, CommandList, UseCopyEngine, numEventsInWaitList, phEventWaitList,
+      OkToBatch, nullptr /*ForcedCmdQueue*/));
+
+  ze_event_handle_t ZeEvent = nullptr;
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = phEvent == nullptr;
+  ur_event_handle_t *Event = phEvent ? phEvent : &InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(hQueue, Event, UR_COMMAND_MEM_IMAGE_COPY,
+                                       CommandList, IsInternal,
+                                       /*IsMultiDevice*/ false));
+  UR_CALL(setSignalEvent(hQueue, UseCopyEngine, &ZeEvent, Event,
+                         numEventsInWaitList, phEventWaitList,
+                         CommandList->second.ZeQueue));
+  (*Event)->WaitList = TmpWaitList;
+
+  const auto &ZeCommandList = CommandList->first;
+  const auto &WaitList = (*Event)->WaitList;
+
+  if (numCopyRegions == 1) {
+    ur_exp_image_copy_region_t CopyRegion = pCopyRegions[0];
+    UR_CALL(appendImageCopyRegion(ZeCommandList, ZeImageDesc, pSrc, pDst,
+                                  pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+                                  pDstImageFormat, &CopyRegion, imageCopyFlags,
+                                  ZeEvent, WaitList, FuncName));
+  } else {
+    // The regions don't overlap, so they are copied in any order, a barrier
+    // signalling the event once they all are.
+    for (uint32_t I = 0; I < numCopyRegions; I++) {
+      ur_exp_image_copy_region_t CopyRegion = pCopyRegions[I];
+      UR_CALL(appendImageCopyRegion(
+          ZeCommandList, ZeImageDesc, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+          pSrcImageFormat, pDstImageFormat, &CopyRegion, imageCopyFlags,
+          nullptr, WaitList, FuncName));
+    }
+    ZE2UR_CALL(zeCommandListAppendBarrier,
+               (ZeCommandList, ZeEvent, 0, nullptr));
+  }
+
+  UR_CALL(hQueue->executeCommandList(CommandList, Blocking, OkToBatch));
+
+  return UR_RESULT_SUCCESS;
+}
+
+// Errors are ignored as the handles are gone from the cache anyway.
+void destroyPurged(
+    const std::vector<ur::image_handle_cache::device_handle_t> &Purged) {
+  for (auto &[Device, Handle] : Purged) {
+    auto It = Device->ZeOffsetToImageHandleMap.find(Handle);
+    if (It == Device->ZeOffsetToImageHandleMap.end())
+      continue;
+    ZE_CALL_NOCHECK(zeImageDestroy, (It->second));
+    Device->ZeOffsetToImageHandleMap.erase(It);
+  }
+}
+
 } // namespace
 
+void destroyImageHandles(ur_context_handle_t hContext,
+                         ur_exp_image_mem_native_handle_t hImageMem) {
+  destroyPurged(hContext->ImageHandles.purge(hImageMem));
+}
+
+void destroyUnusedImageHandles(ur_context_handle_t hContext) {
+  destroyPurged(hContext->ImageHandles.purgeUnused());
+}
+
+void destroyAllImageHandles(ur_context_handle_t hContext) {
+  destroyPurged(hContext->ImageHandles.purgeAll());
+}
+
 ur_result_t getImageRegionHelper(ze_image_desc_t ZeImageDesc,
                                  ur_rect_offset_t *Origin,
                                  ur_rect_region_t *Region,
@@ -733,6 +986,9 @@ ur_result_t urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t hImage) {
   UR_ASSERT(hContext && hDevice && hImage, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
+  if (hContext->ImageHandles.release(hDevice, hImage))
+    return UR_RESULT_SUCCESS;
+
   auto item = hDevice->ZeOffsetToImageHandleMap.find(hImage);
 
   if (item != hDevice->ZeOffsetToImageHandleMap.end()) {
@@ -780,6 +1036,10 @@ ur_result_t urBindlessImagesImageAllocateExp(
              (hContext->ZeContext, hDevice->ZeDevice, ZeImage));
   UR_CALL(createUrMemFromZeImage(hContext, ZeImage, /*OwnZeMemHandle*/ true,
                                  ZeImageDesc, phImageMem));
+  auto Image = reinterpret_cast<_ur_image *>(*phImageMem);
+  Image->AccountedSize = getImageAllocSize(pImageFormat, pImageDesc);
+  hContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE,
+                                     Image->AccountedSize);
   return UR_RESULT_SUCCESS;
 }
 
@@ -787,8 +1047,8 @@ ur_result_t
 urBindlessImagesImageFreeExp(ur_context_handle_t hContext,
                              ur_device_handle_t hDevice,
                              ur_exp_image_mem_native_handle_t hImageMem) {
-  std::ignore = hContext;
   std::ignore = hDevice;
+  destroyImageHandles(hContext, hImageMem);
   UR_CALL(ur::level_zero::urMemRelease(
       reinterpret_cast<ur_mem_handle_t>(hImageMem)));
   return UR_RESULT_SUCCESS;
@@ -815,164 +1075,32 @@ ur_result_t urBindlessImagesSampledImageCreateExp(
 }
 
 ur_result_t urBindlessImagesImageCopyExp(
-    ur_queue_handle_t hQueue, [[maybe_unused]] const void *pSrc,
-    [[maybe_unused]] void *pDst,
-    [[maybe_unused]] const ur_image_desc_t *pSrcImageDesc,
-    [[maybe_unused]] const ur_image_desc_t *pDstImageDesc,
-    [[maybe_unused]] const ur_image_format_t *pSrcImageFormat,
-    [[maybe_unused]] const ur_image_format_t *pDstImageFormat,
-    [[maybe_unused]] ur_exp_image_copy_region_t *pCopyRegion,
-    [[maybe_unused]] ur_exp_image_copy_flags_t imageCopyFlags,
-    [[maybe_unused]] uint32_t numEventsInWaitList,
-    [[maybe_unused]] const ur_event_handle_t *phEventWaitList,
-    [[maybe_unused]] ur_event_handle_t *phEvent) {
-  std::scoped_lock<ur_shared_mutex> Lock(hQueue->Mutex);
-
-  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(pDst && pSrc && pSrcImageFormat && pSrcImageDesc && pDstImageDesc &&
-                pCopyRegion,
-            UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  UR_ASSERT(pSrcImageDesc->type == pDstImageDesc->type,
-            UR_RESULT_ERROR_INVALID_VALUE);
-  UR_ASSERT(!(UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags),
-            UR_RESULT_ERROR_INVALID_ENUMERATION);
-  UR_ASSERT(!(pSrcImageDesc && UR_MEM_TYPE_IMAGE1D_ARRAY < pSrcImageDesc->type),
-            UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR);
-
-  ZeStruct<ze_image_desc_t> ZeImageDesc;
-  UR_CALL(ur2zeImageDesc(pSrcImageFormat, pSrcImageDesc, ZeImageDesc));
-
-  bool UseCopyEngine = hQueue->useCopyEngine(/*PreferCopyEngine*/ true);
-
-  _ur_ze_event_list_t TmpWaitList;
-  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
-      numEventsInWaitList, phEventWaitList, hQueue, UseCopyEngine));
-
-  bool Blocking = false;
-  // We want to batch these commands to avoid extra submissions (costly)
-  bool OkToBatch = true;
-
-  // Get a new command list to be used on this call
-  ur_command_list_ptr_t CommandList{};
-  UR_CALL(hQueue->Context->getAvailableCommandList(
-      hQueue, CommandList, UseCopyEngine, numEventsInWaitList, phEventWaitList,
-      OkToBatch, nullptr /*ForcedCmdQueue*/));
-
-  ze_event_handle_t ZeEvent = nullptr;
-  ur_event_handle_t InternalEvent;
-  bool IsInternal = phEvent == nullptr;
-  ur_event_handle_t *Event = phEvent ? phEvent : &InternalEvent;
-  UR_CALL(createEventAndAssociateQueue(hQueue, Event, UR_COMMAND_MEM_IMAGE_COPY,
-                                       CommandList, IsInternal,
-                                       /*IsMultiDevice*/ false));
-  UR_CALL(setSignalEvent(hQueue, UseCopyEngine, &ZeEvent, Event,
-                         numEventsInWaitList, phEventWaitList,
-                         CommandList->second.ZeQueue));
-  (*Event)->WaitList = TmpWaitList;
-
-  const auto &ZeCommandList = CommandList->first;
-  const auto &WaitList = (*Event)->WaitList;
-
-  if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_HOST_TO_DEVICE) {
-    uint32_t SrcRowPitch =
-        pSrcImageDesc->width * getPixelSizeBytes(pSrcImageFormat);
-    uint32_t SrcSlicePitch = SrcRowPitch * pSrcImageDesc->height;
-    if (pDstImageDesc->rowPitch == 0) {
-      // Copy to Non-USM memory
-      ze_image_region_t DstRegion;
-      UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->dstOffset,
-                                   &pCopyRegion->copyExtent, DstRegion));
-      auto *UrImage = static_cast<_ur_image *>(pDst);
-      const char *SrcPtr =
-          static_cast<const char *>(pSrc) +
-          pCopyRegion->srcOffset.z * SrcSlicePitch +
-          pCopyRegion->srcOffset.y * SrcRowPitch +
-          pCopyRegion->srcOffset.x * getPixelSizeBytes(pSrcImageFormat);
-      ZE2UR_CALL(zeCommandListAppendImageCopyFromMemoryExt,
-                 (ZeCommandList, UrImage->ZeImage, SrcPtr, &DstRegion,
-                  SrcRowPitch, SrcSlicePitch, ZeEvent, WaitList.Length,
-                  WaitList.ZeEventList));
-    } else {
-      // Copy to pitched USM memory
-      uint32_t DstRowPitch = pDstImageDesc->rowPitch;
-      ze_copy_region_t ZeDstRegion = {(uint32_t)pCopyRegion->dstOffset.x,
-                                      (uint32_t)pCopyRegion->dstOffset.y,
-                                      (uint32_t)pCopyRegion->dstOffset.z,
-                                      DstRowPitch,
-                                      (uint32_t)pCopyRegion->copyExtent.height,
-                                      (uint32_t)pCopyRegion->copyExtent.depth};
-      uint32_t DstSlicePitch = 0;
-      ze_copy_region_t ZeSrcRegion = {(uint32_t)pCopyRegion->srcOffset.x,
-                                      (uint32_t)pCopyRegion->srcOffset.y,
-                                      (uint32_t)pCopyRegion->srcOffset.z,
-                                      SrcRowPitch,
-                                      (uint32_t)pCopyRegion->copyExtent.height,
-                                      (uint32_t)pCopyRegion->copyExtent.depth};
-      ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
-                 (ZeCommandList, pDst, &ZeDstRegion, DstRowPitch, DstSlicePitch,
-                  pSrc, &ZeSrcRegion, SrcRowPitch, SrcSlicePitch, ZeEvent,
-                  WaitList.Length, WaitList.ZeEventList));
-    }
-  } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_HOST) {
-    uint32_t DstRowPitch =
-        pDstImageDesc->width * getPixelSizeBytes(pDstImageFormat);
-    uint32_t DstSlicePitch = DstRowPitch * pDstImageDesc->height;
-    if (pSrcImageDesc->rowPitch == 0) {
-      // Copy from Non-USM memory to host
-      ze_image_region_t SrcRegion;
-      UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->srcOffset,
-                                   &pCopyRegion->copyExtent, SrcRegion));
-      auto *UrImage = static_cast<const _ur_image *>(pSrc);
-      char *DstPtr =
-          static_cast<char *>(pDst) + pCopyRegion->dstOffset.z * DstSlicePitch +
-          pCopyRegion->dstOffset.y * DstRowPitch +
-          pCopyRegion->dstOffset.x * getPixelSizeBytes(pDstImageFormat);
-      ZE2UR_CALL(zeCommandListAppendImageCopyToMemoryExt,
-                 (ZeCommandList, DstPtr, UrImage->ZeImage, &SrcRegion,
-                  DstRowPitch, DstSlicePitch, ZeEvent, WaitList.Length,
-                  WaitList.ZeEventList));
-    } else {
-      // Copy from pitched USM memory to host
-      ze_copy_region_t ZeDstRegion = {(uint32_t)pCopyRegion->dstOffset.x,
-                                      (uint32_t)pCopyRegion->dstOffset.y,
-                                      (uint32_t)pCopyRegion->dstOffset.z,
-                                      DstRowPitch,
-                                      (uint32_t)pCopyRegion->copyExtent.height,
-                                      (uint32_t)pCopyRegion->copyExtent.depth};
-      uint32_t SrcRowPitch = pSrcImageDesc->rowPitch;
-      ze_copy_region_t ZeSrcRegion = {(uint32_t)pCopyRegion->srcOffset.x,
-                                      (uint32_t)pCopyRegion->srcOffset.y,
-                                      (uint32_t)pCopyRegion->srcOffset.z,
-                                      SrcRowPitch,
-                                      (uint32_t)pCopyRegion->copyExtent.height,
-                                      (uint32_t)pCopyRegion->copyExtent.depth};
-      uint32_t SrcSlicePitch = 0;
-      ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
-                 (ZeCommandList, pDst, &ZeDstRegion, DstRowPitch, DstSlicePitch,
-                  pSrc, &ZeSrcRegion, SrcRowPitch, SrcSlicePitch, ZeEvent,
-                  WaitList.Length, WaitList.ZeEventList));
-    }
-  } else if (imageCopyFlags == UR_EXP_IMAGE_COPY_FLAG_DEVICE_TO_DEVICE) {
-    ze_image_region_t DstRegion;
-    UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->dstOffset,
-                                 &pCopyRegion->copyExtent, DstRegion));
-    ze_image_region_t SrcRegion;
-    UR_CALL(getImageRegionHelper(ZeImageDesc, &pCopyRegion->srcOffset,
-                                 &pCopyRegion->copyExtent, SrcRegion));
-    auto *UrImageDst = static_cast<_ur_image *>(pDst);
-    auto *UrImageSrc = static_cast<const _ur_image *>(pSrc);
-    ZE2UR_CALL(zeCommandListAppendImageCopyRegion,
-               (ZeCommandList, UrImageDst->ZeImage, UrImageSrc->ZeImage,
-                &DstRegion, &SrcRegion, ZeEvent, WaitList.Length,
-                WaitList.ZeEventList));
-  } else {
-    logger::error("urBindlessImagesImageCopyExp: unexpected imageCopyFlags");
-    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-  }
-
-  UR_CALL(hQueue->executeCommandList(CommandList, Blocking, OkToBatch));
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return bindlessImagesImageCopyImpl(
+      hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+      pDstImageFormat, 1, pCopyRegion, imageCopyFlags, numEventsInWaitList,
+      phEventWaitList, phEvent, "urBindlessImagesImageCopyExp");
+}
 
-  return UR_RESULT_SUCCESS;
+ur_result_t urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return bindlessImagesImageCopyImpl(
+      hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+      pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+      numEventsInWaitList, phEventWaitList, phEvent,
+      "urBindlessImagesImageCopyBatchExp");
 }
 
 ur_result_t urBindlessImagesImageGetInfoExp(
@@ -1165,6 +1293,8 @@ ur_result_t urBindlessImagesReleaseExternalMemoryExp(
   struct ur_ze_external_memory_data *externalMemoryData =
       reinterpret_cast<ur_ze_external_memory_data *>(hExternalMem);
 
+  // The arrays and buffers mapped from it go with the external memory.
+  destroyUnusedImageHandles(hContext);
   UR_CALL(ur::level_zero::urMemRelease(externalMemoryData->urMemoryHandle));
 
   switch (externalMemoryData->type) {
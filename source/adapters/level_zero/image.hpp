@@ -21,3 +21,22 @@ ur_result_t getImageRegionHelper(ze_image_desc_t ZeImageDesc,
 
 std::pair<ze_image_format_type_t, size_t>
 getImageFormatTypeAndSize(const ur_image_format_t *ImageFormat);
+
+uint32_t getPixelSizeBytes(const ur_image_format_t *Format);
+
+// Bytes of the texels of an image of every mip level and array layer, which
+// the memory accounting of the contexts counts the images as.
+size_t getImageAllocSize(const ur_image_format_t *Format,
+                         const ur_image_desc_t *Desc);
+
+// Destroys the bindless image handles of hContext viewing hImageMem, which is
+// being freed.
+void destroyImageHandles(ur_context_handle_t hContext,
+                         ur_exp_image_mem_native_handle_t hImageMem);
+
+// Destroys the bindless image handles of hContext which aren't in use, as
+// memory they view was freed without the context knowing which.
+void destroyUnusedImageHandles(ur_context_handle_t hContext);
+
+// Destroys every bindless image handle of hContext.
+void destroyAllImageHandles(ur_context_handle_t hContext);
@@ -8,6 +8,9 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <cstring>
+
 #include "kernel.hpp"
 #include "logger/ur_logger.hpp"
 #include "ur_api.h"
@@ -25,12 +28,220 @@ ur_result_t getZeKernel(ze_device_handle_t hDevice, ur_kernel_handle_t hKernel,
       /* kernel and queue don't match */
       return UR_RESULT_ERROR_INVALID_QUEUE;
     }
-    *phZeKernel = It->second;
+    auto &Slot = *It->second;
+    auto ZeKernel = Slot.ZeKernel.load(std::memory_order_acquire);
+    if (!ZeKernel) {
+      ZeStruct<ze_kernel_desc_t> ZeKernelDesc;
+      ZeKernelDesc.flags = 0;
+      ZeKernelDesc.pKernelName = hKernel->ZeKernelName->c_str();
+      ZE2UR_CALL(zeKernelCreate, (Slot.ZeModule, &ZeKernelDesc, &ZeKernel));
+      // Another thread may have created it in the meantime
+      ze_kernel_handle_t Created = nullptr;
+      if (!Slot.ZeKernel.compare_exchange_strong(Created, ZeKernel,
+                                                 std::memory_order_acq_rel)) {
+        ZE_CALL_NOCHECK(zeKernelDestroy, (ZeKernel));
+        ZeKernel = Created;
+      }
+    }
+    *phZeKernel = ZeKernel;
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
+namespace {
+
+// Whether the shared USM allocations given to kernels are prefetched to the
+// device before the launches. Off by default, as the launches then pay for a
+// prefetch per allocation even when it is resident already.
+const bool AutoPrefetchSharedUSM = [] {
+  const char *UrRet = std::getenv("UR_L0_USM_AUTO_PREFETCH");
+  return UrRet ? std::atoi(UrRet) != 0 : false;
+}();
+
+// Events superseded by a launch, which are released once the locks of the
+// launch are dropped, since releasing them may release their queues.
+struct ReleasedAfterLaunch {
+  std::vector<ur_event_handle_t> Events;
+  ~ReleasedAfterLaunch() {
+    for (auto Event : Events) {
+      if (auto Res = urEventReleaseInternal(Event)) {
+        UR_LOG(WARN, "failed to release the last use of an allocation, "
+                     "error {}",
+               static_cast<int>(Res));
+      }
+    }
+  }
+};
+
+// Makes the shared allocations used by ZeKernel resident on the device of
+// Queue for the command of Event, if their residency is managed. Only the
+// pointer arguments are known, so all the allocations are taken as used by the
+// kernels whose arguments aren't recorded or when indirect accesses are
+// tracked.
+ur_result_t makeArgumentsResident(ur_queue_handle_t Queue,
+                                  ur_kernel_handle_t Kernel,
+                                  ze_kernel_handle_t ZeKernel,
+                                  ur_event_handle_t Event,
+                                  ReleasedAfterLaunch &Released) {
+  if (!ResidencyManager::isEnabled())
+    return UR_RESULT_SUCCESS;
+
+  bool AllAllocations =
+      IndirectAccessTrackingEnabled || !Kernel->SkipsBoundArguments;
+  std::vector<const void *> Ptrs;
+  if (!AllAllocations) {
+    for (auto &Arg : Kernel->BoundArguments[ZeKernel]) {
+      if (!Arg.IsSet || Arg.IsNull || Arg.Bytes.size() != sizeof(void *))
+        continue;
+      const void *Ptr;
+      std::memcpy(&Ptr, Arg.Bytes.data(), sizeof(void *));
+      Ptrs.push_back(Ptr);
+    }
+  }
+  return Queue->Context->Residency.makeResident(
+      Queue->Context->ZeContext, Queue->Device->ZeDevice, Ptrs, AllAllocations,
+      Event, Released.Events);
+}
+
+// Appends prefetches of the shared USM allocations the kernel was given to the
+// device of CommandList, ahead of the launch, so that they don't migrate a
+// page fault at a time. Prefetches are hints and don't wait for the events of
+// the launch.
+ur_result_t prefetchSharedUSMArgs(ur_kernel_handle_t Kernel,
+                                  ur_command_list_ptr_t CommandList) {
+  for (auto &[Index, Range] : Kernel->SharedUSMArgs) {
+    std::ignore = Index;
+    ZE2UR_CALL(zeCommandListAppendMemoryPrefetch,
+               (CommandList->first, Range.Base, Range.Size));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+// The setters of the kernel arguments, called with the mutex of the kernel
+// held so that urKernelSetArgsExp locks it once for all of its arguments.
+ur_result_t setArgValueLocked(ur_kernel_handle_t Kernel, uint32_t ArgIndex,
+                              size_t ArgSize, const void *PArgValue) {
+  // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
+  // in which case a NULL value will be used as the value for the argument
+  // declared as a pointer to global or constant memory in the kernel"
+  //
+  // We don't know the type of the argument but it seems that the only time
+  // SYCL RT would send a pointer to NULL in 'arg_value' is when the argument
+  // is a NULL pointer. Treat a pointer to NULL in 'arg_value' as a NULL.
+  if (ArgSize == sizeof(void *) && PArgValue &&
+      *(void **)(const_cast<void *>(PArgValue)) == nullptr) {
+    PArgValue = nullptr;
+  }
+
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->SharedUSMArgs.erase(ArgIndex);
+  Kernel->MemObjArguments.erase(ArgIndex);
+
+  ze_result_t ZeResult = ZE_RESULT_SUCCESS;
+  if (Kernel->ZeKernelMap.empty()) {
+    auto ZeKernel = Kernel->ZeKernel;
+    ZeResult = Kernel->setZeArgument(ZeKernel, ArgIndex, ArgSize, PArgValue);
+  } else {
+    // The L0 kernels created later get the argument from bindArguments
+    for (auto &It : Kernel->BoundArguments) {
+      auto ZeKernel = It.first;
+      ZeResult = Kernel->setZeArgument(ZeKernel, ArgIndex, ArgSize, PArgValue);
+    }
+  }
+
+  if (ZeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+  }
+
+  return ze2urResult(ZeResult);
+}
+
+ur_result_t setArgPointerLocked(ur_kernel_handle_t Kernel, uint32_t ArgIndex,
+                                const void *ArgValue) {
+  // The value of a pointer argument is the pointer itself
+  UR_CALL(setArgValueLocked(Kernel, ArgIndex, sizeof(const void *), &ArgValue));
+  if (!AutoPrefetchSharedUSM || !ArgValue)
+    return UR_RESULT_SUCCESS;
+
+  // Pointers into host or device allocations, or not into USM at all, aren't
+  // prefetched
+  auto Context = Kernel->Program ? Kernel->Program->Context : Kernel->Context;
+  ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+  void *Base = nullptr;
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                      (Context->ZeContext, ArgValue,
+                       &ZeMemoryAllocationProperties, nullptr)) ==
+          ZE_RESULT_SUCCESS &&
+      ZeMemoryAllocationProperties.type == ZE_MEMORY_TYPE_SHARED &&
+      ZE_CALL_NOCHECK(zeMemGetAddressRange,
+                      (Context->ZeContext, ArgValue, &Base, &Size)) ==
+          ZE_RESULT_SUCCESS) {
+    Kernel->SharedUSMArgs[ArgIndex] = {Base, Size};
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t setArgSamplerLocked(ur_kernel_handle_t Kernel, uint32_t ArgIndex,
+                                ur_sampler_handle_t ArgValue) {
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->SharedUSMArgs.erase(ArgIndex);
+  Kernel->MemObjArguments.erase(ArgIndex);
+  if (auto ZeResult = Kernel->setZeArgument(
+          Kernel->ZeKernel, ArgIndex, sizeof(void *), &ArgValue->ZeSampler))
+    return ze2urResult(ZeResult);
+
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t setArgMemObjLocked(ur_kernel_handle_t Kernel, uint32_t ArgIndex,
+                               ur_mem_flags_t MemoryAccess,
+                               ur_mem_handle_t ArgValue) {
+  // The ArgValue may be a NULL pointer in which case a NULL value is used for
+  // the kernel argument declared as a pointer to global or constant memory.
+
+  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
+    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+  }
+  Kernel->SharedUSMArgs.erase(ArgIndex);
+
+  ur_mem_handle_t_ *UrMem = ur_cast<ur_mem_handle_t_ *>(ArgValue);
+
+  ur_mem_handle_t_::access_mode_t UrAccessMode = ur_mem_handle_t_::read_write;
+  switch (MemoryAccess) {
+  case UR_MEM_FLAG_READ_WRITE:
+    UrAccessMode = ur_mem_handle_t_::read_write;
+    break;
+  case UR_MEM_FLAG_WRITE_ONLY:
+    UrAccessMode = ur_mem_handle_t_::write_only;
+    break;
+  case UR_MEM_FLAG_READ_ONLY:
+    UrAccessMode = ur_mem_handle_t_::read_only;
+    break;
+  default:
+    return UR_RESULT_ERROR_INVALID_ARGUMENT;
   }
+  // Kernels don't write to read-only buffers, so leave their allocations on
+  // the other devices valid whatever the access given
+  if (UrMem && !UrMem->isImage() &&
+      static_cast<_ur_buffer *>(UrMem)->isReadOnly()) {
+    UrAccessMode = ur_mem_handle_t_::read_only;
+  }
+  auto Arg = UrMem ? UrMem : nullptr;
+  Kernel->PendingArguments.push_back(
+      {ArgIndex, sizeof(void *), Arg, UrAccessMode});
+  Kernel->MemObjArguments[ArgIndex] = Kernel->PendingArguments.back();
 
   return UR_RESULT_SUCCESS;
 }
 
+} // namespace
+
 namespace ur::level_zero {
 
 ur_result_t urKernelGetSuggestedLocalWorkSize(
@@ -92,9 +303,13 @@ ur_result_t urEnqueueKernelLaunch(
   ze_kernel_handle_t ZeKernel{};
   UR_CALL(getZeKernel(Queue->Device->ZeDevice, Kernel, &ZeKernel));
 
+  // Declared first to be released after the locks below.
+  ReleasedAfterLaunch Released;
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
       Queue->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
+  UR_CALL(Kernel->bindArguments(ZeKernel, Queue->Device, NumEventsInWaitList,
+                                EventWaitList));
   if (GlobalWorkOffset != NULL) {
     if (!Queue->Device->Platform->ZeDriverGlobalOffsetExtensionFound) {
       logger::error("No global offset extension found on this driver");
@@ -116,8 +331,9 @@ ur_result_t urEnqueueKernelLaunch(
                                         Queue->Device, EventWaitList,
                                         NumEventsInWaitList));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult = Kernel->setZeArgument(ZeKernel, Arg.Index, Arg.Size,
+                                              ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
@@ -157,6 +373,9 @@ ur_result_t urEnqueueKernelLaunch(
   // the code can do a urKernelRelease on this kernel.
   (*Event)->CommandData = (void *)Kernel;
 
+  UR_CALL(makeArgumentsResident(Queue, Kernel, ZeKernel, *Event, Released));
+  UR_CALL(prefetchSharedUSMArgs(Kernel, CommandList));
+
   // Increment the reference count of the Kernel and indicate that the Kernel
   // is in use. Once the event has been signalled, the code in
   // CleanupCompletedEvent(Event) will do a urKernelRelease to update the
@@ -168,28 +387,23 @@ ur_result_t urEnqueueKernelLaunch(
     Queue->KernelsToBeSubmitted.push_back(Kernel);
 
   if (Queue->UsingImmCmdLists && IndirectAccessTrackingEnabled) {
-    // If using immediate commandlists then gathering of indirect
-    // references and appending to the queue (which means submission)
-    // must be done together.
-    std::unique_lock<ur_shared_mutex> ContextsLock(
-        Queue->Device->Platform->ContextsMutex, std::defer_lock);
-    // We are going to submit kernels for execution. If indirect access flag is
-    // set for a kernel then we need to make a snapshot of existing memory
-    // allocations in all contexts in the platform. We need to lock the mutex
-    // guarding the list of contexts in the platform to prevent creation of new
-    // memory alocations in any context before we submit the kernel for
-    // execution.
-    ContextsLock.lock();
-    Queue->CaptureIndirectAccesses();
+    // If using immediate commandlists then the kernels must be recorded in
+    // the epoch of indirect accesses ahead of appending to the queue (which
+    // means submission), so that the memory freed from then on outlives them.
+    {
+      std::scoped_lock<ur_shared_mutex> ContextsLock(
+          Queue->Device->Platform->ContextsMutex);
+      Queue->CaptureIndirectAccesses();
+    }
     // Add the command to the command list, which implies submission.
     ZE2UR_CALL(zeCommandListAppendLaunchKernel,
                (CommandList->first, ZeKernel, &ZeThreadGroupDimensions, ZeEvent,
                 (*Event)->WaitList.Length, (*Event)->WaitList.ZeEventList));
   } else {
     // Add the command to the command list for later submission.
-    // No lock is needed here, unlike the immediate commandlist case above,
+    // No capture is needed here, unlike the immediate commandlist case above,
     // because the kernels are not actually submitted yet. Kernels will be
-    // submitted only when the comamndlist is closed. Then, a lock is held.
+    // captured only when the comamndlist is closed and executed.
     ZE2UR_CALL(zeCommandListAppendLaunchKernel,
                (CommandList->first, ZeKernel, &ZeThreadGroupDimensions, ZeEvent,
                 (*Event)->WaitList.Length, (*Event)->WaitList.ZeEventList));
@@ -241,22 +455,15 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
   UR_ASSERT(WorkDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
   UR_ASSERT(WorkDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
-  auto ZeDevice = Queue->Device->ZeDevice;
-
   ze_kernel_handle_t ZeKernel{};
-  if (Kernel->ZeKernelMap.empty()) {
-    ZeKernel = Kernel->ZeKernel;
-  } else {
-    auto It = Kernel->ZeKernelMap.find(ZeDevice);
-    if (It == Kernel->ZeKernelMap.end()) {
-      /* kernel and queue don't match */
-      return UR_RESULT_ERROR_INVALID_QUEUE;
-    }
-    ZeKernel = It->second;
-  }
+  UR_CALL(getZeKernel(Queue->Device->ZeDevice, Kernel, &ZeKernel));
+  // Declared first to be released after the locks below.
+  ReleasedAfterLaunch Released;
   // Lock automatically releases when this goes out of scope.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
       Queue->Mutex, Kernel->Mutex, Kernel->Program->Mutex);
+  UR_CALL(Kernel->bindArguments(ZeKernel, Queue->Device, NumEventsInWaitList,
+                                EventWaitList));
   if (GlobalWorkOffset != NULL) {
     if (!Queue->Device->Platform->ZeDriverGlobalOffsetExtensionFound) {
       logger::error("No global offset extension found on this driver");
@@ -278,8 +485,9 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
                                         Queue->Device, EventWaitList,
                                         NumEventsInWaitList));
     }
-    ZE2UR_CALL(zeKernelSetArgumentValue,
-               (ZeKernel, Arg.Index, Arg.Size, ZeHandlePtr));
+    if (auto ZeResult = Kernel->setZeArgument(ZeKernel, Arg.Index, Arg.Size,
+                                              ZeHandlePtr))
+      return ze2urResult(ZeResult);
   }
   Kernel->PendingArguments.clear();
 
@@ -423,6 +631,9 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
   // the code can do a urKernelRelease on this kernel.
   (*Event)->CommandData = (void *)Kernel;
 
+  UR_CALL(makeArgumentsResident(Queue, Kernel, ZeKernel, *Event, Released));
+  UR_CALL(prefetchSharedUSMArgs(Kernel, CommandList));
+
   // Increment the reference count of the Kernel and indicate that the Kernel
   // is in use. Once the event has been signalled, the code in
   // CleanupCompletedEvent(Event) will do a urKernelRelease to update the
@@ -434,28 +645,23 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
     Queue->KernelsToBeSubmitted.push_back(Kernel);
 
   if (Queue->UsingImmCmdLists && IndirectAccessTrackingEnabled) {
-    // If using immediate commandlists then gathering of indirect
-    // references and appending to the queue (which means submission)
-    // must be done together.
-    std::unique_lock<ur_shared_mutex> ContextsLock(
-        Queue->Device->Platform->ContextsMutex, std::defer_lock);
-    // We are going to submit kernels for execution. If indirect access flag is
-    // set for a kernel then we need to make a snapshot of existing memory
-    // allocations in all contexts in the platform. We need to lock the mutex
-    // guarding the list of contexts in the platform to prevent creation of new
-    // memory alocations in any context before we submit the kernel for
-    // execution.
-    ContextsLock.lock();
-    Queue->CaptureIndirectAccesses();
+    // If using immediate commandlists then the kernels must be recorded in
+    // the epoch of indirect accesses ahead of appending to the queue (which
+    // means submission), so that the memory freed from then on outlives them.
+    {
+      std::scoped_lock<ur_shared_mutex> ContextsLock(
+          Queue->Device->Platform->ContextsMutex);
+      Queue->CaptureIndirectAccesses();
+    }
     // Add the command to the command list, which implies submission.
     ZE2UR_CALL(zeCommandListAppendLaunchCooperativeKernel,
                (CommandList->first, ZeKernel, &ZeThreadGroupDimensions, ZeEvent,
                 (*Event)->WaitList.Length, (*Event)->WaitList.ZeEventList));
   } else {
     // Add the command to the command list for later submission.
-    // No lock is needed here, unlike the immediate commandlist case above,
+    // No capture is needed here, unlike the immediate commandlist case above,
     // because the kernels are not actually submitted yet. Kernels will be
-    // submitted only when the comamndlist is closed. Then, a lock is held.
+    // captured only when the comamndlist is closed and executed.
     ZE2UR_CALL(zeCommandListAppendLaunchCooperativeKernel,
                (CommandList->first, ZeKernel, &ZeThreadGroupDimensions, ZeEvent,
                 (*Event)->WaitList.Length, (*Event)->WaitList.ZeEventList));
@@ -474,6 +680,25 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t
+urEnqueueKernelLaunchMultiExp(uint32_t NumLaunches,
+                              const ur_exp_kernel_launch_t *Launches) {
+  // The locks of the queue are taken by each launch, as the commands are
+  // batched by the queue itself
+  for (uint32_t I = 0; I < NumLaunches; I++) {
+    const auto &Launch = Launches[I];
+    if (Launch.numArgs) {
+      UR_CALL(ur::level_zero::urKernelSetArgsExp(Launch.hKernel, Launch.numArgs,
+                                                 Launch.pArgs));
+    }
+    UR_CALL(ur::level_zero::urEnqueueKernelLaunch(
+        Launch.hQueue, Launch.hKernel, Launch.workDim, Launch.pGlobalWorkOffset,
+        Launch.pGlobalWorkSize, Launch.pLocalWorkSize,
+        Launch.numEventsInWaitList, Launch.phEventWaitList, Launch.phEvent));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urEnqueueDeviceGlobalVariableWrite(
     ur_queue_handle_t Queue,     ///< [in] handle of the queue to submit to.
     ur_program_handle_t Program, ///< [in] handle of the program containing the
@@ -509,8 +734,9 @@ ur_result_t urEnqueueDeviceGlobalVariableWrite(
   // Find global variable pointer
   size_t GlobalVarSize = 0;
   void *GlobalVarPtr = nullptr;
-  ZE2UR_CALL(zeModuleGetGlobalPointer,
-             (ZeModule, Name, &GlobalVarSize, &GlobalVarPtr));
+  if (auto ZeResult = Program->getZeGlobalPointer(
+          ZeModule, Name, &GlobalVarSize, &GlobalVarPtr))
+    return ze2urResult(ZeResult);
   if (GlobalVarSize < Offset + Count) {
     setErrorMessage("Write device global variable is out of range.",
                     UR_RESULT_ERROR_INVALID_VALUE,
@@ -571,8 +797,9 @@ ur_result_t urEnqueueDeviceGlobalVariableRead(
   // Find global variable pointer
   size_t GlobalVarSize = 0;
   void *GlobalVarPtr = nullptr;
-  ZE2UR_CALL(zeModuleGetGlobalPointer,
-             (ZeModule, Name, &GlobalVarSize, &GlobalVarPtr));
+  if (auto ZeResult = Program->getZeGlobalPointer(
+          ZeModule, Name, &GlobalVarSize, &GlobalVarPtr))
+    return ze2urResult(ZeResult);
   if (GlobalVarSize < Offset + Count) {
     setErrorMessage("Read from device global variable is out of range.",
                     UR_RESULT_ERROR_INVALID_VALUE,
@@ -618,20 +845,30 @@ ur_result_t urKernelCreate(
     return UR_RESULT_ERROR_UNKNOWN;
   }
 
+  // Only the L0 kernel of the first module is created here, those of the
+  // other devices are created on their first use. Contexts may have many
+  // devices, most of which never run most of the kernels.
   for (auto It : Program->ZeModuleMap) {
-    auto ZeModule = It.second;
-    ZeStruct<ze_kernel_desc_t> ZeKernelDesc;
-    ZeKernelDesc.flags = 0;
-    ZeKernelDesc.pKernelName = KernelName;
-
-    ze_kernel_handle_t ZeKernel;
-    auto ZeResult =
-        ZE_CALL_NOCHECK(zeKernelCreate, (ZeModule, &ZeKernelDesc, &ZeKernel));
-    // Gracefully handle the case that kernel create fails.
-    if (ZeResult != ZE_RESULT_SUCCESS) {
-      delete *RetKernel;
-      *RetKernel = nullptr;
-      return ze2urResult(ZeResult);
+    auto Slot = std::make_unique<ur_kernel_handle_t_::DeviceKernel>();
+    Slot->ZeModule = It.second;
+
+    if ((*RetKernel)->DeviceKernels.empty()) {
+      ZeStruct<ze_kernel_desc_t> ZeKernelDesc;
+      ZeKernelDesc.flags = 0;
+      ZeKernelDesc.pKernelName = KernelName;
+
+      ze_kernel_handle_t ZeKernel;
+      auto ZeResult = ZE_CALL_NOCHECK(
+          zeKernelCreate, (Slot->ZeModule, &ZeKernelDesc, &ZeKernel));
+      // Gracefully handle the case that kernel create fails.
+      if (ZeResult != ZE_RESULT_SUCCESS) {
+        delete *RetKernel;
+        *RetKernel = nullptr;
+        return ze2urResult(ZeResult);
+      }
+      Slot->ZeKernel = ZeKernel;
+      (*RetKernel)->ZeKernel = ZeKernel;
+      (*RetKernel)->BoundArguments[ZeKernel];
     }
 
     auto ZeDevice = It.first;
@@ -639,8 +876,7 @@ ur_result_t urKernelCreate(
     // Store the kernel in the ZeKernelMap so the correct
     // kernel can be retrieved later for a specific device
     // where a queue is being submitted.
-    (*RetKernel)->ZeKernelMap[ZeDevice] = ZeKernel;
-    (*RetKernel)->ZeKernels.push_back(ZeKernel);
+    (*RetKernel)->ZeKernelMap[ZeDevice] = Slot.get();
 
     // If the device used to create the module's kernel is a root-device
     // then store the kernel also using the sub-devices, since application
@@ -650,11 +886,11 @@ ur_result_t urKernelCreate(
     std::vector<ze_device_handle_t> ZeSubDevices(SubDevicesCount);
     zeDeviceGetSubDevices(ZeDevice, &SubDevicesCount, ZeSubDevices.data());
     for (auto ZeSubDevice : ZeSubDevices) {
-      (*RetKernel)->ZeKernelMap[ZeSubDevice] = ZeKernel;
+      (*RetKernel)->ZeKernelMap[ZeSubDevice] = Slot.get();
     }
-  }
 
-  (*RetKernel)->ZeKernel = (*RetKernel)->ZeKernelMap.begin()->second;
+    (*RetKernel)->DeviceKernels.push_back(std::move(Slot));
+  }
 
   UR_CALL((*RetKernel)->initialize());
 
@@ -674,41 +910,8 @@ ur_result_t urKernelSetArgValue(
 
   UR_ASSERT(Kernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
-  // OpenCL: "the arg_value pointer can be NULL or point to a NULL value
-  // in which case a NULL value will be used as the value for the argument
-  // declared as a pointer to global or constant memory in the kernel"
-  //
-  // We don't know the type of the argument but it seems that the only time
-  // SYCL RT would send a pointer to NULL in 'arg_value' is when the argument
-  // is a NULL pointer. Treat a pointer to NULL in 'arg_value' as a NULL.
-  if (ArgSize == sizeof(void *) && PArgValue &&
-      *(void **)(const_cast<void *>(PArgValue)) == nullptr) {
-    PArgValue = nullptr;
-  }
-
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  ze_result_t ZeResult = ZE_RESULT_SUCCESS;
-  if (Kernel->ZeKernelMap.empty()) {
-    auto ZeKernel = Kernel->ZeKernel;
-    ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
-                               (ZeKernel, ArgIndex, ArgSize, PArgValue));
-  } else {
-    for (auto It : Kernel->ZeKernelMap) {
-      auto ZeKernel = It.second;
-      ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
-                                 (ZeKernel, ArgIndex, ArgSize, PArgValue));
-    }
-  }
-
-  if (ZeResult == ZE_RESULT_ERROR_INVALID_ARGUMENT) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
-  }
-
-  return ze2urResult(ZeResult);
+  return setArgValueLocked(Kernel, ArgIndex, ArgSize, PArgValue);
 }
 
 ur_result_t urKernelSetArgLocal(
@@ -827,9 +1030,8 @@ ur_result_t urKernelGetGroupInfo(
     // This makes the assumption that this device is the same device where this
     // kernel was created.
     auto ZeKernelDevice = Kernel->ZeKernel;
-    auto It = Kernel->ZeKernelMap.find(Device->ZeDevice);
-    if (It != Kernel->ZeKernelMap.end()) {
-      ZeKernelDevice = Kernel->ZeKernelMap[Device->ZeDevice];
+    if (Kernel->ZeKernelMap.count(Device->ZeDevice)) {
+      UR_CALL(getZeKernel(Device->ZeDevice, Kernel, &ZeKernelDevice));
     }
     if (ZeKernelDevice) {
       auto ZeResult = ZE_CALL_NOCHECK(zeKernelGetProperties,
@@ -921,6 +1123,10 @@ ur_result_t urKernelRelease(
 
   auto KernelProgram = Kernel->Program;
   if (Kernel->OwnNativeHandle) {
+    for (auto &Slot : Kernel->DeviceKernels) {
+      if (auto ZeKernel = Slot->ZeKernel.load())
+        Kernel->ZeKernels.push_back(ZeKernel);
+    }
     for (auto &ZeKernel : Kernel->ZeKernels) {
       auto ZeResult = ZE_CALL_NOCHECK(zeKernelDestroy, (ZeKernel));
       // Gracefully handle the case that L0 was already unloaded.
@@ -952,10 +1158,10 @@ ur_result_t urKernelSetArgPointer(
 ) {
   std::ignore = Properties;
 
-  // KernelSetArgValue is expecting a pointer to the argument
-  UR_CALL(ur::level_zero::urKernelSetArgValue(
-      Kernel, ArgIndex, sizeof(const void *), nullptr, &ArgValue));
-  return UR_RESULT_SUCCESS;
+  UR_ASSERT(Kernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
+  return setArgPointerLocked(Kernel, ArgIndex, ArgValue);
 }
 
 ur_result_t urKernelSetExecInfo(
@@ -970,18 +1176,15 @@ ur_result_t urKernelSetExecInfo(
   std::ignore = PropSize;
   std::ignore = Properties;
 
-  auto ZeKernel = Kernel->ZeKernel;
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
   if (PropName == UR_KERNEL_EXEC_INFO_USM_INDIRECT_ACCESS &&
       *(static_cast<const ur_bool_t *>(PropValue)) == true) {
     // The whole point for users really was to not need to know anything
     // about the types of allocations kernel uses. So in DPC++ we always
     // just set all 3 modes for each kernel.
-    ze_kernel_indirect_access_flags_t IndirectFlags =
-        ZE_KERNEL_INDIRECT_ACCESS_FLAG_HOST |
-        ZE_KERNEL_INDIRECT_ACCESS_FLAG_DEVICE |
-        ZE_KERNEL_INDIRECT_ACCESS_FLAG_SHARED;
-    ZE2UR_CALL(zeKernelSetIndirectAccess, (ZeKernel, IndirectFlags));
+    Kernel->ZeIndirectAccessFlags = ZE_KERNEL_INDIRECT_ACCESS_FLAG_HOST |
+                                    ZE_KERNEL_INDIRECT_ACCESS_FLAG_DEVICE |
+                                    ZE_KERNEL_INDIRECT_ACCESS_FLAG_SHARED;
   } else if (PropName == UR_KERNEL_EXEC_INFO_CACHE_CONFIG) {
     ze_cache_config_flag_t ZeCacheConfig{};
     auto CacheConfig =
@@ -995,12 +1198,24 @@ ur_result_t urKernelSetExecInfo(
     else
       // Unexpected cache configuration value.
       return UR_RESULT_ERROR_INVALID_VALUE;
-    ZE2UR_CALL(zeKernelSetCacheConfig, (ZeKernel, ZeCacheConfig););
+    Kernel->ZeCacheConfig = ZeCacheConfig;
   } else {
     logger::error("urKernelSetExecInfo: unsupported ParamName");
     return UR_RESULT_ERROR_INVALID_VALUE;
   }
 
+  // The L0 kernels whose arguments aren't bound yet get the attributes from
+  // bindArguments
+  if (Kernel->ZeKernelMap.empty()) {
+    if (auto ZeResult = Kernel->setExecInfo(Kernel->ZeKernel))
+      return ze2urResult(ZeResult);
+  } else {
+    for (auto &It : Kernel->BoundArguments) {
+      if (auto ZeResult = Kernel->setExecInfo(It.first))
+        return ze2urResult(ZeResult);
+    }
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -1013,13 +1228,7 @@ ur_result_t urKernelSetArgSampler(
 ) {
   std::ignore = Properties;
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-  ZE2UR_CALL(zeKernelSetArgumentValue, (Kernel->ZeKernel, ArgIndex,
-                                        sizeof(void *), &ArgValue->ZeSampler));
-
-  return UR_RESULT_SUCCESS;
+  return setArgSamplerLocked(Kernel, ArgIndex, ArgValue);
 }
 
 ur_result_t urKernelSetArgMemObj(
@@ -1029,39 +1238,10 @@ ur_result_t urKernelSetArgMemObj(
         *Properties, ///< [in][optional] pointer to Memory object properties.
     ur_mem_handle_t ArgValue ///< [in][optional] handle of Memory object.
 ) {
-  std::ignore = Properties;
-
   std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
-  // The ArgValue may be a NULL pointer in which case a NULL value is used for
-  // the kernel argument declared as a pointer to global or constant memory.
-
-  if (ArgIndex > Kernel->ZeKernelProperties->numKernelArgs - 1) {
-    return UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
-  }
-
-  ur_mem_handle_t_ *UrMem = ur_cast<ur_mem_handle_t_ *>(ArgValue);
-
-  ur_mem_handle_t_::access_mode_t UrAccessMode = ur_mem_handle_t_::read_write;
-  if (Properties) {
-    switch (Properties->memoryAccess) {
-    case UR_MEM_FLAG_READ_WRITE:
-      UrAccessMode = ur_mem_handle_t_::read_write;
-      break;
-    case UR_MEM_FLAG_WRITE_ONLY:
-      UrAccessMode = ur_mem_handle_t_::write_only;
-      break;
-    case UR_MEM_FLAG_READ_ONLY:
-      UrAccessMode = ur_mem_handle_t_::read_only;
-      break;
-    default:
-      return UR_RESULT_ERROR_INVALID_ARGUMENT;
-    }
-  }
-  auto Arg = UrMem ? UrMem : nullptr;
-  Kernel->PendingArguments.push_back(
-      {ArgIndex, sizeof(void *), Arg, UrAccessMode});
-
-  return UR_RESULT_SUCCESS;
+  return setArgMemObjLocked(
+      Kernel, ArgIndex,
+      Properties ? Properties->memoryAccess : UR_MEM_FLAG_READ_WRITE, ArgValue);
 }
 
 ur_result_t urKernelGetNativeHandle(
@@ -1088,6 +1268,39 @@ ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t Kernel, uint32_t NumArgs,
+                               const ur_exp_kernel_arg_t *Args) {
+  std::scoped_lock<ur_shared_mutex> Guard(Kernel->Mutex);
+  for (uint32_t I = 0; I < NumArgs; I++) {
+    const auto &Arg = Args[I];
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      UR_CALL(setArgValueLocked(Kernel, Arg.index, Arg.size, Arg.value.value));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      UR_CALL(setArgPointerLocked(Kernel, Arg.index, Arg.value.pointer));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      ur_mem_flags_t Flags = Arg.value.memObjTuple.flags;
+      UR_CALL(setArgMemObjLocked(Kernel, Arg.index,
+                                 Flags ? Flags : UR_MEM_FLAG_READ_WRITE,
+                                 Arg.value.memObjTuple.hMem));
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      UR_CALL(setArgValueLocked(Kernel, Arg.index, Arg.size, nullptr));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      UR_CALL(setArgSamplerLocked(Kernel, Arg.index, Arg.value.sampler));
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urKernelCreateWithNativeHandle(
     ur_native_handle_t NativeKernel, ///< [in] the native handle of the kernel.
     ur_context_handle_t Context,     ///< [in] handle of the context object
@@ -1166,3 +1379,80 @@ ur_result_t ur_kernel_handle_t_::initialize() {
 
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t ur_kernel_handle_t_::bindArguments(
+    ze_kernel_handle_t ZeKernel, ur_device_handle_t Device,
+    uint32_t NumEventsInWaitList, const ur_event_handle_t *EventWaitList) {
+  if (!SkipsBoundArguments || BoundArguments.count(ZeKernel))
+    return UR_RESULT_SUCCESS;
+
+  if (auto ZeResult = setExecInfo(ZeKernel))
+    return ze2urResult(ZeResult);
+
+  // The L0 kernel created first has all the arguments set so far, but the
+  // memory objects are resolved for the device they were last used on
+  auto Arguments = BoundArguments[this->ZeKernel];
+  BoundArguments[ZeKernel];
+  for (uint32_t Index = 0; Index < Arguments.size(); Index++) {
+    auto &Bound = Arguments[Index];
+    if (!Bound.IsSet || MemObjArguments.count(Index))
+      continue;
+    if (auto ZeResult =
+            setZeArgument(ZeKernel, Index, Bound.Bytes.size(),
+                          Bound.IsNull ? nullptr : Bound.Bytes.data()))
+      return ze2urResult(ZeResult);
+  }
+  for (auto &[Index, Arg] : MemObjArguments) {
+    char **ZeHandlePtr = nullptr;
+    if (Arg.Value) {
+      UR_CALL(Arg.Value->getZeHandlePtr(ZeHandlePtr, Arg.AccessMode, Device,
+                                        EventWaitList, NumEventsInWaitList));
+    }
+    if (auto ZeResult = setZeArgument(ZeKernel, Index, Arg.Size, ZeHandlePtr))
+      return ze2urResult(ZeResult);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ze_result_t ur_kernel_handle_t_::setExecInfo(ze_kernel_handle_t ZeKernel) {
+  if (ZeIndirectAccessFlags) {
+    if (auto ZeResult = ZE_CALL_NOCHECK(zeKernelSetIndirectAccess,
+                                        (ZeKernel, *ZeIndirectAccessFlags)))
+      return ZeResult;
+  }
+  if (ZeCacheConfig) {
+    if (auto ZeResult =
+            ZE_CALL_NOCHECK(zeKernelSetCacheConfig, (ZeKernel, *ZeCacheConfig)))
+      return ZeResult;
+  }
+  return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t ur_kernel_handle_t_::setZeArgument(ze_kernel_handle_t ZeKernel,
+                                               uint32_t Index, size_t Size,
+                                               const void *Value) {
+  if (!SkipsBoundArguments)
+    return ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
+                           (ZeKernel, Index, Size, Value));
+
+  auto &Arguments = BoundArguments[ZeKernel];
+  if (Arguments.size() <= Index)
+    Arguments.resize(Index + 1);
+  auto &Bound = Arguments[Index];
+
+  auto Bytes = static_cast<const char *>(Value);
+  if (Bound.IsSet && Bound.IsNull == !Value && Bound.Bytes.size() == Size &&
+      (!Value || std::equal(Bytes, Bytes + Size, Bound.Bytes.begin())))
+    return ZE_RESULT_SUCCESS;
+
+  auto ZeResult = ZE_CALL_NOCHECK(zeKernelSetArgumentValue,
+                                  (ZeKernel, Index, Size, Value));
+  // What the argument is set to after a failure is unknown
+  Bound.IsSet = ZeResult == ZE_RESULT_SUCCESS;
+  Bound.IsNull = !Value;
+  if (Value)
+    Bound.Bytes.assign(Bytes, Bytes + Size);
+  else
+    Bound.Bytes.assign(Size, 0);
+  return ZeResult;
+}
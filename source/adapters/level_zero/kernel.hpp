@@ -11,19 +11,24 @@
 
 #include "common.hpp"
 #include "memory.hpp"
+#include <atomic>
+#include <memory>
+#include <optional>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 struct ur_kernel_handle_t_ : _ur_object {
   ur_kernel_handle_t_(bool OwnZeHandle, ur_program_handle_t Program)
       : Context{nullptr}, Program{Program}, ZeKernel{nullptr},
-        SubmissionsCount{0}, MemAllocs{} {
+        SubmissionsCount{0} {
     OwnNativeHandle = OwnZeHandle;
   }
 
   ur_kernel_handle_t_(ze_kernel_handle_t Kernel, bool OwnZeHandle,
                       ur_context_handle_t Context)
       : Context{Context}, Program{nullptr}, ZeKernel{Kernel},
-        SubmissionsCount{0}, MemAllocs{} {
+        SubmissionsCount{0}, SkipsBoundArguments{false} {
     OwnNativeHandle = OwnZeHandle;
   }
 
@@ -36,13 +41,24 @@ struct ur_kernel_handle_t_ : _ur_object {
   // Level Zero function handle.
   ze_kernel_handle_t ZeKernel;
 
-  // Map of L0 kernels created for all the devices for which a UR Program
-  // has been built. It may contain duplicated kernel entries for a root
-  // device and its sub-devices.
-  std::unordered_map<ze_device_handle_t, ze_kernel_handle_t> ZeKernelMap;
+  // L0 kernel of one of the modules of the program, created from the module
+  // on first use by getZeKernel. Once set ZeKernel doesn't change, so it is
+  // read without locking.
+  struct DeviceKernel {
+    ze_module_handle_t ZeModule = nullptr;
+    std::atomic<ze_kernel_handle_t> ZeKernel{nullptr};
+  };
+  // One entry for each module of the program, ZeKernel being created up front
+  // for one of them.
+  std::vector<std::unique_ptr<DeviceKernel>> DeviceKernels;
+
+  // Map of the L0 kernels of all the devices for which a UR Program has been
+  // built. Kernels of root devices are also mapped to their sub-devices.
+  // Not changed after the kernel is created.
+  std::unordered_map<ze_device_handle_t, DeviceKernel *> ZeKernelMap;
 
-  // Vector of L0 kernels. Each entry is unique, so this is used for
-  // destroying the kernels instead of ZeKernelMap
+  // L0 kernels created from native handles owned by this kernel, which are
+  // destroyed along with the DeviceKernels.
   std::vector<ze_kernel_handle_t> ZeKernels;
 
   // Counter to track the number of submissions of the kernel.
@@ -63,29 +79,11 @@ struct ur_kernel_handle_t_ : _ur_object {
     return true;
   }
 
-  // Hash function object for the unordered_set below.
-  struct Hash {
-    size_t operator()(const std::pair<void *const, MemAllocRecord> *P) const {
-      return std::hash<void *>()(P->first);
-    }
-  };
-
-  // If kernel has indirect access we need to make a snapshot of all existing
-  // memory allocations to defer deletion of these memory allocations to the
-  // moment when kernel execution has finished.
-  // We store pointers to the elements because pointers are not invalidated by
-  // insert/delete for std::unordered_map (iterators are invalidated). We need
-  // to take a snapshot instead of just reference-counting the allocations,
-  // because picture of active allocations can change during kernel execution
-  // (new allocations can be added) and we need to know which memory allocations
-  // were retained by this kernel to release them (and don't touch new
-  // allocations) at kernel completion. Same kernel may be submitted several
-  // times and retained allocations may be different at each submission. That's
-  // why we have a set of memory allocations here and increase ref count only
-  // once even if kernel is submitted many times. We don't want to know how many
-  // times and which allocations were retained by each submission. We release
-  // all allocations in the set only when SubmissionsCount == 0.
-  std::unordered_set<std::pair<void *const, MemAllocRecord> *, Hash> MemAllocs;
+  // Epoch of the platform when the kernel was submitted while it had no
+  // submission in flight, so the allocations freed since that epoch are only
+  // released once SubmissionsCount drops to zero. Guarded by the ContextsMutex
+  // of the platform.
+  uint64_t IndirectAccessEpoch = 0;
 
   // Completed initialization of PI kernel. Must be called after construction.
   ur_result_t initialize();
@@ -102,11 +100,62 @@ struct ur_kernel_handle_t_ : _ur_object {
   // Arguments that still need to be set (with zeKernelSetArgumentValue)
   // before kernel is enqueued.
   std::vector<ArgumentInfo> PendingArguments;
+  // Last memory object set to each argument, by index. The handle of the
+  // object depends on the device, so the L0 kernels created after it was set
+  // get it for their own device rather than from the first L0 kernel.
+  std::unordered_map<uint32_t, ArgumentInfo> MemObjArguments;
+
+  // Execution attributes set with urKernelSetExecInfo, which the L0 kernels
+  // created later get when their arguments are bound
+  std::optional<ze_kernel_indirect_access_flags_t> ZeIndirectAccessFlags;
+  std::optional<ze_cache_config_flag_t> ZeCacheConfig;
+  // Sets the execution attributes set so far to ZeKernel
+  ze_result_t setExecInfo(ze_kernel_handle_t ZeKernel);
+
+  // Sets an argument of ZeKernel, which must be one of the L0 kernels of this
+  // kernel, unless that value is already set. Value may be null. The kernel
+  // must be locked by the caller.
+  ze_result_t setZeArgument(ze_kernel_handle_t ZeKernel, uint32_t Index,
+                            size_t Size, const void *Value);
+
+  // Sets the arguments and execution attributes set so far to ZeKernel, the
+  // L0 kernel of Device, if it was created after them. The memory objects are
+  // made valid on Device after the events of the wait list. The kernel must be
+  // locked by the caller.
+  ur_result_t bindArguments(ze_kernel_handle_t ZeKernel,
+                            ur_device_handle_t Device,
+                            uint32_t NumEventsInWaitList,
+                            const ur_event_handle_t *EventWaitList);
+
+  // Last value set to an argument of an L0 kernel
+  struct BoundArgument {
+    bool IsSet = false;
+    bool IsNull = false;
+    std::vector<char> Bytes;
+  };
+  // Values set to the arguments of each L0 kernel, by index. Frameworks set
+  // all the arguments before every launch, mostly to the same values. The L0
+  // kernels of programs all have an entry once their arguments are bound.
+  std::unordered_map<ze_kernel_handle_t, std::vector<BoundArgument>>
+      BoundArguments;
+  // Whether setZeArgument skips the values already set. Not for the kernels
+  // created from native handles, whose arguments may be set through L0 too.
+  bool SkipsBoundArguments = true;
+
+  // Shared USM allocations that pointer arguments point into, by index,
+  // prefetched to the device before each launch with UR_L0_USM_AUTO_PREFETCH
+  struct SharedUSMRange {
+    void *Base;
+    size_t Size;
+  };
+  std::unordered_map<uint32_t, SharedUSMRange> SharedUSMArgs;
 
   // Cache of the kernel properties.
   ZeCache<ZeStruct<ze_kernel_properties_t>> ZeKernelProperties;
   ZeCache<std::string> ZeKernelName;
 };
 
+// Gets the L0 kernel of hKernel for hDevice, creating it on first use. Its
+// arguments are only set by bindArguments.
 ur_result_t getZeKernel(ze_device_handle_t hDevice, ur_kernel_handle_t hKernel,
                         ze_kernel_handle_t *phZeKernel);
@@ -9,8 +9,10 @@
 //===----------------------------------------------------------------------===//
 
 #include <algorithm>
+#include <array>
 #include <climits>
 #include <string.h>
+#include <utility>
 #include <ur/ur.hpp>
 
 #include "context.hpp"
@@ -57,6 +59,327 @@ bool IsSharedPointer(ur_context_handle_t Context, const void *Ptr) {
   return (ZeMemoryAllocationProperties.type == ZE_MEMORY_TYPE_SHARED);
 }
 
+// Helper function to get the memory type of a pointer, with a single query.
+// Unknown if the query fails.
+static ze_memory_type_t GetMemoryType(ur_context_handle_t Context,
+                                      const void *Ptr) {
+  ze_device_handle_t ZeDeviceHandle;
+  ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+
+  // Query memory type of the pointer
+  if (ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                      (Context->ZeContext, Ptr, &ZeMemoryAllocationProperties,
+                       &ZeDeviceHandle)) != ZE_RESULT_SUCCESS) {
+    return ZE_MEMORY_TYPE_UNKNOWN;
+  }
+
+  return ZeMemoryAllocationProperties.type;
+}
+
+// Copies of at least this many bytes are split in chunks, which all the copy
+// engines of the queue copy at once. Not split by default.
+static const size_t CopyStripeThreshold = [] {
+  const char *UrRet = std::getenv("UR_L0_COPY_STRIPE_THRESHOLD");
+  if (!UrRet)
+    return size_t{0};
+  long long Threshold = std::atoll(UrRet);
+  return Threshold > 0 ? static_cast<size_t>(Threshold) : size_t{0};
+}();
+
+// Chunks are a multiple of this size, so that the engines don't share pages
+static constexpr size_t CopyStripeAlignment = 4096;
+
+// Returns the number of chunks to split a copy of Size bytes in, 1 if it
+// isn't split. Only the copies of out-of-order queues are split: the commands
+// of in-order queues rely on following each other on the same command list.
+static uint32_t getCopyStripeCount(ur_queue_handle_t Queue, bool UseCopyEngine,
+                                   size_t Size) {
+  if (!CopyStripeThreshold || Size < CopyStripeThreshold || !UseCopyEngine ||
+      Queue->isInOrderQueue())
+    return 1;
+  auto &QueueGroup = Queue->getQueueGroup(true /*UseCopyEngine*/);
+  size_t NumEngines = QueueGroup.UpperIndex - QueueGroup.LowerIndex + 1;
+  size_t MaxChunks = std::max<size_t>(Size / CopyStripeAlignment, 1);
+  return static_cast<uint32_t>(std::min(NumEngines, MaxChunks));
+}
+
+// Copies Size bytes in NumChunks chunks, each on the next copy engine of the
+// queue, and signals the event of the copy once all the chunks are copied.
+// Same locking requirements as enqueueMemCopyHelper.
+static ur_result_t
+enqueueStripedMemCopy(ur_command_t CommandType, ur_queue_handle_t Queue,
+                      void *Dst, ur_bool_t BlockingWrite, size_t Size,
+                      const void *Src, uint32_t NumChunks,
+                      uint32_t NumEventsInWaitList,
+                      const ur_event_handle_t *EventWaitList,
+                      ur_event_handle_t *OutEvent) {
+  auto &QueueGroup = Queue->getQueueGroup(true /*UseCopyEngine*/);
+  size_t ChunkSize = (Size + NumChunks - 1) / NumChunks;
+  ChunkSize = (ChunkSize + CopyStripeAlignment - 1) / CopyStripeAlignment *
+              CopyStripeAlignment;
+
+  // The chunks are internal events, owned by their command lists
+  std::vector<ur_event_handle_t> ChunkEvents;
+  ChunkEvents.reserve(NumChunks);
+  for (size_t Offset = 0; Offset < Size; Offset += ChunkSize) {
+    _ur_ze_event_list_t TmpWaitList;
+    UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+        NumEventsInWaitList, EventWaitList, Queue, true /*UseCopyEngine*/));
+
+    // Immediate command lists are taken from the engines in turn, regular
+    // command lists have to be created for the next engine.
+    ze_command_queue_handle_t *ForcedCmdQueue = nullptr;
+    uint32_t QueueGroupOrdinal;
+    if (!Queue->UsingImmCmdLists)
+      ForcedCmdQueue = &QueueGroup.getZeQueue(&QueueGroupOrdinal);
+
+    // Not batched, so that each chunk is submitted to its engine right away
+    ur_command_list_ptr_t CommandList{};
+    UR_CALL(Queue->Context->getAvailableCommandList(
+        Queue, CommandList, true /*UseCopyEngine*/, NumEventsInWaitList,
+        EventWaitList, false /*AllowBatching*/, ForcedCmdQueue));
+
+    ur_event_handle_t ChunkEvent;
+    UR_CALL(createEventAndAssociateQueue(Queue, &ChunkEvent, CommandType,
+                                         CommandList, true /*IsInternal*/,
+                                         false));
+    ChunkEvent->WaitList = TmpWaitList;
+
+    size_t ChunkBytes = std::min(ChunkSize, Size - Offset);
+    logger::debug("calling zeCommandListAppendMemoryCopy() for bytes [{}, {})"
+                  " of {} with ZeEvent {}",
+                  Offset, Offset + ChunkBytes, Size,
+                  ur_cast<std::uintptr_t>(ChunkEvent->ZeEvent));
+    printZeEventList(ChunkEvent->WaitList);
+
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (CommandList->first, static_cast<char *>(Dst) + Offset,
+                static_cast<const char *>(Src) + Offset, ChunkBytes,
+                ChunkEvent->ZeEvent, ChunkEvent->WaitList.Length,
+                ChunkEvent->WaitList.ZeEventList));
+    ChunkEvents.push_back(ChunkEvent);
+
+    UR_CALL(Queue->executeCommandList(CommandList, false /*IsBlocking*/,
+                                      false /*OKToBatchCommand*/));
+  }
+
+  // Join the chunks with a barrier signaling the event of the copy
+  auto NumChunkEvents = static_cast<uint32_t>(ChunkEvents.size());
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumChunkEvents, ChunkEvents.data(), Queue, true /*UseCopyEngine*/));
+
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, true /*UseCopyEngine*/, NumChunkEvents,
+      ChunkEvents.data(), false /*AllowBatching*/, nullptr /*ForcedCmdQueue*/));
+
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = OutEvent == nullptr;
+  ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
+                                       IsInternal, false));
+  (*Event)->WaitList = TmpWaitList;
+
+  ZE2UR_CALL(zeCommandListAppendBarrier,
+             (CommandList->first, (*Event)->ZeEvent, (*Event)->WaitList.Length,
+              (*Event)->WaitList.ZeEventList));
+
+  UR_CALL(Queue->executeCommandList(CommandList, BlockingWrite,
+                                    false /*OKToBatchCommand*/));
+
+  return UR_RESULT_SUCCESS;
+}
+
+// Helper function to check if a pointer is host memory unknown to the driver,
+// which it copies through staging buffers of its own.
+static bool isPageableHostPointer(ur_context_handle_t Context,
+                                  const void *Ptr) {
+  ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+  auto ZeResult = ZE_CALL_NOCHECK(
+      zeMemGetAllocProperties,
+      (Context->ZeContext, Ptr, &ZeMemoryAllocationProperties, nullptr));
+  return ZeResult == ZE_RESULT_SUCCESS &&
+         ZeMemoryAllocationProperties.type == ZE_MEMORY_TYPE_UNKNOWN;
+}
+
+// Writes of host memory of at most this many bytes, such as parameter blocks
+// and counters, stay on the compute engine and are appended with their data
+// when they fit in a fill pattern, instead of a copy-engine round trip.
+// 0 disables it.
+static const size_t InlineWriteThreshold = [] {
+  const char *UrRet = std::getenv("UR_L0_INLINE_WRITE_THRESHOLD");
+  if (!UrRet)
+    return size_t{256};
+  long long Threshold = std::atoll(UrRet);
+  return Threshold > 0 ? static_cast<size_t>(Threshold) : size_t{0};
+}();
+
+// Whether the copy of Size bytes from Src is a write small enough to be
+// appended as a fill. Only writes of buffers and device globals qualify, as
+// their destination is device memory, and only from pageable host memory,
+// which the application can't update from the device or another thread
+// while the write is pending, unlike USM host memory. The source is only
+// queried once the cheaper checks pass.
+static bool isInlineWrite(ur_command_t CommandType, ur_queue_handle_t Queue,
+                          const void *Src, size_t Size) {
+  if (CommandType != UR_COMMAND_MEM_BUFFER_WRITE &&
+      CommandType != UR_COMMAND_DEVICE_GLOBAL_VARIABLE_WRITE)
+    return false;
+  if (Size == 0 || Size > InlineWriteThreshold || !isPowerOf2(Size) ||
+      Size > Queue->Device
+                 ->QueueGroup[ur_device_handle_t_::queue_group_info_t::Compute]
+                 .ZeProperties.maxMemoryFillPatternSize)
+    return false;
+  return isPageableHostPointer(Queue->Context, Src);
+}
+
+// Blocking copy of Size bytes from or to the pageable host memory at Src or
+// Dst, in chunks which go through two pinned staging chunks in turn, so that
+// the host copies a chunk while the device copies the other one. The host
+// pointer is imported instead if SYCL_USM_HOSTPTR_IMPORT is set.
+// Same locking requirements as enqueueMemCopyHelper.
+static ur_result_t enqueuePageableMemCopy(
+    ur_command_t CommandType, ur_queue_handle_t Queue, void *Dst, size_t Size,
+    const void *Src, bool HostToDevice, uint32_t NumEventsInWaitList,
+    const ur_event_handle_t *EventWaitList, ur_event_handle_t *OutEvent,
+    bool PreferCopyEngine) {
+  auto Context = Queue->Context;
+  if (ZeUSMImport.Enabled) {
+    void *HostPtr = HostToDevice ? const_cast<void *>(Src) : Dst;
+    auto ZeDriver = Context->getPlatform()->ZeDriverHandleExpTranslated;
+    ZeUSMImport.doZeUSMImport(ZeDriver, HostPtr, Size);
+    // Staged if the driver didn't import it
+    if (!isPageableHostPointer(Context, HostPtr)) {
+      auto Res = enqueueMemCopyHelper(CommandType, Queue, Dst, true, Size, Src,
+                                      NumEventsInWaitList, EventWaitList,
+                                      OutEvent, PreferCopyEngine);
+      ZeUSMImport.doZeUSMRelease(ZeDriver, HostPtr);
+      return Res;
+    }
+  }
+
+  bool UseCopyEngine = Queue->useCopyEngine(PreferCopyEngine);
+  const size_t ChunkSize = ur_context_handle_t_::StagingChunkSize;
+
+  struct Stage {
+    void *Chunk = nullptr;
+    // Copy in flight from or to Chunk, retained until waited for
+    ur_event_handle_t Event = nullptr;
+    size_t Offset = 0;
+  };
+  std::array<Stage, 2> Stages;
+
+  // Copies the chunk at Offset between the device memory and the stage
+  auto Enqueue = [&](Stage &S, size_t Offset) -> ur_result_t {
+    S.Offset = Offset;
+    size_t Bytes = std::min(ChunkSize, Size - Offset);
+    _ur_ze_event_list_t TmpWaitList;
+    UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+        NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+    ur_command_list_ptr_t CommandList{};
+    UR_CALL(Queue->Context->getAvailableCommandList(
+        Queue, CommandList, UseCopyEngine, NumEventsInWaitList, EventWaitList,
+        false /*AllowBatching*/, nullptr /*ForcedCmdQueue*/));
+
+    // Not internal, so that it isn't reused before we waited for it, and
+    // host-visible to be waited for from the host
+    UR_CALL(createEventAndAssociateQueue(Queue, &S.Event, CommandType,
+                                         CommandList, false /*IsInternal*/,
+                                         false /*IsMultiDevice*/,
+                                         true /*HostVisible*/));
+    S.Event->WaitList = TmpWaitList;
+
+    void *To = HostToDevice ? static_cast<char *>(Dst) + Offset : S.Chunk;
+    const void *From =
+        HostToDevice ? S.Chunk : static_cast<const char *>(Src) + Offset;
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (CommandList->first, To, From, Bytes, S.Event->ZeEvent,
+                S.Event->WaitList.Length, S.Event->WaitList.ZeEventList));
+
+    return Queue->executeCommandList(CommandList, false /*IsBlocking*/,
+                                     false /*OKToBatchCommand*/);
+  };
+
+  auto Wait = [&](Stage &S) -> ur_result_t {
+    if (!S.Event)
+      return UR_RESULT_SUCCESS;
+    auto Event = std::exchange(S.Event, nullptr);
+    auto ZeResult =
+        ZE_CALL_NOCHECK(zeEventHostSynchronize, (Event->ZeEvent, UINT64_MAX));
+    UR_CALL(ur::level_zero::urEventRelease(Event));
+    return ze2urResult(ZeResult);
+  };
+
+  auto Run = [&]() -> ur_result_t {
+    for (auto &S : Stages)
+      UR_CALL(Context->getStagingChunk(S.Chunk));
+
+    size_t NumChunks = (Size + ChunkSize - 1) / ChunkSize;
+    if (HostToDevice) {
+      for (size_t I = 0; I < NumChunks; ++I) {
+        auto &S = Stages[I % Stages.size()];
+        UR_CALL(Wait(S));
+        size_t Offset = I * ChunkSize;
+        std::memcpy(S.Chunk, static_cast<const char *>(Src) + Offset,
+                    std::min(ChunkSize, Size - Offset));
+        UR_CALL(Enqueue(S, Offset));
+      }
+    } else {
+      UR_CALL(Enqueue(Stages[0], 0));
+      for (size_t I = 0; I < NumChunks; ++I) {
+        if (I + 1 < NumChunks)
+          UR_CALL(Enqueue(Stages[(I + 1) % Stages.size()],
+                          (I + 1) * ChunkSize));
+        auto &S = Stages[I % Stages.size()];
+        UR_CALL(Wait(S));
+        std::memcpy(static_cast<char *>(Dst) + S.Offset, S.Chunk,
+                    std::min(ChunkSize, Size - S.Offset));
+      }
+    }
+    for (auto &S : Stages)
+      UR_CALL(Wait(S));
+    return UR_RESULT_SUCCESS;
+  };
+
+  ur_result_t Res = Run();
+  // The chunks are only given back once no copy from or to them is in flight
+  for (auto &S : Stages) {
+    if (S.Event) {
+      ZE_CALL_NOCHECK(zeEventHostSynchronize, (S.Event->ZeEvent, UINT64_MAX));
+      ur::level_zero::urEventRelease(S.Event);
+    }
+    if (S.Chunk)
+      Context->releaseStagingChunk(S.Chunk);
+  }
+  UR_CALL(Res);
+
+  // The event of the copy is only signaled once the host is done with it too
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, UseCopyEngine, NumEventsInWaitList, EventWaitList,
+      false /*AllowBatching*/, nullptr /*ForcedCmdQueue*/));
+
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = OutEvent == nullptr;
+  ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType, CommandList,
+                                       IsInternal, false));
+  (*Event)->WaitList = TmpWaitList;
+
+  ZE2UR_CALL(zeCommandListAppendBarrier,
+             (CommandList->first, (*Event)->ZeEvent, (*Event)->WaitList.Length,
+              (*Event)->WaitList.ZeEventList));
+
+  return Queue->executeCommandList(CommandList, true /*IsBlocking*/,
+                                   false /*OKToBatchCommand*/);
+}
+
 // Shared by all memory read/write/copy PI interfaces.
 // PI interfaces must have queue's and destination buffer's mutexes locked for
 // exclusive use and source buffer's mutex locked for shared use on entry.
@@ -67,8 +390,33 @@ ur_result_t enqueueMemCopyHelper(ur_command_t CommandType,
                                  const ur_event_handle_t *EventWaitList,
                                  ur_event_handle_t *OutEvent,
                                  bool PreferCopyEngine) {
+  // Only blocking copies can be staged, as the host copies the chunks
+  if (BlockingWrite && ur_context_handle_t_::StagingChunkSize &&
+      Size > 2 * ur_context_handle_t_::StagingChunkSize) {
+    bool SrcPageable = isPageableHostPointer(Queue->Context, Src);
+    bool DstPageable = isPageableHostPointer(Queue->Context, Dst);
+    if (SrcPageable != DstPageable) {
+      return enqueuePageableMemCopy(CommandType, Queue, Dst, Size, Src,
+                                    SrcPageable, NumEventsInWaitList,
+                                    EventWaitList, OutEvent, PreferCopyEngine);
+    }
+  }
+
+  // Inline writes are ordered with the kernels around them, which are on the
+  // compute engine
+  bool IsInlineWrite = isInlineWrite(CommandType, Queue, Src, Size);
+  if (IsInlineWrite)
+    PreferCopyEngine = false;
+
   bool UseCopyEngine = Queue->useCopyEngine(PreferCopyEngine);
 
+  if (uint32_t NumChunks = getCopyStripeCount(Queue, UseCopyEngine, Size);
+      NumChunks > 1) {
+    return enqueueStripedMemCopy(CommandType, Queue, Dst, BlockingWrite, Size,
+                                 Src, NumChunks, NumEventsInWaitList,
+                                 EventWaitList, OutEvent);
+  }
+
   _ur_ze_event_list_t TmpWaitList;
   UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
       NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
@@ -96,14 +444,28 @@ ur_result_t enqueueMemCopyHelper(ur_command_t CommandType,
   const auto &ZeCommandList = CommandList->first;
   const auto &WaitList = (*Event)->WaitList;
 
-  logger::debug("calling zeCommandListAppendMemoryCopy() with"
-                "  ZeEvent {}",
-                ur_cast<std::uintptr_t>(ZeEvent));
-  printZeEventList(WaitList);
+  // The pattern of a fill is read as it is appended, so a write which fits in
+  // one needs neither the host memory to stay mapped for the device nor a
+  // copy from it
+  if (IsInlineWrite && !UseCopyEngine) {
+    logger::debug("calling zeCommandListAppendMemoryFill() to write {} bytes"
+                  " with ZeEvent {}",
+                  Size, ur_cast<std::uintptr_t>(ZeEvent));
+    printZeEventList(WaitList);
 
-  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-             (ZeCommandList, Dst, Src, Size, ZeEvent, WaitList.Length,
-              WaitList.ZeEventList));
+    ZE2UR_CALL(zeCommandListAppendMemoryFill,
+               (ZeCommandList, Dst, Src, Size, Size, ZeEvent, WaitList.Length,
+                WaitList.ZeEventList));
+  } else {
+    logger::debug("calling zeCommandListAppendMemoryCopy() with"
+                  "  ZeEvent {}",
+                  ur_cast<std::uintptr_t>(ZeEvent));
+    printZeEventList(WaitList);
+
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (ZeCommandList, Dst, Src, Size, ZeEvent, WaitList.Length,
+                WaitList.ZeEventList));
+  }
 
   UR_CALL(Queue->executeCommandList(CommandList, BlockingWrite, OkToBatch));
 
@@ -454,6 +816,61 @@ static ur_result_t enqueueMemImageCommandHelper(
   return UR_RESULT_SUCCESS;
 }
 
+// Blocking reads and writes of buffers in host memory, see _ur_buffer::OnHost,
+// copy on the host once the commands they depend on completed, as map and
+// unmap do, rather than submitting a copy and waiting for it.
+static ur_result_t enqueueHostBufferCopyHelper(
+    ur_command_t CommandType, ur_queue_handle_t Queue, _ur_buffer *Buffer,
+    size_t Offset, size_t Size, void *Dst, const void *Src,
+    uint32_t NumEventsInWaitList, const ur_event_handle_t *EventWaitList,
+    ur_event_handle_t *OutEvent) {
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = OutEvent == nullptr;
+  ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
+  {
+    // Lock automatically releases when this goes out of scope.
+    std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
+
+    bool UseCopyEngine = false;
+    _ur_ze_event_list_t TmpWaitList;
+    UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+        NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+    UR_CALL(createEventAndAssociateQueue(Queue, Event, CommandType,
+                                         Queue->CommandListMap.end(),
+                                         IsInternal, false));
+    (*Event)->WaitList = TmpWaitList;
+  }
+
+  if (NumEventsInWaitList > 0)
+    UR_CALL(ur::level_zero::urEventWait(NumEventsInWaitList, EventWaitList));
+
+  if (Queue->isInOrderQueue())
+    UR_CALL(ur::level_zero::urQueueFinish(Queue));
+
+  {
+    bool IsRead = CommandType == UR_COMMAND_MEM_BUFFER_READ;
+    // Lock automatically releases when this goes out of scope.
+    std::scoped_lock<ur_shared_mutex> Guard(Buffer->Mutex);
+
+    char *ZeHandle;
+    UR_CALL(Buffer->getZeHandle(ZeHandle,
+                                IsRead ? ur_mem_handle_t_::read_only
+                                       : ur_mem_handle_t_::write_only,
+                                Queue->Device, nullptr, 0u));
+    if (IsRead)
+      memcpy(Dst, ZeHandle + Offset, Size);
+    else
+      memcpy(ZeHandle + Offset, Src, Size);
+  }
+
+  // Signal this event if it is not using counter based events
+  if (!(*Event)->CounterBasedEventsEnabled)
+    ZE2UR_CALL(zeEventHostSignal, ((*Event)->ZeEvent));
+  (*Event)->Completed = true;
+  return UR_RESULT_SUCCESS;
+}
+
 namespace ur::level_zero {
 
 ur_result_t urEnqueueMemBufferRead(
@@ -477,6 +894,11 @@ ur_result_t urEnqueueMemBufferRead(
 ) {
   ur_mem_handle_t_ *Src = ur_cast<ur_mem_handle_t_ *>(hBuffer);
 
+  if (blockingRead && ur_cast<_ur_buffer *>(Src)->isOnHost())
+    return enqueueHostBufferCopyHelper(
+        UR_COMMAND_MEM_BUFFER_READ, Queue, ur_cast<_ur_buffer *>(Src), offset,
+        size, pDst, nullptr, numEventsInWaitList, phEventWaitList, phEvent);
+
   std::shared_lock<ur_shared_mutex> SrcLock(Src->Mutex, std::defer_lock);
   std::scoped_lock<std::shared_lock<ur_shared_mutex>, ur_shared_mutex> LockAll(
       SrcLock, Queue->Mutex);
@@ -514,6 +936,12 @@ ur_result_t urEnqueueMemBufferWrite(
 ) {
   ur_mem_handle_t_ *Buffer = ur_cast<ur_mem_handle_t_ *>(hBuffer);
 
+  if (blockingWrite && ur_cast<_ur_buffer *>(Buffer)->isOnHost())
+    return enqueueHostBufferCopyHelper(
+        UR_COMMAND_MEM_BUFFER_WRITE, Queue, ur_cast<_ur_buffer *>(Buffer),
+        offset, size, nullptr, pSrc, numEventsInWaitList, phEventWaitList,
+        phEvent);
+
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Lock(Queue->Mutex,
                                                           Buffer->Mutex);
 
@@ -999,6 +1427,9 @@ ur_result_t urEnqueueMemBufferMap(
     // TODO: Do we even need every map to allocate new host memory?
     //       In the case when the buffer is "OnHost" we use single allocation.
     UR_CALL(ZeHostMemAllocHelper(RetMap, Queue->Context, Size));
+    Queue->Context->MemoryAccounting.onAlloc(
+        UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+        USMAllocSize(Queue->Context, *RetMap, Size));
   }
 
   // Take a shortcut if the host is not going to read buffer's data.
@@ -1214,6 +1645,93 @@ ur_result_t urEnqueueUSMMemcpy(
       NumEventsInWaitList, EventWaitList, OutEvent, PreferCopyEngine);
 }
 
+ur_result_t urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t Queue, ///< [in] handle of the queue object
+    bool Blocking,           ///< [in] blocking or non-blocking copies
+    uint32_t NumCopies,      ///< [in] number of blocks to copy
+    void **Dsts,       ///< [in][range(0, numCopies)] pointers to the
+                       ///< destination USM memory of each block
+    const void **Srcs, ///< [in][range(0, numCopies)] pointers to the source
+                       ///< USM memory of each block
+    const size_t *Sizes, ///< [in][range(0, numCopies)] sizes in bytes of each
+                         ///< block
+    uint32_t NumEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t
+        *EventWaitList, ///< [in][optional][range(0, numEventsInWaitList)]
+                        ///< pointer to a list of events that must be complete
+                        ///< before this command can be executed. If nullptr,
+                        ///< the numEventsInWaitList must be 0, indicating
+                        ///< that this command does not wait on any event to
+                        ///< complete.
+    ur_event_handle_t
+        *OutEvent ///< [in,out][optional] return an event object that identifies
+                  ///< this particular command instance.
+) {
+  // Same engine selection as urEnqueueUSMMemcpy, the copy engine being
+  // preferred as soon as one of the blocks involves host memory. Each pointer
+  // is queried once, outside of the lock of the queue, and only until the
+  // engine is known.
+  const bool IsDG2 = Queue->Device->isDG2();
+  bool PreferCopyEngine = false;
+  bool AnyShared = false;
+  for (uint32_t I = 0; I < 2 * NumCopies; ++I) {
+    const void *Ptr = I % 2 ? Dsts[I / 2] : Srcs[I / 2];
+    ze_memory_type_t Type = GetMemoryType(Queue->Context, Ptr);
+    PreferCopyEngine |= Type != ZE_MEMORY_TYPE_DEVICE;
+    AnyShared |= Type == ZE_MEMORY_TYPE_SHARED;
+    if (IsDG2 ? AnyShared : PreferCopyEngine) {
+      break;
+    }
+  }
+  if (IsDG2 && AnyShared) {
+    PreferCopyEngine = false;
+  }
+  PreferCopyEngine |= UseCopyEngineForD2DCopy;
+
+  std::scoped_lock<ur_shared_mutex> lock(Queue->Mutex);
+
+  bool UseCopyEngine = Queue->useCopyEngine(PreferCopyEngine);
+
+  _ur_ze_event_list_t TmpWaitList;
+  UR_CALL(TmpWaitList.createAndRetainUrZeEventList(
+      NumEventsInWaitList, EventWaitList, Queue, UseCopyEngine));
+
+  bool OkToBatch = true;
+
+  ur_command_list_ptr_t CommandList{};
+  UR_CALL(Queue->Context->getAvailableCommandList(
+      Queue, CommandList, UseCopyEngine, NumEventsInWaitList, EventWaitList,
+      OkToBatch, nullptr /*ForcedCmdQueue*/));
+
+  ze_event_handle_t ZeEvent = nullptr;
+  ur_event_handle_t InternalEvent;
+  bool IsInternal = OutEvent == nullptr;
+  ur_event_handle_t *Event = OutEvent ? OutEvent : &InternalEvent;
+  UR_CALL(createEventAndAssociateQueue(Queue, Event,
+                                       UR_COMMAND_USM_MEMCPY_BATCH_EXP,
+                                       CommandList, IsInternal, false));
+  UR_CALL(setSignalEvent(Queue, UseCopyEngine, &ZeEvent, Event,
+                         NumEventsInWaitList, EventWaitList,
+                         CommandList->second.ZeQueue));
+  (*Event)->WaitList = TmpWaitList;
+
+  const auto &ZeCommandList = CommandList->first;
+  const auto &WaitList = (*Event)->WaitList;
+
+  // The copies run concurrently, and the barrier after them signals the
+  // single event of the batch once they all completed
+  for (uint32_t I = 0; I < NumCopies; ++I) {
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (ZeCommandList, Dsts[I], Srcs[I], Sizes[I], nullptr,
+                WaitList.Length, WaitList.ZeEventList));
+  }
+  ZE2UR_CALL(zeCommandListAppendBarrier, (ZeCommandList, ZeEvent, 0, nullptr));
+
+  UR_CALL(Queue->executeCommandList(CommandList, Blocking, OkToBatch));
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urEnqueueUSMPrefetch(
     ur_queue_handle_t Queue,        ///< [in] handle of the queue object
     const void *Mem,                ///< [in] pointer to the USM memory object
@@ -1538,6 +2056,10 @@ ur_result_t urMemImageCreate(
 
   UR_CALL(createUrMemFromZeImage(Context, ZeImage, /*OwnZeMemHandle*/ true,
                                  ZeImageDesc, Mem));
+  auto Image = static_cast<_ur_image *>(*Mem);
+  Image->AccountedSize = getImageAllocSize(ImageFormat, ImageDesc);
+  Context->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE,
+                                    Image->AccountedSize);
 
   if ((Flags & UR_MEM_FLAG_USE_HOST_POINTER) != 0 ||
       (Flags & UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER) != 0) {
@@ -1606,9 +2128,7 @@ ur_result_t urMemBufferCreate(
 
   bool HostPtrImported = false;
   if (Flags & UR_MEM_FLAG_USE_HOST_POINTER)
-    HostPtrImported =
-        maybeImportUSM(Context->getPlatform()->ZeDriverHandleExpTranslated,
-                       Context->ZeContext, Host, Size);
+    HostPtrImported = Context->importHostPtr(Host, Size);
 
   _ur_buffer *Buffer = nullptr;
   auto HostPtrOrNull = (Flags & UR_MEM_FLAG_USE_HOST_POINTER)
@@ -1616,6 +2136,7 @@ ur_result_t urMemBufferCreate(
                            : nullptr;
   try {
     Buffer = new _ur_buffer(Context, Size, HostPtrOrNull, HostPtrImported);
+    Buffer->ReadOnly = Flags & UR_MEM_FLAG_READ_ONLY;
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -1681,10 +2202,18 @@ ur_result_t urMemRelease(
       // Gracefully handle the case that L0 was already unloaded.
       if (ZeResult && ZeResult != ZE_RESULT_ERROR_UNINITIALIZED)
         return ze2urResult(ZeResult);
+      Image->UrContext->MemoryAccounting.onFree(
+          UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE, Image->AccountedSize);
     }
   } else {
     auto Buffer = reinterpret_cast<_ur_buffer *>(Mem);
     Buffer->free();
+    // Release the reference the sub-buffer holds on its parent.
+    if (Buffer->SubBuffer) {
+      ur_mem_handle_t Parent = Buffer->SubBuffer->Parent;
+      delete Mem;
+      return ur::level_zero::urMemRelease(Parent);
+    }
   }
   delete Mem;
 
@@ -1705,9 +2234,13 @@ ur_result_t urMemBufferPartition(
   UR_ASSERT(Buffer && !Buffer->isImage() &&
                 !(static_cast<_ur_buffer *>(Buffer))->isSubBuffer(),
             UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+  UR_ASSERT(BufferCreateInfo->origin + BufferCreateInfo->size <=
+                static_cast<_ur_buffer *>(Buffer)->Size,
+            UR_RESULT_ERROR_INVALID_BUFFER_SIZE);
 
-  std::shared_lock<ur_shared_mutex> Guard(Buffer->Mutex);
-
+  // The sub-buffer only reads the context and size of the parent, which don't
+  // change, and resolves its allocations from the parent's on use, so the
+  // parent isn't locked.
   if (Flags != UR_MEM_FLAG_READ_WRITE) {
     die("urMemBufferPartition: Level-Zero implements only read-write buffer,"
         "no read-only or write-only yet.");
@@ -2073,10 +2606,15 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
         UR_CALL(ur::level_zero::urUSMHostAlloc(
             UrContext, &USMDesc, Pool, Size,
             reinterpret_cast<void **>(&ZeHandle)));
+        UrContext->MemoryAccounting.reclassify(
+            UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+            UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Size);
       } else {
         HostAllocation.ReleaseAction = allocation_t::free_native;
         UR_CALL(ZeHostMemAllocHelper(reinterpret_cast<void **>(&ZeHandle),
                                      UrContext, Size));
+        UrContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                            Size);
       }
       HostAllocation.ZeHandle = ZeHandle;
       HostAllocation.Valid = true;
@@ -2134,10 +2672,15 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
         UR_CALL(ur::level_zero::urUSMDeviceAlloc(
             UrContext, Device, &USMDesc, Pool, Size,
             reinterpret_cast<void **>(&ZeHandle)));
+        UrContext->MemoryAccounting.reclassify(
+            UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+            UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Size);
       } else {
         Allocation.ReleaseAction = allocation_t::free_native;
         UR_CALL(ZeDeviceMemAllocHelper(reinterpret_cast<void **>(&ZeHandle),
                                        UrContext, Device, Size));
+        UrContext->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                            Size);
       }
     }
     Allocation.ZeHandle = ZeHandle;
@@ -2160,11 +2703,29 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
     if (NeedCopy && !LastDeviceWithValidAllocation) {
       NeedCopy = false;
     }
+    // Read-only accesses leave the other allocations valid, so there may be
+    // several to copy from. Prefer one that the device can access directly,
+    // so that the copy doesn't go through the host.
+    ur_device_handle_t SrcDevice = LastDeviceWithValidAllocation;
+    bool P2P = false;
+    if (NeedCopy) {
+      UR_CALL(UrContext->canAccessPeer(Device, SrcDevice, P2P));
+      for (auto It = Allocations.begin(); !P2P && It != Allocations.end();
+           ++It) {
+        if (!It->first || It->first == Device || !It->second.Valid) {
+          continue;
+        }
+        UR_CALL(UrContext->canAccessPeer(Device, It->first, P2P));
+        if (P2P) {
+          SrcDevice = It->first;
+        }
+      }
+    }
+
     char *ZeHandleSrc = nullptr;
     if (NeedCopy) {
-      UR_CALL(getZeHandle(ZeHandleSrc, ur_mem_handle_t_::read_only,
-                          LastDeviceWithValidAllocation, phWaitEvents,
-                          numWaitEvents));
+      UR_CALL(getZeHandle(ZeHandleSrc, ur_mem_handle_t_::read_only, SrcDevice,
+                          phWaitEvents, numWaitEvents));
       // It's possible with the single root-device contexts that
       // the buffer is represented by the single root-device
       // allocation and then skip the copy to itself.
@@ -2175,10 +2736,7 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
     if (NeedCopy) {
       // Wait on all dependency events passed in to ensure that the memory which
       // is being init is updated correctly.
-      _ur_ze_event_list_t waitlist;
-      waitlist.ZeEventList = nullptr;
-      waitlist.Length = 0;
-      uint32_t EventListIndex = 0;
+      std::vector<ze_event_handle_t> WaitList;
       for (unsigned i = 0; i < numWaitEvents; ++i) {
         if (phWaitEvents[i]->HostVisibleEvent) {
           ZE2UR_CALL(zeEventHostSynchronize,
@@ -2186,76 +2744,78 @@ ur_result_t _ur_buffer::getZeHandle(char *&ZeHandle, access_mode_t AccessMode,
         } else {
           // Generate the waitlist for the Copy calls based on the passed in
           // dependencies, if they exist for device only.
-          if (waitlist.ZeEventList == nullptr) {
-            waitlist.ZeEventList = new ze_event_handle_t[numWaitEvents];
-          }
-          waitlist.ZeEventList[EventListIndex] = phWaitEvents[i]->ZeEvent;
-          waitlist.Length++;
-          EventListIndex++;
+          WaitList.push_back(phWaitEvents[i]->ZeEvent);
         }
       }
-      if (waitlist.Length > 0) {
-        ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
-                   (UrContext->ZeCommandListInit, waitlist.Length,
-                    waitlist.ZeEventList));
+
+      // P2P copy is not possible, so copy through the host.
+      allocation_t *HostAllocationPtr = P2P ? nullptr : &Allocations[nullptr];
+      // The host allocation may already exists, e.g. with imported
+      // host ptr, or in case of interop buffer.
+      if (HostAllocationPtr && !HostAllocationPtr->ZeHandle) {
+        auto &HostAllocation = *HostAllocationPtr;
+        void *ZeHandleHost;
+        if (DisjointPoolConfigInstance.EnableBuffers) {
+          HostAllocation.ReleaseAction = allocation_t::free;
+          ur_usm_desc_t USMDesc{};
+          USMDesc.align = getAlignment();
+          ur_usm_pool_handle_t Pool{};
+          UR_CALL(ur::level_zero::urUSMHostAlloc(UrContext, &USMDesc, Pool,
+                                                 Size, &ZeHandleHost));
+          UrContext->MemoryAccounting.reclassify(
+              UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+              UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Size);
+        } else {
+          HostAllocation.ReleaseAction = allocation_t::free_native;
+          UR_CALL(ZeHostMemAllocHelper(&ZeHandleHost, UrContext, Size));
+          UrContext->MemoryAccounting.onAlloc(
+              UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Size);
+        }
+        HostAllocation.ZeHandle = reinterpret_cast<char *>(ZeHandleHost);
+        HostAllocation.Valid = false;
       }
 
-      // Copy valid buffer data to this allocation.
-      // TODO: see if we should better use peer's device allocation used
-      // directly, if that capability is reported with zeDeviceCanAccessPeer,
-      // instead of maintaining a separate allocation and performing
-      // explciit copies.
+      // Copy valid buffer data to this allocation, on the copy engine of the
+      // device, which pulls the data from its peer or from the host. A copy
+      // to the host is done by the device it is copied from.
       //
       // zeCommandListAppendMemoryCopy must not be called from simultaneous
       // threads with the same command list handle, so we need exclusive lock.
-      ze_bool_t P2P = false;
-      ZE2UR_CALL(
-          zeDeviceCanAccessPeer,
-          (Device->ZeDevice, LastDeviceWithValidAllocation->ZeDevice, &P2P));
-      if (!P2P) {
-        // P2P copy is not possible, so copy through the host.
-        auto &HostAllocation = Allocations[nullptr];
-        // The host allocation may already exists, e.g. with imported
-        // host ptr, or in case of interop buffer.
-        if (!HostAllocation.ZeHandle) {
-          void *ZeHandleHost;
-          if (DisjointPoolConfigInstance.EnableBuffers) {
-            HostAllocation.ReleaseAction = allocation_t::free;
-            ur_usm_desc_t USMDesc{};
-            USMDesc.align = getAlignment();
-            ur_usm_pool_handle_t Pool{};
-            UR_CALL(ur::level_zero::urUSMHostAlloc(UrContext, &USMDesc, Pool,
-                                                   Size, &ZeHandleHost));
-          } else {
-            HostAllocation.ReleaseAction = allocation_t::free_native;
-            UR_CALL(ZeHostMemAllocHelper(&ZeHandleHost, UrContext, Size));
-          }
-          HostAllocation.ZeHandle = reinterpret_cast<char *>(ZeHandleHost);
-          HostAllocation.Valid = false;
-        }
-        std::scoped_lock<ur_mutex> Lock(UrContext->ImmediateCommandListMutex);
-        if (!HostAllocation.Valid) {
+      std::scoped_lock<ur_mutex> Lock(UrContext->ImmediateCommandListMutex);
+      ze_command_list_handle_t ZeCommandList = nullptr;
+      UR_CALL(UrContext->getMigrationCommandList(Device, ZeCommandList));
+      ze_command_list_handle_t ZeSrcCommandList = ZeCommandList;
+      bool NeedHostCopy = HostAllocationPtr && !HostAllocationPtr->Valid;
+      if (NeedHostCopy) {
+        UR_CALL(
+            UrContext->getMigrationCommandList(SrcDevice, ZeSrcCommandList));
+      }
+
+      if (!WaitList.empty()) {
+        ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
+                   (ZeSrcCommandList, static_cast<uint32_t>(WaitList.size()),
+                    WaitList.data()));
+      }
+      if (P2P) {
+        ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+                   (ZeCommandList, ZeHandle, ZeHandleSrc, Size, nullptr, 0u,
+                    nullptr));
+      } else {
+        auto &HostAllocation = *HostAllocationPtr;
+        if (NeedHostCopy) {
           ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-                     (UrContext->ZeCommandListInit, HostAllocation.ZeHandle,
-                      ZeHandleSrc, Size, nullptr, 0u, nullptr));
+                     (ZeSrcCommandList, HostAllocation.ZeHandle, ZeHandleSrc,
+                      Size, nullptr, 0u, nullptr));
           // Mark the host allocation data  as valid so it can be reused.
           // It will be invalidated below if the current access is not
           // read-only.
           HostAllocation.Valid = true;
         }
+        // The copies of synchronous command lists are done on return
         ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-                   (UrContext->ZeCommandListInit, ZeHandle,
-                    HostAllocation.ZeHandle, Size, nullptr, 0u, nullptr));
-      } else {
-        // Perform P2P copy.
-        std::scoped_lock<ur_mutex> Lock(UrContext->ImmediateCommandListMutex);
-        ZE2UR_CALL(zeCommandListAppendMemoryCopy,
-                   (UrContext->ZeCommandListInit, ZeHandle, ZeHandleSrc, Size,
+                   (ZeCommandList, ZeHandle, HostAllocation.ZeHandle, Size,
                     nullptr, 0u, nullptr));
       }
-      if (waitlist.ZeEventList) {
-        delete waitlist.ZeEventList;
-      }
     }
     Allocation.Valid = true;
     LastDeviceWithValidAllocation = Device;
@@ -2303,16 +2863,23 @@ ur_result_t _ur_buffer::free() {
                    (UrContext->ZeCommandListInit, DeviceMappedHostNativePtr,
                     ZeHandle, Size, nullptr, 0, nullptr));
       }
+      // The pool gets the memory back as the USM it was allocated as
+      UrContext->MemoryAccounting.reclassify(
+          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+          Alloc.first ? UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE
+                      : UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+          Size);
       UR_CALL(USMFreeHelper(reinterpret_cast<ur_context_handle_t>(UrContext),
                             ZeHandle));
       break;
     }
     case allocation_t::free_native:
       UR_CALL(ZeMemFreeHelper(UrContext, ZeHandle));
+      UrContext->MemoryAccounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                         Size);
       break;
     case allocation_t::unimport:
-      ZeUSMImport.doZeUSMRelease(
-          UrContext->getPlatform()->ZeDriverHandleExpTranslated, ZeHandle);
+      UrContext->releaseHostPtr(ZeHandle);
       break;
     default:
       die("_ur_buffer::free(): Unhandled release action");
@@ -2333,9 +2900,7 @@ _ur_buffer::_ur_buffer(ur_context_handle_t Context, size_t Size, char *HostPtr,
   // For integrated devices, allocating the buffer in the host memory
   // enables automatic access from the device, and makes copying
   // unnecessary in the map/unmap operations. This improves performance.
-  OnHost = Context->Devices.size() == 1 &&
-           Context->Devices[0]->ZeDeviceProperties->flags &
-               ZE_DEVICE_PROPERTY_FLAG_INTEGRATED;
+  OnHost = Context->isIntegrated();
 
   // Fill the host allocation data.
   if (HostPtr) {
@@ -2368,13 +2933,15 @@ _ur_buffer::_ur_buffer(ur_context_handle_t Context, size_t Size,
   Allocations[Device].Valid = true;
   Allocations[Device].ReleaseAction =
       OwnZeMemHandle ? allocation_t::free_native : allocation_t::keep;
+  // The context frees the memory it owns, which counts as its buffers
+  if (OwnZeMemHandle) {
+    Context->MemoryAccounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, Size);
+  }
 
   // Check if this buffer can always stay on host
   OnHost = false;
   if (!Device) { // Host allocation
-    if (Context->Devices.size() == 1 &&
-        Context->Devices[0]->ZeDeviceProperties->flags &
-            ZE_DEVICE_PROPERTY_FLAG_INTEGRATED) {
+    if (Context->isIntegrated()) {
       OnHost = true;
       MapHostPtr = ZeMemHandle; // map to this allocation
     }
@@ -168,6 +168,17 @@ struct _ur_buffer final : ur_mem_handle_t_ {
   // Flag to indicate that this memory is allocated in host memory.
   // Integrated device accesses this memory.
   bool OnHost{false};
+  bool isOnHost() const {
+    return SubBuffer ? SubBuffer->Parent->OnHost : OnHost;
+  }
+
+  // Set for buffers created with UR_MEM_FLAG_READ_ONLY, which kernels don't
+  // write to. Their allocations on each device, once valid, are only
+  // invalidated by writes from the host.
+  bool ReadOnly{false};
+  bool isReadOnly() const {
+    return SubBuffer ? SubBuffer->Parent->ReadOnly : ReadOnly;
+  }
 
   // Tells the host allocation to use for buffer map operations.
   char *MapHostPtr{nullptr};
@@ -235,6 +246,10 @@ struct _ur_image final : ur_mem_handle_t_ {
   // Keep the descriptor of the image
   ZeStruct<ze_image_desc_t> ZeImageDesc;
 
+  // Bytes the image counts for in the memory accounting of the context, 0
+  // for the images it didn't allocate
+  size_t AccountedSize = 0;
+
   // Level Zero image handle.
   ze_image_handle_t ZeImage;
 };
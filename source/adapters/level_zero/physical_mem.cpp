@@ -14,21 +14,45 @@
 #include "device.hpp"
 #include "ur_level_zero.hpp"
 
+namespace {
+ur_result_t destroyChunks(
+    ur_context_handle_t Context,
+    const std::vector<std::pair<ur_device_handle_t, ze_physical_mem_handle_t>>
+        &Chunks) {
+  for (auto &Chunk : Chunks)
+    ZE2UR_CALL(zePhysicalMemDestroy, (Context->ZeContext, Chunk.second));
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
 namespace ur::level_zero {
 
 ur_result_t urPhysicalMemCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice, size_t size,
     [[maybe_unused]] const ur_physical_mem_properties_t *pProperties,
     ur_physical_mem_handle_t *phPhysicalMem) {
-  ZeStruct<ze_physical_mem_desc_t> PhysicalMemDesc;
-  PhysicalMemDesc.flags = 0;
-  PhysicalMemDesc.size = size;
-
   ze_physical_mem_handle_t ZePhysicalMem;
-  ZE2UR_CALL(zePhysicalMemCreate, (hContext->ZeContext, hDevice->ZeDevice,
-                                   &PhysicalMemDesc, &ZePhysicalMem));
+  if (!hContext->PhysicalMemPool.take(hDevice, size, ZePhysicalMem)) {
+    ZeStruct<ze_physical_mem_desc_t> PhysicalMemDesc;
+    PhysicalMemDesc.flags = 0;
+    PhysicalMemDesc.size = size;
+
+    auto ZeResult = ZE_CALL_NOCHECK(
+        zePhysicalMemCreate, (hContext->ZeContext, hDevice->ZeDevice,
+                              &PhysicalMemDesc, &ZePhysicalMem));
+    if (ZeResult == ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY) {
+      // The device may only be short of the memory kept for reuse
+      destroyChunks(hContext, hContext->PhysicalMemPool.trim(0));
+      ZeResult = ZE_CALL_NOCHECK(
+          zePhysicalMemCreate, (hContext->ZeContext, hDevice->ZeDevice,
+                                &PhysicalMemDesc, &ZePhysicalMem));
+    }
+    if (ZeResult)
+      return ze2urResult(ZeResult);
+  }
   try {
-    *phPhysicalMem = new ur_physical_mem_handle_t_(ZePhysicalMem, hContext);
+    *phPhysicalMem =
+        new ur_physical_mem_handle_t_(ZePhysicalMem, hContext, hDevice, size);
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
   } catch (...) {
@@ -46,10 +70,11 @@ ur_result_t urPhysicalMemRelease(ur_physical_mem_handle_t hPhysicalMem) {
   if (!hPhysicalMem->RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
-  ZE2UR_CALL(zePhysicalMemDestroy,
-             (hPhysicalMem->Context->ZeContext, hPhysicalMem->ZePhysicalMem));
+  auto Context = hPhysicalMem->Context;
+  auto Evicted = Context->PhysicalMemPool.put(
+      hPhysicalMem->Device, hPhysicalMem->Size, hPhysicalMem->ZePhysicalMem);
   delete hPhysicalMem;
 
-  return UR_RESULT_SUCCESS;
+  return destroyChunks(Context, Evicted);
 }
 } // namespace ur::level_zero
@@ -13,12 +13,19 @@
 
 struct ur_physical_mem_handle_t_ : _ur_object {
   ur_physical_mem_handle_t_(ze_physical_mem_handle_t ZePhysicalMem,
-                            ur_context_handle_t Context)
-      : ZePhysicalMem{ZePhysicalMem}, Context{Context} {}
+                            ur_context_handle_t Context,
+                            ur_device_handle_t Device, size_t Size)
+      : ZePhysicalMem{ZePhysicalMem}, Context{Context}, Device{Device},
+        Size{Size} {}
 
   // Level Zero physical memory handle.
   ze_physical_mem_handle_t ZePhysicalMem;
 
   // Keeps the PI context of this memory handle.
   ur_context_handle_t Context;
+
+  // The device and size the memory was created for, to be kept for reuse
+  // by them once released.
+  ur_device_handle_t Device;
+  size_t Size;
 };
@@ -10,6 +10,7 @@
 
 #include "platform.hpp"
 #include "adapter.hpp"
+#include "latency_tracker.hpp"
 #include "ur_level_zero.hpp"
 
 namespace ur::level_zero {
@@ -202,6 +203,7 @@ ur_result_t urPlatformGetBackendOption(
 } // namespace ur::level_zero
 
 ur_result_t ur_platform_handle_t_::initialize() {
+  TRACK_SCOPE_LATENCY("ur_platform_handle_t_::initialize");
   ZE2UR_CALL(zeDriverGetApiVersion, (ZeDriver, &ZeApiVersion));
   ZeDriverApiVersion = std::to_string(ZE_MAJOR_VERSION(ZeApiVersion)) + "." +
                        std::to_string(ZE_MINOR_VERSION(ZeApiVersion));
@@ -239,6 +241,11 @@ ur_result_t ur_platform_handle_t_::initialize() {
         ZeDriverEventPoolCountingEventsExtensionFound = true;
       }
     }
+    // Check if regular command lists can be appended to immediate ones.
+    if (strncmp(extension.name, ZE_IMMEDIATE_COMMAND_LIST_APPEND_EXP_NAME,
+                strlen(ZE_IMMEDIATE_COMMAND_LIST_APPEND_EXP_NAME) + 1) == 0) {
+      ZeDriverImmediateCommandListAppendFound = true;
+    }
     zeDriverExtensionMap[extension.name] = extension.version;
   }
 
@@ -398,6 +405,118 @@ ur_platform_handle_t_::getDeviceFromNativeHandle(ze_device_handle_t ZeDevice) {
   return nullptr;
 }
 
+namespace {
+// The devices created for a root device returned by zeDeviceGet
+struct RootDeviceSetup {
+  std::unique_ptr<ur_device_handle_t_> Device;
+  // Its sub-devices, each after its own sub-sub-devices
+  std::vector<std::unique_ptr<ur_device_handle_t_>> SubDevices;
+  // The card device of the root device, if it is a tile
+  ze_device_handle_t ZeCardDevice = nullptr;
+  ur_result_t Result = UR_RESULT_SUCCESS;
+};
+} // namespace
+
+// Creates and initializes the root device ZeDevice of Platform, its
+// sub-devices and sub-sub-devices, and finds its card device.
+static ur_result_t setupRootDevice(ur_platform_handle_t Platform,
+                                   ze_device_handle_t ZeDevice,
+                                   RootDeviceSetup &Setup) {
+  Setup.Device.reset(new ur_device_handle_t_(ZeDevice, Platform));
+  auto &Device = Setup.Device;
+  UR_CALL(Device->initialize());
+
+  // Additionally we need to cache all sub-devices too, such that they
+  // are readily visible to the urDeviceCreateWithNativeHandle.
+  //
+  uint32_t SubDevicesCount = 0;
+  ZE2UR_CALL(zeDeviceGetSubDevices,
+             (Device->ZeDevice, &SubDevicesCount, nullptr));
+
+  std::vector<ze_device_handle_t> ZeSubdevices(SubDevicesCount);
+  ZE2UR_CALL(zeDeviceGetSubDevices,
+             (Device->ZeDevice, &SubDevicesCount, ZeSubdevices.data()));
+
+  // Wrap the Level Zero sub-devices into PI sub-devices, and add them to
+  // cache.
+  for (uint32_t I = 0; I < SubDevicesCount; ++I) {
+    std::unique_ptr<ur_device_handle_t_> UrSubDevice(
+        new ur_device_handle_t_(ZeSubdevices[I], Platform, Device.get()));
+    UR_CALL(UrSubDevice->initialize());
+
+    // collect all the ordinals for the sub-sub-devices
+    std::vector<int> Ordinals;
+
+    uint32_t numQueueGroups = 0;
+    ZE2UR_CALL(zeDeviceGetCommandQueueGroupProperties,
+               (UrSubDevice->ZeDevice, &numQueueGroups, nullptr));
+    if (numQueueGroups == 0) {
+      return UR_RESULT_ERROR_UNKNOWN;
+    }
+    std::vector<ZeStruct<ze_command_queue_group_properties_t>>
+        QueueGroupProperties(numQueueGroups);
+    ZE2UR_CALL(zeDeviceGetCommandQueueGroupProperties,
+               (UrSubDevice->ZeDevice, &numQueueGroups,
+                QueueGroupProperties.data()));
+
+    for (uint32_t i = 0; i < numQueueGroups; i++) {
+      if (QueueGroupProperties[i].flags &
+              ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE &&
+          QueueGroupProperties[i].numQueues > 1) {
+        Ordinals.push_back(i);
+      }
+    }
+
+    // If isn't PVC, then submissions to different CCS can be executed on
+    // the same EUs still, so we cannot treat them as sub-sub-devices.
+    if (UrSubDevice->isPVC() || ExposeCSliceInAffinityPartitioning) {
+      // Create PI sub-sub-devices with the sub-device for all the ordinals.
+      // Each {ordinal, index} points to a specific CCS which constructs
+      // a sub-sub-device at this point.
+      //
+      // FIXME: Level Zero creates multiple UrDevices for a single physical
+      // device when sub-device is partitioned into sub-sub-devices.
+      // Sub-sub-device is technically a command queue and we should not
+      // build program for each command queue. UrDevice is probably not the
+      // right abstraction for a Level Zero command queue.
+      for (uint32_t J = 0; J < Ordinals.size(); ++J) {
+        for (uint32_t K = 0; K < QueueGroupProperties[Ordinals[J]].numQueues;
+             ++K) {
+          std::unique_ptr<ur_device_handle_t_> URSubSubDevice(
+              new ur_device_handle_t_(ZeSubdevices[I], Platform,
+                                      UrSubDevice.get()));
+          UR_CALL(URSubSubDevice->initialize(Ordinals[J], K));
+
+          // save pointers to sub-sub-devices for quick retrieval in the
+          // future.
+          UrSubDevice->SubDevices.push_back(URSubSubDevice.get());
+          Setup.SubDevices.push_back(std::move(URSubSubDevice));
+        }
+      }
+    }
+
+    // save pointers to sub-devices for quick retrieval in the future.
+    Device->SubDevices.push_back(UrSubDevice.get());
+    Setup.SubDevices.push_back(std::move(UrSubDevice));
+  }
+
+  // When using ZE_FLAT_DEVICE_HIERARCHY=COMBINED, zeDeviceGet will
+  // return tiles as devices, but we can get the card device handle
+  // through zeDeviceGetRootDevice. We need to cache the card device
+  // handle too, such that it is readily visible to the
+  // urDeviceCreateWithNativeHandle.
+  // We cannot use ZE2UR_CALL because under some circumstances this call may
+  // return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, and ZE2UR_CALL will abort
+  // because it's not UR_RESULT_SUCCESS. Instead, we use ZE_CALL_NOCHECK and
+  // we check manually that the result is either ZE_RESULT_SUCCESS or
+  // ZE_RESULT_ERROR_UNSUPPORTED_FEATURE.
+  auto errc = ZE_CALL_NOCHECK(zeDeviceGetRootDevice,
+                              (Device->ZeDevice, &Setup.ZeCardDevice));
+  if (errc != ZE_RESULT_SUCCESS && errc != ZE_RESULT_ERROR_UNSUPPORTED_FEATURE)
+    return ze2urResult(errc);
+  return UR_RESULT_SUCCESS;
+}
+
 // Check the device cache and load it if necessary.
 ur_result_t ur_platform_handle_t_::populateDeviceCacheIfNeeded() {
   std::scoped_lock<ur_shared_mutex> Lock(URDevicesCacheMutex);
@@ -405,6 +524,7 @@ ur_result_t ur_platform_handle_t_::populateDeviceCacheIfNeeded() {
   if (DeviceCachePopulated) {
     return UR_RESULT_SUCCESS;
   }
+  TRACK_SCOPE_LATENCY("ur_platform_handle_t_::populateDeviceCacheIfNeeded");
 
   uint32_t ZeDeviceCount = 0;
   ZE2UR_CALL(zeDeviceGet, (ZeDriver, &ZeDeviceCount, nullptr));
@@ -413,123 +533,59 @@ ur_result_t ur_platform_handle_t_::populateDeviceCacheIfNeeded() {
     std::vector<ze_device_handle_t> ZeDevices(ZeDeviceCount);
     ZE2UR_CALL(zeDeviceGet, (ZeDriver, &ZeDeviceCount, ZeDevices.data()));
 
-    for (uint32_t I = 0; I < ZeDeviceCount; ++I) {
-      std::unique_ptr<ur_device_handle_t_> Device(
-          new ur_device_handle_t_(ZeDevices[I], (ur_platform_handle_t)this));
-      UR_CALL(Device->initialize());
-
-      // Additionally we need to cache all sub-devices too, such that they
-      // are readily visible to the urDeviceCreateWithNativeHandle.
-      //
-      uint32_t SubDevicesCount = 0;
-      ZE2UR_CALL(zeDeviceGetSubDevices,
-                 (Device->ZeDevice, &SubDevicesCount, nullptr));
-
-      auto ZeSubdevices = new ze_device_handle_t[SubDevicesCount];
-      ZE2UR_CALL(zeDeviceGetSubDevices,
-                 (Device->ZeDevice, &SubDevicesCount, ZeSubdevices));
-
-      // Wrap the Level Zero sub-devices into PI sub-devices, and add them to
-      // cache.
-      for (uint32_t I = 0; I < SubDevicesCount; ++I) {
-        std::unique_ptr<ur_device_handle_t_> UrSubDevice(
-            new ur_device_handle_t_(ZeSubdevices[I], (ur_platform_handle_t)this,
-                                    Device.get()));
-        auto Result = UrSubDevice->initialize();
-        if (Result != UR_RESULT_SUCCESS) {
-          delete[] ZeSubdevices;
-          return Result;
-        }
-
-        // collect all the ordinals for the sub-sub-devices
-        std::vector<int> Ordinals;
-
-        uint32_t numQueueGroups = 0;
-        ZE2UR_CALL(zeDeviceGetCommandQueueGroupProperties,
-                   (UrSubDevice->ZeDevice, &numQueueGroups, nullptr));
-        if (numQueueGroups == 0) {
-          return UR_RESULT_ERROR_UNKNOWN;
-        }
-        std::vector<ZeStruct<ze_command_queue_group_properties_t>>
-            QueueGroupProperties(numQueueGroups);
-        ZE2UR_CALL(zeDeviceGetCommandQueueGroupProperties,
-                   (UrSubDevice->ZeDevice, &numQueueGroups,
-                    QueueGroupProperties.data()));
-
-        for (uint32_t i = 0; i < numQueueGroups; i++) {
-          if (QueueGroupProperties[i].flags &
-                  ZE_COMMAND_QUEUE_GROUP_PROPERTY_FLAG_COMPUTE &&
-              QueueGroupProperties[i].numQueues > 1) {
-            Ordinals.push_back(i);
-          }
-        }
-
-        // If isn't PVC, then submissions to different CCS can be executed on
-        // the same EUs still, so we cannot treat them as sub-sub-devices.
-        if (UrSubDevice->isPVC() || ExposeCSliceInAffinityPartitioning) {
-          // Create PI sub-sub-devices with the sub-device for all the ordinals.
-          // Each {ordinal, index} points to a specific CCS which constructs
-          // a sub-sub-device at this point.
-          //
-          // FIXME: Level Zero creates multiple UrDevices for a single physical
-          // device when sub-device is partitioned into sub-sub-devices.
-          // Sub-sub-device is technically a command queue and we should not
-          // build program for each command queue. UrDevice is probably not the
-          // right abstraction for a Level Zero command queue.
-          for (uint32_t J = 0; J < Ordinals.size(); ++J) {
-            for (uint32_t K = 0;
-                 K < QueueGroupProperties[Ordinals[J]].numQueues; ++K) {
-              std::unique_ptr<ur_device_handle_t_> URSubSubDevice(
-                  new ur_device_handle_t_(ZeSubdevices[I],
-                                          (ur_platform_handle_t)this,
-                                          UrSubDevice.get()));
-              UR_CALL(URSubSubDevice->initialize(Ordinals[J], K));
-
-              // save pointers to sub-sub-devices for quick retrieval in the
-              // future.
-              UrSubDevice->SubDevices.push_back(URSubSubDevice.get());
-              URDevicesCache.push_back(std::move(URSubSubDevice));
-            }
-          }
-        }
-
-        // save pointers to sub-devices for quick retrieval in the future.
-        Device->SubDevices.push_back(UrSubDevice.get());
-        URDevicesCache.push_back(std::move(UrSubDevice));
+    // The root devices are independent of each other, so they are set up
+    // concurrently, one thread each, and then cached in the order of
+    // zeDeviceGet.
+    std::vector<RootDeviceSetup> Setups(ZeDeviceCount);
+    forEachConcurrently(ZeDeviceCount, ZeDeviceCount, [&](uint32_t I) {
+      try {
+        Setups[I].Result = setupRootDevice(this, ZeDevices[I], Setups[I]);
+      } catch (...) {
+        Setups[I].Result = exceptionToResult(std::current_exception());
       }
-      delete[] ZeSubdevices;
-
-      // When using ZE_FLAT_DEVICE_HIERARCHY=COMBINED, zeDeviceGet will
-      // return tiles as devices, but we can get the card device handle
-      // through zeDeviceGetRootDevice. We need to cache the card device
-      // handle too, such that it is readily visible to the
-      // urDeviceCreateWithNativeHandle.
-      ze_device_handle_t RootDevice = nullptr;
-      // We cannot use ZE2UR_CALL because under some circumstances this call may
-      // return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, and ZE2UR_CALL will abort
-      // because it's not UR_RESULT_SUCCESS. Instead, we use ZE_CALL_NOCHECK and
-      // we check manually that the result is either ZE_RESULT_SUCCESS or
-      // ZE_RESULT_ERROR_UNSUPPORTED_FEATURE.
-      auto errc = ZE_CALL_NOCHECK(zeDeviceGetRootDevice,
-                                  (Device->ZeDevice, &RootDevice));
-      if (errc != ZE_RESULT_SUCCESS &&
-          errc != ZE_RESULT_ERROR_UNSUPPORTED_FEATURE)
-        return ze2urResult(errc);
-
-      if (RootDevice) {
-        if (std::find_if(URDevicesCache.begin(), URDevicesCache.end(),
-                         [&](auto &Dev) {
-                           return Dev->ZeDevice == RootDevice;
-                         }) == URDevicesCache.end()) {
-          std::unique_ptr<ur_device_handle_t_> UrRootDevice(
-              new ur_device_handle_t_(RootDevice, (ur_platform_handle_t)this));
-          UR_CALL(UrRootDevice->initialize());
-          URDevicesCache.push_back(std::move(UrRootDevice));
-        }
+    });
+
+    // The tiles of a card share its device, which is only set up once.
+    std::vector<ze_device_handle_t> ZeCardDevices;
+    for (auto &Setup : Setups) {
+      UR_CALL(Setup.Result);
+      if (Setup.ZeCardDevice &&
+          std::find(ZeCardDevices.begin(), ZeCardDevices.end(),
+                    Setup.ZeCardDevice) == ZeCardDevices.end()) {
+        ZeCardDevices.push_back(Setup.ZeCardDevice);
+      }
+    }
+    uint32_t CardDeviceCount = ZeCardDevices.size();
+    std::vector<std::unique_ptr<ur_device_handle_t_>> CardDevices(
+        CardDeviceCount);
+    std::vector<ur_result_t> CardDeviceResults(CardDeviceCount);
+    forEachConcurrently(CardDeviceCount, CardDeviceCount, [&](uint32_t I) {
+      try {
+        CardDevices[I].reset(new ur_device_handle_t_(ZeCardDevices[I], this));
+        CardDeviceResults[I] = CardDevices[I]->initialize();
+      } catch (...) {
+        CardDeviceResults[I] = exceptionToResult(std::current_exception());
+      }
+    });
+    for (auto Result : CardDeviceResults)
+      UR_CALL(Result);
+
+    for (auto &Setup : Setups) {
+      for (auto &SubDevice : Setup.SubDevices)
+        URDevicesCache.push_back(std::move(SubDevice));
+
+      // Cached after the sub-devices of its first tile
+      if (Setup.ZeCardDevice) {
+        auto &CardDevice =
+            CardDevices[std::find(ZeCardDevices.begin(), ZeCardDevices.end(),
+                                  Setup.ZeCardDevice) -
+                        ZeCardDevices.begin()];
+        if (CardDevice)
+          URDevicesCache.push_back(std::move(CardDevice));
       }
 
       // Save the root device in the cache for future uses.
-      URDevicesCache.push_back(std::move(Device));
+      URDevicesCache.push_back(std::move(Setup.Device));
     }
   } catch (const std::bad_alloc &) {
     return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
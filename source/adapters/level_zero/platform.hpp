@@ -9,6 +9,9 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <deque>
+#include <map>
+
 #include "common.hpp"
 #include "ur_api.h"
 #include "ze_api.h"
@@ -59,6 +62,7 @@ struct ur_platform_handle_t_ : public _ur_platform {
   bool ZeDriverGlobalOffsetExtensionFound{false};
   bool ZeDriverModuleProgramExtensionFound{false};
   bool ZeDriverEventPoolCountingEventsExtensionFound{false};
+  bool ZeDriverImmediateCommandListAppendFound{false};
 
   // Cache UR devices for reuse
   std::vector<std::unique_ptr<ur_device_handle_t_>> URDevicesCache;
@@ -89,6 +93,23 @@ struct ur_platform_handle_t_ : public _ur_platform {
   std::list<ur_context_handle_t> Contexts;
   ur_shared_mutex ContextsMutex;
 
+  // Epochs of the indirect access tracking, guarded by ContextsMutex. Rather
+  // than having each submitted kernel retain all the allocations, a free while
+  // kernels with indirect access are in flight is deferred and starts a new
+  // epoch, and is only performed once the kernels submitted up to its epoch
+  // completed.
+  struct DeferredFree {
+    uint64_t Epoch;
+    ur_context_handle_t Context;
+    void *Ptr;
+    // Whether Ptr is from a USM pool, or was allocated by zeMemAlloc*
+    bool FromPool;
+  };
+  uint64_t IndirectAccessEpoch = 0;
+  // Number of kernels in flight by the epoch of their oldest submission
+  std::map<uint64_t, uint32_t> IndirectAccessKernels;
+  std::deque<DeferredFree> DeferredFrees;
+
   // Structure with function pointers for mutable command list extension.
   // Not all drivers may support it, so considering that the platform object is
   // associated with particular Level Zero driver, store this extension here.
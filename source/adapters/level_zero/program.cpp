@@ -8,10 +8,21 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <algorithm>
+#include <functional>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 #include "program.hpp"
 #include "device.hpp"
 #include "logger/ur_logger.hpp"
+#include "program_cache.hpp"
 #include "ur_interface_loader.hpp"
+#include "ur_util.hpp"
 
 #ifdef UR_ADAPTER_LEVEL_ZERO_V2
 #include "v2/context.hpp"
@@ -55,6 +66,138 @@ checkUnresolvedSymbols(ze_module_handle_t ZeModule,
 }
 } // extern "C"
 
+// Creates the module of a build from a native binary built for an identical
+// device. Returns false if it didn't load, in which case the module is to be
+// built from the IL.
+static bool createModuleFromBinary(const std::vector<uint8_t> &Binary,
+                                   ze_context_handle_t ZeContext,
+                                   ze_device_handle_t ZeDevice,
+                                   const char *BuildFlags,
+                                   ze_module_handle_t &ZeModule,
+                                   ze_module_build_log_handle_t &ZeBuildLog) {
+  ZeStruct<ze_module_desc_t> ZeModuleDesc;
+  ZeModuleDesc.format = ZE_MODULE_FORMAT_NATIVE;
+  ZeModuleDesc.inputSize = Binary.size();
+  ZeModuleDesc.pInputModule = Binary.data();
+  ZeModuleDesc.pBuildFlags = BuildFlags;
+  ze_result_t ZeResult = ZE_CALL_NOCHECK(
+      zeModuleCreate,
+      (ZeContext, ZeDevice, &ZeModuleDesc, &ZeModule, &ZeBuildLog));
+  if (ZeResult == ZE_RESULT_SUCCESS)
+    return true;
+
+  logger::debug("failed to load a native binary, building from IL");
+  if (ZeModule) {
+    ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModule));
+    ZeModule = nullptr;
+  }
+  if (ZeBuildLog) {
+    ZE_CALL_NOCHECK(zeModuleBuildLogDestroy, (ZeBuildLog));
+    ZeBuildLog = nullptr;
+  }
+  return false;
+}
+
+// Creates the module of a build from the native binary stored in the program
+// cache for it, if any. Returns false if there was none or it didn't load, in
+// which case the module is to be built from the IL.
+static bool createModuleFromCache(const ProgramCache &Cache,
+                                  const std::string &Key,
+                                  ze_context_handle_t ZeContext,
+                                  ze_device_handle_t ZeDevice,
+                                  const char *BuildFlags,
+                                  ze_module_handle_t &ZeModule,
+                                  ze_module_build_log_handle_t &ZeBuildLog) {
+  auto Binary = Cache.load(Key);
+  return Binary && createModuleFromBinary(*Binary, ZeContext, ZeDevice,
+                                          BuildFlags, ZeModule, ZeBuildLog);
+}
+
+// Gets the native binary of a module built from IL, leaving Binary empty if
+// the driver can't return it
+static void getNativeBinary(ze_module_handle_t ZeModule,
+                            std::vector<uint8_t> &Binary) {
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary, (ZeModule, &Size, nullptr)) ||
+      Size == 0)
+    return;
+  Binary.resize(Size);
+  if (ZE_CALL_NOCHECK(zeModuleGetNativeBinary,
+                      (ZeModule, &Size, Binary.data())))
+    Binary.clear();
+}
+
+// Groups the NumDevices devices of a build or link by the native binary the
+// IL compiles to for them, which only depends on the model of the device and
+// on the driver, such as the tiles of a multi-tile GPU. Each device is in a
+// group of its own unless FromIL, as native code needs no JIT.
+static std::vector<std::vector<uint32_t>>
+groupIdenticalDevices(uint32_t NumDevices, ur_device_handle_t *Devices,
+                      bool FromIL) {
+  using key_t = std::tuple<std::string, uint32_t, uint32_t, std::string, bool>;
+  std::map<key_t, size_t> GroupIndices;
+  std::vector<std::vector<uint32_t>> Groups;
+  for (uint32_t I = 0; I < NumDevices; I++) {
+    ur_device_handle_t Device = Devices[I];
+    if (!FromIL) {
+      Groups.push_back({I});
+      continue;
+    }
+    key_t Key{Device->Platform->ZeDriverVersion,
+              Device->ZeDeviceProperties->vendorId,
+              Device->ZeDeviceProperties->deviceId,
+              Device->ZeDeviceProperties->name, Device->isSubDevice()};
+    auto [It, Inserted] = GroupIndices.try_emplace(Key, Groups.size());
+    if (Inserted)
+      Groups.emplace_back();
+    Groups[It->second].push_back(I);
+  }
+  return Groups;
+}
+
+// Runs Build for each of the NumDevices devices of a build or link, on up to
+// UR_L0_PROGRAM_BUILD_THREADS threads at once, by default one per hardware
+// thread. The modules of different devices are built independently by the
+// driver. Build must not throw.
+static void forEachDeviceConcurrently(
+    uint32_t NumDevices, const std::function<void(uint32_t)> &Build) {
+  static const uint32_t MaxThreads = [] {
+    auto Threads = getenv_to_unsigned("UR_L0_PROGRAM_BUILD_THREADS");
+    if (Threads)
+      return static_cast<uint32_t>(std::max<uint64_t>(*Threads, 1));
+    return std::max(std::thread::hardware_concurrency(), 1u);
+  }();
+  forEachConcurrently(NumDevices, MaxThreads, Build);
+}
+
+// Runs Build(I, From, To) concurrently for the first device of each of the
+// Groups, with To receiving the native binary of its module if the group has
+// other devices, then concurrently for the other devices, with From the
+// binary of the first device of their group, empty if its build failed, to
+// load instead of building the IL again.
+static void forEachDeviceGroupConcurrently(
+    const std::vector<std::vector<uint32_t>> &Groups,
+    const std::function<void(uint32_t, const std::vector<uint8_t> *,
+                             std::vector<uint8_t> *)> &Build) {
+  std::vector<std::vector<uint8_t>> Binaries(Groups.size());
+  forEachDeviceConcurrently(
+      static_cast<uint32_t>(Groups.size()), [&](uint32_t G) {
+        Build(Groups[G][0], nullptr,
+              Groups[G].size() > 1 ? &Binaries[G] : nullptr);
+      });
+
+  // Each as the device and its group
+  std::vector<std::pair<uint32_t, uint32_t>> Others;
+  for (uint32_t G = 0; G < Groups.size(); G++) {
+    for (size_t J = 1; J < Groups[G].size(); J++)
+      Others.emplace_back(Groups[G][J], G);
+  }
+  forEachDeviceConcurrently(
+      static_cast<uint32_t>(Others.size()), [&](uint32_t K) {
+        Build(Others[K].first, &Binaries[Others[K].second], nullptr);
+      });
+}
+
 namespace ur::level_zero {
 
 ur_result_t urProgramCreateWithIL(
@@ -182,46 +325,119 @@ ur_result_t urProgramBuildExp(
   ZeModuleDesc.pConstants = Shim.ze();
   ur_result_t Result = UR_RESULT_SUCCESS;
 
-  for (uint32_t i = 0; i < numDevices; i++) {
+  // Only the builds from IL are cached, native code needs no JIT
+  bool FromIL = hProgram->State == ur_program_handle_t_::IL;
+  const ProgramCache *Cache = FromIL ? ProgramCache::get() : nullptr;
+  ProgramVariantCache *Variants = FromIL ? ProgramVariantCache::get() : nullptr;
+
+  // Outcome of the build for one device
+  struct DeviceBuild {
+    ze_module_handle_t ZeModule = nullptr;
+    ze_module_build_log_handle_t ZeBuildLog = nullptr;
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    // Whether the module, null if unresolved symbols remain, is kept
+    bool KeepModule = false;
+  };
+  std::vector<DeviceBuild> Builds(numDevices);
+  ze_context_handle_t ZeContext = hProgram->Context->getZeHandle();
+  auto Groups = groupIdenticalDevices(numDevices, phDevices, FromIL);
+
+  forEachDeviceGroupConcurrently(Groups, [&](uint32_t i,
+                                             const std::vector<uint8_t> *From,
+                                             std::vector<uint8_t> *To) {
     ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
-    ze_context_handle_t ZeContext = hProgram->Context->getZeHandle();
-    ze_module_handle_t ZeModuleHandle = nullptr;
-    ze_module_build_log_handle_t ZeBuildLog{};
-
-    hProgram->State = ur_program_handle_t_::Exe;
-    ze_result_t ZeResult =
-        ZE_CALL_NOCHECK(zeModuleCreate, (ZeContext, ZeDevice, &ZeModuleDesc,
-                                         &ZeModuleHandle, &ZeBuildLog));
-    if (ZeResult != ZE_RESULT_SUCCESS) {
-      // We adjust ur_program below to avoid attempting to release zeModule when
-      // RT calls urProgramRelease().
-      hProgram->State = ur_program_handle_t_::Invalid;
-      Result = ze2urResult(ZeResult);
-      if (ZeModuleHandle) {
-        ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
-        ZeModuleHandle = nullptr;
+    auto &Build = Builds[i];
+    ze_module_handle_t &ZeModuleHandle = Build.ZeModule;
+    ze_module_build_log_handle_t &ZeBuildLog = Build.ZeBuildLog;
+
+    try {
+      // The binary of an identical device is also the one in the caches
+      bool FromMemory = From && !From->empty() &&
+                        createModuleFromBinary(*From, ZeContext, ZeDevice,
+                                               ZeModuleDesc.pBuildFlags,
+                                               ZeModuleHandle, ZeBuildLog);
+      std::string CacheKey;
+      if ((Cache || Variants) && !FromMemory)
+        CacheKey =
+            ProgramCache::makeKey(hProgram, phDevices[i], ZeBuildOptions);
+      if (Variants && !FromMemory) {
+        auto Variant = Variants->load(CacheKey);
+        FromMemory = Variant && createModuleFromBinary(
+                                    *Variant, ZeContext, ZeDevice,
+                                    ZeModuleDesc.pBuildFlags, ZeModuleHandle,
+                                    ZeBuildLog);
       }
-    } else {
+      bool FromCache = false;
+      if (Cache && !FromMemory)
+        FromCache = createModuleFromCache(*Cache, CacheKey, ZeContext,
+                                          ZeDevice, ZeModuleDesc.pBuildFlags,
+                                          ZeModuleHandle, ZeBuildLog);
+
+      ze_result_t ZeResult = ZE_RESULT_SUCCESS;
+      if (!FromMemory && !FromCache)
+        ZeResult = ZE_CALL_NOCHECK(zeModuleCreate,
+                                   (ZeContext, ZeDevice, &ZeModuleDesc,
+                                    &ZeModuleHandle, &ZeBuildLog));
+      if (ZeResult != ZE_RESULT_SUCCESS) {
+        Build.Result = ze2urResult(ZeResult);
+        if (ZeModuleHandle) {
+          ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
+          ZeModuleHandle = nullptr;
+        }
+        return;
+      }
+
       // The call to zeModuleCreate does not report an error if there are
-      // unresolved symbols because it thinks these could be resolved later via
-      // a call to zeModuleDynamicLink.  However, modules created with
+      // unresolved symbols because it thinks these could be resolved later
+      // via a call to zeModuleDynamicLink.  However, modules created with
       // urProgramBuild are supposed to be fully linked and ready to use.
       // Therefore, do an extra check now for unresolved symbols.
+      Build.KeepModule = true;
       ZeResult = checkUnresolvedSymbols(ZeModuleHandle, &ZeBuildLog);
       if (ZeResult != ZE_RESULT_SUCCESS) {
-        hProgram->State = ur_program_handle_t_::Invalid;
-        Result = (ZeResult == ZE_RESULT_ERROR_MODULE_LINK_FAILURE)
-                     ? UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
-                     : ze2urResult(ZeResult);
+        Build.Result = (ZeResult == ZE_RESULT_ERROR_MODULE_LINK_FAILURE)
+                           ? UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
+                           : ze2urResult(ZeResult);
         if (ZeModuleHandle) {
           ZE_CALL_NOCHECK(zeModuleDestroy, (ZeModuleHandle));
           ZeModuleHandle = nullptr;
         }
+      } else if (FromMemory) {
+        if (To)
+          getNativeBinary(ZeModuleHandle, *To);
+      } else if (To || Variants || (Cache && !FromCache)) {
+        auto Binary = std::make_shared<std::vector<uint8_t>>();
+        getNativeBinary(ZeModuleHandle, *Binary);
+        if (!Binary->empty()) {
+          if (Cache && !FromCache)
+            Cache->store(CacheKey, *Binary);
+          if (To)
+            *To = *Binary;
+          if (Variants)
+            Variants->store(CacheKey, std::move(Binary));
+        }
       }
-      hProgram->ZeModuleMap.insert(std::make_pair(ZeDevice, ZeModuleHandle));
+    } catch (...) {
+      Build.Result = exceptionToResult(std::current_exception());
     }
-    hProgram->ZeBuildLogMap.insert(std::make_pair(ZeDevice, ZeBuildLog));
+  });
+
+  // Merged in the order of the devices, whichever build finished first. The
+  // error is the one of the first device which failed.
+  for (uint32_t i = 0; i < numDevices; i++) {
+    ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
+    auto &Build = Builds[i];
+    if (Build.Result != UR_RESULT_SUCCESS && Result == UR_RESULT_SUCCESS)
+      Result = Build.Result;
+    if (Build.KeepModule)
+      hProgram->ZeModuleMap.insert(std::make_pair(ZeDevice, Build.ZeModule));
+    hProgram->ZeBuildLogMap.insert(std::make_pair(ZeDevice, Build.ZeBuildLog));
   }
+  // We adjust ur_program to avoid attempting to release zeModule when RT
+  // calls urProgramRelease() after a failure.
+  hProgram->State = (Result == UR_RESULT_SUCCESS)
+                        ? ur_program_handle_t_::Exe
+                        : ur_program_handle_t_::Invalid;
 
   if (!hProgram->ZeModuleMap.empty())
     hProgram->ZeModule = hProgram->ZeModuleMap.begin()->second;
@@ -230,6 +446,25 @@ ur_result_t urProgramBuildExp(
   return Result;
 }
 
+ur_result_t urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue `phEvent` is
+                                  ///< associated with
+    const char *pOptions,         ///< [in][optional] pointer to build options
+                                  ///< null-terminated string.
+    ur_event_handle_t *phEvent    ///< [out] return an event object that
+                                  ///< signals the end of the build.
+) {
+  std::ignore = hProgram;
+  std::ignore = hQueue;
+  std::ignore = pOptions;
+  std::ignore = phEvent;
+  // zeModuleCreate blocks until the module is built, and signalling the event
+  // from a thread of our own would need a host-visible event pool per
+  // context, so the program can't be built in the background.
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ur_result_t urProgramCompileExp(
     ur_program_handle_t
         hProgram,        ///< [in][out] handle of the program to compile.
@@ -432,24 +667,42 @@ ur_result_t urProgramLinkExp(
     std::unordered_map<ze_device_handle_t, ze_module_build_log_handle_t>
         ZeBuildLogMap;
 
-    for (uint32_t i = 0; i < numDevices; i++) {
-
-      // Call the Level Zero API to compile, link, and create the module.
-      ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
-      ze_context_handle_t ZeContext = hContext->getZeHandle();
+    // Outcome of the link for one device
+    struct DeviceLink {
       ze_module_handle_t ZeModule = nullptr;
       ze_module_build_log_handle_t ZeBuildLog = nullptr;
-      ze_result_t ZeResult =
-          ZE_CALL_NOCHECK(zeModuleCreate, (ZeContext, ZeDevice, &ZeModuleDesc,
-                                           &ZeModule, &ZeBuildLog));
+      ze_result_t ZeResult = ZE_RESULT_SUCCESS;
+      // Set if no program is to be created
+      ur_result_t Error = UR_RESULT_SUCCESS;
+    };
+    std::vector<DeviceLink> Links(numDevices);
+    ze_context_handle_t ZeContext = hContext->getZeHandle();
+    auto Groups = groupIdenticalDevices(numDevices, phDevices, true);
+
+    forEachDeviceGroupConcurrently(Groups, [&](uint32_t i,
+                                               const std::vector<uint8_t> *From,
+                                               std::vector<uint8_t> *To) {
+      // Call the Level Zero API to compile, link, and create the module,
+      // unless an identical device has done it already.
+      ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
+      auto &Link = Links[i];
+      if (From && !From->empty() &&
+          createModuleFromBinary(*From, ZeContext, ZeDevice, nullptr,
+                                 Link.ZeModule, Link.ZeBuildLog)) {
+        Link.ZeResult = ZE_RESULT_SUCCESS;
+      } else {
+        Link.ZeResult = ZE_CALL_NOCHECK(
+            zeModuleCreate, (ZeContext, ZeDevice, &ZeModuleDesc,
+                             &Link.ZeModule, &Link.ZeBuildLog));
+      }
 
       // We still create a ur_program_handle_t_ object even if there is a
       // BUILD_FAILURE because we need the object to hold the ZeBuildLog.  There
       // is no build log created for other errors, so we don't create an object.
-      UrResult = ze2urResult(ZeResult);
-      if (ZeResult != ZE_RESULT_SUCCESS &&
-          ZeResult != ZE_RESULT_ERROR_MODULE_BUILD_FAILURE) {
-        return ze2urResult(ZeResult);
+      if (Link.ZeResult != ZE_RESULT_SUCCESS &&
+          Link.ZeResult != ZE_RESULT_ERROR_MODULE_BUILD_FAILURE) {
+        Link.Error = ze2urResult(Link.ZeResult);
+        return;
       }
 
       // The call to zeModuleCreate does not report an error if there are
@@ -459,14 +712,37 @@ ur_result_t urProgramLinkExp(
       // Therefore, do an extra check now for unresolved symbols.  Note that we
       // still create a ur_program_handle_t_ if there are unresolved symbols
       // because the ZeBuildLog tells which symbols are unresolved.
-      if (ZeResult == ZE_RESULT_SUCCESS) {
-        ZeResult = checkUnresolvedSymbols(ZeModule, &ZeBuildLog);
-        if (ZeResult != ZE_RESULT_SUCCESS) {
-          return ze2urResult(ZeResult);
+      if (Link.ZeResult == ZE_RESULT_SUCCESS) {
+        ze_result_t ZeResult =
+            checkUnresolvedSymbols(Link.ZeModule, &Link.ZeBuildLog);
+        if (ZeResult != ZE_RESULT_SUCCESS)
+          Link.Error = ze2urResult(ZeResult);
+        else if (To)
+          getNativeBinary(Link.ZeModule, *To);
+      }
+    });
+
+    // Merged in the order of the devices, whichever link finished first. The
+    // error is the one of the first device which failed.
+    for (uint32_t i = 0; i < numDevices; i++) {
+      auto &Link = Links[i];
+      if (Link.Error != UR_RESULT_SUCCESS) {
+        // No program holds the modules and logs then
+        for (auto &Other : Links) {
+          if (Other.ZeModule)
+            ZE_CALL_NOCHECK(zeModuleDestroy, (Other.ZeModule));
+          if (Other.ZeBuildLog)
+            ZE_CALL_NOCHECK(zeModuleBuildLogDestroy, (Other.ZeBuildLog));
         }
+        return Link.Error;
       }
-      ZeModuleMap.insert(std::make_pair(ZeDevice, ZeModule));
-      ZeBuildLogMap.insert(std::make_pair(ZeDevice, ZeBuildLog));
+      if (UrResult == UR_RESULT_SUCCESS)
+        UrResult = ze2urResult(Link.ZeResult);
+    }
+    for (uint32_t i = 0; i < numDevices; i++) {
+      ze_device_handle_t ZeDevice = phDevices[i]->ZeDevice;
+      ZeModuleMap.insert(std::make_pair(ZeDevice, Links[i].ZeModule));
+      ZeBuildLogMap.insert(std::make_pair(ZeDevice, Links[i].ZeBuildLog));
     }
 
     ur_program_handle_t_::state State = (UrResult == UR_RESULT_SUCCESS)
@@ -620,9 +896,9 @@ ur_result_t urProgramGetGlobalVariablePointer(
     }
   }
 
-  ze_result_t ZeResult =
-      zeModuleGetGlobalPointer(ZeModuleEntry, GlobalVariableName,
-                               GlobalVariableSizeRet, GlobalVariablePointerRet);
+  ze_result_t ZeResult = Program->getZeGlobalPointer(
+      ZeModuleEntry, GlobalVariableName, GlobalVariableSizeRet,
+      GlobalVariablePointerRet);
 
   if (ZeResult == ZE_RESULT_ERROR_UNSUPPORTED_FEATURE) {
     return UR_RESULT_ERROR_INVALID_VALUE;
@@ -989,6 +1265,7 @@ ur_result_t urProgramSetSpecializationConstants(
   for (uint32_t SpecIt = 0; SpecIt < Count; SpecIt++) {
     uint32_t SpecId = SpecConstants[SpecIt].id;
     Program->SpecConstants[SpecId] = SpecConstants[SpecIt].pValue;
+    Program->SpecConstantSizes[SpecId] = SpecConstants[SpecIt].size;
   }
   return UR_RESULT_SUCCESS;
 }
@@ -1001,6 +1278,30 @@ ur_program_handle_t_::~ur_program_handle_t_() {
   }
 }
 
+ze_result_t
+ur_program_handle_t_::getZeGlobalPointer(ze_module_handle_t ZeModule,
+                                         const char *Name, size_t *Size,
+                                         void **Ptr) {
+  std::scoped_lock<std::mutex> Lock(ZeGlobalPointersMutex);
+  auto &ModuleGlobals = ZeGlobalPointers[ZeModule];
+  auto It = ModuleGlobals.find(Name);
+  if (It == ModuleGlobals.end()) {
+    size_t GlobalSize = 0;
+    void *GlobalPtr = nullptr;
+    ze_result_t ZeResult = ZE_CALL_NOCHECK(
+        zeModuleGetGlobalPointer, (ZeModule, Name, &GlobalSize, &GlobalPtr));
+    if (ZeResult != ZE_RESULT_SUCCESS)
+      return ZeResult;
+    It = ModuleGlobals.emplace(Name, std::make_pair(GlobalPtr, GlobalSize))
+             .first;
+  }
+  if (Size)
+    *Size = It->second.second;
+  if (Ptr)
+    *Ptr = It->second.first;
+  return ZE_RESULT_SUCCESS;
+}
+
 void ur_program_handle_t_::ur_release_program_resources(bool deletion) {
   // According to Level Zero Specification, all kernels and build logs
   // must be destroyed before the Module can be destroyed.  So, be sure
@@ -116,6 +116,11 @@ struct ur_program_handle_t_ : _ur_object {
   ~ur_program_handle_t_();
   void ur_release_program_resources(bool deletion);
 
+  // Looks up the global variable Name of ZeModule, one of the modules of this
+  // program, asking the driver only the first time for each module and name.
+  ze_result_t getZeGlobalPointer(ze_module_handle_t ZeModule, const char *Name,
+                                 size_t *Size, void **Ptr);
+
   // Tracks the release state of the program handle to determine if the
   // internal handle needs to be released.
   bool resourcesReleased = false;
@@ -149,6 +154,10 @@ struct ur_program_handle_t_ : _ur_object {
   // maintaining the storage of this buffer.
   std::unordered_map<uint32_t, const void *> SpecConstants;
 
+  // Sizes of the values of SpecConstants, as given by the caller. Only used to
+  // key the program cache, Level Zero knows them from the SPIR-V.
+  std::unordered_map<uint32_t, size_t> SpecConstantSizes;
+
   // Used only in Object state.  Contains the build flags from the last call to
   // urProgramCompile().
   std::string BuildFlags;
@@ -167,4 +176,11 @@ struct ur_program_handle_t_ : _ur_object {
   // Program has been built.
   std::unordered_map<ze_device_handle_t, ze_module_build_log_handle_t>
       ZeBuildLogMap;
+
+  // Addresses and sizes of the global variables looked up so far, by module
+  // and name. The modules don't change once built, nor do their globals.
+  std::unordered_map<ze_module_handle_t,
+                     std::unordered_map<std::string, std::pair<void *, size_t>>>
+      ZeGlobalPointers;
+  std::mutex ZeGlobalPointersMutex;
 };
@@ -0,0 +1,111 @@
+//===--------- program_cache.cpp - Level Zero Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <map>
+#include <memory>
+#include <sstream>
+
+#include "device.hpp"
+#include "platform.hpp"
+#include "program.hpp"
+#include "program_cache.hpp"
+#include "ur_util.hpp"
+
+namespace {
+
+constexpr const char *CacheMagic = "ur-l0-program-cache-v1";
+
+} // namespace
+
+ProgramCache::ProgramCache(filesystem::path Dir)
+    : Files(std::move(Dir), CacheMagic, ".bin") {}
+
+ProgramCache *ProgramCache::get() {
+  static std::unique_ptr<ProgramCache> Cache =
+      []() -> std::unique_ptr<ProgramCache> {
+    auto Dir = ur_getenv("UR_L0_PROGRAM_CACHE_DIR");
+    if (!Dir || Dir->empty())
+      return nullptr;
+    return std::make_unique<ProgramCache>(filesystem::path(*Dir));
+  }();
+  return Cache.get();
+}
+
+std::string ProgramCache::makeKey(ur_program_handle_t Program,
+                                  ur_device_handle_t Device,
+                                  const std::string &Options) {
+  std::ostringstream Key;
+  Key << Device->Platform->ZeDriverVersion << ';' << std::hex
+      << Device->ZeDeviceProperties->vendorId << ':'
+      << Device->ZeDeviceProperties->deviceId << ';'
+      << Device->ZeDeviceProperties->name << ';' << Program->CodeLength << ':'
+      << ur::hashBytes(Program->Code.get(), Program->CodeLength) << ';';
+
+  // In SpecID order, the order they were set in doesn't matter
+  std::map<uint32_t, const void *> SpecConstants(Program->SpecConstants.begin(),
+                                                 Program->SpecConstants.end());
+  for (auto &[Id, Value] : SpecConstants) {
+    Key << Id << '=';
+    auto SizeIt = Program->SpecConstantSizes.find(Id);
+    auto Size = SizeIt != Program->SpecConstantSizes.end() ? SizeIt->second : 0;
+    auto Bytes = static_cast<const uint8_t *>(Value);
+    for (size_t I = 0; Bytes && I < Size; ++I) {
+      Key << static_cast<unsigned>(Bytes[I] >> 4)
+          << static_cast<unsigned>(Bytes[I] & 0xf);
+    }
+    Key << ',';
+  }
+  Key << ';' << Options;
+  return Key.str();
+}
+
+ProgramVariantCache *ProgramVariantCache::get() {
+  static std::unique_ptr<ProgramVariantCache> Cache =
+      []() -> std::unique_ptr<ProgramVariantCache> {
+    auto MaxMB = getenv_to_unsigned("UR_L0_PROGRAM_VARIANT_CACHE_MB");
+    size_t MaxBytes = (MaxMB ? *MaxMB : 64) * 1024 * 1024;
+    if (MaxBytes == 0)
+      return nullptr;
+    return std::make_unique<ProgramVariantCache>(MaxBytes);
+  }();
+  return Cache.get();
+}
+
+ProgramVariantCache::binary_t
+ProgramVariantCache::load(const std::string &Key) {
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = Index.find(Key);
+  if (It == Index.end())
+    return nullptr;
+  Entries.splice(Entries.begin(), Entries, It->second);
+  return It->second->second;
+}
+
+void ProgramVariantCache::store(const std::string &Key, binary_t Binary) {
+  if (!Binary || Binary->size() > MaxBytes)
+    return;
+
+  std::lock_guard<std::mutex> Lock(Mutex);
+  auto It = Index.find(Key);
+  if (It != Index.end()) {
+    CachedBytes -= It->second->second->size();
+    Entries.erase(It->second);
+    Index.erase(It);
+  }
+  while (CachedBytes + Binary->size() > MaxBytes) {
+    auto &Oldest = Entries.back();
+    CachedBytes -= Oldest.second->size();
+    Index.erase(Oldest.first);
+    Entries.pop_back();
+  }
+  CachedBytes += Binary->size();
+  Entries.emplace_front(Key, std::move(Binary));
+  Index.emplace(Key, Entries.begin());
+}
@@ -0,0 +1,90 @@
+//===--------- program_cache.hpp - Level Zero Adapter ---------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "ur_binary_file_cache.hpp"
+
+// On-disk cache of the native binaries built from the IL of programs, enabled
+// by pointing UR_L0_PROGRAM_CACHE_DIR at a directory. A binary is keyed by
+// all its build depends on: the IL, the build options, the specialization
+// constants, the device and the driver version. The key is stored along with
+// the binary, so that a hash collision can't load the wrong one.
+class ProgramCache {
+public:
+  explicit ProgramCache(filesystem::path Dir);
+
+  // Returns the cache selected by UR_L0_PROGRAM_CACHE_DIR, or nullptr
+  static ProgramCache *get();
+
+  // Describes the build of Program, which must be in IL state, for Device
+  static std::string makeKey(ur_program_handle_t Program,
+                             ur_device_handle_t Device,
+                             const std::string &Options);
+
+  // Returns the binary stored for Key, if any
+  std::optional<std::vector<uint8_t>> load(const std::string &Key) const {
+    return Files.load(Key);
+  }
+
+  // Stores Binary for Key. Concurrent stores of the same key don't see
+  // partial files.
+  void store(const std::string &Key, const std::vector<uint8_t> &Binary) const {
+    Files.store(Key, Binary.data(), Binary.size());
+  }
+
+private:
+  ur::binary_file_cache Files;
+};
+
+// In-memory cache of the native binaries built from the IL of programs, keyed
+// like ProgramCache, so that building a program again for the same device,
+// options and specialization constants, such as in autotuning loops cycling
+// through a few values, loads a binary instead of compiling the IL. Native
+// binaries don't depend on the context, so the cache is shared by all of
+// them. At most UR_L0_PROGRAM_VARIANT_CACHE_MB megabytes, 64 by default, are
+// kept, the binaries used least recently being dropped first, and 0 disables
+// the cache.
+class ProgramVariantCache {
+public:
+  using binary_t = std::shared_ptr<const std::vector<uint8_t>>;
+
+  explicit ProgramVariantCache(size_t MaxBytes) : MaxBytes(MaxBytes) {}
+
+  // Returns the cache selected by UR_L0_PROGRAM_VARIANT_CACHE_MB, or nullptr
+  static ProgramVariantCache *get();
+
+  // Returns the binary kept for Key, if any
+  binary_t load(const std::string &Key);
+
+  // Keeps Binary for Key
+  void store(const std::string &Key, binary_t Binary);
+
+private:
+  using entry_t = std::pair<std::string, binary_t>;
+
+  const size_t MaxBytes;
+  std::mutex Mutex;
+  // The binaries used most recently first
+  std::list<entry_t> Entries;
+  std::unordered_map<std::string, std::list<entry_t>::iterator> Index;
+  size_t CachedBytes = 0;
+};
@@ -19,8 +19,10 @@
 #include "common.hpp"
 #include "event.hpp"
 #include "queue.hpp"
+#include "tracing.hpp"
 #include "ur_interface_loader.hpp"
 #include "ur_level_zero.hpp"
+#include "ur_perf_counters.hpp"
 #include "ur_util.hpp"
 #include "ze_api.h"
 
@@ -40,6 +42,12 @@ static const uint64_t CompletionEventsPerBatch = [] {
       .value_or(256);
 }();
 
+// Whether the standard command lists of profiling queues copy out the kernel
+// timestamps of their events, see ur_kernel_timestamps_t.
+static const bool UseBatchedProfiling = [] {
+  return getenv_to_unsigned("UR_L0_BATCHED_PROFILING").value_or(0) != 0;
+}();
+
 ur_completion_batch::ur_completion_batch()
     : barrierEvent(nullptr), st(EMPTY), numEvents(0) {}
 
@@ -376,8 +384,10 @@ ur_result_t urQueueGetInfo(
   case UR_QUEUE_INFO_EMPTY: {
     // We can exit early if we have in-order queue.
     if (Queue->isInOrderQueue()) {
-      if (!Queue->LastCommandEvent)
+      if (!Queue->LastCommandEvent) {
+        Queue->Stats.onIdle();
         return ReturnValue(true);
+      }
 
       // We can check status of the event only if it isn't discarded otherwise
       // it may be reset (because we are free to reuse such events) and
@@ -392,6 +402,7 @@ ur_result_t urQueueGetInfo(
         } else if (ZeResult != ZE_RESULT_SUCCESS) {
           return ze2urResult(ZeResult);
         }
+        Queue->Stats.onIdle();
         return ReturnValue(true);
       }
       // For immediate command lists we have to check status of the event
@@ -450,8 +461,17 @@ ur_result_t urQueueGetInfo(
         }
       }
     }
+    Queue->Stats.onIdle();
     return ReturnValue(true);
   }
+  case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+  case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+  case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+  case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+    return ur::queue_stats::getInfo(Queue->Stats.snapshot(), ParamName,
+                                    ReturnValue);
   default:
     logger::error(
         "Unsupported ParamName in urQueueGetInfo: ParamName=ParamName={}(0x{})",
@@ -473,6 +493,14 @@ static bool doEagerInit = [] {
   return EagerInit ? std::atoi(EagerInit) != 0 : false;
 }();
 
+// Controls whether the in-order queues of a device with multiple compute
+// engines are each pinned to the engine fewest queues are pinned to, instead
+// of cycling through all engines like the out-of-order queues.
+static const bool PlaceInOrderQueues = [] {
+  const char *UrRet = std::getenv("UR_L0_PLACE_IN_ORDER_QUEUES");
+  return UrRet ? std::atoi(UrRet) != 0 : false;
+}();
+
 ur_result_t urQueueCreate(
     ur_context_handle_t Context, ///< [in] handle of the context object
     ur_device_handle_t Device,   ///< [in] handle of the device object
@@ -489,6 +517,10 @@ ur_result_t urQueueCreate(
   if (Props) {
     Flags = Props->flags;
   }
+  // The traced device activity is read from the kernel timestamps of events
+  if (isL0ActivityEnabled()) {
+    Flags |= UR_QUEUE_FLAG_PROFILING_ENABLE;
+  }
 
   int ForceComputeIndex = -1; // Use default/round-robin.
   if (Props) {
@@ -569,16 +601,26 @@ ur_result_t urQueueCreate(
     // command-lists. Other threads have not accessed the queue yet. So we can
     // only warmup the initial thread's command-lists.
     const auto &QueueGroup = Q->ComputeQueueGroupsByTID.get();
-    UR_CALL(warmupQueueGroup(false, QueueGroup.UpperIndex -
-                                        QueueGroup.LowerIndex + 1));
-    if (Q->useCopyEngine()) {
+    auto Res = warmupQueueGroup(false, QueueGroup.UpperIndex -
+                                           QueueGroup.LowerIndex + 1);
+    if (Res == UR_RESULT_SUCCESS && Q->useCopyEngine()) {
       const auto &QueueGroup = Q->CopyQueueGroupsByTID.get();
-      UR_CALL(warmupQueueGroup(true, QueueGroup.UpperIndex -
-                                         QueueGroup.LowerIndex + 1));
+      Res = warmupQueueGroup(true, QueueGroup.UpperIndex -
+                                       QueueGroup.LowerIndex + 1);
+    }
+    // The queue goes, along with its engine placement, rather than leaking
+    if (Res != UR_RESULT_SUCCESS) {
+      std::ignore = urQueueRelease(Q);
+      *Queue = nullptr;
+      return Res;
     }
     // TODO: warmup event pools. Both host-visible and device-only.
   }
 
+  // The reaper would clean single submitter queues up from its own thread
+  if (CompletionReaper::isEnabled() && !(*Queue)->isSingleSubmitter())
+    Context->Reaper.registerQueue(*Queue);
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -650,23 +692,18 @@ ur_result_t urQueueRelease(
           return ze2urResult(ZeResult);
       }
       if (Queue->UsingImmCmdLists && Queue->OwnZeCommandQueue) {
-        std::scoped_lock<ur_mutex> Lock(
-            Queue->Context->ZeCommandListCacheMutex);
         const ur_command_list_info_t &MapEntry = it->second;
         if (MapEntry.CanReuse) {
           // Add commandlist to the cache for future use.
           // It will be deleted when the context is destroyed.
-          auto &ZeCommandListCache =
-              MapEntry.isCopy(Queue)
-                  ? Queue->Context
-                        ->ZeCopyCommandListCache[Queue->Device->ZeDevice]
-                  : Queue->Context
-                        ->ZeComputeCommandListCache[Queue->Device->ZeDevice];
           struct l0_command_list_cache_info ListInfo;
           ListInfo.ZeQueueDesc = it->second.ZeQueueDesc;
           ListInfo.InOrderList = it->second.IsInOrderList;
           ListInfo.IsImmediate = it->second.IsImmediate;
-          ZeCommandListCache.push_back({it->first, ListInfo});
+          Queue->Context
+              ->getCommandListCache(Queue->Device->ZeDevice,
+                                    MapEntry.isCopy(Queue))
+              .add(it->first, ListInfo);
         } else {
           // A non-reusable comamnd list that came from a make_queue call is
           // destroyed since it cannot be recycled.
@@ -823,12 +860,17 @@ ur_result_t urQueueCreateWithNativeHandle(
   }
   (*RetQueue)->UsingImmCmdLists = (NativeHandleDesc == 1);
 
+  // The reaper would clean single submitter queues up from its own thread
+  if (CompletionReaper::isEnabled() && !(*RetQueue)->isSingleSubmitter())
+    Context->Reaper.registerQueue(*RetQueue);
+
   return UR_RESULT_SUCCESS;
 }
 
 ur_result_t urQueueFinish(
     ur_queue_handle_t Queue ///< [in] handle of the queue to be finished.
 ) {
+  ur::queue_stats::finish_scope Finish(Queue->Stats);
   if (Queue->UsingImmCmdLists) {
     // Lock automatically releases when this goes out of scope.
     std::scoped_lock<ur_shared_mutex> Lock(Queue->Mutex);
@@ -887,9 +929,14 @@ ur_result_t urQueueFinish(
   // available command lists. Events in the immediate command lists are cleaned
   // up in synchronize().
   if (!Queue->UsingImmCmdLists) {
-    std::unique_lock<ur_shared_mutex> Lock(Queue->Mutex);
-    resetCommandLists(Queue);
+    if (CompletionReaper::isEnabled() && !Queue->isSingleSubmitter()) {
+      Queue->Context->Reaper.wake();
+    } else {
+      std::unique_lock<ur_shared_mutex> Lock(Queue->Mutex);
+      resetCommandLists(Queue);
+    }
   }
+  Finish.finished();
   return UR_RESULT_SUCCESS;
 }
 
@@ -900,6 +947,23 @@ ur_result_t urQueueFlush(
   return Queue->executeAllOpenCommandLists();
 }
 
+// Commands enqueued eagerly signal events of their own, which a regular command
+// list replaying them would have to reset, so queues aren't captured
+ur_result_t urQueueBeginCaptureExp(ur_queue_handle_t hQueue) {
+  std::ignore = hQueue;
+  logger::error("{} function not implemented!", __FUNCTION__);
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t
+urQueueEndCaptureExp(ur_queue_handle_t hQueue,
+                     ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  std::ignore = hQueue;
+  std::ignore = phCommandBuffer;
+  logger::error("{} function not implemented!", __FUNCTION__);
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ur_result_t urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -1084,8 +1148,12 @@ ur_queue_handle_t_::ur_queue_handle_t_(
     std::vector<ze_command_queue_handle_t> &CopyQueues,
     ur_context_handle_t Context, ur_device_handle_t Device,
     bool OwnZeCommandQueue, ur_queue_flags_t Properties, int ForceComputeIndex)
-    : Context{Context}, Device{Device}, OwnZeCommandQueue{OwnZeCommandQueue},
-      Properties(Properties) {
+    : _ur_object("queue"), Context{Context}, Device{Device},
+      OwnZeCommandQueue{OwnZeCommandQueue}, Properties(Properties) {
+  // The context stays locked, as it is shared with other queues
+  if (isSingleSubmitter())
+    Mutex.setSingleThreaded();
+
   // Set the type of commandlists the queue will use when user-selected
   // submission mode. Otherwise use env var setting and if unset, use default.
   if (isBatchedSubmission())
@@ -1134,7 +1202,15 @@ ur_queue_handle_t_::ur_queue_handle_t_(
     uint32_t FilterUpperIndex = getRangeOfAllowedComputeEngines().second;
     FilterUpperIndex = (std::min)((size_t)FilterUpperIndex,
                                   FilterLowerIndex + ComputeQueues.size() - 1);
-    if (FilterLowerIndex <= FilterUpperIndex) {
+    if (FilterLowerIndex < FilterUpperIndex && PlaceInOrderQueues &&
+        isInOrderQueue()) {
+      uint32_t Index = Device->placeQueue(FilterLowerIndex, FilterUpperIndex);
+      PlacedComputeEngine.Device = Device;
+      PlacedComputeEngine.Index = Index;
+      ComputeQueueGroup.LowerIndex = Index;
+      ComputeQueueGroup.UpperIndex = Index;
+      ComputeQueueGroup.NextIndex = Index;
+    } else if (FilterLowerIndex <= FilterUpperIndex) {
       ComputeQueueGroup.LowerIndex = FilterLowerIndex;
       ComputeQueueGroup.UpperIndex = FilterUpperIndex;
       ComputeQueueGroup.NextIndex = ComputeQueueGroup.LowerIndex;
@@ -1218,7 +1294,7 @@ void ur_queue_handle_t_::adjustBatchSizeForFullBatch(bool IsCopy) {
           ZeCommandListBatchConfig.NumTimesClosedFullThreshold) {
     if (QueueBatchSize < ZeCommandListBatchConfig.DynamicSizeMax) {
       QueueBatchSize += ZeCommandListBatchConfig.DynamicSizeStep;
-      logger::debug("Raising QueueBatchSize to {}", QueueBatchSize);
+      UR_LOG(DEBUG, "Raising QueueBatchSize to {}", QueueBatchSize);
     }
     CommandBatch.NumTimesClosedEarly = 0;
     CommandBatch.NumTimesClosedFull = 0;
@@ -1245,12 +1321,20 @@ void ur_queue_handle_t_::adjustBatchSizeForPartialBatch(bool IsCopy) {
     QueueBatchSize = CommandBatch.OpenCommandList->second.size() - 1;
     if (QueueBatchSize < 1)
       QueueBatchSize = 1;
-    logger::debug("Lowering QueueBatchSize to {}", QueueBatchSize);
+    UR_LOG(DEBUG, "Lowering QueueBatchSize to {}", QueueBatchSize);
     CommandBatch.NumTimesClosedEarly = 0;
     CommandBatch.NumTimesClosedFull = 0;
   }
 }
 
+// Batches executed once full, or before that as something waits on them
+static ur::perf_counter ComputeBatchesFlushedFull{
+    "compute_batches.flushed_full"};
+static ur::perf_counter ComputeBatchesFlushedEarly{
+    "compute_batches.flushed_early"};
+static ur::perf_counter CopyBatchesFlushedFull{"copy_batches.flushed_full"};
+static ur::perf_counter CopyBatchesFlushedEarly{"copy_batches.flushed_early"};
+
 ur_result_t
 ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
                                        bool IsBlocking, bool OKToBatchCommand) {
@@ -1288,6 +1372,9 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
     }
   }
 
+  if (this->LastUsedCommandList != CommandListMap.end() &&
+      this->LastUsedCommandList != CommandList)
+    Stats.onSwitch();
   this->LastUsedCommandList = CommandList;
 
   if (!UsingImmCmdLists) {
@@ -1317,33 +1404,32 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
       }
 
       adjustBatchSizeForFullBatch(UseCopyEngine);
+      (UseCopyEngine ? CopyBatchesFlushedFull : ComputeBatchesFlushedFull)
+          .add();
       CommandBatch.OpenCommandList = CommandListMap.end();
     }
   }
+  Stats.onSubmission();
 
   auto &ZeCommandQueue = CommandList->second.ZeQueue;
-  // Scope of the lock must be till the end of the function, otherwise new mem
-  // allocs can be created between the moment when we made a snapshot and the
-  // moment when command list is closed and executed. But mutex is locked only
-  // if indirect access tracking enabled, because std::defer_lock is used.
-  // unique_lock destructor at the end of the function will unlock the mutex
-  // if it was locked (which happens only if IndirectAccessTrackingEnabled is
-  // true).
-  std::unique_lock<ur_shared_mutex> ContextsLock(
-      Device->Platform->ContextsMutex, std::defer_lock);
 
   if (IndirectAccessTrackingEnabled) {
     // We are going to submit kernels for execution. If indirect access flag is
-    // set for a kernel then we need to make a snapshot of existing memory
-    // allocations in all contexts in the platform. We need to lock the mutex
-    // guarding the list of contexts in the platform to prevent creation of new
-    // memory alocations in any context before we submit the kernel for
-    // execution.
-    ContextsLock.lock();
+    // set for a kernel then the memory freed from now on must outlive it, so
+    // record it in the current epoch of indirect accesses before the command
+    // list is closed and executed. This is a constant amount of work per
+    // kernel, so there is no need to hold the lock through the submission.
+    std::scoped_lock<ur_shared_mutex> ContextsLock(
+        Device->Platform->ContextsMutex);
     CaptureIndirectAccesses();
   }
 
   if (!UsingImmCmdLists) {
+    // Have the device copy out the timestamps of the profiled events ahead of
+    // signalling the host-visible event below.
+    if (UseBatchedProfiling && isProfilingEnabled())
+      UR_CALL(appendKernelTimestampsQuery(CommandList));
+
     // In this mode all inner-batch events have device visibility only,
     // and we want the last command in the batch to signal a host-visible
     // event that anybody waiting for any event in the batch will
@@ -1471,6 +1557,8 @@ ur_queue_handle_t_::executeCommandList(ur_command_list_ptr_t CommandList,
       // Reset Command List and erase the Fence forcing the user to resubmit
       // their commands.
       std::vector<ur_event_handle_t> EventListToCleanup;
+      // The timestamps won't be written.
+      CommandList->second.KernelTimestamps = nullptr;
       resetCommandList(CommandList, true, EventListToCleanup, false);
       CleanupEventListFromResetCmdList(EventListToCleanup,
                                        true /* QueueLocked */);
@@ -1518,6 +1606,8 @@ ur_queue_handle_t_::resetDiscardedEvent(ur_command_list_ptr_t CommandList) {
     } catch (...) {
       return UR_RESULT_ERROR_UNKNOWN;
     }
+    UREvent->Pool = LastCommandEvent->Pool;
+    UREvent->PoolIndex = LastCommandEvent->PoolIndex;
 
     if (LastCommandEvent->isHostVisible())
       UREvent->HostVisibleEvent = reinterpret_cast<ur_event_handle_t>(UREvent);
@@ -1587,6 +1677,9 @@ ur_result_t urQueueReleaseInternal(ur_queue_handle_t Queue) {
   if (!Queue->RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
+  if (CompletionReaper::isEnabled())
+    Queue->Context->Reaper.unregisterQueue(Queue);
+
   for (auto &Cache : Queue->EventCaches) {
     for (auto &Event : Cache)
       UR_CALL(urEventReleaseInternal(Event));
@@ -1608,14 +1701,15 @@ ur_result_t urQueueReleaseInternal(ur_queue_handle_t Queue) {
 
   Queue->clearEndTimeRecordings();
 
-  logger::debug("urQueueRelease(compute) NumTimesClosedFull {}, "
-                "NumTimesClosedEarly {}",
-                Queue->ComputeCommandBatch.NumTimesClosedFull,
-                Queue->ComputeCommandBatch.NumTimesClosedEarly);
-  logger::debug(
-      "urQueueRelease(copy) NumTimesClosedFull {}, NumTimesClosedEarly {}",
-      Queue->CopyCommandBatch.NumTimesClosedFull,
-      Queue->CopyCommandBatch.NumTimesClosedEarly);
+  UR_LOG(DEBUG,
+         "urQueueRelease(compute) NumTimesClosedFull {}, "
+         "NumTimesClosedEarly {}",
+         Queue->ComputeCommandBatch.NumTimesClosedFull,
+         Queue->ComputeCommandBatch.NumTimesClosedEarly);
+  UR_LOG(DEBUG,
+         "urQueueRelease(copy) NumTimesClosedFull {}, NumTimesClosedEarly {}",
+         Queue->CopyCommandBatch.NumTimesClosedFull,
+         Queue->CopyCommandBatch.NumTimesClosedEarly);
 
   delete Queue;
 
@@ -1648,6 +1742,10 @@ bool ur_queue_handle_t_::isImmediateSubmission() const {
   return ((this->Properties & UR_QUEUE_FLAG_SUBMISSION_IMMEDIATE) != 0);
 }
 
+bool ur_queue_handle_t_::isSingleSubmitter() const {
+  return ((this->Properties & UR_QUEUE_FLAG_SINGLE_SUBMITTER_EXP) != 0);
+}
+
 bool ur_queue_handle_t_::isInOrderQueue() const {
   // If out-of-order queue property is not set, then this is a in-order queue.
   return ((this->Properties & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE) ==
@@ -1691,10 +1789,10 @@ ur_result_t ur_queue_handle_t_::synchronize() {
     // wait for all commands previously submitted to this immediate command list
     if (UrL0QueueSyncNonBlocking) {
       Queue->Mutex.unlock();
-      ZE2UR_CALL(zeCommandListHostSynchronize, (ImmCmdList->first, UINT64_MAX));
+      ZE2UR_CALL(zeHostSynchronize, (ImmCmdList->first));
       Queue->Mutex.lock();
     } else {
-      ZE2UR_CALL(zeCommandListHostSynchronize, (ImmCmdList->first, UINT64_MAX));
+      ZE2UR_CALL(zeHostSynchronize, (ImmCmdList->first));
     }
 
     // Cleanup all events from the synced command list.
@@ -1890,11 +1988,30 @@ ur_result_t createEventAndAssociateQueue(ur_queue_handle_t Queue,
         Queue->Context, Queue, IsMultiDevice, HostVisible.value(), Event,
         Queue->CounterBasedEventsEnabled, false /*ForceDisableProfiling*/));
 
+  // Proxy events signal the commands of a batch, they aren't commands
+  if (CommandType != UR_EXT_COMMAND_TYPE_USER)
+    Queue->Stats.onCommand();
+
   (*Event)->UrQueue = Queue;
   (*Event)->CommandType = CommandType;
   (*Event)->IsDiscarded = IsInternal;
   (*Event)->IsMultiDevice = IsMultiDevice;
   (*Event)->CommandList = CommandList;
+
+  // Reused discarded events are reset by the device before the host sees them
+  // completed, along with their timestamps.
+  if (isL0ActivityEnabled() && CommandType != UR_EXT_COMMAND_TYPE_USER &&
+      !(IsInternal && Queue->doReuseDiscardedEvents()) &&
+      CommandList != Queue->CommandListMap.end()) {
+    auto &Submit = (*Event)->ActivitySubmit;
+    Submit.Submit = getL0ActivityTime();
+    Submit.Thread = std::this_thread::get_id();
+    Submit.Engine = CommandList->second.isCopy(Queue)
+                        ? l0_activity_record_t::Copy
+                        : l0_activity_record_t::Compute;
+    Submit.Ordinal = CommandList->second.ZeQueueDesc.ordinal;
+    Submit.Index = CommandList->second.ZeQueueDesc.index;
+  }
   // Discarded event doesn't own ze_event, it is used by multiple
   // ur_event_handle_t objects. We destroy corresponding ze_event by releasing
   // events from the events cache at queue destruction. Event in the cache owns
@@ -1930,29 +2047,63 @@ ur_result_t createEventAndAssociateQueue(ur_queue_handle_t Queue,
 }
 
 void ur_queue_handle_t_::CaptureIndirectAccesses() {
+  auto Plt = Device->Platform;
   for (auto &Kernel : KernelsToBeSubmitted) {
     if (!Kernel->hasIndirectAccess())
       continue;
 
-    auto &Contexts = Device->Platform->Contexts;
-    for (auto &Ctx : Contexts) {
-      for (auto &Elem : Ctx->MemAllocs) {
-        const auto &Pair = Kernel->MemAllocs.insert(&Elem);
-        // Kernel is referencing this memory allocation from now.
-        // If this memory allocation was already captured for this kernel, it
-        // means that kernel is submitted several times. Increase reference
-        // count only once because we release all allocations only when
-        // SubmissionsCount turns to 0. We don't want to know how many times
-        // allocation was retained by each submission.
-        if (Pair.second)
-          Elem.second.RefCount.increment();
-      }
+    // Kernel may reference any memory allocation from now, which defers the
+    // frees from the current epoch on until SubmissionsCount turns to 0. Only
+    // the epoch of the oldest submission in flight matters, so a kernel
+    // submitted several times is counted once.
+    if (Kernel->SubmissionsCount++ == 0) {
+      Kernel->IndirectAccessEpoch = Plt->IndirectAccessEpoch;
+      Plt->IndirectAccessKernels[Kernel->IndirectAccessEpoch]++;
     }
-    Kernel->SubmissionsCount++;
   }
   KernelsToBeSubmitted.clear();
 }
 
+ur_result_t ur_queue_handle_t_::appendKernelTimestampsQuery(
+    ur_command_list_ptr_t CommandList) {
+  std::vector<ur_event_handle_t> Events;
+  std::vector<ze_event_handle_t> ZeEvents;
+  for (auto &Event : CommandList->second.EventList) {
+    // Discarded events are reset for reuse, and the inner batched events are
+    // only signalled after the copy, which waits for the events.
+    if (!Event->isProfilingEnabled() || Event->IsDiscarded ||
+        Event->IsInnerBatchedEvent || Event->isTimestamped() ||
+        Event->CommandType == UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP)
+      continue;
+    Events.push_back(Event);
+    ZeEvents.push_back(Event->ZeEvent);
+  }
+  if (Events.empty())
+    return UR_RESULT_SUCCESS;
+
+  ze_kernel_timestamp_result_t *Timestamps = nullptr;
+  ZeStruct<ze_host_mem_alloc_desc_t> ZeDesc;
+  ZE2UR_CALL(zeMemAllocHost,
+             (Context->ZeContext, &ZeDesc,
+              Events.size() * sizeof(ze_kernel_timestamp_result_t), 1,
+              reinterpret_cast<void **>(&Timestamps)));
+  auto KernelTimestamps =
+      std::make_shared<ur_kernel_timestamps_t>(Context->ZeContext, Timestamps);
+
+  uint32_t NumEvents = static_cast<uint32_t>(ZeEvents.size());
+  ZE2UR_CALL(zeCommandListAppendQueryKernelTimestamps,
+             (CommandList->first, NumEvents, ZeEvents.data(), Timestamps,
+              nullptr, nullptr, NumEvents, ZeEvents.data()));
+
+  for (uint32_t I = 0; I < NumEvents; ++I) {
+    std::scoped_lock<ur_shared_mutex> EventLock(Events[I]->Mutex);
+    Events[I]->KernelTimestamps = KernelTimestamps;
+    Events[I]->KernelTimestampsIndex = I;
+  }
+  CommandList->second.KernelTimestamps = std::move(KernelTimestamps);
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_queue_handle_t_::signalEventFromCmdListIfLastEventDiscarded(
     ur_command_list_ptr_t CommandList) {
   // We signal new event at the end of command list only if we have queue with
@@ -1985,6 +2136,7 @@ ur_result_t ur_queue_handle_t_::executeOpenCommandList(bool IsCopy) {
   // queue, then close and execute that command list now.
   if (hasOpenCommandList(IsCopy)) {
     adjustBatchSizeForPartialBatch(IsCopy);
+    (IsCopy ? CopyBatchesFlushedEarly : ComputeBatchesFlushedEarly).add();
     auto Res =
         executeCommandList(CommandBatch.OpenCommandList, false /*IsBlocking*/,
                            false /*OKToBatchCommand*/);
@@ -2009,6 +2161,12 @@ ur_result_t ur_queue_handle_t_::resetCommandList(
     ZE2UR_CALL(zeCommandListReset, (CommandList->first));
     CommandList->second.ZeFenceInUse = false;
     CommandList->second.IsClosed = false;
+
+    // The timestamps copied out by the command list are now written.
+    if (auto &Timestamps = CommandList->second.KernelTimestamps) {
+      Timestamps->Ready = true;
+      Timestamps = nullptr;
+    }
   }
 
   auto &EventList = CommandList->second.EventList;
@@ -2082,16 +2240,12 @@ ur_result_t ur_queue_handle_t_::resetCommandList(
   // Standard commandlists move in and out of the cache as they are recycled.
   // Immediate commandlists are always available.
   if (CommandList->second.ZeFence != nullptr && MakeAvailable) {
-    std::scoped_lock<ur_mutex> Lock(this->Context->ZeCommandListCacheMutex);
-    auto &ZeCommandListCache =
-        UseCopyEngine
-            ? this->Context->ZeCopyCommandListCache[this->Device->ZeDevice]
-            : this->Context->ZeComputeCommandListCache[this->Device->ZeDevice];
     struct l0_command_list_cache_info ListInfo;
     ListInfo.ZeQueueDesc = CommandList->second.ZeQueueDesc;
     ListInfo.InOrderList = CommandList->second.IsInOrderList;
     ListInfo.IsImmediate = CommandList->second.IsImmediate;
-    ZeCommandListCache.push_back({CommandList->first, ListInfo});
+    this->Context->getCommandListCache(this->Device->ZeDevice, UseCopyEngine)
+        .add(CommandList->first, ListInfo);
   }
 
   return UR_RESULT_SUCCESS;
@@ -2227,10 +2381,11 @@ ur_queue_handle_t_::ur_queue_group_t::getZeQueue(uint32_t *QueueGroupOrdinal) {
     ZeCommandQueueDesc.flags = ZE_COMMAND_QUEUE_FLAG_EXPLICIT_ONLY;
   }
 
-  logger::debug("[getZeQueue]: create queue ordinal = {}, index = {} "
-                "(round robin in [{}, {}]) priority = {}",
-                ZeCommandQueueDesc.ordinal, ZeCommandQueueDesc.index,
-                LowerIndex, UpperIndex, Priority);
+  UR_LOG(DEBUG,
+         "[getZeQueue]: create queue ordinal = {}, index = {} "
+         "(round robin in [{}, {}]) priority = {}",
+         ZeCommandQueueDesc.ordinal, ZeCommandQueueDesc.index, LowerIndex,
+         UpperIndex, Priority);
 
   auto ZeResult = ZE_CALL_NOCHECK(
       zeCommandQueueCreate, (Queue->Context->ZeContext, Queue->Device->ZeDevice,
@@ -2419,37 +2574,17 @@ ur_command_list_ptr_t &ur_queue_handle_t_::ur_queue_group_t::getImmCmdList() {
 
   // Check if context's command list cache has an immediate command list with
   // matching index.
-  ze_command_list_handle_t ZeCommandList = nullptr;
-  {
-    // Acquire lock to avoid race conditions.
-    std::scoped_lock<ur_mutex> Lock(Queue->Context->ZeCommandListCacheMutex);
-    // Under mutex since operator[] does insertion on the first usage for every
-    // unique ZeDevice.
-    auto &ZeCommandListCache =
-        isCopy()
-            ? Queue->Context->ZeCopyCommandListCache[Queue->Device->ZeDevice]
-            : Queue->Context
-                  ->ZeComputeCommandListCache[Queue->Device->ZeDevice];
-    for (auto ZeCommandListIt = ZeCommandListCache.begin();
-         ZeCommandListIt != ZeCommandListCache.end(); ++ZeCommandListIt) {
-      const auto &Desc = (*ZeCommandListIt).second.ZeQueueDesc;
-      if (Desc.index == ZeCommandQueueDesc.index &&
-          Desc.flags == ZeCommandQueueDesc.flags &&
-          Desc.mode == ZeCommandQueueDesc.mode &&
-          Desc.priority == ZeCommandQueueDesc.priority) {
-        ZeCommandList = (*ZeCommandListIt).first;
-        ZeCommandListCache.erase(ZeCommandListIt);
-        break;
-      }
-    }
-  }
+  ze_command_list_handle_t ZeCommandList =
+      Queue->Context->getCommandListCache(Queue->Device->ZeDevice, isCopy())
+          .takeImmediate(ZeCommandQueueDesc);
 
   // If cache didn't contain a command list, create one.
   if (!ZeCommandList) {
-    logger::debug("[getZeQueue]: create queue ordinal = {}, index = {} "
-                  "(round robin in [{}, {}]) priority = {}",
-                  ZeCommandQueueDesc.ordinal, ZeCommandQueueDesc.index,
-                  LowerIndex, UpperIndex, Priority);
+    UR_LOG(DEBUG,
+           "[getZeQueue]: create queue ordinal = {}, index = {} "
+           "(round robin in [{}, {}]) priority = {}",
+           ZeCommandQueueDesc.ordinal, ZeCommandQueueDesc.index, LowerIndex,
+           UpperIndex, Priority);
 
     ZE_CALL_NOCHECK(zeCommandListCreateImmediate,
                     (Queue->Context->ZeContext, Queue->Device->ZeDevice,
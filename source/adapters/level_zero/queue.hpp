@@ -9,9 +9,11 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <cassert>
 #include <list>
 #include <map>
+#include <memory>
 #include <optional>
 #include <queue>
 #include <stdarg.h>
@@ -26,6 +28,7 @@
 
 #include "common.hpp"
 #include "device.hpp"
+#include "ur_queue_stats.hpp"
 
 extern "C" {
 ur_result_t urQueueReleaseInternal(ur_queue_handle_t Queue);
@@ -154,6 +157,29 @@ ur_result_t CleanupEventsInImmCmdLists(ur_queue_handle_t UrQueue,
                                        bool QueueLocked, bool QueueSynced,
                                        ur_event_handle_t CompletedEvent);
 
+// Kernel timestamps of the profiled events of a command list, which the
+// device copies out at the end of the command list when
+// UR_L0_BATCHED_PROFILING is set, so that the profiling info of these events
+// doesn't need a query of each event. Shared by the events and the command
+// list, which marks them ready once it completed.
+struct ur_kernel_timestamps_t {
+  ur_kernel_timestamps_t(ze_context_handle_t ZeContext,
+                         ze_kernel_timestamp_result_t *Timestamps)
+      : ZeContext(ZeContext), Timestamps(Timestamps) {}
+  ~ur_kernel_timestamps_t() {
+    ZE_CALL_NOCHECK(zeMemFree, (ZeContext, Timestamps));
+  }
+
+  ur_kernel_timestamps_t(const ur_kernel_timestamps_t &) = delete;
+  ur_kernel_timestamps_t &operator=(const ur_kernel_timestamps_t &) = delete;
+
+  ze_context_handle_t ZeContext;
+  // Host allocation written by the device
+  ze_kernel_timestamp_result_t *Timestamps;
+  // Whether the device wrote the timestamps
+  std::atomic<bool> Ready{false};
+};
+
 // Structure describing the specific use of a command-list in a queue.
 // This is because command-lists are re-used across multiple queues
 // in the same context.
@@ -216,6 +242,9 @@ struct ur_command_list_info_t {
   std::vector<ur_event_handle_t> EventList;
   size_t size() const { return EventList.size(); }
   void append(ur_event_handle_t Event);
+
+  // Kernel timestamps copied out by the command list being executed, if any.
+  std::shared_ptr<ur_kernel_timestamps_t> KernelTimestamps;
 };
 
 // The map type that would track all command-lists in a queue.
@@ -330,6 +359,23 @@ struct ur_queue_handle_t_ : _ur_object {
   // is created for each thread. The key used for mapping is the thread ID.
   pi_queue_group_by_tid_t ComputeQueueGroupsByTID;
 
+  // The compute engine the queue is pinned to by UR_L0_PLACE_IN_ORDER_QUEUES,
+  // if any, which is unplaced along with the queue, including when its
+  // constructor throws.
+  struct placed_compute_engine_t {
+    ur_device_handle_t Device = nullptr;
+    int32_t Index = -1;
+
+    placed_compute_engine_t() = default;
+    placed_compute_engine_t(const placed_compute_engine_t &) = delete;
+    placed_compute_engine_t &
+    operator=(const placed_compute_engine_t &) = delete;
+    ~placed_compute_engine_t() {
+      if (Index >= 0)
+        Device->unplaceQueue(Index);
+    }
+  } PlacedComputeEngine;
+
   // A group containing copy queue handles. The main copy engine, if available,
   // comes first followed by link copy engines, if available.
   // When a queue is accessed from multiple host threads, a separate queue group
@@ -478,6 +524,10 @@ struct ur_queue_handle_t_ : _ur_object {
   // are never closed unlike regular command lists.
   ur_command_list_ptr_t LastUsedCommandList = CommandListMap.end();
 
+  // Submission statistics, a submission being the execution of a regular
+  // command list or a command appended to an immediate command list
+  ur::queue_stats Stats;
+
   // Vector of 2 lists of reusable events: host-visible and device-scope.
   // They are separated to allow faster access to stored events depending on
   // requested type of event. Each list contains events which can be reused
@@ -565,6 +615,10 @@ struct ur_queue_handle_t_ : _ur_object {
   bool isBatchedSubmission() const;
   bool isImmediateSubmission() const;
 
+  // Returns true if the application uses the queue from one thread at a time,
+  // in which case the queue isn't locked.
+  bool isSingleSubmitter() const;
+
   // Wait for all commandlists associated with this Queue to finish operations.
   [[nodiscard]] ur_result_t synchronize();
 
@@ -588,15 +642,16 @@ struct ur_queue_handle_t_ : _ur_object {
     return CommandBatch.OpenCommandList != CommandListMap.end();
   }
 
-  // Update map of memory references made by the kernels about to be submitted
+  // Records the kernels about to be submitted in the indirect access epochs of
+  // the platform, whose ContextsMutex must be locked by the caller.
   void CaptureIndirectAccesses();
 
   // Kernel is not necessarily submitted for execution during
   // urEnqueueKernelLaunch, it may be batched. That's why we need to save the
   // list of kernels which is going to be submitted but have not been submitted
-  // yet. This is needed to capture memory allocations for each kernel with
-  // indirect access in the list at the moment when kernel is really submitted
-  // for execution.
+  // yet. This is needed to defer the frees of memory allocations for each
+  // kernel with indirect access in the list from the moment when kernel is
+  // really submitted for execution.
   std::vector<ur_kernel_handle_t> KernelsToBeSubmitted;
 
   // Append command to the command list to signal new event if the last event in
@@ -606,6 +661,10 @@ struct ur_queue_handle_t_ : _ur_object {
   // it in the new command list using barrier.
   ur_result_t signalEventFromCmdListIfLastEventDiscarded(ur_command_list_ptr_t);
 
+  // Appends to a standard command list the copy of the kernel timestamps of
+  // its profiled events, see ur_kernel_timestamps_t.
+  ur_result_t appendKernelTimestampsQuery(ur_command_list_ptr_t CommandList);
+
   // If there is an open command list associated with this queue,
   // close it, execute it, and reset the corresponding OpenCommandList.
   // If IsCopy is 'true', then the OpenCommandList containing copy commands is
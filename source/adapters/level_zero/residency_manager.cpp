@@ -0,0 +1,205 @@
+//===--------- residency_manager.cpp - Level Zero Adapter -----------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdlib>
+#include <unordered_set>
+
+#include "context.hpp"
+#include "event.hpp"
+#include "logger/ur_logger.hpp"
+#include "residency_manager.hpp"
+
+size_t ResidencyManager::budget() {
+  static const size_t Budget = [] {
+    const char *BudgetStr = std::getenv("UR_L0_USM_RESIDENCY_BUDGET");
+    if (!BudgetStr)
+      return size_t{0};
+    long long BudgetMB = std::atoll(BudgetStr);
+    return BudgetMB > 0 ? size_t(BudgetMB) << 20 : size_t{0};
+  }();
+  return Budget;
+}
+
+void ResidencyManager::registerAllocation(void *Ptr, size_t Size) {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+  Allocations[static_cast<char *>(Ptr)] = Allocation{Size};
+}
+
+ur_event_handle_t ResidencyManager::unregisterAllocation(void *Ptr) {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+  auto It = Allocations.find(static_cast<char *>(Ptr));
+  if (It == Allocations.end())
+    return nullptr;
+
+  // Freeing the allocation evicts it from all the devices
+  for (auto &[ZeDevice, Residency] : Devices) {
+    auto ResidentIt = Residency.Resident.find(It->first);
+    if (ResidentIt == Residency.Resident.end())
+      continue;
+    Residency.LRU.erase(ResidentIt->second);
+    Residency.Resident.erase(ResidentIt);
+    Residency.ResidentBytes -= It->second.Size;
+  }
+  auto LastUse = It->second.LastUse;
+  Allocations.erase(It);
+  return LastUse;
+}
+
+bool ResidencyManager::isCompleted(
+    ur_event_handle_t &Event, std::vector<ur_event_handle_t> &EventsToRelease) {
+  if (!Event)
+    return true;
+
+  // Only host-visible events can be queried, the others are idle once cleaned
+  // up by their queue.
+  bool Completed;
+  {
+    std::shared_lock<ur_shared_mutex> EventLock(Event->Mutex);
+    Completed = Event->Completed;
+    if (!Completed && Event->HostVisibleEvent) {
+      auto ZeResult = ZE_CALL_NOCHECK(zeEventQueryStatus,
+                                      (Event->HostVisibleEvent->ZeEvent));
+      Completed = ZeResult == ZE_RESULT_SUCCESS;
+    }
+  }
+  if (!Completed)
+    return false;
+
+  EventsToRelease.push_back(Event);
+  Event = nullptr;
+  return true;
+}
+
+bool ResidencyManager::isIdle(Allocation &Alloc,
+                              std::vector<ur_event_handle_t> &EventsToRelease) {
+  return isCompleted(AllLastUse, EventsToRelease) &&
+         isCompleted(Alloc.LastUse, EventsToRelease);
+}
+
+ur_result_t
+ResidencyManager::evict(ze_context_handle_t ZeContext,
+                        ze_device_handle_t ZeDevice, DeviceResidency &Residency,
+                        size_t Size,
+                        std::vector<ur_event_handle_t> &EventsToRelease) {
+  // Nothing is idle while a use of all the allocations is pending
+  if (Residency.ResidentBytes + Size <= budget() ||
+      !isCompleted(AllLastUse, EventsToRelease))
+    return UR_RESULT_SUCCESS;
+
+  auto It = Residency.LRU.begin();
+  while (Residency.ResidentBytes + Size > budget() &&
+         It != Residency.LRU.end()) {
+    auto &Alloc = Allocations.at(*It);
+    if (!isIdle(Alloc, EventsToRelease)) {
+      ++It;
+      continue;
+    }
+    ZE2UR_CALL(zeContextEvictMemory, (ZeContext, ZeDevice, *It, Alloc.Size));
+    Residency.ResidentBytes -= Alloc.Size;
+    Residency.Resident.erase(*It);
+    It = Residency.LRU.erase(It);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ResidencyManager::makeAllocationResident(
+    ze_context_handle_t ZeContext, ze_device_handle_t ZeDevice,
+    DeviceResidency &Residency, char *Ptr, size_t Size,
+    std::vector<ur_event_handle_t> &EventsToRelease) {
+  auto ResidentIt = Residency.Resident.find(Ptr);
+  if (ResidentIt != Residency.Resident.end()) {
+    Residency.LRU.splice(Residency.LRU.end(), Residency.LRU,
+                         ResidentIt->second);
+    return UR_RESULT_SUCCESS;
+  }
+
+  UR_CALL(evict(ZeContext, ZeDevice, Residency, Size, EventsToRelease));
+  if (Residency.ResidentBytes + Size > budget()) {
+    UR_LOG(DEBUG,
+           "USM residency budget exceeded, {} bytes resident on device {}",
+           Residency.ResidentBytes + Size, ur_cast<std::uintptr_t>(ZeDevice));
+  }
+  ZE2UR_CALL(zeContextMakeMemoryResident, (ZeContext, ZeDevice, Ptr, Size));
+  Residency.ResidentBytes += Size;
+  Residency.Resident[Ptr] = Residency.LRU.insert(Residency.LRU.end(), Ptr);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ResidencyManager::makeResident(
+    ze_context_handle_t ZeContext, ze_device_handle_t ZeDevice,
+    const std::vector<const void *> &Ptrs, bool AllAllocations,
+    ur_event_handle_t Event, std::vector<ur_event_handle_t> &EventsToRelease) {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+
+  // Once all the allocations are resident on the device, as they stay while
+  // launches keep using all of them, such a launch only replaces AllLastUse.
+  if (AllAllocations) {
+    if (AllLastUse)
+      EventsToRelease.push_back(AllLastUse);
+    Event->RefCount.increment();
+    AllLastUse = Event;
+
+    auto &Residency = Devices[ZeDevice];
+    if (Residency.Resident.size() == Allocations.size())
+      return UR_RESULT_SUCCESS;
+    for (auto &[Ptr, Alloc] : Allocations) {
+      if (!Residency.Resident.count(Ptr))
+        UR_CALL(makeAllocationResident(ZeContext, ZeDevice, Residency, Ptr,
+                                       Alloc.Size, EventsToRelease));
+    }
+    return UR_RESULT_SUCCESS;
+  }
+
+  // Find the allocations used, keeping the order of the arguments.
+  std::vector<std::map<char *, Allocation>::iterator> Used;
+  std::unordered_set<char *> Seen;
+  for (auto Ptr : Ptrs) {
+    auto P = static_cast<char *>(const_cast<void *>(Ptr));
+    auto It = Allocations.upper_bound(P);
+    if (It == Allocations.begin())
+      continue;
+    --It;
+    if (P >= It->first + It->second.Size || !Seen.insert(It->first).second)
+      continue;
+    Used.push_back(It);
+  }
+  if (Used.empty())
+    return UR_RESULT_SUCCESS;
+
+  // Mark them used by Event first, so that none is evicted for another.
+  for (auto It : Used) {
+    if (It->second.LastUse)
+      EventsToRelease.push_back(It->second.LastUse);
+    Event->RefCount.increment();
+    It->second.LastUse = Event;
+  }
+
+  auto &Residency = Devices[ZeDevice];
+  for (auto It : Used) {
+    UR_CALL(makeAllocationResident(ZeContext, ZeDevice, Residency, It->first,
+                                   It->second.Size, EventsToRelease));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+std::vector<ur_event_handle_t> ResidencyManager::takeAll() {
+  std::scoped_lock<std::mutex> Lock(Mutex);
+  std::vector<ur_event_handle_t> Events;
+  for (auto &[Ptr, Alloc] : Allocations) {
+    if (Alloc.LastUse)
+      Events.push_back(Alloc.LastUse);
+  }
+  if (AllLastUse)
+    Events.push_back(AllLastUse);
+  AllLastUse = nullptr;
+  Allocations.clear();
+  Devices.clear();
+  return Events;
+}
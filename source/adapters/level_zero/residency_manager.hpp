@@ -0,0 +1,110 @@
+//===--------- residency_manager.hpp - Level Zero Adapter -----------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <list>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include <ur_api.h>
+#include <ze_api.h>
+
+// Residency of the shared USM allocations of a context on its devices. Instead
+// of being made resident when allocated, which doesn't scale past the device
+// memory, allocations are made resident on the device of the kernels using
+// them, and the least recently used ones are evicted once the resident bytes
+// would exceed the budget set by UR_L0_USM_RESIDENCY_BUDGET (in MB per device).
+// Only the allocations whose last use completed are evicted, so the budget is
+// exceeded rather than evicting memory in use.
+class ResidencyManager {
+public:
+  ResidencyManager() = default;
+
+  ResidencyManager(const ResidencyManager &) = delete;
+  ResidencyManager &operator=(const ResidencyManager &) = delete;
+
+  static bool isEnabled() { return budget() != 0; }
+
+  // Bytes which may be resident on each device, 0 if residency isn't managed
+  static size_t budget();
+
+  // Starts tracking a shared allocation, which isn't resident anywhere yet
+  void registerAllocation(void *Ptr, size_t Size);
+
+  // Stops tracking the allocation at Ptr, before it is freed. Returns the event
+  // of its last use, to be released by the caller, or nullptr.
+  ur_event_handle_t unregisterAllocation(void *Ptr);
+
+  // Makes the allocations containing Ptrs, or all the allocations if
+  // AllAllocations is set, resident on ZeDevice for the command of Event,
+  // evicting the least recently used ones to stay within the budget. The
+  // events of the previous uses, which the caller holds the locks of the
+  // queues of, are appended to EventsToRelease, to be released once these
+  // locks are dropped.
+  ur_result_t makeResident(ze_context_handle_t ZeContext,
+                           ze_device_handle_t ZeDevice,
+                           const std::vector<const void *> &Ptrs,
+                           bool AllAllocations, ur_event_handle_t Event,
+                           std::vector<ur_event_handle_t> &EventsToRelease);
+
+  // Stops tracking all the allocations. Returns the events of their last uses,
+  // to be released by the caller.
+  std::vector<ur_event_handle_t> takeAll();
+
+private:
+  struct Allocation {
+    size_t Size;
+    // Retained event of the last command using the allocation, or nullptr
+    // once that command is known to have completed.
+    ur_event_handle_t LastUse = nullptr;
+  };
+
+  struct DeviceResidency {
+    // Resident allocations, the least recently used first
+    std::list<char *> LRU;
+    std::unordered_map<char *, std::list<char *>::iterator> Resident;
+    size_t ResidentBytes = 0;
+  };
+
+  // Whether the command of Event completed, in which case Event is appended
+  // to EventsToRelease and reset.
+  bool isCompleted(ur_event_handle_t &Event,
+                   std::vector<ur_event_handle_t> &EventsToRelease);
+
+  // Whether the last use of Alloc, and the last use of all the allocations,
+  // completed.
+  bool isIdle(Allocation &Alloc,
+              std::vector<ur_event_handle_t> &EventsToRelease);
+
+  // Makes the allocation at Ptr resident on ZeDevice if it isn't already,
+  // evicting others to stay within the budget.
+  ur_result_t makeAllocationResident(
+      ze_context_handle_t ZeContext, ze_device_handle_t ZeDevice,
+      DeviceResidency &Residency, char *Ptr, size_t Size,
+      std::vector<ur_event_handle_t> &EventsToRelease);
+
+  // Evicts the least recently used idle allocations of Residency until Size
+  // more bytes fit in the budget, or none is left.
+  ur_result_t evict(ze_context_handle_t ZeContext, ze_device_handle_t ZeDevice,
+                    DeviceResidency &Residency, size_t Size,
+                    std::vector<ur_event_handle_t> &EventsToRelease);
+
+  std::mutex Mutex;
+  // Tracked allocations by start address, for finding the ones containing the
+  // pointers passed to kernels, which may be inside the slabs of the pools.
+  std::map<char *, Allocation> Allocations;
+  // Retained event of the last command using all the allocations, which
+  // stands for it in their own LastUse so that these launches don't go
+  // through all of them.
+  ur_event_handle_t AllLastUse = nullptr;
+  std::unordered_map<ze_device_handle_t, DeviceResidency> Devices;
+};
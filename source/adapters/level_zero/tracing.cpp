@@ -0,0 +1,140 @@
+//===--------- tracing.cpp - Level Zero Device Activity Tracing -----------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#ifdef XPTI_ENABLE_INSTRUMENTATION
+#include <xpti/xpti_data_types.h>
+#include <xpti/xpti_trace_framework.h>
+#endif
+
+#include <atomic>
+#include <chrono>
+#include <cstdlib>
+#include <mutex>
+#include <unordered_map>
+
+#include "device.hpp"
+#include "tracing.hpp"
+
+#ifdef XPTI_ENABLE_INSTRUMENTATION
+constexpr auto L0_ACTIVITY_STREAM_NAME = "sycl.experimental.level_zero.activity";
+
+constexpr auto GVerStr = "0.1";
+constexpr int GMajVer = 0;
+constexpr int GMinVer = 1;
+
+static xpti_td *ActivityEvent = nullptr;
+#endif // XPTI_ENABLE_INSTRUMENTATION
+
+static std::atomic<bool> ActivityEnabled{false};
+
+// A pair of host and device times read together, from which the host times of
+// nearby kernel timestamps are derived. Kernel timestamps only have
+// kernelTimestampValidBits bits, which wrap around within minutes, so the
+// device time is kept in ticks and the pair is read again every few
+// milliseconds.
+struct activity_clock_t {
+  uint64_t HostTime = 0;
+  uint64_t DeviceTicks = 0;
+};
+
+constexpr uint64_t ActivityClockPeriod = 10'000'000; // 10ms
+
+static std::mutex ActivityClocksMutex;
+static std::unordered_map<ur_device_handle_t, activity_clock_t> ActivityClocks;
+
+uint64_t getL0ActivityTime() {
+  return std::chrono::duration_cast<std::chrono::nanoseconds>(
+             std::chrono::steady_clock::now().time_since_epoch())
+      .count();
+}
+
+void enableL0Activity() {
+#ifdef XPTI_ENABLE_INSTRUMENTATION
+  if (std::getenv("UR_L0_TRACE_ACTIVITY") == nullptr || !xptiTraceEnabled())
+    return;
+
+  xptiRegisterStream(L0_ACTIVITY_STREAM_NAME);
+  xptiInitialize(L0_ACTIVITY_STREAM_NAME, GMajVer, GMinVer, GVerStr);
+
+  uint64_t Dummy;
+  xpti::payload_t L0ActivityPayload("Level Zero Adapter Activity Layer");
+  ActivityEvent = xptiMakeEvent("Level Zero Adapter Activity Layer",
+                                &L0ActivityPayload, xpti::trace_algorithm_event,
+                                xpti_at::active, &Dummy);
+  ActivityEnabled = true;
+#endif // XPTI_ENABLE_INSTRUMENTATION
+}
+
+void disableL0Activity() {
+#ifdef XPTI_ENABLE_INSTRUMENTATION
+  if (!ActivityEnabled.exchange(false))
+    return;
+
+  {
+    std::lock_guard<std::mutex> Guard(ActivityClocksMutex);
+    ActivityClocks.clear();
+  }
+  xptiFinalize(L0_ACTIVITY_STREAM_NAME);
+#endif // XPTI_ENABLE_INSTRUMENTATION
+}
+
+bool isL0ActivityEnabled() {
+  return ActivityEnabled.load(std::memory_order_relaxed);
+}
+
+void notifyL0Activity(ur_device_handle_t Device, l0_activity_record_t &Record,
+                      uint64_t StartTicks, uint64_t EndTicks) {
+#ifdef XPTI_ENABLE_INSTRUMENTATION
+  if (!isL0ActivityEnabled())
+    return;
+
+  uint64_t Now = getL0ActivityTime();
+  activity_clock_t Clock;
+  {
+    std::lock_guard<std::mutex> Guard(ActivityClocksMutex);
+    auto &Cached = ActivityClocks[Device];
+    if (Now - Cached.HostTime > ActivityClockPeriod) {
+      uint64_t HostTimestamp;
+      if (ZE_CALL_NOCHECK(zeDeviceGetGlobalTimestamps,
+                          (Device->ZeDevice, &HostTimestamp,
+                           &Cached.DeviceTicks)) != ZE_RESULT_SUCCESS)
+        return;
+      Cached.HostTime = getL0ActivityTime();
+    }
+    Clock = Cached;
+  }
+
+  // The difference from the clock, taken modulo the valid bits, is negative
+  // for the timestamps written after the clock was read.
+  const uint64_t Mask = Device->getTimestampMask();
+  const uint64_t Resolution = Device->ZeDeviceProperties->timerResolution;
+  auto toHostTime = [&](uint64_t Ticks) {
+    uint64_t Delta = (Ticks - Clock.DeviceTicks) & Mask;
+    int64_t Signed = Delta > Mask / 2 ? -static_cast<int64_t>(Mask - Delta + 1)
+                                      : static_cast<int64_t>(Delta);
+    return Clock.HostTime + Signed * static_cast<int64_t>(Resolution);
+  };
+  Record.Start = toHostTime(StartTicks);
+  Record.End = toHostTime(EndTicks);
+  if (Record.End < Record.Start)
+    Record.End = Record.Start;
+  Record.Device = Device;
+  Record.DeviceName = Device->ZeDeviceProperties->name;
+
+  uint8_t ActivityStreamID = xptiRegisterStream(L0_ACTIVITY_STREAM_NAME);
+  xptiNotifySubscribers(ActivityStreamID, xpti::trace_signal, ActivityEvent,
+                        nullptr, 0, &Record);
+#else
+  (void)Device;
+  (void)Record;
+  (void)StartTicks;
+  (void)EndTicks;
+#endif // XPTI_ENABLE_INSTRUMENTATION
+}
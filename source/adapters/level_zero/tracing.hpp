@@ -0,0 +1,67 @@
+//===--------- tracing.hpp - Level Zero Device Activity Tracing -----------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <thread>
+
+#include <ur_api.h>
+
+// Device activity notified with xpti::trace_signal on the
+// "sycl.experimental.level_zero.activity" stream when UR_L0_TRACE_ACTIVITY is
+// set. Queues then record kernel timestamps for all their commands as if they
+// were created with UR_QUEUE_FLAG_PROFILING_ENABLE, and a record is notified,
+// with an instance of 0, once the command is seen completed. All times are
+// std::chrono::steady_clock nanoseconds of the host, so that they line up with
+// the host spans of the calls which enqueued the commands.
+struct l0_activity_record_t {
+  enum engine_t : uint32_t { Compute, Copy };
+
+  ur_command_t Command;
+  // Name of the kernel, nullptr for other commands
+  const char *Name;
+  // When the command was enqueued, and by which thread
+  uint64_t Submit;
+  std::thread::id Thread;
+  // When the device started and ended executing the command
+  uint64_t Start;
+  uint64_t End;
+  ur_device_handle_t Device;
+  const char *DeviceName;
+  // Engine of the device which executed the command, the ordinal of its
+  // queue group and its index in the group
+  engine_t Engine;
+  uint32_t Ordinal;
+  uint32_t Index;
+};
+
+// Where a traced command was enqueued, kept by its event until it completes.
+// Submit is 0 for the commands which aren't traced.
+struct l0_activity_submit_t {
+  uint64_t Submit = 0;
+  std::thread::id Thread;
+  l0_activity_record_t::engine_t Engine = l0_activity_record_t::Compute;
+  uint32_t Ordinal = 0;
+  uint32_t Index = 0;
+};
+
+// Initialize the activity stream if UR_L0_TRACE_ACTIVITY is set and a
+// subscriber is listening, along with the adapter.
+void enableL0Activity();
+void disableL0Activity();
+bool isL0ActivityEnabled();
+
+// Current host time, as used by the records
+uint64_t getL0ActivityTime();
+
+// Notifies the activity of a command which the device started and ended at
+// the kernel timestamps StartTicks and EndTicks, filling in Record's times.
+void notifyL0Activity(ur_device_handle_t Device, l0_activity_record_t &Record,
+                      uint64_t StartTicks, uint64_t EndTicks);
@@ -66,6 +66,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
   pDdiTable->pfnSampledImageCreateExp =
       ur::level_zero::urBindlessImagesSampledImageCreateExp;
   pDdiTable->pfnImageCopyExp = ur::level_zero::urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageCopyBatchExp =
+      ur::level_zero::urBindlessImagesImageCopyBatchExp;
   pDdiTable->pfnImageGetInfoExp =
       ur::level_zero::urBindlessImagesImageGetInfoExp;
   pDdiTable->pfnMipmapGetLevelExp =
@@ -140,6 +142,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   pDdiTable->pfnGetInfoExp = ur::level_zero::urCommandBufferGetInfoExp;
   pDdiTable->pfnCommandGetInfoExp =
       ur::level_zero::urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnUpdateKernelLaunchBatchExp =
+      ur::level_zero::urCommandBufferUpdateKernelLaunchBatchExp;
+  pDdiTable->pfnUploadExp = ur::level_zero::urCommandBufferUploadExp;
 
   return result;
 }
@@ -217,7 +222,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
       ur::level_zero::urEnqueueCooperativeKernelLaunchExp;
   pDdiTable->pfnTimestampRecordingExp =
       ur::level_zero::urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchMultiExp =
+      ur::level_zero::urEnqueueKernelLaunchMultiExp;
+  pDdiTable->pfnUSMDeviceAllocExp = ur::level_zero::urEnqueueUSMDeviceAllocExp;
+  pDdiTable->pfnUSMFreeExp = ur::level_zero::urEnqueueUSMFreeExp;
   pDdiTable->pfnNativeCommandExp = ur::level_zero::urEnqueueNativeCommandExp;
+  pDdiTable->pfnHostTaskExp = ur::level_zero::urEnqueueHostTaskExp;
+  pDdiTable->pfnIPCEventSignalExp = ur::level_zero::urEnqueueIPCEventSignalExp;
+  pDdiTable->pfnIPCEventWaitExp = ur::level_zero::urEnqueueIPCEventWaitExp;
+  pDdiTable->pfnUSMMemcpyBatchExp = ur::level_zero::urEnqueueUSMMemcpyBatchExp;
 
   return result;
 }
@@ -242,6 +255,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return result;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+
+  pDdiTable->pfnWaitAnyExp = ur::level_zero::urEventWaitAnyExp;
+  pDdiTable->pfnCreateIPCExp = ur::level_zero::urEventCreateIPCExp;
+  pDdiTable->pfnGetIPCHandleExp = ur::level_zero::urEventGetIPCHandleExp;
+  pDdiTable->pfnOpenIPCHandleExp = ur::level_zero::urEventOpenIPCHandleExp;
+
+  return result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
     ur_api_version_t version, ur_kernel_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -281,6 +309,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
       ur::level_zero::urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = ur::level_zero::urKernelSetArgsExp;
 
   return result;
 }
@@ -379,6 +408,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   pDdiTable->pfnBuildExp = ur::level_zero::urProgramBuildExp;
   pDdiTable->pfnCompileExp = ur::level_zero::urProgramCompileExp;
   pDdiTable->pfnLinkExp = ur::level_zero::urProgramLinkExp;
+  pDdiTable->pfnBuildAsyncExp = ur::level_zero::urProgramBuildAsyncExp;
 
   return result;
 }
@@ -403,6 +433,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return result;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+
+  pDdiTable->pfnBeginCaptureExp = ur::level_zero::urQueueBeginCaptureExp;
+  pDdiTable->pfnEndCaptureExp = ur::level_zero::urQueueEndCaptureExp;
+
+  return result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     ur_api_version_t version, ur_sampler_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -449,8 +492,11 @@ UR_APIEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
   }
 
   pDdiTable->pfnPitchedAllocExp = ur::level_zero::urUSMPitchedAllocExp;
+  pDdiTable->pfnGrowableAllocExp = ur::level_zero::urUSMGrowableAllocExp;
+  pDdiTable->pfnGrowExp = ur::level_zero::urUSMGrowExp;
   pDdiTable->pfnImportExp = ur::level_zero::urUSMImportExp;
   pDdiTable->pfnReleaseExp = ur::level_zero::urUSMReleaseExp;
+  pDdiTable->pfnPoolTrimExp = ur::level_zero::urUSMPoolTrimExp;
 
   return result;
 }
@@ -556,6 +602,10 @@ ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
                                                    &ddi->Event);
   if (result != UR_RESULT_SUCCESS)
     return result;
+  result = ur::level_zero::urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->EventExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
   result = ur::level_zero::urGetKernelProcAddrTable(UR_API_VERSION_CURRENT,
                                                     &ddi->Kernel);
   if (result != UR_RESULT_SUCCESS)
@@ -588,6 +638,10 @@ ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi) {
                                                    &ddi->Queue);
   if (result != UR_RESULT_SUCCESS)
     return result;
+  result = ur::level_zero::urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                                      &ddi->QueueExp);
+  if (result != UR_RESULT_SUCCESS)
+    return result;
   result = ur::level_zero::urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
                                                      &ddi->Sampler);
   if (result != UR_RESULT_SUCCESS)
@@ -467,6 +467,10 @@ ur_result_t urUSMPitchedAllocExp(ur_context_handle_t hContext,
                                  ur_usm_pool_handle_t pool, size_t widthInBytes,
                                  size_t height, size_t elementSizeBytes,
                                  void **ppMem, size_t *pResultPitch);
+ur_result_t urUSMGrowableAllocExp(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice, size_t maxSize,
+                                  size_t size, void **ppMem);
+ur_result_t urUSMGrowExp(ur_context_handle_t hContext, void *pMem, size_t size);
 ur_result_t urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     ur_exp_image_native_handle_t hImage);
@@ -499,6 +503,14 @@ ur_result_t urBindlessImagesImageCopyExp(
     ur_exp_image_copy_region_t *pCopyRegion,
     ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
+ur_result_t urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
 ur_result_t urBindlessImagesImageGetInfoExp(
     ur_context_handle_t hContext, ur_exp_image_mem_native_handle_t hImageMem,
     ur_image_info_t propName, void *pPropValue, size_t *pPropSizeRet);
@@ -681,6 +693,14 @@ ur_result_t urCommandBufferCommandGetInfoExp(
     ur_exp_command_buffer_command_handle_t hCommand,
     ur_exp_command_buffer_command_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet);
+ur_result_t urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, uint32_t numKernelUpdates,
+    const ur_exp_command_buffer_command_handle_t *phCommands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch);
+ur_result_t
+urCommandBufferUploadExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                         ur_queue_handle_t hQueue);
 ur_result_t urEnqueueCooperativeKernelLaunchExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
@@ -689,9 +709,20 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
 ur_result_t urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_handle_t hKernel, size_t localWorkSize,
     size_t dynamicSharedMemorySize, uint32_t *pGroupCountRet);
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_t *pArgs);
 ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent);
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent);
 ur_result_t urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -711,6 +742,20 @@ ur_result_t urProgramLinkExp(ur_context_handle_t hContext, uint32_t numDevices,
                              const ur_program_handle_t *phPrograms,
                              const char *pOptions,
                              ur_program_handle_t *phProgram);
+ur_result_t
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches);
+ur_result_t urProgramBuildAsyncExp(ur_program_handle_t hProgram,
+                                   ur_queue_handle_t hQueue,
+                                   const char *pOptions,
+                                   ur_event_handle_t *phEvent);
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pIndex);
+ur_result_t urQueueBeginCaptureExp(ur_queue_handle_t hQueue);
+ur_result_t
+urQueueEndCaptureExp(ur_queue_handle_t hQueue,
+                     ur_exp_command_buffer_handle_t *phCommandBuffer);
 ur_result_t urUSMImportExp(ur_context_handle_t hContext, void *pMem,
                            size_t size);
 ur_result_t urUSMReleaseExp(ur_context_handle_t hContext, void *pMem);
@@ -723,6 +768,8 @@ ur_result_t urUsmP2PPeerAccessGetInfoExp(ur_device_handle_t commandDevice,
                                          ur_exp_peer_info_t propName,
                                          size_t propSize, void *pPropValue,
                                          size_t *pPropSizeRet);
+ur_result_t urUSMPoolTrimExp(ur_context_handle_t hContext,
+                             ur_usm_pool_handle_t hPool, size_t minBytesToKeep);
 ur_result_t urEnqueueNativeCommandExp(
     ur_queue_handle_t hQueue,
     ur_exp_enqueue_native_command_function_t pfnNativeEnqueue, void *data,
@@ -730,6 +777,34 @@ ur_result_t urEnqueueNativeCommandExp(
     const ur_exp_enqueue_native_command_properties_t *pProperties,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent);
+ur_result_t urEnqueueHostTaskExp(ur_queue_handle_t hQueue,
+                                 ur_exp_host_task_function_t pfnHostTask,
+                                 void *pUserData, uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent);
+ur_result_t urEventCreateIPCExp(ur_context_handle_t hContext,
+                                ur_device_handle_t hDevice,
+                                ur_event_handle_t *phEvent);
+ur_result_t urEventGetIPCHandleExp(ur_event_handle_t hEvent,
+                                   ur_exp_ipc_event_handle_t *pIPCHandle);
+ur_result_t urEventOpenIPCHandleExp(ur_context_handle_t hContext,
+                                    ur_device_handle_t hDevice,
+                                    const ur_exp_ipc_event_handle_t *pIPCHandle,
+                                    ur_event_handle_t *phEvent);
+ur_result_t urEnqueueIPCEventSignalExp(ur_queue_handle_t hQueue,
+                                       ur_event_handle_t hIPCEvent,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       ur_event_handle_t *phEvent);
+ur_result_t urEnqueueIPCEventWaitExp(ur_queue_handle_t hQueue,
+                                     ur_event_handle_t hIPCEvent,
+                                     uint32_t numEventsInWaitList,
+                                     const ur_event_handle_t *phEventWaitList,
+                                     ur_event_handle_t *phEvent);
+ur_result_t urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
 #ifdef UR_STATIC_ADAPTER_LEVEL_ZERO
 ur_result_t urAdapterGetDdiTables(ur_dditable_t *ddi);
 #endif
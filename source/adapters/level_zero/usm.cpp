@@ -10,10 +10,12 @@
 
 #include <algorithm>
 #include <climits>
+#include <limits>
 #include <string.h>
 
 #include "context.hpp"
 #include "event.hpp"
+#include "image.hpp"
 #include "usm.hpp"
 
 #include "logger/ur_logger.hpp"
@@ -165,27 +167,9 @@ static ur_result_t USMAllocationMakeResident(
   } else {
     Devices.push_back(Device);
     if (ForceResidency == USMAllocationForceResidencyType::P2PDevices) {
-      // Check if the P2P devices are already cached
-      auto it = Context->P2PDeviceCache.find(Device);
-      if (it != Context->P2PDeviceCache.end()) {
-        // Use cached P2P devices
-        Devices.insert(Devices.end(), it->second.begin(), it->second.end());
-      } else {
-        // Query for P2P devices and update the cache
-        std::list<ur_device_handle_t> P2PDevices;
-        ze_bool_t P2P;
-        for (const auto &D : Context->Devices) {
-          if (D == Device)
-            continue;
-          ZE2UR_CALL(zeDeviceCanAccessPeer,
-                     (D->ZeDevice, Device->ZeDevice, &P2P));
-          if (P2P)
-            P2PDevices.push_back(D);
-        }
-        // Update the cache
-        Context->P2PDeviceCache[Device] = P2PDevices;
-        Devices.insert(Devices.end(), P2PDevices.begin(), P2PDevices.end());
-      }
+      const std::list<ur_device_handle_t> *P2PDevices = nullptr;
+      UR_CALL(Context->getP2PDevices(Device, P2PDevices));
+      Devices.insert(Devices.end(), P2PDevices->begin(), P2PDevices->end());
     }
   }
   for (const auto &D : Devices) {
@@ -273,6 +257,13 @@ USMSharedAllocImpl(void **ResultPtr, ur_context_handle_t Context,
                 reinterpret_cast<std::uintptr_t>(*ResultPtr) % Alignment == 0,
             UR_RESULT_ERROR_INVALID_VALUE);
 
+  // Under a residency budget the allocation is made resident by the kernels
+  // using it instead.
+  if (ResidencyManager::isEnabled()) {
+    Context->Residency.registerAllocation(*ResultPtr, Size);
+    return UR_RESULT_SUCCESS;
+  }
+
   // TODO: Return any non-success result from USMAllocationMakeResident once
   // oneapi-src/level-zero-spec#240 is resolved.
   auto Result = USMAllocationMakeResident(USMSharedAllocationForceResidency,
@@ -367,7 +358,7 @@ ur_result_t urUSMHostAlloc(
 
   // There is a single allocator for Host USM allocations, so we don't need to
   // find the allocator depending on context as we do for Shared and Device
-  // allocations.
+  // allocations, but for those placed on the NUMA node of a device.
   umf_memory_pool_handle_t hPoolInternal = nullptr;
   if (!UseUSMAllocator) {
     hPoolInternal = Context->HostMemProxyPool.get();
@@ -376,6 +367,17 @@ ur_result_t urUSMHostAlloc(
   } else {
     hPoolInternal = Context->HostMemPool.get();
   }
+  if (auto NumaDesc = USMDesc ? find_stype_node<ur_exp_usm_host_numa_desc_t>(
+                                    USMDesc->pNext)
+                              : nullptr) {
+    auto &NumaPools = !UseUSMAllocator ? Context->NumaHostMemProxyPools
+                      : Pool           ? Pool->NumaHostMemPools
+                                       : Context->NumaHostMemPools;
+    auto NumaPool = NumaPools.find(NumaDesc->numaNode);
+    if (NumaPool != NumaPools.end()) {
+      hPoolInternal = NumaPool->second.get();
+    }
+  }
 
   *RetMem = umfPoolAlignedMalloc(hPoolInternal, Size, Align);
   if (*RetMem == nullptr) {
@@ -407,6 +409,14 @@ ur_result_t urUSMDeviceAlloc(
 
   uint32_t Alignment = USMDesc ? USMDesc->align : 0;
 
+  // Zero-initialized allocations are only served by the v2 adapter
+  if (auto UsmDeviceDesc =
+          USMDesc ? find_stype_node<ur_usm_device_desc_t>(USMDesc->pNext)
+                  : nullptr) {
+    if (UsmDeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
   // L0 supports alignment up to 64KB and silently ignores higher values.
   // We flag alignment > 64KB as an invalid value.
   // L0 spec says that alignment values that are not powers of 2 are invalid.
@@ -512,6 +522,10 @@ ur_result_t urUSMSharedAlloc(
   }
   DeviceReadOnly = UsmDeviceFlags & UR_USM_DEVICE_MEM_FLAG_DEVICE_READ_ONLY;
 
+  // Zero-initialized allocations are only served by the v2 adapter
+  if (UsmDeviceFlags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
   // L0 supports alignment up to 64KB and silently ignores higher values.
   // We flag alignment > 64KB as an invalid value.
   // L0 spec says that alignment values that are not powers of 2 are invalid.
@@ -586,12 +600,67 @@ urUSMFree(ur_context_handle_t Context, ///< [in] handle of the context object
 ) {
   ur_platform_handle_t Plt = Context->getPlatform();
 
+  // Sampled images may view USM.
+  destroyImageHandles(Context,
+                      reinterpret_cast<ur_exp_image_mem_native_handle_t>(Mem));
+
+  {
+    std::scoped_lock<ur_mutex> Lock(Context->GrowableAllocationsMutex);
+    auto It = Context->GrowableAllocations.find(Mem);
+    if (It != Context->GrowableAllocations.end()) {
+      auto Allocation = std::move(It->second);
+      Context->GrowableAllocations.erase(It);
+      return Context->releaseGrowableAllocation(Mem, Allocation);
+    }
+  }
+
   std::scoped_lock<ur_shared_mutex> Lock(
       IndirectAccessTrackingEnabled ? Plt->ContextsMutex : Context->Mutex);
 
   return USMFreeHelper(Context, Mem);
 }
 
+ur_result_t urUSMGrowableAllocExp(
+    ur_context_handle_t Context, ///< [in] handle of the context object
+    ur_device_handle_t Device,   ///< [in] handle of the device object
+    size_t MaxSize, ///< [in] size in bytes of the address range reserved for
+                    ///< the allocation
+    size_t Size, ///< [in] size in bytes of the memory initially backing the
+                 ///< allocation
+    void **RetMem ///< [out] pointer to USM device memory object
+) {
+  ur_context_handle_t_::GrowableAllocation Allocation{};
+  Allocation.ZeDevice = Device->ZeDevice;
+  Allocation.MaxSize = MaxSize;
+  ZE2UR_CALL(zeVirtualMemQueryPageSize, (Context->ZeContext, Device->ZeDevice,
+                                         MaxSize, &Allocation.PageSize));
+  Allocation.ReservedSize = (MaxSize + Allocation.PageSize - 1) /
+                            Allocation.PageSize * Allocation.PageSize;
+  ZE2UR_CALL(zeVirtualMemReserve, (Context->ZeContext, nullptr,
+                                   Allocation.ReservedSize, RetMem));
+
+  std::scoped_lock<ur_mutex> Lock(Context->GrowableAllocationsMutex);
+  if (auto Res = Context->growAllocation(*RetMem, Allocation, Size)) {
+    Context->releaseGrowableAllocation(*RetMem, Allocation);
+    return Res;
+  }
+  Context->GrowableAllocations.emplace(*RetMem, std::move(Allocation));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t urUSMGrowExp(
+    ur_context_handle_t Context, ///< [in] handle of the context object
+    void *Mem, ///< [in] pointer to USM memory allocated with
+               ///< ::urUSMGrowableAllocExp
+    size_t Size ///< [in] size in bytes the allocation must be backed for
+) {
+  std::scoped_lock<ur_mutex> Lock(Context->GrowableAllocationsMutex);
+  auto It = Context->GrowableAllocations.find(Mem);
+  UR_ASSERT(It != Context->GrowableAllocations.end(),
+            UR_RESULT_ERROR_INVALID_VALUE);
+  return Context->growAllocation(Mem, It->second, Size);
+}
+
 ur_result_t urUSMGetMemAllocInfo(
     ur_context_handle_t Context, ///< [in] handle of the context object
     const void *Ptr,             ///< [in] pointer to USM memory object
@@ -681,6 +750,11 @@ ur_result_t urUSMGetMemAllocInfo(
       if (Pool->HostMemPool.get() == UMFPool) {
         return ReturnValue(Pool);
       }
+      for (auto &NumaPool : Pool->NumaHostMemPools) {
+        if (NumaPool.second.get() == UMFPool) {
+          return ReturnValue(Pool);
+        }
+      }
     }
 
     return UR_RESULT_ERROR_INVALID_VALUE;
@@ -749,11 +823,53 @@ ur_result_t urUSMPoolGetInfo(
     return ReturnValue(Pool->Context);
   }
   default: {
-    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    return umf::getPoolStatsInfo(Pool->Stats, PropName, ReturnValue);
   }
   }
 }
 
+ur_result_t urUSMPoolTrimExp(ur_context_handle_t Context,
+                             ur_usm_pool_handle_t Pool,
+                             size_t MinBytesToKeep) {
+  UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
+
+  // The pools share the budget, in the order they're trimmed in
+  auto TrimPool = [&MinBytesToKeep](umf::pool_unique_handle_t &UMFPool) {
+    if (UMFPool) {
+      MinBytesToKeep -= std::min(umf::poolTrim(UMFPool.get(), MinBytesToKeep),
+                                 MinBytesToKeep);
+    }
+  };
+  auto TrimPools = [&TrimPool](auto &PoolMap) {
+    for (auto &PoolPair : PoolMap) {
+      TrimPool(PoolPair.second);
+    }
+  };
+  auto TrimUsmPool = [&](ur_usm_pool_handle_t UsmPool) {
+    TrimPools(UsmPool->DeviceMemPools);
+    TrimPools(UsmPool->SharedMemPools);
+    TrimPools(UsmPool->SharedReadOnlyMemPools);
+    TrimPool(UsmPool->HostMemPool);
+    TrimPools(UsmPool->NumaHostMemPools);
+  };
+
+  if (Pool) {
+    TrimUsmPool(Pool);
+    return UR_RESULT_SUCCESS;
+  }
+
+  std::shared_lock<ur_shared_mutex> ContextLock(Context->Mutex);
+  TrimPools(Context->DeviceMemPools);
+  TrimPools(Context->SharedMemPools);
+  TrimPools(Context->SharedReadOnlyMemPools);
+  TrimPool(Context->HostMemPool);
+  TrimPools(Context->NumaHostMemPools);
+  for (auto UsmPool : Context->UsmPoolHandles) {
+    TrimUsmPool(UsmPool);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urUSMImportExp(ur_context_handle_t Context, void *HostPtr,
                            size_t Size) {
   UR_ASSERT(Context, UR_RESULT_ERROR_INVALID_CONTEXT);
@@ -787,9 +903,44 @@ ur_result_t urUSMReleaseExp(ur_context_handle_t Context, void *HostPtr) {
         Context->getPlatform()->ZeDriverHandleExpTranslated, HostPtr);
   return UR_RESULT_SUCCESS;
 }
+
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent) {
+  std::ignore = hQueue;
+  std::ignore = size;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = ppMem;
+  std::ignore = phEvent;
+  logger::error(logger::LegacyMessage("[UR][L0] {} function not implemented!"),
+                "{} function not implemented!", __FUNCTION__);
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+  std::ignore = hQueue;
+  std::ignore = pMem;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  logger::error(logger::LegacyMessage("[UR][L0] {} function not implemented!"),
+                "{} function not implemented!", __FUNCTION__);
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
 } // namespace ur::level_zero
 
 static ur_result_t USMFreeImpl(ur_context_handle_t Context, void *Ptr) {
+  if (ResidencyManager::isEnabled()) {
+    if (auto LastUse = Context->Residency.unregisterAllocation(Ptr))
+      UR_CALL(urEventReleaseInternal(LastUse));
+  }
+
   auto ZeResult = ZE_CALL_NOCHECK(zeMemFree, (Context->ZeContext, Ptr));
   // Handle When the driver is already released
   if (ZeResult == ZE_RESULT_ERROR_UNINITIALIZED) {
@@ -809,6 +960,18 @@ static ur_result_t USMQueryPageSize(ur_context_handle_t Context, void *Ptr,
   return UR_RESULT_SUCCESS;
 }
 
+size_t USMAllocSize(ur_context_handle_t Context, void *Ptr,
+                    size_t RequestedSize) {
+  size_t Size = 0;
+  if (ZE_CALL_NOCHECK(zeMemGetAddressRange,
+                      (Context->ZeContext, Ptr, nullptr, &Size)) !=
+          ZE_RESULT_SUCCESS ||
+      Size == 0) {
+    return RequestedSize;
+  }
+  return Size;
+}
+
 umf_result_t L0MemoryProvider::initialize(ur_context_handle_t Ctx,
                                           ur_device_handle_t Dev) {
   Context = Ctx;
@@ -825,11 +988,14 @@ enum umf_result_t L0MemoryProvider::alloc(size_t Size, size_t Align,
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onAlloc(getMemoryType(),
+                                    USMAllocSize(Context, *Ptr, Size));
   return UMF_RESULT_SUCCESS;
 }
 
 enum umf_result_t L0MemoryProvider::free(void *Ptr, size_t Size) {
-  (void)Size;
+  // The proxy pools don't pass the size
+  auto FreedSize = USMAllocSize(Context, Ptr, Size);
 
   auto Res = USMFreeImpl(Context, Ptr);
   if (Res != UR_RESULT_SUCCESS) {
@@ -837,6 +1003,7 @@ enum umf_result_t L0MemoryProvider::free(void *Ptr, size_t Size) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
+  Context->MemoryAccounting.onFree(getMemoryType(), FreedSize);
   return UMF_RESULT_SUCCESS;
 }
 
@@ -901,8 +1068,19 @@ umf_result_t L0MemoryProvider::get_min_page_size(void *Ptr, size_t *PageSize) {
   return UMF_RESULT_SUCCESS;
 }
 
+// The allocation exported by an IPC handle, as the file descriptor in the
+// handle may be reused by the exporting process for another allocation once
+// the handle is put. Compared as bytes, so it has no padding.
+typedef struct ze_ipc_alloc_id_t {
+  int64_t pid;
+  uint64_t allocId;
+  uintptr_t base;
+  size_t size;
+} ze_ipc_alloc_id_t;
+static_assert(sizeof(ze_ipc_alloc_id_t) == 4 * sizeof(uint64_t));
+
 typedef struct ze_ipc_data_t {
-  int pid;
+  ze_ipc_alloc_id_t alloc;
   ze_ipc_mem_handle_t zeHandle;
 } ze_ipc_data_t;
 
@@ -915,17 +1093,23 @@ umf_result_t L0MemoryProvider::get_ipc_handle_size(size_t *Size) {
 
 umf_result_t L0MemoryProvider::get_ipc_handle(const void *Ptr, size_t Size,
                                               void *IpcData) {
-  std::ignore = Size;
-
   UR_ASSERT(Ptr && IpcData, UMF_RESULT_ERROR_INVALID_ARGUMENT);
   ze_ipc_data_t *zeIpcData = (ze_ipc_data_t *)IpcData;
-  auto Ret = ZE_CALL_NOCHECK(zeMemGetIpcHandle,
-                             (Context->ZeContext, Ptr, &zeIpcData->zeHandle));
+  ZeStruct<ze_memory_allocation_properties_t> ZeMemoryAllocationProperties;
+  auto Ret = ZE_CALL_NOCHECK(zeMemGetAllocProperties,
+                             (Context->ZeContext, Ptr,
+                              &ZeMemoryAllocationProperties, nullptr));
+  if (Ret != ZE_RESULT_SUCCESS) {
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+  Ret = ZE_CALL_NOCHECK(zeMemGetIpcHandle,
+                        (Context->ZeContext, Ptr, &zeIpcData->zeHandle));
   if (Ret != ZE_RESULT_SUCCESS) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
-  zeIpcData->pid = ur_getpid();
+  zeIpcData->alloc = {ur_getpid(), ZeMemoryAllocationProperties.id,
+                      reinterpret_cast<uintptr_t>(Ptr), Size};
 
   return UMF_RESULT_SUCCESS;
 }
@@ -953,27 +1137,36 @@ umf_result_t L0MemoryProvider::open_ipc_handle(void *IpcData, void **Ptr) {
   UR_ASSERT(IpcData && Ptr, UMF_RESULT_ERROR_INVALID_ARGUMENT);
   ze_ipc_data_t *zeIpcData = (ze_ipc_data_t *)IpcData;
 
-  int fdLocal = -1;
-  if (zeIpcData->pid != ur_getpid()) {
-    int fdRemote = -1;
-    memcpy(&fdRemote, &zeIpcData->zeHandle, sizeof(fdRemote));
-    fdLocal = ur_duplicate_fd(zeIpcData->pid, fdRemote);
-    if (fdLocal == -1) {
-      logger::error("duplicating file descriptor from IPC handle failed");
-      return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  // The handle is only opened if the allocation it exports isn't open in the
+  // context already
+  auto Open = [&](void *&OpenedPtr) {
+    int fdLocal = -1;
+    if (zeIpcData->alloc.pid != ur_getpid()) {
+      int fdRemote = -1;
+      memcpy(&fdRemote, &zeIpcData->zeHandle, sizeof(fdRemote));
+      fdLocal = ur_duplicate_fd(static_cast<int>(zeIpcData->alloc.pid),
+                                fdRemote);
+      if (fdLocal == -1) {
+        logger::error("duplicating file descriptor from IPC handle failed");
+        return UR_RESULT_ERROR_INVALID_VALUE;
+      }
+
+      memcpy(&zeIpcData->zeHandle, &fdLocal, sizeof(fdLocal));
     }
 
-    memcpy(&zeIpcData->zeHandle, &fdLocal, sizeof(fdLocal));
-  }
+    auto Ret = ZE_CALL_NOCHECK(zeMemOpenIpcHandle,
+                               (Context->ZeContext, Device->ZeDevice,
+                                zeIpcData->zeHandle, 0, &OpenedPtr));
+    if (fdLocal != -1) {
+      ur_close_fd(fdLocal);
+    }
 
-  auto Ret =
-      ZE_CALL_NOCHECK(zeMemOpenIpcHandle, (Context->ZeContext, Device->ZeDevice,
-                                           zeIpcData->zeHandle, 0, Ptr));
-  if (fdLocal != -1) {
-    ur_close_fd(fdLocal);
-  }
+    return ze2urResult(Ret);
+  };
 
-  if (Ret != ZE_RESULT_SUCCESS) {
+  if (Context->openIpcHandle(Device, &zeIpcData->alloc,
+                             sizeof(ze_ipc_alloc_id_t), Open,
+                             *Ptr) != UR_RESULT_SUCCESS) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
@@ -984,8 +1177,7 @@ umf_result_t L0MemoryProvider::close_ipc_handle(void *Ptr, size_t Size) {
   std::ignore = Size;
 
   UR_ASSERT(Ptr, UMF_RESULT_ERROR_INVALID_ARGUMENT);
-  auto Ret = ZE_CALL_NOCHECK(zeMemCloseIpcHandle, (Context->ZeContext, Ptr));
-  if (Ret != ZE_RESULT_SUCCESS) {
+  if (Context->closeIpcHandle(Ptr) != UR_RESULT_SUCCESS) {
     return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
   }
 
@@ -1015,6 +1207,9 @@ ur_result_t L0DeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
 
 ur_result_t L0HostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
                                                uint32_t Alignment) {
+  // The driver allocates the pages, and pins them, under the memory policy of
+  // the calling thread
+  ur_numa_bind_scope NumaBind(Device ? Device->ZeNumaNode->value : -1);
   return USMHostAllocImpl(ResultPtr, Context, /* flags */ 0, Size, Alignment);
 }
 
@@ -1039,6 +1234,13 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
       }
       break;
     }
+    case UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC: {
+      const ur_exp_usm_pool_arena_desc_t *Arena =
+          reinterpret_cast<const ur_exp_usm_pool_arena_desc_t *>(BaseDesc);
+      DisjointPoolConfigs.Arenas[usm::DisjointPoolMemType::Device] = {
+          Arena->size, Arena->pageSize};
+      break;
+    }
     default: {
       logger::error("urUSMPoolCreate: unexpected chained stype");
       throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
@@ -1051,11 +1253,24 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
       umf::memoryProviderMakeUnique<L0HostMemoryProvider>(Context, nullptr)
           .second;
 
-  HostMemPool =
-      umf::poolMakeUniqueFromOps(
-          umfDisjointPoolOps(), std::move(MemProvider),
-          &this->DisjointPoolConfigs.Configs[usm::DisjointPoolMemType::Host])
-          .second;
+  HostMemPool = this->DisjointPoolConfigs
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::Host, &Stats)
+                .second;
+
+  for (auto device : Context->Devices) {
+    int NumaNode = device->ZeNumaNode->value;
+    if (NumaNode < 0 || NumaHostMemPools.count(NumaNode))
+      continue;
+    MemProvider =
+        umf::memoryProviderMakeUnique<L0HostMemoryProvider>(Context, device)
+            .second;
+    NumaHostMemPools.emplace(
+        NumaNode, this->DisjointPoolConfigs
+                      .makePool(std::move(MemProvider),
+                                usm::DisjointPoolMemType::Host, &Stats)
+                      .second);
+  }
 
   for (auto device : Context->Devices) {
     MemProvider =
@@ -1063,10 +1278,9 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
             .second;
     DeviceMemPools.emplace(
         std::piecewise_construct, std::make_tuple(device),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &this->DisjointPoolConfigs
-                                 .Configs[usm::DisjointPoolMemType::Device])
+        std::make_tuple(this->DisjointPoolConfigs
+                            .makePool(std::move(MemProvider),
+                                      usm::DisjointPoolMemType::Device, &Stats)
                             .second));
 
     MemProvider =
@@ -1074,10 +1288,9 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
             .second;
     SharedMemPools.emplace(
         std::piecewise_construct, std::make_tuple(device),
-        std::make_tuple(umf::poolMakeUniqueFromOps(
-                            umfDisjointPoolOps(), std::move(MemProvider),
-                            &this->DisjointPoolConfigs
-                                 .Configs[usm::DisjointPoolMemType::Shared])
+        std::make_tuple(this->DisjointPoolConfigs
+                            .makePool(std::move(MemProvider),
+                                      usm::DisjointPoolMemType::Shared, &Stats)
                             .second));
 
     MemProvider = umf::memoryProviderMakeUnique<L0SharedReadOnlyMemoryProvider>(
@@ -1086,42 +1299,92 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
     SharedReadOnlyMemPools.emplace(
         std::piecewise_construct, std::make_tuple(device),
         std::make_tuple(
-            umf::poolMakeUniqueFromOps(
-                umfDisjointPoolOps(), std::move(MemProvider),
-                &this->DisjointPoolConfigs
-                     .Configs[usm::DisjointPoolMemType::SharedReadOnly])
+            this->DisjointPoolConfigs
+                .makePool(std::move(MemProvider),
+                          usm::DisjointPoolMemType::SharedReadOnly, &Stats)
                 .second));
   }
 }
 
+// Frees memory tracked for indirect access, which no kernel in flight may use
+// anymore, and releases the reference it held on its context.
+static ur_result_t IndirectAccessFree(ur_context_handle_t Context, void *Ptr,
+                                      bool FromPool) {
+  if (!FromPool) {
+    ZE2UR_CALL(zeMemFree, (Context->ZeContext, Ptr));
+    return ContextReleaseHelper(Context);
+  }
+
+  auto hPool = umfPoolByPtr(Ptr);
+  if (!hPool) {
+    UR_CALL(ContextReleaseHelper(Context));
+    return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
+  }
+
+  auto umfRet = umfPoolFree(hPool, Ptr);
+  UR_CALL(ContextReleaseHelper(Context));
+  return umf2urResult(umfRet);
+}
+
+// Stops tracking memory for indirect access and frees it, unless kernels with
+// indirect access are in flight, in which case the free is deferred to their
+// completion. The caller must lock the ContextsMutex of the platform.
+static ur_result_t IndirectAccessFreeOrDefer(ur_context_handle_t Context,
+                                             void *Ptr, bool FromPool) {
+  auto It = Context->MemAllocs.find(Ptr);
+  if (It == std::end(Context->MemAllocs)) {
+    die("All memory allocations must be tracked!");
+  }
+  // We don't need to track this allocation anymore.
+  Context->MemAllocs.erase(It);
+
+  ur_platform_handle_t Plt = Context->getPlatform();
+  if (Plt->IndirectAccessKernels.empty())
+    return IndirectAccessFree(Context, Ptr, FromPool);
+
+  // The kernels submitted from now on can't use this memory, so they are in
+  // the next epoch.
+  Plt->DeferredFrees.push_back(
+      {Plt->IndirectAccessEpoch++, Context, Ptr, FromPool});
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t IndirectAccessKernelCompleted(ur_kernel_handle_t Kernel) {
+  ur_platform_handle_t Plt = Kernel->Program->Context->getPlatform();
+  std::scoped_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex);
+
+  if (Kernel->SubmissionsCount == 0 || --Kernel->SubmissionsCount != 0)
+    return UR_RESULT_SUCCESS;
+
+  auto &Kernels = Plt->IndirectAccessKernels;
+  auto It = Kernels.find(Kernel->IndirectAccessEpoch);
+  if (It != Kernels.end() && --It->second == 0)
+    Kernels.erase(It);
+
+  // Perform the frees which no kernel in flight was submitted before.
+  uint64_t OldestEpoch = Kernels.empty()
+                             ? std::numeric_limits<uint64_t>::max()
+                             : Kernels.begin()->first;
+  while (!Plt->DeferredFrees.empty() &&
+         Plt->DeferredFrees.front().Epoch < OldestEpoch) {
+    auto Free = Plt->DeferredFrees.front();
+    Plt->DeferredFrees.pop_front();
+    UR_CALL(IndirectAccessFree(Free.Context, Free.Ptr, Free.FromPool));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 // If indirect access tracking is not enabled then this functions just performs
-// zeMemFree. If indirect access tracking is enabled then reference counting is
-// performed.
+// zeMemFree. If indirect access tracking is enabled then the free may be
+// deferred until the kernels which may use the memory completed.
 ur_result_t ZeMemFreeHelper(ur_context_handle_t Context, void *Ptr) {
-  ur_platform_handle_t Plt = Context->getPlatform();
-  std::unique_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex,
-                                                 std::defer_lock);
   if (IndirectAccessTrackingEnabled) {
-    ContextsLock.lock();
-    auto It = Context->MemAllocs.find(Ptr);
-    if (It == std::end(Context->MemAllocs)) {
-      die("All memory allocations must be tracked!");
-    }
-    if (!It->second.RefCount.decrementAndTest()) {
-      // Memory can't be deallocated yet.
-      return UR_RESULT_SUCCESS;
-    }
-
-    // Reference count is zero, it is ok to free memory.
-    // We don't need to track this allocation anymore.
-    Context->MemAllocs.erase(It);
+    ur_platform_handle_t Plt = Context->getPlatform();
+    std::scoped_lock<ur_shared_mutex> ContextsLock(Plt->ContextsMutex);
+    return IndirectAccessFreeOrDefer(Context, Ptr, false /*FromPool*/);
   }
 
   ZE2UR_CALL(zeMemFree, (Context->ZeContext, Ptr));
-
-  if (IndirectAccessTrackingEnabled)
-    UR_CALL(ContextReleaseHelper(Context));
-
   return UR_RESULT_SUCCESS;
 }
 
@@ -1149,30 +1412,12 @@ ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
     return UR_RESULT_SUCCESS;
   }
 
-  if (IndirectAccessTrackingEnabled) {
-    auto It = Context->MemAllocs.find(Ptr);
-    if (It == std::end(Context->MemAllocs)) {
-      die("All memory allocations must be tracked!");
-    }
-    if (!It->second.RefCount.decrementAndTest()) {
-      // Memory can't be deallocated yet.
-      return UR_RESULT_SUCCESS;
-    }
-
-    // Reference count is zero, it is ok to free memory.
-    // We don't need to track this allocation anymore.
-    Context->MemAllocs.erase(It);
-  }
+  if (IndirectAccessTrackingEnabled)
+    return IndirectAccessFreeOrDefer(Context, Ptr, true /*FromPool*/);
 
   auto hPool = umfPoolByPtr(Ptr);
-  if (!hPool) {
-    if (IndirectAccessTrackingEnabled)
-      UR_CALL(ContextReleaseHelper(Context));
+  if (!hPool)
     return UR_RESULT_ERROR_INVALID_MEM_OBJECT;
-  }
 
-  auto umfRet = umfPoolFree(hPool, Ptr);
-  if (IndirectAccessTrackingEnabled)
-    UR_CALL(ContextReleaseHelper(Context));
-  return umf2urResult(umfRet);
+  return umf2urResult(umfPoolFree(hPool, Ptr));
 }
@@ -21,6 +21,8 @@ struct ur_usm_pool_handle_t_ : _ur_object {
   usm::DisjointPoolAllConfigs DisjointPoolConfigs =
       InitializeDisjointPoolConfig();
 
+  umf::pool_stats_t Stats;
+
   std::unordered_map<ur_device_handle_t, umf::pool_unique_handle_t>
       DeviceMemPools;
   std::unordered_map<ur_device_handle_t, umf::pool_unique_handle_t>
@@ -28,6 +30,8 @@ struct ur_usm_pool_handle_t_ : _ur_object {
   std::unordered_map<ur_device_handle_t, umf::pool_unique_handle_t>
       SharedReadOnlyMemPools;
   umf::pool_unique_handle_t HostMemPool;
+  // Placing their pages on the NUMA node of the devices of the context
+  std::unordered_map<uint32_t, umf::pool_unique_handle_t> NumaHostMemPools;
 
   ur_context_handle_t Context{};
 
@@ -118,6 +122,10 @@ private:
   size_t MinPageSize = 0;
   bool MinPageSizeCached = false;
 
+protected:
+  // Type the memory of the provider counts as in the context
+  virtual ur_exp_context_memory_type_t getMemoryType() const = 0;
+
 public:
   umf_result_t initialize(ur_context_handle_t Ctx,
                           ur_device_handle_t Dev) override;
@@ -138,6 +146,9 @@ class L0SharedMemoryProvider final : public L0MemoryProvider {
 protected:
   ur_result_t allocateImpl(void **ResultPtr, size_t Size,
                            uint32_t Alignment) override;
+  ur_exp_context_memory_type_t getMemoryType() const override {
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED;
+  }
 };
 
 // Allocation routines for shared memory type that is only modified from host.
@@ -145,6 +156,9 @@ class L0SharedReadOnlyMemoryProvider final : public L0MemoryProvider {
 protected:
   ur_result_t allocateImpl(void **ResultPtr, size_t Size,
                            uint32_t Alignment) override;
+  ur_exp_context_memory_type_t getMemoryType() const override {
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED;
+  }
 };
 
 // Allocation routines for device memory type
@@ -152,6 +166,9 @@ class L0DeviceMemoryProvider final : public L0MemoryProvider {
 protected:
   ur_result_t allocateImpl(void **ResultPtr, size_t Size,
                            uint32_t Alignment) override;
+  ur_exp_context_memory_type_t getMemoryType() const override {
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE;
+  }
 };
 
 // Allocation routines for host memory type
@@ -159,6 +176,9 @@ class L0HostMemoryProvider final : public L0MemoryProvider {
 protected:
   ur_result_t allocateImpl(void **ResultPtr, size_t Size,
                            uint32_t Alignment) override;
+  ur_exp_context_memory_type_t getMemoryType() const override {
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST;
+  }
 };
 
 // Simple proxy for memory allocations. It is used for the UMF tracking
@@ -210,11 +230,19 @@ public:
 };
 
 // If indirect access tracking is not enabled then this functions just performs
-// zeMemFree. If indirect access tracking is enabled then reference counting is
-// performed.
+// zeMemFree. If indirect access tracking is enabled then the free may be
+// deferred until the kernels which may use the memory completed.
 ur_result_t ZeMemFreeHelper(ur_context_handle_t Context, void *Ptr);
 
+// Performs the frees deferred for Kernel, with indirect access tracking, once
+// its last submission in flight completed.
+ur_result_t IndirectAccessKernelCompleted(ur_kernel_handle_t Kernel);
+
 ur_result_t USMFreeHelper(ur_context_handle_t Context, void *Ptr,
                           bool OwnZeMemHandle = true);
 
+// Size of the allocation at Ptr the driver reports, RequestedSize if it can't
+size_t USMAllocSize(ur_context_handle_t Context, void *Ptr,
+                    size_t RequestedSize);
+
 extern const bool UseUSMAllocator;
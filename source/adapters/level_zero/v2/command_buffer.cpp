@@ -0,0 +1,310 @@
+//===--------- command_buffer.cpp - Level Zero Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include "command_buffer.hpp"
+#include "context.hpp"
+#include "event.hpp"
+#include "kernel.hpp"
+#include "queue_api.hpp"
+
+#include "../common/latency_tracker.hpp"
+#include "../device.hpp"
+#include "../helpers/kernel_helpers.hpp"
+#include "../program.hpp"
+#include "../ur_interface_loader.hpp"
+
+#include <tuple>
+#include <vector>
+
+ur_exp_command_buffer_handle_t_::ur_exp_command_buffer_handle_t_(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice)
+    : hContext(hContext), hDevice(hDevice),
+      commandList(hContext->commandListCache.getRegularCommandList(
+          hDevice->ZeDevice, true,
+          hDevice
+              ->QueueGroup[ur_device_handle_t_::queue_group_info_t::Compute]
+              .ZeOrdinal)) {
+  UR_CALL_THROWS(ur::level_zero::urContextRetain(hContext));
+}
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  // The command list goes back to the cache once its last execution is
+  // complete, with its commands reset.
+  if (lastSubmission) {
+    ZE_CALL_NOCHECK(zeEventHostSynchronize,
+                    (lastSubmission->getZeEvent(), UINT64_MAX));
+    lastSubmission->release();
+  }
+  ZE_CALL_NOCHECK(zeCommandListReset, (commandList.get()));
+  commandList.reset();
+  ur::level_zero::urContextRelease(hContext);
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::nextCommand(
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  if (isFinalized) {
+    logger::error("Commands can't be appended to a finalized command-buffer");
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  auto syncPoint = nextSyncPoint++;
+  if (pSyncPoint) {
+    *pSyncPoint = syncPoint;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::finalize() {
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  if (isFinalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  ZE2UR_CALL(zeCommandListClose, (commandList.get()));
+  isFinalized = true;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::appendKernelLaunch(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  TRACK_SCOPE_LATENCY("ur_exp_command_buffer_handle_t_::appendKernelLaunch");
+
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(hKernel->getProgramHandle(), UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
+  std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
+      hKernel->Mutex, hKernel->getProgramHandle()->Mutex, this->Mutex);
+
+  UR_CALL(nextCommand(pSyncPoint));
+
+  if (pGlobalWorkOffset != NULL) {
+    UR_CALL(setKernelGlobalOffset(hContext, hZeKernel, pGlobalWorkOffset));
+  }
+
+  ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
+  UR_CALL(hKernel->setLaunchGroupSize(hDevice, workDim, pGlobalWorkSize,
+                                      pLocalWorkSize, zeThreadGroupDimensions));
+
+  // The arguments of the kernel are captured when appending it.
+  ZE2UR_CALL(zeCommandListAppendLaunchKernel,
+             (commandList.get(), hZeKernel, &zeThreadGroupDimensions, nullptr,
+              0, nullptr));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::appendUSMMemcpy(
+    void *pDst, const void *pSrc, size_t size,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  UR_CALL(nextCommand(pSyncPoint));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+             (commandList.get(), pDst, pSrc, size, nullptr, 0, nullptr));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::appendUSMFill(
+    void *pMemory, const void *pPattern, size_t patternSize, size_t size,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  UR_CALL(nextCommand(pSyncPoint));
+
+  ZE2UR_CALL(zeCommandListAppendMemoryFill,
+             (commandList.get(), pMemory, pPattern, patternSize, size, nullptr,
+              0, nullptr));
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::enqueue(
+    ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_exp_command_buffer_handle_t_::enqueue");
+
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  if (!isFinalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+
+  std::vector<ur_event_handle_t> waitList(
+      phEventWaitList, phEventWaitList + numEventsInWaitList);
+  if (lastSubmission) {
+    waitList.push_back(lastSubmission);
+  }
+
+  ur_event_handle_t submission = nullptr;
+  UR_CALL(hQueue->enqueueCommandBuffer(
+      commandList.get(), static_cast<uint32_t>(waitList.size()),
+      waitList.data(), &submission));
+
+  if (lastSubmission) {
+    UR_CALL(lastSubmission->release());
+  }
+  lastSubmission = submission;
+
+  if (phEvent) {
+    UR_CALL(submission->retain());
+    *phEvent = submission;
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::upload(ur_queue_handle_t hQueue) {
+  std::ignore = hQueue;
+
+  std::scoped_lock<ur_shared_mutex> Lock(Mutex);
+  if (!isFinalized) {
+    return UR_RESULT_ERROR_INVALID_OPERATION;
+  }
+  // The commands are in a closed command list on the device already, so there
+  // is nothing left to upload before the first enqueue.
+  return UR_RESULT_SUCCESS;
+}
+
+namespace ur::level_zero {
+ur_result_t
+urCommandBufferCreateExp(ur_context_handle_t hContext,
+                         ur_device_handle_t hDevice,
+                         const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+                         ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  if (!hContext->isValidDevice(hDevice)) {
+    return UR_RESULT_ERROR_INVALID_DEVICE;
+  }
+  // The command lists of the v2 command-buffers aren't mutable
+  if (pCommandBufferDesc && pCommandBufferDesc->isUpdatable) {
+    logger::error("Updatable command-buffers are not supported");
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  *phCommandBuffer = new ur_exp_command_buffer_handle_t_(hContext, hDevice);
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  hCommandBuffer->RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  if (!hCommandBuffer->RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete hCommandBuffer;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  return hCommandBuffer->finalize();
+}
+
+ur_result_t urCommandBufferAppendKernelLaunchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numKernelAlternatives, ur_kernel_handle_t *phKernelAlternatives,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  // The commands are executed in order, satisfying their sync-points.
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+  std::ignore = phKernelAlternatives;
+  std::ignore = phEventWaitList;
+
+  // Kernel alternatives and commands handles are only used for updates, and
+  // events within command-buffers aren't supported.
+  if (numKernelAlternatives || phCommand || numEventsInWaitList || phEvent) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return hCommandBuffer->appendKernelLaunch(hKernel, workDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pLocalWorkSize, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMMemcpyExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst, const void *pSrc,
+    size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+  std::ignore = phEventWaitList;
+
+  if (phCommand || numEventsInWaitList || phEvent) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return hCommandBuffer->appendUSMMemcpy(pDst, pSrc, size, pSyncPoint);
+}
+
+ur_result_t urCommandBufferAppendUSMFillExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  std::ignore = numSyncPointsInWaitList;
+  std::ignore = pSyncPointWaitList;
+  std::ignore = phEventWaitList;
+
+  if (phCommand || numEventsInWaitList || phEvent) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  return hCommandBuffer->appendUSMFill(pMemory, pPattern, patternSize, size,
+                                       pSyncPoint);
+}
+
+ur_result_t urCommandBufferEnqueueExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return hCommandBuffer->enqueue(hQueue, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+}
+
+ur_result_t
+urCommandBufferUploadExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                         ur_queue_handle_t hQueue) {
+  return hCommandBuffer->upload(hQueue);
+}
+
+ur_result_t
+urCommandBufferGetInfoExp(ur_exp_command_buffer_handle_t hCommandBuffer,
+                          ur_exp_command_buffer_info_t propName,
+                          size_t propSize, void *pPropValue,
+                          size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{hCommandBuffer->RefCount.load()});
+  default:
+    assert(!"Command-buffer info request not implemented");
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
+}
+} // namespace ur::level_zero
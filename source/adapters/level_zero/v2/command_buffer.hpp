@@ -0,0 +1,59 @@
+//===--------- command_buffer.hpp - Level Zero Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "command_list_cache.hpp"
+#include "common.hpp"
+
+// Command-buffer recording its commands into a regular in-order command list,
+// which is appended to the immediate command list of a queue when enqueued.
+// As the commands are executed in order, the sync-points of the commands are
+// satisfied without any event.
+struct ur_exp_command_buffer_handle_t_ : public _ur_object {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t hContext,
+                                  ur_device_handle_t hDevice);
+  ~ur_exp_command_buffer_handle_t_();
+
+  ur_result_t finalize();
+
+  ur_result_t
+  appendKernelLaunch(ur_kernel_handle_t hKernel, uint32_t workDim,
+                     const size_t *pGlobalWorkOffset,
+                     const size_t *pGlobalWorkSize,
+                     const size_t *pLocalWorkSize,
+                     ur_exp_command_buffer_sync_point_t *pSyncPoint);
+  ur_result_t appendUSMMemcpy(void *pDst, const void *pSrc, size_t size,
+                              ur_exp_command_buffer_sync_point_t *pSyncPoint);
+  ur_result_t appendUSMFill(void *pMemory, const void *pPattern,
+                            size_t patternSize, size_t size,
+                            ur_exp_command_buffer_sync_point_t *pSyncPoint);
+
+  ur_result_t enqueue(ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent);
+  ur_result_t upload(ur_queue_handle_t hQueue);
+
+  const ur_context_handle_t hContext;
+  const ur_device_handle_t hDevice;
+
+private:
+  // Checks that commands can still be appended, and returns the sync-point
+  // of the next one in pSyncPoint.
+  ur_result_t nextCommand(ur_exp_command_buffer_sync_point_t *pSyncPoint);
+
+  v2::raii::cache_borrowed_command_list_t commandList;
+  bool isFinalized = false;
+  ur_exp_command_buffer_sync_point_t nextSyncPoint = 0;
+
+  // Retained event of the last enqueue, which the next one waits for, as the
+  // command list can't be executed again before its previous execution is
+  // complete.
+  ur_event_handle_t lastSubmission = nullptr;
+};
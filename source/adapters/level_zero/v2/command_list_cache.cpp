@@ -12,11 +12,16 @@
 #include "context.hpp"
 
 #include "../device.hpp"
+#include "ur_perf_counters.hpp"
+
+static ur::perf_counter CommandListCacheHits{"command_list_cache.hits"};
+static ur::perf_counter CommandListCacheMisses{"command_list_cache.misses"};
 
 bool v2::immediate_command_list_descriptor_t::operator==(
     const immediate_command_list_descriptor_t &rhs) const {
   return ZeDevice == rhs.ZeDevice && IsInOrder == rhs.IsInOrder &&
-         Mode == rhs.Mode && Priority == rhs.Priority && Index == rhs.Index;
+         Ordinal == rhs.Ordinal && Mode == rhs.Mode &&
+         Priority == rhs.Priority && Index == rhs.Index;
 }
 
 bool v2::regular_command_list_descriptor_t::operator==(
@@ -91,11 +96,7 @@ command_list_cache_t::getImmediateCommandList(
   Desc.Priority = Priority;
   Desc.Index = Index;
 
-  auto CommandList = getCommandList(Desc).release();
-  return raii::cache_borrowed_command_list_t(
-      CommandList, [Cache = this, Desc](ze_command_list_handle_t CmdList) {
-        Cache->addCommandList(Desc, raii::ze_command_list_handle_t(CmdList));
-      });
+  return borrowCommandList(ZeDevice, Desc);
 }
 
 raii::cache_borrowed_command_list_t
@@ -108,22 +109,43 @@ command_list_cache_t::getRegularCommandList(ze_device_handle_t ZeDevice,
   Desc.IsInOrder = IsInOrder;
   Desc.Ordinal = Ordinal;
 
-  auto CommandList = getCommandList(Desc).release();
+  return borrowCommandList(ZeDevice, Desc);
+}
+
+command_list_cache_t::shard_t &
+command_list_cache_t::getShard(ze_device_handle_t ZeDevice) {
+  // Fibonacci hashing, the low bits of the handles are all zeroes.
+  static_assert((NumShards & (NumShards - 1)) == 0);
+  uint64_t Bits = reinterpret_cast<std::uintptr_t>(ZeDevice);
+  return Shards[(Bits * 0x9E3779B97F4A7C15ull) >> 32 & (NumShards - 1)];
+}
+
+raii::cache_borrowed_command_list_t
+command_list_cache_t::borrowCommandList(ze_device_handle_t ZeDevice,
+                                        const command_list_descriptor_t &desc) {
+  auto &Shard = getShard(ZeDevice);
+  command_list_cache_key_t Key{desc, command_list_descriptor_hash_t{}(desc)};
 
+  auto CommandList = getCommandList(Shard, Key).release();
   return raii::cache_borrowed_command_list_t(
-      CommandList, [Cache = this, Desc](ze_command_list_handle_t CmdList) {
-        Cache->addCommandList(Desc, raii::ze_command_list_handle_t(CmdList));
+      CommandList, [Cache = this, Shard = &Shard,
+                    Key = std::move(Key)](ze_command_list_handle_t CmdList) {
+        Cache->addCommandList(*Shard, Key,
+                              raii::ze_command_list_handle_t(CmdList));
       });
 }
 
 raii::ze_command_list_handle_t
-command_list_cache_t::getCommandList(const command_list_descriptor_t &desc) {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  auto it = ZeCommandListCache.find(desc);
-  if (it == ZeCommandListCache.end()) {
+command_list_cache_t::getCommandList(shard_t &Shard,
+                                     const command_list_cache_key_t &key) {
+  std::unique_lock<ur_mutex> Lock(Shard.ZeCommandListCacheMutex);
+  auto it = Shard.ZeCommandListCache.find(key);
+  if (it == Shard.ZeCommandListCache.end()) {
     Lock.unlock();
-    return createCommandList(desc);
+    CommandListCacheMisses.add();
+    return createCommandList(key.Desc);
   }
+  CommandListCacheHits.add();
 
   assert(!it->second.empty());
 
@@ -132,36 +154,42 @@ command_list_cache_t::getCommandList(const command_list_descriptor_t &desc) {
   it->second.pop();
 
   if (it->second.empty())
-    ZeCommandListCache.erase(it);
+    Shard.ZeCommandListCache.erase(it);
 
   return CommandListHandle;
 }
 
 void command_list_cache_t::addCommandList(
-    const command_list_descriptor_t &desc,
+    shard_t &Shard, const command_list_cache_key_t &key,
     raii::ze_command_list_handle_t cmdList) {
   // TODO: add a limit?
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
-  auto [it, _] = ZeCommandListCache.try_emplace(desc);
+  std::unique_lock<ur_mutex> Lock(Shard.ZeCommandListCacheMutex);
+  auto [it, _] = Shard.ZeCommandListCache.try_emplace(key);
   it->second.emplace(std::move(cmdList));
 }
 
 size_t command_list_cache_t::getNumImmediateCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
   size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<immediate_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+  for (auto &Shard : Shards) {
+    std::unique_lock<ur_mutex> Lock(Shard.ZeCommandListCacheMutex);
+    for (auto &Pair : Shard.ZeCommandListCache) {
+      if (std::holds_alternative<immediate_command_list_descriptor_t>(
+              Pair.first.Desc))
+        NumLists += Pair.second.size();
+    }
   }
   return NumLists;
 }
 
 size_t command_list_cache_t::getNumRegularCommandLists() {
-  std::unique_lock<ur_mutex> Lock(ZeCommandListCacheMutex);
   size_t NumLists = 0;
-  for (auto &Pair : ZeCommandListCache) {
-    if (std::holds_alternative<regular_command_list_descriptor_t>(Pair.first))
-      NumLists += Pair.second.size();
+  for (auto &Shard : Shards) {
+    std::unique_lock<ur_mutex> Lock(Shard.ZeCommandListCacheMutex);
+    for (auto &Pair : Shard.ZeCommandListCache) {
+      if (std::holds_alternative<regular_command_list_descriptor_t>(
+              Pair.first.Desc))
+        NumLists += Pair.second.size();
+    }
   }
   return NumLists;
 }
@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
 #include <functional>
 #include <stack>
 
@@ -51,6 +52,22 @@ struct command_list_descriptor_hash_t {
   inline size_t operator()(const command_list_descriptor_t &desc) const;
 };
 
+// Descriptor with its hash, computed once when borrowing a command list and
+// reused when returning it.
+struct command_list_cache_key_t {
+  command_list_descriptor_t Desc;
+  size_t Hash;
+  bool operator==(const command_list_cache_key_t &rhs) const {
+    return Hash == rhs.Hash && Desc == rhs.Desc;
+  }
+};
+
+struct command_list_cache_key_hash_t {
+  size_t operator()(const command_list_cache_key_t &key) const {
+    return key.Hash;
+  }
+};
+
 struct command_list_cache_t {
   command_list_cache_t(ze_context_handle_t ZeContext);
 
@@ -68,16 +85,28 @@ struct command_list_cache_t {
   size_t getNumRegularCommandLists();
 
 private:
+  // The command lists are sharded by device, so that queues created on
+  // different devices don't contend for the same lock. Shards are aligned to
+  // not share cache lines.
+  struct alignas(64) shard_t {
+    std::unordered_map<command_list_cache_key_t,
+                       std::stack<raii::ze_command_list_handle_t>,
+                       command_list_cache_key_hash_t>
+        ZeCommandListCache;
+    ur_mutex ZeCommandListCacheMutex;
+  };
+  static constexpr size_t NumShards = 16;
+
   ze_context_handle_t ZeContext;
-  std::unordered_map<command_list_descriptor_t,
-                     std::stack<raii::ze_command_list_handle_t>,
-                     command_list_descriptor_hash_t>
-      ZeCommandListCache;
-  ur_mutex ZeCommandListCacheMutex;
+  std::array<shard_t, NumShards> Shards;
 
+  shard_t &getShard(ze_device_handle_t ZeDevice);
+  raii::cache_borrowed_command_list_t
+  borrowCommandList(ze_device_handle_t ZeDevice,
+                    const command_list_descriptor_t &desc);
   raii::ze_command_list_handle_t
-  getCommandList(const command_list_descriptor_t &desc);
-  void addCommandList(const command_list_descriptor_t &desc,
+  getCommandList(shard_t &Shard, const command_list_cache_key_t &key);
+  void addCommandList(shard_t &Shard, const command_list_cache_key_t &key,
                       raii::ze_command_list_handle_t cmdList);
   raii::ze_command_list_handle_t
   createCommandList(const command_list_descriptor_t &desc);
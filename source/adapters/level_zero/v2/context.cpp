@@ -151,6 +151,10 @@ ur_result_t urContextGetInfo(ur_context_handle_t hContext,
   case UR_CONTEXT_INFO_USM_FILL2D_SUPPORT:
     // 2D USM fill is not supported.
     return ReturnValue(uint8_t{false});
+  case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+  case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+  case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+    return hContext->memoryAccounting.getInfo(contextInfoType, ReturnValue);
   default:
     return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
   }
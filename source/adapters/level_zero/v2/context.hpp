@@ -15,6 +15,7 @@
 #include "command_list_cache.hpp"
 #include "common.hpp"
 #include "event_pool_cache.hpp"
+#include "ur_memory_accounting.hpp"
 #include "usm.hpp"
 
 struct ur_context_handle_t_ : _ur_object {
@@ -35,6 +36,10 @@ struct ur_context_handle_t_ : _ur_object {
   // For that the Device or its root devices need to be in the context.
   bool isValidDevice(ur_device_handle_t Device) const;
 
+  // Memory the pools of the context hold, declared before the default pool,
+  // which returns its memory as it's destroyed
+  ur::memory_accounting memoryAccounting{this};
+
   v2::command_list_cache_t commandListCache;
   v2::event_pool_cache eventPoolCache;
 
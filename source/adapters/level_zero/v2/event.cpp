@@ -13,6 +13,7 @@
 #include "event.hpp"
 #include "event_pool.hpp"
 #include "event_provider.hpp"
+#include "queue_api.hpp"
 
 #include "../ur_interface_loader.hpp"
 
@@ -25,6 +26,8 @@ ur_event_handle_t_::ur_event_handle_t_(
       timestampMaxValue(getDevice()->getTimestampMask()) {}
 
 void ur_event_handle_t_::reset() {
+  signalingQueueId = 0;
+
   // consider make an abstraction for regular/counter based
   // events if there's more of this type of conditions
   if (pool->getFlags() & v2::EVENT_FLAGS_COUNTER) {
@@ -45,6 +48,11 @@ ur_result_t ur_event_handle_t_::release() {
   if (!RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
+  if (hQueue) {
+    UR_CALL(hQueue->queueRelease());
+    hQueue = nullptr;
+  }
+
   if (isTimestamped() && adjustedEventEndTimestamp == 0) {
     // L0 will write end timestamp to this event some time in the future,
     // so we can't release it yet.
@@ -57,6 +65,26 @@ ur_result_t ur_event_handle_t_::release() {
   return UR_RESULT_SUCCESS;
 }
 
+void ur_event_handle_t_::setQueue(ur_queue_handle_t hQueue) {
+  assert(!this->hQueue);
+  hQueue->queueRetain();
+  this->hQueue = hQueue;
+}
+
+ur_queue_handle_t ur_event_handle_t_::getQueue() const { return hQueue; }
+
+ur_result_t ur_event_handle_t_::flushQueue() {
+  return hQueue ? hQueue->queueFlush() : UR_RESULT_SUCCESS;
+}
+
+void ur_event_handle_t_::setSignalingQueueId(uint64_t queueId) {
+  signalingQueueId = queueId;
+}
+
+uint64_t ur_event_handle_t_::getSignalingQueueId() const {
+  return signalingQueueId;
+}
+
 bool ur_event_handle_t_::isTimestamped() const {
   // If we are recording, the start time of the event will be non-zero.
   return adjustedEventStartTimestamp != 0;
@@ -138,6 +166,10 @@ ur_result_t urEventRelease(ur_event_handle_t hEvent) {
 
 ur_result_t urEventWait(uint32_t numEvents,
                         const ur_event_handle_t *phEventWaitList) {
+  // Flush all the queues first, so that no command waits on a later flush
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    UR_CALL(phEventWaitList[i]->flushQueue());
+  }
   for (uint32_t i = 0; i < numEvents; ++i) {
     ZE2UR_CALL(zeEventHostSynchronize,
                (phEventWaitList[i]->getZeEvent(), UINT64_MAX));
@@ -145,6 +177,23 @@ ur_result_t urEventWait(uint32_t numEvents,
   return UR_RESULT_SUCCESS;
 }
 
+ur_result_t urEventWaitAnyExp(uint32_t numEvents,
+                              const ur_event_handle_t *phEventWaitList,
+                              uint32_t *pIndex) {
+  for (uint32_t i = 0; i < numEvents; ++i) {
+    UR_CALL(phEventWaitList[i]->flushQueue());
+  }
+  return ur::waitAnyEvent(
+      numEvents,
+      [&](uint32_t i, bool &completed) {
+        completed = ZE_CALL_NOCHECK(zeEventQueryStatus,
+                                    (phEventWaitList[i]->getZeEvent())) ==
+                    ZE_RESULT_SUCCESS;
+        return UR_RESULT_SUCCESS;
+      },
+      *pIndex);
+}
+
 ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
                            size_t propValueSize, void *pPropValue,
                            size_t *pPropValueSizeRet) {
@@ -152,6 +201,7 @@ ur_result_t urEventGetInfo(ur_event_handle_t hEvent, ur_event_info_t propName,
 
   switch (propName) {
   case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS: {
+    UR_CALL(hEvent->flushQueue());
     auto zeStatus = ZE_CALL_NOCHECK(zeEventQueryStatus, (hEvent->getZeEvent()));
 
     if (zeStatus == ZE_RESULT_NOT_READY) {
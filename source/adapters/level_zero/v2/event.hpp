@@ -43,6 +43,21 @@ public:
   // Device associated with this event
   ur_device_handle_t getDevice() const;
 
+  // Makes the event retain hQueue, whose commands may not be submitted when
+  // enqueued, until it is released.
+  void setQueue(ur_queue_handle_t hQueue);
+
+  // Queue which has to be flushed for the event to be signaled, or nullptr
+  ur_queue_handle_t getQueue() const;
+
+  // Submits the commands enqueued before the event's one on its queue.
+  ur_result_t flushQueue();
+
+  // Id of the in-order queue whose command signals the event, or 0 if
+  // unknown. The later commands of that queue don't have to wait for it.
+  void setSignalingQueueId(uint64_t queueId);
+  uint64_t getSignalingQueueId() const;
+
   void recordStartTimestamp();
   uint64_t *getEventEndTimestampPtr();
 
@@ -50,8 +65,14 @@ public:
   uint64_t getEventEndTimestamp();
 
 private:
+  friend class v2::event_pool;
+
   v2::raii::cache_borrowed_event zeEvent;
   v2::event_pool *pool;
+  // Next event freed to the pool before this one
+  ur_event_handle_t_ *nextFree = nullptr;
+  ur_queue_handle_t hQueue = nullptr;
+  uint64_t signalingQueueId = 0;
 
   uint64_t adjustedEventStartTimestamp;
   uint64_t recordEventEndTimestamp;
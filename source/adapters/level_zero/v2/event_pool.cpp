@@ -7,6 +7,8 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include <algorithm>
+
 #include "event_pool.hpp"
 #include "common/latency_tracker.hpp"
 #include "ur_api.h"
@@ -17,8 +19,18 @@ static constexpr size_t EVENTS_BURST = 64;
 
 ur_event_handle_t_ *event_pool::allocate() {
   TRACK_SCOPE_LATENCY("event_pool::allocate");
+  std::lock_guard<std::mutex> Lock(*allocateMutex);
 
-  std::unique_lock<std::mutex> lock(*mutex);
+  // Take all the freed events at once, keeping the most recently freed one on
+  // top, since its Level Zero event is the most likely to be cached
+  if (freed->load(std::memory_order_relaxed)) {
+    auto first = freelist.size();
+    auto event = freed->exchange(nullptr, std::memory_order_acquire);
+    for (; event; event = event->nextFree) {
+      freelist.push_back(event);
+    }
+    std::reverse(freelist.begin() + first, freelist.end());
+  }
 
   if (freelist.empty()) {
     auto start = events.size();
@@ -38,14 +50,17 @@ ur_event_handle_t_ *event_pool::allocate() {
 void event_pool::free(ur_event_handle_t_ *event) {
   TRACK_SCOPE_LATENCY("event_pool::free");
 
-  std::unique_lock<std::mutex> lock(*mutex);
-
   event->reset();
-  freelist.push_back(event);
 
   // The event is still in the pool, so we need to increment the refcount
   assert(event->RefCount.load() == 0);
   event->RefCount.increment();
+
+  event->nextFree = freed->load(std::memory_order_relaxed);
+  while (!freed->compare_exchange_weak(event->nextFree, event,
+                                       std::memory_order_release,
+                                       std::memory_order_relaxed))
+    ;
 }
 
 event_provider *event_pool::getProvider() const { return provider.get(); }
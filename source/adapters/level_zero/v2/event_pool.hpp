@@ -9,6 +9,7 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <stack>
@@ -30,7 +31,9 @@ class event_pool {
 public:
   // store weak reference to the queue as event_pool is part of the queue
   event_pool(std::unique_ptr<event_provider> Provider)
-      : provider(std::move(Provider)), mutex(std::make_unique<std::mutex>()){};
+      : provider(std::move(Provider)),
+        freed(std::make_unique<std::atomic<ur_event_handle_t_ *>>(nullptr)),
+        allocateMutex(std::make_unique<std::mutex>()){};
 
   event_pool(event_pool &&other) = default;
   event_pool &operator=(event_pool &&other) = default;
@@ -40,10 +43,12 @@ public:
 
   DeviceId Id() { return provider->device()->Id.value(); };
 
-  // Allocate an event from the pool. Thread safe.
+  // Allocate an event from the pool. Thread safe, so that the threads
+  // submitting to the queue which borrowed the pool allocate their events
+  // before taking the queue's lock.
   ur_event_handle_t_ *allocate();
 
-  // Free an event back to the pool. Thread safe.
+  // Free an event back to the pool. Thread safe and lock-free.
   void free(ur_event_handle_t_ *event);
 
   event_provider *getProvider() const;
@@ -53,9 +58,14 @@ private:
   std::unique_ptr<event_provider> provider;
 
   std::deque<ur_event_handle_t_> events;
+  // Free events, only accessed by allocate, under allocateMutex
   std::vector<ur_event_handle_t_ *> freelist;
 
-  std::unique_ptr<std::mutex> mutex;
+  // Stack of the events freed since allocate last took them all, linked
+  // through ur_event_handle_t_::nextFree, the most recently freed on top.
+  std::unique_ptr<std::atomic<ur_event_handle_t_ *>> freed;
+
+  std::unique_ptr<std::mutex> allocateMutex;
 };
 
 } // namespace v2
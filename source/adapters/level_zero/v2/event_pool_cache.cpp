@@ -10,9 +10,13 @@
 #include "event_pool_cache.hpp"
 #include "../device.hpp"
 #include "../platform.hpp"
+#include "ur_perf_counters.hpp"
 
 namespace v2 {
 
+static ur::perf_counter EventPoolCacheHits{"event_pool_cache.hits"};
+static ur::perf_counter EventPoolCacheMisses{"event_pool_cache.misses"};
+
 event_pool_cache::event_pool_cache(size_t max_devices,
                                    ProviderCreateFunc ProviderCreate)
     : providerCreate(ProviderCreate) {
@@ -33,7 +37,10 @@ raii::cache_borrowed_event_pool event_pool_cache::borrow(DeviceId id,
 
   auto &vec = pools[event_desc.index()];
   if (vec.empty()) {
+    EventPoolCacheMisses.add();
     vec.emplace_back(std::make_unique<event_pool>(providerCreate(id, flags)));
+  } else {
+    EventPoolCacheHits.add();
   }
 
   auto pool = vec.back().release();
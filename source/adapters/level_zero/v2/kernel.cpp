@@ -15,6 +15,7 @@
 #include "memory.hpp"
 
 #include "../device.hpp"
+#include "../helpers/kernel_helpers.hpp"
 #include "../platform.hpp"
 #include "../program.hpp"
 #include "../ur_interface_loader.hpp"
@@ -105,8 +106,8 @@ void ur_kernel_handle_t_::completeInitialization() {
   };
 }
 
-ze_kernel_handle_t
-ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
+ur_single_device_kernel_t &
+ur_kernel_handle_t_::getSingleDeviceKernel(ur_device_handle_t hDevice) {
   // root-device's kernel can be submitted to a sub-device's queue
   if (hDevice->isSubDevice()) {
     hDevice = hDevice->RootDevice;
@@ -123,7 +124,7 @@ ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
       throw UR_RESULT_ERROR_INVALID_DEVICE;
     }
 
-    return kernel.hKernel.get();
+    return kernel;
   }
 
   if (!deviceKernels[hDevice->Id.value()].has_value()) {
@@ -132,7 +133,59 @@ ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
 
   assert(deviceKernels[hDevice->Id.value()].value().hKernel.get());
 
-  return deviceKernels[hDevice->Id.value()].value().hKernel.get();
+  return deviceKernels[hDevice->Id.value()].value();
+}
+
+ze_kernel_handle_t
+ur_kernel_handle_t_::getZeHandle(ur_device_handle_t hDevice) {
+  return getSingleDeviceKernel(hDevice).hKernel.get();
+}
+
+ur_result_t ur_kernel_handle_t_::setLaunchGroupSize(
+    ur_device_handle_t hDevice, uint32_t workDim,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    ze_group_count_t &zeThreadGroupDimensions) {
+  // Bounds the suggestions kept for kernels launched with many global sizes
+  static constexpr size_t maxSuggestedGroupSizes = 16;
+
+  auto &kernel = getSingleDeviceKernel(hDevice);
+  auto hZeKernel = kernel.hKernel.get();
+
+  uint32_t WG[3];
+  if (pLocalWorkSize || !pGlobalWorkSize) {
+    UR_CALL(calculateKernelWorkDimensions(hZeKernel, hDevice,
+                                          zeThreadGroupDimensions, WG, workDim,
+                                          pGlobalWorkSize, pLocalWorkSize));
+  } else {
+    std::array<size_t, 3> globalSize = {1, 1, 1};
+    std::copy(pGlobalWorkSize, pGlobalWorkSize + workDim, globalSize.begin());
+
+    auto suggested = kernel.suggestedGroupSizes.find(globalSize);
+    if (suggested != kernel.suggestedGroupSizes.end()) {
+      size_t localSize[3] = {suggested->second[0], suggested->second[1],
+                             suggested->second[2]};
+      UR_CALL(calculateKernelWorkDimensions(hZeKernel, hDevice,
+                                            zeThreadGroupDimensions, WG,
+                                            workDim, pGlobalWorkSize,
+                                            localSize));
+    } else {
+      UR_CALL(calculateKernelWorkDimensions(hZeKernel, hDevice,
+                                            zeThreadGroupDimensions, WG,
+                                            workDim, pGlobalWorkSize, nullptr));
+      if (kernel.suggestedGroupSizes.size() >= maxSuggestedGroupSizes) {
+        kernel.suggestedGroupSizes.clear();
+      }
+      kernel.suggestedGroupSizes[globalSize] = {WG[0], WG[1], WG[2]};
+    }
+  }
+
+  std::array<uint32_t, 3> groupSize = {WG[0], WG[1], WG[2]};
+  if (groupSize != kernel.groupSize) {
+    ZE2UR_CALL(zeKernelSetGroupSize, (hZeKernel, WG[0], WG[1], WG[2]));
+    kernel.groupSize = groupSize;
+  }
+
+  return UR_RESULT_SUCCESS;
 }
 
 const std::string &ur_kernel_handle_t_::getName() const {
@@ -344,6 +397,39 @@ urKernelSetArgLocal(ur_kernel_handle_t hKernel, uint32_t argIndex,
   return hKernel->setArgValue(argIndex, argSize, nullptr, nullptr);
 }
 
+ur_result_t urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                               const ur_exp_kernel_arg_t *pArgs) {
+  TRACK_SCOPE_LATENCY("ur_kernel_handle_t_::setArgsExp");
+
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const auto &arg = pArgs[i];
+    switch (arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      UR_CALL(hKernel->setArgValue(arg.index, arg.size, nullptr,
+                                   arg.value.value));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      UR_CALL(hKernel->setArgPointer(arg.index, nullptr, arg.value.pointer));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ:
+      UR_CALL(urKernelSetArgMemObj(hKernel, arg.index, nullptr,
+                                   arg.value.memObjTuple.hMem));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      UR_CALL(hKernel->setArgValue(arg.index, arg.size, nullptr, nullptr));
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      UR_CALL(urKernelSetArgSampler(hKernel, arg.index, nullptr,
+                                    arg.value.sampler));
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urKernelSetExecInfo(
     ur_kernel_handle_t hKernel,     ///< [in] handle of the kernel object
     ur_kernel_exec_info_t propName, ///< [in] name of the execution attribute
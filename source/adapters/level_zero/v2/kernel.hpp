@@ -10,6 +10,9 @@
 
 #pragma once
 
+#include <array>
+#include <map>
+
 #include "../program.hpp"
 
 #include "common.hpp"
@@ -22,6 +25,11 @@ struct ur_single_device_kernel_t {
   ur_device_handle_t hDevice;
   v2::raii::ze_kernel_handle_t hKernel;
   mutable ZeCache<ZeStruct<ze_kernel_properties_t>> zeKernelProperties;
+
+  // Group sizes suggested for the global sizes launched so far, and the
+  // group size last set on hKernel, guarded by the Mutex of the kernel.
+  std::map<std::array<size_t, 3>, std::array<uint32_t, 3>> suggestedGroupSizes;
+  std::array<uint32_t, 3> groupSize = {0, 0, 0};
 };
 
 struct ur_kernel_handle_t_ : _ur_object {
@@ -49,6 +57,15 @@ public:
   // Get properties of the kernel.
   const ze_kernel_properties_t &getProperties(ur_device_handle_t hDevice) const;
 
+  // Sets the group size of the kernel for a launch on hDevice, and returns its
+  // group count. The suggested group sizes are cached, and the group size is
+  // only set if it differs from the previous launch. The caller must hold the
+  // Mutex of the kernel.
+  ur_result_t setLaunchGroupSize(ur_device_handle_t hDevice, uint32_t workDim,
+                                 const size_t *pGlobalWorkSize,
+                                 const size_t *pLocalWorkSize,
+                                 ze_group_count_t &zeThreadGroupDimensions);
+
   // Implementation of urKernelSetArgValue.
   ur_result_t setArgValue(uint32_t argIndex, size_t argSize,
                           const ur_kernel_arg_value_properties_t *pProperties,
@@ -78,4 +95,6 @@ private:
   mutable ZeCache<std::string> zeKernelName;
 
   void completeInitialization();
+
+  ur_single_device_kernel_t &getSingleDeviceKernel(ur_device_handle_t hDevice);
 };
@@ -62,6 +62,9 @@ ur_integrated_mem_handle_t::ur_integrated_mem_handle_t(
   if (!hostPtrImported) {
     UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
         hContext, nullptr, nullptr, UR_USM_TYPE_HOST, size, &this->ptr));
+    hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                          size);
 
     if (hostPtr) {
       std::memcpy(this->ptr, hostPtr, size);
@@ -71,6 +74,9 @@ ur_integrated_mem_handle_t::ur_integrated_mem_handle_t(
 
 ur_integrated_mem_handle_t::~ur_integrated_mem_handle_t() {
   if (ptr) {
+    hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                          UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                          getSize());
     auto ret = hContext->getDefaultUSMPool()->free(ptr);
     if (ret != UR_RESULT_SUCCESS) {
       logger::error("Failed to free host memory: {}", ret);
@@ -131,6 +137,9 @@ ur_discrete_mem_handle_t::migrateBufferTo(ur_device_handle_t hDevice, void *src,
     UR_CALL(hContext->getDefaultUSMPool()->allocate(hContext, hDevice, nullptr,
                                                     UR_USM_TYPE_DEVICE, size,
                                                     &deviceAllocations[Id]));
+    hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+                                          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                          size);
   }
 
   UR_CALL(
@@ -155,6 +164,9 @@ ur_discrete_mem_handle_t::ur_discrete_mem_handle_t(ur_context_handle_t hContext,
 ur_discrete_mem_handle_t::~ur_discrete_mem_handle_t() {
   for (auto &ptr : deviceAllocations) {
     if (ptr) {
+      hContext->memoryAccounting.reclassify(
+          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+          UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, getSize());
       auto ret = hContext->getDefaultUSMPool()->free(ptr);
       if (ret != UR_RESULT_SUCCESS) {
         logger::error("Failed to free device memory: {}", ret);
@@ -174,6 +186,9 @@ void *ur_discrete_mem_handle_t::getDevicePtrUnlocked(
     UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
         hContext, hDevice, nullptr, UR_USM_TYPE_DEVICE, getSize(),
         &deviceAllocations[hDevice->Id.value()]));
+    hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+                                          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                                          getSize());
     activeAllocationDevice = hDevice;
   }
 
@@ -215,10 +230,17 @@ void *ur_discrete_mem_handle_t::mapHostPtr(
   void *ptr;
   UR_CALL_THROWS(hContext->getDefaultUSMPool()->allocate(
       hContext, nullptr, nullptr, UR_USM_TYPE_HOST, size, &ptr));
+  // The host copy of the mapping is staging memory of the adapter
+  hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                        UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+                                        size);
 
   hostAllocations.emplace_back(ptr, size, offset, access);
 
-  if (activeAllocationDevice && access != access_mode_t::write_only) {
+  // The contents of a write-invalidate mapping are overwritten by the host,
+  // while the other writes may leave a part of the mapping unchanged, which
+  // is then written back on unmap
+  if (activeAllocationDevice && access != access_mode_t::write_invalidate) {
     auto srcPtr =
         ur_cast<char *>(deviceAllocations[activeAllocationDevice->Id.value()]) +
         offset;
@@ -233,31 +255,38 @@ void ur_discrete_mem_handle_t::unmapHostPtr(
     std::function<void(void *src, void *dst, size_t)> migrate) {
   std::lock_guard lock(this->Mutex);
 
-  for (auto &hostAllocation : hostAllocations) {
-    if (hostAllocation.ptr == pMappedPtr) {
-      void *devicePtr = nullptr;
-      if (activeAllocationDevice) {
-        devicePtr = ur_cast<char *>(
-                        deviceAllocations[activeAllocationDevice->Id.value()]) +
-                    hostAllocation.offset;
-      } else if (hostAllocation.access != access_mode_t::write_invalidate) {
-        devicePtr = ur_cast<char *>(getDevicePtrUnlocked(
-            hContext->getDevices()[0], access_mode_t::read_only,
-            hostAllocation.offset, hostAllocation.size, migrate));
-      }
-
-      if (devicePtr) {
-        migrate(hostAllocation.ptr, devicePtr, hostAllocation.size);
-      }
+  auto hostAllocation =
+      std::find_if(hostAllocations.begin(), hostAllocations.end(),
+                   [&](auto &desc) { return desc.ptr == pMappedPtr; });
+  if (hostAllocation == hostAllocations.end()) {
+    // No mapping found
+    throw UR_RESULT_ERROR_INVALID_ARGUMENT;
+  }
 
-      // TODO: use async free here?
-      UR_CALL_THROWS(hContext->getDefaultUSMPool()->free(hostAllocation.ptr));
-      return;
+  // A read-only mapping leaves the device memory unchanged, which is then
+  // neither written back nor allocated if the buffer has none yet
+  if (hostAllocation->access != access_mode_t::read_only) {
+    void *devicePtr = nullptr;
+    if (activeAllocationDevice) {
+      devicePtr = ur_cast<char *>(
+                      deviceAllocations[activeAllocationDevice->Id.value()]) +
+                  hostAllocation->offset;
+    } else {
+      devicePtr = ur_cast<char *>(getDevicePtrUnlocked(
+          hContext->getDevices()[0], access_mode_t::write_only,
+          hostAllocation->offset, hostAllocation->size, migrate));
     }
+
+    migrate(hostAllocation->ptr, devicePtr, hostAllocation->size);
   }
 
-  // No mapping found
-  throw UR_RESULT_ERROR_INVALID_ARGUMENT;
+  // TODO: use async free here?
+  auto ptr = hostAllocation->ptr;
+  hContext->memoryAccounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL,
+                                        UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST,
+                                        hostAllocation->size);
+  hostAllocations.erase(hostAllocation);
+  UR_CALL_THROWS(hContext->getDefaultUSMPool()->free(ptr));
 }
 
 namespace ur::level_zero {
@@ -10,6 +10,7 @@
  *
  */
 
+#include "latency_tracker.hpp"
 #include "queue_api.hpp"
 
 ur_queue_handle_t_::~ur_queue_handle_t_() {}
@@ -18,23 +19,29 @@ namespace ur::level_zero {
 ur_result_t urQueueGetInfo(ur_queue_handle_t hQueue, ur_queue_info_t propName,
                            size_t propSize, void *pPropValue,
                            size_t *pPropSizeRet) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueGetInfo");
   return hQueue->queueGetInfo(propName, propSize, pPropValue, pPropSizeRet);
 }
 ur_result_t urQueueRetain(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueRetain");
   return hQueue->queueRetain();
 }
 ur_result_t urQueueRelease(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueRelease");
   return hQueue->queueRelease();
 }
 ur_result_t urQueueGetNativeHandle(ur_queue_handle_t hQueue,
                                    ur_queue_native_desc_t *pDesc,
                                    ur_native_handle_t *phNativeQueue) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueGetNativeHandle");
   return hQueue->queueGetNativeHandle(pDesc, phNativeQueue);
 }
 ur_result_t urQueueFinish(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueFinish");
   return hQueue->queueFinish();
 }
 ur_result_t urQueueFlush(ur_queue_handle_t hQueue) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::queueFlush");
   return hQueue->queueFlush();
 }
 ur_result_t urEnqueueKernelLaunch(
@@ -42,6 +49,7 @@ ur_result_t urEnqueueKernelLaunch(
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueKernelLaunch");
   return hQueue->enqueueKernelLaunch(
       hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
       numEventsInWaitList, phEventWaitList, phEvent);
@@ -50,12 +58,14 @@ ur_result_t urEnqueueEventsWait(ur_queue_handle_t hQueue,
                                 uint32_t numEventsInWaitList,
                                 const ur_event_handle_t *phEventWaitList,
                                 ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueEventsWait");
   return hQueue->enqueueEventsWait(numEventsInWaitList, phEventWaitList,
                                    phEvent);
 }
 ur_result_t urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueEventsWaitWithBarrier");
   return hQueue->enqueueEventsWaitWithBarrier(numEventsInWaitList,
                                               phEventWaitList, phEvent);
 }
@@ -65,6 +75,7 @@ ur_result_t urEnqueueMemBufferRead(ur_queue_handle_t hQueue,
                                    uint32_t numEventsInWaitList,
                                    const ur_event_handle_t *phEventWaitList,
                                    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferRead");
   return hQueue->enqueueMemBufferRead(hBuffer, blockingRead, offset, size, pDst,
                                       numEventsInWaitList, phEventWaitList,
                                       phEvent);
@@ -73,6 +84,7 @@ ur_result_t urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferWrite");
   return hQueue->enqueueMemBufferWrite(hBuffer, blockingWrite, offset, size,
                                        pSrc, numEventsInWaitList,
                                        phEventWaitList, phEvent);
@@ -84,6 +96,7 @@ ur_result_t urEnqueueMemBufferReadRect(
     size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferReadRect");
   return hQueue->enqueueMemBufferReadRect(
       hBuffer, blockingRead, bufferOrigin, hostOrigin, region, bufferRowPitch,
       bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst, numEventsInWaitList,
@@ -96,6 +109,7 @@ ur_result_t urEnqueueMemBufferWriteRect(
     size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferWriteRect");
   return hQueue->enqueueMemBufferWriteRect(
       hBuffer, blockingWrite, bufferOrigin, hostOrigin, region, bufferRowPitch,
       bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList,
@@ -108,6 +122,7 @@ ur_result_t urEnqueueMemBufferCopy(ur_queue_handle_t hQueue,
                                    uint32_t numEventsInWaitList,
                                    const ur_event_handle_t *phEventWaitList,
                                    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferCopy");
   return hQueue->enqueueMemBufferCopy(hBufferSrc, hBufferDst, srcOffset,
                                       dstOffset, size, numEventsInWaitList,
                                       phEventWaitList, phEvent);
@@ -119,6 +134,7 @@ ur_result_t urEnqueueMemBufferCopyRect(
     size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferCopyRect");
   return hQueue->enqueueMemBufferCopyRect(
       hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region, srcRowPitch,
       srcSlicePitch, dstRowPitch, dstSlicePitch, numEventsInWaitList,
@@ -131,6 +147,7 @@ ur_result_t urEnqueueMemBufferFill(ur_queue_handle_t hQueue,
                                    uint32_t numEventsInWaitList,
                                    const ur_event_handle_t *phEventWaitList,
                                    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferFill");
   return hQueue->enqueueMemBufferFill(hBuffer, pPattern, patternSize, offset,
                                       size, numEventsInWaitList,
                                       phEventWaitList, phEvent);
@@ -140,6 +157,7 @@ ur_result_t urEnqueueMemImageRead(
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemImageRead");
   return hQueue->enqueueMemImageRead(
       hImage, blockingRead, origin, region, rowPitch, slicePitch, pDst,
       numEventsInWaitList, phEventWaitList, phEvent);
@@ -149,6 +167,7 @@ ur_result_t urEnqueueMemImageWrite(
     ur_rect_offset_t origin, ur_rect_region_t region, size_t rowPitch,
     size_t slicePitch, void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemImageWrite");
   return hQueue->enqueueMemImageWrite(
       hImage, blockingWrite, origin, region, rowPitch, slicePitch, pSrc,
       numEventsInWaitList, phEventWaitList, phEvent);
@@ -160,6 +179,7 @@ urEnqueueMemImageCopy(ur_queue_handle_t hQueue, ur_mem_handle_t hImageSrc,
                       uint32_t numEventsInWaitList,
                       const ur_event_handle_t *phEventWaitList,
                       ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemImageCopy");
   return hQueue->enqueueMemImageCopy(hImageSrc, hImageDst, srcOrigin, dstOrigin,
                                      region, numEventsInWaitList,
                                      phEventWaitList, phEvent);
@@ -170,6 +190,7 @@ ur_result_t urEnqueueMemBufferMap(ur_queue_handle_t hQueue,
                                   size_t size, uint32_t numEventsInWaitList,
                                   const ur_event_handle_t *phEventWaitList,
                                   ur_event_handle_t *phEvent, void **ppRetMap) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemBufferMap");
   return hQueue->enqueueMemBufferMap(hBuffer, blockingMap, mapFlags, offset,
                                      size, numEventsInWaitList, phEventWaitList,
                                      phEvent, ppRetMap);
@@ -178,6 +199,7 @@ ur_result_t urEnqueueMemUnmap(ur_queue_handle_t hQueue, ur_mem_handle_t hMem,
                               void *pMappedPtr, uint32_t numEventsInWaitList,
                               const ur_event_handle_t *phEventWaitList,
                               ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueMemUnmap");
   return hQueue->enqueueMemUnmap(hMem, pMappedPtr, numEventsInWaitList,
                                  phEventWaitList, phEvent);
 }
@@ -186,6 +208,7 @@ ur_result_t urEnqueueUSMFill(ur_queue_handle_t hQueue, void *pMem,
                              size_t size, uint32_t numEventsInWaitList,
                              const ur_event_handle_t *phEventWaitList,
                              ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMFill");
   return hQueue->enqueueUSMFill(pMem, patternSize, pPattern, size,
                                 numEventsInWaitList, phEventWaitList, phEvent);
 }
@@ -194,6 +217,7 @@ ur_result_t urEnqueueUSMMemcpy(ur_queue_handle_t hQueue, bool blocking,
                                uint32_t numEventsInWaitList,
                                const ur_event_handle_t *phEventWaitList,
                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMMemcpy");
   return hQueue->enqueueUSMMemcpy(blocking, pDst, pSrc, size,
                                   numEventsInWaitList, phEventWaitList,
                                   phEvent);
@@ -203,12 +227,14 @@ ur_result_t urEnqueueUSMPrefetch(ur_queue_handle_t hQueue, const void *pMem,
                                  uint32_t numEventsInWaitList,
                                  const ur_event_handle_t *phEventWaitList,
                                  ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMPrefetch");
   return hQueue->enqueueUSMPrefetch(pMem, size, flags, numEventsInWaitList,
                                     phEventWaitList, phEvent);
 }
 ur_result_t urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem,
                                size_t size, ur_usm_advice_flags_t advice,
                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMAdvise");
   return hQueue->enqueueUSMAdvise(pMem, size, advice, phEvent);
 }
 ur_result_t urEnqueueUSMFill2D(ur_queue_handle_t hQueue, void *pMem,
@@ -217,6 +243,7 @@ ur_result_t urEnqueueUSMFill2D(ur_queue_handle_t hQueue, void *pMem,
                                size_t height, uint32_t numEventsInWaitList,
                                const ur_event_handle_t *phEventWaitList,
                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMFill2D");
   return hQueue->enqueueUSMFill2D(pMem, pitch, patternSize, pPattern, width,
                                   height, numEventsInWaitList, phEventWaitList,
                                   phEvent);
@@ -227,6 +254,7 @@ ur_result_t urEnqueueUSMMemcpy2D(ur_queue_handle_t hQueue, bool blocking,
                                  uint32_t numEventsInWaitList,
                                  const ur_event_handle_t *phEventWaitList,
                                  ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMMemcpy2D");
   return hQueue->enqueueUSMMemcpy2D(blocking, pDst, dstPitch, pSrc, srcPitch,
                                     width, height, numEventsInWaitList,
                                     phEventWaitList, phEvent);
@@ -236,6 +264,7 @@ ur_result_t urEnqueueDeviceGlobalVariableWrite(
     bool blockingWrite, size_t count, size_t offset, const void *pSrc,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueDeviceGlobalVariableWrite");
   return hQueue->enqueueDeviceGlobalVariableWrite(
       hProgram, name, blockingWrite, count, offset, pSrc, numEventsInWaitList,
       phEventWaitList, phEvent);
@@ -245,6 +274,7 @@ ur_result_t urEnqueueDeviceGlobalVariableRead(
     bool blockingRead, size_t count, size_t offset, void *pDst,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueDeviceGlobalVariableRead");
   return hQueue->enqueueDeviceGlobalVariableRead(
       hProgram, name, blockingRead, count, offset, pDst, numEventsInWaitList,
       phEventWaitList, phEvent);
@@ -256,6 +286,7 @@ ur_result_t urEnqueueReadHostPipe(ur_queue_handle_t hQueue,
                                   uint32_t numEventsInWaitList,
                                   const ur_event_handle_t *phEventWaitList,
                                   ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueReadHostPipe");
   return hQueue->enqueueReadHostPipe(hProgram, pipe_symbol, blocking, pDst,
                                      size, numEventsInWaitList, phEventWaitList,
                                      phEvent);
@@ -267,6 +298,7 @@ ur_result_t urEnqueueWriteHostPipe(ur_queue_handle_t hQueue,
                                    uint32_t numEventsInWaitList,
                                    const ur_event_handle_t *phEventWaitList,
                                    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueWriteHostPipe");
   return hQueue->enqueueWriteHostPipe(hProgram, pipe_symbol, blocking, pSrc,
                                       size, numEventsInWaitList,
                                       phEventWaitList, phEvent);
@@ -279,15 +311,32 @@ ur_result_t urBindlessImagesImageCopyExp(
     ur_exp_image_copy_region_t *pCopyRegion,
     ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::bindlessImagesImageCopyExp");
   return hQueue->bindlessImagesImageCopyExp(
       pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
       pDstImageFormat, pCopyRegion, imageCopyFlags, numEventsInWaitList,
       phEventWaitList, phEvent);
 }
+ur_result_t urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, const void *pSrc, void *pDst,
+    const ur_image_desc_t *pSrcImageDesc, const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::bindlessImagesImageCopyBatchExp");
+  return hQueue->bindlessImagesImageCopyBatchExp(
+      pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+      pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+      numEventsInWaitList, phEventWaitList, phEvent);
+}
 ur_result_t urBindlessImagesWaitExternalSemaphoreExp(
     ur_queue_handle_t hQueue, ur_exp_external_semaphore_handle_t hSemaphore,
     bool hasWaitValue, uint64_t waitValue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_handle_t_::bindlessImagesWaitExternalSemaphoreExp");
   return hQueue->bindlessImagesWaitExternalSemaphoreExp(
       hSemaphore, hasWaitValue, waitValue, numEventsInWaitList, phEventWaitList,
       phEvent);
@@ -296,6 +345,8 @@ ur_result_t urBindlessImagesSignalExternalSemaphoreExp(
     ur_queue_handle_t hQueue, ur_exp_external_semaphore_handle_t hSemaphore,
     bool hasSignalValue, uint64_t signalValue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_handle_t_::bindlessImagesSignalExternalSemaphoreExp");
   return hQueue->bindlessImagesSignalExternalSemaphoreExp(
       hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
       phEventWaitList, phEvent);
@@ -305,6 +356,7 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueCooperativeKernelLaunchExp");
   return hQueue->enqueueCooperativeKernelLaunchExp(
       hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
       numEventsInWaitList, phEventWaitList, phEvent);
@@ -312,9 +364,27 @@ ur_result_t urEnqueueCooperativeKernelLaunchExp(
 ur_result_t urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueTimestampRecordingExp");
   return hQueue->enqueueTimestampRecordingExp(blocking, numEventsInWaitList,
                                               phEventWaitList, phEvent);
 }
+ur_result_t urEnqueueUSMDeviceAllocExp(ur_queue_handle_t hQueue, size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMDeviceAllocExp");
+  return hQueue->enqueueUSMDeviceAllocExp(size, numEventsInWaitList,
+                                          phEventWaitList, ppMem, phEvent);
+}
+ur_result_t urEnqueueUSMFreeExp(ur_queue_handle_t hQueue, void *pMem,
+                                uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMFreeExp");
+  return hQueue->enqueueUSMFreeExp(pMem, numEventsInWaitList, phEventWaitList,
+                                   phEvent);
+}
 ur_result_t urEnqueueKernelLaunchCustomExp(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -322,6 +392,7 @@ ur_result_t urEnqueueKernelLaunchCustomExp(
     const ur_exp_launch_property_t *launchPropList,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueKernelLaunchCustomExp");
   return hQueue->enqueueKernelLaunchCustomExp(
       hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
       numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
@@ -334,8 +405,45 @@ ur_result_t urEnqueueNativeCommandExp(
     const ur_exp_enqueue_native_command_properties_t *pProperties,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueNativeCommandExp");
   return hQueue->enqueueNativeCommandExp(
       pfnNativeEnqueue, data, numMemsInMemList, phMemList, pProperties,
       numEventsInWaitList, phEventWaitList, phEvent);
 }
+ur_result_t urEnqueueHostTaskExp(ur_queue_handle_t hQueue,
+                                 ur_exp_host_task_function_t pfnHostTask,
+                                 void *pUserData, uint32_t numEventsInWaitList,
+                                 const ur_event_handle_t *phEventWaitList,
+                                 ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueHostTaskExp");
+  return hQueue->enqueueHostTaskExp(pfnHostTask, pUserData, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+}
+ur_result_t urEnqueueIPCEventSignalExp(ur_queue_handle_t hQueue,
+                                       ur_event_handle_t hIPCEvent,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueIPCEventSignalExp");
+  return hQueue->enqueueIPCEventSignalExp(hIPCEvent, numEventsInWaitList,
+                                          phEventWaitList, phEvent);
+}
+ur_result_t urEnqueueIPCEventWaitExp(ur_queue_handle_t hQueue,
+                                     ur_event_handle_t hIPCEvent,
+                                     uint32_t numEventsInWaitList,
+                                     const ur_event_handle_t *phEventWaitList,
+                                     ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueIPCEventWaitExp");
+  return hQueue->enqueueIPCEventWaitExp(hIPCEvent, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+}
+ur_result_t urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_handle_t_::enqueueUSMMemcpyBatchExp");
+  return hQueue->enqueueUSMMemcpyBatchExp(blocking, numCopies, ppDst, ppSrc,
+                                          pSizes, numEventsInWaitList,
+                                          phEventWaitList, phEvent);
+}
 } // namespace ur::level_zero
\ No newline at end of file
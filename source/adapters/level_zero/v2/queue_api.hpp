@@ -13,6 +13,7 @@
 #pragma once
 
 #include <ur_api.h>
+#include <ze_api.h>
 
 struct ur_queue_handle_t_ {
   virtual ~ur_queue_handle_t_();
@@ -127,6 +128,11 @@ struct ur_queue_handle_t_ {
       const ur_image_format_t *, const ur_image_format_t *,
       ur_exp_image_copy_region_t *, ur_exp_image_copy_flags_t, uint32_t,
       const ur_event_handle_t *, ur_event_handle_t *) = 0;
+  virtual ur_result_t bindlessImagesImageCopyBatchExp(
+      const void *, void *, const ur_image_desc_t *, const ur_image_desc_t *,
+      const ur_image_format_t *, const ur_image_format_t *, uint32_t,
+      const ur_exp_image_copy_region_t *, ur_exp_image_copy_flags_t, uint32_t,
+      const ur_event_handle_t *, ur_event_handle_t *) = 0;
   virtual ur_result_t bindlessImagesWaitExternalSemaphoreExp(
       ur_exp_external_semaphore_handle_t, bool, uint64_t, uint32_t,
       const ur_event_handle_t *, ur_event_handle_t *) = 0;
@@ -140,6 +146,13 @@ struct ur_queue_handle_t_ {
   virtual ur_result_t enqueueTimestampRecordingExp(bool, uint32_t,
                                                    const ur_event_handle_t *,
                                                    ur_event_handle_t *) = 0;
+  virtual ur_result_t enqueueUSMDeviceAllocExp(size_t, uint32_t,
+                                               const ur_event_handle_t *,
+                                               void **,
+                                               ur_event_handle_t *) = 0;
+  virtual ur_result_t enqueueUSMFreeExp(void *, uint32_t,
+                                        const ur_event_handle_t *,
+                                        ur_event_handle_t *) = 0;
   virtual ur_result_t enqueueKernelLaunchCustomExp(
       ur_kernel_handle_t, uint32_t, const size_t *, const size_t *, uint32_t,
       const ur_exp_launch_property_t *, uint32_t, const ur_event_handle_t *,
@@ -150,4 +163,28 @@ struct ur_queue_handle_t_ {
                           const ur_exp_enqueue_native_command_properties_t *,
                           uint32_t, const ur_event_handle_t *,
                           ur_event_handle_t *) = 0;
+  virtual ur_result_t enqueueHostTaskExp(ur_exp_host_task_function_t, void *,
+                                         uint32_t, const ur_event_handle_t *,
+                                         ur_event_handle_t *) = 0;
+  virtual ur_result_t enqueueIPCEventSignalExp(ur_event_handle_t, uint32_t,
+                                               const ur_event_handle_t *,
+                                               ur_event_handle_t *) = 0;
+  virtual ur_result_t enqueueIPCEventWaitExp(ur_event_handle_t, uint32_t,
+                                             const ur_event_handle_t *,
+                                             ur_event_handle_t *) = 0;
+  virtual ur_result_t
+  enqueueUSMMemcpyBatchExp(bool, uint32_t, void **, const void **,
+                           const size_t *, uint32_t, const ur_event_handle_t *,
+                           ur_event_handle_t *) = 0;
+
+  // Appends zeCommandList, the regular command list of a finalized
+  // command-buffer, to the queue.
+  virtual ur_result_t enqueueCommandBuffer(ze_command_list_handle_t, uint32_t,
+                                           const ur_event_handle_t *,
+                                           ur_event_handle_t *) = 0;
+
+  // Sets the arguments of and launches the kernels of launches, which all
+  // target the queue, locking the queue once for them.
+  virtual ur_result_t
+  enqueueKernelLaunchBatch(uint32_t, const ur_exp_kernel_launch_t *) = 0;
 };
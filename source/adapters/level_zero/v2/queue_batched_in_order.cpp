@@ -0,0 +1,193 @@
+//===--------- queue_batched_in_order.cpp - Level Zero Adapter -----------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdlib>
+
+#include "queue_batched_in_order.hpp"
+
+#include "../common/latency_tracker.hpp"
+
+namespace v2 {
+
+// Number of the commands recorded into a command list before it is submitted,
+// set by UR_L0_BATCH_SIZE.
+static uint32_t getBatchSize() {
+  static const uint32_t batchSize = [] {
+    const char *batchSizeStr = std::getenv("UR_L0_BATCH_SIZE");
+    int value = batchSizeStr ? std::atoi(batchSizeStr) : 0;
+    return value > 0 ? static_cast<uint32_t>(value) : 16u;
+  }();
+  return batchSize;
+}
+
+static ze_command_queue_handle_t
+createCommandQueue(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                   const ur_queue_properties_t *pProps, int32_t zeOrdinal) {
+  ZeStruct<ze_command_queue_desc_t> desc;
+  desc.ordinal = zeOrdinal;
+  desc.index = getZeIndex(pProps).value_or(0);
+  desc.flags = ZE_COMMAND_QUEUE_FLAG_IN_ORDER;
+  desc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+  desc.priority = getZePriority(pProps ? pProps->flags : ur_queue_flags_t{});
+
+  ze_command_queue_handle_t zeQueue = nullptr;
+  ZE2UR_CALL_THROWS(zeCommandQueueCreate, (hContext->getZeHandle(),
+                                           hDevice->ZeDevice, &desc, &zeQueue));
+  return zeQueue;
+}
+
+ur_queue_batched_in_order_t::ur_queue_batched_in_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps)
+    : ur_queue_immediate_in_order_t(hContext, hDevice, pProps, false) {
+  copyBatch.zeQueue =
+      createCommandQueue(hContext, hDevice, pProps, copyHandler.zeOrdinal);
+  computeBatch.zeQueue =
+      createCommandQueue(hContext, hDevice, pProps, computeHandler.zeOrdinal);
+}
+
+ur_queue_batched_in_order_t::~ur_queue_batched_in_order_t() {
+  for (auto batch : {&copyBatch, &computeBatch}) {
+    // The command lists are cached once reset
+    for (auto &[commandList, zeFence] : batch->submitted) {
+      ZE_CALL_NOCHECK(zeCommandListReset, (commandList.get()));
+      ZE_CALL_NOCHECK(zeFenceDestroy, (zeFence));
+    }
+    batch->submitted.clear();
+    ZE_CALL_NOCHECK(zeCommandQueueDestroy, (batch->zeQueue));
+  }
+}
+
+ur_queue_batched_in_order_t::batch_t &
+ur_queue_batched_in_order_t::getBatch(ur_command_list_handler_t *handler) {
+  return handler == &copyHandler ? copyBatch : computeBatch;
+}
+
+ur_result_t
+ur_queue_batched_in_order_t::submitBatch(ur_command_list_handler_t *handler) {
+  auto &batch = getBatch(handler);
+  if (batch.numCommands == 0)
+    return UR_RESULT_SUCCESS;
+
+  TRACK_SCOPE_LATENCY("ur_queue_batched_in_order_t::submitBatch");
+
+  // Record the next batch into the oldest command list if it was executed
+  raii::cache_borrowed_command_list_t nextCommandList;
+  ze_fence_handle_t zeFence = nullptr;
+  if (!batch.submitted.empty() &&
+      ZE_CALL_NOCHECK(zeFenceQueryStatus, (batch.submitted.front().second)) ==
+          ZE_RESULT_SUCCESS) {
+    auto &[commandList, executedFence] = batch.submitted.front();
+    ZE2UR_CALL(zeCommandListReset, (commandList.get()));
+    ZE2UR_CALL(zeFenceReset, (executedFence));
+    nextCommandList = std::move(commandList);
+    zeFence = executedFence;
+    batch.submitted.pop_front();
+  } else {
+    nextCommandList = hContext->commandListCache.getRegularCommandList(
+        hDevice->ZeDevice, true, handler->zeOrdinal);
+    ZeStruct<ze_fence_desc_t> fenceDesc;
+    ZE2UR_CALL(zeFenceCreate, (batch.zeQueue, &fenceDesc, &zeFence));
+  }
+
+  auto zeCommandList = handler->commandList.get();
+  ZE2UR_CALL(zeCommandListClose, (zeCommandList));
+  ZE2UR_CALL(zeCommandQueueExecuteCommandLists,
+             (batch.zeQueue, 1, &zeCommandList, zeFence));
+  stats.onSubmission();
+
+  batch.submitted.emplace_back(std::move(handler->commandList), zeFence);
+  handler->commandList = std::move(nextCommandList);
+  batch.numCommands = 0;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_batched_in_order_t::submitBatches() {
+  UR_CALL(submitBatch(&copyHandler));
+  return submitBatch(&computeHandler);
+}
+
+ur_result_t ur_queue_batched_in_order_t::synchronize() {
+  TRACK_SCOPE_LATENCY("ur_queue_batched_in_order_t::synchronize");
+  for (auto batch : {&copyBatch, &computeBatch}) {
+    if (!batch->submitted.empty()) {
+      ZE2UR_CALL(zeCommandQueueSynchronize, (batch->zeQueue, UINT64_MAX));
+    }
+  }
+  lastHandler = nullptr;
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_batched_in_order_t::allocateSignalEvent(
+    ur_event_handle_t *hUserEvent) {
+  ur_queue_immediate_in_order_t::allocateSignalEvent(hUserEvent);
+  // Waiting for the event submits the batch recording its command
+  (*hUserEvent)->setQueue(this);
+}
+
+ur_result_t ur_queue_batched_in_order_t::finalizeHandler(
+    ur_command_list_handler_t *handler) {
+  // The command is only submitted with its batch
+  lastHandler = handler;
+  if (++getBatch(handler).numCommands >= getBatchSize()) {
+    return submitBatch(handler);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_batched_in_order_t::finalizeHandler(
+    ur_command_list_handler_t *handler, bool blocking) {
+  if (!blocking)
+    return finalizeHandler(handler);
+
+  getBatch(handler).numCommands++;
+  // The command may wait for the commands of the other handler
+  UR_CALL(submitBatches());
+  return synchronize();
+}
+
+ur_result_t ur_queue_batched_in_order_t::queueRelease() {
+  if (!RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  // The commands still recorded are executed before the queue is destroyed
+  UR_CALL(submitBatches());
+  UR_CALL(synchronize());
+
+  delete this;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_batched_in_order_t::queueFinish() {
+  TRACK_SCOPE_LATENCY("ur_queue_batched_in_order_t::queueFinish");
+  ur::queue_stats::finish_scope finish(stats);
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+
+  UR_CALL(submitBatches());
+  UR_CALL(synchronize());
+  finish.finished();
+
+  auto freedBlocks = usmCache.release();
+  return usm_queue_cache_t::free(freedBlocks);
+}
+
+ur_result_t ur_queue_batched_in_order_t::queueFlush() {
+  std::unique_lock<ur_shared_mutex> lock(this->Mutex);
+  return submitBatches();
+}
+
+ur_result_t ur_queue_batched_in_order_t::enqueueCommandBuffer(
+    ze_command_list_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  logger::error("command-buffers are not supported by batched queues");
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+} // namespace v2
@@ -0,0 +1,71 @@
+//===--------- queue_batched_in_order.hpp - Level Zero Adapter -----------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <deque>
+#include <utility>
+
+#include "queue_immediate_in_order.hpp"
+
+namespace v2 {
+
+// In-order queue recording its commands into regular command lists, which are
+// submitted to Level Zero command queues in batches of UR_L0_BATCH_SIZE
+// commands, or when the queue is flushed or finished, or when one of its
+// events is waited for or queried. The commands are enqueued like on the
+// immediate in-order queue, only their submission differs.
+struct ur_queue_batched_in_order_t : public ur_queue_immediate_in_order_t {
+private:
+  struct batch_t {
+    ze_command_queue_handle_t zeQueue = nullptr;
+    // Commands recorded into the command list of the handler since the last
+    // submission
+    uint32_t numCommands = 0;
+    // The submitted command lists with the fences signaled once they are
+    // executed, the oldest first
+    std::deque<
+        std::pair<raii::cache_borrowed_command_list_t, ze_fence_handle_t>>
+        submitted;
+  };
+
+  batch_t copyBatch;
+  batch_t computeBatch;
+
+  batch_t &getBatch(ur_command_list_handler_t *handler);
+
+  // Submits the commands recorded by handler, and starts recording into a
+  // command list whose previous submission was executed, or a new one.
+  ur_result_t submitBatch(ur_command_list_handler_t *handler);
+  ur_result_t submitBatches();
+  // Waits for all the submitted command lists to be executed.
+  ur_result_t synchronize();
+
+  void allocateSignalEvent(ur_event_handle_t *hUserEvent) override;
+
+  ur_result_t finalizeHandler(ur_command_list_handler_t *handler) override;
+  ur_result_t finalizeHandler(ur_command_list_handler_t *handler,
+                              bool blocking) override;
+
+public:
+  ur_queue_batched_in_order_t(ur_context_handle_t, ur_device_handle_t,
+                              const ur_queue_properties_t *);
+  ~ur_queue_batched_in_order_t();
+
+  ur_result_t queueRelease() override;
+  ur_result_t queueFinish() override;
+  ur_result_t queueFlush() override;
+  // The commands of a command-buffer can't be recorded into the regular
+  // command lists of the batches.
+  ur_result_t enqueueCommandBuffer(ze_command_list_handle_t, uint32_t,
+                                   const ur_event_handle_t *,
+                                   ur_event_handle_t *) override;
+};
+
+} // namespace v2
@@ -12,7 +12,9 @@
 
 #include "logger/ur_logger.hpp"
 #include "queue_api.hpp"
+#include "queue_batched_in_order.hpp"
 #include "queue_immediate_in_order.hpp"
+#include "queue_immediate_out_of_order.hpp"
 
 #include <tuple>
 #include <utility>
@@ -26,9 +28,19 @@ ur_result_t urQueueCreate(ur_context_handle_t hContext,
     return UR_RESULT_ERROR_INVALID_DEVICE;
   }
 
-  // TODO: For now, always use immediate, in-order
-  *phQueue =
-      new v2::ur_queue_immediate_in_order_t(hContext, hDevice, pProperties);
+  // Out-of-order queues submit their commands immediately, batched or not
+  if (pProperties &&
+      (pProperties->flags & UR_QUEUE_FLAG_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
+    *phQueue = new v2::ur_queue_immediate_out_of_order_t(hContext, hDevice,
+                                                         pProperties);
+  } else if (pProperties &&
+             (pProperties->flags & UR_QUEUE_FLAG_SUBMISSION_BATCHED)) {
+    *phQueue =
+        new v2::ur_queue_batched_in_order_t(hContext, hDevice, pProperties);
+  } else {
+    *phQueue =
+        new v2::ur_queue_immediate_in_order_t(hContext, hDevice, pProperties);
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -44,4 +56,23 @@ ur_result_t urQueueCreateWithNativeHandle(
   logger::error("{} function not implemented!", __FUNCTION__);
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+ur_result_t
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches) {
+  // The consecutive launches on a queue are handed to it together, for it to
+  // lock itself once for them
+  uint32_t first = 0;
+  while (first < numLaunches) {
+    uint32_t last = first + 1;
+    while (last < numLaunches &&
+           pLaunches[last].hQueue == pLaunches[first].hQueue) {
+      last++;
+    }
+    UR_CALL(pLaunches[first].hQueue->enqueueKernelLaunchBatch(
+        last - first, pLaunches + first));
+    first = last;
+  }
+  return UR_RESULT_SUCCESS;
+}
 } // namespace ur::level_zero
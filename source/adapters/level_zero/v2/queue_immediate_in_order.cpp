@@ -19,38 +19,81 @@
 #include "../program.hpp"
 #include "../ur_interface_loader.hpp"
 
+#include <atomic>
+#include <unordered_set>
+
 namespace v2 {
 
+static uint64_t nextQueueId() {
+  static std::atomic<uint64_t> NextQueueId{1};
+  return NextQueueId++;
+}
+
 std::pair<ze_event_handle_t *, uint32_t>
-ur_queue_immediate_in_order_t::getWaitListView(
-    const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents,
-    ur_command_list_handler_t *pHandler) {
-  auto extraWaitEvent = (lastHandler && pHandler != lastHandler)
-                            ? lastHandler->lastEvent->getZeEvent()
-                            : nullptr;
+ur_queue_immediate_in_order_t::translateWaitList(
+    wait_list_storage_t &storage, const ur_event_handle_t *phWaitEvents,
+    uint32_t numWaitEvents) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::translateWaitList");
+  auto waitList = storage.get(numWaitEvents + 1);
+  uint32_t totalEvents = 0;
+
+  for (uint32_t i = 0; i < numWaitEvents; i++) {
+    // The commands of this queue are already ordered after the ones signaling
+    // its events, including the ones of the other handler, which is waited
+    // for through extraWaitEvent.
+    if (phWaitEvents[i]->getSignalingQueueId() == id) {
+      continue;
+    }
+    auto zeEvent = phWaitEvents[i]->getZeEvent();
+    if (ZE_CALL_NOCHECK(zeEventQueryStatus, (zeEvent)) == ZE_RESULT_SUCCESS) {
+      continue;
+    }
+    waitList[totalEvents++] = zeEvent;
+  }
 
-  auto totalEvents = numWaitEvents + (extraWaitEvent != nullptr);
-  waitList.reserve(totalEvents);
+  return {waitList, totalEvents};
+}
 
+ur_result_t ur_queue_immediate_in_order_t::flushWaitListQueues(
+    const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents) {
   for (uint32_t i = 0; i < numWaitEvents; i++) {
-    waitList[i] = phWaitEvents[i]->getZeEvent();
+    // The commands of other batched queues have to be submitted for their
+    // events to be signaled.
+    auto hWaitQueue = phWaitEvents[i]->getQueue();
+    if (hWaitQueue && hWaitQueue != static_cast<ur_queue_handle_t>(this)) {
+      UR_CALL(phWaitEvents[i]->flushQueue());
+    }
   }
+  return UR_RESULT_SUCCESS;
+}
 
-  if (extraWaitEvent) {
-    waitList[numWaitEvents] = extraWaitEvent;
+std::pair<ze_event_handle_t *, uint32_t>
+ur_queue_immediate_in_order_t::waitForLastHandler(
+    std::pair<ze_event_handle_t *, uint32_t> waitList,
+    ur_command_list_handler_t *pHandler) {
+  auto [pWaitEvents, numWaitEvents] = waitList;
+  if (lastHandler && pHandler != lastHandler) {
+    pWaitEvents[numWaitEvents++] = lastHandler->lastEvent->getZeEvent();
   }
+  return {numWaitEvents ? pWaitEvents : nullptr, numWaitEvents};
+}
 
-  return {waitList.data(), static_cast<uint32_t>(totalEvents)};
+std::pair<ze_event_handle_t *, uint32_t>
+ur_queue_immediate_in_order_t::getWaitListView(
+    wait_list_storage_t &storage, const ur_event_handle_t *phWaitEvents,
+    uint32_t numWaitEvents, ur_command_list_handler_t *pHandler) {
+  return waitForLastHandler(
+      translateWaitList(storage, phWaitEvents, numWaitEvents), pHandler);
 }
 
-static int32_t getZeOrdinal(ur_device_handle_t hDevice, queue_group_type type) {
+int32_t getZeOrdinal(ur_device_handle_t hDevice, queue_group_type type) {
   if (type == queue_group_type::MainCopy && hDevice->hasMainCopyEngine()) {
     return hDevice->QueueGroup[queue_group_type::MainCopy].ZeOrdinal;
   }
   return hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
 }
 
-static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
+std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
   if (pProps && pProps->pNext) {
     const ur_base_properties_t *extendedDesc =
         reinterpret_cast<const ur_base_properties_t *>(pProps->pNext);
@@ -63,7 +106,7 @@ static std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps) {
   return std::nullopt;
 }
 
-static ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
+ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
   if ((flags & UR_QUEUE_FLAG_PRIORITY_LOW) != 0)
     return ZE_COMMAND_QUEUE_PRIORITY_PRIORITY_LOW;
   if ((flags & UR_QUEUE_FLAG_PRIORITY_HIGH) != 0)
@@ -74,12 +117,17 @@ static ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags) {
 ur_command_list_handler_t::ur_command_list_handler_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProps, queue_group_type type,
-    event_pool *eventPool)
-    : commandList(hContext->commandListCache.getImmediateCommandList(
-          hDevice->ZeDevice, true, getZeOrdinal(hDevice, type),
-          ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
-          getZePriority(pProps ? pProps->flags : ur_queue_flags_t{}),
-          getZeIndex(pProps))),
+    event_pool *eventPool, bool immediate)
+    : zeOrdinal(getZeOrdinal(hDevice, type)),
+      commandList(
+          immediate
+              ? hContext->commandListCache.getImmediateCommandList(
+                    hDevice->ZeDevice, true, zeOrdinal,
+                    ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS,
+                    getZePriority(pProps ? pProps->flags : ur_queue_flags_t{}),
+                    getZeIndex(pProps))
+              : hContext->commandListCache.getRegularCommandList(
+                    hDevice->ZeDevice, true, zeOrdinal)),
       internalEvent(eventPool->allocate(), [=](ur_event_handle_t event) {
         ur::level_zero::urEventRelease(event);
       }) {}
@@ -94,13 +142,20 @@ static event_flags_t eventFlagsFromQueueFlags(ur_queue_flags_t flags) {
 ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProps)
-    : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0),
+    : ur_queue_immediate_in_order_t(hContext, hDevice, pProps, true) {}
+
+ur_queue_immediate_in_order_t::ur_queue_immediate_in_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps, bool immediate)
+    : id(nextQueueId()), hContext(hContext), hDevice(hDevice),
+      flags(pProps ? pProps->flags : 0),
       eventPool(hContext->eventPoolCache.borrow(
           hDevice->Id.value(), eventFlagsFromQueueFlags(flags))),
       copyHandler(hContext, hDevice, pProps, queue_group_type::MainCopy,
-                  eventPool.get()),
+                  eventPool.get(), immediate),
       computeHandler(hContext, hDevice, pProps, queue_group_type::Compute,
-                     eventPool.get()) {}
+                     eventPool.get(), immediate),
+      usmCache(hContext, hDevice) {}
 
 ur_command_list_handler_t *
 ur_queue_immediate_in_order_t::getCommandListHandlerForCompute() {
@@ -123,16 +178,30 @@ ur_queue_immediate_in_order_t::getCommandListHandlerForFill(
     return &computeHandler;
 }
 
+void ur_queue_immediate_in_order_t::allocateSignalEvent(
+    ur_event_handle_t *hUserEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::allocateSignalEvent");
+  *hUserEvent = eventPool->allocate();
+  (*hUserEvent)->setSignalingQueueId(id);
+}
+
+ur_event_handle_t ur_queue_immediate_in_order_t::recordSignalEvent(
+    ur_command_list_handler_t *handler, ur_event_handle_t userEvent) {
+  stats.onCommand();
+  if (lastHandler && lastHandler != handler) {
+    stats.onSwitch();
+  }
+  handler->lastEvent = userEvent ? userEvent : handler->internalEvent.get();
+  return handler->lastEvent;
+}
+
 ur_event_handle_t ur_queue_immediate_in_order_t::getSignalEvent(
     ur_command_list_handler_t *handler, ur_event_handle_t *hUserEvent) {
-  if (!hUserEvent) {
-    handler->lastEvent = handler->internalEvent.get();
-  } else {
-    *hUserEvent = eventPool->allocate();
-    handler->lastEvent = *hUserEvent;
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::getSignalEvent");
+  if (hUserEvent) {
+    allocateSignalEvent(hUserEvent);
   }
-
-  return handler->lastEvent;
+  return recordSignalEvent(handler, hUserEvent ? *hUserEvent : nullptr);
 }
 
 ur_result_t
@@ -154,10 +223,19 @@ ur_queue_immediate_in_order_t::queueGetInfo(ur_queue_info_t propName,
   case UR_QUEUE_INFO_SIZE:
   case UR_QUEUE_INFO_DEVICE_DEFAULT:
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+  case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+  case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+  case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+    return ur::queue_stats::getInfo(stats.snapshot(), propName, ReturnValue);
   case UR_QUEUE_INFO_EMPTY: {
     // We can exit early if we have in-order queue.
-    if (!lastHandler)
+    if (!lastHandler) {
+      stats.onIdle();
       return ReturnValue(true);
+    }
     [[fallthrough]];
   }
   default:
@@ -179,6 +257,11 @@ ur_result_t ur_queue_immediate_in_order_t::queueRelease() {
   if (!RefCount.decrementAndTest())
     return UR_RESULT_SUCCESS;
 
+  // The commands using the cached memory must complete before it's freed
+  if (!usmCache.empty()) {
+    UR_CALL(queueFinish());
+  }
+
   delete this;
   return UR_RESULT_SUCCESS;
 }
@@ -193,12 +276,14 @@ ur_result_t ur_queue_immediate_in_order_t::queueGetNativeHandle(
 ur_result_t ur_queue_immediate_in_order_t::finalizeHandler(
     ur_command_list_handler_t *handler) {
   lastHandler = handler;
+  stats.onSubmission();
   return UR_RESULT_SUCCESS;
 }
 
 ur_result_t ur_queue_immediate_in_order_t::finalizeHandler(
     ur_command_list_handler_t *handler, bool blocking) {
   if (blocking) {
+    stats.onSubmission();
     ZE2UR_CALL(zeCommandListHostSynchronize,
                (handler->commandList.get(), UINT64_MAX));
     lastHandler = nullptr;
@@ -211,22 +296,28 @@ ur_result_t ur_queue_immediate_in_order_t::finalizeHandler(
 
 ur_result_t ur_queue_immediate_in_order_t::queueFinish() {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::queueFinish");
+  ur::queue_stats::finish_scope finish(stats);
   std::unique_lock<ur_shared_mutex> lock(this->Mutex);
 
   if (!lastHandler) {
+    finish.finished();
     return UR_RESULT_SUCCESS;
   }
 
   auto lastCmdList = lastHandler->commandList.get();
   lastHandler = nullptr;
+  // Only the memory freed before the commands synchronized here is released,
+  // the commands enqueued meanwhile may still use the memory freed after them
+  auto freedBlocks = usmCache.release();
   lock.unlock();
 
   // TODO: use zeEventHostSynchronize instead?
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::zeCommandListHostSynchronize");
   ZE2UR_CALL(zeCommandListHostSynchronize, (lastCmdList, UINT64_MAX));
+  finish.finished();
 
-  return UR_RESULT_SUCCESS;
+  return usm_queue_cache_t::free(freedBlocks);
 }
 
 ur_result_t ur_queue_immediate_in_order_t::queueFlush() {
@@ -242,32 +333,66 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(hKernel->getProgramHandle(), UR_RESULT_ERROR_INVALID_NULL_POINTER);
-
   UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
   UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
 
-  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
 
+  wait_list_storage_t waitListStorage;
+  auto waitList =
+      translateWaitList(waitListStorage, phEventWaitList, numEventsInWaitList);
+  if (phEvent) {
+    allocateSignalEvent(phEvent);
+  }
+
+  // The kernel's arguments and group size are only set through its Level
+  // Zero handle, which must not change until the launch is appended.
   std::scoped_lock<ur_shared_mutex, ur_shared_mutex, ur_shared_mutex> Lock(
       hKernel->Mutex, hKernel->getProgramHandle()->Mutex, this->Mutex);
 
+  return appendKernelLaunch(hKernel, workDim, pGlobalWorkOffset,
+                            pGlobalWorkSize, pLocalWorkSize, waitList,
+                            phEvent ? *phEvent : nullptr);
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunchUnlocked(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  wait_list_storage_t waitListStorage;
+  auto waitList =
+      translateWaitList(waitListStorage, phEventWaitList, numEventsInWaitList);
+  if (phEvent) {
+    allocateSignalEvent(phEvent);
+  }
+  return appendKernelLaunch(hKernel, workDim, pGlobalWorkOffset,
+                            pGlobalWorkSize, pLocalWorkSize, waitList,
+                            phEvent ? *phEvent : nullptr);
+}
+
+ur_result_t ur_queue_immediate_in_order_t::appendKernelLaunch(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize,
+    std::pair<ze_event_handle_t *, uint32_t> waitList,
+    ur_event_handle_t userEvent) {
+  ze_kernel_handle_t hZeKernel = hKernel->getZeHandle(hDevice);
+
   if (pGlobalWorkOffset != NULL) {
     UR_CALL(setKernelGlobalOffset(hContext, hZeKernel, pGlobalWorkOffset));
   }
 
   ze_group_count_t zeThreadGroupDimensions{1, 1, 1};
-  uint32_t WG[3];
-  UR_CALL(calculateKernelWorkDimensions(hZeKernel, hDevice,
-                                        zeThreadGroupDimensions, WG, workDim,
-                                        pGlobalWorkSize, pLocalWorkSize));
-
-  ZE2UR_CALL(zeKernelSetGroupSize, (hZeKernel, WG[0], WG[1], WG[2]));
+  UR_CALL(hKernel->setLaunchGroupSize(hDevice, workDim, pGlobalWorkSize,
+                                      pLocalWorkSize, zeThreadGroupDimensions));
 
   auto handler = getCommandListHandlerForCompute();
-  auto signalEvent = getSignalEvent(handler, phEvent);
-
-  auto [pWaitEvents, numWaitEvents] =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  auto signalEvent = recordSignalEvent(handler, userEvent);
+  auto [pWaitEvents, numWaitEvents] = waitForLastHandler(waitList, handler);
 
   // TODO: consider migrating memory to the device if memory buffers are used
 
@@ -280,20 +405,72 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunch(
   return finalizeHandler(handler);
 }
 
+ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunchBatch(
+    uint32_t numLaunches, const ur_exp_kernel_launch_t *pLaunches) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::enqueueKernelLaunchBatch");
+
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    UR_CALL(flushWaitListQueues(pLaunches[i].phEventWaitList,
+                                pLaunches[i].numEventsInWaitList));
+  }
+
+  // The arguments are set before taking the queue lock, which the kernels
+  // are never locked before. The queue is then locked once for the launches
+  // whose arguments were set, so a run ends before a launch setting the
+  // arguments of a kernel launched earlier in it.
+  uint32_t first = 0;
+  while (first < numLaunches) {
+    std::unordered_set<ur_kernel_handle_t> runKernels;
+    uint32_t last = first;
+    for (; last < numLaunches; last++) {
+      const auto &launch = pLaunches[last];
+      UR_ASSERT(launch.hKernel->getProgramHandle(),
+                UR_RESULT_ERROR_INVALID_NULL_POINTER);
+      if (launch.numArgs) {
+        if (runKernels.count(launch.hKernel)) {
+          break;
+        }
+        UR_CALL(ur::level_zero::urKernelSetArgsExp(
+            launch.hKernel, launch.numArgs, launch.pArgs));
+      }
+      runKernels.insert(launch.hKernel);
+    }
+
+    std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+    for (; first < last; first++) {
+      const auto &launch = pLaunches[first];
+      std::scoped_lock<ur_shared_mutex, ur_shared_mutex> KernelLock(
+          launch.hKernel->Mutex, launch.hKernel->getProgramHandle()->Mutex);
+      UR_CALL(enqueueKernelLaunchUnlocked(
+          launch.hKernel, launch.workDim, launch.pGlobalWorkOffset,
+          launch.pGlobalWorkSize, launch.pLocalWorkSize,
+          launch.numEventsInWaitList, launch.phEventWaitList, launch.phEvent));
+    }
+  }
+
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_queue_immediate_in_order_t::enqueueEventsWait(
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueEventsWait");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::unique_lock<ur_shared_mutex> lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
-  auto [pWaitEvents, numWaitEvents] =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
-  ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
-             (handler->commandList.get(), numWaitEvents, pWaitEvents));
+  if (numWaitEvents) {
+    ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
+               (handler->commandList.get(), numWaitEvents, pWaitEvents));
+  }
   ZE2UR_CALL(zeCommandListAppendSignalEvent,
              (handler->commandList.get(), signalEvent->getZeEvent()));
 
@@ -317,8 +494,9 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericCopyUnlocked(
   auto handler = getCommandListHandlerForCopy();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto waitList =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto waitList = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   bool memoryMigrated = false;
   auto pSrc = ur_cast<char *>(src->getDevicePtr(
@@ -346,6 +524,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericCopyUnlocked(
     waitList.second = 0;
   }
 
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::zeCommandListAppendMemoryCopy");
   ZE2UR_CALL(zeCommandListAppendMemoryCopy,
              (handler->commandList.get(), pDst, pSrc, size,
               signalEvent->getZeEvent(), waitList.second, waitList.first));
@@ -361,6 +541,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferRead(
 
   UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   ur_usm_handle_t_ dstHandle(hContext, size, pDst);
@@ -377,6 +559,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferWrite(
 
   UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   ur_usm_handle_t_ srcHandle(hContext, size, pSrc);
@@ -397,8 +581,9 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueRegionCopyUnlocked(
   auto handler = getCommandListHandlerForCopy();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto waitList =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto waitList = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   bool memoryMigrated = false;
   auto pSrc = ur_cast<char *>(src->getDevicePtr(
@@ -425,6 +610,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueRegionCopyUnlocked(
     waitList.second = 0;
   }
 
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::zeCommandListAppendMemoryCopyRegion");
   ZE2UR_CALL(zeCommandListAppendMemoryCopyRegion,
              (handler->commandList.get(), pDst, &zeParams.dstRegion,
               zeParams.dstPitch, zeParams.dstSlicePitch, pSrc,
@@ -443,6 +630,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferReadRect(
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::enqueueMemBufferReadRect");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   ur_usm_handle_t_ dstHandle(hContext, 0, pDst);
@@ -461,6 +650,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferWriteRect(
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::enqueueMemBufferWriteRect");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   ur_usm_handle_t_ srcHandle(hContext, 0, pSrc);
@@ -481,6 +672,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferCopy(
   UR_ASSERT(dstOffset + size <= hBufferDst->getSize(),
             UR_RESULT_ERROR_INVALID_SIZE);
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   return enqueueGenericCopyUnlocked(hBufferSrc, hBufferDst, false, srcOffset,
@@ -497,6 +690,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferCopyRect(
   TRACK_SCOPE_LATENCY(
       "ur_queue_immediate_in_order_t::enqueueMemBufferCopyRect");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   return enqueueRegionCopyUnlocked(
@@ -513,6 +708,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferFill(
 
   UR_ASSERT(offset + size <= hBuffer->getSize(), UR_RESULT_ERROR_INVALID_SIZE);
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   return enqueueGenericFillUnlocked(hBuffer, offset, patternSize, pPattern,
@@ -595,13 +792,16 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferMap(
 
   ur_mem_handle_t_::access_mode_t accessMode = getAccessMode(mapFlags);
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCopy();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto waitList =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto waitList = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   bool memoryMigrated = false;
   auto pDst = ur_cast<char *>(hBuffer->mapHostPtr(
@@ -617,10 +817,10 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemBufferMap(
     // If memory was not migrated, we need to wait on the events here.
     ZE2UR_CALL(zeCommandListAppendWaitOnEvents,
                (handler->commandList.get(), waitList.second, waitList.first));
-    if (signalEvent) {
-      ZE2UR_CALL(zeCommandListAppendSignalEvent,
-                 (handler->commandList.get(), signalEvent->getZeEvent()));
-    }
+  }
+  if (signalEvent) {
+    ZE2UR_CALL(zeCommandListAppendSignalEvent,
+               (handler->commandList.get(), signalEvent->getZeEvent()));
   }
 
   return finalizeHandler(handler, blockingMap);
@@ -631,13 +831,16 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueMemUnmap(
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueMemUnmap");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCopy();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto waitList =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto waitList = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   // TODO: currently unmapHostPtr deallocates memory immediately,
   // since the memory might be used by the user, we need to make sure
@@ -669,8 +872,9 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericFillUnlocked(
   auto handler = getCommandListHandlerForFill(patternSize);
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto waitList =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto waitList = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   bool memoryMigrated = false;
   auto pDst = ur_cast<char *>(dst->getDevicePtr(
@@ -691,6 +895,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueGenericFillUnlocked(
 
   // TODO: support non-power-of-two pattern sizes
 
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::zeCommandListAppendMemoryFill");
   // PatternSize must be a power of two for zeCommandListAppendMemoryFill.
   // When it's not, the fill is emulated with zeCommandListAppendMemoryCopy.
   ZE2UR_CALL(zeCommandListAppendMemoryFill,
@@ -706,6 +912,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMFill(
     ur_event_handle_t *phEvent) {
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMFill");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   ur_usm_handle_t_ dstHandle(hContext, size, pMem);
@@ -721,13 +929,20 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpy(
   // TODO: parametrize latency tracking with 'blocking'
   TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMMemcpy");
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
+  wait_list_storage_t waitListStorage;
+  auto waitList =
+      translateWaitList(waitListStorage, phEventWaitList, numEventsInWaitList);
+  if (phEvent) {
+    allocateSignalEvent(phEvent);
+  }
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCopy();
-  auto signalEvent = getSignalEvent(handler, phEvent);
-
-  auto [pWaitEvents, numWaitEvents] =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  auto signalEvent = recordSignalEvent(handler, phEvent ? *phEvent : nullptr);
+  auto [pWaitEvents, numWaitEvents] = waitForLastHandler(waitList, handler);
 
   ZE2UR_CALL(zeCommandListAppendMemoryCopy,
              (handler->commandList.get(), pDst, pSrc, size,
@@ -742,13 +957,16 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMPrefetch(
     ur_event_handle_t *phEvent) {
   std::ignore = flags;
 
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto [pWaitEvents, numWaitEvents] =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   if (pWaitEvents) {
     ZE2UR_CALL(zeCommandListAppendBarrier, (handler->commandList.get(), nullptr,
@@ -776,7 +994,9 @@ ur_queue_immediate_in_order_t::enqueueUSMAdvise(const void *pMem, size_t size,
   auto handler = getCommandListHandlerForCompute();
   auto signalEvent = getSignalEvent(handler, phEvent);
 
-  auto [pWaitEvents, numWaitEvents] = getWaitListView(nullptr, 0, handler);
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] =
+      getWaitListView(waitListStorage, nullptr, 0, handler);
 
   if (pWaitEvents) {
     ZE2UR_CALL(zeCommandListAppendBarrier, (handler->commandList.get(), nullptr,
@@ -797,43 +1017,68 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueUSMFill2D(
     void *pMem, size_t pitch, size_t patternSize, const void *pPattern,
     size_t width, size_t height, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = pMem;
-  std::ignore = pitch;
-  std::ignore = patternSize;
-  std::ignore = pPattern;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMFill2D");
+
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  auto handler = getCommandListHandlerForFill(patternSize);
+  auto signalEvent = getSignalEvent(handler, phEvent);
+
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
+
+  // Contiguous rows are filled at once. Otherwise, Level Zero has no strided
+  // fill, so the rows are filled one by one by the in-order command list, the
+  // first one waiting for the wait list and the last one signaling the event.
+  size_t numRows = pitch == width ? 1 : height;
+  size_t rowSize = pitch == width ? width * height : width;
+  for (size_t row = 0; row < numRows; row++) {
+    bool isFirst = row == 0;
+    bool isLast = row == numRows - 1;
+    ZE2UR_CALL(zeCommandListAppendMemoryFill,
+               (handler->commandList.get(), ur_cast<char *>(pMem) + row * pitch,
+                pPattern, patternSize, rowSize,
+                isLast ? signalEvent->getZeEvent() : nullptr,
+                isFirst ? numWaitEvents : 0, isFirst ? pWaitEvents : nullptr));
+  }
+
+  return finalizeHandler(handler);
 }
 
 ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpy2D(
     bool blocking, void *pDst, size_t dstPitch, const void *pSrc,
     size_t srcPitch, size_t width, size_t height, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blocking;
-  std::ignore = pDst;
-  std::ignore = dstPitch;
-  std::ignore = pSrc;
-  std::ignore = srcPitch;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMMemcpy2D");
+
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  ur_rect_offset_t zeroOffset{0, 0, 0};
+  ur_rect_region_t region{width, height, 1};
+
+  ur_usm_handle_t_ srcHandle(hContext, 0, pSrc);
+  ur_usm_handle_t_ dstHandle(hContext, 0, pDst);
+  return enqueueRegionCopyUnlocked(&srcHandle, &dstHandle, blocking, zeroOffset,
+                                   zeroOffset, region, srcPitch, 0, dstPitch, 0,
+                                   numEventsInWaitList, phEventWaitList,
+                                   phEvent);
 }
 
-static void *getGlobalPointerFromModule(ze_module_handle_t hModule,
+static void *getGlobalPointerFromModule(ur_program_handle_t hProgram,
+                                        ze_module_handle_t hModule,
                                         size_t offset, size_t count,
                                         const char *name) {
   // Find global variable pointer
   size_t globalVarSize = 0;
   void *globalVarPtr = nullptr;
-  ZE2UR_CALL_THROWS(zeModuleGetGlobalPointer,
-                    (hModule, name, &globalVarSize, &globalVarPtr));
+  if (auto zeResult = hProgram->getZeGlobalPointer(
+          hModule, name, &globalVarSize, &globalVarPtr))
+    throw ze2urResult(zeResult);
   if (globalVarSize < offset + count) {
     setErrorMessage("Write device global variable is out of range.",
                     UR_RESULT_ERROR_INVALID_VALUE,
@@ -858,7 +1103,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableWrite(
   }
 
   // Find global variable pointer
-  auto globalVarPtr = getGlobalPointerFromModule(zeModule, offset, count, name);
+  auto globalVarPtr =
+      getGlobalPointerFromModule(hProgram, zeModule, offset, count, name);
 
   return enqueueUSMMemcpy(blockingWrite, ur_cast<char *>(globalVarPtr) + offset,
                           pSrc, count, numEventsInWaitList, phEventWaitList,
@@ -880,7 +1126,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueDeviceGlobalVariableRead(
   }
 
   // Find global variable pointer
-  auto globalVarPtr = getGlobalPointerFromModule(zeModule, offset, count, name);
+  auto globalVarPtr =
+      getGlobalPointerFromModule(hProgram, zeModule, offset, count, name);
 
   return enqueueUSMMemcpy(blockingRead, pDst,
                           ur_cast<char *>(globalVarPtr) + offset, count,
@@ -939,6 +1186,29 @@ ur_result_t ur_queue_immediate_in_order_t::bindlessImagesImageCopyExp(
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 
+ur_result_t ur_queue_immediate_in_order_t::bindlessImagesImageCopyBatchExp(
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  std::ignore = pDst;
+  std::ignore = pSrc;
+  std::ignore = pSrcImageDesc;
+  std::ignore = pDstImageDesc;
+  std::ignore = imageCopyFlags;
+  std::ignore = pSrcImageFormat;
+  std::ignore = pDstImageFormat;
+  std::ignore = numCopyRegions;
+  std::ignore = pCopyRegions;
+  std::ignore = numEventsInWaitList;
+  std::ignore = phEventWaitList;
+  std::ignore = phEvent;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 ur_result_t
 ur_queue_immediate_in_order_t::bindlessImagesWaitExternalSemaphoreExp(
     ur_exp_external_semaphore_handle_t hSemaphore, bool hasWaitValue,
@@ -986,6 +1256,8 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueCooperativeKernelLaunchExp(
 ur_result_t ur_queue_immediate_in_order_t::enqueueTimestampRecordingExp(
     bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
   std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
 
   auto handler = getCommandListHandlerForCompute();
@@ -995,8 +1267,9 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueTimestampRecordingExp(
     return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
   }
 
-  auto [pWaitEvents, numWaitEvents] =
-      getWaitListView(phEventWaitList, numEventsInWaitList, handler);
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
 
   signalEvent->recordStartTimestamp();
 
@@ -1008,6 +1281,59 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueTimestampRecordingExp(
   return finalizeHandler(handler, blocking);
 }
 
+ur_result_t ur_queue_immediate_in_order_t::enqueueUSMDeviceAllocExp(
+    size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, void **ppMem,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::enqueueUSMDeviceAllocExp");
+
+  {
+    std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+    UR_CALL(usmCache.allocate(size, ppMem));
+  }
+
+  // The commands enqueued after this one already run after the ones using
+  // any reused memory, a command is only needed for the wait list or event
+  if (!numEventsInWaitList && !phEvent) {
+    return UR_RESULT_SUCCESS;
+  }
+
+  auto result =
+      enqueueEventsWait(numEventsInWaitList, phEventWaitList, phEvent);
+  if (result != UR_RESULT_SUCCESS) {
+    std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+    usmCache.free(*ppMem);
+    *ppMem = nullptr;
+  }
+  return result;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueUSMFreeExp(
+    void *pMem, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueUSMFreeExp");
+
+  // The commands enqueued after the wait list are ordered with the ones of
+  // the wait list, so the memory can be handed out as soon as it's recorded
+  if (numEventsInWaitList || phEvent) {
+    UR_CALL(enqueueEventsWait(numEventsInWaitList, phEventWaitList, phEvent));
+  }
+
+  bool full = false;
+  {
+    std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+    usmCache.free(pMem);
+    full = usmCache.full();
+  }
+
+  // Past its limit, the cache is emptied once the commands using it are done
+  if (full) {
+    UR_CALL(queueFinish());
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t ur_queue_immediate_in_order_t::enqueueKernelLaunchCustomExp(
     ur_kernel_handle_t hKernel, uint32_t workDim, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numPropsInLaunchPropList,
@@ -1032,4 +1358,85 @@ ur_result_t ur_queue_immediate_in_order_t::enqueueNativeCommandExp(
     uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueHostTaskExp(
+    ur_exp_host_task_function_t, void *, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  // Host tasks need events the host can signal, which the counter-based
+  // events of the queue aren't
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueIPCEventSignalExp(
+    ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  // The counter-based events of the queue can't be shared between processes
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueIPCEventWaitExp(
+    ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  // The counter-based events of the queue can't be shared between processes
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueUSMMemcpyBatchExp(
+    bool blocking, uint32_t numCopies, void **ppDst, const void **ppSrc,
+    const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_in_order_t::enqueueUSMMemcpyBatchExp");
+
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
+  wait_list_storage_t waitListStorage;
+  auto waitList =
+      translateWaitList(waitListStorage, phEventWaitList, numEventsInWaitList);
+  if (phEvent) {
+    allocateSignalEvent(phEvent);
+  }
+
+  std::scoped_lock<ur_shared_mutex> Lock(this->Mutex);
+
+  auto handler = getCommandListHandlerForCopy();
+  auto signalEvent = recordSignalEvent(handler, phEvent ? *phEvent : nullptr);
+  auto [pWaitEvents, numWaitEvents] = waitForLastHandler(waitList, handler);
+
+  // The command list is in order: only the first copy waits for the wait list
+  // and only the last one signals the event
+  for (uint32_t i = 0; i < numCopies; ++i) {
+    bool isLast = i + 1 == numCopies;
+    ZE2UR_CALL(zeCommandListAppendMemoryCopy,
+               (handler->commandList.get(), ppDst[i], ppSrc[i], pSizes[i],
+                isLast ? signalEvent->getZeEvent() : nullptr,
+                i == 0 ? numWaitEvents : 0, i == 0 ? pWaitEvents : nullptr));
+  }
+
+  return finalizeHandler(handler, blocking);
+}
+
+ur_result_t ur_queue_immediate_in_order_t::enqueueCommandBuffer(
+    ze_command_list_handle_t commandBufferCommandList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_in_order_t::enqueueCommandBuffer");
+
+  UR_CALL(flushWaitListQueues(phEventWaitList, numEventsInWaitList));
+
+  std::scoped_lock<ur_shared_mutex> lock(this->Mutex);
+
+  auto handler = getCommandListHandlerForCompute();
+  auto signalEvent = getSignalEvent(handler, phEvent);
+
+  wait_list_storage_t waitListStorage;
+  auto [pWaitEvents, numWaitEvents] = getWaitListView(
+      waitListStorage, phEventWaitList, numEventsInWaitList, handler);
+
+  ZE2UR_CALL(zeCommandListImmediateAppendCommandListsExp,
+             (handler->commandList.get(), 1, &commandBufferCommandList,
+              signalEvent->getZeEvent(), numWaitEvents, pWaitEvents));
+
+  return finalizeHandler(handler);
+}
 } // namespace v2
@@ -9,6 +9,8 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <array>
+
 #include "../common.hpp"
 #include "../device.hpp"
 
@@ -16,19 +18,29 @@
 #include "event.hpp"
 #include "event_pool_cache.hpp"
 #include "queue_api.hpp"
+#include "usm.hpp"
 
 #include "ur/ur.hpp"
+#include "ur_queue_stats.hpp"
 
 namespace v2 {
 
 using queue_group_type = ur_device_handle_t_::queue_group_info_t::type;
 
+int32_t getZeOrdinal(ur_device_handle_t hDevice, queue_group_type type);
+std::optional<int32_t> getZeIndex(const ur_queue_properties_t *pProps);
+ze_command_queue_priority_t getZePriority(ur_queue_flags_t flags);
+
 struct ur_command_list_handler_t {
+  // Records the commands into an immediate command list, or into a regular
+  // one if immediate is false.
   ur_command_list_handler_t(ur_context_handle_t hContext,
                             ur_device_handle_t hDevice,
                             const ur_queue_properties_t *pProps,
-                            queue_group_type type, event_pool *eventPool);
+                            queue_group_type type, event_pool *eventPool,
+                            bool immediate = true);
 
+  int32_t zeOrdinal;
   raii::cache_borrowed_command_list_t commandList;
   std::unique_ptr<ur_event_handle_t_, std::function<void(ur_event_handle_t)>>
       internalEvent;
@@ -39,8 +51,27 @@ struct ur_command_list_handler_t {
   ur_event_handle_t lastEvent = nullptr;
 };
 
-struct ur_queue_immediate_in_order_t : _ur_object, public ur_queue_handle_t_ {
+// Storage of the Level Zero events of a wait list. The short wait lists,
+// which are the most common, are kept inline, so that translating them on the
+// stack of an enqueue doesn't allocate.
+struct wait_list_storage_t {
+  ze_event_handle_t *get(size_t capacity) {
+    if (capacity <= inlineEvents.size())
+      return inlineEvents.data();
+    heapEvents.resize(capacity);
+    return heapEvents.data();
+  }
+
 private:
+  std::array<ze_event_handle_t, 8> inlineEvents;
+  std::vector<ze_event_handle_t> heapEvents;
+};
+
+struct ur_queue_immediate_in_order_t : _ur_object, public ur_queue_handle_t_ {
+protected:
+  // Unique id of the queue, which unlike its address isn't reused by the
+  // queues created after it is released.
+  const uint64_t id;
   ur_context_handle_t hContext;
   ur_device_handle_t hDevice;
   ur_queue_flags_t flags;
@@ -51,22 +82,70 @@ private:
   ur_command_list_handler_t computeHandler;
   ur_command_list_handler_t *lastHandler = nullptr;
 
-  std::vector<ze_event_handle_t> waitList;
+  // Submission statistics, every command being a submission of its own on
+  // the immediate command lists
+  ur::queue_stats stats;
+
+  // Memory freed by enqueueUSMFreeExp, guarded by Mutex
+  usm_queue_cache_t usmCache;
 
+  // Commands are submitted in two steps, so that threads submitting to the
+  // same queue only serialize on ordering and appending their commands. The
+  // wait list is translated and the user's event allocated without the queue's
+  // lock, then the command is ordered after the previous ones of the queue and
+  // appended with it held.
+
+  // Translates the wait list into storage, leaving out the events which are
+  // already signaled or signaled by the previous commands of this queue. It
+  // doesn't depend on the queue's state, and leaves room for the event added
+  // by waitForLastHandler.
   std::pair<ze_event_handle_t *, uint32_t>
-  getWaitListView(const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents,
+  translateWaitList(wait_list_storage_t &storage,
+                    const ur_event_handle_t *phWaitEvents,
+                    uint32_t numWaitEvents);
+
+  // Submits the commands of the other batched queues which signal the events
+  // of the wait list. Flushing locks the other queues, so it's called before
+  // this queue's lock is taken, which is then never held with theirs.
+  ur_result_t flushWaitListQueues(const ur_event_handle_t *phWaitEvents,
+                                  uint32_t numWaitEvents);
+
+  // Adds the wait for the last command of the other handler to a translated
+  // wait list, if the next command is recorded by pHandler. Called with the
+  // queue's lock held.
+  std::pair<ze_event_handle_t *, uint32_t>
+  waitForLastHandler(std::pair<ze_event_handle_t *, uint32_t> waitList,
+                     ur_command_list_handler_t *pHandler);
+
+  // translateWaitList and waitForLastHandler at once
+  std::pair<ze_event_handle_t *, uint32_t>
+  getWaitListView(wait_list_storage_t &storage,
+                  const ur_event_handle_t *phWaitEvents, uint32_t numWaitEvents,
                   ur_command_list_handler_t *pHandler);
 
   ur_command_list_handler_t *getCommandListHandlerForCompute();
   ur_command_list_handler_t *getCommandListHandlerForCopy();
   ur_command_list_handler_t *getCommandListHandlerForFill(size_t patternSize);
 
+  // Allocates the event returned to the user into hUserEvent. The event pool
+  // has a lock of its own, so the queue's isn't needed.
+  virtual void allocateSignalEvent(ur_event_handle_t *hUserEvent);
+
+  // Makes userEvent, or the internal event of handler if it is null, the
+  // event signaled by the next command of handler. Called with the queue's
+  // lock held.
+  ur_event_handle_t recordSignalEvent(ur_command_list_handler_t *handler,
+                                      ur_event_handle_t userEvent);
+
+  // allocateSignalEvent, if hUserEvent is set, and recordSignalEvent at once
   ur_event_handle_t getSignalEvent(ur_command_list_handler_t *handler,
                                    ur_event_handle_t *hUserEvent);
 
-  ur_result_t finalizeHandler(ur_command_list_handler_t *handler);
-  ur_result_t finalizeHandler(ur_command_list_handler_t *handler,
-                              bool blocking);
+  // Called once a command is recorded by handler, waiting for its completion
+  // if blocking is set.
+  virtual ur_result_t finalizeHandler(ur_command_list_handler_t *handler);
+  virtual ur_result_t finalizeHandler(ur_command_list_handler_t *handler,
+                                      bool blocking);
 
   ur_result_t enqueueRegionCopyUnlocked(
       ur_mem_handle_t src, ur_mem_handle_t dst, bool blocking,
@@ -85,11 +164,33 @@ private:
       const void *pPattern, size_t size, uint32_t numEventsInWaitList,
       const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
 
+  // Appends the launch, with the wait list from translateWaitList and the
+  // event from allocateSignalEvent. Called with the mutexes of the queue, the
+  // kernel and its program held.
+  ur_result_t appendKernelLaunch(
+      ur_kernel_handle_t hKernel, uint32_t workDim,
+      const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+      const size_t *pLocalWorkSize,
+      std::pair<ze_event_handle_t *, uint32_t> waitList,
+      ur_event_handle_t userEvent);
+
+  // Called with the mutexes of the queue, the kernel and its program held.
+  ur_result_t enqueueKernelLaunchUnlocked(
+      ur_kernel_handle_t hKernel, uint32_t workDim,
+      const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+      const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+      const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent);
+
+  ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
+                                const ur_queue_properties_t *, bool immediate);
+
 public:
   ur_queue_immediate_in_order_t(ur_context_handle_t, ur_device_handle_t,
                                 const ur_queue_properties_t *);
   ~ur_queue_immediate_in_order_t() {}
 
+  ur::queue_stats::snapshot_t getStats() const { return stats.snapshot(); }
+
   ur_result_t queueGetInfo(ur_queue_info_t propName, size_t propSize,
                            void *pPropValue, size_t *pPropSizeRet) override;
   ur_result_t queueRetain() override;
@@ -241,6 +342,15 @@ public:
       ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
       const ur_event_handle_t *phEventWaitList,
       ur_event_handle_t *phEvent) override;
+  ur_result_t bindlessImagesImageCopyBatchExp(
+      const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+      const ur_image_desc_t *pDstImageDesc,
+      const ur_image_format_t *pSrcImageFormat,
+      const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+      const ur_exp_image_copy_region_t *pCopyRegions,
+      ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+      const ur_event_handle_t *phEventWaitList,
+      ur_event_handle_t *phEvent) override;
   ur_result_t bindlessImagesWaitExternalSemaphoreExp(
       ur_exp_external_semaphore_handle_t hSemaphore, bool hasWaitValue,
       uint64_t waitValue, uint32_t numEventsInWaitList,
@@ -261,6 +371,14 @@ public:
   enqueueTimestampRecordingExp(bool blocking, uint32_t numEventsInWaitList,
                                const ur_event_handle_t *phEventWaitList,
                                ur_event_handle_t *phEvent) override;
+  ur_result_t enqueueUSMDeviceAllocExp(size_t size,
+                                       uint32_t numEventsInWaitList,
+                                       const ur_event_handle_t *phEventWaitList,
+                                       void **ppMem,
+                                       ur_event_handle_t *phEvent) override;
+  ur_result_t enqueueUSMFreeExp(void *pMem, uint32_t numEventsInWaitList,
+                                const ur_event_handle_t *phEventWaitList,
+                                ur_event_handle_t *phEvent) override;
   ur_result_t enqueueKernelLaunchCustomExp(
       ur_kernel_handle_t hKernel, uint32_t workDim,
       const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
@@ -274,6 +392,24 @@ public:
                           const ur_exp_enqueue_native_command_properties_t *,
                           uint32_t, const ur_event_handle_t *,
                           ur_event_handle_t *) override;
+  ur_result_t enqueueHostTaskExp(ur_exp_host_task_function_t, void *, uint32_t,
+                                 const ur_event_handle_t *,
+                                 ur_event_handle_t *) override;
+  ur_result_t enqueueIPCEventSignalExp(ur_event_handle_t, uint32_t,
+                                       const ur_event_handle_t *,
+                                       ur_event_handle_t *) override;
+  ur_result_t enqueueIPCEventWaitExp(ur_event_handle_t, uint32_t,
+                                     const ur_event_handle_t *,
+                                     ur_event_handle_t *) override;
+  ur_result_t enqueueUSMMemcpyBatchExp(bool, uint32_t, void **, const void **,
+                                       const size_t *, uint32_t,
+                                       const ur_event_handle_t *,
+                                       ur_event_handle_t *) override;
+  ur_result_t enqueueCommandBuffer(ze_command_list_handle_t, uint32_t,
+                                   const ur_event_handle_t *,
+                                   ur_event_handle_t *) override;
+  ur_result_t enqueueKernelLaunchBatch(
+      uint32_t numLaunches, const ur_exp_kernel_launch_t *pLaunches) override;
 };
 
 } // namespace v2
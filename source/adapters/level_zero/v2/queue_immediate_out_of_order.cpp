@@ -0,0 +1,587 @@
+//===--------- queue_immediate_out_of_order.cpp - Level Zero Adapter -----===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdlib>
+
+#include "queue_immediate_out_of_order.hpp"
+
+#include "../common/latency_tracker.hpp"
+
+namespace v2 {
+
+// Number of the in-order queues an out-of-order queue spreads its commands
+// over, set by UR_L0_V2_OUT_OF_ORDER_QUEUE_LISTS.
+static uint32_t getNumInOrderQueues() {
+  static const uint32_t numQueues = [] {
+    const char *numQueuesStr = std::getenv("UR_L0_V2_OUT_OF_ORDER_QUEUE_LISTS");
+    int value = numQueuesStr ? std::atoi(numQueuesStr) : 0;
+    return value > 0 ? static_cast<uint32_t>(value) : 4u;
+  }();
+  return numQueues;
+}
+
+ur_queue_immediate_out_of_order_t::ur_queue_immediate_out_of_order_t(
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_queue_properties_t *pProps)
+    : hContext(hContext), hDevice(hDevice), flags(pProps ? pProps->flags : 0) {
+  for (uint32_t i = 0; i < getNumInOrderQueues(); i++) {
+    queues.push_back(std::make_unique<ur_queue_immediate_in_order_t>(
+        hContext, hDevice, pProps));
+  }
+}
+
+ur_queue_immediate_in_order_t *ur_queue_immediate_out_of_order_t::nextQueue() {
+  return queues[nextQueueIndex++ % queues.size()].get();
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueGetInfo(
+    ur_queue_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+  switch ((uint32_t)propName) { // cast to avoid warnings on EXT enum values
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hContext);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(hDevice);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(uint32_t{RefCount.load()});
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(flags);
+  case UR_QUEUE_INFO_SIZE:
+  case UR_QUEUE_INFO_DEVICE_DEFAULT:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+  case UR_QUEUE_INFO_EMPTY: {
+    for (auto &queue : queues) {
+      bool empty = false;
+      UR_CALL(queue->queueGetInfo(UR_QUEUE_INFO_EMPTY, sizeof(empty), &empty,
+                                  nullptr));
+      if (!empty)
+        return ReturnValue(false);
+    }
+    return ReturnValue(true);
+  }
+  // The commands go to each in-order queue in turn, so only the statistics
+  // of the in-order queues are kept
+  case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+  case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+  case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+  case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+  case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP: {
+    ur::queue_stats::snapshot_t stats;
+    for (auto &queue : queues) {
+      stats += queue->getStats();
+    }
+    return ur::queue_stats::getInfo(stats, propName, ReturnValue);
+  }
+  default:
+    logger::error(
+        "Unsupported ParamName in urQueueGetInfo: ParamName=ParamName={}(0x{})",
+        propName, logger::toHex(propName));
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRetain() {
+  RefCount.increment();
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueRelease() {
+  if (!RefCount.decrementAndTest())
+    return UR_RESULT_SUCCESS;
+
+  delete this;
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueGetNativeHandle(
+    ur_queue_native_desc_t *pDesc, ur_native_handle_t *phNativeQueue) {
+  std::ignore = pDesc;
+  std::ignore = phNativeQueue;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFinish() {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::queueFinish");
+  for (auto &queue : queues) {
+    UR_CALL(queue->queueFinish());
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::queueFlush() {
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::appendOtherQueuesDone(
+    std::vector<ur_event_handle_t> &waitList) {
+  size_t numEvents = waitList.size();
+  for (size_t i = 1; i < queues.size(); i++) {
+    ur_event_handle_t done = nullptr;
+    auto result = queues[i]->enqueueEventsWait(0, nullptr, &done);
+    if (result != UR_RESULT_SUCCESS) {
+      for (size_t j = numEvents; j < waitList.size(); j++) {
+        std::ignore = waitList[j]->release();
+      }
+      waitList.resize(numEvents);
+      return result;
+    }
+    waitList.push_back(done);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWait(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  // Without events to wait for, all the commands enqueued before are waited
+  // for.
+  if (numEventsInWaitList == 0)
+    return enqueueEventsWaitWithBarrier(0, nullptr, phEvent);
+  return nextQueue()->enqueueEventsWait(numEventsInWaitList, phEventWaitList,
+                                        phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier(
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY(
+      "ur_queue_immediate_out_of_order_t::enqueueEventsWaitWithBarrier");
+
+  // Barriers are enqueued one at a time, the other commands may be placed
+  // either side of a concurrent barrier.
+  std::scoped_lock<ur_shared_mutex> lock(Mutex);
+
+  // The first queue waits for the commands enqueued so far on the others, and
+  // then the others wait for the barrier.
+  std::vector<ur_event_handle_t> waitList(
+      phEventWaitList, phEventWaitList + numEventsInWaitList);
+  size_t numUserEvents = waitList.size();
+  UR_CALL(appendOtherQueuesDone(waitList));
+
+  ur_event_handle_t barrier = nullptr;
+  auto result = queues[0]->enqueueEventsWait(
+      static_cast<uint32_t>(waitList.size()), waitList.data(), &barrier);
+  for (size_t i = numUserEvents; i < waitList.size(); i++) {
+    UR_CALL(waitList[i]->release());
+  }
+  if (result != UR_RESULT_SUCCESS)
+    return result;
+
+  for (size_t i = 1; i < queues.size(); i++) {
+    result = queues[i]->enqueueEventsWait(1, &barrier, nullptr);
+    if (result != UR_RESULT_SUCCESS)
+      break;
+  }
+
+  if (phEvent && result == UR_RESULT_SUCCESS) {
+    *phEvent = barrier;
+    return UR_RESULT_SUCCESS;
+  }
+  UR_CALL(barrier->release());
+  return result;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunch(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueKernelLaunch(hKernel, workDim, pGlobalWorkOffset,
+                                          pGlobalWorkSize, pLocalWorkSize,
+                                          numEventsInWaitList, phEventWaitList,
+                                          phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferRead(
+    ur_mem_handle_t hBuffer, bool blockingRead, size_t offset, size_t size,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferRead(hBuffer, blockingRead, offset, size,
+                                           pDst, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWrite(
+    ur_mem_handle_t hBuffer, bool blockingWrite, size_t offset, size_t size,
+    const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferWrite(hBuffer, blockingWrite, offset,
+                                            size, pSrc, numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferReadRect(
+    ur_mem_handle_t hBuffer, bool blockingRead, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferReadRect(
+      hBuffer, blockingRead, bufferOrigin, hostOrigin, region, bufferRowPitch,
+      bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferWriteRect(
+    ur_mem_handle_t hBuffer, bool blockingWrite, ur_rect_offset_t bufferOrigin,
+    ur_rect_offset_t hostOrigin, ur_rect_region_t region, size_t bufferRowPitch,
+    size_t bufferSlicePitch, size_t hostRowPitch, size_t hostSlicePitch,
+    void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferWriteRect(
+      hBuffer, blockingWrite, bufferOrigin, hostOrigin, region, bufferRowPitch,
+      bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopy(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst, size_t srcOffset,
+    size_t dstOffset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferCopy(hBufferSrc, hBufferDst, srcOffset,
+                                           dstOffset, size, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferCopyRect(
+    ur_mem_handle_t hBufferSrc, ur_mem_handle_t hBufferDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, size_t srcRowPitch, size_t srcSlicePitch,
+    size_t dstRowPitch, size_t dstSlicePitch, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferCopyRect(
+      hBufferSrc, hBufferDst, srcOrigin, dstOrigin, region, srcRowPitch,
+      srcSlicePitch, dstRowPitch, dstSlicePitch, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferFill(
+    ur_mem_handle_t hBuffer, const void *pPattern, size_t patternSize,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemBufferFill(hBuffer, pPattern, patternSize,
+                                           offset, size, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageRead(
+    ur_mem_handle_t hImage, bool blockingRead, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pDst,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemImageRead(hImage, blockingRead, origin, region,
+                                          rowPitch, slicePitch, pDst,
+                                          numEventsInWaitList, phEventWaitList,
+                                          phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageWrite(
+    ur_mem_handle_t hImage, bool blockingWrite, ur_rect_offset_t origin,
+    ur_rect_region_t region, size_t rowPitch, size_t slicePitch, void *pSrc,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemImageWrite(hImage, blockingWrite, origin,
+                                           region, rowPitch, slicePitch, pSrc,
+                                           numEventsInWaitList, phEventWaitList,
+                                           phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemImageCopy(
+    ur_mem_handle_t hImageSrc, ur_mem_handle_t hImageDst,
+    ur_rect_offset_t srcOrigin, ur_rect_offset_t dstOrigin,
+    ur_rect_region_t region, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemImageCopy(hImageSrc, hImageDst, srcOrigin,
+                                          dstOrigin, region,
+                                          numEventsInWaitList, phEventWaitList,
+                                          phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemBufferMap(
+    ur_mem_handle_t hBuffer, bool blockingMap, ur_map_flags_t mapFlags,
+    size_t offset, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    void **ppRetMap) {
+  return nextQueue()->enqueueMemBufferMap(hBuffer, blockingMap, mapFlags,
+                                          offset, size, numEventsInWaitList,
+                                          phEventWaitList, phEvent, ppRetMap);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueMemUnmap(
+    ur_mem_handle_t hMem, void *pMappedPtr, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueMemUnmap(hMem, pMappedPtr, numEventsInWaitList,
+                                      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill(
+    void *pMem, size_t patternSize, const void *pPattern, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMFill(pMem, patternSize, pPattern, size,
+                                     numEventsInWaitList, phEventWaitList,
+                                     phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy(
+    bool blocking, void *pDst, const void *pSrc, size_t size,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMMemcpy(blocking, pDst, pSrc, size,
+                                       numEventsInWaitList, phEventWaitList,
+                                       phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFill2D(
+    void *pMem, size_t pitch, size_t patternSize, const void *pPattern,
+    size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMFill2D(pMem, pitch, patternSize, pPattern,
+                                       width, height, numEventsInWaitList,
+                                       phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpy2D(
+    bool blocking, void *pDst, size_t dstPitch, const void *pSrc,
+    size_t srcPitch, size_t width, size_t height, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMMemcpy2D(blocking, pDst, dstPitch, pSrc,
+                                         srcPitch, width, height,
+                                         numEventsInWaitList, phEventWaitList,
+                                         phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMPrefetch(
+    const void *pMem, size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMPrefetch(pMem, size, flags, numEventsInWaitList,
+                                         phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMAdvise(
+    const void *pMem, size_t size, ur_usm_advice_flags_t advice,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMAdvise(pMem, size, advice, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableWrite(
+    ur_program_handle_t hProgram, const char *name, bool blockingWrite,
+    size_t count, size_t offset, const void *pSrc, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueDeviceGlobalVariableWrite(
+      hProgram, name, blockingWrite, count, offset, pSrc, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueDeviceGlobalVariableRead(
+    ur_program_handle_t hProgram, const char *name, bool blockingRead,
+    size_t count, size_t offset, void *pDst, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueDeviceGlobalVariableRead(
+      hProgram, name, blockingRead, count, offset, pDst, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueReadHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pDst, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueReadHostPipe(hProgram, pipe_symbol, blocking, pDst,
+                                          size, numEventsInWaitList,
+                                          phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueWriteHostPipe(
+    ur_program_handle_t hProgram, const char *pipe_symbol, bool blocking,
+    void *pSrc, size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueWriteHostPipe(hProgram, pipe_symbol, blocking,
+                                           pSrc, size, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::bindlessImagesImageCopyExp(
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat,
+    ur_exp_image_copy_region_t *pCopyRegion,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->bindlessImagesImageCopyExp(
+      pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+      pDstImageFormat, pCopyRegion, imageCopyFlags, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::bindlessImagesImageCopyBatchExp(
+    const void *pSrc, void *pDst, const ur_image_desc_t *pSrcImageDesc,
+    const ur_image_desc_t *pDstImageDesc,
+    const ur_image_format_t *pSrcImageFormat,
+    const ur_image_format_t *pDstImageFormat, uint32_t numCopyRegions,
+    const ur_exp_image_copy_region_t *pCopyRegions,
+    ur_exp_image_copy_flags_t imageCopyFlags, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->bindlessImagesImageCopyBatchExp(
+      pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+      pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+      numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesWaitExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasWaitValue,
+    uint64_t waitValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->bindlessImagesWaitExternalSemaphoreExp(
+      hSemaphore, hasWaitValue, waitValue, numEventsInWaitList, phEventWaitList,
+      phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::bindlessImagesSignalExternalSemaphoreExp(
+    ur_exp_external_semaphore_handle_t hSemaphore, bool hasSignalValue,
+    uint64_t signalValue, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->bindlessImagesSignalExternalSemaphoreExp(
+      hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t
+ur_queue_immediate_out_of_order_t::enqueueCooperativeKernelLaunchExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueCooperativeKernelLaunchExp(
+      hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize, pLocalWorkSize,
+      numEventsInWaitList, phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueTimestampRecordingExp(
+    bool blocking, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueTimestampRecordingExp(blocking,
+                                                   numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMDeviceAllocExp(
+    size_t size, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, void **ppMem,
+    ur_event_handle_t *phEvent) {
+  // Memory is cached by the first queue, see enqueueUSMFreeExp
+  return queues[0]->enqueueUSMDeviceAllocExp(
+      size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMFreeExp(
+    void *pMem, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  TRACK_SCOPE_LATENCY("ur_queue_immediate_out_of_order_t::enqueueUSMFreeExp");
+
+  // The memory freed may still be used by the commands enqueued so far on any
+  // of the queues, the first one, whose allocations may reuse it, waits for
+  // them like barriers do.
+  std::scoped_lock<ur_shared_mutex> lock(Mutex);
+
+  std::vector<ur_event_handle_t> waitList(
+      phEventWaitList, phEventWaitList + numEventsInWaitList);
+  size_t numUserEvents = waitList.size();
+  UR_CALL(appendOtherQueuesDone(waitList));
+
+  auto result = queues[0]->enqueueUSMFreeExp(
+      pMem, static_cast<uint32_t>(waitList.size()), waitList.data(), phEvent);
+  for (size_t i = numUserEvents; i < waitList.size(); i++) {
+    UR_CALL(waitList[i]->release());
+  }
+  return result;
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunchCustomExp(
+    ur_kernel_handle_t hKernel, uint32_t workDim, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numPropsInLaunchPropList,
+    const ur_exp_launch_property_t *launchPropList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueKernelLaunchCustomExp(
+      hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+      numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueNativeCommandExp(
+    ur_exp_enqueue_native_command_function_t pfnNativeEnqueue, void *data,
+    uint32_t numMemsInMemList, const ur_mem_handle_t *phMemList,
+    const ur_exp_enqueue_native_command_properties_t *pProperties,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueNativeCommandExp(pfnNativeEnqueue, data,
+                                              numMemsInMemList, phMemList,
+                                              pProperties, numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueHostTaskExp(
+    ur_exp_host_task_function_t pfnHostTask, void *pUserData,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueHostTaskExp(pfnHostTask, pUserData,
+                                         numEventsInWaitList, phEventWaitList,
+                                         phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueIPCEventSignalExp(
+    ur_event_handle_t hIPCEvent, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueIPCEventSignalExp(hIPCEvent, numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueIPCEventWaitExp(
+    ur_event_handle_t hIPCEvent, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueIPCEventWaitExp(hIPCEvent, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueUSMMemcpyBatchExp(
+    bool blocking, uint32_t numCopies, void **ppDst, const void **ppSrc,
+    const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueUSMMemcpyBatchExp(
+      blocking, numCopies, ppDst, ppSrc, pSizes, numEventsInWaitList,
+      phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueCommandBuffer(
+    ze_command_list_handle_t commandBufferCommandList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  return nextQueue()->enqueueCommandBuffer(commandBufferCommandList,
+                                           numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+}
+
+ur_result_t ur_queue_immediate_out_of_order_t::enqueueKernelLaunchBatch(
+    uint32_t numLaunches, const ur_exp_kernel_launch_t *pLaunches) {
+  // Each launch goes to the next in-order queue, as the single launches do,
+  // so that the launches of the batch may still run concurrently
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    UR_CALL(nextQueue()->enqueueKernelLaunchBatch(1, &pLaunches[i]));
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+} // namespace v2
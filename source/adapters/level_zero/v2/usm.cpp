@@ -12,7 +12,6 @@
 
 #include "../device.hpp"
 #include "context.hpp"
-#include "umf_pools/disjoint_pool_config_parser.hpp"
 #include "usm.hpp"
 
 #include <umf/pools/pool_disjoint.h>
@@ -59,6 +58,17 @@ inline umf_usm_memory_type_t urToUmfMemoryType(ur_usm_type_t type) {
   }
 }
 
+static ur_exp_context_memory_type_t urToContextMemoryType(ur_usm_type_t type) {
+  switch (type) {
+  case UR_USM_TYPE_DEVICE:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE;
+  case UR_USM_TYPE_SHARED:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED;
+  default:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST;
+  }
+}
+
 static usm::DisjointPoolMemType
 descToDisjoinPoolMemType(const usm::pool_descriptor &desc) {
   switch (desc.type) {
@@ -77,9 +87,8 @@ descToDisjoinPoolMemType(const usm::pool_descriptor &desc) {
   }
 }
 
-static umf::pool_unique_handle_t
-makePool(umf_disjoint_pool_params_t *poolParams,
-         usm::pool_descriptor poolDescriptor) {
+static umf::provider_unique_handle_t
+makeProvider(const usm::pool_descriptor &poolDescriptor) {
   level_zero_memory_provider_params_t params = {};
   params.level_zero_context_handle = poolDescriptor.hContext->getZeHandle();
   params.level_zero_device_handle =
@@ -107,33 +116,163 @@ makePool(umf_disjoint_pool_params_t *poolParams,
     throw umf::umf2urResult(ret);
   }
 
-  if (!poolParams) {
+  // The memory of the pools counts in the context as the USM they serve
+  auto [accountingRet, accountingProvider] = umf::accountingProviderMakeUnique(
+      std::move(provider), &poolDescriptor.hContext->memoryAccounting,
+      urToContextMemoryType(poolDescriptor.type));
+  if (accountingRet != UMF_RESULT_SUCCESS) {
+    throw umf::umf2urResult(accountingRet);
+  }
+  return std::move(accountingProvider);
+}
+
+static umf::pool_unique_handle_t
+makePool(usm::DisjointPoolAllConfigs *poolConfigs,
+         usm::pool_descriptor poolDescriptor,
+         umf::pool_stats_t *stats = nullptr) {
+  auto provider = makeProvider(poolDescriptor);
+
+  if (!poolConfigs) {
     auto [ret, poolHandle] = umf::poolMakeUniqueFromOps(
         umfProxyPoolOps(), std::move(provider), nullptr);
     if (ret != UMF_RESULT_SUCCESS)
       throw umf::umf2urResult(ret);
     return std::move(poolHandle);
   } else {
-    auto [ret, poolHandle] =
-        umf::poolMakeUniqueFromOps(umfDisjointPoolOps(), std::move(provider),
-                                   static_cast<void *>(poolParams));
+    auto [ret, poolHandle] = poolConfigs->makePool(
+        std::move(provider), descToDisjoinPoolMemType(poolDescriptor), stats);
     if (ret != UMF_RESULT_SUCCESS)
       throw umf::umf2urResult(ret);
     return std::move(poolHandle);
   }
 }
 
+static umf::pool_unique_handle_t
+makeZeroedPool(usm::DisjointPoolAllConfigs &poolConfigs,
+               const usm::pool_descriptor &poolDescriptor,
+               std::shared_ptr<usm_zero_filler_t> filler) {
+  umf::zeroed_pool_params_t zeroParams;
+  zeroParams.Filler = std::move(filler);
+
+  auto [ret, poolHandle] = umf::zeroedPoolMakeUnique(
+      makeProvider(poolDescriptor),
+      &poolConfigs.Configs[descToDisjoinPoolMemType(poolDescriptor)],
+      zeroParams);
+  if (ret != UMF_RESULT_SUCCESS)
+    throw umf::umf2urResult(ret);
+  return std::move(poolHandle);
+}
+
+static umf_result_t ze2umfResult(ze_result_t zeResult) {
+  switch (zeResult) {
+  case ZE_RESULT_SUCCESS:
+    return UMF_RESULT_SUCCESS;
+  case ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY:
+    return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  default:
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+}
+
+static constexpr uint32_t ZERO_FILL_EVENTS = 64;
+
+usm_zero_filler_t::usm_zero_filler_t(ur_context_handle_t hContext,
+                                     ur_device_handle_t hDevice) {
+  using queue_group_type = ur_device_handle_t_::queue_group_info_t::type;
+
+  // Off the compute engine the kernels run on, when the device has a copy
+  // engine
+  ZeStruct<ze_command_queue_desc_t> queueDesc;
+  queueDesc.ordinal =
+      hDevice->hasMainCopyEngine()
+          ? hDevice->QueueGroup[queue_group_type::MainCopy].ZeOrdinal
+          : hDevice->QueueGroup[queue_group_type::Compute].ZeOrdinal;
+  queueDesc.mode = ZE_COMMAND_QUEUE_MODE_ASYNCHRONOUS;
+  queueDesc.priority = ZE_COMMAND_QUEUE_PRIORITY_NORMAL;
+  queueDesc.flags = ZE_COMMAND_QUEUE_FLAG_IN_ORDER;
+  ZE2UR_CALL_THROWS(zeCommandListCreateImmediate,
+                    (hContext->getZeHandle(), hDevice->ZeDevice, &queueDesc,
+                     commandList.ptr()));
+
+  ZeStruct<ze_event_pool_desc_t> poolDesc;
+  poolDesc.count = ZERO_FILL_EVENTS;
+  poolDesc.flags = ZE_EVENT_POOL_FLAG_HOST_VISIBLE;
+  ZE2UR_CALL_THROWS(zeEventPoolCreate,
+                    (hContext->getZeHandle(), &poolDesc, 1,
+                     const_cast<ze_device_handle_t *>(&hDevice->ZeDevice),
+                     eventPool.ptr()));
+
+  events.resize(ZERO_FILL_EVENTS);
+  for (uint32_t i = 0; i < ZERO_FILL_EVENTS; ++i) {
+    ZeStruct<ze_event_desc_t> desc;
+    desc.index = i;
+    desc.signal = ZE_EVENT_SCOPE_FLAG_HOST;
+    desc.wait = 0;
+    ZE2UR_CALL_THROWS(zeEventCreate, (eventPool.get(), &desc, events[i].ptr()));
+  }
+}
+
+umf_result_t usm_zero_filler_t::fill(void *ptr, size_t size, uint64_t *seq) {
+  std::scoped_lock<ur_mutex> lock(mutex);
+  auto next = submitted + 1;
+  auto &event = events[next % events.size()];
+
+  // The fill which signaled the event last must be complete to reset it
+  if (next > events.size()) {
+    if (auto ret = waitLocked(next - events.size()); ret != UMF_RESULT_SUCCESS)
+      return ret;
+    if (auto ret = ze2umfResult(
+            ZE_CALL_NOCHECK(zeEventHostReset, (event.get())));
+        ret != UMF_RESULT_SUCCESS)
+      return ret;
+  }
+
+  static constexpr uint8_t zero = 0;
+  if (auto ret = ze2umfResult(ZE_CALL_NOCHECK(
+          zeCommandListAppendMemoryFill,
+          (commandList.get(), ptr, &zero, sizeof(zero), size, event.get(), 0,
+           nullptr)));
+      ret != UMF_RESULT_SUCCESS)
+    return ret;
+
+  submitted = next;
+  *seq = next;
+  return UMF_RESULT_SUCCESS;
+}
+
+umf_result_t usm_zero_filler_t::wait(uint64_t seq) {
+  std::scoped_lock<ur_mutex> lock(mutex);
+  return waitLocked(seq);
+}
+
+umf_result_t usm_zero_filler_t::waitLocked(uint64_t seq) {
+  if (seq <= completed) {
+    return UMF_RESULT_SUCCESS;
+  }
+  // The list is in order, the earlier fills are complete as well
+  auto ret = ze2umfResult(
+      ZE_CALL_NOCHECK(zeEventHostSynchronize,
+                      (events[seq % events.size()].get(), UINT64_MAX)));
+  if (ret == UMF_RESULT_SUCCESS) {
+    completed = seq;
+  }
+  return ret;
+}
+
 ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t hContext,
                                              ur_usm_pool_desc_t *pPoolDesc)
-    : hContext(hContext) {
+    : hContext(hContext), disjointPoolConfigs(initializeDisjointPoolConfig()) {
   // TODO: handle UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK from pPoolDesc
-  auto disjointPoolConfigs = initializeDisjointPoolConfig();
   if (auto limits = find_stype_node<ur_usm_pool_limits_desc_t>(pPoolDesc)) {
     for (auto &config : disjointPoolConfigs.Configs) {
       config.MaxPoolableSize = limits->maxPoolableSize;
       config.SlabMinSize = limits->minDriverAllocSize;
     }
   }
+  if (auto arena = find_stype_node<ur_exp_usm_pool_arena_desc_t>(pPoolDesc)) {
+    disjointPoolConfigs.Arenas[usm::DisjointPoolMemType::Device] = {
+        arena->size, arena->pageSize};
+  }
 
   auto [result, descriptors] = usm::pool_descriptor::create(this, hContext);
   if (result != UR_RESULT_SUCCESS) {
@@ -142,9 +281,7 @@ ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t hContext,
 
   for (auto &desc : descriptors) {
     if (disjointPoolConfigs.EnableBuffers) {
-      auto &poolConfig =
-          disjointPoolConfigs.Configs[descToDisjoinPoolMemType(desc)];
-      poolManager.addPool(desc, makePool(&poolConfig, desc));
+      poolManager.addPool(desc, makePool(&disjointPoolConfigs, desc, &stats));
     } else {
       poolManager.addPool(desc, makePool(nullptr, desc));
     }
@@ -155,6 +292,10 @@ ur_context_handle_t ur_usm_pool_handle_t_::getContextHandle() const {
   return hContext;
 }
 
+const umf::pool_stats_t &ur_usm_pool_handle_t_::getStats() const {
+  return stats;
+}
+
 umf_memory_pool_handle_t
 ur_usm_pool_handle_t_::getPool(const usm::pool_descriptor &desc) {
   auto pool = poolManager.getPool(desc).value();
@@ -162,6 +303,37 @@ ur_usm_pool_handle_t_::getPool(const usm::pool_descriptor &desc) {
   return pool;
 }
 
+umf_memory_pool_handle_t
+ur_usm_pool_handle_t_::getZeroedPool(const usm::pool_descriptor &desc) {
+  std::scoped_lock<ur_mutex> lock(zeroedPoolsMutex);
+  if (!hasZeroedPools) {
+    auto [result, descriptors] = usm::pool_descriptor::create(this, hContext);
+    if (result != UR_RESULT_SUCCESS) {
+      throw result;
+    }
+
+    // Device and shared memory only, allocate() doesn't tell read-only
+    // shared memory apart
+    for (auto &poolDesc : descriptors) {
+      if (!poolDesc.hDevice || poolDesc.deviceReadOnly) {
+        continue;
+      }
+      auto &filler = zeroFillers[poolDesc.hDevice];
+      if (!filler) {
+        filler =
+            std::make_shared<usm_zero_filler_t>(hContext, poolDesc.hDevice);
+      }
+      zeroedPoolManager.addPool(
+          poolDesc, makeZeroedPool(disjointPoolConfigs, poolDesc, filler));
+    }
+    hasZeroedPools = true;
+  }
+
+  auto pool = zeroedPoolManager.getPool(desc).value();
+  assert(pool);
+  return pool;
+}
+
 ur_result_t ur_usm_pool_handle_t_::allocate(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
@@ -169,8 +341,19 @@ ur_result_t ur_usm_pool_handle_t_::allocate(
     void **ppRetMem) {
   uint32_t alignment = pUSMDesc ? pUSMDesc->align : 0;
 
-  auto umfPool =
-      getPool(usm::pool_descriptor{this, hContext, hDevice, type, false});
+  auto deviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  bool zeroInit = type != UR_USM_TYPE_HOST && deviceDesc &&
+                  (deviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP);
+
+  umf_memory_pool_handle_t umfPool = nullptr;
+  try {
+    usm::pool_descriptor desc{this, hContext, hDevice, type, false};
+    umfPool = zeroInit ? getZeroedPool(desc) : getPool(desc);
+  } catch (...) {
+    return exceptionToResult(std::current_exception());
+  }
   if (!umfPool) {
     return UR_RESULT_ERROR_INVALID_ARGUMENT;
   }
@@ -188,6 +371,78 @@ ur_result_t ur_usm_pool_handle_t_::free(void *ptr) {
   return umf::umf2urResult(umfFree(ptr));
 }
 
+umf_memory_pool_handle_t
+ur_usm_pool_handle_t_::getUmfPool(ur_device_handle_t hDevice,
+                                  ur_usm_type_t type) {
+  return getPool(usm::pool_descriptor{this, hContext, hDevice, type, false});
+}
+
+size_t ur_usm_pool_handle_t_::trim(size_t minBytesToKeep) {
+  size_t keptSize = 0;
+  poolManager.forEachPool([&](umf_memory_pool_handle_t umfPool) {
+    auto budget = minBytesToKeep - keptSize;
+    keptSize += std::min(umf::poolTrim(umfPool, budget), budget);
+  });
+  return keptSize;
+}
+
+// Bytes of device memory a queue keeps for its later allocations, set in
+// megabytes by UR_L0_V2_USM_QUEUE_CACHE_MB.
+static size_t getMaxQueueCachedBytes() {
+  static const size_t maxBytes = [] {
+    const char *maxMBStr = std::getenv("UR_L0_V2_USM_QUEUE_CACHE_MB");
+    long long value = maxMBStr ? std::atoll(maxMBStr) : -1;
+    return static_cast<size_t>(value >= 0 ? value : 256) * 1024 * 1024;
+  }();
+  return maxBytes;
+}
+
+usm_queue_cache_t::usm_queue_cache_t(ur_context_handle_t hContext,
+                                     ur_device_handle_t hDevice)
+    : hContext(hContext), hDevice(hDevice),
+      devicePool(hContext->getDefaultUSMPool()->getUmfPool(
+          hDevice, UR_USM_TYPE_DEVICE)),
+      maxCachedBytes(getMaxQueueCachedBytes()) {}
+
+usm_queue_cache_t::~usm_queue_cache_t() { free(blocks); }
+
+ur_result_t usm_queue_cache_t::allocate(size_t size, void **ppMem) {
+  auto it = blocks.lower_bound(size);
+  if (it != blocks.end() && it->first <= 2 * size) {
+    *ppMem = it->second;
+    cachedBytes -= it->first;
+    blocks.erase(it);
+    return UR_RESULT_SUCCESS;
+  }
+
+  return hContext->getDefaultUSMPool()->allocate(
+      hContext, hDevice, nullptr, UR_USM_TYPE_DEVICE, size, ppMem);
+}
+
+void usm_queue_cache_t::free(void *ptr) {
+  // Only the device memory of the default pool can be handed out again by
+  // allocate, anything else is just freed later
+  size_t usableSize = 0;
+  if (umfPoolByPtr(ptr) == devicePool) {
+    usableSize = umfPoolMallocUsableSize(devicePool, ptr);
+  }
+  cachedBytes += usableSize;
+  blocks.emplace(usableSize, ptr);
+}
+
+ur_result_t usm_queue_cache_t::free(blocks_t &blocks) {
+  ur_result_t result = UR_RESULT_SUCCESS;
+  for (auto &[size, ptr] : blocks) {
+    std::ignore = size;
+    auto umfRet = umfFree(ptr);
+    if (umfRet != UMF_RESULT_SUCCESS) {
+      result = umf::umf2urResult(umfRet);
+    }
+  }
+  blocks.clear();
+  return result;
+}
+
 namespace ur::level_zero {
 ur_result_t urUSMPoolCreate(
     ur_context_handle_t hContext, ///< [in] handle of the context object
@@ -236,11 +491,25 @@ ur_result_t urUSMPoolGetInfo(
     return ReturnValue(hPool->getContextHandle());
   }
   default: {
-    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    return umf::getPoolStatsInfo(hPool->getStats(), propName, ReturnValue);
   }
   }
 }
 
+ur_result_t urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t minBytesToKeep ///< [in] number of bytes of free memory which may be
+                          ///< left cached
+) {
+  if (!hPool) {
+    hPool = hContext->getDefaultUSMPool();
+  }
+  hPool->trim(minBytesToKeep);
+  return UR_RESULT_SUCCESS;
+}
+
 ur_result_t urUSMDeviceAlloc(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     ur_device_handle_t hDevice,   ///< [in] handle of the device object
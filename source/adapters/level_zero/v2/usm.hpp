@@ -10,25 +10,115 @@
 
 #pragma once
 
+#include <map>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "umf_pools/disjoint_pool_config_parser.hpp"
 #include "ur_pool_manager.hpp"
 
+// Zeroes the blocks of the zero-initialized pools of a device, on an in-order
+// immediate command list of its main copy engine, or of its compute engine if
+// it has none. Each fill signals an event of a ring, the fill taking the slot
+// again waits for it first. Fills and waits are serialized.
+struct usm_zero_filler_t : umf::zero_filler_t {
+  usm_zero_filler_t(ur_context_handle_t hContext, ur_device_handle_t hDevice);
+
+  umf_result_t fill(void *ptr, size_t size, uint64_t *seq) override;
+  umf_result_t wait(uint64_t seq) override;
+
+private:
+  umf_result_t waitLocked(uint64_t seq);
+
+  ur_mutex mutex;
+  v2::raii::ze_command_list_handle_t commandList;
+  v2::raii::ze_event_pool_handle_t eventPool;
+  // Fill seq signals events[seq % events.size()]
+  std::vector<v2::raii::ze_event_handle_t> events;
+  uint64_t submitted = 0;
+  uint64_t completed = 0;
+};
+
 struct ur_usm_pool_handle_t_ : _ur_object {
   ur_usm_pool_handle_t_(ur_context_handle_t hContext,
                         ur_usm_pool_desc_t *pPoolDes);
 
   ur_context_handle_t getContextHandle() const;
+  const umf::pool_stats_t &getStats() const;
 
   ur_result_t allocate(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                        const ur_usm_desc_t *pUSMDesc, ur_usm_type_t type,
                        size_t size, void **ppRetMem);
   ur_result_t free(void *ptr);
 
+  // Returns the bytes of free memory left cached, at most minBytesToKeep
+  size_t trim(size_t minBytesToKeep);
+
+  // Returns the UMF pool serving the allocations of type on hDevice
+  umf_memory_pool_handle_t getUmfPool(ur_device_handle_t hDevice,
+                                      ur_usm_type_t type);
+
 private:
   ur_context_handle_t hContext;
+  // Aggregated over the pools of poolManager, which must be destroyed first
+  umf::pool_stats_t stats;
   usm::pool_manager<usm::pool_descriptor> poolManager;
 
+  // Pools of the allocations zeroed with UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP,
+  // for the device and shared memory of each device, created on first use
+  usm::DisjointPoolAllConfigs disjointPoolConfigs;
+  ur_mutex zeroedPoolsMutex;
+  bool hasZeroedPools = false;
+  std::unordered_map<ur_device_handle_t, std::shared_ptr<usm_zero_filler_t>>
+      zeroFillers;
+  usm::pool_manager<usm::pool_descriptor> zeroedPoolManager;
+
   umf_memory_pool_handle_t getPool(const usm::pool_descriptor &desc);
+  umf_memory_pool_handle_t getZeroedPool(const usm::pool_descriptor &desc);
+};
+
+// Device memory freed by urEnqueueUSMFreeExp on a queue, which is handed back
+// to the later urEnqueueUSMDeviceAllocExp of the same queue without waiting,
+// as the commands of an in-order queue are executed after the ones using it.
+// It isn't synchronized, the queue using it must serialize the calls. At most
+// UR_L0_V2_USM_QUEUE_CACHE_MB megabytes, 256 by default, are kept reusable.
+struct usm_queue_cache_t {
+  using blocks_t = std::multimap<size_t, void *>;
+
+  usm_queue_cache_t(ur_context_handle_t hContext, ur_device_handle_t hDevice);
+  // The queue must be synchronized, as the cached blocks are freed
+  ~usm_queue_cache_t();
+
+  // Reuses a cached block of at least size bytes, without wasting more than
+  // half of it, or allocates a new one from the default pool of the context.
+  ur_result_t allocate(size_t size, void **ppMem);
+  void free(void *ptr);
+
+  // Takes the cached blocks, which may be freed once the commands enqueued so
+  // far are complete.
+  blocks_t release() {
+    cachedBytes = 0;
+    return std::exchange(blocks, {});
+  }
+  static ur_result_t free(blocks_t &blocks);
+
+  bool empty() const { return blocks.empty(); }
+
+  // Whether the queue should be synchronized to free the cached blocks
+  bool full() const { return cachedBytes > maxCachedBytes; }
+
+private:
+  ur_context_handle_t hContext;
+  ur_device_handle_t hDevice;
+  umf_memory_pool_handle_t devicePool;
+
+  // Keyed by their usable size, which is 0 for the blocks that can't be
+  // reused and only wait to be freed.
+  blocks_t blocks;
+  size_t cachedBytes = 0;
+  const size_t maxCachedBytes;
 };
@@ -84,6 +84,7 @@ ur_result_t urVirtualMemMap(ur_context_handle_t hContext, const void *pStart,
   ZE2UR_CALL(zeVirtualMemMap,
              (hContext->ZeContext, pStart, size, hPhysicalMem->ZePhysicalMem,
               offset, AccessAttr));
+  hContext->PhysicalMemPool.map(pStart, hPhysicalMem->ZePhysicalMem);
 
   return UR_RESULT_SUCCESS;
 }
@@ -91,6 +92,7 @@ ur_result_t urVirtualMemMap(ur_context_handle_t hContext, const void *pStart,
 ur_result_t urVirtualMemUnmap(ur_context_handle_t hContext, const void *pStart,
                               size_t size) {
   ZE2UR_CALL(zeVirtualMemUnmap, (hContext->ZeContext, pStart, size));
+  hContext->PhysicalMemPool.unmap(pStart, size);
 
   return UR_RESULT_SUCCESS;
 }
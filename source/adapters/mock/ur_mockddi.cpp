@@ -32,8 +32,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
 
     ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urAdapterGet"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -41,8 +42,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urAdapterGet"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -60,8 +61,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urAdapterGet"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -80,8 +80,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
 
     ur_adapter_release_params_t params = {&hAdapter};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urAdapterRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ADAPTER_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -89,8 +90,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urAdapterRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -102,8 +103,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urAdapterRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ADAPTER_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -122,8 +123,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
 
     ur_adapter_retain_params_t params = {&hAdapter};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urAdapterRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ADAPTER_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -131,8 +133,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urAdapterRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -144,8 +146,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urAdapterRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ADAPTER_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -171,8 +173,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
     ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
                                                  &pError};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urAdapterGetLastError"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -180,8 +183,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urAdapterGetLastError"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -193,8 +196,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urAdapterGetLastError"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET_LAST_ERROR);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -224,8 +227,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
     ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urAdapterGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ADAPTER_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -233,8 +237,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urAdapterGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ADAPTER_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -246,8 +250,8 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urAdapterGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ADAPTER_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -280,8 +284,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
     ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                        &phPlatforms, &pNumPlatforms};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPlatformGet"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -289,8 +294,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPlatformGet"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -308,8 +313,7 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPlatformGet"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -339,8 +343,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPlatformGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -348,8 +353,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPlatformGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -361,8 +366,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPlatformGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -382,8 +387,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
 
     ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPlatformGetApiVersion"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -391,8 +397,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPlatformGetApiVersion"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -404,8 +410,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPlatformGetApiVersion"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_API_VERSION);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -427,8 +433,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPlatformGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -436,8 +443,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPlatformGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -450,8 +457,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPlatformGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -478,9 +485,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     ur_platform_create_with_native_handle_params_t params = {
         &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urPlatformCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -488,9 +495,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urPlatformCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -504,9 +510,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urPlatformCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -531,8 +536,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPlatformGetBackendOption"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -540,9 +546,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urPlatformGetBackendOption"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -554,8 +559,8 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPlatformGetBackendOption"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -587,8 +592,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceGet"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -596,8 +601,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceGet"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -615,8 +620,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceGet"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -647,8 +651,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -656,8 +661,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -669,8 +674,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -690,8 +695,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
 
     ur_device_retain_params_t params = {&hDevice};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -699,8 +705,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -712,8 +718,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -733,8 +739,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
 
     ur_device_release_params_t params = {&hDevice};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -742,8 +749,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -755,8 +762,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -786,8 +793,9 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDevicePartition"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_PARTITION);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -795,8 +803,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDevicePartition"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_PARTITION);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -808,8 +816,8 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDevicePartition"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_PARTITION);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -838,8 +846,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceSelectBinary"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -847,8 +856,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceSelectBinary"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -860,8 +869,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceSelectBinary"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_SELECT_BINARY);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -882,8 +891,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
 
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urDeviceGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -891,8 +901,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urDeviceGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -905,8 +915,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -933,9 +943,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hAdapter, &pProperties, &phDevice};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urDeviceCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -943,9 +953,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urDeviceCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -959,9 +968,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urDeviceCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -987,9 +995,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urDeviceGetGlobalTimestamps"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -997,9 +1005,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urDeviceGetGlobalTimestamps"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1011,8 +1018,8 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urDeviceGetGlobalTimestamps"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1038,8 +1045,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urContextCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1047,8 +1055,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urContextCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1061,8 +1069,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1082,8 +1090,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
 
     ur_context_retain_params_t params = {&hContext};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urContextRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1091,8 +1100,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urContextRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1105,8 +1114,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1126,8 +1135,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
 
     ur_context_release_params_t params = {&hContext};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urContextRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1135,8 +1145,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urContextRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1149,8 +1159,8 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1182,8 +1192,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urContextGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1191,8 +1202,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urContextGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1204,8 +1215,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1227,8 +1238,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urContextGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1236,8 +1248,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urContextGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1250,8 +1262,8 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1283,9 +1295,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         &hNativeContext, &hAdapter,    &numDevices,
         &phDevices,      &pProperties, &phContext};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urContextCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1293,9 +1305,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urContextCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1309,9 +1320,8 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urContextCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1335,9 +1345,9 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urContextSetExtendedDeleter"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1345,9 +1355,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urContextSetExtendedDeleter"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1359,8 +1368,8 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urContextSetExtendedDeleter"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1386,8 +1395,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemImageCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1395,8 +1405,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemImageCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1409,8 +1419,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemImageCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_MEM_IMAGE_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1436,8 +1446,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemBufferCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1445,8 +1456,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemBufferCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1465,8 +1476,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemBufferCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_MEM_BUFFER_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1486,8 +1497,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
 
     ur_mem_retain_params_t params = {&hMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_MEM_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1495,8 +1506,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1509,8 +1520,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemRetain"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1530,8 +1540,9 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
 
     ur_mem_release_params_t params = {&hMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1539,8 +1550,8 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1553,8 +1564,7 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemRelease"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1581,8 +1591,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemBufferPartition"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1590,8 +1601,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemBufferPartition"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1604,8 +1615,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemBufferPartition"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_MEM_BUFFER_PARTITION);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1629,8 +1640,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
 
     ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1638,8 +1650,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1652,8 +1664,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_MEM_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1679,9 +1691,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     ur_mem_buffer_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext, &pProperties, &phMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urMemBufferCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1689,9 +1701,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urMemBufferCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1705,9 +1716,8 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urMemBufferCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1737,9 +1747,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         &hNativeMem, &hContext,    &pImageFormat,
         &pImageDesc, &pProperties, &phMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urMemImageCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1747,9 +1757,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urMemImageCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1763,9 +1772,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urMemImageCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1797,8 +1805,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1806,8 +1815,8 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1819,8 +1828,7 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemGetInfo"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_MEM_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1851,8 +1859,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urMemImageGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1860,8 +1869,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urMemImageGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1873,8 +1882,8 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urMemImageGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_MEM_IMAGE_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1896,8 +1905,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
 
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urSamplerCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_SAMPLER_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1905,8 +1915,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urSamplerCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1919,8 +1929,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urSamplerCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_SAMPLER_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1940,8 +1950,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
 
     ur_sampler_retain_params_t params = {&hSampler};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urSamplerRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_SAMPLER_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1949,8 +1960,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urSamplerRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -1963,8 +1974,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urSamplerRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_SAMPLER_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -1984,8 +1995,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
 
     ur_sampler_release_params_t params = {&hSampler};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urSamplerRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_SAMPLER_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -1993,8 +2005,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urSamplerRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2007,8 +2019,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urSamplerRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_SAMPLER_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2036,8 +2048,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urSamplerGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_SAMPLER_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2045,8 +2058,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urSamplerGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2058,8 +2071,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urSamplerGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_SAMPLER_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2081,8 +2094,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urSamplerGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2090,8 +2104,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urSamplerGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2104,8 +2118,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urSamplerGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2131,9 +2145,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &pProperties, &phSampler};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urSamplerCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2141,9 +2155,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urSamplerCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2157,9 +2170,8 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urSamplerCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2186,8 +2198,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMHostAlloc"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_HOST_ALLOC);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2195,8 +2208,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMHostAlloc"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_HOST_ALLOC);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2209,8 +2222,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMHostAlloc"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_HOST_ALLOC);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2238,8 +2251,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMDeviceAlloc"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2247,8 +2261,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMDeviceAlloc"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2261,8 +2275,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMDeviceAlloc"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_DEVICE_ALLOC);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2290,8 +2304,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMSharedAlloc"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_SHARED_ALLOC);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2299,8 +2314,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMSharedAlloc"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_SHARED_ALLOC);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2313,8 +2328,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMSharedAlloc"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_SHARED_ALLOC);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2334,8 +2349,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
 
     ur_usm_free_params_t params = {&hContext, &pMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMFree"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_USM_FREE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2343,8 +2358,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMFree"));
+    auto replaceCallback = callbacks.get_replace_callback(UR_FUNCTION_USM_FREE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2357,8 +2371,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMFree"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_USM_FREE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2388,8 +2401,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMGetMemAllocInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2397,8 +2411,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMGetMemAllocInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2410,8 +2424,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMGetMemAllocInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2434,8 +2448,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
 
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMPoolCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_POOL_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2443,8 +2458,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMPoolCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2457,8 +2472,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMPoolCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_POOL_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2477,8 +2492,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
 
     ur_usm_pool_retain_params_t params = {&pPool};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMPoolRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_POOL_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2486,8 +2502,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMPoolRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2500,8 +2516,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMPoolRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_POOL_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2520,8 +2536,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
 
     ur_usm_pool_release_params_t params = {&pPool};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMPoolRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_POOL_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2529,8 +2546,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMPoolRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2543,8 +2560,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMPoolRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_POOL_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2571,8 +2588,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
     ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMPoolGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_POOL_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2580,8 +2598,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMPoolGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2593,8 +2611,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMPoolGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_POOL_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2628,9 +2646,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     ur_virtual_mem_granularity_get_info_params_t params = {
         &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urVirtualMemGranularityGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2638,9 +2656,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urVirtualMemGranularityGetInfo"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2652,9 +2669,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urVirtualMemGranularityGetInfo"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2683,8 +2699,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
     ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                               &ppStart};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemReserve"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2692,8 +2709,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemReserve"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2705,8 +2722,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemReserve"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_RESERVE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2728,8 +2745,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
 
     ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemFree"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2737,8 +2755,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemFree"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2750,8 +2768,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemFree"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_FREE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2780,8 +2798,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
     ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                           &hPhysicalMem, &offset, &flags};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemMap"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2789,8 +2808,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemMap"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2802,8 +2821,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemMap"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_MAP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2825,8 +2844,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
 
     ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemUnmap"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2834,8 +2854,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemUnmap"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2847,8 +2867,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemUnmap"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_UNMAP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2873,8 +2893,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
     ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                  &flags};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemSetAccess"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2882,8 +2903,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemSetAccess"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2895,8 +2916,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemSetAccess"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2930,8 +2951,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         &hContext, &pStart,     &size,        &propName,
         &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urVirtualMemGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2939,8 +2961,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urVirtualMemGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -2952,8 +2974,8 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urVirtualMemGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_VIRTUAL_MEM_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -2981,8 +3003,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                               &pProperties, &phPhysicalMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPhysicalMemCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -2990,8 +3013,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPhysicalMemCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3004,8 +3027,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPhysicalMemCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3025,8 +3048,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
 
     ur_physical_mem_retain_params_t params = {&hPhysicalMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPhysicalMemRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3034,8 +3058,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPhysicalMemRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3048,8 +3072,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPhysicalMemRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3069,8 +3093,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
 
     ur_physical_mem_release_params_t params = {&hPhysicalMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urPhysicalMemRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3078,8 +3103,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urPhysicalMemRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3092,8 +3117,8 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urPhysicalMemRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PHYSICAL_MEM_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3119,8 +3144,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramCreateWithIL"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3128,8 +3154,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramCreateWithIL"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3142,8 +3168,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramCreateWithIL"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_IL);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3171,8 +3197,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramCreateWithBinary"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3180,8 +3207,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramCreateWithBinary"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3194,8 +3221,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramCreateWithBinary"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3217,8 +3244,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
 
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramBuild"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_BUILD);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3226,8 +3254,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramBuild"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_BUILD);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3239,8 +3267,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramBuild"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_BUILD);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3263,8 +3291,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
 
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramCompile"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_COMPILE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3272,8 +3301,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramCompile"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_COMPILE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3285,8 +3314,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramCompile"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_COMPILE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3316,8 +3345,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramLink"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_LINK);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3325,8 +3355,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramLink"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_LINK);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3339,8 +3369,7 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramLink"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_PROGRAM_LINK);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3360,8 +3389,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
 
     ur_program_retain_params_t params = {&hProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3369,8 +3399,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3383,8 +3413,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3404,8 +3434,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
 
     ur_program_release_params_t params = {&hProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3413,8 +3444,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3427,8 +3458,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3457,9 +3488,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urProgramGetFunctionPointer"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3467,9 +3498,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urProgramGetFunctionPointer"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3481,8 +3511,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramGetFunctionPointer"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3513,9 +3543,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
         &ppGlobalVariablePointerRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urProgramGetGlobalVariablePointer"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3523,9 +3553,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urProgramGetGlobalVariablePointer"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3537,9 +3566,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urProgramGetGlobalVariablePointer"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3570,8 +3598,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3579,8 +3608,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3592,8 +3621,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3626,8 +3655,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramGetBuildInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3635,8 +3665,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramGetBuildInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3648,8 +3678,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramGetBuildInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_BUILD_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3673,9 +3703,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urProgramSetSpecializationConstants"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3683,9 +3713,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urProgramSetSpecializationConstants"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3697,9 +3726,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urProgramSetSpecializationConstants"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3721,8 +3749,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3730,8 +3759,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3744,8 +3773,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3771,9 +3800,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &pProperties, &phProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urProgramCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3781,9 +3810,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urProgramCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3797,9 +3825,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urProgramCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3821,8 +3848,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
 
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3830,8 +3858,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3844,8 +3872,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelCreate"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3872,8 +3900,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties, &pArgValue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetArgValue"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3881,8 +3910,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetArgValue"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3894,8 +3923,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetArgValue"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_VALUE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3920,8 +3949,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetArgLocal"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3929,8 +3959,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetArgLocal"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3942,8 +3972,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetArgLocal"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_LOCAL);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -3975,8 +4005,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -3984,8 +4015,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -3997,8 +4028,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4028,8 +4059,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelGetGroupInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4037,8 +4069,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelGetGroupInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4050,8 +4082,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelGetGroupInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_GROUP_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4081,8 +4113,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelGetSubGroupInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4090,8 +4123,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelGetSubGroupInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4103,8 +4136,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelGetSubGroupInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4123,8 +4156,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
 
     ur_kernel_retain_params_t params = {&hKernel};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4132,8 +4166,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4146,8 +4180,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelRetain"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4167,8 +4201,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
 
     ur_kernel_release_params_t params = {&hKernel};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4176,8 +4211,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4190,8 +4225,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4217,8 +4252,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &pArgValue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetArgPointer"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4226,8 +4262,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetArgPointer"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4239,8 +4275,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetArgPointer"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_POINTER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4267,8 +4303,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pProperties, &pPropValue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetExecInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4276,8 +4313,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetExecInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4289,8 +4326,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetExecInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_EXEC_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4314,8 +4351,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetArgSampler"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4323,8 +4361,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetArgSampler"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4336,8 +4374,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetArgSampler"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4361,8 +4399,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelSetArgMemObj"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4370,8 +4409,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelSetArgMemObj"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4383,8 +4422,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelSetArgMemObj"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4407,9 +4446,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urKernelSetSpecializationConstants"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4417,9 +4456,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urKernelSetSpecializationConstants"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4431,9 +4469,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urKernelSetSpecializationConstants"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4454,8 +4491,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
 
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urKernelGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4463,8 +4501,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urKernelGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4477,8 +4515,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urKernelGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4506,9 +4544,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urKernelCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4516,9 +4554,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urKernelCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4532,9 +4569,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urKernelCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4569,9 +4605,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         &hKernel,           &hQueue,          &numWorkDim,
         &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urKernelGetSuggestedLocalWorkSize"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4579,9 +4615,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urKernelGetSuggestedLocalWorkSize"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4593,9 +4628,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urKernelGetSuggestedLocalWorkSize"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4623,8 +4657,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4632,8 +4667,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4645,8 +4680,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_QUEUE_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4671,8 +4706,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueCreate"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_CREATE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4680,8 +4716,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueCreate"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_CREATE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4694,8 +4730,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueCreate"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_CREATE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4715,8 +4750,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
 
     ur_queue_retain_params_t params = {&hQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4724,8 +4760,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4738,8 +4774,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueRetain"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4759,8 +4794,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
 
     ur_queue_release_params_t params = {&hQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4768,8 +4804,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4782,8 +4818,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_QUEUE_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4807,8 +4843,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
     ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                   &phNativeQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4816,8 +4853,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4830,8 +4867,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4858,9 +4895,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     ur_queue_create_with_native_handle_params_t params = {
         &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urQueueCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4868,9 +4905,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urQueueCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4884,9 +4920,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urQueueCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4905,8 +4940,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
 
     ur_queue_finish_params_t params = {&hQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueFinish"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_FINISH);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4914,8 +4950,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueFinish"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FINISH);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4927,8 +4963,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueFinish"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_FINISH);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4947,8 +4982,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
 
     ur_queue_flush_params_t params = {&hQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urQueueFlush"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_FLUSH);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -4956,8 +4992,8 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urQueueFlush"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_FLUSH);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -4969,8 +5005,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urQueueFlush"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_QUEUE_FLUSH);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -4996,8 +5031,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventGetInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5005,8 +5041,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventGetInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5018,8 +5054,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventGetInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5048,8 +5084,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventGetProfilingInfo"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5057,8 +5094,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventGetProfilingInfo"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5070,8 +5107,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventGetProfilingInfo"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_PROFILING_INFO);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5093,8 +5130,8 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
 
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventWait"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(UR_FUNCTION_EVENT_WAIT);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5102,8 +5139,8 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventWait"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_WAIT);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5115,8 +5152,7 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventWait"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_WAIT);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5135,8 +5171,9 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
 
     ur_event_retain_params_t params = {&hEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventRetain"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_RETAIN);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5144,8 +5181,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventRetain"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_RETAIN);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5158,8 +5195,7 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventRetain"));
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_EVENT_RETAIN);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5178,8 +5214,9 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
 
     ur_event_release_params_t params = {&hEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventRelease"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_RELEASE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5187,8 +5224,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventRelease"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_RELEASE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5201,8 +5238,8 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventRelease"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_RELEASE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5223,8 +5260,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
 
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventGetNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5232,8 +5270,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventGetNativeHandle"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5246,8 +5284,8 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventGetNativeHandle"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5273,9 +5311,9 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     ur_event_create_with_native_handle_params_t params = {
         &hNativeEvent, &hContext, &pProperties, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEventCreateWithNativeHandle"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5283,9 +5321,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEventCreateWithNativeHandle"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5299,9 +5336,8 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEventCreateWithNativeHandle"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5325,8 +5361,9 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEventSetCallback"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5334,8 +5371,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEventSetCallback"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5347,8 +5384,8 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEventSetCallback"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_SET_CALLBACK);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5400,8 +5437,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                                                 &phEventWaitList,
                                                 &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueKernelLaunch"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5409,8 +5447,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueKernelLaunch"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5426,8 +5464,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueKernelLaunch"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5458,8 +5496,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueEventsWait"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5467,8 +5506,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueEventsWait"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5484,8 +5523,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueEventsWait"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_EVENTS_WAIT);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5516,9 +5555,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueEventsWaitWithBarrier"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5526,9 +5565,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueEventsWaitWithBarrier"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5544,9 +5582,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueEventsWaitWithBarrier"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5584,8 +5621,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferRead"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5593,8 +5631,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemBufferRead"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5610,8 +5648,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferRead"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5651,8 +5689,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferWrite"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5660,8 +5699,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemBufferWrite"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5677,8 +5716,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferWrite"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5738,8 +5777,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                                                        &phEventWaitList,
                                                        &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferReadRect"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5747,9 +5787,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueMemBufferReadRect"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5765,8 +5804,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferReadRect"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5829,9 +5868,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                                                         &phEventWaitList,
                                                         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueMemBufferWriteRect"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5839,9 +5878,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueMemBufferWriteRect"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5857,8 +5895,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferWriteRect"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5896,8 +5934,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopy"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5905,8 +5944,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemBufferCopy"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5922,8 +5961,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopy"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -5972,8 +6011,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         &dstRowPitch, &dstSlicePitch, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferCopyRect"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -5981,9 +6021,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueMemBufferCopyRect"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -5999,8 +6038,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferCopyRect"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6043,8 +6082,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                                                   &phEventWaitList,
                                                   &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferFill"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6052,8 +6092,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemBufferFill"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6069,8 +6109,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferFill"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6114,8 +6154,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         &slicePitch,      &pDst,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemImageRead"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6123,8 +6164,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemImageRead"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6140,8 +6181,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemImageRead"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6186,8 +6227,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         &slicePitch,      &pSrc,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemImageWrite"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6195,8 +6237,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemImageWrite"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6212,8 +6254,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemImageWrite"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6257,8 +6299,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemImageCopy"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6266,8 +6309,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemImageCopy"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6283,8 +6326,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemImageCopy"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6324,8 +6367,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
         &phEvent, &ppRetMap};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemBufferMap"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6333,8 +6377,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemBufferMap"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6353,8 +6397,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemBufferMap"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6388,8 +6432,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueMemUnmap"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6397,8 +6442,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueMemUnmap"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6414,8 +6459,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueMemUnmap"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_MEM_UNMAP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6455,8 +6500,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         &pPattern,        &size,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMFill"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6464,8 +6510,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMFill"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6481,8 +6527,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMFill"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_FILL);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6519,8 +6565,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6528,8 +6575,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMMemcpy"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6545,8 +6592,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6581,8 +6628,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMPrefetch"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6590,8 +6638,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMPrefetch"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6607,8 +6655,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMPrefetch"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_PREFETCH);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6635,8 +6683,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMAdvise"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6644,8 +6693,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMAdvise"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6661,8 +6710,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMAdvise"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_ADVISE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6706,8 +6755,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         &pPattern,        &width,  &height, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMFill2D"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6715,8 +6765,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMFill2D"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6732,8 +6782,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMFill2D"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_FILL_2D);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6777,8 +6827,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         &width,           &height,   &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueUSMMemcpy2D"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6786,8 +6837,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueUSMMemcpy2D"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6803,8 +6854,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueUSMMemcpy2D"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6844,9 +6895,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         &count,           &offset,   &pSrc, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueDeviceGlobalVariableWrite"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6854,9 +6905,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueDeviceGlobalVariableWrite"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6872,9 +6922,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueDeviceGlobalVariableWrite"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6914,9 +6963,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         &count,           &offset,   &pDst, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueDeviceGlobalVariableRead"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6924,9 +6973,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueDeviceGlobalVariableRead"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -6942,9 +6990,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueDeviceGlobalVariableRead"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -6989,8 +7036,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueReadHostPipe"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -6998,8 +7046,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueReadHostPipe"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7015,8 +7063,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueReadHostPipe"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7062,8 +7110,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueWriteHostPipe"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7071,8 +7120,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueWriteHostPipe"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7088,8 +7137,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueWriteHostPipe"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7122,8 +7171,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
         &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMPitchedAllocExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7131,8 +7181,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMPitchedAllocExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7145,8 +7195,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMPitchedAllocExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_PITCHED_ALLOC_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7170,9 +7220,9 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesUnsampledImageHandleDestroyExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7180,9 +7230,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesUnsampledImageHandleDestroyExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7195,9 +7244,8 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesUnsampledImageHandleDestroyExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7221,9 +7269,9 @@ urBindlessImagesSampledImageHandleDestroyExp(
     ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesSampledImageHandleDestroyExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7231,9 +7279,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesSampledImageHandleDestroyExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7246,9 +7293,8 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesSampledImageHandleDestroyExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7274,9 +7320,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     ur_bindless_images_image_allocate_exp_params_t params = {
         &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImageAllocateExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7284,9 +7330,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImageAllocateExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7300,9 +7345,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImageAllocateExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7325,9 +7369,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                          &hImageMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImageFreeExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7335,9 +7379,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImageFreeExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7350,9 +7393,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImageFreeExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7380,9 +7422,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     ur_bindless_images_unsampled_image_create_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesUnsampledImageCreateExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7390,9 +7432,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesUnsampledImageCreateExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7405,9 +7446,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesUnsampledImageCreateExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7437,9 +7477,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         &hContext,   &hDevice,  &hImageMem, &pImageFormat,
         &pImageDesc, &hSampler, &phImage};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesSampledImageCreateExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7447,9 +7487,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesSampledImageCreateExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7462,9 +7501,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesSampledImageCreateExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7518,9 +7556,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                                                          &phEventWaitList,
                                                          &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImageCopyExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7528,9 +7566,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImageCopyExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7546,9 +7583,83 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImageCopyExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesImageCopyBatchExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    uint32_t numCopyRegions, ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *
+        pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+    ///< must not refer to an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_bindless_images_image_copy_batch_exp_params_t params = {
+        &hQueue, &pSrc, &pDst, &pSrcImageDesc, &pDstImageDesc,
+        &pSrcImageFormat, &pDstImageFormat, &numCopyRegions, &pCopyRegions,
+        &imageCopyFlags, &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7573,9 +7684,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     ur_bindless_images_image_get_info_exp_params_t params = {
         &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImageGetInfoExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7583,9 +7694,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImageGetInfoExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7597,9 +7707,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImageGetInfoExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7625,9 +7734,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     ur_bindless_images_mipmap_get_level_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesMipmapGetLevelExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7635,9 +7744,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesMipmapGetLevelExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7651,9 +7759,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesMipmapGetLevelExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7676,9 +7783,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                           &hMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesMipmapFreeExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7686,9 +7793,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesMipmapFreeExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7701,9 +7807,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesMipmapFreeExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7732,9 +7837,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         &hContext,      &hDevice,          &size,
         &memHandleType, &pExternalMemDesc, &phExternalMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImportExternalMemoryExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7742,9 +7847,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImportExternalMemoryExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7758,9 +7862,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImportExternalMemoryExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7789,9 +7892,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         &hContext,   &hDevice,      &pImageFormat,
         &pImageDesc, &hExternalMem, &phImageMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesMapExternalArrayExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7799,9 +7902,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesMapExternalArrayExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7815,9 +7917,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesMapExternalArrayExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7843,9 +7944,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
     ur_bindless_images_map_external_linear_memory_exp_params_t params = {
         &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesMapExternalLinearMemoryExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7853,9 +7954,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesMapExternalLinearMemoryExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7867,9 +7967,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesMapExternalLinearMemoryExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7892,9 +7991,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     ur_bindless_images_release_external_memory_exp_params_t params = {
         &hContext, &hDevice, &hExternalMem};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesReleaseExternalMemoryExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7902,9 +8001,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesReleaseExternalMemoryExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7917,9 +8015,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesReleaseExternalMemoryExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7947,9 +8044,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
         &phExternalSemaphore};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesImportExternalSemaphoreExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -7957,9 +8054,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesImportExternalSemaphoreExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -7973,9 +8069,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesImportExternalSemaphoreExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -7998,9 +8093,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     ur_bindless_images_release_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &hExternalSemaphore};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesReleaseExternalSemaphoreExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8008,9 +8103,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesReleaseExternalSemaphoreExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8023,9 +8117,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesReleaseExternalSemaphoreExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8066,9 +8159,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         &waitValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesWaitExternalSemaphoreExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8076,9 +8169,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesWaitExternalSemaphoreExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8094,9 +8186,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesWaitExternalSemaphoreExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8137,9 +8228,9 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         &signalValue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urBindlessImagesSignalExternalSemaphoreExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8147,9 +8238,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urBindlessImagesSignalExternalSemaphoreExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8165,9 +8255,8 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urBindlessImagesSignalExternalSemaphoreExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8192,8 +8281,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
     ur_command_buffer_create_exp_params_t params = {
         &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferCreateExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8201,8 +8291,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urCommandBufferCreateExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8216,8 +8306,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferCreateExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8237,8 +8327,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
 
     ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferRetainExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8246,8 +8337,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urCommandBufferRetainExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8260,8 +8351,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferRetainExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8281,8 +8372,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
 
     ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferReleaseExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8290,8 +8382,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urCommandBufferReleaseExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8304,8 +8396,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferReleaseExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8325,8 +8417,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
 
     ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferFinalizeExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8334,9 +8427,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferFinalizeExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8348,8 +8440,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferFinalizeExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8421,9 +8513,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendKernelLaunchExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8431,9 +8523,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendKernelLaunchExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8454,9 +8545,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendKernelLaunchExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8508,9 +8598,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendUSMMemcpyExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8518,9 +8608,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendUSMMemcpyExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8541,9 +8630,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendUSMMemcpyExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8598,9 +8686,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendUSMFillExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8608,9 +8696,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendUSMFillExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8631,9 +8718,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendUSMFillExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8689,9 +8775,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferCopyExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8699,9 +8785,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferCopyExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8722,9 +8807,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferCopyExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8779,9 +8863,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferWriteExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8789,9 +8873,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferWriteExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8812,9 +8895,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferWriteExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8868,9 +8950,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferReadExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8878,9 +8960,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferReadExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -8901,9 +8982,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferReadExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -8970,9 +9050,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferCopyRectExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -8980,9 +9060,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferCopyRectExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9003,9 +9082,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferCopyRectExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9078,9 +9156,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferWriteRectExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9088,9 +9166,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferWriteRectExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9111,9 +9188,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferWriteRectExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9184,9 +9260,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferReadRectExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9194,9 +9270,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferReadRectExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9217,9 +9292,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferReadRectExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9276,9 +9350,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendMemBufferFillExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9286,9 +9360,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendMemBufferFillExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9309,9 +9382,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendMemBufferFillExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9363,9 +9435,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendUSMPrefetchExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9373,9 +9445,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendUSMPrefetchExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9396,9 +9467,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendUSMPrefetchExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9450,9 +9520,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         &phEvent,
         &phCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferAppendUSMAdviseExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9460,9 +9530,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferAppendUSMAdviseExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9483,9 +9552,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferAppendUSMAdviseExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9518,8 +9586,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferEnqueueExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9527,8 +9596,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urCommandBufferEnqueueExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9544,8 +9613,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferEnqueueExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9565,9 +9634,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
 
     ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferRetainCommandExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9575,9 +9644,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferRetainCommandExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9590,9 +9658,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferRetainCommandExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9612,9 +9679,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
 
     ur_command_buffer_release_command_exp_params_t params = {&hCommand};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferReleaseCommandExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9622,9 +9689,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferReleaseCommandExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9637,9 +9703,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferReleaseCommandExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9662,9 +9727,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     ur_command_buffer_update_kernel_launch_exp_params_t params = {
         &hCommand, &pUpdateKernelLaunch};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferUpdateKernelLaunchExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9672,9 +9737,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferUpdateKernelLaunchExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9686,9 +9750,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferUpdateKernelLaunchExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9710,9 +9773,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
     ur_command_buffer_update_signal_event_exp_params_t params = {
         &hCommand, &phSignalEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferUpdateSignalEventExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9720,9 +9783,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferUpdateSignalEventExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9735,9 +9797,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferUpdateSignalEventExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9763,9 +9824,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
     ur_command_buffer_update_wait_events_exp_params_t params = {
         &hCommand, &numEventsInWaitList, &phEventWaitList};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferUpdateWaitEventsExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9773,9 +9834,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferUpdateWaitEventsExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9787,9 +9847,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferUpdateWaitEventsExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9819,8 +9878,9 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     ur_command_buffer_get_info_exp_params_t params = {
         &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urCommandBufferGetInfoExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9828,8 +9888,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urCommandBufferGetInfoExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9841,8 +9901,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urCommandBufferGetInfoExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9872,9 +9932,108 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     ur_command_buffer_command_get_info_exp_params_t params = {
         &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urCommandBufferCommandGetInfoExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUpdateKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t
+        numKernelUpdates, ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *
+        phCommands, ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                    ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                            ///< command is to be updated.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_command_buffer_update_kernel_launch_batch_exp_params_t params = {
+        &hCommandBuffer, &numKernelUpdates, &phCommands, &pUpdateKernelLaunch};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUploadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue ///< [in] The queue to upload the command-buffer on.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_command_buffer_upload_exp_params_t params = {&hCommandBuffer, &hQueue};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9882,9 +10041,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urCommandBufferCommandGetInfoExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9896,9 +10054,8 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urCommandBufferCommandGetInfoExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -9951,9 +10108,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         &phEventWaitList,
         &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueCooperativeKernelLaunchExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -9961,9 +10118,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueCooperativeKernelLaunchExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -9979,9 +10135,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueCooperativeKernelLaunchExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10008,9 +10163,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
         &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urKernelSuggestMaxCooperativeGroupCountExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10018,9 +10173,8 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urKernelSuggestMaxCooperativeGroupCountExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10032,9 +10186,55 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urKernelSuggestMaxCooperativeGroupCountExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_kernel_set_args_exp_params_t params = {&hKernel, &numArgs, &pArgs};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_KERNEL_SET_ARGS_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_KERNEL_SET_ARGS_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_KERNEL_SET_ARGS_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10073,9 +10273,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ur_enqueue_timestamp_recording_exp_params_t params = {
         &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueTimestampRecordingExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10083,9 +10283,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueTimestampRecordingExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10098,9 +10297,56 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueTimestampRecordingExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                         ///< completion of any of
+    uint32_t *pIndex     ///< [out] index in `phEventWaitList` of a completed event
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_wait_any_exp_params_t params = {&numEvents, &phEventWaitList,
+                                             &pIndex};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_WAIT_ANY_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_WAIT_ANY_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_WAIT_ANY_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10151,9 +10397,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         &launchPropList,  &numEventsInWaitList,
         &phEventWaitList, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urEnqueueKernelLaunchCustomExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10161,9 +10407,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urEnqueueKernelLaunchCustomExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10175,9 +10420,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urEnqueueKernelLaunchCustomExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10202,8 +10446,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramBuildExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10211,8 +10456,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramBuildExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10224,8 +10469,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramBuildExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_BUILD_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10251,8 +10496,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
     ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
                                               &phDevices, &pOptions};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramCompileExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10260,8 +10506,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramCompileExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10273,8 +10519,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramCompileExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_COMPILE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10308,8 +10554,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                                            &count,    &phPrograms, &pOptions,
                                            &phProgram};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urProgramLinkExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10317,8 +10564,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urProgramLinkExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10331,8 +10578,8 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urProgramLinkExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_LINK_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10343,18 +10590,21 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMImportExp
-__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem,                   ///< [in] pointer to host memory object
-    size_t size ///< [in] size in bytes of the host memory object to be imported
+/// @brief Intercept function for urEnqueueKernelLaunchMultiExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
+    ur_enqueue_kernel_launch_multi_exp_params_t params = {&numLaunches,
+                                                          &pLaunches};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMImportExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10362,12 +10612,18 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMImportExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
 
+        for (uint32_t i = 0; i < numLaunches; ++i) {
+            if (pLaunches[i].phEvent) {
+                *pLaunches[i].phEvent =
+                    mock::createDummyHandle<ur_event_handle_t>();
+            }
+        }
         result = UR_RESULT_SUCCESS;
     }
 
@@ -10375,8 +10631,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMImportExp"));
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10387,17 +10643,24 @@ __urdlllocal ur_result_t UR_APICALL urUSMImportExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMReleaseExp
-__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem                    ///< [in] pointer to host memory object
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_usm_release_exp_params_t params = {&hContext, &pMem};
+    ur_program_build_async_exp_params_t params = {&hProgram, &hQueue,
+                                                  &pOptions, &phEvent};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urUSMReleaseExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10405,12 +10668,13 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urUSMReleaseExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
 
+        *phEvent = mock::createDummyHandle<ur_event_handle_t>();
         result = UR_RESULT_SUCCESS;
     }
 
@@ -10418,8 +10682,8 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUSMReleaseExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10430,20 +10694,18 @@ __urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urQueueBeginCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueBeginCaptureExp(
+    ur_queue_handle_t
+        hQueue ///< [in] handle of the queue to capture the commands of
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
-                                                         &peerDevice};
+    ur_queue_begin_capture_exp_params_t params = {&hQueue};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urUsmP2PEnablePeerAccessExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10451,9 +10713,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urUsmP2PEnablePeerAccessExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10465,8 +10726,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urUsmP2PEnablePeerAccessExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10477,20 +10738,21 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urQueueEndCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *
+        phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                        ///< commands
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
-                                                          &peerDevice};
+    ur_queue_end_capture_exp_params_t params = {&hQueue, &phCommandBuffer};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urUsmP2PDisablePeerAccessExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_QUEUE_END_CAPTURE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10498,13 +10760,14 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urUsmP2PDisablePeerAccessExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_QUEUE_END_CAPTURE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
 
+        *phCommandBuffer =
+            mock::createDummyHandle<ur_exp_command_buffer_handle_t>();
         result = UR_RESULT_SUCCESS;
     }
 
@@ -10512,9 +10775,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urUsmP2PDisablePeerAccessExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_QUEUE_END_CAPTURE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10525,32 +10787,709 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t
-        commandDevice,             ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
-    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
-    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
-    void *
-        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
-                    ///< the info.
-    ///< If propSize is not equal to or greater than the real number of bytes
-    ///< needed to return the info
-    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
-    ///< pPropValue is not used.
-    size_t *
-        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be used.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the allocation.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_usm_p2p_peer_access_get_info_exp_params_t params = {
-        &commandDevice, &peerDevice, &propName,
+    ur_enqueue_usm_device_alloc_exp_params_t params = {&hQueue, &size, &numEventsInWaitList, &phEventWaitList, &ppMem, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        *ppMem = mock::createDummyHandle<void *>(size);
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    void *pMem,                   ///< [in] pointer to USM memory object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be freed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the free. If
+    ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_usm_free_exp_params_t params = {&hQueue, &pMem, &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_FREE_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_USM_FREE_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        mock::releaseDummyHandle(pMem);
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_FREE_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowableAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t
+        maxSize, ///< [in] size in bytes of the address range reserved for the allocation
+    size_t
+        size, ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem ///< [out] pointer to USM device memory object
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_growable_alloc_exp_params_t params = {&hContext, &hDevice, &maxSize,
+                                                 &size, &ppMem};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        *ppMem = mock::createDummyHandle<void *>(maxSize);
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size ///< [in] size in bytes the allocation must be backed for
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_grow_exp_params_t params = {&hContext, &pMem, &size};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_GROW_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_GROW_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(UR_FUNCTION_USM_GROW_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_IMPORT_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_IMPORT_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_IMPORT_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_release_exp_params_t params = {&hContext, &pMem};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_RELEASE_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_RELEASE_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_RELEASE_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
+                                                         &peerDevice};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
+                                                          &peerDevice};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_p2p_peer_access_get_info_exp_params_t params = {
+        &commandDevice, &peerDevice, &propName,
         &propSize,      &pPropValue, &pPropSizeRet};
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback(
-            "urUsmP2PPeerAccessGetInfoExp"));
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback = callbacks.get_before_callback(
+        UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback = callbacks.get_after_callback(
+        UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t
+        minBytesToKeep ///< [in] number of bytes of free memory which may be left cached
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_usm_pool_trim_exp_params_t params = {&hContext, &hPool,
+                                            &minBytesToKeep};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_USM_POOL_TRIM_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_USM_POOL_TRIM_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_USM_POOL_TRIM_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
+    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_native_command_exp_params_t params = {&hQueue,
+                                                     &pfnNativeEnqueue,
+                                                     &data,
+                                                     &numMemsInMemList,
+                                                     &phMemList,
+                                                     &pProperties,
+                                                     &numEventsInWaitList,
+                                                     &phEventWaitList,
+                                                     &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueHostTaskExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_host_task_function_t
+        pfnHostTask, ///< [in] function run on the host once the host task's dependencies
+                     ///< completed
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host task is run.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once pfnHostTask
+                ///< returned.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_host_task_exp_params_t params = {
+        &hQueue,          &pfnHostTask, &pUserData, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventCreateIPCExp
+__urdlllocal ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_create_ipc_exp_params_t params = {&hContext, &hDevice, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_CREATE_IPC_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_CREATE_IPC_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_CREATE_IPC_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t
+        hEvent, ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *
+        pIPCHandle ///< [out] pointer to the IPC handle of the event
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_get_ipc_handle_exp_params_t params = {&hEvent, &pIPCHandle};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10558,9 +11497,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback(
-            "urUsmP2PPeerAccessGetInfoExp"));
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10572,9 +11510,8 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback(
-            "urUsmP2PPeerAccessGetInfoExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10585,45 +11522,218 @@ __urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urEnqueueNativeCommandExp
-__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+/// @brief Intercept function for urEventOpenIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    const ur_exp_ipc_event_handle_t *
+        pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                    ///< another process
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_event_open_ipc_handle_exp_params_t params = {
+        &hContext, &hDevice, &pIPCHandle, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueIPCEventSignalExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_exp_enqueue_native_command_function_t
-        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
-                          ///< immediately.
-    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
-    uint32_t numMemsInMemList, ///< [in] size of the mem list
-    const ur_mem_handle_t *
-        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
-                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
-    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
-    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
-    const ur_exp_enqueue_native_command_properties_t *
-        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to signal
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before the kernel execution.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ///< events that must be complete before the IPC event is signaled.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
     ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies the work that has
-    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
-    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
     ) try {
     ur_result_t result = UR_RESULT_SUCCESS;
 
-    ur_enqueue_native_command_exp_params_t params = {&hQueue,
-                                                     &pfnNativeEnqueue,
-                                                     &data,
-                                                     &numMemsInMemList,
-                                                     &phMemList,
-                                                     &pProperties,
-                                                     &numEventsInWaitList,
-                                                     &phEventWaitList,
-                                                     &phEvent};
+    ur_enqueue_ipc_event_signal_exp_params_t params = {
+        &hQueue, &hIPCEvent, &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueIPCEventWaitExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command starts waiting.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once the IPC
+                ///< event was signaled.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_ipc_event_wait_exp_params_t params = {
+        &hQueue, &hIPCEvent, &numEventsInWaitList, &phEventWaitList, &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP);
+    if (beforeCallback) {
+        result = beforeCallback(&params);
+        if (result != UR_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    auto replaceCallback =
+        callbacks.get_replace_callback(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP);
+    if (replaceCallback) {
+        result = replaceCallback(&params);
+    } else {
+
+        // optional output handle
+        if (phEvent) {
+            *phEvent = mock::createDummyHandle<ur_event_handle_t>();
+        }
+        result = UR_RESULT_SUCCESS;
+    }
+
+    if (result != UR_RESULT_SUCCESS) {
+        return result;
+    }
+
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP);
+    if (afterCallback) {
+        return afterCallback(&params);
+    }
 
-    auto beforeCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_before_callback("urEnqueueNativeCommandExp"));
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMMemcpyBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,       ///< [in] number of blocks to copy
+    void **
+        ppDst, ///< [in][range(0, numCopies)] pointers to the destination USM memory
+               ///< blocks
+    const void **
+        ppSrc, ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *
+        pSizes, ///< [in][range(0, numCopies)] sizes in bytes of the blocks
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once all the
+    ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+    ///< phEvent must not refer to an element of the phEventWaitList array.
+    ) try {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    ur_enqueue_usm_memcpy_batch_exp_params_t params = {
+        &hQueue,
+        &blocking,
+        &numCopies,
+        &ppDst,
+        &ppSrc,
+        &pSizes,
+        &numEventsInWaitList,
+        &phEventWaitList,
+        &phEvent};
+
+    auto &callbacks = mock::getCallbacks();
+    auto beforeCallback =
+        callbacks.get_before_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP);
     if (beforeCallback) {
         result = beforeCallback(&params);
         if (result != UR_RESULT_SUCCESS) {
@@ -10631,8 +11741,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         }
     }
 
-    auto replaceCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_replace_callback("urEnqueueNativeCommandExp"));
+    auto replaceCallback = callbacks.get_replace_callback(
+        UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP);
     if (replaceCallback) {
         result = replaceCallback(&params);
     } else {
@@ -10648,8 +11758,8 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         return result;
     }
 
-    auto afterCallback = reinterpret_cast<ur_mock_callback_t>(
-        mock::getCallbacks().get_after_callback("urEnqueueNativeCommandExp"));
+    auto afterCallback =
+        callbacks.get_after_callback(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP);
     if (afterCallback) {
         return afterCallback(&params);
     }
@@ -10744,6 +11854,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
 
     pDdiTable->pfnImageCopyExp = driver::urBindlessImagesImageCopyExp;
 
+    pDdiTable->pfnImageCopyBatchExp =
+        driver::urBindlessImagesImageCopyBatchExp;
+
     pDdiTable->pfnImageGetInfoExp = driver::urBindlessImagesImageGetInfoExp;
 
     pDdiTable->pfnMipmapGetLevelExp = driver::urBindlessImagesMipmapGetLevelExp;
@@ -10864,6 +11977,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
 
     pDdiTable->pfnCommandGetInfoExp = driver::urCommandBufferCommandGetInfoExp;
 
+    pDdiTable->pfnUpdateKernelLaunchBatchExp =
+        driver::urCommandBufferUpdateKernelLaunchBatchExp;
+
+    pDdiTable->pfnUploadExp = driver::urCommandBufferUploadExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -11025,8 +12143,22 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     pDdiTable->pfnTimestampRecordingExp =
         driver::urEnqueueTimestampRecordingExp;
 
+    pDdiTable->pfnKernelLaunchMultiExp = driver::urEnqueueKernelLaunchMultiExp;
+
+    pDdiTable->pfnUSMDeviceAllocExp = driver::urEnqueueUSMDeviceAllocExp;
+
+    pDdiTable->pfnUSMFreeExp = driver::urEnqueueUSMFreeExp;
+
     pDdiTable->pfnNativeCommandExp = driver::urEnqueueNativeCommandExp;
 
+    pDdiTable->pfnHostTaskExp = driver::urEnqueueHostTaskExp;
+
+    pDdiTable->pfnIPCEventSignalExp = driver::urEnqueueIPCEventSignalExp;
+
+    pDdiTable->pfnIPCEventWaitExp = driver::urEnqueueIPCEventWaitExp;
+
+    pDdiTable->pfnUSMMemcpyBatchExp = driver::urEnqueueUSMMemcpyBatchExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -11077,6 +12209,42 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+    ) try {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (driver::d_context.version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnWaitAnyExp = driver::urEventWaitAnyExp;
+
+    pDdiTable->pfnCreateIPCExp = driver::urEventCreateIPCExp;
+
+    pDdiTable->pfnGetIPCHandleExp = driver::urEventGetIPCHandleExp;
+
+    pDdiTable->pfnOpenIPCHandleExp = driver::urEventOpenIPCHandleExp;
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
@@ -11166,6 +12334,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
         driver::urKernelSuggestMaxCooperativeGroupCountExp;
 
+    pDdiTable->pfnSetArgsExp = driver::urKernelSetArgsExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -11384,6 +12554,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
 
     pDdiTable->pfnLinkExp = driver::urProgramLinkExp;
 
+    pDdiTable->pfnBuildAsyncExp = driver::urProgramBuildAsyncExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
@@ -11434,6 +12606,38 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return exceptionToResult(std::current_exception());
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+    ) try {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (driver::d_context.version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnBeginCaptureExp = driver::urQueueBeginCaptureExp;
+
+    pDdiTable->pfnEndCaptureExp = driver::urQueueEndCaptureExp;
+
+    return result;
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
@@ -11546,10 +12750,16 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
 
     pDdiTable->pfnPitchedAllocExp = driver::urUSMPitchedAllocExp;
 
+    pDdiTable->pfnGrowableAllocExp = driver::urUSMGrowableAllocExp;
+
+    pDdiTable->pfnGrowExp = driver::urUSMGrowExp;
+
     pDdiTable->pfnImportExp = driver::urUSMImportExp;
 
     pDdiTable->pfnReleaseExp = driver::urUSMReleaseExp;
 
+    pDdiTable->pfnPoolTrimExp = driver::urUSMPoolTrimExp;
+
     return result;
 } catch (...) {
     return exceptionToResult(std::current_exception());
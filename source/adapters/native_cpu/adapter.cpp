@@ -10,6 +10,7 @@
 
 #include "common.hpp"
 #include "ur_api.h"
+#include "ur_perf_counters.hpp"
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
@@ -57,6 +58,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
     return ReturnValue(UR_ADAPTER_BACKEND_NATIVE_CPU);
   case UR_ADAPTER_INFO_REFERENCE_COUNT:
     return ReturnValue(Adapter.RefCount.load());
+  case UR_ADAPTER_INFO_PERF_COUNTERS:
+    return ReturnValue(ur::perf_counters::get().dump().c_str());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -8,181 +8,427 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <cstdint>
+#include <vector>
+
+#include "command_buffer.hpp"
 #include "common.hpp"
+#include "enqueue.hpp"
+#include "memops.hpp"
+#include "memory.hpp"
+#include "queue.hpp"
+
+ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
+  for (auto hCommand : commandHandles) {
+    decrementOrDelete(hCommand);
+  }
+}
+
+ur_result_t ur_exp_command_buffer_handle_t_::append(
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand,
+    std::function<void()> &&command) {
+  UR_ASSERT(!isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  UR_ASSERT((pSyncPointWaitList == nullptr) == (numSyncPointsInWaitList == 0),
+            UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_WAIT_LIST_EXP);
+  for (uint32_t i = 0; i < numSyncPointsInWaitList; i++) {
+    UR_ASSERT(pSyncPointWaitList[i] < commands.size(),
+              UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_SYNC_POINT_EXP);
+  }
+  // UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP isn't supported
+  UR_ASSERT(numEventsInWaitList == 0 && !phEventWaitList && !phEvent,
+            UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+  if (phCommand) {
+    auto hCommand = new ur_exp_command_buffer_command_handle_t_(this);
+    // One reference for the application and one for the command-buffer
+    hCommand->incrementReferenceCount();
+    commandHandles.push_back(hCommand);
+    *phCommand = hCommand;
+  }
+  if (pSyncPoint) {
+    *pSyncPoint = static_cast<ur_exp_command_buffer_sync_point_t>(
+        commands.size());
+  }
+  commands.push_back(std::move(command));
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_exp_command_buffer_handle_t_::replay() const {
+  for (auto &command : commands) {
+    command();
+  }
+}
 
-/// Stub implementations of UR experimental feature command-buffers
-/// Taken almost unchanged from another adapter. Perhaps going forward
-/// these stubs could be defined in core UR as the default which would
-/// reduce code duplication. Adapters could then "override" these defaults.
-/// Issue raised for this comment in
-/// https://github.com/oneapi-src/unified-runtime/issues/1064
+namespace {
+
+// Appends a copy of the region between the origins, the pitches defaulting
+// like those of the enqueued rect commands
+ur_result_t appendCopyRect(
+    ur_exp_command_buffer_handle_t hCommandBuffer, char *dst,
+    ur_rect_offset_t dstOrigin, size_t dstRowPitch, size_t dstSlicePitch,
+    const char *src, ur_rect_offset_t srcOrigin, size_t srcRowPitch,
+    size_t srcSlicePitch, ur_rect_region_t region,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  if (dstRowPitch == 0)
+    dstRowPitch = region.width;
+  if (dstSlicePitch == 0)
+    dstSlicePitch = dstRowPitch * region.height;
+  if (srcRowPitch == 0)
+    srcRowPitch = region.width;
+  if (srcSlicePitch == 0)
+    srcSlicePitch = srcRowPitch * region.height;
+  dst += dstOrigin.z * dstSlicePitch + dstOrigin.y * dstRowPitch + dstOrigin.x;
+  src += srcOrigin.z * srcSlicePitch + srcOrigin.y * srcRowPitch + srcOrigin.x;
+  return hCommandBuffer->append(
+      numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+      phEventWaitList, pSyncPoint, phEvent, phCommand,
+      [&tp = hCommandBuffer->device->tp, dst, dstRowPitch, dstSlicePitch, src,
+       srcRowPitch, srcSlicePitch, region]() {
+        native_cpu::copyRect(tp, dst, src, region, dstRowPitch, dstSlicePitch,
+                             srcRowPitch, srcSlicePitch);
+      });
+}
+
+ur_result_t appendCopy(
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst,
+    const void *pSrc, size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  return hCommandBuffer->append(
+      numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+      phEventWaitList, pSyncPoint, phEvent, phCommand,
+      [&tp = hCommandBuffer->device->tp, pDst, pSrc, size]() {
+        native_cpu::copy(tp, pDst, pSrc, size);
+      });
+}
+
+ur_result_t
+appendFill(ur_exp_command_buffer_handle_t hCommandBuffer, void *ptr,
+           const void *pPattern, size_t patternSize, size_t size,
+           uint32_t numSyncPointsInWaitList,
+           const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+           uint32_t numEventsInWaitList,
+           const ur_event_handle_t *phEventWaitList,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint,
+           ur_event_handle_t *phEvent,
+           ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+
+  // The pattern only needs to live until the call returns
+  std::vector<uint8_t> patternBytes(static_cast<const uint8_t *>(pPattern),
+                                    static_cast<const uint8_t *>(pPattern) +
+                                        patternSize);
+  return hCommandBuffer->append(
+      numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+      phEventWaitList, pSyncPoint, phEvent, phCommand,
+      [&tp = hCommandBuffer->device->tp, ptr, size,
+       patternBytes = std::move(patternBytes)]() {
+        native_cpu::fill(tp, ptr, patternBytes.data(), patternBytes.size(),
+                         size);
+      });
+}
+
+} // namespace
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
-    ur_context_handle_t, ur_device_handle_t,
-    const ur_exp_command_buffer_desc_t *, ur_exp_command_buffer_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_context_handle_t hContext, ur_device_handle_t hDevice,
+    const ur_exp_command_buffer_desc_t *pCommandBufferDesc,
+    ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  UR_ASSERT(phCommandBuffer, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  // No UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP
+  UR_ASSERT(!pCommandBufferDesc || !pCommandBufferDesc->isUpdatable,
+            UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // Commands run in order, whether the command-buffer is in-order or not
+  *phCommandBuffer = new ur_exp_command_buffer_handle_t_(hContext, hDevice);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferRetainExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  hCommandBuffer->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferReleaseExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  decrementOrDelete(hCommandBuffer);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
+  UR_ASSERT(!hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  hCommandBuffer->isFinalized = true;
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
-    ur_exp_command_buffer_handle_t, ur_kernel_handle_t, uint32_t,
-    const size_t *, const size_t *, const size_t *, uint32_t,
-    ur_kernel_handle_t *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    uint32_t, const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_kernel_handle_t hKernel,
+    uint32_t workDim, const size_t *pGlobalWorkOffset,
+    const size_t *pGlobalWorkSize, const size_t *pLocalWorkSize,
+    uint32_t numKernelAlternatives, ur_kernel_handle_t *phKernelAlternatives,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  // Alternatives are only switched to by updates, which aren't supported
+  std::ignore = numKernelAlternatives;
+  std::ignore = phKernelAlternatives;
+
+  // The launch is checked and takes the arguments of the kernel now, so that
+  // replaying it only runs it
+  std::function<void()> command;
+  ur_result_t result = native_cpu::makeKernelLaunch(
+      hCommandBuffer->device->tp, hKernel, workDim, pGlobalWorkOffset,
+      pGlobalWorkSize, pLocalWorkSize, command);
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  return hCommandBuffer->append(numSyncPointsInWaitList, pSyncPointWaitList,
+                                numEventsInWaitList, phEventWaitList,
+                                pSyncPoint, phEvent, phCommand,
+                                std::move(command));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst,
+    const void *pSrc, size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendCopy(hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+                    pSyncPointWaitList, numEventsInWaitList, phEventWaitList,
+                    pSyncPoint, phEvent, phCommand);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    uint32_t, const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, size_t srcOffset, size_t dstOffset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  return appendCopy(hCommandBuffer, hDstMem->_mem + dstOffset,
+                    hSrcMem->_mem + srcOffset, size, numSyncPointsInWaitList,
+                    pSyncPointWaitList, numEventsInWaitList, phEventWaitList,
+                    pSyncPoint, phEvent, phCommand);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_mem_handle_t,
-    ur_rect_offset_t, ur_rect_offset_t, ur_rect_region_t, size_t, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    uint32_t, const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hSrcMem,
+    ur_mem_handle_t hDstMem, ur_rect_offset_t srcOrigin,
+    ur_rect_offset_t dstOrigin, ur_rect_region_t region, size_t srcRowPitch,
+    size_t srcSlicePitch, size_t dstRowPitch, size_t dstSlicePitch,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  return appendCopyRect(hCommandBuffer, hDstMem->_mem, dstOrigin, dstRowPitch,
+                        dstSlicePitch, hSrcMem->_mem, srcOrigin, srcRowPitch,
+                        srcSlicePitch, region, numSyncPointsInWaitList,
+                        pSyncPointWaitList, numEventsInWaitList,
+                        phEventWaitList, pSyncPoint, phEvent, phCommand);
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t,
-    const void *, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    uint32_t, const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, const void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendCopy(hCommandBuffer, hBuffer->_mem + offset, pSrc, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList,
+                    numEventsInWaitList, phEventWaitList, pSyncPoint, phEvent,
+                    phCommand);
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    size_t offset, size_t size, void *pDst, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendCopy(hCommandBuffer, pDst, hBuffer->_mem + offset, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList,
+                    numEventsInWaitList, phEventWaitList, pSyncPoint, phEvent,
+                    phCommand);
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pSrc,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendCopyRect(hCommandBuffer, hBuffer->_mem, bufferOffset,
+                        bufferRowPitch, bufferSlicePitch,
+                        static_cast<const char *>(pSrc), hostOffset,
+                        hostRowPitch, hostSlicePitch, region,
+                        numSyncPointsInWaitList, pSyncPointWaitList,
+                        numEventsInWaitList, phEventWaitList, pSyncPoint,
+                        phEvent, phCommand);
 }
 
 UR_APIEXPORT
 ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, ur_rect_offset_t,
-    ur_rect_offset_t, ur_rect_region_t, size_t, size_t, size_t, size_t, void *,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    ur_rect_offset_t bufferOffset, ur_rect_offset_t hostOffset,
+    ur_rect_region_t region, size_t bufferRowPitch, size_t bufferSlicePitch,
+    size_t hostRowPitch, size_t hostSlicePitch, void *pDst,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendCopyRect(hCommandBuffer, static_cast<char *>(pDst), hostOffset,
+                        hostRowPitch, hostSlicePitch, hBuffer->_mem,
+                        bufferOffset, bufferRowPitch, bufferSlicePitch, region,
+                        numSyncPointsInWaitList, pSyncPointWaitList,
+                        numEventsInWaitList, phEventWaitList, pSyncPoint,
+                        phEvent, phCommand);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
-    ur_exp_command_buffer_handle_t, ur_queue_handle_t, uint32_t,
-    const ur_event_handle_t *, ur_event_handle_t *) {
-  detail::ur::die("Experimental Command-buffer feature is not "
-                  "implemented for the NativeCPU adapter.");
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_queue_handle_t hQueue,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent) {
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+
+  // Retained until its commands have run
+  hCommandBuffer->incrementReferenceCount();
+  ur_result_t result = hQueue->enqueue(
+      UR_COMMAND_COMMAND_BUFFER_ENQUEUE_EXP, numEventsInWaitList,
+      phEventWaitList, phEvent, [hCommandBuffer]() {
+        hCommandBuffer->replay();
+        decrementOrDelete(hCommandBuffer);
+      });
+  if (result != UR_RESULT_SUCCESS) {
+    decrementOrDelete(hCommandBuffer);
+  }
+  return result;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    [[maybe_unused]] ur_queue_handle_t hQueue) {
+  // The commands are replayed on the host, so there is nothing to upload.
+  UR_ASSERT(hCommandBuffer->isFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
-    ur_exp_command_buffer_handle_t, ur_mem_handle_t, const void *, size_t,
-    size_t, size_t, uint32_t, const ur_exp_command_buffer_sync_point_t *,
-    uint32_t, const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, ur_mem_handle_t hBuffer,
+    const void *pPattern, size_t patternSize, size_t offset, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  return appendFill(hCommandBuffer, hBuffer->_mem + offset, pPattern,
+                    patternSize, size, numSyncPointsInWaitList,
+                    pSyncPointWaitList, numEventsInWaitList, phEventWaitList,
+                    pSyncPoint, phEvent, phCommand);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
-    ur_exp_command_buffer_handle_t, void *, const void *, size_t, size_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  UR_ASSERT(pMemory, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  return appendFill(hCommandBuffer, pMemory, pPattern, patternSize, size,
+                    numSyncPointsInWaitList, pSyncPointWaitList,
+                    numEventsInWaitList, phEventWaitList, pSyncPoint, phEvent,
+                    phCommand);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t,
-    ur_usm_migration_flags_t, uint32_t,
-    const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = flags;
+
+  // USM is host memory, prefetching it only has to order the command
+  return hCommandBuffer->append(numSyncPointsInWaitList, pSyncPointWaitList,
+                                numEventsInWaitList, phEventWaitList,
+                                pSyncPoint, phEvent, phCommand, []() {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
-    ur_exp_command_buffer_handle_t, const void *, size_t, ur_usm_advice_flags_t,
-    uint32_t, const ur_exp_command_buffer_sync_point_t *, uint32_t,
-    const ur_event_handle_t *, ur_exp_command_buffer_sync_point_t *,
-    ur_event_handle_t *, ur_exp_command_buffer_command_handle_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer, const void *pMemory,
+    size_t size, ur_usm_advice_flags_t advice,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
+    ur_exp_command_buffer_command_handle_t *phCommand) {
+  std::ignore = pMemory;
+  std::ignore = size;
+  std::ignore = advice;
+
+  return hCommandBuffer->append(numSyncPointsInWaitList, pSyncPointWaitList,
+                                numEventsInWaitList, phEventWaitList,
+                                pSyncPoint, phEvent, phCommand, []() {});
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferRetainCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  hCommand->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urCommandBufferReleaseCommandExp(ur_exp_command_buffer_command_handle_t) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
+    ur_exp_command_buffer_command_handle_t hCommand) {
+  decrementOrDelete(hCommand);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
@@ -203,13 +449,36 @@ urCommandBufferUpdateWaitEventsExp(ur_exp_command_buffer_command_handle_t,
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferGetInfoExp(
-    ur_exp_command_buffer_handle_t, ur_exp_command_buffer_info_t, size_t,
-    void *, size_t *) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    ur_exp_command_buffer_info_t propName, size_t propSize, void *pPropValue,
+    size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_INFO_REFERENCE_COUNT:
+    return ReturnValue(hCommandBuffer->getReferenceCount());
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
-    ur_exp_command_buffer_command_handle_t,
-    ur_exp_command_buffer_command_info_t, size_t, void *, size_t *) {
+    ur_exp_command_buffer_command_handle_t hCommand,
+    ur_exp_command_buffer_command_info_t propName, size_t propSize,
+    void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EXP_COMMAND_BUFFER_COMMAND_INFO_REFERENCE_COUNT:
+    return ReturnValue(hCommand->getReferenceCount());
+  default:
+    return UR_RESULT_ERROR_INVALID_ENUMERATION;
+  }
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t, uint32_t,
+    const ur_exp_command_buffer_command_handle_t *,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
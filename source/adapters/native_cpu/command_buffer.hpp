@@ -0,0 +1,60 @@
+//===--------- command_buffer.hpp - Native CPU Adapter --------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <functional>
+#include <vector>
+
+#include "common.hpp"
+#include "device.hpp"
+#include "ur_api.h"
+
+struct ur_exp_command_buffer_command_handle_t_ : RefCounted {
+  ur_exp_command_buffer_command_handle_t_(
+      ur_exp_command_buffer_handle_t commandBuffer)
+      : commandBuffer(commandBuffer) {}
+
+  const ur_exp_command_buffer_handle_t commandBuffer;
+};
+
+// Commands recorded with their checks done and their arguments resolved, so
+// that enqueuing the command-buffer only has to run them. Sync points are the
+// indices of the commands, which can only depend on the commands appended
+// before them: running the commands in order honours all their sync points.
+struct ur_exp_command_buffer_handle_t_ : RefCounted {
+  ur_exp_command_buffer_handle_t_(ur_context_handle_t context,
+                                  ur_device_handle_t device)
+      : context(context), device(device) {}
+
+  // Releases the command handles returned to the application
+  ~ur_exp_command_buffer_handle_t_();
+
+  // Appends command, returning its sync point in pSyncPoint and a handle to
+  // it in phCommand if not null
+  ur_result_t
+  append(uint32_t numSyncPointsInWaitList,
+         const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+         uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+         ur_exp_command_buffer_sync_point_t *pSyncPoint,
+         ur_event_handle_t *phEvent,
+         ur_exp_command_buffer_command_handle_t *phCommand,
+         std::function<void()> &&command);
+
+  // Runs the commands, from outside the workers of the device thread pool
+  void replay() const;
+
+  const ur_context_handle_t context;
+  const ur_device_handle_t device;
+  bool isFinalized = false;
+
+private:
+  std::vector<std::function<void()>> commands;
+  std::vector<ur_exp_command_buffer_command_handle_t> commandHandles;
+};
@@ -60,6 +60,10 @@ urContextGetInfo(ur_context_handle_t hContext, ur_context_info_t propName,
     // case UR_CONTEXT_INFO_USM_MEMSET2D_SUPPORT:
     // 2D USM operations currently not supported.
     return returnValue(false);
+  case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+  case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP:
+  case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+    return hContext->MemoryAccounting.getInfo(propName, returnValue);
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_ORDER_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_MEMORY_SCOPE_CAPABILITIES:
   case UR_CONTEXT_INFO_ATOMIC_FENCE_ORDER_CAPABILITIES:
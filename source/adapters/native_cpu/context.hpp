@@ -16,7 +16,9 @@
 
 #include "common.hpp"
 #include "device.hpp"
+#include "huge_pages.hpp"
 #include "ur/ur.hpp"
+#include "ur_memory_accounting.hpp"
 
 namespace native_cpu {
 struct usm_alloc_info {
@@ -29,13 +31,36 @@ struct usm_alloc_info {
   // We store a pointer to the actual allocation because it is needed when
   // freeing memory.
   void *base_alloc_ptr;
+  // Size of the huge page mapping of the allocation, 0 if it was malloc'ed
+  size_t mapped_size;
   constexpr usm_alloc_info(ur_usm_type_t type, const void *base_ptr,
                            size_t size, ur_device_handle_t device,
-                           ur_usm_pool_handle_t pool, void *base_alloc_ptr)
+                           ur_usm_pool_handle_t pool, void *base_alloc_ptr,
+                           size_t mapped_size = 0)
       : type(type), base_ptr(base_ptr), size(size), device(device), pool(pool),
-        base_alloc_ptr(base_alloc_ptr) {}
+        base_alloc_ptr(base_alloc_ptr), mapped_size(mapped_size) {}
+
+  // Bytes taken from the system for the allocation, header and padding
+  // included
+  size_t alloc_size() const {
+    return mapped_size ? mapped_size
+                       : size + (static_cast<const uint8_t *>(base_ptr) -
+                                 static_cast<const uint8_t *>(base_alloc_ptr));
+  }
 };
 
+static inline ur_exp_context_memory_type_t
+get_memory_type(ur_usm_type_t type) {
+  switch (type) {
+  case UR_USM_TYPE_HOST:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST;
+  case UR_USM_TYPE_DEVICE:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE;
+  default:
+    return UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED;
+  }
+}
+
 constexpr usm_alloc_info usm_alloc_info_null_entry(UR_USM_TYPE_UNKNOWN, nullptr,
                                                    0, nullptr, nullptr,
                                                    nullptr);
@@ -95,16 +120,25 @@ struct ur_context_handle_t_ : RefCounted {
 
   ur_device_handle_t _device;
 
+  // Memory of the USM allocations and buffers of the context
+  ur::memory_accounting MemoryAccounting{this};
+
   ur_result_t remove_alloc(void *ptr) {
     std::lock_guard<std::mutex> lock(alloc_mutex);
     const native_cpu::usm_alloc_info &info = native_cpu::get_alloc_info(ptr);
     UR_ASSERT(info.type != UR_USM_TYPE_UNKNOWN,
               UR_RESULT_ERROR_INVALID_MEM_OBJECT);
+    MemoryAccounting.onFree(native_cpu::get_memory_type(info.type),
+                            info.alloc_size());
+    if (info.mapped_size) {
+      native_cpu::freeHugePages(info.base_alloc_ptr, info.mapped_size);
+    } else {
 #ifdef _MSC_VER
-    _aligned_free(info.base_alloc_ptr);
+      _aligned_free(info.base_alloc_ptr);
 #else
-    free(info.base_alloc_ptr);
+      free(info.base_alloc_ptr);
 #endif
+    }
     allocations.erase(ptr);
     return UR_RESULT_SUCCESS;
   }
@@ -127,7 +161,16 @@ struct ur_context_handle_t_ : RefCounted {
     // otherwise its start address may be unaligned.
     alignment =
         std::max<size_t>(alignment, alignof(native_cpu::usm_alloc_info));
-    void *alloc = native_cpu::malloc_impl(alignment, size);
+    size_t mapped_size = 0;
+    void *alloc = nullptr;
+    if (alignment <= native_cpu::HugePagesAlignment) {
+      alloc = native_cpu::allocHugePages(native_cpu::alloc_header_size +
+                                             native_cpu::get_padding(alignment) +
+                                             size,
+                                         mapped_size);
+    }
+    if (!alloc)
+      alloc = native_cpu::malloc_impl(alignment, size);
     if (!alloc)
       return nullptr;
     // Compute the address of the pointer that we'll return to the user.
@@ -138,9 +181,12 @@ struct ur_context_handle_t_ : RefCounted {
       return nullptr;
     // Do a placement new of the alloc_info to avoid allocation and copy
     auto info = new (info_addr)
-        native_cpu::usm_alloc_info(type, ptr, size, this->_device, pool, alloc);
+        native_cpu::usm_alloc_info(type, ptr, size, this->_device, pool, alloc,
+                                   mapped_size);
     if (!info)
       return nullptr;
+    MemoryAccounting.onAlloc(native_cpu::get_memory_type(type),
+                             info->alloc_size());
     allocations.insert(ptr);
     return ptr;
   }
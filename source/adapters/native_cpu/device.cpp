@@ -402,6 +402,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
     return ReturnValue(false);
 
   case UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP:
+    return ReturnValue(true);
   case UR_DEVICE_INFO_COMMAND_BUFFER_EVENT_SUPPORT_EXP:
     return ReturnValue(false);
   case UR_DEVICE_INFO_COMMAND_BUFFER_UPDATE_CAPABILITIES_EXP:
@@ -414,6 +415,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP:
     return ReturnValue(false);
 
+  case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP:
+    return ReturnValue(true);
+
+  case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP:
+    return ReturnValue(false);
+
+  case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP:
+    return ReturnValue(false);
+
+  case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP:
+    return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+
   default:
     DIE_NO_IMPLEMENTATION;
   }
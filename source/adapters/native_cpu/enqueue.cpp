@@ -5,16 +5,24 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include <algorithm>
 #include <array>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
+#include <cstring>
+#include <memory>
+#include <new>
 #include <vector>
 
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "enqueue.hpp"
+#include "event.hpp"
 #include "kernel.hpp"
 #include "memory.hpp"
+#include "memops.hpp"
 #include "queue.hpp"
 #include "threadpool.hpp"
 
@@ -62,79 +70,161 @@ static native_cpu::state getResizedState(const native_cpu::NDRDescT &ndr,
 }
 #endif
 
-UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
-    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
-    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
-    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
-    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+namespace {
+// Local memory entries start on their own cache lines, so that neither the
+// local arguments of a work-group nor the arenas of different threads share
+// lines.
+constexpr size_t CacheLineSize = 64;
 
-  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
-  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
-  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
-  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+size_t alignToCacheLine(size_t size) {
+  return (size + CacheLineSize - 1) & ~(CacheLineSize - 1);
+}
 
-  if (*pGlobalWorkSize == 0) {
-    DIE_NO_IMPLEMENTATION;
-  }
+#ifdef NATIVECPU_USE_OCK
+// Work a chunk of work-groups should at least amount to, so that taking it
+// costs little next to running it
+constexpr uint64_t MinChunkNs = 20000;
 
-  // Check reqd_work_group_size and other kernel constraints
-  if (pLocalWorkSize != nullptr) {
-    uint64_t TotalNumWIs = 1;
-    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
-      TotalNumWIs *= pLocalWorkSize[Dim];
-      if (auto Reqd = hKernel->getReqdWGSize();
-          Reqd && pLocalWorkSize[Dim] != Reqd.value()[Dim]) {
-        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
-      }
-      if (auto MaxWG = hKernel->getMaxWGSize();
-          MaxWG && pLocalWorkSize[Dim] > MaxWG.value()[Dim]) {
-        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
-      }
+size_t getMinChunkSize(const ur_kernel_handle_t_ *hKernel) {
+  uint64_t workGroupNs = hKernel->getWorkGroupNs();
+  return workGroupNs ? std::max<uint64_t>(1, MinChunkNs / workGroupNs) : 1;
+}
+#endif
+
+// Work-group local memory of a thread, kept for its next launches. The thread
+// allocates and first touches it, which places it on the NUMA node of the
+// thread under the default first-touch policy.
+class local_arena {
+public:
+  ~local_arena() { release(); }
+
+  char *get(size_t size) {
+    if (size > capacity) {
+      release();
+      capacity = std::max(size, 2 * capacity);
+      memory = static_cast<char *>(
+          ::operator new(capacity, std::align_val_t(CacheLineSize)));
+      std::memset(memory, 0, capacity);
     }
-    if (auto MaxLinearWG = hKernel->getMaxLinearWGSize()) {
-      if (TotalNumWIs > MaxLinearWG) {
-        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
-      }
+    return memory;
+  }
+
+private:
+  void release() {
+    if (memory) {
+      ::operator delete(memory, std::align_val_t(CacheLineSize));
     }
   }
 
-  // TODO: add proper error checking
-  // TODO: add proper event dep management
-  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
-                           pLocalWorkSize);
-  auto &tp = hQueue->device->tp;
-  const size_t numParallelThreads = tp.num_threads();
-  hKernel->updateMemPool(numParallelThreads);
-  std::vector<std::future<void>> futures;
-  std::vector<std::function<void(size_t, ur_kernel_handle_t_)>> groups;
-  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
-  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
-  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
-  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
-                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
-                          ndr.LocalSize[2], ndr.GlobalOffset[0],
-                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
+  char *memory = nullptr;
+  size_t capacity = 0;
+};
+} // namespace
+
+// Returns the arguments of launch for the work-groups run by the calling
+// thread, whose local arguments point to memory of the thread. Threads only
+// run one launch at a time, the pool running bulk jobs one after the other.
+static const native_cpu::NativeCPUArgDesc *
+getThreadArgs(const native_cpu::launch_args &launch) {
+  if (launch.localArgs.empty()) {
+    return launch.args.data();
+  }
+  thread_local local_arena localMem;
+  thread_local std::vector<native_cpu::NativeCPUArgDesc> args;
+
+  size_t size = 0;
+  for (auto &entry : launch.localArgs) {
+    size += alignToCacheLine(entry.argSize);
+  }
+  char *memory = localMem.get(size);
+  args = launch.args;
+  for (auto &entry : launch.localArgs) {
+    args[entry.argIndex].MPtr = memory;
+    memory += alignToCacheLine(entry.argSize);
+  }
+  return args.data();
+}
+
 #ifndef NATIVECPU_USE_OCK
-  hKernel->handleLocalArgs(1, 0);
-  for (unsigned g2 = 0; g2 < numWG2; g2++) {
-    for (unsigned g1 = 0; g1 < numWG1; g1++) {
-      for (unsigned g0 = 0; g0 < numWG0; g0++) {
-        for (unsigned local2 = 0; local2 < ndr.LocalSize[2]; local2++) {
-          for (unsigned local1 = 0; local1 < ndr.LocalSize[1]; local1++) {
-            for (unsigned local0 = 0; local0 < ndr.LocalSize[0]; local0++) {
-              state.update(g0, g1, g2, local0, local1, local2);
-              hKernel->_subhandler(hKernel->_args.data(), &state);
+// Runs the work-items of a launch with Dims dimensions on the calling thread,
+// work-group after work-group. Only the ids of the first Dims dimensions
+// change from one work-item to the next, so the others are set once, and
+// when the local size is one the work-items are the work-groups.
+template <uint32_t Dims, bool IsLocalSizeOne>
+static void runWorkItems(const nativecpu_task_t &subhandler,
+                         const native_cpu::NativeCPUArgDesc *args,
+                         native_cpu::state &state) {
+  const size_t numWG0 = state.MNumGroups[0];
+  const size_t numWG1 = Dims > 1 ? state.MNumGroups[1] : 1;
+  const size_t numWG2 = Dims > 2 ? state.MNumGroups[2] : 1;
+  const size_t localSize0 = IsLocalSizeOne ? 1 : state.MWorkGroup_size[0];
+  const size_t localSize1 =
+      IsLocalSizeOne || Dims < 2 ? 1 : state.MWorkGroup_size[1];
+  const size_t localSize2 =
+      IsLocalSizeOne || Dims < 3 ? 1 : state.MWorkGroup_size[2];
+  auto setIds = [&state](uint32_t dim, size_t group, size_t local) {
+    state.MWorkGroup_id[dim] = group;
+    state.MLocal_id[dim] = local;
+    state.MGlobal_id[dim] = state.MWorkGroup_size[dim] * group + local +
+                            state.MGlobalOffset[dim];
+  };
+
+  state.update(0, 0, 0, 0, 0, 0);
+  for (size_t g2 = 0; g2 < numWG2; g2++) {
+    for (size_t g1 = 0; g1 < numWG1; g1++) {
+      for (size_t g0 = 0; g0 < numWG0; g0++) {
+        for (size_t local2 = 0; local2 < localSize2; local2++) {
+          if constexpr (Dims > 2) {
+            setIds(2, g2, local2);
+          }
+          for (size_t local1 = 0; local1 < localSize1; local1++) {
+            if constexpr (Dims > 1) {
+              setIds(1, g1, local1);
+            }
+            for (size_t local0 = 0; local0 < localSize0; local0++) {
+              setIds(0, g0, local0);
+              subhandler(args, &state);
             }
           }
         }
       }
     }
   }
+}
+
+using run_work_items_t = void (*)(const nativecpu_task_t &,
+                                  const native_cpu::NativeCPUArgDesc *,
+                                  native_cpu::state &);
+
+// Returns the loop running the work-items of ndr
+static run_work_items_t getWorkItemsLoop(const native_cpu::NDRDescT &ndr) {
+  static constexpr run_work_items_t loops[3][2] = {
+      {runWorkItems<1, false>, runWorkItems<1, true>},
+      {runWorkItems<2, false>, runWorkItems<2, true>},
+      {runWorkItems<3, false>, runWorkItems<3, true>}};
+  bool isLocalSizeOne =
+      ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
+  return loops[ndr.WorkDim - 1][isLocalSizeOne];
+}
+#endif // NATIVECPU_USE_OCK
+
+// Runs the launch of hKernel with the arguments of launch
+static void runKernel(native_cpu::threadpool_t &tp,
+                      ur_kernel_handle_t_ *hKernel,
+                      const native_cpu::launch_args &launch,
+                      const native_cpu::NDRDescT &ndr) {
+  native_cpu::state state(ndr.GlobalSize[0], ndr.GlobalSize[1],
+                          ndr.GlobalSize[2], ndr.LocalSize[0], ndr.LocalSize[1],
+                          ndr.LocalSize[2], ndr.GlobalOffset[0],
+                          ndr.GlobalOffset[1], ndr.GlobalOffset[2]);
+#ifndef NATIVECPU_USE_OCK
+  std::ignore = tp;
+  getWorkItemsLoop(ndr)(hKernel->_subhandler, getThreadArgs(launch), state);
 #else
+  auto numWG0 = ndr.GlobalSize[0] / ndr.LocalSize[0];
+  auto numWG1 = ndr.GlobalSize[1] / ndr.LocalSize[1];
+  auto numWG2 = ndr.GlobalSize[2] / ndr.LocalSize[2];
+  const size_t numParallelThreads = tp.num_threads();
   bool isLocalSizeOne =
       ndr.LocalSize[0] == 1 && ndr.LocalSize[1] == 1 && ndr.LocalSize[2] == 1;
   if (isLocalSizeOne && ndr.GlobalSize[0] > numParallelThreads) {
@@ -155,24 +245,30 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     size_t new_num_work_groups_0 = numParallelThreads;
     size_t itemsPerThread = ndr.GlobalSize[0] / numParallelThreads;
 
+    tp.parallel_for(
+        numWG2 * numWG1 * new_num_work_groups_0,
+        [&ndr = std::as_const(ndr), &launch, itemsPerThread, hKernel, numWG1,
+         new_num_work_groups_0](size_t, size_t begin, size_t end) {
+          native_cpu::state resized_state =
+              getResizedState(ndr, itemsPerThread);
+          auto args = getThreadArgs(launch);
+          for (size_t i = begin; i < end; i++) {
+            size_t g0 = i % new_num_work_groups_0;
+            size_t g1 = i / new_num_work_groups_0 % numWG1;
+            size_t g2 = i / new_num_work_groups_0 / numWG1;
+            resized_state.update(g0, g1, g2);
+            hKernel->_subhandler(args, &resized_state);
+          }
+        });
+    // Peel the remaining work items. Since the local size is 1, we iterate
+    // over the work groups.
+    auto args = getThreadArgs(launch);
     for (unsigned g2 = 0; g2 < numWG2; g2++) {
       for (unsigned g1 = 0; g1 < numWG1; g1++) {
-        for (unsigned g0 = 0; g0 < new_num_work_groups_0; g0 += 1) {
-          futures.emplace_back(
-              tp.schedule_task([&ndr = std::as_const(ndr), itemsPerThread,
-                                hKernel, g0, g1, g2](size_t) {
-                native_cpu::state resized_state =
-                    getResizedState(ndr, itemsPerThread);
-                resized_state.update(g0, g1, g2);
-                hKernel->_subhandler(hKernel->_args.data(), &resized_state);
-              }));
-        }
-        // Peel the remaining work items. Since the local size is 1, we iterate
-        // over the work groups.
         for (unsigned g0 = new_num_work_groups_0 * itemsPerThread; g0 < numWG0;
              g0++) {
           state.update(g0, g1, g2);
-          hKernel->_subhandler(hKernel->_args.data(), &state);
+          hKernel->_subhandler(args, &state);
         }
       }
     }
@@ -180,109 +276,170 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
   } else {
     // We are running a parallel_for over an nd_range
 
-    if (numWG1 * numWG2 >= numParallelThreads) {
-      // Dimensions 1 and 2 have enough work, split them across the threadpool
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          futures.emplace_back(
-              tp.schedule_task([state, kernel = *hKernel, numWG0, g1, g2,
-                                numParallelThreads](size_t threadId) mutable {
-                for (unsigned g0 = 0; g0 < numWG0; g0++) {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                }
-              }));
-        }
-      }
-    } else {
-      // Split dimension 0 across the threadpool
-      // Here we try to create groups of workgroups in order to reduce
-      // synchronization overhead
-      for (unsigned g2 = 0; g2 < numWG2; g2++) {
-        for (unsigned g1 = 0; g1 < numWG1; g1++) {
-          for (unsigned g0 = 0; g0 < numWG0; g0++) {
-            groups.push_back(
-                [state, g0, g1, g2, numParallelThreads](
-                    size_t threadId, ur_kernel_handle_t_ kernel) mutable {
-                  kernel.handleLocalArgs(numParallelThreads, threadId);
-                  state.update(g0, g1, g2);
-                  kernel._subhandler(kernel._args.data(), &state);
-                });
+    // The work-groups are split as one linear range, whatever the shape of
+    // the launch, in guided chunks sized from the time their work-groups took
+    // in the previous launches
+    size_t numWG = numWG0 * numWG1 * numWG2;
+    auto start = std::chrono::steady_clock::now();
+    tp.parallel_for(
+        numWG,
+        [&](size_t, size_t begin, size_t end) {
+          native_cpu::state chunk_state = state;
+          auto args = getThreadArgs(launch);
+          for (size_t i = begin; i < end; i++) {
+            chunk_state.update(i % numWG0, i / numWG0 % numWG1,
+                               i / numWG0 / numWG1);
+            hKernel->_subhandler(args, &chunk_state);
           }
-        }
+        },
+        getMinChunkSize(hKernel));
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now() - start);
+    hKernel->recordWorkGroupNs(elapsed.count() * numParallelThreads / numWG);
+  }
+#endif // NATIVECPU_USE_OCK
+}
+
+namespace {
+// Launch of a kernel with the arguments it had when the launch was made,
+// which keeps the kernel retained
+class kernel_launch {
+public:
+  kernel_launch(ur_kernel_handle_t_ *hKernel, const native_cpu::NDRDescT &ndr)
+      : hKernel(hKernel), launch(hKernel->acquireLaunchArgs()), ndr(ndr) {
+    hKernel->incrementReferenceCount();
+  }
+
+  ~kernel_launch() {
+    hKernel->releaseLaunchArgs(launch);
+    decrementOrDelete(hKernel);
+  }
+
+  kernel_launch(const kernel_launch &) = delete;
+  kernel_launch &operator=(const kernel_launch &) = delete;
+
+  void run(native_cpu::threadpool_t &tp) const {
+    runKernel(tp, hKernel, *launch, ndr);
+  }
+
+private:
+  ur_kernel_handle_t_ *const hKernel;
+  native_cpu::launch_args *const launch;
+  const native_cpu::NDRDescT ndr;
+};
+} // namespace
+
+ur_result_t native_cpu::makeKernelLaunch(
+    threadpool_t &tp, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, std::function<void()> &command) {
+  UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+  UR_ASSERT(pGlobalWorkOffset, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(workDim > 0, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+  UR_ASSERT(workDim < 4, UR_RESULT_ERROR_INVALID_WORK_DIMENSION);
+
+  if (*pGlobalWorkSize == 0) {
+    DIE_NO_IMPLEMENTATION;
+  }
+
+  // Check reqd_work_group_size and other kernel constraints
+  if (pLocalWorkSize != nullptr) {
+    uint64_t TotalNumWIs = 1;
+    for (uint32_t Dim = 0; Dim < workDim; Dim++) {
+      TotalNumWIs *= pLocalWorkSize[Dim];
+      if (auto Reqd = hKernel->getReqdWGSize();
+          Reqd && pLocalWorkSize[Dim] != Reqd.value()[Dim]) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
       }
-      auto numGroups = groups.size();
-      auto groupsPerThread = numGroups / numParallelThreads;
-      auto remainder = numGroups % numParallelThreads;
-      for (unsigned thread = 0; thread < numParallelThreads; thread++) {
-        futures.emplace_back(tp.schedule_task(
-            [&groups, thread, groupsPerThread, hKernel](size_t threadId) {
-              for (unsigned i = 0; i < groupsPerThread; i++) {
-                auto index = thread * groupsPerThread + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
+      if (auto MaxWG = hKernel->getMaxWGSize();
+          MaxWG && pLocalWorkSize[Dim] > MaxWG.value()[Dim]) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
       }
-
-      // schedule the remaining tasks
-      if (remainder) {
-        futures.emplace_back(
-            tp.schedule_task([&groups, remainder,
-                              scheduled = numParallelThreads * groupsPerThread,
-                              hKernel](size_t threadId) {
-              for (unsigned i = 0; i < remainder; i++) {
-                auto index = scheduled + i;
-                groups[index](threadId, *hKernel);
-              }
-            }));
+    }
+    if (auto MaxLinearWG = hKernel->getMaxLinearWGSize()) {
+      if (TotalNumWIs > MaxLinearWG) {
+        return UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE;
       }
     }
   }
 
-  for (auto &f : futures)
-    f.get();
-#endif // NATIVECPU_USE_OCK
-  // TODO: we should avoid calling clear here by avoiding using push_back
-  // in setKernelArgs.
-  hKernel->_args.clear();
-  hKernel->_localArgInfo.clear();
+  // TODO: add proper error checking
+  native_cpu::NDRDescT ndr(workDim, pGlobalWorkOffset, pGlobalWorkSize,
+                           pLocalWorkSize);
+  // std::function needs a copyable callable
+  auto launch = std::make_shared<const kernel_launch>(hKernel, ndr);
+  command = [&tp, launch]() { launch->run(tp); };
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
+    ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
+    const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
+    const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+
+  // The command runs with the arguments as they are now
+  std::function<void()> command;
+  ur_result_t result = native_cpu::makeKernelLaunch(
+      hQueue->device->tp, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+      pLocalWorkSize, command);
+  if (result != UR_RESULT_SUCCESS) {
+    return result;
+  }
+  return hQueue->enqueue(UR_COMMAND_KERNEL_LAUNCH, numEventsInWaitList,
+                         phEventWaitList, phEvent, std::move(command));
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches) {
+  // There are no queue locks to share, so the launches are made in turn
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    const auto &Launch = pLaunches[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    if (Launch.numArgs) {
+      Result = urKernelSetArgsExp(Launch.hKernel, Launch.numArgs, Launch.pArgs);
+      if (Result != UR_RESULT_SUCCESS) {
+        return Result;
+      }
+    }
+    Result = urEnqueueKernelLaunch(
+        Launch.hQueue, Launch.hKernel, Launch.workDim, Launch.pGlobalWorkOffset,
+        Launch.pGlobalWorkSize, Launch.pLocalWorkSize,
+        Launch.numEventsInWaitList, Launch.phEventWaitList, Launch.phEvent);
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  return hQueue->enqueue(UR_COMMAND_EVENTS_WAIT, numEventsInWaitList,
+                         phEventWaitList, phEvent, []() {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  // Commands run one after the other, so every command is a barrier
+  return hQueue->enqueue(UR_COMMAND_EVENTS_WAIT_WITH_BARRIER,
+                         numEventsInWaitList, phEventWaitList, phEvent,
+                         []() {});
 }
 
 template <bool IsRead>
 static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
-    ur_queue_handle_t, ur_mem_handle_t Buff, bool,
+    ur_queue_handle_t hQueue, ur_mem_handle_t Buff, bool blocking,
     ur_rect_offset_t BufferOffset, ur_rect_offset_t HostOffset,
     ur_rect_region_t region, size_t BufferRowPitch, size_t BufferSlicePitch,
     size_t HostRowPitch, size_t HostSlicePitch,
     typename std::conditional<IsRead, void *, const void *>::type DstMem,
-    uint32_t, const ur_event_handle_t *, ur_event_handle_t *) {
-  // TODO: events, blocking, check other constraints, performance optimizations
-  //       More sharing with level_zero where possible
-
+    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
+    ur_event_handle_t *phEvent, ur_command_t commandType) {
   if (BufferRowPitch == 0)
     BufferRowPitch = region.width;
   if (BufferSlicePitch == 0)
@@ -291,59 +448,57 @@ static inline ur_result_t enqueueMemBufferReadWriteRect_impl(
     HostRowPitch = region.width;
   if (HostSlicePitch == 0)
     HostSlicePitch = HostRowPitch * region.height;
-  for (size_t w = 0; w < region.width; w++)
-    for (size_t h = 0; h < region.height; h++)
-      for (size_t d = 0; d < region.depth; d++) {
-        size_t buff_orign = (d + BufferOffset.z) * BufferSlicePitch +
-                            (h + BufferOffset.y) * BufferRowPitch + w +
-                            BufferOffset.x;
-        size_t host_origin = (d + HostOffset.z) * HostSlicePitch +
-                             (h + HostOffset.y) * HostRowPitch + w +
-                             HostOffset.x;
-        int8_t &buff_mem = ur_cast<int8_t *>(Buff->_mem)[buff_orign];
+  char *BuffMem = Buff->_mem + BufferOffset.z * BufferSlicePitch +
+                 BufferOffset.y * BufferRowPitch + BufferOffset.x;
+  size_t HostOrigin = HostOffset.z * HostSlicePitch +
+                      HostOffset.y * HostRowPitch + HostOffset.x;
+  return hQueue->enqueue(
+      commandType, numEventsInWaitList, phEventWaitList, phEvent,
+      [=, &tp = hQueue->device->tp]() {
         if constexpr (IsRead)
-          ur_cast<int8_t *>(DstMem)[host_origin] = buff_mem;
+          native_cpu::copyRect(tp, ur_cast<char *>(DstMem) + HostOrigin,
+                               BuffMem, region, HostRowPitch, HostSlicePitch,
+                               BufferRowPitch, BufferSlicePitch);
         else
-          buff_mem = ur_cast<const int8_t *>(DstMem)[host_origin];
-      }
-  return UR_RESULT_SUCCESS;
+          native_cpu::copyRect(tp, BuffMem,
+                               ur_cast<const char *>(DstMem) + HostOrigin,
+                               region, BufferRowPitch, BufferSlicePitch,
+                               HostRowPitch, HostSlicePitch);
+      },
+      blocking);
 }
 
-static inline ur_result_t doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr,
-                                      const void *SrcPtr, size_t Size,
-                                      uint32_t numEventsInWaitList,
-                                      const ur_event_handle_t *EventWaitList,
-                                      ur_event_handle_t *Event) {
-  // todo: non-blocking, events, UR integration
-  std::ignore = EventWaitList;
-  std::ignore = Event;
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  if (SrcPtr != DstPtr && Size)
-    memmove(DstPtr, SrcPtr, Size);
-  return UR_RESULT_SUCCESS;
+static inline ur_result_t
+doCopy_impl(ur_queue_handle_t hQueue, void *DstPtr, const void *SrcPtr,
+            size_t Size, uint32_t numEventsInWaitList,
+            const ur_event_handle_t *EventWaitList, ur_event_handle_t *Event,
+            ur_command_t commandType, bool blocking) {
+  return hQueue->enqueue(
+      commandType, numEventsInWaitList, EventWaitList, Event,
+      [=, &tp = hQueue->device->tp]() {
+        native_cpu::copy(tp, DstPtr, SrcPtr, Size);
+      },
+      blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingRead,
     size_t offset, size_t size, void *pDst, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingRead;
-
   void *FromPtr = /*Src*/ hBuffer->_mem + offset;
   return doCopy_impl(hQueue, pDst, FromPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_READ,
+                     blockingRead);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ur_queue_handle_t hQueue, ur_mem_handle_t hBuffer, bool blockingWrite,
     size_t offset, size_t size, const void *pSrc, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = blockingWrite;
-
   void *ToPtr = hBuffer->_mem + offset;
   return doCopy_impl(hQueue, ToPtr, pSrc, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_WRITE,
+                     blockingWrite);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
@@ -356,7 +511,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
   return enqueueMemBufferReadWriteRect_impl<true /*read*/>(
       hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_READ_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
@@ -369,7 +525,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
   return enqueueMemBufferReadWriteRect_impl<false /*write*/>(
       hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
       bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
-      numEventsInWaitList, phEventWaitList, phEvent);
+      numEventsInWaitList, phEventWaitList, phEvent,
+      UR_COMMAND_MEM_BUFFER_WRITE_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
@@ -380,7 +537,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopy(
   const void *SrcPtr = hBufferSrc->_mem + srcOffset;
   void *DstPtr = hBufferDst->_mem + dstOffset;
   return doCopy_impl(hQueue, DstPtr, SrcPtr, size, numEventsInWaitList,
-                     phEventWaitList, phEvent);
+                     phEventWaitList, phEvent, UR_COMMAND_MEM_BUFFER_COPY,
+                     false);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
@@ -394,7 +552,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
       hQueue, hBufferSrc, false /*todo: check blocking*/, srcOrigin,
       /*HostOffset*/ dstOrigin, region, srcRowPitch, srcSlicePitch, dstRowPitch,
       dstSlicePitch, hBufferDst->_mem, numEventsInWaitList, phEventWaitList,
-      phEvent);
+      phEvent, UR_COMMAND_MEM_BUFFER_COPY_RECT);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
@@ -402,22 +560,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferFill(
     size_t patternSize, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
 
   // TODO: error checking
-  // TODO: handle async
   void *startingPtr = hBuffer->_mem + offset;
-  unsigned steps = size / patternSize;
-  for (unsigned i = 0; i < steps; i++) {
-    memcpy(static_cast<int8_t *>(startingPtr) + i * patternSize, pPattern,
-           patternSize);
-  }
-
-  return UR_RESULT_SUCCESS;
+  size_t fillSize = size / patternSize * patternSize;
+  // The pattern only needs to live until the call returns
+  std::vector<int8_t> pattern(static_cast<const int8_t *>(pPattern),
+                              static_cast<const int8_t *>(pPattern) +
+                                  patternSize);
+  return hQueue->enqueue(UR_COMMAND_MEM_BUFFER_FILL, numEventsInWaitList,
+                         phEventWaitList, phEvent,
+                         [&tp = hQueue->device->tp, startingPtr, fillSize,
+                          pattern = std::move(pattern)]() {
+                           native_cpu::fill(tp, startingPtr, pattern.data(),
+                                            pattern.size(), fillSize);
+                         });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemImageRead(
@@ -484,42 +642,31 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemBufferMap(
     ur_map_flags_t mapFlags, size_t offset, size_t size,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent, void **ppRetMap) {
-  std::ignore = hQueue;
-  std::ignore = blockingMap;
   std::ignore = mapFlags;
   std::ignore = size;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
   *ppRetMap = hBuffer->_mem + offset;
 
-  return UR_RESULT_SUCCESS;
+  // Buffers are host memory, mapping them only has to order the command
+  return hQueue->enqueue(UR_COMMAND_MEM_BUFFER_MAP, numEventsInWaitList,
+                         phEventWaitList, phEvent, []() {}, blockingMap);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueMemUnmap(
     ur_queue_handle_t hQueue, ur_mem_handle_t hMem, void *pMappedPtr,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = hMem;
   std::ignore = pMappedPtr;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_MEM_UNMAP, numEventsInWaitList,
+                         phEventWaitList, phEvent, []() {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(ptr, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE)
@@ -528,91 +675,81 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   UR_ASSERT(size % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE)
   // TODO: add check for allocation size once the query is supported
 
-  switch (patternSize) {
-  case 1:
-    memset(ptr, *static_cast<const uint8_t *>(pPattern), size * patternSize);
-    break;
-  case 2: {
-    const auto pattern = *static_cast<const uint16_t *>(pPattern);
-    auto *start = reinterpret_cast<uint16_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint16_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 4: {
-    const auto pattern = *static_cast<const uint32_t *>(pPattern);
-    auto *start = reinterpret_cast<uint32_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint32_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  case 8: {
-    const auto pattern = *static_cast<const uint64_t *>(pPattern);
-    auto *start = reinterpret_cast<uint64_t *>(ptr);
-    auto *end =
-        reinterpret_cast<uint64_t *>(reinterpret_cast<uint8_t *>(ptr) + size);
-    std::fill(start, end, pattern);
-    break;
-  }
-  default: {
-    for (unsigned int step{0}; step < size; step += patternSize) {
-      auto *dest =
-          reinterpret_cast<void *>(reinterpret_cast<uint8_t *>(ptr) + step);
-      memcpy(dest, pPattern, patternSize);
-    }
-  }
-  }
-  return UR_RESULT_SUCCESS;
+  // The pattern only needs to live until the call returns
+  std::vector<uint8_t> patternBytes(static_cast<const uint8_t *>(pPattern),
+                                    static_cast<const uint8_t *>(pPattern) +
+                                        patternSize);
+  auto fill = [&tp = hQueue->device->tp, ptr, size,
+               patternBytes = std::move(patternBytes)]() {
+    native_cpu::fill(tp, ptr, patternBytes.data(), patternBytes.size(), size);
+  };
+  return hQueue->enqueue(UR_COMMAND_USM_FILL, numEventsInWaitList,
+                         phEventWaitList, phEvent, std::move(fill));
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ur_queue_handle_t hQueue, bool blocking, void *pDst, const void *pSrc,
     size_t size, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
   UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
   UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  memcpy(pDst, pSrc, size);
+  return hQueue->enqueue(
+      UR_COMMAND_USM_MEMCPY, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp = hQueue->device->tp, pDst, pSrc, size]() {
+        native_cpu::copy(tp, pDst, pSrc, size);
+      },
+      blocking);
+}
 
-  return UR_RESULT_SUCCESS;
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
+  UR_ASSERT(ppDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(ppSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSizes, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // The arrays are the caller's again once the enqueue returned
+  std::vector<void *> Dsts(ppDst, ppDst + numCopies);
+  std::vector<const void *> Srcs(ppSrc, ppSrc + numCopies);
+  std::vector<size_t> Sizes(pSizes, pSizes + numCopies);
+  return hQueue->enqueue(
+      UR_COMMAND_USM_MEMCPY_BATCH_EXP, numEventsInWaitList, phEventWaitList,
+      phEvent,
+      [&tp = hQueue->device->tp, Dsts = std::move(Dsts),
+       Srcs = std::move(Srcs), Sizes = std::move(Sizes)]() {
+        for (size_t i = 0; i < Dsts.size(); i++) {
+          native_cpu::copy(tp, Dsts[i], Srcs[i], Sizes[i]);
+        }
+      },
+      blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, const void *pMem, size_t size,
     ur_usm_migration_flags_t flags, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = flags;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM prefetch
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_USM_PREFETCH, numEventsInWaitList,
+                         phEventWaitList, phEvent, []() {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEnqueueUSMAdvise(ur_queue_handle_t hQueue, const void *pMem, size_t size,
                    ur_usm_advice_flags_t advice, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
   std::ignore = pMem;
   std::ignore = size;
   std::ignore = advice;
-  std::ignore = phEvent;
 
   // TODO: properly implement USM advise
-  return UR_RESULT_SUCCESS;
+  return hQueue->enqueue(UR_COMMAND_USM_ADVISE, 0, nullptr, phEvent, []() {});
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
@@ -620,18 +757,23 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill2D(
     const void *pPattern, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = pMem;
-  std::ignore = pitch;
-  std::ignore = patternSize;
-  std::ignore = pPattern;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(pMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pPattern, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(patternSize != 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(width % patternSize == 0, UR_RESULT_ERROR_INVALID_SIZE);
+  UR_ASSERT(pitch >= width, UR_RESULT_ERROR_INVALID_SIZE);
+
+  // The pattern only needs to live until the call returns
+  std::vector<uint8_t> patternBytes(static_cast<const uint8_t *>(pPattern),
+                                    static_cast<const uint8_t *>(pPattern) +
+                                        patternSize);
+  return hQueue->enqueue(
+      UR_COMMAND_USM_FILL_2D, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp = hQueue->device->tp, pMem, pitch, width, height,
+       patternBytes = std::move(patternBytes)]() {
+        native_cpu::fill2D(tp, pMem, pitch, patternBytes.data(),
+                           patternBytes.size(), width, height);
+      });
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
@@ -639,19 +781,20 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     const void *pSrc, size_t srcPitch, size_t width, size_t height,
     uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
     ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = pDst;
-  std::ignore = dstPitch;
-  std::ignore = pSrc;
-  std::ignore = srcPitch;
-  std::ignore = width;
-  std::ignore = height;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
-
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(pDst, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(pSrc, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+  UR_ASSERT(dstPitch >= width && srcPitch >= width,
+            UR_RESULT_ERROR_INVALID_SIZE);
+
+  ur_rect_region_t region{width, height, 1};
+  return hQueue->enqueue(
+      UR_COMMAND_USM_MEMCPY_2D, numEventsInWaitList, phEventWaitList, phEvent,
+      [&tp = hQueue->device->tp, pDst, dstPitch, pSrc, srcPitch, region]() {
+        native_cpu::copyRect(tp, pDst, pSrc, region, dstPitch,
+                             dstPitch * region.height, srcPitch,
+                             srcPitch * region.height);
+      },
+      blocking);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
@@ -735,3 +878,28 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ur_exp_host_task_function_t pfnHostTask,
+    void *pUserData, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+  UR_ASSERT(hQueue, UR_RESULT_ERROR_INVALID_QUEUE);
+  UR_ASSERT(pfnHostTask, UR_RESULT_ERROR_INVALID_NULL_POINTER);
+
+  // Run by the executor of the queue, in order with its other commands
+  return hQueue->enqueue(UR_COMMAND_ENQUEUE_HOST_TASK_EXP, numEventsInWaitList,
+                         phEventWaitList, phEvent,
+                         [pfnHostTask, pUserData]() { pfnHostTask(pUserData); });
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
@@ -0,0 +1,29 @@
+//===----------- enqueue.hpp - Native CPU Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <functional>
+
+#include <ur_api.h>
+
+#include "threadpool.hpp"
+
+namespace native_cpu {
+
+// Checks a launch of hKernel and sets command to one running it on tp, with
+// the arguments hKernel has now. The command keeps the kernel retained and can
+// run any number of times, from outside the workers of tp.
+ur_result_t makeKernelLaunch(threadpool_t &tp, ur_kernel_handle_t hKernel,
+                             uint32_t workDim, const size_t *pGlobalWorkOffset,
+                             const size_t *pGlobalWorkSize,
+                             const size_t *pLocalWorkSize,
+                             std::function<void()> &command);
+
+} // namespace native_cpu
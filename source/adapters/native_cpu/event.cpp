@@ -8,53 +8,160 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <chrono>
+
 #include "ur_api.h"
 
 #include "common.hpp"
+#include "event.hpp"
+#include "queue.hpp"
+
+namespace {
+// Same clock as urDeviceGetGlobalTimestamps
+uint64_t getTimestamp() {
+  using namespace std::chrono;
+  return duration_cast<nanoseconds>(steady_clock::now().time_since_epoch())
+      .count();
+}
+} // namespace
+
+ur_event_handle_t_::ur_event_handle_t_(ur_queue_handle_t queue,
+                                       ur_command_t commandType)
+    : queue(queue), context(queue->context), commandType(commandType),
+      profilingEnabled(queue->isProfilingEnabled() ||
+                       commandType == UR_COMMAND_TIMESTAMP_RECORDING_EXP),
+      queuedTime(getTimestamp()) {}
+
+void ur_event_handle_t_::wait() {
+  std::unique_lock<std::mutex> lock(mutex);
+  completed.wait(lock, [this]() { return status == UR_EVENT_STATUS_COMPLETE; });
+}
+
+void ur_event_handle_t_::start() {
+  std::unique_lock<std::mutex> lock(mutex);
+  startTime = getTimestamp();
+  status = UR_EVENT_STATUS_RUNNING;
+  runCallbacks(lock);
+}
+
+void ur_event_handle_t_::complete() {
+  std::unique_lock<std::mutex> lock(mutex);
+  endTime = getTimestamp();
+  status = UR_EVENT_STATUS_COMPLETE;
+  completed.notify_all();
+  runCallbacks(lock);
+}
+
+void ur_event_handle_t_::addCallback(ur_execution_info_t execStatus,
+                                     ur_event_callback_t pfnNotify,
+                                     void *pUserData) {
+  std::unique_lock<std::mutex> lock(mutex);
+  callbacks.push_back({execStatus, pfnNotify, pUserData});
+  runCallbacks(lock);
+}
+
+void ur_event_handle_t_::runCallbacks(std::unique_lock<std::mutex> &lock) {
+  // Statuses are numbered from complete to queued
+  std::vector<callback> reached;
+  for (auto it = callbacks.begin(); it != callbacks.end();) {
+    if (static_cast<uint32_t>(it->execStatus) >=
+        static_cast<uint32_t>(status)) {
+      reached.push_back(*it);
+      it = callbacks.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  if (reached.empty()) {
+    return;
+  }
+  auto execStatus = static_cast<ur_execution_info_t>(status);
+  lock.unlock();
+  for (auto &cb : reached) {
+    cb.pfnNotify(this, execStatus, cb.pUserData);
+  }
+  lock.lock();
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
-
-  DIE_NO_IMPLEMENTATION;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_EVENT_INFO_COMMAND_QUEUE:
+    return ReturnValue(hEvent->getQueue());
+  case UR_EVENT_INFO_CONTEXT:
+    return ReturnValue(hEvent->getContext());
+  case UR_EVENT_INFO_COMMAND_TYPE:
+    return ReturnValue(hEvent->getCommandType());
+  case UR_EVENT_INFO_COMMAND_EXECUTION_STATUS:
+    return ReturnValue(hEvent->getExecutionStatus());
+  case UR_EVENT_INFO_REFERENCE_COUNT:
+    return ReturnValue(hEvent->getReferenceCount());
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetProfilingInfo(
     ur_event_handle_t hEvent, ur_profiling_info_t propName, size_t propSize,
     void *pPropValue, size_t *pPropSizeRet) {
-  std::ignore = hEvent;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
-
-  DIE_NO_IMPLEMENTATION;
+  UR_ASSERT(hEvent->isProfilingEnabled(),
+            UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE);
+
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_PROFILING_INFO_COMMAND_QUEUED:
+  case UR_PROFILING_INFO_COMMAND_SUBMIT:
+    // Commands are submitted to the executor as they are queued
+    return ReturnValue(hEvent->getQueuedTime());
+  case UR_PROFILING_INFO_COMMAND_START:
+  case UR_PROFILING_INFO_COMMAND_END:
+  case UR_PROFILING_INFO_COMMAND_COMPLETE:
+    UR_ASSERT(hEvent->isComplete(),
+              UR_RESULT_ERROR_PROFILING_INFO_NOT_AVAILABLE);
+    return ReturnValue(propName == UR_PROFILING_INFO_COMMAND_START
+                           ? hEvent->getStartTime()
+                           : hEvent->getEndTime());
+  default:
+    break;
+  }
+
+  return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
-  std::ignore = numEvents;
-  std::ignore = phEventWaitList;
-  // TODO: currently we do everything synchronously so this is a no-op
+  for (uint32_t i = 0; i < numEvents; i++) {
+    phEventWaitList[i]->wait();
+  }
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventWaitAnyExp(uint32_t numEvents, const ur_event_handle_t *phEventWaitList,
+                  uint32_t *pIndex) {
+  auto QueryFunc = [&](uint32_t i, bool &Completed) -> ur_result_t {
+    Completed = phEventWaitList[i]->isComplete();
+    return UR_RESULT_SUCCESS;
+  };
+  return ur::waitAnyEvent(numEvents, QueryFunc, *pIndex);
+}
 
-  DIE_NO_IMPLEMENTATION;
+UR_APIEXPORT ur_result_t UR_APICALL urEventRetain(ur_event_handle_t hEvent) {
+  hEvent->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventRelease(ur_event_handle_t hEvent) {
-  std::ignore = hEvent;
-  DIE_NO_IMPLEMENTATION;
+  decrementOrDelete(hEvent);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetNativeHandle(
@@ -80,22 +187,32 @@ UR_APIEXPORT ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 UR_APIEXPORT ur_result_t UR_APICALL
 urEventSetCallback(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
                    ur_event_callback_t pfnNotify, void *pUserData) {
-  std::ignore = hEvent;
-  std::ignore = execStatus;
-  std::ignore = pfnNotify;
-  std::ignore = pUserData;
-
-  DIE_NO_IMPLEMENTATION;
+  hEvent->addCallback(execStatus, pfnNotify, pUserData);
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ur_queue_handle_t hQueue, bool blocking, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
-  std::ignore = hQueue;
-  std::ignore = blocking;
-  std::ignore = numEventsInWaitList;
-  std::ignore = phEventWaitList;
-  std::ignore = phEvent;
+  // The event's timestamps are the recording
+  return hQueue->enqueue(UR_COMMAND_TIMESTAMP_RECORDING_EXP,
+                         numEventsInWaitList, phEventWaitList, phEvent, []() {},
+                         blocking);
+}
 
-  DIE_NO_IMPLEMENTATION;
+UR_APIEXPORT ur_result_t UR_APICALL urEventCreateIPCExp(ur_context_handle_t,
+                                                        ur_device_handle_t,
+                                                        ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventGetIPCHandleExp(ur_event_handle_t, ur_exp_ipc_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t, ur_device_handle_t, const ur_exp_ipc_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
@@ -0,0 +1,97 @@
+//===----------- event.hpp - Native CPU Adapter ---------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <condition_variable>
+#include <mutex>
+#include <vector>
+
+#include "common.hpp"
+#include "ur_api.h"
+
+// Event of a command run by the executor of its queue. The event doesn't
+// retain the queue, whose destruction waits for the commands to complete, as
+// the executor releasing the last event would otherwise destroy the queue
+// from the executor thread.
+struct ur_event_handle_t_ : RefCounted {
+  ur_event_handle_t_(ur_queue_handle_t queue, ur_command_t commandType);
+
+  // Blocks until the command has completed
+  void wait();
+
+  // Called by the executor of the queue around the command
+  void start();
+  void complete();
+
+  bool isComplete() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return status == UR_EVENT_STATUS_COMPLETE;
+  }
+
+  ur_event_status_t getExecutionStatus() {
+    std::lock_guard<std::mutex> lock(mutex);
+    return status;
+  }
+
+  // Calls pfnNotify once the command reaches execStatus, immediately if it
+  // already did
+  void addCallback(ur_execution_info_t execStatus,
+                   ur_event_callback_t pfnNotify, void *pUserData);
+
+  ur_queue_handle_t getQueue() const noexcept { return queue; }
+
+  ur_context_handle_t getContext() const noexcept { return context; }
+
+  ur_command_t getCommandType() const noexcept { return commandType; }
+
+  bool isProfilingEnabled() const noexcept { return profilingEnabled; }
+
+  uint64_t getQueuedTime() const noexcept { return queuedTime; }
+
+  // Only valid once the command has started, respectively completed
+  uint64_t getStartTime() const noexcept { return startTime; }
+  uint64_t getEndTime() const noexcept { return endTime; }
+
+private:
+  struct callback {
+    ur_execution_info_t execStatus;
+    ur_event_callback_t pfnNotify;
+    void *pUserData;
+  };
+
+  // Calls and removes the callbacks for statuses up to status, with the
+  // mutex held by lock, which is released while they run
+  void runCallbacks(std::unique_lock<std::mutex> &lock);
+
+  const ur_queue_handle_t queue;
+  const ur_context_handle_t context;
+  const ur_command_t commandType;
+  const bool profilingEnabled;
+
+  std::mutex mutex;
+  std::condition_variable completed;
+  ur_event_status_t status = UR_EVENT_STATUS_SUBMITTED;
+  std::vector<callback> callbacks;
+
+  uint64_t queuedTime;
+  uint64_t startTime = 0;
+  uint64_t endTime = 0;
+};
+
+// Describes the events of wait lists to ur::normalizeEventWaitList, which then
+// drops duplicates and completed events. Events aren't numbered in the order
+// their queues run them, so none are collapsed.
+struct ur_event_wait_traits_ {
+  static const void *sequence(ur_event_handle_t) { return nullptr; }
+  static uint64_t order(ur_event_handle_t) { return 0; }
+  static bool isCompleted(ur_event_handle_t event) {
+    return event->isComplete();
+  }
+};
@@ -0,0 +1,182 @@
+//===----------- huge_pages.cpp - Native CPU Adapter ----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <cstdint>
+#include <cstdlib>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+#include "huge_pages.hpp"
+#include "ur_util.hpp"
+
+namespace native_cpu {
+
+namespace {
+constexpr size_t Size2M = HugePagesAlignment;
+constexpr size_t Size1G = size_t{1} << 30;
+
+// Runs in a static initializer, so an invalid value falls back to the default
+// rather than throwing
+size_t getSizeEnv(const char *Name, size_t Default) {
+  return getenv_to_unsigned(Name).value_or(Default);
+}
+
+size_t pageSize(huge_pages_config::mode_t Mode) {
+  return Mode == huge_pages_config::Explicit1G ? Size1G : Size2M;
+}
+
+// Freed mappings by size, reused before mapping new ones. Pages of reused
+// mappings are already faulted in, so their first touch is cheap as well.
+struct mapping_cache {
+  std::mutex Mutex;
+  std::unordered_map<size_t, std::vector<void *>> Free;
+  size_t CachedSize = 0;
+
+  void *take(size_t MappedSize) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    auto It = Free.find(MappedSize);
+    if (It == Free.end() || It->second.empty()) {
+      return nullptr;
+    }
+    void *Ptr = It->second.back();
+    It->second.pop_back();
+    CachedSize -= MappedSize;
+    return Ptr;
+  }
+
+  bool put(void *Ptr, size_t MappedSize) {
+    std::lock_guard<std::mutex> Lock(Mutex);
+    if (CachedSize + MappedSize > getHugePagesConfig().CacheSize) {
+      return false;
+    }
+    Free[MappedSize].push_back(Ptr);
+    CachedSize += MappedSize;
+    return true;
+  }
+};
+
+mapping_cache &getCache() {
+  // Leaked, so that buffers freed by static destructors still find it
+  static auto *Cache = new mapping_cache;
+  return *Cache;
+}
+
+#ifdef __linux__
+// Transparent huge pages only back the 2MB aligned ranges of a mapping, so
+// the mapping is made larger and trimmed down to an aligned one.
+void *mapTransparent(size_t MappedSize) {
+  size_t Size = MappedSize + Size2M;
+  void *Ptr = mmap(nullptr, Size, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+  if (Ptr == MAP_FAILED) {
+    return nullptr;
+  }
+  auto Start = reinterpret_cast<uintptr_t>(Ptr);
+  auto Aligned = (Start + Size2M - 1) & ~(Size2M - 1);
+  if (Aligned != Start) {
+    munmap(Ptr, Aligned - Start);
+  }
+  size_t Tail = Start + Size - (Aligned + MappedSize);
+  if (Tail) {
+    munmap(reinterpret_cast<void *>(Aligned + MappedSize), Tail);
+  }
+  madvise(reinterpret_cast<void *>(Aligned), MappedSize, MADV_HUGEPAGE);
+  return reinterpret_cast<void *>(Aligned);
+}
+
+void *mapExplicit(size_t MappedSize, huge_pages_config::mode_t Mode) {
+#if defined(MAP_HUGETLB) && defined(MAP_HUGE_SHIFT)
+  int PageShift = Mode == huge_pages_config::Explicit1G ? 30 : 21;
+  void *Ptr = mmap(nullptr, MappedSize, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB |
+                       (PageShift << MAP_HUGE_SHIFT),
+                   -1, 0);
+  return Ptr == MAP_FAILED ? nullptr : Ptr;
+#else
+  (void)MappedSize;
+  (void)Mode;
+  return nullptr;
+#endif
+}
+#endif // __linux__
+} // namespace
+
+const huge_pages_config &getHugePagesConfig() {
+  static const huge_pages_config Config = [] {
+    huge_pages_config Config;
+#ifdef __linux__
+    const char *Mode = std::getenv("SYCL_NATIVE_CPU_HUGE_PAGES");
+    std::string ModeStr = Mode ? Mode : "";
+    if (ModeStr == "thp") {
+      Config.Mode = huge_pages_config::Transparent;
+    } else if (ModeStr == "2M") {
+      Config.Mode = huge_pages_config::Explicit2M;
+    } else if (ModeStr == "1G") {
+      Config.Mode = huge_pages_config::Explicit1G;
+    }
+#endif
+    Config.Threshold =
+        getSizeEnv("SYCL_NATIVE_CPU_HUGE_PAGES_THRESHOLD", Config.Threshold);
+    Config.CacheSize =
+        getSizeEnv("SYCL_NATIVE_CPU_HUGE_PAGES_CACHE", Config.CacheSize);
+    return Config;
+  }();
+  return Config;
+}
+
+bool useHugePages(size_t Size) {
+  const auto &Config = getHugePagesConfig();
+  return Config.Mode != huge_pages_config::Off && Size >= Config.Threshold;
+}
+
+void *allocHugePages(size_t Size, size_t &MappedSize) {
+  MappedSize = 0;
+  if (!useHugePages(Size)) {
+    return nullptr;
+  }
+#ifdef __linux__
+  auto Mode = getHugePagesConfig().Mode;
+  size_t Page = pageSize(Mode);
+  MappedSize = (Size + Page - 1) & ~(Page - 1);
+  if (void *Ptr = getCache().take(MappedSize)) {
+    return Ptr;
+  }
+  void *Ptr = nullptr;
+  if (Mode != huge_pages_config::Transparent) {
+    Ptr = mapExplicit(MappedSize, Mode);
+  }
+  if (!Ptr) {
+    Ptr = mapTransparent(MappedSize);
+  }
+  if (!Ptr) {
+    MappedSize = 0;
+  }
+  return Ptr;
+#else
+  return nullptr;
+#endif
+}
+
+void freeHugePages(void *Ptr, size_t MappedSize) {
+  if (getCache().put(Ptr, MappedSize)) {
+    return;
+  }
+#ifdef __linux__
+  munmap(Ptr, MappedSize);
+#endif
+}
+
+} // namespace native_cpu
@@ -0,0 +1,53 @@
+//===----------- huge_pages.hpp - Native CPU Adapter ----------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#pragma once
+
+#include <cstddef>
+
+namespace native_cpu {
+
+// Large USM and buffer allocations can be backed by huge pages, which cut the
+// TLB misses of kernels streaming through them. SYCL_NATIVE_CPU_HUGE_PAGES
+// selects how:
+//   thp  transparent huge pages, requested with MADV_HUGEPAGE
+//   2M   explicit 2MB pages from the hugetlb pool
+//   1G   explicit 1GB pages from the hugetlb pool
+// Explicit pages fall back to transparent ones when the pool runs out. Only
+// allocations of at least SYCL_NATIVE_CPU_HUGE_PAGES_THRESHOLD bytes (2MB by
+// default) are backed this way. Freed mappings are kept for reuse by the next
+// allocations of the same size, up to SYCL_NATIVE_CPU_HUGE_PAGES_CACHE bytes
+// (1GB by default). Only supported on Linux.
+struct huge_pages_config {
+  enum mode_t { Off, Transparent, Explicit2M, Explicit1G };
+  mode_t Mode = Off;
+  size_t Threshold = size_t{2} << 20;
+  size_t CacheSize = size_t{1} << 30;
+};
+
+const huge_pages_config &getHugePagesConfig();
+
+// Alignment of the memory from allocHugePages
+constexpr size_t HugePagesAlignment = size_t{2} << 20;
+
+// Whether allocations of Size bytes are backed by huge pages
+bool useHugePages(size_t Size);
+
+// Maps at least Size bytes backed by huge pages, aligned to the huge page
+// size, and sets MappedSize to the size to unmap them with. Returns nullptr,
+// with a MappedSize of 0, if huge pages are off, Size is below the threshold
+// or the mapping failed, in which case callers fall back to their regular
+// allocation.
+void *allocHugePages(size_t Size, size_t &MappedSize);
+
+// Unmaps, or caches for reuse, memory from allocHugePages.
+void freeHugePages(void *Ptr, size_t MappedSize);
+
+} // namespace native_cpu
@@ -60,17 +60,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgValue(
     const ur_kernel_arg_value_properties_t *pProperties,
     const void *pArgValue) {
   // Todo: error checking
-  // Todo: I think that the opencl spec (and therefore the pi spec mandates that
-  // arg is copied (this is why it is defined as const void*, I guess we should
-  // do it
-  // TODO: can args arrive out of order?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(argSize, UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE);
 
-  hKernel->_args.emplace_back(const_cast<void *>(pArgValue));
+  hKernel->setArgValue(argIndex, argSize, pArgValue);
 
   return UR_RESULT_SUCCESS;
 }
@@ -79,10 +74,9 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgLocal(
     ur_kernel_handle_t hKernel, uint32_t argIndex, size_t argSize,
     const ur_kernel_arg_local_properties_t *pProperties) {
   std::ignore = pProperties;
-  // emplace a placeholder kernel arg, gets replaced with a pointer to the
-  // memory pool before enqueueing the kernel.
-  hKernel->_args.emplace_back(nullptr);
-  hKernel->_localArgInfo.emplace_back(argIndex, argSize);
+  // the argument gets a pointer to the local memory of the thread running
+  // each work-group
+  hKernel->setArgLocal(argIndex, argSize);
   return UR_RESULT_SUCCESS;
 }
 
@@ -221,14 +215,12 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgPointer(ur_kernel_handle_t hKernel, uint32_t argIndex,
                       const ur_kernel_arg_pointer_properties_t *pProperties,
                       const void *pArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
   UR_ASSERT(pArgValue, UR_RESULT_ERROR_INVALID_NULL_POINTER);
 
-  hKernel->_args.push_back(const_cast<void *>(pArgValue));
+  hKernel->setArgPointer(argIndex, const_cast<void *>(pArgValue));
 
   return UR_RESULT_SUCCESS;
 }
@@ -262,8 +254,6 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
                      const ur_kernel_arg_mem_obj_properties_t *pProperties,
                      ur_mem_handle_t hArgValue) {
-  // TODO: out_of_order args?
-  std::ignore = argIndex;
   std::ignore = pProperties;
 
   UR_ASSERT(hKernel, UR_RESULT_ERROR_INVALID_NULL_HANDLE);
@@ -271,13 +261,53 @@ urKernelSetArgMemObj(ur_kernel_handle_t hKernel, uint32_t argIndex,
   // Taken from ur/adapters/cuda/kernel.cpp
   // zero-sized buffers are expected to be null.
   if (hArgValue == nullptr) {
-    hKernel->_args.emplace_back(nullptr);
+    hKernel->setArgPointer(argIndex, nullptr);
     return UR_RESULT_SUCCESS;
   }
 
-  hKernel->_args.emplace_back(hArgValue->_mem);
+  hKernel->setArgPointer(argIndex, hArgValue->_mem);
   return UR_RESULT_SUCCESS;
 }
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                   const ur_exp_kernel_arg_t *pArgs) {
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const auto &Arg = pArgs[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      Result = urKernelSetArgValue(hKernel, Arg.index, Arg.size, nullptr,
+                                   Arg.value.value);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      Result =
+          urKernelSetArgPointer(hKernel, Arg.index, nullptr, Arg.value.pointer);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      ur_kernel_arg_mem_obj_properties_t Properties = {
+          UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+          Arg.value.memObjTuple.flags ? Arg.value.memObjTuple.flags
+                                      : UR_MEM_FLAG_READ_WRITE};
+      Result = urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                    Arg.value.memObjTuple.hMem);
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      Result = urKernelSetArgLocal(hKernel, Arg.index, Arg.size, nullptr);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      // Samplers aren't implemented by this adapter
+      return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     ur_kernel_handle_t hKernel, uint32_t count,
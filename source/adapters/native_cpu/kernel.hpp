@@ -12,6 +12,10 @@
 #include "nativecpu_state.hpp"
 #include "program.hpp"
 #include <array>
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
 #include <ur_api.h>
 #include <utility>
 
@@ -37,26 +41,24 @@ struct local_arg_info_t {
       : argIndex(argIndex), argSize(argSize) {}
 };
 
+namespace native_cpu {
+
+// Immutable arguments of one launch. Value arguments point into values, and
+// local arguments are given memory by the threads running the work-groups.
+struct launch_args {
+  std::vector<NativeCPUArgDesc> args;
+  std::vector<local_arg_info_t> localArgs;
+  std::vector<char> values;
+};
+
+} // namespace native_cpu
+
 struct ur_kernel_handle_t_ : RefCounted {
 
   ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
                       nativecpu_task_t subhandler)
       : hProgram(hProgram), _name{name}, _subhandler{std::move(subhandler)} {}
 
-  ur_kernel_handle_t_(const ur_kernel_handle_t_ &other)
-      : hProgram(other.hProgram), _name(other._name),
-        _subhandler(other._subhandler), _args(other._args),
-        _localArgInfo(other._localArgInfo), _localMemPool(other._localMemPool),
-        _localMemPoolSize(other._localMemPoolSize),
-        ReqdWGSize(other.ReqdWGSize) {
-    incrementReferenceCount();
-  }
-
-  ~ur_kernel_handle_t_() {
-    if (decrementReferenceCount() == 0) {
-      free(_localMemPool);
-    }
-  }
   ur_kernel_handle_t_(ur_program_handle_t hProgram, const char *name,
                       nativecpu_task_t subhandler,
                       std::optional<native_cpu::WGSize_t> ReqdWGSize,
@@ -69,8 +71,6 @@ struct ur_kernel_handle_t_ : RefCounted {
   ur_program_handle_t hProgram;
   std::string _name;
   nativecpu_task_t _subhandler;
-  std::vector<native_cpu::NativeCPUArgDesc> _args;
-  std::vector<local_arg_info_t> _localArgInfo;
 
   std::optional<native_cpu::WGSize_t> getReqdWGSize() const {
     return ReqdWGSize;
@@ -80,35 +80,111 @@ struct ur_kernel_handle_t_ : RefCounted {
 
   std::optional<uint64_t> getMaxLinearWGSize() const { return MaxLinearWGSize; }
 
-  void updateMemPool(size_t numParallelThreads) {
-    // compute requested size.
-    size_t reqSize = 0;
-    for (auto &entry : _localArgInfo) {
-      reqSize += entry.argSize * numParallelThreads;
+  // The arguments stay set until they are set again, values being copied, so
+  // that launches can run after the caller's copies are gone
+  void setArgValue(uint32_t argIndex, size_t argSize, const void *pArgValue) {
+    auto &arg = getArg(argIndex);
+    auto bytes = static_cast<const char *>(pArgValue);
+    arg.value.assign(bytes, bytes + argSize);
+    arg.kind = arg_t::value_arg;
+  }
+
+  // Pointers are passed as they are
+  void setArgPointer(uint32_t argIndex, void *ptr) {
+    auto &arg = getArg(argIndex);
+    arg.ptr = ptr;
+    arg.kind = arg_t::pointer_arg;
+  }
+
+  void setArgLocal(uint32_t argIndex, size_t argSize) {
+    auto &arg = getArg(argIndex);
+    arg.localSize = argSize;
+    arg.kind = arg_t::local_arg;
+  }
+
+  // Returns the arguments for a launch, which must be given back to
+  // releaseLaunchArgs once it has run. These are recycled, so that launches
+  // don't allocate once the previous ones have run.
+  native_cpu::launch_args *acquireLaunchArgs() {
+    std::unique_ptr<native_cpu::launch_args> launch;
+    {
+      std::lock_guard<std::mutex> lock(_launchArgsMutex);
+      if (!_freeLaunchArgs.empty()) {
+        launch = std::move(_freeLaunchArgs.back());
+        _freeLaunchArgs.pop_back();
+      }
     }
-    if (reqSize == 0 || reqSize == _localMemPoolSize) {
-      return;
+    if (!launch) {
+      launch = std::make_unique<native_cpu::launch_args>();
     }
-    // realloc handles nullptr case
-    _localMemPool = (char *)realloc(_localMemPool, reqSize);
-    _localMemPoolSize = reqSize;
-  }
 
-  // To be called before executing a work group
-  void handleLocalArgs(size_t numParallelThread, size_t threadId) {
-    // For each local argument we have size*numthreads
+    // Values are aligned as allocations are, and only pointed to once all
+    // are copied, as values grows
+    constexpr size_t align = alignof(std::max_align_t);
+    launch->args.clear();
+    launch->localArgs.clear();
+    launch->values.clear();
+    for (auto &arg : _argSlots) {
+      if (arg.kind == arg_t::value_arg) {
+        launch->values.resize((launch->values.size() + align - 1) &
+                              ~(align - 1));
+        launch->values.insert(launch->values.end(), arg.value.begin(),
+                              arg.value.end());
+      }
+    }
     size_t offset = 0;
-    for (auto &entry : _localArgInfo) {
-      _args[entry.argIndex].MPtr =
-          _localMemPool + offset + (entry.argSize * threadId);
-      // update offset in the memory pool
-      offset += entry.argSize * numParallelThread;
+    for (uint32_t i = 0; i < _argSlots.size(); i++) {
+      auto &arg = _argSlots[i];
+      if (arg.kind == arg_t::value_arg) {
+        offset = (offset + align - 1) & ~(align - 1);
+        launch->args.emplace_back(launch->values.data() + offset);
+        offset += arg.value.size();
+      } else {
+        launch->args.emplace_back(arg.ptr);
+        if (arg.kind == arg_t::local_arg) {
+          launch->localArgs.emplace_back(i, arg.localSize);
+        }
+      }
     }
+    return launch.release();
+  }
+
+  void releaseLaunchArgs(native_cpu::launch_args *launch) {
+    std::lock_guard<std::mutex> lock(_launchArgsMutex);
+    _freeLaunchArgs.emplace_back(launch);
+  }
+
+  // Estimate of the time a work-group takes on one thread, averaged over the
+  // timed launches, 0 until one has been
+  uint64_t getWorkGroupNs() const {
+    return _workGroupNs.load(std::memory_order_relaxed);
+  }
+
+  void recordWorkGroupNs(uint64_t ns) {
+    uint64_t average = _workGroupNs.load(std::memory_order_relaxed);
+    _workGroupNs.store(average ? (3 * average + ns) / 4 : ns,
+                       std::memory_order_relaxed);
   }
 
 private:
-  char *_localMemPool = nullptr;
-  size_t _localMemPoolSize = 0;
+  struct arg_t {
+    enum { pointer_arg, value_arg, local_arg } kind = pointer_arg;
+    void *ptr = nullptr;
+    std::vector<char> value;
+    size_t localSize = 0;
+  };
+
+  arg_t &getArg(uint32_t argIndex) {
+    if (argIndex >= _argSlots.size()) {
+      _argSlots.resize(argIndex + 1);
+    }
+    return _argSlots[argIndex];
+  }
+
+  std::vector<arg_t> _argSlots;
+  std::mutex _launchArgsMutex;
+  std::vector<std::unique_ptr<native_cpu::launch_args>> _freeLaunchArgs;
+  std::atomic<uint64_t> _workGroupNs{0};
   std::optional<native_cpu::WGSize_t> ReqdWGSize = std::nullopt;
   std::optional<native_cpu::WGSize_t> MaxWGSize = std::nullopt;
   std::optional<uint64_t> MaxLinearWGSize = std::nullopt;
@@ -0,0 +1,189 @@
+//===----------- memops.cpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <algorithm>
+#include <cstring>
+
+#include "memops.hpp"
+
+namespace {
+
+// Below this, splitting an operation costs more than it gains
+constexpr size_t ParallelThreshold = 1 << 20;
+// Bytes of a contiguous operation a worker takes at a time
+constexpr size_t ChunkSize = 64 * 1024;
+// Bytes of whole patterns replicated for the fills, at most
+constexpr size_t BlockSize = 4096;
+
+bool isParallel(native_cpu::threadpool_t &tp, size_t size) {
+  return size >= ParallelThreshold && tp.num_threads() > 1;
+}
+
+// Calls f(begin, end) for byte ranges covering [0, size), which start at
+// multiples of chunkSize
+template <typename F>
+void forChunks(native_cpu::threadpool_t &tp, size_t size, size_t chunkSize,
+               F &&f) {
+  if (!isParallel(tp, size)) {
+    f(size_t(0), size);
+    return;
+  }
+  tp.parallel_for((size + chunkSize - 1) / chunkSize,
+                  [&](size_t, size_t begin, size_t end) {
+                    f(begin * chunkSize, std::min(end * chunkSize, size));
+                  });
+}
+
+// Calls f(begin, end) for row ranges covering [0, numRows)
+template <typename F>
+void forRows(native_cpu::threadpool_t &tp, size_t numRows, size_t rowSize,
+             F &&f) {
+  if (!isParallel(tp, numRows * rowSize)) {
+    f(size_t(0), numRows);
+    return;
+  }
+  tp.parallel_for(numRows,
+                  [&](size_t, size_t begin, size_t end) { f(begin, end); });
+}
+
+bool isUniform(const void *pattern, size_t patternSize) {
+  auto *bytes = static_cast<const unsigned char *>(pattern);
+  return std::all_of(bytes + 1, bytes + patternSize,
+                     [bytes](unsigned char b) { return b == bytes[0]; });
+}
+
+// The pattern replicated into as many whole copies as fit in BlockSize bytes,
+// so that fills are a memcpy per block instead of one per pattern
+class pattern_block {
+public:
+  pattern_block(const void *pattern, size_t patternSize) {
+    if (patternSize * 2 > BlockSize) {
+      m_data = static_cast<const char *>(pattern);
+      m_size = patternSize;
+      return;
+    }
+    m_size = BlockSize / patternSize * patternSize;
+    std::memcpy(m_storage, pattern, patternSize);
+    for (size_t filled = patternSize; filled < m_size; filled *= 2) {
+      std::memcpy(m_storage + filled, m_storage,
+                  std::min(filled, m_size - filled));
+    }
+    m_data = m_storage;
+  }
+
+  size_t size() const noexcept { return m_size; }
+
+  // Fills size bytes, a multiple of the pattern size
+  void fill(char *dst, size_t size) const {
+    for (size_t offset = 0; offset < size; offset += m_size) {
+      std::memcpy(dst + offset, m_data, std::min(m_size, size - offset));
+    }
+  }
+
+private:
+  alignas(64) char m_storage[BlockSize];
+  const char *m_data;
+  size_t m_size;
+};
+
+} // namespace
+
+namespace native_cpu {
+
+void copy(threadpool_t &tp, void *dst, const void *src, size_t size) {
+  auto *d = static_cast<char *>(dst);
+  auto *s = static_cast<const char *>(src);
+  if (d == s || size == 0) {
+    return;
+  }
+  if (d < s + size && s < d + size) {
+    std::memmove(d, s, size);
+    return;
+  }
+  forChunks(tp, size, ChunkSize, [d, s](size_t begin, size_t end) {
+    std::memcpy(d + begin, s + begin, end - begin);
+  });
+}
+
+void copyRect(threadpool_t &tp, void *dst, const void *src,
+              const ur_rect_region_t &region, size_t dstRowPitch,
+              size_t dstSlicePitch, size_t srcRowPitch, size_t srcSlicePitch) {
+  const size_t width = region.width;
+  const size_t height = region.height;
+  const size_t numRows = height * region.depth;
+  if (width == 0 || numRows == 0) {
+    return;
+  }
+  // Rows following each other on both sides are a single copy
+  if (width == dstRowPitch && width == srcRowPitch &&
+      (region.depth == 1 ||
+       (dstSlicePitch == width * height && srcSlicePitch == width * height))) {
+    copy(tp, dst, src, width * numRows);
+    return;
+  }
+
+  auto *d = static_cast<char *>(dst);
+  auto *s = static_cast<const char *>(src);
+  forRows(tp, numRows, width, [&](size_t begin, size_t end) {
+    size_t z = begin / height;
+    size_t y = begin % height;
+    for (size_t row = begin; row < end; row++) {
+      std::memcpy(d + z * dstSlicePitch + y * dstRowPitch,
+                  s + z * srcSlicePitch + y * srcRowPitch, width);
+      if (++y == height) {
+        y = 0;
+        z++;
+      }
+    }
+  });
+}
+
+void fill(threadpool_t &tp, void *dst, const void *pattern, size_t patternSize,
+          size_t size) {
+  auto *d = static_cast<char *>(dst);
+  if (isUniform(pattern, patternSize)) {
+    const int value = *static_cast<const unsigned char *>(pattern);
+    forChunks(tp, size, ChunkSize, [d, value](size_t begin, size_t end) {
+      std::memset(d + begin, value, end - begin);
+    });
+    return;
+  }
+
+  const pattern_block block(pattern, patternSize);
+  // Chunks start on block boundaries, so at the start of a pattern
+  const size_t chunkSize =
+      std::max<size_t>(ChunkSize / block.size(), 1) * block.size();
+  forChunks(tp, size, chunkSize, [d, &block](size_t begin, size_t end) {
+    block.fill(d + begin, end - begin);
+  });
+}
+
+void fill2D(threadpool_t &tp, void *dst, size_t pitch, const void *pattern,
+            size_t patternSize, size_t width, size_t height) {
+  auto *d = static_cast<char *>(dst);
+  if (isUniform(pattern, patternSize)) {
+    const int value = *static_cast<const unsigned char *>(pattern);
+    forRows(tp, height, width, [&](size_t begin, size_t end) {
+      for (size_t row = begin; row < end; row++) {
+        std::memset(d + row * pitch, value, width);
+      }
+    });
+    return;
+  }
+
+  const pattern_block block(pattern, patternSize);
+  forRows(tp, height, width, [&](size_t begin, size_t end) {
+    for (size_t row = begin; row < end; row++) {
+      block.fill(d + row * pitch, width);
+    }
+  });
+}
+
+} // namespace native_cpu
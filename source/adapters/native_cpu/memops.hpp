@@ -0,0 +1,41 @@
+//===----------- memops.hpp - Native CPU Adapter --------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstddef>
+
+#include <ur_api.h>
+
+#include "threadpool.hpp"
+
+// Memory operations shared by the copy and fill commands. They only use
+// contiguous memcpys and memsets, which libc vectorizes, and split the large
+// ones across the workers of tp. They must not be called from those workers.
+namespace native_cpu {
+
+// Copies size bytes, the ranges being allowed to overlap
+void copy(threadpool_t &tp, void *dst, const void *src, size_t size);
+
+// Copies the region.height * region.depth rows of region.width bytes from src
+// to dst, with rows and slices the given pitches apart
+void copyRect(threadpool_t &tp, void *dst, const void *src,
+              const ur_rect_region_t &region, size_t dstRowPitch,
+              size_t dstSlicePitch, size_t srcRowPitch, size_t srcSlicePitch);
+
+// Fills size bytes, a multiple of patternSize, with the pattern
+void fill(threadpool_t &tp, void *dst, const void *pattern, size_t patternSize,
+          size_t size);
+
+// Fills height rows of width bytes, pitch apart, with the pattern, width being
+// a multiple of patternSize
+void fill2D(threadpool_t &tp, void *dst, size_t pitch, const void *pattern,
+            size_t patternSize, size_t width, size_t height);
+
+} // namespace native_cpu
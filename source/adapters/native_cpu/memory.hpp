@@ -16,15 +16,18 @@
 
 #include "common.hpp"
 #include "context.hpp"
+#include "huge_pages.hpp"
 
 struct ur_mem_handle_t_ : _ur_object {
-  ur_mem_handle_t_(size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true},
-        IsImage{_IsImage} {}
+  ur_mem_handle_t_(ur_context_handle_t Context, size_t Size, bool _IsImage)
+      : _mem{allocate(Size)}, _ownsMem{true}, IsImage{_IsImage} {
+    account(Context, Size);
+  }
 
-  ur_mem_handle_t_(void *HostPtr, size_t Size, bool _IsImage)
-      : _mem{static_cast<char *>(malloc(Size))}, _ownsMem{true}, IsImage{
-                                                                     _IsImage} {
+  ur_mem_handle_t_(ur_context_handle_t Context, void *HostPtr, size_t Size,
+                   bool _IsImage)
+      : _mem{allocate(Size)}, _ownsMem{true}, IsImage{_IsImage} {
+    account(Context, Size);
     memcpy(_mem, HostPtr, Size);
   }
 
@@ -33,9 +36,15 @@ struct ur_mem_handle_t_ : _ur_object {
   }
 
   ~ur_mem_handle_t_() {
-    if (_ownsMem) {
+    if (_ownsMem && _mappedSize) {
+      native_cpu::freeHugePages(_mem, _mappedSize);
+    } else if (_ownsMem) {
       free(_mem);
     }
+    if (_context) {
+      _context->MemoryAccounting.onFree(memoryType(), _allocSize);
+      decrementOrDelete(_context);
+    }
   }
 
   void decrementRefCount() noexcept { _refCount--; }
@@ -43,11 +52,41 @@ struct ur_mem_handle_t_ : _ur_object {
   // Method to get type of the derived object (image or buffer)
   bool isImage() const { return this->IsImage; }
 
+  // Size of the huge page mapping of _mem, 0 if it was malloc'ed. Set while
+  // _mem is initialized, so it is declared before it.
+  size_t _mappedSize = 0;
   char *_mem;
   bool _ownsMem;
   std::atomic_uint32_t _refCount = {1};
 
 private:
+  char *allocate(size_t Size) {
+    if (void *Ptr = native_cpu::allocHugePages(Size, _mappedSize)) {
+      return static_cast<char *>(Ptr);
+    }
+    return static_cast<char *>(malloc(Size));
+  }
+
+  ur_exp_context_memory_type_t memoryType() const {
+    return IsImage ? UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE
+                   : UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER;
+  }
+
+  // Counts _mem in Context, which is retained until it is freed
+  void account(ur_context_handle_t Context, size_t Size) {
+    if (!_mem) {
+      return;
+    }
+    _context = Context;
+    _context->incrementReferenceCount();
+    _allocSize = _mappedSize ? _mappedSize : Size;
+    _context->MemoryAccounting.onAlloc(memoryType(), _allocSize);
+  }
+
+  // Context _mem is counted in, null if the handle doesn't own it
+  ur_context_handle_t _context = nullptr;
+  size_t _allocSize = 0;
+
   const bool IsImage;
 };
 
@@ -55,10 +94,10 @@ struct _ur_buffer final : ur_mem_handle_t_ {
   // Buffer constructor
   _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr)
       : ur_mem_handle_t_(HostPtr, false) {}
-  _ur_buffer(ur_context_handle_t /* Context*/, void *HostPtr, size_t Size)
-      : ur_mem_handle_t_(HostPtr, Size, false) {}
-  _ur_buffer(ur_context_handle_t /* Context*/, size_t Size)
-      : ur_mem_handle_t_(Size, false) {}
+  _ur_buffer(ur_context_handle_t Context, void *HostPtr, size_t Size)
+      : ur_mem_handle_t_(Context, HostPtr, Size, false) {}
+  _ur_buffer(ur_context_handle_t Context, size_t Size)
+      : ur_mem_handle_t_(Context, Size, false) {}
   _ur_buffer(_ur_buffer *b, size_t Offset, size_t Size)
       : ur_mem_handle_t_(b->_mem + Offset, false), SubBuffer(b) {
     std::ignore = Size;
@@ -163,6 +163,14 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramBuildExp(ur_program_handle_t,
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(ur_program_handle_t, ur_queue_handle_t hQueue,
+                       const char *, ur_event_handle_t *phEvent) {
+  // The build is a no-op as for urProgramBuild, the event only completes
+  // after the commands enqueued before it.
+  return urEnqueueEventsWait(hQueue, 0, nullptr, phEvent);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urProgramLinkExp(
     ur_context_handle_t, uint32_t, ur_device_handle_t *, uint32_t,
     const ur_program_handle_t *, const char *, ur_program_handle_t *phProgram) {
@@ -10,32 +10,164 @@
 
 #include "queue.hpp"
 #include "common.hpp"
+#include "event.hpp"
 
 #include "ur/ur.hpp"
 #include "ur_api.h"
 
+ur_queue_handle_t_::ur_queue_handle_t_(ur_device_handle_t_ *device,
+                                       ur_context_handle_t context,
+                                       ur_queue_flags_t flags)
+    : device(device), context(context), flags(flags),
+      executor([this]() { runExecutor(); }) {}
+
+ur_queue_handle_t_::~ur_queue_handle_t_() {
+  finish();
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    stopping = true;
+  }
+  changed.notify_all();
+  executor.join();
+}
+
+ur_result_t ur_queue_handle_t_::enqueue(
+    ur_command_t commandType, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent,
+    std::function<void()> &&command, bool blocking) {
+  for (uint32_t i = 0; i < numEventsInWaitList; i++) {
+    UR_ASSERT(phEventWaitList[i], UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+  }
+  queued_command cmd;
+  cmd.command = std::move(command);
+  ur::normalizeEventWaitList<ur_event_wait_traits_>(
+      phEventWaitList, numEventsInWaitList, cmd.waitList);
+  // The commands of the queue run in turn, so its own events have completed
+  // by the time the command runs
+  cmd.waitList.erase(std::remove_if(cmd.waitList.begin(), cmd.waitList.end(),
+                                    [this](ur_event_handle_t event) {
+                                      return event->getQueue() == this;
+                                    }),
+                     cmd.waitList.end());
+  bool waitListComplete = cmd.waitList.empty();
+  ur_event_handle_t event = (phEvent || blocking)
+                                ? new ur_event_handle_t_(this, commandType)
+                                : nullptr;
+  cmd.event = event;
+
+  std::unique_lock<std::mutex> lock(mutex);
+  if (blocking && waitListComplete && !busy && commands.empty()) {
+    busy = true;
+    lock.unlock();
+    run(cmd);
+    lock.lock();
+    busy = false;
+    lock.unlock();
+    changed.notify_all();
+  } else {
+    for (auto waitEvent : cmd.waitList) {
+      waitEvent->incrementReferenceCount();
+    }
+    if (event) {
+      // Reference of the executor
+      event->incrementReferenceCount();
+    }
+    commands.push_back(std::move(cmd));
+    lock.unlock();
+    changed.notify_all();
+    if (blocking) {
+      event->wait();
+    }
+  }
+
+  if (phEvent) {
+    *phEvent = event;
+  } else if (event) {
+    decrementOrDelete(event);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+void ur_queue_handle_t_::finish() {
+  std::unique_lock<std::mutex> lock(mutex);
+  changed.wait(lock, [this]() { return commands.empty() && !busy; });
+}
+
+bool ur_queue_handle_t_::isEmpty() {
+  std::lock_guard<std::mutex> lock(mutex);
+  return commands.empty() && !busy;
+}
+
+void ur_queue_handle_t_::run(queued_command &cmd) {
+  for (auto event : cmd.waitList) {
+    event->wait();
+  }
+  if (cmd.event) {
+    cmd.event->start();
+  }
+  cmd.command();
+  if (cmd.event) {
+    cmd.event->complete();
+  }
+}
+
+void ur_queue_handle_t_::runExecutor() {
+  std::unique_lock<std::mutex> lock(mutex);
+  while (true) {
+    changed.wait(lock,
+                 [this]() { return stopping || (!busy && !commands.empty()); });
+    if (commands.empty()) {
+      // Only stopping once finished
+      return;
+    }
+    queued_command cmd = std::move(commands.front());
+    commands.pop_front();
+    busy = true;
+    lock.unlock();
+
+    run(cmd);
+    for (auto event : cmd.waitList) {
+      decrementOrDelete(event);
+    }
+    if (cmd.event) {
+      decrementOrDelete(cmd.event);
+    }
+
+    lock.lock();
+    busy = false;
+    changed.notify_all();
+  }
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urQueueGetInfo(ur_queue_handle_t hQueue,
                                                    ur_queue_info_t propName,
                                                    size_t propSize,
                                                    void *pPropValue,
                                                    size_t *pPropSizeRet) {
-  std::ignore = hQueue;
-  std::ignore = propName;
-  std::ignore = propSize;
-  std::ignore = pPropValue;
-  std::ignore = pPropSizeRet;
-
-  DIE_NO_IMPLEMENTATION;
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_QUEUE_INFO_CONTEXT:
+    return ReturnValue(hQueue->context);
+  case UR_QUEUE_INFO_DEVICE:
+    return ReturnValue(hQueue->device);
+  case UR_QUEUE_INFO_FLAGS:
+    return ReturnValue(hQueue->flags);
+  case UR_QUEUE_INFO_REFERENCE_COUNT:
+    return ReturnValue(hQueue->getReferenceCount());
+  case UR_QUEUE_INFO_EMPTY:
+    return ReturnValue(static_cast<ur_bool_t>(hQueue->isEmpty()));
+  default:
+    DIE_NO_IMPLEMENTATION;
+  }
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueCreate(
     ur_context_handle_t hContext, ur_device_handle_t hDevice,
     const ur_queue_properties_t *pProperties, ur_queue_handle_t *phQueue) {
-  std::ignore = hContext;
-  std::ignore = hDevice;
-  std::ignore = pProperties;
+  ur_queue_flags_t Flags = pProperties ? pProperties->flags : 0;
 
-  auto Queue = new ur_queue_handle_t_(hDevice);
+  auto Queue = new ur_queue_handle_t_(hDevice, hContext, Flags);
   *phQueue = Queue;
 
   return UR_RESULT_SUCCESS;
@@ -78,13 +210,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFinish(ur_queue_handle_t hQueue) {
-  std::ignore = hQueue;
-  // TODO: is this fine as no-op?
+  hQueue->finish();
+
   return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
   std::ignore = hQueue;
+  // Commands are handed to the executor as they are enqueued
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueBeginCaptureExp(ur_queue_handle_t hQueue) {
+  std::ignore = hQueue;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
 
-  DIE_NO_IMPLEMENTATION;
+UR_APIEXPORT ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t hQueue, ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  std::ignore = hQueue;
+  std::ignore = phCommandBuffer;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
@@ -8,11 +8,67 @@
 //
 //===----------------------------------------------------------------------===//
 #pragma once
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
 #include "common.hpp"
 #include "device.hpp"
 
+// Commands are run one after the other by an executor thread of the queue,
+// each once the events of its wait list have completed. This also implements
+// out-of-order queues, whose commands may run in any order, and makes
+// barriers implicit.
 struct ur_queue_handle_t_ : RefCounted {
   ur_device_handle_t_ *const device;
+  const ur_context_handle_t context;
+  const ur_queue_flags_t flags;
+
+  ur_queue_handle_t_(ur_device_handle_t_ *device, ur_context_handle_t context,
+                     ur_queue_flags_t flags);
+
+  // Waits for the commands to complete
+  ~ur_queue_handle_t_();
+
+  // Queues command, returning its event in phEvent if not null. Blocking
+  // commands are waited for, and run on the calling thread if the queue and
+  // their wait list are idle, which saves the handover to the executor.
+  ur_result_t enqueue(ur_command_t commandType, uint32_t numEventsInWaitList,
+                      const ur_event_handle_t *phEventWaitList,
+                      ur_event_handle_t *phEvent,
+                      std::function<void()> &&command, bool blocking = false);
+
+  // Blocks until all the commands queued so far have completed
+  void finish();
+
+  bool isEmpty();
+
+  bool isProfilingEnabled() const noexcept {
+    return flags & UR_QUEUE_FLAG_PROFILING_ENABLE;
+  }
+
+private:
+  struct queued_command {
+    std::function<void()> command;
+    // Retained
+    std::vector<ur_event_handle_t> waitList;
+    // Retained, null if neither returned nor waited for
+    ur_event_handle_t event;
+  };
+
+  void runExecutor();
+
+  static void run(queued_command &cmd);
 
-  ur_queue_handle_t_(ur_device_handle_t_ *device) : device(device) {}
+  std::mutex mutex;
+  // Notified when commands are queued and when they complete
+  std::condition_variable changed;
+  std::deque<queued_command> commands;
+  // Whether a command is running, on the executor or the enqueuing thread
+  bool busy = false;
+  bool stopping = false;
+  std::thread executor;
 };
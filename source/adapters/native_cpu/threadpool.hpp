@@ -10,134 +10,184 @@
 #include <algorithm>
 #include <atomic>
 #include <condition_variable>
+#include <cstdint>
+#include <cstdio>
 #include <cstdlib>
-#include <forward_list>
+#include <deque>
 #include <functional>
 #include <future>
-#include <iterator>
+#include <memory>
 #include <mutex>
-#include <numeric>
-#include <queue>
 #include <string>
 #include <thread>
+#include <type_traits>
 #include <vector>
 
+#ifdef __linux__
+#include <fstream>
+#include <pthread.h>
+#include <sched.h>
+#endif
+
 namespace native_cpu {
 
 using worker_task_t = std::function<void(size_t)>;
 
 namespace detail {
 
-class worker_thread {
+// Blocks threads until they are notified. Waiting spins for a while before
+// sleeping on the condition variable, so that workers kept busy by back to
+// back launches don't go through the kernel, and notifying is one atomic
+// increment while nobody sleeps.
+class parker {
 public:
-  // Initializes state, but does not start the worker thread
-  worker_thread(size_t threadId) noexcept
-      : m_threadId(threadId), m_isRunning(false), m_numTasks(0) {
-    std::lock_guard<std::mutex> lock(m_workMutex);
-    if (this->is_running()) {
-      return;
-    }
-    m_worker = std::thread([this]() {
-      while (true) {
-        std::unique_lock<std::mutex> lock(m_workMutex);
-        // Wait until there's work available
-        m_startWorkCondition.wait(
-            lock, [this]() { return !this->is_running() || !m_tasks.empty(); });
-        if (!this->is_running() && m_tasks.empty()) {
-          // Can only break if there is no more work to be done
-          break;
-        }
-        // Retrieve a task from the queue
-        worker_task_t task = std::move(m_tasks.front());
-        m_tasks.pop();
-
-        // Not modifying internal state anymore, can release the mutex
-        lock.unlock();
-
-        // Execute the task
-        task(m_threadId);
-        --m_numTasks;
-      }
-    });
-
-    m_isRunning.store(true, std::memory_order_release);
+  uint32_t epoch() const noexcept {
+    return m_epoch.load(std::memory_order_acquire);
   }
 
-  inline void schedule(const worker_task_t &task) {
-    {
-      std::lock_guard<std::mutex> lock(m_workMutex);
-      // Add the task to the queue
-      m_tasks.push(task);
-      ++m_numTasks;
+  // Returns once notified after epoch returned seenEpoch. With notify_one,
+  // the other sleepers may stay blocked until the next notification.
+  void wait(uint32_t seenEpoch) {
+    for (unsigned i = 0; i < SpinIterations; i++) {
+      if (epoch() != seenEpoch) {
+        return;
+      }
+      std::this_thread::yield();
     }
-    m_startWorkCondition.notify_one();
-  }
-
-  size_t num_pending_tasks() const noexcept {
-    // m_numTasks is an atomic counter because we don't want to lock the mutex
-    // here, num_pending_tasks is only used for heuristics
-    return m_numTasks.load(std::memory_order_acquire);
+    std::unique_lock<std::mutex> lock(m_mutex);
+    // Sequentially consistent with the accesses of notify, so that either the
+    // sleeper sees the new epoch or the notifier sees the sleeper
+    ++m_numSleepers;
+    m_condition.wait(lock, [&]() { return m_epoch.load() != seenEpoch; });
+    --m_numSleepers;
   }
 
-  // Waits for all tasks to finish and destroys the worker thread
-  inline void stop() {
-    {
-      std::lock_guard<std::mutex> lock(m_workMutex);
-      m_isRunning.store(false, std::memory_order_release);
-      m_startWorkCondition.notify_all();
-    }
-    if (m_worker.joinable()) {
-      // Wait for the worker thread to finish handling the task queue
-      m_worker.join();
+  void notify_one() {
+    ++m_epoch;
+    if (m_numSleepers.load() > 0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_condition.notify_one();
     }
   }
 
-  // Checks whether the thread pool is currently running threads
-  inline bool is_running() const noexcept {
-    return m_isRunning.load(std::memory_order_acquire);
+  void notify_all() {
+    ++m_epoch;
+    if (m_numSleepers.load() > 0) {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_condition.notify_all();
+    }
   }
 
 private:
-  // Unique ID identifying the thread in the threadpool
-  const size_t m_threadId;
+  static constexpr unsigned SpinIterations = 256;
 
-  std::thread m_worker;
+  std::atomic<uint32_t> m_epoch{0};
 
-  std::mutex m_workMutex;
+  std::atomic<uint32_t> m_numSleepers{0};
 
-  std::condition_variable m_startWorkCondition;
+  std::mutex m_mutex;
 
-  std::atomic<bool> m_isRunning;
-
-  std::queue<worker_task_t> m_tasks;
-
-  std::atomic<size_t> m_numTasks;
+  std::condition_variable m_condition;
 };
 
 // Implementation of a thread pool. The worker threads are created and
-// ready at construction. This class mainly holds the interface for
-// scheduling a task to the most appropriate thread and handling input
-// parameters and futures.
-class simple_thread_pool {
+// ready at construction. Tasks are queued to the workers in turn, idle
+// workers stealing the tasks queued to the others. Bulk launches give each
+// worker the same slice of the items every time, so that with pinned workers
+// the memory a worker first touched is processed by it again, and workers
+// done with their slice take chunks from the others.
+class work_stealing_thread_pool {
 public:
-  simple_thread_pool() noexcept
-      : m_isRunning(false), m_numThreads(get_num_threads()) {
+  work_stealing_thread_pool()
+      : m_numThreads(get_num_threads()),
+        m_slices(std::make_unique<slice[]>(m_numThreads)) {
     for (size_t i = 0; i < m_numThreads; i++) {
-      m_workers.emplace_front(i);
+      m_workers.emplace_back(std::make_unique<worker_thread>());
     }
     m_isRunning.store(true, std::memory_order_release);
+    for (size_t i = 0; i < m_numThreads; i++) {
+      m_workers[i]->m_thread = std::thread([this, i]() { run_worker(i); });
+    }
+    m_isPinned = pin_workers();
   }
 
-  ~simple_thread_pool() {
-    for (auto &t : m_workers) {
-      t.stop();
-    }
+  // Waits for all tasks to finish and destroys the worker threads
+  ~work_stealing_thread_pool() {
     m_isRunning.store(false, std::memory_order_release);
+    m_workParker.notify_all();
+    for (auto &w : m_workers) {
+      if (w->m_thread.joinable()) {
+        w->m_thread.join();
+      }
+    }
   }
 
-  inline void schedule(const worker_task_t &task) {
-    // Schedule the task on the best available worker thread
-    this->best_worker().schedule(task);
+  inline void schedule(worker_task_t task) {
+    if (m_workers.empty()) {
+      task(0);
+      return;
+    }
+    auto &w = *m_workers[m_nextWorker.fetch_add(1, std::memory_order_relaxed) %
+                         m_numThreads];
+    {
+      std::lock_guard<std::mutex> lock(w.m_tasksMutex);
+      w.m_tasks.push_back(std::move(task));
+      ++m_numTasks;
+    }
+    m_workParker.notify_one();
+  }
+
+  // Calls f(threadId, begin, end) on the workers for disjoint ranges covering
+  // [0, numItems) and returns once all have returned. Concurrent calls are
+  // run one after the other, as each of them uses all the workers. Ranges are
+  // of at least minChunkSize items, except at the ends of the slices. Workers
+  // busy with tasks join late or not at all, the others taking their slices.
+  template <typename F>
+  void parallel_for(size_t numItems, F &&f, size_t minChunkSize = 1) {
+    if (numItems == 0) {
+      return;
+    }
+    if (m_workers.empty()) {
+      f(size_t(0), size_t(0), numItems);
+      return;
+    }
+    using FnT = std::remove_reference_t<F>;
+    bulk_job job;
+    job.m_fn = const_cast<void *>(static_cast<const void *>(std::addressof(f)));
+    job.m_invoke = [](void *fn, size_t threadId, size_t begin, size_t end) {
+      (*static_cast<FnT *>(fn))(threadId, begin, end);
+    };
+    job.m_minChunkSize = std::max<size_t>(1, minChunkSize);
+    job.m_numPendingItems.store(numItems, std::memory_order_relaxed);
+
+    std::lock_guard<std::mutex> lock(m_jobMutex);
+    for (size_t i = 0; i < m_numThreads; i++) {
+      m_slices[i].m_next.store(i * numItems / m_numThreads,
+                               std::memory_order_relaxed);
+      m_slices[i].m_end = (i + 1) * numItems / m_numThreads;
+    }
+    m_job.store(&job);
+    m_jobGeneration.fetch_add(1, std::memory_order_release);
+    m_workParker.notify_all();
+    while (true) {
+      uint32_t epoch = m_doneParker.epoch();
+      if (job.m_numPendingItems.load(std::memory_order_acquire) == 0) {
+        break;
+      }
+      m_doneParker.wait(epoch);
+    }
+    // The workers still in the job only look for chunks left, which they
+    // must be done with before job goes. Either a worker entering it from now
+    // on sees no job or it is counted here, both accesses being sequentially
+    // consistent.
+    m_job.store(nullptr);
+    while (true) {
+      uint32_t epoch = m_doneParker.epoch();
+      if (m_numJobWorkers.load() == 0) {
+        break;
+      }
+      m_doneParker.wait(epoch);
+    }
   }
 
   inline bool is_running() const noexcept {
@@ -146,34 +196,140 @@ public:
 
   inline size_t num_threads() const noexcept { return m_numThreads; }
 
+  // Whether the workers are pinned to CPUs, see pin_workers
+  inline bool is_pinned() const noexcept { return m_isPinned; }
+
   inline size_t num_pending_tasks() const noexcept {
-    return std::accumulate(std::begin(m_workers), std::end(m_workers),
-                           size_t(0),
-                           [](size_t numTasks, const worker_thread &t) {
-                             return (numTasks + t.num_pending_tasks());
-                           });
+    return m_numTasks.load(std::memory_order_acquire);
   }
 
   void wait_for_all_pending_tasks() {
-    while (num_pending_tasks() > 0) {
-      std::this_thread::yield();
+    while (true) {
+      uint32_t epoch = m_doneParker.epoch();
+      if (num_pending_tasks() == 0) {
+        return;
+      }
+      m_doneParker.wait(epoch);
     }
   }
 
-protected:
-  // Determines which thread is the most appropriate for having work
-  // scheduled
-  worker_thread &best_worker() noexcept {
-    return *std::min_element(
-        std::begin(m_workers), std::end(m_workers),
-        [](const worker_thread &w1, const worker_thread &w2) {
-          // Prefer threads whose task queues are shorter
-          // This is just an approximation, it doesn't need to be exact
-          return (w1.num_pending_tasks() < w2.num_pending_tasks());
-        });
+private:
+  struct worker_thread {
+    std::thread m_thread;
+
+    std::mutex m_tasksMutex;
+
+    std::deque<worker_task_t> m_tasks;
+
+    // Generation of the last bulk job the worker took part in
+    uint64_t m_jobGeneration = 0;
+  };
+
+  // Part of the items of the current bulk job, assigned to one worker
+  struct alignas(64) slice {
+    std::atomic<size_t> m_next{0};
+
+    size_t m_end = 0;
+  };
+
+  struct bulk_job {
+    void *m_fn;
+
+    void (*m_invoke)(void *, size_t, size_t, size_t);
+
+    size_t m_minChunkSize;
+
+    std::atomic<size_t> m_numPendingItems;
+  };
+
+  void run_worker(size_t threadId) {
+    while (true) {
+      uint32_t epoch = m_workParker.epoch();
+      if (run_job(threadId) || run_task(threadId)) {
+        continue;
+      }
+      if (!is_running()) {
+        // Can only break if there is no more work to be done
+        break;
+      }
+      m_workParker.wait(epoch);
+    }
+  }
+
+  // Runs chunks of the current bulk job if the worker hasn't taken part in it
+  bool run_job(size_t threadId) {
+    auto &self = *m_workers[threadId];
+    uint64_t generation = m_jobGeneration.load(std::memory_order_acquire);
+    if (generation == self.m_jobGeneration) {
+      return false;
+    }
+    self.m_jobGeneration = generation;
+    ++m_numJobWorkers;
+    if (bulk_job *job = m_job.load()) {
+      // Own slice first
+      for (size_t i = 0; i < m_numThreads; i++) {
+        auto &s = m_slices[(threadId + i) % m_numThreads];
+        size_t begin, end;
+        while (take_chunk(s, job->m_minChunkSize, begin, end)) {
+          job->m_invoke(job->m_fn, threadId, begin, end);
+          if (job->m_numPendingItems.fetch_sub(
+                  end - begin, std::memory_order_acq_rel) == end - begin) {
+            m_doneParker.notify_all();
+          }
+        }
+      }
+    }
+    if (--m_numJobWorkers == 0) {
+      m_doneParker.notify_all();
+    }
+    return true;
+  }
+
+  // Takes the next chunk of s into [begin, end), returning false once s is
+  // done. Chunks are guided: a quarter of what is left, so that they shrink
+  // towards the end of the slice and its last ones, whichever worker takes
+  // them, finish close together.
+  static bool take_chunk(slice &s, size_t minChunkSize, size_t &begin,
+                         size_t &end) {
+    size_t next = s.m_next.load(std::memory_order_relaxed);
+    while (next < s.m_end) {
+      size_t chunkSize = std::max(minChunkSize, (s.m_end - next) / 4);
+      size_t last = std::min(next + chunkSize, s.m_end);
+      if (s.m_next.compare_exchange_weak(next, last,
+                                         std::memory_order_relaxed)) {
+        begin = next;
+        end = last;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  // Runs a task of the worker's own queue, or else steals one from the queues
+  // of the others
+  bool run_task(size_t threadId) {
+    if (num_pending_tasks() == 0) {
+      return false;
+    }
+    for (size_t i = 0; i < m_numThreads; i++) {
+      auto &w = *m_workers[(threadId + i) % m_numThreads];
+      std::unique_lock<std::mutex> lock(w.m_tasksMutex);
+      if (w.m_tasks.empty()) {
+        continue;
+      }
+      worker_task_t task = std::move(w.m_tasks.front());
+      w.m_tasks.pop_front();
+      lock.unlock();
+
+      task(threadId);
+      if (m_numTasks.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+        m_doneParker.notify_all();
+      }
+      return true;
+    }
+    return false;
   }
 
-private:
   static size_t get_num_threads() {
     size_t numThreads;
     char *envVar = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
@@ -185,11 +341,96 @@ private:
     return numThreads;
   }
 
-  std::forward_list<worker_thread> m_workers;
+  // Pins the workers to the CPUs the process may run on, ordered by NUMA
+  // node so that consecutive workers, and thus consecutive slices of the
+  // bulk jobs, share nodes. Only done on Linux and if requested with
+  // SYCL_NATIVE_CPU_PIN_HOST_THREADS.
+  bool pin_workers() {
+#ifdef __linux__
+    const char *envVar = std::getenv("SYCL_NATIVE_CPU_PIN_HOST_THREADS");
+    if (!envVar || std::string(envVar) == "0" || m_numThreads == 0) {
+      return false;
+    }
+    cpu_set_t allowed;
+    if (sched_getaffinity(0, sizeof(allowed), &allowed) != 0) {
+      return false;
+    }
+    std::vector<int> cpus;
+    auto addCPU = [&](int cpu) {
+      if (cpu >= 0 && cpu < CPU_SETSIZE && CPU_ISSET(cpu, &allowed)) {
+        CPU_CLR(cpu, &allowed);
+        cpus.push_back(cpu);
+      }
+    };
+    // Lists as "0-3,8-11"
+    for (int node = 0;; node++) {
+      std::ifstream cpuList("/sys/devices/system/node/node" +
+                            std::to_string(node) + "/cpulist");
+      if (!cpuList) {
+        break;
+      }
+      std::string range;
+      while (std::getline(cpuList, range, ',')) {
+        int first = 0, last = 0;
+        int n = std::sscanf(range.c_str(), "%d-%d", &first, &last);
+        for (int cpu = first; n > 0 && cpu <= (n == 2 ? last : first); cpu++) {
+          addCPU(cpu);
+        }
+      }
+    }
+    // Without NUMA information
+    for (int cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+      addCPU(cpu);
+    }
+    if (cpus.empty()) {
+      return false;
+    }
 
-  std::atomic<bool> m_isRunning;
+    for (size_t i = 0; i < m_numThreads; i++) {
+      cpu_set_t set;
+      CPU_ZERO(&set);
+      CPU_SET(cpus[i % cpus.size()], &set);
+      if (pthread_setaffinity_np(m_workers[i]->m_thread.native_handle(),
+                                 sizeof(set), &set) != 0) {
+        return false;
+      }
+    }
+    return true;
+#else
+    return false;
+#endif
+  }
 
   const size_t m_numThreads;
+
+  std::unique_ptr<slice[]> m_slices;
+
+  bool m_isPinned = false;
+
+  std::vector<std::unique_ptr<worker_thread>> m_workers;
+
+  std::atomic<bool> m_isRunning{false};
+
+  // Worker the next task is queued to
+  std::atomic<size_t> m_nextWorker{0};
+
+  std::atomic<size_t> m_numTasks{0};
+
+  // Serializes the bulk jobs
+  std::mutex m_jobMutex;
+
+  std::atomic<bulk_job *> m_job{nullptr};
+
+  // Workers between loading m_job and being done with it
+  std::atomic<size_t> m_numJobWorkers{0};
+
+  std::atomic<uint64_t> m_jobGeneration{0};
+
+  // Wakes the workers for new tasks and jobs
+  parker m_workParker;
+
+  // Wakes the threads waiting for tasks and jobs to complete
+  parker m_doneParker;
 };
 } // namespace detail
 
@@ -207,8 +448,17 @@ public:
     threadpool.schedule([=](size_t threadId) { (*workerTask)(threadId); });
     return workerTask->get_future();
   }
+
+  // Runs f(threadId, begin, end) over [0, numItems) without a task or future
+  // per range, returning once done
+  template <typename F>
+  void parallel_for(size_t numItems, F &&f, size_t minChunkSize = 1) {
+    threadpool.parallel_for(numItems, std::forward<F>(f), minChunkSize);
+  }
+
+  bool is_pinned() const noexcept { return threadpool.is_pinned(); }
 };
 
-using threadpool_t = threadpool_interface<detail::simple_thread_pool>;
+using threadpool_t = threadpool_interface<detail::work_stealing_thread_pool>;
 
 } // namespace native_cpu
@@ -78,6 +78,19 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = urEventWaitAnyExp;
+  pDdiTable->pfnCreateIPCExp = urEventCreateIPCExp;
+  pDdiTable->pfnGetIPCHandleExp = urEventGetIPCHandleExp;
+  pDdiTable->pfnOpenIPCHandleExp = urEventOpenIPCHandleExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_api_version_t version, ur_program_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -226,6 +239,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnBeginCaptureExp = urQueueBeginCaptureExp;
+  pDdiTable->pfnEndCaptureExp = urQueueEndCaptureExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL
 urGetUSMProcAddrTable(ur_api_version_t version, ur_usm_dditable_t *pDdiTable) {
   auto result = validateProcInputs(version, pDdiTable);
@@ -288,6 +312,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
   pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
   pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnUpdateKernelLaunchBatchExp =
+      urCommandBufferUpdateKernelLaunchBatchExp;
+  pDdiTable->pfnUploadExp = urCommandBufferUploadExp;
   pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
   pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
   pDdiTable->pfnUpdateWaitEventsExp = urCommandBufferUpdateWaitEventsExp;
@@ -325,6 +352,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
       urBindlessImagesUnsampledImageCreateExp;
   pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
   pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageCopyBatchExp = urBindlessImagesImageCopyBatchExp;
   pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
   pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
   pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
@@ -400,7 +428,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
 
   pDdiTable->pfnCooperativeKernelLaunchExp = nullptr;
   pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchMultiExp = urEnqueueKernelLaunchMultiExp;
   pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+  pDdiTable->pfnHostTaskExp = urEnqueueHostTaskExp;
+  pDdiTable->pfnIPCEventSignalExp = urEnqueueIPCEventSignalExp;
+  pDdiTable->pfnIPCEventWaitExp = urEnqueueIPCEventWaitExp;
+  pDdiTable->pfnUSMMemcpyBatchExp = urEnqueueUSMMemcpyBatchExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -413,6 +446,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
   }
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp = nullptr;
+  pDdiTable->pfnSetArgsExp = urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -427,6 +461,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   pDdiTable->pfnBuildExp = urProgramBuildExp;
   pDdiTable->pfnCompileExp = urProgramCompileExp;
   pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildAsyncExp = urProgramBuildAsyncExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -29,6 +29,12 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
   UR_ASSERT(ppMem, UR_RESULT_ERROR_INVALID_NULL_POINTER);
   // TODO: Check Max size when UR_DEVICE_INFO_MAX_MEM_ALLOC_SIZE is implemented
   UR_ASSERT(size > 0, UR_RESULT_ERROR_INVALID_USM_SIZE);
+  auto *deviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  UR_ASSERT(!deviceDesc ||
+                !(deviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP),
+            UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
 
   auto *ptr = hContext->add_alloc(alignment, type, size, nullptr);
   UR_ASSERT(ptr != nullptr, UR_RESULT_ERROR_OUT_OF_RESOURCES);
@@ -37,6 +43,26 @@ static ur_result_t alloc_helper(ur_context_handle_t hContext,
   return UR_RESULT_SUCCESS;
 }
 
+// With pinned workers, large allocations are first touched by the workers,
+// each in the slice of the pages bulk launches give it. Their pages are thus
+// placed on the NUMA nodes of the workers running the proportional slices of
+// the work-groups, which is where kernels indexing the memory linearly use
+// them.
+static void firstTouch(ur_device_handle_t hDevice, void *ptr, size_t size) {
+  constexpr size_t PageSize = 4096;
+  constexpr size_t MinFirstTouchSize = 1 << 20;
+  if (!hDevice || !hDevice->tp.is_pinned() || size < MinFirstTouchSize) {
+    return;
+  }
+  auto *bytes = static_cast<volatile char *>(ptr);
+  hDevice->tp.parallel_for(size / PageSize,
+                           [bytes](size_t, size_t begin, size_t end) {
+                             for (size_t page = begin; page < end; page++) {
+                               bytes[page * PageSize] = 0;
+                             }
+                           });
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
                ur_usm_pool_handle_t pool, size_t size, void **ppMem) {
@@ -49,20 +75,28 @@ UR_APIEXPORT ur_result_t UR_APICALL
 urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hDevice;
   std::ignore = pool;
 
-  return alloc_helper(hContext, pUSMDesc, size, ppMem, UR_USM_TYPE_DEVICE);
+  auto result =
+      alloc_helper(hContext, pUSMDesc, size, ppMem, UR_USM_TYPE_DEVICE);
+  if (result == UR_RESULT_SUCCESS) {
+    firstTouch(hDevice, *ppMem, size);
+  }
+  return result;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
                  const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t pool,
                  size_t size, void **ppMem) {
-  std::ignore = hDevice;
   std::ignore = pool;
 
-  return alloc_helper(hContext, pUSMDesc, size, ppMem, UR_USM_TYPE_SHARED);
+  auto result =
+      alloc_helper(hContext, pUSMDesc, size, ppMem, UR_USM_TYPE_SHARED);
+  if (result == UR_RESULT_SUCCESS) {
+    firstTouch(hDevice, *ppMem, size);
+  }
+  return result;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
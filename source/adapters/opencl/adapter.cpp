@@ -8,18 +8,88 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <condition_variable>
+#include <deque>
+#include <thread>
+
+#include "adapter.hpp"
 #include "common.hpp"
 #include "logger/ur_logger.hpp"
+#include "ur_perf_counters.hpp"
+
+namespace {
+// Runs the builds of urProgramBuildAsyncExp in the order they were pushed
+class build_thread_t {
+public:
+  build_thread_t() : Thread([this] { run(); }) {}
+
+  // Runs the builds pushed already, whose events the application may still
+  // wait on, before joining
+  ~build_thread_t() {
+    {
+      std::lock_guard<std::mutex> Lock{Mutex};
+      Stop = true;
+    }
+    CV.notify_one();
+    Thread.join();
+  }
+
+  void push(std::function<void()> Build) {
+    {
+      std::lock_guard<std::mutex> Lock{Mutex};
+      Builds.push_back(std::move(Build));
+    }
+    CV.notify_one();
+  }
+
+private:
+  void run() {
+    std::unique_lock<std::mutex> Lock{Mutex};
+    for (;;) {
+      CV.wait(Lock, [this] { return Stop || !Builds.empty(); });
+      if (Builds.empty()) {
+        return;
+      }
+      auto Build = std::move(Builds.front());
+      Builds.pop_front();
+      Lock.unlock();
+      Build();
+      Lock.lock();
+    }
+  }
+
+  std::mutex Mutex;
+  std::condition_variable CV;
+  std::deque<std::function<void()>> Builds;
+  bool Stop = false;
+  // Last, so that it starts once the other members are constructed
+  std::thread Thread;
+};
+} // namespace
 
 struct ur_adapter_handle_t_ {
   std::atomic<uint32_t> RefCount = 0;
   std::mutex Mutex;
   logger::Logger &log = logger::get_logger("opencl");
+  // Started by the first background build, guarded by Mutex
+  std::unique_ptr<build_thread_t> BuildThread;
 };
 
 static ur_adapter_handle_t_ *adapter = nullptr;
 
+void cl_adapter::runInBackground(std::function<void()> Build) {
+  std::lock_guard<std::mutex> Lock{adapter->Mutex};
+  if (!adapter->BuildThread) {
+    adapter->BuildThread = std::make_unique<build_thread_t>();
+  }
+  adapter->BuildThread->push(std::move(Build));
+}
+
 static void globalAdapterShutdown() {
+  // The builds may still use the extension functions
+  if (adapter) {
+    adapter->BuildThread.reset();
+  }
   if (cl_ext::ExtFuncPtrCache) {
     delete cl_ext::ExtFuncPtrCache;
     cl_ext::ExtFuncPtrCache = nullptr;
@@ -66,6 +136,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t) {
   if (adapter) {
     std::lock_guard<std::mutex> Lock{adapter->Mutex};
     if (--adapter->RefCount == 0) {
+      // The builds may still use the extension functions
+      adapter->BuildThread.reset();
       if (cl_ext::ExtFuncPtrCache) {
         delete cl_ext::ExtFuncPtrCache;
         cl_ext::ExtFuncPtrCache = nullptr;
@@ -95,6 +167,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t,
     return ReturnValue(UR_ADAPTER_BACKEND_OPENCL);
   case UR_ADAPTER_INFO_REFERENCE_COUNT:
     return ReturnValue(adapter->RefCount.load());
+  case UR_ADAPTER_INFO_PERF_COUNTERS:
+    return ReturnValue(ur::perf_counters::get().dump().c_str());
   default:
     return UR_RESULT_ERROR_INVALID_ENUMERATION;
   }
@@ -8,6 +8,18 @@
 //
 //===----------------------------------------------------------------------===//
 
+#pragma once
+
+#include <functional>
+
 struct ur_adapter_handle_t_;
 
 extern ur_adapter_handle_t_ adapter;
+
+namespace cl_adapter {
+/// Hands Build to the build thread of the adapter, which runs the builds one
+/// after the other and is joined, once it has run those handed to it, when
+/// the adapter is released. Throws std::system_error if the thread can't be
+/// started.
+void runInBackground(std::function<void()> Build);
+} // namespace cl_adapter
@@ -45,8 +45,8 @@ ur_exp_command_buffer_handle_t_::~ur_exp_command_buffer_handle_t_() {
   cl_ext::clReleaseCommandBufferKHR_fn clReleaseCommandBufferKHR = nullptr;
   cl_int Res =
       cl_ext::getExtFuncFromContext<decltype(clReleaseCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clReleaseCommandBufferKHRCache,
-          cl_ext::ReleaseCommandBufferName, &clReleaseCommandBufferKHR);
+          CLContext, &cl_ext::ExtFuncPtrTableT::clReleaseCommandBufferKHR,
+          &clReleaseCommandBufferKHR);
   assert(Res == CL_SUCCESS);
   (void)Res;
 
@@ -65,8 +65,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
   cl_ext::clCreateCommandBufferKHR_fn clCreateCommandBufferKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clCreateCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCreateCommandBufferKHRCache,
-          cl_ext::CreateCommandBufferName, &clCreateCommandBufferKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCreateCommandBufferKHR,
+          &clCreateCommandBufferKHR));
 
   const bool IsUpdatable =
       pCommandBufferDesc ? pCommandBufferDesc->isUpdatable : false;
@@ -81,6 +81,21 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
     return UR_RESULT_ERROR_INVALID_OPERATION;
   }
 
+  // Devices of OpenCL versions before 2.0 don't know the query
+  cl_device_svm_capabilities SVMCapabilities = 0;
+  if (clGetDeviceInfo(CLDevice, CL_DEVICE_SVM_CAPABILITIES,
+                      sizeof(SVMCapabilities), &SVMCapabilities,
+                      nullptr) != CL_SUCCESS) {
+    SVMCapabilities = 0;
+  }
+
+  cl_ext::clCommandBarrierWithWaitListKHR_fn clCommandBarrierWithWaitListKHR =
+      nullptr;
+  UR_RETURN_ON_FAILURE(
+      cl_ext::getExtFuncFromContext<decltype(clCommandBarrierWithWaitListKHR)>(
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandBarrierWithWaitListKHR,
+          &clCommandBarrierWithWaitListKHR));
+
   cl_command_buffer_properties_khr Properties[3] = {
       CL_COMMAND_BUFFER_FLAGS_KHR,
       IsUpdatable ? CL_COMMAND_BUFFER_MUTABLE_KHR : 0u, 0};
@@ -90,9 +105,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCreateExp(
       1, cl_adapter::cast<cl_command_queue *>(&Queue), Properties, &Res);
   CL_RETURN_ON_FAILURE_AND_SET_NULL(Res, phCommandBuffer);
 
+  // Recorded before any other command, the barrier doesn't wait on anything
+  // and stands for the commands without dependencies which aren't recorded
+  ur_exp_command_buffer_sync_point_t RootSyncPoint = 0;
+  CL_RETURN_ON_FAILURE(clCommandBarrierWithWaitListKHR(
+      CLCommandBuffer, nullptr, nullptr, 0, nullptr, &RootSyncPoint, nullptr));
+
   try {
     auto URCommandBuffer = std::make_unique<ur_exp_command_buffer_handle_t_>(
-        Queue, hContext, CLCommandBuffer, IsUpdatable);
+        Queue, hContext, CLCommandBuffer, IsUpdatable, SVMCapabilities != 0,
+        RootSyncPoint);
     *phCommandBuffer = URCommandBuffer.release();
   } catch (...) {
     return UR_RESULT_ERROR_OUT_OF_RESOURCES;
@@ -128,8 +150,8 @@ urCommandBufferFinalizeExp(ur_exp_command_buffer_handle_t hCommandBuffer) {
   cl_ext::clFinalizeCommandBufferKHR_fn clFinalizeCommandBufferKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clFinalizeCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clFinalizeCommandBufferKHRCache,
-          cl_ext::FinalizeCommandBufferName, &clFinalizeCommandBufferKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clFinalizeCommandBufferKHR,
+          &clFinalizeCommandBufferKHR));
 
   CL_RETURN_ON_FAILURE(
       clFinalizeCommandBufferKHR(hCommandBuffer->CLCommandBuffer));
@@ -156,8 +178,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
   cl_ext::clCommandNDRangeKernelKHR_fn clCommandNDRangeKernelKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clCommandNDRangeKernelKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandNDRangeKernelKHRCache,
-          cl_ext::CommandNRRangeKernelName, &clCommandNDRangeKernelKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandNDRangeKernelKHR,
+          &clCommandNDRangeKernelKHR));
 
   cl_mutable_command_khr CommandHandle = nullptr;
   cl_mutable_command_khr *OutCommandHandle =
@@ -197,33 +219,67 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
-    [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
-    [[maybe_unused]] void *pDst, [[maybe_unused]] const void *pSrc,
-    [[maybe_unused]] size_t size,
-    [[maybe_unused]] uint32_t numSyncPointsInWaitList,
-    [[maybe_unused]] const ur_exp_command_buffer_sync_point_t
-        *pSyncPointWaitList,
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pDst,
+    const void *pSrc, size_t size, uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
     [[maybe_unused]] uint32_t numEventsInWaitList,
     [[maybe_unused]] const ur_event_handle_t *phEventWaitList,
-    [[maybe_unused]] ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
     [[maybe_unused]] ur_event_handle_t *phEvent,
     [[maybe_unused]] ur_exp_command_buffer_command_handle_t *phCommand) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+  // USM allocations are valid SVM pointers of their context, on the devices
+  // supporting SVM
+  if (!hCommandBuffer->SupportsSVM) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
+  cl_ext::clCommandSVMMemcpyKHR_fn clCommandSVMMemcpyKHR = nullptr;
+  UR_RETURN_ON_FAILURE(
+      cl_ext::getExtFuncFromContext<decltype(clCommandSVMMemcpyKHR)>(
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandSVMMemcpyKHR,
+          &clCommandSVMMemcpyKHR));
+
+  CL_RETURN_ON_FAILURE(clCommandSVMMemcpyKHR(
+      hCommandBuffer->CLCommandBuffer, nullptr, nullptr, pDst, pSrc, size,
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr));
+
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
-    [[maybe_unused]] ur_exp_command_buffer_handle_t hCommandBuffer,
-    [[maybe_unused]] void *pMemory, [[maybe_unused]] const void *pPattern,
-    [[maybe_unused]] size_t patternSize, [[maybe_unused]] size_t size,
-    [[maybe_unused]] uint32_t numSyncPointsInWaitList,
-    [[maybe_unused]] const ur_exp_command_buffer_sync_point_t
-        *pSyncPointWaitList,
+    ur_exp_command_buffer_handle_t hCommandBuffer, void *pMemory,
+    const void *pPattern, size_t patternSize, size_t size,
+    uint32_t numSyncPointsInWaitList,
+    const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
     [[maybe_unused]] uint32_t numEventsInWaitList,
     [[maybe_unused]] const ur_event_handle_t *phEventWaitList,
-    [[maybe_unused]] ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
     [[maybe_unused]] ur_event_handle_t *phEvent,
     [[maybe_unused]] ur_exp_command_buffer_command_handle_t *phCommand) {
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+
+  // The SVM fill only takes the pattern sizes of the OpenCL types, unlike
+  // urEnqueueUSMFill we can't fall back to a copy of a host buffer, which
+  // would have to outlive the command-buffer.
+  if (!hCommandBuffer->SupportsSVM || patternSize > 128 ||
+      !isPowerOf2(patternSize)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
+  cl_ext::clCommandSVMMemFillKHR_fn clCommandSVMMemFillKHR = nullptr;
+  UR_RETURN_ON_FAILURE(
+      cl_ext::getExtFuncFromContext<decltype(clCommandSVMMemFillKHR)>(
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandSVMMemFillKHR,
+          &clCommandSVMMemFillKHR));
+
+  CL_RETURN_ON_FAILURE(clCommandSVMMemFillKHR(
+      hCommandBuffer->CLCommandBuffer, nullptr, nullptr, pMemory, pPattern,
+      patternSize, size, numSyncPointsInWaitList, pSyncPointWaitList,
+      pSyncPoint, nullptr));
+
+  return UR_RESULT_SUCCESS;
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
@@ -242,8 +298,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
   cl_ext::clCommandCopyBufferKHR_fn clCommandCopyBufferKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clCommandCopyBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandCopyBufferKHRCache,
-          cl_ext::CommandCopyBufferName, &clCommandCopyBufferKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandCopyBufferKHR,
+          &clCommandCopyBufferKHR));
 
   CL_RETURN_ON_FAILURE(clCommandCopyBufferKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -280,8 +336,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
   cl_ext::clCommandCopyBufferRectKHR_fn clCommandCopyBufferRectKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clCommandCopyBufferRectKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandCopyBufferRectKHRCache,
-          cl_ext::CommandCopyBufferRectName, &clCommandCopyBufferRectKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandCopyBufferRectKHR,
+          &clCommandCopyBufferRectKHR));
 
   CL_RETURN_ON_FAILURE(clCommandCopyBufferRectKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -384,8 +440,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
   cl_ext::clCommandFillBufferKHR_fn clCommandFillBufferKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clCommandFillBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clCommandFillBufferKHRCache,
-          cl_ext::CommandFillBufferName, &clCommandFillBufferKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandFillBufferKHR,
+          &clCommandFillBufferKHR));
 
   CL_RETURN_ON_FAILURE(clCommandFillBufferKHR(
       hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
@@ -395,50 +451,69 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
   return UR_RESULT_SUCCESS;
 }
 
+namespace {
+// Prefetches and advice are only hints, which the OpenCL command-buffer has
+// no command for, so nothing is recorded for them. Their sync-point stands
+// for their dependencies: the one they have, the root barrier if they have
+// none, or else a barrier waiting on them only.
+ur_result_t
+appendHint(ur_exp_command_buffer_handle_t hCommandBuffer,
+           uint32_t numSyncPointsInWaitList,
+           const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
+           ur_exp_command_buffer_sync_point_t *pSyncPoint) {
+  if (!pSyncPoint) {
+    return UR_RESULT_SUCCESS;
+  }
+  if (numSyncPointsInWaitList <= 1) {
+    *pSyncPoint = numSyncPointsInWaitList ? pSyncPointWaitList[0]
+                                          : hCommandBuffer->RootSyncPoint;
+    return UR_RESULT_SUCCESS;
+  }
+
+  cl_context CLContext = cl_adapter::cast<cl_context>(hCommandBuffer->hContext);
+  cl_ext::clCommandBarrierWithWaitListKHR_fn clCommandBarrierWithWaitListKHR =
+      nullptr;
+  UR_RETURN_ON_FAILURE(
+      cl_ext::getExtFuncFromContext<decltype(clCommandBarrierWithWaitListKHR)>(
+          CLContext, &cl_ext::ExtFuncPtrTableT::clCommandBarrierWithWaitListKHR,
+          &clCommandBarrierWithWaitListKHR));
+
+  CL_RETURN_ON_FAILURE(clCommandBarrierWithWaitListKHR(
+      hCommandBuffer->CLCommandBuffer, nullptr, nullptr,
+      numSyncPointsInWaitList, pSyncPointWaitList, pSyncPoint, nullptr));
+
+  return UR_RESULT_SUCCESS;
+}
+} // namespace
+
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
-    ur_exp_command_buffer_handle_t hCommandBuffer, const void *mem, size_t size,
-    ur_usm_migration_flags_t flags, uint32_t numSyncPointsInWaitList,
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    [[maybe_unused]] const void *mem, [[maybe_unused]] size_t size,
+    [[maybe_unused]] ur_usm_migration_flags_t flags,
+    uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
-    ur_exp_command_buffer_command_handle_t *phCommand) {
-  (void)hCommandBuffer;
-  (void)mem;
-  (void)size;
-  (void)flags;
-  (void)numSyncPointsInWaitList;
-  (void)pSyncPointWaitList;
-  (void)numEventsInWaitList;
-  (void)phEventWaitList;
-  (void)pSyncPoint;
-  (void)phEvent;
-  (void)phCommand;
-
-  // Not implemented
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    [[maybe_unused]] uint32_t numEventsInWaitList,
+    [[maybe_unused]] const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    [[maybe_unused]] ur_event_handle_t *phEvent,
+    [[maybe_unused]] ur_exp_command_buffer_command_handle_t *phCommand) {
+  return appendHint(hCommandBuffer, numSyncPointsInWaitList,
+                    pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
-    ur_exp_command_buffer_handle_t hCommandBuffer, const void *mem, size_t size,
-    ur_usm_advice_flags_t advice, uint32_t numSyncPointsInWaitList,
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    [[maybe_unused]] const void *mem, [[maybe_unused]] size_t size,
+    [[maybe_unused]] ur_usm_advice_flags_t advice,
+    uint32_t numSyncPointsInWaitList,
     const ur_exp_command_buffer_sync_point_t *pSyncPointWaitList,
-    uint32_t numEventsInWaitList, const ur_event_handle_t *phEventWaitList,
-    ur_exp_command_buffer_sync_point_t *pSyncPoint, ur_event_handle_t *phEvent,
-    ur_exp_command_buffer_command_handle_t *phCommand) {
-  (void)hCommandBuffer;
-  (void)mem;
-  (void)size;
-  (void)advice;
-  (void)numSyncPointsInWaitList;
-  (void)pSyncPointWaitList;
-  (void)numEventsInWaitList;
-  (void)phEventWaitList;
-  (void)pSyncPoint;
-  (void)phEvent;
-  (void)phCommand;
-
-  // Not implemented
-  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    [[maybe_unused]] uint32_t numEventsInWaitList,
+    [[maybe_unused]] const ur_event_handle_t *phEventWaitList,
+    ur_exp_command_buffer_sync_point_t *pSyncPoint,
+    [[maybe_unused]] ur_event_handle_t *phEvent,
+    [[maybe_unused]] ur_exp_command_buffer_command_handle_t *phCommand) {
+  return appendHint(hCommandBuffer, numSyncPointsInWaitList,
+                    pSyncPointWaitList, pSyncPoint);
 }
 
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
@@ -450,8 +525,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   cl_ext::clEnqueueCommandBufferKHR_fn clEnqueueCommandBufferKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clEnqueueCommandBufferKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueCommandBufferKHRCache,
-          cl_ext::EnqueueCommandBufferName, &clEnqueueCommandBufferKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueCommandBufferKHR,
+          &clEnqueueCommandBufferKHR));
 
   const uint32_t NumberOfQueues = 1;
 
@@ -464,6 +539,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferEnqueueExp(
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer,
+    [[maybe_unused]] ur_queue_handle_t hQueue) {
+  // cl_khr_command_buffer has no entry point to prepare a command-buffer for
+  // its first enqueue; the finalized command-buffer is left to the driver.
+  UR_ASSERT(hCommandBuffer->IsFinalized, UR_RESULT_ERROR_INVALID_OPERATION);
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t hCommand) {
   hCommand->incrementExternalReferenceCount();
@@ -553,8 +637,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
   cl_ext::clUpdateMutableCommandsKHR_fn clUpdateMutableCommandsKHR = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<decltype(clUpdateMutableCommandsKHR)>(
-          CLContext, cl_ext::ExtFuncPtrCache->clUpdateMutableCommandsKHRCache,
-          cl_ext::UpdateMutableCommandsName, &clUpdateMutableCommandsKHR));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clUpdateMutableCommandsKHR,
+          &clUpdateMutableCommandsKHR));
 
   if (!hCommandBuffer->IsFinalized || !hCommandBuffer->IsUpdatable)
     return UR_RESULT_ERROR_INVALID_OPERATION;
@@ -668,3 +752,22 @@ UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
   return UR_RESULT_ERROR_INVALID_ENUMERATION;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t hCommandBuffer, uint32_t numKernelUpdates,
+    const ur_exp_command_buffer_command_handle_t *phCommands,
+    const ur_exp_command_buffer_update_kernel_launch_desc_t
+        *pUpdateKernelLaunch) {
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    if (phCommands[i]->hCommandBuffer != hCommandBuffer) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+  }
+
+  for (uint32_t i = 0; i < numKernelUpdates; i++) {
+    UR_RETURN_ON_FAILURE(urCommandBufferUpdateKernelLaunchExp(
+        phCommands[i], &pUpdateKernelLaunch[i]));
+  }
+
+  return UR_RESULT_SUCCESS;
+}
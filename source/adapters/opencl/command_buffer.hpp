@@ -71,6 +71,11 @@ struct ur_exp_command_buffer_handle_t_ {
   bool IsUpdatable;
   /// Set to true if the command-buffer has been finalized, false otherwise
   bool IsFinalized;
+  /// Set to true if the device supports SVM, which the USM commands are
+  /// recorded as
+  bool SupportsSVM;
+  /// Sync-point of the barrier recorded first, which waits on nothing
+  ur_exp_command_buffer_sync_point_t RootSyncPoint;
   /// List of commands in the command-buffer.
   std::vector<ur_exp_command_buffer_command_handle_t> CommandHandles;
   /// Internal & External reference counts of the command-buffer. We do this
@@ -81,13 +86,15 @@ struct ur_exp_command_buffer_handle_t_ {
   std::atomic_uint32_t RefCountInternal;
   std::atomic_uint32_t RefCountExternal;
 
-  ur_exp_command_buffer_handle_t_(ur_queue_handle_t hQueue,
-                                  ur_context_handle_t hContext,
-                                  cl_command_buffer_khr CLCommandBuffer,
-                                  bool IsUpdatable)
+  ur_exp_command_buffer_handle_t_(
+      ur_queue_handle_t hQueue, ur_context_handle_t hContext,
+      cl_command_buffer_khr CLCommandBuffer, bool IsUpdatable,
+      bool SupportsSVM, ur_exp_command_buffer_sync_point_t RootSyncPoint)
       : hInternalQueue(hQueue), hContext(hContext),
         CLCommandBuffer(CLCommandBuffer), IsUpdatable(IsUpdatable),
-        IsFinalized(false), RefCountInternal(0), RefCountExternal(0) {}
+        IsFinalized(false), SupportsSVM(SupportsSVM),
+        RootSyncPoint(RootSyncPoint), RefCountInternal(0),
+        RefCountExternal(0) {}
 
   ~ur_exp_command_buffer_handle_t_();
 
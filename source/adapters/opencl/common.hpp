@@ -9,9 +9,12 @@
 
 #include <CL/cl.h>
 #include <CL/cl_ext.h>
+#include <atomic>
 #include <climits>
 #include <map>
+#include <memory>
 #include <mutex>
+#include <vector>
 #include <ur/ur.hpp>
 
 /**
@@ -215,6 +218,10 @@ CONSTFIX char CommandNRRangeKernelName[] = "clCommandNDRangeKernelKHR";
 CONSTFIX char CommandCopyBufferName[] = "clCommandCopyBufferKHR";
 CONSTFIX char CommandCopyBufferRectName[] = "clCommandCopyBufferRectKHR";
 CONSTFIX char CommandFillBufferName[] = "clCommandFillBufferKHR";
+CONSTFIX char CommandSVMMemcpyName[] = "clCommandSVMMemcpyKHR";
+CONSTFIX char CommandSVMMemFillName[] = "clCommandSVMMemFillKHR";
+CONSTFIX char CommandBarrierWithWaitListName[] =
+    "clCommandBarrierWithWaitListKHR";
 CONSTFIX char EnqueueCommandBufferName[] = "clEnqueueCommandBufferKHR";
 CONSTFIX char GetCommandBufferInfoName[] = "clGetCommandBufferInfoKHR";
 CONSTFIX char UpdateMutableCommandsName[] = "clUpdateMutableCommandsKHR";
@@ -305,6 +312,28 @@ using clCommandFillBufferKHR_fn = CL_API_ENTRY cl_int(CL_API_CALL *)(
     const cl_sync_point_khr *sync_point_wait_list,
     cl_sync_point_khr *sync_point, cl_mutable_command_khr *mutable_handle);
 
+using clCommandSVMMemcpyKHR_fn = CL_API_ENTRY cl_int(CL_API_CALL *)(
+    cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
+    const cl_command_properties_khr *properties, void *dst_ptr,
+    const void *src_ptr, size_t size, cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr *sync_point_wait_list,
+    cl_sync_point_khr *sync_point, cl_mutable_command_khr *mutable_handle);
+
+using clCommandSVMMemFillKHR_fn = CL_API_ENTRY cl_int(CL_API_CALL *)(
+    cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
+    const cl_command_properties_khr *properties, void *svm_ptr,
+    const void *pattern, size_t pattern_size, size_t size,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr *sync_point_wait_list,
+    cl_sync_point_khr *sync_point, cl_mutable_command_khr *mutable_handle);
+
+using clCommandBarrierWithWaitListKHR_fn = CL_API_ENTRY cl_int(CL_API_CALL *)(
+    cl_command_buffer_khr command_buffer, cl_command_queue command_queue,
+    const cl_command_properties_khr *properties,
+    cl_uint num_sync_points_in_wait_list,
+    const cl_sync_point_khr *sync_point_wait_list,
+    cl_sync_point_khr *sync_point, cl_mutable_command_khr *mutable_handle);
+
 using clEnqueueCommandBufferKHR_fn = CL_API_ENTRY
 cl_int(CL_API_CALL *)(cl_uint num_queues, cl_command_queue *queues,
                       cl_command_buffer_khr command_buffer,
@@ -320,22 +349,62 @@ cl_int(CL_API_CALL *)(cl_command_buffer_khr command_buffer, cl_uint num_configs,
                       const cl_command_buffer_update_type_khr *config_types,
                       const void **configs);
 
-template <typename T> struct FuncPtrCache {
-  std::map<cl_context, T> Map;
-  std::mutex Mutex;
+// Extension function pointers of a context. Members are null for the
+// functions its platform doesn't have.
+struct ExtFuncPtrTableT {
+#define CL_EXTENSION_FUNC(func, name) func##_fn func = nullptr;
 
-  void clear(cl_context context) {
-    std::lock_guard<std::mutex> CacheLock{Mutex};
-    Map.erase(context);
-  }
+#include "extension_functions.def"
+
+#undef CL_EXTENSION_FUNC
+
+  // Whether all the devices of the context share the memory of the host,
+  // which is cached with the functions as it is queried on every buffer
+  // creation
+  bool HostUnified = false;
 };
 
+// Incremented whenever tables of ExtFuncPtrCacheT are destroyed, which
+// invalidates the tables remembered by threads.
+inline std::atomic<uint64_t> ExtFuncPtrGeneration{0};
+
 struct ExtFuncPtrCacheT {
-#define CL_EXTENSION_FUNC(func) FuncPtrCache<func##_fn> func##Cache;
+  // Tables are resolved all at once on the first use of an extension function
+  // of a context, and never modified afterwards.
+  std::map<cl_context, std::unique_ptr<const ExtFuncPtrTableT>> Tables;
+  std::mutex Mutex;
 
-#include "extension_functions.def"
+  ~ExtFuncPtrCacheT() { ++ExtFuncPtrGeneration; }
+
+  // Returns the table of Context. Threads remember the last table they got,
+  // so that repeated calls for the same context don't lock.
+  ur_result_t getTable(cl_context Context, const ExtFuncPtrTableT **Table) {
+    struct LastTableT {
+      cl_context Context = nullptr;
+      uint64_t Generation = 0;
+      const ExtFuncPtrTableT *Table = nullptr;
+    };
+    static thread_local LastTableT LastTable;
+    const uint64_t Generation = ExtFuncPtrGeneration.load();
+    if (LastTable.Context == Context && LastTable.Generation == Generation) {
+      *Table = LastTable.Table;
+      return UR_RESULT_SUCCESS;
+    }
 
-#undef CL_EXTENSION_FUNC
+    std::lock_guard<std::mutex> CacheLock{Mutex};
+    auto &Entry = Tables[Context];
+    if (!Entry) {
+      auto NewTable = std::make_unique<ExtFuncPtrTableT>();
+      if (auto Result = resolveTable(Context, *NewTable)) {
+        Tables.erase(Context);
+        return Result;
+      }
+      Entry = std::move(NewTable);
+    }
+    LastTable = {Context, Generation, Entry.get()};
+    *Table = Entry.get();
+    return UR_RESULT_SUCCESS;
+  }
 
   // If a context stored in the current caching mechanism is destroyed by the
   // CL driver all of its function pointers are invalidated. This can lead to a
@@ -344,11 +413,58 @@ struct ExtFuncPtrCacheT {
   // used to retrieve bad function pointers. To avoid this we clear the cache
   // when contexts are released.
   void clearCache(cl_context context) {
-#define CL_EXTENSION_FUNC(func) func##Cache.clear(context);
+    std::lock_guard<std::mutex> CacheLock{Mutex};
+    if (Tables.erase(context)) {
+      ++ExtFuncPtrGeneration;
+    }
+  }
+
+private:
+  static ur_result_t resolveTable(cl_context Context,
+                                  ExtFuncPtrTableT &Table) {
+    cl_uint DeviceCount;
+    cl_int RetErr = clGetContextInfo(Context, CL_CONTEXT_NUM_DEVICES,
+                                     sizeof(cl_uint), &DeviceCount, nullptr);
+
+    if (RetErr != CL_SUCCESS || DeviceCount < 1) {
+      return UR_RESULT_ERROR_INVALID_CONTEXT;
+    }
+
+    std::vector<cl_device_id> DevicesInCtx(DeviceCount);
+    RetErr = clGetContextInfo(Context, CL_CONTEXT_DEVICES,
+                              DeviceCount * sizeof(cl_device_id),
+                              DevicesInCtx.data(), nullptr);
+
+    if (RetErr != CL_SUCCESS) {
+      return UR_RESULT_ERROR_INVALID_CONTEXT;
+    }
+
+    cl_platform_id CurPlatform;
+    RetErr = clGetDeviceInfo(DevicesInCtx[0], CL_DEVICE_PLATFORM,
+                             sizeof(cl_platform_id), &CurPlatform, nullptr);
+
+    if (RetErr != CL_SUCCESS) {
+      return UR_RESULT_ERROR_INVALID_CONTEXT;
+    }
+
+#define CL_EXTENSION_FUNC(func, name)                                          \
+  Table.func = reinterpret_cast<func##_fn>(                                    \
+      clGetExtensionFunctionAddressForPlatform(CurPlatform, name));
 
 #include "extension_functions.def"
 
 #undef CL_EXTENSION_FUNC
+
+    Table.HostUnified = true;
+    for (cl_device_id Dev : DevicesInCtx) {
+      cl_bool Unified = CL_FALSE;
+      if (clGetDeviceInfo(Dev, CL_DEVICE_HOST_UNIFIED_MEMORY, sizeof(cl_bool),
+                          &Unified, nullptr) != CL_SUCCESS) {
+        Unified = CL_FALSE;
+      }
+      Table.HostUnified = Table.HostUnified && Unified == CL_TRUE;
+    }
+    return UR_RESULT_SUCCESS;
   }
 };
 // A raw pointer is used here since the lifetime of this map has to be tied to
@@ -357,63 +473,18 @@ struct ExtFuncPtrCacheT {
 // destructor).
 inline ExtFuncPtrCacheT *ExtFuncPtrCache;
 
-// USM helper function to get an extension function pointer
+// Helper function to get an extension function pointer, Member of the table
+// of Context
 template <typename T>
 static ur_result_t getExtFuncFromContext(cl_context Context,
-                                         FuncPtrCache<T> &FPtrCache,
-                                         const char *FuncName, T *Fptr) {
-  // TODO
-  // Potentially redo caching as UR interface changes.
-  // if cached, return cached FuncPtr
-  std::lock_guard<std::mutex> CacheLock{FPtrCache.Mutex};
-  std::map<cl_context, T> &FPtrMap = FPtrCache.Map;
-  auto It = FPtrMap.find(Context);
-  if (It != FPtrMap.end()) {
-    auto F = It->second;
-    // if cached that extension is not available return nullptr and
-    // UR_RESULT_ERROR_UNSUPPORTED_FEATURE
-    *Fptr = F;
-    return F ? UR_RESULT_SUCCESS : UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-  }
-
-  cl_uint DeviceCount;
-  cl_int RetErr = clGetContextInfo(Context, CL_CONTEXT_NUM_DEVICES,
-                                   sizeof(cl_uint), &DeviceCount, nullptr);
-
-  if (RetErr != CL_SUCCESS || DeviceCount < 1) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  std::vector<cl_device_id> DevicesInCtx(DeviceCount);
-  RetErr = clGetContextInfo(Context, CL_CONTEXT_DEVICES,
-                            DeviceCount * sizeof(cl_device_id),
-                            DevicesInCtx.data(), nullptr);
-
-  if (RetErr != CL_SUCCESS) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  cl_platform_id CurPlatform;
-  RetErr = clGetDeviceInfo(DevicesInCtx[0], CL_DEVICE_PLATFORM,
-                           sizeof(cl_platform_id), &CurPlatform, nullptr);
-
-  if (RetErr != CL_SUCCESS) {
-    return UR_RESULT_ERROR_INVALID_CONTEXT;
-  }
-
-  T FuncPtr = reinterpret_cast<T>(
-      clGetExtensionFunctionAddressForPlatform(CurPlatform, FuncName));
-
-  if (!FuncPtr) {
-    // Cache that the extension is not available
-    FPtrMap[Context] = nullptr;
-    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
-  }
-
-  *Fptr = FuncPtr;
-  FPtrMap[Context] = FuncPtr;
-
-  return UR_RESULT_SUCCESS;
+                                         T ExtFuncPtrTableT::*Member,
+                                         T *Fptr) {
+  const ExtFuncPtrTableT *Table;
+  UR_RETURN_ON_FAILURE(ExtFuncPtrCache->getTable(Context, &Table));
+  // if that extension is not available return nullptr and
+  // UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+  *Fptr = Table->*Member;
+  return *Fptr ? UR_RESULT_SUCCESS : UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
 } // namespace cl_ext
 
@@ -12,6 +12,9 @@
 
 #include <array>
 #include <cassert>
+#include <map>
+#include <memory>
+#include <mutex>
 
 ur_result_t cl_adapter::getDeviceVersion(cl_device_id Dev,
                                          oclv::OpenCLVersion &Version) {
@@ -329,11 +332,9 @@ static cl_int mapURDeviceInfoToCL(ur_device_info_t URPropName) {
   }
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
-                                                    ur_device_info_t propName,
-                                                    size_t propSize,
-                                                    void *pPropValue,
-                                                    size_t *pPropSizeRet) {
+static ur_result_t getDeviceInfo(ur_device_handle_t hDevice,
+                                 ur_device_info_t propName, size_t propSize,
+                                 void *pPropValue, size_t *pPropSizeRet) {
 
   UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
 
@@ -825,6 +826,15 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP: {
     return ReturnValue(false);
   }
+  case UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP: {
+    return ReturnValue(false);
+  }
+  case UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP: {
+    return ReturnValue(false);
+  }
+  case UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP: {
+    return ReturnValue(false);
+  }
   case UR_DEVICE_INFO_HOST_PIPE_READ_WRITE_SUPPORTED: {
     bool Supported = false;
     UR_RETURN_ON_FAILURE(cl_adapter::checkDeviceExtensions(
@@ -1067,7 +1077,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   case UR_DEVICE_INFO_GLOBAL_MEM_FREE:
   case UR_DEVICE_INFO_MEMORY_CLOCK_RATE:
   case UR_DEVICE_INFO_MEMORY_BUS_WIDTH:
-  case UR_DEVICE_INFO_ASYNC_BARRIER: {
+  case UR_DEVICE_INFO_ASYNC_BARRIER:
+  case UR_DEVICE_INFO_HOST_NUMA_NODE_EXP: {
     return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
   }
 
@@ -1100,6 +1111,33 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
   }
 }
 
+// The device handles are the cl_device_id themselves, so their info caches are
+// kept aside, by handle.
+static std::mutex DeviceInfoCachesMutex;
+static std::map<ur_device_handle_t, std::unique_ptr<ur::DeviceInfoCache>>
+    DeviceInfoCaches;
+
+static ur::DeviceInfoCache &getDeviceInfoCache(ur_device_handle_t hDevice) {
+  std::lock_guard<std::mutex> Lock(DeviceInfoCachesMutex);
+  auto &Cache = DeviceInfoCaches[hDevice];
+  if (!Cache) {
+    Cache = std::make_unique<ur::DeviceInfoCache>();
+  }
+  return *Cache;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urDeviceGetInfo(ur_device_handle_t hDevice,
+                                                    ur_device_info_t propName,
+                                                    size_t propSize,
+                                                    void *pPropValue,
+                                                    size_t *pPropSizeRet) {
+  return getDeviceInfoCache(hDevice).get(
+      propName, propSize, pPropValue, pPropSizeRet,
+      [&](size_t Size, void *Value, size_t *SizeRet) {
+        return getDeviceInfo(hDevice, propName, Size, Value, SizeRet);
+      });
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urDevicePartition(
     ur_device_handle_t hDevice,
     const ur_device_partition_properties_t *pProperties, uint32_t NumDevices,
@@ -1175,6 +1213,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urDeviceRetain(ur_device_handle_t hDevice) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urDeviceRelease(ur_device_handle_t hDevice) {
 
+  // The handle of a released sub-device may be reused for another one, so its
+  // cached info is dropped, to be queried again if it is still alive.
+  cl_device_id ParentDevice = nullptr;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(cl_adapter::cast<cl_device_id>(hDevice),
+                                       CL_DEVICE_PARENT_DEVICE,
+                                       sizeof(ParentDevice), &ParentDevice,
+                                       nullptr));
+  if (ParentDevice) {
+    std::lock_guard<std::mutex> Lock(DeviceInfoCachesMutex);
+    DeviceInfoCaches.erase(hDevice);
+  }
+
   cl_int Result = clReleaseDevice(cl_adapter::cast<cl_device_id>(hDevice));
 
   return mapCLErrorToUR(Result);
@@ -9,6 +9,8 @@
 //===----------------------------------------------------------------------===//
 
 #include "common.hpp"
+#include "kernel.hpp"
+#include "program.hpp"
 
 cl_map_flags convertURMapFlagsToCL(ur_map_flags_t URFlags) {
   cl_map_flags CLFlags = 0;
@@ -25,12 +27,50 @@ cl_map_flags convertURMapFlagsToCL(ur_map_flags_t URFlags) {
   return CLFlags;
 }
 
+// Whether the commands of hQueue already wait for all the events of the wait
+// list, which an in-order queue does for its own events. Waiting on them
+// anyway costs the driver a dependency check per event on every launch, while
+// telling costs a query per event, so only short wait lists are checked.
+static constexpr uint32_t MaxImpliedWaitListSize = 4;
+
+static bool isWaitListImplied(ur_queue_handle_t hQueue,
+                              uint32_t numEventsInWaitList,
+                              const ur_event_handle_t *phEventWaitList) {
+  if (numEventsInWaitList > MaxImpliedWaitListSize) {
+    return false;
+  }
+  cl_command_queue CLQueue = cl_adapter::cast<cl_command_queue>(hQueue);
+  cl_command_queue_properties Properties = 0;
+  if (clGetCommandQueueInfo(CLQueue, CL_QUEUE_PROPERTIES, sizeof(Properties),
+                            &Properties, nullptr) != CL_SUCCESS ||
+      (Properties & CL_QUEUE_OUT_OF_ORDER_EXEC_MODE_ENABLE)) {
+    return false;
+  }
+  for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+    // User events have no queue
+    cl_command_queue EventQueue = nullptr;
+    if (clGetEventInfo(cl_adapter::cast<cl_event>(phEventWaitList[i]),
+                       CL_EVENT_COMMAND_QUEUE, sizeof(EventQueue), &EventQueue,
+                       nullptr) != CL_SUCCESS ||
+        EventQueue != CLQueue) {
+      return false;
+    }
+  }
+  return true;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ur_queue_handle_t hQueue, ur_kernel_handle_t hKernel, uint32_t workDim,
     const size_t *pGlobalWorkOffset, const size_t *pGlobalWorkSize,
     const size_t *pLocalWorkSize, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
 
+  if (numEventsInWaitList &&
+      isWaitListImplied(hQueue, numEventsInWaitList, phEventWaitList)) {
+    numEventsInWaitList = 0;
+    phEventWaitList = nullptr;
+  }
+
   CL_RETURN_ON_FAILURE(clEnqueueNDRangeKernel(
       cl_adapter::cast<cl_command_queue>(hQueue),
       cl_adapter::cast<cl_kernel>(hKernel), workDim, pGlobalWorkOffset,
@@ -51,6 +91,42 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                                numEventsInWaitList, phEventWaitList, phEvent);
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urEnqueueKernelLaunchMultiExp(uint32_t numLaunches,
+                              const ur_exp_kernel_launch_t *pLaunches) {
+  // There are no queue locks to share, so the launches are made in turn
+  for (uint32_t i = 0; i < numLaunches; i++) {
+    const auto &Launch = pLaunches[i];
+    cl_kernel CLClone = nullptr;
+    uint64_t CloneGeneration = 0;
+    if (Launch.numArgs) {
+      UR_RETURN_ON_FAILURE(cl_adapter::checkOutKernelClone(
+          Launch.hKernel, Launch.hQueue, Launch.numArgs, Launch.pArgs,
+          CLClone, CloneGeneration));
+    }
+    ur_kernel_handle_t hKernel =
+        CLClone ? cl_adapter::cast<ur_kernel_handle_t>(CLClone)
+                : Launch.hKernel;
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    if (Launch.numArgs) {
+      Result = urKernelSetArgsExp(hKernel, Launch.numArgs, Launch.pArgs);
+    }
+    if (Result == UR_RESULT_SUCCESS) {
+      Result = urEnqueueKernelLaunch(
+          Launch.hQueue, hKernel, Launch.workDim, Launch.pGlobalWorkOffset,
+          Launch.pGlobalWorkSize, Launch.pLocalWorkSize,
+          Launch.numEventsInWaitList, Launch.phEventWaitList, Launch.phEvent);
+    }
+    if (CLClone) {
+      cl_adapter::checkInKernelClone(Launch.hKernel, CLClone, CloneGeneration);
+    }
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueEventsWait(
     ur_queue_handle_t hQueue, uint32_t numEventsInWaitList,
     const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
@@ -348,11 +424,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
 
   cl_ext::clEnqueueWriteGlobalVariable_fn F = nullptr;
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<decltype(F)>(
-      Ctx, cl_ext::ExtFuncPtrCache->clEnqueueWriteGlobalVariableCache,
-      cl_ext::EnqueueWriteGlobalVariableName, &F));
+      Ctx, &cl_ext::ExtFuncPtrTableT::clEnqueueWriteGlobalVariable, &F));
 
   Res = F(cl_adapter::cast<cl_command_queue>(hQueue),
-          cl_adapter::cast<cl_program>(hProgram), name, blockingWrite, count,
+          cl_adapter::getBuiltProgram(hProgram), name, blockingWrite, count,
           offset, pSrc, numEventsInWaitList,
           cl_adapter::cast<const cl_event *>(phEventWaitList),
           cl_adapter::cast<cl_event *>(phEvent));
@@ -376,11 +451,10 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
 
   cl_ext::clEnqueueReadGlobalVariable_fn F = nullptr;
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<decltype(F)>(
-      Ctx, cl_ext::ExtFuncPtrCache->clEnqueueReadGlobalVariableCache,
-      cl_ext::EnqueueReadGlobalVariableName, &F));
+      Ctx, &cl_ext::ExtFuncPtrTableT::clEnqueueReadGlobalVariable, &F));
 
   Res = F(cl_adapter::cast<cl_command_queue>(hQueue),
-          cl_adapter::cast<cl_program>(hProgram), name, blockingRead, count,
+          cl_adapter::getBuiltProgram(hProgram), name, blockingRead, count,
           offset, pDst, numEventsInWaitList,
           cl_adapter::cast<const cl_event *>(phEventWaitList),
           cl_adapter::cast<cl_event *>(phEvent));
@@ -405,13 +479,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueReadHostPipe(
   cl_ext::clEnqueueReadHostPipeINTEL_fn FuncPtr = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<cl_ext::clEnqueueReadHostPipeINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueReadHostPipeINTELCache,
-          cl_ext::EnqueueReadHostPipeName, &FuncPtr));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueReadHostPipeINTEL,
+          &FuncPtr));
 
   if (FuncPtr) {
     CL_RETURN_ON_FAILURE(
         FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue),
-                cl_adapter::cast<cl_program>(hProgram), pipe_symbol, blocking,
+                cl_adapter::getBuiltProgram(hProgram), pipe_symbol, blocking,
                 pDst, size, numEventsInWaitList,
                 cl_adapter::cast<const cl_event *>(phEventWaitList),
                 cl_adapter::cast<cl_event *>(phEvent)));
@@ -437,13 +511,13 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueWriteHostPipe(
   cl_ext::clEnqueueWriteHostPipeINTEL_fn FuncPtr = nullptr;
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<cl_ext::clEnqueueWriteHostPipeINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clEnqueueWriteHostPipeINTELCache,
-          cl_ext::EnqueueWriteHostPipeName, &FuncPtr));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueWriteHostPipeINTEL,
+          &FuncPtr));
 
   if (FuncPtr) {
     CL_RETURN_ON_FAILURE(
         FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue),
-                cl_adapter::cast<cl_program>(hProgram), pipe_symbol, blocking,
+                cl_adapter::getBuiltProgram(hProgram), pipe_symbol, blocking,
                 pSrc, size, numEventsInWaitList,
                 cl_adapter::cast<const cl_event *>(phEventWaitList),
                 cl_adapter::cast<cl_event *>(phEvent)));
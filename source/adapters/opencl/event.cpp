@@ -147,6 +147,23 @@ urEventWait(uint32_t numEvents, const ur_event_handle_t *phEventWaitList) {
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventWaitAnyExp(uint32_t numEvents, const ur_event_handle_t *phEventWaitList,
+                  uint32_t *pIndex) {
+  // OpenCL has no wait for any event, its statuses are polled instead
+  auto QueryFunc = [&](uint32_t i, bool &Completed) -> ur_result_t {
+    cl_int Status = CL_QUEUED;
+    CL_RETURN_ON_FAILURE(clGetEventInfo(
+        cl_adapter::cast<cl_event>(phEventWaitList[i]),
+        CL_EVENT_COMMAND_EXECUTION_STATUS, sizeof(Status), &Status, nullptr));
+    // Negative statuses are errors, with which the command has ended
+    Completed = Status <= CL_COMPLETE;
+    return Status < CL_COMPLETE ? UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+                                : UR_RESULT_SUCCESS;
+  };
+  return ur::waitAnyEvent(numEvents, QueryFunc, *pIndex);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEventGetInfo(ur_event_handle_t hEvent,
                                                    ur_event_info_t propName,
                                                    size_t propSize,
@@ -264,3 +281,32 @@ urEnqueueTimestampRecordingExp(ur_queue_handle_t, bool, uint32_t,
                                const ur_event_handle_t *, ur_event_handle_t *) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventCreateIPCExp(ur_context_handle_t,
+                                                        ur_device_handle_t,
+                                                        ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urEventGetIPCHandleExp(ur_event_handle_t, ur_exp_ipc_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t, ur_device_handle_t, const ur_exp_ipc_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t, ur_event_handle_t, uint32_t, const ur_event_handle_t *,
+    ur_event_handle_t *) {
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
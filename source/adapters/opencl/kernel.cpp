@@ -7,11 +7,128 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 //
 //===----------------------------------------------------------------------===//
+#include "kernel.hpp"
 #include "common.hpp"
+#include "device.hpp"
+#include "program.hpp"
 
 #include <algorithm>
 #include <cstddef>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+struct KernelClones {
+  cl_uint NumArgs = 0;
+  bool CanClone = false;
+  // Tells the clones of this pool from the ones of a pool of the kernel
+  // dropped before
+  uint64_t Generation = 0;
+  // Clones which aren't checked out
+  std::vector<cl_kernel> Idle;
+};
+
+// The kernel handles are the cl_kernel themselves, so their clones are kept
+// aside, by handle. OpenCL can't tell when a kernel is destroyed, as its
+// runtime may hold references of its own, so the pool of a kernel is dropped
+// at each of its releases rather than when its count looks like the last one,
+// for a kernel created later at the same address not to get its clones.
+std::mutex KernelClonesMutex;
+std::unordered_map<ur_kernel_handle_t, KernelClones> ClonesOfKernels;
+uint64_t NextKernelClonesGeneration = 0;
+
+// Drops the clones of hKernel, for its state changed since they were cloned,
+// or it may be about to be destroyed. Clones checked out at the time are
+// released when checked in.
+void releaseKernelClones(ur_kernel_handle_t hKernel) {
+  std::vector<cl_kernel> Idle;
+  {
+    std::lock_guard<std::mutex> Lock(KernelClonesMutex);
+    auto It = ClonesOfKernels.find(hKernel);
+    if (It == ClonesOfKernels.end()) {
+      return;
+    }
+    Idle.swap(It->second.Idle);
+    ClonesOfKernels.erase(It);
+  }
+  for (cl_kernel CLClone : Idle) {
+    clReleaseKernel(CLClone);
+  }
+}
+} // namespace
+
+ur_result_t cl_adapter::checkOutKernelClone(ur_kernel_handle_t hKernel,
+                                            ur_queue_handle_t hQueue,
+                                            uint32_t numArgs,
+                                            const ur_exp_kernel_arg_t *pArgs,
+                                            cl_kernel &CLClone,
+                                            uint64_t &Generation) {
+  CLClone = nullptr;
+  cl_kernel CLKernel = cl_adapter::cast<cl_kernel>(hKernel);
+  {
+    std::lock_guard<std::mutex> Lock(KernelClonesMutex);
+    auto It = ClonesOfKernels.find(hKernel);
+    if (It == ClonesOfKernels.end()) {
+      KernelClones Clones;
+      CL_RETURN_ON_FAILURE(clGetKernelInfo(CLKernel, CL_KERNEL_NUM_ARGS,
+                                           sizeof(Clones.NumArgs),
+                                           &Clones.NumArgs, nullptr));
+      // clCloneKernel is core from OpenCL 2.1 on
+      cl_device_id CLDevice;
+      CL_RETURN_ON_FAILURE(clGetCommandQueueInfo(
+          cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_DEVICE,
+          sizeof(CLDevice), &CLDevice, nullptr));
+      oclv::OpenCLVersion DevVer;
+      UR_RETURN_ON_FAILURE(cl_adapter::getDeviceVersion(CLDevice, DevVer));
+      Clones.CanClone = DevVer >= oclv::V2_1;
+      Clones.Generation = NextKernelClonesGeneration++;
+      It = ClonesOfKernels.emplace(hKernel, std::move(Clones)).first;
+    }
+    auto &Clones = It->second;
+    Generation = Clones.Generation;
+    if (!Clones.CanClone || numArgs < Clones.NumArgs) {
+      return UR_RESULT_SUCCESS;
+    }
+    std::vector<bool> Set(Clones.NumArgs);
+    uint32_t NumSet = 0;
+    for (uint32_t i = 0; i < numArgs; i++) {
+      if (pArgs[i].index < Clones.NumArgs && !Set[pArgs[i].index]) {
+        Set[pArgs[i].index] = true;
+        NumSet++;
+      }
+    }
+    if (NumSet != Clones.NumArgs) {
+      return UR_RESULT_SUCCESS;
+    }
+    if (!Clones.Idle.empty()) {
+      CLClone = Clones.Idle.back();
+      Clones.Idle.pop_back();
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
+  // The clone takes the exec info of the kernel, and arguments which are all
+  // set again before its launch.
+  cl_int Res = CL_SUCCESS;
+  CLClone = clCloneKernel(CLKernel, &Res);
+  CL_RETURN_ON_FAILURE(Res);
+  return UR_RESULT_SUCCESS;
+}
+
+void cl_adapter::checkInKernelClone(ur_kernel_handle_t hKernel,
+                                    cl_kernel CLClone, uint64_t Generation) {
+  {
+    std::lock_guard<std::mutex> Lock(KernelClonesMutex);
+    auto It = ClonesOfKernels.find(hKernel);
+    if (It != ClonesOfKernels.end() && It->second.Generation == Generation) {
+      It->second.Idle.push_back(CLClone);
+      return;
+    }
+  }
+  clReleaseKernel(CLClone);
+}
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
@@ -19,7 +136,7 @@ urKernelCreate(ur_program_handle_t hProgram, const char *pKernelName,
 
   cl_int CLResult;
   *phKernel = cl_adapter::cast<ur_kernel_handle_t>(clCreateKernel(
-      cl_adapter::cast<cl_program>(hProgram), pKernelName, &CLResult));
+      cl_adapter::getBuiltProgram(hProgram), pKernelName, &CLResult));
   CL_RETURN_ON_FAILURE(CLResult);
   return UR_RESULT_SUCCESS;
 }
@@ -88,6 +205,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelGetInfo(ur_kernel_handle_t hKernel,
   if (pPropSizeRet) {
     *pPropSizeRet = CheckPropSize;
   }
+  // Kernels of a program built from cached binaries are another program's
+  if (pPropValue && propName == UR_KERNEL_INFO_PROGRAM) {
+    auto CLProgram = static_cast<cl_program *>(pPropValue);
+    *static_cast<ur_program_handle_t *>(pPropValue) =
+        cl_adapter::getProgramHandle(*CLProgram);
+  }
 
   return UR_RESULT_SUCCESS;
 }
@@ -243,6 +366,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelRetain(ur_kernel_handle_t hKernel) {
 
 UR_APIEXPORT ur_result_t UR_APICALL
 urKernelRelease(ur_kernel_handle_t hKernel) {
+  releaseKernelClones(hKernel);
   CL_RETURN_ON_FAILURE(clReleaseKernel(cl_adapter::cast<cl_kernel>(hKernel)));
   return UR_RESULT_SUCCESS;
 }
@@ -266,8 +390,7 @@ static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
                                        &CLContext, nullptr));
 
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-      cl_ext::HostMemAllocName, &HFunc));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clHostMemAllocINTEL, &HFunc));
 
   if (HFunc) {
     CL_RETURN_ON_FAILURE(
@@ -277,8 +400,7 @@ static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
   }
 
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clDeviceMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clDeviceMemAllocINTELCache,
-      cl_ext::DeviceMemAllocName, &DFunc));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clDeviceMemAllocINTEL, &DFunc));
 
   if (DFunc) {
     CL_RETURN_ON_FAILURE(
@@ -288,8 +410,7 @@ static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
   }
 
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clSharedMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clSharedMemAllocINTELCache,
-      cl_ext::SharedMemAllocName, &SFunc));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clSharedMemAllocINTEL, &SFunc));
 
   if (SFunc) {
     CL_RETURN_ON_FAILURE(
@@ -300,10 +421,9 @@ static ur_result_t usmSetIndirectAccess(ur_kernel_handle_t hKernel) {
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
-    ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName, size_t propSize,
-    const ur_kernel_exec_info_properties_t *, const void *pPropValue) {
-
+static ur_result_t setKernelExecInfo(ur_kernel_handle_t hKernel,
+                                     ur_kernel_exec_info_t propName,
+                                     size_t propSize, const void *pPropValue) {
   switch (propName) {
   case UR_KERNEL_EXEC_INFO_USM_INDIRECT_ACCESS: {
     if (*(static_cast<const ur_bool_t *>(pPropValue))) {
@@ -328,6 +448,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
   }
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urKernelSetExecInfo(
+    ur_kernel_handle_t hKernel, ur_kernel_exec_info_t propName, size_t propSize,
+    const ur_kernel_exec_info_properties_t *, const void *pPropValue) {
+  auto Result = setKernelExecInfo(hKernel, propName, propSize, pPropValue);
+  // The clones of the kernel would miss the new exec info. They are dropped
+  // once it's set, so that the ones cloned meanwhile are dropped too.
+  releaseKernelClones(hKernel);
+  return Result;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
     ur_kernel_handle_t hKernel, uint32_t argIndex,
     const ur_kernel_arg_pointer_properties_t *, const void *pArgValue) {
@@ -341,8 +471,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSetArgPointer(
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<clSetKernelArgMemPointerINTEL_fn>(
           CLContext,
-          cl_ext::ExtFuncPtrCache->clSetKernelArgMemPointerINTELCache,
-          cl_ext::SetKernelArgMemPointerName, &FuncPtr));
+          &cl_ext::ExtFuncPtrTableT::clSetKernelArgMemPointerINTEL, &FuncPtr));
 
   if (FuncPtr) {
     CL_RETURN_ON_FAILURE(FuncPtr(cl_adapter::cast<cl_kernel>(hKernel),
@@ -366,6 +495,47 @@ UR_APIEXPORT ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     [[maybe_unused]] uint32_t *pGroupCountRet) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+UR_APIEXPORT ur_result_t UR_APICALL
+urKernelSetArgsExp(ur_kernel_handle_t hKernel, uint32_t numArgs,
+                   const ur_exp_kernel_arg_t *pArgs) {
+  for (uint32_t i = 0; i < numArgs; i++) {
+    const auto &Arg = pArgs[i];
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    switch (Arg.type) {
+    case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+      Result = urKernelSetArgValue(hKernel, Arg.index, Arg.size, nullptr,
+                                   Arg.value.value);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+      Result =
+          urKernelSetArgPointer(hKernel, Arg.index, nullptr, Arg.value.pointer);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+      ur_kernel_arg_mem_obj_properties_t Properties = {
+          UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+          Arg.value.memObjTuple.flags ? Arg.value.memObjTuple.flags
+                                      : UR_MEM_FLAG_READ_WRITE};
+      Result = urKernelSetArgMemObj(hKernel, Arg.index, &Properties,
+                                    Arg.value.memObjTuple.hMem);
+      break;
+    }
+    case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+      Result = urKernelSetArgLocal(hKernel, Arg.index, Arg.size, nullptr);
+      break;
+    case UR_EXP_KERNEL_ARG_TYPE_SAMPLER:
+      Result =
+          urKernelSetArgSampler(hKernel, Arg.index, nullptr, Arg.value.sampler);
+      break;
+    default:
+      return UR_RESULT_ERROR_INVALID_ENUMERATION;
+    }
+    if (Result != UR_RESULT_SUCCESS) {
+      return Result;
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
+
 
 UR_APIEXPORT ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     ur_native_handle_t hNativeKernel, ur_context_handle_t, ur_program_handle_t,
@@ -0,0 +1,37 @@
+//===--------- kernel.hpp - OpenCL Adapter --------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+
+#include <cstdint>
+
+namespace cl_adapter {
+// The arguments of a cl_kernel can't be set from several threads at once, so
+// launches which set all the arguments of their kernel run on a clone of it
+// instead, kept in a pool of the kernel between launches. An enqueue captures
+// the arguments of its kernel, so a clone goes back to the pool as soon as it
+// is enqueued.
+
+// Checks a clone of hKernel out of its pool for a launch setting the numArgs
+// arguments of pArgs. CLClone is null when the arguments don't cover all the
+// arguments of hKernel, or when the device of hQueue can't clone kernels, in
+// which case the launch sets them on hKernel itself. Generation is the one of
+// the pool at the time.
+ur_result_t checkOutKernelClone(ur_kernel_handle_t hKernel,
+                                ur_queue_handle_t hQueue, uint32_t numArgs,
+                                const ur_exp_kernel_arg_t *pArgs,
+                                cl_kernel &CLClone, uint64_t &Generation);
+
+// Puts a clone checked out of the pool of hKernel back into it, unless the
+// pool was dropped since, with the clones of its Generation
+void checkInKernelClone(ur_kernel_handle_t hKernel, cl_kernel CLClone,
+                        uint64_t Generation);
+} // namespace cl_adapter
@@ -215,10 +215,32 @@ cl_map_flags convertURMemFlagsToCL(ur_mem_flags_t URFlags) {
   return CLFlags;
 }
 
+// Whether all the devices of the context share the memory of the host, in
+// which case buffers allocated in host memory are mapped without a copy.
+static ur_result_t isHostUnifiedContext(ur_context_handle_t hContext,
+                                        bool &HostUnified) {
+  const cl_ext::ExtFuncPtrTableT *Table;
+  UR_RETURN_ON_FAILURE(cl_ext::ExtFuncPtrCache->getTable(
+      cl_adapter::cast<cl_context>(hContext), &Table));
+  HostUnified = Table->HostUnified;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
     ur_context_handle_t hContext, ur_mem_flags_t flags, size_t size,
     const ur_buffer_properties_t *pProperties, ur_mem_handle_t *phBuffer) {
 
+  // Buffers of integrated devices are allocated in host memory, unless they
+  // use the host pointer they are created with, so that mapping them, and
+  // reading or writing them through a map, doesn't copy them.
+  if (!(flags & UR_MEM_FLAG_USE_HOST_POINTER)) {
+    bool HostUnified = false;
+    UR_RETURN_ON_FAILURE(isHostUnifiedContext(hContext, HostUnified));
+    if (HostUnified) {
+      flags |= UR_MEM_FLAG_ALLOC_HOST_POINTER;
+    }
+  }
+
   cl_int RetErr = CL_INVALID_OPERATION;
   if (pProperties) {
     // TODO: need to check if all properties are supported by OpenCL RT and
@@ -229,8 +251,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urMemBufferCreate(
     RetErr =
         cl_ext::getExtFuncFromContext<clCreateBufferWithPropertiesINTEL_fn>(
             CLContext,
-            cl_ext::ExtFuncPtrCache->clCreateBufferWithPropertiesINTELCache,
-            cl_ext::CreateBufferWithPropertiesName, &FuncPtr);
+            &cl_ext::ExtFuncPtrTableT::clCreateBufferWithPropertiesINTEL,
+            &FuncPtr);
     if (FuncPtr) {
       std::vector<cl_mem_properties_intel> PropertiesIntel;
       auto Prop = static_cast<ur_base_properties_t *>(pProperties->pNext);
@@ -1,4 +1,4 @@
-//===--------- platform.cpp - OpenCL Adapter ---------------------------===//
+//===--------- program.cpp - OpenCL Adapter ---------------------------===//
 //
 // Copyright (C) 2023 Intel Corporation
 //
@@ -8,10 +8,84 @@
 //
 //===----------------------------------------------------------------------===//
 
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+
+#include "adapter.hpp"
 #include "common.hpp"
 #include "context.hpp"
 #include "device.hpp"
 #include "platform.hpp"
+#include "program.hpp"
+#include "program_cache.hpp"
+
+namespace {
+// What the build of a program created from IL depends on, while the program
+// cache is enabled
+struct CachedProgramInfo {
+  std::string ILDesc;
+  std::map<uint32_t, std::vector<uint8_t>> SpecConstants;
+  // Program built from the cached binaries, null if hProgram was built itself
+  cl_program BuiltProgram = nullptr;
+  // Options BuiltProgram was built with, and whether hProgram was also built
+  // with them for its native handle
+  std::string BuildOptions;
+  bool HandleBuilt = false;
+};
+
+// The program handles are the cl_program themselves, so their build info is
+// kept aside, by handle.
+std::shared_mutex CachedProgramsMutex;
+std::unordered_map<ur_program_handle_t, CachedProgramInfo> CachedPrograms;
+// Handles of the BuiltProgram of CachedPrograms, which kernels map back to
+std::unordered_map<cl_program, ur_program_handle_t> BuiltProgramHandles;
+// Size of BuiltProgramHandles, so that kernel creation and the other users
+// of the programs don't look them up unless some were built from the cache
+std::atomic<size_t> NumBuiltPrograms{0};
+
+// Sets the program hProgram was built into, with CachedProgramsMutex held
+void setBuiltProgram(ur_program_handle_t hProgram, CachedProgramInfo &Info,
+                     cl_program BuiltProgram) {
+  if (Info.BuiltProgram) {
+    BuiltProgramHandles.erase(Info.BuiltProgram);
+    clReleaseProgram(Info.BuiltProgram);
+  }
+  Info.BuiltProgram = BuiltProgram;
+  Info.HandleBuilt = false;
+  if (BuiltProgram) {
+    BuiltProgramHandles[BuiltProgram] = hProgram;
+  }
+  NumBuiltPrograms.store(BuiltProgramHandles.size(),
+                         std::memory_order_release);
+}
+} // namespace
+
+cl_program cl_adapter::getBuiltProgram(ur_program_handle_t hProgram) {
+  if (NumBuiltPrograms.load(std::memory_order_acquire)) {
+    std::shared_lock<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = CachedPrograms.find(hProgram);
+    if (It != CachedPrograms.end() && It->second.BuiltProgram) {
+      return It->second.BuiltProgram;
+    }
+  }
+  return cl_adapter::cast<cl_program>(hProgram);
+}
+
+ur_program_handle_t cl_adapter::getProgramHandle(cl_program CLProgram) {
+  if (NumBuiltPrograms.load(std::memory_order_acquire)) {
+    std::shared_lock<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = BuiltProgramHandles.find(CLProgram);
+    if (It != BuiltProgramHandles.end()) {
+      return It->second;
+    }
+  }
+  return cl_adapter::cast<ur_program_handle_t>(CLProgram);
+}
 
 static ur_result_t getDevicesFromProgram(
     ur_program_handle_t hProgram,
@@ -112,6 +186,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramCreateWithIL(
     CL_RETURN_ON_FAILURE(Err);
   }
 
+  if (ProgramCache::get()) {
+    std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+    CachedPrograms[*phProgram] =
+        CachedProgramInfo{ProgramCache::describeIL(pIL, length)};
+  }
+
   return UR_RESULT_SUCCESS;
 }
 
@@ -177,10 +257,15 @@ static cl_int mapURProgramInfoToCL(ur_program_info_t URPropName) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
                  size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+  // The binaries and kernels are the built program's
+  cl_program CLProgram = propName == UR_PROGRAM_INFO_REFERENCE_COUNT ||
+                                 propName == UR_PROGRAM_INFO_IL
+                             ? cl_adapter::cast<cl_program>(hProgram)
+                             : cl_adapter::getBuiltProgram(hProgram);
   size_t CheckPropSize = 0;
-  auto ClResult = clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
-                                   mapURProgramInfoToCL(propName), propSize,
-                                   pPropValue, &CheckPropSize);
+  auto ClResult =
+      clGetProgramInfo(CLProgram, mapURProgramInfoToCL(propName), propSize,
+                       pPropValue, &CheckPropSize);
   if (pPropValue && CheckPropSize != propSize) {
     return UR_RESULT_ERROR_INVALID_SIZE;
   }
@@ -191,6 +276,86 @@ urProgramGetInfo(ur_program_handle_t hProgram, ur_program_info_t propName,
   return UR_RESULT_SUCCESS;
 }
 
+// Builds hProgram from the binaries cached for all its devices, into another
+// program running its kernels. Returns false if the binaries aren't all
+// cached, or don't build.
+static bool buildFromCache(const ProgramCache &Cache,
+                           ur_program_handle_t hProgram,
+                           const std::vector<cl_device_id> &Devices,
+                           const std::vector<std::string> &Keys,
+                           const char *pOptions) {
+  std::vector<std::vector<uint8_t>> Binaries;
+  for (auto &Key : Keys) {
+    auto Binary = Cache.load(Key);
+    if (!Binary) {
+      return false;
+    }
+    Binaries.push_back(std::move(*Binary));
+  }
+
+  std::vector<size_t> Lengths;
+  std::vector<const unsigned char *> BinaryPtrs;
+  for (auto &Binary : Binaries) {
+    Lengths.push_back(Binary.size());
+    BinaryPtrs.push_back(Binary.data());
+  }
+
+  cl_context CLContext = nullptr;
+  if (clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
+                       CL_PROGRAM_CONTEXT, sizeof(CLContext), &CLContext,
+                       nullptr) != CL_SUCCESS) {
+    return false;
+  }
+  cl_int CLResult = CL_SUCCESS;
+  cl_program BuiltProgram = clCreateProgramWithBinary(
+      CLContext, Devices.size(), Devices.data(), Lengths.data(),
+      BinaryPtrs.data(), nullptr, &CLResult);
+  if (CLResult != CL_SUCCESS) {
+    return false;
+  }
+  // Binaries of stale drivers fail here, and are rebuilt from the IL
+  if (clBuildProgram(BuiltProgram, Devices.size(), Devices.data(), pOptions,
+                     nullptr, nullptr) != CL_SUCCESS) {
+    clReleaseProgram(BuiltProgram);
+    return false;
+  }
+
+  std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+  auto &Info = CachedPrograms[hProgram];
+  setBuiltProgram(hProgram, Info, BuiltProgram);
+  Info.BuildOptions = pOptions ? pOptions : "";
+  return true;
+}
+
+// Stores the binaries of hProgram, just built from its IL
+static void storeInCache(const ProgramCache &Cache,
+                         ur_program_handle_t hProgram,
+                         const std::vector<std::string> &Keys) {
+  cl_program CLProgram = cl_adapter::cast<cl_program>(hProgram);
+  std::vector<size_t> Sizes(Keys.size());
+  if (clGetProgramInfo(CLProgram, CL_PROGRAM_BINARY_SIZES,
+                       Sizes.size() * sizeof(size_t), Sizes.data(),
+                       nullptr) != CL_SUCCESS) {
+    return;
+  }
+  std::vector<std::vector<uint8_t>> Binaries(Keys.size());
+  std::vector<unsigned char *> BinaryPtrs(Keys.size());
+  for (size_t I = 0; I < Keys.size(); ++I) {
+    Binaries[I].resize(Sizes[I]);
+    BinaryPtrs[I] = Binaries[I].data();
+  }
+  if (clGetProgramInfo(CLProgram, CL_PROGRAM_BINARIES,
+                       BinaryPtrs.size() * sizeof(unsigned char *),
+                       BinaryPtrs.data(), nullptr) != CL_SUCCESS) {
+    return;
+  }
+  for (size_t I = 0; I < Keys.size(); ++I) {
+    if (!Binaries[I].empty()) {
+      Cache.store(Keys[I], Binaries[I]);
+    }
+  }
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramBuild([[maybe_unused]] ur_context_handle_t hContext,
                ur_program_handle_t hProgram, const char *pOptions) {
@@ -198,9 +363,97 @@ urProgramBuild([[maybe_unused]] ur_context_handle_t hContext,
   std::unique_ptr<std::vector<cl_device_id>> DevicesInProgram;
   UR_RETURN_ON_FAILURE(getDevicesFromProgram(hProgram, DevicesInProgram));
 
+  // Only the programs created from IL are cached, the devices of the others
+  // already get their binaries.
+  auto Cache = ProgramCache::get();
+  std::optional<CachedProgramInfo> Info;
+  if (Cache) {
+    std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = CachedPrograms.find(hProgram);
+    if (It != CachedPrograms.end()) {
+      // A program built again runs the kernels of its new build
+      setBuiltProgram(hProgram, It->second, nullptr);
+      Info = It->second;
+    }
+  }
+
+  std::vector<std::string> Keys;
+  if (Info) {
+    for (auto Device : *DevicesInProgram) {
+      UR_RETURN_ON_FAILURE(ProgramCache::makeKey(
+          Device, Info->ILDesc, Info->SpecConstants,
+          pOptions ? pOptions : "", Keys.emplace_back()));
+    }
+    if (buildFromCache(*Cache, hProgram, *DevicesInProgram, Keys, pOptions)) {
+      return UR_RESULT_SUCCESS;
+    }
+  }
+
   CL_RETURN_ON_FAILURE(clBuildProgram(
       cl_adapter::cast<cl_program>(hProgram), DevicesInProgram->size(),
       DevicesInProgram->data(), pOptions, nullptr, nullptr));
+
+  if (Info) {
+    storeInCache(*Cache, hProgram, Keys);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urProgramBuildAsyncExp(ur_program_handle_t hProgram, ur_queue_handle_t hQueue,
+                       const char *pOptions, ur_event_handle_t *phEvent) {
+  cl_program CLProgram = cl_adapter::cast<cl_program>(hProgram);
+  cl_context CLContext;
+  CL_RETURN_ON_FAILURE(clGetProgramInfo(CLProgram, CL_PROGRAM_CONTEXT,
+                                        sizeof(CLContext), &CLContext,
+                                        nullptr));
+  cl_context QueueContext;
+  CL_RETURN_ON_FAILURE(
+      clGetCommandQueueInfo(cl_adapter::cast<cl_command_queue>(hQueue),
+                            CL_QUEUE_CONTEXT, sizeof(QueueContext),
+                            &QueueContext, nullptr));
+  if (QueueContext != CLContext) {
+    return UR_RESULT_ERROR_INVALID_CONTEXT;
+  }
+
+  // A user event completed by the build thread of the adapter, which also
+  // goes through the program cache, rather than clBuildProgram's notification
+  // callback. The event isn't associated with hQueue, but can be waited on by
+  // any command of the context all the same.
+  cl_int CLResult;
+  cl_event Built = clCreateUserEvent(CLContext, &CLResult);
+  CL_RETURN_ON_FAILURE(CLResult);
+
+  std::optional<std::string> Options;
+  if (pOptions) {
+    Options = pOptions;
+  }
+  // The build holds references on the program and the event until it has
+  // completed
+  clRetainProgram(CLProgram);
+  clRetainEvent(Built);
+  try {
+    cl_adapter::runInBackground([CLProgram, CLContext, Built,
+                                 Options = std::move(Options)] {
+      ur_result_t Result = urProgramBuild(
+          cl_adapter::cast<ur_context_handle_t>(CLContext),
+          cl_adapter::cast<ur_program_handle_t>(CLProgram),
+          Options ? Options->c_str() : nullptr);
+      clSetUserEventStatus(Built, Result == UR_RESULT_SUCCESS
+                                      ? CL_COMPLETE
+                                      : CL_BUILD_PROGRAM_FAILURE);
+      clReleaseEvent(Built);
+      clReleaseProgram(CLProgram);
+    });
+  } catch (...) {
+    // The references of the build, and the event itself
+    clReleaseProgram(CLProgram);
+    clReleaseEvent(Built);
+    clReleaseEvent(Built);
+    return UR_RESULT_ERROR_OUT_OF_RESOURCES;
+  }
+
+  *phEvent = cl_adapter::cast<ur_event_handle_t>(Built);
   return UR_RESULT_SUCCESS;
 }
 
@@ -297,14 +550,14 @@ urProgramGetBuildInfo(ur_program_handle_t hProgram, ur_device_handle_t hDevice,
     UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
     cl_program_binary_type BinaryType;
     CL_RETURN_ON_FAILURE(clGetProgramBuildInfo(
-        cl_adapter::cast<cl_program>(hProgram),
+        cl_adapter::getBuiltProgram(hProgram),
         cl_adapter::cast<cl_device_id>(hDevice),
         mapURProgramBuildInfoToCL(propName), sizeof(cl_program_binary_type),
         &BinaryType, nullptr));
     return ReturnValue(mapCLBinaryTypeToUR(BinaryType));
   }
   size_t CheckPropSize = 0;
-  cl_int ClErr = clGetProgramBuildInfo(cl_adapter::cast<cl_program>(hProgram),
+  cl_int ClErr = clGetProgramBuildInfo(cl_adapter::getBuiltProgram(hProgram),
                                        cl_adapter::cast<cl_device_id>(hDevice),
                                        mapURProgramBuildInfoToCL(propName),
                                        propSize, pPropValue, &CheckPropSize);
@@ -329,6 +582,22 @@ urProgramRetain(ur_program_handle_t hProgram) {
 UR_APIEXPORT ur_result_t UR_APICALL
 urProgramRelease(ur_program_handle_t hProgram) {
 
+  if (ProgramCache::get()) {
+    cl_uint RefCount = 0;
+    CL_RETURN_ON_FAILURE(clGetProgramInfo(
+        cl_adapter::cast<cl_program>(hProgram), CL_PROGRAM_REFERENCE_COUNT,
+        sizeof(RefCount), &RefCount, nullptr));
+    // The kernels of the built program keep it alive as long as they need it
+    if (RefCount == 1) {
+      std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+      auto It = CachedPrograms.find(hProgram);
+      if (It != CachedPrograms.end()) {
+        setBuiltProgram(hProgram, It->second, nullptr);
+        CachedPrograms.erase(It);
+      }
+    }
+  }
+
   CL_RETURN_ON_FAILURE(
       clReleaseProgram(cl_adapter::cast<cl_program>(hProgram)));
   return UR_RESULT_SUCCESS;
@@ -337,6 +606,29 @@ urProgramRelease(ur_program_handle_t hProgram) {
 UR_APIEXPORT ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_program_handle_t hProgram, ur_native_handle_t *phNativeProgram) {
 
+  // The native handle is hProgram itself, as created, so that it round-trips
+  // through urProgramCreateWithNativeHandle. If its kernels come from the
+  // program cache it is built from its IL too, for the native kernels created
+  // from it.
+  std::optional<std::string> BuildOptions;
+  if (NumBuiltPrograms.load(std::memory_order_acquire)) {
+    std::shared_lock<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = CachedPrograms.find(hProgram);
+    if (It != CachedPrograms.end() && It->second.BuiltProgram &&
+        !It->second.HandleBuilt) {
+      BuildOptions = It->second.BuildOptions;
+    }
+  }
+  if (BuildOptions) {
+    CL_RETURN_ON_FAILURE(clBuildProgram(cl_adapter::cast<cl_program>(hProgram),
+                                        0, nullptr, BuildOptions->c_str(),
+                                        nullptr, nullptr));
+    std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = CachedPrograms.find(hProgram);
+    if (It != CachedPrograms.end()) {
+      It->second.HandleBuilt = true;
+    }
+  }
   *phNativeProgram = reinterpret_cast<ur_native_handle_t>(hProgram);
   return UR_RESULT_SUCCESS;
 }
@@ -402,8 +694,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         SetProgramSpecializationConstant = nullptr;
     const ur_result_t URResult = cl_ext::getExtFuncFromContext<
         decltype(SetProgramSpecializationConstant)>(
-        Ctx, cl_ext::ExtFuncPtrCache->clSetProgramSpecializationConstantCache,
-        cl_ext::SetProgramSpecializationConstantName,
+        Ctx, &cl_ext::ExtFuncPtrTableT::clSetProgramSpecializationConstant,
         &SetProgramSpecializationConstant);
 
     if (URResult != UR_RESULT_SUCCESS) {
@@ -416,6 +707,18 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramSetSpecializationConstants(
           pSpecConstants[i].pValue));
     }
   }
+
+  if (ProgramCache::get()) {
+    std::lock_guard<std::shared_mutex> Lock(CachedProgramsMutex);
+    auto It = CachedPrograms.find(hProgram);
+    if (It != CachedPrograms.end()) {
+      for (uint32_t i = 0; i < count; ++i) {
+        auto Value = static_cast<const uint8_t *>(pSpecConstants[i].pValue);
+        It->second.SpecConstants[pSpecConstants[i].id].assign(
+            Value, Value + pSpecConstants[i].size);
+      }
+    }
+  }
   return UR_RESULT_SUCCESS;
 }
 
@@ -458,8 +761,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
 
   UR_RETURN_ON_FAILURE(
       cl_ext::getExtFuncFromContext<cl_ext::clGetDeviceFunctionPointer_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clGetDeviceFunctionPointerCache,
-          cl_ext::GetDeviceFunctionPointerName, &FuncT));
+          CLContext, &cl_ext::ExtFuncPtrTableT::clGetDeviceFunctionPointer,
+          &FuncT));
 
   // Check if the kernel name exists to prevent the OpenCL runtime from throwing
   // an exception with the cpu runtime.
@@ -467,16 +770,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   // extension does not exist. Can only be done once the CPU runtime no longer
   // throws exceptions.
   *ppFunctionPointer = 0;
+  cl_program CLProgram = cl_adapter::getBuiltProgram(hProgram);
   size_t Size;
-  CL_RETURN_ON_FAILURE(clGetProgramInfo(cl_adapter::cast<cl_program>(hProgram),
-                                        CL_PROGRAM_KERNEL_NAMES, 0, nullptr,
-                                        &Size));
+  CL_RETURN_ON_FAILURE(clGetProgramInfo(CLProgram, CL_PROGRAM_KERNEL_NAMES, 0,
+                                        nullptr, &Size));
 
   std::string KernelNames(Size, ' ');
 
-  CL_RETURN_ON_FAILURE(clGetProgramInfo(
-      cl_adapter::cast<cl_program>(hProgram), CL_PROGRAM_KERNEL_NAMES,
-      KernelNames.size(), &KernelNames[0], nullptr));
+  CL_RETURN_ON_FAILURE(clGetProgramInfo(CLProgram, CL_PROGRAM_KERNEL_NAMES,
+                                        KernelNames.size(), &KernelNames[0],
+                                        nullptr));
 
   // Get rid of the null terminator and search for the kernel name. If the
   // function cannot be found, return an error code to indicate it exists.
@@ -486,8 +789,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetFunctionPointer(
   }
 
   const cl_int CLResult =
-      FuncT(cl_adapter::cast<cl_device_id>(hDevice),
-            cl_adapter::cast<cl_program>(hProgram), pFunctionName,
+      FuncT(cl_adapter::cast<cl_device_id>(hDevice), CLProgram, pFunctionName,
             reinterpret_cast<cl_ulong *>(ppFunctionPointer));
   // GPU runtime sometimes returns CL_INVALID_ARG_VALUE if the function address
   // cannot be found but the kernel exists. As the kernel does exist, return
@@ -516,12 +818,12 @@ UR_APIEXPORT ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
 
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<
                        cl_ext::clGetDeviceGlobalVariablePointer_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetDeviceGlobalVariablePointerCache,
-      cl_ext::GetDeviceGlobalVariablePointerName, &FuncT));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clGetDeviceGlobalVariablePointer,
+      &FuncT));
 
   const cl_int CLResult =
       FuncT(cl_adapter::cast<cl_device_id>(hDevice),
-            cl_adapter::cast<cl_program>(hProgram), pGlobalVariableName,
+            cl_adapter::getBuiltProgram(hProgram), pGlobalVariableName,
             pGlobalVariableSizeRet, ppGlobalVariablePointerRet);
 
   if (CLResult != CL_SUCCESS) {
@@ -0,0 +1,22 @@
+//===--------- program.hpp - OpenCL Adapter -------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include "common.hpp"
+
+namespace cl_adapter {
+// Returns the cl_program running the kernels of hProgram. That's hProgram
+// itself, unless it was built from a binary of the program cache, in which
+// case the binary is another cl_program.
+cl_program getBuiltProgram(ur_program_handle_t hProgram);
+
+// Returns the handle of the program whose kernels CLProgram runs
+ur_program_handle_t getProgramHandle(cl_program CLProgram);
+} // namespace cl_adapter
@@ -0,0 +1,89 @@
+//===--------- program_cache.cpp - OpenCL Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+
+#include <memory>
+#include <sstream>
+
+#include "common.hpp"
+#include "program_cache.hpp"
+#include "ur_util.hpp"
+
+namespace {
+
+constexpr const char *CacheMagic = "ur-opencl-program-cache-v1";
+
+ur_result_t getDeviceString(cl_device_id Device, cl_device_info Name,
+                            std::string &Value) {
+  size_t Size = 0;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Device, Name, 0, nullptr, &Size));
+  Value.assign(Size, '\0');
+  CL_RETURN_ON_FAILURE(
+      clGetDeviceInfo(Device, Name, Size, Value.data(), nullptr));
+  // Without the null terminator
+  if (!Value.empty()) {
+    Value.pop_back();
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+} // namespace
+
+ProgramCache::ProgramCache(filesystem::path Dir)
+    : Files(std::move(Dir), CacheMagic, ".bin") {}
+
+ProgramCache *ProgramCache::get() {
+  static std::unique_ptr<ProgramCache> Cache =
+      []() -> std::unique_ptr<ProgramCache> {
+    auto Dir = ur_getenv("UR_OPENCL_PROGRAM_CACHE_DIR");
+    if (!Dir || Dir->empty())
+      return nullptr;
+    return std::make_unique<ProgramCache>(filesystem::path(*Dir));
+  }();
+  return Cache.get();
+}
+
+std::string ProgramCache::describeIL(const void *IL, size_t Length) {
+  std::ostringstream Desc;
+  Desc << Length << ':' << std::hex << ur::hashBytes(IL, Length);
+  return Desc.str();
+}
+
+ur_result_t ProgramCache::makeKey(
+    cl_device_id Device, const std::string &ILDesc,
+    const std::map<uint32_t, std::vector<uint8_t>> &SpecConstants,
+    const std::string &Options, std::string &Key) {
+  std::string DeviceName;
+  std::string DeviceVersion;
+  std::string DriverVersion;
+  UR_RETURN_ON_FAILURE(getDeviceString(Device, CL_DEVICE_NAME, DeviceName));
+  UR_RETURN_ON_FAILURE(
+      getDeviceString(Device, CL_DEVICE_VERSION, DeviceVersion));
+  UR_RETURN_ON_FAILURE(
+      getDeviceString(Device, CL_DRIVER_VERSION, DriverVersion));
+  cl_uint VendorId = 0;
+  CL_RETURN_ON_FAILURE(clGetDeviceInfo(Device, CL_DEVICE_VENDOR_ID,
+                                       sizeof(VendorId), &VendorId, nullptr));
+
+  std::ostringstream KeyStream;
+  KeyStream << DriverVersion << ';' << DeviceVersion << ';' << std::hex
+            << VendorId << ';' << DeviceName << ';' << ILDesc << ';';
+  // In SpecID order, the order they were set in doesn't matter
+  for (auto &[Id, Value] : SpecConstants) {
+    KeyStream << Id << '=';
+    for (auto Byte : Value) {
+      KeyStream << static_cast<unsigned>(Byte >> 4)
+                << static_cast<unsigned>(Byte & 0xf);
+    }
+    KeyStream << ',';
+  }
+  KeyStream << ';' << Options;
+  Key = KeyStream.str();
+  return UR_RESULT_SUCCESS;
+}
@@ -0,0 +1,57 @@
+//===--------- program_cache.hpp - OpenCL Adapter -------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include <CL/cl.h>
+#include <ur_api.h>
+
+#include "ur_binary_file_cache.hpp"
+
+// On-disk cache of the binaries built from the IL of programs, enabled by
+// pointing UR_OPENCL_PROGRAM_CACHE_DIR at a directory. A binary is keyed by
+// all its build depends on: the IL, the specialization constants, the build
+// options, the device and its driver version. The key is stored along with
+// the binary, so that a hash collision can't load the wrong one.
+class ProgramCache {
+public:
+  explicit ProgramCache(filesystem::path Dir);
+
+  // Returns the cache selected by UR_OPENCL_PROGRAM_CACHE_DIR, or nullptr
+  static ProgramCache *get();
+
+  // Describes the IL of a program, the part of its keys common to all devices
+  static std::string describeIL(const void *IL, size_t Length);
+
+  // Describes the build for Device of the IL described by ILDesc into Key
+  static ur_result_t
+  makeKey(cl_device_id Device, const std::string &ILDesc,
+          const std::map<uint32_t, std::vector<uint8_t>> &SpecConstants,
+          const std::string &Options, std::string &Key);
+
+  // Returns the binary stored for Key, if any
+  std::optional<std::vector<uint8_t>> load(const std::string &Key) const {
+    return Files.load(Key);
+  }
+
+  // Stores Binary for Key. Concurrent stores of the same key don't see
+  // partial files.
+  void store(const std::string &Key, const std::vector<uint8_t> &Binary) const {
+    Files.store(Key, Binary.data(), Binary.size());
+  }
+
+private:
+  ur::binary_file_cache Files;
+};
@@ -184,6 +184,19 @@ UR_APIEXPORT ur_result_t UR_APICALL urQueueFlush(ur_queue_handle_t hQueue) {
   return UR_RESULT_SUCCESS;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL
+urQueueBeginCaptureExp(ur_queue_handle_t hQueue) {
+  std::ignore = hQueue;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t hQueue, ur_exp_command_buffer_handle_t *phCommandBuffer) {
+  std::ignore = hQueue;
+  std::ignore = phCommandBuffer;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urQueueRetain(ur_queue_handle_t hQueue) {
   cl_int RetErr =
       clRetainCommandQueue(cl_adapter::cast<cl_command_queue>(hQueue));
@@ -80,6 +80,19 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ur_event_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnWaitAnyExp = urEventWaitAnyExp;
+  pDdiTable->pfnCreateIPCExp = urEventCreateIPCExp;
+  pDdiTable->pfnGetIPCHandleExp = urEventGetIPCHandleExp;
+  pDdiTable->pfnOpenIPCHandleExp = urEventOpenIPCHandleExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_api_version_t Version, ur_program_dditable_t *pDdiTable) {
   auto Result = validateProcInputs(Version, pDdiTable);
@@ -228,6 +241,17 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
   return UR_RESULT_SUCCESS;
 }
 
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ur_queue_exp_dditable_t *pDdiTable) {
+  auto result = validateProcInputs(version, pDdiTable);
+  if (UR_RESULT_SUCCESS != result) {
+    return result;
+  }
+  pDdiTable->pfnBeginCaptureExp = urQueueBeginCaptureExp;
+  pDdiTable->pfnEndCaptureExp = urQueueEndCaptureExp;
+  return UR_RESULT_SUCCESS;
+}
+
 UR_DLLEXPORT ur_result_t UR_APICALL
 urGetUSMProcAddrTable(ur_api_version_t Version, ur_usm_dditable_t *pDdiTable) {
   auto Result = validateProcInputs(Version, pDdiTable);
@@ -238,10 +262,10 @@ urGetUSMProcAddrTable(ur_api_version_t Version, ur_usm_dditable_t *pDdiTable) {
   pDdiTable->pfnFree = urUSMFree;
   pDdiTable->pfnGetMemAllocInfo = urUSMGetMemAllocInfo;
   pDdiTable->pfnHostAlloc = urUSMHostAlloc;
-  pDdiTable->pfnPoolCreate = nullptr;
-  pDdiTable->pfnPoolRetain = nullptr;
-  pDdiTable->pfnPoolRelease = nullptr;
-  pDdiTable->pfnPoolGetInfo = nullptr;
+  pDdiTable->pfnPoolCreate = urUSMPoolCreate;
+  pDdiTable->pfnPoolRetain = urUSMPoolRetain;
+  pDdiTable->pfnPoolRelease = urUSMPoolRelease;
+  pDdiTable->pfnPoolGetInfo = urUSMPoolGetInfo;
   pDdiTable->pfnSharedAlloc = urUSMSharedAlloc;
   return UR_RESULT_SUCCESS;
 }
@@ -255,6 +279,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
 
   pDdiTable->pfnImportExp = urUSMImportExp;
   pDdiTable->pfnReleaseExp = urUSMReleaseExp;
+  pDdiTable->pfnPoolTrimExp = urUSMPoolTrimExp;
   return UR_RESULT_SUCCESS;
 }
 
@@ -306,6 +331,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
   pDdiTable->pfnUpdateKernelLaunchExp = urCommandBufferUpdateKernelLaunchExp;
   pDdiTable->pfnGetInfoExp = urCommandBufferGetInfoExp;
   pDdiTable->pfnCommandGetInfoExp = urCommandBufferCommandGetInfoExp;
+  pDdiTable->pfnUpdateKernelLaunchBatchExp =
+      urCommandBufferUpdateKernelLaunchBatchExp;
+  pDdiTable->pfnUploadExp = urCommandBufferUploadExp;
   pDdiTable->pfnReleaseCommandExp = urCommandBufferReleaseCommandExp;
   pDdiTable->pfnRetainCommandExp = urCommandBufferRetainCommandExp;
   pDdiTable->pfnUpdateWaitEventsExp = urCommandBufferUpdateWaitEventsExp;
@@ -343,6 +371,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
       urBindlessImagesUnsampledImageCreateExp;
   pDdiTable->pfnSampledImageCreateExp = urBindlessImagesSampledImageCreateExp;
   pDdiTable->pfnImageCopyExp = urBindlessImagesImageCopyExp;
+  pDdiTable->pfnImageCopyBatchExp = urBindlessImagesImageCopyBatchExp;
   pDdiTable->pfnImageGetInfoExp = urBindlessImagesImageGetInfoExp;
   pDdiTable->pfnMipmapGetLevelExp = urBindlessImagesMipmapGetLevelExp;
   pDdiTable->pfnMipmapFreeExp = urBindlessImagesMipmapFreeExp;
@@ -406,7 +435,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
   pDdiTable->pfnCooperativeKernelLaunchExp =
       urEnqueueCooperativeKernelLaunchExp;
   pDdiTable->pfnTimestampRecordingExp = urEnqueueTimestampRecordingExp;
+  pDdiTable->pfnKernelLaunchMultiExp = urEnqueueKernelLaunchMultiExp;
   pDdiTable->pfnNativeCommandExp = urEnqueueNativeCommandExp;
+  pDdiTable->pfnHostTaskExp = urEnqueueHostTaskExp;
+  pDdiTable->pfnIPCEventSignalExp = urEnqueueIPCEventSignalExp;
+  pDdiTable->pfnIPCEventWaitExp = urEnqueueIPCEventWaitExp;
+  pDdiTable->pfnUSMMemcpyBatchExp = urEnqueueUSMMemcpyBatchExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -420,6 +454,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
   pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
       urKernelSuggestMaxCooperativeGroupCountExp;
+  pDdiTable->pfnSetArgsExp = urKernelSetArgsExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -434,6 +469,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
   pDdiTable->pfnBuildExp = urProgramBuildExp;
   pDdiTable->pfnCompileExp = urProgramCompileExp;
   pDdiTable->pfnLinkExp = urProgramLinkExp;
+  pDdiTable->pfnBuildAsyncExp = urProgramBuildAsyncExp;
 
   return UR_RESULT_SUCCESS;
 }
@@ -10,7 +10,11 @@
 
 #include <ur/ur.hpp>
 
+#include <algorithm>
+#include <set>
+
 #include "common.hpp"
+#include "usm.hpp"
 
 namespace umf {
 ur_result_t getProviderNativeError(const char *, int32_t) {
@@ -87,168 +91,246 @@ usmDescToCLMemProperties(const ur_base_desc_t *Desc,
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
-               ur_usm_pool_handle_t, size_t size, void **ppMem) {
-
-  void *Ptr = nullptr;
-  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
-
-  if (pUSMDesc && pUSMDesc->align != 0 &&
-      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  }
-
-  std::vector<cl_mem_properties_intel> AllocProperties;
-  if (pUSMDesc && pUSMDesc->pNext) {
-    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
-        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
-  }
-
+ur_result_t USMHostAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                             const cl_mem_properties_intel *Properties,
+                             size_t Size, uint32_t Alignment) {
   // First we need to look up the function pointer
   clHostMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
+  cl_context CLContext = cl_adapter::cast<cl_context>(Context);
   if (auto UrResult = cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-          cl_ext::HostMemAllocName, &FuncPtr)) {
+          CLContext, &cl_ext::ExtFuncPtrTableT::clHostMemAllocINTEL,
+          &FuncPtr)) {
     return UrResult;
   }
 
+  void *Ptr = nullptr;
   if (FuncPtr) {
     cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext,
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, &ClResult);
+    Ptr = FuncPtr(CLContext, Properties, Size, Alignment, &ClResult);
     if (ClResult == CL_INVALID_BUFFER_SIZE) {
       return UR_RESULT_ERROR_INVALID_USM_SIZE;
     }
     CL_RETURN_ON_FAILURE(ClResult);
   }
 
-  *ppMem = Ptr;
+  *ResultPtr = Ptr;
 
   assert((Alignment == 0 ||
-          reinterpret_cast<std::uintptr_t>(*ppMem) % Alignment == 0) &&
+          reinterpret_cast<std::uintptr_t>(*ResultPtr) % Alignment == 0) &&
          "Allocation not aligned correctly!");
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t,
-                 size_t size, void **ppMem) {
-
-  void *Ptr = nullptr;
-  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
-
-  if (pUSMDesc && pUSMDesc->align != 0 &&
-      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  }
-
-  std::vector<cl_mem_properties_intel> AllocProperties;
-  if (pUSMDesc && pUSMDesc->pNext) {
-    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
-        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
-  }
-
+ur_result_t USMDeviceAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                               ur_device_handle_t Device,
+                               const cl_mem_properties_intel *Properties,
+                               size_t Size, uint32_t Alignment) {
   // First we need to look up the function pointer
   clDeviceMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
+  cl_context CLContext = cl_adapter::cast<cl_context>(Context);
   if (auto UrResult = cl_ext::getExtFuncFromContext<clDeviceMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clDeviceMemAllocINTELCache,
-          cl_ext::DeviceMemAllocName, &FuncPtr)) {
+          CLContext, &cl_ext::ExtFuncPtrTableT::clDeviceMemAllocINTEL,
+          &FuncPtr)) {
     return UrResult;
   }
 
+  void *Ptr = nullptr;
   if (FuncPtr) {
     cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(hDevice),
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, &ClResult);
+    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(Device),
+                  Properties, Size, Alignment, &ClResult);
     if (ClResult == CL_INVALID_BUFFER_SIZE) {
       return UR_RESULT_ERROR_INVALID_USM_SIZE;
     }
     CL_RETURN_ON_FAILURE(ClResult);
   }
 
-  *ppMem = Ptr;
+  *ResultPtr = Ptr;
 
   assert((Alignment == 0 ||
-          reinterpret_cast<std::uintptr_t>(*ppMem) % Alignment == 0) &&
+          reinterpret_cast<std::uintptr_t>(*ResultPtr) % Alignment == 0) &&
          "Allocation not aligned correctly!");
 
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL
-urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
-                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t,
-                 size_t size, void **ppMem) {
-
-  void *Ptr = nullptr;
-  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
-
-  if (pUSMDesc && pUSMDesc->align != 0 &&
-      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
-    return UR_RESULT_ERROR_INVALID_VALUE;
-  }
-
-  std::vector<cl_mem_properties_intel> AllocProperties;
-  if (pUSMDesc && pUSMDesc->pNext) {
-    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
-        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
-  }
-
+ur_result_t USMSharedAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                               ur_device_handle_t Device,
+                               const cl_mem_properties_intel *Properties,
+                               size_t Size, uint32_t Alignment) {
   // First we need to look up the function pointer
   clSharedMemAllocINTEL_fn FuncPtr = nullptr;
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
+  cl_context CLContext = cl_adapter::cast<cl_context>(Context);
   if (auto UrResult = cl_ext::getExtFuncFromContext<clSharedMemAllocINTEL_fn>(
-          CLContext, cl_ext::ExtFuncPtrCache->clSharedMemAllocINTELCache,
-          cl_ext::SharedMemAllocName, &FuncPtr)) {
+          CLContext, &cl_ext::ExtFuncPtrTableT::clSharedMemAllocINTEL,
+          &FuncPtr)) {
     return UrResult;
   }
 
+  void *Ptr = nullptr;
   if (FuncPtr) {
     cl_int ClResult = CL_SUCCESS;
-    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(hDevice),
-                  AllocProperties.empty() ? nullptr : AllocProperties.data(),
-                  size, Alignment, cl_adapter::cast<cl_int *>(&ClResult));
+    Ptr = FuncPtr(CLContext, cl_adapter::cast<cl_device_id>(Device),
+                  Properties, Size, Alignment,
+                  cl_adapter::cast<cl_int *>(&ClResult));
     if (ClResult == CL_INVALID_BUFFER_SIZE) {
       return UR_RESULT_ERROR_INVALID_USM_SIZE;
     }
     CL_RETURN_ON_FAILURE(ClResult);
   }
 
-  *ppMem = Ptr;
+  *ResultPtr = Ptr;
 
   assert((Alignment == 0 ||
-          reinterpret_cast<std::uintptr_t>(*ppMem) % Alignment == 0) &&
+          reinterpret_cast<std::uintptr_t>(*ResultPtr) % Alignment == 0) &&
          "Allocation not aligned correctly!");
   return UR_RESULT_SUCCESS;
 }
 
-UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
-                                              void *pMem) {
-
+ur_result_t USMFreeImpl(ur_context_handle_t Context, void *Ptr) {
   // Use a blocking free to avoid issues with indirect access from kernels that
   // might be still running.
   clMemBlockingFreeINTEL_fn FuncPtr = nullptr;
 
-  cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
+  cl_context CLContext = cl_adapter::cast<cl_context>(Context);
   ur_result_t RetVal = UR_RESULT_ERROR_INVALID_OPERATION;
   RetVal = cl_ext::getExtFuncFromContext<clMemBlockingFreeINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clMemBlockingFreeINTELCache,
-      cl_ext::MemBlockingFreeName, &FuncPtr);
+      CLContext, &cl_ext::ExtFuncPtrTableT::clMemBlockingFreeINTEL, &FuncPtr);
 
   if (FuncPtr) {
-    RetVal = mapCLErrorToUR(FuncPtr(CLContext, pMem));
+    RetVal = mapCLErrorToUR(FuncPtr(CLContext, Ptr));
   }
 
   return RetVal;
 }
 
+// Allocates from the pool, the descriptors of the allocation being ignored
+static ur_result_t USMPoolAlloc(umf_memory_pool_handle_t UMFPool, size_t Size,
+                                uint32_t Alignment, void **ppMem) {
+  *ppMem = umfPoolAlignedMalloc(UMFPool, Size, Alignment);
+  if (*ppMem == nullptr) {
+    auto UmfErr = umfPoolGetLastAllocationError(UMFPool);
+    return umf::umf2urResult(UmfErr);
+  }
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMHostAlloc(ur_context_handle_t hContext, const ur_usm_desc_t *pUSMDesc,
+               ur_usm_pool_handle_t hPool, size_t size, void **ppMem) {
+
+  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
+
+  if (pUSMDesc && pUSMDesc->align != 0 &&
+      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  if (hPool) {
+    return USMPoolAlloc(hPool->HostMemPool.get(), size, Alignment, ppMem);
+  }
+
+  std::vector<cl_mem_properties_intel> AllocProperties;
+  if (pUSMDesc && pUSMDesc->pNext) {
+    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
+        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
+  }
+
+  return USMHostAllocImpl(
+      ppMem, hContext,
+      AllocProperties.empty() ? nullptr : AllocProperties.data(), size,
+      Alignment);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMDeviceAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
+                 size_t size, void **ppMem) {
+
+  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
+
+  if (pUSMDesc && pUSMDesc->align != 0 &&
+      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  if (hPool) {
+    auto It = hPool->DeviceMemPools.find(hDevice);
+    if (It == hPool->DeviceMemPools.end()) {
+      return UR_RESULT_ERROR_INVALID_DEVICE;
+    }
+    return USMPoolAlloc(It->second.get(), size, Alignment, ppMem);
+  }
+
+  std::vector<cl_mem_properties_intel> AllocProperties;
+  if (pUSMDesc && pUSMDesc->pNext) {
+    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
+        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
+  }
+
+  return USMDeviceAllocImpl(
+      ppMem, hContext, hDevice,
+      AllocProperties.empty() ? nullptr : AllocProperties.data(), size,
+      Alignment);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMSharedAlloc(ur_context_handle_t hContext, ur_device_handle_t hDevice,
+                 const ur_usm_desc_t *pUSMDesc, ur_usm_pool_handle_t hPool,
+                 size_t size, void **ppMem) {
+
+  uint32_t Alignment = pUSMDesc ? pUSMDesc->align : 0;
+
+  if (pUSMDesc && pUSMDesc->align != 0 &&
+      ((pUSMDesc->align & (pUSMDesc->align - 1)) != 0)) {
+    return UR_RESULT_ERROR_INVALID_VALUE;
+  }
+
+  auto *DeviceDesc =
+      pUSMDesc ? find_stype_node<ur_usm_device_desc_t>(pUSMDesc->pNext)
+               : nullptr;
+  if (DeviceDesc &&
+      (DeviceDesc->flags & UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP)) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+
+  if (hPool) {
+    auto It = hPool->SharedMemPools.find(hDevice);
+    if (It == hPool->SharedMemPools.end()) {
+      return UR_RESULT_ERROR_INVALID_DEVICE;
+    }
+    return USMPoolAlloc(It->second.get(), size, Alignment, ppMem);
+  }
+
+  std::vector<cl_mem_properties_intel> AllocProperties;
+  if (pUSMDesc && pUSMDesc->pNext) {
+    UR_RETURN_ON_FAILURE(usmDescToCLMemProperties(
+        static_cast<const ur_base_desc_t *>(pUSMDesc->pNext), AllocProperties));
+  }
+
+  return USMSharedAllocImpl(
+      ppMem, hContext, hDevice,
+      AllocProperties.empty() ? nullptr : AllocProperties.data(), size,
+      Alignment);
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL urUSMFree(ur_context_handle_t hContext,
+                                              void *pMem) {
+  if (auto Pool = umfPoolByPtr(pMem)) {
+    return umf::umf2urResult(umfPoolFree(Pool, pMem));
+  }
+  return USMFreeImpl(hContext, pMem);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     ur_queue_handle_t hQueue, void *ptr, size_t patternSize,
     const void *pPattern, size_t size, uint32_t numEventsInWaitList,
@@ -266,8 +348,8 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
     clEnqueueMemFillINTEL_fn EnqueueMemFill = nullptr;
     UR_RETURN_ON_FAILURE(
         cl_ext::getExtFuncFromContext<clEnqueueMemFillINTEL_fn>(
-            CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemFillINTELCache,
-            cl_ext::EnqueueMemFillName, &EnqueueMemFill));
+            CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueMemFillINTEL,
+            &EnqueueMemFill));
 
     CL_RETURN_ON_FAILURE(
         EnqueueMemFill(cl_adapter::cast<cl_command_queue>(hQueue), ptr,
@@ -283,18 +365,16 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMFill(
   // target allocation.
   clHostMemAllocINTEL_fn HostMemAlloc = nullptr;
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clHostMemAllocINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clHostMemAllocINTELCache,
-      cl_ext::HostMemAllocName, &HostMemAlloc));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clHostMemAllocINTEL,
+      &HostMemAlloc));
 
   clEnqueueMemcpyINTEL_fn USMMemcpy = nullptr;
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &USMMemcpy));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueMemcpyINTEL, &USMMemcpy));
 
   clMemBlockingFreeINTEL_fn USMFree = nullptr;
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clMemBlockingFreeINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clMemBlockingFreeINTELCache,
-      cl_ext::MemBlockingFreeName, &USMFree));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clMemBlockingFreeINTEL, &USMFree));
 
   cl_int ClErr = CL_SUCCESS;
   auto HostBuffer =
@@ -371,8 +451,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
   clEnqueueMemcpyINTEL_fn FuncPtr = nullptr;
   ur_result_t RetVal = cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &FuncPtr);
+      CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueMemcpyINTEL, &FuncPtr);
 
   if (FuncPtr) {
     RetVal = mapCLErrorToUR(
@@ -385,6 +464,71 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy(
   return RetVal;
 }
 
+UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, bool blocking, uint32_t numCopies, void **ppDst,
+    const void **ppSrc, const size_t *pSizes, uint32_t numEventsInWaitList,
+    const ur_event_handle_t *phEventWaitList, ur_event_handle_t *phEvent) {
+
+  // Have to look up the context from the queue
+  cl_context CLContext;
+  cl_int CLErr = clGetCommandQueueInfo(
+      cl_adapter::cast<cl_command_queue>(hQueue), CL_QUEUE_CONTEXT,
+      sizeof(cl_context), &CLContext, nullptr);
+  if (CLErr != CL_SUCCESS) {
+    return mapCLErrorToUR(CLErr);
+  }
+
+  clEnqueueMemcpyINTEL_fn FuncPtr = nullptr;
+  ur_result_t RetVal = cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
+      CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueMemcpyINTEL, &FuncPtr);
+  if (!FuncPtr) {
+    return RetVal;
+  }
+
+  // OpenCL has no batched copy: each block is copied after the wait list,
+  // and a marker waiting for all of them stands for the batch
+  std::vector<cl_event> CopyEvents;
+  try {
+    CopyEvents.reserve(numCopies);
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  auto ReleaseCopyEvents = [&CopyEvents]() {
+    for (cl_event Event : CopyEvents) {
+      clReleaseEvent(Event);
+    }
+  };
+  for (uint32_t i = 0; i < numCopies; i++) {
+    cl_event Event;
+    CLErr = FuncPtr(cl_adapter::cast<cl_command_queue>(hQueue), false,
+                    ppDst[i], ppSrc[i], pSizes[i], numEventsInWaitList,
+                    cl_adapter::cast<const cl_event *>(phEventWaitList),
+                    &Event);
+    if (CLErr != CL_SUCCESS) {
+      ReleaseCopyEvents();
+      return mapCLErrorToUR(CLErr);
+    }
+    CopyEvents.push_back(Event);
+  }
+
+  cl_event Marker;
+  CLErr = clEnqueueMarkerWithWaitList(
+      cl_adapter::cast<cl_command_queue>(hQueue), numCopies, CopyEvents.data(),
+      &Marker);
+  ReleaseCopyEvents();
+  CL_RETURN_ON_FAILURE(CLErr);
+
+  if (blocking) {
+    CLErr = clWaitForEvents(1, &Marker);
+  }
+  if (phEvent && CLErr == CL_SUCCESS) {
+    *phEvent = cl_adapter::cast<ur_event_handle_t>(Marker);
+  } else {
+    clReleaseEvent(Marker);
+  }
+  return mapCLErrorToUR(CLErr);
+}
+
 UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ur_queue_handle_t hQueue, [[maybe_unused]] const void *pMem,
     [[maybe_unused]] size_t size,
@@ -487,8 +631,7 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
 
   clEnqueueMemcpyINTEL_fn FuncPtr = nullptr;
   ur_result_t RetVal = cl_ext::getExtFuncFromContext<clEnqueueMemcpyINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clEnqueueMemcpyINTELCache,
-      cl_ext::EnqueueMemcpyName, &FuncPtr);
+      CLContext, &cl_ext::ExtFuncPtrTableT::clEnqueueMemcpyINTEL, &FuncPtr);
 
   if (!FuncPtr) {
     return RetVal;
@@ -527,6 +670,26 @@ UR_APIEXPORT ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
   return UR_RESULT_SUCCESS;
 }
 
+namespace {
+// The contexts being OpenCL's, the pools of every context are kept here
+std::mutex PoolHandlesMutex;
+std::set<ur_usm_pool_handle_t> PoolHandles;
+
+ur_usm_pool_handle_t getOwningURPool(const void *Ptr) {
+  auto UMFPool = umfPoolByPtr(Ptr);
+  if (!UMFPool) {
+    return nullptr;
+  }
+  std::lock_guard<std::mutex> Lock(PoolHandlesMutex);
+  for (auto Pool : PoolHandles) {
+    if (Pool->hasUMFPool(UMFPool)) {
+      return Pool;
+    }
+  }
+  return nullptr;
+}
+} // namespace
+
 ur_usm_type_t
 mapCLUSMTypeToUR(const cl_unified_shared_memory_type_intel &Type) {
   switch (Type) {
@@ -547,11 +710,20 @@ urUSMGetMemAllocInfo(ur_context_handle_t hContext, const void *pMem,
                      ur_usm_alloc_info_t propName, size_t propSize,
                      void *pPropValue, size_t *pPropSizeRet) {
 
+  if (propName == UR_USM_ALLOC_INFO_POOL) {
+    auto Pool = getOwningURPool(pMem);
+    if (!Pool) {
+      return UR_RESULT_ERROR_INVALID_VALUE;
+    }
+    UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+    return ReturnValue(Pool);
+  }
+
   clGetMemAllocInfoINTEL_fn GetMemAllocInfo = nullptr;
   cl_context CLContext = cl_adapter::cast<cl_context>(hContext);
   UR_RETURN_ON_FAILURE(cl_ext::getExtFuncFromContext<clGetMemAllocInfoINTEL_fn>(
-      CLContext, cl_ext::ExtFuncPtrCache->clGetMemAllocInfoINTELCache,
-      cl_ext::GetMemAllocInfoName, &GetMemAllocInfo));
+      CLContext, &cl_ext::ExtFuncPtrTableT::clGetMemAllocInfoINTEL,
+      &GetMemAllocInfo));
 
   cl_mem_info_intel PropNameCL;
   switch (propName) {
@@ -602,3 +774,262 @@ urUSMReleaseExp([[maybe_unused]] ur_context_handle_t Context,
                 [[maybe_unused]] void *HostPtr) {
   return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
 }
+
+umf_result_t USMMemoryProvider::initialize(ur_context_handle_t Ctx,
+                                           ur_device_handle_t Dev) {
+  Context = Ctx;
+  Device = Dev;
+  return UMF_RESULT_SUCCESS;
+}
+
+enum umf_result_t USMMemoryProvider::alloc(size_t Size, size_t Align,
+                                           void **Ptr) {
+  auto Res = allocateImpl(Ptr, Size, Align);
+  if (Res != UR_RESULT_SUCCESS) {
+    getLastStatusRef() = Res;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+
+  return UMF_RESULT_SUCCESS;
+}
+
+enum umf_result_t USMMemoryProvider::free(void *Ptr, size_t Size) {
+  (void)Size;
+
+  auto Res = USMFreeImpl(Context, Ptr);
+  if (Res != UR_RESULT_SUCCESS) {
+    getLastStatusRef() = Res;
+    return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+  }
+
+  return UMF_RESULT_SUCCESS;
+}
+
+void USMMemoryProvider::get_last_native_error(const char **ErrMsg,
+                                              int32_t *ErrCode) {
+  (void)ErrMsg;
+  *ErrCode = static_cast<int32_t>(getLastStatusRef());
+}
+
+umf_result_t USMMemoryProvider::get_min_page_size(void *Ptr, size_t *PageSize) {
+  (void)Ptr;
+  // OpenCL has no notion of pages for USM, UMF only uses this to influence
+  // the alignment, which the extension functions are given anyway.
+  *PageSize = 0;
+
+  return UMF_RESULT_SUCCESS;
+}
+
+ur_result_t USMSharedMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
+                                                  uint32_t Alignment) {
+  return USMSharedAllocImpl(ResultPtr, Context, Device, nullptr, Size,
+                            Alignment);
+}
+
+ur_result_t USMDeviceMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
+                                                  uint32_t Alignment) {
+  return USMDeviceAllocImpl(ResultPtr, Context, Device, nullptr, Size,
+                            Alignment);
+}
+
+ur_result_t USMHostMemoryProvider::allocateImpl(void **ResultPtr, size_t Size,
+                                                uint32_t Alignment) {
+  return USMHostAllocImpl(ResultPtr, Context, nullptr, Size, Alignment);
+}
+
+ur_usm_pool_handle_t_::ur_usm_pool_handle_t_(ur_context_handle_t Context,
+                                             ur_usm_pool_desc_t *PoolDesc)
+    : Context{Context} {
+  const void *pNext = PoolDesc->pNext;
+  while (pNext != nullptr) {
+    const ur_base_desc_t *BaseDesc = static_cast<const ur_base_desc_t *>(pNext);
+    switch (BaseDesc->stype) {
+    case UR_STRUCTURE_TYPE_USM_POOL_LIMITS_DESC: {
+      const ur_usm_pool_limits_desc_t *Limits =
+          reinterpret_cast<const ur_usm_pool_limits_desc_t *>(BaseDesc);
+      for (auto &config : DisjointPoolConfigs.Configs) {
+        config.MaxPoolableSize = Limits->maxPoolableSize;
+        config.SlabMinSize = Limits->minDriverAllocSize;
+      }
+      break;
+    }
+    case UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC: {
+      const ur_exp_usm_pool_arena_desc_t *Arena =
+          reinterpret_cast<const ur_exp_usm_pool_arena_desc_t *>(BaseDesc);
+      DisjointPoolConfigs.Arenas[usm::DisjointPoolMemType::Device] = {
+          Arena->size, Arena->pageSize};
+      break;
+    }
+    default: {
+      throw UsmAllocationException(UR_RESULT_ERROR_INVALID_ARGUMENT);
+    }
+    }
+    pNext = BaseDesc->pNext;
+  }
+
+  cl_context CLContext = cl_adapter::cast<cl_context>(Context);
+  cl_uint NumDevices = 0;
+  cl_int ClResult =
+      clGetContextInfo(CLContext, CL_CONTEXT_NUM_DEVICES, sizeof(cl_uint),
+                       &NumDevices, nullptr);
+  if (ClResult != CL_SUCCESS) {
+    throw UsmAllocationException(mapCLErrorToUR(ClResult));
+  }
+  std::vector<cl_device_id> Devices(NumDevices);
+  ClResult = clGetContextInfo(CLContext, CL_CONTEXT_DEVICES,
+                              NumDevices * sizeof(cl_device_id),
+                              Devices.data(), nullptr);
+  if (ClResult != CL_SUCCESS) {
+    throw UsmAllocationException(mapCLErrorToUR(ClResult));
+  }
+
+  auto MemProvider =
+      umf::memoryProviderMakeUnique<USMHostMemoryProvider>(Context, nullptr)
+          .second;
+
+  HostMemPool = this->DisjointPoolConfigs
+                    .makePool(std::move(MemProvider),
+                              usm::DisjointPoolMemType::Host, &Stats)
+                    .second;
+
+  for (auto CLDevice : Devices) {
+    auto Device = cl_adapter::cast<ur_device_handle_t>(CLDevice);
+    MemProvider =
+        umf::memoryProviderMakeUnique<USMDeviceMemoryProvider>(Context, Device)
+            .second;
+    DeviceMemPools[Device] = this->DisjointPoolConfigs
+                                 .makePool(std::move(MemProvider),
+                                           usm::DisjointPoolMemType::Device,
+                                           &Stats)
+                                 .second;
+    MemProvider =
+        umf::memoryProviderMakeUnique<USMSharedMemoryProvider>(Context, Device)
+            .second;
+    SharedMemPools[Device] = this->DisjointPoolConfigs
+                                 .makePool(std::move(MemProvider),
+                                           usm::DisjointPoolMemType::Shared,
+                                           &Stats)
+                                 .second;
+  }
+
+  urContextRetain(Context);
+  std::lock_guard<std::mutex> Lock(PoolHandlesMutex);
+  PoolHandles.insert(this);
+}
+
+ur_usm_pool_handle_t_::~ur_usm_pool_handle_t_() {
+  {
+    std::lock_guard<std::mutex> Lock(PoolHandlesMutex);
+    PoolHandles.erase(this);
+  }
+  // The pools free their memory through the context
+  DeviceMemPools.clear();
+  SharedMemPools.clear();
+  HostMemPool.reset();
+  // Clears the extension functions cached for the context if this was its
+  // last reference
+  urContextRelease(Context);
+}
+
+bool ur_usm_pool_handle_t_::hasUMFPool(umf_memory_pool_t *UMFPool) {
+  if (HostMemPool.get() == UMFPool) {
+    return true;
+  }
+  for (auto *Pools : {&DeviceMemPools, &SharedMemPools}) {
+    for (auto &Pool : *Pools) {
+      if (Pool.second.get() == UMFPool) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+size_t ur_usm_pool_handle_t_::trim(size_t MinBytesToKeep) {
+  size_t KeptSize = 0;
+  auto TrimPool = [&](umf_memory_pool_t *UMFPool) {
+    auto Budget = MinBytesToKeep - KeptSize;
+    KeptSize += std::min(umf::poolTrim(UMFPool, Budget), Budget);
+  };
+  for (auto *Pools : {&DeviceMemPools, &SharedMemPools}) {
+    for (auto &Pool : *Pools) {
+      TrimPool(Pool.second.get());
+    }
+  }
+  TrimPool(HostMemPool.get());
+  return KeptSize;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolCreate(ur_context_handle_t hContext, ur_usm_pool_desc_t *pPoolDesc,
+                ur_usm_pool_handle_t *phPool) {
+  // Without pool tracking we can't free pool allocations.
+#ifdef UMF_ENABLE_POOL_TRACKING
+  if (pPoolDesc->flags & UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+  }
+  try {
+    *phPool = new ur_usm_pool_handle_t_(hContext, pPoolDesc);
+  } catch (const UsmAllocationException &Ex) {
+    return Ex.getError();
+  } catch (std::bad_alloc &) {
+    return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+  }
+  return UR_RESULT_SUCCESS;
+#else
+  std::ignore = hContext;
+  std::ignore = pPoolDesc;
+  std::ignore = phPool;
+  return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+#endif
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolRetain(ur_usm_pool_handle_t hPool) {
+  hPool->incrementReferenceCount();
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolRelease(ur_usm_pool_handle_t hPool) {
+  if (hPool->decrementReferenceCount() > 0) {
+    return UR_RESULT_SUCCESS;
+  }
+  delete hPool;
+  return UR_RESULT_SUCCESS;
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolGetInfo(ur_usm_pool_handle_t hPool, ur_usm_pool_info_t propName,
+                 size_t propSize, void *pPropValue, size_t *pPropSizeRet) {
+  UrReturnHelper ReturnValue(propSize, pPropValue, pPropSizeRet);
+
+  switch (propName) {
+  case UR_USM_POOL_INFO_REFERENCE_COUNT: {
+    return ReturnValue(hPool->getReferenceCount());
+  }
+  case UR_USM_POOL_INFO_CONTEXT: {
+    return ReturnValue(hPool->Context);
+  }
+  default: {
+    return umf::getPoolStatsInfo(hPool->Stats, propName, ReturnValue);
+  }
+  }
+}
+
+UR_APIEXPORT ur_result_t UR_APICALL
+urUSMPoolTrimExp(ur_context_handle_t hContext, ur_usm_pool_handle_t hPool,
+                 size_t minBytesToKeep) {
+  // Allocations without a pool aren't pooled, only the pools are trimmed
+  if (hPool) {
+    hPool->trim(minBytesToKeep);
+    return UR_RESULT_SUCCESS;
+  }
+  std::lock_guard<std::mutex> Lock(PoolHandlesMutex);
+  for (auto Pool : PoolHandles) {
+    if (Pool->Context == hContext) {
+      minBytesToKeep -= Pool->trim(minBytesToKeep);
+    }
+  }
+  return UR_RESULT_SUCCESS;
+}
@@ -0,0 +1,153 @@
+//===--------- usm.hpp - OpenCL Adapter -----------------------------------===//
+//
+// Copyright (C) 2024 Intel Corporation
+//
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM
+// Exceptions. See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+//
+//===----------------------------------------------------------------------===//
+#pragma once
+
+#include <unordered_map>
+
+#include "common.hpp"
+
+#include <umf_helpers.hpp>
+#include <umf_pools/disjoint_pool_config_parser.hpp>
+
+// USM pool handing out the allocations of disjoint pools, which get their
+// memory from the cl_intel_unified_shared_memory allocation functions.
+struct ur_usm_pool_handle_t_ {
+  std::atomic_uint32_t RefCount = 1;
+
+  // Retained by the pool, as the memory of the pools below is freed with it
+  ur_context_handle_t Context = nullptr;
+
+  usm::DisjointPoolAllConfigs DisjointPoolConfigs =
+      usm::DisjointPoolAllConfigs();
+
+  umf::pool_stats_t Stats;
+
+  std::unordered_map<ur_device_handle_t, umf::pool_unique_handle_t>
+      DeviceMemPools;
+  std::unordered_map<ur_device_handle_t, umf::pool_unique_handle_t>
+      SharedMemPools;
+  umf::pool_unique_handle_t HostMemPool;
+
+  ur_usm_pool_handle_t_(ur_context_handle_t Context,
+                        ur_usm_pool_desc_t *PoolDesc);
+  ~ur_usm_pool_handle_t_();
+
+  uint32_t incrementReferenceCount() noexcept { return ++RefCount; }
+
+  uint32_t decrementReferenceCount() noexcept { return --RefCount; }
+
+  uint32_t getReferenceCount() const noexcept { return RefCount; }
+
+  bool hasUMFPool(umf_memory_pool_t *UMFPool);
+
+  // Returns the bytes of free memory left cached, at most MinBytesToKeep
+  size_t trim(size_t MinBytesToKeep);
+};
+
+// Exception type to pass allocation errors
+class UsmAllocationException {
+  const ur_result_t Error;
+
+public:
+  UsmAllocationException(ur_result_t Err) : Error{Err} {}
+  ur_result_t getError() const { return Error; }
+};
+
+// Implements memory allocation via the extension functions for USM allocator
+// interface.
+class USMMemoryProvider {
+private:
+  ur_result_t &getLastStatusRef() {
+    static thread_local ur_result_t LastStatus = UR_RESULT_SUCCESS;
+    return LastStatus;
+  }
+
+protected:
+  ur_context_handle_t Context;
+  ur_device_handle_t Device;
+
+  // Internal allocation routine which must be implemented for each allocation
+  // type
+  virtual ur_result_t allocateImpl(void **ResultPtr, size_t Size,
+                                   uint32_t Alignment) = 0;
+
+public:
+  umf_result_t initialize(ur_context_handle_t Ctx, ur_device_handle_t Dev);
+  umf_result_t alloc(size_t Size, size_t Align, void **Ptr);
+  umf_result_t free(void *Ptr, size_t Size);
+  void get_last_native_error(const char **ErrMsg, int32_t *ErrCode);
+  umf_result_t get_min_page_size(void *, size_t *);
+  umf_result_t get_recommended_page_size(size_t, size_t *) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  };
+  umf_result_t purge_lazy(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  };
+  umf_result_t purge_force(void *, size_t) {
+    return UMF_RESULT_ERROR_NOT_SUPPORTED;
+  };
+  umf_result_t allocation_merge(void *, void *, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  umf_result_t allocation_split(void *, size_t, size_t) {
+    return UMF_RESULT_ERROR_UNKNOWN;
+  }
+  virtual const char *get_name() = 0;
+
+  virtual ~USMMemoryProvider() = default;
+};
+
+// Allocation routines for shared memory type
+class USMSharedMemoryProvider final : public USMMemoryProvider {
+public:
+  const char *get_name() override { return "USMSharedMemoryProvider"; }
+
+protected:
+  ur_result_t allocateImpl(void **ResultPtr, size_t Size,
+                           uint32_t Alignment) override;
+};
+
+// Allocation routines for device memory type
+class USMDeviceMemoryProvider final : public USMMemoryProvider {
+public:
+  const char *get_name() override { return "USMDeviceMemoryProvider"; }
+
+protected:
+  ur_result_t allocateImpl(void **ResultPtr, size_t Size,
+                           uint32_t Alignment) override;
+};
+
+// Allocation routines for host memory type
+class USMHostMemoryProvider final : public USMMemoryProvider {
+public:
+  const char *get_name() override { return "USMHostMemoryProvider"; }
+
+protected:
+  ur_result_t allocateImpl(void **ResultPtr, size_t Size,
+                           uint32_t Alignment) override;
+};
+
+// Allocate through the extension functions, Properties being null or zero
+// terminated
+ur_result_t USMDeviceAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                               ur_device_handle_t Device,
+                               const cl_mem_properties_intel *Properties,
+                               size_t Size, uint32_t Alignment);
+
+ur_result_t USMSharedAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                               ur_device_handle_t Device,
+                               const cl_mem_properties_intel *Properties,
+                               size_t Size, uint32_t Alignment);
+
+ur_result_t USMHostAllocImpl(void **ResultPtr, ur_context_handle_t Context,
+                             const cl_mem_properties_intel *Properties,
+                             size_t Size, uint32_t Alignment);
+
+ur_result_t USMFreeImpl(ur_context_handle_t Context, void *Ptr);
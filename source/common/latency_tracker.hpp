@@ -11,9 +11,16 @@
 #pragma once
 
 #include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <cstdio>
+#include <fstream>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
 
 #include "logger/ur_logger.hpp"
 
@@ -70,44 +77,110 @@ static inline latencyValues getValues(const struct hdr_histogram *histogram) {
     return values;
 }
 
+class latency_histogram;
+
+// Collects the per-thread histograms of all TRACK_SCOPE_LATENCY sites. Each
+// thread records into its own shard without any shared writes, shards are
+// merged here when their thread exits. Shards of threads that are still
+// running when the results are printed are merged in at that point.
 class latency_printer {
   public:
-    latency_printer() : logger(logger::create_logger("latency", true, false)) {}
+    latency_printer() : logger(logger::create_logger("latency", true, false)) {
+        if (trackLatency) {
+            startExport();
+        }
+    }
 
     inline void publishLatency(const std::string &name,
                                histogram_ptr histogram) {
-        auto [it, inserted] = values.try_emplace(name, std::move(histogram));
-        if (!inserted) {
-            // combine histograms
-            hdr_add(it->second.get(), histogram.get());
-        }
+        std::scoped_lock<std::mutex> lock(mutex);
+        mergeLocked(values, name, std::move(histogram));
+    }
+
+    inline void registerShard(latency_histogram *shard) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        liveShards.insert(shard);
+    }
+
+    inline void unregisterShard(latency_histogram *shard) {
+        std::scoped_lock<std::mutex> lock(mutex);
+        liveShards.erase(shard);
     }
 
     inline ~latency_printer() {
+        if (exportThread.joinable()) {
+            {
+                std::scoped_lock<std::mutex> lock(exportMutex);
+                exportStop = true;
+            }
+            exportCv.notify_one();
+            exportThread.join();
+            exportJson();
+        }
         if (trackLatency) {
             print();
         }
     }
 
-    inline void print() {
-        printHeader();
+    inline void print();
 
-        for (auto &[name, histogram] : values) {
-            auto value = getValues(histogram.get());
-            auto f = groupDigits<int64_t>;
-            logger.log(
-                logger::Level::INFO,
-                "{},{},{},{},{},{},{},{},{},{},{},{},{},{},ns", name,
-                f(value.mean), f(value.percentileValues[0]),
-                f(value.percentileValues[1]), f(value.percentileValues[2]),
-                f(value.percentileValues[3]), f(value.percentileValues[4]),
-                f(value.percentileValues[5]), f(value.percentileValues[6]),
-                f(value.count), f(value.count * value.mean), f(value.min),
-                f(value.max), value.stddev);
+    // Writes the current state of all histograms as JSON to the file set with
+    // UR_LATENCY_EXPORT, replacing its previous contents atomically.
+    inline void exportJson();
+
+  private:
+    inline void startExport() {
+        std::optional<EnvVarMap> options;
+        try {
+            options = getenv_to_map("UR_LATENCY_EXPORT");
+        } catch (const std::invalid_argument &e) {
+            logger::error("{}", e.what());
+        }
+        if (!options) {
+            return;
+        }
+
+        auto kv = options->find("path");
+        if (kv == options->end()) {
+            logger::error("UR_LATENCY_EXPORT requires a path");
+            return;
+        }
+        exportPath = kv->second.front();
+
+        kv = options->find("interval");
+        if (kv != options->end()) {
+            try {
+                exportInterval =
+                    std::chrono::milliseconds(std::stoull(kv->second.front()));
+            } catch (const std::exception &) {
+                logger::error("invalid UR_LATENCY_EXPORT interval {}",
+                              kv->second.front());
+            }
+        }
+
+        exportThread = std::thread([this] {
+            std::unique_lock<std::mutex> lock(exportMutex);
+            while (!exportCv.wait_for(lock, exportInterval,
+                                      [this] { return exportStop; })) {
+                lock.unlock();
+                exportJson();
+                lock.lock();
+            }
+        });
+    }
+
+    inline std::map<std::string, histogram_ptr> snapshotLocked();
+
+    static inline void mergeLocked(std::map<std::string, histogram_ptr> &dst,
+                                   const std::string &name,
+                                   histogram_ptr histogram) {
+        auto [it, inserted] = dst.try_emplace(name, std::move(histogram));
+        if (!inserted) {
+            // combine histograms
+            hdr_add(it->second.get(), histogram.get());
         }
     }
 
-  private:
     inline void printHeader() {
         logger.log(logger::Level::INFO, "Latency histogram:");
         logger.log(logger::Level::INFO,
@@ -118,8 +191,17 @@ class latency_printer {
                    percentiles[6]);
     }
 
+    std::mutex mutex;
     std::map<std::string, histogram_ptr> values;
+    std::set<latency_histogram *> liveShards;
     logger::Logger logger;
+
+    std::string exportPath;
+    std::chrono::milliseconds exportInterval{10'000};
+    std::mutex exportMutex;
+    std::condition_variable exportCv;
+    bool exportStop = false;
+    std::thread exportThread;
 };
 
 inline latency_printer &globalLatencyPrinter() {
@@ -145,6 +227,7 @@ class latency_histogram {
             histogram =
                 std::unique_ptr<struct hdr_histogram, decltype(&hdr_close)>(
                     cHistogram, &hdr_close);
+            printer.registerShard(this);
         }
     }
 
@@ -156,6 +239,8 @@ class latency_histogram {
             return;
         }
 
+        printer.unregisterShard(this);
+
         if (hdr_min(histogram.get()) == std::numeric_limits<int64_t>::max()) {
             logger::info("[{}] latency: no data", name);
             return;
@@ -169,11 +254,101 @@ class latency_histogram {
     }
 
   private:
+    friend class latency_printer;
+
     const char *name;
     histogram_ptr histogram;
     latency_printer &printer;
 };
 
+inline std::map<std::string, histogram_ptr> latency_printer::snapshotLocked() {
+    // Fold in a copy of every shard that hasn't been published yet. Their
+    // threads may still be recording, so these numbers are a best effort.
+    std::map<std::string, histogram_ptr> snapshot;
+    auto addCopy = [&](const std::string &name,
+                       const struct hdr_histogram *src) {
+        struct hdr_histogram *copy;
+        if (src == nullptr || src->total_count == 0 ||
+            hdr_init(src->lowest_discernible_value,
+                     src->highest_trackable_value, src->significant_figures,
+                     &copy) != 0) {
+            return;
+        }
+        hdr_add(copy, src);
+        mergeLocked(snapshot, name, histogram_ptr(copy, &hdr_close));
+    };
+    for (auto &[name, histogram] : values) {
+        addCopy(name, histogram.get());
+    }
+    for (auto *shard : liveShards) {
+        addCopy(shard->name, shard->histogram.get());
+    }
+    return snapshot;
+}
+
+inline void latency_printer::exportJson() {
+    std::map<std::string, histogram_ptr> snapshot;
+    {
+        std::scoped_lock<std::mutex> lock(mutex);
+        snapshot = snapshotLocked();
+    }
+
+    auto now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+    auto tmpPath = exportPath + ".tmp";
+    {
+        std::ofstream out(tmpPath, std::ios::trunc);
+        out << "{\"pid\": " << ur_getpid() << ", \"timestamp_ns\": " << now
+            << ", \"unit\": \"ns\", \"histograms\": [";
+        bool first = true;
+        for (auto &[name, histogram] : snapshot) {
+            auto value = getValues(histogram.get());
+            out << (first ? "" : ",") << "\n  {\"name\": \"" << name
+                << "\", \"count\": " << value.count
+                << ", \"min\": " << value.min << ", \"max\": " << value.max
+                << ", \"mean\": " << value.mean
+                << ", \"stddev\": " << value.stddev << ", \"percentiles\": {";
+            for (size_t i = 0; i < numPercentiles; ++i) {
+                out << (i ? ", " : "") << "\"" << percentiles[i]
+                    << "\": " << value.percentileValues[i];
+            }
+            out << "}}";
+            first = false;
+        }
+        out << "\n]}\n";
+        if (!out) {
+            logger::error("failed to write latency export to {}", tmpPath);
+            return;
+        }
+    }
+#ifdef _WIN32
+    // rename() doesn't replace an existing file on Windows
+    std::remove(exportPath.c_str());
+#endif
+    std::rename(tmpPath.c_str(), exportPath.c_str());
+}
+
+inline void latency_printer::print() {
+    std::scoped_lock<std::mutex> lock(mutex);
+    auto snapshot = snapshotLocked();
+
+    printHeader();
+
+    for (auto &[name, histogram] : snapshot) {
+        auto value = getValues(histogram.get());
+        auto f = groupDigits<int64_t>;
+        logger.log(logger::Level::INFO,
+                   "{},{},{},{},{},{},{},{},{},{},{},{},{},{},ns", name,
+                   f(value.mean), f(value.percentileValues[0]),
+                   f(value.percentileValues[1]), f(value.percentileValues[2]),
+                   f(value.percentileValues[3]), f(value.percentileValues[4]),
+                   f(value.percentileValues[5]), f(value.percentileValues[6]),
+                   f(value.count), f(value.count * value.mean), f(value.min),
+                   f(value.max), value.stddev);
+    }
+}
+
 class latency_tracker {
   public:
     inline explicit latency_tracker(latency_histogram &stats)
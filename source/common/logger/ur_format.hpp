@@ -0,0 +1,125 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_FORMAT_HPP
+#define UR_FORMAT_HPP 1
+
+#include <charconv>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace logger {
+namespace details {
+
+/// @brief Parses a logger format string at compile time. The syntax is the
+///        one accepted by Sink::format: every "{}" is replaced by the next
+///        argument, "{{" and "}}" print a single brace and anything else
+///        involving braces is an error.
+template <size_t Len, size_t N> struct compiled_format_t {
+    // Unescaped literal text, with the placeholders removed.
+    char text[Len + 1] = {};
+    size_t textLen = 0;
+    // Offset in text at which each argument is inserted.
+    size_t splits[N + 1] = {};
+    bool valid = true;
+
+    constexpr explicit compiled_format_t(std::string_view fmt) {
+        size_t arg = 0;
+        for (size_t i = 0; i < fmt.size(); ++i) {
+            char c = fmt[i];
+            char next = i + 1 < fmt.size() ? fmt[i + 1] : '\0';
+            if (c == '{' && next == '}') {
+                if (arg == N) {
+                    valid = false;
+                    return;
+                }
+                splits[arg++] = textLen;
+                ++i;
+            } else if ((c == '{' && next == '{') || (c == '}' && next == '}')) {
+                text[textLen++] = c;
+                ++i;
+            } else if (c == '{' || c == '}') {
+                valid = false;
+                return;
+            } else {
+                text[textLen++] = c;
+            }
+        }
+        valid = valid && arg == N;
+    }
+};
+
+template <typename T> inline void appendArg(std::string &out, T &&value) {
+    using U = std::decay_t<T>;
+    if constexpr (std::is_same_v<U, bool>) {
+        out += value ? '1' : '0';
+    } else if constexpr (std::is_same_v<U, char> ||
+                         std::is_same_v<U, signed char> ||
+                         std::is_same_v<U, unsigned char>) {
+        // Matches operator<<, which prints (u)int8_t as a character.
+        out += static_cast<char>(value);
+    } else if constexpr (std::is_integral_v<U> &&
+                         !std::is_same_v<U, wchar_t> &&
+                         !std::is_same_v<U, char16_t> &&
+                         !std::is_same_v<U, char32_t>) {
+        char digits[24];
+        auto res = std::to_chars(digits, digits + sizeof(digits), value);
+        out.append(digits, res.ptr);
+    } else if constexpr (std::is_same_v<std::remove_cv_t<std::remove_extent_t<
+                                            std::remove_reference_t<T>>>,
+                                        char>) {
+        // String literal; never null.
+        out += value;
+    } else if constexpr (std::is_same_v<U, const char *> ||
+                         std::is_same_v<U, char *>) {
+        out += value ? value : "(null)";
+    } else if constexpr (std::is_convertible_v<const U &, std::string_view>) {
+        out += std::string_view(value);
+    } else {
+        // Everything else (handles, enums, structs) goes through the same
+        // operator<< overloads as the runtime-parsed path.
+        thread_local std::ostringstream stream;
+        static const std::ostringstream defaults;
+        stream.str(std::string());
+        stream.clear();
+        stream.copyfmt(defaults);
+        stream << value;
+        out += stream.str();
+    }
+}
+
+template <size_t Len, size_t N, typename... Args>
+inline void formatTo(std::string &out, const compiled_format_t<Len, N> &fmt,
+                     Args &&...args) {
+    size_t pos = 0;
+    size_t arg = 0;
+    auto one = [&](auto &&value) {
+        out.append(fmt.text + pos, fmt.splits[arg] - pos);
+        pos = fmt.splits[arg++];
+        appendArg(out, std::forward<decltype(value)>(value));
+    };
+    (one(std::forward<Args>(args)), ...);
+    (void)one;
+    out.append(fmt.text + pos, fmt.textLen - pos);
+}
+
+/// @brief Restricts an overload to format providers created with UR_LOG_FMT.
+template <typename Fmt>
+using enable_if_log_fmt_t =
+    std::enable_if_t<std::is_invocable_r_v<std::string_view, Fmt>>;
+
+} // namespace details
+} // namespace logger
+
+/// @brief Wraps a string literal so the logger can parse it at compile time,
+///        e.g. logger.debug(UR_LOG_FMT("ZE ---> {}{}"), name, args). A format
+///        string that doesn't match the number of arguments fails to compile.
+#define UR_LOG_FMT(str)                                                        \
+    [] { return std::string_view(str); }
+
+#endif /* UR_FORMAT_HPP */
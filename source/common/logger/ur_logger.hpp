@@ -8,6 +8,7 @@
 
 #include <algorithm>
 #include <memory>
+#include <optional>
 
 #include "ur_logger_details.hpp"
 #include "ur_util.hpp"
@@ -80,6 +81,40 @@ inline void error(logger::LegacyMessage p, const char *format, Args &&...args) {
                      std::forward<Args>(args)...);
 }
 
+template <typename Fmt, typename... Args,
+          typename = details::enable_if_log_fmt_t<Fmt>>
+inline void debug(Fmt format, Args &&...args) {
+    get_logger().log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
+}
+
+template <typename Fmt, typename... Args,
+          typename = details::enable_if_log_fmt_t<Fmt>>
+inline void info(Fmt format, Args &&...args) {
+    get_logger().log(logger::Level::INFO, format, std::forward<Args>(args)...);
+}
+
+template <typename Fmt, typename... Args,
+          typename = details::enable_if_log_fmt_t<Fmt>>
+inline void warning(Fmt format, Args &&...args) {
+    get_logger().log(logger::Level::WARN, format, std::forward<Args>(args)...);
+}
+
+template <typename Fmt, typename... Args,
+          typename = details::enable_if_log_fmt_t<Fmt>>
+inline void error(Fmt format, Args &&...args) {
+    get_logger().log(logger::Level::ERR, format, std::forward<Args>(args)...);
+}
+
+template <typename Fmt, typename... Args,
+          typename = details::enable_if_log_fmt_t<Fmt>>
+inline void always(Fmt format, Args &&...args) {
+    get_logger().always(format, std::forward<Args>(args)...);
+}
+
+inline bool isLevelEnabled(logger::Level level) {
+    return get_logger().isLevelEnabled(level);
+}
+
 inline void setLevel(logger::Level level) { get_logger().setLevel(level); }
 
 inline void setFlushLevel(logger::Level level) {
@@ -92,6 +127,22 @@ template <typename T> inline std::string toHex(T t) {
     return s.str();
 }
 
+/// @brief Logs to @p logger_ at logger::Level::@p level_ (DEBUG, INFO, WARN
+///        or ERR). Unlike a plain call, the arguments are only evaluated when
+///        that level is enabled, so a filtered-out message costs one branch.
+///        Example: UR_LOG_L(Logger, DEBUG, "handle {}", ur_print(Handle));
+#define UR_LOG_L(logger_, level_, ...)                                         \
+    do {                                                                       \
+        auto &ur_log_logger_ = (logger_);                                      \
+        if (ur_log_logger_.isLevelEnabled(::logger::Level::level_)) {          \
+            ur_log_logger_.log(::logger::Level::level_, __VA_ARGS__);          \
+        }                                                                      \
+    } while (0)
+
+/// @brief UR_LOG_L for the default logger, e.g. UR_LOG(DEBUG, "x = {}", X).
+#define UR_LOG(level_, ...)                                                    \
+    UR_LOG_L(::logger::get_logger(), level_, __VA_ARGS__)
+
 /// @brief Create an instance of the logger with parameters obtained from the respective
 ///        environment variable or with default configuration if the env var is empty,
 ///        not set, or has the wrong format.
@@ -102,6 +153,8 @@ template <typename T> inline std::string toHex(T t) {
 ///        level set to `info`, flush level set to `warning`, and output set to
 ///        the `out.log` file:
 ///             UR_LOG_LOADER="level:info;flush:warning;output:file,out.log"
+///        Adding `async:block` or `async:drop[,<capacity>]` makes the sink
+///        write from a background thread, see logger::Sink::setAsync.
 /// @param logger_name name that should be appended to the `UR_LOG_` prefix to
 ///        get the proper environment variable, ie. "loader"
 /// @param default_log_level provides the default logging configuration when the environment
@@ -156,6 +209,26 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
             map->erase(kv);
         }
 
+        std::optional<logger::AsyncPolicy> async_policy;
+        size_t async_capacity = 8192;
+        kv = map->find("async");
+        if (kv != map->end()) {
+            auto policy = kv->second.front();
+            if (policy == "block") {
+                async_policy = logger::AsyncPolicy::Block;
+            } else if (policy == "drop") {
+                async_policy = logger::AsyncPolicy::Drop;
+            } else {
+                throw std::invalid_argument(
+                    "Invalid async policy '" + policy +
+                    "', valid policies are: block, drop");
+            }
+            if (kv->second.size() > 1) {
+                async_capacity = std::stoul(kv->second[1]);
+            }
+            map->erase(kv);
+        }
+
         if (!map->empty()) {
             std::cerr << "Wrong logger environment variable parameter: '"
                       << map->begin()->first
@@ -171,6 +244,9 @@ inline Logger create_logger(std::string logger_name, bool skip_prefix,
                                    skip_prefix, skip_linebreak)
                    : sink_from_str(logger_name, values[0], "", skip_prefix,
                                    skip_linebreak);
+        if (async_policy) {
+            sink->setAsync(*async_policy, async_capacity);
+        }
     } catch (const std::invalid_argument &e) {
         std::cerr << "Error when creating a logger instance from the '"
                   << env_var_name.str() << "' environment variable:\n"
@@ -6,6 +6,9 @@
 #ifndef UR_LOGGER_DETAILS_HPP
 #define UR_LOGGER_DETAILS_HPP 1
 
+#include <string_view>
+
+#include "ur_format.hpp"
 #include "ur_level.hpp"
 #include "ur_sinks.hpp"
 
@@ -115,12 +118,87 @@ class Logger {
         sink->log(level, format, std::forward<Args>(args)...);
     }
 
+    /// @brief Overloads taking a format wrapped in UR_LOG_FMT. The format is
+    ///        parsed and checked against the argument count at compile time.
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void debug(Fmt format, Args &&...args) {
+        log(logger::Level::DEBUG, format, std::forward<Args>(args)...);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void info(Fmt format, Args &&...args) {
+        log(logger::Level::INFO, format, std::forward<Args>(args)...);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void warning(Fmt format, Args &&...args) {
+        log(logger::Level::WARN, format, std::forward<Args>(args)...);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void warn(Fmt format, Args &&...args) {
+        log(logger::Level::WARN, format, std::forward<Args>(args)...);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void error(Fmt format, Args &&...args) {
+        log(logger::Level::ERR, format, std::forward<Args>(args)...);
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void always(Fmt format, Args &&...args) {
+        if (sink) {
+            sink->log(logger::Level::QUIET, compile<Args...>(format),
+                      std::forward<Args>(args)...);
+        }
+    }
+
+    template <typename Fmt, typename... Args,
+              typename = details::enable_if_log_fmt_t<Fmt>>
+    void log(logger::Level level, Fmt format, Args &&...args) {
+        if (!sink) {
+            return;
+        }
+        // Legacy sinks print regardless of the level, as in the const char *
+        // overload above.
+        if (!isLegacySink && level < this->level) {
+            return;
+        }
+
+        sink->log(level, compile<Args...>(format),
+                  std::forward<Args>(args)...);
+    }
+
+    /// @brief Whether a message at @p level would be printed. Legacy sinks
+    ///        print every message, whatever the level.
+    bool isLevelEnabled(logger::Level level) const {
+        return sink && (isLegacySink || level >= this->level);
+    }
+
     void setLegacySink(std::unique_ptr<logger::Sink> legacySink) {
         this->isLegacySink = true;
         this->sink = std::move(legacySink);
     }
 
   private:
+    template <typename... Args, typename Fmt>
+    static const auto &compile(Fmt format) {
+        constexpr std::string_view str = format();
+        static constexpr details::compiled_format_t<str.size(),
+                                                    sizeof...(Args)>
+            compiled{str};
+        static_assert(compiled.valid,
+                      "Log format must contain one {} per argument, and "
+                      "literal braces must be escaped as {{ or }}");
+        return compiled;
+    }
+
     logger::Level level;
     std::unique_ptr<logger::Sink> sink;
     bool isLegacySink = false;
@@ -0,0 +1,95 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#ifndef UR_MPMC_QUEUE_HPP
+#define UR_MPMC_QUEUE_HPP 1
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+namespace logger {
+
+/// @brief Bounded lock-free queue (D. Vyukov's MPMC design). Each cell carries
+///        a sequence number telling producers and consumers whose turn it is,
+///        so neither side ever takes a lock. Capacity is rounded up to a
+///        power of two.
+template <typename T> class bounded_mpmc_queue_t {
+    struct cell_t {
+        std::atomic<size_t> sequence;
+        T value;
+    };
+
+  public:
+    explicit bounded_mpmc_queue_t(size_t capacity) {
+        size_t size = 2;
+        while (size < capacity) {
+            size <<= 1;
+        }
+        mask = size - 1;
+        cells = std::make_unique<cell_t[]>(size);
+        for (size_t i = 0; i < size; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    bounded_mpmc_queue_t(const bounded_mpmc_queue_t &) = delete;
+    bounded_mpmc_queue_t &operator=(const bounded_mpmc_queue_t &) = delete;
+
+    bool try_push(T &&value) {
+        auto pos = enqueuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto &cell = cells[pos & mask];
+            auto seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+            if (diff == 0) {
+                if (enqueuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.value = std::move(value);
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // full
+            } else {
+                pos = enqueuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool try_pop(T &value) {
+        auto pos = dequeuePos.load(std::memory_order_relaxed);
+        for (;;) {
+            auto &cell = cells[pos & mask];
+            auto seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff =
+                static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+            if (diff == 0) {
+                if (dequeuePos.compare_exchange_weak(
+                        pos, pos + 1, std::memory_order_relaxed)) {
+                    value = std::move(cell.value);
+                    cell.sequence.store(pos + mask + 1,
+                                        std::memory_order_release);
+                    return true;
+                }
+            } else if (diff < 0) {
+                return false; // empty
+            } else {
+                pos = dequeuePos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+  private:
+    std::unique_ptr<cell_t[]> cells;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) std::atomic<size_t> dequeuePos{0};
+};
+
+} // namespace logger
+
+#endif /* UR_MPMC_QUEUE_HPP */
@@ -6,13 +6,23 @@
 #ifndef UR_SINKS_HPP
 #define UR_SINKS_HPP 1
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <csignal>
 #include <fstream>
 #include <iostream>
+#include <iterator>
 #include <mutex>
 #include <sstream>
+#include <thread>
+#include <vector>
 
 #include "ur_filesystem_resolved.hpp"
+#include "ur_format.hpp"
 #include "ur_level.hpp"
+#include "ur_mpmc_queue.hpp"
 #include "ur_print.hpp"
 
 namespace logger {
@@ -21,6 +31,9 @@ namespace logger {
 inline bool isTearDowned = false;
 #endif
 
+/// @brief What an asynchronous sink does when its queue is full.
+enum class AsyncPolicy { Block, Drop };
+
 class Sink {
   public:
     template <typename... Args>
@@ -49,9 +62,65 @@ class Sink {
 #endif
     }
 
+    /// @brief Same as log(), but with a format string parsed at compile time
+    ///        (see UR_LOG_FMT). The message is built in a thread-local buffer
+    ///        that is reused between calls, so steady-state logging doesn't
+    ///        allocate for integer and string arguments.
+    template <size_t Len, size_t N, typename... Args>
+    void log(logger::Level level, const details::compiled_format_t<Len, N> &fmt,
+             Args &&...args) {
+        thread_local std::string tlsBuffer;
+        thread_local bool tlsBufferBusy = false;
+        // An operator<< that logs itself would otherwise clobber the buffer.
+        std::string nestedBuffer;
+        std::string &buffer = tlsBufferBusy ? nestedBuffer : tlsBuffer;
+        bool *busy = tlsBufferBusy ? nullptr : &tlsBufferBusy;
+        if (busy) {
+            *busy = true;
+        }
+
+        buffer.clear();
+        if (!skip_prefix && level != logger::Level::QUIET) {
+            buffer += '<';
+            buffer += logger_name;
+            buffer += ">[";
+            buffer += level_to_str(level);
+            buffer += "]: ";
+        }
+        details::formatTo(buffer, fmt, std::forward<Args>(args)...);
+        if (!skip_linebreak) {
+            buffer += '\n';
+        }
+#if defined(_WIN32)
+        if (isTearDowned) {
+            std::cerr << buffer << "\n";
+        } else {
+            print(level, buffer);
+        }
+#else
+        print(level, buffer);
+#endif
+        if (busy) {
+            *busy = false;
+        }
+    }
+
     void setFlushLevel(logger::Level level) { this->flush_level = level; }
 
-    virtual ~Sink() = default;
+    /// @brief Hands formatted messages to a background writer thread through
+    ///        a bounded lock-free queue, instead of writing them on the
+    ///        calling thread. Messages still queued when the process crashes
+    ///        are written out by a fatal signal handler.
+    void setAsync(AsyncPolicy policy, size_t capacity = 8192) {
+        if (async) {
+            return;
+        }
+        async = std::make_unique<async_state_t>(policy, capacity);
+        async->thread = std::thread([this] { asyncLoop(); });
+        registerAsyncSink(this);
+    }
+
+    virtual ~Sink() { stopAsync(); }
 
   protected:
     std::ostream *ostream;
@@ -66,6 +135,14 @@ class Sink {
     }
 
     virtual void print(logger::Level level, const std::string &msg) {
+        if (async) {
+            enqueue(level, msg);
+            return;
+        }
+        write(level, msg);
+    }
+
+    void write(logger::Level level, const std::string &msg) {
         std::scoped_lock<std::mutex> lock(output_mutex);
         *ostream << msg;
         if (level >= flush_level) {
@@ -73,11 +150,156 @@ class Sink {
         }
     }
 
+    // Must be called by sinks that own their stream before it is destroyed.
+    void stopAsync() {
+        if (!async) {
+            return;
+        }
+        unregisterAsyncSink(this);
+        async->stop = true;
+        async->cv.notify_one();
+        async->thread.join();
+        async.reset();
+    }
+
   private:
+    struct message_t {
+        logger::Level level;
+        std::string text;
+    };
+
+    struct async_state_t {
+        async_state_t(AsyncPolicy policy, size_t capacity)
+            : queue(capacity), policy(policy) {}
+
+        bounded_mpmc_queue_t<message_t> queue;
+        AsyncPolicy policy;
+        std::atomic<bool> stop{false};
+        std::atomic<bool> idle{false};
+        std::atomic<uint64_t> dropped{0};
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::thread thread;
+    };
+
+    void enqueue(logger::Level level, const std::string &msg) {
+        message_t message{level, msg};
+        while (!async->queue.try_push(std::move(message))) {
+            if (async->policy == AsyncPolicy::Drop) {
+                async->dropped.fetch_add(1, std::memory_order_relaxed);
+                return;
+            }
+            async->cv.notify_one();
+            std::this_thread::yield();
+        }
+        if (async->idle.load(std::memory_order_relaxed)) {
+            async->cv.notify_one();
+        }
+    }
+
+    void asyncLoop() {
+        message_t message;
+        for (;;) {
+            while (async->queue.try_pop(message)) {
+                write(message.level, message.text);
+            }
+            if (auto dropped = async->dropped.exchange(0)) {
+                std::ostringstream note;
+                note << "<" << logger_name << ">[WARNING]: " << dropped
+                     << " log messages dropped\n";
+                write(logger::Level::WARN, note.str());
+            }
+            if (async->stop) {
+                // producers are gone, pick up whatever raced with the flag
+                while (async->queue.try_pop(message)) {
+                    write(message.level, message.text);
+                }
+                break;
+            }
+            std::unique_lock<std::mutex> lock(async->mutex);
+            async->idle = true;
+            async->cv.wait_for(lock, std::chrono::milliseconds(10));
+            async->idle = false;
+        }
+        std::scoped_lock<std::mutex> lock(output_mutex);
+        ostream->flush();
+    }
+
+    // Best effort: runs from a signal handler, so it can't wait for locks
+    // that the crashing thread might be holding.
+    void drainOnCrash() {
+        std::unique_lock<std::mutex> lock(output_mutex, std::try_to_lock);
+        message_t message;
+        while (async->queue.try_pop(message)) {
+            *ostream << message.text;
+        }
+        ostream->flush();
+    }
+
+    static std::mutex &asyncSinksMutex() {
+        static std::mutex m;
+        return m;
+    }
+    static std::vector<Sink *> &asyncSinks() {
+        static std::vector<Sink *> sinks;
+        return sinks;
+    }
+
+    static void registerAsyncSink(Sink *sink) {
+        std::scoped_lock<std::mutex> lock(asyncSinksMutex());
+        asyncSinks().push_back(sink);
+#if !defined(_WIN32)
+        static std::once_flag installed;
+        std::call_once(installed, installCrashHandler);
+#endif
+    }
+
+    static void unregisterAsyncSink(Sink *sink) {
+        std::scoped_lock<std::mutex> lock(asyncSinksMutex());
+        auto &sinks = asyncSinks();
+        sinks.erase(std::remove(sinks.begin(), sinks.end(), sink), sinks.end());
+    }
+
+#if !defined(_WIN32)
+    static constexpr int crashSignals[] = {SIGSEGV, SIGBUS, SIGFPE, SIGILL,
+                                           SIGABRT};
+
+    static struct sigaction *previousActions() {
+        static struct sigaction actions[std::size(crashSignals)];
+        return actions;
+    }
+
+    static void installCrashHandler() {
+        struct sigaction action = {};
+        action.sa_handler = onCrash;
+        sigemptyset(&action.sa_mask);
+        for (size_t i = 0; i < std::size(crashSignals); ++i) {
+            sigaction(crashSignals[i], &action, &previousActions()[i]);
+        }
+    }
+
+    static void onCrash(int sig) {
+        std::unique_lock<std::mutex> lock(asyncSinksMutex(), std::try_to_lock);
+        if (lock.owns_lock()) {
+            for (auto *sink : asyncSinks()) {
+                sink->drainOnCrash();
+            }
+        }
+        // restore whatever handled the signal before us and re-raise
+        for (size_t i = 0; i < std::size(crashSignals); ++i) {
+            if (crashSignals[i] == sig) {
+                sigaction(sig, &previousActions()[i], nullptr);
+            }
+        }
+        raise(sig);
+    }
+#endif
+
     std::string logger_name;
     bool skip_prefix;
     bool skip_linebreak;
     std::mutex output_mutex;
+    std::unique_ptr<async_state_t> async;
     const char *error_prefix = "Log message syntax error: ";
 
     void format(std::ostringstream &buffer, const char *fmt) {
@@ -207,7 +429,7 @@ class FileSink : public Sink {
         this->flush_level = flush_lvl;
     }
 
-    ~FileSink() = default;
+    ~FileSink() override { stopAsync(); }
 
   private:
     std::ofstream ofstream;
@@ -15,17 +15,24 @@
 #include <umf/memory_pool_ops.h>
 #include <umf/memory_provider.h>
 #include <umf/memory_provider_ops.h>
+#include <umf/pools/pool_disjoint.h>
 #include <ur_api.h>
 
 #include "logger/ur_logger.hpp"
 
 #include <array>
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
 #include <stdexcept>
 #include <tuple>
 #include <utility>
 
+namespace ur {
+class memory_accounting;
+} // namespace ur
+
 namespace umf {
 
 using pool_unique_handle_t =
@@ -241,6 +248,245 @@ template <typename Type> umf_result_t &getPoolLastStatusRef() {
     return last_status;
 }
 
+/// @brief configures the per-thread cache put in front of a disjoint pool by
+/// disjointPoolMakeUnique().
+struct thread_cache_params_t {
+    // Largest allocation served from the cache, 0 disables the cache
+    size_t MaxCachedSize = 0;
+    // Smallest size class, allocations are rounded up to a power of two
+    size_t MinCachedSize = 64;
+    // Number of blocks a thread keeps per size class, twice this at most
+    size_t MagazineSize = 32;
+};
+
+/// @brief configures the arena of the pools created by
+/// disjointPoolMakeUnique(): memory allocated from the provider when the pool
+/// is created, which the pool's allocations are carved out of first.
+struct arena_params_t {
+    // Bytes allocated up front, 0 disables the arena
+    size_t Size = 0;
+    // Alignment of the arena, the size is rounded up to it. 0 picks 2MB
+    // pages for arenas of at least 2MB, 64KB pages otherwise.
+    size_t PageSize = 0;
+};
+
+/// @brief bounds the bytes of free slabs cached by the pools sharing it, like
+/// umf_disjoint_pool_shared_limits_t.
+struct slab_cache_limits_t {
+    explicit slab_cache_limits_t(size_t maxSize) : MaxSize(maxSize) {}
+
+    const size_t MaxSize;
+    std::atomic<size_t> TotalSize{0};
+};
+
+/// @brief configures the cache of free slabs of the pools created by
+/// disjointPoolMakeUnique().
+struct slab_cache_params_t {
+    // Shared limit of the cached bytes, unlimited if null. The pools keep it
+    // alive, their configuration may not outlive them.
+    std::shared_ptr<slab_cache_limits_t> Limits;
+    // When the memory provider fails, release the slabs cached by every
+    // pool and retry
+    bool TrimOnAllocFailure = false;
+};
+
+/// @brief usage statistics of the pools created by disjointPoolMakeUnique().
+/// Every update is also applied to the parent, if any, which aggregates the
+/// statistics of several pools. A parent must outlive the pools updating it,
+/// so it is declared before them in the handles of the adapters.
+struct pool_stats_t {
+    // Allocations of up to 2^i bytes are counted in bucket i
+    static constexpr size_t NumBuckets = 64;
+
+    explicit pool_stats_t(pool_stats_t *parent = nullptr) : Parent(parent) {}
+
+    pool_stats_t(const pool_stats_t &) = delete;
+    pool_stats_t &operator=(const pool_stats_t &) = delete;
+
+    pool_stats_t *Parent;
+
+    // Bytes requested by the live allocations
+    std::atomic<size_t> UsedSize{0};
+    std::atomic<size_t> PeakUsedSize{0};
+    // Bytes allocated from the memory provider, including the free blocks
+    // and the cached slabs
+    std::atomic<size_t> ReservedSize{0};
+    std::atomic<size_t> PeakReservedSize{0};
+    // Live allocations of the memory provider
+    std::atomic<uint64_t> SlabCount{0};
+    // Allocations served from memory the pool already held
+    std::atomic<uint64_t> BucketHits[NumBuckets] = {};
+    // Allocations which had to allocate from the memory provider
+    std::atomic<uint64_t> BucketMisses[NumBuckets] = {};
+
+    static size_t getBucket(size_t size);
+
+    void onAlloc(size_t size, bool hit);
+    void onFree(size_t size);
+    void onProviderAlloc(size_t size);
+    void onProviderFree(size_t size);
+};
+
+/// @brief creates a UMF disjoint pool. If the cache is enabled, small
+/// allocations are served from per-thread magazines of free blocks, which
+/// are exchanged with the pool in bulk, so that threads allocating in
+/// parallel rarely contend on the pool's bucket locks. If stats is not null,
+/// the pool keeps statistics of its own, aggregated into stats, and logs them
+/// when destroyed.
+///
+/// The disjoint pool releases its empty slabs right away, into a cache in
+/// front of the memory provider. The cache keeps up to params->Capacity
+/// slabs of each size, within slabParams.Limits, and can be trimmed with
+/// poolTrim().
+///
+/// If arenaParams.Size is not 0, allocations are carved out of an arena
+/// allocated up front by a buddy allocator, and only go to the disjoint pool
+/// once the arena is full.
+std::pair<umf_result_t, pool_unique_handle_t>
+disjointPoolMakeUnique(provider_unique_handle_t provider,
+                       umf_disjoint_pool_params_t *params,
+                       const thread_cache_params_t &cacheParams,
+                       const slab_cache_params_t &slabParams,
+                       const arena_params_t &arenaParams,
+                       pool_stats_t *stats = nullptr);
+
+/// @brief releases the free slabs cached by hPool, a pool created by
+/// disjointPoolMakeUnique(), to its memory provider until at most keepSize
+/// bytes are left. Returns the bytes left cached.
+size_t poolTrim(umf_memory_pool_handle_t hPool, size_t keepSize);
+
+/// @brief zeroes the memory of the pools created by zeroedPoolMakeUnique(),
+/// usually on a copy engine of the device, without waiting for the fills.
+struct zero_filler_t {
+    virtual ~zero_filler_t() = default;
+    // Submits the zeroing of size bytes at ptr, which completes after the
+    // fills submitted before it, and sets seq to its sequence number
+    virtual umf_result_t fill(void *ptr, size_t size, uint64_t *seq) = 0;
+    // Waits until the fill numbered seq, and the ones before it, completed
+    virtual umf_result_t wait(uint64_t seq) = 0;
+};
+
+/// @brief configures the pools created by zeroedPoolMakeUnique().
+struct zeroed_pool_params_t {
+    // Zeroes the blocks, the pools keep it alive
+    std::shared_ptr<zero_filler_t> Filler;
+    // Largest allocation served from zeroed blocks, the larger ones are
+    // zeroed when allocated
+    size_t MaxBlockSize = 2 * 1024 * 1024;
+    // Blocks of each size class zeroed ahead of the allocations
+    size_t ReserveDepth = 2;
+    // Bytes of free zeroed blocks kept, over all the size classes
+    size_t MaxReservedSize = 64 * 1024 * 1024;
+};
+
+/// @brief creates a pool of zero-initialized memory over a disjoint pool
+/// with params. Allocations are rounded up to a power of two and served
+/// from blocks zeroParams.Filler zeroed ahead, and freed blocks are zeroed
+/// again in the background, so an allocation only waits for a fill when its
+/// size class has no block left.
+std::pair<umf_result_t, pool_unique_handle_t>
+zeroedPoolMakeUnique(provider_unique_handle_t provider,
+                     umf_disjoint_pool_params_t *params,
+                     const zeroed_pool_params_t &zeroParams);
+
+/// @brief wraps provider so that the memory it allocates is counted as type
+/// in accounting, which must outlive it.
+std::pair<umf_result_t, provider_unique_handle_t>
+accountingProviderMakeUnique(provider_unique_handle_t provider,
+                             ur::memory_accounting *accounting,
+                             ur_exp_context_memory_type_t type);
+
+namespace detail {
+// Order of the smallest power of two that is at least value, or the number of
+// bits of size_t for the values above the largest power of two
+inline unsigned ceilLog2(size_t value) {
+    constexpr unsigned bits = 8 * sizeof(size_t);
+    unsigned order = 0;
+    while (order < bits && (size_t(1) << order) < value) {
+        ++order;
+    }
+    return order;
+}
+
+// Increments on every allocation of the memory provider below a slab cache,
+// so a pool can tell whether it served an allocation from its own memory
+inline uint64_t &getProviderAllocCountRef() {
+    static thread_local uint64_t count = 0;
+    return count;
+}
+
+class slab_cache_provider;
+
+// Wraps provider in the slab cache of a disjoint pool with params. The cache
+// keeps the statistics of the memory it holds, aggregated into stats.
+std::pair<umf_result_t, provider_unique_handle_t>
+slabCacheMakeUnique(provider_unique_handle_t provider,
+                    const umf_disjoint_pool_params_t &params,
+                    const slab_cache_params_t &slabParams, pool_stats_t *stats,
+                    slab_cache_provider **cache);
+
+pool_stats_t &getSlabCacheStats(slab_cache_provider *cache);
+
+// Makes the cache, which must be hPool's, reachable through poolTrim()
+void registerSlabCache(slab_cache_provider *cache,
+                       umf_memory_pool_handle_t hPool);
+
+// Creates the pool with the given umf_pool_create_flags_t
+umf_result_t disjointPoolCreate(umf_memory_provider_handle_t provider,
+                                umf_disjoint_pool_params_t *params,
+                                const thread_cache_params_t &cacheParams,
+                                const arena_params_t &arenaParams,
+                                umf_pool_create_flags_t flags,
+                                umf_memory_pool_handle_t *hPool);
+
+// Creates the arena in front of the pool, which has no arena of its own
+umf_result_t arenaPoolCreate(umf_memory_provider_handle_t provider,
+                             umf_disjoint_pool_params_t *params,
+                             const thread_cache_params_t &cacheParams,
+                             const arena_params_t &arenaParams,
+                             umf_pool_create_flags_t flags,
+                             umf_memory_pool_handle_t *hPool);
+
+// The pool keeps its statistics into stats, which must outlive it
+std::pair<umf_result_t, pool_unique_handle_t>
+statsPoolMakeUnique(provider_unique_handle_t provider,
+                    umf_disjoint_pool_params_t *params,
+                    const thread_cache_params_t &cacheParams,
+                    const arena_params_t &arenaParams, pool_stats_t *stats);
+} // namespace detail
+
+/// @brief returns the statistic propName of stats, for urUSMPoolGetInfo.
+template <typename ReturnHelper>
+ur_result_t getPoolStatsInfo(const pool_stats_t &stats,
+                             ur_usm_pool_info_t propName,
+                             ReturnHelper &returnValue) {
+    switch (propName) {
+    case UR_USM_POOL_INFO_USED_SIZE_EXP:
+        return returnValue(stats.UsedSize.load());
+    case UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP:
+        return returnValue(stats.PeakUsedSize.load());
+    case UR_USM_POOL_INFO_RESERVED_SIZE_EXP:
+        return returnValue(stats.ReservedSize.load());
+    case UR_USM_POOL_INFO_PEAK_RESERVED_SIZE_EXP:
+        return returnValue(stats.PeakReservedSize.load());
+    case UR_USM_POOL_INFO_SLAB_COUNT_EXP:
+        return returnValue(stats.SlabCount.load());
+    case UR_USM_POOL_INFO_BUCKET_HITS_EXP:
+    case UR_USM_POOL_INFO_BUCKET_MISSES_EXP: {
+        const auto &counters = propName == UR_USM_POOL_INFO_BUCKET_HITS_EXP
+                                   ? stats.BucketHits
+                                   : stats.BucketMisses;
+        std::array<uint64_t, pool_stats_t::NumBuckets> values;
+        for (size_t i = 0; i < values.size(); ++i) {
+            values[i] = counters[i].load();
+        }
+        return returnValue(values.data(), values.size());
+    }
+    default:
+        return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    }
+}
+
 ur_result_t getProviderNativeError(const char *providerName,
                                    int32_t nativeError);
 
@@ -0,0 +1,154 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+#include "ur_memory_accounting.hpp"
+
+#include <mutex>
+#include <unordered_map>
+
+namespace umf {
+
+namespace {
+
+/// Counts the memory of the upstream provider in the memory accounting of a
+/// context. The sizes of the live allocations are kept, as the pools don't
+/// all pass them to free().
+class accounting_provider {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Upstream,
+                            ur::memory_accounting *Accounting,
+                            ur_exp_context_memory_type_t Type) {
+        this->Upstream = Upstream;
+        this->Accounting = Accounting;
+        this->Type = Type;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~accounting_provider() {
+        if (Upstream) {
+            umfMemoryProviderDestroy(Upstream);
+        }
+    }
+
+    umf_result_t alloc(size_t Size, size_t Alignment, void **Ptr) {
+        auto Ret = umfMemoryProviderAlloc(Upstream, Size, Alignment, Ptr);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        try {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            Sizes[*Ptr] = Size;
+        } catch (...) {
+            umfMemoryProviderFree(Upstream, *Ptr, Size);
+            *Ptr = nullptr;
+            return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        Accounting->onAlloc(Type, Size);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t free(void *Ptr, size_t Size) {
+        size_t Counted = 0;
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            auto It = Sizes.find(Ptr);
+            if (It != Sizes.end()) {
+                Counted = It->second;
+                Sizes.erase(It);
+            }
+        }
+        auto Ret = umfMemoryProviderFree(Upstream, Ptr, Size ? Size : Counted);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            Sizes[Ptr] = Counted;
+            return Ret;
+        }
+        Accounting->onFree(Type, Counted);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    void get_last_native_error(const char **ErrMsg, int32_t *ErrCode) {
+        umfMemoryProviderGetLastNativeError(Upstream, ErrMsg, ErrCode);
+    }
+
+    umf_result_t get_recommended_page_size(size_t Size, size_t *PageSize) {
+        return umfMemoryProviderGetRecommendedPageSize(Upstream, Size,
+                                                       PageSize);
+    }
+
+    umf_result_t get_min_page_size(void *Ptr, size_t *PageSize) {
+        return umfMemoryProviderGetMinPageSize(Upstream, Ptr, PageSize);
+    }
+
+    const char *get_name() { return umfMemoryProviderGetName(Upstream); }
+
+    umf_result_t purge_lazy(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeLazy(Upstream, Ptr, Size);
+    }
+
+    umf_result_t purge_force(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeForce(Upstream, Ptr, Size);
+    }
+
+    // The allocations are counted whole
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t get_ipc_handle_size(size_t *Size) {
+        return umfMemoryProviderGetIPCHandleSize(Upstream, Size);
+    }
+
+    umf_result_t get_ipc_handle(const void *Ptr, size_t Size, void *IpcData) {
+        return umfMemoryProviderGetIPCHandle(Upstream, Ptr, Size, IpcData);
+    }
+
+    umf_result_t put_ipc_handle(void *IpcData) {
+        return umfMemoryProviderPutIPCHandle(Upstream, IpcData);
+    }
+
+    // The memory opened belongs to the process which allocated it
+    umf_result_t open_ipc_handle(void *IpcData, void **Ptr) {
+        return umfMemoryProviderOpenIPCHandle(Upstream, IpcData, Ptr);
+    }
+
+    umf_result_t close_ipc_handle(void *Ptr, size_t Size) {
+        return umfMemoryProviderCloseIPCHandle(Upstream, Ptr, Size);
+    }
+
+  private:
+    umf_memory_provider_handle_t Upstream = nullptr;
+    ur::memory_accounting *Accounting = nullptr;
+    ur_exp_context_memory_type_t Type = UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL;
+
+    std::mutex Mutex;
+    std::unordered_map<void *, size_t> Sizes;
+};
+
+} // namespace
+
+std::pair<umf_result_t, provider_unique_handle_t>
+accountingProviderMakeUnique(provider_unique_handle_t provider,
+                             ur::memory_accounting *accounting,
+                             ur_exp_context_memory_type_t type) {
+    auto ret = memoryProviderMakeUnique<accounting_provider>(provider.get(),
+                                                             accounting, type);
+    if (ret.first == UMF_RESULT_SUCCESS) {
+        provider.release(); // the accounting provider now owns it
+    }
+    return ret;
+}
+
+} // namespace umf
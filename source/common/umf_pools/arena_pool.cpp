@@ -0,0 +1,236 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <mutex>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace umf {
+
+namespace {
+
+constexpr size_t LargePageSize = 2 * 1024 * 1024;
+constexpr size_t SmallPageSize = 64 * 1024;
+
+/// Carves allocations out of an arena allocated up front, in pages large
+/// enough for the driver to map it with few TLB entries, and falls back to a
+/// disjoint pool once the arena is full. The arena is handed out by a buddy
+/// allocator: blocks are a power of two in size and aligned to their size
+/// within the arena, so a freed block merges back with its free buddy.
+class arena_pool {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Provider,
+                            umf_disjoint_pool_params_t Params,
+                            thread_cache_params_t CacheParams,
+                            arena_params_t ArenaParams) {
+        this->Provider = Provider;
+        PageSize = ArenaParams.PageSize;
+        if (PageSize == 0) {
+            PageSize = ArenaParams.Size >= LargePageSize ? LargePageSize
+                                                         : SmallPageSize;
+        }
+        if (PageSize & (PageSize - 1)) {
+            return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        ArenaSize = (ArenaParams.Size + PageSize - 1) & ~(PageSize - 1);
+
+        // The inner pool gets the memory of this pool's provider, which
+        // tracks it as memory of this pool already.
+        umf_memory_pool_handle_t hPool = nullptr;
+        auto Ret = detail::disjointPoolCreate(
+            Provider, &Params, CacheParams, arena_params_t{},
+            UMF_POOL_CREATE_FLAG_DISABLE_TRACK, &hPool);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        Inner = pool_unique_handle_t(hPool, umfPoolDestroy);
+
+        void *Ptr = nullptr;
+        Ret = umfMemoryProviderAlloc(Provider, ArenaSize, PageSize, &Ptr);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        Base = reinterpret_cast<uintptr_t>(Ptr);
+
+        // Split the arena in the largest blocks that fit, each one is
+        // aligned to its size as the sizes decrease.
+        size_t Offset = 0;
+        for (unsigned Order = MaxOrder; Order-- > MinOrder;) {
+            if (ArenaSize - Offset >= (size_t(1) << Order)) {
+                FreeBlocks[Order].insert(Offset);
+                Offset += size_t(1) << Order;
+            }
+        }
+        logger::debug("USM arena of {} bytes in {} bytes pages", ArenaSize,
+                      PageSize);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~arena_pool() {
+        // Blocks cached by the inner pool may live in its provider's slabs
+        Inner.reset();
+        if (Base) {
+            umfMemoryProviderFree(Provider, reinterpret_cast<void *>(Base),
+                                  ArenaSize);
+        }
+    }
+
+    void *malloc(size_t Size) { return aligned_malloc(Size, 0); }
+
+    // The memory may not be accessible by the host to be cleared
+    void *calloc(size_t Num, size_t Size) {
+        return umfPoolCalloc(Inner.get(), Num, Size);
+    }
+
+    void *realloc(void *Ptr, size_t Size) {
+        if (!Ptr) {
+            return malloc(Size);
+        }
+        if (!contains(Ptr)) {
+            return umfPoolRealloc(Inner.get(), Ptr, Size);
+        }
+        getPoolLastStatusRef<arena_pool>() = UMF_RESULT_ERROR_NOT_SUPPORTED;
+        return nullptr;
+    }
+
+    void *aligned_malloc(size_t Size, size_t Alignment) {
+        if (Size != 0 && Alignment <= PageSize) {
+            auto Order =
+                std::max({detail::ceilLog2(Size), detail::ceilLog2(Alignment),
+                          MinOrder});
+            if (Order < MaxOrder) {
+                if (auto *Ptr = take(Order)) {
+                    return Ptr;
+                }
+            }
+        }
+        auto *Ptr = umfPoolAlignedMalloc(Inner.get(), Size, Alignment);
+        if (!Ptr) {
+            getPoolLastStatusRef<arena_pool>() =
+                umfPoolGetLastAllocationError(Inner.get());
+        }
+        return Ptr;
+    }
+
+    size_t malloc_usable_size(void *Ptr) {
+        if (!contains(Ptr)) {
+            return umfPoolMallocUsableSize(Inner.get(), Ptr);
+        }
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto It = UsedBlocks.find(reinterpret_cast<uintptr_t>(Ptr) - Base);
+        return It == UsedBlocks.end() ? 0 : size_t(1) << It->second;
+    }
+
+    umf_result_t free(void *Ptr) {
+        if (!Ptr) {
+            return UMF_RESULT_SUCCESS;
+        }
+        if (!contains(Ptr)) {
+            return umfPoolFree(Inner.get(), Ptr);
+        }
+        return put(reinterpret_cast<uintptr_t>(Ptr) - Base);
+    }
+
+    umf_result_t get_last_allocation_error() {
+        return getPoolLastStatusRef<arena_pool>();
+    }
+
+  private:
+    // Blocks of 2^MinOrder bytes at least
+    static constexpr unsigned MinOrder = 8;
+    static constexpr unsigned MaxOrder = 64;
+
+    bool contains(void *Ptr) const {
+        auto Addr = reinterpret_cast<uintptr_t>(Ptr);
+        return Addr >= Base && Addr - Base < ArenaSize;
+    }
+
+    void *take(unsigned Order) {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto From = Order;
+        while (From < MaxOrder && FreeBlocks[From].empty()) {
+            ++From;
+        }
+        if (From == MaxOrder) {
+            return nullptr;
+        }
+
+        auto Offset = *FreeBlocks[From].begin();
+        try {
+            UsedBlocks[Offset] = static_cast<uint8_t>(Order);
+        } catch (...) {
+            return nullptr;
+        }
+        FreeBlocks[From].erase(FreeBlocks[From].begin());
+        // Give the upper halves back, down to the order asked for
+        while (From > Order) {
+            --From;
+            FreeBlocks[From].insert(Offset + (size_t(1) << From));
+        }
+        return reinterpret_cast<void *>(Base + Offset);
+    }
+
+    umf_result_t put(size_t Offset) {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto It = UsedBlocks.find(Offset);
+        if (It == UsedBlocks.end()) {
+            return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        unsigned Order = It->second;
+        UsedBlocks.erase(It);
+
+        // A merged block that fits in the arena lies within one of the
+        // blocks it was split in first, so it's merged as long as it fits.
+        for (; Order + 1 < MaxOrder; ++Order) {
+            auto Buddy = Offset ^ (size_t(1) << Order);
+            auto Merged = std::min(Offset, Buddy);
+            if (Merged + (size_t(2) << Order) > ArenaSize ||
+                FreeBlocks[Order].erase(Buddy) == 0) {
+                break;
+            }
+            Offset = Merged;
+        }
+        FreeBlocks[Order].insert(Offset);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_memory_provider_handle_t Provider = nullptr;
+    uintptr_t Base = 0;
+    size_t ArenaSize = 0;
+    size_t PageSize = 0;
+    pool_unique_handle_t Inner{nullptr, nullptr};
+
+    std::mutex Mutex;
+    // Offsets of the free blocks of each order
+    std::vector<std::set<size_t>> FreeBlocks =
+        std::vector<std::set<size_t>>(MaxOrder);
+    // Orders of the allocated blocks, by offset
+    std::unordered_map<size_t, uint8_t> UsedBlocks;
+};
+
+} // namespace
+
+umf_result_t detail::arenaPoolCreate(umf_memory_provider_handle_t provider,
+                                     umf_disjoint_pool_params_t *params,
+                                     const thread_cache_params_t &cacheParams,
+                                     const arena_params_t &arenaParams,
+                                     umf_pool_create_flags_t flags,
+                                     umf_memory_pool_handle_t *hPool) {
+    auto argsTuple = std::make_tuple(*params, cacheParams, arenaParams);
+    auto ops = poolMakeUniqueOps<arena_pool, decltype(argsTuple)>();
+    return umfPoolCreate(&ops, provider, &argsTuple, flags, hPool);
+}
+
+} // namespace umf
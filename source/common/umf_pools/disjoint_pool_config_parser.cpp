@@ -46,6 +46,14 @@ DisjointPoolAllConfigs::DisjointPoolAllConfigs(int trace) {
     Configs[DisjointPoolMemType::Shared].MinBucketSize = 512;
     Configs[DisjointPoolMemType::SharedReadOnly].MinBucketSize = 512;
 
+    for (int MemType = 0; MemType < DisjointPoolMemType::All; MemType++) {
+        ThreadCaches[MemType].MinCachedSize = Configs[MemType].MinBucketSize;
+    }
+
+    // Device memory is the scarcest, the cached slabs of the other pools may
+    // be standing in its way.
+    SlabCaches[DisjointPoolMemType::Device].TrimOnAllocFailure = true;
+
     // Initialize default pool settings.
     Configs[DisjointPoolMemType::Host].MaxPoolableSize = 2_MB;
     Configs[DisjointPoolMemType::Host].Capacity = 4;
@@ -66,6 +74,16 @@ DisjointPoolAllConfigs::DisjointPoolAllConfigs(int trace) {
     Configs[DisjointPoolMemType::SharedReadOnly].SlabMinSize = 2_MB;
 }
 
+std::pair<umf_result_t, umf::pool_unique_handle_t>
+DisjointPoolAllConfigs::makePool(umf::provider_unique_handle_t provider,
+                                 DisjointPoolMemType memType,
+                                 umf::pool_stats_t *stats) {
+    return umf::disjointPoolMakeUnique(std::move(provider), &Configs[memType],
+                                       ThreadCaches[memType],
+                                       SlabCaches[memType], Arenas[memType],
+                                       stats);
+}
+
 DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
                                                int trace) {
     DisjointPoolAllConfigs AllConfigs;
@@ -140,14 +158,38 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
             }
         }
         if (More) {
-            ParamParser(Params, AllConfigs.Configs[LM].SlabMinSize,
-                        ParamWasSet);
+            More = ParamParser(Params, AllConfigs.Configs[LM].SlabMinSize,
+                               ParamWasSet);
             if (ParamWasSet && memType == DisjointPoolMemType::All) {
                 for (auto &Config : AllConfigs.Configs) {
                     Config.SlabMinSize = AllConfigs.Configs[LM].SlabMinSize;
                 }
             }
         }
+        if (More) {
+            More = ParamParser(Params,
+                               AllConfigs.ThreadCaches[LM].MaxCachedSize,
+                               ParamWasSet);
+            if (ParamWasSet && memType == DisjointPoolMemType::All) {
+                for (auto &ThreadCache : AllConfigs.ThreadCaches) {
+                    ThreadCache.MaxCachedSize =
+                        AllConfigs.ThreadCaches[LM].MaxCachedSize;
+                }
+            }
+        }
+        if (More) {
+            size_t TrimOnFailure =
+                AllConfigs.SlabCaches[LM].TrimOnAllocFailure;
+            ParamParser(Params, TrimOnFailure, ParamWasSet);
+            if (ParamWasSet) {
+                AllConfigs.SlabCaches[LM].TrimOnAllocFailure = TrimOnFailure;
+            }
+            if (ParamWasSet && memType == DisjointPoolMemType::All) {
+                for (auto &SlabCache : AllConfigs.SlabCaches) {
+                    SlabCache.TrimOnAllocFailure = TrimOnFailure;
+                }
+            }
+        }
     };
 
     auto MemTypeParser = [MemParser](std::string &Params) {
@@ -219,10 +261,15 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
         umfDisjointPoolSharedLimitsCreate(MaxSize),
         umfDisjointPoolSharedLimitsDestroy);
 
+    auto SlabLimits = std::make_shared<umf::slab_cache_limits_t>(MaxSize);
+
     for (auto &Config : AllConfigs.Configs) {
         Config.SharedLimits = AllConfigs.limits.get();
         Config.PoolTrace = trace;
     }
+    for (auto &SlabCache : AllConfigs.SlabCaches) {
+        SlabCache.Limits = SlabLimits;
+    }
 
     if (!EnableBuffers) {
         return {};
@@ -269,6 +316,32 @@ DisjointPoolAllConfigs parseDisjointPoolConfig(const std::string &config,
         << std::setw(12)
         << AllConfigs.Configs[DisjointPoolMemType::SharedReadOnly].Capacity
         << std::endl;
+    std::cout << std::setw(15) << "ThreadCacheSize" << std::setw(12)
+              << AllConfigs.ThreadCaches[DisjointPoolMemType::Host]
+                     .MaxCachedSize
+              << std::setw(12)
+              << AllConfigs.ThreadCaches[DisjointPoolMemType::Device]
+                     .MaxCachedSize
+              << std::setw(12)
+              << AllConfigs.ThreadCaches[DisjointPoolMemType::Shared]
+                     .MaxCachedSize
+              << std::setw(12)
+              << AllConfigs.ThreadCaches[DisjointPoolMemType::SharedReadOnly]
+                     .MaxCachedSize
+              << std::endl;
+    std::cout << std::setw(15) << "TrimOnFailure" << std::setw(12)
+              << AllConfigs.SlabCaches[DisjointPoolMemType::Host]
+                     .TrimOnAllocFailure
+              << std::setw(12)
+              << AllConfigs.SlabCaches[DisjointPoolMemType::Device]
+                     .TrimOnAllocFailure
+              << std::setw(12)
+              << AllConfigs.SlabCaches[DisjointPoolMemType::Shared]
+                     .TrimOnAllocFailure
+              << std::setw(12)
+              << AllConfigs.SlabCaches[DisjointPoolMemType::SharedReadOnly]
+                     .TrimOnAllocFailure
+              << std::endl;
     std::cout << std::setw(15) << "MaxPoolSize" << std::setw(12) << MaxSize
               << std::endl;
     std::cout << std::setw(15) << "EnableBuffers" << std::setw(12)
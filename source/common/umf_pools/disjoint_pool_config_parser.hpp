@@ -9,6 +9,8 @@
 #ifndef USM_POOL_CONFIG
 #define USM_POOL_CONFIG
 
+#include "umf_helpers.hpp"
+
 #include <umf/pools/pool_disjoint.h>
 
 #include <memory>
@@ -24,15 +26,26 @@ class DisjointPoolAllConfigs {
     size_t EnableBuffers = 1;
     std::shared_ptr<umf_disjoint_pool_shared_limits_t> limits;
     umf_disjoint_pool_params_t Configs[DisjointPoolMemType::All];
+    umf::thread_cache_params_t ThreadCaches[DisjointPoolMemType::All];
+    umf::slab_cache_params_t SlabCaches[DisjointPoolMemType::All];
+    // Set from the pool's properties only, no arena by default
+    umf::arena_params_t Arenas[DisjointPoolMemType::All];
 
     DisjointPoolAllConfigs(int trace = 0);
+
+    // Creates a disjoint pool for memType, behind a thread cache if enabled.
+    // If stats is not null, the pool's statistics are aggregated into it.
+    std::pair<umf_result_t, umf::pool_unique_handle_t>
+    makePool(umf::provider_unique_handle_t provider,
+             DisjointPoolMemType memType, umf::pool_stats_t *stats = nullptr);
 };
 
 // Parse optional config parameters of this form:
 // [EnableBuffers][;[MaxPoolSize][;memtypelimits]...]
 //  memtypelimits: [<memtype>:]<limits>
 //  memtype: host|device|shared
-//  limits:  [MaxPoolableSize][,[Capacity][,SlabMinSize]]
+//  limits:  [MaxPoolableSize][,[Capacity][,[SlabMinSize][,ThreadCacheSize]
+//           [,TrimOnFailure]]]]
 //
 // Without a memory type, the limits are applied to each memory type.
 // Parameters are for each context, except MaxPoolSize, which is overall
@@ -49,6 +62,12 @@ class DisjointPoolAllConfigs {
 //                  Default 4.
 // SlabMinSize:     Minimum allocation size requested from USM.
 //                  Default 64KB host and device, 2MB shared.
+// ThreadCacheSize: Maximum allocation size served from per-thread caches,
+//                  in front of the pool. At most 64KB.
+//                  Default 0, disabled.
+// TrimOnFailure:   When an allocation fails, release the free slabs cached
+//                  by all pools and retry it.
+//                  Default 1 device, 0 host and shared.
 //
 // Example of usage:
 // "1;32M;host:1M,4,64K;device:1M,4,64K;shared:0,0,2M"
@@ -0,0 +1,249 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace umf {
+
+namespace {
+
+void updatePeak(std::atomic<size_t> &Peak, size_t Value) {
+    auto Current = Peak.load(std::memory_order_relaxed);
+    while (Current < Value &&
+           !Peak.compare_exchange_weak(Current, Value,
+                                       std::memory_order_relaxed)) {
+    }
+}
+
+/// Disjoint pool which keeps the statistics of its allocations. The disjoint
+/// pool doesn't report the size of a block when it's freed, so the requested
+/// sizes are kept in a side table, split in shards to keep the threads
+/// allocating in parallel off each other's locks.
+class stats_pool {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Provider,
+                            umf_disjoint_pool_params_t Params,
+                            thread_cache_params_t CacheParams,
+                            arena_params_t ArenaParams, pool_stats_t *Stats) {
+        this->Stats = Stats;
+        if (Params.Name) {
+            Name = Params.Name;
+        }
+
+        // The provider is this pool's, which tracks every allocation as
+        // memory of this pool; the inner pool mustn't track them again.
+        umf_memory_pool_handle_t hPool = nullptr;
+        auto Ret = detail::disjointPoolCreate(
+            Provider, &Params, CacheParams, ArenaParams,
+            UMF_POOL_CREATE_FLAG_DISABLE_TRACK, &hPool);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        Inner = pool_unique_handle_t(hPool, umfPoolDestroy);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~stats_pool() {
+        if (!Inner) {
+            return;
+        }
+        logger::debug("USM {} pool: used {} (peak {}), reserved {} (peak {}) "
+                      "bytes in {} slabs",
+                      Name, Stats->UsedSize.load(),
+                      Stats->PeakUsedSize.load(), Stats->ReservedSize.load(),
+                      Stats->PeakReservedSize.load(), Stats->SlabCount.load());
+        for (size_t I = 0; I < pool_stats_t::NumBuckets; ++I) {
+            auto Hits = Stats->BucketHits[I].load();
+            auto Misses = Stats->BucketMisses[I].load();
+            if (Hits + Misses != 0) {
+                logger::debug(
+                    "USM {} pool: up to {} bytes: {} hits, {} misses", Name,
+                    size_t(1) << I, Hits, Misses);
+            }
+        }
+    }
+
+    void *malloc(size_t Size) {
+        auto Before = detail::getProviderAllocCountRef();
+        return onAlloc(umfPoolMalloc(Inner.get(), Size), Size, Before);
+    }
+
+    void *calloc(size_t Num, size_t Size) {
+        auto Before = detail::getProviderAllocCountRef();
+        return onAlloc(umfPoolCalloc(Inner.get(), Num, Size), Num * Size,
+                       Before);
+    }
+
+    void *realloc(void *Ptr, size_t Size) {
+        if (!Ptr) {
+            return malloc(Size);
+        }
+        auto Before = detail::getProviderAllocCountRef();
+        auto OldSize = take(Ptr);
+        auto *NewPtr = umfPoolRealloc(Inner.get(), Ptr, Size);
+        if (!NewPtr) {
+            put(Ptr, OldSize);
+            getPoolLastStatusRef<stats_pool>() =
+                umfPoolGetLastAllocationError(Inner.get());
+            return nullptr;
+        }
+        Stats->onFree(OldSize);
+        return onAlloc(NewPtr, Size, Before);
+    }
+
+    void *aligned_malloc(size_t Size, size_t Alignment) {
+        auto Before = detail::getProviderAllocCountRef();
+        return onAlloc(umfPoolAlignedMalloc(Inner.get(), Size, Alignment),
+                       Size, Before);
+    }
+
+    size_t malloc_usable_size(void *Ptr) {
+        return umfPoolMallocUsableSize(Inner.get(), Ptr);
+    }
+
+    umf_result_t free(void *Ptr) {
+        if (!Ptr) {
+            return UMF_RESULT_SUCCESS;
+        }
+        // Forgotten first, as another thread may get Ptr once it's freed
+        auto Size = take(Ptr);
+        auto Ret = umfPoolFree(Inner.get(), Ptr);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            put(Ptr, Size);
+            return Ret;
+        }
+        Stats->onFree(Size);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t get_last_allocation_error() {
+        return getPoolLastStatusRef<stats_pool>();
+    }
+
+  private:
+    static constexpr unsigned ShardBits = 4;
+    static constexpr size_t NumShards = size_t(1) << ShardBits;
+
+    struct shard_t {
+        std::mutex Mutex;
+        std::unordered_map<void *, size_t> Sizes;
+    };
+
+    shard_t &getShard(void *Ptr) {
+        // Blocks are aligned, so the low bits would leave most shards unused
+        auto Hash = reinterpret_cast<uintptr_t>(Ptr) * 0x9E3779B97F4A7C15ull;
+        return Shards[Hash >> (64 - ShardBits)];
+    }
+
+    void put(void *Ptr, size_t Size) {
+        auto &Shard = getShard(Ptr);
+        std::scoped_lock<std::mutex> Guard(Shard.Mutex);
+        Shard.Sizes[Ptr] = Size;
+    }
+
+    size_t take(void *Ptr) {
+        auto &Shard = getShard(Ptr);
+        std::scoped_lock<std::mutex> Guard(Shard.Mutex);
+        auto It = Shard.Sizes.find(Ptr);
+        if (It == Shard.Sizes.end()) {
+            return 0;
+        }
+        auto Size = It->second;
+        Shard.Sizes.erase(It);
+        return Size;
+    }
+
+    void *onAlloc(void *Ptr, size_t Size, uint64_t ProviderAllocsBefore) {
+        if (!Ptr) {
+            getPoolLastStatusRef<stats_pool>() =
+                umfPoolGetLastAllocationError(Inner.get());
+            return nullptr;
+        }
+        try {
+            put(Ptr, Size);
+        } catch (...) {
+            umfPoolFree(Inner.get(), Ptr);
+            getPoolLastStatusRef<stats_pool>() =
+                UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+            return nullptr;
+        }
+        Stats->onAlloc(Size, detail::getProviderAllocCountRef() ==
+                                 ProviderAllocsBefore);
+        return Ptr;
+    }
+
+    // The slab cache's, which outlives this pool
+    pool_stats_t *Stats = nullptr;
+    std::string Name = "unnamed";
+    shard_t Shards[NumShards];
+    pool_unique_handle_t Inner{nullptr, nullptr};
+};
+
+} // namespace
+
+size_t pool_stats_t::getBucket(size_t size) {
+    size_t bucket = 0;
+    while (bucket + 1 < NumBuckets && (size_t(1) << bucket) < size) {
+        ++bucket;
+    }
+    return bucket;
+}
+
+void pool_stats_t::onAlloc(size_t size, bool hit) {
+    auto bucket = getBucket(size);
+    for (auto *stats = this; stats; stats = stats->Parent) {
+        updatePeak(stats->PeakUsedSize,
+                   stats->UsedSize.fetch_add(size, std::memory_order_relaxed) +
+                       size);
+        auto &counters = hit ? stats->BucketHits : stats->BucketMisses;
+        counters[bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void pool_stats_t::onFree(size_t size) {
+    for (auto *stats = this; stats; stats = stats->Parent) {
+        stats->UsedSize.fetch_sub(size, std::memory_order_relaxed);
+    }
+}
+
+void pool_stats_t::onProviderAlloc(size_t size) {
+    for (auto *stats = this; stats; stats = stats->Parent) {
+        updatePeak(
+            stats->PeakReservedSize,
+            stats->ReservedSize.fetch_add(size, std::memory_order_relaxed) +
+                size);
+        stats->SlabCount.fetch_add(1, std::memory_order_relaxed);
+    }
+}
+
+void pool_stats_t::onProviderFree(size_t size) {
+    for (auto *stats = this; stats; stats = stats->Parent) {
+        stats->ReservedSize.fetch_sub(size, std::memory_order_relaxed);
+        stats->SlabCount.fetch_sub(1, std::memory_order_relaxed);
+    }
+}
+
+std::pair<umf_result_t, pool_unique_handle_t>
+detail::statsPoolMakeUnique(provider_unique_handle_t provider,
+                            umf_disjoint_pool_params_t *params,
+                            const thread_cache_params_t &cacheParams,
+                            const arena_params_t &arenaParams,
+                            pool_stats_t *stats) {
+    return poolMakeUnique<stats_pool>(std::move(provider), *params,
+                                      cacheParams, arenaParams, stats);
+}
+
+} // namespace umf
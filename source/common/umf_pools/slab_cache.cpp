@@ -0,0 +1,300 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace umf {
+
+namespace {
+
+struct slab_caches_t {
+    std::mutex Mutex;
+    std::unordered_map<umf_memory_pool_handle_t, detail::slab_cache_provider *>
+        Caches;
+};
+
+slab_caches_t &getSlabCaches() {
+    // Never destroyed, pools may be destroyed by static destructors
+    static auto *SlabCaches = new slab_caches_t();
+    return *SlabCaches;
+}
+
+size_t trimAllSlabCaches();
+
+} // namespace
+
+/// Keeps the slabs freed by a disjoint pool for reuse, instead of releasing
+/// them to the memory provider right away, so that they can be released
+/// whenever asked to. Slabs are reused by exact size, which the disjoint
+/// pool always asks for.
+class detail::slab_cache_provider {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Upstream,
+                            umf_disjoint_pool_params_t Params,
+                            slab_cache_params_t SlabParams,
+                            pool_stats_t *Parent, slab_cache_provider **Self) {
+        this->Upstream = Upstream;
+        Capacity = Params.Capacity;
+        // Slabs are the size of a bucket, which may be above MaxPoolableSize,
+        // or SlabMinSize; anything else is an allocation that isn't pooled.
+        if (Params.MaxPoolableSize != 0) {
+            MaxSlabSize =
+                std::max(Params.SlabMinSize, 2 * Params.MaxPoolableSize);
+        }
+        Limits = SlabParams.Limits;
+        TrimOnAllocFailure = SlabParams.TrimOnAllocFailure;
+        Stats.Parent = Parent;
+        *Self = this;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~slab_cache_provider() {
+        if (Pool) {
+            auto &SlabCaches = getSlabCaches();
+            std::scoped_lock<std::mutex> Guard(SlabCaches.Mutex);
+            SlabCaches.Caches.erase(Pool);
+        }
+        trim(0);
+        umfMemoryProviderDestroy(Upstream);
+    }
+
+    umf_result_t alloc(size_t Size, size_t Alignment, void **Ptr) {
+        if ((*Ptr = take(Size, Alignment))) {
+            return UMF_RESULT_SUCCESS;
+        }
+
+        auto Ret = umfMemoryProviderAlloc(Upstream, Size, Alignment, Ptr);
+        if (Ret != UMF_RESULT_SUCCESS && TrimOnAllocFailure &&
+            trimAllSlabCaches() != 0) {
+            logger::info("Retrying an allocation of {} bytes after releasing "
+                         "the cached USM slabs",
+                         Size);
+            Ret = umfMemoryProviderAlloc(Upstream, Size, Alignment, Ptr);
+        }
+        if (Ret == UMF_RESULT_SUCCESS) {
+            Stats.onProviderAlloc(Size);
+            ++getProviderAllocCountRef();
+        }
+        return Ret;
+    }
+
+    umf_result_t free(void *Ptr, size_t Size) {
+        if (put(Ptr, Size)) {
+            return UMF_RESULT_SUCCESS;
+        }
+        auto Ret = umfMemoryProviderFree(Upstream, Ptr, Size);
+        if (Ret == UMF_RESULT_SUCCESS) {
+            Stats.onProviderFree(Size);
+        }
+        return Ret;
+    }
+
+    void get_last_native_error(const char **ErrMsg, int32_t *ErrCode) {
+        umfMemoryProviderGetLastNativeError(Upstream, ErrMsg, ErrCode);
+    }
+
+    umf_result_t get_recommended_page_size(size_t Size, size_t *PageSize) {
+        return umfMemoryProviderGetRecommendedPageSize(Upstream, Size,
+                                                       PageSize);
+    }
+
+    umf_result_t get_min_page_size(void *Ptr, size_t *PageSize) {
+        return umfMemoryProviderGetMinPageSize(Upstream, Ptr, PageSize);
+    }
+
+    const char *get_name() { return umfMemoryProviderGetName(Upstream); }
+
+    umf_result_t purge_lazy(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeLazy(Upstream, Ptr, Size);
+    }
+
+    umf_result_t purge_force(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeForce(Upstream, Ptr, Size);
+    }
+
+    // Slabs are cached and released whole
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    /// Releases cached slabs, the largest first, until at most KeepSize bytes
+    /// are left. Returns the bytes released.
+    size_t trim(size_t KeepSize) {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        size_t Released = 0;
+        for (auto It = FreeSlabs.rbegin();
+             It != FreeSlabs.rend() && CachedSize > KeepSize; ++It) {
+            auto &[Size, Slabs] = *It;
+            while (!Slabs.empty() && CachedSize > KeepSize) {
+                auto Ret = umfMemoryProviderFree(Upstream, Slabs.back(), Size);
+                if (Ret != UMF_RESULT_SUCCESS) {
+                    // The slab is still allocated, so it stays cached and
+                    // counted, the other sizes may still be released
+                    logger::warning("Failed to release a cached USM slab of "
+                                    "{} bytes",
+                                    Size);
+                    break;
+                }
+                Stats.onProviderFree(Size);
+                Released += Size;
+                Slabs.pop_back();
+                unreserve(Size);
+            }
+        }
+        return Released;
+    }
+
+    size_t getCachedSize() {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        return CachedSize;
+    }
+
+    pool_stats_t Stats;
+    // Set once registered
+    umf_memory_pool_handle_t Pool = nullptr;
+
+  private:
+    void *take(size_t Size, size_t Alignment) {
+        if (Size == 0 || Size > MaxSlabSize) {
+            return nullptr;
+        }
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto It = FreeSlabs.find(Size);
+        if (It == FreeSlabs.end()) {
+            return nullptr;
+        }
+        // Most recently freed first, it's the likeliest to be in the caches
+        auto &Slabs = It->second;
+        for (auto Slab = Slabs.rbegin(); Slab != Slabs.rend(); ++Slab) {
+            void *Ptr = *Slab;
+            if (Alignment <= 1 ||
+                reinterpret_cast<uintptr_t>(Ptr) % Alignment == 0) {
+                Slabs.erase(std::next(Slab).base());
+                unreserve(Size);
+                return Ptr;
+            }
+        }
+        return nullptr;
+    }
+
+    bool put(void *Ptr, size_t Size) {
+        if (Size == 0 || Size > MaxSlabSize) {
+            return false;
+        }
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto &Slabs = FreeSlabs[Size];
+        if (Slabs.size() >= Capacity || !reserve(Size)) {
+            return false;
+        }
+        try {
+            Slabs.push_back(Ptr);
+        } catch (...) {
+            unreserve(Size);
+            return false;
+        }
+        return true;
+    }
+
+    // Accounts for a slab entering the cache, within the shared limit
+    bool reserve(size_t Size) {
+        if (Limits) {
+            auto Total = Limits->TotalSize.load(std::memory_order_relaxed);
+            do {
+                if (Total + Size > Limits->MaxSize) {
+                    return false;
+                }
+            } while (!Limits->TotalSize.compare_exchange_weak(Total,
+                                                              Total + Size));
+        }
+        CachedSize += Size;
+        return true;
+    }
+
+    void unreserve(size_t Size) {
+        if (Limits) {
+            Limits->TotalSize.fetch_sub(Size);
+        }
+        CachedSize -= Size;
+    }
+
+    umf_memory_provider_handle_t Upstream = nullptr;
+    size_t Capacity = 0;
+    size_t MaxSlabSize = 0;
+    std::shared_ptr<slab_cache_limits_t> Limits;
+    bool TrimOnAllocFailure = false;
+
+    std::mutex Mutex;
+    // By size, the largest last
+    std::map<size_t, std::vector<void *>> FreeSlabs;
+    size_t CachedSize = 0;
+};
+
+namespace {
+
+size_t trimAllSlabCaches() {
+    auto &SlabCaches = getSlabCaches();
+    std::scoped_lock<std::mutex> Guard(SlabCaches.Mutex);
+    size_t Released = 0;
+    for (auto &[hPool, Cache] : SlabCaches.Caches) {
+        Released += Cache->trim(0);
+    }
+    return Released;
+}
+
+} // namespace
+
+std::pair<umf_result_t, provider_unique_handle_t>
+detail::slabCacheMakeUnique(provider_unique_handle_t provider,
+                            const umf_disjoint_pool_params_t &params,
+                            const slab_cache_params_t &slabParams,
+                            pool_stats_t *stats, slab_cache_provider **cache) {
+    auto ret = memoryProviderMakeUnique<slab_cache_provider>(
+        provider.get(), params, slabParams, stats, cache);
+    if (ret.first == UMF_RESULT_SUCCESS) {
+        provider.release(); // cache now owns the provider
+    }
+    return ret;
+}
+
+pool_stats_t &detail::getSlabCacheStats(slab_cache_provider *cache) {
+    return cache->Stats;
+}
+
+void detail::registerSlabCache(slab_cache_provider *cache,
+                               umf_memory_pool_handle_t hPool) {
+    auto &SlabCaches = getSlabCaches();
+    std::scoped_lock<std::mutex> Guard(SlabCaches.Mutex);
+    SlabCaches.Caches[hPool] = cache;
+    cache->Pool = hPool;
+}
+
+size_t poolTrim(umf_memory_pool_handle_t hPool, size_t keepSize) {
+    auto &SlabCaches = getSlabCaches();
+    std::scoped_lock<std::mutex> Guard(SlabCaches.Mutex);
+    auto It = SlabCaches.Caches.find(hPool);
+    if (It == SlabCaches.Caches.end()) {
+        return 0;
+    }
+    It->second->trim(keepSize);
+    return It->second->getCachedSize();
+}
+
+} // namespace umf
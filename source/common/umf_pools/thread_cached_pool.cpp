@@ -0,0 +1,567 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace umf {
+
+namespace {
+
+constexpr size_t MaxSizeClasses = 16;
+
+// Full magazines kept by a pool per size class, beyond that they are freed
+constexpr size_t DepotSize = 4;
+
+// Slabs of the cached size classes are allocated in whole granules, so that a
+// granule only ever holds blocks of a single size class. This also bounds the
+// bytes a magazine may hold.
+constexpr unsigned GranuleShift = 16;
+constexpr size_t GranuleSize = size_t(1) << GranuleShift;
+
+size_t roundUpGranule(size_t Size) {
+    return (Size + GranuleSize - 1) & ~(GranuleSize - 1);
+}
+
+/// Maps granules to the size class of the slab they belong to, so that free()
+/// can tell a cached block apart without a lock. The tree is indexed like a
+/// page table; nodes are only freed with the registry.
+class slab_registry {
+  public:
+    slab_registry() = default;
+    ~slab_registry() { freeNode(&Root, 0); }
+
+    slab_registry(const slab_registry &) = delete;
+    slab_registry &operator=(const slab_registry &) = delete;
+
+    // Tag 0 clears the range
+    void set(void *Ptr, size_t Size, uint8_t Tag) {
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        auto First = reinterpret_cast<uintptr_t>(Ptr) >> GranuleShift;
+        auto Last = First + (Size >> GranuleShift);
+        for (auto Granule = First; Granule < Last; ++Granule) {
+            if (auto L = getLeaf(Granule, Tag != 0)) {
+                L->Slots[Granule & (NodeSize - 1)].store(
+                    Tag, std::memory_order_release);
+            }
+        }
+    }
+
+    uint8_t get(const void *Ptr) {
+        auto Granule = reinterpret_cast<uintptr_t>(Ptr) >> GranuleShift;
+        auto L = getLeaf(Granule, false);
+        if (!L) {
+            return 0;
+        }
+        return L->Slots[Granule & (NodeSize - 1)].load(
+            std::memory_order_acquire);
+    }
+
+  private:
+    static constexpr unsigned LevelBits = 12;
+    static constexpr unsigned Levels = 4;
+    static constexpr size_t NodeSize = size_t(1) << LevelBits;
+    static_assert(GranuleShift + LevelBits * Levels == 64);
+
+    // Inner nodes of the last inner level hold leaves
+    struct Node {
+        std::atomic<void *> Slots[NodeSize] = {};
+    };
+    struct Leaf {
+        std::atomic<uint8_t> Slots[NodeSize] = {};
+    };
+
+    // Only set() creates nodes, under the mutex
+    Leaf *getLeaf(uintptr_t Granule, bool Create) {
+        Node *N = &Root;
+        for (unsigned Level = 0;; ++Level) {
+            unsigned Shift = LevelBits * (Levels - 1 - Level);
+            auto &Slot = N->Slots[(Granule >> Shift) & (NodeSize - 1)];
+            bool IsLeaf = Level + 2 == Levels;
+            void *Child = Slot.load(std::memory_order_acquire);
+            if (!Child) {
+                if (!Create) {
+                    return nullptr;
+                }
+                Child = IsLeaf ? static_cast<void *>(new Leaf())
+                               : static_cast<void *>(new Node());
+                Slot.store(Child, std::memory_order_release);
+            }
+            if (IsLeaf) {
+                return static_cast<Leaf *>(Child);
+            }
+            N = static_cast<Node *>(Child);
+        }
+    }
+
+    void freeNode(Node *N, unsigned Level) {
+        for (auto &Slot : N->Slots) {
+            void *Child = Slot.load(std::memory_order_relaxed);
+            if (!Child) {
+                continue;
+            }
+            if (Level + 2 == Levels) {
+                delete static_cast<Leaf *>(Child);
+            } else {
+                freeNode(static_cast<Node *>(Child), Level + 1);
+                delete static_cast<Node *>(Child);
+            }
+        }
+    }
+
+    Node Root;
+    std::mutex Mutex;
+};
+
+/// Provides the slabs of one size class. Forwards to the provider of the
+/// caching pool, so that the slabs are tracked as memory of that pool, and
+/// tags their granules with the size class.
+class slab_provider {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Upstream,
+                            slab_registry *Registry, uint8_t Tag) {
+        this->Upstream = Upstream;
+        this->Registry = Registry;
+        this->Tag = Tag;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t alloc(size_t Size, size_t Alignment, void **Ptr) {
+        Size = roundUpGranule(Size);
+        auto Ret = umfMemoryProviderAlloc(
+            Upstream, Size, std::max(Alignment, GranuleSize), Ptr);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        try {
+            Registry->set(*Ptr, Size, Tag);
+        } catch (...) {
+            umfMemoryProviderFree(Upstream, *Ptr, Size);
+            *Ptr = nullptr;
+            return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t free(void *Ptr, size_t Size) {
+        Size = roundUpGranule(Size);
+        Registry->set(Ptr, Size, 0);
+        return umfMemoryProviderFree(Upstream, Ptr, Size);
+    }
+
+    void get_last_native_error(const char **ErrMsg, int32_t *ErrCode) {
+        umfMemoryProviderGetLastNativeError(Upstream, ErrMsg, ErrCode);
+    }
+
+    umf_result_t get_recommended_page_size(size_t Size, size_t *PageSize) {
+        return umfMemoryProviderGetRecommendedPageSize(Upstream, Size,
+                                                       PageSize);
+    }
+
+    umf_result_t get_min_page_size(void *Ptr, size_t *PageSize) {
+        return umfMemoryProviderGetMinPageSize(Upstream, Ptr, PageSize);
+    }
+
+    const char *get_name() { return umfMemoryProviderGetName(Upstream); }
+
+    umf_result_t purge_lazy(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeLazy(Upstream, Ptr, Size);
+    }
+
+    umf_result_t purge_force(void *Ptr, size_t Size) {
+        return umfMemoryProviderPurgeForce(Upstream, Ptr, Size);
+    }
+
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+  private:
+    umf_memory_provider_handle_t Upstream = nullptr;
+    slab_registry *Registry = nullptr;
+    uint8_t Tag = 0;
+};
+
+class thread_cached_pool;
+
+struct magazines_t {
+    // Blocks are taken from and returned to Loaded, Previous is a full or
+    // empty spare, so that a thread going back and forth across a magazine
+    // boundary doesn't hit the depot every time.
+    std::vector<void *> Loaded;
+    std::vector<void *> Previous;
+};
+
+struct thread_cache_t {
+    magazines_t Classes[MaxSizeClasses];
+};
+
+/// Pools alive, by id. Ids are never reused, so that a thread cache left
+/// behind by a destroyed pool can't be mistaken for a new pool's.
+struct live_pools_t {
+    std::mutex Mutex;
+    std::unordered_map<uint64_t, thread_cached_pool *> Pools;
+    uint64_t NextId = 1;
+};
+
+live_pools_t &getLivePools() {
+    static live_pools_t LivePools;
+    return LivePools;
+}
+
+struct thread_caches_t {
+    // Last pool used by this thread
+    uint64_t LastId = 0;
+    thread_cache_t *Last = nullptr;
+    std::unordered_map<uint64_t, std::unique_ptr<thread_cache_t>> Caches;
+
+    thread_cache_t &get(uint64_t Id);
+    ~thread_caches_t();
+};
+
+thread_local thread_caches_t ThreadCaches;
+
+/// Disjoint pool with per-thread magazines of free blocks in front of it for
+/// small allocations. Each cached size class is served by a disjoint pool of
+/// its own, whose slabs are tagged in the registry; every other allocation
+/// goes to the general disjoint pool. Full magazines are exchanged through a
+/// small per-class depot, so a pool lock is only taken once per magazine.
+class thread_cached_pool {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Provider,
+                            umf_disjoint_pool_params_t Params,
+                            thread_cache_params_t CacheParams) {
+        // The provider is this pool's, which tracks every allocation as
+        // memory of this pool; the inner pools mustn't track them again.
+        umf_memory_pool_handle_t hPool = nullptr;
+        auto Ret = umfPoolCreate(umfDisjointPoolOps(), Provider, &Params,
+                                 UMF_POOL_CREATE_FLAG_DISABLE_TRACK, &hPool);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        GeneralPool = pool_unique_handle_t(hPool, umfPoolDestroy);
+
+        // Classes are powers of two, so their blocks are aligned to their
+        // size within the granule-aligned slabs.
+        size_t ClassSize = 1;
+        while (ClassSize < CacheParams.MinCachedSize) {
+            ClassSize <<= 1;
+        }
+        size_t MaxCachedSize = std::min({CacheParams.MaxCachedSize,
+                                         Params.MaxPoolableSize, GranuleSize});
+
+        auto ClassParams = Params;
+        ClassParams.SlabMinSize = roundUpGranule(Params.SlabMinSize);
+        for (; ClassSize <= MaxCachedSize && NumClasses < MaxSizeClasses;
+             ClassSize <<= 1) {
+            auto [Ret, SlabProvider] = memoryProviderMakeUnique<slab_provider>(
+                Provider, &Registry, static_cast<uint8_t>(NumClasses + 1));
+            if (Ret != UMF_RESULT_SUCCESS) {
+                return Ret;
+            }
+            Ret = umfPoolCreate(umfDisjointPoolOps(), SlabProvider.get(),
+                                &ClassParams,
+                                UMF_POOL_CREATE_FLAG_OWN_PROVIDER |
+                                    UMF_POOL_CREATE_FLAG_DISABLE_TRACK,
+                                &hPool);
+            if (Ret != UMF_RESULT_SUCCESS) {
+                return Ret;
+            }
+            SlabProvider.release(); // pool now owns the provider
+
+            auto &Class = Classes[NumClasses++];
+            Class.Size = ClassSize;
+            Class.MagazineSize = std::max<size_t>(
+                1, std::min(CacheParams.MagazineSize, GranuleSize / ClassSize));
+            Class.Pool = pool_unique_handle_t(hPool, umfPoolDestroy);
+        }
+
+        auto &LivePools = getLivePools();
+        std::scoped_lock<std::mutex> Guard(LivePools.Mutex);
+        Id = LivePools.NextId++;
+        LivePools.Pools.emplace(Id, this);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~thread_cached_pool() {
+        if (Id != 0) {
+            auto &LivePools = getLivePools();
+            std::scoped_lock<std::mutex> Guard(LivePools.Mutex);
+            LivePools.Pools.erase(Id);
+        }
+        // Blocks still cached by other threads go away with the class pools
+        for (size_t I = 0; I < NumClasses; ++I) {
+            for (auto &Magazine : Classes[I].Depot) {
+                freeBlocks(I, Magazine);
+            }
+        }
+    }
+
+    void *malloc(size_t Size) { return aligned_malloc(Size, 0); }
+
+    void *calloc(size_t Num, size_t Size) {
+        return setLastStatus(GeneralPool.get(),
+                             umfPoolCalloc(GeneralPool.get(), Num, Size));
+    }
+
+    void *realloc(void *Ptr, size_t Size) {
+        if (Ptr && Registry.get(Ptr) != 0) {
+            getPoolLastStatusRef<thread_cached_pool>() =
+                UMF_RESULT_ERROR_NOT_SUPPORTED;
+            return nullptr;
+        }
+        return setLastStatus(GeneralPool.get(),
+                             umfPoolRealloc(GeneralPool.get(), Ptr, Size));
+    }
+
+    void *aligned_malloc(size_t Size, size_t Alignment) {
+        size_t I = 0;
+        while (I < NumClasses && Classes[I].Size < Size) {
+            ++I;
+        }
+        if (I == NumClasses || Alignment > Classes[I].Size) {
+            return setLastStatus(
+                GeneralPool.get(),
+                umfPoolAlignedMalloc(GeneralPool.get(), Size, Alignment));
+        }
+
+        auto &Magazines = ThreadCaches.get(Id).Classes[I];
+        if (Magazines.Loaded.empty()) {
+            if (!Magazines.Previous.empty()) {
+                std::swap(Magazines.Loaded, Magazines.Previous);
+            } else {
+                refill(I, Magazines.Loaded);
+            }
+        }
+        if (!Magazines.Loaded.empty()) {
+            void *Ptr = Magazines.Loaded.back();
+            Magazines.Loaded.pop_back();
+            return Ptr;
+        }
+
+        auto hPool = Classes[I].Pool.get();
+        return setLastStatus(hPool, umfPoolMalloc(hPool, Classes[I].Size));
+    }
+
+    size_t malloc_usable_size(void *Ptr) {
+        if (auto Tag = Registry.get(Ptr)) {
+            return Classes[Tag - 1].Size;
+        }
+        return umfPoolMallocUsableSize(GeneralPool.get(), Ptr);
+    }
+
+    umf_result_t free(void *Ptr) {
+        if (!Ptr) {
+            return UMF_RESULT_SUCCESS;
+        }
+        auto Tag = Registry.get(Ptr);
+        if (Tag == 0) {
+            return umfPoolFree(GeneralPool.get(), Ptr);
+        }
+
+        size_t I = Tag - 1;
+        try {
+            auto &Magazines = ThreadCaches.get(Id).Classes[I];
+            if (Magazines.Loaded.size() >= Classes[I].MagazineSize) {
+                if (!Magazines.Previous.empty()) {
+                    flush(I, Magazines.Previous);
+                }
+                std::swap(Magazines.Loaded, Magazines.Previous);
+            }
+            Magazines.Loaded.reserve(Classes[I].MagazineSize);
+            Magazines.Loaded.push_back(Ptr);
+            return UMF_RESULT_SUCCESS;
+        } catch (...) {
+            return umfPoolFree(Classes[I].Pool.get(), Ptr);
+        }
+    }
+
+    umf_result_t get_last_allocation_error() {
+        return getPoolLastStatusRef<thread_cached_pool>();
+    }
+
+    /// Called when a thread exits, with the live pools locked
+    void releaseThreadCache(thread_cache_t &Cache) {
+        for (size_t I = 0; I < NumClasses; ++I) {
+            freeBlocks(I, Cache.Classes[I].Loaded);
+            freeBlocks(I, Cache.Classes[I].Previous);
+        }
+    }
+
+  private:
+    struct size_class_t {
+        size_t Size = 0;
+        size_t MagazineSize = 0;
+        pool_unique_handle_t Pool{nullptr, nullptr};
+
+        // Full magazines
+        std::mutex DepotMutex;
+        std::vector<std::vector<void *>> Depot;
+    };
+
+    static void *setLastStatus(umf_memory_pool_handle_t hPool, void *Ptr) {
+        if (!Ptr) {
+            getPoolLastStatusRef<thread_cached_pool>() =
+                umfPoolGetLastAllocationError(hPool);
+        }
+        return Ptr;
+    }
+
+    void freeBlocks(size_t I, std::vector<void *> &Magazine) {
+        for (auto Ptr : Magazine) {
+            umfPoolFree(Classes[I].Pool.get(), Ptr);
+        }
+        Magazine.clear();
+    }
+
+    // Swaps the empty Magazine for a full one of the depot, if any
+    void refill(size_t I, std::vector<void *> &Magazine) {
+        auto &Class = Classes[I];
+        std::scoped_lock<std::mutex> Guard(Class.DepotMutex);
+        if (!Class.Depot.empty()) {
+            std::swap(Magazine, Class.Depot.back());
+            Class.Depot.pop_back();
+        }
+    }
+
+    // Hands the full Magazine to the depot, or frees its blocks if the
+    // depot is full. Magazine is left empty.
+    void flush(size_t I, std::vector<void *> &Magazine) {
+        auto &Class = Classes[I];
+        {
+            std::scoped_lock<std::mutex> Guard(Class.DepotMutex);
+            if (Class.Depot.size() < DepotSize) {
+                Class.Depot.push_back(std::move(Magazine));
+                Magazine = {};
+                return;
+            }
+        }
+        freeBlocks(I, Magazine);
+    }
+
+    uint64_t Id = 0;
+    // Outlives the class pools, whose providers use it
+    slab_registry Registry;
+    pool_unique_handle_t GeneralPool{nullptr, nullptr};
+    size_class_t Classes[MaxSizeClasses];
+    size_t NumClasses = 0;
+};
+
+thread_cache_t &thread_caches_t::get(uint64_t Id) {
+    if (LastId == Id) {
+        return *Last;
+    }
+    auto It = Caches.find(Id);
+    if (It == Caches.end()) {
+        // Drop the caches of destroyed pools, whose blocks went with them
+        auto &LivePools = getLivePools();
+        {
+            std::scoped_lock<std::mutex> Guard(LivePools.Mutex);
+            for (auto DeadIt = Caches.begin(); DeadIt != Caches.end();) {
+                if (LivePools.Pools.count(DeadIt->first) == 0) {
+                    DeadIt = Caches.erase(DeadIt);
+                } else {
+                    ++DeadIt;
+                }
+            }
+        }
+        It = Caches.emplace(Id, std::make_unique<thread_cache_t>()).first;
+    }
+    LastId = Id;
+    Last = It->second.get();
+    return *Last;
+}
+
+thread_caches_t::~thread_caches_t() {
+    auto &LivePools = getLivePools();
+    std::scoped_lock<std::mutex> Guard(LivePools.Mutex);
+    for (auto &[Id, Cache] : Caches) {
+        auto It = LivePools.Pools.find(Id);
+        if (It != LivePools.Pools.end()) {
+            It->second->releaseThreadCache(*Cache);
+        }
+    }
+}
+
+} // namespace
+
+umf_result_t
+detail::disjointPoolCreate(umf_memory_provider_handle_t provider,
+                           umf_disjoint_pool_params_t *params,
+                           const thread_cache_params_t &cacheParams,
+                           const arena_params_t &arenaParams,
+                           umf_pool_create_flags_t flags,
+                           umf_memory_pool_handle_t *hPool) {
+    if (arenaParams.Size != 0) {
+        return arenaPoolCreate(provider, params, cacheParams, arenaParams,
+                               flags, hPool);
+    }
+    if (cacheParams.MaxCachedSize == 0) {
+        return umfPoolCreate(umfDisjointPoolOps(), provider, params, flags,
+                             hPool);
+    }
+    auto argsTuple = std::make_tuple(*params, cacheParams);
+    auto ops = poolMakeUniqueOps<thread_cached_pool, decltype(argsTuple)>();
+    return umfPoolCreate(&ops, provider, &argsTuple, flags, hPool);
+}
+
+std::pair<umf_result_t, pool_unique_handle_t>
+disjointPoolMakeUnique(provider_unique_handle_t provider,
+                       umf_disjoint_pool_params_t *params,
+                       const thread_cache_params_t &cacheParams,
+                       const slab_cache_params_t &slabParams,
+                       const arena_params_t &arenaParams,
+                       pool_stats_t *stats) {
+    detail::slab_cache_provider *cache = nullptr;
+    auto [ret, cacheProvider] = detail::slabCacheMakeUnique(
+        std::move(provider), *params, slabParams, stats, &cache);
+    if (ret != UMF_RESULT_SUCCESS) {
+        return std::pair<umf_result_t, pool_unique_handle_t>{
+            ret, pool_unique_handle_t(nullptr, nullptr)};
+    }
+
+    // The cache keeps the empty slabs instead, up to the same capacity
+    auto poolParams = *params;
+    poolParams.Capacity = 0;
+
+    std::pair<umf_result_t, pool_unique_handle_t> result{
+        UMF_RESULT_SUCCESS, pool_unique_handle_t(nullptr, nullptr)};
+    if (stats) {
+        result = detail::statsPoolMakeUnique(
+            std::move(cacheProvider), &poolParams, cacheParams, arenaParams,
+            &detail::getSlabCacheStats(cache));
+    } else {
+        umf_memory_pool_handle_t hPool = nullptr;
+        result.first = detail::disjointPoolCreate(
+            cacheProvider.get(), &poolParams, cacheParams, arenaParams,
+            UMF_POOL_CREATE_FLAG_OWN_PROVIDER, &hPool);
+        if (result.first == UMF_RESULT_SUCCESS) {
+            cacheProvider.release(); // pool now owns the provider
+            result.second = pool_unique_handle_t(hPool, umfPoolDestroy);
+        }
+    }
+
+    if (result.first == UMF_RESULT_SUCCESS) {
+        detail::registerSlabCache(cache, result.second.get());
+    }
+    return result;
+}
+
+} // namespace umf
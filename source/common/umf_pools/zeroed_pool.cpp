@@ -0,0 +1,307 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#include "umf_helpers.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace umf {
+
+namespace {
+
+/// Serves zero-initialized allocations from blocks the filler zeroed ahead.
+/// Allocations up to MaxBlockSize are rounded up to a power of two, and each
+/// size class keeps a reserve of blocks whose fill was submitted already,
+/// oldest first. Taking a block tops its class up again in the background,
+/// and freed blocks are zeroed again before going back to the reserve, so an
+/// allocation only waits for a fill of its own when its class ran dry.
+class zeroed_pool {
+  public:
+    umf_result_t initialize(umf_memory_provider_handle_t Provider,
+                            umf_disjoint_pool_params_t Params,
+                            zeroed_pool_params_t ZeroParams) {
+        if (!ZeroParams.Filler) {
+            return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        this->ZeroParams = std::move(ZeroParams);
+        // The block of the largest size class must have a size_t size
+        auto &MaxBlockSize = this->ZeroParams.MaxBlockSize;
+        MaxBlockSize = std::min(MaxBlockSize, SIZE_MAX / 2 + 1);
+        MaxOrder = std::max(detail::ceilLog2(MaxBlockSize), MinOrder);
+
+        // The inner pool gets the memory of this pool's provider, which
+        // tracks it as memory of this pool already.
+        umf_memory_pool_handle_t hPool = nullptr;
+        auto Ret = detail::disjointPoolCreate(
+            Provider, &Params, thread_cache_params_t{}, arena_params_t{},
+            UMF_POOL_CREATE_FLAG_DISABLE_TRACK, &hPool);
+        if (Ret != UMF_RESULT_SUCCESS) {
+            return Ret;
+        }
+        Inner = pool_unique_handle_t(hPool, umfPoolDestroy);
+        Reserve.resize(MaxOrder + 1);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~zeroed_pool() {
+        if (!Inner) {
+            return;
+        }
+        // The blocks mustn't be released while they're being filled
+        if (LastSeq) {
+            ZeroParams.Filler->wait(LastSeq);
+        }
+        for (auto &Blocks : Reserve) {
+            for (auto &Block : Blocks) {
+                umfPoolFree(Inner.get(), Block.Ptr);
+            }
+        }
+    }
+
+    void *malloc(size_t Size) { return aligned_malloc(Size, 0); }
+
+    // Every allocation is zeroed already
+    void *calloc(size_t Num, size_t Size) {
+        if (Size != 0 && Num > SIZE_MAX / Size) {
+            getPoolLastStatusRef<zeroed_pool>() =
+                UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+            return nullptr;
+        }
+        return malloc(Num * Size);
+    }
+
+    void *realloc(void *, size_t) {
+        getPoolLastStatusRef<zeroed_pool>() = UMF_RESULT_ERROR_NOT_SUPPORTED;
+        return nullptr;
+    }
+
+    void *aligned_malloc(size_t Size, size_t Alignment) {
+        if (Size == 0 || Size > ZeroParams.MaxBlockSize) {
+            return zeroNow(umfPoolAlignedMalloc(Inner.get(), Size, Alignment),
+                           Size);
+        }
+        auto Order = std::max(detail::ceilLog2(Size), MinOrder);
+        if (Alignment > blockAlignment(Order)) {
+            return zeroNow(umfPoolAlignedMalloc(Inner.get(), Size, Alignment),
+                           Size);
+        }
+
+        void *Ptr = nullptr;
+        uint64_t Seq = 0;
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            auto &Blocks = Reserve[Order];
+            if (!Blocks.empty()) {
+                Ptr = Blocks.front().Ptr;
+                Seq = Blocks.front().Seq;
+                Blocks.pop_front();
+                ReservedSize -= size_t(1) << Order;
+            }
+        }
+
+        if (Ptr) {
+            // The oldest fill of the class has usually completed already
+            auto Ret = ZeroParams.Filler->wait(Seq);
+            if (Ret != UMF_RESULT_SUCCESS) {
+                umfPoolFree(Inner.get(), Ptr);
+                getPoolLastStatusRef<zeroed_pool>() = Ret;
+                return nullptr;
+            }
+        } else {
+            Ptr = zeroNow(umfPoolAlignedMalloc(Inner.get(), size_t(1) << Order,
+                                               blockAlignment(Order)),
+                          size_t(1) << Order);
+            if (!Ptr) {
+                return nullptr;
+            }
+        }
+
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            try {
+                LiveBlocks[Ptr] = static_cast<uint8_t>(Order);
+            } catch (...) {
+                umfPoolFree(Inner.get(), Ptr);
+                getPoolLastStatusRef<zeroed_pool>() =
+                    UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+                return nullptr;
+            }
+        }
+        refill(Order);
+        return Ptr;
+    }
+
+    size_t malloc_usable_size(void *Ptr) {
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            auto It = LiveBlocks.find(Ptr);
+            if (It != LiveBlocks.end()) {
+                return size_t(1) << It->second;
+            }
+        }
+        return umfPoolMallocUsableSize(Inner.get(), Ptr);
+    }
+
+    umf_result_t free(void *Ptr) {
+        if (!Ptr) {
+            return UMF_RESULT_SUCCESS;
+        }
+
+        unsigned Order = 0;
+        bool Keep = false;
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            auto It = LiveBlocks.find(Ptr);
+            if (It == LiveBlocks.end()) {
+                // Zeroed when allocated, it isn't reused
+                return umfPoolFree(Inner.get(), Ptr);
+            }
+            Order = It->second;
+            LiveBlocks.erase(It);
+            Keep = ReservedSize + (size_t(1) << Order) <=
+                   ZeroParams.MaxReservedSize;
+            if (Keep) {
+                ReservedSize += size_t(1) << Order;
+            }
+        }
+        if (!Keep) {
+            return umfPoolFree(Inner.get(), Ptr);
+        }
+
+        uint64_t Seq = 0;
+        if (ZeroParams.Filler->fill(Ptr, size_t(1) << Order, &Seq) !=
+            UMF_RESULT_SUCCESS) {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            ReservedSize -= size_t(1) << Order;
+            return umfPoolFree(Inner.get(), Ptr);
+        }
+
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        LastSeq = std::max(LastSeq, Seq);
+        Reserve[Order].push_back({Ptr, Seq});
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t get_last_allocation_error() {
+        return getPoolLastStatusRef<zeroed_pool>();
+    }
+
+  private:
+    // Blocks of 2^MinOrder bytes at least
+    static constexpr unsigned MinOrder = 8;
+    // Largest alignment of the blocks, larger ones are allocated on their own
+    static constexpr size_t MaxBlockAlignment = 4096;
+
+    struct block_t {
+        void *Ptr;
+        // Sequence number of the fill zeroing it
+        uint64_t Seq;
+    };
+
+    static size_t blockAlignment(unsigned Order) {
+        return std::min(size_t(1) << Order, MaxBlockAlignment);
+    }
+
+    // Waits for Size bytes at Ptr to be zeroed, freeing them on failure
+    void *zeroNow(void *Ptr, size_t Size) {
+        if (!Ptr) {
+            getPoolLastStatusRef<zeroed_pool>() =
+                umfPoolGetLastAllocationError(Inner.get());
+            return nullptr;
+        }
+        if (Size == 0) {
+            return Ptr;
+        }
+        uint64_t Seq = 0;
+        auto Ret = ZeroParams.Filler->fill(Ptr, Size, &Seq);
+        if (Ret == UMF_RESULT_SUCCESS) {
+            Ret = ZeroParams.Filler->wait(Seq);
+        }
+        if (Ret != UMF_RESULT_SUCCESS) {
+            umfPoolFree(Inner.get(), Ptr);
+            getPoolLastStatusRef<zeroed_pool>() = Ret;
+            return nullptr;
+        }
+        return Ptr;
+    }
+
+    // Submits the fills of the blocks the reserve of Order lacks, within
+    // MaxReservedSize. Failures only leave the reserve short.
+    void refill(unsigned Order) {
+        const size_t Size = size_t(1) << Order;
+        size_t Count = 0;
+        {
+            std::scoped_lock<std::mutex> Guard(Mutex);
+            auto Held = Reserve[Order].size();
+            if (Held < ZeroParams.ReserveDepth) {
+                Count = ZeroParams.ReserveDepth - Held;
+            }
+            while (Count && ReservedSize + Count * Size >
+                                ZeroParams.MaxReservedSize) {
+                --Count;
+            }
+            ReservedSize += Count * Size;
+        }
+
+        std::vector<block_t> Blocks;
+        for (size_t I = 0; I < Count; ++I) {
+            auto *Ptr = umfPoolAlignedMalloc(Inner.get(), Size,
+                                             blockAlignment(Order));
+            if (!Ptr) {
+                break;
+            }
+            uint64_t Seq = 0;
+            if (ZeroParams.Filler->fill(Ptr, Size, &Seq) !=
+                UMF_RESULT_SUCCESS) {
+                umfPoolFree(Inner.get(), Ptr);
+                break;
+            }
+            Blocks.push_back({Ptr, Seq});
+        }
+
+        std::scoped_lock<std::mutex> Guard(Mutex);
+        ReservedSize -= (Count - Blocks.size()) * Size;
+        for (auto &Block : Blocks) {
+            LastSeq = std::max(LastSeq, Block.Seq);
+            Reserve[Order].push_back(Block);
+        }
+    }
+
+    zeroed_pool_params_t ZeroParams;
+    unsigned MaxOrder = MinOrder;
+    pool_unique_handle_t Inner{nullptr, nullptr};
+
+    std::mutex Mutex;
+    // Blocks zeroed or being zeroed, oldest fill first, by order
+    std::vector<std::deque<block_t>> Reserve;
+    // Bytes of the blocks of Reserve, and of the ones being added to it
+    size_t ReservedSize = 0;
+    // Orders of the allocated blocks
+    std::unordered_map<void *, uint8_t> LiveBlocks;
+    // Sequence number of the last fill of a reserved block
+    uint64_t LastSeq = 0;
+};
+
+} // namespace
+
+std::pair<umf_result_t, pool_unique_handle_t>
+zeroedPoolMakeUnique(provider_unique_handle_t provider,
+                     umf_disjoint_pool_params_t *params,
+                     const zeroed_pool_params_t &zeroParams) {
+    return poolMakeUnique<zeroed_pool>(std::move(provider), *params,
+                                       zeroParams);
+}
+
+} // namespace umf
@@ -0,0 +1,129 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_BINARY_FILE_CACHE_HPP
+#define UR_BINARY_FILE_CACHE_HPP 1
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <iterator>
+#include <optional>
+#include <sstream>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "logger/ur_logger.hpp"
+#include "ur_filesystem_resolved.hpp"
+#include "ur_util.hpp"
+
+namespace ur {
+
+/// FNV-1a, stable across processes and builds unlike std::hash
+inline uint64_t hashBytes(const void *data, size_t size) {
+    auto bytes = static_cast<const uint8_t *>(data);
+    uint64_t hash = 0xcbf29ce484222325;
+    for (size_t i = 0; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * 0x100000001b3;
+    }
+    return hash;
+}
+
+//////////////////////////////////////////////////////////////////////////
+/// Directory of binaries keyed by strings describing all they depend on,
+/// which the program caches of the adapters store their builds in. A file is
+/// named after the hash of its key and starts with the magic of the cache and
+/// the key, so that a hash collision or a file of another cache can't load
+/// the wrong binary.
+class binary_file_cache {
+  public:
+    binary_file_cache(filesystem::path dir, std::string magic,
+                      std::string extension)
+        : dir(std::move(dir)), magic(std::move(magic)),
+          extension(std::move(extension)) {}
+
+    /// Returns the binary stored for key, if any
+    template <typename T = uint8_t>
+    std::optional<std::vector<T>> load(const std::string &key) const {
+        std::ifstream in(getPath(key), std::ios::binary);
+        if (!in) {
+            return std::nullopt;
+        }
+
+        std::string storedMagic;
+        size_t keySize = 0;
+        if (!std::getline(in, storedMagic) || storedMagic != magic ||
+            !(in >> keySize) || in.get() != '\n' || keySize != key.size()) {
+            return std::nullopt;
+        }
+        std::string storedKey(keySize, '\0');
+        if (!in.read(storedKey.data(), keySize) || storedKey != key) {
+            return std::nullopt;
+        }
+
+        std::vector<T> binary{std::istreambuf_iterator<char>(in),
+                              std::istreambuf_iterator<char>()};
+        if (binary.empty()) {
+            return std::nullopt;
+        }
+        return binary;
+    }
+
+    /// Stores the size bytes of binary for key. Other threads and processes
+    /// storing the same key don't see partial files.
+    void store(const std::string &key, const void *binary, size_t size) const {
+        std::error_code error;
+        filesystem::create_directories(dir, error);
+
+        // Written to a file of this store first and renamed over the cached
+        // one, which the pid and a counter of the process tell apart
+        static std::atomic<uint64_t> tmpCount{0};
+        auto path = getPath(key);
+        auto tmpPath = path;
+        tmpPath += "." + std::to_string(ur_getpid()) + "." +
+                   std::to_string(tmpCount++) + ".tmp";
+        {
+            std::ofstream out(tmpPath, std::ios::binary | std::ios::trunc);
+            out << magic << '\n' << key.size() << '\n' << key;
+            out.write(static_cast<const char *>(binary), size);
+            if (!out) {
+                logger::warning("failed to write program cache file {}",
+                                tmpPath.string());
+                out.close();
+                filesystem::remove(tmpPath, error);
+                return;
+            }
+        }
+
+        filesystem::rename(tmpPath, path, error);
+        if (error) {
+            logger::warning("failed to write program cache file {}: {}",
+                            path.string(), error.message());
+            filesystem::remove(tmpPath, error);
+        }
+    }
+
+  private:
+    filesystem::path getPath(const std::string &key) const {
+        std::ostringstream name;
+        name << std::hex << hashBytes(key.data(), key.size()) << extension;
+        return dir / name.str();
+    }
+
+    filesystem::path dir;
+    std::string magic;
+    std::string extension;
+};
+
+} // namespace ur
+
+#endif /* UR_BINARY_FILE_CACHE_HPP */
@@ -0,0 +1,291 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_EVENT_NOTIFIER_HPP
+#define UR_EVENT_NOTIFIER_HPP 1
+
+#include <ur_api.h>
+#include <ur_ddi.h>
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Calls the callbacks registered with urEventSetCallback once their events
+/// reach the statuses they were registered for. A single thread polls all the
+/// events with outstanding callbacks of its owner, typically a context, and
+/// runs the callbacks, instead of a thread waiting on each event. The thread
+/// starts with the first callback and sleeps while there are none, polling
+/// less and less often while the events don't change.
+///
+/// Callbacks are run in turn, so they should return promptly.
+class event_notifier {
+  public:
+    event_notifier(ur_pfnEventGetInfo_t pfnGetInfo,
+                   ur_pfnEventRetain_t pfnRetain,
+                   ur_pfnEventRelease_t pfnRelease)
+        : state(std::make_shared<shared_state>(pfnGetInfo, pfnRetain,
+                                               pfnRelease)) {}
+
+    event_notifier(const event_notifier &) = delete;
+    event_notifier &operator=(const event_notifier &) = delete;
+
+    ~event_notifier() { shutdown(); }
+
+    /// Stops the thread. The callbacks still outstanding are run if their
+    /// events reached their statuses and dropped otherwise, calling their
+    /// pfnDropped, and the references on their events are released. Owners
+    /// whose events need more than the notifier to be released call it before
+    /// destroying those resources.
+    void shutdown() {
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->stop = true;
+        }
+        state->cv.notify_all();
+        if (thread.joinable()) {
+            // Releasing the last reference on an event may destroy the owner
+            // from the thread itself, which then drains the callbacks and
+            // exits on its own
+            if (thread.get_id() == std::this_thread::get_id()) {
+                thread.detach();
+                return;
+            }
+            thread.join();
+        }
+        drain(*state);
+    }
+
+    /// Retains hEvent until pfnNotify has been called, or pfnDropped if the
+    /// notifier is shut down before hEvent reached execStatus
+    ur_result_t add(ur_event_handle_t hEvent, ur_execution_info_t execStatus,
+                    ur_event_callback_t pfnNotify, void *pUserData,
+                    ur_event_callback_t pfnDropped = nullptr) {
+        if (execStatus == UR_EXECUTION_INFO_QUEUED) {
+            return UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+        }
+        if (auto result = state->pfnRetain(hEvent)) {
+            return result;
+        }
+
+        ur_result_t result = UR_RESULT_SUCCESS;
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            try {
+                state->pending.push_back(
+                    {hEvent, execStatus, pfnNotify, pUserData, pfnDropped});
+                try {
+                    if (!thread.joinable()) {
+                        thread = std::thread(run, state);
+                    }
+                } catch (const std::system_error &) {
+                    state->pending.pop_back();
+                    result = UR_RESULT_ERROR_OUT_OF_RESOURCES;
+                }
+            } catch (const std::bad_alloc &) {
+                result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+            }
+            state->polled = false;
+        }
+
+        if (result != UR_RESULT_SUCCESS) {
+            state->pfnRelease(hEvent);
+            return result;
+        }
+        state->cv.notify_all();
+        return UR_RESULT_SUCCESS;
+    }
+
+    /// Runs the callbacks of hEvent whose statuses it has reached from the
+    /// calling thread, so that they have run when a wait on hEvent returns.
+    /// Waits for the callbacks being run by the thread to return first.
+    void flush(ur_event_handle_t hEvent) {
+        // Releasing the event may destroy the notifier along with its owner
+        auto state = this->state;
+        std::vector<callback> flushed;
+        {
+            std::unique_lock<std::mutex> lock(state->mutex);
+            // A callback waiting on its own event from the thread would
+            // wait for itself
+            if (state->threadId != std::this_thread::get_id()) {
+                state->cv.wait(lock, [&] { return !state->inPass; });
+            }
+            auto first = std::stable_partition(
+                state->pending.begin(), state->pending.end(),
+                [&](const callback &cb) { return cb.hEvent != hEvent; });
+            flushed.assign(first, state->pending.end());
+            state->pending.erase(first, state->pending.end());
+        }
+        if (flushed.empty()) {
+            return;
+        }
+
+        std::vector<callback> waiting;
+        for (auto &cb : flushed) {
+            if (!notify(*state, cb)) {
+                waiting.push_back(cb);
+            }
+        }
+        if (!waiting.empty()) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->pending.insert(state->pending.end(), waiting.begin(),
+                                  waiting.end());
+        }
+    }
+
+  private:
+    struct callback {
+        ur_event_handle_t hEvent;
+        ur_execution_info_t execStatus;
+        ur_event_callback_t pfnNotify;
+        void *pUserData;
+        ur_event_callback_t pfnDropped;
+    };
+
+    // Shared with the thread, which may outlive the notifier
+    struct shared_state {
+        shared_state(ur_pfnEventGetInfo_t pfnGetInfo,
+                     ur_pfnEventRetain_t pfnRetain,
+                     ur_pfnEventRelease_t pfnRelease)
+            : pfnGetInfo(pfnGetInfo), pfnRetain(pfnRetain),
+              pfnRelease(pfnRelease) {}
+
+        const ur_pfnEventGetInfo_t pfnGetInfo;
+        const ur_pfnEventRetain_t pfnRetain;
+        const ur_pfnEventRelease_t pfnRelease;
+
+        std::mutex mutex;
+        std::condition_variable cv;
+        std::vector<callback> pending;
+        // Whether the pending callbacks have all been polled since the
+        // last was added
+        bool polled = false;
+        // Whether the thread is polling callbacks taken out of pending
+        bool inPass = false;
+        bool stop = false;
+        std::thread::id threadId;
+    };
+
+    static constexpr std::chrono::microseconds minInterval{20};
+    static constexpr std::chrono::microseconds maxInterval{1000};
+
+    // Returns whether the event has reached the status of the callback, as
+    // the status to notify
+    static bool reached(shared_state &state, const callback &cb,
+                        ur_execution_info_t &status) {
+        ur_event_status_t eventStatus;
+        if (state.pfnGetInfo(cb.hEvent, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                             sizeof(eventStatus), &eventStatus,
+                             nullptr) != UR_RESULT_SUCCESS ||
+            eventStatus == UR_EVENT_STATUS_ERROR) {
+            // The command won't go any further
+            status = UR_EXECUTION_INFO_COMPLETE;
+            return true;
+        }
+        // Statuses are numbered from complete to queued
+        status = static_cast<ur_execution_info_t>(eventStatus);
+        return static_cast<uint32_t>(eventStatus) <=
+               static_cast<uint32_t>(cb.execStatus);
+    }
+
+    // Calls and releases the callback if its event has reached its status
+    static bool notify(shared_state &state, const callback &cb) {
+        ur_execution_info_t status;
+        if (!reached(state, cb, status)) {
+            return false;
+        }
+        cb.pfnNotify(cb.hEvent, status, cb.pUserData);
+        state.pfnRelease(cb.hEvent);
+        return true;
+    }
+
+    // Runs or drops the callbacks left once the notifier is stopped
+    static void drain(shared_state &state) {
+        std::vector<callback> left;
+        {
+            std::lock_guard<std::mutex> lock(state.mutex);
+            left = std::move(state.pending);
+            state.pending.clear();
+        }
+        for (auto &cb : left) {
+            ur_execution_info_t status;
+            if (reached(state, cb, status)) {
+                cb.pfnNotify(cb.hEvent, status, cb.pUserData);
+            } else if (cb.pfnDropped) {
+                cb.pfnDropped(cb.hEvent, status, cb.pUserData);
+            }
+            state.pfnRelease(cb.hEvent);
+        }
+    }
+
+    static void run(std::shared_ptr<shared_state> state) {
+        auto interval = minInterval;
+        std::unique_lock<std::mutex> lock(state->mutex);
+        state->threadId = std::this_thread::get_id();
+        while (!state->stop) {
+            if (state->pending.empty()) {
+                state->cv.wait(lock, [&] {
+                    return state->stop || !state->pending.empty();
+                });
+                interval = minInterval;
+                continue;
+            }
+
+            auto polled = std::move(state->pending);
+            state->pending.clear();
+            state->polled = true;
+            state->inPass = true;
+            lock.unlock();
+
+            std::vector<callback> waiting;
+            bool notified = false;
+            for (auto &cb : polled) {
+                if (notify(*state, cb)) {
+                    notified = true;
+                } else {
+                    waiting.push_back(cb);
+                }
+            }
+
+            lock.lock();
+            state->pending.insert(state->pending.end(), waiting.begin(),
+                                  waiting.end());
+            state->inPass = false;
+            state->cv.notify_all();
+            // Poll again soon after progress, or when callbacks were added
+            // in the meantime
+            interval = notified || !state->polled
+                           ? minInterval
+                           : std::min(interval * 2, maxInterval);
+            state->cv.wait_for(lock, interval, [&] {
+                return state->stop || !state->polled;
+            });
+        }
+        lock.unlock();
+        drain(*state);
+    }
+
+    std::shared_ptr<shared_state> state;
+    std::thread thread;
+};
+
+} // namespace ur
+
+#endif // UR_EVENT_NOTIFIER_HPP
@@ -0,0 +1,163 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_IMAGE_HANDLE_CACHE_HPP
+#define UR_IMAGE_HANDLE_CACHE_HPP 1
+
+#include <ur_api.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Bindless image handles of a context, so that creating a handle for an
+/// image memory, a device and a descriptor it already has a handle for
+/// returns that handle instead of creating another native object. Frameworks
+/// tend to create the same handles every time they bind their images, which
+/// is typically every frame.
+///
+/// Handles are counted, each create taking a reference and each destroy
+/// dropping one, and are kept when they have none left so that the next
+/// create finds them. The native objects are only destroyed when the caller
+/// purges the memory they view, as it frees it.
+///
+/// Descriptors are compared as bytes, so structures appended to them must
+/// have their padding zeroed.
+class image_handle_cache {
+  public:
+    using memory_t = ur_exp_image_mem_native_handle_t;
+    using handle_t = ur_exp_image_native_handle_t;
+    using device_handle_t = std::pair<ur_device_handle_t, handle_t>;
+
+    /// Appends the bytes of value to the descriptor desc
+    template <typename T>
+    static void append(std::string &desc, const T &value) {
+        static_assert(std::is_trivially_copyable_v<T>,
+                      "descriptors are compared as bytes");
+        desc.append(reinterpret_cast<const char *>(&value), sizeof(value));
+    }
+
+    /// Finds the handle created for memory on device with desc, taking a
+    /// reference on it
+    bool acquire(ur_device_handle_t device, memory_t memory,
+                 const std::string &desc, handle_t &handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.find(key_t{memory, device, desc});
+        if (it == entries.end()) {
+            return false;
+        }
+        it->second.refCount++;
+        handle = it->second.handle;
+        return true;
+    }
+
+    /// Keeps handle, just created for memory on device with desc, with a
+    /// reference. If another thread cached a handle for them in the meantime,
+    /// returns false with handle replaced by that one, referenced, for the
+    /// caller to destroy its own.
+    bool insert(ur_device_handle_t device, memory_t memory,
+                const std::string &desc, handle_t &handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto [it, inserted] =
+            entries.try_emplace(key_t{memory, device, desc}, entry_t{handle});
+        if (!inserted) {
+            it->second.refCount++;
+            handle = it->second.handle;
+            return false;
+        }
+        handles.emplace(device_handle_t{device, handle}, it);
+        return true;
+    }
+
+    /// Drops a reference on handle, returning false if it isn't cached, for
+    /// the caller to destroy it
+    bool release(ur_device_handle_t device, handle_t handle) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = handles.find(device_handle_t{device, handle});
+        if (it == handles.end()) {
+            return false;
+        }
+        if (it->second->second.refCount > 0) {
+            it->second->second.refCount--;
+        }
+        return true;
+    }
+
+    /// Forgets the handles created for memory, returning them with their
+    /// devices for the caller to destroy
+    std::vector<device_handle_t> purge(memory_t memory) {
+        std::vector<device_handle_t> purged;
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = entries.lower_bound(key_t{memory, nullptr, std::string()});
+        while (it != entries.end() && std::get<0>(it->first) == memory) {
+            it = erase(it, purged);
+        }
+        return purged;
+    }
+
+    /// Forgets the handles nothing references, returning them with their
+    /// devices for the caller to destroy, as the memory they view may have
+    /// been freed in a way the caller doesn't see
+    std::vector<device_handle_t> purgeUnused() {
+        std::vector<device_handle_t> purged;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end();) {
+            it = it->second.refCount == 0 ? erase(it, purged) : std::next(it);
+        }
+        return purged;
+    }
+
+    /// Forgets every handle, returning them with their devices for the
+    /// caller to destroy
+    std::vector<device_handle_t> purgeAll() {
+        std::vector<device_handle_t> purged;
+        std::lock_guard<std::mutex> lock(mutex);
+        for (auto it = entries.begin(); it != entries.end();) {
+            it = erase(it, purged);
+        }
+        return purged;
+    }
+
+  private:
+    // Ordered by memory first, so that purging it walks a range
+    using key_t = std::tuple<memory_t, ur_device_handle_t, std::string>;
+
+    struct entry_t {
+        handle_t handle;
+        uint32_t refCount = 1;
+    };
+
+    using entries_t = std::map<key_t, entry_t>;
+
+    entries_t::iterator erase(entries_t::iterator it,
+                              std::vector<device_handle_t> &purged) {
+        device_handle_t handle{std::get<1>(it->first), it->second.handle};
+        purged.push_back(handle);
+        handles.erase(handle);
+        return entries.erase(it);
+    }
+
+    std::mutex mutex;
+    entries_t entries;
+    // The entry of each handle, to find it on destroy
+    std::map<device_handle_t, entries_t::iterator> handles;
+};
+
+} // namespace ur
+
+#endif // UR_IMAGE_HANDLE_CACHE_HPP
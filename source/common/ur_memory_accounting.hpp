@@ -0,0 +1,191 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_MEMORY_ACCOUNTING_HPP
+#define UR_MEMORY_ACCOUNTING_HPP 1
+
+#include <ur_api.h>
+
+#include "logger/ur_logger.hpp"
+#include "ur_util.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Memory a context holds from the driver, by ur_exp_context_memory_type_t,
+/// returned by the experimental ur_context_info_t properties, to size the
+/// pool limits from what applications actually use and to spot memory the
+/// adapter keeps for itself.
+///
+/// Adapters count the memory where they allocate it from the driver, so the
+/// memory a pool holds counts once, when the pool gets it, whether it has
+/// been handed out or not.
+///
+/// With UR_CONTEXT_MEMORY_LOG_INTERVAL set to a number of milliseconds, the
+/// usage is logged at most that often, as the context allocates, and once
+/// more when the context is destroyed.
+///
+/// Every counter is updated with relaxed atomics, as they are only read to
+/// be reported.
+class memory_accounting {
+  public:
+    static constexpr size_t typeCount = UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL + 1;
+
+    /// owner identifies the context in the log lines
+    explicit memory_accounting(const void *owner)
+        : owner(owner), lastLog(nowMilliseconds()) {}
+
+    memory_accounting(const memory_accounting &) = delete;
+    memory_accounting &operator=(const memory_accounting &) = delete;
+
+    ~memory_accounting() {
+        if (logInterval()) {
+            log();
+        }
+    }
+
+    /// Counts size bytes of type allocated from the driver
+    void onAlloc(ur_exp_context_memory_type_t type, size_t size) {
+        uint64_t current =
+            used[type].fetch_add(size, std::memory_order_relaxed) + size;
+        updatePeak(peak[type], current);
+        uint64_t total =
+            totalUsed.fetch_add(size, std::memory_order_relaxed) + size;
+        updatePeak(totalPeak, total);
+        logIfDue();
+    }
+
+    /// Counts size bytes of type returned to the driver
+    void onFree(ur_exp_context_memory_type_t type, size_t size) {
+        used[type].fetch_sub(size, std::memory_order_relaxed);
+        totalUsed.fetch_sub(size, std::memory_order_relaxed);
+    }
+
+    /// Counts size bytes counted as from as to instead, for the memory of a
+    /// pool of from which the adapter uses as to, such as the buffers served
+    /// from the USM pools. The total doesn't change.
+    void reclassify(ur_exp_context_memory_type_t from,
+                    ur_exp_context_memory_type_t to, size_t size) {
+        used[from].fetch_sub(size, std::memory_order_relaxed);
+        uint64_t current =
+            used[to].fetch_add(size, std::memory_order_relaxed) + size;
+        updatePeak(peak[to], current);
+    }
+
+    uint64_t getUsed(ur_exp_context_memory_type_t type) const {
+        return used[type].load(std::memory_order_relaxed);
+    }
+
+    uint64_t getPeak(ur_exp_context_memory_type_t type) const {
+        return peak[type].load(std::memory_order_relaxed);
+    }
+
+    uint64_t getTotalPeak() const {
+        return totalPeak.load(std::memory_order_relaxed);
+    }
+
+    /// Returns the usage propName through returnValue, an UrReturnHelper
+    template <typename ReturnHelper>
+    ur_result_t getInfo(ur_context_info_t propName,
+                        ReturnHelper &returnValue) const {
+        switch (propName) {
+        case UR_CONTEXT_INFO_MEMORY_USED_EXP:
+        case UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP: {
+            const auto &counters =
+                propName == UR_CONTEXT_INFO_MEMORY_USED_EXP ? used : peak;
+            std::array<uint64_t, typeCount> values;
+            for (size_t i = 0; i < values.size(); ++i) {
+                values[i] = counters[i].load(std::memory_order_relaxed);
+            }
+            return returnValue(values.data(), values.size());
+        }
+        case UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP:
+            return returnValue(getTotalPeak());
+        default:
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+  private:
+    static void updatePeak(std::atomic<uint64_t> &peak, uint64_t current) {
+        uint64_t max = peak.load(std::memory_order_relaxed);
+        while (max < current &&
+               !peak.compare_exchange_weak(max, current,
+                                           std::memory_order_relaxed)) {
+        }
+    }
+
+    static uint64_t nowMilliseconds() {
+        return std::chrono::duration_cast<std::chrono::milliseconds>(
+                   std::chrono::steady_clock::now().time_since_epoch())
+            .count();
+    }
+
+    static uint64_t logInterval() {
+        static const uint64_t interval =
+            getenv_to_unsigned("UR_CONTEXT_MEMORY_LOG_INTERVAL").value_or(0);
+        return interval;
+    }
+
+    // Logs on behalf of the first allocation past the interval, the others
+    // of that interval only read the clock
+    void logIfDue() {
+        uint64_t interval = logInterval();
+        if (!interval) {
+            return;
+        }
+        uint64_t now = nowMilliseconds();
+        uint64_t last = lastLog.load(std::memory_order_relaxed);
+        if (now - last < interval ||
+            !lastLog.compare_exchange_strong(last, now,
+                                             std::memory_order_relaxed)) {
+            return;
+        }
+        log();
+    }
+
+    void log() const {
+        logger::always(
+            "context {} memory used (bytes): usm_host {} (peak {}), "
+            "usm_device {} (peak {}), usm_shared {} (peak {}), buffer {} "
+            "(peak {}), image {} (peak {}), internal {} (peak {}), total {} "
+            "(peak {})",
+            owner, getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST),
+            getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE),
+            getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED),
+            getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER),
+            getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE),
+            getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL),
+            getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL),
+            totalUsed.load(std::memory_order_relaxed), getTotalPeak());
+    }
+
+    const void *owner;
+    std::array<std::atomic<uint64_t>, typeCount> used{};
+    std::array<std::atomic<uint64_t>, typeCount> peak{};
+    std::atomic<uint64_t> totalUsed{0};
+    std::atomic<uint64_t> totalPeak{0};
+    std::atomic<uint64_t> lastLog;
+};
+
+} // namespace ur
+
+#endif // UR_MEMORY_ACCOUNTING_HPP
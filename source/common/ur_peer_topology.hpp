@@ -0,0 +1,112 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_PEER_TOPOLOGY_HPP
+#define UR_PEER_TOPOLOGY_HPP 1
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Peer links between the devices of a platform, queried once for every
+/// pair on first use instead of on every query, along with whether peer
+/// access has been enabled between them. Copies between devices without peer
+/// access enabled either way go through the host, so a copy between two such
+/// devices may be faster through a third one both have peer access with.
+///
+/// Devices are identified by their index in the platform.
+class peer_topology {
+  public:
+    struct link_t {
+        bool accessSupported = false;
+        bool atomicsSupported = false;
+        // Relative performance of the link as reported by the driver, lower
+        // being faster
+        int performanceRank = 0;
+    };
+
+    /// Fills the links between numDevices devices on the first call, with
+    /// query(src, dst, link) called for every pair of distinct devices.
+    /// Exceptions thrown by query are propagated and the next call retries.
+    template <typename F> void init(size_t numDevices, F &&query) {
+        std::call_once(initFlag, [&] {
+            std::vector<link_t> queried(numDevices * numDevices);
+            for (size_t src = 0; src < numDevices; src++) {
+                for (size_t dst = 0; dst < numDevices; dst++) {
+                    if (src != dst) {
+                        query(src, dst, queried[src * numDevices + dst]);
+                    }
+                }
+            }
+            links = std::move(queried);
+            enabled = std::make_unique<std::atomic<bool>[]>(numDevices *
+                                                              numDevices);
+            this->numDevices = numDevices;
+        });
+    }
+
+    /// The link from src to dst, once initialized
+    const link_t &get(size_t src, size_t dst) const {
+        return links[src * numDevices + dst];
+    }
+
+    /// Records that dst's memory can be accessed from src, or no longer can
+    void setEnabled(size_t src, size_t dst, bool isEnabled) {
+        enabled[src * numDevices + dst] = isEnabled;
+    }
+
+    /// Whether copies between src and dst go directly from one to the other
+    bool isDirect(size_t src, size_t dst) const {
+        return src == dst || enabled[src * numDevices + dst] ||
+               enabled[dst * numDevices + src];
+    }
+
+    /// Finds a device to copy from src to dst through, when they have no
+    /// direct path and others have one to both, picking the one with the
+    /// fastest links among those for which usable(device) returns true
+    template <typename F>
+    bool findRoute(size_t src, size_t dst, F &&usable, size_t &via) const {
+        if (isDirect(src, dst)) {
+            return false;
+        }
+        bool found = false;
+        int bestRank = 0;
+        for (size_t device = 0; device < numDevices; device++) {
+            if (device == src || device == dst || !isDirect(src, device) ||
+                !isDirect(device, dst) || !usable(device)) {
+                continue;
+            }
+            int rank = get(src, device).performanceRank +
+                       get(device, dst).performanceRank;
+            if (!found || rank < bestRank) {
+                found = true;
+                bestRank = rank;
+                via = device;
+            }
+        }
+        return found;
+    }
+
+  private:
+    std::once_flag initFlag;
+    size_t numDevices = 0;
+    // Indexed by src * numDevices + dst
+    std::vector<link_t> links;
+    std::unique_ptr<std::atomic<bool>[]> enabled;
+};
+
+} // namespace ur
+
+#endif // UR_PEER_TOPOLOGY_HPP
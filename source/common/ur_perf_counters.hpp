@@ -0,0 +1,106 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_PERF_COUNTERS_HPP
+#define UR_PERF_COUNTERS_HPP 1
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace ur {
+
+class perf_counter;
+
+//////////////////////////////////////////////////////////////////////////
+/// The performance counters of an adapter, such as the hits and misses of
+/// its caches, to find out when a configuration defeats them without running
+/// a profiler. Adapters define their counters as globals, which register
+/// themselves here, and return dump() from urAdapterGetInfo.
+///
+/// Adapters are built with hidden visibility, so each has its own registry.
+class perf_counters {
+  public:
+    static perf_counters &get() {
+        static perf_counters instance;
+        return instance;
+    }
+
+    /// The counters ordered by name, one per line as the name followed by a
+    /// space and the value
+    inline std::string dump() const;
+
+  private:
+    friend class perf_counter;
+
+    void add(const perf_counter *counter) {
+        std::lock_guard<std::mutex> lock(mutex);
+        counters.push_back(counter);
+    }
+
+    void remove(const perf_counter *counter) {
+        std::lock_guard<std::mutex> lock(mutex);
+        counters.erase(std::remove(counters.begin(), counters.end(), counter),
+                       counters.end());
+    }
+
+    mutable std::mutex mutex;
+    std::vector<const perf_counter *> counters;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// A named counter of the registry, incremented with relaxed atomics so that
+/// counting on hot paths costs no more than an uncontended increment.
+/// Counters are only read to be reported, never to synchronize.
+class perf_counter {
+  public:
+    explicit perf_counter(const char *name) : name(name) {
+        perf_counters::get().add(this);
+    }
+    ~perf_counter() { perf_counters::get().remove(this); }
+
+    perf_counter(const perf_counter &) = delete;
+    perf_counter &operator=(const perf_counter &) = delete;
+
+    void add(uint64_t n = 1) { value.fetch_add(n, std::memory_order_relaxed); }
+
+    uint64_t get() const { return value.load(std::memory_order_relaxed); }
+
+    const char *getName() const { return name; }
+
+  private:
+    const char *name;
+    std::atomic<uint64_t> value{0};
+};
+
+std::string perf_counters::dump() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    std::vector<const perf_counter *> sorted = counters;
+    std::sort(sorted.begin(), sorted.end(),
+              [](const perf_counter *a, const perf_counter *b) {
+                  return std::strcmp(a->getName(), b->getName()) < 0;
+              });
+    std::string result;
+    for (auto counter : sorted) {
+        result.append(counter->getName());
+        result.append(" ");
+        result.append(std::to_string(counter->get()));
+        result.append("\n");
+    }
+    return result;
+}
+
+} // namespace ur
+
+#endif // UR_PERF_COUNTERS_HPP
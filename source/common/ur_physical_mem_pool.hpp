@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_PHYSICAL_MEM_POOL_HPP
+#define UR_PHYSICAL_MEM_POOL_HPP 1
+
+#include <ur_api.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <list>
+#include <map>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Physical memory chunks of a context which nothing uses anymore, kept by
+/// device and size so that creating a chunk of the same size for the same
+/// device takes one of them instead of asking the driver, which is slow.
+/// Frameworks growing and shrinking virtual ranges release chunks and create
+/// them again all the time.
+///
+/// At most maxBytes are kept, the chunks released first being given back to
+/// the caller to destroy when more come, and trim gives back more of them,
+/// such as when the device runs out of memory. Chunks still mapped when
+/// they are released are given back too, as the driver only frees them once
+/// unmapped, so the caller records the mappings.
+template <typename T> class physical_mem_pool {
+  public:
+    using chunk_t = std::pair<ur_device_handle_t, T>;
+
+    explicit physical_mem_pool(size_t maxBytes) : maxBytes(maxBytes) {}
+
+    /// Takes a chunk of size bytes kept for device, the one released last
+    bool take(ur_device_handle_t device, size_t size, T &chunk) {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto [first, last] = index.equal_range(key_t{device, size});
+        if (first == last) {
+            return false;
+        }
+        auto it = std::prev(last);
+        chunk = it->second->chunk;
+        pooledBytes -= size;
+        entries.erase(it->second);
+        index.erase(it);
+        return true;
+    }
+
+    /// Keeps chunk, of size bytes for device, giving back the chunks to
+    /// destroy to stay within maxBytes, which may include chunk itself
+    std::vector<chunk_t> put(ur_device_handle_t device, size_t size,
+                             T chunk) {
+        std::vector<chunk_t> evicted;
+        std::lock_guard<std::mutex> lock(mutex);
+        if (size > maxBytes || mapCounts.count(chunk)) {
+            evicted.emplace_back(device, chunk);
+            return evicted;
+        }
+        trimLocked(maxBytes - size, evicted);
+        entries.push_back(entry_t{device, size, chunk});
+        index.emplace(key_t{device, size}, std::prev(entries.end()));
+        pooledBytes += size;
+        return evicted;
+    }
+
+    /// Gives back the chunks released first until at most keepBytes are
+    /// kept, for the caller to destroy
+    std::vector<chunk_t> trim(size_t keepBytes) {
+        std::vector<chunk_t> evicted;
+        std::lock_guard<std::mutex> lock(mutex);
+        trimLocked(keepBytes, evicted);
+        return evicted;
+    }
+
+    /// Records that chunk is mapped at start
+    void map(const void *start, T chunk) {
+        auto addr = reinterpret_cast<uintptr_t>(start);
+        std::lock_guard<std::mutex> lock(mutex);
+        if (mappings.emplace(addr, chunk).second) {
+            mapCounts[chunk]++;
+        }
+    }
+
+    /// Forgets the mappings starting in [start, start + size)
+    void unmap(const void *start, size_t size) {
+        auto begin = reinterpret_cast<uintptr_t>(start);
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = mappings.lower_bound(begin);
+        while (it != mappings.end() && it->first - begin < size) {
+            auto count = mapCounts.find(it->second);
+            if (--count->second == 0) {
+                mapCounts.erase(count);
+            }
+            it = mappings.erase(it);
+        }
+    }
+
+  private:
+    using key_t = std::pair<ur_device_handle_t, size_t>;
+
+    struct entry_t {
+        ur_device_handle_t device;
+        size_t size;
+        T chunk;
+    };
+
+    void trimLocked(size_t keepBytes, std::vector<chunk_t> &evicted) {
+        while (pooledBytes > keepBytes) {
+            auto oldest = entries.begin();
+            auto [first, last] =
+                index.equal_range(key_t{oldest->device, oldest->size});
+            for (auto it = first; it != last; ++it) {
+                if (it->second == oldest) {
+                    index.erase(it);
+                    break;
+                }
+            }
+            evicted.emplace_back(oldest->device, oldest->chunk);
+            pooledBytes -= oldest->size;
+            entries.erase(oldest);
+        }
+    }
+
+    const size_t maxBytes;
+    std::mutex mutex;
+    // In the order they were released
+    std::list<entry_t> entries;
+    std::multimap<key_t, typename std::list<entry_t>::iterator> index;
+    size_t pooledBytes = 0;
+
+    // Chunks by the address they are mapped at, and the number of times
+    // each is mapped
+    std::map<uintptr_t, T> mappings;
+    std::map<T, uint32_t> mapCounts;
+};
+
+} // namespace ur
+
+#endif // UR_PHYSICAL_MEM_POOL_HPP
@@ -254,6 +254,62 @@ template <typename D> struct pool_manager {
 
     desc_to_pool_map_t descToPoolMap;
 
+    // Flat routing table filled by addPool(), indexed by the device ordinal
+    // and the USM type, so that getPool() needn't hash the descriptor, which
+    // queries the native device handle. Only covers the pool handle of the
+    // first descriptor added, the others go through descToPoolMap.
+    enum { DEVICE_POOL, SHARED_POOL, SHARED_READ_ONLY_POOL, POOLS_PER_DEVICE };
+
+    bool hasTable = false;
+    ur_usm_pool_handle_t tablePoolHandle = nullptr;
+    umf_memory_pool_handle_t hostPool = nullptr;
+    std::vector<ur_device_handle_t> tableDevices;
+    std::vector<umf_memory_pool_handle_t> tablePools;
+
+    umf_memory_pool_handle_t *findTableEntry(const D &desc, bool create) {
+        if (!hasTable) {
+            if (!create) {
+                return nullptr;
+            }
+            hasTable = true;
+            tablePoolHandle = desc.poolHandle;
+        }
+        if (desc.poolHandle != tablePoolHandle) {
+            return nullptr;
+        }
+
+        size_t slot;
+        switch (desc.type) {
+        case UR_USM_TYPE_HOST:
+            return &hostPool;
+        case UR_USM_TYPE_DEVICE:
+            slot = DEVICE_POOL;
+            break;
+        case UR_USM_TYPE_SHARED:
+            slot = isSharedAllocationReadOnlyOnDevice(desc)
+                       ? SHARED_READ_ONLY_POOL
+                       : SHARED_POOL;
+            break;
+        default:
+            return nullptr;
+        }
+
+        // A context has a handful of devices, a scan beats hashing
+        size_t ordinal = 0;
+        while (ordinal < tableDevices.size() &&
+               tableDevices[ordinal] != desc.hDevice) {
+            ordinal++;
+        }
+        if (ordinal == tableDevices.size()) {
+            if (!create) {
+                return nullptr;
+            }
+            tableDevices.push_back(desc.hDevice);
+            tablePools.resize(tablePools.size() + POOLS_PER_DEVICE, nullptr);
+        }
+        return &tablePools[ordinal * POOLS_PER_DEVICE + slot];
+    }
+
   public:
     static std::pair<ur_result_t, pool_manager>
     create(desc_to_pool_map_t &&descToHandleMap = {}) {
@@ -271,7 +327,14 @@ template <typename D> struct pool_manager {
 
     ur_result_t addPool(const D &desc,
                         umf::pool_unique_handle_t &&hPool) noexcept {
-        if (!descToPoolMap.try_emplace(desc, std::move(hPool)).second) {
+        auto [it, inserted] = descToPoolMap.try_emplace(desc, std::move(hPool));
+
+        // Sub-devices matching an existing descriptor share its pool
+        if (auto entry = findTableEntry(desc, true)) {
+            *entry = it->second.get();
+        }
+
+        if (!inserted) {
             logger::error("Pool for pool descriptor: {}, already exists", desc);
             return UR_RESULT_ERROR_INVALID_ARGUMENT;
         }
@@ -280,6 +343,10 @@ template <typename D> struct pool_manager {
     }
 
     std::optional<umf_memory_pool_handle_t> getPool(const D &desc) noexcept {
+        if (auto entry = findTableEntry(desc, false); entry && *entry) {
+            return *entry;
+        }
+
         auto it = descToPoolMap.find(desc);
         if (it == descToPoolMap.end()) {
             logger::error("Pool descriptor doesn't match any existing pool: {}",
@@ -289,6 +356,12 @@ template <typename D> struct pool_manager {
 
         return it->second.get();
     }
+
+    template <typename F> void forEachPool(F &&func) {
+        for (auto &[desc, hPool] : descToPoolMap) {
+            func(hPool.get());
+        }
+    }
 };
 
 } // namespace usm
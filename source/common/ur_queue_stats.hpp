@@ -0,0 +1,160 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_QUEUE_STATS_HPP
+#define UR_QUEUE_STATS_HPP 1
+
+#include <ur_api.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Submission statistics of a queue, returned by the experimental
+/// ur_queue_info_t properties, to tune the batch sizes and stream counts of
+/// the adapters from what applications actually do.
+///
+/// The commands outstanding are those enqueued since the queue was last
+/// found idle, when urQueueFinish returns or when the queue is queried
+/// empty. Adapters don't track the completion of each command, so this is
+/// an upper bound of the commands the device has yet to execute.
+///
+/// Every statistic is updated with relaxed atomics, as they are only read to
+/// be reported.
+class queue_stats {
+  public:
+    struct snapshot_t {
+        uint64_t commands = 0;
+        uint64_t submissions = 0;
+        // Sum of the commands outstanding as each command was enqueued
+        uint64_t outstandingSum = 0;
+        uint64_t maxOutstanding = 0;
+        uint64_t finishNanoseconds = 0;
+        uint64_t switches = 0;
+
+        /// Combines the statistics of queues, such as the queues an
+        /// out-of-order queue is made of
+        snapshot_t &operator+=(const snapshot_t &other) {
+            commands += other.commands;
+            submissions += other.submissions;
+            outstandingSum += other.outstandingSum;
+            if (maxOutstanding < other.maxOutstanding) {
+                maxOutstanding = other.maxOutstanding;
+            }
+            finishNanoseconds += other.finishNanoseconds;
+            switches += other.switches;
+            return *this;
+        }
+    };
+
+    /// Counts a command enqueued
+    void onCommand() {
+        commands.fetch_add(1, std::memory_order_relaxed);
+        uint64_t current =
+            outstanding.fetch_add(1, std::memory_order_relaxed) + 1;
+        outstandingSum.fetch_add(current, std::memory_order_relaxed);
+        uint64_t max = maxOutstanding.load(std::memory_order_relaxed);
+        while (max < current &&
+               !maxOutstanding.compare_exchange_weak(
+                   max, current, std::memory_order_relaxed)) {
+        }
+    }
+
+    /// Counts a submission to the driver, of one or more commands
+    void onSubmission() { submissions.fetch_add(1, std::memory_order_relaxed); }
+
+    /// Counts a command going to another command list or stream than the
+    /// previous one
+    void onSwitch() { switches.fetch_add(1, std::memory_order_relaxed); }
+
+    /// Records that every command enqueued so far has completed
+    void onIdle() { outstanding.store(0, std::memory_order_relaxed); }
+
+    /// Measures the time spent in urQueueFinish during its lifetime, after
+    /// which the queue is idle
+    class finish_scope {
+      public:
+        explicit finish_scope(queue_stats &stats)
+            : stats(stats), start(std::chrono::steady_clock::now()) {}
+        ~finish_scope() {
+            auto elapsed = std::chrono::steady_clock::now() - start;
+            stats.finishNanoseconds.fetch_add(
+                std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed)
+                    .count(),
+                std::memory_order_relaxed);
+        }
+
+        finish_scope(const finish_scope &) = delete;
+        finish_scope &operator=(const finish_scope &) = delete;
+
+        /// Records that the queue is idle, once it finished successfully
+        void finished() { stats.onIdle(); }
+
+      private:
+        queue_stats &stats;
+        std::chrono::steady_clock::time_point start;
+    };
+
+    snapshot_t snapshot() const {
+        snapshot_t result;
+        result.commands = commands.load(std::memory_order_relaxed);
+        result.submissions = submissions.load(std::memory_order_relaxed);
+        result.outstandingSum = outstandingSum.load(std::memory_order_relaxed);
+        result.maxOutstanding = maxOutstanding.load(std::memory_order_relaxed);
+        result.finishNanoseconds =
+            finishNanoseconds.load(std::memory_order_relaxed);
+        result.switches = switches.load(std::memory_order_relaxed);
+        return result;
+    }
+
+    /// Returns the statistic propName of snapshot through returnValue, an
+    /// UrReturnHelper
+    template <typename ReturnHelper>
+    static ur_result_t getInfo(const snapshot_t &snapshot,
+                               ur_queue_info_t propName,
+                               ReturnHelper &returnValue) {
+        switch (propName) {
+        case UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP:
+            return returnValue(snapshot.commands);
+        case UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP:
+            return returnValue(snapshot.submissions);
+        case UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP:
+            return returnValue(snapshot.commands
+                                   ? static_cast<double>(
+                                         snapshot.outstandingSum) /
+                                         snapshot.commands
+                                   : 0.0);
+        case UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP:
+            return returnValue(snapshot.maxOutstanding);
+        case UR_QUEUE_INFO_FINISH_BLOCKED_TIME_EXP:
+            return returnValue(snapshot.finishNanoseconds);
+        case UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP:
+            return returnValue(snapshot.switches);
+        default:
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+    }
+
+  private:
+    std::atomic<uint64_t> commands{0};
+    std::atomic<uint64_t> submissions{0};
+    std::atomic<uint64_t> outstanding{0};
+    std::atomic<uint64_t> outstandingSum{0};
+    std::atomic<uint64_t> maxOutstanding{0};
+    std::atomic<uint64_t> finishNanoseconds{0};
+    std::atomic<uint64_t> switches{0};
+};
+
+} // namespace ur
+
+#endif // UR_QUEUE_STATS_HPP
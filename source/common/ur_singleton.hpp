@@ -11,23 +11,148 @@
 #ifndef UR_SINGLETON_H
 #define UR_SINGLETON_H 1
 
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <memory>
 #include <mutex>
+#include <new>
 #include <unordered_map>
+#include <vector>
+
+//////////////////////////////////////////////////////////////////////////
+/// a pool of equally sized memory blocks carved out of large chunks,
+/// released blocks are kept on a free list and handed out again
+class slab_pool_t {
+  public:
+    slab_pool_t() = default;
+    slab_pool_t(const slab_pool_t &) = delete;
+    slab_pool_t &operator=(const slab_pool_t &) = delete;
+
+    /// returns the block size served by the pool, 0 until first use
+    size_t blockSize() const { return size; }
+
+    /// binds the pool to a block size, the first caller wins
+    bool serves(size_t bytes) {
+        if (size == 0) {
+            size = roundUp(bytes);
+        }
+        return size == roundUp(bytes);
+    }
+
+    void *allocate() {
+        if (freeList) {
+            auto block = freeList;
+            freeList = freeList->next;
+            return block;
+        }
+        if (used == capacity) {
+            capacity = capacity ? std::min(capacity * 2, maxChunkBlocks)
+                                : minChunkBlocks;
+            chunks.emplace_back(new std::byte[capacity * size]);
+            used = 0;
+        }
+        return chunks.back().get() + (used++) * size;
+    }
+
+    void deallocate(void *ptr) {
+        auto block = static_cast<free_block_t *>(ptr);
+        block->next = freeList;
+        freeList = block;
+    }
+
+  private:
+    struct free_block_t {
+        free_block_t *next;
+    };
+
+    static constexpr size_t minChunkBlocks = 64;
+    static constexpr size_t maxChunkBlocks = 4096;
+
+    static size_t roundUp(size_t bytes) {
+        constexpr size_t align = alignof(std::max_align_t);
+        bytes = std::max(bytes, sizeof(free_block_t));
+        return (bytes + align - 1) & ~(align - 1);
+    }
+
+    size_t size = 0;
+    size_t used = 0;
+    size_t capacity = 0;
+    free_block_t *freeList = nullptr;
+    std::vector<std::unique_ptr<std::byte[]>> chunks;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// allocator serving single-object allocations (e.g. hash map nodes) from
+/// a slab_pool_t, everything else goes to the global operator new
+template <typename T> struct slab_allocator_t {
+    using value_type = T;
+
+    explicit slab_allocator_t(slab_pool_t *pool) noexcept : pool(pool) {}
+    template <typename U>
+    slab_allocator_t(const slab_allocator_t<U> &other) noexcept
+        : pool(other.pool) {}
+
+    T *allocate(size_t n) {
+        if (n == 1 && alignof(T) <= alignof(std::max_align_t) &&
+            pool->serves(sizeof(T))) {
+            return static_cast<T *>(pool->allocate());
+        }
+        return static_cast<T *>(::operator new(n * sizeof(T)));
+    }
+
+    void deallocate(T *ptr, size_t n) noexcept {
+        if (n == 1 && alignof(T) <= alignof(std::max_align_t) &&
+            pool->serves(sizeof(T))) {
+            pool->deallocate(ptr);
+            return;
+        }
+        ::operator delete(ptr);
+    }
+
+    template <typename U>
+    bool operator==(const slab_allocator_t<U> &other) const noexcept {
+        return pool == other.pool;
+    }
+    template <typename U>
+    bool operator!=(const slab_allocator_t<U> &other) const noexcept {
+        return pool != other.pool;
+    }
+
+    slab_pool_t *pool;
+};
 
 //////////////////////////////////////////////////////////////////////////
 /// a abstract factory for creation of singleton objects
+///
+/// The map is split into a fixed number of independently locked shards so
+/// that threads creating or releasing unrelated handles (e.g. the output
+/// events of concurrent enqueues) do not serialize on a single lock.
+///
+/// Instances live inside the map nodes, which are carved out of a per-shard
+/// slab, so creating an instance doesn't hit the heap once the slab is warm
+/// and released instances are recycled.
 template <typename singleton_tn, typename key_tn> class singleton_factory_t {
   protected:
     using singleton_t = singleton_tn;
     using key_t = typename std::conditional<std::is_pointer<key_tn>::value,
                                             size_t, key_tn>::type;
 
-    using ptr_t = std::unique_ptr<singleton_t>;
-    using map_t = std::unordered_map<key_t, ptr_t>;
+    using allocator_t = slab_allocator_t<std::pair<const key_t, singleton_t>>;
+    using map_t = std::unordered_map<key_t, singleton_t, std::hash<key_t>,
+                                     std::equal_to<key_t>, allocator_t>;
+
+    static constexpr size_t numShards = 64; ///< must be a power of two
 
-    std::mutex mut; ///< lock for thread-safety
-    map_t map;      ///< single instance of singleton for each unique key
+    struct alignas(64) shard_t {
+        std::mutex mut;   ///< lock for thread-safety
+        slab_pool_t slab; ///< storage of the map nodes, must outlive the map
+        map_t map{0, std::hash<key_t>{}, std::equal_to<key_t>{},
+                  allocator_t{&slab}}; ///< single instance of singleton for
+                                       ///< each unique key
+    };
+
+    std::array<shard_t, numShards> shards;
 
     //////////////////////////////////////////////////////////////////////////
     /// extract the key from parameter list and if necessary, convert type
@@ -36,6 +161,16 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
         return reinterpret_cast<key_t>(key);
     }
 
+    //////////////////////////////////////////////////////////////////////////
+    /// select the shard owning the key, handles are usually allocated with
+    /// at least 16-byte alignment so the low bits carry no information
+    shard_t &getShard(key_t key) {
+        auto bits = static_cast<size_t>(key);
+        bits ^= bits >> 17;
+        bits ^= bits >> 9;
+        return shards[(bits >> 4) & (numShards - 1)];
+    }
+
   public:
     //////////////////////////////////////////////////////////////////////////
     /// default ctor/dtor
@@ -54,27 +189,26 @@ template <typename singleton_tn, typename key_tn> class singleton_factory_t {
             return static_cast<singleton_tn *>(0);
         }
 
-        std::lock_guard<std::mutex> lk(mut);
-        auto iter = map.find(key);
-
-        if (map.end() == iter) {
-            auto ptr =
-                std::make_unique<singleton_t>(std::forward<Ts>(params)...);
-            iter = map.emplace(key, std::move(ptr)).first;
-        }
-        return iter->second.get();
+        auto &shard = getShard(key);
+        std::lock_guard<std::mutex> lk(shard.mut);
+        // only constructs the singleton if the key isn't present yet
+        auto iter = shard.map.try_emplace(key, std::forward<Ts>(params)...);
+        return &iter.first->second;
     }
 
     //////////////////////////////////////////////////////////////////////////
     /// once the key is no longer valid, release the singleton
     void release(key_tn key) {
-        std::lock_guard<std::mutex> lk(mut);
-        map.erase(getKey(key));
+        auto &shard = getShard(getKey(key));
+        std::lock_guard<std::mutex> lk(shard.mut);
+        shard.map.erase(getKey(key));
     }
 
     void clear() {
-        std::lock_guard<std::mutex> lk(mut);
-        map.clear();
+        for (auto &shard : shards) {
+            std::lock_guard<std::mutex> lk(shard.mut);
+            shard.map.clear();
+        }
     }
 };
 
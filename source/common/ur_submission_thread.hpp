@@ -0,0 +1,257 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_SUBMISSION_THREAD_HPP
+#define UR_SUBMISSION_THREAD_HPP 1
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Bounded queue between a single producer and a single consumer, neither of
+/// which locks. The slots are constructed once and reused: the producer fills
+/// the slot returned by beginPush() and publishes it with endPush(), the
+/// consumer reads the one returned by front() and hands it back with pop().
+/// Members keeping their capacity, vectors for instance, are thus not
+/// reallocated once the ring has warmed up.
+template <typename T> class spsc_ring {
+  public:
+    /// capacity is rounded up to a power of two
+    explicit spsc_ring(size_t capacity)
+        : slots(roundUpToPowerOfTwo(capacity)), mask(slots.size() - 1) {}
+
+    spsc_ring(const spsc_ring &) = delete;
+    spsc_ring &operator=(const spsc_ring &) = delete;
+
+    size_t capacity() const noexcept { return slots.size(); }
+
+    /// Producer only: the slot to fill next, or nullptr if the ring is full
+    T *beginPush() noexcept {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cachedHead == slots.size()) {
+            cachedHead = head.load(std::memory_order_acquire);
+            if (t - cachedHead == slots.size()) {
+                return nullptr;
+            }
+        }
+        return &slots[t & mask];
+    }
+
+    /// Producer only: publishes the slot returned by beginPush()
+    void endPush() noexcept {
+        tail.store(tail.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+    }
+
+    /// Consumer only: the oldest published slot, or nullptr if there's none
+    T *front() noexcept {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cachedTail) {
+            cachedTail = tail.load(std::memory_order_acquire);
+            if (h == cachedTail) {
+                return nullptr;
+            }
+        }
+        return &slots[h & mask];
+    }
+
+    /// Consumer only: hands the slot returned by front() back to the producer
+    void pop() noexcept {
+        head.store(head.load(std::memory_order_relaxed) + 1,
+                   std::memory_order_release);
+    }
+
+  private:
+    static size_t roundUpToPowerOfTwo(size_t value) {
+        size_t result = 1;
+        while (result < value) {
+            result <<= 1;
+        }
+        return result;
+    }
+
+    // Each side's index is kept on a cache line of its own, with the copy of
+    // the other side's index it last read
+    static constexpr size_t cacheLineSize = 64;
+
+    std::vector<T> slots;
+    const size_t mask;
+    alignas(cacheLineSize) std::atomic<size_t> head{0};
+    size_t cachedTail = 0;
+    alignas(cacheLineSize) std::atomic<size_t> tail{0};
+    size_t cachedHead = 0;
+};
+
+//////////////////////////////////////////////////////////////////////////
+/// Runs the commands handed over by a producer, in the order they were
+/// pushed, on a thread of its own, so that the producer doesn't wait for the
+/// driver calls submitting them. Commands are filled in place in the slots of
+/// a spsc_ring, and the producer wakes the thread only when it went to sleep,
+/// after spinning for a while without commands.
+///
+/// Each command gets a sequence number, starting at 1, with which any thread
+/// can tell or wait until it has been run. The handler must not throw, and
+/// must release whatever the command holds, while keeping the capacity of its
+/// members for later commands.
+template <typename T> class submission_thread {
+  public:
+    using handler_t = std::function<void(T &)>;
+
+    /// How long the thread spins for commands before going to sleep
+    static constexpr std::chrono::microseconds defaultSpinTime{100};
+
+    submission_thread(size_t capacity, handler_t handler,
+                      std::chrono::microseconds spinTime = defaultSpinTime)
+        : state(std::make_shared<shared_state>(capacity, std::move(handler),
+                                               spinTime)) {
+        thread = std::thread([state = state] { state->run(); });
+    }
+
+    submission_thread(const submission_thread &) = delete;
+    submission_thread &operator=(const submission_thread &) = delete;
+
+    /// Runs the commands pushed already, unless it's called from the thread
+    /// itself, by the last command releasing the owner. The thread then exits
+    /// once that command returned.
+    ~submission_thread() {
+        bool onSelf = onThread();
+        if (!onSelf) {
+            drain();
+        }
+        {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->stop = true;
+        }
+        state->cv.notify_one();
+        if (onSelf) {
+            thread.detach();
+        } else {
+            thread.join();
+        }
+    }
+
+    /// Fills the next slot with fill(T &) and hands it to the thread, waiting
+    /// for a slot while the ring is full. Returns the sequence number of the
+    /// command. Pushes must not be concurrent.
+    template <typename F> uint64_t push(F &&fill) {
+        T *slot;
+        while (!(slot = state->ring.beginPush())) {
+            std::this_thread::yield();
+        }
+        fill(*slot);
+        state->ring.endPush();
+        uint64_t seq = state->pushed.load(std::memory_order_relaxed) + 1;
+        state->pushed.store(seq, std::memory_order_release);
+        // Pairs with the fence of the thread going to sleep: either it sees
+        // the command, or this sees that it sleeps
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (state->sleeping.load(std::memory_order_relaxed)) {
+            std::lock_guard<std::mutex> lock(state->mutex);
+            state->cv.notify_one();
+        }
+        return seq;
+    }
+
+    /// Whether the command with sequence number seq has been run
+    bool isSubmitted(uint64_t seq) const noexcept {
+        return state->processed.load(std::memory_order_acquire) >= seq;
+    }
+
+    /// Waits until the command with sequence number seq has been run. What
+    /// the command wrote is then visible to the caller.
+    void waitSubmitted(uint64_t seq) const noexcept {
+        while (!isSubmitted(seq)) {
+            std::this_thread::yield();
+        }
+    }
+
+    /// Waits until all the commands pushed so far have been run
+    void drain() const noexcept {
+        waitSubmitted(state->pushed.load(std::memory_order_acquire));
+    }
+
+    /// Whether the caller is the submission thread, which must not wait for
+    /// the commands after the one it runs
+    bool onThread() const noexcept {
+        return std::this_thread::get_id() == thread.get_id();
+    }
+
+  private:
+    // Shared with the thread, which may outlive the owner, see the destructor
+    struct shared_state {
+        shared_state(size_t capacity, handler_t handler,
+                     std::chrono::microseconds spinTime)
+            : ring(capacity), handler(std::move(handler)), spinTime(spinTime) {}
+
+        void run() {
+            auto idleSince = std::chrono::steady_clock::now();
+            while (true) {
+                if (T *command = ring.front()) {
+                    handler(*command);
+                    ring.pop();
+                    processed.fetch_add(1, std::memory_order_release);
+                    if (stop.load(std::memory_order_relaxed) && !ring.front()) {
+                        return;
+                    }
+                    idleSince = std::chrono::steady_clock::now();
+                    continue;
+                }
+                if (stop.load(std::memory_order_relaxed)) {
+                    return;
+                }
+                if (std::chrono::steady_clock::now() - idleSince < spinTime) {
+                    std::this_thread::yield();
+                    continue;
+                }
+
+                std::unique_lock<std::mutex> lock(mutex);
+                sleeping.store(true, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+                cv.wait(lock, [this] {
+                    return stop.load(std::memory_order_relaxed) ||
+                           ring.front() != nullptr;
+                });
+                sleeping.store(false, std::memory_order_relaxed);
+                if (stop.load(std::memory_order_relaxed) && !ring.front()) {
+                    return;
+                }
+                idleSince = std::chrono::steady_clock::now();
+            }
+        }
+
+        spsc_ring<T> ring;
+        handler_t handler;
+        const std::chrono::microseconds spinTime;
+        std::atomic<uint64_t> pushed{0};
+        std::atomic<uint64_t> processed{0};
+        std::atomic<bool> sleeping{false};
+        std::atomic<bool> stop{false};
+        std::mutex mutex;
+        std::condition_variable cv;
+    };
+
+    std::shared_ptr<shared_state> state;
+    std::thread thread;
+};
+
+} // namespace ur
+
+#endif /* UR_SUBMISSION_THREAD_HPP */
@@ -0,0 +1,163 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+
+#ifndef UR_SYNC_POINT_GRAPH_HPP
+#define UR_SYNC_POINT_GRAPH_HPP 1
+
+#include <ur_api.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+namespace ur {
+
+//////////////////////////////////////////////////////////////////////////
+/// Dependencies between the sync points of a command-buffer, used to drop the
+/// sync points of a wait list which another of them already depends on,
+/// directly or not. Frameworks tend to pass every command a command depends
+/// on, or every command so far, when waiting on the last ones would do, and
+/// each dependency left is an event wait or a graph edge in the adapter.
+///
+/// Sync points are expected to be numbered in the order the commands are
+/// appended, from 0, as the adapters do, so that a command only depends on
+/// lower sync points. Reducing the wait list of each command as it is
+/// appended then gives the transitive reduction of the whole graph.
+class sync_point_graph {
+  public:
+    using sync_point_t = ur_exp_command_buffer_sync_point_t;
+
+    /// Writes to reduced the sync points of the wait list that no other one
+    /// depends on, in their original order and without duplicates, and keeps
+    /// them as the dependencies of the next sync point added. Sync points
+    /// not added yet are left in, for the caller to reject.
+    void reduce(const sync_point_t *waitList, size_t numWaitList,
+                std::vector<sync_point_t> &reduced) {
+        reduced.clear();
+        if (numWaitList > 0 && waitList) {
+            if (numWaitList == 1) {
+                reduced.push_back(waitList[0]);
+            } else {
+                reduceMany(waitList, numWaitList, reduced);
+            }
+        }
+        pending = reduced;
+        hasPending = true;
+    }
+
+    /// Records syncPoint with the dependencies of the last wait list reduced,
+    /// or none if there wasn't one since the last sync point added
+    void add(sync_point_t syncPoint) {
+        if (syncPoint >= deps.size()) {
+            deps.resize(syncPoint + 1);
+            visited.resize(syncPoint + 1, 0);
+        }
+        if (hasPending) {
+            deps[syncPoint] = std::move(pending);
+        } else {
+            deps[syncPoint].clear();
+        }
+        pending.clear();
+        hasPending = false;
+    }
+
+  private:
+    // Bounds the sync points walked per wait list, past which the dependencies
+    // not found redundant yet are kept, so that long chains of commands don't
+    // make appending quadratic
+    static constexpr size_t maxVisits = 4096;
+
+    bool isKnown(sync_point_t syncPoint) const {
+        return syncPoint < deps.size();
+    }
+
+    void nextEpoch() {
+        if (++epoch == 0) {
+            std::fill(visited.begin(), visited.end(), 0);
+            epoch = 1;
+        }
+    }
+
+    void reduceMany(const sync_point_t *waitList, size_t numWaitList,
+                    std::vector<sync_point_t> &reduced) {
+        std::vector<sync_point_t> candidates;
+        for (size_t i = 0; i < numWaitList; i++) {
+            if (isKnown(waitList[i])) {
+                candidates.push_back(waitList[i]);
+            }
+        }
+        // Ancestors have lower sync points, so walking from the highest
+        // candidate down finds those the others depend on before they are
+        // walked from
+        std::sort(candidates.begin(), candidates.end(),
+                  std::greater<sync_point_t>());
+        sync_point_t lowest = candidates.empty() ? 0 : candidates.back();
+
+        nextEpoch();
+        std::vector<sync_point_t> kept;
+        std::vector<sync_point_t> stack;
+        size_t visits = 0;
+        for (auto candidate : candidates) {
+            if (visited[candidate] == epoch) {
+                continue;
+            }
+            kept.push_back(candidate);
+            visited[candidate] = epoch;
+            if (visits >= maxVisits) {
+                continue;
+            }
+            stack.assign(deps[candidate].begin(), deps[candidate].end());
+            while (!stack.empty() && visits < maxVisits) {
+                auto syncPoint = stack.back();
+                stack.pop_back();
+                // Nothing below the lowest candidate leads to one
+                if (syncPoint < lowest || !isKnown(syncPoint) ||
+                    visited[syncPoint] == epoch) {
+                    continue;
+                }
+                visited[syncPoint] = epoch;
+                visits++;
+                stack.insert(stack.end(), deps[syncPoint].begin(),
+                             deps[syncPoint].end());
+            }
+        }
+
+        // Back to the order of the wait list, marking each one written
+        nextEpoch();
+        for (size_t i = 0; i < numWaitList; i++) {
+            auto syncPoint = waitList[i];
+            if (!isKnown(syncPoint)) {
+                reduced.push_back(syncPoint);
+                continue;
+            }
+            if (visited[syncPoint] == epoch ||
+                !std::binary_search(kept.begin(), kept.end(), syncPoint,
+                                    std::greater<sync_point_t>())) {
+                continue;
+            }
+            visited[syncPoint] = epoch;
+            reduced.push_back(syncPoint);
+        }
+    }
+
+    // Dependencies of each sync point, reduced, by sync point
+    std::vector<std::vector<sync_point_t>> deps;
+    // The epoch of the last reduction which visited each sync point
+    std::vector<uint32_t> visited;
+    uint32_t epoch = 0;
+
+    std::vector<sync_point_t> pending;
+    bool hasPending = false;
+};
+
+} // namespace ur
+
+#endif // UR_SYNC_POINT_GRAPH_HPP
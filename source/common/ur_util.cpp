@@ -24,8 +24,21 @@ int ur_duplicate_fd(int pid, int fd_in) {
     return -1;
 }
 
+int ur_pci_numa_node(const char *pci_address) {
+    (void)pci_address; // unused
+    return -1;
+}
+
+ur_numa_bind_scope::ur_numa_bind_scope(int numa_node) {
+    (void)numa_node; // unused
+}
+
+ur_numa_bind_scope::~ur_numa_bind_scope() {}
+
 #else
 
+#include <cctype>
+#include <fstream>
 #include <sys/syscall.h>
 #include <unistd.h>
 int ur_getpid(void) { return static_cast<int>(getpid()); }
@@ -65,6 +78,56 @@ int ur_duplicate_fd(int pid, int fd_in) {
 #endif /* defined(__NR_pidfd_open) && defined(__NR_pidfd_getfd) */
 }
 
+int ur_pci_numa_node(const char *pci_address) {
+    // The kernel names the devices in lower case, CUDA in upper case
+    std::string path = "/sys/bus/pci/devices/";
+    for (const char *c = pci_address; *c; c++) {
+        path += static_cast<char>(tolower(*c));
+    }
+    path += "/numa_node";
+    std::ifstream file(path);
+    int node = -1;
+    if (!(file >> node)) {
+        return -1;
+    }
+    return node;
+}
+
+// The modes of set_mempolicy(2), whose header is libnuma's
+static constexpr int mpol_default = 0;
+static constexpr int mpol_preferred = 1;
+
+ur_numa_bind_scope::ur_numa_bind_scope(int numa_node) {
+#if defined(__NR_get_mempolicy) && defined(__NR_set_mempolicy)
+    if (numa_node < 0 || static_cast<size_t>(numa_node) >= max_nodes) {
+        return;
+    }
+    if (syscall(__NR_get_mempolicy, &saved_mode, saved_mask, max_nodes,
+                nullptr, 0) != 0) {
+        return;
+    }
+    // Preferred rather than bound, so that allocations go to other nodes
+    // rather than fail once the node is full
+    unsigned long mask[max_nodes / mask_bits] = {};
+    mask[numa_node / mask_bits] = 1ul << (numa_node % mask_bits);
+    // The kernel reads one bit less than maxnode
+    bound = syscall(__NR_set_mempolicy, mpol_preferred, mask,
+                    max_nodes + 1) == 0;
+#else
+    (void)numa_node; // unused
+#endif
+}
+
+ur_numa_bind_scope::~ur_numa_bind_scope() {
+#if defined(__NR_get_mempolicy) && defined(__NR_set_mempolicy)
+    if (bound) {
+        syscall(__NR_set_mempolicy, saved_mode,
+                saved_mode == mpol_default ? nullptr : saved_mask,
+                max_nodes + 1);
+    }
+#endif
+}
+
 #endif /* _WIN32 */
 
 std::optional<std::string> ur_getenv(const char *name) {
@@ -30,6 +30,31 @@ int ur_getpid(void);
 int ur_close_fd(int fd);
 int ur_duplicate_fd(int pid, int fd_in);
 
+// NUMA node of the host closest to the PCI device at pci_address, which is in
+// the "dddd:bb:dd.f" form of UR_DEVICE_INFO_PCI_ADDRESS, or -1 if unknown.
+int ur_pci_numa_node(const char *pci_address);
+
+// Makes the pages allocated for the calling thread come from numa_node first
+// while alive, such as those a driver pins for a host allocation, and restores
+// the previous memory policy of the thread when destroyed. Does nothing for a
+// negative node, or where memory policies aren't supported.
+class ur_numa_bind_scope {
+  public:
+    explicit ur_numa_bind_scope(int numa_node);
+    ~ur_numa_bind_scope();
+
+    ur_numa_bind_scope(const ur_numa_bind_scope &) = delete;
+    ur_numa_bind_scope &operator=(const ur_numa_bind_scope &) = delete;
+
+  private:
+    static constexpr size_t max_nodes = 1024;
+    static constexpr size_t mask_bits = 8 * sizeof(unsigned long);
+
+    bool bound = false;
+    int saved_mode = 0;
+    unsigned long saved_mask[max_nodes / mask_bits] = {};
+};
+
 /* for compatibility with non-clang compilers */
 #if defined(__has_feature)
 #define CLANG_HAS_FEATURE(x) __has_feature(x)
@@ -108,9 +133,14 @@ inline bool getenv_tobool(const char *name, bool def = false) {
     return def;
 }
 
+/// The value of the environment variable, if it's set to an unsigned number
 inline std::optional<uint64_t> getenv_to_unsigned(const char *name) try {
     auto env = ur_getenv(name);
-    return env ? std::optional(std::stoi(*env)) : std::nullopt;
+    // std::stoull takes negative numbers, wrapped around
+    if (!env || env->find('-') != std::string::npos) {
+        return std::nullopt;
+    }
+    return std::optional<uint64_t>(std::stoull(*env));
 } catch (...) {
     return std::nullopt;
 }
@@ -0,0 +1,250 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_allocation_index.cpp
+ *
+ */
+
+#include "asan_allocation_index.hpp"
+
+#include <algorithm>
+
+namespace ur_sanitizer_layer {
+
+namespace {
+
+// Epoch-based reclamation. A lookup publishes the global epoch it started in
+// through its thread's slot, and clears it when done. A bucket retired at
+// epoch E may only be freed once every published epoch is above E.
+std::atomic<uint64_t> GlobalEpoch{1};
+
+struct alignas(64) ReaderSlot {
+    std::atomic<uint64_t> Epoch{0}; // 0: not in a lookup
+    std::atomic<bool> InUse{false};
+    ReaderSlot *Next = nullptr;
+};
+
+// Slots are never freed, only handed to a new thread once their owner exits.
+std::atomic<ReaderSlot *> ReaderSlots{nullptr};
+
+ReaderSlot *acquireReaderSlot() {
+    for (auto *S = ReaderSlots.load(std::memory_order_acquire); S;
+         S = S->Next) {
+        bool Expected = false;
+        if (!S->InUse.load(std::memory_order_relaxed) &&
+            S->InUse.compare_exchange_strong(Expected, true)) {
+            return S;
+        }
+    }
+    auto *S = new ReaderSlot();
+    S->InUse.store(true, std::memory_order_relaxed);
+    S->Next = ReaderSlots.load(std::memory_order_relaxed);
+    while (!ReaderSlots.compare_exchange_weak(S->Next, S)) {
+    }
+    return S;
+}
+
+struct ReaderSlotHolder {
+    ReaderSlot *Slot = acquireReaderSlot();
+    ~ReaderSlotHolder() { Slot->InUse.store(false); }
+};
+
+ReaderSlot *getReaderSlot() {
+    thread_local ReaderSlotHolder Holder;
+    return Holder.Slot;
+}
+
+struct EpochGuard {
+    ReaderSlot *Slot;
+    EpochGuard() : Slot(getReaderSlot()) {
+        Slot->Epoch.store(GlobalEpoch.load(std::memory_order_relaxed));
+    }
+    ~EpochGuard() { Slot->Epoch.store(0, std::memory_order_release); }
+};
+
+uint64_t minActiveEpoch() {
+    uint64_t Min = UINT64_MAX;
+    for (auto *S = ReaderSlots.load(); S; S = S->Next) {
+        auto Epoch = S->Epoch.load();
+        if (Epoch != 0) {
+            Min = std::min(Min, Epoch);
+        }
+    }
+    return Min;
+}
+
+bool beginLess(const std::shared_ptr<AllocInfo> &AI, uptr Address) {
+    return AI->AllocBegin < Address;
+}
+
+} // namespace
+
+AllocationIndex::AllocationIndex() : Root(new Node()) {}
+
+AllocationIndex::~AllocationIndex() {
+    freeNode(Root, 0);
+    for (auto &R : RetiredList) {
+        delete R.Ptr;
+    }
+}
+
+void AllocationIndex::freeNode(Node *N, unsigned Level) {
+    for (auto &Slot : N->Slots) {
+        void *Child = Slot.load(std::memory_order_relaxed);
+        if (!Child) {
+            continue;
+        }
+        if (Level + 1 == Levels) {
+            delete static_cast<Bucket *>(Child);
+        } else {
+            freeNode(static_cast<Node *>(Child), Level + 1);
+        }
+    }
+    delete N;
+}
+
+std::atomic<void *> *AllocationIndex::getLeafSlot(uptr Granule, bool Create) {
+    Node *N = Root;
+    for (unsigned Level = 0;; ++Level) {
+        unsigned Shift = LevelBits * (Levels - 1 - Level);
+        auto &Slot = N->Slots[(Granule >> Shift) & (NodeSize - 1)];
+        if (Level + 1 == Levels) {
+            return &Slot;
+        }
+        void *Child = Slot.load(std::memory_order_acquire);
+        if (!Child) {
+            if (!Create) {
+                return nullptr;
+            }
+            // Only writers, serialized by WriterMutex, create nodes.
+            Child = new Node();
+            Slot.store(Child, std::memory_order_release);
+        }
+        N = static_cast<Node *>(Child);
+    }
+}
+
+void AllocationIndex::update(const std::shared_ptr<AllocInfo> &AI,
+                             bool Insert) {
+    std::scoped_lock<std::mutex> Guard(WriterMutex);
+
+    uptr First = AI->AllocBegin >> GranuleShift;
+    uptr Last = (AI->AllocBegin + AI->AllocSize - 1) >> GranuleShift;
+    for (uptr Granule = First; Granule <= Last; ++Granule) {
+        auto *Slot = getLeafSlot(Granule, Insert);
+        if (!Slot) {
+            continue;
+        }
+        auto *Old =
+            static_cast<Bucket *>(Slot->load(std::memory_order_relaxed));
+        auto *New = new Bucket();
+        if (Old) {
+            New->Allocs.reserve(Old->Allocs.size() + Insert);
+            for (auto &Entry : Old->Allocs) {
+                if (Entry != AI) {
+                    New->Allocs.push_back(Entry);
+                }
+            }
+        }
+        if (Insert) {
+            auto Pos = std::lower_bound(New->Allocs.begin(), New->Allocs.end(),
+                                        AI->AllocBegin, beginLess);
+            New->Allocs.insert(Pos, AI);
+        }
+        if (New->Allocs.empty()) {
+            delete New;
+            New = nullptr;
+        }
+        Slot->store(New);
+        if (Old) {
+            retire(Old);
+        }
+    }
+    reclaim();
+}
+
+void AllocationIndex::insert(const std::shared_ptr<AllocInfo> &AI) {
+    update(AI, true);
+}
+
+void AllocationIndex::erase(const std::shared_ptr<AllocInfo> &AI) {
+    update(AI, false);
+}
+
+void AllocationIndex::clear() {
+    std::scoped_lock<std::mutex> Guard(WriterMutex);
+
+    // Walk the tree and drop every bucket, keeping the inner nodes.
+    std::vector<std::pair<Node *, unsigned>> Stack{{Root, 0}};
+    while (!Stack.empty()) {
+        auto [N, Level] = Stack.back();
+        Stack.pop_back();
+        for (auto &Slot : N->Slots) {
+            void *Child = Slot.load(std::memory_order_relaxed);
+            if (!Child) {
+                continue;
+            }
+            if (Level + 1 == Levels) {
+                Slot.store(nullptr);
+                retire(static_cast<Bucket *>(Child));
+            } else {
+                Stack.emplace_back(static_cast<Node *>(Child), Level + 1);
+            }
+        }
+    }
+    reclaim();
+}
+
+void AllocationIndex::retire(Bucket *Old) {
+    // Lookups that start after this point can't see Old any more.
+    RetiredList.push_back({Old, GlobalEpoch.fetch_add(1)});
+}
+
+void AllocationIndex::reclaim() {
+    auto MinEpoch = minActiveEpoch();
+    auto Keep = std::partition(
+        RetiredList.begin(), RetiredList.end(),
+        [MinEpoch](const Retired &R) { return R.Epoch >= MinEpoch; });
+    for (auto It = Keep; It != RetiredList.end(); ++It) {
+        delete It->Ptr;
+    }
+    RetiredList.erase(Keep, RetiredList.end());
+}
+
+std::shared_ptr<AllocInfo> AllocationIndex::find(uptr Address) const {
+    EpochGuard Guard;
+
+    auto *Slot = const_cast<AllocationIndex *>(this)->getLeafSlot(
+        Address >> GranuleShift, /*Create*/ false);
+    if (!Slot) {
+        return nullptr;
+    }
+    // Pairs with the seq_cst epoch store in EpochGuard, see retire()
+    const auto *B = static_cast<const Bucket *>(Slot->load());
+    if (!B) {
+        return nullptr;
+    }
+
+    // Last allocation starting at or before Address
+    auto It = std::upper_bound(
+        B->Allocs.begin(), B->Allocs.end(), Address,
+        [](uptr Addr, const std::shared_ptr<AllocInfo> &AI) {
+            return Addr < AI->AllocBegin;
+        });
+    if (It == B->Allocs.begin()) {
+        return nullptr;
+    }
+    --It;
+    const auto &AI = *It;
+    if (Address - AI->AllocBegin >= AI->AllocSize) {
+        return nullptr;
+    }
+    return AI;
+}
+
+} // namespace ur_sanitizer_layer
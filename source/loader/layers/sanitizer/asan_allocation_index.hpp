@@ -0,0 +1,83 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file asan_allocation_index.hpp
+ *
+ */
+
+#pragma once
+
+#include "asan_allocator.hpp"
+#include "common.hpp"
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ur_sanitizer_layer {
+
+/// Maps addresses to the allocation containing them.
+///
+/// The address space is split into 64KiB granules, which are looked up in a
+/// four-level radix tree, like a page table. Each granule points to an
+/// immutable, sorted bucket of the allocations overlapping it. Writers build
+/// a new bucket and swap the pointer, so lookups never take a lock and are
+/// never blocked by a concurrent insert or erase. Replaced buckets are freed
+/// once no lookup that may still see them is in progress (epoch-based
+/// reclamation).
+class AllocationIndex {
+  public:
+    AllocationIndex();
+    ~AllocationIndex();
+
+    AllocationIndex(const AllocationIndex &) = delete;
+    AllocationIndex &operator=(const AllocationIndex &) = delete;
+
+    void insert(const std::shared_ptr<AllocInfo> &AI);
+    void erase(const std::shared_ptr<AllocInfo> &AI);
+    void clear();
+
+    /// Returns the allocation whose [AllocBegin, AllocBegin + AllocSize)
+    /// range contains Address, or nullptr.
+    std::shared_ptr<AllocInfo> find(uptr Address) const;
+
+  private:
+    static constexpr unsigned GranuleShift = 16;
+    static constexpr unsigned LevelBits = 12;
+    static constexpr unsigned Levels = 4;
+    static constexpr size_t NodeSize = size_t(1) << LevelBits;
+    static_assert(GranuleShift + LevelBits * Levels == 64);
+
+    struct Bucket {
+        // Sorted by AllocBegin
+        std::vector<std::shared_ptr<AllocInfo>> Allocs;
+    };
+
+    // Inner nodes hold Node pointers, leaves hold Bucket pointers.
+    struct Node {
+        std::atomic<void *> Slots[NodeSize] = {};
+    };
+
+    struct Retired {
+        Bucket *Ptr;
+        uint64_t Epoch;
+    };
+
+    std::atomic<void *> *getLeafSlot(uptr Granule, bool Create);
+    void update(const std::shared_ptr<AllocInfo> &AI, bool Insert);
+    void retire(Bucket *Old);
+    void reclaim();
+    void freeNode(Node *N, unsigned Level);
+
+    Node *Root;
+    std::mutex WriterMutex;
+    std::vector<Retired> RetiredList;
+};
+
+} // namespace ur_sanitizer_layer
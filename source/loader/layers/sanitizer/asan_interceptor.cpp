@@ -26,11 +26,20 @@ SanitizerInterceptor::SanitizerInterceptor() {
     if (getOptions().MaxQuarantineSizeMB) {
         m_Quarantine = std::make_unique<Quarantine>(
             static_cast<uint64_t>(getOptions().MaxQuarantineSizeMB) * 1024 *
-            1024);
+                1024,
+            [this](std::vector<AllocationIterator> &ReleaseList) {
+                auto Result = releaseQuarantined(ReleaseList);
+                if (Result != UR_RESULT_SUCCESS) {
+                    getContext()->logger.error(
+                        "Failed to release quarantined memory: {}", Result);
+                }
+            });
     }
 }
 
 SanitizerInterceptor::~SanitizerInterceptor() {
+    checkDeferredReports(nullptr, true);
+
     // We must release these objects before releasing adapters, since
     // they may use the adapter in their destructor
     for (const auto &[_, DeviceInfo] : m_DeviceMap) {
@@ -39,6 +48,7 @@ SanitizerInterceptor::~SanitizerInterceptor() {
 
     m_Quarantine = nullptr;
     m_MemBufferMap.clear();
+    m_AllocationIndex.clear();
     m_AllocationMap.clear();
     m_KernelMap.clear();
     m_ContextMap.clear();
@@ -63,6 +73,7 @@ ur_result_t SanitizerInterceptor::allocateMemory(
     auto ContextInfo = getContextInfo(Context);
     std::shared_ptr<DeviceInfo> DeviceInfo =
         Device ? getDeviceInfo(Device) : nullptr;
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats, AsanPhase::Alloc);
 
     /// Modified from llvm/compiler-rt/lib/asan/asan_allocator.cpp
     uint32_t Alignment = Properties ? Properties->align : 0;
@@ -134,6 +145,15 @@ ur_result_t SanitizerInterceptor::allocateMemory(
 
     AI->print();
 
+    // Released in releaseMemory, once the allocation leaves the quarantine
+    if (Device) { // Device/Shared USM
+        UR_CALL(getDeviceInfo(Device)->Shadow->RetainShadow(AI));
+    } else { // Host USM
+        for (auto &HostDevice : ContextInfo->DeviceList) {
+            UR_CALL(getDeviceInfo(HostDevice)->Shadow->RetainShadow(AI));
+        }
+    }
+
     // For updating shadow memory
     if (Device) { // Device/Shared USM
         ContextInfo->insertAllocInfo({Device}, AI);
@@ -144,6 +164,7 @@ ur_result_t SanitizerInterceptor::allocateMemory(
     // For memory release
     {
         std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
+        m_AllocationIndex.insert(AI);
         m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
     }
 
@@ -153,20 +174,17 @@ ur_result_t SanitizerInterceptor::allocateMemory(
 ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
                                                 void *Ptr) {
     auto ContextInfo = getContextInfo(Context);
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats, AsanPhase::Free);
 
     auto Addr = reinterpret_cast<uptr>(Ptr);
-    auto AllocInfoItOp = findAllocInfoByAddress(Addr);
+    auto AllocInfo = findAllocInfoByAddress(Addr);
 
-    if (!AllocInfoItOp) {
+    if (!AllocInfo) {
         // "Addr" might be a host pointer
         ReportBadFree(Addr, GetCurrentBacktrace(), nullptr);
         return UR_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    auto AllocInfoIt = *AllocInfoItOp;
-    // NOTE: AllocInfoIt will be erased later, so "AllocInfo" must be a new reference here
-    auto AllocInfo = AllocInfoIt->second;
-
     if (AllocInfo->Context != Context) {
         if (AllocInfo->UserBegin == Addr) {
             ReportBadContext(Addr, GetCurrentBacktrace(), AllocInfo);
@@ -190,6 +208,13 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
     AllocInfo->IsReleased = true;
     AllocInfo->ReleaseStack = GetCurrentBacktrace();
 
+    AllocationIterator AllocInfoIt;
+    {
+        std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
+        AllocInfoIt = m_AllocationMap.find(AllocInfo->AllocBegin);
+        assert(AllocInfoIt != m_AllocationMap.end());
+    }
+
     if (AllocInfo->Type == AllocType::HOST_USM) {
         ContextInfo->insertAllocInfo(ContextInfo->DeviceList, AllocInfo);
     } else {
@@ -204,41 +229,59 @@ ur_result_t SanitizerInterceptor::releaseMemory(ur_context_handle_t Context,
                                               AllocInfo->getRedzoneSize());
 
         std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
+        m_AllocationIndex.erase(AllocInfo);
         m_AllocationMap.erase(AllocInfoIt);
 
         return getContext()->urDdiTable.USM.pfnFree(
             Context, (void *)(AllocInfo->AllocBegin));
     }
 
-    // If quarantine is enabled, cache it
-    auto ReleaseList = m_Quarantine->put(AllocInfo->Device, AllocInfoIt);
-    if (ReleaseList.size()) {
-        std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-        for (auto &It : ReleaseList) {
-            getContext()->logger.info("Quarantine Free: {}",
-                                      (void *)It->second->AllocBegin);
-
-            ContextInfo->Stats.UpdateUSMRealFreed(AllocInfo->AllocSize,
-                                                  AllocInfo->getRedzoneSize());
-
-            m_AllocationMap.erase(It);
-            if (AllocInfo->Type == AllocType::HOST_USM) {
-                for (auto &Device : ContextInfo->DeviceList) {
-                    UR_CALL(getDeviceInfo(Device)->Shadow->ReleaseShadow(
-                        AllocInfo));
-                }
-            } else {
-                UR_CALL(getDeviceInfo(AllocInfo->Device)
-                            ->Shadow->ReleaseShadow(AllocInfo));
-            }
+    // If quarantine is enabled, cache it. Evicted allocations are released
+    // on the quarantine's thread, see releaseQuarantined.
+    m_Quarantine->put(AllocInfo->Device, AllocInfoIt);
+    ContextInfo->Stats.UpdateUSMFreed(AllocInfo->AllocSize);
 
-            UR_CALL(getContext()->urDdiTable.USM.pfnFree(
-                Context, (void *)(It->second->AllocBegin)));
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t SanitizerInterceptor::releaseQuarantined(
+    std::vector<AllocationIterator> &ReleaseList) {
+    // The allocations are out of the quarantine already, so all of them are
+    // freed even if some fail, the first failure being returned
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    auto Check = [&Result](ur_result_t Ret) {
+        if (Result == UR_RESULT_SUCCESS) {
+            Result = Ret;
+        }
+    };
+
+    std::scoped_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
+    for (auto &It : ReleaseList) {
+        auto AI = It->second;
+        getContext()->logger.info("Quarantine Free: {}",
+                                  (void *)AI->AllocBegin);
+
+        auto ContextInfo = getContextInfo(AI->Context);
+        AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                           AsanPhase::Quarantine);
+        ContextInfo->Stats.UpdateUSMRealFreed(AI->AllocSize,
+                                              AI->getRedzoneSize());
+
+        m_AllocationIndex.erase(AI);
+        m_AllocationMap.erase(It);
+        if (AI->Type == AllocType::HOST_USM) {
+            for (auto &Device : ContextInfo->DeviceList) {
+                Check(getDeviceInfo(Device)->Shadow->ReleaseShadow(AI));
+            }
+        } else {
+            Check(getDeviceInfo(AI->Device)->Shadow->ReleaseShadow(AI));
         }
+
+        Check(getContext()->urDdiTable.USM.pfnFree(
+            AI->Context, (void *)(AI->AllocBegin)));
     }
-    ContextInfo->Stats.UpdateUSMFreed(AllocInfo->AllocSize);
 
-    return UR_RESULT_SUCCESS;
+    return Result;
 }
 
 ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
@@ -249,8 +292,11 @@ ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
     auto ContextInfo = getContextInfo(Context);
     auto DeviceInfo = getDeviceInfo(Device);
     auto KernelInfo = getKernelInfo(Kernel);
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                       AsanPhase::PreLaunch, Kernel);
 
     UR_CALL(LaunchInfo.updateKernelInfo(*KernelInfo.get()));
+    LaunchInfo.Queue = Queue;
 
     ManagedQueue InternalQueue(Context, Device);
     if (!InternalQueue) {
@@ -261,43 +307,236 @@ ur_result_t SanitizerInterceptor::preLaunchKernel(ur_kernel_handle_t Kernel,
     UR_CALL(prepareLaunch(ContextInfo, DeviceInfo, InternalQueue, Kernel,
                           LaunchInfo));
 
-    UR_CALL(updateShadowMemory(ContextInfo, DeviceInfo, InternalQueue));
+    UR_CALL(
+        updateShadowMemory(ContextInfo, DeviceInfo, InternalQueue, Kernel));
 
     return UR_RESULT_SUCCESS;
 }
 
-ur_result_t SanitizerInterceptor::postLaunchKernel(ur_kernel_handle_t Kernel,
-                                                   ur_queue_handle_t Queue,
-                                                   USMLaunchInfo &LaunchInfo) {
-    // FIXME: We must use block operation here, until we support urEventSetCallback
-    auto Result = getContext()->urDdiTable.Queue.pfnFinish(Queue);
+ur_result_t
+SanitizerInterceptor::preLaunchUninstrumentedKernel(ur_kernel_handle_t Kernel,
+                                                    ur_queue_handle_t Queue) {
+    // Shadow updates stay pending until the next instrumented launch
+    auto KernelInfo = getKernelInfo(Kernel);
+    return setBufferArgs(Kernel, *KernelInfo, GetDevice(Queue));
+}
 
-    if (Result == UR_RESULT_SUCCESS) {
-        for (const auto &AH : LaunchInfo.Data->SanitizerReport) {
-            if (!AH.Flag) {
+ur_result_t SanitizerInterceptor::postLaunchKernel(
+    ur_kernel_handle_t Kernel, ur_queue_handle_t Queue, ur_event_handle_t Event,
+    std::shared_ptr<USMLaunchInfo> &LaunchInfo) {
+    auto ContextInfo = getContextInfo(LaunchInfo->Context);
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                       AsanPhase::PostLaunch, Kernel);
+
+    if (!getOptions().DeferredReport) {
+        // Wait for the kernel, so errors are reported at the launch
+        ur_result_t Result;
+        {
+            AsanStatsWrapper::PhaseTimer WaitTimer(
+                ContextInfo->Stats, AsanPhase::KernelWait, Kernel);
+            Result = getContext()->urDdiTable.Queue.pfnFinish(Queue);
+        }
+        if (Result == UR_RESULT_SUCCESS) {
+            reportErrors(Kernel, *LaunchInfo);
+        }
+        return Result;
+    }
+
+    // The report lives in shared USM, so it can be read whenever the launch
+    // is done: at the next launch on this queue, or at a sync point.
+    UR_CALL(checkDeferredReports(Queue, false));
+
+    UR_CALL(getContext()->urDdiTable.Kernel.pfnRetain(Kernel));
+    UR_CALL(getContext()->urDdiTable.Event.pfnRetain(Event));
+    std::scoped_lock<ur_mutex> Guard(m_DeferredReportsMutex);
+    m_DeferredReports[Queue].push_back({Kernel, Event, LaunchInfo});
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t SanitizerInterceptor::checkDeferredReports(ur_queue_handle_t Queue,
+                                                       bool Wait) {
+    auto IsDone = [Wait](const DeferredReport &Report) {
+        if (Wait) {
+            return true;
+        }
+        ur_event_status_t Status{};
+        auto Result = getContext()->urDdiTable.Event.pfnGetInfo(
+            Report.Event, UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+            sizeof(Status), &Status, nullptr);
+        return Result == UR_RESULT_SUCCESS && Status == UR_EVENT_STATUS_COMPLETE;
+    };
+
+    std::vector<DeferredReport> Ready;
+    {
+        std::scoped_lock<ur_mutex> Guard(m_DeferredReportsMutex);
+        for (auto It = m_DeferredReports.begin();
+             It != m_DeferredReports.end();) {
+            if (Queue && It->first != Queue) {
+                ++It;
                 continue;
             }
-            switch (AH.ErrorType) {
-            case DeviceSanitizerErrorType::USE_AFTER_FREE:
-                ReportUseAfterFree(AH, Kernel, GetContext(Queue));
-                break;
-            case DeviceSanitizerErrorType::OUT_OF_BOUNDS:
-            case DeviceSanitizerErrorType::MISALIGNED:
-            case DeviceSanitizerErrorType::NULL_POINTER:
-                ReportGenericError(AH, Kernel);
-                break;
-            default:
-                ReportFatalError(AH);
-            }
-            if (!AH.IsRecover) {
-                exit(1);
+            auto &List = It->second;
+            auto Pending = std::stable_partition(List.begin(), List.end(),
+                                                 IsDone);
+            std::move(List.begin(), Pending, std::back_inserter(Ready));
+            List.erase(List.begin(), Pending);
+            It = List.empty() ? m_DeferredReports.erase(It) : std::next(It);
+        }
+    }
+
+    ur_result_t Result = UR_RESULT_SUCCESS;
+    for (auto &Report : Ready) {
+        if (Wait) {
+            auto URes =
+                getContext()->urDdiTable.Event.pfnWait(1, &Report.Event);
+            if (URes != UR_RESULT_SUCCESS) {
+                Result = URes;
+            } else {
+                reportErrors(Report.Kernel, *Report.LaunchInfo);
             }
+        } else {
+            reportErrors(Report.Kernel, *Report.LaunchInfo);
         }
+        getContext()->urDdiTable.Event.pfnRelease(Report.Event);
+        getContext()->urDdiTable.Kernel.pfnRelease(Report.Kernel);
     }
 
     return Result;
 }
 
+ur_result_t SanitizerInterceptor::acquireShadowScratch(
+    std::shared_ptr<ContextInfo> &ContextInfo, ur_device_handle_t Device,
+    ur_queue_handle_t Queue, ur_queue_handle_t InternalQueue,
+    ShadowScratchKind Kind, size_t Size, uptr &Ptr) {
+    auto Allocate = [&](ShadowScratch &Scratch) -> ur_result_t {
+        void *Allocated = nullptr;
+        UR_CALL(getContext()->urDdiTable.USM.pfnDeviceAlloc(
+            ContextInfo->Handle, Device, nullptr, nullptr, Size, &Allocated));
+        ContextInfo->Stats.UpdateShadowMalloced(Size);
+        Scratch.Begin = (uptr)Allocated;
+        Scratch.Size = Size;
+        return UR_RESULT_SUCCESS;
+    };
+
+    {
+        std::scoped_lock<ur_mutex> Guard(m_ShadowScratchMutex);
+        auto &Buffers = m_ShadowScratch.try_emplace(Queue, ContextInfo->Handle)
+                            .first->second.get(Kind);
+
+        // Take the largest buffer no launch holds, growing it if it's too
+        // small, or a new one if every buffer is held
+        ShadowScratch *Scratch = nullptr;
+        for (auto &Buffer : Buffers) {
+            if (!Buffer.InUse && (!Scratch || Scratch->Size < Buffer.Size)) {
+                Scratch = &Buffer;
+            }
+        }
+        if (!Scratch) {
+            Scratch = &Buffers.emplace_back();
+        }
+        if (Scratch->Size < Size) {
+            if (Scratch->Begin) {
+                ContextInfo->Stats.UpdateShadowFreed(Scratch->Size);
+                UR_CALL(getContext()->urDdiTable.USM.pfnFree(
+                    ContextInfo->Handle, (void *)Scratch->Begin));
+                *Scratch = ShadowScratch{};
+            }
+            if (auto URes = Allocate(*Scratch)) {
+                Buffers.erase(Buffers.begin() + (Scratch - Buffers.data()));
+                return URes;
+            }
+        }
+        Scratch->InUse = true;
+        Ptr = Scratch->Begin;
+    }
+
+    // The previous launch may have left its shadow values
+    auto URes = EnqueueUSMBlockingSet(InternalQueue, (void *)Ptr, 0, Size);
+    if (URes != UR_RESULT_SUCCESS) {
+        releaseShadowScratch(ContextInfo->Handle, Queue, Kind, Ptr, Size);
+        Ptr = 0;
+    }
+    return URes;
+}
+
+void SanitizerInterceptor::releaseShadowScratch(ur_context_handle_t Context,
+                                                ur_queue_handle_t Queue,
+                                                ShadowScratchKind Kind,
+                                                uptr Ptr, size_t Size) {
+    {
+        std::scoped_lock<ur_mutex> Guard(m_ShadowScratchMutex);
+        auto It = m_ShadowScratch.find(Queue);
+        if (It != m_ShadowScratch.end()) {
+            for (auto &Buffer : It->second.get(Kind)) {
+                if (Buffer.Begin == Ptr) {
+                    Buffer.InUse = false;
+                    return;
+                }
+            }
+        }
+    }
+
+    getContextInfo(Context)->Stats.UpdateShadowFreed(Size);
+    [[maybe_unused]] auto Result =
+        getContext()->urDdiTable.USM.pfnFree(Context, (void *)Ptr);
+    assert(Result == UR_RESULT_SUCCESS);
+}
+
+ur_result_t SanitizerInterceptor::eraseShadowScratch(ur_queue_handle_t Queue) {
+    std::scoped_lock<ur_mutex> Guard(m_ShadowScratchMutex);
+    auto It = m_ShadowScratch.find(Queue);
+    if (It == m_ShadowScratch.end()) {
+        return UR_RESULT_SUCCESS;
+    }
+    UR_CALL(freeShadowScratch(It->second));
+    m_ShadowScratch.erase(It);
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t SanitizerInterceptor::freeShadowScratch(QueueShadowScratch &Entry) {
+    auto ContextInfo = getContextInfo(Entry.Context);
+    for (auto Kind : {ShadowScratchKind::Local, ShadowScratchKind::Private}) {
+        for (auto &Buffer : Entry.get(Kind)) {
+            if (Buffer.InUse) {
+                continue;
+            }
+            ContextInfo->Stats.UpdateShadowFreed(Buffer.Size);
+            UR_CALL(getContext()->urDdiTable.USM.pfnFree(
+                Entry.Context, (void *)Buffer.Begin));
+        }
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+void SanitizerInterceptor::reportErrors(ur_kernel_handle_t Kernel,
+                                        USMLaunchInfo &LaunchInfo) {
+    auto ContextInfo = getContextInfo(LaunchInfo.Context);
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                       AsanPhase::ReportReadback, Kernel);
+
+    for (const auto &AH : LaunchInfo.Data->SanitizerReport) {
+        if (!AH.Flag) {
+            continue;
+        }
+        switch (AH.ErrorType) {
+        case DeviceSanitizerErrorType::USE_AFTER_FREE:
+            ReportUseAfterFree(AH, Kernel, LaunchInfo.Context);
+            break;
+        case DeviceSanitizerErrorType::OUT_OF_BOUNDS:
+        case DeviceSanitizerErrorType::MISALIGNED:
+        case DeviceSanitizerErrorType::NULL_POINTER:
+            ReportGenericError(AH, Kernel);
+            break;
+        default:
+            ReportFatalError(AH);
+        }
+        if (!AH.IsRecover) {
+            exit(1);
+        }
+    }
+}
+
 ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
     Shadow = GetShadowMemory(Context, Handle, Type);
     assert(Shadow && "Failed to get shadow memory");
@@ -318,7 +557,13 @@ ur_result_t DeviceInfo::allocShadowMemory(ur_context_handle_t Context) {
 ur_result_t
 SanitizerInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
                                        ur_queue_handle_t Queue,
-                                       std::shared_ptr<AllocInfo> &AI) {
+                                       std::shared_ptr<AllocInfo> &AI,
+                                       std::vector<ShadowRun> &Runs) {
+    // Allocations whose shadow is at most this big get their shadow bytes
+    // built on the host and appended to Runs, instead of being poisoned with
+    // several fills
+    constexpr uptr MaxShadowRunSize = 4096;
+
     if (AI->IsReleased) {
         int ShadowByte;
         switch (AI->Type) {
@@ -343,21 +588,9 @@ SanitizerInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
         return UR_RESULT_SUCCESS;
     }
 
-    // Init zero
-    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(Queue, AI->AllocBegin,
-                                                    AI->AllocSize, 0));
-
     uptr TailBegin = RoundUpTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
     uptr TailEnd = AI->AllocBegin + AI->AllocSize;
 
-    // User tail
-    if (TailBegin != AI->UserEnd) {
-        auto Value =
-            AI->UserEnd - RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
-        UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(
-            Queue, AI->UserEnd, 1, static_cast<u8>(Value)));
-    }
-
     int ShadowByte;
     switch (AI->Type) {
     case AllocType::HOST_USM:
@@ -380,28 +613,131 @@ SanitizerInterceptor::enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
         assert(false && "Unknow AllocInfo Type");
     }
 
-    // Left red zone
-    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(
-        Queue, AI->AllocBegin, AI->UserBegin - AI->AllocBegin, ShadowByte));
+    auto &Shadow = DeviceInfo->Shadow;
+    uptr ShadowBegin = Shadow->MemToShadow(AI->AllocBegin);
+    uptr ShadowEnd = Shadow->MemToShadow(TailEnd - 1);
+
+    if (ShadowEnd - ShadowBegin + 1 > MaxShadowRunSize) {
+        // Init zero
+        UR_CALL(Shadow->EnqueuePoisonShadow(Queue, AI->AllocBegin,
+                                            AI->AllocSize, 0));
+
+        // User tail
+        if (TailBegin != AI->UserEnd) {
+            auto Value = AI->UserEnd -
+                         RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY);
+            UR_CALL(Shadow->EnqueuePoisonShadow(Queue, AI->UserEnd, 1,
+                                                static_cast<u8>(Value)));
+        }
+
+        // Left red zone
+        UR_CALL(Shadow->EnqueuePoisonShadow(Queue, AI->AllocBegin,
+                                            AI->UserBegin - AI->AllocBegin,
+                                            ShadowByte));
 
-    // Right red zone
-    UR_CALL(DeviceInfo->Shadow->EnqueuePoisonShadow(
-        Queue, TailBegin, TailEnd - TailBegin, ShadowByte));
+        // Right red zone
+        UR_CALL(Shadow->EnqueuePoisonShadow(Queue, TailBegin,
+                                            TailEnd - TailBegin, ShadowByte));
+
+        return UR_RESULT_SUCCESS;
+    }
+
+    UR_CALL(Shadow->MapShadow(Queue, AI->AllocBegin, AI->AllocSize));
+
+    // Same layout as the fills above, in the same order
+    ShadowRun Run{AI->AllocBegin, ShadowBegin,
+                  std::vector<u8>(ShadowEnd - ShadowBegin + 1, 0)};
+    auto Poison = [&](uptr Ptr, uptr Size, u8 Value) {
+        if (Size == 0) {
+            return;
+        }
+        std::fill(Run.Bytes.begin() + (Shadow->MemToShadow(Ptr) - ShadowBegin),
+                  Run.Bytes.begin() +
+                      (Shadow->MemToShadow(Ptr + Size - 1) - ShadowBegin + 1),
+                  Value);
+    };
+    if (TailBegin != AI->UserEnd) {
+        Poison(AI->UserEnd, 1,
+               AI->UserEnd - RoundDownTo(AI->UserEnd, ASAN_SHADOW_GRANULARITY));
+    }
+    Poison(AI->AllocBegin, AI->UserBegin - AI->AllocBegin, ShadowByte);
+    Poison(TailBegin, TailEnd - TailBegin, ShadowByte);
+    Runs.push_back(std::move(Run));
+
+    return UR_RESULT_SUCCESS;
+}
+
+/// Writes Runs[First..] to the shadow, merging runs that are adjacent in
+/// shadow memory into a single copy.
+ur_result_t SanitizerInterceptor::enqueueShadowRuns(
+    std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue,
+    std::vector<ShadowRun> &Runs, size_t First) {
+    if (First >= Runs.size()) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    // Runs of a single batch never overlap, see updateShadowMemory
+    std::sort(Runs.begin() + First, Runs.end(),
+              [](const ShadowRun &A, const ShadowRun &B) {
+                  return A.ShadowBegin < B.ShadowBegin;
+              });
+
+    size_t Merged = First;
+    for (size_t I = First + 1; I < Runs.size(); ++I) {
+        auto &Prev = Runs[Merged];
+        if (Prev.ShadowBegin + Prev.Bytes.size() == Runs[I].ShadowBegin) {
+            Prev.Bytes.insert(Prev.Bytes.end(), Runs[I].Bytes.begin(),
+                              Runs[I].Bytes.end());
+        } else {
+            Runs[++Merged] = std::move(Runs[I]);
+        }
+    }
+    Runs.resize(Merged + 1);
+
+    for (size_t I = First; I < Runs.size(); ++I) {
+        UR_CALL(DeviceInfo->Shadow->EnqueueWriteShadow(
+            Queue, Runs[I].AppBegin, Runs[I].Bytes.data(),
+            Runs[I].Bytes.size()));
+    }
 
     return UR_RESULT_SUCCESS;
 }
 
 ur_result_t SanitizerInterceptor::updateShadowMemory(
     std::shared_ptr<ContextInfo> &ContextInfo,
-    std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue) {
+    std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue,
+    ur_kernel_handle_t Kernel) {
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                       AsanPhase::ShadowUpdate, Kernel);
     auto &AllocInfos = ContextInfo->AllocInfosMap[DeviceInfo->Handle];
     std::scoped_lock<ur_shared_mutex> Guard(AllocInfos.Mutex);
 
+    // Small live allocations are batched into Runs. Anything poisoned with a
+    // fill (a released allocation) first writes out the pending runs, so the
+    // queue sees the updates in list order. Runs already written keep their
+    // place in the vector and are skipped by the next batch.
+    std::vector<ShadowRun> Runs;
+    size_t Written = 0;
+    auto Flush = [&]() -> ur_result_t {
+        UR_CALL(enqueueShadowRuns(DeviceInfo, Queue, Runs, Written));
+        Written = Runs.size();
+        return UR_RESULT_SUCCESS;
+    };
+
     for (auto &AI : AllocInfos.List) {
-        UR_CALL(enqueueAllocInfo(DeviceInfo, Queue, AI));
+        if (AI->IsReleased) {
+            UR_CALL(Flush());
+        }
+        UR_CALL(enqueueAllocInfo(DeviceInfo, Queue, AI, Runs));
     }
+    UR_CALL(Flush());
     AllocInfos.List.clear();
 
+    // The copies read from Runs, which is about to go out of scope
+    if (!Runs.empty()) {
+        UR_CALL(getContext()->urDdiTable.Queue.pfnFinish(Queue));
+    }
+
     return UR_RESULT_SUCCESS;
 }
 
@@ -427,9 +763,8 @@ ur_result_t SanitizerInterceptor::registerProgram(ur_context_handle_t Context,
             if (ReportWarning && Result != UR_RESULT_SUCCESS) {
                 getContext()->logger.warning(
                     "Failed to write device global \"{}\": {}", Name, Result);
-                return false;
             }
-            return true;
+            return Result == UR_RESULT_SUCCESS;
         };
 
         // Write debug
@@ -439,10 +774,17 @@ ur_result_t SanitizerInterceptor::registerProgram(ur_context_handle_t Context,
         static uint64_t Debug = getOptions().Debug ? 1 : 0;
         EnqueueWriteGlobal(kSPIR_AsanDebug, &Debug, sizeof(Debug), false);
 
-        // Write shadow memory offset for global memory
-        EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalStart,
-                           &DeviceInfo->Shadow->ShadowBegin,
-                           sizeof(DeviceInfo->Shadow->ShadowBegin));
+        // Write shadow memory offset for global memory. Only programs built
+        // with the sanitizer have this device global.
+        if (!EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalStart,
+                                &DeviceInfo->Shadow->ShadowBegin,
+                                sizeof(DeviceInfo->Shadow->ShadowBegin),
+                                false)) {
+            getContext()->logger.info("Program {} is not instrumented",
+                                      (void *)Program);
+            continue;
+        }
+        ProgramInfo->IsInstrumented = true;
         EnqueueWriteGlobal(kSPIR_AsanShadowMemoryGlobalEnd,
                            &DeviceInfo->Shadow->ShadowEnd,
                            sizeof(DeviceInfo->Shadow->ShadowEnd));
@@ -486,12 +828,14 @@ ur_result_t SanitizerInterceptor::registerProgram(ur_context_handle_t Context,
                           GetCurrentBacktrace(),
                           {}});
 
+            UR_CALL(DeviceInfo->Shadow->RetainShadow(AI));
             ContextInfo->insertAllocInfo({Device}, AI);
 
             {
                 std::scoped_lock<ur_shared_mutex, ur_shared_mutex> Guard(
                     m_AllocationMapMutex, ProgramInfo->Mutex);
                 ProgramInfo->AllocInfoForGlobals.emplace(AI);
+                m_AllocationIndex.insert(AI);
                 m_AllocationMap.emplace(AI->AllocBegin, std::move(AI));
             }
         }
@@ -508,6 +852,7 @@ SanitizerInterceptor::unregisterProgram(ur_program_handle_t Program) {
         m_AllocationMapMutex, ProgramInfo->Mutex);
     for (auto AI : ProgramInfo->AllocInfoForGlobals) {
         UR_CALL(getDeviceInfo(AI->Device)->Shadow->ReleaseShadow(AI));
+        m_AllocationIndex.erase(AI);
         m_AllocationMap.erase(AI->AllocBegin);
     }
     ProgramInfo->AllocInfoForGlobals.clear();
@@ -534,6 +879,28 @@ SanitizerInterceptor::insertContext(ur_context_handle_t Context,
 }
 
 ur_result_t SanitizerInterceptor::eraseContext(ur_context_handle_t Context) {
+    // Deferred launches hold on to the context's ContextInfo
+    UR_CALL(checkDeferredReports(nullptr, true));
+
+    // Quarantined allocations must be freed while the context is alive
+    if (m_Quarantine) {
+        auto ReleaseList = m_Quarantine->drain(Context);
+        UR_CALL(releaseQuarantined(ReleaseList));
+    }
+
+    // So must the shadow scratch of queues that weren't released
+    {
+        std::scoped_lock<ur_mutex> Guard(m_ShadowScratchMutex);
+        for (auto It = m_ShadowScratch.begin(); It != m_ShadowScratch.end();) {
+            if (It->second.Context != Context) {
+                ++It;
+                continue;
+            }
+            UR_CALL(freeShadowScratch(It->second));
+            It = m_ShadowScratch.erase(It);
+        }
+    }
+
     std::scoped_lock<ur_shared_mutex> Guard(m_ContextMapMutex);
     assert(m_ContextMap.find(Context) != m_ContextMap.end());
     m_ContextMap.erase(Context);
@@ -596,7 +963,9 @@ ur_result_t SanitizerInterceptor::insertKernel(ur_kernel_handle_t Kernel) {
     if (m_KernelMap.find(Kernel) != m_KernelMap.end()) {
         return UR_RESULT_SUCCESS;
     }
-    m_KernelMap.emplace(Kernel, std::make_shared<KernelInfo>(Kernel));
+    auto ProgramInfo = getProgramInfo(GetProgram(Kernel));
+    m_KernelMap.emplace(Kernel, std::make_shared<KernelInfo>(
+                                    Kernel, ProgramInfo->IsInstrumented));
     return UR_RESULT_SUCCESS;
 }
 
@@ -633,10 +1002,30 @@ SanitizerInterceptor::getMemBuffer(ur_mem_handle_t MemHandle) {
     return nullptr;
 }
 
+ur_result_t SanitizerInterceptor::setBufferArgs(ur_kernel_handle_t Kernel,
+                                                KernelInfo &KernelInfo,
+                                                ur_device_handle_t Device) {
+    for (const auto &[ArgIndex, MemBuffer] : KernelInfo.BufferArgs) {
+        char *ArgPointer = nullptr;
+        UR_CALL(MemBuffer->getHandle(Device, ArgPointer));
+        ur_result_t URes = getContext()->urDdiTable.Kernel.pfnSetArgPointer(
+            Kernel, ArgIndex, nullptr, ArgPointer);
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.error(
+                "Failed to set buffer {} as the {} arg to kernel {}: {}",
+                ur_cast<ur_mem_handle_t>(MemBuffer.get()), ArgIndex, Kernel,
+                URes);
+        }
+    }
+    return UR_RESULT_SUCCESS;
+}
+
 ur_result_t SanitizerInterceptor::prepareLaunch(
     std::shared_ptr<ContextInfo> &ContextInfo,
     std::shared_ptr<DeviceInfo> &DeviceInfo, ur_queue_handle_t Queue,
     ur_kernel_handle_t Kernel, USMLaunchInfo &LaunchInfo) {
+    AsanStatsWrapper::PhaseTimer Timer(ContextInfo->Stats,
+                                       AsanPhase::LaunchInfo, Kernel);
 
     do {
         auto KernelInfo = getKernelInfo(Kernel);
@@ -657,19 +1046,7 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
             }
         }
 
-        // Set membuffer arguments
-        for (const auto &[ArgIndex, MemBuffer] : KernelInfo->BufferArgs) {
-            char *ArgPointer = nullptr;
-            UR_CALL(MemBuffer->getHandle(DeviceInfo->Handle, ArgPointer));
-            ur_result_t URes = getContext()->urDdiTable.Kernel.pfnSetArgPointer(
-                Kernel, ArgIndex, nullptr, ArgPointer);
-            if (URes != UR_RESULT_SUCCESS) {
-                getContext()->logger.error(
-                    "Failed to set buffer {} as the {} arg to kernel {}: {}",
-                    ur_cast<ur_mem_handle_t>(MemBuffer.get()), ArgIndex, Kernel,
-                    URes);
-            }
-        }
+        UR_CALL(setBufferArgs(Kernel, *KernelInfo, DeviceInfo->Handle));
 
         // Set launch info argument
         auto ArgNums = GetKernelNumArgs(Kernel);
@@ -713,26 +1090,11 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                      LocalWorkSize[Dim];
         }
 
-        auto EnqueueAllocateShadowMemory = [Context = ContextInfo->Handle,
-                                            Device = DeviceInfo->Handle,
-                                            Queue](size_t Size, uptr &Ptr) {
-            void *Allocated = nullptr;
-            auto URes = getContext()->urDdiTable.USM.pfnDeviceAlloc(
-                Context, Device, nullptr, nullptr, Size, &Allocated);
-            if (URes != UR_RESULT_SUCCESS) {
-                return URes;
-            }
-            // Initialize shadow memory
-            URes = EnqueueUSMBlockingSet(Queue, Allocated, 0, Size);
-            if (URes != UR_RESULT_SUCCESS) {
-                [[maybe_unused]] auto URes =
-                    getContext()->urDdiTable.USM.pfnFree(Context, Allocated);
-                assert(URes == UR_RESULT_SUCCESS &&
-                       "urUSMFree failed at allocating shadow memory");
-                Allocated = nullptr;
-            }
-            Ptr = (uptr)Allocated;
-            return URes;
+        auto EnqueueAllocateShadowMemory = [&](ShadowScratchKind Kind,
+                                               size_t Size, uptr &Ptr) {
+            return acquireShadowScratch(ContextInfo, DeviceInfo->Handle,
+                                        LaunchInfo.Queue, Queue, Kind, Size,
+                                        Ptr);
         };
 
         auto LocalMemoryUsage =
@@ -760,7 +1122,7 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                     NumWG, LocalMemorySize, LocalShadowMemorySize);
 
                 if (EnqueueAllocateShadowMemory(
-                        LocalShadowMemorySize,
+                        ShadowScratchKind::Local, LocalShadowMemorySize,
                         LaunchInfo.Data->LocalShadowOffset) !=
                     UR_RESULT_SUCCESS) {
                     getContext()->logger.warning(
@@ -776,9 +1138,6 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                         LaunchInfo.Data->LocalShadowOffset +
                         LocalShadowMemorySize - 1;
 
-                    ContextInfo->Stats.UpdateShadowMalloced(
-                        LocalShadowMemorySize);
-
                     getContext()->logger.info(
                         "ShadowMemory(Local, {} - {})",
                         (void *)LaunchInfo.Data->LocalShadowOffset,
@@ -802,7 +1161,7 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                                            NumWG, PrivateShadowMemorySize);
 
                 if (EnqueueAllocateShadowMemory(
-                        PrivateShadowMemorySize,
+                        ShadowScratchKind::Private, PrivateShadowMemorySize,
                         LaunchInfo.Data->PrivateShadowOffset) !=
                     UR_RESULT_SUCCESS) {
                     getContext()->logger.warning(
@@ -818,9 +1177,6 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
                         LaunchInfo.Data->PrivateShadowOffset +
                         PrivateShadowMemorySize - 1;
 
-                    ContextInfo->Stats.UpdateShadowMalloced(
-                        PrivateShadowMemorySize);
-
                     getContext()->logger.info(
                         "ShadowMemory(Private, {} - {})",
                         (void *)LaunchInfo.Data->PrivateShadowOffset,
@@ -833,21 +1189,6 @@ ur_result_t SanitizerInterceptor::prepareLaunch(
     return UR_RESULT_SUCCESS;
 }
 
-std::optional<AllocationIterator>
-SanitizerInterceptor::findAllocInfoByAddress(uptr Address) {
-    std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
-    auto It = m_AllocationMap.upper_bound(Address);
-    if (It == m_AllocationMap.begin()) {
-        return std::optional<AllocationIterator>{};
-    }
-    --It;
-    // Make sure we got the right AllocInfo
-    assert(Address >= It->second->AllocBegin &&
-           Address < It->second->AllocBegin + It->second->AllocSize &&
-           "Wrong AllocInfo for the address");
-    return It;
-}
-
 std::vector<AllocationIterator>
 SanitizerInterceptor::findAllocInfoByContext(ur_context_handle_t Context) {
     std::shared_lock<ur_shared_mutex> Guard(m_AllocationMapMutex);
@@ -910,22 +1251,20 @@ USMLaunchInfo::~USMLaunchInfo() {
     [[maybe_unused]] ur_result_t Result;
     if (Data) {
         auto Type = GetDeviceType(Context, Device);
-        auto ContextInfo = getContext()->interceptor->getContextInfo(Context);
+        auto &Interceptor = getContext()->interceptor;
         if (Type == DeviceType::GPU_PVC || Type == DeviceType::GPU_DG2) {
             if (Data->PrivateShadowOffset) {
-                ContextInfo->Stats.UpdateShadowFreed(
+                Interceptor->releaseShadowScratch(
+                    Context, Queue, ShadowScratchKind::Private,
+                    Data->PrivateShadowOffset,
                     Data->PrivateShadowOffsetEnd - Data->PrivateShadowOffset +
-                    1);
-                Result = getContext()->urDdiTable.USM.pfnFree(
-                    Context, (void *)Data->PrivateShadowOffset);
-                assert(Result == UR_RESULT_SUCCESS);
+                        1);
             }
             if (Data->LocalShadowOffset) {
-                ContextInfo->Stats.UpdateShadowFreed(
+                Interceptor->releaseShadowScratch(
+                    Context, Queue, ShadowScratchKind::Local,
+                    Data->LocalShadowOffset,
                     Data->LocalShadowOffsetEnd - Data->LocalShadowOffset + 1);
-                Result = getContext()->urDdiTable.USM.pfnFree(
-                    Context, (void *)Data->LocalShadowOffset);
-                assert(Result == UR_RESULT_SUCCESS);
             }
         }
         if (Data->LocalArgs) {
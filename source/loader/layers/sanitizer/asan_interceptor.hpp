@@ -12,6 +12,7 @@
 
 #pragma once
 
+#include "asan_allocation_index.hpp"
 #include "asan_allocator.hpp"
 #include "asan_buffer.hpp"
 #include "asan_libdevice.hpp"
@@ -37,6 +38,14 @@ struct AllocInfoList {
     ur_shared_mutex Mutex;
 };
 
+/// Shadow bytes of one allocation, computed on the host and written to the
+/// device shadow in a single copy.
+struct ShadowRun {
+    uptr AppBegin;
+    uptr ShadowBegin;
+    std::vector<u8> Bytes;
+};
+
 struct DeviceInfo {
     ur_device_handle_t Handle;
 
@@ -80,9 +89,38 @@ struct QueueInfo {
     }
 };
 
+enum class ShadowScratchKind { Local, Private };
+
+// Shadow memory for the local or private memory of launches on a queue
+struct ShadowScratch {
+    uptr Begin = 0;
+    size_t Size = 0;
+    // Held by a launch whose report hasn't been read yet
+    bool InUse = false;
+};
+
+// The shadow scratch buffers of a queue, reused by its launches instead of
+// allocating shadow memory for each of them. They only grow, and there are
+// as many of them as launches in flight at once.
+struct QueueShadowScratch {
+    ur_context_handle_t Context;
+    std::vector<ShadowScratch> Local;
+    std::vector<ShadowScratch> Private;
+
+    explicit QueueShadowScratch(ur_context_handle_t Context)
+        : Context(Context) {}
+
+    std::vector<ShadowScratch> &get(ShadowScratchKind Kind) {
+        return Kind == ShadowScratchKind::Local ? Local : Private;
+    }
+};
+
 struct KernelInfo {
     ur_kernel_handle_t Handle;
     std::atomic<int32_t> RefCount = 1;
+    // False if the kernel's program wasn't built with the sanitizer, then its
+    // launches need neither launch info nor shadow memory
+    const bool IsInstrumented;
 
     // lock this mutex if following fields are accessed
     ur_shared_mutex Mutex;
@@ -93,7 +131,8 @@ struct KernelInfo {
     // Need preserve the order of local arguments
     std::map<uint32_t, LocalArgsInfo> LocalArgs;
 
-    explicit KernelInfo(ur_kernel_handle_t Kernel) : Handle(Kernel) {
+    explicit KernelInfo(ur_kernel_handle_t Kernel, bool IsInstrumented)
+        : Handle(Kernel), IsInstrumented(IsInstrumented) {
         [[maybe_unused]] auto Result =
             getContext()->urDdiTable.Kernel.pfnRetain(Kernel);
         assert(Result == UR_RESULT_SUCCESS);
@@ -109,6 +148,8 @@ struct KernelInfo {
 struct ProgramInfo {
     ur_program_handle_t Handle;
     std::atomic<int32_t> RefCount = 1;
+    // Set by registerProgram once the sanitizer's device globals are found
+    std::atomic<bool> IsInstrumented = false;
 
     // lock this mutex if following fields are accessed
     ur_shared_mutex Mutex;
@@ -159,6 +200,8 @@ struct USMLaunchInfo {
 
     ur_context_handle_t Context = nullptr;
     ur_device_handle_t Device = nullptr;
+    // Set by preLaunchKernel, the shadow scratch is given back to it
+    ur_queue_handle_t Queue = nullptr;
     const size_t *GlobalWorkSize = nullptr;
     const size_t *GlobalWorkOffset = nullptr;
     std::vector<size_t> LocalWorkSize;
@@ -208,9 +251,38 @@ class SanitizerInterceptor {
                                 ur_queue_handle_t Queue,
                                 USMLaunchInfo &LaunchInfo);
 
+    /// Only sets the buffer arguments of a kernel that isn't instrumented
+    ur_result_t preLaunchUninstrumentedKernel(ur_kernel_handle_t Kernel,
+                                              ur_queue_handle_t Queue);
+
     ur_result_t postLaunchKernel(ur_kernel_handle_t Kernel,
                                  ur_queue_handle_t Queue,
-                                 USMLaunchInfo &LaunchInfo);
+                                 ur_event_handle_t Event,
+                                 std::shared_ptr<USMLaunchInfo> &LaunchInfo);
+
+    /// Checks the device reports of launches on Queue (or on every queue if
+    /// it's nullptr) whose checks were deferred by postLaunchKernel. Launches
+    /// still running are skipped, unless Wait is set.
+    ur_result_t checkDeferredReports(ur_queue_handle_t Queue, bool Wait);
+
+    /// Takes Size bytes of zeroed shadow memory for the local or private
+    /// memory of a launch on Queue, from the queue's scratch buffers
+    ur_result_t acquireShadowScratch(std::shared_ptr<ContextInfo> &ContextInfo,
+                                     ur_device_handle_t Device,
+                                     ur_queue_handle_t Queue,
+                                     ur_queue_handle_t InternalQueue,
+                                     ShadowScratchKind Kind, size_t Size,
+                                     uptr &Ptr);
+
+    /// Gives back shadow memory taken with acquireShadowScratch once the
+    /// launch is done, freeing it if the queue no longer has it
+    void releaseShadowScratch(ur_context_handle_t Context,
+                              ur_queue_handle_t Queue, ShadowScratchKind Kind,
+                              uptr Ptr, size_t Size);
+
+    /// Frees the shadow scratch buffers of Queue, whose handle may be
+    /// reused for another queue
+    ur_result_t eraseShadowScratch(ur_queue_handle_t Queue);
 
     ur_result_t insertContext(ur_context_handle_t Context,
                               std::shared_ptr<ContextInfo> &CI);
@@ -240,7 +312,10 @@ class SanitizerInterceptor {
         return UR_RESULT_SUCCESS;
     }
 
-    std::optional<AllocationIterator> findAllocInfoByAddress(uptr Address);
+    /// Lock-free; returns the allocation containing Address, or nullptr.
+    std::shared_ptr<AllocInfo> findAllocInfoByAddress(uptr Address) {
+        return m_AllocationIndex.find(Address);
+    }
 
     std::vector<AllocationIterator>
     findAllocInfoByContext(ur_context_handle_t Context);
@@ -272,13 +347,29 @@ class SanitizerInterceptor {
     const AsanOptions &getOptions() { return m_Options; }
 
   private:
+    /// Frees the shadow scratch buffers of Entry that no launch holds, the
+    /// others being freed by their launches. m_ShadowScratchMutex is held.
+    ur_result_t freeShadowScratch(QueueShadowScratch &Entry);
+
     ur_result_t updateShadowMemory(std::shared_ptr<ContextInfo> &ContextInfo,
                                    std::shared_ptr<DeviceInfo> &DeviceInfo,
-                                   ur_queue_handle_t Queue);
+                                   ur_queue_handle_t Queue,
+                                   ur_kernel_handle_t Kernel);
+
+    /// Frees allocations evicted from the quarantine.
+    ur_result_t
+    releaseQuarantined(std::vector<AllocationIterator> &ReleaseList);
 
     ur_result_t enqueueAllocInfo(std::shared_ptr<DeviceInfo> &DeviceInfo,
                                  ur_queue_handle_t Queue,
-                                 std::shared_ptr<AllocInfo> &AI);
+                                 std::shared_ptr<AllocInfo> &AI,
+                                 std::vector<ShadowRun> &Runs);
+
+    ur_result_t enqueueShadowRuns(std::shared_ptr<DeviceInfo> &DeviceInfo,
+                                  ur_queue_handle_t Queue,
+                                  std::vector<ShadowRun> &Runs, size_t First);
+
+    void reportErrors(ur_kernel_handle_t Kernel, USMLaunchInfo &LaunchInfo);
 
     /// Initialize Global Variables & Kernel Name at first Launch
     ur_result_t prepareLaunch(std::shared_ptr<ContextInfo> &ContextInfo,
@@ -287,6 +378,9 @@ class SanitizerInterceptor {
                               ur_kernel_handle_t Kernel,
                               USMLaunchInfo &LaunchInfo);
 
+    ur_result_t setBufferArgs(ur_kernel_handle_t Kernel, KernelInfo &KernelInfo,
+                              ur_device_handle_t Device);
+
     ur_result_t allocShadowMemory(ur_context_handle_t Context,
                                   std::shared_ptr<DeviceInfo> &DeviceInfo);
 
@@ -313,9 +407,24 @@ class SanitizerInterceptor {
     /// Assumption: all USM chunks are allocated in one VA
     AllocationMap m_AllocationMap;
     ur_shared_mutex m_AllocationMapMutex;
+    /// Address lookups; updated along with m_AllocationMap
+    AllocationIndex m_AllocationIndex;
 
     std::unique_ptr<Quarantine> m_Quarantine;
 
+    /// A launch whose device report is checked once its event completes
+    struct DeferredReport {
+        ur_kernel_handle_t Kernel; // retained
+        ur_event_handle_t Event;   // retained
+        std::shared_ptr<USMLaunchInfo> LaunchInfo;
+    };
+    std::unordered_map<ur_queue_handle_t, std::vector<DeferredReport>>
+        m_DeferredReports;
+    ur_mutex m_DeferredReportsMutex;
+
+    std::unordered_map<ur_queue_handle_t, QueueShadowScratch> m_ShadowScratch;
+    ur_mutex m_ShadowScratchMutex;
+
     AsanOptions m_Options;
 
     std::unordered_set<ur_adapter_handle_t> m_Adapters;
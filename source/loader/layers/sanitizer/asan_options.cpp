@@ -81,12 +81,18 @@ AsanOptions::AsanOptions() {
     };
 
     SetBoolOption("debug", Debug);
+    SetBoolOption("deferred_report", DeferredReport);
     SetBoolOption("detect_kernel_arguments", DetectKernelArguments);
     SetBoolOption("detect_locals", DetectLocals);
     SetBoolOption("detect_privates", DetectPrivates);
     SetBoolOption("print_stats", PrintStats);
 
-    auto KV = OptionsEnvMap->find("quarantine_size_mb");
+    auto KV = OptionsEnvMap->find("stats_export");
+    if (KV != OptionsEnvMap->end()) {
+        StatsExportPath = KV->second.front();
+    }
+
+    KV = OptionsEnvMap->find("quarantine_size_mb");
     if (KV != OptionsEnvMap->end()) {
         const auto &Value = KV->second.front();
         try {
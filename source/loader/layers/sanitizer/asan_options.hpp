@@ -24,7 +24,10 @@ struct AsanOptions {
     bool DetectLocals = true;
     bool DetectPrivates = true;
     bool PrintStats = false;
+    // Where the phase timings are written as JSON with print_stats
+    std::string StatsExportPath;
     bool DetectKernelArguments = true;
+    bool DeferredReport = false;
 
     explicit AsanOptions();
 };
@@ -14,23 +14,159 @@
 
 namespace ur_sanitizer_layer {
 
-std::vector<AllocationIterator> Quarantine::put(ur_device_handle_t Device,
-                                                AllocationIterator &It) {
-    auto &AI = It->second;
-    auto AllocSize = AI->AllocSize;
-    auto &Cache = getCache(Device);
-
-    std::vector<AllocationIterator> DequeueList;
-    std::scoped_lock<ur_mutex> Guard(Cache.Mutex);
-    while (Cache.size() + AllocSize > m_MaxQuarantineSize) {
-        auto ElementOp = Cache.dequeue();
-        if (!ElementOp) {
-            break;
+QuarantineCache::~QuarantineCache() {
+    auto *Head = m_Incoming.load(std::memory_order_acquire);
+    while (Head) {
+        auto *Next = Head->Next;
+        delete Head;
+        Head = Next;
+    }
+}
+
+uptr QuarantineCache::enqueue(Element &It) {
+    // Account first, so dequeue() never makes the size wrap around
+    auto AllocSize = It->second->AllocSize;
+    auto Size = m_Size.fetch_add(AllocSize) + AllocSize;
+
+    auto *New = new Node{It, m_Incoming.load(std::memory_order_relaxed)};
+    while (!m_Incoming.compare_exchange_weak(New->Next, New,
+                                             std::memory_order_release,
+                                             std::memory_order_relaxed)) {
+    }
+    return Size;
+}
+
+void QuarantineCache::collect() {
+    auto *Head = m_Incoming.exchange(nullptr, std::memory_order_acquire);
+
+    // Reverse the stack, so the oldest element is evicted first
+    Node *Oldest = nullptr;
+    while (Head) {
+        auto *Next = Head->Next;
+        Head->Next = Oldest;
+        Oldest = Head;
+        Head = Next;
+    }
+    while (Oldest) {
+        auto *Next = Oldest->Next;
+        m_List.push(Oldest->It);
+        delete Oldest;
+        Oldest = Next;
+    }
+}
+
+std::optional<QuarantineCache::Element> QuarantineCache::dequeue() {
+    if (m_List.empty()) {
+        return std::optional<Element>{};
+    }
+    auto It = m_List.front();
+    m_List.pop();
+    m_Size -= It->second->AllocSize;
+    return It;
+}
+
+void QuarantineCache::remove(ur_context_handle_t Context,
+                             std::vector<Element> &Removed) {
+    List Kept;
+    while (!m_List.empty()) {
+        auto It = m_List.front();
+        m_List.pop();
+        if (It->second->Context == Context) {
+            m_Size -= It->second->AllocSize;
+            Removed.emplace_back(It);
+        } else {
+            Kept.push(It);
+        }
+    }
+    m_List = std::move(Kept);
+}
+
+Quarantine::Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release)
+    : m_MaxQuarantineSize(MaxQuarantineSize), m_Release(std::move(Release)) {
+    m_Thread = std::thread([this] { run(); });
+}
+
+Quarantine::~Quarantine() {
+    {
+        std::scoped_lock<std::mutex> Guard(m_WakeMutex);
+        m_Stop = true;
+    }
+    m_WakeCv.notify_one();
+    m_Thread.join();
+}
+
+QuarantineCache &Quarantine::getCache(ur_device_handle_t Device) {
+    if (Device == nullptr) { // Host USM
+        return m_HostCache;
+    }
+    size_t Hash = std::hash<ur_device_handle_t>{}(Device);
+    for (size_t N = 0; N < MaxDevices; ++N) {
+        auto &Slot = m_Slots[(Hash + N) % MaxDevices];
+        auto Current = Slot.Device.load(std::memory_order_acquire);
+        if (Current == Device) {
+            return Slot.Cache;
+        }
+        if (Current == nullptr &&
+            (Slot.Device.compare_exchange_strong(Current, Device) ||
+             Current == Device)) {
+            return Slot.Cache;
+        }
+    }
+    assert(false && "Too many devices in the quarantine");
+    return m_Slots[0].Cache;
+}
+
+void Quarantine::put(ur_device_handle_t Device, AllocationIterator &It) {
+    if (getCache(Device).enqueue(It) <= m_MaxQuarantineSize) {
+        return;
+    }
+
+    {
+        std::scoped_lock<std::mutex> Guard(m_WakeMutex);
+        m_Wake = true;
+    }
+    m_WakeCv.notify_one();
+}
+
+std::vector<AllocationIterator>
+Quarantine::drain(ur_context_handle_t Context) {
+    std::vector<AllocationIterator> Removed;
+    std::scoped_lock<ur_mutex> Guard(m_ListMutex);
+    forEachCache([&](QuarantineCache &Cache) {
+        Cache.collect();
+        Cache.remove(Context, Removed);
+    });
+    return Removed;
+}
+
+void Quarantine::run() {
+    std::vector<AllocationIterator> Batch;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> Lock(m_WakeMutex);
+            m_WakeCv.wait(Lock, [this] { return m_Wake || m_Stop; });
+            if (m_Stop) {
+                return;
+            }
+            m_Wake = false;
+        }
+
+        std::scoped_lock<ur_mutex> Guard(m_ListMutex);
+        forEachCache([&](QuarantineCache &Cache) {
+            Cache.collect();
+            while (Cache.size() > m_MaxQuarantineSize) {
+                auto ElementOp = Cache.dequeue();
+                if (!ElementOp) {
+                    break;
+                }
+                Batch.emplace_back(*ElementOp);
+            }
+        });
+        if (!Batch.empty()) {
+            m_Release(Batch);
+            Batch.clear();
         }
-        DequeueList.emplace_back(*ElementOp);
     }
-    Cache.enqueue(It);
-    return DequeueList;
 }
 
 } // namespace ur_sanitizer_layer
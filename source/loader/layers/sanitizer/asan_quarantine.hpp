@@ -15,8 +15,12 @@
 #include "asan_allocator.hpp"
 
 #include <atomic>
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <optional>
 #include <queue>
-#include <unordered_map>
+#include <thread>
 #include <vector>
 
 namespace ur_sanitizer_layer {
@@ -26,49 +30,94 @@ class QuarantineCache {
     using Element = AllocationIterator;
     using List = std::queue<Element>;
 
-    // The following methods are not thread safe, use this lock
-    ur_mutex Mutex;
+    QuarantineCache() = default;
+    ~QuarantineCache();
+
+    QuarantineCache(const QuarantineCache &) = delete;
+    QuarantineCache &operator=(const QuarantineCache &) = delete;
 
     // Total memory used, including internal accounting.
-    uptr size() const { return m_Size; }
+    uptr size() const { return m_Size.load(std::memory_order_relaxed); }
 
-    void enqueue(Element &It) {
-        m_List.push(It);
-        m_Size += It->second->AllocSize;
-    }
+    /// Lock-free, may be called from any thread. Returns the new size.
+    uptr enqueue(Element &It);
 
-    std::optional<Element> dequeue() {
-        if (m_List.empty()) {
-            return std::optional<Element>{};
-        }
-        auto It = m_List.front();
-        m_List.pop();
-        m_Size -= It->second->AllocSize;
-        return It;
-    }
+    // The following methods must only be called by the owner of
+    // Quarantine::m_ListMutex
+
+    /// Moves the elements enqueued so far to the eviction list, oldest first.
+    void collect();
+
+    std::optional<Element> dequeue();
+
+    /// Removes every element of Context from the eviction list.
+    void remove(ur_context_handle_t Context, std::vector<Element> &Removed);
 
   private:
+    struct Node {
+        Element It;
+        Node *Next;
+    };
+
+    // Newest first, pushed lock-free by enqueue()
+    std::atomic<Node *> m_Incoming{nullptr};
     List m_List;
     std::atomic_uintptr_t m_Size = 0;
 };
 
+/// Delays the release of freed allocations, so that use-after-free can be
+/// detected. Freeing only enqueues the allocation on its device's cache; once
+/// a cache goes over the limit, a background thread evicts its oldest
+/// allocations in batches and hands them to the release callback.
 class Quarantine {
   public:
-    explicit Quarantine(size_t MaxQuarantineSize)
-        : m_MaxQuarantineSize(MaxQuarantineSize) {}
+    using ReleaseCallback =
+        std::function<void(std::vector<AllocationIterator> &)>;
+
+    Quarantine(size_t MaxQuarantineSize, ReleaseCallback Release);
+    ~Quarantine();
 
-    std::vector<AllocationIterator> put(ur_device_handle_t Device,
-                                        AllocationIterator &Ptr);
+    void put(ur_device_handle_t Device, AllocationIterator &It);
+
+    /// Removes every allocation of Context, which is about to be destroyed,
+    /// from the quarantine. Waits for a batch in flight to be released.
+    std::vector<AllocationIterator> drain(ur_context_handle_t Context);
 
   private:
-    QuarantineCache &getCache(ur_device_handle_t Device) {
-        std::scoped_lock<ur_mutex> Guard(m_Mutex);
-        return m_Map[Device];
+    static constexpr size_t MaxDevices = 256;
+
+    struct Slot {
+        std::atomic<ur_device_handle_t> Device{nullptr};
+        QuarantineCache Cache;
+    };
+
+    QuarantineCache &getCache(ur_device_handle_t Device);
+
+    template <typename F> void forEachCache(F &&Func) {
+        Func(m_HostCache);
+        for (auto &Slot : m_Slots) {
+            if (Slot.Device.load(std::memory_order_acquire) != nullptr) {
+                Func(Slot.Cache);
+            }
+        }
     }
 
-    std::unordered_map<ur_device_handle_t, QuarantineCache> m_Map;
-    ur_mutex m_Mutex;
+    void run();
+
+    // Open-addressing table, slots are claimed but never released
+    Slot m_Slots[MaxDevices];
+    QuarantineCache m_HostCache;
     size_t m_MaxQuarantineSize;
+    ReleaseCallback m_Release;
+
+    // Held while a batch is evicted and released
+    ur_mutex m_ListMutex;
+
+    std::mutex m_WakeMutex;
+    std::condition_variable m_WakeCv;
+    bool m_Wake = false;
+    bool m_Stop = false;
+    std::thread m_Thread;
 };
 
 } // namespace ur_sanitizer_layer
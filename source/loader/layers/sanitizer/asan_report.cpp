@@ -138,15 +138,14 @@ void ReportUseAfterFree(const DeviceSanitizerReport &Report,
     getContext()->logger.always("");
 
     if (getContext()->interceptor->getOptions().MaxQuarantineSizeMB > 0) {
-        auto AllocInfoItOp =
+        auto AllocInfo =
             getContext()->interceptor->findAllocInfoByAddress(Report.Address);
 
-        if (!AllocInfoItOp) {
+        if (!AllocInfo) {
             getContext()->logger.always(
                 "Failed to find which chunck {} is allocated",
                 (void *)Report.Address);
         } else {
-            auto &AllocInfo = (*AllocInfoItOp)->second;
             if (AllocInfo->Context != Context) {
                 getContext()->logger.always(
                     "Failed to find which chunck {} is allocated",
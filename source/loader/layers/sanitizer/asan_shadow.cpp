@@ -16,8 +16,17 @@
 #include "ur_sanitizer_layer.hpp"
 #include "ur_sanitizer_utils.hpp"
 
+#include <algorithm>
+
 namespace ur_sanitizer_layer {
 
+namespace {
+
+// Smallest granule in which GPU shadow memory is committed
+constexpr size_t ShadowCommitSize = 2 * 1024 * 1024;
+
+} // namespace
+
 std::shared_ptr<ShadowMemory> GetShadowMemory(ur_context_handle_t Context,
                                               ur_device_handle_t Device,
                                               DeviceType Type) {
@@ -90,7 +99,23 @@ ur_result_t ShadowMemoryCPU::EnqueuePoisonShadow(ur_queue_handle_t, uptr Ptr,
     getContext()->logger.debug(
         "EnqueuePoisonShadow(addr={}, count={}, value={})", (void *)ShadowBegin,
         ShadowEnd - ShadowBegin + 1, (void *)(size_t)Value);
-    memset((void *)ShadowBegin, Value, ShadowEnd - ShadowBegin + 1);
+    if (Value == 0) {
+        // Unpoisoning a large allocation would otherwise commit its shadow
+        ZeroMmapRange(ShadowBegin, ShadowEnd - ShadowBegin + 1);
+    } else {
+        memset((void *)ShadowBegin, Value, ShadowEnd - ShadowBegin + 1);
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryCPU::EnqueueWriteShadow(ur_queue_handle_t, uptr Ptr,
+                                                const u8 *ShadowBytes,
+                                                size_t Count) {
+    uptr ShadowBegin = MemToShadow(Ptr);
+    getContext()->logger.debug("EnqueueWriteShadow(addr={}, count={})",
+                               (void *)ShadowBegin, Count);
+    memcpy((void *)ShadowBegin, ShadowBytes, Count);
 
     return UR_RESULT_SUCCESS;
 }
@@ -110,9 +135,15 @@ ur_result_t ShadowMemoryGPU::Setup() {
             getContext()->urDdiTable.Context.pfnRetain(Context);
         }
 
-        // Set shadow memory for null pointer
+        size_t NumGranules =
+            (ShadowSize + GetCommitSize() - 1) / GetCommitSize();
+        NumChunks = (NumGranules + GranuleChunk::Size - 1) / GranuleChunk::Size;
+        Chunks = std::make_unique<std::atomic<GranuleChunk *>[]>(NumChunks);
+
+        // Set shadow memory for null pointer, which is never released
         ManagedQueue Queue(Context, Device);
 
+        UR_CALL(retainRange(0, 1));
         Result = EnqueuePoisonShadow(Queue, 0, 1, kNullPointerRedzoneMagic);
         if (Result != UR_RESULT_SUCCESS) {
             getContext()->logger.error("EnqueuePoisonShadow(NullPointerRZ): {}",
@@ -129,6 +160,19 @@ ur_result_t ShadowMemoryGPU::Destory() {
         return UR_RESULT_SUCCESS;
     }
     static ur_result_t Result = [this]() {
+        for (size_t I = 0; I < NumChunks; ++I) {
+            auto *Chunk = Chunks[I].load(std::memory_order_acquire);
+            if (!Chunk) {
+                continue;
+            }
+            for (size_t J = 0; J < GranuleChunk::Size; ++J) {
+                if (Chunk->isCommitted(J)) {
+                    std::scoped_lock<ur_mutex> Guard(CommitMutex);
+                    UR_CALL(decommit(Chunk, I * GranuleChunk::Size + J));
+                }
+            }
+        }
+
         auto Result = getContext()->urDdiTable.VirtualMem.pfnFree(
             Context, (const void *)ShadowBegin, GetShadowSize());
         getContext()->urDdiTable.Context.pfnRelease(Context);
@@ -147,65 +191,7 @@ ur_result_t ShadowMemoryGPU::EnqueuePoisonShadow(ur_queue_handle_t Queue,
     uptr ShadowBegin = MemToShadow(Ptr);
     uptr ShadowEnd = MemToShadow(Ptr + Size - 1);
     assert(ShadowBegin <= ShadowEnd);
-    {
-        static const size_t PageSize =
-            GetVirtualMemGranularity(Context, Device);
-
-        ur_physical_mem_properties_t Desc{
-            UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES, nullptr, 0};
-
-        // Make sure [Ptr, Ptr + Size] is mapped to physical memory
-        for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
-             MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
-            std::scoped_lock<ur_mutex> Guard(VirtualMemMapsMutex);
-            if (VirtualMemMaps.find(MappedPtr) == VirtualMemMaps.end()) {
-                ur_physical_mem_handle_t PhysicalMem{};
-                auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
-                    Context, Device, PageSize, &Desc, &PhysicalMem);
-                if (URes != UR_RESULT_SUCCESS) {
-                    getContext()->logger.error("urPhysicalMemCreate(): {}",
-                                               URes);
-                    return URes;
-                }
-
-                URes = getContext()->urDdiTable.VirtualMem.pfnMap(
-                    Context, (void *)MappedPtr, PageSize, PhysicalMem, 0,
-                    UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
-                if (URes != UR_RESULT_SUCCESS) {
-                    getContext()->logger.error("urVirtualMemMap({}, {}): {}",
-                                               (void *)MappedPtr, PageSize,
-                                               URes);
-                    return URes;
-                }
-
-                getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
-                                           (void *)MappedPtr,
-                                           (void *)(MappedPtr + PageSize - 1));
-
-                // Initialize to zero
-                URes = EnqueueUSMBlockingSet(Queue, (void *)MappedPtr, 0,
-                                             PageSize);
-                if (URes != UR_RESULT_SUCCESS) {
-                    getContext()->logger.error("EnqueueUSMBlockingSet(): {}",
-                                               URes);
-                    return URes;
-                }
-
-                VirtualMemMaps[MappedPtr].first = PhysicalMem;
-            }
-
-            // We don't need to record virtual memory map for null pointer,
-            // since it doesn't have an alloc info.
-            if (Ptr == 0) {
-                continue;
-            }
-
-            auto AllocInfoIt =
-                getContext()->interceptor->findAllocInfoByAddress(Ptr);
-            assert(AllocInfoIt);
-            VirtualMemMaps[MappedPtr].second.insert((*AllocInfoIt)->second);
-        }
-    }
+    UR_CALL(MapShadow(Queue, Ptr, Size));
 
     auto URes = EnqueueUSMBlockingSet(Queue, (void *)ShadowBegin, Value,
                                       ShadowEnd - ShadowBegin + 1);
@@ -221,34 +207,205 @@ ur_result_t ShadowMemoryGPU::EnqueuePoisonShadow(ur_queue_handle_t Queue,
     return UR_RESULT_SUCCESS;
 }
 
-ur_result_t ShadowMemoryGPU::ReleaseShadow(std::shared_ptr<AllocInfo> AI) {
-    uptr ShadowBegin = MemToShadow(AI->AllocBegin);
-    uptr ShadowEnd = MemToShadow(AI->AllocBegin + AI->AllocSize);
-    assert(ShadowBegin <= ShadowEnd);
+ShadowMemoryGPU::~ShadowMemoryGPU() {
+    for (size_t I = 0; I < NumChunks; ++I) {
+        delete Chunks[I].load(std::memory_order_relaxed);
+    }
+}
+
+size_t ShadowMemoryGPU::GetCommitSize() {
+    static const size_t CommitSize = [this]() {
+        size_t PageSize = GetVirtualMemGranularity(Context, Device);
+        return RoundUpTo(std::max(ShadowCommitSize, PageSize), PageSize);
+    }();
+    return CommitSize;
+}
+
+ShadowMemoryGPU::GranuleChunk *ShadowMemoryGPU::getChunk(size_t Granule,
+                                                         bool Create) {
+    size_t Index = Granule / GranuleChunk::Size;
+    assert(Index < NumChunks);
+    auto *Chunk = Chunks[Index].load(std::memory_order_acquire);
+    if (Chunk || !Create) {
+        return Chunk;
+    }
+    auto *New = new GranuleChunk();
+    if (Chunks[Index].compare_exchange_strong(Chunk, New)) {
+        return New;
+    }
+    // Another thread installed it first
+    delete New;
+    return Chunk;
+}
+
+ur_result_t ShadowMemoryGPU::MapShadow(ur_queue_handle_t Queue, uptr Ptr,
+                                       uptr Size) {
+    if (Size == 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    const size_t CommitSize = GetCommitSize();
+    size_t First = (MemToShadow(Ptr) - ShadowBegin) / CommitSize;
+    size_t Last = (MemToShadow(Ptr + Size - 1) - ShadowBegin) / CommitSize;
+
+    ur_physical_mem_properties_t Desc{
+        UR_STRUCTURE_TYPE_PHYSICAL_MEM_PROPERTIES, nullptr, 0};
+
+    // Make sure [Ptr, Ptr + Size] is mapped to physical memory
+    for (size_t Granule = First; Granule <= Last; ++Granule) {
+        auto *Chunk = getChunk(Granule, true);
+        size_t I = Granule % GranuleChunk::Size;
+        if (Chunk->isCommitted(I)) {
+            continue;
+        }
+
+        std::scoped_lock<ur_mutex> Guard(CommitMutex);
+        if (Chunk->isCommitted(I)) {
+            continue;
+        }
+
+        uptr MappedPtr = ShadowBegin + Granule * CommitSize;
+        ur_physical_mem_handle_t PhysicalMem{};
+        auto URes = getContext()->urDdiTable.PhysicalMem.pfnCreate(
+            Context, Device, CommitSize, &Desc, &PhysicalMem);
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.error("urPhysicalMemCreate(): {}", URes);
+            return URes;
+        }
+
+        URes = getContext()->urDdiTable.VirtualMem.pfnMap(
+            Context, (void *)MappedPtr, CommitSize, PhysicalMem, 0,
+            UR_VIRTUAL_MEM_ACCESS_FLAG_READ_WRITE);
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.error("urVirtualMemMap({}, {}): {}",
+                                       (void *)MappedPtr, CommitSize, URes);
+            getContext()->urDdiTable.PhysicalMem.pfnRelease(PhysicalMem);
+            return URes;
+        }
 
-    static const size_t PageSize = GetVirtualMemGranularity(Context, Device);
+        getContext()->logger.debug("urVirtualMemMap: {} ~ {}",
+                                   (void *)MappedPtr,
+                                   (void *)(MappedPtr + CommitSize - 1));
 
-    for (auto MappedPtr = RoundDownTo(ShadowBegin, PageSize);
-         MappedPtr <= ShadowEnd; MappedPtr += PageSize) {
-        std::scoped_lock<ur_mutex> Guard(VirtualMemMapsMutex);
-        if (VirtualMemMaps.find(MappedPtr) == VirtualMemMaps.end()) {
+        // Initialize to zero. Other threads may write this granule on their
+        // own queues as soon as it is marked committed, so wait for it.
+        URes = EnqueueUSMBlockingSet(Queue, (void *)MappedPtr, 0, CommitSize);
+        if (URes == UR_RESULT_SUCCESS) {
+            URes = getContext()->urDdiTable.Queue.pfnFinish(Queue);
+        }
+        if (URes != UR_RESULT_SUCCESS) {
+            getContext()->logger.error("EnqueueUSMBlockingSet(): {}", URes);
+            getContext()->urDdiTable.VirtualMem.pfnUnmap(
+                Context, (void *)MappedPtr, CommitSize);
+            getContext()->urDdiTable.PhysicalMem.pfnRelease(PhysicalMem);
+            return URes;
+        }
+
+        Chunk->PhysicalMem[I] = PhysicalMem;
+        Chunk->Committed[I / 64].fetch_or(uint64_t(1) << (I % 64),
+                                          std::memory_order_release);
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::EnqueueWriteShadow(ur_queue_handle_t Queue,
+                                                uptr Ptr,
+                                                const u8 *ShadowBytes,
+                                                size_t Count) {
+    uptr ShadowBegin = MemToShadow(Ptr);
+    auto URes = getContext()->urDdiTable.Enqueue.pfnUSMMemcpy(
+        Queue, false, (void *)ShadowBegin, ShadowBytes, Count, 0, nullptr,
+        nullptr);
+    getContext()->logger.debug("EnqueueWriteShadow (addr={}, count={}): {}",
+                               (void *)ShadowBegin, Count, URes);
+    if (URes != UR_RESULT_SUCCESS) {
+        getContext()->logger.error("urEnqueueUSMMemcpy(): {}", URes);
+        return URes;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::retainRange(uptr Ptr, uptr Size) {
+    if (Size == 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    const size_t CommitSize = GetCommitSize();
+    size_t First = (MemToShadow(Ptr) - ShadowBegin) / CommitSize;
+    size_t Last = (MemToShadow(Ptr + Size - 1) - ShadowBegin) / CommitSize;
+
+    for (size_t Granule = First; Granule <= Last; ++Granule) {
+        auto *Chunk = getChunk(Granule, true);
+        size_t I = Granule % GranuleChunk::Size;
+        if (Chunk->RefCount[I].fetch_add(1) == 0) {
+            // The last reference may just have been dropped, in which case
+            // the granule may be decommitting. Wait until that's done, so
+            // the next MapShadow sees the bitmap after it.
+            std::scoped_lock<ur_mutex> Guard(CommitMutex);
+        }
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::releaseRange(uptr Ptr, uptr Size) {
+    if (Size == 0) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    const size_t CommitSize = GetCommitSize();
+    size_t First = (MemToShadow(Ptr) - ShadowBegin) / CommitSize;
+    size_t Last = (MemToShadow(Ptr + Size - 1) - ShadowBegin) / CommitSize;
+
+    for (size_t Granule = First; Granule <= Last; ++Granule) {
+        auto *Chunk = getChunk(Granule, false);
+        assert(Chunk && "ReleaseShadow without RetainShadow");
+        size_t I = Granule % GranuleChunk::Size;
+        [[maybe_unused]] auto RefCount = Chunk->RefCount[I].fetch_sub(1);
+        assert(RefCount > 0);
+        if (RefCount != 1) {
             continue;
         }
-        VirtualMemMaps[MappedPtr].second.erase(AI);
-        if (VirtualMemMaps[MappedPtr].second.empty()) {
-            UR_CALL(getContext()->urDdiTable.VirtualMem.pfnUnmap(
-                Context, (void *)MappedPtr, PageSize));
-            UR_CALL(getContext()->urDdiTable.PhysicalMem.pfnRelease(
-                VirtualMemMaps[MappedPtr].first));
-            getContext()->logger.debug("urVirtualMemUnmap: {} ~ {}",
-                                       (void *)MappedPtr,
-                                       (void *)(MappedPtr + PageSize - 1));
+
+        std::scoped_lock<ur_mutex> Guard(CommitMutex);
+        // Retained again in the meantime
+        if (Chunk->RefCount[I].load() != 0 || !Chunk->isCommitted(I)) {
+            continue;
         }
+        UR_CALL(decommit(Chunk, Granule));
     }
 
     return UR_RESULT_SUCCESS;
 }
 
+ur_result_t ShadowMemoryGPU::decommit(GranuleChunk *Chunk, size_t Granule) {
+    const size_t CommitSize = GetCommitSize();
+    size_t I = Granule % GranuleChunk::Size;
+    uptr MappedPtr = ShadowBegin + Granule * CommitSize;
+
+    Chunk->Committed[I / 64].fetch_and(~(uint64_t(1) << (I % 64)),
+                                       std::memory_order_release);
+    UR_CALL(getContext()->urDdiTable.VirtualMem.pfnUnmap(
+        Context, (void *)MappedPtr, CommitSize));
+    UR_CALL(getContext()->urDdiTable.PhysicalMem.pfnRelease(
+        Chunk->PhysicalMem[I]));
+    Chunk->PhysicalMem[I] = nullptr;
+    getContext()->logger.debug("urVirtualMemUnmap: {} ~ {}", (void *)MappedPtr,
+                               (void *)(MappedPtr + CommitSize - 1));
+
+    return UR_RESULT_SUCCESS;
+}
+
+ur_result_t ShadowMemoryGPU::RetainShadow(std::shared_ptr<AllocInfo> AI) {
+    return retainRange(AI->AllocBegin, AI->AllocSize);
+}
+
+ur_result_t ShadowMemoryGPU::ReleaseShadow(std::shared_ptr<AllocInfo> AI) {
+    return releaseRange(AI->AllocBegin, AI->AllocSize);
+}
+
 uptr ShadowMemoryPVC::MemToShadow(uptr Ptr) {
     if (Ptr & 0xFF00000000000000ULL) { // Device USM
         return ShadowBegin + 0x80000000000ULL +
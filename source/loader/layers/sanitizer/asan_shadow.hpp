@@ -14,7 +14,9 @@
 
 #include "asan_allocator.hpp"
 #include "common.hpp"
-#include <unordered_set>
+
+#include <atomic>
+#include <memory>
 
 namespace ur_sanitizer_layer {
 
@@ -33,6 +35,24 @@ struct ShadowMemory {
     virtual ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr,
                                             uptr Size, u8 Value) = 0;
 
+    /// Makes sure the shadow of [Ptr, Ptr + Size) is backed by memory.
+    /// EnqueuePoisonShadow does this itself, EnqueueWriteShadow doesn't.
+    virtual ur_result_t MapShadow(ur_queue_handle_t, uptr, uptr) {
+        return UR_RESULT_SUCCESS;
+    }
+
+    /// Copies precomputed shadow bytes to the shadow of Ptr onwards. The copy
+    /// may be asynchronous, so ShadowBytes must stay alive until Queue is
+    /// finished.
+    virtual ur_result_t EnqueueWriteShadow(ur_queue_handle_t Queue, uptr Ptr,
+                                           const u8 *ShadowBytes,
+                                           size_t Count) = 0;
+
+    /// Keeps the shadow of AI committed until the matching ReleaseShadow.
+    virtual ur_result_t RetainShadow(std::shared_ptr<AllocInfo>) {
+        return UR_RESULT_SUCCESS;
+    }
+
     virtual ur_result_t ReleaseShadow(std::shared_ptr<AllocInfo>) {
         return UR_RESULT_SUCCESS;
     }
@@ -61,27 +81,70 @@ struct ShadowMemoryCPU final : public ShadowMemory {
     ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr,
                                     uptr Size, u8 Value) override;
 
+    ur_result_t EnqueueWriteShadow(ur_queue_handle_t Queue, uptr Ptr,
+                                   const u8 *ShadowBytes,
+                                   size_t Count) override;
+
     size_t GetShadowSize() override { return 0x80000000000ULL; }
 };
 
+/// The whole shadow range is reserved once in Setup() and committed on
+/// demand, in granules of at least 2MB. A granule stays committed while an
+/// allocation whose shadow overlaps it is retained; lookups of the committed
+/// bitmap and refcount updates don't take a lock, only committing and
+/// decommitting a granule does.
 struct ShadowMemoryGPU : public ShadowMemory {
     ShadowMemoryGPU(ur_context_handle_t Context, ur_device_handle_t Device)
         : ShadowMemory(Context, Device) {}
 
+    ~ShadowMemoryGPU() override;
+
     ur_result_t Setup() override;
 
     ur_result_t Destory() override;
     ur_result_t EnqueuePoisonShadow(ur_queue_handle_t Queue, uptr Ptr,
                                     uptr Size, u8 Value) override final;
 
+    ur_result_t MapShadow(ur_queue_handle_t Queue, uptr Ptr,
+                          uptr Size) override final;
+
+    ur_result_t EnqueueWriteShadow(ur_queue_handle_t Queue, uptr Ptr,
+                                   const u8 *ShadowBytes,
+                                   size_t Count) override final;
+
+    ur_result_t RetainShadow(std::shared_ptr<AllocInfo> AI) override final;
+
     ur_result_t ReleaseShadow(std::shared_ptr<AllocInfo> AI) override final;
 
-    ur_mutex VirtualMemMapsMutex;
+  private:
+    struct GranuleChunk {
+        static constexpr size_t Size = 4096;
+        std::atomic<uint64_t> Committed[Size / 64] = {};
+        std::atomic<uint32_t> RefCount[Size] = {};
+        // Guarded by CommitMutex
+        ur_physical_mem_handle_t PhysicalMem[Size] = {};
+
+        bool isCommitted(size_t I) const {
+            return Committed[I / 64].load(std::memory_order_acquire) &
+                   (uint64_t(1) << (I % 64));
+        }
+    };
+
+    size_t GetCommitSize();
+
+    GranuleChunk *getChunk(size_t Granule, bool Create);
+
+    ur_result_t retainRange(uptr Ptr, uptr Size);
+
+    ur_result_t releaseRange(uptr Ptr, uptr Size);
+
+    ur_result_t decommit(GranuleChunk *Chunk, size_t Granule);
+
+    ur_mutex CommitMutex;
+
+    size_t NumChunks = 0;
 
-    std::unordered_map<
-        uptr, std::pair<ur_physical_mem_handle_t,
-                        std::unordered_set<std::shared_ptr<AllocInfo>>>>
-        VirtualMemMaps;
+    std::unique_ptr<std::atomic<GranuleChunk *>[]> Chunks;
 };
 
 /// Shadow Memory layout of GPU PVC device
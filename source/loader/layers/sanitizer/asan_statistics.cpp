@@ -13,11 +13,89 @@
 #include "asan_statistics.hpp"
 #include "asan_interceptor.hpp"
 #include "ur_sanitizer_layer.hpp"
+#include "ur_sanitizer_utils.hpp"
 
+#include <array>
 #include <atomic>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <mutex>
 
 namespace ur_sanitizer_layer {
 
+namespace {
+
+// The percentiles reported by the latency histograms, so that the phases can
+// be compared with them
+constexpr size_t NumPercentiles = 7;
+constexpr double Percentiles[NumPercentiles] = {
+    50.0, 90.0, 99.0, 99.9, 99.99, 99.999, 99.9999};
+
+const char *PhaseNames[] = {
+    "alloc",       "free",          "quarantine",
+    "pre_launch",  "launch_info",   "shadow_update",
+    "post_launch", "kernel_wait",   "report_readback",
+};
+static_assert(std::size(PhaseNames) == static_cast<size_t>(AsanPhase::Count));
+
+// Durations of a phase in nanoseconds, counted in buckets of a sixteenth of a
+// power of two, so that percentiles are within about 6% of the exact ones
+struct PhaseHistogram {
+    uint64_t Count = 0;
+    uint64_t Sum = 0;
+    uint64_t Min = UINT64_MAX;
+    uint64_t Max = 0;
+    double SumSquares = 0.0;
+    std::map<uint32_t, uint64_t> Buckets;
+
+    void Record(uint64_t Value) {
+        Count++;
+        Sum += Value;
+        Min = std::min(Min, Value);
+        Max = std::max(Max, Value);
+        SumSquares += (double)Value * Value;
+
+        uint32_t Shift = 0;
+        while ((Value >> Shift) >= 32) {
+            Shift++;
+        }
+        Buckets[Shift * 16 + (uint32_t)(Value >> Shift)]++;
+    }
+
+    // The highest value of the bucket holding the given percentile
+    uint64_t ValueAtPercentile(double Percentile) const {
+        auto Target = std::max<uint64_t>(
+            1, (uint64_t)std::ceil(Percentile / 100.0 * Count));
+        uint64_t Seen = 0;
+        for (const auto &[Index, BucketCount] : Buckets) {
+            Seen += BucketCount;
+            if (Seen >= Target) {
+                uint32_t Shift = Index < 32 ? 0 : Index / 16 - 1;
+                uint64_t Mantissa = Index - Shift * 16;
+                return std::min(Max, ((Mantissa + 1) << Shift) - 1);
+            }
+        }
+        return Max;
+    }
+
+    uint64_t Mean() const { return Count ? Sum / Count : 0; }
+
+    uint64_t Stddev() const {
+        if (!Count) {
+            return 0;
+        }
+        double Mean = (double)Sum / Count;
+        return (uint64_t)std::sqrt(
+            std::max(0.0, SumSquares / Count - Mean * Mean));
+    }
+};
+
+using PhaseHistograms =
+    std::array<PhaseHistogram, static_cast<size_t>(AsanPhase::Count)>;
+
+} // namespace
+
 struct AsanStats {
     void UpdateUSMMalloced(uptr MallocedSize, uptr RedzoneSize);
     void UpdateUSMFreed(uptr FreedSize);
@@ -27,6 +105,9 @@ struct AsanStats {
     void UpdateShadowMalloced(uptr ShadowSize);
     void UpdateShadowFreed(uptr ShadowSize);
 
+    void UpdatePhase(AsanPhase Phase, ur_kernel_handle_t Kernel,
+                     uint64_t Nanoseconds);
+
     void Print(ur_context_handle_t Context);
 
   private:
@@ -40,13 +121,128 @@ struct AsanStats {
 
     double Overhead = 0.0;
 
+    ur_mutex PhaseMutex;
+    PhaseHistograms Phases;
+    // Indexed by kernel name, so that the launches of a kernel are counted
+    // together whichever handle they were made with
+    std::map<std::string, PhaseHistograms> KernelPhases;
+
     void UpdateOverhead();
+
+    void PrintPhases();
+    void ExportPhases(ur_context_handle_t Context, const std::string &Path);
 };
 
 void AsanStats::Print(ur_context_handle_t Context) {
     getContext()->logger.always("Stats: Context {}", (void *)Context);
     getContext()->logger.always("Stats:   peak memory overhead: {}%",
                                 Overhead * 100);
+
+    std::scoped_lock<ur_mutex> Guard(PhaseMutex);
+    PrintPhases();
+    const auto &ExportPath =
+        getContext()->interceptor->getOptions().StatsExportPath;
+    if (!ExportPath.empty()) {
+        ExportPhases(Context, ExportPath);
+    }
+}
+
+void AsanStats::UpdatePhase(AsanPhase Phase, ur_kernel_handle_t Kernel,
+                            uint64_t Nanoseconds) {
+    // Queried before taking the lock, as it calls into the adapter
+    std::string KernelName = Kernel ? GetKernelName(Kernel) : std::string();
+
+    std::scoped_lock<ur_mutex> Guard(PhaseMutex);
+    Phases[static_cast<size_t>(Phase)].Record(Nanoseconds);
+    if (Kernel) {
+        KernelPhases[KernelName][static_cast<size_t>(Phase)].Record(
+            Nanoseconds);
+    }
+}
+
+// Prints the phases as the latency histograms are printed, the phases of
+// each kernel being named after the kernel
+void AsanStats::PrintPhases() {
+    auto &Logger = getContext()->logger;
+    Logger.always("Stats:   phase latency:");
+    Logger.always("name,mean,p{},p{},p{},p{},p{},p{},p{},count,sum,min,max,"
+                  "stdev,unit",
+                  Percentiles[0], Percentiles[1], Percentiles[2],
+                  Percentiles[3], Percentiles[4], Percentiles[5],
+                  Percentiles[6]);
+
+    auto PrintRows = [&](const std::string &Prefix,
+                         const PhaseHistograms &Histograms) {
+        auto F = groupDigits<int64_t>;
+        for (size_t I = 0; I < Histograms.size(); ++I) {
+            const auto &H = Histograms[I];
+            if (!H.Count) {
+                continue;
+            }
+            Logger.always("{}{},{},{},{},{},{},{},{},{},{},{},{},{},{},ns",
+                          Prefix, PhaseNames[I], F(H.Mean()),
+                          F(H.ValueAtPercentile(Percentiles[0])),
+                          F(H.ValueAtPercentile(Percentiles[1])),
+                          F(H.ValueAtPercentile(Percentiles[2])),
+                          F(H.ValueAtPercentile(Percentiles[3])),
+                          F(H.ValueAtPercentile(Percentiles[4])),
+                          F(H.ValueAtPercentile(Percentiles[5])),
+                          F(H.ValueAtPercentile(Percentiles[6])), F(H.Count),
+                          F(H.Sum), F(H.Min), F(H.Max), H.Stddev());
+        }
+    };
+
+    PrintRows("asan.", Phases);
+    for (const auto &[Name, Histograms] : KernelPhases) {
+        PrintRows("asan." + Name + ".", Histograms);
+    }
+}
+
+// Writes the phases as UR_LATENCY_EXPORT writes the latency histograms, with
+// the context they belong to. The file is replaced by the first context
+// printed and the others are appended to it, one document each.
+void AsanStats::ExportPhases(ur_context_handle_t Context,
+                             const std::string &Path) {
+    static std::once_flag Truncated;
+    auto Mode = std::ios::app;
+    std::call_once(Truncated, [&] { Mode = std::ios::trunc; });
+
+    auto Now = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                   std::chrono::system_clock::now().time_since_epoch())
+                   .count();
+    std::ofstream Out(Path, std::ios::out | Mode);
+    Out << "{\"pid\": " << ur_getpid() << ", \"context\": \""
+        << (void *)Context << "\", \"timestamp_ns\": " << Now
+        << ", \"unit\": \"ns\", \"histograms\": [";
+    bool First = true;
+    auto WriteHistograms = [&](const std::string &Prefix,
+                               const PhaseHistograms &Histograms) {
+        for (size_t I = 0; I < Histograms.size(); ++I) {
+            const auto &H = Histograms[I];
+            if (!H.Count) {
+                continue;
+            }
+            Out << (First ? "" : ",") << "\n  {\"name\": \"" << Prefix
+                << PhaseNames[I] << "\", \"count\": " << H.Count
+                << ", \"min\": " << H.Min << ", \"max\": " << H.Max
+                << ", \"mean\": " << H.Mean()
+                << ", \"stddev\": " << H.Stddev() << ", \"percentiles\": {";
+            for (size_t P = 0; P < NumPercentiles; ++P) {
+                Out << (P ? ", " : "") << "\"" << Percentiles[P]
+                    << "\": " << H.ValueAtPercentile(Percentiles[P]);
+            }
+            Out << "}}";
+            First = false;
+        }
+    };
+    WriteHistograms("asan.", Phases);
+    for (const auto &[Name, Histograms] : KernelPhases) {
+        WriteHistograms("asan." + Name + ".", Histograms);
+    }
+    Out << "\n]}\n";
+    if (!Out) {
+        getContext()->logger.error("Failed to write stats export to {}", Path);
+    }
 }
 
 void AsanStats::UpdateUSMMalloced(uptr MallocedSize, uptr RedzoneSize) {
@@ -129,6 +325,13 @@ void AsanStatsWrapper::UpdateShadowFreed(uptr ShadowSize) {
     }
 }
 
+void AsanStatsWrapper::UpdatePhase(AsanPhase Phase, ur_kernel_handle_t Kernel,
+                                   uint64_t Nanoseconds) {
+    if (Stat) {
+        Stat->UpdatePhase(Phase, Kernel, Nanoseconds);
+    }
+}
+
 void AsanStatsWrapper::Print(ur_context_handle_t Context) {
     if (Stat) {
         Stat->Print(Context);
@@ -143,4 +346,23 @@ AsanStatsWrapper::AsanStatsWrapper() : Stat(nullptr) {
 
 AsanStatsWrapper::~AsanStatsWrapper() { delete Stat; }
 
+AsanStatsWrapper::PhaseTimer::PhaseTimer(AsanStatsWrapper &Stats,
+                                         AsanPhase Phase,
+                                         ur_kernel_handle_t Kernel)
+    : Stats(Stats), Phase(Phase), Kernel(Kernel) {
+    if (Stats.Stat) {
+        Begin = std::chrono::steady_clock::now();
+    }
+}
+
+AsanStatsWrapper::PhaseTimer::~PhaseTimer() {
+    if (Stats.Stat) {
+        auto Elapsed = std::chrono::steady_clock::now() - Begin;
+        Stats.UpdatePhase(
+            Phase, Kernel,
+            std::chrono::duration_cast<std::chrono::nanoseconds>(Elapsed)
+                .count());
+    }
+}
+
 } // namespace ur_sanitizer_layer
@@ -14,10 +14,31 @@
 
 #include "common.hpp"
 
+#include <chrono>
+
 namespace ur_sanitizer_layer {
 
 struct AsanStats;
 
+// Where the sanitizer spends its time, the launch phases being also broken
+// down by kernel
+enum class AsanPhase {
+    Alloc,
+    Free,
+    // Releasing allocations evicted from the quarantine
+    Quarantine,
+    PreLaunch,
+    // Validating the arguments of a kernel and setting its launch info
+    LaunchInfo,
+    // Poisoning the shadow memory of the allocations before a launch
+    ShadowUpdate,
+    PostLaunch,
+    // Waiting for the kernel to read its report at the launch
+    KernelWait,
+    ReportReadback,
+    Count
+};
+
 struct AsanStatsWrapper {
 
     AsanStatsWrapper();
@@ -30,8 +51,28 @@ struct AsanStatsWrapper {
     void UpdateShadowMalloced(uptr ShadowSize);
     void UpdateShadowFreed(uptr ShadowSize);
 
+    void UpdatePhase(AsanPhase Phase, ur_kernel_handle_t Kernel,
+                     uint64_t Nanoseconds);
+
     void Print(ur_context_handle_t Context);
 
+    // Measures the time spent in a phase during its lifetime, attributed to
+    // Kernel too if it isn't null
+    struct PhaseTimer {
+        PhaseTimer(AsanStatsWrapper &Stats, AsanPhase Phase,
+                   ur_kernel_handle_t Kernel = nullptr);
+        ~PhaseTimer();
+
+        PhaseTimer(const PhaseTimer &) = delete;
+        PhaseTimer &operator=(const PhaseTimer &) = delete;
+
+      private:
+        AsanStatsWrapper &Stats;
+        AsanPhase Phase;
+        ur_kernel_handle_t Kernel;
+        std::chrono::steady_clock::time_point Begin;
+    };
+
   private:
     AsanStats *Stat;
 };
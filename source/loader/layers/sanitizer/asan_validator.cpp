@@ -38,8 +38,8 @@ ValidateUSMResult ValidateUSMPointer(ur_context_handle_t Context,
                                      ur_device_handle_t Device, uptr Ptr) {
     assert(Ptr != 0 && "Don't validate nullptr here");
 
-    auto AllocInfoItOp = getContext()->interceptor->findAllocInfoByAddress(Ptr);
-    if (!AllocInfoItOp) {
+    auto AllocInfo = getContext()->interceptor->findAllocInfoByAddress(Ptr);
+    if (!AllocInfo) {
         auto DI = getContext()->interceptor->getDeviceInfo(Device);
         bool IsSupportSharedSystemUSM = DI->IsSupportSharedSystemUSM;
         if (IsSupportSharedSystemUSM) {
@@ -49,8 +49,6 @@ ValidateUSMResult ValidateUSMPointer(ur_context_handle_t Context,
         return ValidateUSMResult::fail(ValidateUSMResult::MAYBE_HOST_POINTER);
     }
 
-    auto AllocInfo = AllocInfoItOp.value()->second;
-
     if (AllocInfo->Context != Context) {
         return ValidateUSMResult::fail(ValidateUSMResult::BAD_CONTEXT,
                                        AllocInfo);
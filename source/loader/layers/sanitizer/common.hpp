@@ -159,6 +159,10 @@ bool IsInASanContext();
 uptr MmapNoReserve(uptr Addr, uptr Size);
 bool Munmap(uptr Addr, uptr Size);
 bool DontCoredumpRange(uptr Addr, uptr Size);
+/// Zeroes a range of memory mapped with MmapNoReserve, dropping its whole
+/// pages instead of writing them when it's large enough, so that they no
+/// longer take memory. Returns whether pages were dropped.
+bool ZeroMmapRange(uptr Addr, uptr Size);
 
 void *GetMemFunctionPointer(const char *);
 
@@ -18,11 +18,8 @@ StackTrace GetCurrentBacktrace() {
     BacktraceFrame Frames[MAX_BACKTRACE_FRAMES];
     int FrameCount = backtrace(Frames, MAX_BACKTRACE_FRAMES);
 
-    StackTrace Stack;
-    Stack.stack =
-        std::vector<BacktraceFrame>(&Frames[0], &Frames[FrameCount - 1]);
-
-    return Stack;
+    // Drop the outermost frame
+    return StackTrace(Frames, FrameCount > 0 ? FrameCount - 1 : 0);
 }
 
 char **GetBacktraceSymbols(const std::vector<BacktraceFrame> &BacktraceFrames) {
@@ -17,6 +17,7 @@
 #include <asm/param.h>
 #include <cxxabi.h>
 #include <dlfcn.h>
+#include <cstring>
 #include <gnu/lib-names.h>
 #include <string>
 #include <sys/mman.h>
@@ -43,6 +44,24 @@ bool DontCoredumpRange(uptr Addr, uptr Size) {
     return madvise((void *)Addr, Size, MADV_DONTDUMP) == 0;
 }
 
+bool ZeroMmapRange(uptr Addr, uptr Size) {
+    uptr Begin = RoundUpTo(Addr, EXEC_PAGESIZE);
+    uptr End = RoundDownTo(Addr + Size, EXEC_PAGESIZE);
+    // The syscall costs more than clearing a few pages
+    if (End <= Begin || End - Begin < 16 * EXEC_PAGESIZE) {
+        memset((void *)Addr, 0, Size);
+        return false;
+    }
+    // Pages of a private anonymous mapping read as zero once dropped
+    if (madvise((void *)Begin, End - Begin, MADV_DONTNEED) != 0) {
+        memset((void *)Addr, 0, Size);
+        return false;
+    }
+    memset((void *)Addr, 0, Begin - Addr);
+    memset((void *)End, 0, Addr + Size - End);
+    return true;
+}
+
 void *GetMemFunctionPointer(const char *FuncName) {
     void *handle = dlopen(LIBC_SO, RTLD_LAZY | RTLD_NOLOAD);
     if (!handle) {
@@ -13,6 +13,12 @@
 #include "stacktrace.hpp"
 #include "ur_sanitizer_layer.hpp"
 
+#include <algorithm>
+#include <deque>
+#include <mutex>
+#include <sstream>
+#include <unordered_map>
+
 extern "C" {
 
 __attribute__((weak)) void SymbolizeCode(const char *ModuleName,
@@ -77,58 +83,186 @@ SourceInfo ParseSymbolizerOutput(const std::string &Output) {
     return Info;
 }
 
-} // namespace
+/// Stores each unique backtrace once. Ids encode the shard in the low bits
+/// and the index of the backtrace in that shard, plus one, above them.
+class StackDepot {
+  public:
+    uint32_t put(const BacktraceFrame *Frames, size_t Count) {
+        if (Count == 0) {
+            return 0;
+        }
+        size_t Hash = Count;
+        for (size_t I = 0; I < Count; ++I) {
+            Hash ^= std::hash<BacktraceFrame>{}(Frames[I]) + 0x9e3779b9 +
+                    (Hash << 6) + (Hash >> 2);
+        }
+        size_t ShardIndex = Hash % NumShards;
+        auto &Shard = Shards[ShardIndex];
 
-void StackTrace::print() const {
-    if (!stack.size()) {
-        getContext()->logger.always("  failed to acquire backtrace");
+        std::scoped_lock<ur_mutex> Guard(Shard.Mutex);
+        auto [Begin, End] = Shard.Index.equal_range(Hash);
+        for (auto It = Begin; It != End; ++It) {
+            const auto &Stack = Shard.Stacks[It->second];
+            if (std::equal(Stack.begin(), Stack.end(), Frames,
+                           Frames + Count)) {
+                return makeId(ShardIndex, It->second);
+            }
+        }
+        Shard.Stacks.emplace_back(Frames, Frames + Count);
+        auto Index = static_cast<uint32_t>(Shard.Stacks.size() - 1);
+        Shard.Index.emplace(Hash, Index);
+        return makeId(ShardIndex, Index);
     }
 
-    unsigned index = 0;
+    std::vector<BacktraceFrame> get(uint32_t Id) {
+        if (Id == 0) {
+            return {};
+        }
+        auto &Shard = Shards[Id % NumShards];
+        std::scoped_lock<ur_mutex> Guard(Shard.Mutex);
+        return Shard.Stacks[Id / NumShards - 1];
+    }
 
-    char **BacktraceSymbols = GetBacktraceSymbols(stack);
+  private:
+    static constexpr size_t NumShards = 16;
 
-    for (size_t i = 0; i < stack.size(); i++) {
-        BacktraceInfo BI = BacktraceSymbols[i];
+    static uint32_t makeId(size_t ShardIndex, uint32_t Index) {
+        return static_cast<uint32_t>((Index + 1) * NumShards + ShardIndex);
+    }
 
-        // Skip runtime modules
-        if (Contains(BI, "libsycl.so") ||
-            Contains(BI, "libpi_unified_runtime.so") ||
-            Contains(BI, "libur_loader.so")) {
-            continue;
-        }
+    struct Shard {
+        ur_mutex Mutex;
+        std::unordered_multimap<size_t, uint32_t> Index;
+        // Elements of a deque don't move when it grows
+        std::deque<std::vector<BacktraceFrame>> Stacks;
+    };
+
+    Shard Shards[NumShards];
+};
+
+StackDepot &GetStackDepot() {
+    static StackDepot Depot;
+    return Depot;
+}
+
+/// How a frame is printed, which only depends on its PC
+struct FrameLine {
+    enum { SKIPPED, EMPTY, SYMBOLIZED, RAW } Kind;
+    std::string Text;
+};
+
+FrameLine SymbolizeFrame(const BacktraceInfo &BI) {
+    // Skip runtime modules
+    if (Contains(BI, "libsycl.so") ||
+        Contains(BI, "libpi_unified_runtime.so") ||
+        Contains(BI, "libur_loader.so")) {
+        return {FrameLine::SKIPPED, {}};
+    }
 
-        if (&SymbolizeCode != nullptr) {
-            std::string Result;
-            std::string ModuleName;
-            uptr Offset;
-            ParseBacktraceInfo(BI, ModuleName, Offset);
-            size_t ResultSize = 0;
-            SymbolizeCode(ModuleName.c_str(), Offset, nullptr, 0, &ResultSize);
-            if (ResultSize) {
-                std::vector<char> ResultVector(ResultSize);
-                SymbolizeCode(ModuleName.c_str(), Offset, ResultVector.data(),
-                              ResultSize, nullptr);
-                std::string Result((char *)ResultVector.data());
-                SourceInfo SrcInfo = ParseSymbolizerOutput(Result);
-                if (SrcInfo.file != "??") {
-                    getContext()->logger.always(" #{} in {} {}:{}:{}", index,
-                                                SrcInfo.function, SrcInfo.file,
-                                                SrcInfo.line, SrcInfo.column);
-                } else {
-                    getContext()->logger.always(" #{} in {} ({}+{})", index,
-                                                SrcInfo.function, ModuleName,
-                                                (void *)Offset);
-                }
+    if (&SymbolizeCode == nullptr) {
+        return {FrameLine::RAW, BI};
+    }
+
+    std::string ModuleName;
+    uptr Offset;
+    ParseBacktraceInfo(BI, ModuleName, Offset);
+    size_t ResultSize = 0;
+    SymbolizeCode(ModuleName.c_str(), Offset, nullptr, 0, &ResultSize);
+    if (!ResultSize) {
+        return {FrameLine::EMPTY, {}};
+    }
+    std::vector<char> ResultVector(ResultSize);
+    SymbolizeCode(ModuleName.c_str(), Offset, ResultVector.data(), ResultSize,
+                  nullptr);
+    std::string Result((char *)ResultVector.data());
+    SourceInfo SrcInfo = ParseSymbolizerOutput(Result);
+
+    std::stringstream SS;
+    if (SrcInfo.file != "??") {
+        SS << "in " << SrcInfo.function << " " << SrcInfo.file << ":"
+           << SrcInfo.line << ":" << SrcInfo.column;
+    } else {
+        SS << "in " << SrcInfo.function << " (" << ModuleName << "+"
+           << (void *)Offset << ")";
+    }
+    return {FrameLine::SYMBOLIZED, SS.str()};
+}
+
+/// Symbolizes Frames, running the symbolizer only for PCs that weren't seen
+/// in an earlier report.
+std::vector<FrameLine>
+SymbolizeFrames(const std::vector<BacktraceFrame> &Frames) {
+    static ur_mutex CacheMutex;
+    static std::unordered_map<BacktraceFrame, FrameLine> Cache;
+
+    std::vector<FrameLine> Lines(Frames.size());
+    std::vector<BacktraceFrame> Missing;
+    std::vector<size_t> MissingIndex;
+    {
+        std::scoped_lock<ur_mutex> Guard(CacheMutex);
+        for (size_t I = 0; I < Frames.size(); ++I) {
+            auto It = Cache.find(Frames[I]);
+            if (It != Cache.end()) {
+                Lines[I] = It->second;
+            } else {
+                Missing.push_back(Frames[I]);
+                MissingIndex.push_back(I);
             }
-        } else {
-            getContext()->logger.always("  #{} {}", index, BI);
         }
-        ++index;
     }
-    getContext()->logger.always("");
+    if (Missing.empty()) {
+        return Lines;
+    }
 
+    char **BacktraceSymbols = GetBacktraceSymbols(Missing);
+    std::vector<FrameLine> MissingLines;
+    for (size_t I = 0; I < Missing.size(); ++I) {
+        MissingLines.push_back(SymbolizeFrame(BacktraceSymbols[I]));
+    }
     free(BacktraceSymbols);
+
+    std::scoped_lock<ur_mutex> Guard(CacheMutex);
+    for (size_t I = 0; I < Missing.size(); ++I) {
+        Lines[MissingIndex[I]] = MissingLines[I];
+        Cache.emplace(Missing[I], std::move(MissingLines[I]));
+    }
+    return Lines;
+}
+
+} // namespace
+
+StackTrace::StackTrace(const BacktraceFrame *Frames, size_t Count)
+    : id(GetStackDepot().put(Frames, Count)) {}
+
+std::vector<BacktraceFrame> StackTrace::frames() const {
+    return GetStackDepot().get(id);
+}
+
+void StackTrace::print() const {
+    auto Frames = frames();
+    if (Frames.empty()) {
+        getContext()->logger.always("  failed to acquire backtrace");
+        getContext()->logger.always("");
+        return;
+    }
+
+    unsigned index = 0;
+    for (const auto &Line : SymbolizeFrames(Frames)) {
+        switch (Line.Kind) {
+        case FrameLine::SKIPPED:
+            continue;
+        case FrameLine::EMPTY:
+            break;
+        case FrameLine::SYMBOLIZED:
+            getContext()->logger.always(" #{} {}", index, Line.Text);
+            break;
+        case FrameLine::RAW:
+            getContext()->logger.always("  #{} {}", index, Line.Text);
+            break;
+        }
+        ++index;
+    }
+    getContext()->logger.always("");
 }
 
 } // namespace ur_sanitizer_layer
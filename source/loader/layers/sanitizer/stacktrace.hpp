@@ -20,8 +20,15 @@ namespace ur_sanitizer_layer {
 
 constexpr size_t MAX_BACKTRACE_FRAMES = 64;
 
+/// Handle to a backtrace in the stack depot. Identical backtraces, e.g. of
+/// every allocation made at the same call site, share a single copy.
 struct StackTrace {
-    std::vector<BacktraceFrame> stack;
+    StackTrace() = default;
+    StackTrace(const BacktraceFrame *Frames, size_t Count);
+
+    uint32_t id = 0; // 0: no backtrace
+
+    std::vector<BacktraceFrame> frames() const;
 
     void print() const;
 };
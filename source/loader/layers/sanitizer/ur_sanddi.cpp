@@ -328,6 +328,37 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
     return UR_RESULT_SUCCESS;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
+) {
+    auto pfnProgramBuild = getContext()->urDdiTable.Program.pfnBuild;
+    auto pfnEventsWait = getContext()->urDdiTable.Enqueue.pfnEventsWait;
+
+    if (nullptr == pfnProgramBuild || nullptr == pfnEventsWait) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urProgramBuildAsyncExp");
+
+    // The program is registered once built, which a build in the background
+    // would leave to later, so the build is made before returning
+    auto hContext = GetContext(hProgram);
+    UR_CALL(pfnProgramBuild(hContext, hProgram, pOptions));
+    UR_CALL(getContext()->interceptor->registerProgram(hContext, hProgram));
+
+    UR_CALL(pfnEventsWait(hQueue, 0, nullptr, phEvent));
+
+    return UR_RESULT_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urProgramLink
 __urdlllocal ur_result_t UR_APICALL urProgramLink(
@@ -451,27 +482,38 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
 
     getContext()->logger.debug("==== urEnqueueKernelLaunch");
 
-    USMLaunchInfo LaunchInfo(GetContext(hQueue), GetDevice(hQueue),
-                             pGlobalWorkSize, pLocalWorkSize, pGlobalWorkOffset,
-                             workDim);
-    UR_CALL(LaunchInfo.initialize());
+    // Kernels that weren't built with the sanitizer don't take a launch info
+    if (!getContext()->interceptor->getKernelInfo(hKernel)->IsInstrumented) {
+        UR_CALL(getContext()->interceptor->preLaunchUninstrumentedKernel(
+            hKernel, hQueue));
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    auto LaunchInfo = std::make_shared<USMLaunchInfo>(
+        GetContext(hQueue), GetDevice(hQueue), pGlobalWorkSize, pLocalWorkSize,
+        pGlobalWorkOffset, workDim);
+    UR_CALL(LaunchInfo->initialize());
 
     UR_CALL(getContext()->interceptor->preLaunchKernel(hKernel, hQueue,
-                                                       LaunchInfo));
+                                                       *LaunchInfo));
 
     ur_event_handle_t hEvent{};
     ur_result_t result =
         pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
-                        pGlobalWorkSize, LaunchInfo.LocalWorkSize.data(),
+                        pGlobalWorkSize, LaunchInfo->LocalWorkSize.data(),
                         numEventsInWaitList, phEventWaitList, &hEvent);
 
     if (result == UR_RESULT_SUCCESS) {
-        UR_CALL(getContext()->interceptor->postLaunchKernel(hKernel, hQueue,
-                                                            LaunchInfo));
+        UR_CALL(getContext()->interceptor->postLaunchKernel(
+            hKernel, hQueue, hEvent, LaunchInfo));
     }
 
     if (phEvent) {
         *phEvent = hEvent;
+    } else if (hEvent) {
+        getContext()->urDdiTable.Event.pfnRelease(hEvent);
     }
 
     return result;
@@ -1478,6 +1520,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
 
     {
         auto KI = getContext()->interceptor->getKernelInfo(hKernel);
+        if (!KI->IsInstrumented) {
+            return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+        }
         std::scoped_lock<ur_shared_mutex> Guard(KI->Mutex);
         // TODO: get local variable alignment
         auto argSizeWithRZ = GetSizeAndRedzoneSizeForLocal(
@@ -1525,6 +1570,149 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urKernelSetArgsExp (numArgs={})",
+                               numArgs);
+
+    // Buffers, local arguments and pointers are tracked by the intercepts of
+    // the single argument entry-points, so the batch is split into them
+    for (uint32_t i = 0; i < numArgs; i++) {
+        const auto &Arg = pArgs[i];
+        switch (Arg.type) {
+        case UR_EXP_KERNEL_ARG_TYPE_VALUE:
+            UR_CALL(ur_sanitizer_layer::urKernelSetArgValue(
+                hKernel, Arg.index, Arg.size, nullptr, Arg.value.value));
+            break;
+        case UR_EXP_KERNEL_ARG_TYPE_POINTER:
+            UR_CALL(ur_sanitizer_layer::urKernelSetArgPointer(
+                hKernel, Arg.index, nullptr, Arg.value.pointer));
+            break;
+        case UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ: {
+            ur_mem_flags_t Flags = Arg.value.memObjTuple.flags;
+            ur_kernel_arg_mem_obj_properties_t Properties = {
+                UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+                Flags ? Flags : UR_MEM_FLAG_READ_WRITE};
+            UR_CALL(ur_sanitizer_layer::urKernelSetArgMemObj(
+                hKernel, Arg.index, &Properties, Arg.value.memObjTuple.hMem));
+            break;
+        }
+        case UR_EXP_KERNEL_ARG_TYPE_LOCAL:
+            UR_CALL(ur_sanitizer_layer::urKernelSetArgLocal(
+                hKernel, Arg.index, Arg.size, nullptr));
+            break;
+        default:
+            UR_CALL(pfnSetArgsExp(hKernel, 1, &Arg));
+            break;
+        }
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueKernelLaunchMultiExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
+) {
+    getContext()->logger.debug(
+        "==== urEnqueueKernelLaunchMultiExp (numLaunches={})", numLaunches);
+
+    // Each launch has its shadow memory prepared and its reports checked by
+    // the intercept of the single launch, so the batch is split into them
+    for (uint32_t i = 0; i < numLaunches; i++) {
+        const auto &Launch = pLaunches[i];
+        if (Launch.numArgs) {
+            UR_CALL(ur_sanitizer_layer::urKernelSetArgsExp(
+                Launch.hKernel, Launch.numArgs, Launch.pArgs));
+        }
+        UR_CALL(ur_sanitizer_layer::urEnqueueKernelLaunch(
+            Launch.hQueue, Launch.hKernel, Launch.workDim,
+            Launch.pGlobalWorkOffset, Launch.pGlobalWorkSize,
+            Launch.pLocalWorkSize, Launch.numEventsInWaitList,
+            Launch.phEventWaitList, Launch.phEvent));
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueFinish
+__urdlllocal ur_result_t UR_APICALL urQueueFinish(
+    ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
+) {
+    auto pfnFinish = getContext()->urDdiTable.Queue.pfnFinish;
+
+    if (nullptr == pfnFinish) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urQueueFinish");
+
+    UR_CALL(pfnFinish(hQueue));
+    UR_CALL(getContext()->interceptor->checkDeferredReports(hQueue, true));
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueRelease
+__urdlllocal ur_result_t UR_APICALL urQueueRelease(
+    ur_queue_handle_t hQueue ///< [in][release] handle of the queue object to release
+) {
+    auto pfnRelease = getContext()->urDdiTable.Queue.pfnRelease;
+
+    if (nullptr == pfnRelease) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urQueueRelease");
+
+    // The handle may be destroyed and reused for another queue
+    UR_CALL(getContext()->interceptor->checkDeferredReports(hQueue, true));
+    UR_CALL(getContext()->interceptor->eraseShadowScratch(hQueue));
+
+    return pfnRelease(hQueue);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWait
+__urdlllocal ur_result_t UR_APICALL urEventWait(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
+                        ///< completion
+) {
+    auto pfnWait = getContext()->urDdiTable.Event.pfnWait;
+
+    if (nullptr == pfnWait) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    getContext()->logger.debug("==== urEventWait");
+
+    UR_CALL(pfnWait(numEvents, phEventWaitList));
+    UR_CALL(getContext()->interceptor->checkDeferredReports(nullptr, false));
+
+    return UR_RESULT_SUCCESS;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Global table
 ///        with current process' addresses
@@ -1664,6 +1852,36 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelProcAddrTable(
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's KernelExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_kernel_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnSetArgsExp = ur_sanitizer_layer::urKernelSetArgsExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Mem table
 ///        with current process' addresses
 ///
@@ -1725,6 +1943,7 @@ __urdlllocal ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
 
     pDdiTable->pfnBuildExp = ur_sanitizer_layer::urProgramBuildExp;
     pDdiTable->pfnLinkExp = ur_sanitizer_layer::urProgramLinkExp;
+    pDdiTable->pfnBuildAsyncExp = ur_sanitizer_layer::urProgramBuildAsyncExp;
 
     return result;
 }
@@ -1771,6 +1990,37 @@ __urdlllocal ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
     return result;
 }
 ///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EnqueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_enqueue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnKernelLaunchMultiExp =
+        ur_sanitizer_layer::urEnqueueKernelLaunchMultiExp;
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's USM table
 ///        with current process' addresses
 ///
@@ -1804,6 +2054,69 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Queue table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnFinish = ur_sanitizer_layer::urQueueFinish;
+    pDdiTable->pfnRelease = ur_sanitizer_layer::urQueueRelease;
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Event table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEventProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(ur_sanitizer_layer::getContext()->version) !=
+            UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(ur_sanitizer_layer::getContext()->version) >
+            UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    pDdiTable->pfnWait = ur_sanitizer_layer::urEventWait;
+
+    return result;
+}
+
 ur_result_t context_t::init(ur_dditable_t *dditable,
                             const std::set<std::string> &enabledLayerNames,
                             [[maybe_unused]] codeloc_data codelocData) {
@@ -1861,6 +2174,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Kernel);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetKernelExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->KernelExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_sanitizer_layer::urGetMemProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Mem);
@@ -1876,11 +2194,26 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Enqueue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetEnqueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EnqueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_sanitizer_layer::urGetUSMProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->USM);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetQueueProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Queue);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_sanitizer_layer::urGetEventProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->Event);
+    }
+
     return result;
 }
 
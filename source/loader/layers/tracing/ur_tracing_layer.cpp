@@ -11,11 +11,17 @@
  */
 #include "ur_tracing_layer.hpp"
 #include "ur_api.h"
+#include "ur_print.hpp"
 #include "ur_util.hpp"
 #include "xpti/xpti_data_types.h"
 #include "xpti/xpti_trace_framework.h"
+#include <algorithm>
+#include <array>
 #include <atomic>
+#include <chrono>
+#include <map>
 #include <optional>
+#include <regex>
 #include <sstream>
 
 namespace ur_tracing_layer {
@@ -40,6 +46,78 @@ static std::shared_ptr<XptiContextManager> xptiContextManagerGet() {
 }
 static thread_local xpti_td *activeEvent;
 
+static uint64_t timestampNs() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+               std::chrono::steady_clock::now().time_since_epoch())
+        .count();
+}
+
+struct event_record_t {
+    uint16_t trace_type;
+    uint32_t id;
+    const char *name;
+    ur_result_t result;
+    uint64_t instance;
+    uint64_t timestamp;
+    xpti_td *event;
+};
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Single-producer single-consumer ring of trace records. The owning
+/// thread pushes, the drain thread pops.
+struct event_ring_t {
+    static constexpr size_t capacity = 4096;
+    static_assert((capacity & (capacity - 1)) == 0);
+
+    explicit event_ring_t(uint64_t generation) : generation(generation) {}
+
+    bool push(const event_record_t &record) {
+        auto h = head.load(std::memory_order_relaxed);
+        if (h - tail.load(std::memory_order_acquire) == capacity) {
+            return false;
+        }
+        records[h & (capacity - 1)] = record;
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+
+    template <typename F> size_t pop_all(F &&f) {
+        auto t = tail.load(std::memory_order_relaxed);
+        auto h = head.load(std::memory_order_acquire);
+        for (auto i = t; i != h; ++i) {
+            f(records[i & (capacity - 1)]);
+        }
+        tail.store(h, std::memory_order_release);
+        return h - t;
+    }
+
+    bool empty() const {
+        return head.load(std::memory_order_acquire) ==
+               tail.load(std::memory_order_acquire);
+    }
+
+    const uint64_t generation;
+    std::atomic<bool> orphaned{false};
+    alignas(64) std::atomic<size_t> head{0};
+    alignas(64) std::atomic<size_t> tail{0};
+    std::array<event_record_t, capacity> records;
+};
+
+// The tracing context can be recreated between loader init and teardown, so
+// rings are tagged with the context generation they were registered with.
+static std::atomic<uint64_t> contextGeneration{0};
+static thread_local uint64_t localGeneration = 0;
+
+struct local_ring_holder_t {
+    std::shared_ptr<event_ring_t> ring;
+    ~local_ring_holder_t() {
+        if (ring) {
+            ring->orphaned = true;
+        }
+    }
+};
+static thread_local local_ring_holder_t localRing;
+
 ///////////////////////////////////////////////////////////////////////////////
 context_t::context_t() : logger(logger::create_logger("tracing", true, true)) {
     this->xptiContextManager = xptiContextManagerGet();
@@ -49,6 +127,116 @@ context_t::context_t() : logger(logger::create_logger("tracing", true, true)) {
     streamv << STREAM_VER_MAJOR << "." << STREAM_VER_MINOR;
     xptiInitialize(CALL_STREAM_NAME, STREAM_VER_MAJOR, STREAM_VER_MINOR,
                    streamv.str().data());
+    // Subscribers register their callbacks from xptiInitialize
+    subscribed = xptiCheckTraceEnabled(
+        call_stream_id,
+        (uint16_t)xpti::trace_point_type_t::function_with_args_begin);
+
+    parseOptions();
+
+    generation = ++contextGeneration;
+    if (buffered) {
+        logger.info("tracing layer running in buffered mode");
+        drainThread = std::thread([this] { drainLoop(); });
+    }
+}
+
+void context_t::parseOptions() {
+    std::optional<EnvVarMap> options;
+    try {
+        options = getenv_to_map("UR_LAYER_TRACING_OPTIONS");
+    } catch (const std::invalid_argument &e) {
+        logger.error("{}", e.what());
+    }
+    if (!options) {
+        return;
+    }
+
+    for (auto &[key, values] : *options) {
+        if (key == "buffered") {
+            buffered = values.front() == "1" || values.front() == "true";
+        } else if (key == "sample") {
+            try {
+                sampleRate = std::max<uint64_t>(std::stoull(values.front()), 1);
+            } catch (const std::exception &) {
+                logger.error("invalid tracing sample rate {}", values.front());
+            }
+        } else if (key == "functions") {
+            filterFunctions(values);
+        } else if (key == "codeloc") {
+            parseCodelocPolicy(values);
+        } else {
+            logger.warning("unknown UR_LAYER_TRACING_OPTIONS option {}", key);
+        }
+    }
+}
+
+void context_t::parseCodelocPolicy(const std::vector<std::string> &values) {
+    auto &policy = values.front();
+    if (policy == "always") {
+        codelocPolicy = codeloc_policy_t::always;
+    } else if (policy == "never") {
+        codelocPolicy = codeloc_policy_t::never;
+    } else if (policy == "subscribed") {
+        codelocPolicy = codeloc_policy_t::subscribed;
+    } else if (policy == "sample" && values.size() == 2) {
+        try {
+            codelocSampleRate = std::max<uint64_t>(std::stoull(values[1]), 1);
+            codelocPolicy = codeloc_policy_t::sampled;
+        } catch (const std::exception &) {
+            logger.error("invalid code location sample rate {}", values[1]);
+        }
+    } else {
+        logger.error("invalid code location policy {}", policy);
+    }
+}
+
+// The callback usually walks the stack to find the caller, which can cost more
+// than the rest of the tracing. A call that doesn't capture its location is
+// notified without an event.
+bool context_t::wantsCodeloc() {
+    switch (codelocPolicy) {
+    case codeloc_policy_t::never:
+        return false;
+    case codeloc_policy_t::sampled: {
+        static thread_local uint64_t calls = 0;
+        return calls++ % codelocSampleRate == 0;
+    }
+    case codeloc_policy_t::subscribed:
+        return subscribed;
+    default:
+        return true;
+    }
+}
+
+// Function ids are matched by their etor name, e.g. urEnqueueKernelLaunch is
+// looked up as UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, the same way the spec
+// generator derives it.
+void context_t::filterFunctions(const std::vector<std::string> &names) {
+    std::map<std::string, uint32_t> etors;
+    for (uint32_t id = 0; id < functionMaskSize; ++id) {
+        std::ostringstream etor;
+        etor << static_cast<ur_function_t>(id);
+        etors.emplace(etor.str(), id);
+    }
+
+    filtered = true;
+    for (auto &name : names) {
+        std::string etor = name;
+        if (name.rfind("ur", 0) == 0) {
+            etor = std::regex_replace("urFunction" + name.substr(2),
+                                      std::regex("(.)([A-Z][a-z]+)"), "$1_$2");
+            etor = std::regex_replace(etor, std::regex("([a-z])([A-Z0-9])"),
+                                      "$1_$2");
+            std::transform(etor.begin(), etor.end(), etor.begin(), ::toupper);
+        }
+        auto it = etors.find(etor);
+        if (it == etors.end()) {
+            logger.warning("unknown function {} in tracing filter", name);
+            continue;
+        }
+        functionMask.set(it->second);
+    }
 }
 
 void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
@@ -59,7 +247,8 @@ void context_t::notify(uint16_t trace_type, uint32_t id, const char *name,
 }
 
 uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
-    if (auto loc = codelocData.get_codeloc()) {
+    activeEvent = nullptr;
+    if (auto loc = wantsCodeloc() ? codelocData.get_codeloc() : std::nullopt) {
         xpti::payload_t payload =
             xpti::payload_t(loc->functionName, loc->sourceFile, loc->lineNumber,
                             loc->columnNumber, nullptr);
@@ -70,6 +259,12 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
     }
 
     uint64_t instance = xptiGetUniqueId();
+    if (buffered) {
+        notify_buffered(
+            (uint16_t)xpti::trace_point_type_t::function_with_args_begin, id,
+            name, UR_RESULT_SUCCESS, instance);
+        return instance;
+    }
     notify((uint16_t)xpti::trace_point_type_t::function_with_args_begin, id,
            name, args, nullptr, instance);
     return instance;
@@ -77,10 +272,100 @@ uint64_t context_t::notify_begin(uint32_t id, const char *name, void *args) {
 
 void context_t::notify_end(uint32_t id, const char *name, void *args,
                            ur_result_t *resultp, uint64_t instance) {
+    if (buffered) {
+        notify_buffered(
+            (uint16_t)xpti::trace_point_type_t::function_with_args_end, id,
+            name, *resultp, instance);
+        return;
+    }
     notify((uint16_t)xpti::trace_point_type_t::function_with_args_end, id, name,
            args, resultp, instance);
 }
 
+event_ring_t &context_t::getLocalRing() {
+    if (!localRing.ring || localGeneration != generation) {
+        auto ring = std::make_shared<event_ring_t>(generation);
+        {
+            std::scoped_lock<std::mutex> lock(ringsMutex);
+            rings.push_back(ring);
+        }
+        if (localRing.ring) {
+            localRing.ring->orphaned = true;
+        }
+        localRing.ring = std::move(ring);
+        localGeneration = generation;
+    }
+    return *localRing.ring;
+}
+
+void context_t::notify_buffered(uint16_t trace_type, uint32_t id,
+                                const char *name, ur_result_t result,
+                                uint64_t instance) {
+    event_record_t record{trace_type, id,          name,       result,
+                          instance,   timestampNs(), activeEvent};
+    auto &ring = getLocalRing();
+    // Apply backpressure rather than dropping records, a lost begin or end
+    // would leave subscribers with unmatched pairs.
+    while (!ring.push(record)) {
+        drainCv.notify_one();
+        std::this_thread::yield();
+    }
+}
+
+bool context_t::drainRings() {
+    std::vector<std::shared_ptr<event_ring_t>> snapshot;
+    {
+        std::scoped_lock<std::mutex> lock(ringsMutex);
+        auto isDone = [](const std::shared_ptr<event_ring_t> &ring) {
+            return ring->orphaned && ring->empty();
+        };
+        rings.erase(std::remove_if(rings.begin(), rings.end(), isDone),
+                    rings.end());
+        snapshot = rings;
+    }
+
+    size_t drained = 0;
+    for (auto &ring : snapshot) {
+        drained += ring->pop_all([&](event_record_t &record) {
+            // Arguments live on the caller's stack and are gone by now. The
+            // capture timestamp (steady clock, ns) is passed as user_data.
+            bool isEnd =
+                record.trace_type ==
+                (uint16_t)xpti::trace_point_type_t::function_with_args_end;
+            xpti::function_with_args_t payload{
+                record.id, record.name, nullptr,
+                isEnd ? &record.result : nullptr, &record.timestamp};
+            xptiNotifySubscribers(call_stream_id, record.trace_type, nullptr,
+                                  record.event, record.instance, &payload);
+        });
+    }
+    return drained != 0;
+}
+
+void context_t::drainLoop() {
+    for (;;) {
+        bool drained = drainRings();
+        std::unique_lock<std::mutex> lock(drainMutex);
+        if (drained) {
+            continue;
+        }
+        if (drainStop) {
+            break;
+        }
+        drainCv.wait_for(lock, std::chrono::milliseconds(1));
+    }
+}
+
 ///////////////////////////////////////////////////////////////////////////////
-context_t::~context_t() { xptiFinalize(CALL_STREAM_NAME); }
+context_t::~context_t() {
+    if (drainThread.joinable()) {
+        {
+            std::scoped_lock<std::mutex> lock(drainMutex);
+            drainStop = true;
+        }
+        drainCv.notify_one();
+        drainThread.join();
+    }
+    xptiFinalize(CALL_STREAM_NAME);
+}
 } // namespace ur_tracing_layer
@@ -18,10 +18,18 @@
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
 
+#include <atomic>
+#include <bitset>
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <thread>
+
 #define TRACING_COMP_NAME "tracing layer"
 
 namespace ur_tracing_layer {
 struct XptiContextManager;
+struct event_ring_t;
 
 ///////////////////////////////////////////////////////////////////////////////
 class __urdlllocal context_t : public proxy_layer_context_t,
@@ -39,15 +47,68 @@ class __urdlllocal context_t : public proxy_layer_context_t,
                      const std::set<std::string> &enabledLayerNames,
                      codeloc_data codelocData) override;
     ur_result_t tearDown() override { return UR_RESULT_SUCCESS; }
+    /// Checked by every intercept before its params struct is built, see
+    /// the "functions" and "sample" options of UR_LAYER_TRACING_OPTIONS.
+    bool isTraced(ur_function_t id) {
+        if (!isIntercepted(id)) {
+            return false;
+        }
+        if (sampleRate > 1) {
+            static thread_local uint64_t calls = 0;
+            return calls++ % sampleRate == 0;
+        }
+        return true;
+    }
+    /// Whether the function is selected by the "functions" option. The
+    /// intercepts of the others are left out of the dispatch chain, so that
+    /// the layers below are called directly.
+    bool isIntercepted(ur_function_t id) const {
+        return !filtered || (id < functionMaskSize && functionMask[id]);
+    }
     uint64_t notify_begin(uint32_t id, const char *name, void *args);
     void notify_end(uint32_t id, const char *name, void *args,
                     ur_result_t *resultp, uint64_t instance);
 
   private:
+    static constexpr size_t functionMaskSize = 512;
+
+    // When notify_begin asks the loader's code location callback for the
+    // caller's location, see the "codeloc" option of UR_LAYER_TRACING_OPTIONS
+    enum class codeloc_policy_t { always, never, sampled, subscribed };
+
+    void parseOptions();
+    void parseCodelocPolicy(const std::vector<std::string> &values);
+    bool wantsCodeloc();
+    void filterFunctions(const std::vector<std::string> &names);
     void notify(uint16_t trace_type, uint32_t id, const char *name, void *args,
                 ur_result_t *resultp, uint64_t instance);
+    void notify_buffered(uint16_t trace_type, uint32_t id, const char *name,
+                         ur_result_t result, uint64_t instance);
+    event_ring_t &getLocalRing();
+    bool drainRings();
+    void drainLoop();
     uint8_t call_stream_id;
 
+    // In buffered mode (UR_LAYER_TRACING_OPTIONS="buffered:1") begin/end
+    // records are queued in per-thread rings and delivered to subscribers by
+    // drainThread, without the arguments of the call.
+    bool buffered = false;
+    bool filtered = false;
+    std::bitset<functionMaskSize> functionMask;
+    uint64_t sampleRate = 1;
+    codeloc_policy_t codelocPolicy = codeloc_policy_t::subscribed;
+    uint64_t codelocSampleRate = 1;
+    // Whether a subscriber listens to the call stream, known once the stream
+    // is initialized
+    bool subscribed = false;
+    uint64_t generation = 0;
+    std::mutex ringsMutex;
+    std::vector<std::shared_ptr<event_ring_t>> rings;
+    std::mutex drainMutex;
+    std::condition_variable drainCv;
+    bool drainStop = false;
+    std::thread drainThread;
+
     inline static const std::string name = "UR_LAYER_TRACING";
 
     std::shared_ptr<XptiContextManager> xptiContextManager;
@@ -36,6 +36,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET)) {
+        return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+    }
+
     ur_adapter_get_params_t params = {&NumEntries, &phAdapters, &pNumAdapters};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET,
                                                    "urAdapterGet", &params);
@@ -49,11 +53,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET,
-                                        &params);
-        logger.info("   <--- urAdapterGet({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ADAPTER_GET, &params);
+        logger.info("   <--- urAdapterGet({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -70,6 +72,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RELEASE)) {
+        return pfnAdapterRelease(hAdapter);
+    }
+
     ur_adapter_release_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RELEASE,
                                                    "urAdapterRelease", &params);
@@ -83,11 +89,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RELEASE,
-                                        &params);
-        logger.info("   <--- urAdapterRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ADAPTER_RELEASE, &params);
+        logger.info("   <--- urAdapterRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -104,6 +108,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_RETAIN)) {
+        return pfnAdapterRetain(hAdapter);
+    }
+
     ur_adapter_retain_params_t params = {&hAdapter};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_RETAIN,
                                                    "urAdapterRetain", &params);
@@ -117,11 +125,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_RETAIN,
-                                        &params);
-        logger.info("   <--- urAdapterRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ADAPTER_RETAIN, &params);
+        logger.info("   <--- urAdapterRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -145,6 +151,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_LAST_ERROR)) {
+        return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+    }
+
     ur_adapter_get_last_error_params_t params = {&hAdapter, &ppMessage,
                                                  &pError};
     uint64_t instance = getContext()->notify_begin(
@@ -160,11 +170,10 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetLastError(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ADAPTER_GET_LAST_ERROR, &params);
         logger.info("   <--- urAdapterGetLastError({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -191,6 +200,11 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ADAPTER_GET_INFO)) {
+        return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
+                                 pPropSizeRet);
+    }
+
     ur_adapter_get_info_params_t params = {&hAdapter, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_ADAPTER_GET_INFO,
@@ -206,11 +220,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ADAPTER_GET_INFO,
-                                        &params);
-        logger.info("   <--- urAdapterGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ADAPTER_GET_INFO, &params);
+        logger.info("   <--- urAdapterGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -240,6 +252,11 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET)) {
+        return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
+                      pNumPlatforms);
+    }
+
     ur_platform_get_params_t params = {&phAdapters, &NumAdapters, &NumEntries,
                                        &phPlatforms, &pNumPlatforms};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET,
@@ -255,11 +272,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET,
-                                        &params);
-        logger.info("   <--- urPlatformGet({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_GET, &params);
+        logger.info("   <--- urPlatformGet({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -286,6 +301,11 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        return pfnGetInfo(hPlatform, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_platform_get_info_params_t params = {&hPlatform, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -301,11 +321,9 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PLATFORM_GET_INFO,
-                                        &params);
-        logger.info("   <--- urPlatformGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_GET_INFO, &params);
+        logger.info("   <--- urPlatformGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -323,6 +341,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        return pfnGetApiVersion(hPlatform, pVersion);
+    }
+
     ur_platform_get_api_version_params_t params = {&hPlatform, &pVersion};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_PLATFORM_GET_API_VERSION,
@@ -338,11 +360,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetApiVersion(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PLATFORM_GET_API_VERSION, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_GET_API_VERSION, &params);
         logger.info("   <--- urPlatformGetApiVersion({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -362,6 +383,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hPlatform, phNativePlatform);
+    }
+
     ur_platform_get_native_handle_params_t params = {&hPlatform,
                                                      &phNativePlatform};
     uint64_t instance =
@@ -378,11 +403,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urPlatformGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -407,6 +431,12 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
+                                         phPlatform);
+    }
+
     ur_platform_create_with_native_handle_params_t params = {
         &hNativePlatform, &hAdapter, &pProperties, &phPlatform};
     uint64_t instance = getContext()->notify_begin(
@@ -424,11 +454,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urPlatformCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -451,6 +480,11 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        return pfnGetBackendOption(hPlatform, pFrontendOption,
+                                   ppPlatformOption);
+    }
+
     ur_platform_get_backend_option_params_t params = {
         &hPlatform, &pFrontendOption, &ppPlatformOption};
     uint64_t instance =
@@ -468,11 +502,10 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGetBackendOption(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION, &params);
         logger.info("   <--- urPlatformGetBackendOption({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -501,6 +534,11 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET)) {
+        return pfnGet(hPlatform, DeviceType, NumEntries, phDevices,
+                      pNumDevices);
+    }
+
     ur_device_get_params_t params = {&hPlatform, &DeviceType, &NumEntries,
                                      &phDevices, &pNumDevices};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET,
@@ -516,10 +554,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET,
-                                        &params);
-        logger.info("   <--- urDeviceGet({}) -> {};\n", args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_GET, &params);
+        logger.info("   <--- urDeviceGet({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -547,6 +584,11 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_INFO)) {
+        return pfnGetInfo(hDevice, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_device_get_info_params_t params = {&hDevice, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_INFO,
@@ -562,11 +604,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_GET_INFO,
-                                        &params);
-        logger.info("   <--- urDeviceGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_GET_INFO, &params);
+        logger.info("   <--- urDeviceGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -584,6 +624,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RETAIN)) {
+        return pfnRetain(hDevice);
+    }
+
     ur_device_retain_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RETAIN,
                                                    "urDeviceRetain", &params);
@@ -597,11 +641,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RETAIN,
-                                        &params);
-        logger.info("   <--- urDeviceRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_RETAIN, &params);
+        logger.info("   <--- urDeviceRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -619,6 +661,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_RELEASE)) {
+        return pfnRelease(hDevice);
+    }
+
     ur_device_release_params_t params = {&hDevice};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_DEVICE_RELEASE,
                                                    "urDeviceRelease", &params);
@@ -632,11 +678,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_RELEASE,
-                                        &params);
-        logger.info("   <--- urDeviceRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_RELEASE, &params);
+        logger.info("   <--- urDeviceRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -663,6 +707,11 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_PARTITION)) {
+        return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
+                            pNumDevicesRet);
+    }
+
     ur_device_partition_params_t params = {&hDevice, &pProperties, &NumDevices,
                                            &phSubDevices, &pNumDevicesRet};
     uint64_t instance = getContext()->notify_begin(
@@ -678,11 +727,9 @@ __urdlllocal ur_result_t UR_APICALL urDevicePartition(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_DEVICE_PARTITION,
-                                        &params);
-        logger.info("   <--- urDevicePartition({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_PARTITION, &params);
+        logger.info("   <--- urDevicePartition({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -708,6 +755,11 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        return pfnSelectBinary(hDevice, pBinaries, NumBinaries,
+                               pSelectedBinary);
+    }
+
     ur_device_select_binary_params_t params = {&hDevice, &pBinaries,
                                                &NumBinaries, &pSelectedBinary};
     uint64_t instance = getContext()->notify_begin(
@@ -724,10 +776,9 @@ __urdlllocal ur_result_t UR_APICALL urDeviceSelectBinary(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_DEVICE_SELECT_BINARY, &params);
-        logger.info("   <--- urDeviceSelectBinary({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_SELECT_BINARY, &params);
+        logger.info("   <--- urDeviceSelectBinary({}) -> {};\n", args_str,
                     result);
     }
 
@@ -748,6 +799,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hDevice, phNativeDevice);
+    }
+
     ur_device_get_native_handle_params_t params = {&hDevice, &phNativeDevice};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE,
@@ -763,11 +818,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urDeviceGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -792,6 +846,11 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
+                                         phDevice);
+    }
+
     ur_device_create_with_native_handle_params_t params = {
         &hNativeDevice, &hAdapter, &pProperties, &phDevice};
     uint64_t instance =
@@ -809,11 +868,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urDeviceCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -837,6 +895,11 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp,
+                                      pHostTimestamp);
+    }
+
     ur_device_get_global_timestamps_params_t params = {
         &hDevice, &pDeviceTimestamp, &pHostTimestamp};
     uint64_t instance =
@@ -854,11 +917,10 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS, &params);
         logger.info("   <--- urDeviceGetGlobalTimestamps({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -881,6 +943,10 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_CREATE)) {
+        return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+    }
+
     ur_context_create_params_t params = {&DeviceCount, &phDevices, &pProperties,
                                          &phContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_CREATE,
@@ -896,11 +962,9 @@ __urdlllocal ur_result_t UR_APICALL urContextCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_CREATE,
-                                        &params);
-        logger.info("   <--- urContextCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_CREATE, &params);
+        logger.info("   <--- urContextCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -918,6 +982,10 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RETAIN)) {
+        return pfnRetain(hContext);
+    }
+
     ur_context_retain_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RETAIN,
                                                    "urContextRetain", &params);
@@ -931,11 +999,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RETAIN,
-                                        &params);
-        logger.info("   <--- urContextRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_RETAIN, &params);
+        logger.info("   <--- urContextRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -953,6 +1019,10 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_RELEASE)) {
+        return pfnRelease(hContext);
+    }
+
     ur_context_release_params_t params = {&hContext};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_RELEASE,
                                                    "urContextRelease", &params);
@@ -966,11 +1036,9 @@ __urdlllocal ur_result_t UR_APICALL urContextRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_RELEASE,
-                                        &params);
-        logger.info("   <--- urContextRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_RELEASE, &params);
+        logger.info("   <--- urContextRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -999,6 +1067,11 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        return pfnGetInfo(hContext, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_context_get_info_params_t params = {&hContext, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_CONTEXT_GET_INFO,
@@ -1014,11 +1087,9 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_CONTEXT_GET_INFO,
-                                        &params);
-        logger.info("   <--- urContextGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_GET_INFO, &params);
+        logger.info("   <--- urContextGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1038,6 +1109,10 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hContext, phNativeContext);
+    }
+
     ur_context_get_native_handle_params_t params = {&hContext,
                                                     &phNativeContext};
     uint64_t instance =
@@ -1054,11 +1129,10 @@ __urdlllocal ur_result_t UR_APICALL urContextGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urContextGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1087,6 +1161,12 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
+                                         phDevices, pProperties, phContext);
+    }
+
     ur_context_create_with_native_handle_params_t params = {
         &hNativeContext, &hAdapter,    &numDevices,
         &phDevices,      &pProperties, &phContext};
@@ -1106,11 +1186,10 @@ __urdlllocal ur_result_t UR_APICALL urContextCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urContextCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1132,6 +1211,10 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+    }
+
     ur_context_set_extended_deleter_params_t params = {&hContext, &pfnDeleter,
                                                        &pUserData};
     uint64_t instance =
@@ -1148,11 +1231,10 @@ __urdlllocal ur_result_t UR_APICALL urContextSetExtendedDeleter(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER, &params);
         logger.info("   <--- urContextSetExtendedDeleter({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1175,6 +1257,11 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
+                              phMem);
+    }
+
     ur_mem_image_create_params_t params = {&hContext,   &flags, &pImageFormat,
                                            &pImageDesc, &pHost, &phMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_IMAGE_CREATE,
@@ -1190,11 +1277,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_IMAGE_CREATE,
-                                        &params);
-        logger.info("   <--- urMemImageCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_IMAGE_CREATE, &params);
+        logger.info("   <--- urMemImageCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1217,6 +1302,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+    }
+
     ur_mem_buffer_create_params_t params = {&hContext, &flags, &size,
                                             &pProperties, &phBuffer};
     uint64_t instance = getContext()->notify_begin(
@@ -1232,11 +1321,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_BUFFER_CREATE,
-                                        &params);
-        logger.info("   <--- urMemBufferCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_BUFFER_CREATE, &params);
+        logger.info("   <--- urMemBufferCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1254,6 +1341,10 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RETAIN)) {
+        return pfnRetain(hMem);
+    }
+
     ur_mem_retain_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RETAIN,
                                                    "urMemRetain", &params);
@@ -1267,10 +1358,9 @@ __urdlllocal ur_result_t UR_APICALL urMemRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RETAIN,
-                                        &params);
-        logger.info("   <--- urMemRetain({}) -> {};\n", args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_RETAIN, &params);
+        logger.info("   <--- urMemRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1288,6 +1378,10 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_RELEASE)) {
+        return pfnRelease(hMem);
+    }
+
     ur_mem_release_params_t params = {&hMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_RELEASE,
                                                    "urMemRelease", &params);
@@ -1301,11 +1395,9 @@ __urdlllocal ur_result_t UR_APICALL urMemRelease(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_RELEASE,
-                                        &params);
-        logger.info("   <--- urMemRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_RELEASE, &params);
+        logger.info("   <--- urMemRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1329,6 +1421,11 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion,
+                                  phMem);
+    }
+
     ur_mem_buffer_partition_params_t params = {
         &hBuffer, &flags, &bufferCreateType, &pRegion, &phMem};
     uint64_t instance = getContext()->notify_begin(
@@ -1345,10 +1442,9 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_MEM_BUFFER_PARTITION, &params);
-        logger.info("   <--- urMemBufferPartition({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_BUFFER_PARTITION, &params);
+        logger.info("   <--- urMemBufferPartition({}) -> {};\n", args_str,
                     result);
     }
 
@@ -1371,6 +1467,10 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+    }
+
     ur_mem_get_native_handle_params_t params = {&hMem, &hDevice, &phNativeMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_MEM_GET_NATIVE_HANDLE, "urMemGetNativeHandle", &params);
@@ -1385,10 +1485,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_MEM_GET_NATIVE_HANDLE, &params);
-        logger.info("   <--- urMemGetNativeHandle({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_GET_NATIVE_HANDLE, &params);
+        logger.info("   <--- urMemGetNativeHandle({}) -> {};\n", args_str,
                     result);
     }
 
@@ -1413,6 +1512,12 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnBufferCreateWithNativeHandle(hNativeMem, hContext,
+                                               pProperties, phMem);
+    }
+
     ur_mem_buffer_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext, &pProperties, &phMem};
     uint64_t instance = getContext()->notify_begin(
@@ -1430,12 +1535,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urMemBufferCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1462,6 +1565,13 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnImageCreateWithNativeHandle(hNativeMem, hContext,
+                                              pImageFormat, pImageDesc,
+                                              pProperties, phMem);
+    }
+
     ur_mem_image_create_with_native_handle_params_t params = {
         &hNativeMem, &hContext,    &pImageFormat,
         &pImageDesc, &pProperties, &phMem};
@@ -1480,11 +1590,10 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urMemImageCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1513,6 +1622,11 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_GET_INFO)) {
+        return pfnGetInfo(hMemory, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_mem_get_info_params_t params = {&hMemory, &propName, &propSize,
                                        &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_MEM_GET_INFO,
@@ -1528,11 +1642,9 @@ __urdlllocal ur_result_t UR_APICALL urMemGetInfo(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_MEM_GET_INFO,
-                                        &params);
-        logger.info("   <--- urMemGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_GET_INFO, &params);
+        logger.info("   <--- urMemGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1560,6 +1672,11 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_mem_image_get_info_params_t params = {&hMemory, &propName, &propSize,
                                              &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -1575,11 +1692,9 @@ __urdlllocal ur_result_t UR_APICALL urMemImageGetInfo(
                              "urMemImageGetInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_MEM_IMAGE_GET_INFO, &params);
-        logger.info("   <--- urMemImageGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_MEM_IMAGE_GET_INFO, &params);
+        logger.info("   <--- urMemImageGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1599,6 +1714,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_CREATE)) {
+        return pfnCreate(hContext, pDesc, phSampler);
+    }
+
     ur_sampler_create_params_t params = {&hContext, &pDesc, &phSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_CREATE,
                                                    "urSamplerCreate", &params);
@@ -1612,11 +1731,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_CREATE,
-                                        &params);
-        logger.info("   <--- urSamplerCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_CREATE, &params);
+        logger.info("   <--- urSamplerCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1634,6 +1751,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RETAIN)) {
+        return pfnRetain(hSampler);
+    }
+
     ur_sampler_retain_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RETAIN,
                                                    "urSamplerRetain", &params);
@@ -1647,11 +1768,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RETAIN,
-                                        &params);
-        logger.info("   <--- urSamplerRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_RETAIN, &params);
+        logger.info("   <--- urSamplerRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1669,6 +1788,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_RELEASE)) {
+        return pfnRelease(hSampler);
+    }
+
     ur_sampler_release_params_t params = {&hSampler};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_RELEASE,
                                                    "urSamplerRelease", &params);
@@ -1682,11 +1805,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_RELEASE,
-                                        &params);
-        logger.info("   <--- urSamplerRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_RELEASE, &params);
+        logger.info("   <--- urSamplerRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1711,6 +1832,11 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        return pfnGetInfo(hSampler, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_sampler_get_info_params_t params = {&hSampler, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_SAMPLER_GET_INFO,
@@ -1726,11 +1852,9 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_SAMPLER_GET_INFO,
-                                        &params);
-        logger.info("   <--- urSamplerGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_GET_INFO, &params);
+        logger.info("   <--- urSamplerGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1750,6 +1874,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hSampler, phNativeSampler);
+    }
+
     ur_sampler_get_native_handle_params_t params = {&hSampler,
                                                     &phNativeSampler};
     uint64_t instance =
@@ -1766,11 +1894,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urSamplerGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1794,6 +1921,12 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
+                                         phSampler);
+    }
+
     ur_sampler_create_with_native_handle_params_t params = {
         &hNativeSampler, &hContext, &pProperties, &phSampler};
     uint64_t instance = getContext()->notify_begin(
@@ -1811,11 +1944,10 @@ __urdlllocal ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urSamplerCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -1839,6 +1971,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_HOST_ALLOC)) {
+        return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_host_alloc_params_t params = {&hContext, &pUSMDesc, &pool, &size,
                                          &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_HOST_ALLOC,
@@ -1853,11 +1989,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_HOST_ALLOC,
-                                        &params);
-        logger.info("   <--- urUSMHostAlloc({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_HOST_ALLOC, &params);
+        logger.info("   <--- urUSMHostAlloc({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1882,6 +2016,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_device_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_DEVICE_ALLOC,
@@ -1897,11 +2035,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_DEVICE_ALLOC,
-                                        &params);
-        logger.info("   <--- urUSMDeviceAlloc({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_DEVICE_ALLOC, &params);
+        logger.info("   <--- urUSMDeviceAlloc({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1926,6 +2062,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+    }
+
     ur_usm_shared_alloc_params_t params = {&hContext, &hDevice, &pUSMDesc,
                                            &pool,     &size,    &ppMem};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_SHARED_ALLOC,
@@ -1941,11 +2081,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_SHARED_ALLOC,
-                                        &params);
-        logger.info("   <--- urUSMSharedAlloc({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_SHARED_ALLOC, &params);
+        logger.info("   <--- urUSMSharedAlloc({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -1963,6 +2101,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_FREE)) {
+        return pfnFree(hContext, pMem);
+    }
+
     ur_usm_free_params_t params = {&hContext, &pMem};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_USM_FREE, "urUSMFree", &params);
@@ -1976,10 +2118,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_FREE,
-                                        &params);
-        logger.info("   <--- urUSMFree({}) -> {};\n", args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_FREE, &params);
+        logger.info("   <--- urUSMFree({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2006,6 +2147,11 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        return pfnGetMemAllocInfo(hContext, pMem, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_usm_get_mem_alloc_info_params_t params = {
         &hContext, &pMem, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -2022,10 +2168,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMGetMemAllocInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params);
-        logger.info("   <--- urUSMGetMemAllocInfo({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO, &params);
+        logger.info("   <--- urUSMGetMemAllocInfo({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2047,6 +2192,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_CREATE)) {
+        return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+    }
+
     ur_usm_pool_create_params_t params = {&hContext, &pPoolDesc, &ppPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_CREATE,
                                                    "urUSMPoolCreate", &params);
@@ -2060,11 +2209,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_CREATE,
-                                        &params);
-        logger.info("   <--- urUSMPoolCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_POOL_CREATE, &params);
+        logger.info("   <--- urUSMPoolCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2081,6 +2228,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RETAIN)) {
+        return pfnPoolRetain(pPool);
+    }
+
     ur_usm_pool_retain_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RETAIN,
                                                    "urUSMPoolRetain", &params);
@@ -2094,11 +2245,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RETAIN,
-                                        &params);
-        logger.info("   <--- urUSMPoolRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_POOL_RETAIN, &params);
+        logger.info("   <--- urUSMPoolRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2115,6 +2264,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_RELEASE)) {
+        return pfnPoolRelease(pPool);
+    }
+
     ur_usm_pool_release_params_t params = {&pPool};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_POOL_RELEASE,
                                                    "urUSMPoolRelease", &params);
@@ -2128,11 +2281,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_RELEASE,
-                                        &params);
-        logger.info("   <--- urUSMPoolRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_POOL_RELEASE, &params);
+        logger.info("   <--- urUSMPoolRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2156,6 +2307,11 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_GET_INFO)) {
+        return pfnPoolGetInfo(hPool, propName, propSize, pPropValue,
+                              pPropSizeRet);
+    }
+
     ur_usm_pool_get_info_params_t params = {&hPool, &propName, &propSize,
                                             &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -2171,11 +2327,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_POOL_GET_INFO,
-                                        &params);
-        logger.info("   <--- urUSMPoolGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_POOL_GET_INFO, &params);
+        logger.info("   <--- urUSMPoolGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2207,6 +2361,11 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO)) {
+        return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
+                                     pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_granularity_get_info_params_t params = {
         &hContext, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
@@ -2224,11 +2383,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO, &params);
         logger.info("   <--- urVirtualMemGranularityGetInfo({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -2254,6 +2412,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_RESERVE)) {
+        return pfnReserve(hContext, pStart, size, ppStart);
+    }
+
     ur_virtual_mem_reserve_params_t params = {&hContext, &pStart, &size,
                                               &ppStart};
     uint64_t instance = getContext()->notify_begin(
@@ -2268,10 +2430,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemReserve(
                              "urVirtualMemReserve", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_VIRTUAL_MEM_RESERVE, &params);
-        logger.info("   <--- urVirtualMemReserve({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_RESERVE, &params);
+        logger.info("   <--- urVirtualMemReserve({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2292,6 +2453,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_FREE)) {
+        return pfnFree(hContext, pStart, size);
+    }
+
     ur_virtual_mem_free_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_FREE,
                                                    "urVirtualMemFree", &params);
@@ -2305,11 +2470,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemFree(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_FREE,
-                                        &params);
-        logger.info("   <--- urVirtualMemFree({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_FREE, &params);
+        logger.info("   <--- urVirtualMemFree({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2335,6 +2498,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_MAP)) {
+        return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+    }
+
     ur_virtual_mem_map_params_t params = {&hContext,     &pStart, &size,
                                           &hPhysicalMem, &offset, &flags};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_VIRTUAL_MEM_MAP,
@@ -2350,11 +2517,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemMap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_MAP,
-                                        &params);
-        logger.info("   <--- urVirtualMemMap({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_MAP, &params);
+        logger.info("   <--- urVirtualMemMap({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2374,6 +2539,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_UNMAP)) {
+        return pfnUnmap(hContext, pStart, size);
+    }
+
     ur_virtual_mem_unmap_params_t params = {&hContext, &pStart, &size};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_VIRTUAL_MEM_UNMAP, "urVirtualMemUnmap", &params);
@@ -2387,11 +2556,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemUnmap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_VIRTUAL_MEM_UNMAP,
-                                        &params);
-        logger.info("   <--- urVirtualMemUnmap({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_UNMAP, &params);
+        logger.info("   <--- urVirtualMemUnmap({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2413,6 +2580,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS)) {
+        return pfnSetAccess(hContext, pStart, size, flags);
+    }
+
     ur_virtual_mem_set_access_params_t params = {&hContext, &pStart, &size,
                                                  &flags};
     uint64_t instance = getContext()->notify_begin(
@@ -2428,11 +2599,10 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemSetAccess(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS, &params);
         logger.info("   <--- urVirtualMemSetAccess({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -2462,6 +2632,11 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_VIRTUAL_MEM_GET_INFO)) {
+        return pfnGetInfo(hContext, pStart, size, propName, propSize,
+                          pPropValue, pPropSizeRet);
+    }
+
     ur_virtual_mem_get_info_params_t params = {
         &hContext, &pStart,     &size,        &propName,
         &propSize, &pPropValue, &pPropSizeRet};
@@ -2478,10 +2653,9 @@ __urdlllocal ur_result_t UR_APICALL urVirtualMemGetInfo(
                              "urVirtualMemGetInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_VIRTUAL_MEM_GET_INFO, &params);
-        logger.info("   <--- urVirtualMemGetInfo({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_VIRTUAL_MEM_GET_INFO, &params);
+        logger.info("   <--- urVirtualMemGetInfo({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2507,6 +2681,10 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_CREATE)) {
+        return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+    }
+
     ur_physical_mem_create_params_t params = {&hContext, &hDevice, &size,
                                               &pProperties, &phPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
@@ -2522,10 +2700,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemCreate(
                              "urPhysicalMemCreate", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PHYSICAL_MEM_CREATE, &params);
-        logger.info("   <--- urPhysicalMemCreate({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PHYSICAL_MEM_CREATE, &params);
+        logger.info("   <--- urPhysicalMemCreate({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2544,6 +2721,10 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RETAIN)) {
+        return pfnRetain(hPhysicalMem);
+    }
+
     ur_physical_mem_retain_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PHYSICAL_MEM_RETAIN, "urPhysicalMemRetain", &params);
@@ -2557,10 +2738,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRetain(
                              "urPhysicalMemRetain", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PHYSICAL_MEM_RETAIN, &params);
-        logger.info("   <--- urPhysicalMemRetain({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PHYSICAL_MEM_RETAIN, &params);
+        logger.info("   <--- urPhysicalMemRetain({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2579,6 +2759,10 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PHYSICAL_MEM_RELEASE)) {
+        return pfnRelease(hPhysicalMem);
+    }
+
     ur_physical_mem_release_params_t params = {&hPhysicalMem};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_PHYSICAL_MEM_RELEASE, "urPhysicalMemRelease", &params);
@@ -2593,10 +2777,9 @@ __urdlllocal ur_result_t UR_APICALL urPhysicalMemRelease(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PHYSICAL_MEM_RELEASE, &params);
-        logger.info("   <--- urPhysicalMemRelease({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PHYSICAL_MEM_RELEASE, &params);
+        logger.info("   <--- urPhysicalMemRelease({}) -> {};\n", args_str,
                     result);
     }
 
@@ -2620,6 +2803,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+    }
+
     ur_program_create_with_il_params_t params = {&hContext, &pIL, &length,
                                                  &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
@@ -2636,11 +2823,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithIL(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_CREATE_WITH_IL, &params);
         logger.info("   <--- urProgramCreateWithIL({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -2666,6 +2852,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        return pfnCreateWithBinary(hContext, hDevice, size, pBinary,
+                                   pProperties, phProgram);
+    }
+
     ur_program_create_with_binary_params_t params = {
         &hContext, &hDevice, &size, &pBinary, &pProperties, &phProgram};
     uint64_t instance =
@@ -2683,11 +2874,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithBinary(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY, &params);
         logger.info("   <--- urProgramCreateWithBinary({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -2707,6 +2897,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD)) {
+        return pfnBuild(hContext, hProgram, pOptions);
+    }
+
     ur_program_build_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD,
                                                    "urProgramBuild", &params);
@@ -2720,11 +2914,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuild(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD,
-                                        &params);
-        logger.info("   <--- urProgramBuild({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_BUILD, &params);
+        logger.info("   <--- urProgramBuild({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2745,6 +2937,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE)) {
+        return pfnCompile(hContext, hProgram, pOptions);
+    }
+
     ur_program_compile_params_t params = {&hContext, &hProgram, &pOptions};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_COMPILE,
                                                    "urProgramCompile", &params);
@@ -2758,11 +2954,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompile(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_COMPILE,
-                                        &params);
-        logger.info("   <--- urProgramCompile({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_COMPILE, &params);
+        logger.info("   <--- urProgramCompile({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2789,6 +2983,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK)) {
+        return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+    }
+
     ur_program_link_params_t params = {&hContext, &count, &phPrograms,
                                        &pOptions, &phProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_LINK,
@@ -2804,11 +3002,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramLink(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK,
-                                        &params);
-        logger.info("   <--- urProgramLink({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_LINK, &params);
+        logger.info("   <--- urProgramLink({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2826,6 +3022,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RETAIN)) {
+        return pfnRetain(hProgram);
+    }
+
     ur_program_retain_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RETAIN,
                                                    "urProgramRetain", &params);
@@ -2839,11 +3039,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RETAIN,
-                                        &params);
-        logger.info("   <--- urProgramRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_RETAIN, &params);
+        logger.info("   <--- urProgramRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2861,6 +3059,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_RELEASE)) {
+        return pfnRelease(hProgram);
+    }
+
     ur_program_release_params_t params = {&hProgram};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_RELEASE,
                                                    "urProgramRelease", &params);
@@ -2874,11 +3076,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_RELEASE,
-                                        &params);
-        logger.info("   <--- urProgramRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_RELEASE, &params);
+        logger.info("   <--- urProgramRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -2905,6 +3105,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
+                                     ppFunctionPointer);
+    }
+
     ur_program_get_function_pointer_params_t params = {
         &hDevice, &hProgram, &pFunctionName, &ppFunctionPointer};
     uint64_t instance =
@@ -2922,11 +3127,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetFunctionPointer(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER, &params);
         logger.info("   <--- urProgramGetFunctionPointer({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -2954,6 +3158,14 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER)) {
+        return pfnGetGlobalVariablePointer(hDevice, hProgram,
+                                           pGlobalVariableName,
+                                           pGlobalVariableSizeRet,
+                                           ppGlobalVariablePointerRet);
+    }
+
     ur_program_get_global_variable_pointer_params_t params = {
         &hDevice, &hProgram, &pGlobalVariableName, &pGlobalVariableSizeRet,
         &ppGlobalVariablePointerRet};
@@ -2973,11 +3185,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER, &params);
         logger.info("   <--- urProgramGetGlobalVariablePointer({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3005,6 +3216,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        return pfnGetInfo(hProgram, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_program_get_info_params_t params = {&hProgram, &propName, &propSize,
                                            &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_PROGRAM_GET_INFO,
@@ -3020,11 +3236,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_GET_INFO,
-                                        &params);
-        logger.info("   <--- urProgramGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_GET_INFO, &params);
+        logger.info("   <--- urProgramGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3054,6 +3268,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        return pfnGetBuildInfo(hProgram, hDevice, propName, propSize,
+                               pPropValue, pPropSizeRet);
+    }
+
     ur_program_get_build_info_params_t params = {
         &hProgram, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -3070,11 +3289,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetBuildInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_GET_BUILD_INFO, &params);
         logger.info("   <--- urProgramGetBuildInfo({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3096,6 +3314,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+    }
+
     ur_program_set_specialization_constants_params_t params = {
         &hProgram, &count, &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
@@ -3113,12 +3336,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramSetSpecializationConstants(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS, &params);
         logger.info("   <--- urProgramSetSpecializationConstants({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3138,6 +3359,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hProgram, phNativeProgram);
+    }
+
     ur_program_get_native_handle_params_t params = {&hProgram,
                                                     &phNativeProgram};
     uint64_t instance =
@@ -3154,11 +3379,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urProgramGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3182,6 +3406,12 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
+                                         phProgram);
+    }
+
     ur_program_create_with_native_handle_params_t params = {
         &hNativeProgram, &hContext, &pProperties, &phProgram};
     uint64_t instance = getContext()->notify_begin(
@@ -3199,11 +3429,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urProgramCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3223,6 +3452,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE)) {
+        return pfnCreate(hProgram, pKernelName, phKernel);
+    }
+
     ur_kernel_create_params_t params = {&hProgram, &pKernelName, &phKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_CREATE,
                                                    "urKernelCreate", &params);
@@ -3236,11 +3469,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreate(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_CREATE,
-                                        &params);
-        logger.info("   <--- urKernelCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_CREATE, &params);
+        logger.info("   <--- urKernelCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3264,6 +3495,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        return pfnSetArgValue(hKernel, argIndex, argSize, pProperties,
+                              pArgValue);
+    }
+
     ur_kernel_set_arg_value_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
@@ -3279,10 +3515,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgValue(
                              "urKernelSetArgValue", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_ARG_VALUE, &params);
-        logger.info("   <--- urKernelSetArgValue({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARG_VALUE, &params);
+        logger.info("   <--- urKernelSetArgValue({}) -> {};\n", args_str,
                     result);
     }
 
@@ -3305,6 +3540,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+    }
+
     ur_kernel_set_arg_local_params_t params = {&hKernel, &argIndex, &argSize,
                                                &pProperties};
     uint64_t instance = getContext()->notify_begin(
@@ -3320,10 +3559,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgLocal(
                              "urKernelSetArgLocal", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_ARG_LOCAL, &params);
-        logger.info("   <--- urKernelSetArgLocal({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARG_LOCAL, &params);
+        logger.info("   <--- urKernelSetArgLocal({}) -> {};\n", args_str,
                     result);
     }
 
@@ -3353,6 +3591,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_INFO)) {
+        return pfnGetInfo(hKernel, propName, propSize, pPropValue,
+                          pPropSizeRet);
+    }
+
     ur_kernel_get_info_params_t params = {&hKernel, &propName, &propSize,
                                           &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_INFO,
@@ -3368,11 +3611,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_GET_INFO,
-                                        &params);
-        logger.info("   <--- urKernelGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_GET_INFO, &params);
+        logger.info("   <--- urKernelGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3399,6 +3640,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
+                               pPropSizeRet);
+    }
+
     ur_kernel_get_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -3415,10 +3661,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetGroupInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_GET_GROUP_INFO, &params);
-        logger.info("   <--- urKernelGetGroupInfo({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_GET_GROUP_INFO, &params);
+        logger.info("   <--- urKernelGetGroupInfo({}) -> {};\n", args_str,
                     result);
     }
 
@@ -3447,6 +3692,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize,
+                                  pPropValue, pPropSizeRet);
+    }
+
     ur_kernel_get_sub_group_info_params_t params = {
         &hKernel, &hDevice, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
@@ -3464,11 +3714,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSubGroupInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO, &params);
         logger.info("   <--- urKernelGetSubGroupInfo({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3485,6 +3734,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RETAIN)) {
+        return pfnRetain(hKernel);
+    }
+
     ur_kernel_retain_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RETAIN,
                                                    "urKernelRetain", &params);
@@ -3498,11 +3751,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRetain(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RETAIN,
-                                        &params);
-        logger.info("   <--- urKernelRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_RETAIN, &params);
+        logger.info("   <--- urKernelRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3520,6 +3771,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_RELEASE)) {
+        return pfnRelease(hKernel);
+    }
+
     ur_kernel_release_params_t params = {&hKernel};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_KERNEL_RELEASE,
                                                    "urKernelRelease", &params);
@@ -3533,11 +3788,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_KERNEL_RELEASE,
-                                        &params);
-        logger.info("   <--- urKernelRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_RELEASE, &params);
+        logger.info("   <--- urKernelRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3560,6 +3813,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+    }
+
     ur_kernel_set_arg_pointer_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &pArgValue};
     uint64_t instance = getContext()->notify_begin(
@@ -3576,11 +3833,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgPointer(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARG_POINTER, &params);
         logger.info("   <--- urKernelSetArgPointer({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3604,6 +3860,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        return pfnSetExecInfo(hKernel, propName, propSize, pProperties,
+                              pPropValue);
+    }
+
     ur_kernel_set_exec_info_params_t params = {&hKernel, &propName, &propSize,
                                                &pProperties, &pPropValue};
     uint64_t instance = getContext()->notify_begin(
@@ -3619,10 +3880,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetExecInfo(
                              "urKernelSetExecInfo", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_EXEC_INFO, &params);
-        logger.info("   <--- urKernelSetExecInfo({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_EXEC_INFO, &params);
+        logger.info("   <--- urKernelSetExecInfo({}) -> {};\n", args_str,
                     result);
     }
 
@@ -3644,6 +3904,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_sampler_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
@@ -3660,11 +3924,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgSampler(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER, &params);
         logger.info("   <--- urKernelSetArgSampler({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3685,6 +3948,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+    }
+
     ur_kernel_set_arg_mem_obj_params_t params = {&hKernel, &argIndex,
                                                  &pProperties, &hArgValue};
     uint64_t instance = getContext()->notify_begin(
@@ -3701,10 +3968,9 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetArgMemObj(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params);
-        logger.info("   <--- urKernelSetArgMemObj({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ, &params);
+        logger.info("   <--- urKernelSetArgMemObj({}) -> {};\n", args_str,
                     result);
     }
 
@@ -3726,6 +3992,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+    }
+
     ur_kernel_set_specialization_constants_params_t params = {&hKernel, &count,
                                                               &pSpecConstants};
     uint64_t instance = getContext()->notify_begin(
@@ -3743,11 +4014,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelSetSpecializationConstants(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS, &params);
         logger.info("   <--- urKernelSetSpecializationConstants({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3767,6 +4037,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hKernel, phNativeKernel);
+    }
+
     ur_kernel_get_native_handle_params_t params = {&hKernel, &phNativeKernel};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE,
@@ -3782,11 +4056,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urKernelGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3812,6 +4085,11 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
+                                         pProperties, phKernel);
+    }
+
     ur_kernel_create_with_native_handle_params_t params = {
         &hNativeKernel, &hContext, &hProgram, &pProperties, &phKernel};
     uint64_t instance =
@@ -3829,11 +4107,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urKernelCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3865,6 +4142,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE)) {
+        return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
+                                            pGlobalWorkOffset, pGlobalWorkSize,
+                                            pSuggestedLocalWorkSize);
+    }
+
     ur_kernel_get_suggested_local_work_size_params_t params = {
         &hKernel,           &hQueue,          &numWorkDim,
         &pGlobalWorkOffset, &pGlobalWorkSize, &pSuggestedLocalWorkSize};
@@ -3884,12 +4168,10 @@ __urdlllocal ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE, &params);
         logger.info("   <--- urKernelGetSuggestedLocalWorkSize({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -3914,6 +4196,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_INFO)) {
+        return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_queue_get_info_params_t params = {&hQueue, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_GET_INFO,
@@ -3929,11 +4215,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_GET_INFO,
-                                        &params);
-        logger.info("   <--- urQueueGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_GET_INFO, &params);
+        logger.info("   <--- urQueueGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3955,6 +4239,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE)) {
+        return pfnCreate(hContext, hDevice, pProperties, phQueue);
+    }
+
     ur_queue_create_params_t params = {&hContext, &hDevice, &pProperties,
                                        &phQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_CREATE,
@@ -3969,11 +4257,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreate(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_CREATE,
-                                        &params);
-        logger.info("   <--- urQueueCreate({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_CREATE, &params);
+        logger.info("   <--- urQueueCreate({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -3991,6 +4277,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RETAIN)) {
+        return pfnRetain(hQueue);
+    }
+
     ur_queue_retain_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RETAIN,
                                                    "urQueueRetain", &params);
@@ -4004,11 +4294,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RETAIN,
-                                        &params);
-        logger.info("   <--- urQueueRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_RETAIN, &params);
+        logger.info("   <--- urQueueRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4026,6 +4314,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_RELEASE)) {
+        return pfnRelease(hQueue);
+    }
+
     ur_queue_release_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_RELEASE,
                                                    "urQueueRelease", &params);
@@ -4039,11 +4331,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_RELEASE,
-                                        &params);
-        logger.info("   <--- urQueueRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_RELEASE, &params);
+        logger.info("   <--- urQueueRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4064,6 +4354,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+    }
+
     ur_queue_get_native_handle_params_t params = {&hQueue, &pDesc,
                                                   &phNativeQueue};
     uint64_t instance = getContext()->notify_begin(
@@ -4079,11 +4373,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urQueueGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4108,6 +4401,11 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
+                                         pProperties, phQueue);
+    }
+
     ur_queue_create_with_native_handle_params_t params = {
         &hNativeQueue, &hContext, &hDevice, &pProperties, &phQueue};
     uint64_t instance =
@@ -4125,11 +4423,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urQueueCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4146,6 +4443,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FINISH)) {
+        return pfnFinish(hQueue);
+    }
+
     ur_queue_finish_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FINISH,
                                                    "urQueueFinish", &params);
@@ -4159,11 +4460,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueFinish(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FINISH,
-                                        &params);
-        logger.info("   <--- urQueueFinish({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_FINISH, &params);
+        logger.info("   <--- urQueueFinish({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4180,6 +4479,10 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_FLUSH)) {
+        return pfnFlush(hQueue);
+    }
+
     ur_queue_flush_params_t params = {&hQueue};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_QUEUE_FLUSH,
                                                    "urQueueFlush", &params);
@@ -4193,11 +4496,9 @@ __urdlllocal ur_result_t UR_APICALL urQueueFlush(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_QUEUE_FLUSH,
-                                        &params);
-        logger.info("   <--- urQueueFlush({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_QUEUE_FLUSH, &params);
+        logger.info("   <--- urQueueFlush({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4220,6 +4521,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_INFO)) {
+        return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+    }
+
     ur_event_get_info_params_t params = {&hEvent, &propName, &propSize,
                                          &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_GET_INFO,
@@ -4235,11 +4540,9 @@ __urdlllocal ur_result_t UR_APICALL urEventGetInfo(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_GET_INFO,
-                                        &params);
-        logger.info("   <--- urEventGetInfo({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_GET_INFO, &params);
+        logger.info("   <--- urEventGetInfo({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4266,6 +4569,11 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
+                                   pPropSizeRet);
+    }
+
     ur_event_get_profiling_info_params_t params = {
         &hEvent, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
@@ -4283,11 +4591,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetProfilingInfo(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_GET_PROFILING_INFO, &params);
         logger.info("   <--- urEventGetProfilingInfo({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4307,6 +4614,10 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT)) {
+        return pfnWait(numEvents, phEventWaitList);
+    }
+
     ur_event_wait_params_t params = {&numEvents, &phEventWaitList};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_WAIT,
                                                    "urEventWait", &params);
@@ -4320,10 +4631,9 @@ __urdlllocal ur_result_t UR_APICALL urEventWait(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_WAIT,
-                                        &params);
-        logger.info("   <--- urEventWait({}) -> {};\n", args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_WAIT, &params);
+        logger.info("   <--- urEventWait({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4340,6 +4650,10 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RETAIN)) {
+        return pfnRetain(hEvent);
+    }
+
     ur_event_retain_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RETAIN,
                                                    "urEventRetain", &params);
@@ -4353,11 +4667,9 @@ __urdlllocal ur_result_t UR_APICALL urEventRetain(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RETAIN,
-                                        &params);
-        logger.info("   <--- urEventRetain({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_RETAIN, &params);
+        logger.info("   <--- urEventRetain({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4374,6 +4686,10 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_RELEASE)) {
+        return pfnRelease(hEvent);
+    }
+
     ur_event_release_params_t params = {&hEvent};
     uint64_t instance = getContext()->notify_begin(UR_FUNCTION_EVENT_RELEASE,
                                                    "urEventRelease", &params);
@@ -4387,11 +4703,9 @@ __urdlllocal ur_result_t UR_APICALL urEventRelease(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_EVENT_RELEASE,
-                                        &params);
-        logger.info("   <--- urEventRelease({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_RELEASE, &params);
+        logger.info("   <--- urEventRelease({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -4410,6 +4724,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        return pfnGetNativeHandle(hEvent, phNativeEvent);
+    }
+
     ur_event_get_native_handle_params_t params = {&hEvent, &phNativeEvent};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, "urEventGetNativeHandle", &params);
@@ -4424,11 +4742,10 @@ __urdlllocal ur_result_t UR_APICALL urEventGetNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE, &params);
         logger.info("   <--- urEventGetNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4452,6 +4769,11 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
+                                         phEvent);
+    }
+
     ur_event_create_with_native_handle_params_t params = {
         &hNativeEvent, &hContext, &pProperties, &phEvent};
     uint64_t instance =
@@ -4469,11 +4791,10 @@ __urdlllocal ur_result_t UR_APICALL urEventCreateWithNativeHandle(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE, &params);
         logger.info("   <--- urEventCreateWithNativeHandle({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4494,6 +4815,10 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+    }
+
     ur_event_set_callback_params_t params = {&hEvent, &execStatus, &pfnNotify,
                                              &pUserData};
     uint64_t instance = getContext()->notify_begin(
@@ -4509,10 +4834,9 @@ __urdlllocal ur_result_t UR_APICALL urEventSetCallback(
                              "urEventSetCallback", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_EVENT_SET_CALLBACK, &params);
-        logger.info("   <--- urEventSetCallback({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_EVENT_SET_CALLBACK, &params);
+        logger.info("   <--- urEventSetCallback({}) -> {};\n", args_str,
                     result);
     }
 
@@ -4555,6 +4879,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
+                               pGlobalWorkSize, pLocalWorkSize,
+                               numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_params_t params = {&hQueue,
                                                 &hKernel,
                                                 &workDim,
@@ -4579,11 +4909,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunch(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH, &params);
         logger.info("   <--- urEnqueueKernelLaunch({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4611,6 +4940,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList,
+                             phEvent);
+    }
+
     ur_enqueue_events_wait_params_t params = {&hQueue, &numEventsInWaitList,
                                               &phEventWaitList, &phEvent};
     uint64_t instance = getContext()->notify_begin(
@@ -4626,10 +4960,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWait(
                              "urEnqueueEventsWait", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT, &params);
-        logger.info("   <--- urEnqueueEventsWait({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_EVENTS_WAIT, &params);
+        logger.info("   <--- urEnqueueEventsWait({}) -> {};\n", args_str,
                     result);
     }
 
@@ -4659,6 +4992,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_events_wait_with_barrier_params_t params = {
         &hQueue, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance =
@@ -4676,11 +5014,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER, &params);
         logger.info("   <--- urEnqueueEventsWaitWithBarrier({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4713,6 +5050,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size,
+                                pDst, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_params_t params = {
         &hQueue, &hBuffer, &blockingRead,        &offset,
         &size,   &pDst,    &numEventsInWaitList, &phEventWaitList,
@@ -4732,11 +5075,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferRead(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ, &params);
         logger.info("   <--- urEnqueueMemBufferRead({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4771,6 +5113,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size,
+                                 pSrc, numEventsInWaitList, phEventWaitList,
+                                 phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_params_t params = {
         &hQueue, &hBuffer, &blockingWrite,       &offset,
         &size,   &pSrc,    &numEventsInWaitList, &phEventWaitList,
@@ -4791,11 +5139,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWrite(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE, &params);
         logger.info("   <--- urEnqueueMemBufferWrite({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4841,6 +5188,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        return pfnMemBufferReadRect(hQueue, hBuffer, blockingRead, bufferOrigin,
+                                    hostOrigin, region, bufferRowPitch,
+                                    bufferSlicePitch, hostRowPitch,
+                                    hostSlicePitch, pDst, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_read_rect_params_t params = {&hQueue,
                                                        &hBuffer,
                                                        &blockingRead,
@@ -4872,11 +5227,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferReadRect({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4925,6 +5279,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        return pfnMemBufferWriteRect(hQueue, hBuffer, blockingWrite,
+                                     bufferOrigin, hostOrigin, region,
+                                     bufferRowPitch, bufferSlicePitch,
+                                     hostRowPitch, hostSlicePitch, pSrc,
+                                     numEventsInWaitList, phEventWaitList,
+                                     phEvent);
+    }
+
     ur_enqueue_mem_buffer_write_rect_params_t params = {&hQueue,
                                                         &hBuffer,
                                                         &blockingWrite,
@@ -4956,11 +5319,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferWriteRect({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -4994,6 +5356,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
+                                dstOffset, size, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_params_t params = {
         &hQueue, &hBufferSrc,          &hBufferDst,      &srcOffset, &dstOffset,
         &size,   &numEventsInWaitList, &phEventWaitList, &phEvent};
@@ -5012,11 +5380,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopy(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY, &params);
         logger.info("   <--- urEnqueueMemBufferCopy({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5060,6 +5427,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        return pfnMemBufferCopyRect(hQueue, hBufferSrc, hBufferDst, srcOrigin,
+                                    dstOrigin, region, srcRowPitch,
+                                    srcSlicePitch, dstRowPitch, dstSlicePitch,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
+    }
+
     ur_enqueue_mem_buffer_copy_rect_params_t params = {
         &hQueue,      &hBufferSrc,    &hBufferDst,          &srcOrigin,
         &dstOrigin,   &region,        &srcRowPitch,         &srcSlicePitch,
@@ -5082,11 +5457,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT, &params);
         logger.info("   <--- urEnqueueMemBufferCopyRect({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5119,6 +5493,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_mem_buffer_fill_params_t params = {&hQueue,
                                                   &hBuffer,
                                                   &pPattern,
@@ -5143,11 +5523,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferFill(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL, &params);
         logger.info("   <--- urEnqueueMemBufferFill({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5185,6 +5564,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
+                               rowPitch, slicePitch, pDst, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_read_params_t params = {
         &hQueue,          &hImage, &blockingRead,
         &origin,          &region, &rowPitch,
@@ -5205,11 +5590,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageRead(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ, &params);
         logger.info("   <--- urEnqueueMemImageRead({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5248,6 +5632,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
+                                rowPitch, slicePitch, pSrc, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_write_params_t params = {
         &hQueue,          &hImage, &blockingWrite,
         &origin,          &region, &rowPitch,
@@ -5268,11 +5658,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageWrite(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE, &params);
         logger.info("   <--- urEnqueueMemImageWrite({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5312,6 +5701,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin,
+                               dstOrigin, region, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_image_copy_params_t params = {
         &hQueue, &hImageSrc,           &hImageDst,       &srcOrigin, &dstOrigin,
         &region, &numEventsInWaitList, &phEventWaitList, &phEvent};
@@ -5330,11 +5725,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemImageCopy(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY, &params);
         logger.info("   <--- urEnqueueMemImageCopy({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5369,6 +5763,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent, ppRetMap);
+    }
+
     ur_enqueue_mem_buffer_map_params_t params = {
         &hQueue,  &hBuffer, &blockingMap,         &mapFlags,
         &offset,  &size,    &numEventsInWaitList, &phEventWaitList,
@@ -5388,11 +5788,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemBufferMap(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP, &params);
         logger.info("   <--- urEnqueueMemBufferMap({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5422,6 +5821,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
+                           phEventWaitList, phEvent);
+    }
+
     ur_enqueue_mem_unmap_params_t params = {
         &hQueue,          &hMem,   &pMappedPtr, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
@@ -5439,11 +5843,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueMemUnmap(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_MEM_UNMAP,
-                                        &params);
-        logger.info("   <--- urEnqueueMemUnmap({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_MEM_UNMAP, &params);
+        logger.info("   <--- urEnqueueMemUnmap({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -5478,6 +5880,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
+                          numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_fill_params_t params = {
         &hQueue,          &pMem,   &patternSize,
         &pPattern,        &size,   &numEventsInWaitList,
@@ -5496,11 +5903,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_ENQUEUE_USM_FILL,
-                                        &params);
-        logger.info("   <--- urEnqueueUSMFill({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_FILL, &params);
+        logger.info("   <--- urEnqueueUSMFill({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -5533,6 +5938,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size,
+                            numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_params_t params = {
         &hQueue,          &blocking, &pDst, &pSrc, &size, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
@@ -5550,10 +5960,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy(
                              "urEnqueueUSMMemcpy", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY, &params);
-        logger.info("   <--- urEnqueueUSMMemcpy({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_MEMCPY, &params);
+        logger.info("   <--- urEnqueueUSMMemcpy({}) -> {};\n", args_str,
                     result);
     }
 
@@ -5585,6 +5994,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_prefetch_params_t params = {
         &hQueue,          &pMem,   &size, &flags, &numEventsInWaitList,
         &phEventWaitList, &phEvent};
@@ -5603,10 +6017,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMPrefetch(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_USM_PREFETCH, &params);
-        logger.info("   <--- urEnqueueUSMPrefetch({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_PREFETCH, &params);
+        logger.info("   <--- urEnqueueUSMPrefetch({}) -> {};\n", args_str,
                     result);
     }
 
@@ -5631,6 +6044,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+    }
+
     ur_enqueue_usm_advise_params_t params = {&hQueue, &pMem, &size, &advice,
                                              &phEvent};
     uint64_t instance = getContext()->notify_begin(
@@ -5645,10 +6062,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMAdvise(
                              "urEnqueueUSMAdvise", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_USM_ADVISE, &params);
-        logger.info("   <--- urEnqueueUSMAdvise({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_ADVISE, &params);
+        logger.info("   <--- urEnqueueUSMAdvise({}) -> {};\n", args_str,
                     result);
     }
 
@@ -5688,6 +6104,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FILL_2D)) {
+        return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
+                            height, numEventsInWaitList, phEventWaitList,
+                            phEvent);
+    }
+
     ur_enqueue_usm_fill_2d_params_t params = {
         &hQueue,          &pMem,   &pitch,  &patternSize,
         &pPattern,        &width,  &height, &numEventsInWaitList,
@@ -5706,10 +6128,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMFill2D(
                              "urEnqueueUSMFill2D", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_USM_FILL_2D, &params);
-        logger.info("   <--- urEnqueueUSMFill2D({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_FILL_2D, &params);
+        logger.info("   <--- urEnqueueUSMFill2D({}) -> {};\n", args_str,
                     result);
     }
 
@@ -5748,6 +6169,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D)) {
+        return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
+                              width, height, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+    }
+
     ur_enqueue_usm_memcpy_2d_params_t params = {
         &hQueue,          &blocking, &pDst,
         &dstPitch,        &pSrc,     &srcPitch,
@@ -5768,10 +6195,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, &params);
-        logger.info("   <--- urEnqueueUSMMemcpy2D({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D, &params);
+        logger.info("   <--- urEnqueueUSMMemcpy2D({}) -> {};\n", args_str,
                     result);
     }
 
@@ -5808,6 +6234,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        return pfnDeviceGlobalVariableWrite(hQueue, hProgram, name,
+                                            blockingWrite, count, offset, pSrc,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+    }
+
     ur_enqueue_device_global_variable_write_params_t params = {
         &hQueue,          &hProgram, &name, &blockingWrite,
         &count,           &offset,   &pSrc, &numEventsInWaitList,
@@ -5828,12 +6262,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE, &params);
         logger.info("   <--- urEnqueueDeviceGlobalVariableWrite({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5869,6 +6301,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
+                                           count, offset, pDst,
+                                           numEventsInWaitList, phEventWaitList,
+                                           phEvent);
+    }
+
     ur_enqueue_device_global_variable_read_params_t params = {
         &hQueue,          &hProgram, &name, &blockingRead,
         &count,           &offset,   &pDst, &numEventsInWaitList,
@@ -5889,11 +6329,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ, &params);
         logger.info("   <--- urEnqueueDeviceGlobalVariableRead({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5933,6 +6372,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE)) {
+        return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst,
+                               size, numEventsInWaitList, phEventWaitList,
+                               phEvent);
+    }
+
     ur_enqueue_read_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pDst,   &size,     &numEventsInWaitList, &phEventWaitList,
@@ -5952,11 +6397,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueReadHostPipe(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE, &params);
         logger.info("   <--- urEnqueueReadHostPipe({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -5997,6 +6441,12 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE)) {
+        return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc,
+                                size, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+    }
+
     ur_enqueue_write_host_pipe_params_t params = {
         &hQueue, &hProgram, &pipe_symbol,         &blocking,
         &pSrc,   &size,     &numEventsInWaitList, &phEventWaitList,
@@ -6016,11 +6466,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueWriteHostPipe(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE, &params);
         logger.info("   <--- urEnqueueWriteHostPipe({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6050,6 +6499,12 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_USM_PITCHED_ALLOC_EXP)) {
+        return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool,
+                                  widthInBytes, height, elementSizeBytes, ppMem,
+                                  pResultPitch);
+    }
+
     ur_usm_pitched_alloc_exp_params_t params = {
         &hContext, &hDevice,          &pUSMDesc, &pool,        &widthInBytes,
         &height,   &elementSizeBytes, &ppMem,    &pResultPitch};
@@ -6068,10 +6523,9 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_USM_PITCHED_ALLOC_EXP, &params);
-        logger.info("   <--- urUSMPitchedAllocExp({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_PITCHED_ALLOC_EXP, &params);
+        logger.info("   <--- urUSMPitchedAllocExp({}) -> {};\n", args_str,
                     result);
     }
 
@@ -6095,6 +6549,11 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_unsampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
@@ -6113,15 +6572,12 @@ urBindlessImagesUnsampledImageHandleDestroyExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesUnsampledImageHandleDestroyExp({}) -> "
             "{};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6144,6 +6600,11 @@ urBindlessImagesSampledImageHandleDestroyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+    }
+
     ur_bindless_images_sampled_image_handle_destroy_exp_params_t params = {
         &hContext, &hDevice, &hImage};
     uint64_t instance = getContext()->notify_begin(
@@ -6162,14 +6623,11 @@ urBindlessImagesSampledImageHandleDestroyExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesSampledImageHandleDestroyExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6193,6 +6651,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP)) {
+        return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
+                                   phImageMem);
+    }
+
     ur_bindless_images_image_allocate_exp_params_t params = {
         &hContext, &hDevice, &pImageFormat, &pImageDesc, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
@@ -6210,11 +6674,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP, &params);
         logger.info("   <--- urBindlessImagesImageAllocateExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6235,6 +6698,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP)) {
+        return pfnImageFreeExp(hContext, hDevice, hImageMem);
+    }
+
     ur_bindless_images_image_free_exp_params_t params = {&hContext, &hDevice,
                                                          &hImageMem};
     uint64_t instance =
@@ -6251,11 +6718,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP, &params);
         logger.info("   <--- urBindlessImagesImageFreeExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6281,6 +6747,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
+                                          pImageFormat, pImageDesc, phImage);
+    }
+
     ur_bindless_images_unsampled_image_create_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &pImageFormat, &pImageDesc, &phImage};
     uint64_t instance = getContext()->notify_begin(
@@ -6298,13 +6770,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
         "urBindlessImagesUnsampledImageCreateExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesUnsampledImageCreateExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6331,6 +6801,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP)) {
+        return pfnSampledImageCreateExp(hContext, hDevice, hImageMem,
+                                        pImageFormat, pImageDesc, hSampler,
+                                        phImage);
+    }
+
     ur_bindless_images_sampled_image_create_exp_params_t params = {
         &hContext,   &hDevice,  &hImageMem, &pImageFormat,
         &pImageDesc, &hSampler, &phImage};
@@ -6350,13 +6827,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
         "urBindlessImagesSampledImageCreateExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesSampledImageCreateExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6398,6 +6873,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP)) {
+        return pfnImageCopyExp(hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc,
+                               pSrcImageFormat, pDstImageFormat, pCopyRegion,
+                               imageCopyFlags, numEventsInWaitList,
+                               phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_image_copy_exp_params_t params = {&hQueue,
                                                          &pSrc,
                                                          &pDst,
@@ -6427,11 +6909,87 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP, &params);
         logger.info("   <--- urBindlessImagesImageCopyExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesImageCopyBatchExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    uint32_t numCopyRegions, ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *
+        pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+    ///< must not refer to an element of the phEventWaitList array.
+) {
+    auto pfnImageCopyBatchExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyBatchExp;
+
+    if (nullptr == pfnImageCopyBatchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP)) {
+        return pfnImageCopyBatchExp(hQueue, pSrc, pDst, pSrcImageDesc,
+                                    pDstImageDesc, pSrcImageFormat,
+                                    pDstImageFormat, numCopyRegions,
+                                    pCopyRegions, imageCopyFlags,
+                                    numEventsInWaitList, phEventWaitList,
+                                    phEvent);
+    }
+
+    ur_bindless_images_image_copy_batch_exp_params_t params = {
+        &hQueue, &pSrc, &pDst, &pSrcImageDesc, &pDstImageDesc,
+        &pSrcImageFormat, &pDstImageFormat, &numCopyRegions, &pCopyRegions,
+        &imageCopyFlags, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP,
+        "urBindlessImagesImageCopyBatchExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urBindlessImagesImageCopyBatchExp\n");
+
+    ur_result_t result = pfnImageCopyBatchExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP,
+                             "urBindlessImagesImageCopyBatchExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP, &params);
+        logger.info("   <--- urBindlessImagesImageCopyBatchExp({}) -> {};\n",
+                    args_str, result);
     }
 
     return result;
@@ -6454,6 +7012,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP)) {
+        return pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
+                                  pPropSizeRet);
+    }
+
     ur_bindless_images_image_get_info_exp_params_t params = {
         &hContext, &hImageMem, &propName, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -6471,11 +7035,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP, &params);
         logger.info("   <--- urBindlessImagesImageGetInfoExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6499,6 +7062,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP)) {
+        return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
+                                    phImageMem);
+    }
+
     ur_bindless_images_mipmap_get_level_exp_params_t params = {
         &hContext, &hDevice, &hImageMem, &mipmapLevel, &phImageMem};
     uint64_t instance = getContext()->notify_begin(
@@ -6516,12 +7085,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP, &params);
         logger.info("   <--- urBindlessImagesMipmapGetLevelExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6542,6 +7109,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP)) {
+        return pfnMipmapFreeExp(hContext, hDevice, hMem);
+    }
+
     ur_bindless_images_mipmap_free_exp_params_t params = {&hContext, &hDevice,
                                                           &hMem};
     uint64_t instance =
@@ -6558,11 +7129,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP, &params);
         logger.info("   <--- urBindlessImagesMipmapFreeExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6588,6 +7158,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP)) {
+        return pfnImportExternalMemoryExp(hContext, hDevice, size,
+                                          memHandleType, pExternalMemDesc,
+                                          phExternalMem);
+    }
+
     ur_bindless_images_import_external_memory_exp_params_t params = {
         &hContext,      &hDevice,          &size,
         &memHandleType, &pExternalMemDesc, &phExternalMem};
@@ -6607,13 +7184,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
         "urBindlessImagesImportExternalMemoryExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesImportExternalMemoryExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6639,6 +7214,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP)) {
+        return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat,
+                                      pImageDesc, hExternalMem, phImageMem);
+    }
+
     ur_bindless_images_map_external_array_exp_params_t params = {
         &hContext,   &hDevice,      &pImageFormat,
         &pImageDesc, &hExternalMem, &phImageMem};
@@ -6657,12 +7238,10 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP, &params);
         logger.info("   <--- urBindlessImagesMapExternalArrayExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -6687,6 +7266,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP)) {
+        return pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
+                                             hExternalMem, ppRetMem);
+    }
+
     ur_bindless_images_map_external_linear_memory_exp_params_t params = {
         &hContext, &hDevice, &offset, &size, &hExternalMem, &ppRetMem};
     uint64_t instance = getContext()->notify_begin(
@@ -6705,14 +7290,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesMapExternalLinearMemoryExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6733,6 +7315,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP)) {
+        return pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+    }
+
     ur_bindless_images_release_external_memory_exp_params_t params = {
         &hContext, &hDevice, &hExternalMem};
     uint64_t instance = getContext()->notify_begin(
@@ -6750,13 +7337,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
         "urBindlessImagesReleaseExternalMemoryExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesReleaseExternalMemoryExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6782,6 +7367,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
+                                             pExternalSemaphoreDesc,
+                                             phExternalSemaphore);
+    }
+
     ur_bindless_images_import_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &semHandleType, &pExternalSemaphoreDesc,
         &phExternalSemaphore};
@@ -6802,13 +7394,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesImportExternalSemaphoreExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6830,6 +7420,12 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnReleaseExternalSemaphoreExp(hContext, hDevice,
+                                              hExternalSemaphore);
+    }
+
     ur_bindless_images_release_external_semaphore_exp_params_t params = {
         &hContext, &hDevice, &hExternalSemaphore};
     uint64_t instance = getContext()->notify_begin(
@@ -6848,14 +7444,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesReleaseExternalSemaphoreExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6892,6 +7485,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
+                                           waitValue, numEventsInWaitList,
+                                           phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_wait_external_semaphore_exp_params_t params = {
         &hQueue,    &hSemaphore,          &hasWaitValue,
         &waitValue, &numEventsInWaitList, &phEventWaitList,
@@ -6912,13 +7512,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
         "urBindlessImagesWaitExternalSemaphoreExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesWaitExternalSemaphoreExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -6956,6 +7554,13 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP)) {
+        return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
+                                             signalValue, numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_bindless_images_signal_external_semaphore_exp_params_t params = {
         &hQueue,      &hSemaphore,          &hasSignalValue,
         &signalValue, &numEventsInWaitList, &phEventWaitList,
@@ -6977,13 +7582,11 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP, &params);
         logger.info(
             "   <--- urBindlessImagesSignalExternalSemaphoreExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7005,6 +7608,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP)) {
+        return pfnCreateExp(hContext, hDevice, pCommandBufferDesc,
+                            phCommandBuffer);
+    }
+
     ur_command_buffer_create_exp_params_t params = {
         &hContext, &hDevice, &pCommandBufferDesc, &phCommandBuffer};
     uint64_t instance =
@@ -7022,11 +7630,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCreateExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP, &params);
         logger.info("   <--- urCommandBufferCreateExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7044,6 +7651,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP)) {
+        return pfnRetainExp(hCommandBuffer);
+    }
+
     ur_command_buffer_retain_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP,
@@ -7059,11 +7670,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP, &params);
         logger.info("   <--- urCommandBufferRetainExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7082,6 +7692,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP)) {
+        return pfnReleaseExp(hCommandBuffer);
+    }
+
     ur_command_buffer_release_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP,
@@ -7097,11 +7711,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP, &params);
         logger.info("   <--- urCommandBufferReleaseExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7120,6 +7733,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP)) {
+        return pfnFinalizeExp(hCommandBuffer);
+    }
+
     ur_command_buffer_finalize_exp_params_t params = {&hCommandBuffer};
     uint64_t instance =
         getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP,
@@ -7135,11 +7752,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferFinalizeExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP, &params);
         logger.info("   <--- urCommandBufferFinalizeExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7195,6 +7811,18 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP)) {
+        return pfnAppendKernelLaunchExp(hCommandBuffer, hKernel, workDim,
+                                        pGlobalWorkOffset, pGlobalWorkSize,
+                                        pLocalWorkSize, numKernelAlternatives,
+                                        phKernelAlternatives,
+                                        numSyncPointsInWaitList,
+                                        pSyncPointWaitList, numEventsInWaitList,
+                                        phEventWaitList, pSyncPoint, phEvent,
+                                        phCommand);
+    }
+
     ur_command_buffer_append_kernel_launch_exp_params_t params = {
         &hCommandBuffer,
         &hKernel,
@@ -7229,12 +7857,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         "urCommandBufferAppendKernelLaunchExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP, &params);
         logger.info("   <--- urCommandBufferAppendKernelLaunchExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7274,6 +7900,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP)) {
+        return pfnAppendUSMMemcpyExp(hCommandBuffer, pDst, pSrc, size,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, numEventsInWaitList,
+                                     phEventWaitList, pSyncPoint, phEvent,
+                                     phCommand);
+    }
+
     ur_command_buffer_append_usm_memcpy_exp_params_t params = {
         &hCommandBuffer,
         &pDst,
@@ -7303,12 +7938,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP, &params);
         logger.info("   <--- urCommandBufferAppendUSMMemcpyExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7350,6 +7983,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP)) {
+        return pfnAppendUSMFillExp(hCommandBuffer, pMemory, pPattern,
+                                   patternSize, size, numSyncPointsInWaitList,
+                                   pSyncPointWaitList, numEventsInWaitList,
+                                   phEventWaitList, pSyncPoint, phEvent,
+                                   phCommand);
+    }
+
     ur_command_buffer_append_usm_fill_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -7380,11 +8022,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP, &params);
         logger.info("   <--- urCommandBufferAppendUSMFillExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -7426,6 +8067,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP)) {
+        return pfnAppendMemBufferCopyExp(hCommandBuffer, hSrcMem, hDstMem,
+                                         srcOffset, dstOffset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList,
+                                         numEventsInWaitList, phEventWaitList,
+                                         pSyncPoint, phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -7457,13 +8108,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         "urCommandBufferAppendMemBufferCopyExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferCopyExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7505,6 +8154,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP)) {
+        return pfnAppendMemBufferWriteExp(hCommandBuffer, hBuffer, offset, size,
+                                          pSrc, numSyncPointsInWaitList,
+                                          pSyncPointWaitList,
+                                          numEventsInWaitList, phEventWaitList,
+                                          pSyncPoint, phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_write_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7535,13 +8193,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         "urCommandBufferAppendMemBufferWriteExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferWriteExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7582,6 +8238,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP)) {
+        return pfnAppendMemBufferReadExp(hCommandBuffer, hBuffer, offset, size,
+                                         pDst, numSyncPointsInWaitList,
+                                         pSyncPointWaitList,
+                                         numEventsInWaitList, phEventWaitList,
+                                         pSyncPoint, phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_read_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7612,13 +8277,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         "urCommandBufferAppendMemBufferReadExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferReadExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7667,6 +8330,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP)) {
+        return pfnAppendMemBufferCopyRectExp(hCommandBuffer, hSrcMem, hDstMem,
+                                             srcOrigin, dstOrigin, region,
+                                             srcRowPitch, srcSlicePitch,
+                                             dstRowPitch, dstSlicePitch,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList,
+                                             numEventsInWaitList,
+                                             phEventWaitList, pSyncPoint,
+                                             phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_copy_rect_exp_params_t params = {
         &hCommandBuffer,
         &hSrcMem,
@@ -7704,14 +8380,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferCopyRectExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7767,6 +8440,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP)) {
+        return pfnAppendMemBufferWriteRectExp(hCommandBuffer, hBuffer,
+                                              bufferOffset, hostOffset, region,
+                                              bufferRowPitch, bufferSlicePitch,
+                                              hostRowPitch, hostSlicePitch,
+                                              pSrc, numSyncPointsInWaitList,
+                                              pSyncPointWaitList,
+                                              numEventsInWaitList,
+                                              phEventWaitList, pSyncPoint,
+                                              phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_write_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7804,14 +8490,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferWriteRectExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7864,6 +8547,19 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP)) {
+        return pfnAppendMemBufferReadRectExp(hCommandBuffer, hBuffer,
+                                             bufferOffset, hostOffset, region,
+                                             bufferRowPitch, bufferSlicePitch,
+                                             hostRowPitch, hostSlicePitch, pDst,
+                                             numSyncPointsInWaitList,
+                                             pSyncPointWaitList,
+                                             numEventsInWaitList,
+                                             phEventWaitList, pSyncPoint,
+                                             phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_read_rect_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7901,14 +8597,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferReadRectExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -7951,6 +8644,16 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP)) {
+        return pfnAppendMemBufferFillExp(hCommandBuffer, hBuffer, pPattern,
+                                         patternSize, offset, size,
+                                         numSyncPointsInWaitList,
+                                         pSyncPointWaitList,
+                                         numEventsInWaitList, phEventWaitList,
+                                         pSyncPoint, phEvent, phCommand);
+    }
+
     ur_command_buffer_append_mem_buffer_fill_exp_params_t params = {
         &hCommandBuffer,
         &hBuffer,
@@ -7982,13 +8685,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         "urCommandBufferAppendMemBufferFillExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP, &params);
         logger.info(
             "   <--- urCommandBufferAppendMemBufferFillExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
@@ -8028,6 +8729,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP)) {
+        return pfnAppendUSMPrefetchExp(hCommandBuffer, pMemory, size, flags,
+                                       numSyncPointsInWaitList,
+                                       pSyncPointWaitList, numEventsInWaitList,
+                                       phEventWaitList, pSyncPoint, phEvent,
+                                       phCommand);
+    }
+
     ur_command_buffer_append_usm_prefetch_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -8057,12 +8767,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP, &params);
         logger.info("   <--- urCommandBufferAppendUSMPrefetchExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8102,6 +8810,15 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP)) {
+        return pfnAppendUSMAdviseExp(hCommandBuffer, pMemory, size, advice,
+                                     numSyncPointsInWaitList,
+                                     pSyncPointWaitList, numEventsInWaitList,
+                                     phEventWaitList, pSyncPoint, phEvent,
+                                     phCommand);
+    }
+
     ur_command_buffer_append_usm_advise_exp_params_t params = {
         &hCommandBuffer,
         &pMemory,
@@ -8131,12 +8848,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP, &params);
         logger.info("   <--- urCommandBufferAppendUSMAdviseExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8166,6 +8881,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP)) {
+        return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
+                             phEventWaitList, phEvent);
+    }
+
     ur_command_buffer_enqueue_exp_params_t params = {
         &hCommandBuffer, &hQueue, &numEventsInWaitList, &phEventWaitList,
         &phEvent};
@@ -8184,11 +8904,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferEnqueueExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP, &params);
         logger.info("   <--- urCommandBufferEnqueueExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8207,6 +8926,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP)) {
+        return pfnRetainCommandExp(hCommand);
+    }
+
     ur_command_buffer_retain_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP,
@@ -8222,11 +8946,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP, &params);
         logger.info("   <--- urCommandBufferRetainCommandExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8245,6 +8968,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP)) {
+        return pfnReleaseCommandExp(hCommand);
+    }
+
     ur_command_buffer_release_command_exp_params_t params = {&hCommand};
     uint64_t instance = getContext()->notify_begin(
         UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP,
@@ -8260,11 +8988,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP, &params);
         logger.info("   <--- urCommandBufferReleaseCommandExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8285,6 +9012,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP)) {
+        return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+    }
+
     ur_command_buffer_update_kernel_launch_exp_params_t params = {
         &hCommand, &pUpdateKernelLaunch};
     uint64_t instance = getContext()->notify_begin(
@@ -8302,12 +9034,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
         "urCommandBufferUpdateKernelLaunchExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP, &params);
         logger.info("   <--- urCommandBufferUpdateKernelLaunchExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8327,6 +9057,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP)) {
+        return pfnUpdateSignalEventExp(hCommand, phSignalEvent);
+    }
+
     ur_command_buffer_update_signal_event_exp_params_t params = {
         &hCommand, &phSignalEvent};
     uint64_t instance = getContext()->notify_begin(
@@ -8343,12 +9078,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP, &params);
         logger.info("   <--- urCommandBufferUpdateSignalEventExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8372,6 +9105,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP)) {
+        return pfnUpdateWaitEventsExp(hCommand, numEventsInWaitList,
+                                      phEventWaitList);
+    }
+
     ur_command_buffer_update_wait_events_exp_params_t params = {
         &hCommand, &numEventsInWaitList, &phEventWaitList};
     uint64_t instance = getContext()->notify_begin(
@@ -8389,12 +9128,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP, &params);
         logger.info("   <--- urCommandBufferUpdateWaitEventsExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8422,6 +9159,11 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP)) {
+        return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
+                             pPropSizeRet);
+    }
+
     ur_command_buffer_get_info_exp_params_t params = {
         &hCommandBuffer, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance =
@@ -8439,11 +9181,10 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferGetInfoExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP, &params);
         logger.info("   <--- urCommandBufferGetInfoExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8471,6 +9212,12 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP)) {
+        return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
+                                    pPropSizeRet);
+    }
+
     ur_command_buffer_command_get_info_exp_params_t params = {
         &hCommand, &propName, &propSize, &pPropValue, &pPropSizeRet};
     uint64_t instance = getContext()->notify_begin(
@@ -8488,11 +9235,107 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP, &params);
         logger.info("   <--- urCommandBufferCommandGetInfoExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUpdateKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t
+        numKernelUpdates, ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *
+        phCommands, ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                    ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                            ///< command is to be updated.
+) {
+    auto pfnUpdateKernelLaunchBatchExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchBatchExp;
+
+    if (nullptr == pfnUpdateKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP)) {
+        return pfnUpdateKernelLaunchBatchExp(hCommandBuffer, numKernelUpdates,
+                                             phCommands, pUpdateKernelLaunch);
+    }
+
+    ur_command_buffer_update_kernel_launch_batch_exp_params_t params = {
+        &hCommandBuffer, &numKernelUpdates, &phCommands, &pUpdateKernelLaunch};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP,
+        "urCommandBufferUpdateKernelLaunchBatchExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferUpdateKernelLaunchBatchExp\n");
+
+    ur_result_t result = pfnUpdateKernelLaunchBatchExp(
+        hCommandBuffer, numKernelUpdates, phCommands, pUpdateKernelLaunch);
+
+    getContext()->notify_end(
+        UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP,
+        "urCommandBufferUpdateKernelLaunchBatchExp", &params, &result,
+        instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP, &params);
+        logger.info(
+            "   <--- urCommandBufferUpdateKernelLaunchBatchExp({}) -> {};\n",
+            args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUploadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue ///< [in] The queue to upload the command-buffer on.
+) {
+    auto pfnUploadExp = getContext()->urDdiTable.CommandBufferExp.pfnUploadExp;
+
+    if (nullptr == pfnUploadExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP)) {
+        return pfnUploadExp(hCommandBuffer, hQueue);
+    }
+
+    ur_command_buffer_upload_exp_params_t params = {&hCommandBuffer, &hQueue};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP,
+                                   "urCommandBufferUploadExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urCommandBufferUploadExp\n");
+
+    ur_result_t result = pfnUploadExp(hCommandBuffer, hQueue);
+
+    getContext()->notify_end(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP,
+                             "urCommandBufferUploadExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP, &params);
+        logger.info("   <--- urCommandBufferUploadExp({}) -> {};\n", args_str,
+                    result);
     }
 
     return result;
@@ -8535,6 +9378,15 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP)) {
+        return pfnCooperativeKernelLaunchExp(hQueue, hKernel, workDim,
+                                             pGlobalWorkOffset, pGlobalWorkSize,
+                                             pLocalWorkSize,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+    }
+
     ur_enqueue_cooperative_kernel_launch_exp_params_t params = {
         &hQueue,
         &hKernel,
@@ -8561,12 +9413,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
                              &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP, &params);
         logger.info("   <--- urEnqueueCooperativeKernelLaunchExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8592,6 +9442,13 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP)) {
+        return pfnSuggestMaxCooperativeGroupCountExp(hKernel, localWorkSize,
+                                                     dynamicSharedMemorySize,
+                                                     pGroupCountRet);
+    }
+
     ur_kernel_suggest_max_cooperative_group_count_exp_params_t params = {
         &hKernel, &localWorkSize, &dynamicSharedMemorySize, &pGroupCountRet};
     uint64_t instance = getContext()->notify_begin(
@@ -8610,25 +9467,64 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
         instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str,
-            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP,
-            &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP, &params);
         logger.info(
             "   <--- urKernelSuggestMaxCooperativeGroupCountExp({}) -> {};\n",
-            args_str.str(), result);
+            args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urEnqueueTimestampRecordingExp
-__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
-    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    bool
-        blocking, ///< [in] indicates whether the call to this function should block until
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_KERNEL_SET_ARGS_EXP)) {
+        return pfnSetArgsExp(hKernel, numArgs, pArgs);
+    }
+
+    ur_kernel_set_args_exp_params_t params = {&hKernel, &numArgs, &pArgs};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_KERNEL_SET_ARGS_EXP,
+                                   "urKernelSetArgsExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urKernelSetArgsExp\n");
+
+    ur_result_t result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    getContext()->notify_end(UR_FUNCTION_KERNEL_SET_ARGS_EXP,
+                             "urKernelSetArgsExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_KERNEL_SET_ARGS_EXP, &params);
+        logger.info("   <--- urKernelSetArgsExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueTimestampRecordingExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool
+        blocking, ///< [in] indicates whether the call to this function should block until
     ///< until the device timestamp recording command has executed on the
     ///< device.
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
@@ -8654,6 +9550,11 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP)) {
+        return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_timestamp_recording_exp_params_t params = {
         &hQueue, &blocking, &numEventsInWaitList, &phEventWaitList, &phEvent};
     uint64_t instance =
@@ -8671,11 +9572,52 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP, &params);
         logger.info("   <--- urEnqueueTimestampRecordingExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                         ///< completion of any of
+    uint32_t *pIndex     ///< [out] index in `phEventWaitList` of a completed event
+) {
+    auto pfnWaitAnyExp = getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_WAIT_ANY_EXP)) {
+        return pfnWaitAnyExp(numEvents, phEventWaitList, pIndex);
+    }
+
+    ur_event_wait_any_exp_params_t params = {&numEvents, &phEventWaitList,
+                                             &pIndex};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_EVENT_WAIT_ANY_EXP, "urEventWaitAnyExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventWaitAnyExp\n");
+
+    ur_result_t result = pfnWaitAnyExp(numEvents, phEventWaitList, pIndex);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_WAIT_ANY_EXP,
+                             "urEventWaitAnyExp", &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_EVENT_WAIT_ANY_EXP, &params);
+        logger.info("   <--- urEventWaitAnyExp({}) -> {};\n", args_str,
+                    result);
     }
 
     return result;
@@ -8720,6 +9662,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP)) {
+        return pfnKernelLaunchCustomExp(hQueue, hKernel, workDim,
+                                        pGlobalWorkSize, pLocalWorkSize,
+                                        numPropsInLaunchPropList,
+                                        launchPropList, numEventsInWaitList,
+                                        phEventWaitList, phEvent);
+    }
+
     ur_enqueue_kernel_launch_custom_exp_params_t params = {
         &hQueue,          &hKernel,
         &workDim,         &pGlobalWorkSize,
@@ -8743,11 +9693,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP, &params);
         logger.info("   <--- urEnqueueKernelLaunchCustomExp({}) -> {};\n",
-                    args_str.str(), result);
+                    args_str, result);
     }
 
     return result;
@@ -8769,6 +9718,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD_EXP)) {
+        return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_build_exp_params_t params = {&hProgram, &numDevices, &phDevices,
                                             &pOptions};
     uint64_t instance = getContext()->notify_begin(
@@ -8783,11 +9736,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramBuildExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_BUILD_EXP,
-                                        &params);
-        logger.info("   <--- urProgramBuildExp({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_BUILD_EXP, &params);
+        logger.info("   <--- urProgramBuildExp({}) -> {};\n", args_str, result);
     }
 
     return result;
@@ -8810,6 +9761,10 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_COMPILE_EXP)) {
+        return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+    }
+
     ur_program_compile_exp_params_t params = {&hProgram, &numDevices,
                                               &phDevices, &pOptions};
     uint64_t instance = getContext()->notify_begin(
@@ -8825,10 +9780,9 @@ __urdlllocal ur_result_t UR_APICALL urProgramCompileExp(
                              "urProgramCompileExp", &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_PROGRAM_COMPILE_EXP, &params);
-        logger.info("   <--- urProgramCompileExp({}) -> {};\n", args_str.str(),
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_COMPILE_EXP, &params);
+        logger.info("   <--- urProgramCompileExp({}) -> {};\n", args_str,
                     result);
     }
 
@@ -8859,6 +9813,11 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_LINK_EXP)) {
+        return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
+                          pOptions, phProgram);
+    }
+
     ur_program_link_exp_params_t params = {&hContext, &numDevices, &phDevices,
                                            &count,    &phPrograms, &pOptions,
                                            &phProgram};
@@ -8875,331 +9834,1140 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
                              &params, &result, instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_PROGRAM_LINK_EXP,
-                                        &params);
-        logger.info("   <--- urProgramLinkExp({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_LINK_EXP, &params);
+        logger.info("   <--- urProgramLinkExp({}) -> {};\n", args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMImportExp
-__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem,                   ///< [in] pointer to host memory object
-    size_t size ///< [in] size in bytes of the host memory object to be imported
+/// @brief Intercept function for urEnqueueKernelLaunchMultiExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
 ) {
-    auto pfnImportExp = getContext()->urDdiTable.USMExp.pfnImportExp;
+    auto pfnKernelLaunchMultiExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchMultiExp;
 
-    if (nullptr == pfnImportExp) {
+    if (nullptr == pfnKernelLaunchMultiExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
-    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
-                                                   "urUSMImportExp", &params);
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP)) {
+        return pfnKernelLaunchMultiExp(numLaunches, pLaunches);
+    }
+
+    ur_enqueue_kernel_launch_multi_exp_params_t params = {&numLaunches,
+                                                          &pLaunches};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP,
+                                   "urEnqueueKernelLaunchMultiExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urUSMImportExp\n");
+    logger.info("   ---> urEnqueueKernelLaunchMultiExp\n");
 
-    ur_result_t result = pfnImportExp(hContext, pMem, size);
+    ur_result_t result = pfnKernelLaunchMultiExp(numLaunches, pLaunches);
 
-    getContext()->notify_end(UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp",
-                             &params, &result, instance);
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP,
+                             "urEnqueueKernelLaunchMultiExp", &params, &result,
+                             instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_IMPORT_EXP,
-                                        &params);
-        logger.info("   <--- urUSMImportExp({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP, &params);
+        logger.info("   <--- urEnqueueKernelLaunchMultiExp({}) -> {};\n",
+                    args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMReleaseExp
-__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem                    ///< [in] pointer to host memory object
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
 ) {
-    auto pfnReleaseExp = getContext()->urDdiTable.USMExp.pfnReleaseExp;
+    auto pfnBuildAsyncExp =
+        getContext()->urDdiTable.ProgramExp.pfnBuildAsyncExp;
 
-    if (nullptr == pfnReleaseExp) {
+    if (nullptr == pfnBuildAsyncExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_usm_release_exp_params_t params = {&hContext, &pMem};
-    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
-                                                   "urUSMReleaseExp", &params);
+    if (!getContext()->isTraced(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP)) {
+        return pfnBuildAsyncExp(hProgram, hQueue, pOptions, phEvent);
+    }
+
+    ur_program_build_async_exp_params_t params = {&hProgram, &hQueue,
+                                                  &pOptions, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP,
+                                   "urProgramBuildAsyncExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urUSMReleaseExp\n");
+    logger.info("   ---> urProgramBuildAsyncExp\n");
 
-    ur_result_t result = pfnReleaseExp(hContext, pMem);
+    ur_result_t result = pfnBuildAsyncExp(hProgram, hQueue, pOptions, phEvent);
 
-    getContext()->notify_end(UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp",
-                             &params, &result, instance);
+    getContext()->notify_end(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP,
+                             "urProgramBuildAsyncExp", &params, &result,
+                             instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(args_str, UR_FUNCTION_USM_RELEASE_EXP,
-                                        &params);
-        logger.info("   <--- urUSMReleaseExp({}) -> {};\n", args_str.str(),
-                    result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP, &params);
+        logger.info("   <--- urProgramBuildAsyncExp({}) -> {};\n",
+                    args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urQueueBeginCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueBeginCaptureExp(
+    ur_queue_handle_t
+        hQueue ///< [in] handle of the queue to capture the commands of
 ) {
-    auto pfnEnablePeerAccessExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+    auto pfnBeginCaptureExp =
+        getContext()->urDdiTable.QueueExp.pfnBeginCaptureExp;
 
-    if (nullptr == pfnEnablePeerAccessExp) {
+    if (nullptr == pfnBeginCaptureExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
-                                                         &peerDevice};
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP)) {
+        return pfnBeginCaptureExp(hQueue);
+    }
+
+    ur_queue_begin_capture_exp_params_t params = {&hQueue};
     uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
-                                   "urUsmP2PEnablePeerAccessExp", &params);
+        getContext()->notify_begin(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP,
+                                   "urQueueBeginCaptureExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urUsmP2PEnablePeerAccessExp\n");
+    logger.info("   ---> urQueueBeginCaptureExp\n");
 
-    ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    ur_result_t result = pfnBeginCaptureExp(hQueue);
 
-    getContext()->notify_end(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
-                             "urUsmP2PEnablePeerAccessExp", &params, &result,
+    getContext()->notify_end(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP,
+                             "urQueueBeginCaptureExp", &params, &result,
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params);
-        logger.info("   <--- urUsmP2PEnablePeerAccessExp({}) -> {};\n",
-                    args_str.str(), result);
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP, &params);
+        logger.info("   <--- urQueueBeginCaptureExp({}) -> {};\n", args_str,
+                    result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urQueueEndCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *
+        phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                        ///< commands
 ) {
-    auto pfnDisablePeerAccessExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+    auto pfnEndCaptureExp = getContext()->urDdiTable.QueueExp.pfnEndCaptureExp;
 
-    if (nullptr == pfnDisablePeerAccessExp) {
+    if (nullptr == pfnEndCaptureExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
-                                                          &peerDevice};
+    if (!getContext()->isTraced(UR_FUNCTION_QUEUE_END_CAPTURE_EXP)) {
+        return pfnEndCaptureExp(hQueue, phCommandBuffer);
+    }
+
+    ur_queue_end_capture_exp_params_t params = {&hQueue, &phCommandBuffer};
     uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
-                                   "urUsmP2PDisablePeerAccessExp", &params);
+        getContext()->notify_begin(UR_FUNCTION_QUEUE_END_CAPTURE_EXP,
+                                   "urQueueEndCaptureExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urUsmP2PDisablePeerAccessExp\n");
+    logger.info("   ---> urQueueEndCaptureExp\n");
 
-    ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    ur_result_t result = pfnEndCaptureExp(hQueue, phCommandBuffer);
 
-    getContext()->notify_end(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
-                             "urUsmP2PDisablePeerAccessExp", &params, &result,
+    getContext()->notify_end(UR_FUNCTION_QUEUE_END_CAPTURE_EXP,
+                             "urQueueEndCaptureExp", &params, &result,
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params);
-        logger.info("   <--- urUsmP2PDisablePeerAccessExp({}) -> {};\n",
-                    args_str.str(), result);
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_QUEUE_END_CAPTURE_EXP, &params);
+        logger.info("   <--- urQueueEndCaptureExp({}) -> {};\n", args_str,
+                    result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t
-        commandDevice,             ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
-    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
-    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
-    void *
-        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
-                    ///< the info.
-    ///< If propSize is not equal to or greater than the real number of bytes
-    ///< needed to return the info
-    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
-    ///< pPropValue is not used.
-    size_t *
-        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be used.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the allocation.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
-    auto pfnPeerAccessGetInfoExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+    auto pfnUSMDeviceAllocExp = getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
 
-    if (nullptr == pfnPeerAccessGetInfoExp) {
+    if (nullptr == pfnUSMDeviceAllocExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_usm_p2p_peer_access_get_info_exp_params_t params = {
-        &commandDevice, &peerDevice, &propName,
-        &propSize,      &pPropValue, &pPropSizeRet};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
-                                   "urUsmP2PPeerAccessGetInfoExp", &params);
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP)) {
+        return pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+    }
+
+    ur_enqueue_usm_device_alloc_exp_params_t params = {&hQueue, &size, &numEventsInWaitList, &phEventWaitList, &ppMem, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, "urEnqueueUSMDeviceAllocExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urUsmP2PPeerAccessGetInfoExp\n");
+    logger.info("   ---> urEnqueueUSMDeviceAllocExp\n");
 
-    ur_result_t result =
-        pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
-                                pPropValue, pPropSizeRet);
+    ur_result_t result = pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
 
-    getContext()->notify_end(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
-                             "urUsmP2PPeerAccessGetInfoExp", &params, &result,
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP,
+                             "urEnqueueUSMDeviceAllocExp", &params, &result,
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params);
-        logger.info("   <--- urUsmP2PPeerAccessGetInfoExp({}) -> {};\n",
-                    args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP, &params);
+        logger.info("   <--- urEnqueueUSMDeviceAllocExp({}) -> {};\n",
+                    args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urEnqueueNativeCommandExp
-__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
-    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_exp_enqueue_native_command_function_t
-        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
-                          ///< immediately.
-    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
-    uint32_t numMemsInMemList, ///< [in] size of the mem list
-    const ur_mem_handle_t *
-        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
-                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
-    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
-    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
-    const ur_exp_enqueue_native_command_properties_t *
-        pProperties, ///< [in][optional] pointer to the native enqueue properties
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    void *pMem,                   ///< [in] pointer to USM memory object
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before the kernel execution.
+    ///< events that must be complete before the memory can be freed.
     ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
     ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies the work that has
-    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
-    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+        phEvent ///< [out][optional] return an event object that identifies the free. If
+    ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
-    auto pfnNativeCommandExp =
-        getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+    auto pfnUSMFreeExp = getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
 
-    if (nullptr == pfnNativeCommandExp) {
+    if (nullptr == pfnUSMFreeExp) {
         return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    ur_enqueue_native_command_exp_params_t params = {&hQueue,
-                                                     &pfnNativeEnqueue,
-                                                     &data,
-                                                     &numMemsInMemList,
-                                                     &phMemList,
-                                                     &pProperties,
-                                                     &numEventsInWaitList,
-                                                     &phEventWaitList,
-                                                     &phEvent};
-    uint64_t instance =
-        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
-                                   "urEnqueueNativeCommandExp", &params);
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_FREE_EXP)) {
+        return pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_free_exp_params_t params = {&hQueue, &pMem, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_ENQUEUE_USM_FREE_EXP, "urEnqueueUSMFreeExp", &params);
 
     auto &logger = getContext()->logger;
-    logger.info("   ---> urEnqueueNativeCommandExp\n");
+    logger.info("   ---> urEnqueueUSMFreeExp\n");
 
-    ur_result_t result = pfnNativeCommandExp(
-        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
-        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+    ur_result_t result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
 
-    getContext()->notify_end(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
-                             "urEnqueueNativeCommandExp", &params, &result,
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_FREE_EXP,
+                             "urEnqueueUSMFreeExp", &params, &result,
                              instance);
 
     if (logger.getLevel() <= logger::Level::INFO) {
-        std::ostringstream args_str;
-        ur::extras::printFunctionParams(
-            args_str, UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params);
-        logger.info("   <--- urEnqueueNativeCommandExp({}) -> {};\n",
-                    args_str.str(), result);
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_USM_FREE_EXP, &params);
+        logger.info("   <--- urEnqueueUSMFreeExp({}) -> {};\n",
+                    args_str, result);
     }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Exported function for filling application's Global table
-///        with current process' addresses
-///
-/// @returns
-///     - ::UR_RESULT_SUCCESS
-///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
-__urdlllocal ur_result_t UR_APICALL urGetGlobalProcAddrTable(
-    ur_api_version_t version, ///< [in] API version requested
-    ur_global_dditable_t
-        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+/// @brief Intercept function for urUSMGrowableAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t
+        maxSize, ///< [in] size in bytes of the address range reserved for the allocation
+    size_t
+        size, ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem ///< [out] pointer to USM device memory object
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Global;
+    auto pfnGrowableAllocExp =
+        getContext()->urDdiTable.USMExp.pfnGrowableAllocExp;
 
-    if (nullptr == pDdiTable) {
-        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    if (nullptr == pfnGrowableAllocExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
-        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP)) {
+        return pfnGrowableAllocExp(hContext, hDevice, maxSize, size, ppMem);
     }
 
-    ur_result_t result = UR_RESULT_SUCCESS;
+    ur_usm_growable_alloc_exp_params_t params = {&hContext, &hDevice, &maxSize,
+                                                 &size, &ppMem};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP,
+                                   "urUSMGrowableAllocExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMGrowableAllocExp\n");
+
+    ur_result_t result =
+        pfnGrowableAllocExp(hContext, hDevice, maxSize, size, ppMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP,
+                             "urUSMGrowableAllocExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP, &params);
+        logger.info("   <--- urUSMGrowableAllocExp({}) -> {};\n",
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size ///< [in] size in bytes the allocation must be backed for
+) {
+    auto pfnGrowExp = getContext()->urDdiTable.USMExp.pfnGrowExp;
+
+    if (nullptr == pfnGrowExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_GROW_EXP)) {
+        return pfnGrowExp(hContext, pMem, size);
+    }
+
+    ur_usm_grow_exp_params_t params = {&hContext, &pMem, &size};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_GROW_EXP,
+                                                   "urUSMGrowExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMGrowExp\n");
+
+    ur_result_t result = pfnGrowExp(hContext, pMem, size);
+
+    getContext()->notify_end(UR_FUNCTION_USM_GROW_EXP, "urUSMGrowExp", &params,
+                             &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_GROW_EXP, &params);
+        logger.info("   <--- urUSMGrowExp({}) -> {};\n", args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+) {
+    auto pfnImportExp = getContext()->urDdiTable.USMExp.pfnImportExp;
+
+    if (nullptr == pfnImportExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_IMPORT_EXP)) {
+        return pfnImportExp(hContext, pMem, size);
+    }
+
+    ur_usm_import_exp_params_t params = {&hContext, &pMem, &size};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_IMPORT_EXP,
+                                                   "urUSMImportExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMImportExp\n");
+
+    ur_result_t result = pfnImportExp(hContext, pMem, size);
+
+    getContext()->notify_end(UR_FUNCTION_USM_IMPORT_EXP, "urUSMImportExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_IMPORT_EXP, &params);
+        logger.info("   <--- urUSMImportExp({}) -> {};\n", args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+) {
+    auto pfnReleaseExp = getContext()->urDdiTable.USMExp.pfnReleaseExp;
+
+    if (nullptr == pfnReleaseExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_RELEASE_EXP)) {
+        return pfnReleaseExp(hContext, pMem);
+    }
+
+    ur_usm_release_exp_params_t params = {&hContext, &pMem};
+    uint64_t instance = getContext()->notify_begin(UR_FUNCTION_USM_RELEASE_EXP,
+                                                   "urUSMReleaseExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMReleaseExp\n");
+
+    ur_result_t result = pfnReleaseExp(hContext, pMem);
+
+    getContext()->notify_end(UR_FUNCTION_USM_RELEASE_EXP, "urUSMReleaseExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_RELEASE_EXP, &params);
+        logger.info("   <--- urUSMReleaseExp({}) -> {};\n", args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnEnablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+
+    if (nullptr == pfnEnablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP)) {
+        return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    }
+
+    ur_usm_p2p_enable_peer_access_exp_params_t params = {&commandDevice,
+                                                         &peerDevice};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+                                   "urUsmP2PEnablePeerAccessExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PEnablePeerAccessExp\n");
+
+    ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP,
+                             "urUsmP2PEnablePeerAccessExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP, &params);
+        logger.info("   <--- urUsmP2PEnablePeerAccessExp({}) -> {};\n",
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnDisablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+
+    if (nullptr == pfnDisablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP)) {
+        return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    }
+
+    ur_usm_p2p_disable_peer_access_exp_params_t params = {&commandDevice,
+                                                          &peerDevice};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+                                   "urUsmP2PDisablePeerAccessExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PDisablePeerAccessExp\n");
+
+    ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP,
+                             "urUsmP2PDisablePeerAccessExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP, &params);
+        logger.info("   <--- urUsmP2PDisablePeerAccessExp({}) -> {};\n",
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnPeerAccessGetInfoExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+
+    if (nullptr == pfnPeerAccessGetInfoExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP)) {
+        return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                       propSize, pPropValue, pPropSizeRet);
+    }
+
+    ur_usm_p2p_peer_access_get_info_exp_params_t params = {
+        &commandDevice, &peerDevice, &propName,
+        &propSize,      &pPropValue, &pPropSizeRet};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+                                   "urUsmP2PPeerAccessGetInfoExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUsmP2PPeerAccessGetInfoExp\n");
+
+    ur_result_t result =
+        pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
+                                pPropValue, pPropSizeRet);
+
+    getContext()->notify_end(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP,
+                             "urUsmP2PPeerAccessGetInfoExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP, &params);
+        logger.info("   <--- urUsmP2PPeerAccessGetInfoExp({}) -> {};\n",
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t
+        minBytesToKeep ///< [in] number of bytes of free memory which may be left cached
+) {
+    auto pfnPoolTrimExp = getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_USM_POOL_TRIM_EXP)) {
+        return pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+    }
+
+    ur_usm_pool_trim_exp_params_t params = {&hContext, &hPool,
+                                            &minBytesToKeep};
+    uint64_t instance = getContext()->notify_begin(
+        UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urUSMPoolTrimExp\n");
+
+    ur_result_t result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    getContext()->notify_end(UR_FUNCTION_USM_POOL_TRIM_EXP, "urUSMPoolTrimExp",
+                             &params, &result, instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_USM_POOL_TRIM_EXP, &params);
+        logger.info("   <--- urUSMPoolTrimExp({}) -> {};\n", args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
+    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+) {
+    auto pfnNativeCommandExp =
+        getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+
+    if (nullptr == pfnNativeCommandExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP)) {
+        return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data,
+                                   numMemsInMemList, phMemList, pProperties,
+                                   numEventsInWaitList, phEventWaitList,
+                                   phEvent);
+    }
+
+    ur_enqueue_native_command_exp_params_t params = {&hQueue,
+                                                     &pfnNativeEnqueue,
+                                                     &data,
+                                                     &numMemsInMemList,
+                                                     &phMemList,
+                                                     &pProperties,
+                                                     &numEventsInWaitList,
+                                                     &phEventWaitList,
+                                                     &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
+                                   "urEnqueueNativeCommandExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueNativeCommandExp\n");
+
+    ur_result_t result = pfnNativeCommandExp(
+        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP,
+                             "urEnqueueNativeCommandExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str =
+            ur::extras::printFunctionParams(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP, &params);
+        logger.info("   <--- urEnqueueNativeCommandExp({}) -> {};\n",
+                    args_str, result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueHostTaskExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_host_task_function_t
+        pfnHostTask, ///< [in] function run on the host once the host task's dependencies
+                     ///< completed
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host task is run.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once pfnHostTask
+                ///< returned.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnHostTaskExp = getContext()->urDdiTable.EnqueueExp.pfnHostTaskExp;
+
+    if (nullptr == pfnHostTaskExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP)) {
+        return pfnHostTaskExp(hQueue, pfnHostTask, pUserData,
+                              numEventsInWaitList, phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_host_task_exp_params_t params = {
+        &hQueue,          &pfnHostTask, &pUserData, &numEventsInWaitList,
+        &phEventWaitList, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP,
+                                   "urEnqueueHostTaskExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueHostTaskExp\n");
+
+    ur_result_t result = pfnHostTaskExp(hQueue, pfnHostTask, pUserData,
+                                        numEventsInWaitList, phEventWaitList,
+                                        phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP,
+                             "urEnqueueHostTaskExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_ENQUEUE_HOST_TASK_EXP, &params);
+        logger.info("   <--- urEnqueueHostTaskExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventCreateIPCExp
+__urdlllocal ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+) {
+    auto pfnCreateIPCExp = getContext()->urDdiTable.EventExp.pfnCreateIPCExp;
+
+    if (nullptr == pfnCreateIPCExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_CREATE_IPC_EXP)) {
+        return pfnCreateIPCExp(hContext, hDevice, phEvent);
+    }
+
+    ur_event_create_ipc_exp_params_t params = {&hContext, &hDevice, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_EVENT_CREATE_IPC_EXP,
+                                   "urEventCreateIPCExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventCreateIPCExp\n");
+
+    ur_result_t result = pfnCreateIPCExp(hContext, hDevice, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_CREATE_IPC_EXP,
+                             "urEventCreateIPCExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_EVENT_CREATE_IPC_EXP, &params);
+        logger.info("   <--- urEventCreateIPCExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t
+        hEvent, ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *
+        pIPCHandle ///< [out] pointer to the IPC handle of the event
+) {
+    auto pfnGetIPCHandleExp =
+        getContext()->urDdiTable.EventExp.pfnGetIPCHandleExp;
+
+    if (nullptr == pfnGetIPCHandleExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP)) {
+        return pfnGetIPCHandleExp(hEvent, pIPCHandle);
+    }
+
+    ur_event_get_ipc_handle_exp_params_t params = {&hEvent, &pIPCHandle};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP,
+                                   "urEventGetIPCHandleExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventGetIPCHandleExp\n");
+
+    ur_result_t result = pfnGetIPCHandleExp(hEvent, pIPCHandle);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP,
+                             "urEventGetIPCHandleExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP, &params);
+        logger.info("   <--- urEventGetIPCHandleExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventOpenIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    const ur_exp_ipc_event_handle_t *
+        pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                    ///< another process
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+) {
+    auto pfnOpenIPCHandleExp =
+        getContext()->urDdiTable.EventExp.pfnOpenIPCHandleExp;
+
+    if (nullptr == pfnOpenIPCHandleExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP)) {
+        return pfnOpenIPCHandleExp(hContext, hDevice, pIPCHandle, phEvent);
+    }
+
+    ur_event_open_ipc_handle_exp_params_t params = {
+        &hContext, &hDevice, &pIPCHandle, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP,
+                                   "urEventOpenIPCHandleExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEventOpenIPCHandleExp\n");
+
+    ur_result_t result = pfnOpenIPCHandleExp(hContext, hDevice, pIPCHandle,
+                                             phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP,
+                             "urEventOpenIPCHandleExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP, &params);
+        logger.info("   <--- urEventOpenIPCHandleExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueIPCEventSignalExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to signal
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the IPC event is signaled.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnIPCEventSignalExp =
+        getContext()->urDdiTable.EnqueueExp.pfnIPCEventSignalExp;
+
+    if (nullptr == pfnIPCEventSignalExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP)) {
+        return pfnIPCEventSignalExp(hQueue, hIPCEvent, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_ipc_event_signal_exp_params_t params = {
+        &hQueue, &hIPCEvent, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP,
+                                   "urEnqueueIPCEventSignalExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueIPCEventSignalExp\n");
+
+    ur_result_t result = pfnIPCEventSignalExp(hQueue, hIPCEvent,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP,
+                             "urEnqueueIPCEventSignalExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP, &params);
+        logger.info("   <--- urEnqueueIPCEventSignalExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueIPCEventWaitExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command starts waiting.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once the IPC
+                ///< event was signaled.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnIPCEventWaitExp =
+        getContext()->urDdiTable.EnqueueExp.pfnIPCEventWaitExp;
+
+    if (nullptr == pfnIPCEventWaitExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP)) {
+        return pfnIPCEventWaitExp(hQueue, hIPCEvent, numEventsInWaitList,
+                                  phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_ipc_event_wait_exp_params_t params = {
+        &hQueue, &hIPCEvent, &numEventsInWaitList, &phEventWaitList, &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP,
+                                   "urEnqueueIPCEventWaitExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueIPCEventWaitExp\n");
+
+    ur_result_t result = pfnIPCEventWaitExp(hQueue, hIPCEvent,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP,
+                             "urEnqueueIPCEventWaitExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP, &params);
+        logger.info("   <--- urEnqueueIPCEventWaitExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMMemcpyBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,       ///< [in] number of blocks to copy
+    void **
+        ppDst, ///< [in][range(0, numCopies)] pointers to the destination USM memory
+               ///< blocks
+    const void **
+        ppSrc, ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *
+        pSizes, ///< [in][range(0, numCopies)] sizes in bytes of the blocks
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once all the
+    ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+    ///< phEvent must not refer to an element of the phEventWaitList array.
+) {
+    auto pfnUSMMemcpyBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnUSMMemcpyBatchExp;
+
+    if (nullptr == pfnUSMMemcpyBatchExp) {
+        return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    if (!getContext()->isTraced(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP)) {
+        return pfnUSMMemcpyBatchExp(hQueue, blocking, numCopies, ppDst, ppSrc,
+                                    pSizes, numEventsInWaitList,
+                                    phEventWaitList, phEvent);
+    }
+
+    ur_enqueue_usm_memcpy_batch_exp_params_t params = {
+        &hQueue,
+        &blocking,
+        &numCopies,
+        &ppDst,
+        &ppSrc,
+        &pSizes,
+        &numEventsInWaitList,
+        &phEventWaitList,
+        &phEvent};
+    uint64_t instance =
+        getContext()->notify_begin(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP,
+                                   "urEnqueueUSMMemcpyBatchExp", &params);
+
+    auto &logger = getContext()->logger;
+    logger.info("   ---> urEnqueueUSMMemcpyBatchExp\n");
+
+    ur_result_t result = pfnUSMMemcpyBatchExp(hQueue, blocking, numCopies,
+                                              ppDst, ppSrc, pSizes,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+
+    getContext()->notify_end(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP,
+                             "urEnqueueUSMMemcpyBatchExp", &params, &result,
+                             instance);
+
+    if (logger.getLevel() <= logger::Level::INFO) {
+        auto args_str = ur::extras::printFunctionParams(
+            UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP, &params);
+        logger.info("   <--- urEnqueueUSMMemcpyBatchExp({}) -> {};\n", args_str,
+                    result);
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's Global table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetGlobalProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_global_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Global;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnAdapterGet = pDdiTable->pfnAdapterGet;
-    pDdiTable->pfnAdapterGet = ur_tracing_layer::urAdapterGet;
+    if (context->isIntercepted(UR_FUNCTION_ADAPTER_GET)) {
+        pDdiTable->pfnAdapterGet = ur_tracing_layer::urAdapterGet;
+    }
 
     dditable.pfnAdapterRelease = pDdiTable->pfnAdapterRelease;
-    pDdiTable->pfnAdapterRelease = ur_tracing_layer::urAdapterRelease;
+    if (context->isIntercepted(UR_FUNCTION_ADAPTER_RELEASE)) {
+        pDdiTable->pfnAdapterRelease = ur_tracing_layer::urAdapterRelease;
+    }
 
     dditable.pfnAdapterRetain = pDdiTable->pfnAdapterRetain;
-    pDdiTable->pfnAdapterRetain = ur_tracing_layer::urAdapterRetain;
+    if (context->isIntercepted(UR_FUNCTION_ADAPTER_RETAIN)) {
+        pDdiTable->pfnAdapterRetain = ur_tracing_layer::urAdapterRetain;
+    }
 
     dditable.pfnAdapterGetLastError = pDdiTable->pfnAdapterGetLastError;
-    pDdiTable->pfnAdapterGetLastError = ur_tracing_layer::urAdapterGetLastError;
+    if (context->isIntercepted(UR_FUNCTION_ADAPTER_GET_LAST_ERROR)) {
+        pDdiTable->pfnAdapterGetLastError =
+            ur_tracing_layer::urAdapterGetLastError;
+    }
 
     dditable.pfnAdapterGetInfo = pDdiTable->pfnAdapterGetInfo;
-    pDdiTable->pfnAdapterGetInfo = ur_tracing_layer::urAdapterGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_ADAPTER_GET_INFO)) {
+        pDdiTable->pfnAdapterGetInfo = ur_tracing_layer::urAdapterGetInfo;
+    }
 
     return result;
 }
@@ -9216,17 +10984,15 @@ __urdlllocal ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     ur_bindless_images_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable =
-        ur_tracing_layer::getContext()->urDdiTable.BindlessImagesExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.BindlessImagesExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
@@ -9234,81 +11000,141 @@ __urdlllocal ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
 
     dditable.pfnUnsampledImageHandleDestroyExp =
         pDdiTable->pfnUnsampledImageHandleDestroyExp;
-    pDdiTable->pfnUnsampledImageHandleDestroyExp =
-        ur_tracing_layer::urBindlessImagesUnsampledImageHandleDestroyExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        pDdiTable->pfnUnsampledImageHandleDestroyExp =
+            ur_tracing_layer::urBindlessImagesUnsampledImageHandleDestroyExp;
+    }
 
     dditable.pfnSampledImageHandleDestroyExp =
         pDdiTable->pfnSampledImageHandleDestroyExp;
-    pDdiTable->pfnSampledImageHandleDestroyExp =
-        ur_tracing_layer::urBindlessImagesSampledImageHandleDestroyExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP)) {
+        pDdiTable->pfnSampledImageHandleDestroyExp =
+            ur_tracing_layer::urBindlessImagesSampledImageHandleDestroyExp;
+    }
 
     dditable.pfnImageAllocateExp = pDdiTable->pfnImageAllocateExp;
-    pDdiTable->pfnImageAllocateExp =
-        ur_tracing_layer::urBindlessImagesImageAllocateExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP)) {
+        pDdiTable->pfnImageAllocateExp =
+            ur_tracing_layer::urBindlessImagesImageAllocateExp;
+    }
 
     dditable.pfnImageFreeExp = pDdiTable->pfnImageFreeExp;
-    pDdiTable->pfnImageFreeExp = ur_tracing_layer::urBindlessImagesImageFreeExp;
+    if (context->isIntercepted(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP)) {
+        pDdiTable->pfnImageFreeExp =
+            ur_tracing_layer::urBindlessImagesImageFreeExp;
+    }
 
     dditable.pfnUnsampledImageCreateExp = pDdiTable->pfnUnsampledImageCreateExp;
-    pDdiTable->pfnUnsampledImageCreateExp =
-        ur_tracing_layer::urBindlessImagesUnsampledImageCreateExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP)) {
+        pDdiTable->pfnUnsampledImageCreateExp =
+            ur_tracing_layer::urBindlessImagesUnsampledImageCreateExp;
+    }
 
     dditable.pfnSampledImageCreateExp = pDdiTable->pfnSampledImageCreateExp;
-    pDdiTable->pfnSampledImageCreateExp =
-        ur_tracing_layer::urBindlessImagesSampledImageCreateExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP)) {
+        pDdiTable->pfnSampledImageCreateExp =
+            ur_tracing_layer::urBindlessImagesSampledImageCreateExp;
+    }
 
     dditable.pfnImageCopyExp = pDdiTable->pfnImageCopyExp;
-    pDdiTable->pfnImageCopyExp = ur_tracing_layer::urBindlessImagesImageCopyExp;
+    if (context->isIntercepted(UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP)) {
+        pDdiTable->pfnImageCopyExp =
+            ur_tracing_layer::urBindlessImagesImageCopyExp;
+    }
+
+    dditable.pfnImageCopyBatchExp = pDdiTable->pfnImageCopyBatchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP)) {
+        pDdiTable->pfnImageCopyBatchExp =
+            ur_tracing_layer::urBindlessImagesImageCopyBatchExp;
+    }
 
     dditable.pfnImageGetInfoExp = pDdiTable->pfnImageGetInfoExp;
-    pDdiTable->pfnImageGetInfoExp =
-        ur_tracing_layer::urBindlessImagesImageGetInfoExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP)) {
+        pDdiTable->pfnImageGetInfoExp =
+            ur_tracing_layer::urBindlessImagesImageGetInfoExp;
+    }
 
     dditable.pfnMipmapGetLevelExp = pDdiTable->pfnMipmapGetLevelExp;
-    pDdiTable->pfnMipmapGetLevelExp =
-        ur_tracing_layer::urBindlessImagesMipmapGetLevelExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP)) {
+        pDdiTable->pfnMipmapGetLevelExp =
+            ur_tracing_layer::urBindlessImagesMipmapGetLevelExp;
+    }
 
     dditable.pfnMipmapFreeExp = pDdiTable->pfnMipmapFreeExp;
-    pDdiTable->pfnMipmapFreeExp =
-        ur_tracing_layer::urBindlessImagesMipmapFreeExp;
+    if (context->isIntercepted(UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP)) {
+        pDdiTable->pfnMipmapFreeExp =
+            ur_tracing_layer::urBindlessImagesMipmapFreeExp;
+    }
 
     dditable.pfnImportExternalMemoryExp = pDdiTable->pfnImportExternalMemoryExp;
-    pDdiTable->pfnImportExternalMemoryExp =
-        ur_tracing_layer::urBindlessImagesImportExternalMemoryExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP)) {
+        pDdiTable->pfnImportExternalMemoryExp =
+            ur_tracing_layer::urBindlessImagesImportExternalMemoryExp;
+    }
 
     dditable.pfnMapExternalArrayExp = pDdiTable->pfnMapExternalArrayExp;
-    pDdiTable->pfnMapExternalArrayExp =
-        ur_tracing_layer::urBindlessImagesMapExternalArrayExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP)) {
+        pDdiTable->pfnMapExternalArrayExp =
+            ur_tracing_layer::urBindlessImagesMapExternalArrayExp;
+    }
 
     dditable.pfnMapExternalLinearMemoryExp =
         pDdiTable->pfnMapExternalLinearMemoryExp;
-    pDdiTable->pfnMapExternalLinearMemoryExp =
-        ur_tracing_layer::urBindlessImagesMapExternalLinearMemoryExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP)) {
+        pDdiTable->pfnMapExternalLinearMemoryExp =
+            ur_tracing_layer::urBindlessImagesMapExternalLinearMemoryExp;
+    }
 
     dditable.pfnReleaseExternalMemoryExp =
         pDdiTable->pfnReleaseExternalMemoryExp;
-    pDdiTable->pfnReleaseExternalMemoryExp =
-        ur_tracing_layer::urBindlessImagesReleaseExternalMemoryExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP)) {
+        pDdiTable->pfnReleaseExternalMemoryExp =
+            ur_tracing_layer::urBindlessImagesReleaseExternalMemoryExp;
+    }
 
     dditable.pfnImportExternalSemaphoreExp =
         pDdiTable->pfnImportExternalSemaphoreExp;
-    pDdiTable->pfnImportExternalSemaphoreExp =
-        ur_tracing_layer::urBindlessImagesImportExternalSemaphoreExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP)) {
+        pDdiTable->pfnImportExternalSemaphoreExp =
+            ur_tracing_layer::urBindlessImagesImportExternalSemaphoreExp;
+    }
 
     dditable.pfnReleaseExternalSemaphoreExp =
         pDdiTable->pfnReleaseExternalSemaphoreExp;
-    pDdiTable->pfnReleaseExternalSemaphoreExp =
-        ur_tracing_layer::urBindlessImagesReleaseExternalSemaphoreExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP)) {
+        pDdiTable->pfnReleaseExternalSemaphoreExp =
+            ur_tracing_layer::urBindlessImagesReleaseExternalSemaphoreExp;
+    }
 
     dditable.pfnWaitExternalSemaphoreExp =
         pDdiTable->pfnWaitExternalSemaphoreExp;
-    pDdiTable->pfnWaitExternalSemaphoreExp =
-        ur_tracing_layer::urBindlessImagesWaitExternalSemaphoreExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP)) {
+        pDdiTable->pfnWaitExternalSemaphoreExp =
+            ur_tracing_layer::urBindlessImagesWaitExternalSemaphoreExp;
+    }
 
     dditable.pfnSignalExternalSemaphoreExp =
         pDdiTable->pfnSignalExternalSemaphoreExp;
-    pDdiTable->pfnSignalExternalSemaphoreExp =
-        ur_tracing_layer::urBindlessImagesSignalExternalSemaphoreExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP)) {
+        pDdiTable->pfnSignalExternalSemaphoreExp =
+            ur_tracing_layer::urBindlessImagesSignalExternalSemaphoreExp;
+    }
 
     return result;
 }
@@ -9325,114 +11151,191 @@ __urdlllocal ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
     ur_command_buffer_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable =
-        ur_tracing_layer::getContext()->urDdiTable.CommandBufferExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.CommandBufferExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreateExp = pDdiTable->pfnCreateExp;
-    pDdiTable->pfnCreateExp = ur_tracing_layer::urCommandBufferCreateExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP)) {
+        pDdiTable->pfnCreateExp = ur_tracing_layer::urCommandBufferCreateExp;
+    }
 
     dditable.pfnRetainExp = pDdiTable->pfnRetainExp;
-    pDdiTable->pfnRetainExp = ur_tracing_layer::urCommandBufferRetainExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP)) {
+        pDdiTable->pfnRetainExp = ur_tracing_layer::urCommandBufferRetainExp;
+    }
 
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
-    pDdiTable->pfnReleaseExp = ur_tracing_layer::urCommandBufferReleaseExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP)) {
+        pDdiTable->pfnReleaseExp = ur_tracing_layer::urCommandBufferReleaseExp;
+    }
 
     dditable.pfnFinalizeExp = pDdiTable->pfnFinalizeExp;
-    pDdiTable->pfnFinalizeExp = ur_tracing_layer::urCommandBufferFinalizeExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP)) {
+        pDdiTable->pfnFinalizeExp =
+            ur_tracing_layer::urCommandBufferFinalizeExp;
+    }
 
     dditable.pfnAppendKernelLaunchExp = pDdiTable->pfnAppendKernelLaunchExp;
-    pDdiTable->pfnAppendKernelLaunchExp =
-        ur_tracing_layer::urCommandBufferAppendKernelLaunchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP)) {
+        pDdiTable->pfnAppendKernelLaunchExp =
+            ur_tracing_layer::urCommandBufferAppendKernelLaunchExp;
+    }
 
     dditable.pfnAppendUSMMemcpyExp = pDdiTable->pfnAppendUSMMemcpyExp;
-    pDdiTable->pfnAppendUSMMemcpyExp =
-        ur_tracing_layer::urCommandBufferAppendUSMMemcpyExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP)) {
+        pDdiTable->pfnAppendUSMMemcpyExp =
+            ur_tracing_layer::urCommandBufferAppendUSMMemcpyExp;
+    }
 
     dditable.pfnAppendUSMFillExp = pDdiTable->pfnAppendUSMFillExp;
-    pDdiTable->pfnAppendUSMFillExp =
-        ur_tracing_layer::urCommandBufferAppendUSMFillExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP)) {
+        pDdiTable->pfnAppendUSMFillExp =
+            ur_tracing_layer::urCommandBufferAppendUSMFillExp;
+    }
 
     dditable.pfnAppendMemBufferCopyExp = pDdiTable->pfnAppendMemBufferCopyExp;
-    pDdiTable->pfnAppendMemBufferCopyExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferCopyExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP)) {
+        pDdiTable->pfnAppendMemBufferCopyExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferCopyExp;
+    }
 
     dditable.pfnAppendMemBufferWriteExp = pDdiTable->pfnAppendMemBufferWriteExp;
-    pDdiTable->pfnAppendMemBufferWriteExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferWriteExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP)) {
+        pDdiTable->pfnAppendMemBufferWriteExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferWriteExp;
+    }
 
     dditable.pfnAppendMemBufferReadExp = pDdiTable->pfnAppendMemBufferReadExp;
-    pDdiTable->pfnAppendMemBufferReadExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferReadExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP)) {
+        pDdiTable->pfnAppendMemBufferReadExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferReadExp;
+    }
 
     dditable.pfnAppendMemBufferCopyRectExp =
         pDdiTable->pfnAppendMemBufferCopyRectExp;
-    pDdiTable->pfnAppendMemBufferCopyRectExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferCopyRectExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP)) {
+        pDdiTable->pfnAppendMemBufferCopyRectExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferCopyRectExp;
+    }
 
     dditable.pfnAppendMemBufferWriteRectExp =
         pDdiTable->pfnAppendMemBufferWriteRectExp;
-    pDdiTable->pfnAppendMemBufferWriteRectExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferWriteRectExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP)) {
+        pDdiTable->pfnAppendMemBufferWriteRectExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferWriteRectExp;
+    }
 
     dditable.pfnAppendMemBufferReadRectExp =
         pDdiTable->pfnAppendMemBufferReadRectExp;
-    pDdiTable->pfnAppendMemBufferReadRectExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferReadRectExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP)) {
+        pDdiTable->pfnAppendMemBufferReadRectExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferReadRectExp;
+    }
 
     dditable.pfnAppendMemBufferFillExp = pDdiTable->pfnAppendMemBufferFillExp;
-    pDdiTable->pfnAppendMemBufferFillExp =
-        ur_tracing_layer::urCommandBufferAppendMemBufferFillExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP)) {
+        pDdiTable->pfnAppendMemBufferFillExp =
+            ur_tracing_layer::urCommandBufferAppendMemBufferFillExp;
+    }
 
     dditable.pfnAppendUSMPrefetchExp = pDdiTable->pfnAppendUSMPrefetchExp;
-    pDdiTable->pfnAppendUSMPrefetchExp =
-        ur_tracing_layer::urCommandBufferAppendUSMPrefetchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP)) {
+        pDdiTable->pfnAppendUSMPrefetchExp =
+            ur_tracing_layer::urCommandBufferAppendUSMPrefetchExp;
+    }
 
     dditable.pfnAppendUSMAdviseExp = pDdiTable->pfnAppendUSMAdviseExp;
-    pDdiTable->pfnAppendUSMAdviseExp =
-        ur_tracing_layer::urCommandBufferAppendUSMAdviseExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP)) {
+        pDdiTable->pfnAppendUSMAdviseExp =
+            ur_tracing_layer::urCommandBufferAppendUSMAdviseExp;
+    }
 
     dditable.pfnEnqueueExp = pDdiTable->pfnEnqueueExp;
-    pDdiTable->pfnEnqueueExp = ur_tracing_layer::urCommandBufferEnqueueExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP)) {
+        pDdiTable->pfnEnqueueExp = ur_tracing_layer::urCommandBufferEnqueueExp;
+    }
 
     dditable.pfnRetainCommandExp = pDdiTable->pfnRetainCommandExp;
-    pDdiTable->pfnRetainCommandExp =
-        ur_tracing_layer::urCommandBufferRetainCommandExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP)) {
+        pDdiTable->pfnRetainCommandExp =
+            ur_tracing_layer::urCommandBufferRetainCommandExp;
+    }
 
     dditable.pfnReleaseCommandExp = pDdiTable->pfnReleaseCommandExp;
-    pDdiTable->pfnReleaseCommandExp =
-        ur_tracing_layer::urCommandBufferReleaseCommandExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP)) {
+        pDdiTable->pfnReleaseCommandExp =
+            ur_tracing_layer::urCommandBufferReleaseCommandExp;
+    }
 
     dditable.pfnUpdateKernelLaunchExp = pDdiTable->pfnUpdateKernelLaunchExp;
-    pDdiTable->pfnUpdateKernelLaunchExp =
-        ur_tracing_layer::urCommandBufferUpdateKernelLaunchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP)) {
+        pDdiTable->pfnUpdateKernelLaunchExp =
+            ur_tracing_layer::urCommandBufferUpdateKernelLaunchExp;
+    }
 
     dditable.pfnUpdateSignalEventExp = pDdiTable->pfnUpdateSignalEventExp;
-    pDdiTable->pfnUpdateSignalEventExp =
-        ur_tracing_layer::urCommandBufferUpdateSignalEventExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP)) {
+        pDdiTable->pfnUpdateSignalEventExp =
+            ur_tracing_layer::urCommandBufferUpdateSignalEventExp;
+    }
 
     dditable.pfnUpdateWaitEventsExp = pDdiTable->pfnUpdateWaitEventsExp;
-    pDdiTable->pfnUpdateWaitEventsExp =
-        ur_tracing_layer::urCommandBufferUpdateWaitEventsExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP)) {
+        pDdiTable->pfnUpdateWaitEventsExp =
+            ur_tracing_layer::urCommandBufferUpdateWaitEventsExp;
+    }
 
     dditable.pfnGetInfoExp = pDdiTable->pfnGetInfoExp;
-    pDdiTable->pfnGetInfoExp = ur_tracing_layer::urCommandBufferGetInfoExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP)) {
+        pDdiTable->pfnGetInfoExp = ur_tracing_layer::urCommandBufferGetInfoExp;
+    }
 
     dditable.pfnCommandGetInfoExp = pDdiTable->pfnCommandGetInfoExp;
-    pDdiTable->pfnCommandGetInfoExp =
-        ur_tracing_layer::urCommandBufferCommandGetInfoExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP)) {
+        pDdiTable->pfnCommandGetInfoExp =
+            ur_tracing_layer::urCommandBufferCommandGetInfoExp;
+    }
+
+    dditable.pfnUpdateKernelLaunchBatchExp =
+        pDdiTable->pfnUpdateKernelLaunchBatchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP)) {
+        pDdiTable->pfnUpdateKernelLaunchBatchExp =
+            ur_tracing_layer::urCommandBufferUpdateKernelLaunchBatchExp;
+    }
+
+    dditable.pfnUploadExp = pDdiTable->pfnUploadExp;
+    if (context->isIntercepted(UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP)) {
+        pDdiTable->pfnUploadExp = ur_tracing_layer::urCommandBufferUploadExp;
+    }
 
     return result;
 }
@@ -9449,43 +11352,57 @@ __urdlllocal ur_result_t UR_APICALL urGetContextProcAddrTable(
     ur_context_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Context;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Context;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_tracing_layer::urContextCreate;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_CREATE)) {
+        pDdiTable->pfnCreate = ur_tracing_layer::urContextCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urContextRetain;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urContextRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urContextRelease;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urContextRelease;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urContextGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urContextGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urContextGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urContextGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urContextCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urContextCreateWithNativeHandle;
+    }
 
     dditable.pfnSetExtendedDeleter = pDdiTable->pfnSetExtendedDeleter;
-    pDdiTable->pfnSetExtendedDeleter =
-        ur_tracing_layer::urContextSetExtendedDeleter;
+    if (context->isIntercepted(UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER)) {
+        pDdiTable->pfnSetExtendedDeleter =
+            ur_tracing_layer::urContextSetExtendedDeleter;
+    }
 
     return result;
 }
@@ -9502,103 +11419,155 @@ __urdlllocal ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
     ur_enqueue_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Enqueue;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Enqueue;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnKernelLaunch = pDdiTable->pfnKernelLaunch;
-    pDdiTable->pfnKernelLaunch = ur_tracing_layer::urEnqueueKernelLaunch;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH)) {
+        pDdiTable->pfnKernelLaunch = ur_tracing_layer::urEnqueueKernelLaunch;
+    }
 
     dditable.pfnEventsWait = pDdiTable->pfnEventsWait;
-    pDdiTable->pfnEventsWait = ur_tracing_layer::urEnqueueEventsWait;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_EVENTS_WAIT)) {
+        pDdiTable->pfnEventsWait = ur_tracing_layer::urEnqueueEventsWait;
+    }
 
     dditable.pfnEventsWaitWithBarrier = pDdiTable->pfnEventsWaitWithBarrier;
-    pDdiTable->pfnEventsWaitWithBarrier =
-        ur_tracing_layer::urEnqueueEventsWaitWithBarrier;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER)) {
+        pDdiTable->pfnEventsWaitWithBarrier =
+            ur_tracing_layer::urEnqueueEventsWaitWithBarrier;
+    }
 
     dditable.pfnMemBufferRead = pDdiTable->pfnMemBufferRead;
-    pDdiTable->pfnMemBufferRead = ur_tracing_layer::urEnqueueMemBufferRead;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ)) {
+        pDdiTable->pfnMemBufferRead = ur_tracing_layer::urEnqueueMemBufferRead;
+    }
 
     dditable.pfnMemBufferWrite = pDdiTable->pfnMemBufferWrite;
-    pDdiTable->pfnMemBufferWrite = ur_tracing_layer::urEnqueueMemBufferWrite;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE)) {
+        pDdiTable->pfnMemBufferWrite =
+            ur_tracing_layer::urEnqueueMemBufferWrite;
+    }
 
     dditable.pfnMemBufferReadRect = pDdiTable->pfnMemBufferReadRect;
-    pDdiTable->pfnMemBufferReadRect =
-        ur_tracing_layer::urEnqueueMemBufferReadRect;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT)) {
+        pDdiTable->pfnMemBufferReadRect =
+            ur_tracing_layer::urEnqueueMemBufferReadRect;
+    }
 
     dditable.pfnMemBufferWriteRect = pDdiTable->pfnMemBufferWriteRect;
-    pDdiTable->pfnMemBufferWriteRect =
-        ur_tracing_layer::urEnqueueMemBufferWriteRect;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT)) {
+        pDdiTable->pfnMemBufferWriteRect =
+            ur_tracing_layer::urEnqueueMemBufferWriteRect;
+    }
 
     dditable.pfnMemBufferCopy = pDdiTable->pfnMemBufferCopy;
-    pDdiTable->pfnMemBufferCopy = ur_tracing_layer::urEnqueueMemBufferCopy;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY)) {
+        pDdiTable->pfnMemBufferCopy = ur_tracing_layer::urEnqueueMemBufferCopy;
+    }
 
     dditable.pfnMemBufferCopyRect = pDdiTable->pfnMemBufferCopyRect;
-    pDdiTable->pfnMemBufferCopyRect =
-        ur_tracing_layer::urEnqueueMemBufferCopyRect;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT)) {
+        pDdiTable->pfnMemBufferCopyRect =
+            ur_tracing_layer::urEnqueueMemBufferCopyRect;
+    }
 
     dditable.pfnMemBufferFill = pDdiTable->pfnMemBufferFill;
-    pDdiTable->pfnMemBufferFill = ur_tracing_layer::urEnqueueMemBufferFill;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL)) {
+        pDdiTable->pfnMemBufferFill = ur_tracing_layer::urEnqueueMemBufferFill;
+    }
 
     dditable.pfnMemImageRead = pDdiTable->pfnMemImageRead;
-    pDdiTable->pfnMemImageRead = ur_tracing_layer::urEnqueueMemImageRead;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ)) {
+        pDdiTable->pfnMemImageRead = ur_tracing_layer::urEnqueueMemImageRead;
+    }
 
     dditable.pfnMemImageWrite = pDdiTable->pfnMemImageWrite;
-    pDdiTable->pfnMemImageWrite = ur_tracing_layer::urEnqueueMemImageWrite;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE)) {
+        pDdiTable->pfnMemImageWrite = ur_tracing_layer::urEnqueueMemImageWrite;
+    }
 
     dditable.pfnMemImageCopy = pDdiTable->pfnMemImageCopy;
-    pDdiTable->pfnMemImageCopy = ur_tracing_layer::urEnqueueMemImageCopy;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY)) {
+        pDdiTable->pfnMemImageCopy = ur_tracing_layer::urEnqueueMemImageCopy;
+    }
 
     dditable.pfnMemBufferMap = pDdiTable->pfnMemBufferMap;
-    pDdiTable->pfnMemBufferMap = ur_tracing_layer::urEnqueueMemBufferMap;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP)) {
+        pDdiTable->pfnMemBufferMap = ur_tracing_layer::urEnqueueMemBufferMap;
+    }
 
     dditable.pfnMemUnmap = pDdiTable->pfnMemUnmap;
-    pDdiTable->pfnMemUnmap = ur_tracing_layer::urEnqueueMemUnmap;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_MEM_UNMAP)) {
+        pDdiTable->pfnMemUnmap = ur_tracing_layer::urEnqueueMemUnmap;
+    }
 
     dditable.pfnUSMFill = pDdiTable->pfnUSMFill;
-    pDdiTable->pfnUSMFill = ur_tracing_layer::urEnqueueUSMFill;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_FILL)) {
+        pDdiTable->pfnUSMFill = ur_tracing_layer::urEnqueueUSMFill;
+    }
 
     dditable.pfnUSMMemcpy = pDdiTable->pfnUSMMemcpy;
-    pDdiTable->pfnUSMMemcpy = ur_tracing_layer::urEnqueueUSMMemcpy;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_MEMCPY)) {
+        pDdiTable->pfnUSMMemcpy = ur_tracing_layer::urEnqueueUSMMemcpy;
+    }
 
     dditable.pfnUSMPrefetch = pDdiTable->pfnUSMPrefetch;
-    pDdiTable->pfnUSMPrefetch = ur_tracing_layer::urEnqueueUSMPrefetch;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_PREFETCH)) {
+        pDdiTable->pfnUSMPrefetch = ur_tracing_layer::urEnqueueUSMPrefetch;
+    }
 
     dditable.pfnUSMAdvise = pDdiTable->pfnUSMAdvise;
-    pDdiTable->pfnUSMAdvise = ur_tracing_layer::urEnqueueUSMAdvise;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_ADVISE)) {
+        pDdiTable->pfnUSMAdvise = ur_tracing_layer::urEnqueueUSMAdvise;
+    }
 
     dditable.pfnUSMFill2D = pDdiTable->pfnUSMFill2D;
-    pDdiTable->pfnUSMFill2D = ur_tracing_layer::urEnqueueUSMFill2D;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_FILL_2D)) {
+        pDdiTable->pfnUSMFill2D = ur_tracing_layer::urEnqueueUSMFill2D;
+    }
 
     dditable.pfnUSMMemcpy2D = pDdiTable->pfnUSMMemcpy2D;
-    pDdiTable->pfnUSMMemcpy2D = ur_tracing_layer::urEnqueueUSMMemcpy2D;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D)) {
+        pDdiTable->pfnUSMMemcpy2D = ur_tracing_layer::urEnqueueUSMMemcpy2D;
+    }
 
     dditable.pfnDeviceGlobalVariableWrite =
         pDdiTable->pfnDeviceGlobalVariableWrite;
-    pDdiTable->pfnDeviceGlobalVariableWrite =
-        ur_tracing_layer::urEnqueueDeviceGlobalVariableWrite;
+    if (context->isIntercepted(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE)) {
+        pDdiTable->pfnDeviceGlobalVariableWrite =
+            ur_tracing_layer::urEnqueueDeviceGlobalVariableWrite;
+    }
 
     dditable.pfnDeviceGlobalVariableRead =
         pDdiTable->pfnDeviceGlobalVariableRead;
-    pDdiTable->pfnDeviceGlobalVariableRead =
-        ur_tracing_layer::urEnqueueDeviceGlobalVariableRead;
+    if (context->isIntercepted(
+            UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ)) {
+        pDdiTable->pfnDeviceGlobalVariableRead =
+            ur_tracing_layer::urEnqueueDeviceGlobalVariableRead;
+    }
 
     dditable.pfnReadHostPipe = pDdiTable->pfnReadHostPipe;
-    pDdiTable->pfnReadHostPipe = ur_tracing_layer::urEnqueueReadHostPipe;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_READ_HOST_PIPE)) {
+        pDdiTable->pfnReadHostPipe = ur_tracing_layer::urEnqueueReadHostPipe;
+    }
 
     dditable.pfnWriteHostPipe = pDdiTable->pfnWriteHostPipe;
-    pDdiTable->pfnWriteHostPipe = ur_tracing_layer::urEnqueueWriteHostPipe;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE)) {
+        pDdiTable->pfnWriteHostPipe = ur_tracing_layer::urEnqueueWriteHostPipe;
+    }
 
     return result;
 }
@@ -9615,37 +11584,85 @@ __urdlllocal ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     ur_enqueue_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.EnqueueExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.EnqueueExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnKernelLaunchCustomExp = pDdiTable->pfnKernelLaunchCustomExp;
-    pDdiTable->pfnKernelLaunchCustomExp =
-        ur_tracing_layer::urEnqueueKernelLaunchCustomExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP)) {
+        pDdiTable->pfnKernelLaunchCustomExp =
+            ur_tracing_layer::urEnqueueKernelLaunchCustomExp;
+    }
 
     dditable.pfnCooperativeKernelLaunchExp =
         pDdiTable->pfnCooperativeKernelLaunchExp;
-    pDdiTable->pfnCooperativeKernelLaunchExp =
-        ur_tracing_layer::urEnqueueCooperativeKernelLaunchExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP)) {
+        pDdiTable->pfnCooperativeKernelLaunchExp =
+            ur_tracing_layer::urEnqueueCooperativeKernelLaunchExp;
+    }
 
     dditable.pfnTimestampRecordingExp = pDdiTable->pfnTimestampRecordingExp;
-    pDdiTable->pfnTimestampRecordingExp =
-        ur_tracing_layer::urEnqueueTimestampRecordingExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP)) {
+        pDdiTable->pfnTimestampRecordingExp =
+            ur_tracing_layer::urEnqueueTimestampRecordingExp;
+    }
+
+    dditable.pfnKernelLaunchMultiExp = pDdiTable->pfnKernelLaunchMultiExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP)) {
+        pDdiTable->pfnKernelLaunchMultiExp =
+            ur_tracing_layer::urEnqueueKernelLaunchMultiExp;
+    }
+
+    dditable.pfnUSMDeviceAllocExp = pDdiTable->pfnUSMDeviceAllocExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP)) {
+        pDdiTable->pfnUSMDeviceAllocExp =
+            ur_tracing_layer::urEnqueueUSMDeviceAllocExp;
+    }
+
+    dditable.pfnUSMFreeExp = pDdiTable->pfnUSMFreeExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_FREE_EXP)) {
+        pDdiTable->pfnUSMFreeExp = ur_tracing_layer::urEnqueueUSMFreeExp;
+    }
 
     dditable.pfnNativeCommandExp = pDdiTable->pfnNativeCommandExp;
-    pDdiTable->pfnNativeCommandExp =
-        ur_tracing_layer::urEnqueueNativeCommandExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP)) {
+        pDdiTable->pfnNativeCommandExp =
+            ur_tracing_layer::urEnqueueNativeCommandExp;
+    }
+
+    dditable.pfnHostTaskExp = pDdiTable->pfnHostTaskExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_HOST_TASK_EXP)) {
+        pDdiTable->pfnHostTaskExp = ur_tracing_layer::urEnqueueHostTaskExp;
+    }
+
+    dditable.pfnIPCEventSignalExp = pDdiTable->pfnIPCEventSignalExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP)) {
+        pDdiTable->pfnIPCEventSignalExp =
+            ur_tracing_layer::urEnqueueIPCEventSignalExp;
+    }
+
+    dditable.pfnIPCEventWaitExp = pDdiTable->pfnIPCEventWaitExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP)) {
+        pDdiTable->pfnIPCEventWaitExp =
+            ur_tracing_layer::urEnqueueIPCEventWaitExp;
+    }
+
+    dditable.pfnUSMMemcpyBatchExp = pDdiTable->pfnUSMMemcpyBatchExp;
+    if (context->isIntercepted(UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP)) {
+        pDdiTable->pfnUSMMemcpyBatchExp =
+            ur_tracing_layer::urEnqueueUSMMemcpyBatchExp;
+    }
 
     return result;
 }
@@ -9662,45 +11679,113 @@ __urdlllocal ur_result_t UR_APICALL urGetEventProcAddrTable(
     ur_event_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Event;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Event;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urEventGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urEventGetInfo;
+    }
 
     dditable.pfnGetProfilingInfo = pDdiTable->pfnGetProfilingInfo;
-    pDdiTable->pfnGetProfilingInfo = ur_tracing_layer::urEventGetProfilingInfo;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_GET_PROFILING_INFO)) {
+        pDdiTable->pfnGetProfilingInfo =
+            ur_tracing_layer::urEventGetProfilingInfo;
+    }
 
     dditable.pfnWait = pDdiTable->pfnWait;
-    pDdiTable->pfnWait = ur_tracing_layer::urEventWait;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_WAIT)) {
+        pDdiTable->pfnWait = ur_tracing_layer::urEventWait;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urEventRetain;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urEventRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urEventRelease;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urEventRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urEventGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urEventGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urEventCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urEventCreateWithNativeHandle;
+    }
 
     dditable.pfnSetCallback = pDdiTable->pfnSetCallback;
-    pDdiTable->pfnSetCallback = ur_tracing_layer::urEventSetCallback;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_SET_CALLBACK)) {
+        pDdiTable->pfnSetCallback = ur_tracing_layer::urEventSetCallback;
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.EventExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnWaitAnyExp = pDdiTable->pfnWaitAnyExp;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_WAIT_ANY_EXP)) {
+        pDdiTable->pfnWaitAnyExp = ur_tracing_layer::urEventWaitAnyExp;
+    }
+
+    dditable.pfnCreateIPCExp = pDdiTable->pfnCreateIPCExp;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_CREATE_IPC_EXP)) {
+        pDdiTable->pfnCreateIPCExp = ur_tracing_layer::urEventCreateIPCExp;
+    }
+
+    dditable.pfnGetIPCHandleExp = pDdiTable->pfnGetIPCHandleExp;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP)) {
+        pDdiTable->pfnGetIPCHandleExp =
+            ur_tracing_layer::urEventGetIPCHandleExp;
+    }
+
+    dditable.pfnOpenIPCHandleExp = pDdiTable->pfnOpenIPCHandleExp;
+    if (context->isIntercepted(UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP)) {
+        pDdiTable->pfnOpenIPCHandleExp =
+            ur_tracing_layer::urEventOpenIPCHandleExp;
+    }
 
     return result;
 }
@@ -9717,73 +11802,108 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelProcAddrTable(
     ur_kernel_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Kernel;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Kernel;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_tracing_layer::urKernelCreate;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_CREATE)) {
+        pDdiTable->pfnCreate = ur_tracing_layer::urKernelCreate;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urKernelGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urKernelGetInfo;
+    }
 
     dditable.pfnGetGroupInfo = pDdiTable->pfnGetGroupInfo;
-    pDdiTable->pfnGetGroupInfo = ur_tracing_layer::urKernelGetGroupInfo;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_GET_GROUP_INFO)) {
+        pDdiTable->pfnGetGroupInfo = ur_tracing_layer::urKernelGetGroupInfo;
+    }
 
     dditable.pfnGetSubGroupInfo = pDdiTable->pfnGetSubGroupInfo;
-    pDdiTable->pfnGetSubGroupInfo = ur_tracing_layer::urKernelGetSubGroupInfo;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO)) {
+        pDdiTable->pfnGetSubGroupInfo =
+            ur_tracing_layer::urKernelGetSubGroupInfo;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urKernelRetain;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urKernelRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urKernelRelease;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urKernelRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urKernelGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urKernelGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urKernelCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urKernelCreateWithNativeHandle;
+    }
 
     dditable.pfnGetSuggestedLocalWorkSize =
         pDdiTable->pfnGetSuggestedLocalWorkSize;
-    pDdiTable->pfnGetSuggestedLocalWorkSize =
-        ur_tracing_layer::urKernelGetSuggestedLocalWorkSize;
+    if (context->isIntercepted(
+            UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE)) {
+        pDdiTable->pfnGetSuggestedLocalWorkSize =
+            ur_tracing_layer::urKernelGetSuggestedLocalWorkSize;
+    }
 
     dditable.pfnSetArgValue = pDdiTable->pfnSetArgValue;
-    pDdiTable->pfnSetArgValue = ur_tracing_layer::urKernelSetArgValue;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARG_VALUE)) {
+        pDdiTable->pfnSetArgValue = ur_tracing_layer::urKernelSetArgValue;
+    }
 
     dditable.pfnSetArgLocal = pDdiTable->pfnSetArgLocal;
-    pDdiTable->pfnSetArgLocal = ur_tracing_layer::urKernelSetArgLocal;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARG_LOCAL)) {
+        pDdiTable->pfnSetArgLocal = ur_tracing_layer::urKernelSetArgLocal;
+    }
 
     dditable.pfnSetArgPointer = pDdiTable->pfnSetArgPointer;
-    pDdiTable->pfnSetArgPointer = ur_tracing_layer::urKernelSetArgPointer;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARG_POINTER)) {
+        pDdiTable->pfnSetArgPointer = ur_tracing_layer::urKernelSetArgPointer;
+    }
 
     dditable.pfnSetExecInfo = pDdiTable->pfnSetExecInfo;
-    pDdiTable->pfnSetExecInfo = ur_tracing_layer::urKernelSetExecInfo;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_EXEC_INFO)) {
+        pDdiTable->pfnSetExecInfo = ur_tracing_layer::urKernelSetExecInfo;
+    }
 
     dditable.pfnSetArgSampler = pDdiTable->pfnSetArgSampler;
-    pDdiTable->pfnSetArgSampler = ur_tracing_layer::urKernelSetArgSampler;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARG_SAMPLER)) {
+        pDdiTable->pfnSetArgSampler = ur_tracing_layer::urKernelSetArgSampler;
+    }
 
     dditable.pfnSetArgMemObj = pDdiTable->pfnSetArgMemObj;
-    pDdiTable->pfnSetArgMemObj = ur_tracing_layer::urKernelSetArgMemObj;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ)) {
+        pDdiTable->pfnSetArgMemObj = ur_tracing_layer::urKernelSetArgMemObj;
+    }
 
     dditable.pfnSetSpecializationConstants =
         pDdiTable->pfnSetSpecializationConstants;
-    pDdiTable->pfnSetSpecializationConstants =
-        ur_tracing_layer::urKernelSetSpecializationConstants;
+    if (context->isIntercepted(
+            UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS)) {
+        pDdiTable->pfnSetSpecializationConstants =
+            ur_tracing_layer::urKernelSetSpecializationConstants;
+    }
 
     return result;
 }
@@ -9800,16 +11920,15 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     ur_kernel_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.KernelExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.KernelExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
@@ -9817,8 +11936,16 @@ __urdlllocal ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
     dditable.pfnSuggestMaxCooperativeGroupCountExp =
         pDdiTable->pfnSuggestMaxCooperativeGroupCountExp;
-    pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
-        ur_tracing_layer::urKernelSuggestMaxCooperativeGroupCountExp;
+    if (context->isIntercepted(
+            UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP)) {
+        pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
+            ur_tracing_layer::urKernelSuggestMaxCooperativeGroupCountExp;
+    }
+
+    dditable.pfnSetArgsExp = pDdiTable->pfnSetArgsExp;
+    if (context->isIntercepted(UR_FUNCTION_KERNEL_SET_ARGS_EXP)) {
+        pDdiTable->pfnSetArgsExp = ur_tracing_layer::urKernelSetArgsExp;
+    }
 
     return result;
 }
@@ -9835,54 +11962,75 @@ __urdlllocal ur_result_t UR_APICALL urGetMemProcAddrTable(
     ur_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Mem;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Mem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnImageCreate = pDdiTable->pfnImageCreate;
-    pDdiTable->pfnImageCreate = ur_tracing_layer::urMemImageCreate;
+    if (context->isIntercepted(UR_FUNCTION_MEM_IMAGE_CREATE)) {
+        pDdiTable->pfnImageCreate = ur_tracing_layer::urMemImageCreate;
+    }
 
     dditable.pfnBufferCreate = pDdiTable->pfnBufferCreate;
-    pDdiTable->pfnBufferCreate = ur_tracing_layer::urMemBufferCreate;
+    if (context->isIntercepted(UR_FUNCTION_MEM_BUFFER_CREATE)) {
+        pDdiTable->pfnBufferCreate = ur_tracing_layer::urMemBufferCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urMemRetain;
+    if (context->isIntercepted(UR_FUNCTION_MEM_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urMemRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urMemRelease;
+    if (context->isIntercepted(UR_FUNCTION_MEM_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urMemRelease;
+    }
 
     dditable.pfnBufferPartition = pDdiTable->pfnBufferPartition;
-    pDdiTable->pfnBufferPartition = ur_tracing_layer::urMemBufferPartition;
+    if (context->isIntercepted(UR_FUNCTION_MEM_BUFFER_PARTITION)) {
+        pDdiTable->pfnBufferPartition = ur_tracing_layer::urMemBufferPartition;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urMemGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_MEM_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urMemGetNativeHandle;
+    }
 
     dditable.pfnBufferCreateWithNativeHandle =
         pDdiTable->pfnBufferCreateWithNativeHandle;
-    pDdiTable->pfnBufferCreateWithNativeHandle =
-        ur_tracing_layer::urMemBufferCreateWithNativeHandle;
+    if (context->isIntercepted(
+            UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnBufferCreateWithNativeHandle =
+            ur_tracing_layer::urMemBufferCreateWithNativeHandle;
+    }
 
     dditable.pfnImageCreateWithNativeHandle =
         pDdiTable->pfnImageCreateWithNativeHandle;
-    pDdiTable->pfnImageCreateWithNativeHandle =
-        ur_tracing_layer::urMemImageCreateWithNativeHandle;
+    if (context->isIntercepted(
+            UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnImageCreateWithNativeHandle =
+            ur_tracing_layer::urMemImageCreateWithNativeHandle;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urMemGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_MEM_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urMemGetInfo;
+    }
 
     dditable.pfnImageGetInfo = pDdiTable->pfnImageGetInfo;
-    pDdiTable->pfnImageGetInfo = ur_tracing_layer::urMemImageGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_MEM_IMAGE_GET_INFO)) {
+        pDdiTable->pfnImageGetInfo = ur_tracing_layer::urMemImageGetInfo;
+    }
 
     return result;
 }
@@ -9899,29 +12047,34 @@ __urdlllocal ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     ur_physical_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.PhysicalMem;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.PhysicalMem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_tracing_layer::urPhysicalMemCreate;
+    if (context->isIntercepted(UR_FUNCTION_PHYSICAL_MEM_CREATE)) {
+        pDdiTable->pfnCreate = ur_tracing_layer::urPhysicalMemCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urPhysicalMemRetain;
+    if (context->isIntercepted(UR_FUNCTION_PHYSICAL_MEM_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urPhysicalMemRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urPhysicalMemRelease;
+    if (context->isIntercepted(UR_FUNCTION_PHYSICAL_MEM_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urPhysicalMemRelease;
+    }
 
     return result;
 }
@@ -9938,40 +12091,53 @@ __urdlllocal ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     ur_platform_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Platform;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Platform;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGet = pDdiTable->pfnGet;
-    pDdiTable->pfnGet = ur_tracing_layer::urPlatformGet;
+    if (context->isIntercepted(UR_FUNCTION_PLATFORM_GET)) {
+        pDdiTable->pfnGet = ur_tracing_layer::urPlatformGet;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urPlatformGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_PLATFORM_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urPlatformGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urPlatformGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urPlatformGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urPlatformCreateWithNativeHandle;
+    if (context->isIntercepted(
+            UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urPlatformCreateWithNativeHandle;
+    }
 
     dditable.pfnGetApiVersion = pDdiTable->pfnGetApiVersion;
-    pDdiTable->pfnGetApiVersion = ur_tracing_layer::urPlatformGetApiVersion;
+    if (context->isIntercepted(UR_FUNCTION_PLATFORM_GET_API_VERSION)) {
+        pDdiTable->pfnGetApiVersion = ur_tracing_layer::urPlatformGetApiVersion;
+    }
 
     dditable.pfnGetBackendOption = pDdiTable->pfnGetBackendOption;
-    pDdiTable->pfnGetBackendOption =
-        ur_tracing_layer::urPlatformGetBackendOption;
+    if (context->isIntercepted(UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION)) {
+        pDdiTable->pfnGetBackendOption =
+            ur_tracing_layer::urPlatformGetBackendOption;
+    }
 
     return result;
 }
@@ -9988,69 +12154,99 @@ __urdlllocal ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_program_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Program;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Program;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreateWithIL = pDdiTable->pfnCreateWithIL;
-    pDdiTable->pfnCreateWithIL = ur_tracing_layer::urProgramCreateWithIL;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_CREATE_WITH_IL)) {
+        pDdiTable->pfnCreateWithIL = ur_tracing_layer::urProgramCreateWithIL;
+    }
 
     dditable.pfnCreateWithBinary = pDdiTable->pfnCreateWithBinary;
-    pDdiTable->pfnCreateWithBinary =
-        ur_tracing_layer::urProgramCreateWithBinary;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY)) {
+        pDdiTable->pfnCreateWithBinary =
+            ur_tracing_layer::urProgramCreateWithBinary;
+    }
 
     dditable.pfnBuild = pDdiTable->pfnBuild;
-    pDdiTable->pfnBuild = ur_tracing_layer::urProgramBuild;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_BUILD)) {
+        pDdiTable->pfnBuild = ur_tracing_layer::urProgramBuild;
+    }
 
     dditable.pfnCompile = pDdiTable->pfnCompile;
-    pDdiTable->pfnCompile = ur_tracing_layer::urProgramCompile;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_COMPILE)) {
+        pDdiTable->pfnCompile = ur_tracing_layer::urProgramCompile;
+    }
 
     dditable.pfnLink = pDdiTable->pfnLink;
-    pDdiTable->pfnLink = ur_tracing_layer::urProgramLink;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_LINK)) {
+        pDdiTable->pfnLink = ur_tracing_layer::urProgramLink;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urProgramRetain;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urProgramRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urProgramRelease;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urProgramRelease;
+    }
 
     dditable.pfnGetFunctionPointer = pDdiTable->pfnGetFunctionPointer;
-    pDdiTable->pfnGetFunctionPointer =
-        ur_tracing_layer::urProgramGetFunctionPointer;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER)) {
+        pDdiTable->pfnGetFunctionPointer =
+            ur_tracing_layer::urProgramGetFunctionPointer;
+    }
 
     dditable.pfnGetGlobalVariablePointer =
         pDdiTable->pfnGetGlobalVariablePointer;
-    pDdiTable->pfnGetGlobalVariablePointer =
-        ur_tracing_layer::urProgramGetGlobalVariablePointer;
+    if (context->isIntercepted(
+            UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER)) {
+        pDdiTable->pfnGetGlobalVariablePointer =
+            ur_tracing_layer::urProgramGetGlobalVariablePointer;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urProgramGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urProgramGetInfo;
+    }
 
     dditable.pfnGetBuildInfo = pDdiTable->pfnGetBuildInfo;
-    pDdiTable->pfnGetBuildInfo = ur_tracing_layer::urProgramGetBuildInfo;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_GET_BUILD_INFO)) {
+        pDdiTable->pfnGetBuildInfo = ur_tracing_layer::urProgramGetBuildInfo;
+    }
 
     dditable.pfnSetSpecializationConstants =
         pDdiTable->pfnSetSpecializationConstants;
-    pDdiTable->pfnSetSpecializationConstants =
-        ur_tracing_layer::urProgramSetSpecializationConstants;
+    if (context->isIntercepted(
+            UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS)) {
+        pDdiTable->pfnSetSpecializationConstants =
+            ur_tracing_layer::urProgramSetSpecializationConstants;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urProgramGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urProgramGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urProgramCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urProgramCreateWithNativeHandle;
+    }
 
     return result;
 }
@@ -10067,29 +12263,39 @@ __urdlllocal ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     ur_program_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.ProgramExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.ProgramExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnBuildExp = pDdiTable->pfnBuildExp;
-    pDdiTable->pfnBuildExp = ur_tracing_layer::urProgramBuildExp;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_BUILD_EXP)) {
+        pDdiTable->pfnBuildExp = ur_tracing_layer::urProgramBuildExp;
+    }
 
     dditable.pfnCompileExp = pDdiTable->pfnCompileExp;
-    pDdiTable->pfnCompileExp = ur_tracing_layer::urProgramCompileExp;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_COMPILE_EXP)) {
+        pDdiTable->pfnCompileExp = ur_tracing_layer::urProgramCompileExp;
+    }
 
     dditable.pfnLinkExp = pDdiTable->pfnLinkExp;
-    pDdiTable->pfnLinkExp = ur_tracing_layer::urProgramLinkExp;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_LINK_EXP)) {
+        pDdiTable->pfnLinkExp = ur_tracing_layer::urProgramLinkExp;
+    }
+
+    dditable.pfnBuildAsyncExp = pDdiTable->pfnBuildAsyncExp;
+    if (context->isIntercepted(UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP)) {
+        pDdiTable->pfnBuildAsyncExp = ur_tracing_layer::urProgramBuildAsyncExp;
+    }
 
     return result;
 }
@@ -10106,45 +12312,101 @@ __urdlllocal ur_result_t UR_APICALL urGetQueueProcAddrTable(
     ur_queue_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Queue;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Queue;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urQueueGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urQueueGetInfo;
+    }
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_tracing_layer::urQueueCreate;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_CREATE)) {
+        pDdiTable->pfnCreate = ur_tracing_layer::urQueueCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urQueueRetain;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urQueueRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urQueueRelease;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urQueueRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urQueueGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urQueueGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urQueueCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urQueueCreateWithNativeHandle;
+    }
 
     dditable.pfnFinish = pDdiTable->pfnFinish;
-    pDdiTable->pfnFinish = ur_tracing_layer::urQueueFinish;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_FINISH)) {
+        pDdiTable->pfnFinish = ur_tracing_layer::urQueueFinish;
+    }
 
     dditable.pfnFlush = pDdiTable->pfnFlush;
-    pDdiTable->pfnFlush = ur_tracing_layer::urQueueFlush;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_FLUSH)) {
+        pDdiTable->pfnFlush = ur_tracing_layer::urQueueFlush;
+    }
+
+    return result;
+}
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+__urdlllocal ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.QueueExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnBeginCaptureExp = pDdiTable->pfnBeginCaptureExp;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP)) {
+        pDdiTable->pfnBeginCaptureExp =
+            ur_tracing_layer::urQueueBeginCaptureExp;
+    }
+
+    dditable.pfnEndCaptureExp = pDdiTable->pfnEndCaptureExp;
+    if (context->isIntercepted(UR_FUNCTION_QUEUE_END_CAPTURE_EXP)) {
+        pDdiTable->pfnEndCaptureExp = ur_tracing_layer::urQueueEndCaptureExp;
+    }
 
     return result;
 }
@@ -10161,39 +12423,51 @@ __urdlllocal ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     ur_sampler_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Sampler;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Sampler;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_tracing_layer::urSamplerCreate;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_CREATE)) {
+        pDdiTable->pfnCreate = ur_tracing_layer::urSamplerCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urSamplerRetain;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urSamplerRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urSamplerRelease;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urSamplerRelease;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urSamplerGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urSamplerGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urSamplerGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urSamplerGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urSamplerCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urSamplerCreateWithNativeHandle;
+    }
 
     return result;
 }
@@ -10210,47 +12484,64 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMProcAddrTable(
     ur_usm_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.USM;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.USM;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnHostAlloc = pDdiTable->pfnHostAlloc;
-    pDdiTable->pfnHostAlloc = ur_tracing_layer::urUSMHostAlloc;
+    if (context->isIntercepted(UR_FUNCTION_USM_HOST_ALLOC)) {
+        pDdiTable->pfnHostAlloc = ur_tracing_layer::urUSMHostAlloc;
+    }
 
     dditable.pfnDeviceAlloc = pDdiTable->pfnDeviceAlloc;
-    pDdiTable->pfnDeviceAlloc = ur_tracing_layer::urUSMDeviceAlloc;
+    if (context->isIntercepted(UR_FUNCTION_USM_DEVICE_ALLOC)) {
+        pDdiTable->pfnDeviceAlloc = ur_tracing_layer::urUSMDeviceAlloc;
+    }
 
     dditable.pfnSharedAlloc = pDdiTable->pfnSharedAlloc;
-    pDdiTable->pfnSharedAlloc = ur_tracing_layer::urUSMSharedAlloc;
+    if (context->isIntercepted(UR_FUNCTION_USM_SHARED_ALLOC)) {
+        pDdiTable->pfnSharedAlloc = ur_tracing_layer::urUSMSharedAlloc;
+    }
 
     dditable.pfnFree = pDdiTable->pfnFree;
-    pDdiTable->pfnFree = ur_tracing_layer::urUSMFree;
+    if (context->isIntercepted(UR_FUNCTION_USM_FREE)) {
+        pDdiTable->pfnFree = ur_tracing_layer::urUSMFree;
+    }
 
     dditable.pfnGetMemAllocInfo = pDdiTable->pfnGetMemAllocInfo;
-    pDdiTable->pfnGetMemAllocInfo = ur_tracing_layer::urUSMGetMemAllocInfo;
+    if (context->isIntercepted(UR_FUNCTION_USM_GET_MEM_ALLOC_INFO)) {
+        pDdiTable->pfnGetMemAllocInfo = ur_tracing_layer::urUSMGetMemAllocInfo;
+    }
 
     dditable.pfnPoolCreate = pDdiTable->pfnPoolCreate;
-    pDdiTable->pfnPoolCreate = ur_tracing_layer::urUSMPoolCreate;
+    if (context->isIntercepted(UR_FUNCTION_USM_POOL_CREATE)) {
+        pDdiTable->pfnPoolCreate = ur_tracing_layer::urUSMPoolCreate;
+    }
 
     dditable.pfnPoolRetain = pDdiTable->pfnPoolRetain;
-    pDdiTable->pfnPoolRetain = ur_tracing_layer::urUSMPoolRetain;
+    if (context->isIntercepted(UR_FUNCTION_USM_POOL_RETAIN)) {
+        pDdiTable->pfnPoolRetain = ur_tracing_layer::urUSMPoolRetain;
+    }
 
     dditable.pfnPoolRelease = pDdiTable->pfnPoolRelease;
-    pDdiTable->pfnPoolRelease = ur_tracing_layer::urUSMPoolRelease;
+    if (context->isIntercepted(UR_FUNCTION_USM_POOL_RELEASE)) {
+        pDdiTable->pfnPoolRelease = ur_tracing_layer::urUSMPoolRelease;
+    }
 
     dditable.pfnPoolGetInfo = pDdiTable->pfnPoolGetInfo;
-    pDdiTable->pfnPoolGetInfo = ur_tracing_layer::urUSMPoolGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_USM_POOL_GET_INFO)) {
+        pDdiTable->pfnPoolGetInfo = ur_tracing_layer::urUSMPoolGetInfo;
+    }
 
     return result;
 }
@@ -10267,29 +12558,50 @@ __urdlllocal ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     ur_usm_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.USMExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.USMExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnPitchedAllocExp = pDdiTable->pfnPitchedAllocExp;
-    pDdiTable->pfnPitchedAllocExp = ur_tracing_layer::urUSMPitchedAllocExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_PITCHED_ALLOC_EXP)) {
+        pDdiTable->pfnPitchedAllocExp = ur_tracing_layer::urUSMPitchedAllocExp;
+    }
+
+    dditable.pfnGrowableAllocExp = pDdiTable->pfnGrowableAllocExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_GROWABLE_ALLOC_EXP)) {
+        pDdiTable->pfnGrowableAllocExp =
+            ur_tracing_layer::urUSMGrowableAllocExp;
+    }
+
+    dditable.pfnGrowExp = pDdiTable->pfnGrowExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_GROW_EXP)) {
+        pDdiTable->pfnGrowExp = ur_tracing_layer::urUSMGrowExp;
+    }
 
     dditable.pfnImportExp = pDdiTable->pfnImportExp;
-    pDdiTable->pfnImportExp = ur_tracing_layer::urUSMImportExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_IMPORT_EXP)) {
+        pDdiTable->pfnImportExp = ur_tracing_layer::urUSMImportExp;
+    }
 
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
-    pDdiTable->pfnReleaseExp = ur_tracing_layer::urUSMReleaseExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_RELEASE_EXP)) {
+        pDdiTable->pfnReleaseExp = ur_tracing_layer::urUSMReleaseExp;
+    }
+
+    dditable.pfnPoolTrimExp = pDdiTable->pfnPoolTrimExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_POOL_TRIM_EXP)) {
+        pDdiTable->pfnPoolTrimExp = ur_tracing_layer::urUSMPoolTrimExp;
+    }
 
     return result;
 }
@@ -10306,32 +12618,37 @@ __urdlllocal ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
     ur_usm_p2p_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.UsmP2PExp;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.UsmP2PExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnEnablePeerAccessExp = pDdiTable->pfnEnablePeerAccessExp;
-    pDdiTable->pfnEnablePeerAccessExp =
-        ur_tracing_layer::urUsmP2PEnablePeerAccessExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP)) {
+        pDdiTable->pfnEnablePeerAccessExp =
+            ur_tracing_layer::urUsmP2PEnablePeerAccessExp;
+    }
 
     dditable.pfnDisablePeerAccessExp = pDdiTable->pfnDisablePeerAccessExp;
-    pDdiTable->pfnDisablePeerAccessExp =
-        ur_tracing_layer::urUsmP2PDisablePeerAccessExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP)) {
+        pDdiTable->pfnDisablePeerAccessExp =
+            ur_tracing_layer::urUsmP2PDisablePeerAccessExp;
+    }
 
     dditable.pfnPeerAccessGetInfoExp = pDdiTable->pfnPeerAccessGetInfoExp;
-    pDdiTable->pfnPeerAccessGetInfoExp =
-        ur_tracing_layer::urUsmP2PPeerAccessGetInfoExp;
+    if (context->isIntercepted(UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP)) {
+        pDdiTable->pfnPeerAccessGetInfoExp =
+            ur_tracing_layer::urUsmP2PPeerAccessGetInfoExp;
+    }
 
     return result;
 }
@@ -10348,42 +12665,55 @@ __urdlllocal ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     ur_virtual_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.VirtualMem;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.VirtualMem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGranularityGetInfo = pDdiTable->pfnGranularityGetInfo;
-    pDdiTable->pfnGranularityGetInfo =
-        ur_tracing_layer::urVirtualMemGranularityGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO)) {
+        pDdiTable->pfnGranularityGetInfo =
+            ur_tracing_layer::urVirtualMemGranularityGetInfo;
+    }
 
     dditable.pfnReserve = pDdiTable->pfnReserve;
-    pDdiTable->pfnReserve = ur_tracing_layer::urVirtualMemReserve;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_RESERVE)) {
+        pDdiTable->pfnReserve = ur_tracing_layer::urVirtualMemReserve;
+    }
 
     dditable.pfnFree = pDdiTable->pfnFree;
-    pDdiTable->pfnFree = ur_tracing_layer::urVirtualMemFree;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_FREE)) {
+        pDdiTable->pfnFree = ur_tracing_layer::urVirtualMemFree;
+    }
 
     dditable.pfnMap = pDdiTable->pfnMap;
-    pDdiTable->pfnMap = ur_tracing_layer::urVirtualMemMap;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_MAP)) {
+        pDdiTable->pfnMap = ur_tracing_layer::urVirtualMemMap;
+    }
 
     dditable.pfnUnmap = pDdiTable->pfnUnmap;
-    pDdiTable->pfnUnmap = ur_tracing_layer::urVirtualMemUnmap;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_UNMAP)) {
+        pDdiTable->pfnUnmap = ur_tracing_layer::urVirtualMemUnmap;
+    }
 
     dditable.pfnSetAccess = pDdiTable->pfnSetAccess;
-    pDdiTable->pfnSetAccess = ur_tracing_layer::urVirtualMemSetAccess;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS)) {
+        pDdiTable->pfnSetAccess = ur_tracing_layer::urVirtualMemSetAccess;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urVirtualMemGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_VIRTUAL_MEM_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urVirtualMemGetInfo;
+    }
 
     return result;
 }
@@ -10400,49 +12730,67 @@ __urdlllocal ur_result_t UR_APICALL urGetDeviceProcAddrTable(
     ur_device_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_tracing_layer::getContext()->urDdiTable.Device;
+    auto context = ur_tracing_layer::getContext();
+    auto &dditable = context->urDdiTable.Device;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_tracing_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_tracing_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGet = pDdiTable->pfnGet;
-    pDdiTable->pfnGet = ur_tracing_layer::urDeviceGet;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_GET)) {
+        pDdiTable->pfnGet = ur_tracing_layer::urDeviceGet;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_tracing_layer::urDeviceGetInfo;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_GET_INFO)) {
+        pDdiTable->pfnGetInfo = ur_tracing_layer::urDeviceGetInfo;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_tracing_layer::urDeviceRetain;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_RETAIN)) {
+        pDdiTable->pfnRetain = ur_tracing_layer::urDeviceRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_tracing_layer::urDeviceRelease;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_RELEASE)) {
+        pDdiTable->pfnRelease = ur_tracing_layer::urDeviceRelease;
+    }
 
     dditable.pfnPartition = pDdiTable->pfnPartition;
-    pDdiTable->pfnPartition = ur_tracing_layer::urDevicePartition;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_PARTITION)) {
+        pDdiTable->pfnPartition = ur_tracing_layer::urDevicePartition;
+    }
 
     dditable.pfnSelectBinary = pDdiTable->pfnSelectBinary;
-    pDdiTable->pfnSelectBinary = ur_tracing_layer::urDeviceSelectBinary;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_SELECT_BINARY)) {
+        pDdiTable->pfnSelectBinary = ur_tracing_layer::urDeviceSelectBinary;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_tracing_layer::urDeviceGetNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_tracing_layer::urDeviceGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_tracing_layer::urDeviceCreateWithNativeHandle;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_tracing_layer::urDeviceCreateWithNativeHandle;
+    }
 
     dditable.pfnGetGlobalTimestamps = pDdiTable->pfnGetGlobalTimestamps;
-    pDdiTable->pfnGetGlobalTimestamps =
-        ur_tracing_layer::urDeviceGetGlobalTimestamps;
+    if (context->isIntercepted(UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS)) {
+        pDdiTable->pfnGetGlobalTimestamps =
+            ur_tracing_layer::urDeviceGetGlobalTimestamps;
+    }
 
     return result;
 }
@@ -10497,6 +12845,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Event);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_tracing_layer::urGetEventExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EventExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetKernelProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Kernel);
@@ -10537,6 +12890,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Queue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_tracing_layer::urGetQueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->QueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_tracing_layer::urGetSamplerProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Sampler);
@@ -12,7 +12,20 @@
 namespace ur_validation_layer {
 
 using BacktraceLine = std::string;
-std::vector<BacktraceLine> getCurrentBacktrace();
+using BacktraceFrame = void *;
+
+/// @brief Returns the return addresses of the current call stack, without
+///        resolving them. This is cheap enough to call on every handle
+///        creation; pass the result to symbolizeBacktrace when reporting.
+std::vector<BacktraceFrame> captureBacktrace();
+
+/// @brief Turns addresses returned by captureBacktrace into printable lines.
+std::vector<BacktraceLine>
+symbolizeBacktrace(const std::vector<BacktraceFrame> &frames);
+
+inline std::vector<BacktraceLine> getCurrentBacktrace() {
+    return symbolizeBacktrace(captureBacktrace());
+}
 
 } // namespace ur_validation_layer
 
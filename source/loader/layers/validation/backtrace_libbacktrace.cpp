@@ -72,14 +72,43 @@ int backtrace_cb(void *data, uintptr_t pc, const char *filename, int lineno,
     return 0;
 }
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
-    backtrace_state *state = backtrace_create_state(NULL, 0, NULL, NULL);
+static backtrace_state *getBacktraceState() {
+    // libbacktrace states can't be freed, so keep a single one around.
+    static backtrace_state *state =
+        backtrace_create_state(NULL, /*threaded*/ 1, NULL, NULL);
+    return state;
+}
+
+static int backtrace_simple_cb(void *data, uintptr_t pc) {
+    auto *frames = reinterpret_cast<std::vector<BacktraceFrame> *>(data);
+    if (frames->size() >= MAX_BACKTRACE_FRAMES) {
+        return 1;
+    }
+    frames->push_back(reinterpret_cast<BacktraceFrame>(pc));
+    return 0;
+}
+
+std::vector<BacktraceFrame> captureBacktrace() {
+    std::vector<BacktraceFrame> frames;
+    backtrace_state *state = getBacktraceState();
+    if (state != NULL) {
+        backtrace_simple(state, 0, backtrace_simple_cb, NULL, &frames);
+    }
+    return frames;
+}
+
+std::vector<BacktraceLine>
+symbolizeBacktrace(const std::vector<BacktraceFrame> &frames) {
+    backtrace_state *state = getBacktraceState();
     if (state == NULL) {
         return std::vector<std::string>(1, "Failed to acquire a backtrace");
     }
 
     std::vector<BacktraceLine> backtrace;
-    backtrace_full(state, 0, backtrace_cb, NULL, &backtrace);
+    for (auto frame : frames) {
+        backtrace_pcinfo(state, reinterpret_cast<uintptr_t>(frame),
+                         backtrace_cb, NULL, &backtrace);
+    }
     if (backtrace.empty()) {
         return std::vector<std::string>(1, "Failed to acquire a backtrace");
     }
@@ -14,10 +14,18 @@
 
 namespace ur_validation_layer {
 
-std::vector<BacktraceLine> getCurrentBacktrace() {
+std::vector<BacktraceFrame> captureBacktrace() {
     void *backtraceFrames[MAX_BACKTRACE_FRAMES];
     int frameCount = backtrace(backtraceFrames, MAX_BACKTRACE_FRAMES);
-    char **backtraceStr = backtrace_symbols(backtraceFrames, frameCount);
+
+    return std::vector<BacktraceFrame>(backtraceFrames,
+                                       backtraceFrames + frameCount);
+}
+
+std::vector<BacktraceLine>
+symbolizeBacktrace(const std::vector<BacktraceFrame> &frames) {
+    char **backtraceStr =
+        backtrace_symbols(frames.data(), static_cast<int>(frames.size()));
 
     if (backtraceStr == nullptr) {
         return std::vector<BacktraceLine>(1, "Failed to acquire a backtrace");
@@ -25,7 +33,7 @@ std::vector<BacktraceLine> getCurrentBacktrace() {
 
     std::vector<BacktraceLine> backtrace;
     try {
-        for (int i = 0; i < frameCount; i++) {
+        for (size_t i = 0; i < frames.size(); i++) {
             backtrace.emplace_back(backtraceStr[i]);
         }
     } catch (std::bad_alloc &) {
@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#ifndef UR_ALLOC_SIZE_REGISTRY_H
+#define UR_ALLOC_SIZE_REGISTRY_H 1
+
+#include <ur_api.h>
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <shared_mutex>
+#include <unordered_map>
+
+namespace ur_validation_layer {
+
+/// @brief Sizes of the buffers and USM allocations made through the layer,
+///        used by bounds checking instead of querying the adapter for every
+///        checked argument. Every entry point creating a memory object
+///        either records its size or forgets its handle, which may be that
+///        of a buffer released since, so that the sizes found stay valid.
+class AllocSizeRegistry {
+  public:
+    void insertBuffer(ur_mem_handle_t buffer, size_t size) {
+        std::unique_lock<std::shared_mutex> lock(buffersMutex);
+        buffers[buffer] = size;
+    }
+
+    void eraseBuffer(ur_mem_handle_t buffer) {
+        std::unique_lock<std::shared_mutex> lock(buffersMutex);
+        buffers.erase(buffer);
+    }
+
+    bool findBuffer(ur_mem_handle_t buffer, size_t &size) const {
+        std::shared_lock<std::shared_mutex> lock(buffersMutex);
+        auto it = buffers.find(buffer);
+        if (it == buffers.end()) {
+            return false;
+        }
+        size = it->second;
+        return true;
+    }
+
+    void insertUSM(const void *ptr, size_t size) {
+        if (size == 0) {
+            return;
+        }
+        std::unique_lock<std::shared_mutex> lock(allocationsMutex);
+        allocations[reinterpret_cast<uintptr_t>(ptr)] = size;
+    }
+
+    void eraseUSM(const void *ptr) {
+        std::unique_lock<std::shared_mutex> lock(allocationsMutex);
+        allocations.erase(reinterpret_cast<uintptr_t>(ptr));
+    }
+
+    /// Finds the allocation ptr points into, giving the number of bytes from
+    /// ptr to its end
+    bool findUSM(const void *ptr, size_t &remaining) const {
+        auto addr = reinterpret_cast<uintptr_t>(ptr);
+        std::shared_lock<std::shared_mutex> lock(allocationsMutex);
+        auto it = allocations.upper_bound(addr);
+        if (it == allocations.begin()) {
+            return false;
+        }
+        --it;
+        if (addr - it->first >= it->second) {
+            return false;
+        }
+        remaining = it->second - (addr - it->first);
+        return true;
+    }
+
+  private:
+    mutable std::shared_mutex buffersMutex;
+    std::unordered_map<ur_mem_handle_t, size_t> buffers;
+
+    // Live allocations don't overlap, so the one containing an address is the
+    // last starting at or before it, if it extends that far
+    mutable std::shared_mutex allocationsMutex;
+    std::map<uintptr_t, size_t> allocations;
+};
+
+} // namespace ur_validation_layer
+
+#endif /* UR_ALLOC_SIZE_REGISTRY_H */
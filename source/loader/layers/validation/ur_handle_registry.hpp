@@ -0,0 +1,199 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+#ifndef UR_HANDLE_REGISTRY_H
+#define UR_HANDLE_REGISTRY_H 1
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace ur_validation_layer {
+
+/// @brief Set of live handles of a single type, used by lifetime validation.
+///        Lookups never take a lock: the set is an open-addressing table of
+///        atomic slots. Writers serialize on a mutex and, when the table gets
+///        too full, publish a rehashed copy. Replaced tables are never freed
+///        while the registry lives, only recycled by a later rehash of the
+///        same size; a generation counter, bumped before a table is recycled,
+///        tells a reader that was still probing it to retry.
+class HandleRegistry {
+  public:
+    HandleRegistry() {
+        auto initial = std::make_unique<table_t>(INITIAL_CAPACITY);
+        current.store(initial.get(), std::memory_order_release);
+        tables.push_back(std::move(initial));
+    }
+
+    HandleRegistry(const HandleRegistry &) = delete;
+    HandleRegistry &operator=(const HandleRegistry &) = delete;
+
+    bool contains(void *handle) const {
+        if (handle == EMPTY || handle == TOMBSTONE) {
+            return false;
+        }
+        for (;;) {
+            auto gen = generation.load(std::memory_order_acquire);
+            bool found = find(current.load(std::memory_order_acquire), handle);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (generation.load(std::memory_order_relaxed) == gen) {
+                return found;
+            }
+        }
+    }
+
+    void insert(void *handle) {
+        if (handle == EMPTY || handle == TOMBSTONE) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        table_t *table = current.load(std::memory_order_relaxed);
+        if ((table->used + 1) * 2 > table->capacity) {
+            table = grow(table);
+        }
+
+        std::atomic<void *> *reuse = nullptr;
+        for (size_t i = table->first(handle);; i = (i + 1) & table->mask) {
+            void *slot = table->slots[i].load(std::memory_order_relaxed);
+            if (slot == handle) {
+                return;
+            }
+            if (slot == TOMBSTONE && !reuse) {
+                reuse = &table->slots[i];
+            }
+            if (slot == EMPTY) {
+                if (!reuse) {
+                    reuse = &table->slots[i];
+                    table->used++;
+                }
+                break;
+            }
+        }
+        reuse->store(handle, std::memory_order_release);
+    }
+
+    void erase(void *handle) {
+        if (handle == EMPTY || handle == TOMBSTONE) {
+            return;
+        }
+        std::unique_lock<std::mutex> lock(mutex);
+        table_t *table = current.load(std::memory_order_relaxed);
+        for (size_t i = table->first(handle), n = 0; n < table->capacity;
+             i = (i + 1) & table->mask, ++n) {
+            void *slot = table->slots[i].load(std::memory_order_relaxed);
+            if (slot == handle) {
+                table->slots[i].store(TOMBSTONE, std::memory_order_release);
+                return;
+            }
+            if (slot == EMPTY) {
+                return;
+            }
+        }
+    }
+
+  private:
+    static constexpr size_t INITIAL_CAPACITY = 256;
+    static inline void *const EMPTY = nullptr;
+    static inline void *const TOMBSTONE = reinterpret_cast<void *>(1);
+
+    struct table_t {
+        explicit table_t(size_t capacity)
+            : capacity(capacity), mask(capacity - 1),
+              slots(std::make_unique<std::atomic<void *>[]>(capacity)) {
+            for (size_t i = 0; i < capacity; ++i) {
+                slots[i].store(EMPTY, std::memory_order_relaxed);
+            }
+        }
+
+        size_t first(void *handle) const {
+            auto value = reinterpret_cast<uintptr_t>(handle);
+            value ^= value >> 33;
+            value *= 0xff51afd7ed558ccdULL;
+            value ^= value >> 33;
+            return static_cast<size_t>(value) & mask;
+        }
+
+        size_t capacity;
+        size_t mask;
+        // Slots that are not EMPTY (live or TOMBSTONE); guarded by mutex.
+        size_t used = 0;
+        std::unique_ptr<std::atomic<void *>[]> slots;
+    };
+
+    static bool find(const table_t *table, void *handle) {
+        for (size_t i = table->first(handle), n = 0; n < table->capacity;
+             i = (i + 1) & table->mask, ++n) {
+            void *slot = table->slots[i].load(std::memory_order_acquire);
+            if (slot == handle) {
+                return true;
+            }
+            if (slot == EMPTY) {
+                return false;
+            }
+        }
+        return false;
+    }
+
+    table_t *grow(table_t *table) {
+        size_t live = 0;
+        for (size_t i = 0; i < table->capacity; ++i) {
+            void *slot = table->slots[i].load(std::memory_order_relaxed);
+            live += (slot != EMPTY && slot != TOMBSTONE);
+        }
+        // Dropping tombstones may be enough, otherwise double the size.
+        size_t capacity = table->capacity;
+        while ((live + 1) * 4 > capacity) {
+            capacity *= 2;
+        }
+
+        // Reuse a previously replaced table of the right size, if any, so
+        // that the memory kept around stays bounded.
+        table_t *next = nullptr;
+        for (auto &candidate : tables) {
+            if (candidate.get() != table && candidate->capacity == capacity) {
+                next = candidate.get();
+                break;
+            }
+        }
+        if (next) {
+            generation.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_release);
+            for (size_t i = 0; i < capacity; ++i) {
+                next->slots[i].store(EMPTY, std::memory_order_relaxed);
+            }
+            next->used = 0;
+        } else {
+            tables.push_back(std::make_unique<table_t>(capacity));
+            next = tables.back().get();
+        }
+
+        for (size_t i = 0; i < table->capacity; ++i) {
+            void *slot = table->slots[i].load(std::memory_order_relaxed);
+            if (slot == EMPTY || slot == TOMBSTONE) {
+                continue;
+            }
+            size_t j = next->first(slot);
+            while (next->slots[j].load(std::memory_order_relaxed) != EMPTY) {
+                j = (j + 1) & next->mask;
+            }
+            next->slots[j].store(slot, std::memory_order_relaxed);
+            next->used++;
+        }
+
+        current.store(next, std::memory_order_release);
+        return next;
+    }
+
+    std::mutex mutex;
+    std::atomic<table_t *> current;
+    std::atomic<uint64_t> generation = 0;
+    // Every table allocated so far; at most two of each capacity.
+    std::vector<std::unique_ptr<table_t>> tables;
+};
+
+} // namespace ur_validation_layer
+
+#endif /* UR_HANDLE_REGISTRY_H */
@@ -6,8 +6,10 @@
 #define UR_LEAK_CHECK_H 1
 
 #include "backtrace.hpp"
+#include "ur_handle_registry.hpp"
 #include "ur_validation_layer.hpp"
 
+#include <atomic>
 #include <mutex>
 #include <typeindex>
 #include <unordered_map>
@@ -17,16 +19,82 @@
 
 namespace ur_validation_layer {
 
+/// @brief Interns captured call stacks. Each distinct return address gets a
+///        small frame id and each distinct sequence of frame ids a stack id,
+///        so handles created from the same place share one stored backtrace.
+///        Symbolization only happens when a stack is reported.
+class BacktraceTable {
+  public:
+    using StackId = uint32_t;
+
+    StackId intern(const std::vector<BacktraceFrame> &frames) {
+        std::unique_lock<std::mutex> lock(mutex);
+
+        std::vector<FrameId> ids;
+        ids.reserve(frames.size());
+        for (auto frame : frames) {
+            auto [it, inserted] =
+                frameIds.try_emplace(frame, FrameId(this->frames.size()));
+            if (inserted) {
+                this->frames.push_back(frame);
+            }
+            ids.push_back(it->second);
+        }
+
+        auto [it, inserted] =
+            stackIds.try_emplace(std::move(ids), StackId(stacks.size()));
+        if (inserted) {
+            stacks.push_back(&it->first);
+        }
+        return it->second;
+    }
+
+    std::vector<BacktraceLine> symbolize(StackId id) {
+        std::vector<BacktraceFrame> stack;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            for (auto frameId : *stacks[id]) {
+                stack.push_back(frames[frameId]);
+            }
+        }
+        return symbolizeBacktrace(stack);
+    }
+
+  private:
+    using FrameId = uint32_t;
+
+    struct StackHash {
+        size_t operator()(const std::vector<FrameId> &ids) const {
+            size_t hash = ids.size();
+            for (auto id : ids) {
+                hash ^= id + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+            }
+            return hash;
+        }
+    };
+
+    std::mutex mutex;
+    std::unordered_map<BacktraceFrame, FrameId> frameIds;
+    std::vector<BacktraceFrame> frames;
+    std::unordered_map<std::vector<FrameId>, StackId, StackHash> stackIds;
+    // Keys of stackIds, indexed by StackId. Node-based map keys are stable.
+    std::vector<const std::vector<FrameId> *> stacks;
+};
+
 struct RefCountContext {
   private:
     struct RefRuntimeInfo {
         int64_t refCount;
         std::type_index type;
-        std::vector<BacktraceLine> backtrace;
+        BacktraceTable::StackId backtrace;
+        // Registry of the handle's type, holding it while refCount >= 1.
+        HandleRegistry *registry;
 
         RefRuntimeInfo(int64_t refCount, std::type_index type,
-                       std::vector<BacktraceLine> backtrace)
-            : refCount(refCount), type(type), backtrace(backtrace) {}
+                       BacktraceTable::StackId backtrace,
+                       HandleRegistry *registry)
+            : refCount(refCount), type(type), backtrace(backtrace),
+              registry(registry) {}
     };
 
     enum RefCountUpdateType {
@@ -36,24 +104,67 @@ struct RefCountContext {
         REFCOUNT_DECREASE,
     };
 
-    std::mutex mutex;
-    std::unordered_map<void *, struct RefRuntimeInfo> counts;
-    int64_t adapterCount = 0;
+    // Handles are spread over independently locked shards, so that threads
+    // working on unrelated handles don't serialize on a single mutex.
+    static constexpr size_t SHARD_COUNT = 64;
+
+    struct alignas(64) Shard {
+        std::mutex mutex;
+        std::unordered_map<void *, struct RefRuntimeInfo> counts;
+    };
+
+    Shard shards[SHARD_COUNT];
+    BacktraceTable backtraces;
+    std::atomic<int64_t> adapterCount = 0;
+
+    std::mutex registriesMutex;
+    std::unordered_map<std::type_index, std::unique_ptr<HandleRegistry>>
+        registries;
+
+    template <typename T> HandleRegistry *getRegistry() {
+        // There is a single RefCountContext per process, so the lookup is
+        // only done once per handle type.
+        static HandleRegistry *registry = [this] {
+            std::unique_lock<std::mutex> lock(registriesMutex);
+            auto &entry = registries[std::type_index(typeid(T))];
+            if (!entry) {
+                entry = std::make_unique<HandleRegistry>();
+            }
+            return entry.get();
+        }();
+        return registry;
+    }
+
+    Shard &getShard(void *ptr) {
+        // Handles are at least 8-byte aligned; mix in the higher bits.
+        auto value = reinterpret_cast<uintptr_t>(ptr) >> 3;
+        value ^= value >> 6;
+        value ^= value >> 12;
+        return shards[value % SHARD_COUNT];
+    }
+
+    template <typename T> RefRuntimeInfo newRuntimeInfo(int64_t refCount) {
+        return RefRuntimeInfo{refCount, std::type_index(typeid(T)),
+                              backtraces.intern(captureBacktrace()),
+                              getRegistry<T>()};
+    }
 
     template <typename T>
     void updateRefCount(T handle, enum RefCountUpdateType type,
                         bool isAdapterHandle = false) {
-        std::unique_lock<std::mutex> ulock(mutex);
-
         void *ptr = static_cast<void *>(handle);
+        Shard &shard = getShard(ptr);
+        std::unique_lock<std::mutex> ulock(shard.mutex);
+
+        auto &counts = shard.counts;
         auto it = counts.find(ptr);
+        bool wasLive = it != counts.end() && it->second.refCount >= 1;
 
         switch (type) {
         case REFCOUNT_CREATE_OR_INCREASE:
             if (it == counts.end()) {
-                std::tie(it, std::ignore) = counts.emplace(
-                    ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                std::tie(it, std::ignore) =
+                    counts.emplace(ptr, newRuntimeInfo<T>(1));
                 if (isAdapterHandle) {
                     adapterCount++;
                 }
@@ -63,9 +174,8 @@ struct RefCountContext {
             break;
         case REFCOUNT_CREATE:
             if (it == counts.end()) {
-                std::tie(it, std::ignore) = counts.emplace(
-                    ptr, RefRuntimeInfo{1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                std::tie(it, std::ignore) =
+                    counts.emplace(ptr, newRuntimeInfo<T>(1));
             } else {
                 getContext()->logger.error("Handle {} already exists", ptr);
                 return;
@@ -82,9 +192,8 @@ struct RefCountContext {
             break;
         case REFCOUNT_DECREASE:
             if (it == counts.end()) {
-                std::tie(it, std::ignore) = counts.emplace(
-                    ptr, RefRuntimeInfo{-1, std::type_index(typeid(handle)),
-                                        getCurrentBacktrace()});
+                std::tie(it, std::ignore) =
+                    counts.emplace(ptr, newRuntimeInfo<T>(-1));
             } else {
                 it->second.refCount--;
             }
@@ -102,14 +211,21 @@ struct RefCountContext {
             "Reference count for handle {} changed to {}", ptr,
             it->second.refCount);
 
+        bool isLive = it->second.refCount >= 1;
+        if (isLive && !wasLive) {
+            it->second.registry->insert(ptr);
+        } else if (!isLive && wasLive) {
+            it->second.registry->erase(ptr);
+        }
+
         if (it->second.refCount == 0) {
             counts.erase(ptr);
         }
+        ulock.unlock();
 
         // No more active adapters, so any references still held are leaked
         if (adapterCount == 0) {
-            logInvalidReferences();
-            counts.clear();
+            logInvalidReferences(/*clear*/ true);
         }
     }
 
@@ -133,25 +249,49 @@ struct RefCountContext {
         updateRefCount(handle, REFCOUNT_CREATE_OR_INCREASE, isAdapterHandle);
     }
 
+    /// @brief Whether handle is live and was recorded with type T. This is
+    ///        a lock-free lookup in the per-type registry, not in the shards.
     template <typename T> bool isReferenceValid(T handle) {
-        std::unique_lock<std::mutex> lock(mutex);
-        auto it = counts.find(static_cast<void *>(handle));
-        if (it == counts.end() || it->second.refCount < 1) {
-            return false;
-        }
-
-        return (it->second.type == std::type_index(typeid(handle)));
+        return getRegistry<T>()->contains(static_cast<void *>(handle));
     }
 
-    void logInvalidReferences() {
-        for (auto &[ptr, refRuntimeInfo] : counts) {
-            getContext()->logger.error("Retained {} reference(s) to handle {}",
-                                       refRuntimeInfo.refCount, ptr);
-            getContext()->logger.error(
-                "Handle {} was recorded for first time here:", ptr);
-            for (size_t i = 0; i < refRuntimeInfo.backtrace.size(); i++) {
-                getContext()->logger.error("#{} {}", i,
-                                           refRuntimeInfo.backtrace[i].c_str());
+    void logInvalidReferences(bool clear = false) {
+        // Lock every shard, always in the same order, for a consistent view.
+        std::vector<std::unique_lock<std::mutex>> locks;
+        locks.reserve(SHARD_COUNT);
+        for (auto &shard : shards) {
+            locks.emplace_back(shard.mutex);
+        }
+
+        std::unordered_map<BacktraceTable::StackId, std::vector<BacktraceLine>>
+            symbolized;
+        for (auto &shard : shards) {
+            for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                getContext()->logger.error(
+                    "Retained {} reference(s) to handle {}",
+                    refRuntimeInfo.refCount, ptr);
+                getContext()->logger.error(
+                    "Handle {} was recorded for first time here:", ptr);
+                auto it = symbolized.find(refRuntimeInfo.backtrace);
+                if (it == symbolized.end()) {
+                    it = symbolized
+                             .emplace(refRuntimeInfo.backtrace,
+                                      backtraces.symbolize(
+                                          refRuntimeInfo.backtrace))
+                             .first;
+                }
+                for (size_t i = 0; i < it->second.size(); i++) {
+                    getContext()->logger.error("#{} {}", i,
+                                               it->second[i].c_str());
+                }
+            }
+            if (clear) {
+                for (auto &[ptr, refRuntimeInfo] : shard.counts) {
+                    if (refRuntimeInfo.refCount >= 1) {
+                        refRuntimeInfo.registry->erase(ptr);
+                    }
+                }
+                shard.counts.clear();
             }
         }
     }
@@ -182,7 +182,7 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_ADAPTER_INFO_REFERENCE_COUNT < propName) {
+        if (UR_ADAPTER_INFO_PERF_COUNTERS < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -514,7 +514,7 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP < propName) {
+        if (UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -927,7 +927,7 @@ __urdlllocal ur_result_t UR_APICALL urContextGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES < propName) {
+        if (UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -1149,6 +1149,10 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreate(
         getContext()->refCountContext->createRefCount(*phMem);
     }
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.eraseBuffer(*phMem);
+    }
+
     return result;
 }
 
@@ -1217,6 +1221,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreate(
         getContext()->refCountContext->createRefCount(*phBuffer);
     }
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertBuffer(*phBuffer, size);
+    }
+
     return result;
 }
 
@@ -1326,6 +1334,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferPartition(
     ur_result_t result =
         pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertBuffer(*phMem, pRegion->size);
+    }
+
     return result;
 }
 
@@ -1410,6 +1422,10 @@ __urdlllocal ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
         getContext()->refCountContext->createRefCount(*phMem);
     }
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.eraseBuffer(*phMem);
+    }
+
     return result;
 }
 
@@ -1464,6 +1480,10 @@ __urdlllocal ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
         getContext()->refCountContext->createRefCount(*phMem);
     }
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.eraseBuffer(*phMem);
+    }
+
     return result;
 }
 
@@ -1865,6 +1885,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMHostAlloc(
 
     ur_result_t result = pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertUSM(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -1932,6 +1956,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMDeviceAlloc(
     ur_result_t result =
         pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertUSM(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -1999,6 +2027,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMSharedAlloc(
     ur_result_t result =
         pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertUSM(*ppMem, size);
+    }
+
     return result;
 }
 
@@ -2029,6 +2061,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMFree(
         getContext()->refCountContext->logInvalidReference(hContext);
     }
 
+    if (getContext()->enableBoundsChecking) {
+        getContext()->allocSizes.eraseUSM(pMem);
+    }
+
     ur_result_t result = pfnFree(hContext, pMem);
 
     return result;
@@ -2210,7 +2246,7 @@ __urdlllocal ur_result_t UR_APICALL urUSMPoolGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_USM_POOL_INFO_CONTEXT < propName) {
+        if (UR_USM_POOL_INFO_BUCKET_MISSES_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -4015,7 +4051,7 @@ __urdlllocal ur_result_t UR_APICALL urQueueGetInfo(
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (UR_QUEUE_INFO_EMPTY < propName) {
+        if (UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP < propName) {
             return UR_RESULT_ERROR_INVALID_ENUMERATION;
         }
 
@@ -6940,6 +6976,10 @@ __urdlllocal ur_result_t UR_APICALL urUSMPitchedAllocExp(
         pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
                            height, elementSizeBytes, ppMem, pResultPitch);
 
+    if (getContext()->enableBoundsChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->allocSizes.insertUSM(*ppMem, *pResultPitch * height);
+    }
+
     return result;
 }
 
@@ -7369,6 +7409,116 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesImageCopyBatchExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    uint32_t numCopyRegions, ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *
+        pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+    ///< must not refer to an element of the phEventWaitList array.
+) {
+    auto pfnImageCopyBatchExp =
+        getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyBatchExp;
+
+    if (nullptr == pfnImageCopyBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDst) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrcImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstImageDesc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSrcImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pDstImageFormat) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pCopyRegions) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (numCopyRegions == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (pSrcImageDesc &&
+            UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pSrcImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (pDstImageDesc &&
+            UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pDstImageDesc->type) {
+            return UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnImageCopyBatchExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+        numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urBindlessImagesImageGetInfoExp
 __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
@@ -9502,6 +9652,96 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUpdateKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t
+        numKernelUpdates, ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *
+        phCommands, ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                    ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                            ///< command is to be updated.
+) {
+    auto pfnUpdateKernelLaunchBatchExp =
+        getContext()->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchBatchExp;
+
+    if (nullptr == pfnUpdateKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phCommands) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pUpdateKernelLaunch) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (numKernelUpdates == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        for (uint32_t i = 0; i < numKernelUpdates; ++i) {
+            if (NULL == phCommands[i]) {
+                return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+            }
+
+            if (pUpdateKernelLaunch[i].newWorkDim < 1 ||
+                pUpdateKernelLaunch[i].newWorkDim > 3) {
+                return UR_RESULT_ERROR_INVALID_WORK_DIMENSION;
+            }
+        }
+    }
+
+    ur_result_t result = pfnUpdateKernelLaunchBatchExp(
+        hCommandBuffer, numKernelUpdates, phCommands, pUpdateKernelLaunch);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUploadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue ///< [in] The queue to upload the command-buffer on.
+) {
+    auto pfnUploadExp = getContext()->urDdiTable.CommandBufferExp.pfnUploadExp;
+
+    if (nullptr == pfnUploadExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUploadExp(hCommandBuffer, hQueue);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueCooperativeKernelLaunchExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
@@ -9631,6 +9871,67 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+) {
+    auto pfnSetArgsExp = getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hKernel) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pArgs) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (numArgs == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        for (uint32_t i = 0; i < numArgs; ++i) {
+            if (pArgs[i].type > UR_EXP_KERNEL_ARG_TYPE_SAMPLER) {
+                return UR_RESULT_ERROR_INVALID_ENUMERATION;
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hKernel)) {
+        getContext()->refCountContext->logInvalidReference(hKernel);
+    }
+
+    if (getContext()->enableLifetimeValidation) {
+        for (uint32_t i = 0; i < numArgs; ++i) {
+            if (pArgs[i].type == UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ &&
+                !getContext()->refCountContext->isReferenceValid(
+                    pArgs[i].value.memObjTuple.hMem)) {
+                getContext()->refCountContext->logInvalidReference(
+                    pArgs[i].value.memObjTuple.hMem);
+            } else if (pArgs[i].type == UR_EXP_KERNEL_ARG_TYPE_SAMPLER &&
+                       !getContext()->refCountContext->isReferenceValid(
+                           pArgs[i].value.sampler)) {
+                getContext()->refCountContext->logInvalidReference(
+                    pArgs[i].value.sampler);
+            }
+        }
+    }
+
+    ur_result_t result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueTimestampRecordingExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
@@ -9699,6 +10000,40 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                         ///< completion of any of
+    uint32_t *pIndex     ///< [out] index in `phEventWaitList` of a completed event
+) {
+    auto pfnWaitAnyExp = getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == phEventWaitList) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pIndex) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (numEvents == 0) {
+            return UR_RESULT_ERROR_INVALID_VALUE;
+        }
+    }
+
+    ur_result_t result = pfnWaitAnyExp(numEvents, phEventWaitList, pIndex);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueKernelLaunchCustomExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
@@ -9914,246 +10249,1081 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMImportExp
-__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem,                   ///< [in] pointer to host memory object
-    size_t size ///< [in] size in bytes of the host memory object to be imported
+/// @brief Intercept function for urEnqueueKernelLaunchMultiExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
 ) {
-    auto pfnImportExp = getContext()->urDdiTable.USMExp.pfnImportExp;
+    auto pfnKernelLaunchMultiExp =
+        getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchMultiExp;
 
-    if (nullptr == pfnImportExp) {
+    if (nullptr == pfnKernelLaunchMultiExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     if (getContext()->enableParameterValidation) {
-        if (NULL == hContext) {
-            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        if (NULL == pLaunches) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (NULL == pMem) {
-            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        if (numLaunches == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
         }
-    }
 
-    if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(hContext)) {
-        getContext()->refCountContext->logInvalidReference(hContext);
+        for (uint32_t i = 0; i < numLaunches; ++i) {
+            if (NULL == pLaunches[i].hQueue) {
+                return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+            }
+
+            if (NULL == pLaunches[i].hKernel) {
+                return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+            }
+
+            if (NULL == pLaunches[i].pGlobalWorkSize) {
+                return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+            }
+
+            if (pLaunches[i].numArgs != 0 && NULL == pLaunches[i].pArgs) {
+                return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+            }
+
+            if (pLaunches[i].phEventWaitList == NULL &&
+                pLaunches[i].numEventsInWaitList > 0) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+
+            if (pLaunches[i].phEventWaitList != NULL &&
+                pLaunches[i].numEventsInWaitList == 0) {
+                return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation) {
+        for (uint32_t i = 0; i < numLaunches; ++i) {
+            if (!getContext()->refCountContext->isReferenceValid(
+                    pLaunches[i].hQueue)) {
+                getContext()->refCountContext->logInvalidReference(
+                    pLaunches[i].hQueue);
+            }
+            if (!getContext()->refCountContext->isReferenceValid(
+                    pLaunches[i].hKernel)) {
+                getContext()->refCountContext->logInvalidReference(
+                    pLaunches[i].hKernel);
+            }
+        }
+    }
+
+    ur_result_t result = pfnKernelLaunchMultiExp(numLaunches, pLaunches);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
+) {
+    auto pfnBuildAsyncExp =
+        getContext()->urDdiTable.ProgramExp.pfnBuildAsyncExp;
+
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hProgram) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hProgram)) {
+        getContext()->refCountContext->logInvalidReference(hProgram);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnBuildAsyncExp(hProgram, hQueue, pOptions, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueBeginCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueBeginCaptureExp(
+    ur_queue_handle_t
+        hQueue ///< [in] handle of the queue to capture the commands of
+) {
+    auto pfnBeginCaptureExp =
+        getContext()->urDdiTable.QueueExp.pfnBeginCaptureExp;
+
+    if (nullptr == pfnBeginCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnBeginCaptureExp(hQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueEndCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *
+        phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                        ///< commands
+) {
+    auto pfnEndCaptureExp = getContext()->urDdiTable.QueueExp.pfnEndCaptureExp;
+
+    if (nullptr == pfnEndCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phCommandBuffer) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnEndCaptureExp(hQueue, phCommandBuffer);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be used.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the allocation.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnUSMDeviceAllocExp = getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
+
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (size == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    void *pMem,                   ///< [in] pointer to USM memory object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be freed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the free. If
+    ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnUSMFreeExp = getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
+
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowableAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t
+        maxSize, ///< [in] size in bytes of the address range reserved for the allocation
+    size_t
+        size, ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem ///< [out] pointer to USM device memory object
+) {
+    auto pfnGrowableAllocExp =
+        getContext()->urDdiTable.USMExp.pfnGrowableAllocExp;
+
+    if (nullptr == pfnGrowableAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == ppMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (maxSize == 0) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+
+        if (size > maxSize) {
+            return UR_RESULT_ERROR_INVALID_USM_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result =
+        pfnGrowableAllocExp(hContext, hDevice, maxSize, size, ppMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size ///< [in] size in bytes the allocation must be backed for
+) {
+    auto pfnGrowExp = getContext()->urDdiTable.USMExp.pfnGrowExp;
+
+    if (nullptr == pfnGrowExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnGrowExp(hContext, pMem, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+) {
+    auto pfnImportExp = getContext()->urDdiTable.USMExp.pfnImportExp;
+
+    if (nullptr == pfnImportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnImportExp(hContext, pMem, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+) {
+    auto pfnReleaseExp = getContext()->urDdiTable.USMExp.pfnReleaseExp;
+
+    if (nullptr == pfnReleaseExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pMem) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    ur_result_t result = pfnReleaseExp(hContext, pMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnEnablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+
+    if (nullptr == pfnEnablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    auto pfnDisablePeerAccessExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+
+    if (nullptr == pfnDisablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    auto pfnPeerAccessGetInfoExp =
+        getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+
+    if (nullptr == pfnPeerAccessGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == commandDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == peerDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (propSize != 0 && pPropValue == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (pPropValue == NULL && pPropSizeRet == NULL) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED < propName) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (propSize == 0 && pPropValue != NULL) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
+        getContext()->refCountContext->logInvalidReference(commandDevice);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
+        getContext()->refCountContext->logInvalidReference(peerDevice);
+    }
+
+    ur_result_t result =
+        pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
+                                pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t
+        minBytesToKeep ///< [in] number of bytes of free memory which may be left cached
+) {
+    auto pfnPoolTrimExp = getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hPool)) {
+        getContext()->refCountContext->logInvalidReference(hPool);
+    }
+
+    ur_result_t result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
+    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+) {
+    auto pfnNativeCommandExp =
+        getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+
+    if (nullptr == pfnNativeCommandExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnNativeEnqueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL != pProperties &&
+            UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags) {
+            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnNativeCommandExp(
+        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
+        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueHostTaskExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_host_task_function_t
+        pfnHostTask, ///< [in] function run on the host once the host task's dependencies
+                     ///< completed
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host task is run.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once pfnHostTask
+                ///< returned.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    auto pfnHostTaskExp = getContext()->urDdiTable.EnqueueExp.pfnHostTaskExp;
+
+    if (nullptr == pfnHostTaskExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hQueue) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == pfnHostTask) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
+    }
+
+    ur_result_t result = pfnHostTaskExp(hQueue, pfnHostTask, pUserData,
+                                        numEventsInWaitList, phEventWaitList,
+                                        phEvent);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventCreateIPCExp
+__urdlllocal ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+) {
+    auto pfnCreateIPCExp = getContext()->urDdiTable.EventExp.pfnCreateIPCExp;
+
+    if (nullptr == pfnCreateIPCExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    ur_result_t result = pfnImportExp(hContext, pMem, size);
+    if (getContext()->enableParameterValidation) {
+        if (NULL == hContext) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == hDevice) {
+            return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+
+        if (NULL == phEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
+    }
+
+    if (getContext()->enableLifetimeValidation &&
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
+    }
+
+    ur_result_t result = pfnCreateIPCExp(hContext, hDevice, phEvent);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phEvent);
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMReleaseExp
-__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem                    ///< [in] pointer to host memory object
+/// @brief Intercept function for urEventGetIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t
+        hEvent, ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *
+        pIPCHandle ///< [out] pointer to the IPC handle of the event
 ) {
-    auto pfnReleaseExp = getContext()->urDdiTable.USMExp.pfnReleaseExp;
+    auto pfnGetIPCHandleExp =
+        getContext()->urDdiTable.EventExp.pfnGetIPCHandleExp;
 
-    if (nullptr == pfnReleaseExp) {
+    if (nullptr == pfnGetIPCHandleExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     if (getContext()->enableParameterValidation) {
-        if (NULL == hContext) {
+        if (NULL == hEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (NULL == pMem) {
+        if (NULL == pIPCHandle) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(hContext)) {
-        getContext()->refCountContext->logInvalidReference(hContext);
+        !getContext()->refCountContext->isReferenceValid(hEvent)) {
+        getContext()->refCountContext->logInvalidReference(hEvent);
     }
 
-    ur_result_t result = pfnReleaseExp(hContext, pMem);
+    ur_result_t result = pfnGetIPCHandleExp(hEvent, pIPCHandle);
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+/// @brief Intercept function for urEventOpenIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
     ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    const ur_exp_ipc_event_handle_t *
+        pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                    ///< another process
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
 ) {
-    auto pfnEnablePeerAccessExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
+    auto pfnOpenIPCHandleExp =
+        getContext()->urDdiTable.EventExp.pfnOpenIPCHandleExp;
 
-    if (nullptr == pfnEnablePeerAccessExp) {
+    if (nullptr == pfnOpenIPCHandleExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     if (getContext()->enableParameterValidation) {
-        if (NULL == commandDevice) {
+        if (NULL == hContext) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (NULL == peerDevice) {
+        if (NULL == hDevice) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+
+        if (NULL == pIPCHandle) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == phEvent) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
-        getContext()->refCountContext->logInvalidReference(commandDevice);
+        !getContext()->refCountContext->isReferenceValid(hContext)) {
+        getContext()->refCountContext->logInvalidReference(hContext);
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
-        getContext()->refCountContext->logInvalidReference(peerDevice);
+        !getContext()->refCountContext->isReferenceValid(hDevice)) {
+        getContext()->refCountContext->logInvalidReference(hDevice);
     }
 
-    ur_result_t result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    ur_result_t result = pfnOpenIPCHandleExp(hContext, hDevice, pIPCHandle,
+                                             phEvent);
+
+    if (getContext()->enableLeakChecking && result == UR_RESULT_SUCCESS) {
+        getContext()->refCountContext->createRefCount(*phEvent);
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urEnqueueIPCEventSignalExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to signal
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the IPC event is signaled.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
-    auto pfnDisablePeerAccessExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
+    auto pfnIPCEventSignalExp =
+        getContext()->urDdiTable.EnqueueExp.pfnIPCEventSignalExp;
 
-    if (nullptr == pfnDisablePeerAccessExp) {
+    if (nullptr == pfnIPCEventSignalExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     if (getContext()->enableParameterValidation) {
-        if (NULL == commandDevice) {
+        if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (NULL == peerDevice) {
+        if (NULL == hIPCEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
+        }
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
-        getContext()->refCountContext->logInvalidReference(commandDevice);
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
-        getContext()->refCountContext->logInvalidReference(peerDevice);
+        !getContext()->refCountContext->isReferenceValid(hIPCEvent)) {
+        getContext()->refCountContext->logInvalidReference(hIPCEvent);
     }
 
-    ur_result_t result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    ur_result_t result = pfnIPCEventSignalExp(hQueue, hIPCEvent,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t
-        commandDevice,             ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
-    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
-    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
-    void *
-        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
-                    ///< the info.
-    ///< If propSize is not equal to or greater than the real number of bytes
-    ///< needed to return the info
-    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
-    ///< pPropValue is not used.
-    size_t *
-        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+/// @brief Intercept function for urEnqueueIPCEventWaitExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command starts waiting.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once the IPC
+                ///< event was signaled.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
-    auto pfnPeerAccessGetInfoExp =
-        getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
+    auto pfnIPCEventWaitExp =
+        getContext()->urDdiTable.EnqueueExp.pfnIPCEventWaitExp;
 
-    if (nullptr == pfnPeerAccessGetInfoExp) {
+    if (nullptr == pfnIPCEventWaitExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     if (getContext()->enableParameterValidation) {
-        if (NULL == commandDevice) {
+        if (NULL == hQueue) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (NULL == peerDevice) {
+        if (NULL == hIPCEvent) {
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (propSize != 0 && pPropValue == NULL) {
-            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
-        }
-
-        if (pPropValue == NULL && pPropSizeRet == NULL) {
-            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (UR_EXP_PEER_INFO_UR_PEER_ATOMICS_SUPPORTED < propName) {
-            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
-        if (propSize == 0 && pPropValue != NULL) {
-            return UR_RESULT_ERROR_INVALID_SIZE;
+        if (phEventWaitList != NULL && numEventsInWaitList > 0) {
+            for (uint32_t i = 0; i < numEventsInWaitList; ++i) {
+                if (phEventWaitList[i] == NULL) {
+                    return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+                }
+            }
         }
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(commandDevice)) {
-        getContext()->refCountContext->logInvalidReference(commandDevice);
+        !getContext()->refCountContext->isReferenceValid(hQueue)) {
+        getContext()->refCountContext->logInvalidReference(hQueue);
     }
 
     if (getContext()->enableLifetimeValidation &&
-        !getContext()->refCountContext->isReferenceValid(peerDevice)) {
-        getContext()->refCountContext->logInvalidReference(peerDevice);
+        !getContext()->refCountContext->isReferenceValid(hIPCEvent)) {
+        getContext()->refCountContext->logInvalidReference(hIPCEvent);
     }
 
-    ur_result_t result =
-        pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName, propSize,
-                                pPropValue, pPropSizeRet);
+    ur_result_t result = pfnIPCEventWaitExp(hQueue, hIPCEvent,
+                                            numEventsInWaitList,
+                                            phEventWaitList, phEvent);
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urEnqueueNativeCommandExp
-__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+/// @brief Intercept function for urEnqueueUSMMemcpyBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_exp_enqueue_native_command_function_t
-        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
-                          ///< immediately.
-    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
-    uint32_t numMemsInMemList, ///< [in] size of the mem list
-    const ur_mem_handle_t *
-        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
-                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
-    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
-    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
-    const ur_exp_enqueue_native_command_properties_t *
-        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,       ///< [in] number of blocks to copy
+    void **
+        ppDst, ///< [in][range(0, numCopies)] pointers to the destination USM memory
+               ///< blocks
+    const void **
+        ppSrc, ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *
+        pSizes, ///< [in][range(0, numCopies)] sizes in bytes of the blocks
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before the kernel execution.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
     ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies the work that has
-    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
-    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+        phEvent ///< [out][optional] return an event object that is complete once all the
+    ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+    ///< phEvent must not refer to an element of the phEventWaitList array.
 ) {
-    auto pfnNativeCommandExp =
-        getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
+    auto pfnUSMMemcpyBatchExp =
+        getContext()->urDdiTable.EnqueueExp.pfnUSMMemcpyBatchExp;
 
-    if (nullptr == pfnNativeCommandExp) {
+    if (nullptr == pfnUSMMemcpyBatchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
@@ -10162,13 +11332,28 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
             return UR_RESULT_ERROR_INVALID_NULL_HANDLE;
         }
 
-        if (NULL == pfnNativeEnqueue) {
+        if (NULL == ppDst) {
             return UR_RESULT_ERROR_INVALID_NULL_POINTER;
         }
 
-        if (NULL != pProperties &&
-            UR_EXP_ENQUEUE_NATIVE_COMMAND_FLAGS_MASK & pProperties->flags) {
-            return UR_RESULT_ERROR_INVALID_ENUMERATION;
+        if (NULL == ppSrc) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (NULL == pSizes) {
+            return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+        }
+
+        if (numCopies == 0) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+
+        if (phEventWaitList == NULL && numEventsInWaitList > 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
+        }
+
+        if (phEventWaitList != NULL && numEventsInWaitList == 0) {
+            return UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST;
         }
 
         if (phEventWaitList != NULL && numEventsInWaitList > 0) {
@@ -10185,9 +11370,10 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
         getContext()->refCountContext->logInvalidReference(hQueue);
     }
 
-    ur_result_t result = pfnNativeCommandExp(
-        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemList,
-        pProperties, numEventsInWaitList, phEventWaitList, phEvent);
+    ur_result_t result = pfnUSMMemcpyBatchExp(hQueue, blocking, numCopies,
+                                              ppDst, ppSrc, pSizes,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
 
     return result;
 }
@@ -10205,36 +11391,45 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
     ur_global_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Global;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Global;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnAdapterGet = pDdiTable->pfnAdapterGet;
-    pDdiTable->pfnAdapterGet = ur_validation_layer::urAdapterGet;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnAdapterGet = ur_validation_layer::urAdapterGet;
+    }
 
     dditable.pfnAdapterRelease = pDdiTable->pfnAdapterRelease;
-    pDdiTable->pfnAdapterRelease = ur_validation_layer::urAdapterRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnAdapterRelease = ur_validation_layer::urAdapterRelease;
+    }
 
     dditable.pfnAdapterRetain = pDdiTable->pfnAdapterRetain;
-    pDdiTable->pfnAdapterRetain = ur_validation_layer::urAdapterRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnAdapterRetain = ur_validation_layer::urAdapterRetain;
+    }
 
     dditable.pfnAdapterGetLastError = pDdiTable->pfnAdapterGetLastError;
-    pDdiTable->pfnAdapterGetLastError =
-        ur_validation_layer::urAdapterGetLastError;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAdapterGetLastError =
+            ur_validation_layer::urAdapterGetLastError;
+    }
 
     dditable.pfnAdapterGetInfo = pDdiTable->pfnAdapterGetInfo;
-    pDdiTable->pfnAdapterGetInfo = ur_validation_layer::urAdapterGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAdapterGetInfo = ur_validation_layer::urAdapterGetInfo;
+    }
 
     return result;
 }
@@ -10252,17 +11447,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     ur_bindless_images_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable =
-        ur_validation_layer::getContext()->urDdiTable.BindlessImagesExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.BindlessImagesExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
@@ -10270,83 +11463,125 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
 
     dditable.pfnUnsampledImageHandleDestroyExp =
         pDdiTable->pfnUnsampledImageHandleDestroyExp;
-    pDdiTable->pfnUnsampledImageHandleDestroyExp =
-        ur_validation_layer::urBindlessImagesUnsampledImageHandleDestroyExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUnsampledImageHandleDestroyExp =
+            ur_validation_layer::urBindlessImagesUnsampledImageHandleDestroyExp;
+    }
 
     dditable.pfnSampledImageHandleDestroyExp =
         pDdiTable->pfnSampledImageHandleDestroyExp;
-    pDdiTable->pfnSampledImageHandleDestroyExp =
-        ur_validation_layer::urBindlessImagesSampledImageHandleDestroyExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSampledImageHandleDestroyExp =
+            ur_validation_layer::urBindlessImagesSampledImageHandleDestroyExp;
+    }
 
     dditable.pfnImageAllocateExp = pDdiTable->pfnImageAllocateExp;
-    pDdiTable->pfnImageAllocateExp =
-        ur_validation_layer::urBindlessImagesImageAllocateExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageAllocateExp =
+            ur_validation_layer::urBindlessImagesImageAllocateExp;
+    }
 
     dditable.pfnImageFreeExp = pDdiTable->pfnImageFreeExp;
-    pDdiTable->pfnImageFreeExp =
-        ur_validation_layer::urBindlessImagesImageFreeExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageFreeExp =
+            ur_validation_layer::urBindlessImagesImageFreeExp;
+    }
 
     dditable.pfnUnsampledImageCreateExp = pDdiTable->pfnUnsampledImageCreateExp;
-    pDdiTable->pfnUnsampledImageCreateExp =
-        ur_validation_layer::urBindlessImagesUnsampledImageCreateExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUnsampledImageCreateExp =
+            ur_validation_layer::urBindlessImagesUnsampledImageCreateExp;
+    }
 
     dditable.pfnSampledImageCreateExp = pDdiTable->pfnSampledImageCreateExp;
-    pDdiTable->pfnSampledImageCreateExp =
-        ur_validation_layer::urBindlessImagesSampledImageCreateExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSampledImageCreateExp =
+            ur_validation_layer::urBindlessImagesSampledImageCreateExp;
+    }
 
     dditable.pfnImageCopyExp = pDdiTable->pfnImageCopyExp;
-    pDdiTable->pfnImageCopyExp =
-        ur_validation_layer::urBindlessImagesImageCopyExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageCopyExp =
+            ur_validation_layer::urBindlessImagesImageCopyExp;
+    }
+
+    dditable.pfnImageCopyBatchExp = pDdiTable->pfnImageCopyBatchExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageCopyBatchExp =
+            ur_validation_layer::urBindlessImagesImageCopyBatchExp;
+    }
 
     dditable.pfnImageGetInfoExp = pDdiTable->pfnImageGetInfoExp;
-    pDdiTable->pfnImageGetInfoExp =
-        ur_validation_layer::urBindlessImagesImageGetInfoExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageGetInfoExp =
+            ur_validation_layer::urBindlessImagesImageGetInfoExp;
+    }
 
     dditable.pfnMipmapGetLevelExp = pDdiTable->pfnMipmapGetLevelExp;
-    pDdiTable->pfnMipmapGetLevelExp =
-        ur_validation_layer::urBindlessImagesMipmapGetLevelExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMipmapGetLevelExp =
+            ur_validation_layer::urBindlessImagesMipmapGetLevelExp;
+    }
 
     dditable.pfnMipmapFreeExp = pDdiTable->pfnMipmapFreeExp;
-    pDdiTable->pfnMipmapFreeExp =
-        ur_validation_layer::urBindlessImagesMipmapFreeExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMipmapFreeExp =
+            ur_validation_layer::urBindlessImagesMipmapFreeExp;
+    }
 
     dditable.pfnImportExternalMemoryExp = pDdiTable->pfnImportExternalMemoryExp;
-    pDdiTable->pfnImportExternalMemoryExp =
-        ur_validation_layer::urBindlessImagesImportExternalMemoryExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImportExternalMemoryExp =
+            ur_validation_layer::urBindlessImagesImportExternalMemoryExp;
+    }
 
     dditable.pfnMapExternalArrayExp = pDdiTable->pfnMapExternalArrayExp;
-    pDdiTable->pfnMapExternalArrayExp =
-        ur_validation_layer::urBindlessImagesMapExternalArrayExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMapExternalArrayExp =
+            ur_validation_layer::urBindlessImagesMapExternalArrayExp;
+    }
 
     dditable.pfnMapExternalLinearMemoryExp =
         pDdiTable->pfnMapExternalLinearMemoryExp;
-    pDdiTable->pfnMapExternalLinearMemoryExp =
-        ur_validation_layer::urBindlessImagesMapExternalLinearMemoryExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMapExternalLinearMemoryExp =
+            ur_validation_layer::urBindlessImagesMapExternalLinearMemoryExp;
+    }
 
     dditable.pfnReleaseExternalMemoryExp =
         pDdiTable->pfnReleaseExternalMemoryExp;
-    pDdiTable->pfnReleaseExternalMemoryExp =
-        ur_validation_layer::urBindlessImagesReleaseExternalMemoryExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnReleaseExternalMemoryExp =
+            ur_validation_layer::urBindlessImagesReleaseExternalMemoryExp;
+    }
 
     dditable.pfnImportExternalSemaphoreExp =
         pDdiTable->pfnImportExternalSemaphoreExp;
-    pDdiTable->pfnImportExternalSemaphoreExp =
-        ur_validation_layer::urBindlessImagesImportExternalSemaphoreExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImportExternalSemaphoreExp =
+            ur_validation_layer::urBindlessImagesImportExternalSemaphoreExp;
+    }
 
     dditable.pfnReleaseExternalSemaphoreExp =
         pDdiTable->pfnReleaseExternalSemaphoreExp;
-    pDdiTable->pfnReleaseExternalSemaphoreExp =
-        ur_validation_layer::urBindlessImagesReleaseExternalSemaphoreExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnReleaseExternalSemaphoreExp =
+            ur_validation_layer::urBindlessImagesReleaseExternalSemaphoreExp;
+    }
 
     dditable.pfnWaitExternalSemaphoreExp =
         pDdiTable->pfnWaitExternalSemaphoreExp;
-    pDdiTable->pfnWaitExternalSemaphoreExp =
-        ur_validation_layer::urBindlessImagesWaitExternalSemaphoreExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnWaitExternalSemaphoreExp =
+            ur_validation_layer::urBindlessImagesWaitExternalSemaphoreExp;
+    }
 
     dditable.pfnSignalExternalSemaphoreExp =
         pDdiTable->pfnSignalExternalSemaphoreExp;
-    pDdiTable->pfnSignalExternalSemaphoreExp =
-        ur_validation_layer::urBindlessImagesSignalExternalSemaphoreExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSignalExternalSemaphoreExp =
+            ur_validation_layer::urBindlessImagesSignalExternalSemaphoreExp;
+    }
 
     return result;
 }
@@ -10364,114 +11599,176 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
     ur_command_buffer_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable =
-        ur_validation_layer::getContext()->urDdiTable.CommandBufferExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.CommandBufferExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreateExp = pDdiTable->pfnCreateExp;
-    pDdiTable->pfnCreateExp = ur_validation_layer::urCommandBufferCreateExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateExp = ur_validation_layer::urCommandBufferCreateExp;
+    }
 
     dditable.pfnRetainExp = pDdiTable->pfnRetainExp;
-    pDdiTable->pfnRetainExp = ur_validation_layer::urCommandBufferRetainExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnRetainExp = ur_validation_layer::urCommandBufferRetainExp;
+    }
 
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
-    pDdiTable->pfnReleaseExp = ur_validation_layer::urCommandBufferReleaseExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnReleaseExp =
+            ur_validation_layer::urCommandBufferReleaseExp;
+    }
 
     dditable.pfnFinalizeExp = pDdiTable->pfnFinalizeExp;
-    pDdiTable->pfnFinalizeExp = ur_validation_layer::urCommandBufferFinalizeExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnFinalizeExp =
+            ur_validation_layer::urCommandBufferFinalizeExp;
+    }
 
     dditable.pfnAppendKernelLaunchExp = pDdiTable->pfnAppendKernelLaunchExp;
-    pDdiTable->pfnAppendKernelLaunchExp =
-        ur_validation_layer::urCommandBufferAppendKernelLaunchExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendKernelLaunchExp =
+            ur_validation_layer::urCommandBufferAppendKernelLaunchExp;
+    }
 
     dditable.pfnAppendUSMMemcpyExp = pDdiTable->pfnAppendUSMMemcpyExp;
-    pDdiTable->pfnAppendUSMMemcpyExp =
-        ur_validation_layer::urCommandBufferAppendUSMMemcpyExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnAppendUSMMemcpyExp =
+            ur_validation_layer::urCommandBufferAppendUSMMemcpyExp;
+    }
 
     dditable.pfnAppendUSMFillExp = pDdiTable->pfnAppendUSMFillExp;
-    pDdiTable->pfnAppendUSMFillExp =
-        ur_validation_layer::urCommandBufferAppendUSMFillExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnAppendUSMFillExp =
+            ur_validation_layer::urCommandBufferAppendUSMFillExp;
+    }
 
     dditable.pfnAppendMemBufferCopyExp = pDdiTable->pfnAppendMemBufferCopyExp;
-    pDdiTable->pfnAppendMemBufferCopyExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferCopyExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferCopyExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferCopyExp;
+    }
 
     dditable.pfnAppendMemBufferWriteExp = pDdiTable->pfnAppendMemBufferWriteExp;
-    pDdiTable->pfnAppendMemBufferWriteExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferWriteExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferWriteExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferWriteExp;
+    }
 
     dditable.pfnAppendMemBufferReadExp = pDdiTable->pfnAppendMemBufferReadExp;
-    pDdiTable->pfnAppendMemBufferReadExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferReadExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferReadExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferReadExp;
+    }
 
     dditable.pfnAppendMemBufferCopyRectExp =
         pDdiTable->pfnAppendMemBufferCopyRectExp;
-    pDdiTable->pfnAppendMemBufferCopyRectExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferCopyRectExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferCopyRectExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferCopyRectExp;
+    }
 
     dditable.pfnAppendMemBufferWriteRectExp =
         pDdiTable->pfnAppendMemBufferWriteRectExp;
-    pDdiTable->pfnAppendMemBufferWriteRectExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferWriteRectExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferWriteRectExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferWriteRectExp;
+    }
 
     dditable.pfnAppendMemBufferReadRectExp =
         pDdiTable->pfnAppendMemBufferReadRectExp;
-    pDdiTable->pfnAppendMemBufferReadRectExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferReadRectExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferReadRectExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferReadRectExp;
+    }
 
     dditable.pfnAppendMemBufferFillExp = pDdiTable->pfnAppendMemBufferFillExp;
-    pDdiTable->pfnAppendMemBufferFillExp =
-        ur_validation_layer::urCommandBufferAppendMemBufferFillExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnAppendMemBufferFillExp =
+            ur_validation_layer::urCommandBufferAppendMemBufferFillExp;
+    }
 
     dditable.pfnAppendUSMPrefetchExp = pDdiTable->pfnAppendUSMPrefetchExp;
-    pDdiTable->pfnAppendUSMPrefetchExp =
-        ur_validation_layer::urCommandBufferAppendUSMPrefetchExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnAppendUSMPrefetchExp =
+            ur_validation_layer::urCommandBufferAppendUSMPrefetchExp;
+    }
 
     dditable.pfnAppendUSMAdviseExp = pDdiTable->pfnAppendUSMAdviseExp;
-    pDdiTable->pfnAppendUSMAdviseExp =
-        ur_validation_layer::urCommandBufferAppendUSMAdviseExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnAppendUSMAdviseExp =
+            ur_validation_layer::urCommandBufferAppendUSMAdviseExp;
+    }
 
     dditable.pfnEnqueueExp = pDdiTable->pfnEnqueueExp;
-    pDdiTable->pfnEnqueueExp = ur_validation_layer::urCommandBufferEnqueueExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnEnqueueExp =
+            ur_validation_layer::urCommandBufferEnqueueExp;
+    }
 
     dditable.pfnRetainCommandExp = pDdiTable->pfnRetainCommandExp;
-    pDdiTable->pfnRetainCommandExp =
-        ur_validation_layer::urCommandBufferRetainCommandExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnRetainCommandExp =
+            ur_validation_layer::urCommandBufferRetainCommandExp;
+    }
 
     dditable.pfnReleaseCommandExp = pDdiTable->pfnReleaseCommandExp;
-    pDdiTable->pfnReleaseCommandExp =
-        ur_validation_layer::urCommandBufferReleaseCommandExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnReleaseCommandExp =
+            ur_validation_layer::urCommandBufferReleaseCommandExp;
+    }
 
     dditable.pfnUpdateKernelLaunchExp = pDdiTable->pfnUpdateKernelLaunchExp;
-    pDdiTable->pfnUpdateKernelLaunchExp =
-        ur_validation_layer::urCommandBufferUpdateKernelLaunchExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnUpdateKernelLaunchExp =
+            ur_validation_layer::urCommandBufferUpdateKernelLaunchExp;
+    }
 
     dditable.pfnUpdateSignalEventExp = pDdiTable->pfnUpdateSignalEventExp;
-    pDdiTable->pfnUpdateSignalEventExp =
-        ur_validation_layer::urCommandBufferUpdateSignalEventExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnUpdateSignalEventExp =
+            ur_validation_layer::urCommandBufferUpdateSignalEventExp;
+    }
 
     dditable.pfnUpdateWaitEventsExp = pDdiTable->pfnUpdateWaitEventsExp;
-    pDdiTable->pfnUpdateWaitEventsExp =
-        ur_validation_layer::urCommandBufferUpdateWaitEventsExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnUpdateWaitEventsExp =
+            ur_validation_layer::urCommandBufferUpdateWaitEventsExp;
+    }
 
     dditable.pfnGetInfoExp = pDdiTable->pfnGetInfoExp;
-    pDdiTable->pfnGetInfoExp = ur_validation_layer::urCommandBufferGetInfoExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGetInfoExp =
+            ur_validation_layer::urCommandBufferGetInfoExp;
+    }
 
     dditable.pfnCommandGetInfoExp = pDdiTable->pfnCommandGetInfoExp;
-    pDdiTable->pfnCommandGetInfoExp =
-        ur_validation_layer::urCommandBufferCommandGetInfoExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnCommandGetInfoExp =
+            ur_validation_layer::urCommandBufferCommandGetInfoExp;
+    }
+
+    dditable.pfnUpdateKernelLaunchBatchExp =
+        pDdiTable->pfnUpdateKernelLaunchBatchExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnUpdateKernelLaunchBatchExp =
+            ur_validation_layer::urCommandBufferUpdateKernelLaunchBatchExp;
+    }
+
+    dditable.pfnUploadExp = pDdiTable->pfnUploadExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnUploadExp = ur_validation_layer::urCommandBufferUploadExp;
+    }
 
     return result;
 }
@@ -10489,44 +11786,57 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
     ur_context_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Context;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Context;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_validation_layer::urContextCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnCreate = ur_validation_layer::urContextCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urContextRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urContextRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urContextRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urContextRelease;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urContextGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urContextGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urContextGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urContextGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urContextCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urContextCreateWithNativeHandle;
+    }
 
     dditable.pfnSetExtendedDeleter = pDdiTable->pfnSetExtendedDeleter;
-    pDdiTable->pfnSetExtendedDeleter =
-        ur_validation_layer::urContextSetExtendedDeleter;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetExtendedDeleter =
+            ur_validation_layer::urContextSetExtendedDeleter;
+    }
 
     return result;
 }
@@ -10544,103 +11854,158 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
     ur_enqueue_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Enqueue;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Enqueue;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnKernelLaunch = pDdiTable->pfnKernelLaunch;
-    pDdiTable->pfnKernelLaunch = ur_validation_layer::urEnqueueKernelLaunch;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnKernelLaunch = ur_validation_layer::urEnqueueKernelLaunch;
+    }
 
     dditable.pfnEventsWait = pDdiTable->pfnEventsWait;
-    pDdiTable->pfnEventsWait = ur_validation_layer::urEnqueueEventsWait;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnEventsWait = ur_validation_layer::urEnqueueEventsWait;
+    }
 
     dditable.pfnEventsWaitWithBarrier = pDdiTable->pfnEventsWaitWithBarrier;
-    pDdiTable->pfnEventsWaitWithBarrier =
-        ur_validation_layer::urEnqueueEventsWaitWithBarrier;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnEventsWaitWithBarrier =
+            ur_validation_layer::urEnqueueEventsWaitWithBarrier;
+    }
 
     dditable.pfnMemBufferRead = pDdiTable->pfnMemBufferRead;
-    pDdiTable->pfnMemBufferRead = ur_validation_layer::urEnqueueMemBufferRead;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferRead =
+            ur_validation_layer::urEnqueueMemBufferRead;
+    }
 
     dditable.pfnMemBufferWrite = pDdiTable->pfnMemBufferWrite;
-    pDdiTable->pfnMemBufferWrite = ur_validation_layer::urEnqueueMemBufferWrite;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferWrite =
+            ur_validation_layer::urEnqueueMemBufferWrite;
+    }
 
     dditable.pfnMemBufferReadRect = pDdiTable->pfnMemBufferReadRect;
-    pDdiTable->pfnMemBufferReadRect =
-        ur_validation_layer::urEnqueueMemBufferReadRect;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferReadRect =
+            ur_validation_layer::urEnqueueMemBufferReadRect;
+    }
 
     dditable.pfnMemBufferWriteRect = pDdiTable->pfnMemBufferWriteRect;
-    pDdiTable->pfnMemBufferWriteRect =
-        ur_validation_layer::urEnqueueMemBufferWriteRect;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferWriteRect =
+            ur_validation_layer::urEnqueueMemBufferWriteRect;
+    }
 
     dditable.pfnMemBufferCopy = pDdiTable->pfnMemBufferCopy;
-    pDdiTable->pfnMemBufferCopy = ur_validation_layer::urEnqueueMemBufferCopy;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferCopy =
+            ur_validation_layer::urEnqueueMemBufferCopy;
+    }
 
     dditable.pfnMemBufferCopyRect = pDdiTable->pfnMemBufferCopyRect;
-    pDdiTable->pfnMemBufferCopyRect =
-        ur_validation_layer::urEnqueueMemBufferCopyRect;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferCopyRect =
+            ur_validation_layer::urEnqueueMemBufferCopyRect;
+    }
 
     dditable.pfnMemBufferFill = pDdiTable->pfnMemBufferFill;
-    pDdiTable->pfnMemBufferFill = ur_validation_layer::urEnqueueMemBufferFill;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferFill =
+            ur_validation_layer::urEnqueueMemBufferFill;
+    }
 
     dditable.pfnMemImageRead = pDdiTable->pfnMemImageRead;
-    pDdiTable->pfnMemImageRead = ur_validation_layer::urEnqueueMemImageRead;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemImageRead = ur_validation_layer::urEnqueueMemImageRead;
+    }
 
     dditable.pfnMemImageWrite = pDdiTable->pfnMemImageWrite;
-    pDdiTable->pfnMemImageWrite = ur_validation_layer::urEnqueueMemImageWrite;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemImageWrite =
+            ur_validation_layer::urEnqueueMemImageWrite;
+    }
 
     dditable.pfnMemImageCopy = pDdiTable->pfnMemImageCopy;
-    pDdiTable->pfnMemImageCopy = ur_validation_layer::urEnqueueMemImageCopy;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemImageCopy = ur_validation_layer::urEnqueueMemImageCopy;
+    }
 
     dditable.pfnMemBufferMap = pDdiTable->pfnMemBufferMap;
-    pDdiTable->pfnMemBufferMap = ur_validation_layer::urEnqueueMemBufferMap;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemBufferMap = ur_validation_layer::urEnqueueMemBufferMap;
+    }
 
     dditable.pfnMemUnmap = pDdiTable->pfnMemUnmap;
-    pDdiTable->pfnMemUnmap = ur_validation_layer::urEnqueueMemUnmap;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMemUnmap = ur_validation_layer::urEnqueueMemUnmap;
+    }
 
     dditable.pfnUSMFill = pDdiTable->pfnUSMFill;
-    pDdiTable->pfnUSMFill = ur_validation_layer::urEnqueueUSMFill;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMFill = ur_validation_layer::urEnqueueUSMFill;
+    }
 
     dditable.pfnUSMMemcpy = pDdiTable->pfnUSMMemcpy;
-    pDdiTable->pfnUSMMemcpy = ur_validation_layer::urEnqueueUSMMemcpy;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMMemcpy = ur_validation_layer::urEnqueueUSMMemcpy;
+    }
 
     dditable.pfnUSMPrefetch = pDdiTable->pfnUSMPrefetch;
-    pDdiTable->pfnUSMPrefetch = ur_validation_layer::urEnqueueUSMPrefetch;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMPrefetch = ur_validation_layer::urEnqueueUSMPrefetch;
+    }
 
     dditable.pfnUSMAdvise = pDdiTable->pfnUSMAdvise;
-    pDdiTable->pfnUSMAdvise = ur_validation_layer::urEnqueueUSMAdvise;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMAdvise = ur_validation_layer::urEnqueueUSMAdvise;
+    }
 
     dditable.pfnUSMFill2D = pDdiTable->pfnUSMFill2D;
-    pDdiTable->pfnUSMFill2D = ur_validation_layer::urEnqueueUSMFill2D;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMFill2D = ur_validation_layer::urEnqueueUSMFill2D;
+    }
 
     dditable.pfnUSMMemcpy2D = pDdiTable->pfnUSMMemcpy2D;
-    pDdiTable->pfnUSMMemcpy2D = ur_validation_layer::urEnqueueUSMMemcpy2D;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMMemcpy2D = ur_validation_layer::urEnqueueUSMMemcpy2D;
+    }
 
     dditable.pfnDeviceGlobalVariableWrite =
         pDdiTable->pfnDeviceGlobalVariableWrite;
-    pDdiTable->pfnDeviceGlobalVariableWrite =
-        ur_validation_layer::urEnqueueDeviceGlobalVariableWrite;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnDeviceGlobalVariableWrite =
+            ur_validation_layer::urEnqueueDeviceGlobalVariableWrite;
+    }
 
     dditable.pfnDeviceGlobalVariableRead =
         pDdiTable->pfnDeviceGlobalVariableRead;
-    pDdiTable->pfnDeviceGlobalVariableRead =
-        ur_validation_layer::urEnqueueDeviceGlobalVariableRead;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnDeviceGlobalVariableRead =
+            ur_validation_layer::urEnqueueDeviceGlobalVariableRead;
+    }
 
     dditable.pfnReadHostPipe = pDdiTable->pfnReadHostPipe;
-    pDdiTable->pfnReadHostPipe = ur_validation_layer::urEnqueueReadHostPipe;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnReadHostPipe = ur_validation_layer::urEnqueueReadHostPipe;
+    }
 
     dditable.pfnWriteHostPipe = pDdiTable->pfnWriteHostPipe;
-    pDdiTable->pfnWriteHostPipe = ur_validation_layer::urEnqueueWriteHostPipe;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnWriteHostPipe =
+            ur_validation_layer::urEnqueueWriteHostPipe;
+    }
 
     return result;
 }
@@ -10658,37 +12023,84 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     ur_enqueue_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.EnqueueExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.EnqueueExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnKernelLaunchCustomExp = pDdiTable->pfnKernelLaunchCustomExp;
-    pDdiTable->pfnKernelLaunchCustomExp =
-        ur_validation_layer::urEnqueueKernelLaunchCustomExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnKernelLaunchCustomExp =
+            ur_validation_layer::urEnqueueKernelLaunchCustomExp;
+    }
 
     dditable.pfnCooperativeKernelLaunchExp =
         pDdiTable->pfnCooperativeKernelLaunchExp;
-    pDdiTable->pfnCooperativeKernelLaunchExp =
-        ur_validation_layer::urEnqueueCooperativeKernelLaunchExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCooperativeKernelLaunchExp =
+            ur_validation_layer::urEnqueueCooperativeKernelLaunchExp;
+    }
 
     dditable.pfnTimestampRecordingExp = pDdiTable->pfnTimestampRecordingExp;
-    pDdiTable->pfnTimestampRecordingExp =
-        ur_validation_layer::urEnqueueTimestampRecordingExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnTimestampRecordingExp =
+            ur_validation_layer::urEnqueueTimestampRecordingExp;
+    }
+
+    dditable.pfnKernelLaunchMultiExp = pDdiTable->pfnKernelLaunchMultiExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnKernelLaunchMultiExp =
+            ur_validation_layer::urEnqueueKernelLaunchMultiExp;
+    }
+
+    dditable.pfnUSMDeviceAllocExp = pDdiTable->pfnUSMDeviceAllocExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMDeviceAllocExp =
+            ur_validation_layer::urEnqueueUSMDeviceAllocExp;
+    }
+
+    dditable.pfnUSMFreeExp = pDdiTable->pfnUSMFreeExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMFreeExp = ur_validation_layer::urEnqueueUSMFreeExp;
+    }
 
     dditable.pfnNativeCommandExp = pDdiTable->pfnNativeCommandExp;
-    pDdiTable->pfnNativeCommandExp =
-        ur_validation_layer::urEnqueueNativeCommandExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnNativeCommandExp =
+            ur_validation_layer::urEnqueueNativeCommandExp;
+    }
+
+    dditable.pfnHostTaskExp = pDdiTable->pfnHostTaskExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnHostTaskExp = ur_validation_layer::urEnqueueHostTaskExp;
+    }
+
+    dditable.pfnIPCEventSignalExp = pDdiTable->pfnIPCEventSignalExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnIPCEventSignalExp =
+            ur_validation_layer::urEnqueueIPCEventSignalExp;
+    }
+
+    dditable.pfnIPCEventWaitExp = pDdiTable->pfnIPCEventWaitExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnIPCEventWaitExp =
+            ur_validation_layer::urEnqueueIPCEventWaitExp;
+    }
+
+    dditable.pfnUSMMemcpyBatchExp = pDdiTable->pfnUSMMemcpyBatchExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUSMMemcpyBatchExp =
+            ur_validation_layer::urEnqueueUSMMemcpyBatchExp;
+    }
 
     return result;
 }
@@ -10706,46 +12118,114 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     ur_event_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Event;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Event;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urEventGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urEventGetInfo;
+    }
 
     dditable.pfnGetProfilingInfo = pDdiTable->pfnGetProfilingInfo;
-    pDdiTable->pfnGetProfilingInfo =
-        ur_validation_layer::urEventGetProfilingInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetProfilingInfo =
+            ur_validation_layer::urEventGetProfilingInfo;
+    }
 
     dditable.pfnWait = pDdiTable->pfnWait;
-    pDdiTable->pfnWait = ur_validation_layer::urEventWait;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnWait = ur_validation_layer::urEventWait;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urEventRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urEventRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urEventRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urEventRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_validation_layer::urEventGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urEventGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urEventCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urEventCreateWithNativeHandle;
+    }
 
     dditable.pfnSetCallback = pDdiTable->pfnSetCallback;
-    pDdiTable->pfnSetCallback = ur_validation_layer::urEventSetCallback;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetCallback = ur_validation_layer::urEventSetCallback;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.EventExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnWaitAnyExp = pDdiTable->pfnWaitAnyExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnWaitAnyExp = ur_validation_layer::urEventWaitAnyExp;
+    }
+
+    dditable.pfnCreateIPCExp = pDdiTable->pfnCreateIPCExp;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateIPCExp = ur_validation_layer::urEventCreateIPCExp;
+    }
+
+    dditable.pfnGetIPCHandleExp = pDdiTable->pfnGetIPCHandleExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetIPCHandleExp =
+            ur_validation_layer::urEventGetIPCHandleExp;
+    }
+
+    dditable.pfnOpenIPCHandleExp = pDdiTable->pfnOpenIPCHandleExp;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnOpenIPCHandleExp =
+            ur_validation_layer::urEventOpenIPCHandleExp;
+    }
 
     return result;
 }
@@ -10763,75 +12243,108 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
     ur_kernel_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Kernel;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Kernel;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_validation_layer::urKernelCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreate = ur_validation_layer::urKernelCreate;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urKernelGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urKernelGetInfo;
+    }
 
     dditable.pfnGetGroupInfo = pDdiTable->pfnGetGroupInfo;
-    pDdiTable->pfnGetGroupInfo = ur_validation_layer::urKernelGetGroupInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetGroupInfo = ur_validation_layer::urKernelGetGroupInfo;
+    }
 
     dditable.pfnGetSubGroupInfo = pDdiTable->pfnGetSubGroupInfo;
-    pDdiTable->pfnGetSubGroupInfo =
-        ur_validation_layer::urKernelGetSubGroupInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetSubGroupInfo =
+            ur_validation_layer::urKernelGetSubGroupInfo;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urKernelRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urKernelRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urKernelRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urKernelRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urKernelGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urKernelGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urKernelCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urKernelCreateWithNativeHandle;
+    }
 
     dditable.pfnGetSuggestedLocalWorkSize =
         pDdiTable->pfnGetSuggestedLocalWorkSize;
-    pDdiTable->pfnGetSuggestedLocalWorkSize =
-        ur_validation_layer::urKernelGetSuggestedLocalWorkSize;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetSuggestedLocalWorkSize =
+            ur_validation_layer::urKernelGetSuggestedLocalWorkSize;
+    }
 
     dditable.pfnSetArgValue = pDdiTable->pfnSetArgValue;
-    pDdiTable->pfnSetArgValue = ur_validation_layer::urKernelSetArgValue;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgValue = ur_validation_layer::urKernelSetArgValue;
+    }
 
     dditable.pfnSetArgLocal = pDdiTable->pfnSetArgLocal;
-    pDdiTable->pfnSetArgLocal = ur_validation_layer::urKernelSetArgLocal;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgLocal = ur_validation_layer::urKernelSetArgLocal;
+    }
 
     dditable.pfnSetArgPointer = pDdiTable->pfnSetArgPointer;
-    pDdiTable->pfnSetArgPointer = ur_validation_layer::urKernelSetArgPointer;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgPointer =
+            ur_validation_layer::urKernelSetArgPointer;
+    }
 
     dditable.pfnSetExecInfo = pDdiTable->pfnSetExecInfo;
-    pDdiTable->pfnSetExecInfo = ur_validation_layer::urKernelSetExecInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetExecInfo = ur_validation_layer::urKernelSetExecInfo;
+    }
 
     dditable.pfnSetArgSampler = pDdiTable->pfnSetArgSampler;
-    pDdiTable->pfnSetArgSampler = ur_validation_layer::urKernelSetArgSampler;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgSampler =
+            ur_validation_layer::urKernelSetArgSampler;
+    }
 
     dditable.pfnSetArgMemObj = pDdiTable->pfnSetArgMemObj;
-    pDdiTable->pfnSetArgMemObj = ur_validation_layer::urKernelSetArgMemObj;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgMemObj = ur_validation_layer::urKernelSetArgMemObj;
+    }
 
     dditable.pfnSetSpecializationConstants =
         pDdiTable->pfnSetSpecializationConstants;
-    pDdiTable->pfnSetSpecializationConstants =
-        ur_validation_layer::urKernelSetSpecializationConstants;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetSpecializationConstants =
+            ur_validation_layer::urKernelSetSpecializationConstants;
+    }
 
     return result;
 }
@@ -10849,16 +12362,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     ur_kernel_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.KernelExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.KernelExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
@@ -10866,8 +12378,15 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
 
     dditable.pfnSuggestMaxCooperativeGroupCountExp =
         pDdiTable->pfnSuggestMaxCooperativeGroupCountExp;
-    pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
-        ur_validation_layer::urKernelSuggestMaxCooperativeGroupCountExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
+            ur_validation_layer::urKernelSuggestMaxCooperativeGroupCountExp;
+    }
+
+    dditable.pfnSetArgsExp = pDdiTable->pfnSetArgsExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetArgsExp = ur_validation_layer::urKernelSetArgsExp;
+    }
 
     return result;
 }
@@ -10885,54 +12404,79 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetMemProcAddrTable(
     ur_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Mem;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Mem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnImageCreate = pDdiTable->pfnImageCreate;
-    pDdiTable->pfnImageCreate = ur_validation_layer::urMemImageCreate;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LEAKS |
+                               INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageCreate = ur_validation_layer::urMemImageCreate;
+    }
 
     dditable.pfnBufferCreate = pDdiTable->pfnBufferCreate;
-    pDdiTable->pfnBufferCreate = ur_validation_layer::urMemBufferCreate;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LEAKS |
+                               INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBufferCreate = ur_validation_layer::urMemBufferCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urMemRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urMemRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urMemRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urMemRelease;
+    }
 
     dditable.pfnBufferPartition = pDdiTable->pfnBufferPartition;
-    pDdiTable->pfnBufferPartition = ur_validation_layer::urMemBufferPartition;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBufferPartition =
+            ur_validation_layer::urMemBufferPartition;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_validation_layer::urMemGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urMemGetNativeHandle;
+    }
 
     dditable.pfnBufferCreateWithNativeHandle =
         pDdiTable->pfnBufferCreateWithNativeHandle;
-    pDdiTable->pfnBufferCreateWithNativeHandle =
-        ur_validation_layer::urMemBufferCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LEAKS |
+                               INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBufferCreateWithNativeHandle =
+            ur_validation_layer::urMemBufferCreateWithNativeHandle;
+    }
 
     dditable.pfnImageCreateWithNativeHandle =
         pDdiTable->pfnImageCreateWithNativeHandle;
-    pDdiTable->pfnImageCreateWithNativeHandle =
-        ur_validation_layer::urMemImageCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LEAKS |
+                               INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageCreateWithNativeHandle =
+            ur_validation_layer::urMemImageCreateWithNativeHandle;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urMemGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urMemGetInfo;
+    }
 
     dditable.pfnImageGetInfo = pDdiTable->pfnImageGetInfo;
-    pDdiTable->pfnImageGetInfo = ur_validation_layer::urMemImageGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImageGetInfo = ur_validation_layer::urMemImageGetInfo;
+    }
 
     return result;
 }
@@ -10950,29 +12494,34 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     ur_physical_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.PhysicalMem;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.PhysicalMem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_validation_layer::urPhysicalMemCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreate = ur_validation_layer::urPhysicalMemCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urPhysicalMemRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urPhysicalMemRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urPhysicalMemRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urPhysicalMemRelease;
+    }
 
     return result;
 }
@@ -10990,41 +12539,53 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     ur_platform_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Platform;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Platform;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGet = pDdiTable->pfnGet;
-    pDdiTable->pfnGet = ur_validation_layer::urPlatformGet;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGet = ur_validation_layer::urPlatformGet;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urPlatformGetInfo;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urPlatformGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urPlatformGetNativeHandle;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urPlatformGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urPlatformCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urPlatformCreateWithNativeHandle;
+    }
 
     dditable.pfnGetApiVersion = pDdiTable->pfnGetApiVersion;
-    pDdiTable->pfnGetApiVersion = ur_validation_layer::urPlatformGetApiVersion;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGetApiVersion =
+            ur_validation_layer::urPlatformGetApiVersion;
+    }
 
     dditable.pfnGetBackendOption = pDdiTable->pfnGetBackendOption;
-    pDdiTable->pfnGetBackendOption =
-        ur_validation_layer::urPlatformGetBackendOption;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnGetBackendOption =
+            ur_validation_layer::urPlatformGetBackendOption;
+    }
 
     return result;
 }
@@ -11042,70 +12603,97 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     ur_program_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Program;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Program;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreateWithIL = pDdiTable->pfnCreateWithIL;
-    pDdiTable->pfnCreateWithIL = ur_validation_layer::urProgramCreateWithIL;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithIL = ur_validation_layer::urProgramCreateWithIL;
+    }
 
     dditable.pfnCreateWithBinary = pDdiTable->pfnCreateWithBinary;
-    pDdiTable->pfnCreateWithBinary =
-        ur_validation_layer::urProgramCreateWithBinary;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithBinary =
+            ur_validation_layer::urProgramCreateWithBinary;
+    }
 
     dditable.pfnBuild = pDdiTable->pfnBuild;
-    pDdiTable->pfnBuild = ur_validation_layer::urProgramBuild;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBuild = ur_validation_layer::urProgramBuild;
+    }
 
     dditable.pfnCompile = pDdiTable->pfnCompile;
-    pDdiTable->pfnCompile = ur_validation_layer::urProgramCompile;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCompile = ur_validation_layer::urProgramCompile;
+    }
 
     dditable.pfnLink = pDdiTable->pfnLink;
-    pDdiTable->pfnLink = ur_validation_layer::urProgramLink;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnLink = ur_validation_layer::urProgramLink;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urProgramRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urProgramRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urProgramRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urProgramRelease;
+    }
 
     dditable.pfnGetFunctionPointer = pDdiTable->pfnGetFunctionPointer;
-    pDdiTable->pfnGetFunctionPointer =
-        ur_validation_layer::urProgramGetFunctionPointer;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetFunctionPointer =
+            ur_validation_layer::urProgramGetFunctionPointer;
+    }
 
     dditable.pfnGetGlobalVariablePointer =
         pDdiTable->pfnGetGlobalVariablePointer;
-    pDdiTable->pfnGetGlobalVariablePointer =
-        ur_validation_layer::urProgramGetGlobalVariablePointer;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetGlobalVariablePointer =
+            ur_validation_layer::urProgramGetGlobalVariablePointer;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urProgramGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urProgramGetInfo;
+    }
 
     dditable.pfnGetBuildInfo = pDdiTable->pfnGetBuildInfo;
-    pDdiTable->pfnGetBuildInfo = ur_validation_layer::urProgramGetBuildInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetBuildInfo = ur_validation_layer::urProgramGetBuildInfo;
+    }
 
     dditable.pfnSetSpecializationConstants =
         pDdiTable->pfnSetSpecializationConstants;
-    pDdiTable->pfnSetSpecializationConstants =
-        ur_validation_layer::urProgramSetSpecializationConstants;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetSpecializationConstants =
+            ur_validation_layer::urProgramSetSpecializationConstants;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urProgramGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urProgramGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urProgramCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urProgramCreateWithNativeHandle;
+    }
 
     return result;
 }
@@ -11123,29 +12711,40 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     ur_program_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.ProgramExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.ProgramExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnBuildExp = pDdiTable->pfnBuildExp;
-    pDdiTable->pfnBuildExp = ur_validation_layer::urProgramBuildExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBuildExp = ur_validation_layer::urProgramBuildExp;
+    }
 
     dditable.pfnCompileExp = pDdiTable->pfnCompileExp;
-    pDdiTable->pfnCompileExp = ur_validation_layer::urProgramCompileExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCompileExp = ur_validation_layer::urProgramCompileExp;
+    }
 
     dditable.pfnLinkExp = pDdiTable->pfnLinkExp;
-    pDdiTable->pfnLinkExp = ur_validation_layer::urProgramLinkExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnLinkExp = ur_validation_layer::urProgramLinkExp;
+    }
+
+    dditable.pfnBuildAsyncExp = pDdiTable->pfnBuildAsyncExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnBuildAsyncExp =
+            ur_validation_layer::urProgramBuildAsyncExp;
+    }
 
     return result;
 }
@@ -11163,45 +12762,102 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     ur_queue_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Queue;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Queue;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urQueueGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urQueueGetInfo;
+    }
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_validation_layer::urQueueCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreate = ur_validation_layer::urQueueCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urQueueRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urQueueRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urQueueRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urQueueRelease;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle = ur_validation_layer::urQueueGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urQueueGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urQueueCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urQueueCreateWithNativeHandle;
+    }
 
     dditable.pfnFinish = pDdiTable->pfnFinish;
-    pDdiTable->pfnFinish = ur_validation_layer::urQueueFinish;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnFinish = ur_validation_layer::urQueueFinish;
+    }
 
     dditable.pfnFlush = pDdiTable->pfnFlush;
-    pDdiTable->pfnFlush = ur_validation_layer::urQueueFlush;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnFlush = ur_validation_layer::urQueueFlush;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.QueueExp;
+
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    dditable.pfnBeginCaptureExp = pDdiTable->pfnBeginCaptureExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnBeginCaptureExp =
+            ur_validation_layer::urQueueBeginCaptureExp;
+    }
+
+    dditable.pfnEndCaptureExp = pDdiTable->pfnEndCaptureExp;
+    if (context->isIntercepted(0)) {
+        pDdiTable->pfnEndCaptureExp = ur_validation_layer::urQueueEndCaptureExp;
+    }
 
     return result;
 }
@@ -11219,40 +12875,51 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     ur_sampler_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Sampler;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Sampler;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnCreate = pDdiTable->pfnCreate;
-    pDdiTable->pfnCreate = ur_validation_layer::urSamplerCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreate = ur_validation_layer::urSamplerCreate;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urSamplerRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urSamplerRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urSamplerRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urSamplerRelease;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urSamplerGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urSamplerGetInfo;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urSamplerGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urSamplerGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urSamplerCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urSamplerCreateWithNativeHandle;
+    }
 
     return result;
 }
@@ -11270,47 +12937,65 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMProcAddrTable(
     ur_usm_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.USM;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.USM;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnHostAlloc = pDdiTable->pfnHostAlloc;
-    pDdiTable->pfnHostAlloc = ur_validation_layer::urUSMHostAlloc;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnHostAlloc = ur_validation_layer::urUSMHostAlloc;
+    }
 
     dditable.pfnDeviceAlloc = pDdiTable->pfnDeviceAlloc;
-    pDdiTable->pfnDeviceAlloc = ur_validation_layer::urUSMDeviceAlloc;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnDeviceAlloc = ur_validation_layer::urUSMDeviceAlloc;
+    }
 
     dditable.pfnSharedAlloc = pDdiTable->pfnSharedAlloc;
-    pDdiTable->pfnSharedAlloc = ur_validation_layer::urUSMSharedAlloc;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSharedAlloc = ur_validation_layer::urUSMSharedAlloc;
+    }
 
     dditable.pfnFree = pDdiTable->pfnFree;
-    pDdiTable->pfnFree = ur_validation_layer::urUSMFree;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnFree = ur_validation_layer::urUSMFree;
+    }
 
     dditable.pfnGetMemAllocInfo = pDdiTable->pfnGetMemAllocInfo;
-    pDdiTable->pfnGetMemAllocInfo = ur_validation_layer::urUSMGetMemAllocInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetMemAllocInfo =
+            ur_validation_layer::urUSMGetMemAllocInfo;
+    }
 
     dditable.pfnPoolCreate = pDdiTable->pfnPoolCreate;
-    pDdiTable->pfnPoolCreate = ur_validation_layer::urUSMPoolCreate;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPoolCreate = ur_validation_layer::urUSMPoolCreate;
+    }
 
     dditable.pfnPoolRetain = pDdiTable->pfnPoolRetain;
-    pDdiTable->pfnPoolRetain = ur_validation_layer::urUSMPoolRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnPoolRetain = ur_validation_layer::urUSMPoolRetain;
+    }
 
     dditable.pfnPoolRelease = pDdiTable->pfnPoolRelease;
-    pDdiTable->pfnPoolRelease = ur_validation_layer::urUSMPoolRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnPoolRelease = ur_validation_layer::urUSMPoolRelease;
+    }
 
     dditable.pfnPoolGetInfo = pDdiTable->pfnPoolGetInfo;
-    pDdiTable->pfnPoolGetInfo = ur_validation_layer::urUSMPoolGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPoolGetInfo = ur_validation_layer::urUSMPoolGetInfo;
+    }
 
     return result;
 }
@@ -11328,29 +13013,51 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     ur_usm_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.USMExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.USMExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnPitchedAllocExp = pDdiTable->pfnPitchedAllocExp;
-    pDdiTable->pfnPitchedAllocExp = ur_validation_layer::urUSMPitchedAllocExp;
+    if (context->isIntercepted(INTERCEPT_BOUNDS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPitchedAllocExp =
+            ur_validation_layer::urUSMPitchedAllocExp;
+    }
+
+    dditable.pfnGrowableAllocExp = pDdiTable->pfnGrowableAllocExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGrowableAllocExp =
+            ur_validation_layer::urUSMGrowableAllocExp;
+    }
+
+    dditable.pfnGrowExp = pDdiTable->pfnGrowExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGrowExp = ur_validation_layer::urUSMGrowExp;
+    }
 
     dditable.pfnImportExp = pDdiTable->pfnImportExp;
-    pDdiTable->pfnImportExp = ur_validation_layer::urUSMImportExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnImportExp = ur_validation_layer::urUSMImportExp;
+    }
 
     dditable.pfnReleaseExp = pDdiTable->pfnReleaseExp;
-    pDdiTable->pfnReleaseExp = ur_validation_layer::urUSMReleaseExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnReleaseExp = ur_validation_layer::urUSMReleaseExp;
+    }
+
+    dditable.pfnPoolTrimExp = pDdiTable->pfnPoolTrimExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPoolTrimExp = ur_validation_layer::urUSMPoolTrimExp;
+    }
 
     return result;
 }
@@ -11368,32 +13075,37 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
     ur_usm_p2p_exp_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.UsmP2PExp;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.UsmP2PExp;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnEnablePeerAccessExp = pDdiTable->pfnEnablePeerAccessExp;
-    pDdiTable->pfnEnablePeerAccessExp =
-        ur_validation_layer::urUsmP2PEnablePeerAccessExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnEnablePeerAccessExp =
+            ur_validation_layer::urUsmP2PEnablePeerAccessExp;
+    }
 
     dditable.pfnDisablePeerAccessExp = pDdiTable->pfnDisablePeerAccessExp;
-    pDdiTable->pfnDisablePeerAccessExp =
-        ur_validation_layer::urUsmP2PDisablePeerAccessExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnDisablePeerAccessExp =
+            ur_validation_layer::urUsmP2PDisablePeerAccessExp;
+    }
 
     dditable.pfnPeerAccessGetInfoExp = pDdiTable->pfnPeerAccessGetInfoExp;
-    pDdiTable->pfnPeerAccessGetInfoExp =
-        ur_validation_layer::urUsmP2PPeerAccessGetInfoExp;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPeerAccessGetInfoExp =
+            ur_validation_layer::urUsmP2PPeerAccessGetInfoExp;
+    }
 
     return result;
 }
@@ -11411,42 +13123,55 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     ur_virtual_mem_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.VirtualMem;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.VirtualMem;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGranularityGetInfo = pDdiTable->pfnGranularityGetInfo;
-    pDdiTable->pfnGranularityGetInfo =
-        ur_validation_layer::urVirtualMemGranularityGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGranularityGetInfo =
+            ur_validation_layer::urVirtualMemGranularityGetInfo;
+    }
 
     dditable.pfnReserve = pDdiTable->pfnReserve;
-    pDdiTable->pfnReserve = ur_validation_layer::urVirtualMemReserve;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnReserve = ur_validation_layer::urVirtualMemReserve;
+    }
 
     dditable.pfnFree = pDdiTable->pfnFree;
-    pDdiTable->pfnFree = ur_validation_layer::urVirtualMemFree;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnFree = ur_validation_layer::urVirtualMemFree;
+    }
 
     dditable.pfnMap = pDdiTable->pfnMap;
-    pDdiTable->pfnMap = ur_validation_layer::urVirtualMemMap;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnMap = ur_validation_layer::urVirtualMemMap;
+    }
 
     dditable.pfnUnmap = pDdiTable->pfnUnmap;
-    pDdiTable->pfnUnmap = ur_validation_layer::urVirtualMemUnmap;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnUnmap = ur_validation_layer::urVirtualMemUnmap;
+    }
 
     dditable.pfnSetAccess = pDdiTable->pfnSetAccess;
-    pDdiTable->pfnSetAccess = ur_validation_layer::urVirtualMemSetAccess;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSetAccess = ur_validation_layer::urVirtualMemSetAccess;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urVirtualMemGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urVirtualMemGetInfo;
+    }
 
     return result;
 }
@@ -11464,50 +13189,67 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
     ur_device_dditable_t
         *pDdiTable ///< [in,out] pointer to table of DDI function pointers
 ) {
-    auto &dditable = ur_validation_layer::getContext()->urDdiTable.Device;
+    auto context = ur_validation_layer::getContext();
+    auto &dditable = context->urDdiTable.Device;
 
     if (nullptr == pDdiTable) {
         return UR_RESULT_ERROR_INVALID_NULL_POINTER;
     }
 
-    if (UR_MAJOR_VERSION(ur_validation_layer::getContext()->version) !=
-            UR_MAJOR_VERSION(version) ||
-        UR_MINOR_VERSION(ur_validation_layer::getContext()->version) >
-            UR_MINOR_VERSION(version)) {
+    if (UR_MAJOR_VERSION(context->version) != UR_MAJOR_VERSION(version) ||
+        UR_MINOR_VERSION(context->version) > UR_MINOR_VERSION(version)) {
         return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
     }
 
     ur_result_t result = UR_RESULT_SUCCESS;
 
     dditable.pfnGet = pDdiTable->pfnGet;
-    pDdiTable->pfnGet = ur_validation_layer::urDeviceGet;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnGet = ur_validation_layer::urDeviceGet;
+    }
 
     dditable.pfnGetInfo = pDdiTable->pfnGetInfo;
-    pDdiTable->pfnGetInfo = ur_validation_layer::urDeviceGetInfo;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetInfo = ur_validation_layer::urDeviceGetInfo;
+    }
 
     dditable.pfnRetain = pDdiTable->pfnRetain;
-    pDdiTable->pfnRetain = ur_validation_layer::urDeviceRetain;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRetain = ur_validation_layer::urDeviceRetain;
+    }
 
     dditable.pfnRelease = pDdiTable->pfnRelease;
-    pDdiTable->pfnRelease = ur_validation_layer::urDeviceRelease;
+    if (context->isIntercepted(INTERCEPT_LEAKS)) {
+        pDdiTable->pfnRelease = ur_validation_layer::urDeviceRelease;
+    }
 
     dditable.pfnPartition = pDdiTable->pfnPartition;
-    pDdiTable->pfnPartition = ur_validation_layer::urDevicePartition;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnPartition = ur_validation_layer::urDevicePartition;
+    }
 
     dditable.pfnSelectBinary = pDdiTable->pfnSelectBinary;
-    pDdiTable->pfnSelectBinary = ur_validation_layer::urDeviceSelectBinary;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnSelectBinary = ur_validation_layer::urDeviceSelectBinary;
+    }
 
     dditable.pfnGetNativeHandle = pDdiTable->pfnGetNativeHandle;
-    pDdiTable->pfnGetNativeHandle =
-        ur_validation_layer::urDeviceGetNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetNativeHandle =
+            ur_validation_layer::urDeviceGetNativeHandle;
+    }
 
     dditable.pfnCreateWithNativeHandle = pDdiTable->pfnCreateWithNativeHandle;
-    pDdiTable->pfnCreateWithNativeHandle =
-        ur_validation_layer::urDeviceCreateWithNativeHandle;
+    if (context->isIntercepted(INTERCEPT_LEAKS | INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnCreateWithNativeHandle =
+            ur_validation_layer::urDeviceCreateWithNativeHandle;
+    }
 
     dditable.pfnGetGlobalTimestamps = pDdiTable->pfnGetGlobalTimestamps;
-    pDdiTable->pfnGetGlobalTimestamps =
-        ur_validation_layer::urDeviceGetGlobalTimestamps;
+    if (context->isIntercepted(INTERCEPT_LIFETIME)) {
+        pDdiTable->pfnGetGlobalTimestamps =
+            ur_validation_layer::urDeviceGetGlobalTimestamps;
+    }
 
     return result;
 }
@@ -11579,6 +13321,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Event);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_validation_layer::urGetEventExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->EventExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetKernelProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Kernel);
@@ -11619,6 +13366,11 @@ ur_result_t context_t::init(ur_dditable_t *dditable,
             UR_API_VERSION_CURRENT, &dditable->Queue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = ur_validation_layer::urGetQueueExpProcAddrTable(
+            UR_API_VERSION_CURRENT, &dditable->QueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = ur_validation_layer::urGetSamplerProcAddrTable(
             UR_API_VERSION_CURRENT, &dditable->Sampler);
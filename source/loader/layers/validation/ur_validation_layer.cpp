@@ -38,12 +38,26 @@ context_t::~context_t() {}
         return result;                                                         \
     }
 
-ur_result_t bounds(ur_mem_handle_t buffer, size_t offset, size_t size) {
+// Buffers created through the layer have their size recorded, others are
+// queried once.
+static ur_result_t getBufferSize(ur_mem_handle_t buffer, size_t &bufferSize) {
+    auto &allocSizes = getContext()->allocSizes;
+    if (allocSizes.findBuffer(buffer, bufferSize)) {
+        return UR_RESULT_SUCCESS;
+    }
+
     auto pfnMemGetInfo = getContext()->urDdiTable.Mem.pfnGetInfo;
+    auto result = pfnMemGetInfo(buffer, UR_MEM_INFO_SIZE, sizeof(bufferSize),
+                                &bufferSize, nullptr);
+    if (result == UR_RESULT_SUCCESS) {
+        allocSizes.insertBuffer(buffer, bufferSize);
+    }
+    return result;
+}
 
+ur_result_t bounds(ur_mem_handle_t buffer, size_t offset, size_t size) {
     size_t bufferSize = 0;
-    RETURN_ON_FAILURE(pfnMemGetInfo(buffer, UR_MEM_INFO_SIZE,
-                                    sizeof(bufferSize), &bufferSize, nullptr));
+    RETURN_ON_FAILURE(getBufferSize(buffer, bufferSize));
 
     if (size + offset > bufferSize) {
         return UR_RESULT_ERROR_INVALID_SIZE;
@@ -54,11 +68,8 @@ ur_result_t bounds(ur_mem_handle_t buffer, size_t offset, size_t size) {
 
 ur_result_t bounds(ur_mem_handle_t buffer, ur_rect_offset_t offset,
                    ur_rect_region_t region) {
-    auto pfnMemGetInfo = getContext()->urDdiTable.Mem.pfnGetInfo;
-
     size_t bufferSize = 0;
-    RETURN_ON_FAILURE(pfnMemGetInfo(buffer, UR_MEM_INFO_SIZE,
-                                    sizeof(bufferSize), &bufferSize, nullptr));
+    RETURN_ON_FAILURE(getBufferSize(buffer, bufferSize));
 
     if (offset.x >= bufferSize || offset.y >= bufferSize ||
         offset.z >= bufferSize) {
@@ -76,6 +87,16 @@ ur_result_t bounds(ur_mem_handle_t buffer, ur_rect_offset_t offset,
 
 ur_result_t bounds(ur_queue_handle_t queue, const void *ptr, size_t offset,
                    size_t size) {
+    // Allocations made through the layer are found without asking the
+    // adapter, from the pointer itself.
+    size_t remaining = 0;
+    if (getContext()->allocSizes.findUSM(ptr, remaining)) {
+        if (size + offset > remaining) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
     auto pfnQueueGetInfo = getContext()->urDdiTable.Queue.pfnGetInfo;
     auto pfnUSMGetMemAllocInfo =
         getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
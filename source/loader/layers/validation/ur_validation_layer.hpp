@@ -11,6 +11,7 @@
  */
 #pragma once
 #include "logger/ur_logger.hpp"
+#include "ur_alloc_size_registry.hpp"
 #include "ur_ddi.h"
 #include "ur_proxy_layer.hpp"
 #include "ur_util.hpp"
@@ -19,6 +20,13 @@ namespace ur_validation_layer {
 
 struct RefCountContext;
 
+// What an intercept does besides parameter validation, which all of them do
+enum intercept_features_t : uint32_t {
+    INTERCEPT_BOUNDS = 1 << 0,
+    INTERCEPT_LEAKS = 1 << 1,
+    INTERCEPT_LIFETIME = 1 << 2,
+};
+
 ///////////////////////////////////////////////////////////////////////////////
 class __urdlllocal context_t : public proxy_layer_context_t,
                                public AtomicSingleton<context_t> {
@@ -43,7 +51,18 @@ class __urdlllocal context_t : public proxy_layer_context_t,
                      codeloc_data codelocData) override;
     ur_result_t tearDown() override;
 
+    /// Whether an intercept doing features has anything to do with the
+    /// enabled ones. If it hasn't, it's left out of the dispatch chain, so
+    /// that the layers below are called directly.
+    bool isIntercepted(uint32_t features) const {
+        return enableParameterValidation ||
+               (enableBoundsChecking && (features & INTERCEPT_BOUNDS)) ||
+               (enableLeakChecking && (features & INTERCEPT_LEAKS)) ||
+               (enableLifetimeValidation && (features & INTERCEPT_LIFETIME));
+    }
+
     std::unique_ptr<RefCountContext> refCountContext;
+    AllocSizeRegistry allocSizes;
 
   private:
     inline static const std::string nameFullValidation =
@@ -34,4 +34,16 @@ std::optional<fs::path> getAdapterNameAsPath(std::string adapterName) {
     return fs::path(adapterName);
 }
 
+std::optional<fs::path> getAdapterLibPath(void *getTableFn) {
+    Dl_info info;
+    if (dladdr(getTableFn, &info) && info.dli_fname) {
+        auto libPath = fs::path(info.dli_fname);
+        if (fs::exists(libPath)) {
+            return fs::absolute(libPath);
+        }
+    }
+
+    return std::nullopt;
+}
+
 } // namespace ur_loader
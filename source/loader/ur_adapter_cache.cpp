@@ -0,0 +1,179 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_adapter_cache.cpp
+ *
+ */
+
+#include <fstream>
+#include <sstream>
+
+#include "logger/ur_logger.hpp"
+#include "ur_adapter_cache.hpp"
+#include "ur_util.hpp"
+
+namespace ur_loader {
+
+static constexpr const char *cacheMagic = "ur-adapter-discovery-cache-v1";
+
+AdapterDiscoveryCache::AdapterDiscoveryCache(fs::path file)
+    : file(std::move(file)) {
+    load();
+}
+
+std::optional<AdapterDiscoveryCache> AdapterDiscoveryCache::fromEnv() {
+    auto path = ur_getenv("UR_ADAPTERS_DISCOVERY_CACHE");
+    if (!path.has_value() || path->empty()) {
+        return std::nullopt;
+    }
+    return AdapterDiscoveryCache(fs::path(*path));
+}
+
+std::string AdapterDiscoveryCache::fingerprint() {
+    std::stringstream ss;
+    ss << UR_API_VERSION_CURRENT;
+    for (auto name : {"UR_ADAPTERS_SEARCH_PATH", "ONEAPI_DEVICE_SELECTOR",
+                      "UR_LOADER_PRELOAD_FILTER"}) {
+        ss << ';' << ur_getenv(name).value_or("");
+    }
+#ifdef __linux__
+    std::ifstream bootId("/proc/sys/kernel/random/boot_id");
+    std::string id;
+    if (bootId >> id) {
+        ss << ';' << id;
+    }
+#endif
+    return std::to_string(std::hash<std::string>{}(ss.str()));
+}
+
+std::optional<AdapterDiscoveryCache::Entry>
+AdapterDiscoveryCache::stat(const fs::path &libPath) {
+    try {
+        Entry entry;
+        entry.path = libPath;
+        entry.size = fs::file_size(libPath);
+        entry.mtime = static_cast<int64_t>(
+            fs::last_write_time(libPath).time_since_epoch().count());
+        return entry;
+    } catch (std::exception &) {
+        return std::nullopt;
+    }
+}
+
+void AdapterDiscoveryCache::load() {
+    std::ifstream in(file);
+    if (!in) {
+        return;
+    }
+
+    std::string magic, print;
+    if (!std::getline(in, magic) || magic != cacheMagic ||
+        !std::getline(in, print) || print != fingerprint()) {
+        logger::debug("adapter discovery cache {} is stale", file.string());
+        dirty = true;
+        return;
+    }
+
+    // <name>\t<path>\t<size>\t<mtime>\t<platforms>
+    std::string line;
+    while (std::getline(in, line)) {
+        std::stringstream ss(line);
+        std::string name, path, size, mtime, platforms;
+        if (!std::getline(ss, name, '\t') || !std::getline(ss, path, '\t') ||
+            !std::getline(ss, size, '\t') || !std::getline(ss, mtime, '\t') ||
+            !std::getline(ss, platforms)) {
+            continue;
+        }
+        try {
+            Entry entry;
+            entry.path = fs::path(path);
+            entry.size = std::stoull(size);
+            entry.mtime = std::stoll(mtime);
+            entry.numPlatforms = std::stoll(platforms);
+            entries[name] = entry;
+        } catch (std::exception &) {
+            dirty = true;
+        }
+    }
+}
+
+std::optional<AdapterDiscoveryCache::Entry>
+AdapterDiscoveryCache::lookup(const std::string &adapterName) const {
+    auto it = entries.find(adapterName);
+    if (it == entries.end()) {
+        return std::nullopt;
+    }
+    auto current = stat(it->second.path);
+    if (!current || current->size != it->second.size ||
+        current->mtime != it->second.mtime) {
+        return std::nullopt;
+    }
+    return it->second;
+}
+
+void AdapterDiscoveryCache::update(const std::string &adapterName,
+                                   const fs::path &libPath) {
+    auto entry = stat(libPath);
+    if (!entry) {
+        return;
+    }
+    auto it = entries.find(adapterName);
+    if (it != entries.end() && it->second.path == entry->path &&
+        it->second.size == entry->size && it->second.mtime == entry->mtime) {
+        return;
+    }
+    entries[adapterName] = *entry;
+    dirty = true;
+}
+
+void AdapterDiscoveryCache::setNumPlatforms(const std::string &adapterName,
+                                            uint32_t count) {
+    auto it = entries.find(adapterName);
+    if (it == entries.end() ||
+        it->second.numPlatforms == static_cast<int64_t>(count)) {
+        return;
+    }
+    it->second.numPlatforms = count;
+    dirty = true;
+}
+
+void AdapterDiscoveryCache::save() {
+    if (!dirty) {
+        return;
+    }
+
+    // Write to a process specific file and rename it over the cache, so that
+    // concurrently starting processes never observe a partial file.
+    auto tmp = file;
+    tmp += "." + std::to_string(ur_getpid()) + ".tmp";
+    {
+        std::ofstream out(tmp, std::ios::trunc);
+        if (!out) {
+            logger::warning("failed to write adapter discovery cache {}",
+                            file.string());
+            return;
+        }
+        out << cacheMagic << '\n' << fingerprint() << '\n';
+        for (const auto &[name, entry] : entries) {
+            out << name << '\t' << entry.path.string() << '\t' << entry.size
+                << '\t' << entry.mtime << '\t' << entry.numPlatforms << '\n';
+        }
+    }
+
+    std::error_code ec;
+    fs::rename(tmp, file, ec);
+    if (ec) {
+        logger::warning("failed to write adapter discovery cache {}: {}",
+                        file.string(), ec.message());
+        fs::remove(tmp, ec);
+        return;
+    }
+    dirty = false;
+}
+
+} // namespace ur_loader
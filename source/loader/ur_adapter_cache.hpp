@@ -0,0 +1,75 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_adapter_cache.hpp
+ *
+ */
+#ifndef UR_ADAPTER_CACHE_HPP
+#define UR_ADAPTER_CACHE_HPP 1
+
+#include <cstdint>
+#include <map>
+#include <optional>
+#include <string>
+
+#include "ur_filesystem_resolved.hpp"
+
+namespace fs = filesystem;
+
+namespace ur_loader {
+
+/// On-disk cache of adapter discovery results, enabled by pointing
+/// UR_ADAPTERS_DISCOVERY_CACHE at a file. For every known adapter it records
+/// the library path that was successfully loaded and how many platforms the
+/// adapter reported, so later processes can skip probing the search paths
+/// and skip adapters which had nothing to offer.
+///
+/// An entry is only trusted while the library it points to keeps its size and
+/// modification time. The whole cache is discarded when the loader version,
+/// the environment affecting discovery or (on Linux) the boot id changes,
+/// the latter to notice driver updates.
+class AdapterDiscoveryCache {
+  public:
+    struct Entry {
+        fs::path path;
+        uintmax_t size = 0;
+        int64_t mtime = 0;
+        /// -1 until the adapter's platforms have been enumerated
+        int64_t numPlatforms = -1;
+    };
+
+    explicit AdapterDiscoveryCache(fs::path file);
+
+    /// Returns the cache selected by UR_ADAPTERS_DISCOVERY_CACHE, if any.
+    static std::optional<AdapterDiscoveryCache> fromEnv();
+
+    /// Returns the entry for adapterName if it is still valid.
+    std::optional<Entry> lookup(const std::string &adapterName) const;
+
+    /// Records the library adapterName was loaded from.
+    void update(const std::string &adapterName, const fs::path &libPath);
+
+    /// Records the number of platforms adapterName reported.
+    void setNumPlatforms(const std::string &adapterName, uint32_t count);
+
+    /// Writes the cache back to disk if it was modified.
+    void save();
+
+  private:
+    static std::string fingerprint();
+    static std::optional<Entry> stat(const fs::path &libPath);
+    void load();
+
+    fs::path file;
+    std::map<std::string, Entry> entries;
+    bool dirty = false;
+};
+
+} // namespace ur_loader
+
+#endif /* UR_ADAPTER_CACHE_HPP */
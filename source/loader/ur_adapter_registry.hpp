@@ -13,7 +13,9 @@
 #include <array>
 
 #include "logger/ur_logger.hpp"
+#include "ur_adapter_cache.hpp"
 #include "ur_adapter_search.hpp"
+#include "ur_startup_timer.hpp"
 #include "ur_util.hpp"
 
 namespace fs = filesystem;
@@ -23,6 +25,7 @@ namespace ur_loader {
 class AdapterRegistry {
   public:
     AdapterRegistry() {
+        startup_timer::scope timer("adapter search");
         std::optional<std::vector<std::string>> forceLoadedAdaptersOpt;
         try {
             forceLoadedAdaptersOpt = getenv_to_vec("UR_ADAPTERS_FORCE_LOAD");
@@ -60,6 +63,7 @@ class AdapterRegistry {
                 }
             }
         } else {
+            discoveryCache = AdapterDiscoveryCache::fromEnv();
             discoverKnownAdapters();
         }
     }
@@ -103,6 +107,12 @@ class AdapterRegistry {
 
     bool adaptersForceLoaded() { return forceLoaded; }
 
+    /// Set when UR_ADAPTERS_DISCOVERY_CACHE is in use, entries are keyed by
+    /// the file name of the adapter's load paths.
+    std::optional<AdapterDiscoveryCache> &getDiscoveryCache() {
+        return discoveryCache;
+    }
+
     std::vector<std::vector<fs::path>>::const_iterator begin() const noexcept {
         return adaptersLoadPaths.begin();
     }
@@ -280,6 +290,20 @@ class AdapterRegistry {
                     continue;
                 }
             }
+            if (discoveryCache.has_value()) {
+                if (auto entry = discoveryCache->lookup(adapterName)) {
+                    if (entry->numPlatforms == 0) {
+                        logger::debug("The adapter '{}' was skipped, it "
+                                      "reported no platforms last time.",
+                                      adapterName);
+                        continue;
+                    }
+                    adaptersLoadPaths.emplace_back(
+                        std::vector{std::move(entry->path)});
+                    continue;
+                }
+            }
+
             std::vector<fs::path> loadPaths;
 
             // Adapter search order:
@@ -309,9 +333,12 @@ class AdapterRegistry {
 
     bool forceLoaded = false;
 
+    std::optional<AdapterDiscoveryCache> discoveryCache;
+
   public:
     void enableMock() {
         adaptersLoadPaths.clear();
+        discoveryCache.reset();
 
         std::vector<fs::path> loadPaths;
         auto adapterNamePath = fs::path{mockAdapterName};
@@ -21,6 +21,8 @@ namespace ur_loader {
 
 std::optional<fs::path> getLoaderLibPath();
 std::optional<fs::path> getAdapterNameAsPath(std::string adapterName);
+/// Returns the absolute path the adapter library was loaded from.
+std::optional<fs::path> getAdapterLibPath(void *getTableFn);
 
 } // namespace ur_loader
 
@@ -54,6 +54,12 @@ __urdlllocal ur_result_t UR_APICALL urAdapterGet(
                 break;
             }
         }
+
+        // initialize the adapters' drivers concurrently
+        if (UR_RESULT_SUCCESS == result) {
+            context->prefetchPlatforms(phAdapters,
+                                       static_cast<uint32_t>(adapterIndex));
+        }
     }
 
     if (pNumAdapters != nullptr) {
@@ -72,6 +78,9 @@ __urdlllocal ur_result_t UR_APICALL urAdapterRelease(
 
     [[maybe_unused]] auto context = getContext();
 
+    // the adapter may destroy its platforms and devices once released
+    context->invalidateEnumeration(hAdapter);
+
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
     auto pfnAdapterRelease = dditable->ur.Global.pfnAdapterRelease;
@@ -205,47 +214,28 @@ __urdlllocal ur_result_t UR_APICALL urPlatformGet(
 
     for (uint32_t adapter_index = 0; adapter_index < NumAdapters;
          adapter_index++) {
-        // extract adapter's function pointer table
-        auto dditable =
-            reinterpret_cast<ur_platform_object_t *>(phAdapters[adapter_index])
-                ->dditable;
-
         if ((0 < NumEntries) && (NumEntries == total_platform_handle_count)) {
             break;
         }
 
-        uint32_t library_platform_handle_count = 0;
-
-        result = dditable->ur.Platform.pfnGet(&phAdapters[adapter_index], 1, 0,
-                                              nullptr,
-                                              &library_platform_handle_count);
+        // the adapter is only asked once, see UR_LOADER_ENUMERATION_CACHE
+        std::vector<ur_platform_handle_t> platforms;
+        result = context->getPlatforms(phAdapters[adapter_index], platforms);
         if (UR_RESULT_SUCCESS != result) {
             break;
         }
 
+        uint32_t library_platform_handle_count =
+            static_cast<uint32_t>(platforms.size());
+
         if (nullptr != phPlatforms && NumEntries != 0) {
             if (total_platform_handle_count + library_platform_handle_count >
                 NumEntries) {
                 library_platform_handle_count =
                     NumEntries - total_platform_handle_count;
             }
-            result = dditable->ur.Platform.pfnGet(
-                &phAdapters[adapter_index], 1, library_platform_handle_count,
-                &phPlatforms[total_platform_handle_count], nullptr);
-            if (UR_RESULT_SUCCESS != result) {
-                break;
-            }
-
-            try {
-                for (uint32_t i = 0; i < library_platform_handle_count; ++i) {
-                    uint32_t platform_index = total_platform_handle_count + i;
-                    phPlatforms[platform_index] =
-                        reinterpret_cast<ur_platform_handle_t>(
-                            context->factories.ur_platform_factory.getInstance(
-                                phPlatforms[platform_index], dditable));
-                }
-            } catch (std::bad_alloc &) {
-                result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+            for (uint32_t i = 0; i < library_platform_handle_count; ++i) {
+                phPlatforms[total_platform_handle_count + i] = platforms[i];
             }
         }
 
@@ -453,34 +443,25 @@ __urdlllocal ur_result_t UR_APICALL urDeviceGet(
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
-
-    // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_platform_object_t *>(hPlatform)->dditable;
-    auto pfnGet = dditable->ur.Device.pfnGet;
-    if (nullptr == pfnGet) {
-        return UR_RESULT_ERROR_UNINITIALIZED;
+    if (0 == NumEntries && nullptr != phDevices) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
     }
 
-    // convert loader handle to platform handle
-    hPlatform = reinterpret_cast<ur_platform_object_t *>(hPlatform)->handle;
-
-    // forward to device-platform
-    result = pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
-
+    // the adapter is only asked once, see UR_LOADER_ENUMERATION_CACHE
+    std::vector<ur_device_handle_t> devices;
+    result = context->getDevices(hPlatform, DeviceType, devices);
     if (UR_RESULT_SUCCESS != result) {
         return result;
     }
 
-    try {
-        // convert platform handles to loader handles
-        for (size_t i = 0; (nullptr != phDevices) && (i < NumEntries); ++i) {
-            phDevices[i] = reinterpret_cast<ur_device_handle_t>(
-                context->factories.ur_device_factory.getInstance(phDevices[i],
-                                                                 dditable));
-        }
-    } catch (std::bad_alloc &) {
-        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    for (size_t i = 0;
+         (nullptr != phDevices) && (i < NumEntries) && (i < devices.size());
+         ++i) {
+        phDevices[i] = devices[i];
+    }
+
+    if (nullptr != pNumDevices) {
+        *pNumDevices = static_cast<uint32_t>(devices.size());
     }
 
     return result;
@@ -6463,6 +6444,83 @@ __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urBindlessImagesImageCopyBatchExp
+__urdlllocal ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    uint32_t numCopyRegions, ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *
+        pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+    ///< must not refer to an element of the phEventWaitList array.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnImageCopyBatchExp =
+        dditable->ur.BindlessImagesExp.pfnImageCopyBatchExp;
+    if (nullptr == pfnImageCopyBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnImageCopyBatchExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+        numEventsInWaitList, phEventWaitListLocal.data(), phEvent);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urBindlessImagesImageGetInfoExp
 __urdlllocal ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
@@ -8664,6 +8722,123 @@ __urdlllocal ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUpdateKernelLaunchBatchExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t
+        numKernelUpdates, ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *
+        phCommands, ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                    ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                            ///< command is to be updated.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
+            ->dditable;
+    auto pfnUpdateKernelLaunchBatchExp =
+        dditable->ur.CommandBufferExp.pfnUpdateKernelLaunchBatchExp;
+    if (nullptr == pfnUpdateKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hCommandBuffer =
+        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
+            ->handle;
+
+    // convert loader handles to platform handles
+    auto phCommandsLocal =
+        std::vector<ur_exp_command_buffer_command_handle_t>(numKernelUpdates);
+    for (size_t i = 0; i < numKernelUpdates; ++i) {
+        phCommandsLocal[i] =
+            reinterpret_cast<ur_exp_command_buffer_command_object_t *>(
+                phCommands[i])
+                ->handle;
+    }
+
+    // Deal with any struct parameters that have handle members we need to convert.
+    auto pUpdateKernelLaunchLocal =
+        std::vector<ur_exp_command_buffer_update_kernel_launch_desc_t>(
+            pUpdateKernelLaunch, pUpdateKernelLaunch + numKernelUpdates);
+    auto pUpdateKernelLaunchpNewMemObjArgList = std::vector<
+        std::vector<ur_exp_command_buffer_update_memobj_arg_desc_t>>(
+        numKernelUpdates);
+    for (size_t i = 0; i < numKernelUpdates; ++i) {
+        auto &UpdateLocal = pUpdateKernelLaunchLocal[i];
+        if (UpdateLocal.hNewKernel) {
+            UpdateLocal.hNewKernel =
+                reinterpret_cast<ur_kernel_object_t *>(UpdateLocal.hNewKernel)
+                    ->handle;
+        }
+
+        for (uint32_t j = 0; j < UpdateLocal.numNewMemObjArgs; j++) {
+            ur_exp_command_buffer_update_memobj_arg_desc_t NewRangeStruct =
+                UpdateLocal.pNewMemObjArgList[j];
+            if (NewRangeStruct.hNewMemObjArg) {
+                NewRangeStruct.hNewMemObjArg =
+                    reinterpret_cast<ur_mem_object_t *>(
+                        NewRangeStruct.hNewMemObjArg)
+                        ->handle;
+            }
+
+            pUpdateKernelLaunchpNewMemObjArgList[i].push_back(NewRangeStruct);
+        }
+        UpdateLocal.pNewMemObjArgList =
+            pUpdateKernelLaunchpNewMemObjArgList[i].data();
+    }
+
+    // forward to device-platform
+    result = pfnUpdateKernelLaunchBatchExp(hCommandBuffer, numKernelUpdates,
+                                           phCommandsLocal.data(),
+                                           pUpdateKernelLaunchLocal.data());
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urCommandBufferUploadExp
+__urdlllocal ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue ///< [in] The queue to upload the command-buffer on.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
+            ->dditable;
+    auto pfnUploadExp = dditable->ur.CommandBufferExp.pfnUploadExp;
+    if (nullptr == pfnUploadExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hCommandBuffer =
+        reinterpret_cast<ur_exp_command_buffer_object_t *>(hCommandBuffer)
+            ->handle;
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnUploadExp(hCommandBuffer, hQueue);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueCooperativeKernelLaunchExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
@@ -8779,6 +8954,53 @@ __urdlllocal ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urKernelSetArgsExp
+__urdlllocal ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_kernel_object_t *>(hKernel)->dditable;
+    auto pfnSetArgsExp = dditable->ur.KernelExp.pfnSetArgsExp;
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hKernel = reinterpret_cast<ur_kernel_object_t *>(hKernel)->handle;
+
+    // Deal with any struct parameters that have handle members we need to convert.
+    std::vector<ur_exp_kernel_arg_t> pArgsLocal(pArgs, pArgs + numArgs);
+    for (auto &Arg : pArgsLocal) {
+        if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ &&
+            Arg.value.memObjTuple.hMem) {
+            Arg.value.memObjTuple.hMem = reinterpret_cast<ur_mem_object_t *>(
+                                             Arg.value.memObjTuple.hMem)
+                                             ->handle;
+        } else if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_SAMPLER) {
+            Arg.value.sampler =
+                reinterpret_cast<ur_sampler_object_t *>(Arg.value.sampler)
+                    ->handle;
+        }
+    }
+
+    // Now that we've converted all the members update the param pointers
+    pArgs = pArgsLocal.data();
+
+    // forward to device-platform
+    result = pfnSetArgsExp(hKernel, numArgs, pArgs);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueTimestampRecordingExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
@@ -8847,6 +9069,40 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventWaitAnyExp
+__urdlllocal ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                         ///< completion of any of
+    uint32_t *pIndex     ///< [out] index in `phEventWaitList` of a completed event
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_event_object_t *>(*phEventWaitList)->dditable;
+    auto pfnWaitAnyExp = dditable->ur.EventExp.pfnWaitAnyExp;
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal = std::vector<ur_event_handle_t>(numEvents);
+    for (size_t i = 0; i < numEvents; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnWaitAnyExp(numEvents, phEventWaitListLocal.data(), pIndex);
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Intercept function for urEnqueueKernelLaunchCustomExp
 __urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
@@ -9047,193 +9303,1016 @@ __urdlllocal ur_result_t UR_APICALL urProgramLinkExp(
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMImportExp
-__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem,                   ///< [in] pointer to host memory object
-    size_t size ///< [in] size in bytes of the host memory object to be imported
+/// @brief Intercept function for urEnqueueKernelLaunchMultiExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
 
-    // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnImportExp = dditable->ur.USMExp.pfnImportExp;
-    if (nullptr == pfnImportExp) {
+    if (0 == numLaunches) {
+        return UR_RESULT_ERROR_INVALID_SIZE;
+    }
+
+    // extract platform's function pointer table, all the queues belonging to
+    // the same adapter
+    auto dditable =
+        reinterpret_cast<ur_queue_object_t *>(pLaunches[0].hQueue)->dditable;
+    auto pfnKernelLaunchMultiExp =
+        dditable->ur.EnqueueExp.pfnKernelLaunchMultiExp;
+    if (nullptr == pfnKernelLaunchMultiExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
-    // convert loader handle to platform handle
-    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+    // Deal with any struct parameters that have handle members we need to convert.
+    std::vector<ur_exp_kernel_launch_t> pLaunchesLocal(
+        pLaunches, pLaunches + numLaunches);
+    std::vector<std::vector<ur_exp_kernel_arg_t>> pArgsLocal(numLaunches);
+    std::vector<std::vector<ur_event_handle_t>> phEventWaitListLocal(
+        numLaunches);
+    // The adapter's events are written here, so that the events of the
+    // launches made before a failing one are still wrapped
+    std::vector<ur_event_handle_t> phEventLocal(numLaunches, nullptr);
+    for (uint32_t i = 0; i < numLaunches; ++i) {
+        auto &Launch = pLaunchesLocal[i];
+        Launch.hQueue =
+            reinterpret_cast<ur_queue_object_t *>(Launch.hQueue)->handle;
+        Launch.hKernel =
+            reinterpret_cast<ur_kernel_object_t *>(Launch.hKernel)->handle;
+
+        if (Launch.pArgs) {
+            pArgsLocal[i].assign(Launch.pArgs, Launch.pArgs + Launch.numArgs);
+            for (auto &Arg : pArgsLocal[i]) {
+                if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_MEM_OBJ &&
+                    Arg.value.memObjTuple.hMem) {
+                    Arg.value.memObjTuple.hMem =
+                        reinterpret_cast<ur_mem_object_t *>(
+                            Arg.value.memObjTuple.hMem)
+                            ->handle;
+                } else if (Arg.type == UR_EXP_KERNEL_ARG_TYPE_SAMPLER) {
+                    Arg.value.sampler =
+                        reinterpret_cast<ur_sampler_object_t *>(
+                            Arg.value.sampler)
+                            ->handle;
+                }
+            }
+            Launch.pArgs = pArgsLocal[i].data();
+        }
+
+        if (Launch.phEventWaitList) {
+            phEventWaitListLocal[i].resize(Launch.numEventsInWaitList);
+            for (uint32_t j = 0; j < Launch.numEventsInWaitList; ++j) {
+                phEventWaitListLocal[i][j] =
+                    reinterpret_cast<ur_event_object_t *>(
+                        Launch.phEventWaitList[j])
+                        ->handle;
+            }
+            Launch.phEventWaitList = phEventWaitListLocal[i].data();
+        }
+
+        if (Launch.phEvent) {
+            Launch.phEvent = &phEventLocal[i];
+        }
+    }
 
     // forward to device-platform
-    result = pfnImportExp(hContext, pMem, size);
+    result = pfnKernelLaunchMultiExp(numLaunches, pLaunchesLocal.data());
+
+    try {
+        for (uint32_t i = 0; i < numLaunches; ++i) {
+            if (nullptr == phEventLocal[i]) {
+                continue;
+            }
+            // convert platform handle to loader handle
+            *pLaunches[i].phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(
+                    phEventLocal[i], dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUSMReleaseExp
-__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem                    ///< [in] pointer to host memory object
+/// @brief Intercept function for urProgramBuildAsyncExp
+__urdlllocal ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
-    auto pfnReleaseExp = dditable->ur.USMExp.pfnReleaseExp;
-    if (nullptr == pfnReleaseExp) {
+    auto dditable = reinterpret_cast<ur_program_object_t *>(hProgram)->dditable;
+    auto pfnBuildAsyncExp = dditable->ur.ProgramExp.pfnBuildAsyncExp;
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hProgram = reinterpret_cast<ur_program_object_t *>(hProgram)->handle;
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnBuildAsyncExp(hProgram, hQueue, pOptions, phEvent);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        *phEvent = reinterpret_cast<ur_event_handle_t>(
+            context->factories.ur_event_factory.getInstance(*phEvent,
+                                                            dditable));
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueBeginCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueBeginCaptureExp(
+    ur_queue_handle_t
+        hQueue ///< [in] handle of the queue to capture the commands of
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnBeginCaptureExp = dditable->ur.QueueExp.pfnBeginCaptureExp;
+    if (nullptr == pfnBeginCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnBeginCaptureExp(hQueue);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urQueueEndCaptureExp
+__urdlllocal ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *
+        phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                        ///< commands
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnEndCaptureExp = dditable->ur.QueueExp.pfnEndCaptureExp;
+    if (nullptr == pfnEndCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // forward to device-platform
+    result = pfnEndCaptureExp(hQueue, phCommandBuffer);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        *phCommandBuffer = reinterpret_cast<ur_exp_command_buffer_handle_t>(
+            context->factories.ur_exp_command_buffer_factory.getInstance(
+                *phCommandBuffer, dditable));
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMDeviceAllocExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be used.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the allocation.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnUSMDeviceAllocExp = dditable->ur.EnqueueExp.pfnUSMDeviceAllocExp;
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList,
+                                  phEventWaitListLocal.data(), ppMem, phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueUSMFreeExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    void *pMem,                   ///< [in] pointer to USM memory object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be freed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the free. If
+    ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnUSMFreeExp = dditable->ur.EnqueueExp.pfnUSMFreeExp;
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList,
+                           phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowableAllocExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t
+        maxSize, ///< [in] size in bytes of the address range reserved for the allocation
+    size_t
+        size, ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem ///< [out] pointer to USM device memory object
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnGrowableAllocExp = dditable->ur.USMExp.pfnGrowableAllocExp;
+    if (nullptr == pfnGrowableAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // convert loader handle to platform handle
+    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+
+    // forward to device-platform
+    result = pfnGrowableAllocExp(hContext, hDevice, maxSize, size, ppMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMGrowExp
+__urdlllocal ur_result_t UR_APICALL urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size ///< [in] size in bytes the allocation must be backed for
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnGrowExp = dditable->ur.USMExp.pfnGrowExp;
+    if (nullptr == pfnGrowExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // forward to device-platform
+    result = pfnGrowExp(hContext, pMem, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMImportExp
+__urdlllocal ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnImportExp = dditable->ur.USMExp.pfnImportExp;
+    if (nullptr == pfnImportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // forward to device-platform
+    result = pfnImportExp(hContext, pMem, size);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMReleaseExp
+__urdlllocal ur_result_t UR_APICALL urUSMReleaseExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem                    ///< [in] pointer to host memory object
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnReleaseExp = dditable->ur.USMExp.pfnReleaseExp;
+    if (nullptr == pfnReleaseExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // forward to device-platform
+    result = pfnReleaseExp(hContext, pMem);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto pfnEnablePeerAccessExp = dditable->ur.UsmP2PExp.pfnEnablePeerAccessExp;
+    if (nullptr == pfnEnablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    commandDevice =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+
+    // convert loader handle to platform handle
+    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+
+    // forward to device-platform
+    result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
+    ur_device_handle_t
+        commandDevice,            ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto pfnDisablePeerAccessExp =
+        dditable->ur.UsmP2PExp.pfnDisablePeerAccessExp;
+    if (nullptr == pfnDisablePeerAccessExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    commandDevice =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+
+    // convert loader handle to platform handle
+    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+
+    // forward to device-platform
+    result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
+__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
+    ur_device_handle_t
+        commandDevice,             ///< [in] handle of the command device object
+    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
+    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
+    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
+    void *
+        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
+                    ///< the info.
+    ///< If propSize is not equal to or greater than the real number of bytes
+    ///< needed to return the info
+    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
+    ///< pPropValue is not used.
+    size_t *
+        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
+    auto pfnPeerAccessGetInfoExp =
+        dditable->ur.UsmP2PExp.pfnPeerAccessGetInfoExp;
+    if (nullptr == pfnPeerAccessGetInfoExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    commandDevice =
+        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+
+    // convert loader handle to platform handle
+    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+
+    // forward to device-platform
+    result = pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
+                                     propSize, pPropValue, pPropSizeRet);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urUSMPoolTrimExp
+__urdlllocal ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t
+        minBytesToKeep ///< [in] number of bytes of free memory which may be left cached
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnPoolTrimExp = dditable->ur.USMExp.pfnPoolTrimExp;
+    if (nullptr == pfnPoolTrimExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
     hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
+    // convert loader handle to platform handle
+    hPool = (hPool) ? reinterpret_cast<ur_usm_pool_object_t *>(hPool)->handle
+                    : nullptr;
+
     // forward to device-platform
-    result = pfnReleaseExp(hContext, pMem);
+    result = pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PEnablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
+/// @brief Intercept function for urEnqueueNativeCommandExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_enqueue_native_command_function_t
+        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
+                          ///< immediately.
+    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
+    uint32_t numMemsInMemList, ///< [in] size of the mem list
+    const ur_mem_handle_t *
+        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
+                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
+    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
+    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
+    const ur_exp_enqueue_native_command_properties_t *
+        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the kernel execution.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the work that has
+    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
+    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnNativeCommandExp = dditable->ur.EnqueueExp.pfnNativeCommandExp;
+    if (nullptr == pfnNativeCommandExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phMemListLocal = std::vector<ur_mem_handle_t>(numMemsInMemList);
+    for (size_t i = 0; i < numMemsInMemList; ++i) {
+        phMemListLocal[i] =
+            reinterpret_cast<ur_mem_object_t *>(phMemList[i])->handle;
+    }
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnNativeCommandExp(
+        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemListLocal.data(),
+        pProperties, numEventsInWaitList, phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEnqueueHostTaskExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_host_task_function_t
+        pfnHostTask, ///< [in] function run on the host once the host task's dependencies
+                     ///< completed
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host task is run.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once pfnHostTask
+                ///< returned.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnHostTaskExp = dditable->ur.EnqueueExp.pfnHostTaskExp;
+    if (nullptr == pfnHostTaskExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
+
+    // forward to device-platform
+    result = pfnHostTaskExp(hQueue, pfnHostTask, pUserData, numEventsInWaitList,
+                            phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventCreateIPCExp
+__urdlllocal ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
     ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
-    auto pfnEnablePeerAccessExp = dditable->ur.UsmP2PExp.pfnEnablePeerAccessExp;
-    if (nullptr == pfnEnablePeerAccessExp) {
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnCreateIPCExp = dditable->ur.EventExp.pfnCreateIPCExp;
+    if (nullptr == pfnCreateIPCExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
+
+    // forward to device-platform
+    result = pfnCreateIPCExp(hContext, hDevice, phEvent);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        *phEvent = reinterpret_cast<ur_event_handle_t>(
+            context->factories.ur_event_factory.getInstance(*phEvent,
+                                                            dditable));
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventGetIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t
+        hEvent, ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *
+        pIPCHandle ///< [out] pointer to the IPC handle of the event
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_event_object_t *>(hEvent)->dditable;
+    auto pfnGetIPCHandleExp = dditable->ur.EventExp.pfnGetIPCHandleExp;
+    if (nullptr == pfnGetIPCHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hEvent = reinterpret_cast<ur_event_object_t *>(hEvent)->handle;
+
+    // forward to device-platform
+    result = pfnGetIPCHandleExp(hEvent, pIPCHandle);
+
+    return result;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Intercept function for urEventOpenIPCHandleExp
+__urdlllocal ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    const ur_exp_ipc_event_handle_t *
+        pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                    ///< another process
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+) {
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    [[maybe_unused]] auto context = getContext();
+
+    // extract platform's function pointer table
+    auto dditable = reinterpret_cast<ur_context_object_t *>(hContext)->dditable;
+    auto pfnOpenIPCHandleExp = dditable->ur.EventExp.pfnOpenIPCHandleExp;
+    if (nullptr == pfnOpenIPCHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    // convert loader handle to platform handle
+    hContext = reinterpret_cast<ur_context_object_t *>(hContext)->handle;
+
+    // convert loader handle to platform handle
+    hDevice = reinterpret_cast<ur_device_object_t *>(hDevice)->handle;
 
     // forward to device-platform
-    result = pfnEnablePeerAccessExp(commandDevice, peerDevice);
+    result = pfnOpenIPCHandleExp(hContext, hDevice, pIPCHandle, phEvent);
+
+    if (UR_RESULT_SUCCESS != result) {
+        return result;
+    }
+
+    try {
+        // convert platform handle to loader handle
+        *phEvent = reinterpret_cast<ur_event_handle_t>(
+            context->factories.ur_event_factory.getInstance(*phEvent,
+                                                            dditable));
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PDisablePeerAccessExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
-    ur_device_handle_t
-        commandDevice,            ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice ///< [in] handle of the peer device object
+/// @brief Intercept function for urEnqueueIPCEventSignalExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to signal
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the IPC event is signaled.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
-    auto pfnDisablePeerAccessExp =
-        dditable->ur.UsmP2PExp.pfnDisablePeerAccessExp;
-    if (nullptr == pfnDisablePeerAccessExp) {
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnIPCEventSignalExp = dditable->ur.EnqueueExp.pfnIPCEventSignalExp;
+    if (nullptr == pfnIPCEventSignalExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    hIPCEvent = reinterpret_cast<ur_event_object_t *>(hIPCEvent)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
 
     // forward to device-platform
-    result = pfnDisablePeerAccessExp(commandDevice, peerDevice);
+    result = pfnIPCEventSignalExp(hQueue, hIPCEvent, numEventsInWaitList,
+                                  phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urUsmP2PPeerAccessGetInfoExp
-__urdlllocal ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
-    ur_device_handle_t
-        commandDevice,             ///< [in] handle of the command device object
-    ur_device_handle_t peerDevice, ///< [in] handle of the peer device object
-    ur_exp_peer_info_t propName,   ///< [in] type of the info to retrieve
-    size_t propSize, ///< [in] the number of bytes pointed to by pPropValue.
-    void *
-        pPropValue, ///< [out][optional][typename(propName, propSize)] array of bytes holding
-                    ///< the info.
-    ///< If propSize is not equal to or greater than the real number of bytes
-    ///< needed to return the info
-    ///< then the ::UR_RESULT_ERROR_INVALID_SIZE error is returned and
-    ///< pPropValue is not used.
-    size_t *
-        pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
+/// @brief Intercept function for urEnqueueIPCEventWaitExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command starts waiting.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once the IPC
+                ///< event was signaled.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
     [[maybe_unused]] auto context = getContext();
 
     // extract platform's function pointer table
-    auto dditable =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->dditable;
-    auto pfnPeerAccessGetInfoExp =
-        dditable->ur.UsmP2PExp.pfnPeerAccessGetInfoExp;
-    if (nullptr == pfnPeerAccessGetInfoExp) {
+    auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
+    auto pfnIPCEventWaitExp = dditable->ur.EnqueueExp.pfnIPCEventWaitExp;
+    if (nullptr == pfnIPCEventWaitExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
-    commandDevice =
-        reinterpret_cast<ur_device_object_t *>(commandDevice)->handle;
+    hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
     // convert loader handle to platform handle
-    peerDevice = reinterpret_cast<ur_device_object_t *>(peerDevice)->handle;
+    hIPCEvent = reinterpret_cast<ur_event_object_t *>(hIPCEvent)->handle;
+
+    // convert loader handles to platform handles
+    auto phEventWaitListLocal =
+        std::vector<ur_event_handle_t>(numEventsInWaitList);
+    for (size_t i = 0; i < numEventsInWaitList; ++i) {
+        phEventWaitListLocal[i] =
+            reinterpret_cast<ur_event_object_t *>(phEventWaitList[i])->handle;
+    }
 
     // forward to device-platform
-    result = pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
-                                     propSize, pPropValue, pPropSizeRet);
+    result = pfnIPCEventWaitExp(hQueue, hIPCEvent, numEventsInWaitList,
+                                phEventWaitListLocal.data(), phEvent);
+
+    // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
+    if (UR_RESULT_SUCCESS != result &&
+        UR_RESULT_ERROR_ADAPTER_SPECIFIC != result) {
+        return result;
+    }
+    try {
+        // convert platform handle to loader handle
+        if (nullptr != phEvent) {
+            *phEvent = reinterpret_cast<ur_event_handle_t>(
+                context->factories.ur_event_factory.getInstance(*phEvent,
+                                                                dditable));
+        }
+    } catch (std::bad_alloc &) {
+        result = UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
 
     return result;
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Intercept function for urEnqueueNativeCommandExp
-__urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
+/// @brief Intercept function for urEnqueueUSMMemcpyBatchExp
+__urdlllocal ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
     ur_queue_handle_t hQueue, ///< [in] handle of the queue object
-    ur_exp_enqueue_native_command_function_t
-        pfnNativeEnqueue, ///< [in] function calling the native underlying API, to be executed
-                          ///< immediately.
-    void *data,                ///< [in][optional] data used by pfnNativeEnqueue
-    uint32_t numMemsInMemList, ///< [in] size of the mem list
-    const ur_mem_handle_t *
-        phMemList, ///< [in][optional][range(0, numMemsInMemList)] mems that are used within
-                   ///< pfnNativeEnqueue using ::urMemGetNativeHandle.
-    ///< If nullptr, the numMemsInMemList must be 0, indicating that no mems
-    ///< are accessed with ::urMemGetNativeHandle within pfnNativeEnqueue.
-    const ur_exp_enqueue_native_command_properties_t *
-        pProperties, ///< [in][optional] pointer to the native enqueue properties
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,       ///< [in] number of blocks to copy
+    void **
+        ppDst, ///< [in][range(0, numCopies)] pointers to the destination USM memory
+               ///< blocks
+    const void **
+        ppSrc, ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *
+        pSizes, ///< [in][range(0, numCopies)] sizes in bytes of the blocks
     uint32_t numEventsInWaitList, ///< [in] size of the event wait list
     const ur_event_handle_t *
         phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
-    ///< events that must be complete before the kernel execution.
-    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
     ur_event_handle_t *
-        phEvent ///< [out][optional] return an event object that identifies the work that has
-    ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
-    ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
+        phEvent ///< [out][optional] return an event object that is complete once all the
+    ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+    ///< phEvent must not refer to an element of the phEventWaitList array.
 ) {
     ur_result_t result = UR_RESULT_SUCCESS;
 
@@ -9241,21 +10320,14 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
 
     // extract platform's function pointer table
     auto dditable = reinterpret_cast<ur_queue_object_t *>(hQueue)->dditable;
-    auto pfnNativeCommandExp = dditable->ur.EnqueueExp.pfnNativeCommandExp;
-    if (nullptr == pfnNativeCommandExp) {
+    auto pfnUSMMemcpyBatchExp = dditable->ur.EnqueueExp.pfnUSMMemcpyBatchExp;
+    if (nullptr == pfnUSMMemcpyBatchExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     // convert loader handle to platform handle
     hQueue = reinterpret_cast<ur_queue_object_t *>(hQueue)->handle;
 
-    // convert loader handles to platform handles
-    auto phMemListLocal = std::vector<ur_mem_handle_t>(numMemsInMemList);
-    for (size_t i = 0; i < numMemsInMemList; ++i) {
-        phMemListLocal[i] =
-            reinterpret_cast<ur_mem_object_t *>(phMemList[i])->handle;
-    }
-
     // convert loader handles to platform handles
     auto phEventWaitListLocal =
         std::vector<ur_event_handle_t>(numEventsInWaitList);
@@ -9265,9 +10337,9 @@ __urdlllocal ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     }
 
     // forward to device-platform
-    result = pfnNativeCommandExp(
-        hQueue, pfnNativeEnqueue, data, numMemsInMemList, phMemListLocal.data(),
-        pProperties, numEventsInWaitList, phEventWaitListLocal.data(), phEvent);
+    result = pfnUSMMemcpyBatchExp(hQueue, blocking, numCopies, ppDst, ppSrc,
+                                  pSizes, numEventsInWaitList,
+                                  phEventWaitListLocal.data(), phEvent);
 
     // In the event of ERROR_ADAPTER_SPECIFIC we should still attempt to wrap any output handles below.
     if (UR_RESULT_SUCCESS != result &&
@@ -9338,8 +10410,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetGlobalProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnAdapterGet = ur_loader::urAdapterGet;
             pDdiTable->pfnAdapterRelease = ur_loader::urAdapterRelease;
@@ -9404,8 +10475,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnUnsampledImageHandleDestroyExp =
                 ur_loader::urBindlessImagesUnsampledImageHandleDestroyExp;
@@ -9421,6 +10491,8 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetBindlessImagesExpProcAddrTable(
                 ur_loader::urBindlessImagesSampledImageCreateExp;
             pDdiTable->pfnImageCopyExp =
                 ur_loader::urBindlessImagesImageCopyExp;
+            pDdiTable->pfnImageCopyBatchExp =
+                ur_loader::urBindlessImagesImageCopyBatchExp;
             pDdiTable->pfnImageGetInfoExp =
                 ur_loader::urBindlessImagesImageGetInfoExp;
             pDdiTable->pfnMipmapGetLevelExp =
@@ -9501,8 +10573,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreateExp = ur_loader::urCommandBufferCreateExp;
             pDdiTable->pfnRetainExp = ur_loader::urCommandBufferRetainExp;
@@ -9546,6 +10617,9 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetCommandBufferExpProcAddrTable(
             pDdiTable->pfnGetInfoExp = ur_loader::urCommandBufferGetInfoExp;
             pDdiTable->pfnCommandGetInfoExp =
                 ur_loader::urCommandBufferCommandGetInfoExp;
+            pDdiTable->pfnUpdateKernelLaunchBatchExp =
+                ur_loader::urCommandBufferUpdateKernelLaunchBatchExp;
+            pDdiTable->pfnUploadExp = ur_loader::urCommandBufferUploadExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -9601,8 +10675,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetContextProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urContextCreate;
             pDdiTable->pfnRetain = ur_loader::urContextRetain;
@@ -9667,8 +10740,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnKernelLaunch = ur_loader::urEnqueueKernelLaunch;
             pDdiTable->pfnEventsWait = ur_loader::urEnqueueEventsWait;
@@ -9756,8 +10828,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnKernelLaunchCustomExp =
                 ur_loader::urEnqueueKernelLaunchCustomExp;
@@ -9765,8 +10836,19 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEnqueueExpProcAddrTable(
                 ur_loader::urEnqueueCooperativeKernelLaunchExp;
             pDdiTable->pfnTimestampRecordingExp =
                 ur_loader::urEnqueueTimestampRecordingExp;
+            pDdiTable->pfnKernelLaunchMultiExp =
+                ur_loader::urEnqueueKernelLaunchMultiExp;
+            pDdiTable->pfnUSMDeviceAllocExp =
+                ur_loader::urEnqueueUSMDeviceAllocExp;
+            pDdiTable->pfnUSMFreeExp = ur_loader::urEnqueueUSMFreeExp;
             pDdiTable->pfnNativeCommandExp =
                 ur_loader::urEnqueueNativeCommandExp;
+            pDdiTable->pfnHostTaskExp = ur_loader::urEnqueueHostTaskExp;
+            pDdiTable->pfnIPCEventSignalExp =
+                ur_loader::urEnqueueIPCEventSignalExp;
+            pDdiTable->pfnIPCEventWaitExp = ur_loader::urEnqueueIPCEventWaitExp;
+            pDdiTable->pfnUSMMemcpyBatchExp =
+                ur_loader::urEnqueueUSMMemcpyBatchExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -9822,8 +10904,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetInfo = ur_loader::urEventGetInfo;
             pDdiTable->pfnGetProfilingInfo = ur_loader::urEventGetProfilingInfo;
@@ -9844,6 +10925,66 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetEventProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's EventExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetEventExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_event_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (ur_loader::getContext()->version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // Load the device-platform DDI tables
+    for (auto &platform : ur_loader::getContext()->platforms) {
+        // statically linked adapter inside of the loader
+        if (platform.handle == nullptr) {
+            continue;
+        }
+
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            continue;
+        }
+        auto getTable = reinterpret_cast<ur_pfnGetEventExpProcAddrTable_t>(
+            ur_loader::LibLoader::getFunctionPtr(
+                platform.handle.get(), "urGetEventExpProcAddrTable"));
+        if (!getTable) {
+            continue;
+        }
+        platform.initStatus = getTable(version, &platform.dditable.ur.EventExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        if (ur_loader::getContext()->intercept_enabled) {
+            // return pointers to loader's DDIs
+            pDdiTable->pfnWaitAnyExp = ur_loader::urEventWaitAnyExp;
+            pDdiTable->pfnCreateIPCExp = ur_loader::urEventCreateIPCExp;
+            pDdiTable->pfnGetIPCHandleExp = ur_loader::urEventGetIPCHandleExp;
+            pDdiTable->pfnOpenIPCHandleExp = ur_loader::urEventOpenIPCHandleExp;
+        } else {
+            // return pointers directly to platform's DDIs
+            *pDdiTable =
+                ur_loader::getContext()->platforms.front().dditable.ur.EventExp;
+        }
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Kernel table
 ///        with current process' addresses
@@ -9888,8 +11029,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urKernelCreate;
             pDdiTable->pfnGetInfo = ur_loader::urKernelGetInfo;
@@ -9965,11 +11105,11 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetKernelExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnSuggestMaxCooperativeGroupCountExp =
                 ur_loader::urKernelSuggestMaxCooperativeGroupCountExp;
+            pDdiTable->pfnSetArgsExp = ur_loader::urKernelSetArgsExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -10025,8 +11165,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnImageCreate = ur_loader::urMemImageCreate;
             pDdiTable->pfnBufferCreate = ur_loader::urMemBufferCreate;
@@ -10095,8 +11234,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPhysicalMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urPhysicalMemCreate;
             pDdiTable->pfnRetain = ur_loader::urPhysicalMemRetain;
@@ -10156,8 +11294,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetPlatformProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet = ur_loader::urPlatformGet;
             pDdiTable->pfnGetInfo = ur_loader::urPlatformGetInfo;
@@ -10222,8 +11359,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreateWithIL = ur_loader::urProgramCreateWithIL;
             pDdiTable->pfnCreateWithBinary =
@@ -10299,12 +11435,12 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetProgramExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnBuildExp = ur_loader::urProgramBuildExp;
             pDdiTable->pfnCompileExp = ur_loader::urProgramCompileExp;
             pDdiTable->pfnLinkExp = ur_loader::urProgramLinkExp;
+            pDdiTable->pfnBuildAsyncExp = ur_loader::urProgramBuildAsyncExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable = ur_loader::getContext()
@@ -10360,8 +11496,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGetInfo = ur_loader::urQueueGetInfo;
             pDdiTable->pfnCreate = ur_loader::urQueueCreate;
@@ -10382,6 +11517,64 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueProcAddrTable(
     return result;
 }
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Exported function for filling application's QueueExp table
+///        with current process' addresses
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_VERSION
+UR_DLLEXPORT ur_result_t UR_APICALL urGetQueueExpProcAddrTable(
+    ur_api_version_t version, ///< [in] API version requested
+    ur_queue_exp_dditable_t
+        *pDdiTable ///< [in,out] pointer to table of DDI function pointers
+) {
+    if (nullptr == pDdiTable) {
+        return UR_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    if (ur_loader::getContext()->version < version) {
+        return UR_RESULT_ERROR_UNSUPPORTED_VERSION;
+    }
+
+    ur_result_t result = UR_RESULT_SUCCESS;
+
+    // Load the device-platform DDI tables
+    for (auto &platform : ur_loader::getContext()->platforms) {
+        // statically linked adapter inside of the loader
+        if (platform.handle == nullptr) {
+            continue;
+        }
+
+        if (platform.initStatus != UR_RESULT_SUCCESS) {
+            continue;
+        }
+        auto getTable = reinterpret_cast<ur_pfnGetQueueExpProcAddrTable_t>(
+            ur_loader::LibLoader::getFunctionPtr(
+                platform.handle.get(), "urGetQueueExpProcAddrTable"));
+        if (!getTable) {
+            continue;
+        }
+        platform.initStatus = getTable(version, &platform.dditable.ur.QueueExp);
+    }
+
+    if (UR_RESULT_SUCCESS == result) {
+        if (ur_loader::getContext()->intercept_enabled) {
+            // return pointers to loader's DDIs
+            pDdiTable->pfnBeginCaptureExp = ur_loader::urQueueBeginCaptureExp;
+            pDdiTable->pfnEndCaptureExp = ur_loader::urQueueEndCaptureExp;
+        } else {
+            // return pointers directly to platform's DDIs
+            *pDdiTable =
+                ur_loader::getContext()->platforms.front().dditable.ur.QueueExp;
+        }
+    }
+
+    return result;
+}
+
 ///////////////////////////////////////////////////////////////////////////////
 /// @brief Exported function for filling application's Sampler table
 ///        with current process' addresses
@@ -10426,8 +11619,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetSamplerProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnCreate = ur_loader::urSamplerCreate;
             pDdiTable->pfnRetain = ur_loader::urSamplerRetain;
@@ -10490,8 +11682,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnHostAlloc = ur_loader::urUSMHostAlloc;
             pDdiTable->pfnDeviceAlloc = ur_loader::urUSMDeviceAlloc;
@@ -10556,12 +11747,14 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUSMExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnPitchedAllocExp = ur_loader::urUSMPitchedAllocExp;
+            pDdiTable->pfnGrowableAllocExp = ur_loader::urUSMGrowableAllocExp;
+            pDdiTable->pfnGrowExp = ur_loader::urUSMGrowExp;
             pDdiTable->pfnImportExp = ur_loader::urUSMImportExp;
             pDdiTable->pfnReleaseExp = ur_loader::urUSMReleaseExp;
+            pDdiTable->pfnPoolTrimExp = ur_loader::urUSMPoolTrimExp;
         } else {
             // return pointers directly to platform's DDIs
             *pDdiTable =
@@ -10617,8 +11810,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetUsmP2PExpProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnEnablePeerAccessExp =
                 ur_loader::urUsmP2PEnablePeerAccessExp;
@@ -10682,8 +11874,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetVirtualMemProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGranularityGetInfo =
                 ur_loader::urVirtualMemGranularityGetInfo;
@@ -10748,8 +11939,7 @@ UR_DLLEXPORT ur_result_t UR_APICALL urGetDeviceProcAddrTable(
     }
 
     if (UR_RESULT_SUCCESS == result) {
-        if (ur_loader::getContext()->platforms.size() != 1 ||
-            ur_loader::getContext()->forceIntercept) {
+        if (ur_loader::getContext()->intercept_enabled) {
             // return pointers to loader's DDIs
             pDdiTable->pfnGet = ur_loader::urDeviceGet;
             pDdiTable->pfnGetInfo = ur_loader::urDeviceGetInfo;
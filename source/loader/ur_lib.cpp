@@ -72,14 +72,19 @@ __urdlllocal ur_result_t context_t::Init(
         ur_loader::getContext()->adapter_registry.enableMock();
     }
 
+    ur_loader::startup_timer::scope timer("urLoaderInit");
     ur_result_t result;
     const char *logger_name = "loader";
     logger::init(logger_name);
     logger::debug("Logger {} initialized successfully!", logger_name);
 
-    result = ur_loader::getContext()->init();
+    {
+        ur_loader::startup_timer::scope timer("adapter loading");
+        result = ur_loader::getContext()->init();
+    }
 
     if (UR_RESULT_SUCCESS == result) {
+        ur_loader::startup_timer::scope timer("ddi tables");
         result = ddiInit();
     }
 
@@ -89,9 +94,18 @@ __urdlllocal ur_result_t context_t::Init(
     }
 
     if (!enabledLayerNames.empty()) {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+        // The entry points call into the adapter directly, there is no DDI
+        // table for the layers to intercept.
+        logger::warning("layers are unavailable with direct dispatch to the "
+                        "static Level Zero adapter, ignoring them");
+#else
+        ur_loader::startup_timer::scope timer("layers");
         initLayers();
+#endif
     }
 
+    ur_loader::startup_timer::get().flush();
     return result;
 }
 
@@ -218,6 +232,17 @@ ur_result_t urLoaderTearDown() {
     return result;
 }
 
+ur_result_t urLoaderInvalidateEnumerationCacheExp() {
+    // the loader context only has platforms once urLoaderInit succeeded
+    auto context = ur_loader::getContext();
+    if (context->platforms.empty()) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    context->invalidateEnumeration();
+    return UR_RESULT_SUCCESS;
+}
+
 ur_result_t
 urLoaderConfigSetCodeLocationCallback(ur_loader_config_handle_t hLoaderConfig,
                                       ur_code_location_callback_t pfnCodeloc,
@@ -26,6 +26,9 @@
 #if UR_ENABLE_SANITIZER
 #include "sanitizer/ur_sanitizer_layer.hpp"
 #endif
+#ifdef UR_STATIC_DIRECT_DISPATCH
+#include "adapters/level_zero/ur_interface_loader.hpp"
+#endif
 
 #include <atomic>
 #include <mutex>
@@ -130,6 +133,7 @@ ur_result_t urLoaderConfigEnableLayer(ur_loader_config_handle_t hLoaderConfig,
 ur_result_t UR_APICALL urLoaderInit(ur_device_init_flags_t device_flags,
                                     ur_loader_config_handle_t);
 ur_result_t urLoaderTearDown();
+ur_result_t urLoaderInvalidateEnumerationCacheExp();
 ur_result_t
 urLoaderConfigSetCodeLocationCallback(ur_loader_config_handle_t hLoaderConfig,
                                       ur_code_location_callback_t pfnCodeloc,
@@ -306,12 +306,16 @@ ur_result_t UR_APICALL urAdapterGet(
     uint32_t *
         pNumAdapters ///< [out][optional] returns the total number of adapters available.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urAdapterGet(NumEntries, phAdapters, pNumAdapters);
+#else
     auto pfnAdapterGet = ur_lib::getContext()->urDdiTable.Global.pfnAdapterGet;
     if (nullptr == pfnAdapterGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnAdapterGet(NumEntries, phAdapters, pNumAdapters);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -335,6 +339,9 @@ ur_result_t UR_APICALL urAdapterGet(
 ur_result_t UR_APICALL urAdapterRelease(
     ur_adapter_handle_t hAdapter ///< [in][release] Adapter handle to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urAdapterRelease(hAdapter);
+#else
     auto pfnAdapterRelease =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterRelease;
     if (nullptr == pfnAdapterRelease) {
@@ -342,6 +349,7 @@ ur_result_t UR_APICALL urAdapterRelease(
     }
 
     return pfnAdapterRelease(hAdapter);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -362,6 +370,9 @@ ur_result_t UR_APICALL urAdapterRelease(
 ur_result_t UR_APICALL urAdapterRetain(
     ur_adapter_handle_t hAdapter ///< [in][retain] Adapter handle to retain
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urAdapterRetain(hAdapter);
+#else
     auto pfnAdapterRetain =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterRetain;
     if (nullptr == pfnAdapterRetain) {
@@ -369,6 +380,7 @@ ur_result_t UR_APICALL urAdapterRetain(
     }
 
     return pfnAdapterRetain(hAdapter);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -425,6 +437,9 @@ ur_result_t UR_APICALL urAdapterGetLastError(
         pError ///< [out] pointer to an integer where the adapter specific error code will
                ///< be stored.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urAdapterGetLastError(hAdapter, ppMessage, pError);
+#else
     auto pfnAdapterGetLastError =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterGetLastError;
     if (nullptr == pfnAdapterGetLastError) {
@@ -432,6 +447,7 @@ ur_result_t UR_APICALL urAdapterGetLastError(
     }
 
     return pfnAdapterGetLastError(hAdapter, ppMessage, pError);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -451,7 +467,7 @@ ur_result_t UR_APICALL urAdapterGetLastError(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hAdapter`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_ADAPTER_INFO_REFERENCE_COUNT < propName`
+///         + `::UR_ADAPTER_INFO_PERF_COUNTERS < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -475,6 +491,10 @@ ur_result_t UR_APICALL urAdapterGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPropValue.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urAdapterGetInfo(hAdapter, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnAdapterGetInfo =
         ur_lib::getContext()->urDdiTable.Global.pfnAdapterGetInfo;
     if (nullptr == pfnAdapterGetInfo) {
@@ -483,6 +503,7 @@ ur_result_t UR_APICALL urAdapterGetInfo(
 
     return pfnAdapterGetInfo(hAdapter, propName, propSize, pPropValue,
                              pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -525,6 +546,10 @@ ur_result_t UR_APICALL urPlatformGet(
     uint32_t *
         pNumPlatforms ///< [out][optional] returns the total number of platforms available.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformGet(phAdapters, NumAdapters, NumEntries,
+                                         phPlatforms, pNumPlatforms);
+#else
     auto pfnGet = ur_lib::getContext()->urDdiTable.Platform.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -532,6 +557,7 @@ ur_result_t UR_APICALL urPlatformGet(
 
     return pfnGet(phAdapters, NumAdapters, NumEntries, phPlatforms,
                   pNumPlatforms);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -580,12 +606,17 @@ ur_result_t UR_APICALL urPlatformGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual number of bytes being queried by pPlatformInfo.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformGetInfo(hPlatform, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Platform.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hPlatform, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -610,6 +641,9 @@ ur_result_t UR_APICALL urPlatformGetApiVersion(
     ur_platform_handle_t hPlatform, ///< [in] handle of the platform
     ur_api_version_t *pVersion      ///< [out] api version
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformGetApiVersion(hPlatform, pVersion);
+#else
     auto pfnGetApiVersion =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetApiVersion;
     if (nullptr == pfnGetApiVersion) {
@@ -617,6 +651,7 @@ ur_result_t UR_APICALL urPlatformGetApiVersion(
     }
 
     return pfnGetApiVersion(hPlatform, pVersion);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -649,6 +684,10 @@ ur_result_t UR_APICALL urPlatformGetNativeHandle(
     ur_native_handle_t *
         phNativePlatform ///< [out] a pointer to the native handle of the platform.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformGetNativeHandle(hPlatform,
+                                                     phNativePlatform);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -656,6 +695,7 @@ ur_result_t UR_APICALL urPlatformGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hPlatform, phNativePlatform);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -690,6 +730,12 @@ ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
     ur_platform_handle_t *
         phPlatform ///< [out] pointer to the handle of the platform object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformCreateWithNativeHandle(hNativePlatform,
+                                                            hAdapter,
+                                                            pProperties,
+                                                            phPlatform);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Platform.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -698,6 +744,7 @@ ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativePlatform, hAdapter, pProperties,
                                      phPlatform);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -735,6 +782,11 @@ ur_result_t UR_APICALL urPlatformGetBackendOption(
         ppPlatformOption ///< [out] returns the correct platform specific compiler option based on
                          ///< the frontend option.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPlatformGetBackendOption(hPlatform,
+                                                      pFrontendOption,
+                                                      ppPlatformOption);
+#else
     auto pfnGetBackendOption =
         ur_lib::getContext()->urDdiTable.Platform.pfnGetBackendOption;
     if (nullptr == pfnGetBackendOption) {
@@ -742,6 +794,7 @@ ur_result_t UR_APICALL urPlatformGetBackendOption(
     }
 
     return pfnGetBackendOption(hPlatform, pFrontendOption, ppPlatformOption);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -793,12 +846,17 @@ ur_result_t UR_APICALL urDeviceGet(
     uint32_t *pNumDevices ///< [out][optional] pointer to the number of devices.
     ///< pNumDevices will be updated with the total number of devices available.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceGet(hPlatform, DeviceType, NumEntries,
+                                       phDevices, pNumDevices);
+#else
     auto pfnGet = ur_lib::getContext()->urDdiTable.Device.pfnGet;
     if (nullptr == pfnGet) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGet(hPlatform, DeviceType, NumEntries, phDevices, pNumDevices);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -868,7 +926,7 @@ ur_result_t UR_APICALL urDeviceGetSelected(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hDevice`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP < propName`
+///         + `::UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -894,12 +952,17 @@ ur_result_t UR_APICALL urDeviceGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceGetInfo(hDevice, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Device.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hDevice, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -934,12 +997,16 @@ ur_result_t UR_APICALL urDeviceRetain(
     ur_device_handle_t
         hDevice ///< [in][retain] handle of the device to get a reference of.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceRetain(hDevice);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Device.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -971,12 +1038,16 @@ ur_result_t UR_APICALL urDeviceRelease(
     ur_device_handle_t
         hDevice ///< [in][release] handle of the device to release.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceRelease(hDevice);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Device.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1022,6 +1093,10 @@ ur_result_t UR_APICALL urDevicePartition(
         pNumDevicesRet ///< [out][optional] pointer to the number of sub-devices the device can be
     ///< partitioned into according to the partitioning property.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDevicePartition(hDevice, pProperties, NumDevices,
+                                             phSubDevices, pNumDevicesRet);
+#else
     auto pfnPartition = ur_lib::getContext()->urDdiTable.Device.pfnPartition;
     if (nullptr == pfnPartition) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1029,6 +1104,7 @@ ur_result_t UR_APICALL urDevicePartition(
 
     return pfnPartition(hDevice, pProperties, NumDevices, phSubDevices,
                         pNumDevicesRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1071,6 +1147,10 @@ ur_result_t UR_APICALL urDeviceSelectBinary(
         pSelectedBinary ///< [out] the index of the selected binary in the input array of binaries.
     ///< If a suitable binary was not found the function returns ::UR_RESULT_ERROR_INVALID_BINARY.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceSelectBinary(hDevice, pBinaries, NumBinaries,
+                                                pSelectedBinary);
+#else
     auto pfnSelectBinary =
         ur_lib::getContext()->urDdiTable.Device.pfnSelectBinary;
     if (nullptr == pfnSelectBinary) {
@@ -1078,6 +1158,7 @@ ur_result_t UR_APICALL urDeviceSelectBinary(
     }
 
     return pfnSelectBinary(hDevice, pBinaries, NumBinaries, pSelectedBinary);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1110,6 +1191,9 @@ ur_result_t UR_APICALL urDeviceGetNativeHandle(
     ur_native_handle_t
         *phNativeDevice ///< [out] a pointer to the native handle of the device.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceGetNativeHandle(hDevice, phNativeDevice);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Device.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1117,6 +1201,7 @@ ur_result_t UR_APICALL urDeviceGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hDevice, phNativeDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1151,6 +1236,11 @@ ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
     ur_device_handle_t
         *phDevice ///< [out] pointer to the handle of the device object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceCreateWithNativeHandle(hNativeDevice,
+                                                          hAdapter, pProperties,
+                                                          phDevice);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Device.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1159,6 +1249,7 @@ ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeDevice, hAdapter, pProperties,
                                      phDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1191,6 +1282,11 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
         pHostTimestamp ///< [out][optional] pointer to the Host's global timestamp that
                        ///< correlates with the Device's global timestamp value
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urDeviceGetGlobalTimestamps(hDevice,
+                                                       pDeviceTimestamp,
+                                                       pHostTimestamp);
+#else
     auto pfnGetGlobalTimestamps =
         ur_lib::getContext()->urDdiTable.Device.pfnGetGlobalTimestamps;
     if (nullptr == pfnGetGlobalTimestamps) {
@@ -1198,6 +1294,7 @@ ur_result_t UR_APICALL urDeviceGetGlobalTimestamps(
     }
 
     return pfnGetGlobalTimestamps(hDevice, pDeviceTimestamp, pHostTimestamp);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1241,12 +1338,17 @@ ur_result_t UR_APICALL urContextCreate(
     ur_context_handle_t
         *phContext ///< [out] pointer to handle of context object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextCreate(DeviceCount, phDevices, pProperties,
+                                           phContext);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Context.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(DeviceCount, phDevices, pProperties, phContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1277,12 +1379,16 @@ ur_result_t UR_APICALL urContextRetain(
     ur_context_handle_t
         hContext ///< [in][retain] handle of the context to get a reference of.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextRetain(hContext);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Context.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1310,12 +1416,16 @@ ur_result_t UR_APICALL urContextRelease(
     ur_context_handle_t
         hContext ///< [in][release] handle of the context to release.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextRelease(hContext);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Context.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1339,7 +1449,7 @@ ur_result_t UR_APICALL urContextRelease(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hContext`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_CONTEXT_INFO_ATOMIC_FENCE_SCOPE_CAPABILITIES < propName`
+///         + `::UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -1366,12 +1476,17 @@ ur_result_t UR_APICALL urContextGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextGetInfo(hContext, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Context.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hContext, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1404,6 +1519,9 @@ ur_result_t UR_APICALL urContextGetNativeHandle(
     ur_native_handle_t *
         phNativeContext ///< [out] a pointer to the native handle of the context.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextGetNativeHandle(hContext, phNativeContext);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Context.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1411,6 +1529,7 @@ ur_result_t UR_APICALL urContextGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hContext, phNativeContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1449,6 +1568,13 @@ ur_result_t UR_APICALL urContextCreateWithNativeHandle(
     ur_context_handle_t *
         phContext ///< [out] pointer to the handle of the context object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextCreateWithNativeHandle(hNativeContext,
+                                                           hAdapter, numDevices,
+                                                           phDevices,
+                                                           pProperties,
+                                                           phContext);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Context.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -1457,6 +1583,7 @@ ur_result_t UR_APICALL urContextCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeContext, hAdapter, numDevices,
                                      phDevices, pProperties, phContext);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1490,6 +1617,10 @@ ur_result_t UR_APICALL urContextSetExtendedDeleter(
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urContextSetExtendedDeleter(hContext, pfnDeleter,
+                                                       pUserData);
+#else
     auto pfnSetExtendedDeleter =
         ur_lib::getContext()->urDdiTable.Context.pfnSetExtendedDeleter;
     if (nullptr == pfnSetExtendedDeleter) {
@@ -1497,6 +1628,7 @@ ur_result_t UR_APICALL urContextSetExtendedDeleter(
     }
 
     return pfnSetExtendedDeleter(hContext, pfnDeleter, pUserData);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1561,6 +1693,10 @@ ur_result_t UR_APICALL urMemImageCreate(
     void *pHost,           ///< [in][optional] pointer to the buffer data
     ur_mem_handle_t *phMem ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemImageCreate(hContext, flags, pImageFormat,
+                                            pImageDesc, pHost, phMem);
+#else
     auto pfnImageCreate = ur_lib::getContext()->urDdiTable.Mem.pfnImageCreate;
     if (nullptr == pfnImageCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1568,6 +1704,7 @@ ur_result_t UR_APICALL urMemImageCreate(
 
     return pfnImageCreate(hContext, flags, pImageFormat, pImageDesc, pHost,
                           phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1613,12 +1750,17 @@ ur_result_t UR_APICALL urMemBufferCreate(
     ur_mem_handle_t
         *phBuffer ///< [out] pointer to handle of the memory buffer created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemBufferCreate(hContext, flags, size, pProperties,
+                                             phBuffer);
+#else
     auto pfnBufferCreate = ur_lib::getContext()->urDdiTable.Mem.pfnBufferCreate;
     if (nullptr == pfnBufferCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBufferCreate(hContext, flags, size, pProperties, phBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1649,12 +1791,16 @@ ur_result_t UR_APICALL urMemRetain(
     ur_mem_handle_t
         hMem ///< [in][retain] handle of the memory object to get access
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemRetain(hMem);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Mem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1680,12 +1826,16 @@ ur_result_t UR_APICALL urMemRelease(
     ur_mem_handle_t
         hMem ///< [in][release] handle of the memory object to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemRelease(hMem);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Mem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1729,6 +1879,11 @@ ur_result_t UR_APICALL urMemBufferPartition(
     ur_mem_handle_t
         *phMem ///< [out] pointer to the handle of sub buffer created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemBufferPartition(hBuffer, flags,
+                                                bufferCreateType, pRegion,
+                                                phMem);
+#else
     auto pfnBufferPartition =
         ur_lib::getContext()->urDdiTable.Mem.pfnBufferPartition;
     if (nullptr == pfnBufferPartition) {
@@ -1736,6 +1891,7 @@ ur_result_t UR_APICALL urMemBufferPartition(
     }
 
     return pfnBufferPartition(hBuffer, flags, bufferCreateType, pRegion, phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1774,6 +1930,9 @@ ur_result_t UR_APICALL urMemGetNativeHandle(
     ur_native_handle_t
         *phNativeMem ///< [out] a pointer to the native handle of the mem.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemGetNativeHandle(hMem, hDevice, phNativeMem);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -1781,6 +1940,7 @@ ur_result_t UR_APICALL urMemGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hMem, hDevice, phNativeMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1813,6 +1973,12 @@ ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of buffer memory object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemBufferCreateWithNativeHandle(hNativeMem,
+                                                             hContext,
+                                                             pProperties,
+                                                             phMem);
+#else
     auto pfnBufferCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnBufferCreateWithNativeHandle;
     if (nullptr == pfnBufferCreateWithNativeHandle) {
@@ -1821,6 +1987,7 @@ ur_result_t UR_APICALL urMemBufferCreateWithNativeHandle(
 
     return pfnBufferCreateWithNativeHandle(hNativeMem, hContext, pProperties,
                                            phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1858,6 +2025,13 @@ ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
     ur_mem_handle_t
         *phMem ///< [out] pointer to handle of image memory object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemImageCreateWithNativeHandle(hNativeMem,
+                                                            hContext,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            pProperties, phMem);
+#else
     auto pfnImageCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Mem.pfnImageCreateWithNativeHandle;
     if (nullptr == pfnImageCreateWithNativeHandle) {
@@ -1866,6 +2040,7 @@ ur_result_t UR_APICALL urMemImageCreateWithNativeHandle(
 
     return pfnImageCreateWithNativeHandle(hNativeMem, hContext, pImageFormat,
                                           pImageDesc, pProperties, phMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1915,12 +2090,17 @@ ur_result_t UR_APICALL urMemGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemGetInfo(hMemory, propName, propSize, pPropValue,
+                                        pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Mem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hMemory, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -1969,6 +2149,10 @@ ur_result_t UR_APICALL urMemImageGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urMemImageGetInfo(hMemory, propName, propSize,
+                                             pPropValue, pPropSizeRet);
+#else
     auto pfnImageGetInfo = ur_lib::getContext()->urDdiTable.Mem.pfnImageGetInfo;
     if (nullptr == pfnImageGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -1976,6 +2160,7 @@ ur_result_t UR_APICALL urMemImageGetInfo(
 
     return pfnImageGetInfo(hMemory, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2017,12 +2202,16 @@ ur_result_t UR_APICALL urSamplerCreate(
     ur_sampler_handle_t
         *phSampler ///< [out] pointer to handle of sampler object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerCreate(hContext, pDesc, phSampler);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Sampler.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, pDesc, phSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2049,12 +2238,16 @@ ur_result_t UR_APICALL urSamplerRetain(
     ur_sampler_handle_t
         hSampler ///< [in][retain] handle of the sampler object to get access
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerRetain(hSampler);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Sampler.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2081,12 +2274,16 @@ ur_result_t UR_APICALL urSamplerRelease(
     ur_sampler_handle_t
         hSampler ///< [in][release] handle of the sampler object to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerRelease(hSampler);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Sampler.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2129,12 +2326,17 @@ ur_result_t UR_APICALL urSamplerGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in sampler property value
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerGetInfo(hSampler, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Sampler.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hSampler, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2167,6 +2369,9 @@ ur_result_t UR_APICALL urSamplerGetNativeHandle(
     ur_native_handle_t *
         phNativeSampler ///< [out] a pointer to the native handle of the sampler.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerGetNativeHandle(hSampler, phNativeSampler);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Sampler.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -2174,6 +2379,7 @@ ur_result_t UR_APICALL urSamplerGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hSampler, phNativeSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2207,6 +2413,12 @@ ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
     ur_sampler_handle_t *
         phSampler ///< [out] pointer to the handle of the sampler object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urSamplerCreateWithNativeHandle(hNativeSampler,
+                                                           hContext,
+                                                           pProperties,
+                                                           phSampler);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Sampler.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -2215,6 +2427,7 @@ ur_result_t UR_APICALL urSamplerCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeSampler, hContext, pProperties,
                                      phSampler);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2266,12 +2479,17 @@ ur_result_t UR_APICALL urUSMHostAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM host memory object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMHostAlloc(hContext, pUSMDesc, pool, size,
+                                          ppMem);
+#else
     auto pfnHostAlloc = ur_lib::getContext()->urDdiTable.USM.pfnHostAlloc;
     if (nullptr == pfnHostAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnHostAlloc(hContext, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2325,12 +2543,17 @@ ur_result_t UR_APICALL urUSMDeviceAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM device memory object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMDeviceAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+#else
     auto pfnDeviceAlloc = ur_lib::getContext()->urDdiTable.USM.pfnDeviceAlloc;
     if (nullptr == pfnDeviceAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnDeviceAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2385,12 +2608,17 @@ ur_result_t UR_APICALL urUSMSharedAlloc(
         size, ///< [in] minimum size in bytes of the USM memory object to be allocated
     void **ppMem ///< [out] pointer to USM shared memory object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMSharedAlloc(hContext, hDevice, pUSMDesc, pool,
+                                            size, ppMem);
+#else
     auto pfnSharedAlloc = ur_lib::getContext()->urDdiTable.USM.pfnSharedAlloc;
     if (nullptr == pfnSharedAlloc) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnSharedAlloc(hContext, hDevice, pUSMDesc, pool, size, ppMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2413,12 +2641,16 @@ ur_result_t UR_APICALL urUSMFree(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to USM memory object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMFree(hContext, pMem);
+#else
     auto pfnFree = ur_lib::getContext()->urDdiTable.USM.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFree(hContext, pMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2454,6 +2686,11 @@ ur_result_t UR_APICALL urUSMGetMemAllocInfo(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in USM allocation property
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMGetMemAllocInfo(hContext, pMem, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+#else
     auto pfnGetMemAllocInfo =
         ur_lib::getContext()->urDdiTable.USM.pfnGetMemAllocInfo;
     if (nullptr == pfnGetMemAllocInfo) {
@@ -2462,6 +2699,7 @@ ur_result_t UR_APICALL urUSMGetMemAllocInfo(
 
     return pfnGetMemAllocInfo(hContext, pMem, propName, propSize, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2495,12 +2733,16 @@ ur_result_t UR_APICALL urUSMPoolCreate(
                    ///< ::ur_usm_pool_limits_desc_t
     ur_usm_pool_handle_t *ppPool ///< [out] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPoolCreate(hContext, pPoolDesc, ppPool);
+#else
     auto pfnPoolCreate = ur_lib::getContext()->urDdiTable.USM.pfnPoolCreate;
     if (nullptr == pfnPoolCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolCreate(hContext, pPoolDesc, ppPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2518,12 +2760,16 @@ ur_result_t UR_APICALL urUSMPoolCreate(
 ur_result_t UR_APICALL urUSMPoolRetain(
     ur_usm_pool_handle_t pPool ///< [in][retain] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPoolRetain(pPool);
+#else
     auto pfnPoolRetain = ur_lib::getContext()->urDdiTable.USM.pfnPoolRetain;
     if (nullptr == pfnPoolRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolRetain(pPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2548,12 +2794,16 @@ ur_result_t UR_APICALL urUSMPoolRetain(
 ur_result_t UR_APICALL urUSMPoolRelease(
     ur_usm_pool_handle_t pPool ///< [in][release] pointer to USM memory pool
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPoolRelease(pPool);
+#else
     auto pfnPoolRelease = ur_lib::getContext()->urDdiTable.USM.pfnPoolRelease;
     if (nullptr == pfnPoolRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolRelease(pPool);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2569,7 +2819,7 @@ ur_result_t UR_APICALL urUSMPoolRelease(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hPool`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_USM_POOL_INFO_CONTEXT < propName`
+///         + `::UR_USM_POOL_INFO_BUCKET_MISSES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -2590,12 +2840,17 @@ ur_result_t UR_APICALL urUSMPoolGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in pool property value
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPoolGetInfo(hPool, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnPoolGetInfo = ur_lib::getContext()->urDdiTable.USM.pfnPoolGetInfo;
     if (nullptr == pfnPoolGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnPoolGetInfo(hPool, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2642,6 +2897,12 @@ ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemGranularityGetInfo(hContext, hDevice,
+                                                          propName, propSize,
+                                                          pPropValue,
+                                                          pPropSizeRet);
+#else
     auto pfnGranularityGetInfo =
         ur_lib::getContext()->urDdiTable.VirtualMem.pfnGranularityGetInfo;
     if (nullptr == pfnGranularityGetInfo) {
@@ -2650,6 +2911,7 @@ ur_result_t UR_APICALL urVirtualMemGranularityGetInfo(
 
     return pfnGranularityGetInfo(hContext, hDevice, propName, propSize,
                                  pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2678,12 +2940,16 @@ ur_result_t UR_APICALL urVirtualMemReserve(
         ppStart ///< [out] pointer to the returned address at the start of reserved virtual
                 ///< memory range.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemReserve(hContext, pStart, size, ppStart);
+#else
     auto pfnReserve = ur_lib::getContext()->urDdiTable.VirtualMem.pfnReserve;
     if (nullptr == pfnReserve) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnReserve(hContext, pStart, size, ppStart);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2706,12 +2972,16 @@ ur_result_t UR_APICALL urVirtualMemFree(
         pStart, ///< [in] pointer to the start of the virtual memory range to free.
     size_t size ///< [in] size in bytes of the virtual memory range to free.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemFree(hContext, pStart, size);
+#else
     auto pfnFree = ur_lib::getContext()->urDdiTable.VirtualMem.pfnFree;
     if (nullptr == pfnFree) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFree(hContext, pStart, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2743,12 +3013,17 @@ ur_result_t UR_APICALL urVirtualMemMap(
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags for the physical memory mapping.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemMap(hContext, pStart, size, hPhysicalMem,
+                                           offset, flags);
+#else
     auto pfnMap = ur_lib::getContext()->urDdiTable.VirtualMem.pfnMap;
     if (nullptr == pfnMap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnMap(hContext, pStart, size, hPhysicalMem, offset, flags);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2775,12 +3050,16 @@ ur_result_t UR_APICALL urVirtualMemUnmap(
         pStart, ///< [in] pointer to the start of the mapped virtual memory range
     size_t size ///< [in] size in bytes of the virtual memory range.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemUnmap(hContext, pStart, size);
+#else
     auto pfnUnmap = ur_lib::getContext()->urDdiTable.VirtualMem.pfnUnmap;
     if (nullptr == pfnUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnUnmap(hContext, pStart, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2807,6 +3086,9 @@ ur_result_t UR_APICALL urVirtualMemSetAccess(
     ur_virtual_mem_access_flags_t
         flags ///< [in] access flags to set for the mapped virtual memory range.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemSetAccess(hContext, pStart, size, flags);
+#else
     auto pfnSetAccess =
         ur_lib::getContext()->urDdiTable.VirtualMem.pfnSetAccess;
     if (nullptr == pfnSetAccess) {
@@ -2814,6 +3096,7 @@ ur_result_t UR_APICALL urVirtualMemSetAccess(
     }
 
     return pfnSetAccess(hContext, pStart, size, flags);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2848,6 +3131,11 @@ ur_result_t UR_APICALL urVirtualMemGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName."
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urVirtualMemGetInfo(hContext, pStart, size, propName,
+                                               propSize, pPropValue,
+                                               pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.VirtualMem.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -2855,6 +3143,7 @@ ur_result_t UR_APICALL urVirtualMemGetInfo(
 
     return pfnGetInfo(hContext, pStart, size, propName, propSize, pPropValue,
                       pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2887,12 +3176,17 @@ ur_result_t UR_APICALL urPhysicalMemCreate(
     ur_physical_mem_handle_t *
         phPhysicalMem ///< [out] pointer to handle of physical memory object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPhysicalMemCreate(hContext, hDevice, size,
+                                               pProperties, phPhysicalMem);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, hDevice, size, pProperties, phPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2911,12 +3205,16 @@ ur_result_t UR_APICALL urPhysicalMemRetain(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in][retain] handle of the physical memory object to retain.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPhysicalMemRetain(hPhysicalMem);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2935,12 +3233,16 @@ ur_result_t UR_APICALL urPhysicalMemRelease(
     ur_physical_mem_handle_t
         hPhysicalMem ///< [in][release] handle of the physical memory object to release.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urPhysicalMemRelease(hPhysicalMem);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.PhysicalMem.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hPhysicalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -2984,6 +3286,10 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of program object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramCreateWithIL(hContext, pIL, length,
+                                                 pProperties, phProgram);
+#else
     auto pfnCreateWithIL =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithIL;
     if (nullptr == pfnCreateWithIL) {
@@ -2991,6 +3297,7 @@ ur_result_t UR_APICALL urProgramCreateWithIL(
     }
 
     return pfnCreateWithIL(hContext, pIL, length, pProperties, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3039,6 +3346,11 @@ ur_result_t UR_APICALL urProgramCreateWithBinary(
     ur_program_handle_t
         *phProgram ///< [out] pointer to handle of Program object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramCreateWithBinary(hContext, hDevice, size,
+                                                     pBinary, pProperties,
+                                                     phProgram);
+#else
     auto pfnCreateWithBinary =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithBinary;
     if (nullptr == pfnCreateWithBinary) {
@@ -3047,6 +3359,7 @@ ur_result_t UR_APICALL urProgramCreateWithBinary(
 
     return pfnCreateWithBinary(hContext, hDevice, size, pBinary, pProperties,
                                phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3083,12 +3396,16 @@ ur_result_t UR_APICALL urProgramBuild(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramBuild(hContext, hProgram, pOptions);
+#else
     auto pfnBuild = ur_lib::getContext()->urDdiTable.Program.pfnBuild;
     if (nullptr == pfnBuild) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBuild(hContext, hProgram, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3125,12 +3442,16 @@ ur_result_t UR_APICALL urProgramCompile(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramCompile(hContext, hProgram, pOptions);
+#else
     auto pfnCompile = ur_lib::getContext()->urDdiTable.Program.pfnCompile;
     if (nullptr == pfnCompile) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCompile(hContext, hProgram, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3183,12 +3504,17 @@ ur_result_t UR_APICALL urProgramLink(
     if (nullptr != phProgram) {
         *phProgram = nullptr;
     }
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramLink(hContext, count, phPrograms, pOptions,
+                                         phProgram);
+#else
     auto pfnLink = ur_lib::getContext()->urDdiTable.Program.pfnLink;
     if (nullptr == pfnLink) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnLink(hContext, count, phPrograms, pOptions, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3217,12 +3543,16 @@ ur_result_t UR_APICALL urProgramRetain(
     ur_program_handle_t
         hProgram ///< [in][retain] handle for the Program to retain
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramRetain(hProgram);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Program.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3251,12 +3581,16 @@ ur_result_t UR_APICALL urProgramRelease(
     ur_program_handle_t
         hProgram ///< [in][release] handle for the Program to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramRelease(hProgram);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Program.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3304,6 +3638,11 @@ ur_result_t UR_APICALL urProgramGetFunctionPointer(
     void **
         ppFunctionPointer ///< [out] Returns the pointer to the function if it is found in the program.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramGetFunctionPointer(hDevice, hProgram,
+                                                       pFunctionName,
+                                                       ppFunctionPointer);
+#else
     auto pfnGetFunctionPointer =
         ur_lib::getContext()->urDdiTable.Program.pfnGetFunctionPointer;
     if (nullptr == pfnGetFunctionPointer) {
@@ -3312,6 +3651,7 @@ ur_result_t UR_APICALL urProgramGetFunctionPointer(
 
     return pfnGetFunctionPointer(hDevice, hProgram, pFunctionName,
                                  ppFunctionPointer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3355,6 +3695,11 @@ ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     void **
         ppGlobalVariablePointerRet ///< [out] Returns the pointer to the global variable if it is found in the program.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramGetGlobalVariablePointer(
+        hDevice, hProgram, pGlobalVariableName, pGlobalVariableSizeRet,
+        ppGlobalVariablePointerRet);
+#else
     auto pfnGetGlobalVariablePointer =
         ur_lib::getContext()->urDdiTable.Program.pfnGetGlobalVariablePointer;
     if (nullptr == pfnGetGlobalVariablePointer) {
@@ -3364,6 +3709,7 @@ ur_result_t UR_APICALL urProgramGetGlobalVariablePointer(
     return pfnGetGlobalVariablePointer(hDevice, hProgram, pGlobalVariableName,
                                        pGlobalVariableSizeRet,
                                        ppGlobalVariablePointerRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3409,12 +3755,17 @@ ur_result_t UR_APICALL urProgramGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramGetInfo(hProgram, propName, propSize,
+                                            pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Program.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hProgram, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3452,6 +3803,11 @@ ur_result_t UR_APICALL urProgramGetBuildInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramGetBuildInfo(hProgram, hDevice, propName,
+                                                 propSize, pPropValue,
+                                                 pPropSizeRet);
+#else
     auto pfnGetBuildInfo =
         ur_lib::getContext()->urDdiTable.Program.pfnGetBuildInfo;
     if (nullptr == pfnGetBuildInfo) {
@@ -3460,6 +3816,7 @@ ur_result_t UR_APICALL urProgramGetBuildInfo(
 
     return pfnGetBuildInfo(hProgram, hDevice, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3499,6 +3856,10 @@ ur_result_t UR_APICALL urProgramSetSpecializationConstants(
         pSpecConstants ///< [in][range(0, count)] array of specialization constant value
                        ///< descriptions
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramSetSpecializationConstants(hProgram, count,
+                                                               pSpecConstants);
+#else
     auto pfnSetSpecializationConstants =
         ur_lib::getContext()->urDdiTable.Program.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -3506,6 +3867,7 @@ ur_result_t UR_APICALL urProgramSetSpecializationConstants(
     }
 
     return pfnSetSpecializationConstants(hProgram, count, pSpecConstants);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3538,6 +3900,9 @@ ur_result_t UR_APICALL urProgramGetNativeHandle(
     ur_native_handle_t *
         phNativeProgram ///< [out] a pointer to the native handle of the program.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramGetNativeHandle(hProgram, phNativeProgram);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Program.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -3545,6 +3910,7 @@ ur_result_t UR_APICALL urProgramGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hProgram, phNativeProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3578,6 +3944,12 @@ ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
     ur_program_handle_t *
         phProgram ///< [out] pointer to the handle of the program object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramCreateWithNativeHandle(hNativeProgram,
+                                                           hContext,
+                                                           pProperties,
+                                                           phProgram);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Program.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -3586,6 +3958,7 @@ ur_result_t UR_APICALL urProgramCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeProgram, hContext, pProperties,
                                      phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3615,12 +3988,16 @@ ur_result_t UR_APICALL urKernelCreate(
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to handle of kernel object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelCreate(hProgram, pKernelName, phKernel);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Kernel.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hProgram, pKernelName, phKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3654,6 +4031,10 @@ ur_result_t UR_APICALL urKernelSetArgValue(
         *pArgValue ///< [in] argument value represented as matching arg type.
     ///< The data pointed to will be copied and therefore can be reused on return.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgValue(hKernel, argIndex, argSize,
+                                               pProperties, pArgValue);
+#else
     auto pfnSetArgValue =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgValue;
     if (nullptr == pfnSetArgValue) {
@@ -3661,6 +4042,7 @@ ur_result_t UR_APICALL urKernelSetArgValue(
     }
 
     return pfnSetArgValue(hKernel, argIndex, argSize, pProperties, pArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3690,6 +4072,10 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
     const ur_kernel_arg_local_properties_t
         *pProperties ///< [in][optional] pointer to local buffer properties.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgLocal(hKernel, argIndex, argSize,
+                                               pProperties);
+#else
     auto pfnSetArgLocal =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgLocal;
     if (nullptr == pfnSetArgLocal) {
@@ -3697,6 +4083,7 @@ ur_result_t UR_APICALL urKernelSetArgLocal(
     }
 
     return pfnSetArgLocal(hKernel, argIndex, argSize, pProperties);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3743,12 +4130,17 @@ ur_result_t UR_APICALL urKernelGetInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelGetInfo(hKernel, propName, propSize,
+                                           pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Kernel.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hKernel, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3783,6 +4175,11 @@ ur_result_t UR_APICALL urKernelGetGroupInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelGetGroupInfo(hKernel, hDevice, propName,
+                                                propSize, pPropValue,
+                                                pPropSizeRet);
+#else
     auto pfnGetGroupInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetGroupInfo;
     if (nullptr == pfnGetGroupInfo) {
@@ -3791,6 +4188,7 @@ ur_result_t UR_APICALL urKernelGetGroupInfo(
 
     return pfnGetGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
                            pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3821,6 +4219,11 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of data being
                      ///< queried by propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelGetSubGroupInfo(hKernel, hDevice, propName,
+                                                   propSize, pPropValue,
+                                                   pPropSizeRet);
+#else
     auto pfnGetSubGroupInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetSubGroupInfo;
     if (nullptr == pfnGetSubGroupInfo) {
@@ -3829,6 +4232,7 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
 
     return pfnGetSubGroupInfo(hKernel, hDevice, propName, propSize, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3856,12 +4260,16 @@ ur_result_t UR_APICALL urKernelGetSubGroupInfo(
 ur_result_t UR_APICALL urKernelRetain(
     ur_kernel_handle_t hKernel ///< [in][retain] handle for the Kernel to retain
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelRetain(hKernel);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Kernel.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3890,12 +4298,16 @@ ur_result_t UR_APICALL urKernelRelease(
     ur_kernel_handle_t
         hKernel ///< [in][release] handle for the Kernel to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelRelease(hKernel);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Kernel.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3930,6 +4342,10 @@ ur_result_t UR_APICALL urKernelSetArgPointer(
         pArgValue ///< [in][optional] Pointer obtained by USM allocation or virtual memory
     ///< mapping operation. If null then argument value is considered null.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgPointer(hKernel, argIndex, pProperties,
+                                                 pArgValue);
+#else
     auto pfnSetArgPointer =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgPointer;
     if (nullptr == pfnSetArgPointer) {
@@ -3937,6 +4353,7 @@ ur_result_t UR_APICALL urKernelSetArgPointer(
     }
 
     return pfnSetArgPointer(hKernel, argIndex, pProperties, pArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -3974,6 +4391,10 @@ ur_result_t UR_APICALL urKernelSetExecInfo(
         pPropValue ///< [in][typename(propName, propSize)] pointer to memory location holding
                    ///< the property value.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetExecInfo(hKernel, propName, propSize,
+                                               pProperties, pPropValue);
+#else
     auto pfnSetExecInfo =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetExecInfo;
     if (nullptr == pfnSetExecInfo) {
@@ -3981,6 +4402,7 @@ ur_result_t UR_APICALL urKernelSetExecInfo(
     }
 
     return pfnSetExecInfo(hKernel, propName, propSize, pProperties, pPropValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4009,6 +4431,10 @@ ur_result_t UR_APICALL urKernelSetArgSampler(
         *pProperties, ///< [in][optional] pointer to sampler properties.
     ur_sampler_handle_t hArgValue ///< [in] handle of Sampler object.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgSampler(hKernel, argIndex, pProperties,
+                                                 hArgValue);
+#else
     auto pfnSetArgSampler =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgSampler;
     if (nullptr == pfnSetArgSampler) {
@@ -4016,6 +4442,7 @@ ur_result_t UR_APICALL urKernelSetArgSampler(
     }
 
     return pfnSetArgSampler(hKernel, argIndex, pProperties, hArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4045,6 +4472,10 @@ ur_result_t UR_APICALL urKernelSetArgMemObj(
         *pProperties, ///< [in][optional] pointer to Memory object properties.
     ur_mem_handle_t hArgValue ///< [in][optional] handle of Memory object.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgMemObj(hKernel, argIndex, pProperties,
+                                                hArgValue);
+#else
     auto pfnSetArgMemObj =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetArgMemObj;
     if (nullptr == pfnSetArgMemObj) {
@@ -4052,6 +4483,7 @@ ur_result_t UR_APICALL urKernelSetArgMemObj(
     }
 
     return pfnSetArgMemObj(hKernel, argIndex, pProperties, hArgValue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4097,6 +4529,10 @@ ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     const ur_specialization_constant_info_t *
         pSpecConstants ///< [in] array of specialization constant value descriptions
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetSpecializationConstants(hKernel, count,
+                                                              pSpecConstants);
+#else
     auto pfnSetSpecializationConstants =
         ur_lib::getContext()->urDdiTable.Kernel.pfnSetSpecializationConstants;
     if (nullptr == pfnSetSpecializationConstants) {
@@ -4104,6 +4540,7 @@ ur_result_t UR_APICALL urKernelSetSpecializationConstants(
     }
 
     return pfnSetSpecializationConstants(hKernel, count, pSpecConstants);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4136,6 +4573,9 @@ ur_result_t UR_APICALL urKernelGetNativeHandle(
     ur_native_handle_t
         *phNativeKernel ///< [out] a pointer to the native handle of the kernel.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelGetNativeHandle(hKernel, phNativeKernel);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4143,6 +4583,7 @@ ur_result_t UR_APICALL urKernelGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hKernel, phNativeKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4181,6 +4622,12 @@ ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
     ur_kernel_handle_t
         *phKernel ///< [out] pointer to the handle of the kernel object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelCreateWithNativeHandle(hNativeKernel,
+                                                          hContext, hProgram,
+                                                          pProperties,
+                                                          phKernel);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Kernel.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4189,6 +4636,7 @@ ur_result_t UR_APICALL urKernelCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeKernel, hContext, hProgram,
                                      pProperties, phKernel);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4232,6 +4680,11 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
         pSuggestedLocalWorkSize ///< [out] pointer to an array of numWorkDim unsigned values that specify
     ///< suggested local work size that will contain the result of the query
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelGetSuggestedLocalWorkSize(
+        hKernel, hQueue, numWorkDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pSuggestedLocalWorkSize);
+#else
     auto pfnGetSuggestedLocalWorkSize =
         ur_lib::getContext()->urDdiTable.Kernel.pfnGetSuggestedLocalWorkSize;
     if (nullptr == pfnGetSuggestedLocalWorkSize) {
@@ -4241,6 +4694,7 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
     return pfnGetSuggestedLocalWorkSize(hKernel, hQueue, numWorkDim,
                                         pGlobalWorkOffset, pGlobalWorkSize,
                                         pSuggestedLocalWorkSize);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4260,7 +4714,7 @@ ur_result_t UR_APICALL urKernelGetSuggestedLocalWorkSize(
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
 ///         + `NULL == hQueue`
 ///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
-///         + `::UR_QUEUE_INFO_EMPTY < propName`
+///         + `::UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP < propName`
 ///     - ::UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION
 ///         + If `propName` is not supported by the adapter.
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
@@ -4283,12 +4737,17 @@ ur_result_t UR_APICALL urQueueGetInfo(
     size_t *
         pPropSizeRet ///< [out][optional] size in bytes returned in queue property value
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueGetInfo(hQueue, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Queue.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hQueue, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4330,12 +4789,17 @@ ur_result_t UR_APICALL urQueueCreate(
     ur_queue_handle_t
         *phQueue ///< [out] pointer to handle of queue object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueCreate(hContext, hDevice, pProperties,
+                                         phQueue);
+#else
     auto pfnCreate = ur_lib::getContext()->urDdiTable.Queue.pfnCreate;
     if (nullptr == pfnCreate) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnCreate(hContext, hDevice, pProperties, phQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4366,12 +4830,16 @@ ur_result_t UR_APICALL urQueueRetain(
     ur_queue_handle_t
         hQueue ///< [in][retain] handle of the queue object to get access
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueRetain(hQueue);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Queue.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4404,12 +4872,16 @@ ur_result_t UR_APICALL urQueueRelease(
     ur_queue_handle_t
         hQueue ///< [in][release] handle of the queue object to release
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueRelease(hQueue);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Queue.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4444,6 +4916,9 @@ ur_result_t UR_APICALL urQueueGetNativeHandle(
     ur_native_handle_t
         *phNativeQueue ///< [out] a pointer to the native handle of the queue.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueGetNativeHandle(hQueue, pDesc, phNativeQueue);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Queue.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4451,6 +4926,7 @@ ur_result_t UR_APICALL urQueueGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hQueue, pDesc, phNativeQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4485,6 +4961,11 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
     ur_queue_handle_t
         *phQueue ///< [out] pointer to the handle of the queue object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueCreateWithNativeHandle(hNativeQueue, hContext,
+                                                         hDevice, pProperties,
+                                                         phQueue);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Queue.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4493,6 +4974,7 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeQueue, hContext, hDevice,
                                      pProperties, phQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4524,12 +5006,16 @@ ur_result_t UR_APICALL urQueueCreateWithNativeHandle(
 ur_result_t UR_APICALL urQueueFinish(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be finished.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueFinish(hQueue);
+#else
     auto pfnFinish = ur_lib::getContext()->urDdiTable.Queue.pfnFinish;
     if (nullptr == pfnFinish) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFinish(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4560,12 +5046,16 @@ ur_result_t UR_APICALL urQueueFinish(
 ur_result_t UR_APICALL urQueueFlush(
     ur_queue_handle_t hQueue ///< [in] handle of the queue to be flushed.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueFlush(hQueue);
+#else
     auto pfnFlush = ur_lib::getContext()->urDdiTable.Queue.pfnFlush;
     if (nullptr == pfnFlush) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnFlush(hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4606,12 +5096,17 @@ ur_result_t UR_APICALL urEventGetInfo(
                     ///< property
     size_t *pPropSizeRet ///< [out][optional] bytes returned in event property
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventGetInfo(hEvent, propName, propSize,
+                                          pPropValue, pPropSizeRet);
+#else
     auto pfnGetInfo = ur_lib::getContext()->urDdiTable.Event.pfnGetInfo;
     if (nullptr == pfnGetInfo) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnGetInfo(hEvent, propName, propSize, pPropValue, pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4652,6 +5147,10 @@ ur_result_t UR_APICALL urEventGetProfilingInfo(
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes returned in
                      ///< propValue
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventGetProfilingInfo(hEvent, propName, propSize,
+                                                   pPropValue, pPropSizeRet);
+#else
     auto pfnGetProfilingInfo =
         ur_lib::getContext()->urDdiTable.Event.pfnGetProfilingInfo;
     if (nullptr == pfnGetProfilingInfo) {
@@ -4660,6 +5159,7 @@ ur_result_t UR_APICALL urEventGetProfilingInfo(
 
     return pfnGetProfilingInfo(hEvent, propName, propSize, pPropValue,
                                pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4692,12 +5192,16 @@ ur_result_t UR_APICALL urEventWait(
         phEventWaitList ///< [in][range(0, numEvents)] pointer to a list of events to wait for
                         ///< completion
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventWait(numEvents, phEventWaitList);
+#else
     auto pfnWait = ur_lib::getContext()->urDdiTable.Event.pfnWait;
     if (nullptr == pfnWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnWait(numEvents, phEventWaitList);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4723,12 +5227,16 @@ ur_result_t UR_APICALL urEventWait(
 ur_result_t UR_APICALL urEventRetain(
     ur_event_handle_t hEvent ///< [in][retain] handle of the event object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventRetain(hEvent);
+#else
     auto pfnRetain = ur_lib::getContext()->urDdiTable.Event.pfnRetain;
     if (nullptr == pfnRetain) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRetain(hEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4754,12 +5262,16 @@ ur_result_t UR_APICALL urEventRetain(
 ur_result_t UR_APICALL urEventRelease(
     ur_event_handle_t hEvent ///< [in][release] handle of the event object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventRelease(hEvent);
+#else
     auto pfnRelease = ur_lib::getContext()->urDdiTable.Event.pfnRelease;
     if (nullptr == pfnRelease) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnRelease(hEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4792,6 +5304,9 @@ ur_result_t UR_APICALL urEventGetNativeHandle(
     ur_native_handle_t
         *phNativeEvent ///< [out] a pointer to the native handle of the event.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventGetNativeHandle(hEvent, phNativeEvent);
+#else
     auto pfnGetNativeHandle =
         ur_lib::getContext()->urDdiTable.Event.pfnGetNativeHandle;
     if (nullptr == pfnGetNativeHandle) {
@@ -4799,6 +5314,7 @@ ur_result_t UR_APICALL urEventGetNativeHandle(
     }
 
     return pfnGetNativeHandle(hEvent, phNativeEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4832,6 +5348,10 @@ ur_result_t UR_APICALL urEventCreateWithNativeHandle(
     ur_event_handle_t
         *phEvent ///< [out] pointer to the handle of the event object created.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventCreateWithNativeHandle(hNativeEvent, hContext,
+                                                         pProperties, phEvent);
+#else
     auto pfnCreateWithNativeHandle =
         ur_lib::getContext()->urDdiTable.Event.pfnCreateWithNativeHandle;
     if (nullptr == pfnCreateWithNativeHandle) {
@@ -4840,6 +5360,7 @@ ur_result_t UR_APICALL urEventCreateWithNativeHandle(
 
     return pfnCreateWithNativeHandle(hNativeEvent, hContext, pProperties,
                                      phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4878,12 +5399,17 @@ ur_result_t UR_APICALL urEventSetCallback(
     void *
         pUserData ///< [in][out][optional] pointer to data to be passed to callback.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventSetCallback(hEvent, execStatus, pfnNotify,
+                                              pUserData);
+#else
     auto pfnSetCallback = ur_lib::getContext()->urDdiTable.Event.pfnSetCallback;
     if (nullptr == pfnSetCallback) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnSetCallback(hEvent, execStatus, pfnNotify, pUserData);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -4949,6 +5475,14 @@ ur_result_t UR_APICALL urEnqueueKernelLaunch(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueKernelLaunch(hQueue, hKernel, workDim,
+                                                 pGlobalWorkOffset,
+                                                 pGlobalWorkSize,
+                                                 pLocalWorkSize,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnKernelLaunch =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnKernelLaunch;
     if (nullptr == pfnKernelLaunch) {
@@ -4958,6 +5492,7 @@ ur_result_t UR_APICALL urEnqueueKernelLaunch(
     return pfnKernelLaunch(hQueue, hKernel, workDim, pGlobalWorkOffset,
                            pGlobalWorkSize, pLocalWorkSize, numEventsInWaitList,
                            phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5007,12 +5542,17 @@ ur_result_t UR_APICALL urEnqueueEventsWait(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueEventsWait(hQueue, numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+#else
     auto pfnEventsWait = ur_lib::getContext()->urDdiTable.Enqueue.pfnEventsWait;
     if (nullptr == pfnEventsWait) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnEventsWait(hQueue, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5064,6 +5604,12 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueEventsWaitWithBarrier(hQueue,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+#else
     auto pfnEventsWaitWithBarrier =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnEventsWaitWithBarrier;
     if (nullptr == pfnEventsWaitWithBarrier) {
@@ -5072,6 +5618,7 @@ ur_result_t UR_APICALL urEnqueueEventsWaitWithBarrier(
 
     return pfnEventsWaitWithBarrier(hQueue, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5129,6 +5676,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferRead(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferRead(hQueue, hBuffer, blockingRead,
+                                                  offset, size, pDst,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemBufferRead =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferRead;
     if (nullptr == pfnMemBufferRead) {
@@ -5137,6 +5690,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferRead(
 
     return pfnMemBufferRead(hQueue, hBuffer, blockingRead, offset, size, pDst,
                             numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5196,6 +5750,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferWrite(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferWrite(hQueue, hBuffer,
+                                                   blockingWrite, offset, size,
+                                                   pSrc, numEventsInWaitList,
+                                                   phEventWaitList, phEvent);
+#else
     auto pfnMemBufferWrite =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWrite;
     if (nullptr == pfnMemBufferWrite) {
@@ -5204,6 +5764,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferWrite(
 
     return pfnMemBufferWrite(hQueue, hBuffer, blockingWrite, offset, size, pSrc,
                              numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5283,6 +5844,17 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferReadRect(hQueue, hBuffer,
+                                                      blockingRead,
+                                                      bufferOrigin, hostOrigin,
+                                                      region, bufferRowPitch,
+                                                      bufferSlicePitch,
+                                                      hostRowPitch,
+                                                      hostSlicePitch, pDst,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
     auto pfnMemBufferReadRect =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferReadRect;
     if (nullptr == pfnMemBufferReadRect) {
@@ -5293,6 +5865,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferReadRect(
         hQueue, hBuffer, blockingRead, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
         numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5375,6 +5948,18 @@ ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferWriteRect(hQueue, hBuffer,
+                                                       blockingWrite,
+                                                       bufferOrigin, hostOrigin,
+                                                       region, bufferRowPitch,
+                                                       bufferSlicePitch,
+                                                       hostRowPitch,
+                                                       hostSlicePitch, pSrc,
+                                                       numEventsInWaitList,
+                                                       phEventWaitList,
+                                                       phEvent);
+#else
     auto pfnMemBufferWriteRect =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferWriteRect;
     if (nullptr == pfnMemBufferWriteRect) {
@@ -5385,6 +5970,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferWriteRect(
         hQueue, hBuffer, blockingWrite, bufferOrigin, hostOrigin, region,
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5439,6 +6025,13 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferCopy(hQueue, hBufferSrc,
+                                                  hBufferDst, srcOffset,
+                                                  dstOffset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemBufferCopy =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferCopy;
     if (nullptr == pfnMemBufferCopy) {
@@ -5448,6 +6041,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopy(
     return pfnMemBufferCopy(hQueue, hBufferSrc, hBufferDst, srcOffset,
                             dstOffset, size, numEventsInWaitList,
                             phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5519,6 +6113,17 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferCopyRect(hQueue, hBufferSrc,
+                                                      hBufferDst, srcOrigin,
+                                                      dstOrigin, region,
+                                                      srcRowPitch,
+                                                      srcSlicePitch,
+                                                      dstRowPitch,
+                                                      dstSlicePitch,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
     auto pfnMemBufferCopyRect =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferCopyRect;
     if (nullptr == pfnMemBufferCopyRect) {
@@ -5529,6 +6134,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferCopyRect(
                                 dstOrigin, region, srcRowPitch, srcSlicePitch,
                                 dstRowPitch, dstSlicePitch, numEventsInWaitList,
                                 phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5588,6 +6194,12 @@ ur_result_t UR_APICALL urEnqueueMemBufferFill(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferFill(hQueue, hBuffer, pPattern,
+                                                  patternSize, offset, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemBufferFill =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferFill;
     if (nullptr == pfnMemBufferFill) {
@@ -5597,6 +6209,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferFill(
     return pfnMemBufferFill(hQueue, hBuffer, pPattern, patternSize, offset,
                             size, numEventsInWaitList, phEventWaitList,
                             phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5660,6 +6273,13 @@ ur_result_t UR_APICALL urEnqueueMemImageRead(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemImageRead(hQueue, hImage, blockingRead,
+                                                 origin, region, rowPitch,
+                                                 slicePitch, pDst,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnMemImageRead =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageRead;
     if (nullptr == pfnMemImageRead) {
@@ -5669,6 +6289,7 @@ ur_result_t UR_APICALL urEnqueueMemImageRead(
     return pfnMemImageRead(hQueue, hImage, blockingRead, origin, region,
                            rowPitch, slicePitch, pDst, numEventsInWaitList,
                            phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5733,6 +6354,13 @@ ur_result_t UR_APICALL urEnqueueMemImageWrite(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemImageWrite(hQueue, hImage, blockingWrite,
+                                                  origin, region, rowPitch,
+                                                  slicePitch, pSrc,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnMemImageWrite =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageWrite;
     if (nullptr == pfnMemImageWrite) {
@@ -5742,6 +6370,7 @@ ur_result_t UR_APICALL urEnqueueMemImageWrite(
     return pfnMemImageWrite(hQueue, hImage, blockingWrite, origin, region,
                             rowPitch, slicePitch, pSrc, numEventsInWaitList,
                             phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5801,6 +6430,12 @@ ur_result_t UR_APICALL urEnqueueMemImageCopy(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemImageCopy(hQueue, hImageSrc, hImageDst,
+                                                 srcOrigin, dstOrigin, region,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnMemImageCopy =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemImageCopy;
     if (nullptr == pfnMemImageCopy) {
@@ -5810,6 +6445,7 @@ ur_result_t UR_APICALL urEnqueueMemImageCopy(
     return pfnMemImageCopy(hQueue, hImageSrc, hImageDst, srcOrigin, dstOrigin,
                            region, numEventsInWaitList, phEventWaitList,
                            phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5875,6 +6511,13 @@ ur_result_t UR_APICALL urEnqueueMemBufferMap(
     void **ppRetMap ///< [out] return mapped pointer.  TODO: move it before
                     ///< numEventsInWaitList?
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemBufferMap(hQueue, hBuffer, blockingMap,
+                                                 mapFlags, offset, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent,
+                                                 ppRetMap);
+#else
     auto pfnMemBufferMap =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnMemBufferMap;
     if (nullptr == pfnMemBufferMap) {
@@ -5884,6 +6527,7 @@ ur_result_t UR_APICALL urEnqueueMemBufferMap(
     return pfnMemBufferMap(hQueue, hBuffer, blockingMap, mapFlags, offset, size,
                            numEventsInWaitList, phEventWaitList, phEvent,
                            ppRetMap);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5933,6 +6577,11 @@ ur_result_t UR_APICALL urEnqueueMemUnmap(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueMemUnmap(hQueue, hMem, pMappedPtr,
+                                             numEventsInWaitList,
+                                             phEventWaitList, phEvent);
+#else
     auto pfnMemUnmap = ur_lib::getContext()->urDdiTable.Enqueue.pfnMemUnmap;
     if (nullptr == pfnMemUnmap) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -5940,6 +6589,7 @@ ur_result_t UR_APICALL urEnqueueMemUnmap(
 
     return pfnMemUnmap(hQueue, hMem, pMappedPtr, numEventsInWaitList,
                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -5994,6 +6644,11 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMFill(hQueue, pMem, patternSize, pPattern,
+                                            size, numEventsInWaitList,
+                                            phEventWaitList, phEvent);
+#else
     auto pfnUSMFill = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMFill;
     if (nullptr == pfnUSMFill) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -6001,6 +6656,7 @@ ur_result_t UR_APICALL urEnqueueUSMFill(
 
     return pfnUSMFill(hQueue, pMem, patternSize, pPattern, size,
                       numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6051,6 +6707,11 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMMemcpy(hQueue, blocking, pDst, pSrc,
+                                              size, numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+#else
     auto pfnUSMMemcpy = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMMemcpy;
     if (nullptr == pfnUSMMemcpy) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -6058,6 +6719,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy(
 
     return pfnUSMMemcpy(hQueue, blocking, pDst, pSrc, size, numEventsInWaitList,
                         phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6112,6 +6774,11 @@ ur_result_t UR_APICALL urEnqueueUSMPrefetch(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMPrefetch(hQueue, pMem, size, flags,
+                                                numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+#else
     auto pfnUSMPrefetch =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMPrefetch;
     if (nullptr == pfnUSMPrefetch) {
@@ -6120,6 +6787,7 @@ ur_result_t UR_APICALL urEnqueueUSMPrefetch(
 
     return pfnUSMPrefetch(hQueue, pMem, size, flags, numEventsInWaitList,
                           phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6161,12 +6829,17 @@ ur_result_t UR_APICALL urEnqueueUSMAdvise(
         phEvent ///< [out][optional] return an event object that identifies this particular
                 ///< command instance.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMAdvise(hQueue, pMem, size, advice,
+                                              phEvent);
+#else
     auto pfnUSMAdvise = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMAdvise;
     if (nullptr == pfnUSMAdvise) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnUSMAdvise(hQueue, pMem, size, advice, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6229,6 +6902,12 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMFill2D(hQueue, pMem, pitch, patternSize,
+                                              pPattern, width, height,
+                                              numEventsInWaitList,
+                                              phEventWaitList, phEvent);
+#else
     auto pfnUSMFill2D = ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMFill2D;
     if (nullptr == pfnUSMFill2D) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -6236,6 +6915,7 @@ ur_result_t UR_APICALL urEnqueueUSMFill2D(
 
     return pfnUSMFill2D(hQueue, pMem, pitch, patternSize, pPattern, width,
                         height, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6295,6 +6975,12 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMMemcpy2D(hQueue, blocking, pDst,
+                                                dstPitch, pSrc, srcPitch, width,
+                                                height, numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+#else
     auto pfnUSMMemcpy2D =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnUSMMemcpy2D;
     if (nullptr == pfnUSMMemcpy2D) {
@@ -6304,6 +6990,7 @@ ur_result_t UR_APICALL urEnqueueUSMMemcpy2D(
     return pfnUSMMemcpy2D(hQueue, blocking, pDst, dstPitch, pSrc, srcPitch,
                           width, height, numEventsInWaitList, phEventWaitList,
                           phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6350,6 +7037,11 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueDeviceGlobalVariableWrite(
+        hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnDeviceGlobalVariableWrite =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableWrite;
     if (nullptr == pfnDeviceGlobalVariableWrite) {
@@ -6359,6 +7051,7 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableWrite(
     return pfnDeviceGlobalVariableWrite(
         hQueue, hProgram, name, blockingWrite, count, offset, pSrc,
         numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6405,6 +7098,11 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueDeviceGlobalVariableRead(
+        hQueue, hProgram, name, blockingRead, count, offset, pDst,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnDeviceGlobalVariableRead =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnDeviceGlobalVariableRead;
     if (nullptr == pfnDeviceGlobalVariableRead) {
@@ -6414,6 +7112,7 @@ ur_result_t UR_APICALL urEnqueueDeviceGlobalVariableRead(
     return pfnDeviceGlobalVariableRead(hQueue, hProgram, name, blockingRead,
                                        count, offset, pDst, numEventsInWaitList,
                                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6464,6 +7163,12 @@ ur_result_t UR_APICALL urEnqueueReadHostPipe(
     ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
     ///< an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueReadHostPipe(hQueue, hProgram, pipe_symbol,
+                                                 blocking, pDst, size,
+                                                 numEventsInWaitList,
+                                                 phEventWaitList, phEvent);
+#else
     auto pfnReadHostPipe =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnReadHostPipe;
     if (nullptr == pfnReadHostPipe) {
@@ -6472,6 +7177,7 @@ ur_result_t UR_APICALL urEnqueueReadHostPipe(
 
     return pfnReadHostPipe(hQueue, hProgram, pipe_symbol, blocking, pDst, size,
                            numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6523,6 +7229,12 @@ ur_result_t UR_APICALL urEnqueueWriteHostPipe(
     ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
     ///< an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueWriteHostPipe(hQueue, hProgram, pipe_symbol,
+                                                  blocking, pSrc, size,
+                                                  numEventsInWaitList,
+                                                  phEventWaitList, phEvent);
+#else
     auto pfnWriteHostPipe =
         ur_lib::getContext()->urDdiTable.Enqueue.pfnWriteHostPipe;
     if (nullptr == pfnWriteHostPipe) {
@@ -6531,6 +7243,7 @@ ur_result_t UR_APICALL urEnqueueWriteHostPipe(
 
     return pfnWriteHostPipe(hQueue, hProgram, pipe_symbol, blocking, pSrc, size,
                             numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6593,6 +7306,12 @@ ur_result_t UR_APICALL urUSMPitchedAllocExp(
     void **ppMem,         ///< [out] pointer to USM shared memory object
     size_t *pResultPitch  ///< [out] pitch of the allocation
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPitchedAllocExp(hContext, hDevice, pUSMDesc,
+                                                pool, widthInBytes, height,
+                                                elementSizeBytes, ppMem,
+                                                pResultPitch);
+#else
     auto pfnPitchedAllocExp =
         ur_lib::getContext()->urDdiTable.USMExp.pfnPitchedAllocExp;
     if (nullptr == pfnPitchedAllocExp) {
@@ -6601,6 +7320,7 @@ ur_result_t UR_APICALL urUSMPitchedAllocExp(
 
     return pfnPitchedAllocExp(hContext, hDevice, pUSMDesc, pool, widthInBytes,
                               height, elementSizeBytes, ppMem, pResultPitch);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6628,6 +7348,10 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t
         hImage ///< [in][release] pointer to handle of image object to destroy
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesUnsampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+#else
     auto pfnUnsampledImageHandleDestroyExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnUnsampledImageHandleDestroyExp;
@@ -6636,6 +7360,7 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageHandleDestroyExp(
     }
 
     return pfnUnsampledImageHandleDestroyExp(hContext, hDevice, hImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6663,6 +7388,10 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageHandleDestroyExp(
     ur_exp_image_native_handle_t
         hImage ///< [in][release] pointer to handle of image object to destroy
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesSampledImageHandleDestroyExp(
+        hContext, hDevice, hImage);
+#else
     auto pfnSampledImageHandleDestroyExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSampledImageHandleDestroyExp;
@@ -6671,6 +7400,7 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageHandleDestroyExp(
     }
 
     return pfnSampledImageHandleDestroyExp(hContext, hDevice, hImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6710,6 +7440,12 @@ ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
     ur_exp_image_mem_native_handle_t
         *phImageMem ///< [out] pointer to handle of image memory allocated
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImageAllocateExp(hContext, hDevice,
+                                                            pImageFormat,
+                                                            pImageDesc,
+                                                            phImageMem);
+#else
     auto pfnImageAllocateExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageAllocateExp;
     if (nullptr == pfnImageAllocateExp) {
@@ -6718,6 +7454,7 @@ ur_result_t UR_APICALL urBindlessImagesImageAllocateExp(
 
     return pfnImageAllocateExp(hContext, hDevice, pImageFormat, pImageDesc,
                                phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6745,6 +7482,10 @@ ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     ur_exp_image_mem_native_handle_t
         hImageMem ///< [in][release] handle of image memory to be freed
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImageFreeExp(hContext, hDevice,
+                                                        hImageMem);
+#else
     auto pfnImageFreeExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageFreeExp;
     if (nullptr == pfnImageFreeExp) {
@@ -6752,6 +7493,7 @@ ur_result_t UR_APICALL urBindlessImagesImageFreeExp(
     }
 
     return pfnImageFreeExp(hContext, hDevice, hImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6793,6 +7535,14 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
     ur_exp_image_native_handle_t
         *phImage ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesUnsampledImageCreateExp(hContext,
+                                                                   hDevice,
+                                                                   hImageMem,
+                                                                   pImageFormat,
+                                                                   pImageDesc,
+                                                                   phImage);
+#else
     auto pfnUnsampledImageCreateExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnUnsampledImageCreateExp;
@@ -6802,6 +7552,7 @@ ur_result_t UR_APICALL urBindlessImagesUnsampledImageCreateExp(
 
     return pfnUnsampledImageCreateExp(hContext, hDevice, hImageMem,
                                       pImageFormat, pImageDesc, phImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6846,6 +7597,15 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
     ur_exp_image_native_handle_t
         *phImage ///< [out] pointer to handle of image object created
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesSampledImageCreateExp(hContext,
+                                                                 hDevice,
+                                                                 hImageMem,
+                                                                 pImageFormat,
+                                                                 pImageDesc,
+                                                                 hSampler,
+                                                                 phImage);
+#else
     auto pfnSampledImageCreateExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSampledImageCreateExp;
@@ -6855,6 +7615,7 @@ ur_result_t UR_APICALL urBindlessImagesSampledImageCreateExp(
 
     return pfnSampledImageCreateExp(hContext, hDevice, hImageMem, pImageFormat,
                                     pImageDesc, hSampler, phImage);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6920,6 +7681,18 @@ ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImageCopyExp(hQueue, pSrc, pDst,
+                                                        pSrcImageDesc,
+                                                        pDstImageDesc,
+                                                        pSrcImageFormat,
+                                                        pDstImageFormat,
+                                                        pCopyRegion,
+                                                        imageCopyFlags,
+                                                        numEventsInWaitList,
+                                                        phEventWaitList,
+                                                        phEvent);
+#else
     auto pfnImageCopyExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyExp;
     if (nullptr == pfnImageCopyExp) {
@@ -6930,6 +7703,93 @@ ur_result_t UR_APICALL urBindlessImagesImageCopyExp(
                            pSrcImageFormat, pDstImageFormat, pCopyRegion,
                            imageCopyFlags, numEventsInWaitList, phEventWaitList,
                            phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Copy many regions of image data between the same source and
+///        destination
+///
+/// @details
+///     - Copies each region as ::urBindlessImagesImageCopyBatchExp would, with a
+///       single command and event for all of them.
+///     - The regions may be copied in any order or concurrently, so the
+///       destination regions must not overlap each other.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pSrc`
+///         + `NULL == pDst`
+///         + `NULL == pSrcImageDesc`
+///         + `NULL == pDstImageDesc`
+///         + `NULL == pSrcImageFormat`
+///         + `NULL == pDstImageFormat`
+///         + `NULL == pCopyRegions`
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `::UR_EXP_IMAGE_COPY_FLAGS_MASK & imageCopyFlags`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numCopyRegions == 0`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///     - ::UR_RESULT_ERROR_INVALID_IMAGE_FORMAT_DESCRIPTOR
+///         + `pSrcImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pSrcImageDesc->type`
+///         + `pDstImageDesc && UR_MEM_TYPE_IMAGE_CUBEMAP_EXP < pDstImageDesc->type`
+///     - ::UR_RESULT_ERROR_INVALID_IMAGE_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+ur_result_t UR_APICALL urBindlessImagesImageCopyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    const void *pSrc,         ///< [in] location the data will be copied from
+    void *pDst,               ///< [in] location the data will be copied to
+    const ur_image_desc_t *pSrcImageDesc, ///< [in] pointer to image description
+    const ur_image_desc_t *pDstImageDesc, ///< [in] pointer to image description
+    const ur_image_format_t
+        *pSrcImageFormat, ///< [in] pointer to image format specification
+    const ur_image_format_t
+        *pDstImageFormat, ///< [in] pointer to image format specification
+    uint32_t numCopyRegions, ///< [in] number of regions to copy
+    const ur_exp_image_copy_region_t *
+        pCopyRegions, ///< [in][range(0, numCopyRegions)] pointer to an array of structures
+    ///< describing the (sub-)regions of source and destination images
+    ur_exp_image_copy_flags_t
+        imageCopyFlags, ///< [in] flags describing copy direction e.g. H2D or D2H
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that all
+    ///< previously enqueued commands
+    ///< must be complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+    ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
+    ///< must not refer to an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImageCopyBatchExp(
+        hQueue, pSrc, pDst, pSrcImageDesc, pDstImageDesc, pSrcImageFormat,
+        pDstImageFormat, numCopyRegions, pCopyRegions, imageCopyFlags,
+        numEventsInWaitList, phEventWaitList, phEvent);
+#else
+    auto pfnImageCopyBatchExp =
+        ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageCopyBatchExp;
+    if (nullptr == pfnImageCopyBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnImageCopyBatchExp(hQueue, pSrc, pDst, pSrcImageDesc,
+                                pDstImageDesc, pSrcImageFormat,
+                                pDstImageFormat, numCopyRegions, pCopyRegions,
+                                imageCopyFlags, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -6963,6 +7823,11 @@ ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
     void *pPropValue,         ///< [out][optional] returned query value
     size_t *pPropSizeRet      ///< [out][optional] returned query value size
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImageGetInfoExp(hContext, hImageMem,
+                                                           propName, pPropValue,
+                                                           pPropSizeRet);
+#else
     auto pfnImageGetInfoExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnImageGetInfoExp;
     if (nullptr == pfnImageGetInfoExp) {
@@ -6971,6 +7836,7 @@ ur_result_t UR_APICALL urBindlessImagesImageGetInfoExp(
 
     return pfnImageGetInfoExp(hContext, hImageMem, propName, pPropValue,
                               pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7003,6 +7869,12 @@ ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
     ur_exp_image_mem_native_handle_t
         *phImageMem ///< [out] returning memory handle to the individual image
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesMipmapGetLevelExp(hContext, hDevice,
+                                                             hImageMem,
+                                                             mipmapLevel,
+                                                             phImageMem);
+#else
     auto pfnMipmapGetLevelExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnMipmapGetLevelExp;
     if (nullptr == pfnMipmapGetLevelExp) {
@@ -7011,6 +7883,7 @@ ur_result_t UR_APICALL urBindlessImagesMipmapGetLevelExp(
 
     return pfnMipmapGetLevelExp(hContext, hDevice, hImageMem, mipmapLevel,
                                 phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7038,6 +7911,10 @@ ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     ur_exp_image_mem_native_handle_t
         hMem ///< [in][release] handle of image memory to be freed
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesMipmapFreeExp(hContext, hDevice,
+                                                         hMem);
+#else
     auto pfnMipmapFreeExp =
         ur_lib::getContext()->urDdiTable.BindlessImagesExp.pfnMipmapFreeExp;
     if (nullptr == pfnMipmapFreeExp) {
@@ -7045,6 +7922,7 @@ ur_result_t UR_APICALL urBindlessImagesMipmapFreeExp(
     }
 
     return pfnMipmapFreeExp(hContext, hDevice, hMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7083,6 +7961,11 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
     ur_exp_external_mem_handle_t
         *phExternalMem ///< [out] external memory handle to the external memory
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImportExternalMemoryExp(
+        hContext, hDevice, size, memHandleType, pExternalMemDesc,
+        phExternalMem);
+#else
     auto pfnImportExternalMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnImportExternalMemoryExp;
@@ -7092,6 +7975,7 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalMemoryExp(
 
     return pfnImportExternalMemoryExp(hContext, hDevice, size, memHandleType,
                                       pExternalMemDesc, phExternalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7130,6 +8014,14 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
     ur_exp_image_mem_native_handle_t *
         phImageMem ///< [out] image memory handle to the externally allocated memory
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesMapExternalArrayExp(hContext,
+                                                               hDevice,
+                                                               pImageFormat,
+                                                               pImageDesc,
+                                                               hExternalMem,
+                                                               phImageMem);
+#else
     auto pfnMapExternalArrayExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnMapExternalArrayExp;
@@ -7139,6 +8031,7 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalArrayExp(
 
     return pfnMapExternalArrayExp(hContext, hDevice, pImageFormat, pImageDesc,
                                   hExternalMem, phImageMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7172,6 +8065,10 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
         hExternalMem, ///< [in] external memory handle to the external memory
     void **ppRetMem   ///< [out] pointer of the externally allocated memory
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesMapExternalLinearMemoryExp(
+        hContext, hDevice, offset, size, hExternalMem, ppRetMem);
+#else
     auto pfnMapExternalLinearMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnMapExternalLinearMemoryExp;
@@ -7181,6 +8078,7 @@ ur_result_t UR_APICALL urBindlessImagesMapExternalLinearMemoryExp(
 
     return pfnMapExternalLinearMemoryExp(hContext, hDevice, offset, size,
                                          hExternalMem, ppRetMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7209,6 +8107,10 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     ur_exp_external_mem_handle_t
         hExternalMem ///< [in][release] handle of external memory to be destroyed
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesReleaseExternalMemoryExp(
+        hContext, hDevice, hExternalMem);
+#else
     auto pfnReleaseExternalMemoryExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnReleaseExternalMemoryExp;
@@ -7217,6 +8119,7 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalMemoryExp(
     }
 
     return pfnReleaseExternalMemoryExp(hContext, hDevice, hExternalMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7253,6 +8156,11 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     ur_exp_external_semaphore_handle_t *
         phExternalSemaphore ///< [out] external semaphore handle to the external semaphore
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesImportExternalSemaphoreExp(
+        hContext, hDevice, semHandleType, pExternalSemaphoreDesc,
+        phExternalSemaphore);
+#else
     auto pfnImportExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnImportExternalSemaphoreExp;
@@ -7263,6 +8171,7 @@ ur_result_t UR_APICALL urBindlessImagesImportExternalSemaphoreExp(
     return pfnImportExternalSemaphoreExp(hContext, hDevice, semHandleType,
                                          pExternalSemaphoreDesc,
                                          phExternalSemaphore);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7291,6 +8200,10 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
     ur_exp_external_semaphore_handle_t
         hExternalSemaphore ///< [in][release] handle of external semaphore to be destroyed
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesReleaseExternalSemaphoreExp(
+        hContext, hDevice, hExternalSemaphore);
+#else
     auto pfnReleaseExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnReleaseExternalSemaphoreExp;
@@ -7300,6 +8213,7 @@ ur_result_t UR_APICALL urBindlessImagesReleaseExternalSemaphoreExp(
 
     return pfnReleaseExternalSemaphoreExp(hContext, hDevice,
                                           hExternalSemaphore);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7343,6 +8257,11 @@ ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesWaitExternalSemaphoreExp(
+        hQueue, hSemaphore, hasWaitValue, waitValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnWaitExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnWaitExternalSemaphoreExp;
@@ -7353,6 +8272,7 @@ ur_result_t UR_APICALL urBindlessImagesWaitExternalSemaphoreExp(
     return pfnWaitExternalSemaphoreExp(hQueue, hSemaphore, hasWaitValue,
                                        waitValue, numEventsInWaitList,
                                        phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7397,6 +8317,11 @@ ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     ///< command instance. If phEventWaitList and phEvent are not NULL, phEvent
     ///< must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urBindlessImagesSignalExternalSemaphoreExp(
+        hQueue, hSemaphore, hasSignalValue, signalValue, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnSignalExternalSemaphoreExp =
         ur_lib::getContext()
             ->urDdiTable.BindlessImagesExp.pfnSignalExternalSemaphoreExp;
@@ -7407,6 +8332,7 @@ ur_result_t UR_APICALL urBindlessImagesSignalExternalSemaphoreExp(
     return pfnSignalExternalSemaphoreExp(hQueue, hSemaphore, hasSignalValue,
                                          signalValue, numEventsInWaitList,
                                          phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7441,6 +8367,11 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
     ur_exp_command_buffer_handle_t
         *phCommandBuffer ///< [out] Pointer to command-Buffer handle.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferCreateExp(hContext, hDevice,
+                                                    pCommandBufferDesc,
+                                                    phCommandBuffer);
+#else
     auto pfnCreateExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnCreateExp;
     if (nullptr == pfnCreateExp) {
@@ -7448,6 +8379,7 @@ ur_result_t UR_APICALL urCommandBufferCreateExp(
     }
 
     return pfnCreateExp(hContext, hDevice, pCommandBufferDesc, phCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7469,6 +8401,9 @@ ur_result_t UR_APICALL urCommandBufferRetainExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in][retain] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferRetainExp(hCommandBuffer);
+#else
     auto pfnRetainExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnRetainExp;
     if (nullptr == pfnRetainExp) {
@@ -7476,6 +8411,7 @@ ur_result_t UR_APICALL urCommandBufferRetainExp(
     }
 
     return pfnRetainExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7498,6 +8434,9 @@ ur_result_t UR_APICALL urCommandBufferReleaseExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in][release] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferReleaseExp(hCommandBuffer);
+#else
     auto pfnReleaseExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
@@ -7505,6 +8444,7 @@ ur_result_t UR_APICALL urCommandBufferReleaseExp(
     }
 
     return pfnReleaseExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7527,6 +8467,9 @@ ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     ur_exp_command_buffer_handle_t
         hCommandBuffer ///< [in] Handle of the command-buffer object.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferFinalizeExp(hCommandBuffer);
+#else
     auto pfnFinalizeExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnFinalizeExp;
     if (nullptr == pfnFinalizeExp) {
@@ -7534,6 +8477,7 @@ ur_result_t UR_APICALL urCommandBufferFinalizeExp(
     }
 
     return pfnFinalizeExp(hCommandBuffer);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7614,6 +8558,13 @@ ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendKernelLaunchExp(
+        hCommandBuffer, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendKernelLaunchExp;
@@ -7626,6 +8577,7 @@ ur_result_t UR_APICALL urCommandBufferAppendKernelLaunchExp(
         pLocalWorkSize, numKernelAlternatives, phKernelAlternatives,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7686,6 +8638,12 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendUSMMemcpyExp(
+        hCommandBuffer, pDst, pSrc, size, numSyncPointsInWaitList,
+        pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
+        phEvent, phCommand);
+#else
     auto pfnAppendUSMMemcpyExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMMemcpyExp;
     if (nullptr == pfnAppendUSMMemcpyExp) {
@@ -7696,6 +8654,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMMemcpyExp(
                                  numSyncPointsInWaitList, pSyncPointWaitList,
                                  numEventsInWaitList, phEventWaitList,
                                  pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7760,6 +8719,12 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendUSMFillExp(
+        hCommandBuffer, pMemory, pPattern, patternSize, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendUSMFillExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMFillExp;
     if (nullptr == pfnAppendUSMFillExp) {
@@ -7770,6 +8735,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMFillExp(
                                size, numSyncPointsInWaitList,
                                pSyncPointWaitList, numEventsInWaitList,
                                phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7828,6 +8794,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferCopyExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendMemBufferCopyExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyExp;
@@ -7839,6 +8811,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyExp(
         hCommandBuffer, hSrcMem, hDstMem, srcOffset, dstOffset, size,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7898,6 +8871,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferWriteExp(
+        hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
+        pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
+        phEvent, phCommand);
+#else
     auto pfnAppendMemBufferWriteExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteExp;
@@ -7909,6 +8888,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteExp(
         hCommandBuffer, hBuffer, offset, size, pSrc, numSyncPointsInWaitList,
         pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
         phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -7967,6 +8947,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferReadExp(
+        hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
+        pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
+        phEvent, phCommand);
+#else
     auto pfnAppendMemBufferReadExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadExp;
@@ -7978,6 +8964,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadExp(
         hCommandBuffer, hBuffer, offset, size, pDst, numSyncPointsInWaitList,
         pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
         phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8043,6 +9030,13 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferCopyRectExp(
+        hCommandBuffer, hSrcMem, hDstMem, srcOrigin, dstOrigin, region,
+        srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendMemBufferCopyRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferCopyRectExp;
@@ -8055,6 +9049,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferCopyRectExp(
         srcRowPitch, srcSlicePitch, dstRowPitch, dstSlicePitch,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8127,6 +9122,13 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferWriteRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendMemBufferWriteRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferWriteRectExp;
@@ -8139,6 +9141,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferWriteRectExp(
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pSrc,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8209,6 +9212,13 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferReadRectExp(
+        hCommandBuffer, hBuffer, bufferOffset, hostOffset, region,
+        bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendMemBufferReadRectExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferReadRectExp;
@@ -8221,6 +9231,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferReadRectExp(
         bufferRowPitch, bufferSlicePitch, hostRowPitch, hostSlicePitch, pDst,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8283,6 +9294,12 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendMemBufferFillExp(
+        hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
+        numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
+        phEventWaitList, pSyncPoint, phEvent, phCommand);
+#else
     auto pfnAppendMemBufferFillExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendMemBufferFillExp;
@@ -8294,6 +9311,7 @@ ur_result_t UR_APICALL urCommandBufferAppendMemBufferFillExp(
         hCommandBuffer, hBuffer, pPattern, patternSize, offset, size,
         numSyncPointsInWaitList, pSyncPointWaitList, numEventsInWaitList,
         phEventWaitList, pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8360,6 +9378,12 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendUSMPrefetchExp(
+        hCommandBuffer, pMemory, size, flags, numSyncPointsInWaitList,
+        pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
+        phEvent, phCommand);
+#else
     auto pfnAppendUSMPrefetchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnAppendUSMPrefetchExp;
@@ -8371,6 +9395,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMPrefetchExp(
                                    numSyncPointsInWaitList, pSyncPointWaitList,
                                    numEventsInWaitList, phEventWaitList,
                                    pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8437,6 +9462,12 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
     ur_exp_command_buffer_command_handle_t
         *phCommand ///< [out][optional] Handle to this command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferAppendUSMAdviseExp(
+        hCommandBuffer, pMemory, size, advice, numSyncPointsInWaitList,
+        pSyncPointWaitList, numEventsInWaitList, phEventWaitList, pSyncPoint,
+        phEvent, phCommand);
+#else
     auto pfnAppendUSMAdviseExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnAppendUSMAdviseExp;
     if (nullptr == pfnAppendUSMAdviseExp) {
@@ -8447,6 +9478,7 @@ ur_result_t UR_APICALL urCommandBufferAppendUSMAdviseExp(
                                  numSyncPointsInWaitList, pSyncPointWaitList,
                                  numEventsInWaitList, phEventWaitList,
                                  pSyncPoint, phEvent, phCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8486,6 +9518,11 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
     ///< command-buffer execution instance. If phEventWaitList and phEvent are
     ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferEnqueueExp(hCommandBuffer, hQueue,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+#else
     auto pfnEnqueueExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnEnqueueExp;
     if (nullptr == pfnEnqueueExp) {
@@ -8494,6 +9531,7 @@ ur_result_t UR_APICALL urCommandBufferEnqueueExp(
 
     return pfnEnqueueExp(hCommandBuffer, hQueue, numEventsInWaitList,
                          phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8515,6 +9553,9 @@ ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in][retain] Handle of the command-buffer command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferRetainCommandExp(hCommand);
+#else
     auto pfnRetainCommandExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnRetainCommandExp;
     if (nullptr == pfnRetainCommandExp) {
@@ -8522,6 +9563,7 @@ ur_result_t UR_APICALL urCommandBufferRetainCommandExp(
     }
 
     return pfnRetainCommandExp(hCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8544,6 +9586,9 @@ ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     ur_exp_command_buffer_command_handle_t
         hCommand ///< [in][release] Handle of the command-buffer command.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferReleaseCommandExp(hCommand);
+#else
     auto pfnReleaseCommandExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnReleaseCommandExp;
     if (nullptr == pfnReleaseCommandExp) {
@@ -8551,6 +9596,7 @@ ur_result_t UR_APICALL urCommandBufferReleaseCommandExp(
     }
 
     return pfnReleaseCommandExp(hCommand);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8594,6 +9640,10 @@ ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     const ur_exp_command_buffer_update_kernel_launch_desc_t *
         pUpdateKernelLaunch ///< [in] Struct defining how the kernel command is to be updated.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferUpdateKernelLaunchExp(
+        hCommand, pUpdateKernelLaunch);
+#else
     auto pfnUpdateKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchExp;
@@ -8602,6 +9652,7 @@ ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchExp(
     }
 
     return pfnUpdateKernelLaunchExp(hCommand, pUpdateKernelLaunch);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8637,6 +9688,10 @@ ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
         hCommand, ///< [in] Handle of the command-buffer command to update.
     ur_event_handle_t *phSignalEvent ///< [out] Event to be signaled.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferUpdateSignalEventExp(hCommand,
+                                                               phSignalEvent);
+#else
     auto pfnUpdateSignalEventExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnUpdateSignalEventExp;
@@ -8645,6 +9700,7 @@ ur_result_t UR_APICALL urCommandBufferUpdateSignalEventExp(
     }
 
     return pfnUpdateSignalEventExp(hCommand, phSignalEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8682,6 +9738,10 @@ ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
     ///< events that must be complete before the command execution. If nullptr,
     ///< the numEventsInWaitList must be 0, indicating no wait events.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferUpdateWaitEventsExp(
+        hCommand, numEventsInWaitList, phEventWaitList);
+#else
     auto pfnUpdateWaitEventsExp =
         ur_lib::getContext()
             ->urDdiTable.CommandBufferExp.pfnUpdateWaitEventsExp;
@@ -8691,6 +9751,7 @@ ur_result_t UR_APICALL urCommandBufferUpdateWaitEventsExp(
 
     return pfnUpdateWaitEventsExp(hCommand, numEventsInWaitList,
                                   phEventWaitList);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8731,6 +9792,11 @@ ur_result_t UR_APICALL urCommandBufferGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer property
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferGetInfoExp(hCommandBuffer, propName,
+                                                     propSize, pPropValue,
+                                                     pPropSizeRet);
+#else
     auto pfnGetInfoExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnGetInfoExp;
     if (nullptr == pfnGetInfoExp) {
@@ -8739,6 +9805,7 @@ ur_result_t UR_APICALL urCommandBufferGetInfoExp(
 
     return pfnGetInfoExp(hCommandBuffer, propName, propSize, pPropValue,
                          pPropSizeRet);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8779,6 +9846,12 @@ ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] bytes returned in command-buffer command property
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferCommandGetInfoExp(hCommand, propName,
+                                                            propSize,
+                                                            pPropValue,
+                                                            pPropSizeRet);
+#else
     auto pfnCommandGetInfoExp =
         ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnCommandGetInfoExp;
     if (nullptr == pfnCommandGetInfoExp) {
@@ -8787,6 +9860,130 @@ ur_result_t UR_APICALL urCommandBufferCommandGetInfoExp(
 
     return pfnCommandGetInfoExp(hCommand, propName, propSize, pPropValue,
                                 pPropSizeRet);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Update a batch of kernel launch commands in a finalized
+///        command-buffer.
+///
+/// @details
+///     - This entry-point is synchronous and may block if the command-buffer
+///       is executing when the entry-point is called.
+///     - Each element of `pUpdateKernelLaunch` describes the update of the
+///       command at the same index in `phCommands`, with the same semantics
+///       as ::urCommandBufferUpdateKernelLaunchExp.
+///     - Adapters may apply the whole batch with a single device operation,
+///       which is cheaper than updating the commands one at a time.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hCommandBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phCommands`
+///         + `NULL == pUpdateKernelLaunch`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numKernelUpdates == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If update functionality is not supported by the device.
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If ::ur_exp_command_buffer_desc_t::isUpdatable was not set to true on creation of `hCommandBuffer`.
+///         + If `hCommandBuffer` has not been finalized.
+///     - ::UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_COMMAND_HANDLE_EXP - "If any element of `phCommands` is not a kernel execution command."
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///         + `pUpdateKernelLaunch[i].newWorkDim < 1 || pUpdateKernelLaunch[i].newWorkDim > 3`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If any element of `phCommands` does not belong to `hCommandBuffer`.
+///         + If `pUpdateKernelLaunch[i].hNewKernel` was not passed to the `hKernel` or `phKernelAlternatives` parameters of ::urCommandBufferAppendKernelLaunchExp when `phCommands[i]` was created.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urCommandBufferUpdateKernelLaunchBatchExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer the commands to update belong to.
+    uint32_t
+        numKernelUpdates, ///< [in] Length of the `phCommands` and `pUpdateKernelLaunch` arrays.
+    const ur_exp_command_buffer_command_handle_t *
+        phCommands, ///< [in][range(0, numKernelUpdates)] Handles of the command-buffer kernel
+                    ///< commands to update.
+    const ur_exp_command_buffer_update_kernel_launch_desc_t *
+        pUpdateKernelLaunch ///< [in][range(0, numKernelUpdates)] Structs defining how each kernel
+                            ///< command is to be updated.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferUpdateKernelLaunchBatchExp(
+        hCommandBuffer, numKernelUpdates, phCommands, pUpdateKernelLaunch);
+#else
+    auto pfnUpdateKernelLaunchBatchExp =
+        ur_lib::getContext()
+            ->urDdiTable.CommandBufferExp.pfnUpdateKernelLaunchBatchExp;
+    if (nullptr == pfnUpdateKernelLaunchBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnUpdateKernelLaunchBatchExp(hCommandBuffer, numKernelUpdates,
+                                         phCommands, pUpdateKernelLaunch);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Upload a finalized command-buffer to the device ahead of its first
+///        enqueue.
+///
+/// @details
+///     - Uploads the resources an execution of `hCommandBuffer` needs to the
+///       device of `hQueue`, after the commands already enqueued to `hQueue`,
+///       so that its first enqueue takes no longer than the later ones.
+///     - The upload returns no event, and `hCommandBuffer` may be enqueued to
+///       any queue after it.
+///     - Adapters with nothing to upload return ::UR_RESULT_SUCCESS without
+///       doing anything.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same command-buffer handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hCommandBuffer`
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_COMMAND_BUFFER_EXP
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + If `hCommandBuffer` isn't finalized.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urCommandBufferUploadExp(
+    ur_exp_command_buffer_handle_t
+        hCommandBuffer, ///< [in] Handle of the command-buffer object.
+    ur_queue_handle_t
+        hQueue ///< [in] The queue to upload the command-buffer on.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urCommandBufferUploadExp(hCommandBuffer, hQueue);
+#else
+    auto pfnUploadExp =
+        ur_lib::getContext()->urDdiTable.CommandBufferExp.pfnUploadExp;
+    if (nullptr == pfnUploadExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnUploadExp(hCommandBuffer, hQueue);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8845,6 +10042,11 @@ ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     ///< kernel execution instance. If phEventWaitList and phEvent are not
     ///< NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueCooperativeKernelLaunchExp(
+        hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
+        pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+#else
     auto pfnCooperativeKernelLaunchExp =
         ur_lib::getContext()
             ->urDdiTable.EnqueueExp.pfnCooperativeKernelLaunchExp;
@@ -8855,6 +10057,7 @@ ur_result_t UR_APICALL urEnqueueCooperativeKernelLaunchExp(
     return pfnCooperativeKernelLaunchExp(
         hQueue, hKernel, workDim, pGlobalWorkOffset, pGlobalWorkSize,
         pLocalWorkSize, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8882,6 +10085,10 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
     ///< that will be used when the kernel is launched
     uint32_t *pGroupCountRet ///< [out] pointer to maximum number of groups
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSuggestMaxCooperativeGroupCountExp(
+        hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+#else
     auto pfnSuggestMaxCooperativeGroupCountExp =
         ur_lib::getContext()
             ->urDdiTable.KernelExp.pfnSuggestMaxCooperativeGroupCountExp;
@@ -8891,6 +10098,62 @@ ur_result_t UR_APICALL urKernelSuggestMaxCooperativeGroupCountExp(
 
     return pfnSuggestMaxCooperativeGroupCountExp(
         hKernel, localWorkSize, dynamicSharedMemorySize, pGroupCountRet);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Set many arguments of a kernel at once
+///
+/// @details
+///     - Each element of `pArgs` sets an argument with the semantics of the
+///       entry-point its `type` names, the arguments being set in order.
+///     - Adapters take the locks of the kernel once for the whole batch, so
+///       setting the arguments of a kernel with many arguments costs one call
+///       instead of one per argument.
+///     - If an argument can't be set, the arguments before it are set and the
+///       arguments after it aren't.
+///     - The application may call this function from simultaneous threads with
+///       the same kernel handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pArgs`
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numArgs == 0`
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_INVALID_SAMPLER
+///     - ::UR_RESULT_ERROR_INVALID_ENUMERATION
+///         + `pArgs[i].type > ::UR_EXP_KERNEL_ARG_TYPE_SAMPLER`
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urKernelSetArgsExp(
+    ur_kernel_handle_t hKernel, ///< [in] handle of the kernel object
+    uint32_t numArgs,           ///< [in] number of arguments to set
+    const ur_exp_kernel_arg_t *
+        pArgs ///< [in][range(0, numArgs)] pointer to an array of numArgs arguments to
+              ///< set
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urKernelSetArgsExp(hKernel, numArgs, pArgs);
+#else
+    auto pfnSetArgsExp =
+        ur_lib::getContext()->urDdiTable.KernelExp.pfnSetArgsExp;
+    if (nullptr == pfnSetArgsExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnSetArgsExp(hKernel, numArgs, pArgs);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -8932,6 +10195,12 @@ ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
     ///< device. If phEventWaitList and phEvent are not NULL, phEvent must not
     ///< refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueTimestampRecordingExp(hQueue, blocking,
+                                                          numEventsInWaitList,
+                                                          phEventWaitList,
+                                                          phEvent);
+#else
     auto pfnTimestampRecordingExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnTimestampRecordingExp;
     if (nullptr == pfnTimestampRecordingExp) {
@@ -8940,6 +10209,55 @@ ur_result_t UR_APICALL urEnqueueTimestampRecordingExp(
 
     return pfnTimestampRecordingExp(hQueue, blocking, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Wait for any of a list of events to finish.
+///
+/// @details
+///     - Returns once at least one of the events of `phEventWaitList` has
+///       completed, with `pIndex` set to the index of a completed event.
+///     - The events are polled together, the calling thread backing off
+///       between polls the longer the wait lasts.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEventWaitList`
+///         + `NULL == pIndex`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + `numEvents == 0`
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + The event at `pIndex` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEventWaitAnyExp(
+    uint32_t numEvents, ///< [in] number of events in the event list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][range(0, numEvents)] pointer to a list of events to wait for the
+                         ///< completion of any of
+    uint32_t *pIndex     ///< [out] index in `phEventWaitList` of a completed event
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventWaitAnyExp(numEvents, phEventWaitList,
+                                             pIndex);
+#else
+    auto pfnWaitAnyExp = ur_lib::getContext()->urDdiTable.EventExp.pfnWaitAnyExp;
+    if (nullptr == pfnWaitAnyExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnWaitAnyExp(numEvents, phEventWaitList, pIndex);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9021,6 +10339,12 @@ ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
     ///< NULL, phEvent must not refer to an element of the phEventWaitList
     ///< array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueKernelLaunchCustomExp(
+        hQueue, hKernel, workDim, pGlobalWorkSize, pLocalWorkSize,
+        numPropsInLaunchPropList, launchPropList, numEventsInWaitList,
+        phEventWaitList, phEvent);
+#else
     auto pfnKernelLaunchCustomExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchCustomExp;
     if (nullptr == pfnKernelLaunchCustomExp) {
@@ -9031,6 +10355,32 @@ ur_result_t UR_APICALL urEnqueueKernelLaunchCustomExp(
                                     pLocalWorkSize, numPropsInLaunchPropList,
                                     launchPropList, numEventsInWaitList,
                                     phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Forget the platforms and devices the loader has enumerated
+///
+/// @details
+///     - The loader keeps the platforms returned by ::urPlatformGet and the
+///       devices returned by ::urDeviceGet, so that each adapter is asked for
+///       them once. After this call, the next calls ask the adapters again,
+///       such as after devices were plugged or unplugged.
+///     - Handles returned before this call remain valid.
+///     - Adapters which enumerate their devices once may not report devices
+///       plugged afterwards.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///         + If the loader isn't initialized.
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+ur_result_t UR_APICALL urLoaderInvalidateEnumerationCacheExp(void) try {
+    return ur_lib::urLoaderInvalidateEnumerationCacheExp();
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9070,12 +10420,17 @@ ur_result_t UR_APICALL urProgramBuildExp(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramBuildExp(hProgram, numDevices, phDevices,
+                                             pOptions);
+#else
     auto pfnBuildExp = ur_lib::getContext()->urDdiTable.ProgramExp.pfnBuildExp;
     if (nullptr == pfnBuildExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnBuildExp(hProgram, numDevices, phDevices, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9115,6 +10470,10 @@ ur_result_t UR_APICALL urProgramCompileExp(
     const char *
         pOptions ///< [in][optional] pointer to build options null-terminated string.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramCompileExp(hProgram, numDevices, phDevices,
+                                               pOptions);
+#else
     auto pfnCompileExp =
         ur_lib::getContext()->urDdiTable.ProgramExp.pfnCompileExp;
     if (nullptr == pfnCompileExp) {
@@ -9122,6 +10481,7 @@ ur_result_t UR_APICALL urProgramCompileExp(
     }
 
     return pfnCompileExp(hProgram, numDevices, phDevices, pOptions);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9178,6 +10538,11 @@ ur_result_t UR_APICALL urProgramLinkExp(
     if (nullptr != phProgram) {
         *phProgram = nullptr;
     }
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramLinkExp(hContext, numDevices, phDevices,
+                                            count, phPrograms, pOptions,
+                                            phProgram);
+#else
     auto pfnLinkExp = ur_lib::getContext()->urDdiTable.ProgramExp.pfnLinkExp;
     if (nullptr == pfnLinkExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
@@ -9185,38 +10550,498 @@ ur_result_t UR_APICALL urProgramLinkExp(
 
     return pfnLinkExp(hContext, numDevices, phDevices, count, phPrograms,
                       pOptions, phProgram);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
 
 ///////////////////////////////////////////////////////////////////////////////
-/// @brief Import memory into USM
+/// @brief Launch kernels on many queues at once
 ///
 /// @details
-///     - Import memory into USM
+///     - Each element of `pLaunches` sets the arguments it lists on its kernel,
+///       as ::urKernelSetArgsExp, then launches the kernel on its queue, as
+///       ::urEnqueueKernelLaunch.
+///     - The launches are made in order, so a kernel launched several times in
+///       the batch takes the arguments of each launch in turn.
+///     - If a launch fails, the launches before it have been enqueued and the
+///       ones after it haven't.
+///     - All the queues must belong to the same adapter.
+///     - Adapters take the locks of the queues shared by consecutive launches
+///       once, and batch the submissions of the launches where the driver
+///       allows.
+///     - A launch listing every argument of its kernel may set them on a copy
+///       of the kernel instead, which leaves the arguments of the kernel
+///       unchanged, so that launches of one kernel from several threads don't
+///       have to be serialized.
 ///
 /// @returns
 ///     - ::UR_RESULT_SUCCESS
 ///     - ::UR_RESULT_ERROR_UNINITIALIZED
 ///     - ::UR_RESULT_ERROR_DEVICE_LOST
 ///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
-///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
-///         + `NULL == hContext`
 ///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
-///         + `NULL == pMem`
-///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///         + `NULL == pLaunches`
+///         + `NULL == pLaunches[i].pGlobalWorkSize`
+///         + `pLaunches[i].numArgs != 0 && NULL == pLaunches[i].pArgs`
 ///     - ::UR_RESULT_ERROR_INVALID_SIZE
-ur_result_t UR_APICALL urUSMImportExp(
-    ur_context_handle_t hContext, ///< [in] handle of the context object
-    void *pMem,                   ///< [in] pointer to host memory object
-    size_t size ///< [in] size in bytes of the host memory object to be imported
-    ) try {
-    auto pfnImportExp = ur_lib::getContext()->urDdiTable.USMExp.pfnImportExp;
-    if (nullptr == pfnImportExp) {
-        return UR_RESULT_ERROR_UNINITIALIZED;
+///         + `numLaunches == 0`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == pLaunches[i].hQueue`
+///         + `NULL == pLaunches[i].hKernel`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `pLaunches[i].phEventWaitList == NULL && pLaunches[i].numEventsInWaitList > 0`
+///         + `pLaunches[i].phEventWaitList != NULL && pLaunches[i].numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_INVALID_WORK_DIMENSION
+///     - ::UR_RESULT_ERROR_INVALID_WORK_GROUP_SIZE
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX
+///     - ::UR_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueKernelLaunchMultiExp(
+    uint32_t numLaunches, ///< [in] number of kernel launches
+    const ur_exp_kernel_launch_t *
+        pLaunches ///< [in][range(0, numLaunches)] pointer to an array of numLaunches
+                  ///< launches
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueKernelLaunchMultiExp(numLaunches,
+                                                         pLaunches);
+#else
+    auto pfnKernelLaunchMultiExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnKernelLaunchMultiExp;
+    if (nullptr == pfnKernelLaunchMultiExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnKernelLaunchMultiExp(numLaunches, pLaunches);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Produces an executable program from one program without blocking
+///        the calling thread
+///
+/// @details
+///     - The build is the one ::urProgramBuild makes, run in the background
+///       where the adapter supports it and before the function returns
+///       otherwise.
+///     - `phEvent` signals the end of the build. It may be waited on with
+///       ::urEventWait and used in the wait lists of commands on any queue of
+///       the context of `hQueue`, such as the launches of the kernels of
+///       `hProgram`.
+///     - The command status of `phEvent` is an error if the build failed, the
+///       build log being available with ::urProgramGetBuildInfo.
+///     - Commands enqueued on `hQueue` after this call may wait for the build
+///       to complete, as they would for any other command.
+///     - The application must not use `hProgram` until `phEvent` has
+///       completed, other than to release it.
+///     - The application may call this function from simultaneous threads.
+///
+/// @remarks
+///   _Analogues_
+///     - **clBuildProgram** with a notification callback
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hProgram`
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_INVALID_PROGRAM
+///         + If `hProgram` isn't a valid program object.
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///         + If `hProgram` and `hQueue` don't belong to the same context.
+///     - ::UR_RESULT_ERROR_PROGRAM_BUILD_FAILURE
+///         + If the adapter built `hProgram` before returning and the build
+///           failed.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urProgramBuildAsyncExp(
+    ur_program_handle_t hProgram, ///< [in] handle of the program to build
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue `phEvent` is associated with
+    const char *
+        pOptions, ///< [in][optional] pointer to build options null-terminated string.
+    ur_event_handle_t *
+        phEvent ///< [out] return an event object that signals the end of the build.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urProgramBuildAsyncExp(hProgram, hQueue, pOptions,
+                                                  phEvent);
+#else
+    auto pfnBuildAsyncExp =
+        ur_lib::getContext()->urDdiTable.ProgramExp.pfnBuildAsyncExp;
+    if (nullptr == pfnBuildAsyncExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnBuildAsyncExp(hProgram, hQueue, pOptions, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Begin capturing the commands enqueued to a queue.
+///
+/// @details
+///     - Completes the commands already enqueued to `hQueue`, then captures
+///       the commands enqueued to it until ::urQueueEndCaptureExp is called,
+///       instead of submitting them.
+///     - The captured commands execute in the order they are enqueued,
+///       whatever the properties of `hQueue`.
+///     - The events returned by captured commands may only be used in the
+///       wait lists of other commands captured from the same queue, and must
+///       not be waited on or queried.
+///     - Blocking commands and ::urQueueFinish must not be called on `hQueue`
+///       while it is capturing.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same queue handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + `hQueue` is already capturing.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + The adapter can't capture the commands of queues.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urQueueBeginCaptureExp(
+    ur_queue_handle_t
+        hQueue ///< [in] handle of the queue to capture the commands of
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueBeginCaptureExp(hQueue);
+#else
+    auto pfnBeginCaptureExp =
+        ur_lib::getContext()->urDdiTable.QueueExp.pfnBeginCaptureExp;
+    if (nullptr == pfnBeginCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnBeginCaptureExp(hQueue);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief End capturing the commands enqueued to a queue.
+///
+/// @details
+///     - Returns a command-buffer replaying the commands captured since
+///       ::urQueueBeginCaptureExp, and submits the commands enqueued to
+///       `hQueue` afterwards again.
+///     - The command-buffer is finalized, commands can't be appended to it,
+///       and is enqueued with ::urCommandBufferEnqueueExp.
+///     - The application may **not** call this function from simultaneous
+///       threads with the same queue handle.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phCommandBuffer`
+///     - ::UR_RESULT_ERROR_INVALID_OPERATION
+///         + `hQueue` isn't capturing.
+///         + A command invalid during a capture was enqueued to `hQueue`.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + The adapter can't capture the commands of queues.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urQueueEndCaptureExp(
+    ur_queue_handle_t
+        hQueue, ///< [in] handle of the queue to end capturing the commands of
+    ur_exp_command_buffer_handle_t *
+        phCommandBuffer ///< [out] pointer to the handle of the command-buffer of the captured
+                        ///< commands
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urQueueEndCaptureExp(hQueue, phCommandBuffer);
+#else
+    auto pfnEndCaptureExp =
+        ur_lib::getContext()->urDdiTable.QueueExp.pfnEndCaptureExp;
+    if (nullptr == pfnEndCaptureExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnEndCaptureExp(hQueue, phCommandBuffer);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue an allocation of USM device memory
+///
+/// @details
+///     - The memory may be used by the commands enqueued to `hQueue` after this
+///       one, and by the other commands once the returned event is complete.
+///     - The memory may be reused from the allocations freed earlier with
+///       ::urEnqueueUSMFreeExp on the same queue, without synchronizing with
+///       the device.
+///     - The memory is allocated on the device of `hQueue`, and may be freed
+///       with ::urEnqueueUSMFreeExp or ::urUSMFree.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `size == 0`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support queue-ordered allocations.
+ur_result_t UR_APICALL urEnqueueUSMDeviceAllocExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    size_t
+        size, ///< [in] size in bytes of the USM device memory object to be allocated
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be used.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    void **ppMem, ///< [out] pointer to USM device memory object
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the allocation.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMDeviceAllocExp(hQueue, size,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, ppMem,
+                                                      phEvent);
+#else
+    auto pfnUSMDeviceAllocExp = ur_lib::getContext()->urDdiTable.EnqueueExp.pfnUSMDeviceAllocExp;
+    if (nullptr == pfnUSMDeviceAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnUSMDeviceAllocExp(hQueue, size, numEventsInWaitList, phEventWaitList, ppMem, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a free of USM memory
+///
+/// @details
+///     - The memory is freed once the commands enqueued to `hQueue` before this
+///       one, and the events of the wait list, are complete.
+///     - The memory must not be used by the commands enqueued after this one.
+///     - The memory may be reused by the later allocations of
+///       ::urEnqueueUSMDeviceAllocExp on the same queue.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support queue-ordered allocations.
+ur_result_t UR_APICALL urEnqueueUSMFreeExp(
+    ur_queue_handle_t hQueue,     ///< [in] handle of the queue object
+    void *pMem,                   ///< [in] pointer to USM memory object
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the memory can be freed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies the free. If
+    ///< phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMFreeExp(hQueue, pMem,
+                                               numEventsInWaitList,
+                                               phEventWaitList, phEvent);
+#else
+    auto pfnUSMFreeExp = ur_lib::getContext()->urDdiTable.EnqueueExp.pfnUSMFreeExp;
+    if (nullptr == pfnUSMFreeExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnUSMFreeExp(hQueue, pMem, numEventsInWaitList, phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Allocate USM device memory which can grow in place
+///
+/// @details
+///     - Reserves `maxSize` bytes of virtual address space on the device, of
+///       which only the first `size` bytes are backed by physical memory.
+///     - The allocation can be grown with ::urUSMGrowExp up to `maxSize`
+///       bytes without its address changing and without its content being
+///       copied.
+///     - The memory is freed with ::urUSMFree.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + `maxSize == 0`
+///         + `size > maxSize`
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support virtual memory.
+ur_result_t UR_APICALL urUSMGrowableAllocExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t hDevice,   ///< [in] handle of the device object
+    size_t
+        maxSize, ///< [in] size in bytes of the address range reserved for the allocation
+    size_t
+        size, ///< [in] size in bytes of the memory initially backing the allocation
+    void **ppMem ///< [out] pointer to USM device memory object
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMGrowableAllocExp(hContext, hDevice, maxSize,
+                                                 size, ppMem);
+#else
+    auto pfnGrowableAllocExp =
+        ur_lib::getContext()->urDdiTable.USMExp.pfnGrowableAllocExp;
+    if (nullptr == pfnGrowableAllocExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnGrowableAllocExp(hContext, hDevice, maxSize, size, ppMem);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Grow the memory backing a growable USM allocation
+///
+/// @details
+///     - Backs at least the first `size` bytes of the allocation with physical
+///       memory, which is never copied: the content of the allocation and its
+///       address are preserved.
+///     - Allocations never shrink, growing an allocation to a size it already
+///       has does nothing.
+///     - The memory already backing the allocation may be accessed by the
+///       device and the host while the allocation grows.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If `pMem` wasn't allocated with ::urUSMGrowableAllocExp.
+///     - ::UR_RESULT_ERROR_INVALID_USM_SIZE
+///         + If `size` is larger than the `maxSize` the allocation was made
+///           with.
+///     - ::UR_RESULT_ERROR_OUT_OF_DEVICE_MEMORY
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter doesn't support growable allocations.
+ur_result_t UR_APICALL urUSMGrowExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *
+        pMem, ///< [in] pointer to USM memory allocated with ::urUSMGrowableAllocExp
+    size_t size ///< [in] size in bytes the allocation must be backed for
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMGrowExp(hContext, pMem, size);
+#else
+    auto pfnGrowExp = ur_lib::getContext()->urDdiTable.USMExp.pfnGrowExp;
+    if (nullptr == pfnGrowExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnGrowExp(hContext, pMem, size);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Import memory into USM
+///
+/// @details
+///     - Import memory into USM
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pMem`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+ur_result_t UR_APICALL urUSMImportExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    void *pMem,                   ///< [in] pointer to host memory object
+    size_t size ///< [in] size in bytes of the host memory object to be imported
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMImportExp(hContext, pMem, size);
+#else
+    auto pfnImportExp = ur_lib::getContext()->urDdiTable.USMExp.pfnImportExp;
+    if (nullptr == pfnImportExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnImportExp(hContext, pMem, size);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9241,12 +11066,16 @@ ur_result_t UR_APICALL urUSMReleaseExp(
     ur_context_handle_t hContext, ///< [in] handle of the context object
     void *pMem                    ///< [in] pointer to host memory object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMReleaseExp(hContext, pMem);
+#else
     auto pfnReleaseExp = ur_lib::getContext()->urDdiTable.USMExp.pfnReleaseExp;
     if (nullptr == pfnReleaseExp) {
         return UR_RESULT_ERROR_UNINITIALIZED;
     }
 
     return pfnReleaseExp(hContext, pMem);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9291,6 +11120,10 @@ ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUsmP2PEnablePeerAccessExp(commandDevice,
+                                                       peerDevice);
+#else
     auto pfnEnablePeerAccessExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnEnablePeerAccessExp;
     if (nullptr == pfnEnablePeerAccessExp) {
@@ -9298,6 +11131,7 @@ ur_result_t UR_APICALL urUsmP2PEnablePeerAccessExp(
     }
 
     return pfnEnablePeerAccessExp(commandDevice, peerDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9343,6 +11177,10 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
         commandDevice,            ///< [in] handle of the command device object
     ur_device_handle_t peerDevice ///< [in] handle of the peer device object
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUsmP2PDisablePeerAccessExp(commandDevice,
+                                                        peerDevice);
+#else
     auto pfnDisablePeerAccessExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnDisablePeerAccessExp;
     if (nullptr == pfnDisablePeerAccessExp) {
@@ -9350,6 +11188,7 @@ ur_result_t UR_APICALL urUsmP2PDisablePeerAccessExp(
     }
 
     return pfnDisablePeerAccessExp(commandDevice, peerDevice);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9401,6 +11240,12 @@ ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
     size_t *
         pPropSizeRet ///< [out][optional] pointer to the actual size in bytes of the queried propName.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUsmP2PPeerAccessGetInfoExp(commandDevice,
+                                                        peerDevice, propName,
+                                                        propSize, pPropValue,
+                                                        pPropSizeRet);
+#else
     auto pfnPeerAccessGetInfoExp =
         ur_lib::getContext()->urDdiTable.UsmP2PExp.pfnPeerAccessGetInfoExp;
     if (nullptr == pfnPeerAccessGetInfoExp) {
@@ -9409,6 +11254,52 @@ ur_result_t UR_APICALL urUsmP2PPeerAccessGetInfoExp(
 
     return pfnPeerAccessGetInfoExp(commandDevice, peerDevice, propName,
                                    propSize, pPropValue, pPropSizeRet);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Release the free memory cached by USM pools
+///
+/// @details
+///     - Returns the free memory kept by the pool for reuse to the device,
+///       until at most `minBytesToKeep` bytes are left cached.
+///     - If `hPool` is NULL, the pools of the context, including the pools
+///       used by ::urUSMHostAlloc, ::urUSMDeviceAlloc and ::urUSMSharedAlloc
+///       when no pool is given, are trimmed instead and share the
+///       `minBytesToKeep` budget.
+///     - Memory which is still allocated is never released.
+///     - The application may call this function from simultaneous threads.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///     - ::UR_RESULT_ERROR_INVALID_CONTEXT
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the adapter can't release the memory cached by its pools.
+ur_result_t UR_APICALL urUSMPoolTrimExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_usm_pool_handle_t
+        hPool, ///< [in][optional] handle of the USM memory pool to trim
+    size_t
+        minBytesToKeep ///< [in] number of bytes of free memory which may be left cached
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urUSMPoolTrimExp(hContext, hPool, minBytesToKeep);
+#else
+    auto pfnPoolTrimExp =
+        ur_lib::getContext()->urDdiTable.USMExp.pfnPoolTrimExp;
+    if (nullptr == pfnPoolTrimExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnPoolTrimExp(hContext, hPool, minBytesToKeep);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -9452,6 +11343,13 @@ ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     ///< been enqueued in nativeEnqueueFunc. If phEventWaitList and phEvent are
     ///< not NULL, phEvent must not refer to an element of the phEventWaitList array.
     ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueNativeCommandExp(hQueue, pfnNativeEnqueue,
+                                                     data, numMemsInMemList,
+                                                     phMemList, pProperties,
+                                                     numEventsInWaitList,
+                                                     phEventWaitList, phEvent);
+#else
     auto pfnNativeCommandExp =
         ur_lib::getContext()->urDdiTable.EnqueueExp.pfnNativeCommandExp;
     if (nullptr == pfnNativeCommandExp) {
@@ -9461,6 +11359,406 @@ ur_result_t UR_APICALL urEnqueueNativeCommandExp(
     return pfnNativeCommandExp(hQueue, pfnNativeEnqueue, data, numMemsInMemList,
                                phMemList, pProperties, numEventsInWaitList,
                                phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a function to be run on the host, in the order of the
+///        commands of a queue
+///
+/// @details
+///     - `pfnHostTask` is run on a thread of the adapter once the commands it
+///       depends on completed, without blocking the calling thread or any
+///       other application thread.
+///     - The commands it depends on are the ones of `phEventWaitList` and, on
+///       an in-order queue, the commands enqueued to `hQueue` before it.
+///     - The commands enqueued to an in-order queue after it, and the
+///       commands waiting for `phEvent`, start once `pfnHostTask` returned.
+///     - `pfnHostTask` must not call any ur function, nor block on work
+///       enqueued to a queue.
+///     - Host tasks may be run one at a time, so long-running ones delay the
+///       others.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pfnHostTask`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support host tasks, see ::UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP.
+ur_result_t UR_APICALL urEnqueueHostTaskExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_exp_host_task_function_t
+        pfnHostTask, ///< [in] function run on the host once the host task's dependencies
+                     ///< completed
+    void *pUserData, ///< [in][optional] data passed to pfnHostTask
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the host task is run.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once pfnHostTask
+                ///< returned.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueHostTaskExp(hQueue, pfnHostTask, pUserData,
+                                                numEventsInWaitList,
+                                                phEventWaitList, phEvent);
+#else
+    auto pfnHostTaskExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnHostTaskExp;
+    if (nullptr == pfnHostTaskExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnHostTaskExp(hQueue, pfnHostTask, pUserData, numEventsInWaitList,
+                          phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Create an event which can be shared with other processes
+///
+/// @details
+///     - The event is signaled by ::urEnqueueIPCEventSignalExp and waited for
+///       by ::urEnqueueIPCEventWaitExp, from queues of this process or of the
+///       processes which opened its IPC handle.
+///     - The event must not be passed to any other function than these two,
+///       ::urEventGetIPCHandleExp, ::urEventRetain and ::urEventRelease.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEventCreateIPCExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventCreateIPCExp(hContext, hDevice, phEvent);
+#else
+    auto pfnCreateIPCExp =
+        ur_lib::getContext()->urDdiTable.EventExp.pfnCreateIPCExp;
+    if (nullptr == pfnCreateIPCExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnCreateIPCExp(hContext, hDevice, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Get the IPC handle of an event, for another process to open it
+///
+/// @details
+///     - The handle is valid for as long as the event isn't released, and may
+///       be sent to other processes by any means.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hEvent`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pIPCHandle`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hEvent` wasn't created with ::urEventCreateIPCExp.
+ur_result_t UR_APICALL urEventGetIPCHandleExp(
+    ur_event_handle_t
+        hEvent, ///< [in] handle of an event created with ::urEventCreateIPCExp
+    ur_exp_ipc_event_handle_t *
+        pIPCHandle ///< [out] pointer to the IPC handle of the event
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventGetIPCHandleExp(hEvent, pIPCHandle);
+#else
+    auto pfnGetIPCHandleExp =
+        ur_lib::getContext()->urDdiTable.EventExp.pfnGetIPCHandleExp;
+    if (nullptr == pfnGetIPCHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnGetIPCHandleExp(hEvent, pIPCHandle);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Open the IPC handle of an event created by another process
+///
+/// @details
+///     - The event returned can be used as the one created with
+///       ::urEventCreateIPCExp, except that its IPC handle can't be taken.
+///     - Releasing the event closes the handle, the event of the other
+///       process remains valid.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hContext`
+///         + `NULL == hDevice`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == pIPCHandle`
+///         + `NULL == phEvent`
+///     - ::UR_RESULT_ERROR_INVALID_VALUE
+///         + If `pIPCHandle` can't be opened, for instance because it comes from this process.
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEventOpenIPCHandleExp(
+    ur_context_handle_t hContext, ///< [in] handle of the context object
+    ur_device_handle_t
+        hDevice, ///< [in] handle of the device of the queues signaling and waiting for the
+                 ///< event
+    const ur_exp_ipc_event_handle_t *
+        pIPCHandle, ///< [in] pointer to the IPC handle, from ::urEventGetIPCHandleExp in
+                    ///< another process
+    ur_event_handle_t *
+        phEvent ///< [out] pointer to the handle of the event object created
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEventOpenIPCHandleExp(hContext, hDevice,
+                                                   pIPCHandle, phEvent);
+#else
+    auto pfnOpenIPCHandleExp =
+        ur_lib::getContext()->urDdiTable.EventExp.pfnOpenIPCHandleExp;
+    if (nullptr == pfnOpenIPCHandleExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnOpenIPCHandleExp(hContext, hDevice, pIPCHandle, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command signaling an IPC event
+///
+/// @details
+///     - The event is signaled on the device once the commands the command
+///       depends on completed, without the host waiting for them.
+///     - Each signal is meant for one ::urEnqueueIPCEventWaitExp, which the
+///       application enqueues after this one, for instance once it has told
+///       the other process that it enqueued the signal.
+///     - The event must not be signaled again until that wait completed.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hIPCEvent`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hIPCEvent` wasn't created with ::urEventCreateIPCExp or ::urEventOpenIPCHandleExp.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+ur_result_t UR_APICALL urEnqueueIPCEventSignalExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to signal
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the IPC event is signaled.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that identifies this particular
+                ///< command instance.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueIPCEventSignalExp(hQueue, hIPCEvent,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
+    auto pfnIPCEventSignalExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnIPCEventSignalExp;
+    if (nullptr == pfnIPCEventSignalExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnIPCEventSignalExp(hQueue, hIPCEvent, numEventsInWaitList,
+                                phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command waiting for an IPC event to be signaled
+///
+/// @details
+///     - The commands depending on this one start once the last
+///       ::urEnqueueIPCEventSignalExp of the event enqueued before it, in
+///       this or another process, completed on the device.
+///     - The host doesn't wait for the signal.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///         + `NULL == hIPCEvent`
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///         + If `hIPCEvent` wasn't created with ::urEventCreateIPCExp or ::urEventOpenIPCHandleExp.
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///     - ::UR_RESULT_ERROR_UNSUPPORTED_FEATURE
+///         + If the device doesn't support IPC events, see ::UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP.
+ur_result_t UR_APICALL urEnqueueIPCEventWaitExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    ur_event_handle_t hIPCEvent, ///< [in] handle of the IPC event to wait for
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before the command starts waiting.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating no wait
+    ///< events.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once the IPC
+                ///< event was signaled.
+    ///< If phEventWaitList and phEvent are not NULL, phEvent must not refer to
+    ///< an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueIPCEventWaitExp(hQueue, hIPCEvent,
+                                                    numEventsInWaitList,
+                                                    phEventWaitList, phEvent);
+#else
+    auto pfnIPCEventWaitExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnIPCEventWaitExp;
+    if (nullptr == pfnIPCEventWaitExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnIPCEventWaitExp(hQueue, hIPCEvent, numEventsInWaitList,
+                              phEventWaitList, phEvent);
+#endif
+} catch (...) {
+    return exceptionToResult(std::current_exception());
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Enqueue a command to copy a batch of USM memory blocks
+///
+/// @details
+///     - Copies `pSizes[i]` bytes from `ppSrc[i]` to `ppDst[i]`, for each `i`
+///       below `numCopies`, as a single command of the queue with a single
+///       event.
+///     - The copies may run concurrently and in any order. No destination
+///       block may overlap another block of the batch.
+///
+/// @returns
+///     - ::UR_RESULT_SUCCESS
+///     - ::UR_RESULT_ERROR_UNINITIALIZED
+///     - ::UR_RESULT_ERROR_DEVICE_LOST
+///     - ::UR_RESULT_ERROR_ADAPTER_SPECIFIC
+///     - ::UR_RESULT_ERROR_INVALID_NULL_HANDLE
+///         + `NULL == hQueue`
+///     - ::UR_RESULT_ERROR_INVALID_NULL_POINTER
+///         + `NULL == ppDst`
+///         + `NULL == ppSrc`
+///         + `NULL == pSizes`
+///     - ::UR_RESULT_ERROR_INVALID_QUEUE
+///     - ::UR_RESULT_ERROR_INVALID_EVENT
+///     - ::UR_RESULT_ERROR_INVALID_SIZE
+///         + `numCopies == 0`
+///         + If any of `pSizes` is 0, or higher than the allocation size of its block
+///     - ::UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST
+///         + `phEventWaitList == NULL && numEventsInWaitList > 0`
+///         + `phEventWaitList != NULL && numEventsInWaitList == 0`
+///         + If event objects in phEventWaitList are not valid events.
+///     - ::UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+///         + An event in `phEventWaitList` has ::UR_EVENT_STATUS_ERROR.
+///     - ::UR_RESULT_ERROR_INVALID_MEM_OBJECT
+///     - ::UR_RESULT_ERROR_OUT_OF_HOST_MEMORY
+///     - ::UR_RESULT_ERROR_OUT_OF_RESOURCES
+ur_result_t UR_APICALL urEnqueueUSMMemcpyBatchExp(
+    ur_queue_handle_t hQueue, ///< [in] handle of the queue object
+    bool blocking,            ///< [in] blocking or non-blocking copy
+    uint32_t numCopies,       ///< [in] number of blocks to copy
+    void **
+        ppDst, ///< [in][range(0, numCopies)] pointers to the destination USM memory
+               ///< blocks
+    const void **
+        ppSrc, ///< [in][range(0, numCopies)] pointers to the source USM memory blocks
+    const size_t *
+        pSizes, ///< [in][range(0, numCopies)] sizes in bytes of the blocks
+    uint32_t numEventsInWaitList, ///< [in] size of the event wait list
+    const ur_event_handle_t *
+        phEventWaitList, ///< [in][optional][range(0, numEventsInWaitList)] pointer to a list of
+    ///< events that must be complete before this command can be executed.
+    ///< If nullptr, the numEventsInWaitList must be 0, indicating that this
+    ///< command does not wait on any event to complete.
+    ur_event_handle_t *
+        phEvent ///< [out][optional] return an event object that is complete once all the
+    ///< blocks were copied. If phEventWaitList and phEvent are not NULL,
+    ///< phEvent must not refer to an element of the phEventWaitList array.
+    ) try {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    return ur::level_zero::urEnqueueUSMMemcpyBatchExp(hQueue, blocking,
+                                                      numCopies, ppDst, ppSrc,
+                                                      pSizes,
+                                                      numEventsInWaitList,
+                                                      phEventWaitList, phEvent);
+#else
+    auto pfnUSMMemcpyBatchExp =
+        ur_lib::getContext()->urDdiTable.EnqueueExp.pfnUSMMemcpyBatchExp;
+    if (nullptr == pfnUSMMemcpyBatchExp) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    return pfnUSMMemcpyBatchExp(hQueue, blocking, numCopies, ppDst, ppSrc,
+                                pSizes, numEventsInWaitList, phEventWaitList,
+                                phEvent);
+#endif
 } catch (...) {
     return exceptionToResult(std::current_exception());
 }
@@ -55,6 +55,11 @@ __urdlllocal ur_result_t context_t::ddiInit() {
             urGetEventProcAddrTable(UR_API_VERSION_CURRENT, &urDdiTable.Event);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = urGetEventExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                            &urDdiTable.EventExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = urGetKernelProcAddrTable(UR_API_VERSION_CURRENT,
                                           &urDdiTable.Kernel);
@@ -94,6 +99,11 @@ __urdlllocal ur_result_t context_t::ddiInit() {
             urGetQueueProcAddrTable(UR_API_VERSION_CURRENT, &urDdiTable.Queue);
     }
 
+    if (UR_RESULT_SUCCESS == result) {
+        result = urGetQueueExpProcAddrTable(UR_API_VERSION_CURRENT,
+                                            &urDdiTable.QueueExp);
+    }
+
     if (UR_RESULT_SUCCESS == result) {
         result = urGetSamplerProcAddrTable(UR_API_VERSION_CURRENT,
                                            &urDdiTable.Sampler);
@@ -12,11 +12,634 @@
 #include "adapters/level_zero/ur_interface_loader.hpp"
 #endif
 
+#include <array>
+#include <cstring>
+#include <iterator>
+#include <thread>
+#include <utility>
+
 namespace ur_loader {
 ///////////////////////////////////////////////////////////////////////////////
 context_t *getContext() { return context_t::get_direct(); }
 
+///////////////////////////////////////////////////////////////////////////////
+/// Loads the first valid adapter library out of the candidate paths.
+static LibLoader::Lib loadAdapter(const std::vector<fs::path> &adapterPaths) {
+    for (const auto &path : adapterPaths) {
+        startup_timer::scope timer("load " + path.string());
+        auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
+        if (!handle) {
+            continue;
+        }
+        // Libraries which don't export the DDI table getters can never
+        // be dispatched to, don't let them force interception.
+        if (!LibLoader::getFunctionPtr(handle.get(),
+                                       "urGetGlobalProcAddrTable")) {
+            logger::warning("{} is not a valid adapter library, skipping",
+                            path.string());
+            continue;
+        }
+        return handle;
+    }
+    return LibLoader::Lib(nullptr);
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Maps a known adapter library name onto its backend, lazy loading relies on
+/// this to answer UR_ADAPTER_INFO_BACKEND without opening the library.
+static ur_adapter_backend_t
+getBackendFromPaths(const std::vector<fs::path> &adapterPaths) {
+    static constexpr std::pair<const char *, ur_adapter_backend_t> backends[] =
+        {
+            {"ur_adapter_level_zero", UR_ADAPTER_BACKEND_LEVEL_ZERO},
+            {"ur_adapter_opencl", UR_ADAPTER_BACKEND_OPENCL},
+            {"ur_adapter_cuda", UR_ADAPTER_BACKEND_CUDA},
+            {"ur_adapter_hip", UR_ADAPTER_BACKEND_HIP},
+            {"ur_adapter_native_cpu", UR_ADAPTER_BACKEND_NATIVE_CPU},
+        };
+    if (adapterPaths.empty()) {
+        return UR_ADAPTER_BACKEND_UNKNOWN;
+    }
+    auto filename = adapterPaths.front().filename().string();
+    for (const auto &[name, backend] : backends) {
+        if (filename.find(name) != std::string::npos) {
+            return backend;
+        }
+    }
+    return UR_ADAPTER_BACKEND_UNKNOWN;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+/// Fetches all DDI tables of a lazily opened adapter library. This mirrors the
+/// per-platform part of the generated urGet*ProcAddrTable functions.
+static ur_result_t getAdapterDdiTables(HMODULE handle,
+                                       ur_api_version_t version,
+                                       dditable_t &dditable) {
+#define UR_LAZY_GET_TABLE(TABLE, NAME)                                         \
+    do {                                                                       \
+        auto getTable = reinterpret_cast<ur_pfnGet##TABLE##ProcAddrTable_t>(   \
+            LibLoader::getFunctionPtr(handle, "urGet" #TABLE "ProcAddrTable")); \
+        if (getTable) {                                                        \
+            auto result = getTable(version, &dditable.ur.NAME);                \
+            if (result != UR_RESULT_SUCCESS) {                                 \
+                return result;                                                 \
+            }                                                                  \
+        }                                                                      \
+    } while (0)
+
+    UR_LAZY_GET_TABLE(Global, Global);
+    UR_LAZY_GET_TABLE(BindlessImagesExp, BindlessImagesExp);
+    UR_LAZY_GET_TABLE(CommandBufferExp, CommandBufferExp);
+    UR_LAZY_GET_TABLE(Context, Context);
+    UR_LAZY_GET_TABLE(Enqueue, Enqueue);
+    UR_LAZY_GET_TABLE(EnqueueExp, EnqueueExp);
+    UR_LAZY_GET_TABLE(Event, Event);
+    UR_LAZY_GET_TABLE(EventExp, EventExp);
+    UR_LAZY_GET_TABLE(Kernel, Kernel);
+    UR_LAZY_GET_TABLE(KernelExp, KernelExp);
+    UR_LAZY_GET_TABLE(Mem, Mem);
+    UR_LAZY_GET_TABLE(PhysicalMem, PhysicalMem);
+    UR_LAZY_GET_TABLE(Platform, Platform);
+    UR_LAZY_GET_TABLE(Program, Program);
+    UR_LAZY_GET_TABLE(ProgramExp, ProgramExp);
+    UR_LAZY_GET_TABLE(Queue, Queue);
+    UR_LAZY_GET_TABLE(QueueExp, QueueExp);
+    UR_LAZY_GET_TABLE(Sampler, Sampler);
+    UR_LAZY_GET_TABLE(USM, USM);
+    UR_LAZY_GET_TABLE(USMExp, USMExp);
+    UR_LAZY_GET_TABLE(UsmP2PExp, UsmP2PExp);
+    UR_LAZY_GET_TABLE(VirtualMem, VirtualMem);
+    UR_LAZY_GET_TABLE(Device, Device);
+
+#undef UR_LAZY_GET_TABLE
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+// Lazily loaded adapters are represented by a placeholder native adapter
+// handle, which is the address of their platform_t entry. Until the library
+// is opened, their dditable only contains the stubs below, which open it on
+// first real use. The stubs stay in place afterwards, since other threads may
+// read them at any time, and forward to the adapter's own entry points. The
+// other entries are only filled in once, when the library is opened, and are
+// read through platform, device and context objects, which can only be
+// obtained after that.
+namespace lazy {
+static constexpr size_t maxLazyPlatforms = 8;
+
+static platform_t *getPlatform(ur_adapter_handle_t hAdapter) {
+    return reinterpret_cast<platform_t *>(hAdapter);
+}
+
+// Fills in the entries of a lazy platform's table its stubs don't occupy,
+// one pointer-sized entry at a time so that the stubs are never written.
+static void fillUnstubbedEntries(dditable_t &dditable,
+                                 const dditable_t &loaded) {
+    using entry_t = void (*)();
+    static_assert(sizeof(dditable_t) % sizeof(entry_t) == 0);
+    auto dst = reinterpret_cast<unsigned char *>(&dditable);
+    auto src = reinterpret_cast<const unsigned char *>(&loaded);
+    for (size_t offset = 0; offset < sizeof(dditable_t);
+         offset += sizeof(entry_t)) {
+        entry_t entry = nullptr;
+        std::memcpy(&entry, dst + offset, sizeof(entry_t));
+        if (entry == nullptr) {
+            std::memcpy(dst + offset, src + offset, sizeof(entry_t));
+        }
+    }
+}
+
+static ur_result_t ensureLoaded(platform_t &platform) {
+    auto &lazy = *platform.lazy;
+    if (lazy.loaded.load(std::memory_order_acquire)) {
+        return lazy.status;
+    }
+
+    auto context = getContext();
+    std::lock_guard<std::mutex> lk(context->lazyLoadMutex);
+    if (lazy.loaded.load(std::memory_order_relaxed)) {
+        return lazy.status;
+    }
+
+#ifdef _WIN32
+    UINT SavedMode = SetErrorMode(SEM_FAILCRITICALERRORS);
+#endif
+    platform.handle = loadAdapter(platform.lazyPaths);
+#ifdef _WIN32
+    (void)SetErrorMode(SavedMode);
+#endif
+
+    lazy.status = platform.handle
+                      ? getAdapterDdiTables(platform.handle.get(),
+                                            context->version, lazy.dditable)
+                      : UR_RESULT_ERROR_UNINITIALIZED;
+    if (lazy.status == UR_RESULT_SUCCESS) {
+        lazy.status =
+            lazy.dditable.ur.Global.pfnAdapterGet(1, &lazy.hAdapter, nullptr);
+    }
+    if (lazy.status == UR_RESULT_SUCCESS) {
+        // transfer the references handed out before the library was opened
+        for (uint32_t i = 1; i < platform.lazyRefCount; i++) {
+            lazy.dditable.ur.Global.pfnAdapterRetain(lazy.hAdapter);
+        }
+        fillUnstubbedEntries(platform.dditable, lazy.dditable);
+        logger::info("lazily loaded adapter {}",
+                     platform.lazyPaths.front().string());
+    } else {
+        // keep the stubs, the adapter simply reports no platforms
+        logger::info("failed to lazily load adapter {}",
+                     platform.lazyPaths.front().string());
+    }
+    lazy.loaded.store(true, std::memory_order_release);
+    return lazy.status;
+}
+
+// Returns the adapter behind the stubs if its library has been opened. The
+// references counted until then were transferred to it.
+static lazy_adapter_t *getLoaded(platform_t &platform) {
+    auto &lazy = *platform.lazy;
+    if (!lazy.loaded.load(std::memory_order_acquire) ||
+        lazy.status != UR_RESULT_SUCCESS) {
+        return nullptr;
+    }
+    return &lazy;
+}
+
+// Counts a reference to an adapter whose library hasn't been opened yet,
+// returns false if it has been opened in the meantime.
+static bool countReference(platform_t &platform, bool retain) {
+    if (platform.lazy->loaded.load(std::memory_order_acquire)) {
+        return false;
+    }
+    std::lock_guard<std::mutex> lk(getContext()->lazyLoadMutex);
+    if (platform.lazy->loaded.load(std::memory_order_relaxed)) {
+        return false;
+    }
+    if (retain) {
+        platform.lazyRefCount++;
+    } else if (platform.lazyRefCount > 0) {
+        platform.lazyRefCount--;
+    }
+    return true;
+}
+
+// The loader calls urAdapterGet through each platform's own table without
+// saying which platform it is querying, so every lazy platform gets a stub
+// instantiated for its index in context_t::platforms.
+template <size_t Index>
+static ur_result_t UR_APICALL urAdapterGet(uint32_t NumEntries,
+                                           ur_adapter_handle_t *phAdapters,
+                                           uint32_t *pNumAdapters) {
+    if (NumEntries > 0 && phAdapters) {
+        auto &platform = getContext()->platforms[Index];
+        if (!countReference(platform, true)) {
+            if (auto lazy = getLoaded(platform)) {
+                auto result =
+                    lazy->dditable.ur.Global.pfnAdapterRetain(lazy->hAdapter);
+                if (result != UR_RESULT_SUCCESS) {
+                    return result;
+                }
+            }
+        }
+        *phAdapters = reinterpret_cast<ur_adapter_handle_t>(&platform);
+    }
+    if (pNumAdapters) {
+        *pNumAdapters = 1;
+    }
+    return UR_RESULT_SUCCESS;
+}
+
+template <size_t... Is>
+static constexpr std::array<ur_pfnAdapterGet_t, sizeof...(Is)>
+makeAdapterGetStubs(std::index_sequence<Is...>) {
+    return {urAdapterGet<Is>...};
+}
+
+static constexpr auto adapterGetStubs =
+    makeAdapterGetStubs(std::make_index_sequence<maxLazyPlatforms>{});
+
+static ur_result_t UR_APICALL urAdapterRetain(ur_adapter_handle_t hAdapter) {
+    auto platform = getPlatform(hAdapter);
+    if (countReference(*platform, true)) {
+        return UR_RESULT_SUCCESS;
+    }
+    auto lazy = getLoaded(*platform);
+    return lazy ? lazy->dditable.ur.Global.pfnAdapterRetain(lazy->hAdapter)
+                : UR_RESULT_SUCCESS;
+}
+
+static ur_result_t UR_APICALL urAdapterRelease(ur_adapter_handle_t hAdapter) {
+    auto platform = getPlatform(hAdapter);
+    if (countReference(*platform, false)) {
+        return UR_RESULT_SUCCESS;
+    }
+    auto lazy = getLoaded(*platform);
+    return lazy ? lazy->dditable.ur.Global.pfnAdapterRelease(lazy->hAdapter)
+                : UR_RESULT_SUCCESS;
+}
+
+static ur_result_t UR_APICALL urAdapterGetLastError(
+    ur_adapter_handle_t hAdapter, const char **ppMessage, int32_t *pError) {
+    auto platform = getPlatform(hAdapter);
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto &lazy = *platform->lazy;
+    return lazy.dditable.ur.Global.pfnAdapterGetLastError(lazy.hAdapter,
+                                                          ppMessage, pError);
+}
+
+static ur_result_t UR_APICALL urAdapterGetInfo(ur_adapter_handle_t hAdapter,
+                                               ur_adapter_info_t propName,
+                                               size_t propSize,
+                                               void *pPropValue,
+                                               size_t *pPropSizeRet) {
+    auto platform = getPlatform(hAdapter);
+    if (propName == UR_ADAPTER_INFO_BACKEND &&
+        platform->lazyBackend != UR_ADAPTER_BACKEND_UNKNOWN) {
+        if (pPropValue && propSize < sizeof(ur_adapter_backend_t)) {
+            return UR_RESULT_ERROR_INVALID_SIZE;
+        }
+        if (pPropValue) {
+            std::memcpy(pPropValue, &platform->lazyBackend,
+                        sizeof(ur_adapter_backend_t));
+        }
+        if (pPropSizeRet) {
+            *pPropSizeRet = sizeof(ur_adapter_backend_t);
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto &lazy = *platform->lazy;
+    return lazy.dditable.ur.Global.pfnAdapterGetInfo(
+        lazy.hAdapter, propName, propSize, pPropValue, pPropSizeRet);
+}
+
+static ur_result_t UR_APICALL urPlatformGet(ur_adapter_handle_t *phAdapters,
+                                            uint32_t NumAdapters,
+                                            uint32_t NumEntries,
+                                            ur_platform_handle_t *phPlatforms,
+                                            uint32_t *pNumPlatforms) {
+    // this receives the loader's adapter object, see context_t::getPlatforms
+    auto loaderAdapter = reinterpret_cast<ur_adapter_object_t *>(phAdapters[0]);
+    auto platform = getPlatform(loaderAdapter->handle);
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        // the library couldn't be opened, it has no platforms to offer
+        if (pNumPlatforms) {
+            *pNumPlatforms = 0;
+        }
+        return UR_RESULT_SUCCESS;
+    }
+    return platform->lazy->dditable.ur.Platform.pfnGet(
+        phAdapters, NumAdapters, NumEntries, phPlatforms, pNumPlatforms);
+}
+
+// The native handle entry points are the only others which take an adapter
+// handle, and so may be called before the library is opened.
+static ur_result_t UR_APICALL urPlatformCreateWithNativeHandle(
+    ur_native_handle_t hNativePlatform, ur_adapter_handle_t hAdapter,
+    const ur_platform_native_properties_t *pProperties,
+    ur_platform_handle_t *phPlatform) {
+    auto platform = getPlatform(hAdapter);
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto &lazy = *platform->lazy;
+    auto pfnCreateWithNativeHandle =
+        lazy.dditable.ur.Platform.pfnCreateWithNativeHandle;
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    return pfnCreateWithNativeHandle(hNativePlatform, lazy.hAdapter,
+                                     pProperties, phPlatform);
+}
+
+static ur_result_t UR_APICALL urDeviceCreateWithNativeHandle(
+    ur_native_handle_t hNativeDevice, ur_adapter_handle_t hAdapter,
+    const ur_device_native_properties_t *pProperties,
+    ur_device_handle_t *phDevice) {
+    auto platform = getPlatform(hAdapter);
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto &lazy = *platform->lazy;
+    auto pfnCreateWithNativeHandle =
+        lazy.dditable.ur.Device.pfnCreateWithNativeHandle;
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    return pfnCreateWithNativeHandle(hNativeDevice, lazy.hAdapter,
+                                     pProperties, phDevice);
+}
+
+static ur_result_t UR_APICALL urContextCreateWithNativeHandle(
+    ur_native_handle_t hNativeContext, ur_adapter_handle_t hAdapter,
+    uint32_t numDevices, const ur_device_handle_t *phDevices,
+    const ur_context_native_properties_t *pProperties,
+    ur_context_handle_t *phContext) {
+    auto platform = getPlatform(hAdapter);
+    if (ensureLoaded(*platform) != UR_RESULT_SUCCESS) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    auto &lazy = *platform->lazy;
+    auto pfnCreateWithNativeHandle =
+        lazy.dditable.ur.Context.pfnCreateWithNativeHandle;
+    if (nullptr == pfnCreateWithNativeHandle) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+    return pfnCreateWithNativeHandle(hNativeContext, lazy.hAdapter,
+                                     numDevices, phDevices, pProperties,
+                                     phContext);
+}
+
+static void installStubs(platform_t &platform, size_t index) {
+    platform.lazy = std::make_unique<lazy_adapter_t>();
+    auto &global = platform.dditable.ur.Global;
+    global.pfnAdapterGet = adapterGetStubs[index];
+    global.pfnAdapterRetain = urAdapterRetain;
+    global.pfnAdapterRelease = urAdapterRelease;
+    global.pfnAdapterGetLastError = urAdapterGetLastError;
+    global.pfnAdapterGetInfo = urAdapterGetInfo;
+    platform.dditable.ur.Platform.pfnGet = urPlatformGet;
+    platform.dditable.ur.Platform.pfnCreateWithNativeHandle =
+        urPlatformCreateWithNativeHandle;
+    platform.dditable.ur.Device.pfnCreateWithNativeHandle =
+        urDeviceCreateWithNativeHandle;
+    platform.dditable.ur.Context.pfnCreateWithNativeHandle =
+        urContextCreateWithNativeHandle;
+}
+} // namespace lazy
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::recordDiscovery(platform_t &platform,
+                                const std::vector<fs::path> &adapterPaths) {
+    auto &cache = adapter_registry.getDiscoveryCache();
+    if (!cache.has_value() || adapterPaths.empty()) {
+        return;
+    }
+    platform.cacheKey = adapterPaths.front().filename().string();
+    auto libPath = getAdapterLibPath(LibLoader::getFunctionPtr(
+        platform.handle.get(), "urGetGlobalProcAddrTable"));
+    if (libPath.has_value()) {
+        cache->update(platform.cacheKey, *libPath);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::prefetchPlatforms(ur_adapter_handle_t *phAdapters,
+                                  uint32_t NumAdapters) {
+    auto &cache = adapter_registry.getDiscoveryCache();
+    if (NumAdapters < 2 && !cache.has_value()) {
+        return;
+    }
+    bool parallel = getenv_tobool("UR_LOADER_PARALLEL_INIT", true);
+
+    std::call_once(prefetchOnce, [&]() {
+        std::vector<std::thread> threads;
+        std::vector<int64_t> counts(NumAdapters, -1);
+        for (uint32_t i = 0; i < NumAdapters; i++) {
+            auto adapter = reinterpret_cast<ur_adapter_object_t *>(phAdapters[i]);
+            auto prefetch = [adapter, hAdapter = &phAdapters[i],
+                             pCount = &counts[i], i]() {
+                // lazily loaded adapters are left alone until they are used
+                auto pfnGet = adapter->dditable->ur.Platform.pfnGet;
+                if (!pfnGet || pfnGet == lazy::urPlatformGet) {
+                    return;
+                }
+                startup_timer::scope timer("platform discovery of adapter " +
+                                           std::to_string(i));
+                uint32_t count = 0;
+                if (pfnGet(hAdapter, 1, 0, nullptr, &count) ==
+                    UR_RESULT_SUCCESS) {
+                    *pCount = count;
+                }
+            };
+            if (!parallel || NumAdapters < 2) {
+                prefetch();
+                continue;
+            }
+            try {
+                threads.emplace_back(prefetch);
+            } catch (std::system_error &) {
+                // couldn't spawn a thread, do the work inline
+                prefetch();
+            }
+        }
+        for (auto &thread : threads) {
+            thread.join();
+        }
+
+        if (!cache.has_value()) {
+            return;
+        }
+        for (uint32_t i = 0; i < NumAdapters; i++) {
+            auto adapter = reinterpret_cast<ur_adapter_object_t *>(phAdapters[i]);
+            for (auto &platform : platforms) {
+                if (&platform.dditable == adapter->dditable &&
+                    !platform.cacheKey.empty() && counts[i] >= 0) {
+                    cache->setNumPlatforms(platform.cacheKey,
+                                           static_cast<uint32_t>(counts[i]));
+                }
+            }
+        }
+        cache->save();
+    });
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t
+context_t::getPlatforms(ur_adapter_handle_t hAdapter,
+                        std::vector<ur_platform_handle_t> &phPlatforms) {
+    uint64_t generation = 0;
+    if (enumerationCache.enabled) {
+        std::lock_guard<std::mutex> lk(enumerationCache.mutex);
+        auto it = enumerationCache.platforms.find(hAdapter);
+        if (it != enumerationCache.platforms.end()) {
+            phPlatforms = it->second;
+            return UR_RESULT_SUCCESS;
+        }
+        generation = enumerationCache.generation;
+    }
+
+    // The adapter is asked without holding the lock, as its first
+    // enumeration initializes its driver, and threads racing to enumerate the
+    // same platforms get the same loader handles anyway.
+    auto adapter = reinterpret_cast<ur_adapter_object_t *>(hAdapter);
+    auto dditable = adapter->dditable;
+    auto pfnGet = dditable->ur.Platform.pfnGet;
+    if (nullptr == pfnGet) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    try {
+        // Adapters get the loader's adapter handle, as they always have, since
+        // the placeholders of lazily loaded adapters can only be resolved from
+        // it, see lazy::urPlatformGet.
+        uint32_t count = 0;
+        auto result = pfnGet(&hAdapter, 1, 0, nullptr, &count);
+        if (UR_RESULT_SUCCESS != result) {
+            return result;
+        }
+        phPlatforms.resize(count);
+        if (count > 0) {
+            result = pfnGet(&hAdapter, 1, count, phPlatforms.data(), nullptr);
+            if (UR_RESULT_SUCCESS != result) {
+                return result;
+            }
+        }
+
+        // convert platform handles to loader handles
+        for (auto &hPlatform : phPlatforms) {
+            hPlatform = reinterpret_cast<ur_platform_handle_t>(
+                factories.ur_platform_factory.getInstance(hPlatform, dditable));
+        }
+
+        if (enumerationCache.enabled) {
+            std::lock_guard<std::mutex> lk(enumerationCache.mutex);
+            if (generation == enumerationCache.generation) {
+                enumerationCache.platforms.try_emplace(hAdapter, phPlatforms);
+            }
+        }
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+ur_result_t context_t::getDevices(ur_platform_handle_t hPlatform,
+                                  ur_device_type_t DeviceType,
+                                  std::vector<ur_device_handle_t> &phDevices) {
+    uint64_t generation = 0;
+    if (enumerationCache.enabled) {
+        std::lock_guard<std::mutex> lk(enumerationCache.mutex);
+        auto it = enumerationCache.devices.find({hPlatform, DeviceType});
+        if (it != enumerationCache.devices.end()) {
+            phDevices = it->second;
+            return UR_RESULT_SUCCESS;
+        }
+        generation = enumerationCache.generation;
+    }
+
+    auto platform = reinterpret_cast<ur_platform_object_t *>(hPlatform);
+    auto dditable = platform->dditable;
+    auto pfnGet = dditable->ur.Device.pfnGet;
+    if (nullptr == pfnGet) {
+        return UR_RESULT_ERROR_UNINITIALIZED;
+    }
+
+    try {
+        uint32_t count = 0;
+        auto result = pfnGet(platform->handle, DeviceType, 0, nullptr, &count);
+        if (UR_RESULT_SUCCESS != result) {
+            return result;
+        }
+        phDevices.resize(count);
+        if (count > 0) {
+            result = pfnGet(platform->handle, DeviceType, count,
+                            phDevices.data(), nullptr);
+            if (UR_RESULT_SUCCESS != result) {
+                return result;
+            }
+        }
+
+        // convert device handles to loader handles
+        for (auto &hDevice : phDevices) {
+            hDevice = reinterpret_cast<ur_device_handle_t>(
+                factories.ur_device_factory.getInstance(hDevice, dditable));
+        }
+
+        if (enumerationCache.enabled) {
+            std::lock_guard<std::mutex> lk(enumerationCache.mutex);
+            if (generation == enumerationCache.generation) {
+                enumerationCache.devices.try_emplace({hPlatform, DeviceType},
+                                                     phDevices);
+            }
+        }
+    } catch (std::bad_alloc &) {
+        return UR_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+
+    return UR_RESULT_SUCCESS;
+}
+
+///////////////////////////////////////////////////////////////////////////////
+void context_t::invalidateEnumeration(ur_adapter_handle_t hAdapter) {
+    std::lock_guard<std::mutex> lk(enumerationCache.mutex);
+    enumerationCache.generation++;
+    if (nullptr == hAdapter) {
+        enumerationCache.platforms.clear();
+        enumerationCache.devices.clear();
+        return;
+    }
+
+    enumerationCache.platforms.erase(hAdapter);
+    // The devices of the adapter's platforms share its dditable, which also
+    // catches platforms created from native handles
+    auto dditable = reinterpret_cast<ur_adapter_object_t *>(hAdapter)->dditable;
+    auto &devices = enumerationCache.devices;
+    for (auto it = devices.begin(); it != devices.end();) {
+        auto platform =
+            reinterpret_cast<ur_platform_object_t *>(it->first.first);
+        it = platform->dditable == dditable ? devices.erase(it) : std::next(it);
+    }
+}
+
+///////////////////////////////////////////////////////////////////////////////
 ur_result_t context_t::init() {
+#ifdef UR_STATIC_DIRECT_DISPATCH
+    // The API entry points call the static adapter directly, so it is the
+    // only one in use and no other adapter is loaded.
+    auto &level_zero = platforms.emplace_back(nullptr);
+    ur::level_zero::urAdapterGetDdiTables(&level_zero.dditable.ur);
+    logger::info("loader direct dispatch to the static Level Zero adapter");
+    return UR_RESULT_SUCCESS;
+#endif
+
 #ifdef _WIN32
     // Suppress system errors.
     // Tells the system to not display the critical-error-handler message box.
@@ -33,31 +656,61 @@ ur_result_t context_t::init() {
     // If the adapters were force loaded, it means the user wants to use
     // a specific adapter library. Don't load any static adapters.
     if (!adapter_registry.adaptersForceLoaded()) {
+        startup_timer::scope timer("static adapter level_zero");
         auto &level_zero = platforms.emplace_back(nullptr);
         ur::level_zero::urAdapterGetDdiTables(&level_zero.dditable.ur);
     }
 #endif
 
+    // Lazy loading defers opening known adapter libraries, and with them the
+    // initialization of their drivers, until the adapter is actually used.
+    bool lazyLoad = getenv_tobool("UR_ADAPTERS_LAZY_LOAD") &&
+                    !adapter_registry.adaptersForceLoaded();
+
+    // Placeholder handles point into the vector, it must not reallocate.
+    platforms.reserve(platforms.size() + adapter_registry.size());
     for (const auto &adapterPaths : adapter_registry) {
-        for (const auto &path : adapterPaths) {
-            auto handle = LibLoader::loadAdapterLibrary(path.string().c_str());
-            if (handle) {
-                platforms.emplace_back(std::move(handle));
-                break;
-            }
+        auto backend = getBackendFromPaths(adapterPaths);
+        if (lazyLoad && backend != UR_ADAPTER_BACKEND_UNKNOWN &&
+            platforms.size() < lazy::maxLazyPlatforms) {
+            auto &platform = platforms.emplace_back(nullptr);
+            platform.lazyPaths = adapterPaths;
+            platform.lazyBackend = backend;
+            lazy::installStubs(platform, platforms.size() - 1);
+            continue;
+        }
+
+        auto handle = loadAdapter(adapterPaths);
+        if (handle) {
+            auto &platform = platforms.emplace_back(std::move(handle));
+            recordDiscovery(platform, adapterPaths);
         }
     }
+    if (auto &cache = adapter_registry.getDiscoveryCache()) {
+        cache->save();
+    }
 #ifdef _WIN32
     // Restore system error handling.
     (void)SetErrorMode(SavedMode);
 #endif
 
     forceIntercept = getenv_tobool("UR_ENABLE_LOADER_INTERCEPT");
+    enumerationCache.enabled =
+        getenv_tobool("UR_LOADER_ENUMERATION_CACHE", true);
 
-    if (forceIntercept || platforms.size() > 1) {
+    // Lazily loaded adapters are only reachable through the loader's DDIs.
+    // Without any adapter there are no tables to pass through, the loader's
+    // DDIs report that no adapters were found.
+    if (forceIntercept || lazyLoad || platforms.size() != 1) {
         intercept_enabled = true;
     }
 
+    // With a single adapter the loader hands out the adapter's own DDI
+    // tables, so handles are not wrapped and calls are not redirected.
+    logger::info("loader interception {}, {} adapter(s) loaded",
+                 intercept_enabled ? "enabled" : "disabled (passthrough)",
+                 platforms.size());
+
     return UR_RESULT_SUCCESS;
 }
 
@@ -16,8 +16,26 @@
 #include "ur_ldrddi.hpp"
 #include "ur_lib_loader.hpp"
 
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
 namespace ur_loader {
 
+/// The adapter behind the stubs of a lazily loaded platform. Everything but
+/// `loaded` is written once, by the thread opening the library, before
+/// `loaded` is set with release semantics, and only read after observing it.
+struct lazy_adapter_t {
+    std::atomic<bool> loaded = false;
+    ur_result_t status = UR_RESULT_SUCCESS;
+    ur_adapter_handle_t hAdapter = nullptr;
+    dditable_t dditable = {};
+};
+
 struct platform_t {
     platform_t(std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle)
         : handle(std::move(handle)) {}
@@ -25,10 +43,38 @@ struct platform_t {
     std::unique_ptr<HMODULE, LibLoader::lib_dtor> handle;
     ur_result_t initStatus = UR_RESULT_SUCCESS;
     dditable_t dditable = {};
+
+    // State of an adapter whose library is opened on first use, see
+    // UR_ADAPTERS_LAZY_LOAD.
+    std::unique_ptr<lazy_adapter_t> lazy;
+    std::vector<fs::path> lazyPaths;
+    ur_adapter_backend_t lazyBackend = UR_ADAPTER_BACKEND_UNKNOWN;
+    uint32_t lazyRefCount = 0;
+
+    // Key of the adapter in the discovery cache, if one is in use.
+    std::string cacheKey;
 };
 
 using platform_vector_t = std::vector<platform_t>;
 
+/// Platforms and devices enumerated through the loader's DDIs, already
+/// wrapped, so that urPlatformGet and urDeviceGet only ask the adapters once.
+/// See UR_LOADER_ENUMERATION_CACHE.
+struct enumeration_cache_t {
+    bool enabled = true;
+    std::mutex mutex;
+    // Incremented on every invalidation, so that the results of enumerations
+    // which raced with one aren't cached
+    uint64_t generation = 0;
+    // By loader adapter handle
+    std::unordered_map<ur_adapter_handle_t, std::vector<ur_platform_handle_t>>
+        platforms;
+    // By loader platform handle and device type
+    std::map<std::pair<ur_platform_handle_t, ur_device_type_t>,
+             std::vector<ur_device_handle_t>>
+        devices;
+};
+
 class context_t : public AtomicSingleton<context_t> {
   public:
     ur_api_version_t version = UR_API_VERSION_CURRENT;
@@ -37,8 +83,41 @@ class context_t : public AtomicSingleton<context_t> {
     AdapterRegistry adapter_registry;
 
     bool forceIntercept = false;
+    std::mutex lazyLoadMutex;
 
     ur_result_t init();
+
+    /// Enumerates the platforms of the given loader adapter handles on
+    /// separate threads, once per process. Most of an adapter's startup cost
+    /// is driver initialization on its first urPlatformGet, doing this
+    /// concurrently makes startup take the longest adapter's time rather than
+    /// the sum of all of them.
+    void prefetchPlatforms(ur_adapter_handle_t *phAdapters,
+                           uint32_t NumAdapters);
+    std::once_flag prefetchOnce;
+
+    void recordDiscovery(platform_t &platform,
+                         const std::vector<fs::path> &adapterPaths);
+
+    /// Returns the loader handles of the platforms of hAdapter, a loader
+    /// handle, from the enumeration cache if they are in it.
+    ur_result_t getPlatforms(ur_adapter_handle_t hAdapter,
+                             std::vector<ur_platform_handle_t> &phPlatforms);
+    /// Returns the loader handles of the devices of type DeviceType of
+    /// hPlatform, a loader handle, from the enumeration cache if they are in
+    /// it.
+    ur_result_t getDevices(ur_platform_handle_t hPlatform,
+                           ur_device_type_t DeviceType,
+                           std::vector<ur_device_handle_t> &phDevices);
+    /// Drops the platforms of hAdapter and their devices from the
+    /// enumeration cache, as an adapter may destroy them once released, or
+    /// the whole cache if hAdapter is null.
+    void invalidateEnumeration(ur_adapter_handle_t hAdapter = nullptr);
+    enumeration_cache_t enumerationCache;
+
+    /// true when handles must be wrapped and calls redirected through the
+    /// loader's DDIs, i.e. when more than one adapter is loaded or when
+    /// UR_ENABLE_LOADER_INTERCEPT is set
     bool intercept_enabled = false;
 
     struct handle_factories factories;
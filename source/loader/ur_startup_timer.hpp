@@ -0,0 +1,85 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ */
+#ifndef UR_STARTUP_TIMER_HPP
+#define UR_STARTUP_TIMER_HPP 1
+
+#include <chrono>
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "logger/ur_logger.hpp"
+
+namespace ur_loader {
+
+/// Durations of the phases of the loader's startup: the search for adapter
+/// libraries, loading them, getting their DDI tables, initializing the layers
+/// and the first platform discovery of each adapter, which initializes its
+/// driver. They are logged at info level as "startup: <phase>: <us> us", the
+/// phases which end before the logger is initialized once urLoaderInit has
+/// initialized it.
+class startup_timer {
+  public:
+    using clock = std::chrono::steady_clock;
+
+    static startup_timer &get() {
+        static startup_timer timer;
+        return timer;
+    }
+
+    void record(std::string phase, clock::duration duration) {
+        std::lock_guard<std::mutex> lk(mutex);
+        if (loggerReady) {
+            log(phase, duration);
+        } else {
+            pending.push_back({std::move(phase), duration});
+        }
+    }
+
+    /// Logs the phases recorded so far, and any later one as it ends
+    void flush() {
+        std::lock_guard<std::mutex> lk(mutex);
+        for (auto &[phase, duration] : pending) {
+            log(phase, duration);
+        }
+        pending.clear();
+        loggerReady = true;
+    }
+
+    /// Records the time from its construction to its destruction as phase
+    class scope {
+      public:
+        explicit scope(std::string phase)
+            : phase(std::move(phase)), start(clock::now()) {}
+        ~scope() { get().record(std::move(phase), clock::now() - start); }
+        scope(const scope &) = delete;
+        scope &operator=(const scope &) = delete;
+
+      private:
+        std::string phase;
+        clock::time_point start;
+    };
+
+  private:
+    static void log(const std::string &phase, clock::duration duration) {
+        logger::info(
+            "startup: {}: {} us", phase,
+            std::chrono::duration_cast<std::chrono::microseconds>(duration)
+                .count());
+    }
+
+    std::mutex mutex;
+    std::vector<std::pair<std::string, clock::duration>> pending;
+    bool loggerReady = false;
+};
+
+} // namespace ur_loader
+
+#endif /* UR_STARTUP_TIMER_HPP */
@@ -44,4 +44,21 @@ std::optional<fs::path> getAdapterNameAsPath(std::string adapterName) {
     return std::nullopt;
 }
 
+std::optional<fs::path> getAdapterLibPath(void *getTableFn) {
+    HMODULE hModule = NULL;
+    char pathStr[MAX_PATH_LEN_WIN];
+
+    if (GetModuleHandleEx(GET_MODULE_HANDLE_EX_FLAG_FROM_ADDRESS |
+                              GET_MODULE_HANDLE_EX_FLAG_UNCHANGED_REFCOUNT,
+                          reinterpret_cast<LPCSTR>(getTableFn), &hModule) &&
+        GetModuleFileNameA(hModule, pathStr, MAX_PATH_LEN_WIN)) {
+        auto libPath = fs::path(pathStr);
+        if (fs::exists(libPath)) {
+            return fs::absolute(libPath);
+        }
+    }
+
+    return std::nullopt;
+}
+
 } // namespace ur_loader
@@ -0,0 +1,301 @@
+/*
+ *
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file ur_mock_functions.hpp
+ *
+ */
+
+#pragma once
+
+#include "ur_api.h"
+
+namespace mock {
+
+struct function_id_t {
+    const char *name;
+    ur_function_t id;
+};
+
+// The entry points of the mock adapter which callbacks can intercept
+inline constexpr function_id_t functionIds[] = {
+    {"urAdapterGet", UR_FUNCTION_ADAPTER_GET},
+    {"urAdapterRelease", UR_FUNCTION_ADAPTER_RELEASE},
+    {"urAdapterRetain", UR_FUNCTION_ADAPTER_RETAIN},
+    {"urAdapterGetLastError", UR_FUNCTION_ADAPTER_GET_LAST_ERROR},
+    {"urAdapterGetInfo", UR_FUNCTION_ADAPTER_GET_INFO},
+    {"urPlatformGet", UR_FUNCTION_PLATFORM_GET},
+    {"urPlatformGetInfo", UR_FUNCTION_PLATFORM_GET_INFO},
+    {"urPlatformGetApiVersion", UR_FUNCTION_PLATFORM_GET_API_VERSION},
+    {"urPlatformGetNativeHandle", UR_FUNCTION_PLATFORM_GET_NATIVE_HANDLE},
+    {"urPlatformCreateWithNativeHandle",
+     UR_FUNCTION_PLATFORM_CREATE_WITH_NATIVE_HANDLE},
+    {"urPlatformGetBackendOption", UR_FUNCTION_PLATFORM_GET_BACKEND_OPTION},
+    {"urDeviceGet", UR_FUNCTION_DEVICE_GET},
+    {"urDeviceGetInfo", UR_FUNCTION_DEVICE_GET_INFO},
+    {"urDeviceRetain", UR_FUNCTION_DEVICE_RETAIN},
+    {"urDeviceRelease", UR_FUNCTION_DEVICE_RELEASE},
+    {"urDevicePartition", UR_FUNCTION_DEVICE_PARTITION},
+    {"urDeviceSelectBinary", UR_FUNCTION_DEVICE_SELECT_BINARY},
+    {"urDeviceGetNativeHandle", UR_FUNCTION_DEVICE_GET_NATIVE_HANDLE},
+    {"urDeviceCreateWithNativeHandle",
+     UR_FUNCTION_DEVICE_CREATE_WITH_NATIVE_HANDLE},
+    {"urDeviceGetGlobalTimestamps", UR_FUNCTION_DEVICE_GET_GLOBAL_TIMESTAMPS},
+    {"urContextCreate", UR_FUNCTION_CONTEXT_CREATE},
+    {"urContextRetain", UR_FUNCTION_CONTEXT_RETAIN},
+    {"urContextRelease", UR_FUNCTION_CONTEXT_RELEASE},
+    {"urContextGetInfo", UR_FUNCTION_CONTEXT_GET_INFO},
+    {"urContextGetNativeHandle", UR_FUNCTION_CONTEXT_GET_NATIVE_HANDLE},
+    {"urContextCreateWithNativeHandle",
+     UR_FUNCTION_CONTEXT_CREATE_WITH_NATIVE_HANDLE},
+    {"urContextSetExtendedDeleter", UR_FUNCTION_CONTEXT_SET_EXTENDED_DELETER},
+    {"urMemImageCreate", UR_FUNCTION_MEM_IMAGE_CREATE},
+    {"urMemBufferCreate", UR_FUNCTION_MEM_BUFFER_CREATE},
+    {"urMemRetain", UR_FUNCTION_MEM_RETAIN},
+    {"urMemRelease", UR_FUNCTION_MEM_RELEASE},
+    {"urMemBufferPartition", UR_FUNCTION_MEM_BUFFER_PARTITION},
+    {"urMemGetNativeHandle", UR_FUNCTION_MEM_GET_NATIVE_HANDLE},
+    {"urMemBufferCreateWithNativeHandle",
+     UR_FUNCTION_MEM_BUFFER_CREATE_WITH_NATIVE_HANDLE},
+    {"urMemImageCreateWithNativeHandle",
+     UR_FUNCTION_MEM_IMAGE_CREATE_WITH_NATIVE_HANDLE},
+    {"urMemGetInfo", UR_FUNCTION_MEM_GET_INFO},
+    {"urMemImageGetInfo", UR_FUNCTION_MEM_IMAGE_GET_INFO},
+    {"urSamplerCreate", UR_FUNCTION_SAMPLER_CREATE},
+    {"urSamplerRetain", UR_FUNCTION_SAMPLER_RETAIN},
+    {"urSamplerRelease", UR_FUNCTION_SAMPLER_RELEASE},
+    {"urSamplerGetInfo", UR_FUNCTION_SAMPLER_GET_INFO},
+    {"urSamplerGetNativeHandle", UR_FUNCTION_SAMPLER_GET_NATIVE_HANDLE},
+    {"urSamplerCreateWithNativeHandle",
+     UR_FUNCTION_SAMPLER_CREATE_WITH_NATIVE_HANDLE},
+    {"urUSMHostAlloc", UR_FUNCTION_USM_HOST_ALLOC},
+    {"urUSMDeviceAlloc", UR_FUNCTION_USM_DEVICE_ALLOC},
+    {"urUSMSharedAlloc", UR_FUNCTION_USM_SHARED_ALLOC},
+    {"urUSMFree", UR_FUNCTION_USM_FREE},
+    {"urUSMGetMemAllocInfo", UR_FUNCTION_USM_GET_MEM_ALLOC_INFO},
+    {"urUSMPoolCreate", UR_FUNCTION_USM_POOL_CREATE},
+    {"urUSMPoolRetain", UR_FUNCTION_USM_POOL_RETAIN},
+    {"urUSMPoolRelease", UR_FUNCTION_USM_POOL_RELEASE},
+    {"urUSMPoolGetInfo", UR_FUNCTION_USM_POOL_GET_INFO},
+    {"urVirtualMemGranularityGetInfo",
+     UR_FUNCTION_VIRTUAL_MEM_GRANULARITY_GET_INFO},
+    {"urVirtualMemReserve", UR_FUNCTION_VIRTUAL_MEM_RESERVE},
+    {"urVirtualMemFree", UR_FUNCTION_VIRTUAL_MEM_FREE},
+    {"urVirtualMemMap", UR_FUNCTION_VIRTUAL_MEM_MAP},
+    {"urVirtualMemUnmap", UR_FUNCTION_VIRTUAL_MEM_UNMAP},
+    {"urVirtualMemSetAccess", UR_FUNCTION_VIRTUAL_MEM_SET_ACCESS},
+    {"urVirtualMemGetInfo", UR_FUNCTION_VIRTUAL_MEM_GET_INFO},
+    {"urPhysicalMemCreate", UR_FUNCTION_PHYSICAL_MEM_CREATE},
+    {"urPhysicalMemRetain", UR_FUNCTION_PHYSICAL_MEM_RETAIN},
+    {"urPhysicalMemRelease", UR_FUNCTION_PHYSICAL_MEM_RELEASE},
+    {"urProgramCreateWithIL", UR_FUNCTION_PROGRAM_CREATE_WITH_IL},
+    {"urProgramCreateWithBinary", UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY},
+    {"urProgramBuild", UR_FUNCTION_PROGRAM_BUILD},
+    {"urProgramCompile", UR_FUNCTION_PROGRAM_COMPILE},
+    {"urProgramLink", UR_FUNCTION_PROGRAM_LINK},
+    {"urProgramRetain", UR_FUNCTION_PROGRAM_RETAIN},
+    {"urProgramRelease", UR_FUNCTION_PROGRAM_RELEASE},
+    {"urProgramGetFunctionPointer", UR_FUNCTION_PROGRAM_GET_FUNCTION_POINTER},
+    {"urProgramGetGlobalVariablePointer",
+     UR_FUNCTION_PROGRAM_GET_GLOBAL_VARIABLE_POINTER},
+    {"urProgramGetInfo", UR_FUNCTION_PROGRAM_GET_INFO},
+    {"urProgramGetBuildInfo", UR_FUNCTION_PROGRAM_GET_BUILD_INFO},
+    {"urProgramSetSpecializationConstants",
+     UR_FUNCTION_PROGRAM_SET_SPECIALIZATION_CONSTANTS},
+    {"urProgramGetNativeHandle", UR_FUNCTION_PROGRAM_GET_NATIVE_HANDLE},
+    {"urProgramCreateWithNativeHandle",
+     UR_FUNCTION_PROGRAM_CREATE_WITH_NATIVE_HANDLE},
+    {"urKernelCreate", UR_FUNCTION_KERNEL_CREATE},
+    {"urKernelSetArgValue", UR_FUNCTION_KERNEL_SET_ARG_VALUE},
+    {"urKernelSetArgLocal", UR_FUNCTION_KERNEL_SET_ARG_LOCAL},
+    {"urKernelGetInfo", UR_FUNCTION_KERNEL_GET_INFO},
+    {"urKernelGetGroupInfo", UR_FUNCTION_KERNEL_GET_GROUP_INFO},
+    {"urKernelGetSubGroupInfo", UR_FUNCTION_KERNEL_GET_SUB_GROUP_INFO},
+    {"urKernelRetain", UR_FUNCTION_KERNEL_RETAIN},
+    {"urKernelRelease", UR_FUNCTION_KERNEL_RELEASE},
+    {"urKernelSetArgPointer", UR_FUNCTION_KERNEL_SET_ARG_POINTER},
+    {"urKernelSetExecInfo", UR_FUNCTION_KERNEL_SET_EXEC_INFO},
+    {"urKernelSetArgSampler", UR_FUNCTION_KERNEL_SET_ARG_SAMPLER},
+    {"urKernelSetArgMemObj", UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ},
+    {"urKernelSetSpecializationConstants",
+     UR_FUNCTION_KERNEL_SET_SPECIALIZATION_CONSTANTS},
+    {"urKernelGetNativeHandle", UR_FUNCTION_KERNEL_GET_NATIVE_HANDLE},
+    {"urKernelCreateWithNativeHandle",
+     UR_FUNCTION_KERNEL_CREATE_WITH_NATIVE_HANDLE},
+    {"urKernelGetSuggestedLocalWorkSize",
+     UR_FUNCTION_KERNEL_GET_SUGGESTED_LOCAL_WORK_SIZE},
+    {"urQueueGetInfo", UR_FUNCTION_QUEUE_GET_INFO},
+    {"urQueueCreate", UR_FUNCTION_QUEUE_CREATE},
+    {"urQueueRetain", UR_FUNCTION_QUEUE_RETAIN},
+    {"urQueueRelease", UR_FUNCTION_QUEUE_RELEASE},
+    {"urQueueGetNativeHandle", UR_FUNCTION_QUEUE_GET_NATIVE_HANDLE},
+    {"urQueueCreateWithNativeHandle",
+     UR_FUNCTION_QUEUE_CREATE_WITH_NATIVE_HANDLE},
+    {"urQueueFinish", UR_FUNCTION_QUEUE_FINISH},
+    {"urQueueFlush", UR_FUNCTION_QUEUE_FLUSH},
+    {"urEventGetInfo", UR_FUNCTION_EVENT_GET_INFO},
+    {"urEventGetProfilingInfo", UR_FUNCTION_EVENT_GET_PROFILING_INFO},
+    {"urEventWait", UR_FUNCTION_EVENT_WAIT},
+    {"urEventRetain", UR_FUNCTION_EVENT_RETAIN},
+    {"urEventRelease", UR_FUNCTION_EVENT_RELEASE},
+    {"urEventGetNativeHandle", UR_FUNCTION_EVENT_GET_NATIVE_HANDLE},
+    {"urEventCreateWithNativeHandle",
+     UR_FUNCTION_EVENT_CREATE_WITH_NATIVE_HANDLE},
+    {"urEventSetCallback", UR_FUNCTION_EVENT_SET_CALLBACK},
+    {"urEnqueueKernelLaunch", UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH},
+    {"urEnqueueEventsWait", UR_FUNCTION_ENQUEUE_EVENTS_WAIT},
+    {"urEnqueueEventsWaitWithBarrier",
+     UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER},
+    {"urEnqueueMemBufferRead", UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ},
+    {"urEnqueueMemBufferWrite", UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE},
+    {"urEnqueueMemBufferReadRect", UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ_RECT},
+    {"urEnqueueMemBufferWriteRect", UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE_RECT},
+    {"urEnqueueMemBufferCopy", UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY},
+    {"urEnqueueMemBufferCopyRect", UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY_RECT},
+    {"urEnqueueMemBufferFill", UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL},
+    {"urEnqueueMemImageRead", UR_FUNCTION_ENQUEUE_MEM_IMAGE_READ},
+    {"urEnqueueMemImageWrite", UR_FUNCTION_ENQUEUE_MEM_IMAGE_WRITE},
+    {"urEnqueueMemImageCopy", UR_FUNCTION_ENQUEUE_MEM_IMAGE_COPY},
+    {"urEnqueueMemBufferMap", UR_FUNCTION_ENQUEUE_MEM_BUFFER_MAP},
+    {"urEnqueueMemUnmap", UR_FUNCTION_ENQUEUE_MEM_UNMAP},
+    {"urEnqueueUSMFill", UR_FUNCTION_ENQUEUE_USM_FILL},
+    {"urEnqueueUSMMemcpy", UR_FUNCTION_ENQUEUE_USM_MEMCPY},
+    {"urEnqueueUSMPrefetch", UR_FUNCTION_ENQUEUE_USM_PREFETCH},
+    {"urEnqueueUSMAdvise", UR_FUNCTION_ENQUEUE_USM_ADVISE},
+    {"urEnqueueUSMFill2D", UR_FUNCTION_ENQUEUE_USM_FILL_2D},
+    {"urEnqueueUSMMemcpy2D", UR_FUNCTION_ENQUEUE_USM_MEMCPY_2D},
+    {"urEnqueueDeviceGlobalVariableWrite",
+     UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_WRITE},
+    {"urEnqueueDeviceGlobalVariableRead",
+     UR_FUNCTION_ENQUEUE_DEVICE_GLOBAL_VARIABLE_READ},
+    {"urEnqueueReadHostPipe", UR_FUNCTION_ENQUEUE_READ_HOST_PIPE},
+    {"urEnqueueWriteHostPipe", UR_FUNCTION_ENQUEUE_WRITE_HOST_PIPE},
+    {"urUSMPitchedAllocExp", UR_FUNCTION_USM_PITCHED_ALLOC_EXP},
+    {"urBindlessImagesUnsampledImageHandleDestroyExp",
+     UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_HANDLE_DESTROY_EXP},
+    {"urBindlessImagesSampledImageHandleDestroyExp",
+     UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_HANDLE_DESTROY_EXP},
+    {"urBindlessImagesImageAllocateExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMAGE_ALLOCATE_EXP},
+    {"urBindlessImagesImageFreeExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMAGE_FREE_EXP},
+    {"urBindlessImagesUnsampledImageCreateExp",
+     UR_FUNCTION_BINDLESS_IMAGES_UNSAMPLED_IMAGE_CREATE_EXP},
+    {"urBindlessImagesSampledImageCreateExp",
+     UR_FUNCTION_BINDLESS_IMAGES_SAMPLED_IMAGE_CREATE_EXP},
+    {"urBindlessImagesImageCopyExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_EXP},
+    {"urBindlessImagesImageCopyBatchExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMAGE_COPY_BATCH_EXP},
+    {"urBindlessImagesImageGetInfoExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMAGE_GET_INFO_EXP},
+    {"urBindlessImagesMipmapGetLevelExp",
+     UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_GET_LEVEL_EXP},
+    {"urBindlessImagesMipmapFreeExp",
+     UR_FUNCTION_BINDLESS_IMAGES_MIPMAP_FREE_EXP},
+    {"urBindlessImagesImportExternalMemoryExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_MEMORY_EXP},
+    {"urBindlessImagesMapExternalArrayExp",
+     UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_ARRAY_EXP},
+    {"urBindlessImagesMapExternalLinearMemoryExp",
+     UR_FUNCTION_BINDLESS_IMAGES_MAP_EXTERNAL_LINEAR_MEMORY_EXP},
+    {"urBindlessImagesReleaseExternalMemoryExp",
+     UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_MEMORY_EXP},
+    {"urBindlessImagesImportExternalSemaphoreExp",
+     UR_FUNCTION_BINDLESS_IMAGES_IMPORT_EXTERNAL_SEMAPHORE_EXP},
+    {"urBindlessImagesReleaseExternalSemaphoreExp",
+     UR_FUNCTION_BINDLESS_IMAGES_RELEASE_EXTERNAL_SEMAPHORE_EXP},
+    {"urBindlessImagesWaitExternalSemaphoreExp",
+     UR_FUNCTION_BINDLESS_IMAGES_WAIT_EXTERNAL_SEMAPHORE_EXP},
+    {"urBindlessImagesSignalExternalSemaphoreExp",
+     UR_FUNCTION_BINDLESS_IMAGES_SIGNAL_EXTERNAL_SEMAPHORE_EXP},
+    {"urCommandBufferCreateExp", UR_FUNCTION_COMMAND_BUFFER_CREATE_EXP},
+    {"urCommandBufferRetainExp", UR_FUNCTION_COMMAND_BUFFER_RETAIN_EXP},
+    {"urCommandBufferReleaseExp", UR_FUNCTION_COMMAND_BUFFER_RELEASE_EXP},
+    {"urCommandBufferFinalizeExp", UR_FUNCTION_COMMAND_BUFFER_FINALIZE_EXP},
+    {"urCommandBufferAppendKernelLaunchExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_KERNEL_LAUNCH_EXP},
+    {"urCommandBufferAppendUSMMemcpyExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_MEMCPY_EXP},
+    {"urCommandBufferAppendUSMFillExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_FILL_EXP},
+    {"urCommandBufferAppendMemBufferCopyExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_EXP},
+    {"urCommandBufferAppendMemBufferWriteExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_EXP},
+    {"urCommandBufferAppendMemBufferReadExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_EXP},
+    {"urCommandBufferAppendMemBufferCopyRectExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_COPY_RECT_EXP},
+    {"urCommandBufferAppendMemBufferWriteRectExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_WRITE_RECT_EXP},
+    {"urCommandBufferAppendMemBufferReadRectExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_READ_RECT_EXP},
+    {"urCommandBufferAppendMemBufferFillExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_MEM_BUFFER_FILL_EXP},
+    {"urCommandBufferAppendUSMPrefetchExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_PREFETCH_EXP},
+    {"urCommandBufferAppendUSMAdviseExp",
+     UR_FUNCTION_COMMAND_BUFFER_APPEND_USM_ADVISE_EXP},
+    {"urCommandBufferEnqueueExp", UR_FUNCTION_COMMAND_BUFFER_ENQUEUE_EXP},
+    {"urCommandBufferRetainCommandExp",
+     UR_FUNCTION_COMMAND_BUFFER_RETAIN_COMMAND_EXP},
+    {"urCommandBufferReleaseCommandExp",
+     UR_FUNCTION_COMMAND_BUFFER_RELEASE_COMMAND_EXP},
+    {"urCommandBufferUpdateKernelLaunchExp",
+     UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_EXP},
+    {"urCommandBufferUpdateSignalEventExp",
+     UR_FUNCTION_COMMAND_BUFFER_UPDATE_SIGNAL_EVENT_EXP},
+    {"urCommandBufferUpdateWaitEventsExp",
+     UR_FUNCTION_COMMAND_BUFFER_UPDATE_WAIT_EVENTS_EXP},
+    {"urCommandBufferGetInfoExp", UR_FUNCTION_COMMAND_BUFFER_GET_INFO_EXP},
+    {"urCommandBufferCommandGetInfoExp",
+     UR_FUNCTION_COMMAND_BUFFER_COMMAND_GET_INFO_EXP},
+    {"urCommandBufferUpdateKernelLaunchBatchExp",
+     UR_FUNCTION_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_BATCH_EXP},
+    {"urEnqueueCooperativeKernelLaunchExp",
+     UR_FUNCTION_ENQUEUE_COOPERATIVE_KERNEL_LAUNCH_EXP},
+    {"urKernelSuggestMaxCooperativeGroupCountExp",
+     UR_FUNCTION_KERNEL_SUGGEST_MAX_COOPERATIVE_GROUP_COUNT_EXP},
+    {"urKernelSetArgsExp", UR_FUNCTION_KERNEL_SET_ARGS_EXP},
+    {"urEnqueueTimestampRecordingExp",
+     UR_FUNCTION_ENQUEUE_TIMESTAMP_RECORDING_EXP},
+    {"urEventWaitAnyExp", UR_FUNCTION_EVENT_WAIT_ANY_EXP},
+    {"urQueueBeginCaptureExp", UR_FUNCTION_QUEUE_BEGIN_CAPTURE_EXP},
+    {"urQueueEndCaptureExp", UR_FUNCTION_QUEUE_END_CAPTURE_EXP},
+    {"urCommandBufferUploadExp", UR_FUNCTION_COMMAND_BUFFER_UPLOAD_EXP},
+    {"urEnqueueKernelLaunchCustomExp",
+     UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_CUSTOM_EXP},
+    {"urProgramBuildExp", UR_FUNCTION_PROGRAM_BUILD_EXP},
+    {"urProgramCompileExp", UR_FUNCTION_PROGRAM_COMPILE_EXP},
+    {"urProgramLinkExp", UR_FUNCTION_PROGRAM_LINK_EXP},
+    {"urEnqueueKernelLaunchMultiExp",
+     UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH_MULTI_EXP},
+    {"urProgramBuildAsyncExp", UR_FUNCTION_PROGRAM_BUILD_ASYNC_EXP},
+    {"urEnqueueUSMDeviceAllocExp", UR_FUNCTION_ENQUEUE_USM_DEVICE_ALLOC_EXP},
+    {"urEnqueueUSMFreeExp", UR_FUNCTION_ENQUEUE_USM_FREE_EXP},
+    {"urUSMGrowableAllocExp", UR_FUNCTION_USM_GROWABLE_ALLOC_EXP},
+    {"urUSMGrowExp", UR_FUNCTION_USM_GROW_EXP},
+    {"urUSMImportExp", UR_FUNCTION_USM_IMPORT_EXP},
+    {"urUSMReleaseExp", UR_FUNCTION_USM_RELEASE_EXP},
+    {"urUsmP2PEnablePeerAccessExp", UR_FUNCTION_USM_P2P_ENABLE_PEER_ACCESS_EXP},
+    {"urUsmP2PDisablePeerAccessExp",
+     UR_FUNCTION_USM_P2P_DISABLE_PEER_ACCESS_EXP},
+    {"urUsmP2PPeerAccessGetInfoExp",
+     UR_FUNCTION_USM_P2P_PEER_ACCESS_GET_INFO_EXP},
+    {"urUSMPoolTrimExp", UR_FUNCTION_USM_POOL_TRIM_EXP},
+    {"urEnqueueNativeCommandExp", UR_FUNCTION_ENQUEUE_NATIVE_COMMAND_EXP},
+    {"urEnqueueHostTaskExp", UR_FUNCTION_ENQUEUE_HOST_TASK_EXP},
+    {"urEventCreateIPCExp", UR_FUNCTION_EVENT_CREATE_IPC_EXP},
+    {"urEventGetIPCHandleExp", UR_FUNCTION_EVENT_GET_IPC_HANDLE_EXP},
+    {"urEventOpenIPCHandleExp", UR_FUNCTION_EVENT_OPEN_IPC_HANDLE_EXP},
+    {"urEnqueueIPCEventSignalExp", UR_FUNCTION_ENQUEUE_IPC_EVENT_SIGNAL_EXP},
+    {"urEnqueueIPCEventWaitExp", UR_FUNCTION_ENQUEUE_IPC_EVENT_WAIT_EXP},
+    {"urEnqueueUSMMemcpyBatchExp", UR_FUNCTION_ENQUEUE_USM_MEMCPY_BATCH_EXP},
+};
+
+} // namespace mock
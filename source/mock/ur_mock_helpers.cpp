@@ -12,9 +12,26 @@
 
 #include "ur_mock_helpers.hpp"
 
+#include <unordered_map>
+
 namespace mock {
 static callbacks_t callbacks = {};
 
 callbacks_t &getCallbacks() { return callbacks; }
 
+std::optional<ur_function_t> getFunctionId(const std::string &name) {
+    static const auto ids = [] {
+        std::unordered_map<std::string, ur_function_t> ids;
+        for (const auto &function : functionIds) {
+            ids.emplace(function.name, function.id);
+        }
+        return ids;
+    }();
+    auto id = ids.find(name);
+    if (id == ids.end()) {
+        return std::nullopt;
+    }
+    return id->second;
+}
+
 } // namespace mock
@@ -13,12 +13,15 @@
 #pragma once
 
 #include "ur_api.h"
+#include "ur_mock_functions.hpp"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cassert>
 #include <cstddef>
+#include <optional>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
 // This is the callback function we accept to override or instrument
@@ -83,56 +86,121 @@ template <class T> inline void retainDummyHandle(T Handle) {
     ++DummyHandlePtr->MRefCounter;
 }
 
+// One past the largest id of the entry points in functionIds
+constexpr size_t getFunctionTableSize() {
+    size_t size = 0;
+    for (const auto &function : functionIds) {
+        size = std::max<size_t>(size, function.id + 1);
+    }
+    return size;
+}
+
+// The id of the mock adapter entry point with the given name, if any
+UR_DLLEXPORT std::optional<ur_function_t>
+getFunctionId(const std::string &name);
+
+// Callbacks are looked up by ur_function_t in fixed tables, so that the mock
+// adapter costs a few loads per call. The string overloads are for setting
+// callbacks, names of functions the mock adapter doesn't implement being
+// ignored.
 struct callbacks_t {
     void set_before_callback(std::string name, ur_mock_callback_t callback) {
-        beforeCallbacks[name] = callback;
+        set_callback(beforeCallbacks, name, callback);
+    }
+
+    void set_before_callback(ur_function_t function,
+                             ur_mock_callback_t callback) {
+        set_callback(beforeCallbacks, function, callback);
     }
 
     ur_mock_callback_t get_before_callback(std::string name) const {
-        auto callback = beforeCallbacks.find(name);
+        return get_callback(beforeCallbacks, name);
+    }
 
-        if (callback != beforeCallbacks.end()) {
-            return callback->second;
-        }
-        return nullptr;
+    ur_mock_callback_t get_before_callback(ur_function_t function) const {
+        return get_callback(beforeCallbacks, function);
     }
 
     void set_replace_callback(std::string name, ur_mock_callback_t callback) {
-        replaceCallbacks[name] = callback;
+        set_callback(replaceCallbacks, name, callback);
+    }
+
+    void set_replace_callback(ur_function_t function,
+                              ur_mock_callback_t callback) {
+        set_callback(replaceCallbacks, function, callback);
     }
 
     ur_mock_callback_t get_replace_callback(std::string name) const {
-        auto callback = replaceCallbacks.find(name);
+        return get_callback(replaceCallbacks, name);
+    }
 
-        if (callback != replaceCallbacks.end()) {
-            return callback->second;
-        }
-        return nullptr;
+    ur_mock_callback_t get_replace_callback(ur_function_t function) const {
+        return get_callback(replaceCallbacks, function);
     }
 
     void set_after_callback(std::string name, ur_mock_callback_t callback) {
-        afterCallbacks[name] = callback;
+        set_callback(afterCallbacks, name, callback);
+    }
+
+    void set_after_callback(ur_function_t function,
+                            ur_mock_callback_t callback) {
+        set_callback(afterCallbacks, function, callback);
     }
 
     ur_mock_callback_t get_after_callback(std::string name) const {
-        auto callback = afterCallbacks.find(name);
+        return get_callback(afterCallbacks, name);
+    }
 
-        if (callback != afterCallbacks.end()) {
-            return callback->second;
-        }
-        return nullptr;
+    ur_mock_callback_t get_after_callback(ur_function_t function) const {
+        return get_callback(afterCallbacks, function);
     }
 
     void resetCallbacks() {
-        beforeCallbacks.clear();
-        replaceCallbacks.clear();
-        afterCallbacks.clear();
+        beforeCallbacks.fill(nullptr);
+        replaceCallbacks.fill(nullptr);
+        afterCallbacks.fill(nullptr);
+        hasCallbacks = false;
     }
 
   private:
-    std::unordered_map<std::string, ur_mock_callback_t> beforeCallbacks;
-    std::unordered_map<std::string, ur_mock_callback_t> replaceCallbacks;
-    std::unordered_map<std::string, ur_mock_callback_t> afterCallbacks;
+    using table_t = std::array<ur_mock_callback_t, getFunctionTableSize()>;
+
+    void set_callback(table_t &table, ur_function_t function,
+                      ur_mock_callback_t callback) {
+        if (static_cast<size_t>(function) >= table.size()) {
+            return;
+        }
+        table[function] = callback;
+        hasCallbacks = hasCallbacks || callback;
+    }
+
+    void set_callback(table_t &table, const std::string &name,
+                      ur_mock_callback_t callback) {
+        if (auto function = getFunctionId(name)) {
+            set_callback(table, *function, callback);
+        }
+    }
+
+    ur_mock_callback_t get_callback(const table_t &table,
+                                    ur_function_t function) const {
+        if (!hasCallbacks || static_cast<size_t>(function) >= table.size()) {
+            return nullptr;
+        }
+        return table[function];
+    }
+
+    ur_mock_callback_t get_callback(const table_t &table,
+                                    const std::string &name) const {
+        auto function = getFunctionId(name);
+        return function ? get_callback(table, *function) : nullptr;
+    }
+
+    table_t beforeCallbacks = {};
+    table_t replaceCallbacks = {};
+    table_t afterCallbacks = {};
+    // Whether any callback was set since the last reset, which spares the
+    // lookups when none is
+    bool hasCallbacks = false;
 };
 
 UR_DLLEXPORT callbacks_t &getCallbacks();
@@ -12,6 +12,11 @@
 #include "ur.hpp"
 #include <cassert>
 
+#ifdef UR_ENABLE_LOCK_STATS
+#include "logger/ur_logger.hpp"
+#include <memory>
+#endif
+
 // Controls tracing UR calls from within the UR itself.
 bool PrintTrace = [] {
   const char *UrRet = std::getenv("SYCL_UR_TRACE");
@@ -31,3 +36,47 @@ bool PrintTrace = [] {
   }
   return false;
 }();
+
+#ifdef UR_ENABLE_LOCK_STATS
+namespace {
+// Owns the counters of every lock name and logs them at exit, the locks that
+// waited the longest first.
+struct ur_lock_stats_registry {
+  ur_lock_stats_registry()
+      : Logger(logger::create_logger("locks", true, false)) {}
+
+  ~ur_lock_stats_registry() {
+    std::vector<std::pair<const std::string *, ur_lock_stats *>> Sorted;
+    for (auto &[Name, Stats] : Stats) {
+      Sorted.emplace_back(&Name, Stats.get());
+    }
+    std::sort(Sorted.begin(), Sorted.end(), [](auto &A, auto &B) {
+      return A.second->WaitNs > B.second->WaitNs;
+    });
+    for (auto &[Name, Stats] : Sorted) {
+      Logger.info("{}: {} acquired, {} contended, {} spun, {} us waiting",
+                  *Name, Stats->Acquired.load(), Stats->Contended.load(),
+                  Stats->Spun.load(), Stats->WaitNs.load() / 1000);
+    }
+    // Objects destroyed after this one may still take their locks
+    for (auto &Entry : Stats) {
+      static_cast<void>(Entry.second.release());
+    }
+  }
+
+  logger::Logger Logger;
+  std::mutex Mutex;
+  std::unordered_map<std::string, std::unique_ptr<ur_lock_stats>> Stats;
+};
+} // namespace
+
+ur_lock_stats &ur_lock_stats::get(const char *Name) {
+  static ur_lock_stats_registry Registry;
+  std::scoped_lock<std::mutex> Lock(Registry.Mutex);
+  auto &Stats = Registry.Stats[Name];
+  if (!Stats) {
+    Stats = std::make_unique<ur_lock_stats>();
+  }
+  return *Stats;
+}
+#endif // UR_ENABLE_LOCK_STATS
@@ -9,8 +9,10 @@
 //===----------------------------------------------------------------------===//
 #pragma once
 
+#include <algorithm>
 #include <atomic>
 #include <cassert>
+#include <chrono>
 #include <cstdint>
 #include <cstring>
 #include <functional>
@@ -20,9 +22,15 @@
 #include <shared_mutex>
 #include <string>
 #include <thread>
+#include <unordered_map>
 #include <variant>
 #include <vector>
 
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+#include <immintrin.h>
+#endif
+
 #include <ur_api.h>
 
 #include "ur_util.hpp"
@@ -76,56 +84,199 @@ static const bool SingleThreadMode = [] {
   return RetVal;
 }();
 
+// Times a contended ur_mutex or ur_shared_mutex is retried before the thread
+// blocks on it. Critical sections that last tens of nanoseconds are then
+// waited for without a futex sleep and wake up. Zero, the default unless
+// the build sets UR_MUTEX_DEFAULT_SPIN_COUNT, blocks straight away.
+#ifndef UR_MUTEX_DEFAULT_SPIN_COUNT
+#define UR_MUTEX_DEFAULT_SPIN_COUNT 0
+#endif
+static const uint32_t MutexSpinCount = [] {
+  auto SpinCount = ur_getenv("UR_MUTEX_SPIN_COUNT");
+  try {
+    return SpinCount ? static_cast<uint32_t>(std::stoul(*SpinCount))
+                     : uint32_t{UR_MUTEX_DEFAULT_SPIN_COUNT};
+  } catch (...) {
+    return uint32_t{UR_MUTEX_DEFAULT_SPIN_COUNT};
+  }
+}();
+
+inline void urCpuRelax() {
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) ||            \
+    defined(_M_IX86)
+  _mm_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield");
+#else
+  std::atomic_signal_fence(std::memory_order_seq_cst);
+#endif
+}
+
+#ifdef UR_ENABLE_LOCK_STATS
+// Contention counters of the locks sharing a name, updated in builds with
+// UR_ENABLE_LOCK_STATS and logged at exit through the "locks" logger, see
+// UR_LOG_LOCKS.
+struct ur_lock_stats {
+  std::atomic<uint64_t> Acquired{0};
+  // Acquisitions that found the lock taken
+  std::atomic<uint64_t> Contended{0};
+  // Contended acquisitions that got the lock while spinning
+  std::atomic<uint64_t> Spun{0};
+  std::atomic<uint64_t> WaitNs{0};
+
+  static ur_lock_stats &get(const char *Name);
+};
+#endif
+
+// Acquires ur_mutex and ur_shared_mutex, spinning on contention for up to an
+// adaptive number of tries before blocking. As with glibc's adaptive mutexes,
+// the tries follow what the recent contended acquisitions of the lock needed.
+// Spins that fail shrink them, so a lock that is usually held for long soon
+// only spins briefly.
+class ur_lock_acquirer {
+  // Moving average of the tries, in eighths so that failed spins take it down
+  // to 0 rather than stopping where an eighth of it rounds to nothing
+  std::atomic<uint32_t> SpinEstimate8{0};
+#ifdef UR_ENABLE_LOCK_STATS
+  ur_lock_stats *Stats = &ur_lock_stats::get("unnamed");
+#endif
+
+  void updateEstimate(uint32_t Tries) {
+    auto Estimate8 = SpinEstimate8.load(std::memory_order_relaxed);
+    SpinEstimate8.store(Estimate8 - Estimate8 / 8 + Tries,
+                        std::memory_order_relaxed);
+  }
+
+  template <typename TryLockFn> bool spin(TryLockFn &&TryLock) {
+    uint32_t MaxTries =
+        std::min(MutexSpinCount,
+                 SpinEstimate8.load(std::memory_order_relaxed) / 4 + 10);
+    for (uint32_t Tries = 1; Tries <= MaxTries; ++Tries) {
+      urCpuRelax();
+      if (TryLock()) {
+        updateEstimate(Tries);
+        return true;
+      }
+    }
+    updateEstimate(0);
+    return false;
+  }
+
+public:
+  void setName([[maybe_unused]] const char *Name) {
+#ifdef UR_ENABLE_LOCK_STATS
+    Stats = &ur_lock_stats::get(Name);
+#endif
+  }
+
+  template <typename TryLockFn, typename LockFn>
+  void acquire(TryLockFn &&TryLock, LockFn &&Lock) {
+#ifdef UR_ENABLE_LOCK_STATS
+    Stats->Acquired.fetch_add(1, std::memory_order_relaxed);
+#else
+    if (MutexSpinCount == 0) {
+      Lock();
+      return;
+    }
+#endif
+    if (TryLock()) {
+      return;
+    }
+
+#ifdef UR_ENABLE_LOCK_STATS
+    auto Start = std::chrono::steady_clock::now();
+    Stats->Contended.fetch_add(1, std::memory_order_relaxed);
+#endif
+    if (MutexSpinCount != 0 && spin(TryLock)) {
+#ifdef UR_ENABLE_LOCK_STATS
+      Stats->Spun.fetch_add(1, std::memory_order_relaxed);
+#endif
+    } else {
+      Lock();
+    }
+#ifdef UR_ENABLE_LOCK_STATS
+    Stats->WaitNs.fetch_add(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - Start)
+            .count(),
+        std::memory_order_relaxed);
+#endif
+  }
+};
+
 // Class which acts like shared_mutex if SingleThreadMode variable is not set.
-// If SingleThreadMode variable is set then mutex operations are turned into
-// nop.
+// If SingleThreadMode variable is set, or the mutex was made single-threaded,
+// then mutex operations are turned into nop.
 class ur_shared_mutex {
   std::shared_mutex Mutex;
+  ur_lock_acquirer Acquirer;
+  bool SingleThreaded = SingleThreadMode;
 
 public:
+  ur_shared_mutex() = default;
+  // Names the lock in the counters of UR_ENABLE_LOCK_STATS builds
+  explicit ur_shared_mutex(const char *Name) { Acquirer.setName(Name); }
+
+  // Turns the operations into nop for an object the application promised to
+  // use from one thread at a time. Must be called before the mutex is shared.
+  void setSingleThreaded() { SingleThreaded = true; }
+
   void lock() {
-    if (!SingleThreadMode) {
-      Mutex.lock();
+    if (!SingleThreaded) {
+      Acquirer.acquire([this] { return Mutex.try_lock(); },
+                       [this] { Mutex.lock(); });
     }
   }
-  bool try_lock() { return SingleThreadMode ? true : Mutex.try_lock(); }
+  bool try_lock() { return SingleThreaded ? true : Mutex.try_lock(); }
   void unlock() {
-    if (!SingleThreadMode) {
+    if (!SingleThreaded) {
       Mutex.unlock();
     }
   }
 
   void lock_shared() {
-    if (!SingleThreadMode) {
-      Mutex.lock_shared();
+    if (!SingleThreaded) {
+      Acquirer.acquire([this] { return Mutex.try_lock_shared(); },
+                       [this] { Mutex.lock_shared(); });
     }
   }
   bool try_lock_shared() {
-    return SingleThreadMode ? true : Mutex.try_lock_shared();
+    return SingleThreaded ? true : Mutex.try_lock_shared();
   }
   void unlock_shared() {
-    if (!SingleThreadMode) {
+    if (!SingleThreaded) {
       Mutex.unlock_shared();
     }
   }
 };
 
 // Class which acts like std::mutex if SingleThreadMode variable is not set.
-// If SingleThreadMode variable is set then mutex operations are turned into
-// nop.
+// If SingleThreadMode variable is set, or the mutex was made single-threaded,
+// then mutex operations are turned into nop.
 class ur_mutex {
   std::mutex Mutex;
+  ur_lock_acquirer Acquirer;
+  bool SingleThreaded = SingleThreadMode;
   friend class ur_lock;
 
 public:
+  ur_mutex() = default;
+  // Names the lock in the counters of UR_ENABLE_LOCK_STATS builds
+  explicit ur_mutex(const char *Name) { Acquirer.setName(Name); }
+
+  // Turns the operations into nop for an object the application promised to
+  // use from one thread at a time. Must be called before the mutex is shared.
+  void setSingleThreaded() { SingleThreaded = true; }
+
   void lock() {
-    if (!SingleThreadMode) {
-      Mutex.lock();
+    if (!SingleThreaded) {
+      Acquirer.acquire([this] { return Mutex.try_lock(); },
+                       [this] { Mutex.lock(); });
     }
   }
-  bool try_lock() { return SingleThreadMode ? true : Mutex.try_lock(); }
+  bool try_lock() { return SingleThreaded ? true : Mutex.try_lock(); }
   void unlock() {
-    if (!SingleThreadMode) {
+    if (!SingleThreaded) {
       Mutex.unlock();
     }
   }
@@ -136,8 +287,9 @@ class ur_lock {
 
 public:
   explicit ur_lock(ur_mutex &Mutex) {
-    if (!SingleThreadMode) {
-      Lock = std::unique_lock<std::mutex>(Mutex.Mutex);
+    if (!Mutex.SingleThreaded) {
+      Mutex.lock();
+      Lock = std::unique_lock<std::mutex>(Mutex.Mutex, std::adopt_lock);
     }
   }
 };
@@ -319,6 +471,61 @@ protected:
   size_t *param_value_size_ret;
 };
 
+namespace ur {
+// Cache of the values of the immutable properties of a device, for adapters
+// to serve urDeviceGetInfo from memory. A value is queried from the backend on
+// first use, through the adapter's own implementation of urDeviceGetInfo, and
+// the properties which may change are always queried.
+class DeviceInfoCache {
+public:
+  static bool isCached(ur_device_info_t PropName) {
+    switch (PropName) {
+    case UR_DEVICE_INFO_AVAILABLE:
+    case UR_DEVICE_INFO_GLOBAL_MEM_FREE:
+    case UR_DEVICE_INFO_REFERENCE_COUNT:
+      return false;
+    default:
+      return true;
+    }
+  }
+
+  // Returns the value of PropName like urDeviceGetInfo, where Query is the
+  // urDeviceGetInfo of the adapter for that property.
+  template <typename QueryFn>
+  ur_result_t get(ur_device_info_t PropName, size_t PropSize, void *PropValue,
+                  size_t *PropSizeRet, QueryFn &&Query) {
+    if (!isCached(PropName))
+      return Query(PropSize, PropValue, PropSizeRet);
+
+    {
+      std::shared_lock<ur_shared_mutex> Lock(Mutex);
+      auto It = Values.find(PropName);
+      if (It != Values.end())
+        return getInfoArray(It->second.size(), PropSize, PropValue,
+                            PropSizeRet, It->second.data());
+    }
+
+    size_t Size = 0;
+    if (auto Res = Query(0, nullptr, &Size))
+      return Res;
+    std::vector<char> Value(Size);
+    if (Size) {
+      if (auto Res = Query(Size, Value.data(), nullptr))
+        return Res;
+    }
+
+    std::unique_lock<ur_shared_mutex> Lock(Mutex);
+    auto &Cached = Values.emplace(PropName, std::move(Value)).first->second;
+    return getInfoArray(Cached.size(), PropSize, PropValue, PropSizeRet,
+                        Cached.data());
+  }
+
+private:
+  ur_shared_mutex Mutex;
+  std::unordered_map<ur_device_info_t, std::vector<char>> Values;
+};
+} // namespace ur
+
 template <typename T> class Result {
 public:
   Result(ur_result_t err) : value_or_err(err) {}
@@ -392,3 +599,131 @@ static inline void roundToHighestFactorOfGlobalSizeIn3d(
                MaxBlockDim[2]));
   roundToHighestFactorOfGlobalSize(ThreadsPerBlock[2], GlobalSize[2]);
 }
+
+namespace ur {
+// Normalizes an event wait list into the events an enqueue still has to wait
+// on, in the order of the list: null and duplicate events are dropped, as are
+// events known to have completed, and of several events from one in-order
+// sequence, such as a stream, only the newest is kept. Traits provides
+//   static const void *sequence(EventT) - the in-order sequence the command of
+//       the event was enqueued to, nullptr if the event can't be collapsed
+//   static uint64_t order(EventT) - increases with the commands of a sequence
+//   static bool isCompleted(EventT) - whether the event is known to have
+//       completed, ideally without calling into the driver
+template <typename Traits, typename EventT>
+void normalizeEventWaitList(const EventT *EventWaitList, size_t NumEvents,
+                            std::vector<EventT> &Events) {
+  Events.clear();
+  for (size_t I = 0; I < NumEvents; I++) {
+    if (EventWaitList[I] && !Traits::isCompleted(EventWaitList[I])) {
+      Events.push_back(EventWaitList[I]);
+    }
+  }
+  if (Events.size() < 2) {
+    return;
+  }
+
+  // Events are grouped by sequence, or by themselves when they have none, and
+  // the newest of each group is kept
+  auto GroupOf = [](EventT Event) {
+    const void *Sequence = Traits::sequence(Event);
+    return Sequence ? Sequence : static_cast<const void *>(Event);
+  };
+  auto OrderOf = [](EventT Event) {
+    return Traits::sequence(Event) ? Traits::order(Event) : 0;
+  };
+
+  // Wait lists are mostly short, compare the events pairwise then
+  constexpr size_t MaxPairwiseEvents = 16;
+  if (Events.size() <= MaxPairwiseEvents) {
+    size_t NumKept = 0;
+    for (size_t I = 0; I < Events.size(); I++) {
+      const void *Group = GroupOf(Events[I]);
+      const uint64_t Order = OrderOf(Events[I]);
+      bool Superseded = false;
+      for (size_t J = 0; J < Events.size() && !Superseded; J++) {
+        Superseded = J != I && GroupOf(Events[J]) == Group &&
+                     (OrderOf(Events[J]) > Order ||
+                      (OrderOf(Events[J]) == Order && J < I));
+      }
+      if (!Superseded) {
+        Events[NumKept++] = Events[I];
+      }
+    }
+    Events.resize(NumKept);
+    return;
+  }
+
+  struct Entry {
+    const void *Group;
+    uint64_t Order;
+    size_t Index;
+  };
+  std::vector<Entry> Entries;
+  Entries.reserve(Events.size());
+  for (size_t I = 0; I < Events.size(); I++) {
+    Entries.push_back({GroupOf(Events[I]), OrderOf(Events[I]), I});
+  }
+  // Newest first within each group, then first in the list
+  std::sort(Entries.begin(), Entries.end(),
+            [](const Entry &A, const Entry &B) {
+              if (A.Group != B.Group) {
+                return std::less<const void *>{}(A.Group, B.Group);
+              }
+              if (A.Order != B.Order) {
+                return A.Order > B.Order;
+              }
+              return A.Index < B.Index;
+            });
+  std::vector<bool> Kept(Events.size(), false);
+  for (size_t I = 0; I < Entries.size(); I++) {
+    if (I == 0 || Entries[I].Group != Entries[I - 1].Group) {
+      Kept[Entries[I].Index] = true;
+    }
+  }
+  size_t NumKept = 0;
+  for (size_t I = 0; I < Events.size(); I++) {
+    if (Kept[I]) {
+      Events[NumKept++] = Events[I];
+    }
+  }
+  Events.resize(NumKept);
+}
+
+// Waits until one of NumEvents events has completed and sets Index to it.
+// Query(I, Completed) sets whether event I has completed without blocking, and
+// returns an error to end the wait with, Index then being set to I. The events
+// are polled in turn, and between rounds the thread spins, then yields, then
+// sleeps for doubling periods, so that a wait returns soon after a short command
+// and a long wait on many events doesn't take a core.
+template <typename QueryT>
+ur_result_t waitAnyEvent(uint32_t NumEvents, QueryT &&Query, uint32_t &Index) {
+  constexpr uint32_t SpinRounds = 64;
+  constexpr uint32_t YieldRounds = 64;
+  constexpr std::chrono::microseconds MaxSleep{256};
+  std::chrono::microseconds Sleep{1};
+  for (uint32_t Round = 0;; Round++) {
+    for (uint32_t I = 0; I < NumEvents; I++) {
+      bool Completed = false;
+      if (ur_result_t Result = Query(I, Completed);
+          Result != UR_RESULT_SUCCESS) {
+        Index = I;
+        return Result;
+      }
+      if (Completed) {
+        Index = I;
+        return UR_RESULT_SUCCESS;
+      }
+    }
+    if (Round < SpinRounds) {
+      continue;
+    }
+    if (Round < SpinRounds + YieldRounds) {
+      std::this_thread::yield();
+    } else {
+      std::this_thread::sleep_for(Sleep);
+      Sleep = std::min(Sleep * 2, MaxSleep);
+    }
+  }
+}
+} // namespace ur
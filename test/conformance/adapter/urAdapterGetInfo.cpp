@@ -25,7 +25,8 @@ std::unordered_map<ur_adapter_info_t, size_t> adapter_info_size_map = {
 
 INSTANTIATE_TEST_SUITE_P(
     urAdapterGetInfo, urAdapterGetInfoTest,
-    ::testing::Values(UR_ADAPTER_INFO_BACKEND, UR_ADAPTER_INFO_REFERENCE_COUNT),
+    ::testing::Values(UR_ADAPTER_INFO_BACKEND, UR_ADAPTER_INFO_REFERENCE_COUNT,
+                      UR_ADAPTER_INFO_PERF_COUNTERS),
     [](const ::testing::TestParamInfo<ur_adapter_info_t> &info) {
         std::stringstream ss;
         ss << info.param;
@@ -105,3 +106,15 @@ TEST_F(urAdapterGetInfoTest, ValidAdapterBackend) {
     ASSERT_TRUE(backend >= UR_ADAPTER_BACKEND_LEVEL_ZERO &&
                 backend <= UR_ADAPTER_BACKEND_NATIVE_CPU);
 }
+
+TEST_F(urAdapterGetInfoTest, PerfCountersNullTerminated) {
+    size_t size = 0;
+    ASSERT_SUCCESS(urAdapterGetInfo(adapter, UR_ADAPTER_INFO_PERF_COUNTERS, 0,
+                                    nullptr, &size));
+    ASSERT_NE(size, 0);
+
+    std::vector<char> counters(size);
+    ASSERT_SUCCESS(urAdapterGetInfo(adapter, UR_ADAPTER_INFO_PERF_COUNTERS,
+                                    size, counters.data(), nullptr));
+    ASSERT_EQ(counters.back(), '\0');
+}
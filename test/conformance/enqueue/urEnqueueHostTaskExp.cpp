@@ -0,0 +1,100 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <atomic>
+#include <uur/fixtures.h>
+
+struct urEnqueueHostTaskExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ur_bool_t host_task_support = false;
+        ASSERT_SUCCESS(urDeviceGetInfo(
+            device, UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP,
+            sizeof(host_task_support), &host_task_support, nullptr));
+        if (!host_task_support) {
+            GTEST_SKIP() << "Host tasks are not supported";
+        }
+    }
+
+    // Appends the number of tasks counted before it ran to order
+    static void countTask(void *pUserData) {
+        auto test = static_cast<urEnqueueHostTaskExpTest *>(pUserData);
+        test->order.push_back(test->count++);
+    }
+
+    std::atomic<uint32_t> count{0};
+    std::vector<uint32_t> order;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueHostTaskExpTest);
+
+TEST_P(urEnqueueHostTaskExpTest, Success) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueHostTaskExp(queue, countTask, this, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_EQ(count, 1);
+
+    ur_command_t type;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_TYPE,
+                                  sizeof(type), &type, nullptr));
+    ASSERT_EQ(type, UR_COMMAND_ENQUEUE_HOST_TASK_EXP);
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urEnqueueHostTaskExpTest, SuccessInOrder) {
+    constexpr uint32_t numTasks = 8;
+    for (uint32_t i = 0; i < numTasks; ++i) {
+        ASSERT_SUCCESS(
+            urEnqueueHostTaskExp(queue, countTask, this, 0, nullptr, nullptr));
+    }
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    ASSERT_EQ(order.size(), numTasks);
+    for (uint32_t i = 0; i < numTasks; ++i) {
+        ASSERT_EQ(order[i], i);
+    }
+}
+
+TEST_P(urEnqueueHostTaskExpTest, SuccessWithWaitList) {
+    ur_event_handle_t first = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueHostTaskExp(queue, countTask, this, 0, nullptr, &first));
+    ur_event_handle_t second = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueHostTaskExp(queue, countTask, this, 1, &first, &second));
+    ASSERT_SUCCESS(urEventWait(1, &second));
+    ASSERT_EQ(count, 2);
+    ASSERT_SUCCESS(urEventRelease(first));
+    ASSERT_SUCCESS(urEventRelease(second));
+}
+
+TEST_P(urEnqueueHostTaskExpTest, InvalidNullHandleQueue) {
+    ASSERT_EQ_RESULT(
+        urEnqueueHostTaskExp(nullptr, countTask, this, 0, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE);
+}
+
+TEST_P(urEnqueueHostTaskExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(
+        urEnqueueHostTaskExp(queue, nullptr, this, 0, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_NULL_POINTER);
+}
+
+TEST_P(urEnqueueHostTaskExpTest, InvalidEventWaitList) {
+    ASSERT_EQ_RESULT(
+        urEnqueueHostTaskExp(queue, countTask, this, 1, nullptr, nullptr),
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+    ur_event_handle_t validEvent;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &validEvent));
+    ASSERT_EQ_RESULT(
+        urEnqueueHostTaskExp(queue, countTask, this, 0, &validEvent, nullptr),
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+
+    ur_event_handle_t inv_evt = nullptr;
+    ASSERT_EQ_RESULT(
+        urEnqueueHostTaskExp(queue, countTask, this, 1, &inv_evt, nullptr),
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST);
+    ASSERT_SUCCESS(urEventRelease(validEvent));
+}
@@ -359,6 +359,34 @@ TEST_P(urEnqueueKernelLaunchWithUSM, Success) {
     }
 }
 
+TEST_P(urEnqueueKernelLaunchWithUSM, SuccessSettingArgsAgain) {
+    size_t work_dim = 1;
+    size_t global_offset = 0;
+    size_t global_size = alloc_size / sizeof(uint32_t);
+    auto *ptr = static_cast<uint32_t *>(usmPtr);
+
+    // Set the same values before the second launch, as frameworks do, and a
+    // new value before the third one.
+    for (uint32_t fill_val : {42, 42, 7}) {
+        ASSERT_SUCCESS(urKernelSetArgPointer(kernel, 0, nullptr, usmPtr));
+        ASSERT_SUCCESS(urKernelSetArgValue(kernel, 1, sizeof(fill_val),
+                                           nullptr, &fill_val));
+
+        for (size_t i = 0; i < global_size; i++) {
+            ptr[i] = 0;
+        }
+
+        ASSERT_SUCCESS(urEnqueueKernelLaunch(queue, kernel, work_dim,
+                                             &global_offset, &global_size,
+                                             nullptr, 0, nullptr, nullptr));
+        ASSERT_SUCCESS(urQueueFinish(queue));
+
+        for (size_t i = 0; i < global_size; i++) {
+            ASSERT_EQ(ptr[i], fill_val);
+        }
+    }
+}
+
 struct urEnqueueKernelLaunchWithVirtualMemory : uur::urKernelExecutionTest {
 
     void SetUp() override {
@@ -0,0 +1,130 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEnqueueKernelLaunchMultiExpTest : uur::urKernelExecutionTest {
+    void SetUp() {
+        program_name = "fill_usm";
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::SetUp());
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &other_queue));
+    }
+
+    void TearDown() {
+        for (auto allocation : allocations) {
+            if (allocation) {
+                ASSERT_SUCCESS(urUSMFree(context, allocation));
+            }
+        }
+        if (other_queue) {
+            ASSERT_SUCCESS(urQueueRelease(other_queue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::TearDown());
+    }
+
+    ur_exp_kernel_launch_t Launch(ur_queue_handle_t hQueue,
+                                  ur_exp_kernel_arg_t *args) {
+        ur_exp_kernel_launch_t launch{};
+        launch.hQueue = hQueue;
+        launch.hKernel = kernel;
+        launch.workDim = 1;
+        launch.pGlobalWorkOffset = &global_offset;
+        launch.pGlobalWorkSize = &array_size;
+        launch.numArgs = 2;
+        launch.pArgs = args;
+        return launch;
+    }
+
+    ur_exp_kernel_arg_t PointerArg(const void *pointer) {
+        ur_exp_kernel_arg_t arg{};
+        arg.type = UR_EXP_KERNEL_ARG_TYPE_POINTER;
+        arg.index = 0;
+        arg.value.pointer = pointer;
+        return arg;
+    }
+
+    ur_exp_kernel_arg_t ValueArg(const uint32_t *value) {
+        ur_exp_kernel_arg_t arg{};
+        arg.type = UR_EXP_KERNEL_ARG_TYPE_VALUE;
+        arg.index = 1;
+        arg.size = sizeof(uint32_t);
+        arg.value.value = value;
+        return arg;
+    }
+
+    ur_queue_handle_t other_queue = nullptr;
+    void *allocations[3] = {};
+    size_t global_offset = 0;
+    size_t array_size = 16;
+    size_t allocation_size = array_size * sizeof(uint32_t);
+    uint32_t data[3] = {42, 43, 44};
+};
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urEnqueueKernelLaunchMultiExpTest);
+
+TEST_P(urEnqueueKernelLaunchMultiExpTest, Success) {
+    ur_device_usm_access_capability_flags_t shared_usm_flags = 0;
+    ASSERT_SUCCESS(
+        uur::GetDeviceUSMSingleSharedSupport(device, shared_usm_flags));
+    if (!(shared_usm_flags & UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ACCESS)) {
+        GTEST_SKIP() << "Shared USM is not supported.";
+    }
+
+    for (auto &allocation : allocations) {
+        ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                        allocation_size, &allocation));
+        ASSERT_NE(allocation, nullptr);
+    }
+
+    // The first two launches share a queue, the last one doesn't
+    ur_exp_kernel_arg_t args[3][2];
+    ur_queue_handle_t queues[3] = {queue, queue, other_queue};
+    ur_exp_kernel_launch_t launches[3];
+    ur_event_handle_t events[3] = {};
+    for (size_t i = 0; i < 3; i++) {
+        args[i][0] = PointerArg(allocations[i]);
+        args[i][1] = ValueArg(&data[i]);
+        launches[i] = Launch(queues[i], args[i]);
+        launches[i].phEvent = &events[i];
+    }
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(
+        urEnqueueKernelLaunchMultiExp(3, launches));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+    ASSERT_SUCCESS(urQueueFinish(other_queue));
+
+    for (size_t i = 0; i < 3; i++) {
+        ASSERT_NE(events[i], nullptr);
+        ASSERT_SUCCESS(urEventRelease(events[i]));
+        for (size_t j = 0; j < array_size; j++) {
+            ASSERT_EQ(static_cast<uint32_t *>(allocations[i])[j], data[i]);
+        }
+    }
+}
+
+TEST_P(urEnqueueKernelLaunchMultiExpTest, InvalidNullPointerLaunches) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueKernelLaunchMultiExp(1, nullptr));
+}
+
+TEST_P(urEnqueueKernelLaunchMultiExpTest, InvalidSizeNumLaunches) {
+    ur_exp_kernel_arg_t args[2] = {PointerArg(nullptr), ValueArg(&data[0])};
+    auto launch = Launch(queue, args);
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urEnqueueKernelLaunchMultiExp(0, &launch));
+}
+
+TEST_P(urEnqueueKernelLaunchMultiExpTest, InvalidNullHandleQueue) {
+    ur_exp_kernel_arg_t args[2] = {PointerArg(nullptr), ValueArg(&data[0])};
+    auto launch = Launch(nullptr, args);
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueKernelLaunchMultiExp(1, &launch));
+}
+
+TEST_P(urEnqueueKernelLaunchMultiExpTest, InvalidNullHandleKernel) {
+    ur_exp_kernel_arg_t args[2] = {PointerArg(nullptr), ValueArg(&data[0])};
+    auto launch = Launch(queue, args);
+    launch.hKernel = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueKernelLaunchMultiExp(1, &launch));
+}
@@ -0,0 +1,145 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+#include <vector>
+
+struct urEnqueueUSMAsyncAllocExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+
+        ur_device_usm_access_capability_flags_t device_usm = 0;
+        ASSERT_SUCCESS(uur::GetDeviceUSMDeviceSupport(device, device_usm));
+        if (!device_usm) {
+            GTEST_SKIP() << "Device USM is not supported";
+        }
+
+        void *ptr = nullptr;
+        auto result = urEnqueueUSMDeviceAllocExp(queue, allocation_size, 0,
+                                                 nullptr, &ptr, nullptr);
+        if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE ||
+            result == UR_RESULT_ERROR_UNINITIALIZED) {
+            GTEST_SKIP() << "Queue-ordered allocations are not supported";
+        }
+        ASSERT_SUCCESS(result);
+        ASSERT_SUCCESS(urEnqueueUSMFreeExp(queue, ptr, 0, nullptr, nullptr));
+        ASSERT_SUCCESS(urQueueFinish(queue));
+    }
+
+    void allocate(void **ptr, ur_event_handle_t *event = nullptr) {
+        ASSERT_SUCCESS(urEnqueueUSMDeviceAllocExp(queue, allocation_size, 0,
+                                                  nullptr, ptr, event));
+        ASSERT_NE(*ptr, nullptr);
+    }
+
+    void fillAndCheck(void *ptr, uint8_t value) {
+        ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(value), &value,
+                                        allocation_size, 0, nullptr, nullptr));
+        std::vector<uint8_t> host_mem(allocation_size);
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, host_mem.data(), ptr,
+                                          allocation_size, 0, nullptr,
+                                          nullptr));
+        for (auto i : host_mem) {
+            ASSERT_EQ(i, value);
+        }
+    }
+
+    static constexpr size_t allocation_size = 1024;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueUSMAsyncAllocExpTest);
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, Success) {
+    void *ptr = nullptr;
+    UUR_RETURN_ON_FATAL_FAILURE(allocate(&ptr));
+    UUR_RETURN_ON_FATAL_FAILURE(fillAndCheck(ptr, 42));
+
+    ASSERT_SUCCESS(urEnqueueUSMFreeExp(queue, ptr, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, SuccessWithEvents) {
+    void *ptr = nullptr;
+    ur_event_handle_t alloc_event = nullptr;
+    UUR_RETURN_ON_FATAL_FAILURE(allocate(&ptr, &alloc_event));
+    ASSERT_NE(alloc_event, nullptr);
+
+    uint8_t value = 7;
+    ur_event_handle_t fill_event = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(value), &value,
+                                    allocation_size, 1, &alloc_event,
+                                    &fill_event));
+
+    ur_event_handle_t free_event = nullptr;
+    ASSERT_SUCCESS(
+        urEnqueueUSMFreeExp(queue, ptr, 1, &fill_event, &free_event));
+    ASSERT_NE(free_event, nullptr);
+    ASSERT_SUCCESS(urEventWait(1, &free_event));
+
+    EXPECT_SUCCESS(urEventRelease(alloc_event));
+    EXPECT_SUCCESS(urEventRelease(fill_event));
+    EXPECT_SUCCESS(urEventRelease(free_event));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, SuccessReuse) {
+    void *ptr = nullptr;
+    UUR_RETURN_ON_FATAL_FAILURE(allocate(&ptr));
+    UUR_RETURN_ON_FATAL_FAILURE(fillAndCheck(ptr, 1));
+    ASSERT_SUCCESS(urEnqueueUSMFreeExp(queue, ptr, 0, nullptr, nullptr));
+
+    // The memory freed on the queue may be handed out again
+    void *other_ptr = nullptr;
+    UUR_RETURN_ON_FATAL_FAILURE(allocate(&other_ptr));
+    UUR_RETURN_ON_FATAL_FAILURE(fillAndCheck(other_ptr, 2));
+    ASSERT_SUCCESS(urEnqueueUSMFreeExp(queue, other_ptr, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, SuccessFreeWithUSMFree) {
+    void *ptr = nullptr;
+    UUR_RETURN_ON_FATAL_FAILURE(allocate(&ptr));
+    UUR_RETURN_ON_FATAL_FAILURE(fillAndCheck(ptr, 3));
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, InvalidNullHandleQueue) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueUSMDeviceAllocExp(nullptr, allocation_size, 0,
+                                                nullptr, &ptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueUSMFreeExp(nullptr, &ptr, 0, nullptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueUSMDeviceAllocExp(queue, allocation_size, 0,
+                                                nullptr, nullptr, nullptr));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEnqueueUSMFreeExp(queue, nullptr, 0, nullptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, InvalidUSMSize) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_USM_SIZE,
+        urEnqueueUSMDeviceAllocExp(queue, 0, 0, nullptr, &ptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMAsyncAllocExpTest, InvalidEventWaitList) {
+    void *ptr = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+                     urEnqueueUSMDeviceAllocExp(queue, allocation_size, 1,
+                                                nullptr, &ptr, nullptr));
+
+    ur_event_handle_t validEvent;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &validEvent));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+                     urEnqueueUSMDeviceAllocExp(queue, allocation_size, 0,
+                                                &validEvent, &ptr, nullptr));
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+        urEnqueueUSMFreeExp(queue, &ptr, 0, &validEvent, nullptr));
+    ASSERT_SUCCESS(urEventRelease(validEvent));
+}
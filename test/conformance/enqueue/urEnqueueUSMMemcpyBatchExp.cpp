@@ -0,0 +1,152 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+#include <vector>
+
+struct urEnqueueUSMMemcpyBatchExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+
+        ur_device_usm_access_capability_flags_t device_usm = 0;
+        ASSERT_SUCCESS(uur::GetDeviceUSMDeviceSupport(device, device_usm));
+        if (!device_usm) {
+            GTEST_SKIP() << "Device USM is not supported";
+        }
+
+        ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                                        allocation_size, &device_src));
+        ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, nullptr,
+                                        allocation_size, &device_dst));
+
+        // Each block of the source holds its index
+        for (uint32_t i = 0; i < num_blocks; ++i) {
+            uint8_t value = static_cast<uint8_t>(i);
+            ASSERT_SUCCESS(urEnqueueUSMFill(queue, block(device_src, i),
+                                            sizeof(value), &value, block_size,
+                                            0, nullptr, nullptr));
+        }
+        ASSERT_SUCCESS(urQueueFinish(queue));
+
+        // The blocks are copied in reverse order
+        for (uint32_t i = 0; i < num_blocks; ++i) {
+            dsts.push_back(block(device_dst, num_blocks - 1 - i));
+            srcs.push_back(block(device_src, i));
+            sizes.push_back(block_size);
+        }
+    }
+
+    void TearDown() override {
+        if (device_src) {
+            EXPECT_SUCCESS(urUSMFree(context, device_src));
+        }
+        if (device_dst) {
+            EXPECT_SUCCESS(urUSMFree(context, device_dst));
+        }
+
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::TearDown());
+    }
+
+    static void *block(void *base, uint32_t index) {
+        return static_cast<uint8_t *>(base) + index * block_size;
+    }
+
+    void verifyData() {
+        std::vector<uint8_t> host_mem(allocation_size);
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, host_mem.data(),
+                                          device_dst, allocation_size, 0,
+                                          nullptr, nullptr));
+        for (uint32_t i = 0; i < num_blocks; ++i) {
+            uint8_t expected = static_cast<uint8_t>(num_blocks - 1 - i);
+            for (uint32_t j = 0; j < block_size; ++j) {
+                ASSERT_EQ(host_mem[i * block_size + j], expected);
+            }
+        }
+    }
+
+    static constexpr uint32_t num_blocks = 16;
+    static constexpr uint32_t block_size = 64;
+    static constexpr uint32_t allocation_size = num_blocks * block_size;
+
+    void *device_src = nullptr;
+    void *device_dst = nullptr;
+    std::vector<void *> dsts;
+    std::vector<const void *> srcs;
+    std::vector<size_t> sizes;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEnqueueUSMMemcpyBatchExpTest);
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, Blocking) {
+    ASSERT_SUCCESS(urEnqueueUSMMemcpyBatchExp(
+        queue, true, num_blocks, dsts.data(), srcs.data(), sizes.data(), 0,
+        nullptr, nullptr));
+    ASSERT_NO_FATAL_FAILURE(verifyData());
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, NonBlockingWithEvent) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpyBatchExp(
+        queue, false, num_blocks, dsts.data(), srcs.data(), sizes.data(), 0,
+        nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+
+    ur_command_t type;
+    ASSERT_SUCCESS(urEventGetInfo(event, UR_EVENT_INFO_COMMAND_TYPE,
+                                  sizeof(type), &type, nullptr));
+    ASSERT_EQ(type, UR_COMMAND_USM_MEMCPY_BATCH_EXP);
+    ASSERT_SUCCESS(urEventRelease(event));
+    ASSERT_NO_FATAL_FAILURE(verifyData());
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, WaitForDependencies) {
+    ur_event_handle_t fill_event = nullptr;
+    uint8_t value = 0xff;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, device_dst, sizeof(value), &value,
+                                    allocation_size, 0, nullptr, &fill_event));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpyBatchExp(
+        queue, true, num_blocks, dsts.data(), srcs.data(), sizes.data(), 1,
+        &fill_event, nullptr));
+    ASSERT_SUCCESS(urEventRelease(fill_event));
+    ASSERT_NO_FATAL_FAILURE(verifyData());
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, InvalidNullQueueHandle) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEnqueueUSMMemcpyBatchExp(nullptr, true, num_blocks,
+                                                dsts.data(), srcs.data(),
+                                                sizes.data(), 0, nullptr,
+                                                nullptr));
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, InvalidNullPointer) {
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_POINTER,
+        urEnqueueUSMMemcpyBatchExp(queue, true, num_blocks, nullptr,
+                                   srcs.data(), sizes.data(), 0, nullptr,
+                                   nullptr));
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_POINTER,
+        urEnqueueUSMMemcpyBatchExp(queue, true, num_blocks, dsts.data(),
+                                   nullptr, sizes.data(), 0, nullptr, nullptr));
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_POINTER,
+        urEnqueueUSMMemcpyBatchExp(queue, true, num_blocks, dsts.data(),
+                                   srcs.data(), nullptr, 0, nullptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, InvalidSize) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urEnqueueUSMMemcpyBatchExp(queue, true, 0, dsts.data(),
+                                                srcs.data(), sizes.data(), 0,
+                                                nullptr, nullptr));
+}
+
+TEST_P(urEnqueueUSMMemcpyBatchExpTest, InvalidNullPtrEventWaitList) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT_WAIT_LIST,
+                     urEnqueueUSMMemcpyBatchExp(queue, true, num_blocks,
+                                                dsts.data(), srcs.data(),
+                                                sizes.data(), 1, nullptr,
+                                                nullptr));
+}
@@ -0,0 +1,104 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEventIPCExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ur_bool_t ipc_event_support = false;
+        ASSERT_SUCCESS(urDeviceGetInfo(
+            device, UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP,
+            sizeof(ipc_event_support), &ipc_event_support, nullptr));
+        if (!ipc_event_support) {
+            GTEST_SKIP() << "IPC events are not supported";
+        }
+        ASSERT_SUCCESS(urEventCreateIPCExp(context, device, &ipc_event));
+    }
+
+    void TearDown() override {
+        if (ipc_event) {
+            EXPECT_SUCCESS(urEventRelease(ipc_event));
+        }
+        urQueueTest::TearDown();
+    }
+
+    ur_event_handle_t ipc_event = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEventIPCExpTest);
+
+TEST_P(urEventIPCExpTest, GetIPCHandle) {
+    ur_exp_ipc_event_handle_t ipc_handle{};
+    ASSERT_SUCCESS(urEventGetIPCHandleExp(ipc_event, &ipc_handle));
+}
+
+TEST_P(urEventIPCExpTest, SignalThenWait) {
+    ur_event_handle_t signal_event = nullptr;
+    ASSERT_SUCCESS(urEnqueueIPCEventSignalExp(queue, ipc_event, 0, nullptr,
+                                              &signal_event));
+    ur_event_handle_t wait_event = nullptr;
+    ASSERT_SUCCESS(urEnqueueIPCEventWaitExp(queue, ipc_event, 1,
+                                            &signal_event, &wait_event));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    ur_command_t type;
+    ASSERT_SUCCESS(urEventGetInfo(wait_event, UR_EVENT_INFO_COMMAND_TYPE,
+                                  sizeof(type), &type, nullptr));
+    ASSERT_EQ(type, UR_COMMAND_IPC_EVENT_WAIT_EXP);
+    ur_event_status_t status;
+    ASSERT_SUCCESS(urEventGetInfo(wait_event,
+                                  UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                  sizeof(status), &status, nullptr));
+    ASSERT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+
+    EXPECT_SUCCESS(urEventRelease(signal_event));
+    EXPECT_SUCCESS(urEventRelease(wait_event));
+}
+
+TEST_P(urEventIPCExpTest, SignalWaitRepeatedly) {
+    // Each wait consumes the signal enqueued before it
+    for (int i = 0; i < 4; i++) {
+        ASSERT_SUCCESS(
+            urEnqueueIPCEventSignalExp(queue, ipc_event, 0, nullptr, nullptr));
+        ASSERT_SUCCESS(
+            urEnqueueIPCEventWaitExp(queue, ipc_event, 0, nullptr, nullptr));
+    }
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urEventIPCExpTest, InvalidEvent) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_EVENT,
+        urEnqueueIPCEventSignalExp(queue, event, 0, nullptr, nullptr));
+    ur_exp_ipc_event_handle_t ipc_handle{};
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_EVENT,
+                     urEventGetIPCHandleExp(event, &ipc_handle));
+    EXPECT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urEventIPCExpTest, InvalidNullHandleContext) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urEventCreateIPCExp(nullptr, device, &event));
+}
+
+TEST_P(urEventIPCExpTest, InvalidNullPointerEvent) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventCreateIPCExp(context, device, nullptr));
+}
+
+TEST_P(urEventIPCExpTest, InvalidNullPointerIPCHandle) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventGetIPCHandleExp(ipc_event, nullptr));
+}
+
+TEST_P(urEventIPCExpTest, InvalidNullHandleQueue) {
+    ASSERT_EQ_RESULT(
+        UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+        urEnqueueIPCEventWaitExp(nullptr, ipc_event, 0, nullptr, nullptr));
+}
@@ -0,0 +1,77 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urEventWaitAnyExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ASSERT_SUCCESS(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, size,
+                                         nullptr, &buffer));
+        input.assign(count, 42);
+    }
+
+    void TearDown() override {
+        if (buffer) {
+            EXPECT_SUCCESS(urMemRelease(buffer));
+        }
+        urQueueTest::TearDown();
+    }
+
+    const size_t count = 1024;
+    const size_t size = sizeof(uint32_t) * count;
+    ur_mem_handle_t buffer = nullptr;
+    std::vector<uint32_t> input;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urEventWaitAnyExpTest);
+
+TEST_P(urEventWaitAnyExpTest, Success) {
+    ur_event_handle_t event1 = nullptr;
+    ASSERT_SUCCESS(urEnqueueMemBufferWrite(queue, buffer, false, 0, size,
+                                           input.data(), 0, nullptr, &event1));
+    std::vector<uint32_t> output(count, 1);
+    ur_event_handle_t event2 = nullptr;
+    ASSERT_SUCCESS(urEnqueueMemBufferRead(queue, buffer, false, 0, size,
+                                          output.data(), 0, nullptr, &event2));
+    std::vector<ur_event_handle_t> events{event1, event2};
+    uint32_t index = UINT32_MAX;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urEventWaitAnyExp(
+        static_cast<uint32_t>(events.size()), events.data(), &index));
+    ASSERT_LT(index, events.size());
+
+    ur_event_status_t status;
+    ASSERT_SUCCESS(urEventGetInfo(events[index],
+                                  UR_EVENT_INFO_COMMAND_EXECUTION_STATUS,
+                                  sizeof(status), &status, nullptr));
+    ASSERT_EQ(status, UR_EVENT_STATUS_COMPLETE);
+
+    ASSERT_SUCCESS(
+        urEventWait(static_cast<uint32_t>(events.size()), events.data()));
+    ASSERT_EQ(input, output);
+
+    EXPECT_SUCCESS(urEventRelease(event1));
+    EXPECT_SUCCESS(urEventRelease(event2));
+}
+
+TEST_P(urEventWaitAnyExpTest, ZeroSize) {
+    ur_event_handle_t event = nullptr;
+    uint32_t index = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_VALUE,
+                     urEventWaitAnyExp(0, &event, &index));
+}
+
+TEST_P(urEventWaitAnyExpTest, InvalidNullPointerEventList) {
+    uint32_t index = 0;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventWaitAnyExp(1, nullptr, &index));
+}
+
+TEST_P(urEventWaitAnyExpTest, InvalidNullPointerIndex) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 0, nullptr, &event));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urEventWaitAnyExp(1, &event, nullptr));
+    ASSERT_SUCCESS(urEventRelease(event));
+}
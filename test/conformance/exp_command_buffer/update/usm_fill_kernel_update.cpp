@@ -356,3 +356,90 @@ TEST_P(USMMultipleFillCommandTest, UpdateAllKernels) {
         ASSERT_EQ(expected, updated_output[i]) << i;
     }
 }
+
+// Test updating all the kernels commands in the command-buffer with a single
+// batched update call
+TEST_P(USMMultipleFillCommandTest, UpdateAllKernelsBatched) {
+    // Run command-buffer prior to update an verify output
+    ASSERT_SUCCESS(urCommandBufferEnqueueExp(updatable_cmd_buf_handle, queue, 0,
+                                             nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    uint32_t *output = (uint32_t *)shared_ptr;
+    for (size_t i = 0; i < global_size; i++) {
+        const uint32_t expected = val + (i / elements);
+        ASSERT_EQ(expected, output[i]);
+    }
+
+    // Create a new USM allocation to update kernel outputs to
+    ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                    allocation_size, &new_shared_ptr));
+    ASSERT_NE(new_shared_ptr, nullptr);
+    std::memset(new_shared_ptr, 0, allocation_size);
+
+    // The update descriptors of all the kernels must stay alive until the
+    // batched update call.
+    uint32_t new_val = 33;
+    std::array<void *, num_kernels> offset_ptrs;
+    std::array<uint32_t, num_kernels> new_fill_vals;
+    std::array<ur_exp_command_buffer_update_pointer_arg_desc_t, num_kernels>
+        new_output_descs;
+    std::array<ur_exp_command_buffer_update_value_arg_desc_t, num_kernels>
+        new_input_descs;
+    std::array<ur_exp_command_buffer_update_kernel_launch_desc_t, num_kernels>
+        update_descs;
+    for (size_t k = 0; k < num_kernels; k++) {
+        // Update output pointer to an offset into new USM allocation
+        offset_ptrs[k] = (uint32_t *)new_shared_ptr + (k * elements);
+        new_output_descs[k] = {
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_POINTER_ARG_DESC, // stype
+            nullptr,         // pNext
+            0,               // argIndex
+            nullptr,         // pProperties
+            &offset_ptrs[k], // pArgValue
+        };
+
+        // Update fill value
+        new_fill_vals[k] = new_val + k;
+        new_input_descs[k] = {
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_VALUE_ARG_DESC, // stype
+            nullptr,                                                    // pNext
+            1,                 // argIndex
+            sizeof(int),       // argSize
+            nullptr,           // pProperties
+            &new_fill_vals[k], // hArgValue
+        };
+
+        update_descs[k] = {
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_UPDATE_KERNEL_LAUNCH_DESC, // stype
+            nullptr,              // pNext
+            kernel,               // hNewKernel
+            0,                    // numNewMemObjArgs
+            1,                    // numNewPointerArgs
+            1,                    // numNewValueArgs
+            n_dimensions,         // newWorkDim
+            nullptr,              // pNewMemObjArgList
+            &new_output_descs[k], // pNewPointerArgList
+            &new_input_descs[k],  // pNewValueArgList
+            nullptr,              // pNewGlobalWorkOffset
+            nullptr,              // pNewGlobalWorkSize
+            nullptr,              // pNewLocalWorkSize
+        };
+    }
+
+    ASSERT_SUCCESS(urCommandBufferUpdateKernelLaunchBatchExp(
+        updatable_cmd_buf_handle, num_kernels, command_handles.data(),
+        update_descs.data()));
+
+    // Update kernel and enqueue command-buffer again
+    ASSERT_SUCCESS(urCommandBufferEnqueueExp(updatable_cmd_buf_handle, queue, 0,
+                                             nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+
+    // Verify that update occurred correctly
+    uint32_t *updated_output = (uint32_t *)new_shared_ptr;
+    for (size_t i = 0; i < global_size; i++) {
+        uint32_t expected = new_val + (i / elements);
+        ASSERT_EQ(expected, updated_output[i]) << i;
+    }
+}
@@ -0,0 +1,52 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "fixtures.h"
+
+struct urCommandBufferUploadExpTest
+    : uur::command_buffer::urCommandBufferExpTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(
+            uur::command_buffer::urCommandBufferExpTest::SetUp());
+        ASSERT_SUCCESS(urQueueCreate(context, device, nullptr, &queue));
+    }
+
+    void TearDown() override {
+        if (queue) {
+            EXPECT_SUCCESS(urQueueRelease(queue));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(
+            uur::command_buffer::urCommandBufferExpTest::TearDown());
+    }
+
+    ur_queue_handle_t queue = nullptr;
+};
+
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urCommandBufferUploadExpTest);
+
+TEST_P(urCommandBufferUploadExpTest, Success) {
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmd_buf_handle));
+    ASSERT_SUCCESS(urCommandBufferUploadExp(cmd_buf_handle, queue));
+
+    ASSERT_SUCCESS(
+        urCommandBufferEnqueueExp(cmd_buf_handle, queue, 0, nullptr, nullptr));
+    ASSERT_SUCCESS(urQueueFinish(queue));
+}
+
+TEST_P(urCommandBufferUploadExpTest, InvalidOperationNotFinalized) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_OPERATION,
+                     urCommandBufferUploadExp(cmd_buf_handle, queue));
+}
+
+TEST_P(urCommandBufferUploadExpTest, InvalidNullHandleCommandBuffer) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urCommandBufferUploadExp(nullptr, queue));
+}
+
+TEST_P(urCommandBufferUploadExpTest, InvalidNullHandleQueue) {
+    ASSERT_SUCCESS(urCommandBufferFinalizeExp(cmd_buf_handle));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urCommandBufferUploadExp(cmd_buf_handle, nullptr));
+}
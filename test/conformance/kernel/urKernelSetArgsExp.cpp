@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urKernelSetArgsExpTest : uur::urKernelExecutionTest {
+    void SetUp() {
+        program_name = "fill_usm";
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::SetUp());
+    }
+
+    void TearDown() {
+        if (allocation) {
+            ASSERT_SUCCESS(urUSMFree(context, allocation));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(urKernelExecutionTest::TearDown());
+    }
+
+    ur_exp_kernel_arg_t PointerArg(uint32_t index, const void *pointer) {
+        ur_exp_kernel_arg_t arg{};
+        arg.type = UR_EXP_KERNEL_ARG_TYPE_POINTER;
+        arg.index = index;
+        arg.value.pointer = pointer;
+        return arg;
+    }
+
+    ur_exp_kernel_arg_t ValueArg(uint32_t index) {
+        ur_exp_kernel_arg_t arg{};
+        arg.type = UR_EXP_KERNEL_ARG_TYPE_VALUE;
+        arg.index = index;
+        arg.size = sizeof(data);
+        arg.value.value = &data;
+        return arg;
+    }
+
+    void *allocation = nullptr;
+    size_t array_size = 16;
+    size_t allocation_size = array_size * sizeof(uint32_t);
+    uint32_t data = 42;
+};
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urKernelSetArgsExpTest);
+
+TEST_P(urKernelSetArgsExpTest, Success) {
+    ur_device_usm_access_capability_flags_t shared_usm_flags = 0;
+    ASSERT_SUCCESS(
+        uur::GetDeviceUSMSingleSharedSupport(device, shared_usm_flags));
+    if (!(shared_usm_flags & UR_DEVICE_USM_ACCESS_CAPABILITY_FLAG_ACCESS)) {
+        GTEST_SKIP() << "Shared USM is not supported.";
+    }
+
+    ASSERT_SUCCESS(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                    allocation_size, &allocation));
+    ASSERT_NE(allocation, nullptr);
+
+    ur_exp_kernel_arg_t args[] = {PointerArg(0, allocation), ValueArg(1)};
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urKernelSetArgsExp(kernel, 2, args));
+    Launch1DRange(array_size);
+    for (size_t i = 0; i < array_size; i++) {
+        ASSERT_EQ(static_cast<uint32_t *>(allocation)[i], data);
+    }
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidNullHandleKernel) {
+    ur_exp_kernel_arg_t args[] = {ValueArg(1)};
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urKernelSetArgsExp(nullptr, 1, args));
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidNullPointerArgs) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urKernelSetArgsExp(kernel, 1, nullptr));
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidSizeNumArgs) {
+    ur_exp_kernel_arg_t args[] = {ValueArg(1)};
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_SIZE,
+                     urKernelSetArgsExp(kernel, 0, args));
+}
+
+TEST_P(urKernelSetArgsExpTest, InvalidEnumerationType) {
+    ur_exp_kernel_arg_t args[] = {ValueArg(1)};
+    args[0].type = UR_EXP_KERNEL_ARG_TYPE_FORCE_UINT32;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_ENUMERATION,
+                     urKernelSetArgsExp(kernel, 1, args));
+}
@@ -0,0 +1,49 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+using urProgramBuildAsyncExpTest = uur::urProgramTest;
+UUR_INSTANTIATE_KERNEL_TEST_SUITE_P(urProgramBuildAsyncExpTest);
+
+TEST_P(urProgramBuildAsyncExpTest, Success) {
+    ur_event_handle_t event = nullptr;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(
+        urProgramBuildAsyncExp(program, queue, nullptr, &event));
+    ASSERT_NE(event, nullptr);
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(urEventRelease(event));
+
+    auto kernel_names =
+        uur::KernelsEnvironment::instance->GetEntryPointNames(program_name);
+    ur_kernel_handle_t kernel = nullptr;
+    ASSERT_SUCCESS(urKernelCreate(program, kernel_names[0].data(), &kernel));
+    ASSERT_SUCCESS(urKernelRelease(kernel));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, SuccessWithOptions) {
+    ur_event_handle_t event = nullptr;
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(
+        urProgramBuildAsyncExp(program, queue, "", &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+    ASSERT_SUCCESS(urEventRelease(event));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullHandleProgram) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urProgramBuildAsyncExp(nullptr, queue, nullptr, &event));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullHandleQueue) {
+    ur_event_handle_t event = nullptr;
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urProgramBuildAsyncExp(program, nullptr, nullptr, &event));
+}
+
+TEST_P(urProgramBuildAsyncExpTest, InvalidNullPointerEvent) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urProgramBuildAsyncExp(program, queue, nullptr, nullptr));
+}
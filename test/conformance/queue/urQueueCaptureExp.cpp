@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urQueueCaptureExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(urQueueTest::SetUp());
+        ur_device_usm_access_capability_flags_t deviceUSMSupport = 0;
+        ASSERT_SUCCESS(
+            uur::GetDeviceUSMDeviceSupport(device, deviceUSMSupport));
+        if (!deviceUSMSupport) {
+            GTEST_SKIP() << "Device USM is not supported.";
+        }
+        ASSERT_SUCCESS(
+            urUSMDeviceAlloc(context, device, nullptr, nullptr, size, &ptr));
+    }
+
+    void TearDown() override {
+        if (ptr) {
+            EXPECT_SUCCESS(urUSMFree(context, ptr));
+        }
+        urQueueTest::TearDown();
+    }
+
+    const size_t count = 1024;
+    const size_t size = sizeof(uint32_t) * count;
+    void *ptr = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urQueueCaptureExpTest);
+
+TEST_P(urQueueCaptureExpTest, Success) {
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urQueueBeginCaptureExp(queue));
+
+    uint32_t pattern = 42;
+    ur_event_handle_t fill_event = nullptr;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                    size, 0, nullptr, &fill_event));
+    ASSERT_SUCCESS(urEnqueueEventsWait(queue, 1, &fill_event, nullptr));
+
+    ur_exp_command_buffer_handle_t command_buffer = nullptr;
+    ASSERT_SUCCESS(urQueueEndCaptureExp(queue, &command_buffer));
+    ASSERT_NE(command_buffer, nullptr);
+    EXPECT_SUCCESS(urEventRelease(fill_event));
+
+    // The fill was only captured, so only replaying it sets the memory
+    std::vector<uint32_t> output(count, 1);
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, ptr, output.data(), size, 0,
+                                      nullptr, nullptr));
+
+    ASSERT_SUCCESS(urCommandBufferEnqueueExp(command_buffer, queue, 0,
+                                             nullptr, nullptr));
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, output.data(), ptr, size, 0,
+                                      nullptr, nullptr));
+    for (uint32_t value : output) {
+        ASSERT_EQ(value, pattern);
+    }
+
+    EXPECT_SUCCESS(urCommandBufferReleaseExp(command_buffer));
+}
+
+TEST_P(urQueueCaptureExpTest, InvalidOperationNotCapturing) {
+    ur_exp_command_buffer_handle_t command_buffer = nullptr;
+    auto result = urQueueEndCaptureExp(queue, &command_buffer);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+        GTEST_SKIP();
+    }
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_OPERATION, result);
+}
+
+TEST_P(urQueueCaptureExpTest, InvalidOperationAlreadyCapturing) {
+    UUR_ASSERT_SUCCESS_OR_UNSUPPORTED(urQueueBeginCaptureExp(queue));
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_OPERATION,
+                     urQueueBeginCaptureExp(queue));
+
+    ur_exp_command_buffer_handle_t command_buffer = nullptr;
+    ASSERT_SUCCESS(urQueueEndCaptureExp(queue, &command_buffer));
+    EXPECT_SUCCESS(urCommandBufferReleaseExp(command_buffer));
+}
+
+TEST_P(urQueueCaptureExpTest, InvalidNullHandleQueue) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urQueueBeginCaptureExp(nullptr));
+}
+
+TEST_P(urQueueCaptureExpTest, InvalidNullPointerCommandBuffer) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urQueueEndCaptureExp(queue, nullptr));
+}
@@ -88,6 +88,50 @@ TEST_P(urUSMDeviceAllocTest, SuccessWithDescriptors) {
     EXPECT_SUCCESS(urEventRelease(event));
 }
 
+TEST_P(urUSMDeviceAllocTest, SuccessZeroInit) {
+    ur_bool_t zeroInitSupport = false;
+    ASSERT_SUCCESS(urDeviceGetInfo(device,
+                                   UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP,
+                                   sizeof(zeroInitSupport), &zeroInitSupport,
+                                   nullptr));
+
+    ur_usm_device_desc_t usm_device_desc{UR_STRUCTURE_TYPE_USM_DEVICE_DESC,
+                                         nullptr,
+                                         UR_USM_DEVICE_MEM_FLAG_ZERO_INIT_EXP};
+    ur_usm_desc_t usm_desc{UR_STRUCTURE_TYPE_USM_DESC, &usm_device_desc,
+                           /* mem advice flags */ UR_USM_ADVICE_FLAG_DEFAULT,
+                           /* alignment */ 0};
+    const size_t allocation_size = 4096;
+    void *ptr = nullptr;
+    if (!zeroInitSupport) {
+        ASSERT_EQ_RESULT(UR_RESULT_ERROR_UNSUPPORTED_FEATURE,
+                         urUSMDeviceAlloc(context, device, &usm_desc, pool,
+                                          allocation_size, &ptr));
+        GTEST_SKIP() << "Zero-initialized USM is not supported.";
+    }
+
+    // The block freed dirty must come back zeroed
+    for (int i = 0; i < 2; i++) {
+        ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, &usm_desc, pool,
+                                        allocation_size, &ptr));
+        ASSERT_NE(ptr, nullptr);
+
+        std::vector<uint8_t> host(allocation_size, 0xff);
+        ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, host.data(), ptr,
+                                          allocation_size, 0, nullptr,
+                                          nullptr));
+        for (auto byte : host) {
+            ASSERT_EQ(byte, 0);
+        }
+
+        uint8_t pattern = 0xab;
+        ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                        allocation_size, 0, nullptr, nullptr));
+        ASSERT_SUCCESS(urQueueFinish(queue));
+        ASSERT_SUCCESS(urUSMFree(context, ptr));
+    }
+}
+
 TEST_P(urUSMDeviceAllocTest, InvalidNullHandleContext) {
     void *ptr = nullptr;
     ASSERT_EQ_RESULT(
@@ -0,0 +1,64 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <uur/fixtures.h>
+
+struct urUSMGrowExpTest : uur::urQueueTest {
+    void SetUp() override {
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::SetUp());
+        auto result = urUSMGrowableAllocExp(context, device, max_size,
+                                            initial_size, &ptr);
+        if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE ||
+            result == UR_RESULT_ERROR_UNINITIALIZED) {
+            GTEST_SKIP() << "Growable allocations are not supported";
+        }
+        ASSERT_SUCCESS(result);
+        ASSERT_NE(ptr, nullptr);
+    }
+
+    void TearDown() override {
+        if (ptr) {
+            EXPECT_SUCCESS(urUSMFree(context, ptr));
+        }
+        UUR_RETURN_ON_FATAL_FAILURE(uur::urQueueTest::TearDown());
+    }
+
+    static constexpr size_t max_size = 64 * 1024 * 1024;
+    static constexpr size_t initial_size = 1024;
+    void *ptr = nullptr;
+};
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUSMGrowExpTest);
+
+TEST_P(urUSMGrowExpTest, Success) {
+    uint8_t pattern = 0x2a;
+    ASSERT_SUCCESS(urUSMGrowExp(context, ptr, max_size));
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                    max_size, 0, nullptr, nullptr));
+
+    uint8_t last = 0;
+    ASSERT_SUCCESS(urEnqueueUSMMemcpy(queue, true, &last,
+                                      static_cast<uint8_t *>(ptr) + max_size - 1,
+                                      sizeof(last), 0, nullptr, nullptr));
+    ASSERT_EQ(last, pattern);
+}
+
+TEST_P(urUSMGrowExpTest, SuccessShrink) {
+    ASSERT_SUCCESS(urUSMGrowExp(context, ptr, 0));
+}
+
+TEST_P(urUSMGrowExpTest, InvalidUSMSize) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_USM_SIZE,
+                     urUSMGrowExp(context, ptr, max_size + 1));
+}
+
+TEST_P(urUSMGrowExpTest, InvalidNullHandleContext) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urUSMGrowExp(nullptr, ptr, initial_size));
+}
+
+TEST_P(urUSMGrowExpTest, InvalidNullPointerMem) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_POINTER,
+                     urUSMGrowExp(context, nullptr, initial_size));
+}
@@ -108,6 +108,37 @@ TEST_P(urUSMHostAllocTest, SuccessWithDescriptors) {
     EXPECT_SUCCESS(urEventRelease(event));
 }
 
+TEST_P(urUSMHostAllocTest, SuccessWithNumaNode) {
+    uint32_t numa_node = 0;
+    auto result =
+        urDeviceGetInfo(device, UR_DEVICE_INFO_HOST_NUMA_NODE_EXP,
+                        sizeof(numa_node), &numa_node, nullptr);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION) {
+        GTEST_SKIP() << "The NUMA node of the device is not known.";
+    }
+    ASSERT_SUCCESS(result);
+
+    ur_exp_usm_host_numa_desc_t numa_desc{
+        UR_STRUCTURE_TYPE_EXP_USM_HOST_NUMA_DESC, nullptr, numa_node};
+    ur_usm_desc_t usm_desc{UR_STRUCTURE_TYPE_USM_DESC, &numa_desc,
+                           /* mem advice flags */ UR_USM_ADVICE_FLAG_DEFAULT,
+                           /* alignment */ 0};
+    void *ptr = nullptr;
+    size_t allocation_size = sizeof(int);
+    ASSERT_SUCCESS(
+        urUSMHostAlloc(context, &usm_desc, pool, allocation_size, &ptr));
+    ASSERT_NE(ptr, nullptr);
+
+    ur_event_handle_t event = nullptr;
+    uint8_t pattern = 0;
+    ASSERT_SUCCESS(urEnqueueUSMFill(queue, ptr, sizeof(pattern), &pattern,
+                                    allocation_size, 0, nullptr, &event));
+    ASSERT_SUCCESS(urEventWait(1, &event));
+
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+    EXPECT_SUCCESS(urEventRelease(event));
+}
+
 TEST_P(urUSMHostAllocTest, InvalidNullHandleContext) {
     void *ptr = nullptr;
     ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
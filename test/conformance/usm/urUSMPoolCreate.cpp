@@ -25,6 +25,30 @@ TEST_P(urUSMPoolCreateTest, SuccessWithFlag) {
     EXPECT_SUCCESS(urUSMPoolRelease(pool));
 }
 
+TEST_P(urUSMPoolCreateTest, SuccessWithArena) {
+    ur_exp_usm_pool_arena_desc_t arena_desc{
+        UR_STRUCTURE_TYPE_EXP_USM_POOL_ARENA_DESC, nullptr, 4 * 1024 * 1024,
+        0};
+    ur_usm_pool_desc_t pool_desc{UR_STRUCTURE_TYPE_USM_POOL_DESC, &arena_desc,
+                                 0};
+    ur_usm_pool_handle_t pool = nullptr;
+    ASSERT_SUCCESS(urUSMPoolCreate(context, &pool_desc, &pool));
+    ASSERT_NE(pool, nullptr);
+
+    // Fits in the arena, then doesn't
+    void *small = nullptr;
+    void *large = nullptr;
+    ASSERT_SUCCESS(
+        urUSMDeviceAlloc(context, device, nullptr, pool, 4096, &small));
+    ASSERT_NE(small, nullptr);
+    ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, pool,
+                                    8 * 1024 * 1024, &large));
+    ASSERT_NE(large, nullptr);
+    EXPECT_SUCCESS(urUSMFree(context, small));
+    EXPECT_SUCCESS(urUSMFree(context, large));
+    EXPECT_SUCCESS(urUSMPoolRelease(pool));
+}
+
 TEST_P(urUSMPoolCreateTest, InvalidNullHandleContext) {
     ur_usm_pool_desc_t pool_desc{UR_STRUCTURE_TYPE_USM_POOL_DESC, nullptr,
                                  UR_USM_POOL_FLAG_ZERO_INITIALIZE_BLOCK};
@@ -81,3 +81,38 @@ TEST_P(urUSMPoolGetInfoTest, InvalidNullPointerPropSizeRet) {
         UR_RESULT_ERROR_INVALID_NULL_POINTER,
         urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_CONTEXT, 0, nullptr, nullptr));
 }
+
+TEST_P(urUSMPoolGetInfoTest, SuccessUsedSizeTracksAllocations) {
+    size_t used_before = 0;
+    auto result = urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE_EXP,
+                                   sizeof(size_t), &used_before, nullptr);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION) {
+        GTEST_SKIP() << "Pool statistics are not supported";
+    }
+    ASSERT_SUCCESS(result);
+
+    void *ptr = nullptr;
+    const size_t alloc_size = 256;
+    ASSERT_SUCCESS(
+        urUSMDeviceAlloc(context, device, nullptr, pool, alloc_size, &ptr));
+
+    size_t used = 0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE_EXP,
+                                    sizeof(size_t), &used, nullptr));
+    ASSERT_EQ(used, used_before + alloc_size);
+
+    size_t peak = 0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_PEAK_USED_SIZE_EXP,
+                                    sizeof(size_t), &peak, nullptr));
+    ASSERT_GE(peak, used);
+
+    size_t reserved = 0;
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_RESERVED_SIZE_EXP,
+                                    sizeof(size_t), &reserved, nullptr));
+    ASSERT_GE(reserved, used);
+
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+    ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_USED_SIZE_EXP,
+                                    sizeof(size_t), &used, nullptr));
+    ASSERT_EQ(used, used_before);
+}
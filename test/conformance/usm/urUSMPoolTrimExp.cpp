@@ -0,0 +1,51 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_api.h"
+#include <uur/fixtures.h>
+
+using urUSMPoolTrimExpTest = uur::urUSMPoolTest;
+UUR_INSTANTIATE_DEVICE_TEST_SUITE_P(urUSMPoolTrimExpTest);
+
+TEST_P(urUSMPoolTrimExpTest, Success) {
+    void *ptr = nullptr;
+    ASSERT_SUCCESS(urUSMDeviceAlloc(context, device, nullptr, pool, 256, &ptr));
+    ASSERT_SUCCESS(urUSMFree(context, ptr));
+
+    size_t reserved_before = 0;
+    auto result =
+        urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_RESERVED_SIZE_EXP, sizeof(size_t),
+                         &reserved_before, nullptr);
+    bool has_stats = result != UR_RESULT_ERROR_UNSUPPORTED_ENUMERATION;
+    if (has_stats) {
+        ASSERT_SUCCESS(result);
+    }
+
+    result = urUSMPoolTrimExp(context, pool, 0);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+        GTEST_SKIP() << "Pool trimming is not supported";
+    }
+    ASSERT_SUCCESS(result);
+
+    if (has_stats) {
+        size_t reserved = 0;
+        ASSERT_SUCCESS(urUSMPoolGetInfo(pool, UR_USM_POOL_INFO_RESERVED_SIZE_EXP,
+                                        sizeof(size_t), &reserved, nullptr));
+        ASSERT_LE(reserved, reserved_before);
+    }
+}
+
+TEST_P(urUSMPoolTrimExpTest, SuccessNullPool) {
+    auto result = urUSMPoolTrimExp(context, nullptr, 0);
+    if (result == UR_RESULT_ERROR_UNSUPPORTED_FEATURE) {
+        GTEST_SKIP() << "Pool trimming is not supported";
+    }
+    ASSERT_SUCCESS(result);
+}
+
+TEST_P(urUSMPoolTrimExpTest, InvalidNullHandleContext) {
+    ASSERT_EQ_RESULT(UR_RESULT_ERROR_INVALID_NULL_HANDLE,
+                     urUSMPoolTrimExp(nullptr, pool, 0));
+}
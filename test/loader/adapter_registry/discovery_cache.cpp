@@ -0,0 +1,63 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include "ur_adapter_cache.hpp"
+#include "ur_util.hpp"
+
+#include <fstream>
+#include <gtest/gtest.h>
+
+struct adapterDiscoveryCacheTest : ::testing::Test {
+    fs::path dir;
+    fs::path cacheFile;
+    fs::path libFile;
+    const std::string adapterName = "libur_adapter_test.so.0";
+
+    void SetUp() override {
+        dir = fs::temp_directory_path() /
+              ("ur-discovery-cache-" + std::to_string(ur_getpid()));
+        fs::create_directories(dir);
+        cacheFile = dir / "cache";
+        libFile = dir / adapterName;
+        std::ofstream(libFile) << "not really a library";
+    }
+
+    void TearDown() override { fs::remove_all(dir); }
+};
+
+TEST_F(adapterDiscoveryCacheTest, RoundTrip) {
+    {
+        ur_loader::AdapterDiscoveryCache cache(cacheFile);
+        ASSERT_FALSE(cache.lookup(adapterName).has_value());
+        cache.update(adapterName, libFile);
+        cache.setNumPlatforms(adapterName, 0);
+        cache.save();
+    }
+
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    auto entry = cache.lookup(adapterName);
+    ASSERT_TRUE(entry.has_value());
+    EXPECT_EQ(entry->path, libFile);
+    EXPECT_EQ(entry->numPlatforms, 0);
+}
+
+TEST_F(adapterDiscoveryCacheTest, ModifiedLibraryInvalidatesEntry) {
+    {
+        ur_loader::AdapterDiscoveryCache cache(cacheFile);
+        cache.update(adapterName, libFile);
+        cache.save();
+    }
+
+    std::ofstream(libFile, std::ios::app) << "a new build";
+
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    EXPECT_FALSE(cache.lookup(adapterName).has_value());
+}
+
+TEST_F(adapterDiscoveryCacheTest, CorruptFileIsIgnored) {
+    std::ofstream(cacheFile) << "garbage\n";
+    ur_loader::AdapterDiscoveryCache cache(cacheFile);
+    EXPECT_FALSE(cache.lookup(adapterName).has_value());
+}
@@ -39,3 +39,43 @@ TEST_F(LoaderHandleTest, SuccessArraySizeRet) {
     ASSERT_EQ(query_platform[0], platform);
     ASSERT_EQ(query_platform[1], (ur_platform_handle_t)0xBEEF);
 }
+
+static uint32_t platformGetCalls = 0;
+
+ur_result_t before_urPlatformGet(void *) {
+    platformGetCalls++;
+    return UR_RESULT_SUCCESS;
+}
+
+TEST_F(LoaderHandleTest, EnumerationCached) {
+    platformGetCalls = 0;
+    mock::getCallbacks().set_before_callback("urPlatformGet",
+                                             &before_urPlatformGet);
+
+    uint32_t nplatforms = 0;
+    ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 0, nullptr, &nplatforms));
+    ASSERT_EQ(nplatforms, 1u);
+    ur_platform_handle_t query_platform = nullptr;
+    ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 1, &query_platform, nullptr));
+    ASSERT_EQ(query_platform, platform);
+    ASSERT_EQ(platformGetCalls, 0u);
+
+    ASSERT_SUCCESS(urLoaderInvalidateEnumerationCacheExp());
+    query_platform = nullptr;
+    ASSERT_SUCCESS(urPlatformGet(&adapter, 1, 1, &query_platform, nullptr));
+    ASSERT_EQ(query_platform, platform);
+    ASSERT_GT(platformGetCalls, 0u);
+}
+
+TEST_F(LoaderHandleTest, EnumerationCachedDevices) {
+    ur_device_handle_t query_device = nullptr;
+    uint32_t ndevices = 0;
+    ASSERT_SUCCESS(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &query_device,
+                               &ndevices));
+    ASSERT_EQ(query_device, device);
+    ASSERT_EQ(ndevices, 1u);
+
+    ASSERT_EQ(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 0, &query_device,
+                          nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+}
@@ -102,3 +102,33 @@ TEST(Mock, Callbacks) {
         reinterpret_cast<ur_adapter_handle_t>(uintptr_t(0xF00DCAFE));
     ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
 }
+
+ur_result_t replaceUrAdapterGetUnsupported(void *) {
+    return UR_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+TEST(Mock, CallbacksByFunctionId) {
+    uur::raii::LoaderConfig loader_config;
+    ASSERT_EQ(urLoaderConfigCreate(loader_config.ptr()), UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderConfigSetMockingEnabled(loader_config, true),
+              UR_RESULT_SUCCESS);
+    ASSERT_EQ(urLoaderInit(0, loader_config), UR_RESULT_SUCCESS);
+
+    ASSERT_EQ(mock::getFunctionId("urAdapterGet"), UR_FUNCTION_ADAPTER_GET);
+    ASSERT_FALSE(mock::getFunctionId("urNotAnEntryPoint").has_value());
+
+    // Clear the callbacks other tests may have left on urAdapterGet
+    mock::getCallbacks().set_before_callback(UR_FUNCTION_ADAPTER_GET, nullptr);
+    mock::getCallbacks().set_after_callback(UR_FUNCTION_ADAPTER_GET, nullptr);
+    mock::getCallbacks().set_replace_callback(UR_FUNCTION_ADAPTER_GET,
+                                              &replaceUrAdapterGetUnsupported);
+    ASSERT_EQ(mock::getCallbacks().get_replace_callback("urAdapterGet"),
+              &replaceUrAdapterGetUnsupported);
+
+    ur_adapter_handle_t adapter = nullptr;
+    ASSERT_EQ(urAdapterGet(1, &adapter, nullptr),
+              UR_RESULT_ERROR_UNSUPPORTED_FEATURE);
+
+    mock::getCallbacks().set_replace_callback("urAdapterGet", nullptr);
+    ASSERT_EQ(urAdapterGet(1, &adapter, nullptr), UR_RESULT_SUCCESS);
+}
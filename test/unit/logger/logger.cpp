@@ -168,6 +168,51 @@ TEST_P(FileSinkLoggerMultipleThreads, Multithreaded) {
     }
 }
 
+TEST_F(UniquePtrLoggerWithFilesink, AsyncBlockKeepsAllMessagesInOrder) {
+    auto sink = std::make_unique<logger::FileSink>(logger_name, file_path);
+    // a tiny queue forces the producer to wait for the writer thread
+    sink->setAsync(logger::AsyncPolicy::Block, 4);
+    logger = std::make_unique<logger::Logger>(logger::Level::INFO,
+                                              std::move(sink));
+
+    for (int i = 0; i < 100; ++i) {
+        logger->info("Test message: {}", i);
+        test_msg << test_msg_prefix << "[INFO]: Test message: " << i << "\n";
+    }
+}
+
+TEST_F(UniquePtrLoggerWithFilesink, CompiledFormatMatchesRuntimeFormat) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::FileSink>(logger_name, file_path));
+
+    const char *null_str = nullptr;
+    logger->debug(UR_LOG_FMT("This should not be printed: {}"), 42);
+    logger->info(UR_LOG_FMT("{} {} {} {} {}"), -7, 42u, true, 'c',
+                 std::string("str"));
+    logger->warning(UR_LOG_FMT("{{}} {}: {}"), "literal", null_str);
+    logger->error(UR_LOG_FMT("{}"), 1.5);
+    logger->info(UR_LOG_FMT("No arguments"));
+    test_msg << test_msg_prefix << "[INFO]: -7 42 1 c str\n"
+             << test_msg_prefix << "[WARNING]: {} literal: (null)\n"
+             << test_msg_prefix << "[ERROR]: 1.5\n"
+             << test_msg_prefix << "[INFO]: No arguments\n";
+}
+
+TEST_F(UniquePtrLoggerWithFilesink, LazyLogSkipsArgumentsBelowLevel) {
+    logger = std::make_unique<logger::Logger>(
+        logger::Level::INFO,
+        std::make_unique<logger::FileSink>(logger_name, file_path));
+
+    int evaluated = 0;
+    auto arg = [&] { return ++evaluated; };
+    UR_LOG_L(*logger, DEBUG, "This should not be printed: {}", arg());
+    ASSERT_EQ(evaluated, 0);
+    UR_LOG_L(*logger, INFO, UR_LOG_FMT("Test message: {}"), arg());
+    ASSERT_EQ(evaluated, 1);
+    test_msg << test_msg_prefix << "[INFO]: Test message: 1\n";
+}
+
 //////////////////////////////////////////////////////////////////////////////
 INSTANTIATE_TEST_SUITE_P(
     ThreadCount, CommonLoggerWithMultipleThreads,
@@ -0,0 +1,108 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ur/ur.hpp"
+
+#include <vector>
+
+namespace {
+
+struct fake_event {
+    const void *sequence;
+    uint64_t order;
+    bool completed;
+};
+
+using fake_event_t = const fake_event *;
+
+struct fake_event_traits {
+    static const void *sequence(fake_event_t event) { return event->sequence; }
+    static uint64_t order(fake_event_t event) { return event->order; }
+    static bool isCompleted(fake_event_t event) { return event->completed; }
+};
+
+std::vector<fake_event_t> normalize(const std::vector<fake_event_t> &list) {
+    std::vector<fake_event_t> events;
+    ur::normalizeEventWaitList<fake_event_traits>(list.data(), list.size(),
+                                                  events);
+    return events;
+}
+
+int streamA, streamB;
+
+} // namespace
+
+TEST(normalizeEventWaitList, Empty) {
+    EXPECT_TRUE(normalize({}).empty());
+    EXPECT_TRUE(normalize({nullptr, nullptr}).empty());
+}
+
+TEST(normalizeEventWaitList, DropsDuplicatesAndCompleted) {
+    fake_event e0{nullptr, 0, false};
+    fake_event e1{nullptr, 0, true};
+    fake_event e2{nullptr, 0, false};
+    EXPECT_THAT(normalize({&e0, &e1, nullptr, &e2, &e0, &e2}),
+                testing::ElementsAre(&e0, &e2));
+}
+
+TEST(normalizeEventWaitList, KeepsNewestOfEachSequence) {
+    fake_event a0{&streamA, 0, false};
+    fake_event a1{&streamA, 1, false};
+    fake_event a2{&streamA, 2, false};
+    fake_event b0{&streamB, 0, false};
+    fake_event b1{&streamB, 1, false};
+    fake_event none{nullptr, 5, false};
+    EXPECT_THAT(normalize({&a1, &b1, &a2, &none, &b0, &a0, &a2}),
+                testing::ElementsAre(&b1, &a2, &none));
+}
+
+TEST(normalizeEventWaitList, LongListsMatchShortOnes) {
+    std::vector<fake_event> events;
+    for (uint64_t i = 0; i < 20; i++) {
+        events.push_back({i % 2 ? &streamA : &streamB, i, i == 19});
+    }
+    for (uint64_t i = 0; i < 20; i++) {
+        events.push_back({nullptr, 0, false});
+    }
+    std::vector<fake_event_t> list;
+    for (auto &event : events) {
+        list.push_back(&event);
+    }
+    // Repeated, so that the sorted path is taken
+    list.insert(list.end(), list.begin(), list.end());
+
+    std::vector<fake_event_t> expected{&events[17], &events[18]};
+    for (size_t i = 20; i < 40; i++) {
+        expected.push_back(&events[i]);
+    }
+    EXPECT_EQ(normalize(list), expected);
+}
+
+TEST(waitAnyEvent, ReturnsFirstCompleted) {
+    // Events 1 and 3 complete after a few polls each
+    uint32_t polls[4] = {};
+    auto query = [&](uint32_t i, bool &completed) {
+        completed = (i == 1 || i == 3) && ++polls[i] > 200;
+        return UR_RESULT_SUCCESS;
+    };
+    uint32_t index = 0;
+    ASSERT_EQ(ur::waitAnyEvent(4, query, index), UR_RESULT_SUCCESS);
+    EXPECT_EQ(index, 1u);
+}
+
+TEST(waitAnyEvent, StopsOnError) {
+    auto query = [](uint32_t i, bool &completed) {
+        completed = false;
+        return i == 2 ? UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS
+                      : UR_RESULT_SUCCESS;
+    };
+    uint32_t index = 0;
+    EXPECT_EQ(ur::waitAnyEvent(3, query, index),
+              UR_RESULT_ERROR_IN_EVENT_LIST_EXEC_STATUS);
+    EXPECT_EQ(index, 2u);
+}
@@ -187,6 +187,19 @@ TEST_P(GetenvToVec, WrongEnvVarValues) {
     ASSERT_THROW(getenv_to_vec("UR_TEST_ENV_VAR"), std::invalid_argument);
 }
 
+TEST(GetenvToUnsigned, Values) {
+    for (auto [value, expected] :
+         {std::pair<const char *, std::optional<uint64_t>>{"0", 0},
+          {"4294967296", uint64_t(1) << 32},
+          {"-1", std::nullopt},
+          {"size", std::nullopt}}) {
+        ASSERT_EQ(setenv("UR_TEST_ENV_VAR", value, 1), 0);
+        EXPECT_EQ(getenv_to_unsigned("UR_TEST_ENV_VAR"), expected) << value;
+    }
+    ASSERT_EQ(unsetenv("UR_TEST_ENV_VAR"), 0);
+    EXPECT_FALSE(getenv_to_unsigned("UR_TEST_ENV_VAR").has_value());
+}
+
 #if defined(_WIN32)
 TEST(GetEnvExceptionWindows, HugeInput) {
     std::string huge_str;
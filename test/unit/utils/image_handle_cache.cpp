@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ur_image_handle_cache.hpp"
+
+#include <string>
+
+namespace {
+
+using device_handle_t = ur::image_handle_cache::device_handle_t;
+
+const auto device0 = reinterpret_cast<ur_device_handle_t>(0x10);
+const auto device1 = reinterpret_cast<ur_device_handle_t>(0x20);
+
+std::string desc(uint32_t value) {
+    std::string d;
+    ur::image_handle_cache::append(d, value);
+    return d;
+}
+
+} // namespace
+
+TEST(imageHandleCache, ReturnsCachedHandle) {
+    ur::image_handle_cache cache;
+    ur::image_handle_cache::handle_t handle = 0;
+    EXPECT_FALSE(cache.acquire(device0, 1, desc(0), handle));
+    handle = 100;
+    EXPECT_TRUE(cache.insert(device0, 1, desc(0), handle));
+
+    handle = 0;
+    EXPECT_TRUE(cache.acquire(device0, 1, desc(0), handle));
+    EXPECT_EQ(handle, 100u);
+    EXPECT_FALSE(cache.acquire(device0, 1, desc(1), handle));
+    EXPECT_FALSE(cache.acquire(device0, 2, desc(0), handle));
+    EXPECT_FALSE(cache.acquire(device1, 1, desc(0), handle));
+}
+
+TEST(imageHandleCache, InsertRace) {
+    ur::image_handle_cache cache;
+    ur::image_handle_cache::handle_t handle = 100;
+    EXPECT_TRUE(cache.insert(device0, 1, desc(0), handle));
+    handle = 101;
+    EXPECT_FALSE(cache.insert(device0, 1, desc(0), handle));
+    EXPECT_EQ(handle, 100u);
+    // The loser's handle isn't cached, for its creator to destroy it
+    EXPECT_FALSE(cache.release(device0, 101));
+}
+
+TEST(imageHandleCache, KeptUntilPurged) {
+    ur::image_handle_cache cache;
+    ur::image_handle_cache::handle_t handle = 100;
+    cache.insert(device0, 1, desc(0), handle);
+    handle = 200;
+    cache.insert(device1, 1, desc(0), handle);
+    handle = 300;
+    cache.insert(device0, 2, desc(0), handle);
+
+    EXPECT_TRUE(cache.release(device0, 100));
+    EXPECT_TRUE(cache.acquire(device0, 1, desc(0), handle));
+    EXPECT_EQ(handle, 100u);
+
+    EXPECT_THAT(cache.purge(1),
+                ::testing::UnorderedElementsAre(device_handle_t{device0, 100},
+                                                device_handle_t{device1, 200}));
+    EXPECT_FALSE(cache.acquire(device0, 1, desc(0), handle));
+    EXPECT_FALSE(cache.release(device0, 100));
+    EXPECT_TRUE(cache.acquire(device0, 2, desc(0), handle));
+    EXPECT_EQ(handle, 300u);
+}
+
+TEST(imageHandleCache, PurgeUnused) {
+    ur::image_handle_cache cache;
+    ur::image_handle_cache::handle_t handle = 100;
+    cache.insert(device0, 1, desc(0), handle);
+    handle = 200;
+    cache.insert(device0, 2, desc(0), handle);
+    cache.release(device0, 100);
+
+    EXPECT_THAT(cache.purgeUnused(),
+                ::testing::ElementsAre(device_handle_t{device0, 100}));
+    EXPECT_THAT(cache.purgeAll(),
+                ::testing::ElementsAre(device_handle_t{device0, 200}));
+    EXPECT_FALSE(cache.acquire(device0, 2, desc(0), handle));
+}
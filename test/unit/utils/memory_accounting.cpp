@@ -0,0 +1,124 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_memory_accounting.hpp"
+
+#include <cstring>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Stands in for UrReturnHelper, keeping the values returned
+struct return_helper_t {
+    template <typename T> ur_result_t operator()(const T &value) {
+        return (*this)(&value, 1);
+    }
+
+    template <typename T> ur_result_t operator()(const T *values, size_t n) {
+        this->values.resize(n);
+        for (size_t i = 0; i < n; i++) {
+            this->values[i] = values[i];
+        }
+        return UR_RESULT_SUCCESS;
+    }
+
+    std::vector<uint64_t> values;
+};
+
+std::vector<uint64_t> getInfo(const ur::memory_accounting &accounting,
+                              ur_context_info_t propName) {
+    return_helper_t returnValue;
+    EXPECT_EQ(accounting.getInfo(propName, returnValue), UR_RESULT_SUCCESS);
+    return returnValue.values;
+}
+
+} // namespace
+
+TEST(memoryAccounting, Empty) {
+    ur::memory_accounting accounting(nullptr);
+    EXPECT_EQ(getInfo(accounting, UR_CONTEXT_INFO_MEMORY_USED_EXP),
+              std::vector<uint64_t>(ur::memory_accounting::typeCount, 0));
+    EXPECT_EQ(getInfo(accounting, UR_CONTEXT_INFO_TOTAL_MEMORY_USED_PEAK_EXP),
+              std::vector<uint64_t>{0});
+}
+
+TEST(memoryAccounting, ByType) {
+    ur::memory_accounting accounting(nullptr);
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, 4096);
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, 1024);
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL, 64);
+    accounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, 1024);
+
+    auto used = getInfo(accounting, UR_CONTEXT_INFO_MEMORY_USED_EXP);
+    ASSERT_EQ(used.size(), ur::memory_accounting::typeCount);
+    EXPECT_EQ(used[UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST], 0);
+    EXPECT_EQ(used[UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE], 4096);
+    EXPECT_EQ(used[UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER], 0);
+    EXPECT_EQ(used[UR_EXP_CONTEXT_MEMORY_TYPE_INTERNAL], 64);
+
+    auto peak = getInfo(accounting, UR_CONTEXT_INFO_MEMORY_USED_PEAK_EXP);
+    EXPECT_EQ(peak[UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE], 4096);
+    EXPECT_EQ(peak[UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER], 1024);
+}
+
+TEST(memoryAccounting, TotalPeak) {
+    ur::memory_accounting accounting(nullptr);
+    // The peaks of the types are reached at different times
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST, 100);
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_IMAGE, 50);
+    accounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST, 100);
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED, 120);
+
+    EXPECT_EQ(accounting.getTotalPeak(), 170);
+    EXPECT_EQ(accounting.getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_HOST), 100);
+    EXPECT_EQ(accounting.getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_SHARED), 120);
+}
+
+TEST(memoryAccounting, Reclassify) {
+    ur::memory_accounting accounting(nullptr);
+    // A buffer served from a slab of a device pool
+    accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, 2048);
+    accounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE,
+                          UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER, 512);
+
+    EXPECT_EQ(accounting.getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE), 1536);
+    EXPECT_EQ(accounting.getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER), 512);
+    EXPECT_EQ(accounting.getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER), 512);
+    EXPECT_EQ(accounting.getTotalPeak(), 2048);
+
+    accounting.reclassify(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER,
+                          UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, 512);
+    EXPECT_EQ(accounting.getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE), 2048);
+    EXPECT_EQ(accounting.getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_BUFFER), 0);
+}
+
+TEST(memoryAccounting, Concurrent) {
+    ur::memory_accounting accounting(nullptr);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; t++) {
+        threads.emplace_back([&] {
+            for (int i = 0; i < 1000; i++) {
+                accounting.onAlloc(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, 8);
+                accounting.onFree(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE, 8);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(accounting.getUsed(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE), 0);
+    EXPECT_GE(accounting.getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE), 8);
+    EXPECT_LE(accounting.getPeak(UR_EXP_CONTEXT_MEMORY_TYPE_USM_DEVICE), 32);
+}
+
+TEST(memoryAccounting, UnknownInfo) {
+    ur::memory_accounting accounting(nullptr);
+    return_helper_t returnValue;
+    EXPECT_EQ(accounting.getInfo(UR_CONTEXT_INFO_NUM_DEVICES, returnValue),
+              UR_RESULT_ERROR_INVALID_ENUMERATION);
+}
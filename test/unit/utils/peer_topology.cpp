@@ -0,0 +1,88 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_peer_topology.hpp"
+
+namespace {
+
+// Four devices, all supporting peer access with a rank of src + dst
+void initTopology(ur::peer_topology &topology) {
+    topology.init(
+        4, [](size_t src, size_t dst, ur::peer_topology::link_t &link) {
+            link.accessSupported = true;
+            link.performanceRank = static_cast<int>(src + dst);
+        });
+}
+
+bool anyDevice(size_t) { return true; }
+
+} // namespace
+
+TEST(peerTopology, QueriesOnce) {
+    ur::peer_topology topology;
+    int queries = 0;
+    auto query = [&](size_t, size_t, ur::peer_topology::link_t &link) {
+        link.atomicsSupported = true;
+        queries++;
+    };
+    topology.init(3, query);
+    topology.init(3, query);
+    EXPECT_EQ(queries, 6);
+    EXPECT_TRUE(topology.get(0, 2).atomicsSupported);
+    EXPECT_FALSE(topology.get(1, 1).atomicsSupported);
+}
+
+TEST(peerTopology, RetriesAfterThrow) {
+    ur::peer_topology topology;
+    EXPECT_THROW(
+        topology.init(2, [](size_t, size_t,
+                            ur::peer_topology::link_t &) { throw 1; }),
+        int);
+    initTopology(topology);
+    EXPECT_TRUE(topology.get(1, 0).accessSupported);
+}
+
+TEST(peerTopology, Enabled) {
+    ur::peer_topology topology;
+    initTopology(topology);
+    EXPECT_TRUE(topology.isDirect(1, 1));
+    EXPECT_FALSE(topology.isDirect(0, 1));
+    topology.setEnabled(1, 0, true);
+    EXPECT_TRUE(topology.isDirect(0, 1));
+    EXPECT_TRUE(topology.isDirect(1, 0));
+    topology.setEnabled(1, 0, false);
+    EXPECT_FALSE(topology.isDirect(0, 1));
+}
+
+TEST(peerTopology, NoRouteWhenDirect) {
+    ur::peer_topology topology;
+    initTopology(topology);
+    topology.setEnabled(0, 1, true);
+    topology.setEnabled(0, 2, true);
+    topology.setEnabled(2, 1, true);
+    size_t via;
+    EXPECT_FALSE(topology.findRoute(0, 1, anyDevice, via));
+}
+
+TEST(peerTopology, RoutesThroughFastest) {
+    ur::peer_topology topology;
+    initTopology(topology);
+    topology.setEnabled(0, 2, true);
+    topology.setEnabled(2, 3, true);
+    topology.setEnabled(0, 1, true);
+    topology.setEnabled(1, 3, true);
+    size_t via = 0;
+    ASSERT_TRUE(topology.findRoute(0, 3, anyDevice, via));
+    EXPECT_EQ(via, 1u);
+
+    ASSERT_TRUE(topology.findRoute(
+        0, 3, [](size_t device) { return device != 1; }, via));
+    EXPECT_EQ(via, 2u);
+
+    EXPECT_FALSE(topology.findRoute(
+        0, 3, [](size_t device) { return device == 0 || device == 3; }, via));
+}
@@ -0,0 +1,59 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_perf_counters.hpp"
+
+#include <thread>
+#include <vector>
+
+TEST(perfCounters, Empty) {
+    EXPECT_EQ(ur::perf_counters::get().dump(), "");
+}
+
+TEST(perfCounters, Counts) {
+    ur::perf_counter counter("counts");
+    EXPECT_EQ(counter.get(), 0);
+    counter.add();
+    counter.add(4);
+    EXPECT_EQ(counter.get(), 5);
+}
+
+TEST(perfCounters, DumpsByName) {
+    ur::perf_counter misses("cache.misses");
+    ur::perf_counter hits("cache.hits");
+    hits.add(3);
+    misses.add();
+    EXPECT_EQ(ur::perf_counters::get().dump(),
+              "cache.hits 3\ncache.misses 1\n");
+}
+
+TEST(perfCounters, Deregisters) {
+    {
+        ur::perf_counter counter("scoped");
+        counter.add();
+        EXPECT_EQ(ur::perf_counters::get().dump(), "scoped 1\n");
+    }
+    EXPECT_EQ(ur::perf_counters::get().dump(), "");
+}
+
+TEST(perfCounters, ConcurrentAdds) {
+    ur::perf_counter counter("concurrent");
+    constexpr int numThreads = 8;
+    constexpr int numAdds = 10000;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back([&] {
+            for (int j = 0; j < numAdds; j++) {
+                counter.add();
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    EXPECT_EQ(counter.get(), numThreads * numAdds);
+}
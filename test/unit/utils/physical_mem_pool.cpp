@@ -0,0 +1,89 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ur_physical_mem_pool.hpp"
+
+namespace {
+
+using pool_t = ur::physical_mem_pool<int>;
+using chunk_t = pool_t::chunk_t;
+
+ur_device_handle_t device(uintptr_t id) {
+    return reinterpret_cast<ur_device_handle_t>(id);
+}
+
+} // namespace
+
+TEST(physicalMemPool, TakesSameDeviceAndSize) {
+    pool_t pool(100);
+    EXPECT_TRUE(pool.put(device(1), 10, 1).empty());
+    EXPECT_TRUE(pool.put(device(2), 10, 2).empty());
+    EXPECT_TRUE(pool.put(device(1), 20, 3).empty());
+    int chunk = 0;
+    EXPECT_FALSE(pool.take(device(2), 20, chunk));
+    ASSERT_TRUE(pool.take(device(1), 10, chunk));
+    EXPECT_EQ(chunk, 1);
+    EXPECT_FALSE(pool.take(device(1), 10, chunk));
+}
+
+TEST(physicalMemPool, TakesLastReleased) {
+    pool_t pool(100);
+    pool.put(device(1), 10, 1);
+    pool.put(device(1), 10, 2);
+    int chunk = 0;
+    ASSERT_TRUE(pool.take(device(1), 10, chunk));
+    EXPECT_EQ(chunk, 2);
+}
+
+TEST(physicalMemPool, EvictsOldestPastCapacity) {
+    pool_t pool(30);
+    pool.put(device(1), 10, 1);
+    pool.put(device(1), 10, 2);
+    pool.put(device(2), 10, 3);
+    EXPECT_THAT(pool.put(device(1), 20, 4),
+                ::testing::ElementsAre(chunk_t{device(1), 1},
+                                       chunk_t{device(1), 2}));
+    EXPECT_THAT(pool.put(device(1), 40, 5),
+                ::testing::ElementsAre(chunk_t{device(1), 5}));
+    int chunk = 0;
+    EXPECT_FALSE(pool.take(device(1), 10, chunk));
+    EXPECT_TRUE(pool.take(device(2), 10, chunk));
+}
+
+TEST(physicalMemPool, Trims) {
+    pool_t pool(100);
+    pool.put(device(1), 10, 1);
+    pool.put(device(1), 10, 2);
+    pool.put(device(1), 10, 3);
+    EXPECT_THAT(pool.trim(15), ::testing::ElementsAre(chunk_t{device(1), 1},
+                                                      chunk_t{device(1), 2}));
+    EXPECT_THAT(pool.trim(0), ::testing::ElementsAre(chunk_t{device(1), 3}));
+    EXPECT_TRUE(pool.trim(0).empty());
+}
+
+TEST(physicalMemPool, KeepsNothingWithoutCapacity) {
+    pool_t pool(0);
+    EXPECT_THAT(pool.put(device(1), 10, 1),
+                ::testing::ElementsAre(chunk_t{device(1), 1}));
+}
+
+TEST(physicalMemPool, GivesBackMapped) {
+    pool_t pool(100);
+    int ranges[4];
+    pool.map(&ranges[0], 1);
+    pool.map(&ranges[1], 1);
+    pool.map(&ranges[2], 2);
+    EXPECT_THAT(pool.put(device(1), 10, 1),
+                ::testing::ElementsAre(chunk_t{device(1), 1}));
+    pool.unmap(&ranges[0], sizeof(int));
+    EXPECT_THAT(pool.put(device(1), 10, 1),
+                ::testing::ElementsAre(chunk_t{device(1), 1}));
+    pool.unmap(&ranges[1], 2 * sizeof(int));
+    EXPECT_TRUE(pool.put(device(1), 10, 1).empty());
+    EXPECT_TRUE(pool.put(device(1), 10, 2).empty());
+}
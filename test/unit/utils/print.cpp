@@ -7,6 +7,7 @@
 #include <gtest/gtest.h>
 
 #include "print.h"
+#include "ur_print.hpp"
 
 TEST(Print, KernelInfo) {
     constexpr size_t BUFF_SIZE = 1024;
@@ -26,6 +27,45 @@ TEST(Print, ApiVersion) {
     EXPECT_EQ(out_len, strlen("0.8") + 1);
 }
 
+TEST(Print, FunctionParamsTooSmall) {
+    UrContextGetInfoParamsDevicesArray params;
+    size_t out_len = 0;
+    ASSERT_EQ(urPrintFunctionParams(UR_FUNCTION_CONTEXT_GET_INFO,
+                                    params.get_struct(), nullptr, 0, &out_len),
+              UR_RESULT_SUCCESS);
+
+    std::vector<char> buffer(out_len);
+    EXPECT_EQ(urPrintFunctionParams(UR_FUNCTION_CONTEXT_GET_INFO,
+                                    params.get_struct(), buffer.data(),
+                                    out_len - 1, nullptr),
+              UR_RESULT_ERROR_INVALID_SIZE);
+    EXPECT_EQ(urPrintFunctionParams(UR_FUNCTION_CONTEXT_GET_INFO,
+                                    params.get_struct(), buffer.data(),
+                                    out_len, nullptr),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(strlen(buffer.data()) + 1, out_len);
+}
+
+TEST(Print, FunctionParamsBuffer) {
+    UrContextGetInfoParamsDevicesArray params;
+    auto printed = ur::extras::printFunctionParams(
+        UR_FUNCTION_CONTEXT_GET_INFO, params.get_struct());
+    EXPECT_THAT(std::string(printed), MatchesRegex(params.get_expected()));
+    EXPECT_THAT(std::string(printed),
+                ::testing::HasSubstr(".pPropValue = {0xabad, 0xcafe, 0xbabe}"));
+
+    // Cut short rather than overflowing, with the full length reported
+    char buffer[16];
+    size_t length = 0;
+    EXPECT_EQ(ur::extras::printFunctionParams(
+                  buffer, sizeof(buffer), UR_FUNCTION_CONTEXT_GET_INFO,
+                  params.get_struct(), &length),
+              UR_RESULT_SUCCESS);
+    EXPECT_EQ(length, printed.size());
+    EXPECT_EQ(std::string_view(buffer, sizeof(buffer)),
+              printed.substr(0, sizeof(buffer)));
+}
+
 TYPED_TEST(ParamsTest, GetParams) {
     constexpr size_t BUFF_SIZE = 1024;
     char buffer[BUFF_SIZE];
@@ -0,0 +1,131 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_queue_stats.hpp"
+
+#include <cstring>
+
+namespace {
+
+// Stands in for UrReturnHelper, keeping the bytes of the value returned
+struct return_helper_t {
+    template <typename T> ur_result_t operator()(const T &value) {
+        size = sizeof(T);
+        std::memcpy(bytes, &value, sizeof(T));
+        return UR_RESULT_SUCCESS;
+    }
+
+    template <typename T> T get() const {
+        EXPECT_EQ(size, sizeof(T));
+        T value;
+        std::memcpy(&value, bytes, sizeof(T));
+        return value;
+    }
+
+    char bytes[16];
+    size_t size = 0;
+};
+
+template <typename T>
+T getInfo(const ur::queue_stats &stats, ur_queue_info_t propName) {
+    return_helper_t returnValue;
+    EXPECT_EQ(
+        ur::queue_stats::getInfo(stats.snapshot(), propName, returnValue),
+        UR_RESULT_SUCCESS);
+    return returnValue.get<T>();
+}
+
+} // namespace
+
+TEST(queueStats, Empty) {
+    ur::queue_stats stats;
+    EXPECT_EQ(getInfo<uint64_t>(stats, UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP),
+              0);
+    EXPECT_EQ(
+        getInfo<double>(stats, UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP),
+        0.0);
+}
+
+TEST(queueStats, Counts) {
+    ur::queue_stats stats;
+    for (int i = 0; i < 4; i++) {
+        stats.onCommand();
+    }
+    stats.onSubmission();
+    stats.onSwitch();
+    EXPECT_EQ(getInfo<uint64_t>(stats, UR_QUEUE_INFO_COMMANDS_SUBMITTED_EXP),
+              4);
+    EXPECT_EQ(getInfo<uint64_t>(stats, UR_QUEUE_INFO_DRIVER_SUBMISSIONS_EXP),
+              1);
+    EXPECT_EQ(
+        getInfo<uint64_t>(stats, UR_QUEUE_INFO_COMMAND_LIST_SWITCHES_EXP), 1);
+}
+
+TEST(queueStats, Outstanding) {
+    ur::queue_stats stats;
+    // 1, 2, 3 outstanding, then 1 once idle
+    stats.onCommand();
+    stats.onCommand();
+    stats.onCommand();
+    stats.onIdle();
+    stats.onCommand();
+    EXPECT_EQ(
+        getInfo<uint64_t>(stats, UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP),
+        3);
+    EXPECT_EQ(
+        getInfo<double>(stats, UR_QUEUE_INFO_AVERAGE_OUTSTANDING_COMMANDS_EXP),
+        7.0 / 4);
+}
+
+TEST(queueStats, FinishResetsOutstanding) {
+    ur::queue_stats stats;
+    stats.onCommand();
+    stats.onCommand();
+    {
+        ur::queue_stats::finish_scope finish(stats);
+        finish.finished();
+    }
+    stats.onCommand();
+    EXPECT_EQ(
+        getInfo<uint64_t>(stats, UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP),
+        2);
+    EXPECT_EQ(stats.snapshot().outstandingSum, 4);
+}
+
+TEST(queueStats, FailedFinishKeepsOutstanding) {
+    ur::queue_stats stats;
+    stats.onCommand();
+    { ur::queue_stats::finish_scope finish(stats); }
+    stats.onCommand();
+    EXPECT_EQ(
+        getInfo<uint64_t>(stats, UR_QUEUE_INFO_MAX_OUTSTANDING_COMMANDS_EXP),
+        2);
+}
+
+TEST(queueStats, Merge) {
+    ur::queue_stats first;
+    ur::queue_stats second;
+    first.onCommand();
+    first.onSubmission();
+    second.onCommand();
+    second.onCommand();
+    second.onSubmission();
+    auto stats = first.snapshot();
+    stats += second.snapshot();
+    EXPECT_EQ(stats.commands, 3);
+    EXPECT_EQ(stats.submissions, 2);
+    EXPECT_EQ(stats.maxOutstanding, 2);
+    EXPECT_EQ(stats.outstandingSum, 4);
+}
+
+TEST(queueStats, InvalidEnumeration) {
+    ur::queue_stats stats;
+    return_helper_t returnValue;
+    EXPECT_EQ(ur::queue_stats::getInfo(stats.snapshot(), UR_QUEUE_INFO_EMPTY,
+                                       returnValue),
+              UR_RESULT_ERROR_INVALID_ENUMERATION);
+}
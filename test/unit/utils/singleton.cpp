@@ -0,0 +1,91 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_singleton.hpp"
+
+#include <thread>
+#include <vector>
+
+namespace {
+struct test_object_t {
+    test_object_t(int *handle, int value) : handle(handle), value(value) {}
+    int *handle;
+    int value;
+};
+using test_factory_t = singleton_factory_t<test_object_t, int *>;
+} // namespace
+
+TEST(singletonFactory, NullKey) {
+    test_factory_t factory;
+    EXPECT_EQ(factory.getInstance(static_cast<int *>(nullptr), 0), nullptr);
+}
+
+TEST(singletonFactory, SameKeySameInstance) {
+    test_factory_t factory;
+    int handle = 0;
+    auto first = factory.getInstance(&handle, 1);
+    auto second = factory.getInstance(&handle, 2);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(second->value, 1);
+
+    factory.release(&handle);
+    // releasing an unknown key is a no-op
+    factory.release(&handle);
+    EXPECT_EQ(factory.getInstance(&handle, 3)->value, 3);
+}
+
+TEST(singletonFactory, ReleasedInstancesAreRecycled) {
+    test_factory_t factory;
+    int handle = 0;
+    auto instance = factory.getInstance(&handle, 1);
+    factory.release(&handle);
+    // the storage of the released instance is reused for the next one
+    auto recycled = factory.getInstance(&handle, 2);
+    EXPECT_EQ(recycled, instance);
+    EXPECT_EQ(recycled->value, 2);
+}
+
+TEST(singletonFactory, ConcurrentCreate) {
+    constexpr int numThreads = 8;
+    constexpr int numHandles = 4096;
+
+    test_factory_t factory;
+    std::vector<int> handles(numHandles);
+    std::vector<std::vector<test_object_t *>> results(numThreads);
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = 0; i < numHandles; i++) {
+                results[t].push_back(factory.getInstance(&handles[i], i));
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    for (int i = 0; i < numHandles; i++) {
+        EXPECT_EQ(results[0][i]->handle, &handles[i]);
+        for (int t = 1; t < numThreads; t++) {
+            EXPECT_EQ(results[0][i], results[t][i]);
+        }
+    }
+
+    threads.clear();
+    for (int t = 0; t < numThreads; t++) {
+        threads.emplace_back([&, t]() {
+            for (int i = t; i < numHandles; i += numThreads) {
+                factory.release(&handles[i]);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
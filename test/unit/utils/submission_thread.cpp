@@ -0,0 +1,98 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "ur_submission_thread.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+#include <vector>
+
+TEST(spscRing, PushPop) {
+    ur::spsc_ring<int> ring(3);
+    EXPECT_EQ(ring.capacity(), 4);
+    EXPECT_EQ(ring.front(), nullptr);
+
+    for (int i = 0; i < 4; i++) {
+        int *slot = ring.beginPush();
+        ASSERT_NE(slot, nullptr);
+        *slot = i;
+        ring.endPush();
+    }
+    EXPECT_EQ(ring.beginPush(), nullptr);
+
+    for (int i = 0; i < 4; i++) {
+        int *slot = ring.front();
+        ASSERT_NE(slot, nullptr);
+        EXPECT_EQ(*slot, i);
+        ring.pop();
+    }
+    EXPECT_EQ(ring.front(), nullptr);
+    EXPECT_NE(ring.beginPush(), nullptr);
+}
+
+TEST(submissionThread, RunsInOrder) {
+    std::vector<int> done;
+    {
+        ur::submission_thread<std::vector<int>> thread(
+            4, [&](std::vector<int> &command) {
+                done.insert(done.end(), command.begin(), command.end());
+                command.clear();
+            });
+        uint64_t seq = 0;
+        for (int i = 0; i < 1000; i++) {
+            seq = thread.push([i](std::vector<int> &command) {
+                command.push_back(i);
+            });
+        }
+        EXPECT_EQ(seq, 1000);
+        thread.waitSubmitted(seq);
+        EXPECT_TRUE(thread.isSubmitted(seq));
+        ASSERT_EQ(done.size(), 1000);
+        for (int i = 0; i < 1000; i++) {
+            EXPECT_EQ(done[i], i);
+        }
+    }
+}
+
+TEST(submissionThread, WakesUp) {
+    int done = 0;
+    ur::submission_thread<int> thread(
+        2, [&](int &command) { done += command; },
+        std::chrono::microseconds{0});
+    for (int i = 0; i < 3; i++) {
+        // Long enough for the thread to go to sleep
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        thread.push([](int &command) { command = 1; });
+        thread.drain();
+    }
+    EXPECT_EQ(done, 3);
+}
+
+TEST(submissionThread, OnThread) {
+    bool onThread = false;
+    std::unique_ptr<ur::submission_thread<int>> thread;
+    thread = std::make_unique<ur::submission_thread<int>>(
+        1, [&](int &) { onThread = thread->onThread(); });
+    EXPECT_FALSE(thread->onThread());
+    thread->push([](int &) {});
+    thread->drain();
+    EXPECT_TRUE(onThread);
+}
+
+TEST(submissionThread, DestroyedByCommand) {
+    std::atomic<bool> destroyed{false};
+    ur::submission_thread<int> *thread = nullptr;
+    thread = new ur::submission_thread<int>(1, [&](int &) {
+        delete thread;
+        destroyed = true;
+    });
+    thread->push([](int &) {});
+    while (!destroyed) {
+        std::this_thread::yield();
+    }
+}
@@ -0,0 +1,87 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "ur_sync_point_graph.hpp"
+
+#include <vector>
+
+namespace {
+
+using sync_point_t = ur::sync_point_graph::sync_point_t;
+
+// Appends a command waiting on waitList, returning its reduced wait list
+std::vector<sync_point_t> append(ur::sync_point_graph &graph,
+                                 sync_point_t syncPoint,
+                                 const std::vector<sync_point_t> &waitList) {
+    std::vector<sync_point_t> reduced;
+    graph.reduce(waitList.data(), waitList.size(), reduced);
+    graph.add(syncPoint);
+    return reduced;
+}
+
+} // namespace
+
+TEST(syncPointGraph, Empty) {
+    ur::sync_point_graph graph;
+    EXPECT_TRUE(append(graph, 0, {}).empty());
+}
+
+TEST(syncPointGraph, KeepsIndependent) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    append(graph, 1, {});
+    EXPECT_THAT(append(graph, 2, {1, 0}), ::testing::ElementsAre(1, 0));
+}
+
+TEST(syncPointGraph, DropsTransitive) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    append(graph, 1, {0});
+    append(graph, 2, {1});
+    EXPECT_THAT(append(graph, 3, {0, 2, 1}), ::testing::ElementsAre(2));
+}
+
+TEST(syncPointGraph, WaitOnEverything) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    append(graph, 1, {});
+    append(graph, 2, {0});
+    append(graph, 3, {0, 1, 2});
+    EXPECT_THAT(append(graph, 4, {3, 2, 1, 0}), ::testing::ElementsAre(3));
+    EXPECT_THAT(append(graph, 5, {0, 1, 2}), ::testing::ElementsAre(1, 2));
+}
+
+TEST(syncPointGraph, DropsDuplicates) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    append(graph, 1, {});
+    EXPECT_THAT(append(graph, 2, {1, 0, 1, 0}), ::testing::ElementsAre(1, 0));
+}
+
+TEST(syncPointGraph, KeepsUnknown) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    std::vector<sync_point_t> waitList = {0, 7};
+    std::vector<sync_point_t> reduced;
+    graph.reduce(waitList.data(), waitList.size(), reduced);
+    EXPECT_THAT(reduced, ::testing::ElementsAre(0, 7));
+}
+
+TEST(syncPointGraph, LongChain) {
+    ur::sync_point_graph graph;
+    append(graph, 0, {});
+    constexpr sync_point_t length = 10000;
+    for (sync_point_t i = 1; i < length; i++) {
+        append(graph, i, {i - 1});
+    }
+    // Beyond the walk's bound the dependency is kept, which is still correct
+    EXPECT_THAT(append(graph, length, {length - 1, 0}),
+                ::testing::ElementsAre(length - 1, 0));
+    EXPECT_THAT(append(graph, length + 1, {length, length - 2}),
+                ::testing::ElementsAre(length));
+}
@@ -0,0 +1,255 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+#include <gtest/gtest.h>
+
+#include "umf_helpers.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// Size of the granules the slabs of the cached size classes are made of. A
+// block of this size class takes a whole slab, so the bytes taken from the
+// provider tell how many blocks are alive or cached.
+constexpr size_t GranuleSize = 64 * 1024;
+
+// Host memory, counting the bytes currently allocated
+struct host_provider_t {
+    umf_result_t initialize(std::atomic<size_t> *allocated) {
+        this->allocated = allocated;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t alloc(size_t size, size_t alignment, void **ptr) {
+        alignment = std::max(alignment, alignof(std::max_align_t));
+        *ptr = std::aligned_alloc(alignment,
+                                  (size + alignment - 1) & ~(alignment - 1));
+        if (!*ptr) {
+            return UMF_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+        }
+        *allocated += size;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t free(void *ptr, size_t size) {
+        std::free(ptr);
+        *allocated -= size;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    void get_last_native_error(const char **errMsg, int32_t *errCode) {
+        *errMsg = "";
+        *errCode = 0;
+    }
+
+    umf_result_t get_recommended_page_size(size_t, size_t *pageSize) {
+        *pageSize = 4096;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t get_min_page_size(void *, size_t *pageSize) {
+        *pageSize = 4096;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    const char *get_name() { return "host"; }
+
+    umf_result_t purge_lazy(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t purge_force(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    std::atomic<size_t> *allocated = nullptr;
+};
+
+struct threadCachedPoolTest : ::testing::Test {
+    // Neither the pool nor its cache of slabs keep empty slabs, freed blocks
+    // only remain allocated while the thread caches hold them.
+    void createPool(size_t minCachedSize, size_t maxCachedSize,
+                    size_t magazineSize = 32) {
+        auto [ret, provider] =
+            umf::memoryProviderMakeUnique<host_provider_t>(&allocated);
+        ASSERT_EQ(ret, UMF_RESULT_SUCCESS);
+
+        umf_disjoint_pool_params_t params = umfDisjointPoolParamsDefault();
+        params.SlabMinSize = GranuleSize;
+        params.MaxPoolableSize = 16 * GranuleSize;
+        params.Capacity = 0;
+        params.MinBucketSize = 64;
+
+        umf::thread_cache_params_t cacheParams;
+        cacheParams.MinCachedSize = minCachedSize;
+        cacheParams.MaxCachedSize = maxCachedSize;
+        cacheParams.MagazineSize = magazineSize;
+
+        auto [poolRet, hPool] = umf::disjointPoolMakeUnique(
+            std::move(provider), &params, cacheParams, {}, {});
+        ASSERT_EQ(poolRet, UMF_RESULT_SUCCESS);
+        pool = std::move(hPool);
+    }
+
+    void *alloc(size_t size) { return umfPoolMalloc(pool.get(), size); }
+
+    void free(void *ptr) {
+        ASSERT_EQ(umfPoolFree(pool.get(), ptr), UMF_RESULT_SUCCESS);
+    }
+
+    std::atomic<size_t> allocated{0};
+    umf::pool_unique_handle_t pool{nullptr, nullptr};
+};
+
+} // namespace
+
+TEST_F(threadCachedPoolTest, AllocFree) {
+    createPool(64, 4096);
+
+    for (size_t size : {1, 64, 100, 1024, 4096, 8192, 100000}) {
+        void *ptr = alloc(size);
+        ASSERT_NE(ptr, nullptr) << size;
+        std::memset(ptr, 0xab, size);
+        EXPECT_GE(umfPoolMallocUsableSize(pool.get(), ptr), size);
+        free(ptr);
+    }
+    EXPECT_EQ(umfPoolFree(pool.get(), nullptr), UMF_RESULT_SUCCESS);
+}
+
+TEST_F(threadCachedPoolTest, ReusesLastFreedBlock) {
+    createPool(64, 4096);
+
+    void *first = alloc(200);
+    ASSERT_NE(first, nullptr);
+    EXPECT_EQ(umfPoolMallocUsableSize(pool.get(), first), 256u);
+    void *second = alloc(256);
+    ASSERT_NE(second, nullptr);
+    free(first);
+    free(second);
+
+    EXPECT_EQ(alloc(129), second);
+    EXPECT_EQ(alloc(256), first);
+    free(first);
+    free(second);
+}
+
+TEST_F(threadCachedPoolTest, OverAlignedAndZeroedAllocations) {
+    createPool(64, 4096);
+
+    // Alignments above the size class are served by the general pool
+    void *aligned = umfPoolAlignedMalloc(pool.get(), 64, 8192);
+    ASSERT_NE(aligned, nullptr);
+    EXPECT_EQ(reinterpret_cast<uintptr_t>(aligned) % 8192, 0u);
+    free(aligned);
+
+    void *dirty = alloc(128);
+    ASSERT_NE(dirty, nullptr);
+    std::memset(dirty, 0xab, 128);
+    free(dirty);
+
+    auto zeroed =
+        static_cast<unsigned char *>(umfPoolCalloc(pool.get(), 16, 8));
+    ASSERT_NE(zeroed, nullptr);
+    EXPECT_TRUE(std::all_of(zeroed, zeroed + 128,
+                            [](unsigned char c) { return c == 0; }));
+    free(zeroed);
+}
+
+TEST_F(threadCachedPoolTest, CrossThreadFree) {
+    createPool(64, 4096);
+
+    std::vector<void *> blocks(16);
+    std::thread([&] {
+        for (auto &block : blocks) {
+            block = alloc(512);
+        }
+    }).join();
+
+    // The blocks are cached by the thread freeing them
+    for (auto block : blocks) {
+        ASSERT_NE(block, nullptr);
+        free(block);
+    }
+    void *block = alloc(512);
+    EXPECT_EQ(block, blocks.back());
+
+    // ... until it exits
+    std::thread([&] { free(block); }).join();
+    block = alloc(512);
+    EXPECT_NE(block, nullptr);
+    free(block);
+}
+
+TEST_F(threadCachedPoolTest, ThreadExitFlushesCache) {
+    createPool(GranuleSize, GranuleSize);
+
+    std::promise<void> freed;
+    std::promise<void> checked;
+    std::thread thread([&] {
+        void *block = alloc(GranuleSize);
+        EXPECT_NE(block, nullptr);
+        free(block);
+        freed.set_value();
+        checked.get_future().wait();
+    });
+
+    freed.get_future().wait();
+    EXPECT_EQ(allocated.load(), GranuleSize);
+    checked.set_value();
+    thread.join();
+
+    EXPECT_EQ(allocated.load(), 0u);
+}
+
+TEST_F(threadCachedPoolTest, LargeAllocationsAreNotCached) {
+    createPool(64, 4096);
+
+    void *block = alloc(2 * GranuleSize);
+    ASSERT_NE(block, nullptr);
+    EXPECT_GT(allocated.load(), 0u);
+    free(block);
+    EXPECT_EQ(allocated.load(), 0u);
+}
+
+TEST_F(threadCachedPoolTest, CachedBlocksAreBounded) {
+    // A block of the size class fills its magazine
+    createPool(GranuleSize, GranuleSize, 1);
+
+    constexpr size_t numBlocks = 64;
+    std::vector<void *> blocks;
+    for (size_t i = 0; i < numBlocks; ++i) {
+        blocks.push_back(alloc(GranuleSize));
+        ASSERT_NE(blocks.back(), nullptr);
+    }
+    EXPECT_EQ(allocated.load(), numBlocks * GranuleSize);
+
+    // The thread keeps two magazines, the pool a few more in its depot, the
+    // other blocks are released
+    for (auto block : blocks) {
+        free(block);
+    }
+    EXPECT_GE(allocated.load(), 2 * GranuleSize);
+    EXPECT_LE(allocated.load(), 8 * GranuleSize);
+
+    // The depot and the class pools go with the pool
+    pool.reset();
+    EXPECT_EQ(allocated.load(), 0u);
+}
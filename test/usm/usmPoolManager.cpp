@@ -88,6 +88,30 @@ TEST_P(urUsmPoolManagerTest, poolManagerPopulate) {
     }
 }
 
+TEST_P(urUsmPoolManagerTest, poolManagerGetReturnsAddedPool) {
+    auto [ret, manager] = usm::pool_manager<usm::pool_descriptor>::create();
+    ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+
+    std::vector<umf_memory_pool_handle_t> pools;
+    for (auto &desc : poolDescriptors) {
+        auto poolUnique = createMockPoolHandle();
+        pools.push_back(poolUnique.get());
+        ret = manager.addPool(desc, std::move(poolUnique));
+        ASSERT_EQ(ret, UR_RESULT_SUCCESS);
+    }
+
+    for (size_t i = 0; i < poolDescriptors.size(); i++) {
+        auto desc = poolDescriptors[i];
+        ASSERT_EQ(manager.getPool(desc).value(), pools[i]);
+
+        // The read-only flag only selects a pool for shared allocations
+        if (desc.type != UR_USM_TYPE_SHARED) {
+            desc.deviceReadOnly = !desc.deviceReadOnly;
+            ASSERT_EQ(manager.getPool(desc).value(), pools[i]);
+        }
+    }
+}
+
 TEST_P(urUsmPoolManagerTest, poolManagerInsertExisting) {
     auto [ret, manager] = usm::pool_manager<usm::pool_descriptor>::create();
     ASSERT_EQ(ret, UR_RESULT_SUCCESS);
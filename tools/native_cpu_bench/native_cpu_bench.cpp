@@ -0,0 +1,421 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Kernel launch microbenchmarks for the Native CPU adapter. The kernels are
+// host functions registered through the Native CPU program binary format, so
+// that they run without a SYCL compiler. Run it through the benchmark scripts
+// to sweep SYCL_NATIVE_CPU_HOST_THREADS, or directly:
+//
+//   $ native_cpu_bench [--csv] [--iterations N]
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+#include <nativecpu_state.hpp>
+#include <ur_api.h>
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::fprintf(stderr, "error: " #ACTION " failed: %d\n", error);        \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace {
+
+// Matches the layout of native_cpu::NativeCPUArgDesc and nativecpu_entry of
+// the adapter
+struct arg_desc {
+    void *MPtr;
+};
+
+struct program_entry {
+    const char *kernelname;
+    const unsigned char *kernel_ptr;
+};
+
+using kernel_fn = void(const arg_desc *, native_cpu::state *);
+
+// Whether the adapter calls kernels once per work-group, as it does when built
+// with the oneAPI Construction Kit, rather than once per work-item
+bool perWorkGroup = false;
+
+// Calls f(id0, id1, id2) for the global ids of the work-items the kernel is
+// called for
+template <typename F> void forWorkItems(const native_cpu::state *s, F &&f) {
+    if (!perWorkGroup) {
+        f(s->MGlobal_id[0], s->MGlobal_id[1], s->MGlobal_id[2]);
+        return;
+    }
+    size_t base[3];
+    for (int dim = 0; dim < 3; dim++) {
+        base[dim] = s->MWorkGroup_id[dim] * s->MWorkGroup_size[dim] +
+                    s->MGlobalOffset[dim];
+    }
+    for (size_t l2 = 0; l2 < s->MWorkGroup_size[2]; l2++) {
+        for (size_t l1 = 0; l1 < s->MWorkGroup_size[1]; l1++) {
+            for (size_t l0 = 0; l0 < s->MWorkGroup_size[0]; l0++) {
+                f(base[0] + l0, base[1] + l1, base[2] + l2);
+            }
+        }
+    }
+}
+
+size_t linearId(const native_cpu::state *s, size_t id0, size_t id1,
+                size_t id2) {
+    return (id2 * s->MGlobal_range[1] + id1) * s->MGlobal_range[0] + id0;
+}
+
+std::atomic<size_t> probeCalls{0};
+
+void probeKernel(const arg_desc *, native_cpu::state *) { probeCalls++; }
+
+void emptyKernel(const arg_desc *, native_cpu::state *) {}
+
+// a = b + scalar * c
+void triadKernel(const arg_desc *args, native_cpu::state *s) {
+    auto *a = static_cast<float *>(args[0].MPtr);
+    auto *b = static_cast<const float *>(args[1].MPtr);
+    auto *c = static_cast<const float *>(args[2].MPtr);
+    float scalar = *static_cast<const float *>(args[3].MPtr);
+    forWorkItems(s, [&](size_t id0, size_t id1, size_t id2) {
+        size_t i = linearId(s, id0, id1, id2);
+        a[i] = b[i] + scalar * c[i];
+    });
+}
+
+// Dependent multiply-adds on each work-item
+void computeKernel(const arg_desc *args, native_cpu::state *s) {
+    auto *out = static_cast<float *>(args[0].MPtr);
+    uint32_t iterations = *static_cast<const uint32_t *>(args[1].MPtr);
+    forWorkItems(s, [&](size_t id0, size_t id1, size_t id2) {
+        size_t i = linearId(s, id0, id1, id2);
+        float x = static_cast<float>(i & 0xff) * 1e-3f;
+        for (uint32_t it = 0; it < iterations; it++) {
+            x = x * 0.999f + 0.5f;
+        }
+        out[i] = x;
+    });
+}
+
+template <kernel_fn *F> const unsigned char *entry() {
+    return reinterpret_cast<const unsigned char *>(F);
+}
+
+const program_entry programEntries[] = {
+    {"probe", entry<probeKernel>()},   {"empty", entry<emptyKernel>()},
+    {"triad", entry<triadKernel>()},   {"compute", entry<computeKernel>()},
+    {nullptr, nullptr},
+};
+
+struct launch_shape {
+    uint32_t workDim;
+    std::array<size_t, 3> global;
+    // All zeros for a range launch, leaving the local size to the adapter
+    std::array<size_t, 3> local;
+
+    size_t numItems() const { return global[0] * global[1] * global[2]; }
+};
+
+struct benchmark {
+    std::string name;
+    ur_kernel_handle_t kernel;
+    launch_shape shape;
+    // Launches per timed batch
+    size_t batch;
+    // Relaunches a command-buffer holding the launch instead of enqueueing the
+    // kernel every time
+    bool prebound = false;
+};
+
+struct app {
+    bool csv = false;
+    size_t iterations = 10;
+
+    ur_adapter_handle_t adapter = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+    ur_program_handle_t program = nullptr;
+    std::vector<void *> allocations;
+    std::vector<ur_kernel_handle_t> kernels;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        UR_CHECK(urLoaderInit(0, nullptr));
+        findDevice();
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+        UR_CHECK(urQueueCreate(context, device, nullptr, &queue));
+        UR_CHECK(urProgramCreateWithBinary(
+            context, device, sizeof(programEntries),
+            reinterpret_cast<const uint8_t *>(programEntries), nullptr,
+            &program));
+        UR_CHECK(urProgramBuild(context, program, nullptr));
+    }
+
+    ~app() {
+        for (auto kernel : kernels) {
+            urKernelRelease(kernel);
+        }
+        for (auto ptr : allocations) {
+            urUSMFree(context, ptr);
+        }
+        urProgramRelease(program);
+        urQueueRelease(queue);
+        urContextRelease(context);
+        urAdapterRelease(adapter);
+        urLoaderTearDown();
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage =
+            R"(usage: %s [-h] [--csv] [--iterations N]
+
+Measures the launch overhead and the run time of empty, memory-bound and
+compute-bound kernels on the Native CPU device, over range and nd_range
+launches, and of empty launches relaunched from a command-buffer. Set
+SYCL_NATIVE_CPU_HOST_THREADS to choose the number of threads.
+
+options:
+  -h, --help        show this help message and exit
+  --csv             print name,value rows of the median microseconds per launch
+  --iterations N    number of timed batches per benchmark, default 10
+)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string arg = argv[argi];
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "--csv") {
+                csv = true;
+            } else if (arg == "--iterations" && argi + 1 < argc) {
+                iterations = std::max(1, std::atoi(argv[++argi]));
+            } else {
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+    }
+
+    void findDevice() {
+        uint32_t numAdapters = 0;
+        UR_CHECK(urAdapterGet(0, nullptr, &numAdapters));
+        std::vector<ur_adapter_handle_t> adapters(numAdapters);
+        UR_CHECK(urAdapterGet(numAdapters, adapters.data(), nullptr));
+        for (auto candidate : adapters) {
+            uint32_t numPlatforms = 0;
+            UR_CHECK(urPlatformGet(&candidate, 1, 0, nullptr, &numPlatforms));
+            std::vector<ur_platform_handle_t> platforms(numPlatforms);
+            UR_CHECK(urPlatformGet(&candidate, 1, numPlatforms,
+                                   platforms.data(), nullptr));
+            for (auto platform : platforms) {
+                ur_platform_backend_t backend;
+                UR_CHECK(urPlatformGetInfo(platform, UR_PLATFORM_INFO_BACKEND,
+                                           sizeof(backend), &backend,
+                                           nullptr));
+                if (backend != UR_PLATFORM_BACKEND_NATIVE_CPU) {
+                    continue;
+                }
+                UR_CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                                     nullptr));
+                adapter = candidate;
+            }
+        }
+        for (auto candidate : adapters) {
+            if (candidate != adapter) {
+                urAdapterRelease(candidate);
+            }
+        }
+        if (!device) {
+            std::fprintf(stderr, "error: no Native CPU device found\n");
+            std::exit(1);
+        }
+    }
+
+    ur_kernel_handle_t createKernel(const char *name) {
+        ur_kernel_handle_t kernel;
+        UR_CHECK(urKernelCreate(program, name, &kernel));
+        kernels.push_back(kernel);
+        return kernel;
+    }
+
+    float *allocate(size_t numFloats, float value) {
+        void *ptr;
+        UR_CHECK(urUSMSharedAlloc(context, device, nullptr, nullptr,
+                                  numFloats * sizeof(float), &ptr));
+        allocations.push_back(ptr);
+        std::fill_n(static_cast<float *>(ptr), numFloats, value);
+        return static_cast<float *>(ptr);
+    }
+
+    void launch(ur_kernel_handle_t kernel, const launch_shape &shape) {
+        const size_t offset[3] = {0, 0, 0};
+        bool isRange = shape.local[0] == 0;
+        UR_CHECK(urEnqueueKernelLaunch(queue, kernel, shape.workDim, offset,
+                                       shape.global.data(),
+                                       isRange ? nullptr : shape.local.data(),
+                                       0, nullptr, nullptr));
+    }
+
+    void detectDispatch() {
+        auto kernel = createKernel("probe");
+        launch(kernel, {1, {4, 1, 1}, {2, 1, 1}});
+        UR_CHECK(urQueueFinish(queue));
+        perWorkGroup = probeCalls == 2;
+    }
+
+    // A finalized in-order command-buffer holding only the launch
+    ur_exp_command_buffer_handle_t prebind(ur_kernel_handle_t kernel,
+                                           const launch_shape &shape) {
+        const size_t offset[3] = {0, 0, 0};
+        bool isRange = shape.local[0] == 0;
+        ur_exp_command_buffer_desc_t desc{
+            UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, false, true,
+            false};
+        ur_exp_command_buffer_handle_t commandBuffer;
+        UR_CHECK(urCommandBufferCreateExp(context, device, &desc,
+                                          &commandBuffer));
+        UR_CHECK(urCommandBufferAppendKernelLaunchExp(
+            commandBuffer, kernel, shape.workDim, offset, shape.global.data(),
+            isRange ? nullptr : shape.local.data(), 0, nullptr, 0, nullptr, 0,
+            nullptr, nullptr, nullptr, nullptr));
+        UR_CHECK(urCommandBufferFinalizeExp(commandBuffer));
+        return commandBuffer;
+    }
+
+    // Median microseconds per launch over the timed batches
+    double measure(const benchmark &bench) {
+        ur_exp_command_buffer_handle_t commandBuffer =
+            bench.prebound ? prebind(bench.kernel, bench.shape) : nullptr;
+        auto run = [&] {
+            if (commandBuffer) {
+                UR_CHECK(urCommandBufferEnqueueExp(commandBuffer, queue, 0,
+                                                   nullptr, nullptr));
+            } else {
+                launch(bench.kernel, bench.shape);
+            }
+        };
+
+        for (size_t i = 0; i < std::min<size_t>(bench.batch, 10); i++) {
+            run();
+        }
+        UR_CHECK(urQueueFinish(queue));
+
+        std::vector<double> perLaunch;
+        for (size_t it = 0; it < iterations; it++) {
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < bench.batch; i++) {
+                run();
+            }
+            UR_CHECK(urQueueFinish(queue));
+            std::chrono::duration<double, std::micro> elapsed =
+                std::chrono::steady_clock::now() - start;
+            perLaunch.push_back(elapsed.count() / bench.batch);
+        }
+        if (commandBuffer) {
+            UR_CHECK(urCommandBufferReleaseExp(commandBuffer));
+        }
+        std::sort(perLaunch.begin(), perLaunch.end());
+        return perLaunch[perLaunch.size() / 2];
+    }
+
+    std::vector<benchmark> makeBenchmarks() {
+        std::vector<benchmark> benchmarks;
+        auto add = [&](const std::string &name, ur_kernel_handle_t kernel,
+                       launch_shape shape, size_t batch) {
+            benchmarks.push_back({name, kernel, shape, batch});
+        };
+        auto addPrebound = [&](const std::string &name,
+                               ur_kernel_handle_t kernel, launch_shape shape,
+                               size_t batch) {
+            benchmarks.push_back({name, kernel, shape, batch, true});
+        };
+
+        auto empty = createKernel("empty");
+        add("empty range 1", empty, {1, {1, 1, 1}, {0, 0, 0}}, 1000);
+        add("empty range 64K", empty, {1, {65536, 1, 1}, {0, 0, 0}}, 100);
+        add("empty nd_range 64K/64", empty, {1, {65536, 1, 1}, {64, 1, 1}},
+            100);
+        // The same launches relaunched from a command-buffer, which resolves
+        // them once
+        addPrebound("empty range 1 prebound", empty, {1, {1, 1, 1}, {0, 0, 0}},
+                    1000);
+        addPrebound("empty nd_range 64K/64 prebound", empty,
+                    {1, {65536, 1, 1}, {64, 1, 1}}, 100);
+
+        // Arrays larger than the caches
+        constexpr size_t TriadItems = 16 * 1024 * 1024;
+        auto triad = createKernel("triad");
+        float scalar = 3.0f;
+        UR_CHECK(urKernelSetArgPointer(triad, 0, nullptr,
+                                       allocate(TriadItems, 0.0f)));
+        UR_CHECK(urKernelSetArgPointer(triad, 1, nullptr,
+                                       allocate(TriadItems, 1.0f)));
+        UR_CHECK(urKernelSetArgPointer(triad, 2, nullptr,
+                                       allocate(TriadItems, 2.0f)));
+        UR_CHECK(
+            urKernelSetArgValue(triad, 3, sizeof(scalar), nullptr, &scalar));
+        add("triad range 16M", triad, {1, {TriadItems, 1, 1}, {0, 0, 0}}, 5);
+        add("triad nd_range 16M/256", triad,
+            {1, {TriadItems, 1, 1}, {256, 1, 1}}, 5);
+        add("triad nd_range 256x256x256/4x4x4", triad,
+            {3, {256, 256, 256}, {4, 4, 4}}, 5);
+
+        constexpr size_t ComputeItems = 1024 * 1024;
+        auto compute = createKernel("compute");
+        uint32_t computeIterations = 256;
+        UR_CHECK(urKernelSetArgPointer(compute, 0, nullptr,
+                                       allocate(ComputeItems, 0.0f)));
+        UR_CHECK(urKernelSetArgValue(compute, 1, sizeof(computeIterations),
+                                     nullptr, &computeIterations));
+        add("compute range 1M", compute, {1, {ComputeItems, 1, 1}, {0, 0, 0}},
+            5);
+        add("compute nd_range 1M/64", compute,
+            {1, {ComputeItems, 1, 1}, {64, 1, 1}}, 5);
+        // Few work-groups along the first dimensions
+        add("compute nd_range 3x7x1000/1x1x8", compute,
+            {3, {3, 7, 1000}, {1, 1, 8}}, 50);
+        return benchmarks;
+    }
+
+    int run() {
+        detectDispatch();
+        auto benchmarks = makeBenchmarks();
+        const char *threads = std::getenv("SYCL_NATIVE_CPU_HOST_THREADS");
+        if (csv) {
+            std::printf("name,value\n");
+        } else {
+            std::printf("threads: %s, kernels called per %s\n",
+                        threads ? threads : "default",
+                        perWorkGroup ? "work-group" : "work-item");
+        }
+        for (auto &bench : benchmarks) {
+            double us = measure(bench);
+            if (csv) {
+                std::printf("%s,%.3f\n", bench.name.c_str(), us);
+            } else {
+                std::printf("%-40s %12.3f us/launch\n", bench.name.c_str(),
+                            us);
+            }
+            std::fflush(stdout);
+        }
+        return 0;
+    }
+};
+
+} // namespace
+
+int main(int argc, const char **argv) {
+    app bench(argc, argv);
+    return bench.run();
+}
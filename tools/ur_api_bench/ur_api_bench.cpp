@@ -0,0 +1,474 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Benchmarks written directly against the UR API, which take no kernels so
+// that they run on the first device of any adapter, e.g. one forced with
+// UR_ADAPTERS_FORCE_LOAD:
+//
+//   $ ur_api_bench [--csv] [--filter TEXT] [--threads 1,2,4]
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ur_api.h>
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::fprintf(stderr, "error: " #ACTION " failed: %d\n", error);        \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+double elapsedUs(clock_type::time_point start) {
+    return std::chrono::duration<double, std::micro>(clock_type::now() - start)
+        .count();
+}
+
+std::vector<std::string> split(const std::string &list, char separator) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, separator)) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// Blocks the threads calling wait until count of them have
+class latch {
+  public:
+    explicit latch(size_t count) : count(count) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (--count == 0) {
+            cv.notify_all();
+            return;
+        }
+        cv.wait(lock, [this] { return count == 0; });
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t count;
+};
+
+std::string formatSize(size_t size) {
+    if (size >= 1024 * 1024) {
+        return std::to_string(size / (1024 * 1024)) + "M";
+    }
+    if (size >= 1024) {
+        return std::to_string(size / 1024) + "K";
+    }
+    return std::to_string(size);
+}
+
+struct app {
+    bool csv = false;
+    size_t iterations = 10;
+    std::string filter;
+    std::vector<size_t> threadCounts;
+
+    ur_adapter_handle_t adapter = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+    ur_queue_handle_t queue = nullptr;
+
+    app(int argc, const char **argv) {
+        threadCounts = {1, std::thread::hardware_concurrency()};
+        parseArgs(argc, argv);
+        // hardware_concurrency is 0 when unknown
+        threadCounts.erase(
+            std::remove(threadCounts.begin(), threadCounts.end(), 0),
+            threadCounts.end());
+        std::sort(threadCounts.begin(), threadCounts.end());
+        threadCounts.erase(
+            std::unique(threadCounts.begin(), threadCounts.end()),
+            threadCounts.end());
+        UR_CHECK(urLoaderInit(0, nullptr));
+        findDevice();
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+        UR_CHECK(urQueueCreate(context, device, nullptr, &queue));
+    }
+
+    ~app() {
+        urQueueRelease(queue);
+        urContextRelease(context);
+        urDeviceRelease(device);
+        urAdapterRelease(adapter);
+        urLoaderTearDown();
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage =
+            R"(usage: %s [-h] [--csv] [--filter TEXT] [--threads N1,N2]
+          [--iterations N]
+
+Measures event round trips, USM allocations, 1D, 2D and 3D copies,
+command-buffer recording and replay, and copies on concurrent queues with the
+UR API, on the first device of the first adapter.
+
+options:
+  -h, --help        show this help message and exit
+  --csv             print name,value rows of the median microseconds per
+                    operation
+  --filter TEXT     only run the benchmarks whose name contains TEXT
+  --threads N1,N2   numbers of threads or queues for the concurrent
+                    benchmarks, default 1 and the number of cores
+  --iterations N    number of timed batches per benchmark, default 10
+)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string arg = argv[argi];
+            bool hasValue = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "--csv") {
+                csv = true;
+            } else if (arg == "--filter" && hasValue) {
+                filter = argv[++argi];
+            } else if (arg == "--threads" && hasValue) {
+                threadCounts.clear();
+                for (auto &count : split(argv[++argi], ',')) {
+                    threadCounts.push_back(std::max(1, std::stoi(count)));
+                }
+            } else if (arg == "--iterations" && hasValue) {
+                iterations = std::max(1, std::atoi(argv[++argi]));
+            } else {
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+    }
+
+    void findDevice() {
+        uint32_t numAdapters = 0;
+        UR_CHECK(urAdapterGet(0, nullptr, &numAdapters));
+        std::vector<ur_adapter_handle_t> adapters(numAdapters);
+        UR_CHECK(urAdapterGet(numAdapters, adapters.data(), nullptr));
+        for (auto candidate : adapters) {
+            uint32_t numPlatforms = 0;
+            UR_CHECK(urPlatformGet(&candidate, 1, 0, nullptr, &numPlatforms));
+            std::vector<ur_platform_handle_t> platforms(numPlatforms);
+            UR_CHECK(urPlatformGet(&candidate, 1, numPlatforms,
+                                   platforms.data(), nullptr));
+            for (auto platform : platforms) {
+                uint32_t numDevices = 0;
+                urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
+                            &numDevices);
+                if (numDevices && !device) {
+                    UR_CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1,
+                                         &device, nullptr));
+                    adapter = candidate;
+                }
+            }
+        }
+        for (auto candidate : adapters) {
+            if (candidate != adapter) {
+                urAdapterRelease(candidate);
+            }
+        }
+        if (!device) {
+            std::fprintf(stderr, "error: no device found\n");
+            std::exit(1);
+        }
+    }
+
+    template <typename T> bool getInfo(ur_device_info_t prop, T &value) {
+        return urDeviceGetInfo(device, prop, sizeof(T), &value, nullptr) ==
+               UR_RESULT_SUCCESS;
+    }
+
+    bool supportsCommandBuffers() {
+        ur_bool_t supported = false;
+        return getInfo(UR_DEVICE_INFO_COMMAND_BUFFER_SUPPORT_EXP, supported) &&
+               supported;
+    }
+
+    bool supportsMemcpy2D() {
+        ur_bool_t supported = false;
+        return urContextGetInfo(context, UR_CONTEXT_INFO_USM_MEMCPY2D_SUPPORT,
+                                sizeof(supported), &supported,
+                                nullptr) == UR_RESULT_SUCCESS &&
+               supported;
+    }
+
+    void *deviceAlloc(size_t size) {
+        void *ptr;
+        UR_CHECK(urUSMDeviceAlloc(context, device, nullptr, nullptr, size,
+                                  &ptr));
+        return ptr;
+    }
+
+    // Median over the iterations of batch(), which returns the microseconds
+    // per operation of a batch, after an untimed batch
+    double measure(const std::function<double()> &batch) {
+        batch();
+        std::vector<double> perOperation;
+        for (size_t it = 0; it < iterations; it++) {
+            perOperation.push_back(batch());
+        }
+        std::sort(perOperation.begin(), perOperation.end());
+        return perOperation[perOperation.size() / 2];
+    }
+
+    // Runs f(threadId) on numThreads threads at once, returning the time the
+    // slowest took in microseconds. prepare(threadId) runs untimed before.
+    double concurrently(size_t numThreads,
+                        const std::function<void(size_t)> &prepare,
+                        const std::function<void(size_t)> &f) {
+        std::vector<double> threadUs(numThreads);
+        latch ready(numThreads);
+        auto worker = [&](size_t threadId) {
+            prepare(threadId);
+            ready.wait();
+            auto start = clock_type::now();
+            f(threadId);
+            threadUs[threadId] = elapsedUs(start);
+        };
+        std::vector<std::thread> threads;
+        for (size_t threadId = 1; threadId < numThreads; threadId++) {
+            threads.emplace_back(worker, threadId);
+        }
+        worker(0);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        return *std::max_element(threadUs.begin(), threadUs.end());
+    }
+
+    void report(const std::string &name, const std::function<double()> &batch) {
+        if (name.find(filter) == std::string::npos) {
+            return;
+        }
+        double us = measure(batch);
+        if (csv) {
+            std::printf("%s,%.3f\n", name.c_str(), us);
+        } else {
+            std::printf("%-48s %12.3f us\n", name.c_str(), us);
+        }
+        std::fflush(stdout);
+    }
+
+    void benchEvents() {
+        constexpr size_t Batch = 1000;
+        report("event round trip", [&] {
+            auto start = clock_type::now();
+            for (size_t i = 0; i < Batch; i++) {
+                ur_event_handle_t event;
+                UR_CHECK(urEnqueueEventsWait(queue, 0, nullptr, &event));
+                UR_CHECK(urEventWait(1, &event));
+                UR_CHECK(urEventRelease(event));
+            }
+            return elapsedUs(start) / Batch;
+        });
+    }
+
+    void benchUSMAlloc() {
+        constexpr size_t Batch = 100;
+        for (size_t size : {size_t(64), size_t(64 * 1024),
+                            size_t(16 * 1024 * 1024)}) {
+            for (size_t numThreads : threadCounts) {
+                std::vector<std::vector<void *>> ptrs(numThreads);
+                auto name = "usm alloc/free device " + formatSize(size) + " " +
+                            std::to_string(numThreads) + " threads";
+                report(name, [&] {
+                    auto prepare = [&](size_t threadId) {
+                        ptrs[threadId].resize(Batch);
+                    };
+                    auto allocFree = [&](size_t threadId) {
+                        for (auto &ptr : ptrs[threadId]) {
+                            ptr = deviceAlloc(size);
+                        }
+                        for (auto ptr : ptrs[threadId]) {
+                            UR_CHECK(urUSMFree(context, ptr));
+                        }
+                    };
+                    return concurrently(numThreads, prepare, allocFree) /
+                           Batch;
+                });
+            }
+        }
+    }
+
+    void benchCopies() {
+        constexpr size_t Batch = 10;
+        // 16 MiB copies, as a 1D range, 4096 rows and 256^3 bytes
+        constexpr size_t Size = 16 * 1024 * 1024;
+        constexpr size_t Width = 4096;
+        constexpr size_t Side = 256;
+        void *src = deviceAlloc(Size);
+        void *dst = deviceAlloc(Size);
+
+        report("copy 1D usm 16M", [&] {
+            auto start = clock_type::now();
+            for (size_t i = 0; i < Batch; i++) {
+                UR_CHECK(urEnqueueUSMMemcpy(queue, false, dst, src, Size, 0,
+                                            nullptr, nullptr));
+            }
+            UR_CHECK(urQueueFinish(queue));
+            return elapsedUs(start) / Batch;
+        });
+
+        if (supportsMemcpy2D()) {
+            report("copy 2D usm 4096x4096", [&] {
+                auto start = clock_type::now();
+                for (size_t i = 0; i < Batch; i++) {
+                    UR_CHECK(urEnqueueUSMMemcpy2D(queue, false, dst, Width, src,
+                                                  Width, Width, Size / Width,
+                                                  0, nullptr, nullptr));
+                }
+                UR_CHECK(urQueueFinish(queue));
+                return elapsedUs(start) / Batch;
+            });
+        }
+
+        ur_mem_handle_t srcBuffer, dstBuffer;
+        UR_CHECK(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, Size,
+                                   nullptr, &srcBuffer));
+        UR_CHECK(urMemBufferCreate(context, UR_MEM_FLAG_READ_WRITE, Size,
+                                   nullptr, &dstBuffer));
+        report("copy 3D buffer 256x256x256", [&] {
+            const ur_rect_offset_t origin = {0, 0, 0};
+            const ur_rect_region_t region = {Side, Side, Side};
+            auto start = clock_type::now();
+            for (size_t i = 0; i < Batch; i++) {
+                UR_CHECK(urEnqueueMemBufferCopyRect(
+                    queue, srcBuffer, dstBuffer, origin, origin, region, Side,
+                    Side * Side, Side, Side * Side, 0, nullptr, nullptr));
+            }
+            UR_CHECK(urQueueFinish(queue));
+            return elapsedUs(start) / Batch;
+        });
+
+        UR_CHECK(urMemRelease(dstBuffer));
+        UR_CHECK(urMemRelease(srcBuffer));
+        UR_CHECK(urUSMFree(context, dst));
+        UR_CHECK(urUSMFree(context, src));
+    }
+
+    void benchCommandBuffers() {
+        if (!supportsCommandBuffers()) {
+            return;
+        }
+        constexpr size_t Batch = 100;
+        // Copies per command-buffer, each depending on the previous one
+        constexpr size_t Commands = 16;
+        constexpr size_t Size = 4096;
+        void *src = deviceAlloc(Size * Commands);
+        void *dst = deviceAlloc(Size * Commands);
+
+        auto record = [&] {
+            ur_exp_command_buffer_desc_t desc = {
+                UR_STRUCTURE_TYPE_EXP_COMMAND_BUFFER_DESC, nullptr, false,
+                false, false};
+            ur_exp_command_buffer_handle_t commandBuffer;
+            UR_CHECK(urCommandBufferCreateExp(context, device, &desc,
+                                              &commandBuffer));
+            ur_exp_command_buffer_sync_point_t syncPoint;
+            for (size_t i = 0; i < Commands; i++) {
+                UR_CHECK(urCommandBufferAppendUSMMemcpyExp(
+                    commandBuffer, static_cast<char *>(dst) + i * Size,
+                    static_cast<char *>(src) + i * Size, Size, i ? 1 : 0,
+                    i ? &syncPoint : nullptr, 0, nullptr, &syncPoint, nullptr,
+                    nullptr));
+            }
+            UR_CHECK(urCommandBufferFinalizeExp(commandBuffer));
+            return commandBuffer;
+        };
+
+        report("command-buffer record 16 copies", [&] {
+            auto start = clock_type::now();
+            for (size_t i = 0; i < Batch; i++) {
+                UR_CHECK(urCommandBufferReleaseExp(record()));
+            }
+            return elapsedUs(start) / Batch;
+        });
+
+        auto commandBuffer = record();
+        report("command-buffer replay 16 copies", [&] {
+            auto start = clock_type::now();
+            for (size_t i = 0; i < Batch; i++) {
+                UR_CHECK(urCommandBufferEnqueueExp(commandBuffer, queue, 0,
+                                                   nullptr, nullptr));
+            }
+            UR_CHECK(urQueueFinish(queue));
+            return elapsedUs(start) / Batch;
+        });
+
+        UR_CHECK(urCommandBufferReleaseExp(commandBuffer));
+        UR_CHECK(urUSMFree(context, dst));
+        UR_CHECK(urUSMFree(context, src));
+    }
+
+    void benchQueues() {
+        // Copies per queue, each thread filling and finishing its own queue
+        constexpr size_t Batch = 1000;
+        constexpr size_t Size = 4096;
+        for (size_t numQueues : threadCounts) {
+            std::vector<ur_queue_handle_t> queues(numQueues);
+            std::vector<void *> buffers(numQueues);
+            for (size_t q = 0; q < numQueues; q++) {
+                UR_CHECK(urQueueCreate(context, device, nullptr, &queues[q]));
+                buffers[q] = deviceAlloc(Size * 2);
+            }
+            auto name =
+                "queues " + std::to_string(numQueues) + " usm copies 4K";
+            report(name, [&] {
+                auto copies = [&](size_t q) {
+                    auto *buffer = static_cast<char *>(buffers[q]);
+                    for (size_t i = 0; i < Batch; i++) {
+                        UR_CHECK(urEnqueueUSMMemcpy(queues[q], false,
+                                                    buffer + Size, buffer,
+                                                    Size, 0, nullptr, nullptr));
+                    }
+                    UR_CHECK(urQueueFinish(queues[q]));
+                };
+                return concurrently(numQueues, [](size_t) {}, copies) /
+                       (Batch * numQueues);
+            });
+            for (size_t q = 0; q < numQueues; q++) {
+                UR_CHECK(urUSMFree(context, buffers[q]));
+                UR_CHECK(urQueueRelease(queues[q]));
+            }
+        }
+    }
+
+    int run() {
+        if (csv) {
+            std::printf("name,value\n");
+        }
+        benchEvents();
+        benchUSMAlloc();
+        benchCopies();
+        benchCommandBuffers();
+        benchQueues();
+        return 0;
+    }
+};
+
+} // namespace
+
+int main(int argc, const char **argv) {
+    app bench(argc, argv);
+    return bench.run();
+}
@@ -0,0 +1,323 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Measures the cost of the loader and its layers per API call, against the
+// mock adapter, which does next to nothing. Layers are enabled through the
+// loader config, so each combination of layers is a separate run, which the
+// benchmark scripts drive:
+//
+//   $ ur_dispatch_bench [--csv] [--layers L1,L2] [--threads 1,2,4]
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <ur_api.h>
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::fprintf(stderr, "error: " #ACTION " failed: %d\n", error);        \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace {
+
+std::vector<std::string> split(const std::string &list, char separator) {
+    std::vector<std::string> items;
+    std::stringstream stream(list);
+    std::string item;
+    while (std::getline(stream, item, separator)) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+// Blocks the threads calling wait until count of them have
+class latch {
+  public:
+    explicit latch(size_t count) : count(count) {}
+
+    void wait() {
+        std::unique_lock<std::mutex> lock(mutex);
+        if (--count == 0) {
+            cv.notify_all();
+            return;
+        }
+        cv.wait(lock, [this] { return count == 0; });
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable cv;
+    size_t count;
+};
+
+// The handles one thread calls the entry points with
+struct thread_state {
+    ur_context_handle_t context;
+    ur_device_handle_t device;
+    ur_queue_handle_t queue = nullptr;
+    ur_program_handle_t program = nullptr;
+    ur_kernel_handle_t kernel = nullptr;
+    std::vector<ur_event_handle_t> events;
+    std::vector<void *> allocations;
+
+    thread_state(ur_context_handle_t context, ur_device_handle_t device)
+        : context(context), device(device) {
+        static const uint8_t il[] = {0x03, 0x02, 0x23, 0x07};
+        UR_CHECK(urQueueCreate(context, device, nullptr, &queue));
+        UR_CHECK(urProgramCreateWithIL(context, il, sizeof(il), nullptr,
+                                       &program));
+        UR_CHECK(urKernelCreate(program, "kernel", &kernel));
+    }
+
+    ~thread_state() {
+        for (auto event : events) {
+            urEventRelease(event);
+        }
+        for (auto ptr : allocations) {
+            urUSMFree(context, ptr);
+        }
+        urKernelRelease(kernel);
+        urProgramRelease(program);
+        urQueueRelease(queue);
+    }
+};
+
+struct benchmark {
+    const char *name;
+    // Called before timing iterations calls of run
+    std::function<void(thread_state &, size_t iterations)> prepare;
+    std::function<void(thread_state &, size_t iteration)> run;
+    // Called after the timed calls, to release what they created
+    std::function<void(thread_state &)> finish;
+};
+
+std::vector<benchmark> makeBenchmarks() {
+    static const size_t globalOffset[] = {0};
+    static const size_t globalSize[] = {1024};
+    auto none = [](thread_state &, size_t) {};
+    auto nothing = [](thread_state &) {};
+    return {
+        {"urEnqueueKernelLaunch", none,
+         [](thread_state &state, size_t) {
+             UR_CHECK(urEnqueueKernelLaunch(state.queue, state.kernel, 1,
+                                            globalOffset, globalSize, nullptr,
+                                            0, nullptr, nullptr));
+         },
+         nothing},
+        {"urKernelSetArgValue", none,
+         [](thread_state &state, size_t iteration) {
+             uint32_t value = static_cast<uint32_t>(iteration);
+             UR_CHECK(urKernelSetArgValue(state.kernel, 0, sizeof(value),
+                                          nullptr, &value));
+         },
+         nothing},
+        {"urEventRelease",
+         [](thread_state &state, size_t iterations) {
+             state.events.resize(iterations);
+             for (auto &event : state.events) {
+                 UR_CHECK(urEnqueueEventsWait(state.queue, 0, nullptr, &event));
+             }
+         },
+         [](thread_state &state, size_t iteration) {
+             UR_CHECK(urEventRelease(state.events[iteration]));
+         },
+         [](thread_state &state) { state.events.clear(); }},
+        {"urUSMDeviceAlloc",
+         [](thread_state &state, size_t iterations) {
+             state.allocations.resize(iterations);
+         },
+         [](thread_state &state, size_t iteration) {
+             UR_CHECK(urUSMDeviceAlloc(state.context, state.device, nullptr,
+                                       nullptr, 64,
+                                       &state.allocations[iteration]));
+         },
+         [](thread_state &state) {
+             for (auto ptr : state.allocations) {
+                 UR_CHECK(urUSMFree(state.context, ptr));
+             }
+             state.allocations.clear();
+         }},
+    };
+}
+
+struct app {
+    bool csv = false;
+    size_t iterations = 100000;
+    std::vector<std::string> layers;
+    std::vector<size_t> threadCounts = {1};
+
+    ur_loader_config_handle_t config = nullptr;
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+
+    app(int argc, const char **argv) {
+        UR_CHECK(urLoaderConfigCreate(&config));
+        parseArgs(argc, argv);
+        UR_CHECK(urLoaderConfigSetMockingEnabled(config, true));
+        for (auto &layer : layers) {
+            if (urLoaderConfigEnableLayer(config, layer.c_str())) {
+                std::fprintf(stderr, "error: layer %s is not available\n",
+                             layer.c_str());
+                std::exit(1);
+            }
+        }
+        UR_CHECK(urLoaderInit(0, config));
+        UR_CHECK(urAdapterGet(1, &adapter, nullptr));
+        UR_CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+        UR_CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                             nullptr));
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+    }
+
+    ~app() {
+        urContextRelease(context);
+        urDeviceRelease(device);
+        urAdapterRelease(adapter);
+        urLoaderTearDown();
+        urLoaderConfigRelease(config);
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage =
+            R"(usage: %s [-h] [--csv] [--available-layers] [--layers L1,L2]
+          [--threads N1,N2] [--iterations N]
+
+Measures the nanoseconds per call of urEnqueueKernelLaunch,
+urKernelSetArgValue, urEventRelease and urUSMDeviceAlloc through the loader
+and the given layers, on the mock adapter.
+
+options:
+  -h, --help          show this help message and exit
+  --csv               print name,value rows of the nanoseconds per call
+  --available-layers  print the layers the loader was built with and exit
+  --layers L1,L2      layers to enable, e.g. UR_LAYER_PARAMETER_VALIDATION
+  --threads N1,N2     numbers of threads calling concurrently, default 1
+  --iterations N      calls per thread and benchmark, default 100000
+)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string arg = argv[argi];
+            bool hasValue = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "--csv") {
+                csv = true;
+            } else if (arg == "--available-layers") {
+                printAvailableLayers();
+                std::exit(0);
+            } else if (arg == "--layers" && hasValue) {
+                layers = split(argv[++argi], ',');
+            } else if (arg == "--threads" && hasValue) {
+                threadCounts.clear();
+                for (auto &count : split(argv[++argi], ',')) {
+                    threadCounts.push_back(std::max(1, std::stoi(count)));
+                }
+            } else if (arg == "--iterations" && hasValue) {
+                iterations = std::max(1, std::atoi(argv[++argi]));
+            } else {
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+    }
+
+    void printAvailableLayers() {
+        size_t size = 0;
+        UR_CHECK(urLoaderConfigGetInfo(config,
+                                       UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS,
+                                       0, nullptr, &size));
+        std::string available(size, '\0');
+        UR_CHECK(urLoaderConfigGetInfo(config,
+                                       UR_LOADER_CONFIG_INFO_AVAILABLE_LAYERS,
+                                       size, available.data(), nullptr));
+        for (auto &layer : split(available.c_str(), ';')) {
+            std::printf("%s\n", layer.c_str());
+        }
+    }
+
+    // Nanoseconds per call seen by the threads calling concurrently, the
+    // slowest thread setting the time
+    double measure(const benchmark &bench, size_t numThreads) {
+        std::vector<double> elapsedNs(numThreads);
+        latch ready(numThreads);
+        latch done(numThreads);
+
+        auto worker = [&](size_t threadId) {
+            thread_state state(context, device);
+            bench.prepare(state, iterations);
+            ready.wait();
+            auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < iterations; i++) {
+                bench.run(state, i);
+            }
+            std::chrono::duration<double, std::nano> elapsed =
+                std::chrono::steady_clock::now() - start;
+            elapsedNs[threadId] = elapsed.count();
+            done.wait();
+            bench.finish(state);
+        };
+
+        std::vector<std::thread> threads;
+        for (size_t threadId = 1; threadId < numThreads; threadId++) {
+            threads.emplace_back(worker, threadId);
+        }
+        worker(0);
+        for (auto &thread : threads) {
+            thread.join();
+        }
+        return *std::max_element(elapsedNs.begin(), elapsedNs.end()) /
+               iterations;
+    }
+
+    int run() {
+        std::string layerNames;
+        for (auto &layer : layers) {
+            layerNames += (layerNames.empty() ? "" : ",") + layer;
+        }
+        if (csv) {
+            std::printf("name,value\n");
+        } else {
+            std::printf("layers: %s\n",
+                        layerNames.empty() ? "none" : layerNames.c_str());
+        }
+        for (auto &bench : makeBenchmarks()) {
+            for (auto numThreads : threadCounts) {
+                double ns = measure(bench, numThreads);
+                if (csv) {
+                    std::printf("%s %zu threads,%.3f\n", bench.name,
+                                numThreads, ns);
+                } else {
+                    std::printf("%-24s %4zu threads %12.3f ns/call\n",
+                                bench.name, numThreads, ns);
+                }
+                std::fflush(stdout);
+            }
+        }
+        return 0;
+    }
+};
+
+} // namespace
+
+int main(int argc, const char **argv) {
+    app bench(argc, argv);
+    return bench.run();
+}
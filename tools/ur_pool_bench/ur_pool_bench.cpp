@@ -0,0 +1,677 @@
+// Copyright (C) 2024 Intel Corporation
+// Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+// See LICENSE.TXT
+// SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+
+// Replays the USM allocations of an application, or of a synthetic pattern,
+// through a usm::pool_manager of the disjoint pools the adapters create, for
+// each of the given pool configs, so that the configs can be tuned offline
+// against an application's allocation profile:
+//
+//   $ urtrace --json --file app.json ./app
+//   $ ur_pool_bench --trace app.json --config "1;32M;device:1M,4,64K"
+//
+// The pools allocate from host memory standing in for the device's, since
+// only the pools are measured, and the device memory is never accessed.
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "umf_helpers.hpp"
+#include "umf_pools/disjoint_pool_config_parser.hpp"
+#include "ur_pool_manager.hpp"
+
+#define UR_CHECK(ACTION)                                                       \
+    if (auto error = ACTION) {                                                 \
+        std::fprintf(stderr, "error: " #ACTION " failed: %d\n", error);        \
+        std::exit(1);                                                          \
+    }                                                                          \
+    (void)0
+
+namespace {
+
+// What the memory providers of one replay allocated
+struct footprint_t {
+    size_t reserved = 0;
+    uint64_t allocations = 0;
+};
+
+// Stands in for an adapter's memory provider, rounding allocations up to its
+// page size like the drivers do
+class host_provider {
+  public:
+    umf_result_t initialize(footprint_t *footprint, size_t pageSize) {
+        this->footprint = footprint;
+        this->pageSize = pageSize;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    ~host_provider() {
+        for (auto &[ptr, size] : sizes) {
+            release(ptr);
+            footprint->reserved -= size;
+        }
+    }
+
+    umf_result_t alloc(size_t size, size_t alignment, void **ptr) {
+        alignment = std::max(alignment, pageSize);
+        size = (size + alignment - 1) / alignment * alignment;
+#ifdef _WIN32
+        *ptr = _aligned_malloc(size, alignment);
+#else
+        *ptr = std::aligned_alloc(alignment, size);
+#endif
+        if (!*ptr) {
+            return UMF_RESULT_ERROR_MEMORY_PROVIDER_SPECIFIC;
+        }
+        sizes.emplace(*ptr, size);
+        footprint->reserved += size;
+        footprint->allocations++;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t free(void *ptr, size_t) {
+        auto it = sizes.find(ptr);
+        if (it == sizes.end()) {
+            return UMF_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        release(ptr);
+        footprint->reserved -= it->second;
+        sizes.erase(it);
+        return UMF_RESULT_SUCCESS;
+    }
+
+    void get_last_native_error(const char **errMsg, int32_t *errCode) {
+        *errMsg = "out of host memory";
+        *errCode = 0;
+    }
+
+    umf_result_t get_recommended_page_size(size_t, size_t *size) {
+        *size = pageSize;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    umf_result_t get_min_page_size(void *, size_t *size) {
+        *size = pageSize;
+        return UMF_RESULT_SUCCESS;
+    }
+
+    const char *get_name() { return "host"; }
+
+    umf_result_t purge_lazy(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t purge_force(void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_merge(void *, void *, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+    umf_result_t allocation_split(void *, size_t, size_t) {
+        return UMF_RESULT_ERROR_NOT_SUPPORTED;
+    }
+
+  private:
+    static void release(void *ptr) {
+#ifdef _WIN32
+        _aligned_free(ptr);
+#else
+        std::free(ptr);
+#endif
+    }
+
+    footprint_t *footprint = nullptr;
+    size_t pageSize = 0;
+    // Sizes as rounded up, which the pools don't know
+    std::unordered_map<void *, size_t> sizes;
+};
+
+// An allocation or a free of the allocation in slot, slots being reused once
+// freed so that the replay needn't look up addresses
+struct trace_op {
+    bool isAlloc;
+    ur_usm_type_t type;
+    size_t size;
+    size_t slot;
+};
+
+struct trace_t {
+    std::string name;
+    std::vector<trace_op> ops;
+    size_t numSlots = 0;
+};
+
+// Assigns the slots of the allocations of a trace
+class trace_builder {
+  public:
+    explicit trace_builder(std::string name) { trace.name = std::move(name); }
+
+    void alloc(uint64_t address, ur_usm_type_t type, size_t size) {
+        // The free of an address handed out again went missing
+        free(address);
+        size_t slot;
+        if (freeSlots.empty()) {
+            slot = trace.numSlots++;
+        } else {
+            slot = freeSlots.back();
+            freeSlots.pop_back();
+        }
+        live.emplace(address, trace.ops.size());
+        trace.ops.push_back({true, type, size, slot});
+    }
+
+    void free(uint64_t address) {
+        auto it = live.find(address);
+        if (it == live.end()) {
+            return;
+        }
+        auto op = trace.ops[it->second];
+        live.erase(it);
+        freeSlots.push_back(op.slot);
+        trace.ops.push_back({false, op.type, op.size, op.slot});
+    }
+
+    // Frees what the trace leaves allocated, for the pools to be destroyed
+    // empty
+    trace_t finish() {
+        while (!live.empty()) {
+            free(live.begin()->first);
+        }
+        return std::move(trace);
+    }
+
+  private:
+    trace_t trace;
+    // The index in ops of the allocation of each live address
+    std::unordered_map<uint64_t, size_t> live;
+    std::vector<size_t> freeSlots;
+};
+
+// Returns the number following key in line, as printed by urtrace, or 0
+uint64_t findNumber(std::string_view line, std::string_view key,
+                    int base = 10) {
+    auto pos = line.find(key);
+    if (pos == std::string_view::npos) {
+        return 0;
+    }
+    std::string value(line.substr(pos + key.size(), 32));
+    return std::strtoull(value.c_str(), nullptr, base);
+}
+
+// Reads the USM allocations and frees of a urtrace --json trace, which holds
+// an event per line, printing the arguments of each call
+trace_t loadTrace(const std::string &path) {
+    std::ifstream file(path);
+    if (!file) {
+        std::fprintf(stderr, "error: cannot open %s\n", path.c_str());
+        std::exit(1);
+    }
+
+    struct event {
+        uint64_t ts;
+        ur_usm_type_t type;
+        bool isAlloc;
+        uint64_t address;
+        size_t size;
+    };
+    static const std::pair<std::string_view, ur_usm_type_t> allocs[] = {
+        {"\"urUSMHostAlloc\"", UR_USM_TYPE_HOST},
+        {"\"urUSMDeviceAlloc\"", UR_USM_TYPE_DEVICE},
+        {"\"urUSMSharedAlloc\"", UR_USM_TYPE_SHARED},
+    };
+
+    std::vector<event> events;
+    size_t withoutArgs = 0;
+    std::string line;
+    while (std::getline(file, line)) {
+        event e = {findNumber(line, "\"ts\": "), UR_USM_TYPE_UNKNOWN, false,
+                   0, 0};
+        for (auto &[name, type] : allocs) {
+            if (line.find(name) != std::string::npos) {
+                e.type = type;
+                e.isAlloc = true;
+            }
+        }
+        if (e.isAlloc) {
+            // .ppMem = 0x7ffd0000 (0x55550000)
+            auto pos = line.find(".ppMem = ");
+            pos = pos == std::string::npos ? pos : line.find('(', pos);
+            if (pos == std::string::npos) {
+                withoutArgs++;
+                continue;
+            }
+            e.address = findNumber(line.substr(pos), "(", 16);
+            e.size = findNumber(line, ".size = ");
+        } else if (line.find("\"urUSMFree\"") != std::string::npos) {
+            e.address = findNumber(line, ".pMem = ", 16);
+            withoutArgs += line.find(".pMem = ") == std::string::npos;
+        }
+        // Failed allocations print a null pointer
+        if (e.address != 0) {
+            events.push_back(e);
+        }
+    }
+    if (events.empty()) {
+        std::fprintf(stderr,
+                     "error: %s has no USM allocations%s\n", path.c_str(),
+                     withoutArgs ? ", record it with urtrace --json without "
+                                   "--no-args"
+                                 : "");
+        std::exit(1);
+    }
+
+    // Events are written once calls return, threads interleaving
+    std::stable_sort(
+        events.begin(), events.end(),
+        [](const event &a, const event &b) { return a.ts < b.ts; });
+    auto name = path.substr(path.find_last_of("/\\") + 1);
+    trace_builder builder(name.substr(0, name.rfind('.')));
+    for (auto &e : events) {
+        if (e.isAlloc) {
+            builder.alloc(e.address, e.type, e.size);
+        } else {
+            builder.free(e.address);
+        }
+    }
+    return builder.finish();
+}
+
+// Most allocations are small and a few very large, as in most applications
+class power_law_sizes {
+  public:
+    static constexpr size_t minSize = 64;
+    static constexpr double exponent = 1.2;
+
+    power_law_sizes(uint64_t seed, size_t maxSize)
+        : rng(seed), tail(std::pow(double(minSize) / maxSize, exponent)) {}
+
+    size_t operator()() {
+        // Inverse of the CDF of the Pareto distribution cut off at maxSize
+        double u = std::uniform_real_distribution<double>()(rng);
+        double size = minSize * std::pow(1 - u * (1 - tail), -1 / exponent);
+        return (static_cast<size_t>(size) + 7) / 8 * 8;
+    }
+
+    std::mt19937_64 rng;
+
+  private:
+    double tail;
+};
+
+// Allocations of power-law sizes, whose number stays around live, each op
+// allocating or freeing a random allocation
+trace_t powerLawTrace(size_t ops, size_t live, ur_usm_type_t type,
+                      size_t maxSize, uint64_t seed) {
+    power_law_sizes sizes(seed, maxSize);
+    trace_builder builder("power-law");
+    std::vector<uint64_t> addresses;
+    uint64_t nextAddress = 1;
+    for (size_t i = 0; i < ops; i++) {
+        bool alloc = addresses.size() < live ||
+                     (addresses.size() < 2 * live && sizes.rng() % 2);
+        if (alloc) {
+            builder.alloc(nextAddress, type, sizes());
+            addresses.push_back(nextAddress++);
+        } else {
+            auto victim = addresses.begin() + sizes.rng() % addresses.size();
+            builder.free(*victim);
+            *victim = addresses.back();
+            addresses.pop_back();
+        }
+    }
+    return builder.finish();
+}
+
+// Bursts of temporary allocations of power-law sizes freed together, as an
+// iteration of a solver would, with one in sixteen surviving the burst until
+// more than live allocations survived
+trace_t burstsTrace(size_t ops, size_t live, ur_usm_type_t type,
+                    size_t maxSize, uint64_t seed) {
+    power_law_sizes sizes(seed, maxSize);
+    trace_builder builder("bursts");
+    std::vector<uint64_t> burst;
+    std::vector<uint64_t> survivors;
+    size_t survivorsBegin = 0;
+    uint64_t nextAddress = 1;
+    size_t done = 0;
+    while (done < ops) {
+        size_t length = 1 + sizes.rng() % 512;
+        for (size_t i = 0; i < length && done < ops; i++, done++) {
+            builder.alloc(nextAddress, type, sizes());
+            burst.push_back(nextAddress++);
+        }
+        for (auto address : burst) {
+            if (sizes.rng() % 16 == 0) {
+                survivors.push_back(address);
+            } else if (done < ops) {
+                builder.free(address);
+                done++;
+            }
+        }
+        burst.clear();
+        while (survivors.size() - survivorsBegin > live && done < ops) {
+            builder.free(survivors[survivorsBegin++]);
+            done++;
+        }
+    }
+    return builder.finish();
+}
+
+size_t parseSize(const std::string &value) {
+    char *end = nullptr;
+    size_t size = std::strtoull(value.c_str(), &end, 10);
+    switch (std::tolower(*end)) {
+    case 'k':
+        return size << 10;
+    case 'm':
+        return size << 20;
+    case 'g':
+        return size << 30;
+    default:
+        return size;
+    }
+}
+
+usm::DisjointPoolMemType getMemType(const usm::pool_descriptor &desc) {
+    switch (desc.type) {
+    case UR_USM_TYPE_HOST:
+        return usm::DisjointPoolMemType::Host;
+    case UR_USM_TYPE_DEVICE:
+        return usm::DisjointPoolMemType::Device;
+    default:
+        return desc.deviceReadOnly ? usm::DisjointPoolMemType::SharedReadOnly
+                                   : usm::DisjointPoolMemType::Shared;
+    }
+}
+
+struct replay_result {
+    double opsPerSecond;
+    size_t peakFootprint;
+    size_t peakUsed;
+    // Share of the footprint at its peak not backing live allocations
+    double fragmentation;
+    uint64_t providerAllocations;
+    double hitRate;
+};
+
+struct app {
+    bool csv = false;
+    std::vector<std::string> tracePaths;
+    std::vector<std::string> patterns;
+    std::vector<std::string> configs;
+    ur_usm_type_t memType = UR_USM_TYPE_DEVICE;
+    size_t ops = 1000000;
+    size_t live = 1000;
+    size_t maxSize = 16 << 20;
+    size_t pageSize = 64 << 10;
+    uint64_t seed = 1;
+
+    ur_loader_config_handle_t config = nullptr;
+    ur_adapter_handle_t adapter = nullptr;
+    ur_platform_handle_t platform = nullptr;
+    ur_device_handle_t device = nullptr;
+    ur_context_handle_t context = nullptr;
+
+    app(int argc, const char **argv) {
+        parseArgs(argc, argv);
+        // The pool manager only needs devices to key the pools with
+        UR_CHECK(urLoaderConfigCreate(&config));
+        UR_CHECK(urLoaderConfigSetMockingEnabled(config, true));
+        UR_CHECK(urLoaderInit(0, config));
+        UR_CHECK(urAdapterGet(1, &adapter, nullptr));
+        UR_CHECK(urPlatformGet(&adapter, 1, 1, &platform, nullptr));
+        UR_CHECK(urDeviceGet(platform, UR_DEVICE_TYPE_ALL, 1, &device,
+                             nullptr));
+        UR_CHECK(urContextCreate(1, &device, nullptr, &context));
+    }
+
+    ~app() {
+        urContextRelease(context);
+        urDeviceRelease(device);
+        urAdapterRelease(adapter);
+        urLoaderTearDown();
+        urLoaderConfigRelease(config);
+    }
+
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage =
+            R"(usage: %s [-h] [--csv] [--trace FILE] [--pattern NAME]
+          [--config CONFIG] [--memtype TYPE] [--ops N] [--live N]
+          [--max-size SIZE] [--page-size SIZE] [--seed N]
+
+Replays USM allocations through the disjoint pools of each config and reports
+the throughput, the peak footprint and the fragmentation at that peak.
+
+options:
+  -h, --help        show this help message and exit
+  --csv             print name,value rows of the results
+  --trace FILE      replay the USM allocations of urtrace --json output
+  --pattern NAME    replay a synthetic pattern, power-law or bursts, both by
+                    default when no trace is given
+  --config CONFIG   pool config, as UR_L0_USM_ALLOCATOR takes, e.g.
+                    "1;32M;device:1M,4,64K", the built-in defaults by default
+  --memtype TYPE    host, device or shared memory of the patterns, default
+                    device
+  --ops N           allocations and frees of the patterns, default 1000000
+  --live N          allocations the patterns keep live, default 1000
+  --max-size SIZE   largest allocation of the patterns, default 16M
+  --page-size SIZE  granularity of the emulated device memory, default 64K
+  --seed N          seed of the patterns, default 1
+
+--trace, --pattern and --config may be repeated. Traces are replayed from a
+single thread, in the order the calls returned.
+)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string arg = argv[argi];
+            bool hasValue = argi + 1 < argc;
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "--csv") {
+                csv = true;
+            } else if (arg == "--trace" && hasValue) {
+                tracePaths.push_back(argv[++argi]);
+            } else if (arg == "--pattern" && hasValue) {
+                patterns.push_back(argv[++argi]);
+            } else if (arg == "--config" && hasValue) {
+                configs.push_back(argv[++argi]);
+            } else if (arg == "--memtype" && hasValue) {
+                std::string type = argv[++argi];
+                memType = type == "host"     ? UR_USM_TYPE_HOST
+                          : type == "shared" ? UR_USM_TYPE_SHARED
+                                             : UR_USM_TYPE_DEVICE;
+            } else if (arg == "--ops" && hasValue) {
+                ops = std::strtoull(argv[++argi], nullptr, 10);
+            } else if (arg == "--live" && hasValue) {
+                live = std::max<size_t>(1, std::atoi(argv[++argi]));
+            } else if (arg == "--max-size" && hasValue) {
+                maxSize = std::max(power_law_sizes::minSize,
+                                   parseSize(argv[++argi]));
+            } else if (arg == "--page-size" && hasValue) {
+                pageSize = std::max<size_t>(1, parseSize(argv[++argi]));
+            } else if (arg == "--seed" && hasValue) {
+                seed = std::strtoull(argv[++argi], nullptr, 10);
+            } else {
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+        if (configs.empty()) {
+            configs.push_back("");
+        }
+        if (tracePaths.empty() && patterns.empty()) {
+            patterns = {"power-law", "bursts"};
+        }
+    }
+
+    std::vector<trace_t> loadTraces() {
+        std::vector<trace_t> traces;
+        for (auto &path : tracePaths) {
+            traces.push_back(loadTrace(path));
+        }
+        for (auto &pattern : patterns) {
+            if (pattern == "power-law") {
+                traces.push_back(
+                    powerLawTrace(ops, live, memType, maxSize, seed));
+            } else if (pattern == "bursts") {
+                traces.push_back(
+                    burstsTrace(ops, live, memType, maxSize, seed));
+            } else {
+                std::fprintf(stderr, "error: unknown pattern %s\n",
+                             pattern.c_str());
+                std::exit(1);
+            }
+        }
+        return traces;
+    }
+
+    // The pools an adapter creates for the context, as the Level Zero
+    // adapter does for a USM pool
+    usm::pool_manager<usm::pool_descriptor>
+    makePoolManager(const std::string &poolConfig, footprint_t &footprint,
+                    umf::pool_stats_t &stats) {
+        auto poolConfigs = usm::parseDisjointPoolConfig(poolConfig, 0);
+        auto [ret, descriptors] = usm::pool_descriptor::create(nullptr, context);
+        UR_CHECK(ret);
+        auto [managerRet, manager] =
+            usm::pool_manager<usm::pool_descriptor>::create();
+        UR_CHECK(managerRet);
+        for (auto &desc : descriptors) {
+            auto [providerRet, provider] =
+                umf::memoryProviderMakeUnique<host_provider>(&footprint,
+                                                             pageSize);
+            UR_CHECK(providerRet);
+            auto [poolRet, pool] = poolConfigs.makePool(
+                std::move(provider), getMemType(desc), &stats);
+            UR_CHECK(poolRet);
+            UR_CHECK(manager.addPool(desc, std::move(pool)));
+        }
+        return std::move(manager);
+    }
+
+    replay_result replay(const trace_t &trace, const std::string &poolConfig) {
+        footprint_t footprint;
+        umf::pool_stats_t stats;
+        auto manager = makePoolManager(poolConfig, footprint, stats);
+        // Pooling may reserve memory up front
+        size_t peakFootprint = footprint.reserved;
+        size_t used = 0;
+        size_t peakUsed = 0;
+        size_t usedAtPeak = 0;
+
+        std::vector<void *> slots(trace.numSlots, nullptr);
+        auto start = std::chrono::steady_clock::now();
+        for (auto &op : trace.ops) {
+            if (op.isAlloc) {
+                auto pool = manager.getPool(usm::pool_descriptor{
+                    nullptr, context,
+                    op.type == UR_USM_TYPE_HOST ? nullptr : device, op.type,
+                    false});
+                if (!pool) {
+                    std::exit(1);
+                }
+                slots[op.slot] = umfPoolAlignedMalloc(*pool, op.size, 0);
+                if (!slots[op.slot] && op.size) {
+                    std::fprintf(stderr,
+                                 "error: allocation of %zu bytes failed\n",
+                                 op.size);
+                    std::exit(1);
+                }
+                used += op.size;
+                peakUsed = std::max(peakUsed, used);
+            } else {
+                UR_CHECK(umfFree(slots[op.slot]));
+                used -= op.size;
+            }
+            if (footprint.reserved > peakFootprint ||
+                (footprint.reserved == peakFootprint && used > usedAtPeak)) {
+                peakFootprint = footprint.reserved;
+                usedAtPeak = used;
+            }
+        }
+        std::chrono::duration<double> elapsed =
+            std::chrono::steady_clock::now() - start;
+
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        for (size_t i = 0; i < umf::pool_stats_t::NumBuckets; i++) {
+            hits += stats.BucketHits[i].load();
+            misses += stats.BucketMisses[i].load();
+        }
+        return {
+            trace.ops.size() / elapsed.count(),
+            peakFootprint,
+            peakUsed,
+            peakFootprint ? 1 - double(usedAtPeak) / peakFootprint : 0,
+            footprint.allocations,
+            hits + misses ? double(hits) / (hits + misses) : 0,
+        };
+    }
+
+    int run() {
+        if (csv) {
+            std::printf("name,value\n");
+        }
+        for (auto &trace : loadTraces()) {
+            if (!csv) {
+                std::printf("%s: %zu ops\n", trace.name.c_str(),
+                            trace.ops.size());
+            }
+            for (auto &poolConfig : configs) {
+                auto result = replay(trace, poolConfig);
+                auto name = trace.name + " " +
+                            (poolConfig.empty() ? "default" : poolConfig);
+                if (csv) {
+                    // Configs hold commas, the names are quoted
+                    std::printf("\"%s throughput\",%.3f\n", name.c_str(),
+                                result.opsPerSecond / 1e6);
+                    std::printf("\"%s footprint\",%.3f\n", name.c_str(),
+                                result.peakFootprint / double(1 << 20));
+                    std::printf("\"%s fragmentation\",%.3f\n", name.c_str(),
+                                result.fragmentation * 100);
+                    std::printf("\"%s provider allocations\",%llu\n",
+                                name.c_str(),
+                                (unsigned long long)result.providerAllocations);
+                } else {
+                    std::printf(
+                        "  %-32s %9.3f Mops/s, peak %9.3f MB for %9.3f MB "
+                        "used, %5.1f%% fragmentation, %llu provider "
+                        "allocations, %5.1f%% hits\n",
+                        poolConfig.empty() ? "default" : poolConfig.c_str(),
+                        result.opsPerSecond / 1e6,
+                        result.peakFootprint / double(1 << 20),
+                        result.peakUsed / double(1 << 20),
+                        result.fragmentation * 100,
+                        (unsigned long long)result.providerAllocations,
+                        result.hitRate * 100);
+                }
+                std::fflush(stdout);
+            }
+        }
+        return 0;
+    }
+};
+
+} // namespace
+
+int main(int argc, const char **argv) {
+    app bench(argc, argv);
+    return bench.run();
+}
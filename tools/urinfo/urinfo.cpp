@@ -4,7 +4,9 @@
 // SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
 
 #include "urinfo.hpp"
+#include <chrono>
 #include <cstdlib>
+#include <iomanip>
 #include <iostream>
 #include <string>
 #include <string_view>
@@ -16,12 +18,16 @@ struct app {
     bool verbose = false;
     bool linear_ids = true;
     bool ignore_device_selector = false;
+    bool timing = false;
     ur_loader_config_handle_t loaderConfig = nullptr;
     std::vector<ur_adapter_handle_t> adapters;
     std::unordered_map<ur_adapter_handle_t, std::vector<ur_platform_handle_t>>
         adapterPlatformsMap;
     std::unordered_map<ur_platform_handle_t, std::vector<ur_device_handle_t>>
         platformDevicesMap;
+    // How long each step of the startup took, in the order they ran
+    std::vector<std::pair<std::string, std::chrono::steady_clock::duration>>
+        timings;
 
     app(int argc, const char **argv) {
         parseArgs(argc, argv);
@@ -35,13 +41,31 @@ struct app {
                              device_selector);
             }
         }
+        if (timing && !std::getenv("UR_LOG_LOADER")) {
+            // The loader logs the durations of its startup phases at info
+            // level.
+#ifdef _WIN32
+            _putenv_s("UR_LOG_LOADER", "level:info;output:stdout");
+#else
+            setenv("UR_LOG_LOADER", "level:info;output:stdout", 0);
+#endif
+        }
         UR_CHECK(urLoaderConfigCreate(&loaderConfig));
         UR_CHECK(urLoaderConfigEnableLayer(loaderConfig,
                                            "UR_LAYER_FULL_VALIDATION"));
-        UR_CHECK(urLoaderInit(0, loaderConfig));
+        UR_CHECK(timed("urLoaderInit",
+                       [&]() { return urLoaderInit(0, loaderConfig); }));
         enumerateDevices();
     }
 
+    template <class F> ur_result_t timed(std::string step, F &&action) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = action();
+        timings.emplace_back(std::move(step),
+                             std::chrono::steady_clock::now() - start);
+        return result;
+    }
+
     void parseArgs(int argc, const char **argv) {
         static const char *usage = R"(usage: %s [-h] [-v] [-V]
 
@@ -56,6 +80,9 @@ options:
   --ignore-device-selector
                         do not use ONEAPI_DEVICE_SELECTOR to filter list of
                         devices
+  --timing              print how long each step of the startup took, per
+                        adapter and per device, along with the phases of the
+                        loader unless UR_LOG_LOADER is set
 )";
         for (int argi = 1; argi < argc; argi++) {
             std::string_view arg{argv[argi]};
@@ -71,6 +98,8 @@ options:
                 linear_ids = false;
             } else if (arg == "--ignore-device-selector") {
                 ignore_device_selector = true;
+            } else if (arg == "--timing") {
+                timing = true;
             } else {
                 std::fprintf(stderr, "error: invalid argument: %s\n",
                              argv[argi]);
@@ -88,7 +117,9 @@ options:
             std::exit(0);
         }
         adapters.resize(numAdapters);
-        UR_CHECK(urAdapterGet(numAdapters, adapters.data(), nullptr));
+        UR_CHECK(timed("urAdapterGet", [&]() {
+            return urAdapterGet(numAdapters, adapters.data(), nullptr);
+        }));
 
         auto urDeviceGetFn =
             ignore_device_selector ? urDeviceGet : urDeviceGetSelected;
@@ -97,8 +128,15 @@ options:
              adapterIndex++) {
             auto adapter = adapters[adapterIndex];
             // Enumerate platforms
+            // The first platform query initializes the adapter's driver
             uint32_t numPlatforms = 0;
-            UR_CHECK(urPlatformGet(&adapter, 1, 0, nullptr, &numPlatforms));
+            UR_CHECK(timed("[adapter(" + std::to_string(adapterIndex) + "," +
+                               urinfo::getAdapterBackend(adapter) +
+                               ")] urPlatformGet",
+                           [&]() {
+                               return urPlatformGet(&adapter, 1, 0, nullptr,
+                                                    &numPlatforms);
+                           }));
             if (numPlatforms == 0) {
                 continue;
             }
@@ -112,8 +150,15 @@ options:
                 auto platform = adapterPlatformsMap[adapter][platformIndex];
                 // Enumerate devices
                 uint32_t numDevices = 0;
-                UR_CHECK(urDeviceGetFn(platform, UR_DEVICE_TYPE_ALL, 0, nullptr,
-                                       &numDevices));
+                UR_CHECK(timed("[adapter(" + std::to_string(adapterIndex) +
+                                   "),platform(" +
+                                   std::to_string(platformIndex) +
+                                   ")] urDeviceGet",
+                               [&]() {
+                                   return urDeviceGetFn(platform,
+                                                        UR_DEVICE_TYPE_ALL, 0,
+                                                        nullptr, &numDevices);
+                               }));
                 if (numDevices == 0) {
                     continue;
                 }
@@ -204,6 +249,42 @@ options:
         }
     }
 
+    void printTiming() {
+        // Creating a context is the first thing done with a device, and
+        // where some adapters initialize it.
+        for (size_t adapterIndex = 0; adapterIndex < adapters.size();
+             adapterIndex++) {
+            auto &platforms = adapterPlatformsMap[adapters[adapterIndex]];
+            for (size_t platformIndex = 0; platformIndex < platforms.size();
+                 platformIndex++) {
+                auto &devices = platformDevicesMap[platforms[platformIndex]];
+                for (size_t deviceIndex = 0; deviceIndex < devices.size();
+                     deviceIndex++) {
+                    ur_context_handle_t context = nullptr;
+                    auto step = "[adapter(" + std::to_string(adapterIndex) +
+                                "),platform(" + std::to_string(platformIndex) +
+                                "),device(" + std::to_string(deviceIndex) +
+                                ")] urContextCreate";
+                    if (timed(step, [&]() {
+                            return urContextCreate(1, &devices[deviceIndex],
+                                                   nullptr, &context);
+                        }) == UR_RESULT_SUCCESS) {
+                        urContextRelease(context);
+                    }
+                }
+            }
+        }
+
+        std::cout << "\n"
+                  << "[timing]:"
+                  << "\n";
+        for (auto &[step, duration] : timings) {
+            auto ms = std::chrono::duration<double, std::milli>(duration);
+            std::cout << "  " << step << ": " << std::fixed
+                      << std::setprecision(3) << ms.count() << " ms\n";
+        }
+    }
+
     ~app() {
         urLoaderConfigRelease(loaderConfig);
         urLoaderTearDown();
@@ -217,5 +298,8 @@ int main(int argc, const char **argv) {
     if (app.verbose) {
         app.printDetail();
     }
+    if (app.timing) {
+        app.printTiming();
+    }
     return 0;
 }
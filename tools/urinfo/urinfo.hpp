@@ -416,5 +416,15 @@ inline void printDeviceInfos(ur_device_handle_t hDevice,
     std::cout << prefix;
     printDeviceInfo<ur_bool_t>(
         hDevice, UR_DEVICE_INFO_ENQUEUE_NATIVE_COMMAND_SUPPORT_EXP);
+    std::cout << prefix;
+    printDeviceInfo<uint32_t>(hDevice, UR_DEVICE_INFO_HOST_NUMA_NODE_EXP);
+    std::cout << prefix;
+    printDeviceInfo<ur_bool_t>(hDevice,
+                               UR_DEVICE_INFO_ENQUEUE_HOST_TASK_SUPPORT_EXP);
+    std::cout << prefix;
+    printDeviceInfo<ur_bool_t>(hDevice, UR_DEVICE_INFO_IPC_EVENT_SUPPORT_EXP);
+    std::cout << prefix;
+    printDeviceInfo<ur_bool_t>(hDevice,
+                               UR_DEVICE_INFO_USM_ZERO_INIT_SUPPORT_EXP);
 }
 } // namespace urinfo
@@ -0,0 +1,261 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file capture.cpp
+ *
+ * The set of replayable functions covers the objects a workload creates and
+ * the commands it enqueues on them. Each case below has its counterpart in
+ * urreplay.cpp, which reads the arguments back in the same order.
+ */
+
+#include <algorithm>
+
+#include "capture.hpp"
+#include "trace_format.hpp"
+#include "ur_api.h"
+
+namespace {
+// Number of handles an enumeration wrote to an array of num_entries
+uint32_t enumerated(uint32_t num_entries, const uint32_t *p_num) {
+    return p_num ? std::min(num_entries, *p_num) : num_entries;
+}
+
+void wait_list(arg_writer &w, uint32_t num_events,
+               const ur_event_handle_t *events, ur_event_handle_t *p_event) {
+    w.handles(num_events, events);
+    w.out(p_event);
+}
+} // namespace
+
+bool capture_args(uint32_t function_id, const void *params, bool with_data,
+                  std::vector<char> &args) {
+    arg_writer w(args);
+    switch (static_cast<ur_function_t>(function_id)) {
+    case UR_FUNCTION_ADAPTER_GET: {
+        auto p = static_cast<const ur_adapter_get_params_t *>(params);
+        w.u32(*p->pNumEntries);
+        w.handles(enumerated(*p->pNumEntries, *p->ppNumAdapters),
+                  *p->pphAdapters);
+    } break;
+    case UR_FUNCTION_PLATFORM_GET: {
+        auto p = static_cast<const ur_platform_get_params_t *>(params);
+        w.handles(*p->pNumAdapters, *p->pphAdapters);
+        w.u32(*p->pNumEntries);
+        w.handles(enumerated(*p->pNumEntries, *p->ppNumPlatforms),
+                  *p->pphPlatforms);
+    } break;
+    case UR_FUNCTION_DEVICE_GET: {
+        auto p = static_cast<const ur_device_get_params_t *>(params);
+        w.handle(*p->phPlatform);
+        w.u32(*p->pDeviceType);
+        w.u32(*p->pNumEntries);
+        w.handles(enumerated(*p->pNumEntries, *p->ppNumDevices),
+                  *p->pphDevices);
+    } break;
+    case UR_FUNCTION_CONTEXT_CREATE: {
+        auto p = static_cast<const ur_context_create_params_t *>(params);
+        w.handles(*p->pDeviceCount, *p->pphDevices);
+        w.out(*p->pphContext);
+    } break;
+    case UR_FUNCTION_QUEUE_CREATE: {
+        auto p = static_cast<const ur_queue_create_params_t *>(params);
+        w.handle(*p->phContext);
+        w.handle(*p->phDevice);
+        w.u32(*p->ppProperties ? (*p->ppProperties)->flags : 0);
+        w.out(*p->pphQueue);
+    } break;
+    case UR_FUNCTION_CONTEXT_RELEASE:
+    case UR_FUNCTION_QUEUE_FINISH:
+    case UR_FUNCTION_QUEUE_FLUSH:
+    case UR_FUNCTION_QUEUE_RELEASE:
+    case UR_FUNCTION_MEM_RELEASE:
+    case UR_FUNCTION_PROGRAM_RELEASE:
+    case UR_FUNCTION_KERNEL_RELEASE:
+    case UR_FUNCTION_EVENT_RELEASE: {
+        // The single parameter of all of these is the handle
+        w.handle(**static_cast<void *const *const *>(params));
+    } break;
+    case UR_FUNCTION_USM_HOST_ALLOC: {
+        auto p = static_cast<const ur_usm_host_alloc_params_t *>(params);
+        w.handle(*p->phContext);
+        w.u64(*p->psize);
+        w.u32(*p->ppUSMDesc ? (*p->ppUSMDesc)->align : 0);
+        w.out(*p->pppMem);
+    } break;
+    case UR_FUNCTION_USM_DEVICE_ALLOC:
+    case UR_FUNCTION_USM_SHARED_ALLOC: {
+        // Both take the same parameters
+        auto p = static_cast<const ur_usm_device_alloc_params_t *>(params);
+        w.handle(*p->phContext);
+        w.handle(*p->phDevice);
+        w.u64(*p->psize);
+        w.u32(*p->ppUSMDesc ? (*p->ppUSMDesc)->align : 0);
+        w.out(*p->pppMem);
+    } break;
+    case UR_FUNCTION_USM_FREE: {
+        auto p = static_cast<const ur_usm_free_params_t *>(params);
+        w.handle(*p->phContext);
+        w.ptr(*p->ppMem);
+    } break;
+    case UR_FUNCTION_MEM_BUFFER_CREATE: {
+        auto p = static_cast<const ur_mem_buffer_create_params_t *>(params);
+        w.handle(*p->phContext);
+        w.u32(*p->pflags);
+        const void *host = *p->ppProperties ? (*p->ppProperties)->pHost
+                                            : nullptr;
+        w.bytes(host, host ? *p->psize : 0, with_data);
+        w.u64(*p->psize);
+        w.out(*p->pphBuffer);
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+        auto p = static_cast<const ur_enqueue_mem_buffer_write_params_t *>(
+            params);
+        w.handle(*p->phQueue);
+        w.handle(*p->phBuffer);
+        w.u8(*p->pblockingWrite);
+        w.u64(*p->poffset);
+        w.bytes(*p->ppSrc, *p->psize, with_data);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+        auto p =
+            static_cast<const ur_enqueue_mem_buffer_read_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.handle(*p->phBuffer);
+        w.u8(*p->pblockingRead);
+        w.u64(*p->poffset);
+        w.u64(*p->psize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+        auto p =
+            static_cast<const ur_enqueue_mem_buffer_copy_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.handle(*p->phBufferSrc);
+        w.handle(*p->phBufferDst);
+        w.u64(*p->psrcOffset);
+        w.u64(*p->pdstOffset);
+        w.u64(*p->psize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+        auto p =
+            static_cast<const ur_enqueue_mem_buffer_fill_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.handle(*p->phBuffer);
+        w.bytes(*p->ppPattern, *p->ppatternSize);
+        w.u64(*p->poffset);
+        w.u64(*p->psize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+        // The source may be device memory, whose contents the host can't read
+        auto p = static_cast<const ur_enqueue_usm_memcpy_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.u8(*p->pblocking);
+        w.ptr(*p->ppDst);
+        w.ptr(*p->ppSrc);
+        w.u64(*p->psize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_ENQUEUE_USM_FILL: {
+        auto p = static_cast<const ur_enqueue_usm_fill_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.ptr(*p->ppMem);
+        w.bytes(*p->ppPattern, *p->ppatternSize);
+        w.u64(*p->psize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+        auto p =
+            static_cast<const ur_program_create_with_il_params_t *>(params);
+        w.handle(*p->phContext);
+        w.bytes(*p->ppIL, *p->plength);
+        w.out(*p->pphProgram);
+    } break;
+    case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+        auto p = static_cast<const ur_program_create_with_binary_params_t *>(
+            params);
+        w.handle(*p->phContext);
+        w.handle(*p->phDevice);
+        w.bytes(*p->ppBinary, *p->psize);
+        w.out(*p->pphProgram);
+    } break;
+    case UR_FUNCTION_PROGRAM_BUILD: {
+        auto p = static_cast<const ur_program_build_params_t *>(params);
+        w.handle(*p->phContext);
+        w.handle(*p->phProgram);
+        w.string(*p->ppOptions);
+    } break;
+    case UR_FUNCTION_KERNEL_CREATE: {
+        auto p = static_cast<const ur_kernel_create_params_t *>(params);
+        w.handle(*p->phProgram);
+        w.string(*p->ppKernelName);
+        w.out(*p->pphKernel);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+        // Pointers stored in the value aren't mapped
+        auto p = static_cast<const ur_kernel_set_arg_value_params_t *>(params);
+        w.handle(*p->phKernel);
+        w.u32(*p->pargIndex);
+        w.bytes(*p->ppArgValue, *p->pargSize);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+        auto p = static_cast<const ur_kernel_set_arg_local_params_t *>(params);
+        w.handle(*p->phKernel);
+        w.u32(*p->pargIndex);
+        w.u64(*p->pargSize);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+        auto p =
+            static_cast<const ur_kernel_set_arg_pointer_params_t *>(params);
+        w.handle(*p->phKernel);
+        w.u32(*p->pargIndex);
+        w.ptr(*p->ppArgValue);
+    } break;
+    case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+        auto p =
+            static_cast<const ur_kernel_set_arg_mem_obj_params_t *>(params);
+        w.handle(*p->phKernel);
+        w.u32(*p->pargIndex);
+        w.u32(*p->ppProperties ? (*p->ppProperties)->memoryAccess : 0);
+        w.handle(*p->phArgValue);
+    } break;
+    case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+        auto p = static_cast<const ur_enqueue_kernel_launch_params_t *>(params);
+        w.handle(*p->phQueue);
+        w.handle(*p->phKernel);
+        w.u32(*p->pworkDim);
+        w.sizes(*p->pworkDim, *p->ppGlobalWorkOffset);
+        w.sizes(*p->pworkDim, *p->ppGlobalWorkSize);
+        w.sizes(*p->pworkDim, *p->ppLocalWorkSize);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    case UR_FUNCTION_EVENT_WAIT: {
+        auto p = static_cast<const ur_event_wait_params_t *>(params);
+        w.handles(*p->pnumEvents, *p->pphEventWaitList);
+    } break;
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+    case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+        // Both take the same parameters
+        auto p = static_cast<const ur_enqueue_events_wait_params_t *>(params);
+        w.handle(*p->phQueue);
+        wait_list(w, *p->pnumEventsInWaitList, *p->pphEventWaitList,
+                  *p->pphEvent);
+    } break;
+    default:
+        return false;
+    }
+    return true;
+}
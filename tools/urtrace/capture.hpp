@@ -0,0 +1,26 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file capture.hpp
+ *
+ * Recording of the arguments of the calls `urreplay` can replay.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+/*
+ * Appends the arguments of a finished call of function_id, whose parameters
+ * params points to, to args. Returns false, appending nothing, if the
+ * function can't be replayed. The contents of host memory read by the
+ * device, such as the source of a buffer write, are only recorded if
+ * with_data is set; programs, patterns and argument values always are.
+ */
+bool capture_args(uint32_t function_id, const void *params, bool with_data,
+                  std::vector<char> &args);
@@ -12,21 +12,35 @@
  * execution time.
  */
 
+#include <algorithm>
 #include <cassert>
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <functional>
+#include <iomanip>
+#include <iterator>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <optional>
 #include <regex>
 #include <sstream>
-#include <stack>
 #include <stdexcept>
 #include <string>
 #include <string_view>
 #include <thread>
+#include <tuple>
+#include <unordered_map>
 #include <vector>
 
+#include "adapters/level_zero/tracing.hpp"
+#include "capture.hpp"
+#include "latency_tracker.hpp"
 #include "logger/ur_logger.hpp"
+#include "trace_format.hpp"
 #include "ur_api.h"
 #include "ur_print.hpp"
 #include "ur_util.hpp"
@@ -37,6 +51,11 @@ constexpr uint16_t TRACE_FN_BEGIN =
 constexpr uint16_t TRACE_FN_END =
     static_cast<uint16_t>(xpti::trace_point_type_t::function_with_args_end);
 constexpr std::string_view UR_STREAM_NAME = "ur.call";
+constexpr uint16_t TRACE_SIGNAL =
+    static_cast<uint16_t>(xpti::trace_point_type_t::signal);
+// Device activity of the Level Zero adapter, see l0_activity_record_t
+constexpr std::string_view L0_ACTIVITY_STREAM_NAME =
+    "sycl.experimental.level_zero.activity";
 
 static logger::Logger out = logger::create_logger("collector", true);
 
@@ -96,10 +115,13 @@ std::string time_to_str(std::chrono::nanoseconds dur, enum time_unit unit) {
 enum output_format {
     OUTPUT_HUMAN_READABLE,
     OUTPUT_JSON,
+    OUTPUT_BINARY,
+    OUTPUT_SUMMARY,
     MAX_OUTPUT_FORMAT,
 };
 
-const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
+const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json",
+                                                    "binary", "summary"};
 
 /*
  * Since this is a library that gets loaded alongside the traced program, it
@@ -113,6 +135,10 @@ const char *output_format_str[MAX_OUTPUT_FORMAT] = {"human readable", "json"};
  * - "time_unit:<auto,ns, ...>"
  * - "filter:<regex>"
  * - "json"
+ * - "binary:<path>"
+ * - "capture:<path>"
+ * - "capture_data"
+ * - "summary"
  */
 static class cli_args {
     std::optional<std::string>
@@ -134,6 +160,8 @@ static class cli_args {
         profiling = false;
         time_unit = TIME_UNIT_AUTO;
         no_args = false;
+        capture = false;
+        capture_data = false;
         filter = std::nullopt;
         filter_str = std::nullopt;
         output_format = OUTPUT_HUMAN_READABLE;
@@ -143,10 +171,14 @@ static class cli_args {
                     print_begin = true;
                 } else if (arg_name == "json") {
                     output_format = OUTPUT_JSON;
+                } else if (arg_name == "summary") {
+                    output_format = OUTPUT_SUMMARY;
                 } else if (arg_name == "profiling") {
                     profiling = true;
                 } else if (arg_name == "no_args") {
                     no_args = true;
+                } else if (arg_name == "capture_data") {
+                    capture_data = true;
                 } else if (auto unit = arg_with_value("time_unit", arg_name,
                                                       arg_values)) {
                     for (int i = 0; i < MAX_TIME_UNIT; ++i) {
@@ -155,6 +187,15 @@ static class cli_args {
                             break;
                         }
                     }
+                } else if (auto path = arg_with_value("binary", arg_name,
+                                                      arg_values)) {
+                    output_format = OUTPUT_BINARY;
+                    binary_path = *path;
+                } else if (auto path = arg_with_value("capture", arg_name,
+                                                      arg_values)) {
+                    output_format = OUTPUT_BINARY;
+                    binary_path = *path;
+                    capture = true;
                 } else if (auto filter_str =
                                arg_with_value("filter", arg_name, arg_values)) {
                     try {
@@ -179,7 +220,10 @@ static class cli_args {
     bool print_begin;
     bool profiling;
     bool no_args;
+    bool capture;
+    bool capture_data;
     enum output_format output_format;
+    std::string binary_path;
     std::optional<std::string>
         filter_str; //the filter_str is kept primarily for printing.
     std::optional<std::regex> filter;
@@ -193,20 +237,29 @@ class TraceWriter {
     virtual ~TraceWriter() {}
     virtual void prologue() {}
     virtual void epilogue() {}
-    virtual void begin(uint64_t id, const char *fname, std::string args) = 0;
-    virtual void end(uint64_t id, const char *fname, std::string args,
-                     Timepoint tp, Timepoint start_tp,
-                     const ur_result_t *resultp) = 0;
+    // Writers that don't print arguments let the callback skip formatting them.
+    virtual bool needs_args() const { return true; }
+    virtual void begin(uint64_t id, const char *fname,
+                       std::string_view args) = 0;
+    // params points to the parameters of the call, null when the tracing
+    // layer doesn't pass them.
+    virtual void end(uint64_t id, uint32_t function_id, const char *fname,
+                     std::string_view args, const void *params, Timepoint tp,
+                     Timepoint start_tp, const ur_result_t *resultp) = 0;
+    // Called from any thread, some time after the command completed.
+    virtual void activity(const l0_activity_record_t &) {}
 };
 
 class HumanReadable : public TraceWriter {
-    void begin(uint64_t id, const char *fname, std::string args) override {
+    void begin(uint64_t id, const char *fname,
+               std::string_view args) override {
         if (cli_args.print_begin) {
             out.info("begin({}) - {}({});", id, fname, args);
         }
     }
-    void end(uint64_t id, const char *fname, std::string args, Timepoint tp,
-             Timepoint start_tp, const ur_result_t *resultp) override {
+    void end(uint64_t id, uint32_t, const char *fname, std::string_view args,
+             const void *, Timepoint tp, Timepoint start_tp,
+             const ur_result_t *resultp) override {
         std::ostringstream prefix_str;
         if (cli_args.print_begin) {
             prefix_str << "end(" << id << ") - ";
@@ -245,10 +298,11 @@ class JsonWriter : public TraceWriter {
             "\"tid\": \"\", \"ts\": \"\"}}");
         out.info("]\n}}");
     }
-    void begin(uint64_t, const char *, std::string) override {}
+    void begin(uint64_t, const char *, std::string_view) override {}
 
-    void end(uint64_t, const char *fname, std::string args, Timepoint tp,
-             Timepoint start_tp, const ur_result_t *) override {
+    void end(uint64_t, uint32_t, const char *fname, std::string_view args,
+             const void *, Timepoint tp, Timepoint start_tp,
+             const ur_result_t *) override {
         auto dur = tp - start_tp;
         auto ts_us = std::chrono::duration_cast<std::chrono::microseconds>(
                          tp.time_since_epoch())
@@ -268,6 +322,380 @@ class JsonWriter : public TraceWriter {
                  ur_getpid(), std::this_thread::get_id(), ts_us, dur_us, fname,
                  args);
     }
+
+    // Commands run on a track per device engine, linked by a flow arrow to
+    // the call which enqueued them.
+    void activity(const l0_activity_record_t &record) override {
+        auto us = [](uint64_t ns) { return ns / 1000.0; };
+        auto track = engine_track(record);
+        auto flow = ++flows;
+        std::ostringstream name;
+        if (record.Name) {
+            name << record.Name;
+        } else {
+            name << record.Command;
+        }
+        out.info("{{\
+            \"cat\": \"device\", \
+            \"ph\": \"X\",\
+            \"pid\": {},\
+            \"tid\": {},\
+            \"ts\": {:.3f},\
+            \"dur\": {:.3f},\
+            \"name\": \"{}\",\
+            \"args\": {{\"queued_us\": {:.3f}}}\
+        }},",
+                 ur_getpid(), track, us(record.Start),
+                 us(record.End - record.Start), name.str(),
+                 us(record.Start - std::min(record.Start, record.Submit)));
+        out.info("{{\"cat\": \"device\", \"ph\": \"s\", \"id\": {}, "
+                 "\"pid\": {}, \"tid\": {}, \"ts\": {:.3f}, "
+                 "\"name\": \"submit\"}},",
+                 flow, ur_getpid(), record.Thread, us(record.Submit));
+        out.info("{{\"cat\": \"device\", \"ph\": \"f\", \"bp\": \"e\", "
+                 "\"id\": {}, \"pid\": {}, \"tid\": {}, \"ts\": {:.3f}, "
+                 "\"name\": \"submit\"}},",
+                 flow, ur_getpid(), track, us(record.Start));
+    }
+
+  private:
+    // Tracks are numbered from 1, far below the host thread ids
+    uint64_t engine_track(const l0_activity_record_t &record) {
+        std::lock_guard<std::mutex> lock(tracks_mutex);
+        auto key = std::make_tuple(record.Device, record.Ordinal, record.Index);
+        auto [it, inserted] = tracks.try_emplace(key, tracks.size() + 1);
+        if (inserted) {
+            out.info("{{\"name\": \"thread_name\", \"ph\": \"M\", "
+                     "\"pid\": {}, \"tid\": {}, \"args\": {{\"name\": "
+                     "\"{} {} engine {}.{}\"}}}},",
+                     ur_getpid(), it->second, record.DeviceName,
+                     record.Engine == l0_activity_record_t::Copy ? "copy"
+                                                                 : "compute",
+                     record.Ordinal, record.Index);
+        }
+        return it->second;
+    }
+
+    std::mutex tracks_mutex;
+    std::map<std::tuple<ur_device_handle_t, uint32_t, uint32_t>, uint64_t>
+        tracks;
+    std::atomic<uint64_t> flows{0};
+};
+
+/*
+ * Compact binary trace, decoded offline by `urtrace --decode`, whose layout
+ * is described in trace_format.hpp. With capture set, the arguments of the
+ * successful calls of the functions urreplay supports are recorded too.
+ */
+class BinaryWriter : public TraceWriter {
+    static constexpr size_t BUFFER_SIZE = 64 * 1024;
+    static constexpr size_t MAX_FUNCTION_ID = 1024;
+
+    // The file is shared with the threads' buffers, as threads may exit
+    // after the writer was destroyed at exit. Their records are dropped once
+    // the file is closed.
+    struct output_t {
+        std::string path;
+        FILE *file = nullptr;
+        std::mutex mutex;
+
+        void flush(std::vector<char> &data) {
+            if (data.empty()) {
+                return;
+            }
+            std::scoped_lock<std::mutex> lock(mutex);
+            if (file &&
+                fwrite(data.data(), 1, data.size(), file) != data.size()) {
+                out.error("failed to write binary trace to {}", path);
+            }
+            data.clear();
+        }
+
+        void close() {
+            std::scoped_lock<std::mutex> lock(mutex);
+            if (file) {
+                fclose(file);
+                file = nullptr;
+            }
+        }
+    };
+
+    struct thread_buffer {
+        std::shared_ptr<output_t> output;
+        std::vector<char> data;
+        // Arguments of the call being recorded
+        std::vector<char> args;
+
+        explicit thread_buffer(std::shared_ptr<output_t> output)
+            : output(std::move(output)) {
+            data.reserve(BUFFER_SIZE);
+        }
+        ~thread_buffer() { output->flush(data); }
+    };
+
+    thread_buffer &local_buffer() {
+        static thread_local thread_buffer buffer(output);
+        return buffer;
+    }
+
+    template <typename T> static void append(std::vector<char> &data, T &v) {
+        auto *bytes = reinterpret_cast<const char *>(&v);
+        data.insert(data.end(), bytes, bytes + sizeof(T));
+    }
+
+    void append_args(thread_buffer &buffer, uint32_t function_id,
+                     const void *params) {
+        if (params == nullptr) {
+            if (!warned_no_params.exchange(true, std::memory_order_relaxed)) {
+                out.warn("the buffered tracing layer passes no arguments, "
+                         "nothing can be captured");
+            }
+            return;
+        }
+        buffer.args.clear();
+        if (!capture_args(function_id, params, cli_args.capture_data,
+                          buffer.args)) {
+            return;
+        }
+        // A chunk shorter than the maximum ends the arguments
+        size_t offset = 0;
+        while (true) {
+            auto len = std::min(buffer.args.size() - offset, MAX_RECORD_SIZE);
+            binary_record_header header{
+                RECORD_ARGS, static_cast<uint16_t>(len), function_id};
+            append(buffer.data, header);
+            buffer.data.insert(buffer.data.end(),
+                               buffer.args.begin() + offset,
+                               buffer.args.begin() + offset + len);
+            offset += len;
+            if (len < MAX_RECORD_SIZE) {
+                break;
+            }
+        }
+    }
+
+    std::shared_ptr<output_t> output = std::make_shared<output_t>();
+    std::array<std::atomic<bool>, MAX_FUNCTION_ID> names_written{};
+    std::atomic<bool> warned_no_params{false};
+
+  public:
+    explicit BinaryWriter(std::string path) {
+        output->path = std::move(path);
+        output->file = fopen(output->path.c_str(), "wb");
+        if (output->file == nullptr) {
+            out.error("unable to open binary trace file {}", output->path);
+            return;
+        }
+        binary_file_header header{};
+        std::memcpy(header.magic, BINARY_MAGIC, sizeof(header.magic));
+        header.version = BINARY_VERSION;
+        header.pid = static_cast<uint32_t>(ur_getpid());
+        fwrite(&header, sizeof(header), 1, output->file);
+    }
+    ~BinaryWriter() override {
+        // Thread-local buffers of the main thread are destroyed before the
+        // writer, other threads flush theirs as they exit.
+        output->close();
+    }
+
+    bool needs_args() const override { return false; }
+
+    void begin(uint64_t, const char *, std::string_view) override {}
+
+    void end(uint64_t, uint32_t function_id, const char *fname,
+             std::string_view, const void *params, Timepoint tp,
+             Timepoint start_tp, const ur_result_t *resultp) override {
+        auto &buffer = local_buffer();
+
+        if (function_id >= MAX_FUNCTION_ID ||
+            !names_written[function_id].exchange(true,
+                                                 std::memory_order_relaxed)) {
+            auto len = static_cast<uint16_t>(strnlen(fname, UINT16_MAX));
+            binary_record_header name_header{RECORD_NAME, len, function_id};
+            append(buffer.data, name_header);
+            buffer.data.insert(buffer.data.end(), fname, fname + len);
+        }
+
+        binary_record_header header{RECORD_CALL,
+                                    sizeof(binary_call_record), function_id};
+        binary_call_record call{};
+        call.result = static_cast<int32_t>(*resultp);
+        call.thread_id = std::hash<std::thread::id>{}(std::this_thread::get_id());
+        call.begin_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            start_tp.time_since_epoch())
+                            .count();
+        call.end_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          tp.time_since_epoch())
+                          .count();
+        append(buffer.data, header);
+        append(buffer.data, call);
+
+        if (cli_args.capture && *resultp == UR_RESULT_SUCCESS) {
+            append_args(buffer, function_id, params);
+        }
+
+        if (buffer.data.size() >= BUFFER_SIZE) {
+            output->flush(buffer.data);
+        }
+    }
+};
+
+/*
+ * Aggregates calls per function and prints a single table at exit, so the
+ * output size doesn't depend on how long the traced program runs. Each thread
+ * collects into its own table, which is merged into the global one when the
+ * thread exits. Percentiles require a build with UR_ENABLE_LATENCY_HISTOGRAM.
+ */
+class SummaryWriter : public TraceWriter {
+    struct fn_stats {
+        const char *name = nullptr;
+        uint64_t count = 0;
+        uint64_t threads = 0;
+        std::chrono::nanoseconds total{0};
+        std::chrono::nanoseconds max{0};
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+        histogram_ptr histogram{nullptr, &hdr_close};
+#endif
+
+        void record(std::chrono::nanoseconds dur) {
+            count++;
+            total += dur;
+            max = std::max(max, dur);
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+            if (!histogram) {
+                struct hdr_histogram *h = nullptr;
+                // two significant figures keep per-thread tables small
+                if (hdr_init(1, 100'000'000'000, 2, &h) == 0) {
+                    histogram.reset(h);
+                }
+            }
+            if (histogram) {
+                hdr_record_value(histogram.get(), dur.count());
+            }
+#endif
+        }
+
+        void merge(fn_stats &other) {
+            name = other.name;
+            count += other.count;
+            threads++;
+            total += other.total;
+            max = std::max(max, other.max);
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+            if (!histogram) {
+                histogram = std::move(other.histogram);
+            } else if (other.histogram) {
+                hdr_add(histogram.get(), other.histogram.get());
+            }
+#endif
+        }
+    };
+    using stats_map = std::unordered_map<uint32_t, fn_stats>;
+
+    // The global table is shared with the threads' tables, as threads may
+    // exit after the writer was destroyed at exit.
+    struct summary_t {
+        std::mutex mutex;
+        stats_map total;
+
+        void merge(stats_map &stats) {
+            std::scoped_lock<std::mutex> lock(mutex);
+            for (auto &[id, fn] : stats) {
+                total[id].merge(fn);
+            }
+            stats.clear();
+        }
+    };
+
+    struct thread_stats {
+        std::shared_ptr<summary_t> summary;
+        stats_map stats;
+
+        explicit thread_stats(std::shared_ptr<summary_t> summary)
+            : summary(std::move(summary)) {}
+        ~thread_stats() { summary->merge(stats); }
+    };
+
+    thread_stats &local_stats() {
+        static thread_local thread_stats stats(summary);
+        return stats;
+    }
+
+    std::shared_ptr<summary_t> summary = std::make_shared<summary_t>();
+
+  public:
+    ~SummaryWriter() override {
+        try {
+            epilogue();
+        } catch (...) {
+        }
+    }
+
+    bool needs_args() const override { return false; }
+
+    void begin(uint64_t, const char *, std::string_view) override {}
+
+    void end(uint64_t, uint32_t function_id, const char *fname,
+             std::string_view, const void *, Timepoint tp, Timepoint start_tp,
+             const ur_result_t *) override {
+        auto &fn = local_stats().stats[function_id];
+        fn.name = fname;
+        fn.record(
+            std::chrono::duration_cast<std::chrono::nanoseconds>(tp - start_tp));
+    }
+
+    void epilogue() override {
+        // The main thread's table is destroyed before the writer, threads
+        // still running at exit are not included.
+        std::scoped_lock<std::mutex> lock(summary->mutex);
+        auto &total = summary->total;
+        if (total.empty()) {
+            return;
+        }
+
+        std::multimap<std::chrono::nanoseconds, const fn_stats *,
+                      std::greater<>>
+            by_total;
+        for (auto &[id, fn] : total) {
+            by_total.emplace(fn.total, &fn);
+        }
+
+        auto t = [](std::chrono::nanoseconds dur) {
+            return time_to_str(dur, cli_args.time_unit);
+        };
+        auto row = [](const auto &name, const auto &calls, const auto &total,
+                      const auto &p50, const auto &p99, const auto &p999,
+                      const auto &max, const auto &threads,
+                      const auto &per_thread) {
+            std::ostringstream line;
+            line << std::left << std::setw(48) << name << std::right
+                 << std::setw(10) << calls << std::setw(12) << total
+                 << std::setw(10) << p50 << std::setw(10) << p99
+                 << std::setw(10) << p999 << std::setw(10) << max
+                 << std::setw(8) << threads << std::setw(14) << per_thread;
+            return line.str();
+        };
+        out.info("{}", row("function", "calls", "total", "p50", "p99", "p99.9",
+                           "max", "threads", "calls/thread"));
+        for (auto &[_, fn] : by_total) {
+            std::string p50 = "-", p99 = "-", p999 = "-";
+#if defined(UR_ENABLE_LATENCY_HISTOGRAM)
+            if (fn->histogram) {
+                auto at = [&](double p) {
+                    return t(std::chrono::nanoseconds(
+                        hdr_value_at_percentile(fn->histogram.get(), p)));
+                };
+                p50 = at(50.0);
+                p99 = at(99.0);
+                p999 = at(99.9);
+            }
+#endif
+            out.info("{}", row(fn->name, fn->count, t(fn->total), p50, p99,
+                               p999, t(fn->max), fn->threads,
+                               fn->count / fn->threads));
+        }
+        total.clear();
+    }
 };
 
 std::unique_ptr<TraceWriter> create_writer() {
@@ -276,6 +704,10 @@ std::unique_ptr<TraceWriter> create_writer() {
         return std::make_unique<HumanReadable>();
     case OUTPUT_JSON:
         return std::make_unique<JsonWriter>();
+    case OUTPUT_BINARY:
+        return std::make_unique<BinaryWriter>(cli_args.binary_path);
+    case OUTPUT_SUMMARY:
+        return std::make_unique<SummaryWriter>();
     default:
         ur::unreachable();
     }
@@ -293,23 +725,37 @@ struct fn_context {
     std::optional<Timepoint> start;
 };
 
-static thread_local std::stack<fn_context> instance_data;
+static thread_local std::vector<fn_context> instance_data;
 
 fn_context *push_instance_data(uint64_t instance) {
-    instance_data.push(fn_context{instance, std::nullopt});
-    return &instance_data.top();
+    instance_data.push_back(fn_context{instance, std::nullopt});
+    return &instance_data.back();
 }
 
 std::optional<fn_context> pop_instance_data(uint64_t instance) {
-    if (instance_data.empty()) {
-        return std::nullopt;
+    // Calls made on one thread nest, but the buffered tracing layer delivers
+    // the events of all threads from its drain thread, so the matching begin
+    // isn't necessarily on top.
+    for (auto it = instance_data.rbegin(); it != instance_data.rend(); ++it) {
+        if (it->instance == instance) {
+            auto data = *it;
+            instance_data.erase(std::next(it).base());
+            return data;
+        }
     }
-    auto data = instance_data.top();
-    if (data.instance != instance) {
-        return std::nullopt;
+    return std::nullopt;
+}
+
+// The buffered tracing layer passes the time the event was captured
+// (steady clock, in nanoseconds) as user_data.
+static Timepoint event_time(const xpti::function_with_args_t *args,
+                            Timepoint now) {
+    if (args->user_data == nullptr) {
+        return now;
     }
-    instance_data.pop();
-    return data;
+    auto ns = *static_cast<const uint64_t *>(args->user_data);
+    return Timepoint(std::chrono::duration_cast<Clock::duration>(
+        std::chrono::nanoseconds(ns)));
 }
 
 XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
@@ -327,19 +773,23 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
         }
     }
 
-    std::ostringstream args_str;
-    if (cli_args.no_args) {
-        args_str << "...";
-    } else {
-        ur::extras::printFunctionParams(
-            args_str, (enum ur_function_t)args->function_id, args->args_data);
+    // Printed into a buffer kept by the thread, which the writers are done
+    // with by the time they return
+    std::string_view args_str;
+    if (writer()->needs_args()) {
+        if (cli_args.no_args || args->args_data == nullptr) {
+            args_str = "...";
+        } else {
+            args_str = ur::extras::printFunctionParams(
+                (enum ur_function_t)args->function_id, args->args_data);
+        }
     }
 
     if (trace_type == TRACE_FN_BEGIN) {
         auto ctx = push_instance_data(instance);
-        ctx->start = std::optional(Clock::now());
+        ctx->start = std::optional(event_time(args, Clock::now()));
 
-        writer()->begin(instance, args->function_name, args_str.str());
+        writer()->begin(instance, args->function_name, args_str);
     } else if (trace_type == TRACE_FN_END) {
         auto ctx = pop_instance_data(instance);
         if (!ctx) {
@@ -350,13 +800,20 @@ XPTI_CALLBACK_API void trace_cb(uint16_t trace_type, xpti::trace_event_data_t *,
         }
         auto resultp = static_cast<const ur_result_t *>(args->ret_data);
 
-        writer()->end(instance, args->function_name, args_str.str(),
-                      time_for_end, *ctx->start, resultp);
+        writer()->end(instance, args->function_id, args->function_name,
+                      args_str, args->args_data, event_time(args, time_for_end),
+                      *ctx->start, resultp);
     } else {
         out.warn("unsupported trace type");
     }
 }
 
+XPTI_CALLBACK_API void activity_cb(uint16_t, xpti::trace_event_data_t *,
+                                   xpti::trace_event_data_t *, uint64_t,
+                                   const void *user_data) {
+    writer()->activity(*static_cast<const l0_activity_record_t *>(user_data));
+}
+
 /**
  * @brief Subscriber initialization function called by the XPTI dispatcher.
  *
@@ -369,6 +826,13 @@ XPTI_CALLBACK_API void xptiTraceInit(unsigned int major_version,
         out.debug("Found stream with null name. Skipping...");
         return;
     }
+    if (std::string_view(stream_name) == L0_ACTIVITY_STREAM_NAME) {
+        out.debug("Registered stream {} ({}.{}).", stream_name, major_version,
+                  minor_version);
+        xptiRegisterCallback(xptiRegisterStream(stream_name), TRACE_SIGNAL,
+                             activity_cb);
+        return;
+    }
     if (std::string_view(stream_name) != UR_STREAM_NAME) {
         out.debug("Found stream: {}. Expected: {}. Skipping...", stream_name,
                   UR_STREAM_NAME);
@@ -0,0 +1,207 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file trace_format.hpp
+ *
+ * Layout of the binary traces written by the collector, decoded by
+ * `urtrace --decode` and replayed by `urreplay`.
+ */
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+/*
+ * Compact binary trace.
+ *
+ * Records are appended to a per-thread buffer without any formatting or
+ * locking, and the buffer is written out in one go once it fills up or its
+ * thread exits. The file starts with a binary_file_header, followed by
+ * records that each begin with a binary_record_header. A function's name is
+ * stored once, in a RECORD_NAME preceding its first RECORD_CALL. All fields
+ * are little-endian.
+ *
+ * Captured traces follow the RECORD_CALL of each replayable call with the
+ * arguments of the call, split into RECORD_ARGS chunks of up to
+ * MAX_RECORD_SIZE bytes, the last of which is shorter. Readers that don't
+ * replay skip them.
+ */
+constexpr char BINARY_MAGIC[8] = {'U', 'R', 'T', 'R', 'A', 'C', 'E', 'B'};
+constexpr uint32_t BINARY_VERSION = 1;
+constexpr size_t MAX_RECORD_SIZE = UINT16_MAX;
+
+enum binary_record_kind : uint16_t {
+    RECORD_NAME = 1,
+    RECORD_CALL = 2,
+    RECORD_ARGS = 3,
+};
+
+struct binary_file_header {
+    char magic[8];
+    uint32_t version;
+    uint32_t pid;
+};
+
+struct binary_record_header {
+    uint16_t kind;
+    uint16_t size; // payload bytes following the header
+    uint32_t function_id;
+};
+
+struct binary_call_record {
+    int32_t result;
+    uint32_t reserved;
+    uint64_t thread_id;
+    uint64_t begin_ns;
+    uint64_t end_ns;
+};
+
+/*
+ * Arguments of a captured call, in the order of the function's parameters.
+ * Handles and USM pointers are stored as the values they had in the traced
+ * process, which the replay maps to the ones it creates. Output handles are
+ * stored after the call, as 0 when the caller didn't ask for them.
+ */
+class arg_writer {
+  public:
+    explicit arg_writer(std::vector<char> &data) : data(data) {}
+
+    void u8(uint8_t v) { raw(&v, sizeof(v)); }
+    void u32(uint32_t v) { raw(&v, sizeof(v)); }
+    void u64(uint64_t v) { raw(&v, sizeof(v)); }
+    void ptr(const void *p) { u64(reinterpret_cast<uintptr_t>(p)); }
+    template <typename T> void handle(T h) { ptr(h); }
+    template <typename T> void out(T *ph) { ptr(ph ? *ph : nullptr); }
+
+    // count handles, or none if phs is null
+    template <typename T> void handles(uint32_t count, T *phs) {
+        u32(phs ? count : 0);
+        for (uint32_t i = 0; phs && i < count; i++) {
+            ptr(phs[i]);
+        }
+    }
+
+    // Sizes of an optional array of count elements
+    void sizes(uint32_t count, const size_t *values) {
+        u32(values ? count : 0);
+        for (uint32_t i = 0; values && i < count; i++) {
+            u64(values[i]);
+        }
+    }
+
+    // size bytes of p, whose contents are only kept if with_data is set
+    void bytes(const void *p, size_t size, bool with_data = true) {
+        u64(size);
+        bool has_data = p && with_data;
+        u8(has_data);
+        if (has_data) {
+            raw(p, size);
+        }
+    }
+
+    void string(const char *s) {
+        if (s == nullptr) {
+            u32(UINT32_MAX);
+            return;
+        }
+        auto len = static_cast<uint32_t>(strlen(s));
+        u32(len);
+        raw(s, len);
+    }
+
+  private:
+    void raw(const void *p, size_t size) {
+        auto *bytes = static_cast<const char *>(p);
+        data.insert(data.end(), bytes, bytes + size);
+    }
+
+    std::vector<char> &data;
+};
+
+class arg_reader {
+  public:
+    arg_reader(const char *data, size_t size) : data(data), size(size) {}
+
+    bool ok() const { return !overrun; }
+
+    uint8_t u8() { return read<uint8_t>(); }
+    uint32_t u32() { return read<uint32_t>(); }
+    uint64_t u64() { return read<uint64_t>(); }
+
+    std::vector<uint64_t> handles() {
+        std::vector<uint64_t> values(count(sizeof(uint64_t)));
+        for (auto &v : values) {
+            v = u64();
+        }
+        return values;
+    }
+
+    std::vector<size_t> sizes() {
+        std::vector<size_t> values(count(sizeof(uint64_t)));
+        for (auto &v : values) {
+            v = static_cast<size_t>(u64());
+        }
+        return values;
+    }
+
+    // Size of a byte range and its contents, empty if they weren't captured
+    std::pair<size_t, std::string_view> bytes() {
+        auto len = static_cast<size_t>(u64());
+        bool has_data = u8();
+        return {len, has_data ? view(len) : std::string_view()};
+    }
+
+    // Returns false for a null string
+    bool string(std::string &s) {
+        auto len = u32();
+        if (len == UINT32_MAX) {
+            return false;
+        }
+        s = std::string(view(len));
+        return true;
+    }
+
+  private:
+    // Number of elements of an array, which must fit in what is left
+    uint32_t count(size_t element_size) {
+        auto n = u32();
+        if (n > (size - offset) / element_size) {
+            overrun = true;
+            return 0;
+        }
+        return n;
+    }
+
+    template <typename T> T read() {
+        T v{};
+        auto bytes = view(sizeof(T));
+        if (!bytes.empty()) {
+            std::memcpy(&v, bytes.data(), sizeof(T));
+        }
+        return v;
+    }
+
+    std::string_view view(size_t len) {
+        if (overrun || len > size - offset) {
+            overrun = true;
+            return {};
+        }
+        std::string_view v(data + offset, len);
+        offset += len;
+        return v;
+    }
+
+    const char *data;
+    size_t size;
+    size_t offset = 0;
+    bool overrun = false;
+};
@@ -0,0 +1,720 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * Part of the Unified-Runtime Project, under the Apache License v2.0 with LLVM Exceptions.
+ * See LICENSE.TXT
+ * SPDX-License-Identifier: Apache-2.0 WITH LLVM-exception
+ *
+ * @file urreplay.cpp
+ *
+ * Replays the calls recorded by `urtrace --capture` against the adapter
+ * selected with UR_ADAPTERS_FORCE_LOAD, and compares the time each function
+ * took with the recorded one:
+ *
+ *   $ urreplay [--no-gaps] [--csv] TRACE
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <ur_api.h>
+
+#include "trace_format.hpp"
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+struct recorded_call {
+    uint32_t function_id;
+    binary_call_record record;
+    std::vector<char> args;
+    // Set once the last RECORD_ARGS chunk of the call is read
+    bool captured = false;
+};
+
+struct function_stats {
+    uint64_t calls = 0;
+    uint64_t skipped = 0;
+    uint64_t mismatched = 0;
+    uint64_t recorded_ns = 0;
+    uint64_t replayed_ns = 0;
+};
+
+class replayer {
+  public:
+    void parseArgs(int argc, const char **argv) {
+        static const char *usage =
+            R"(usage: %s [-h] [--no-gaps] [--csv] TRACE
+
+Replays the calls captured with `urtrace --capture --file TRACE` one after
+the other, in the order they began, on the adapter forced with
+UR_ADAPTERS_FORCE_LOAD, and prints the recorded and replayed time of every
+function.
+
+options:
+  -h, --help  show this help message and exit
+  --no-gaps   don't wait between calls for as long as the traced process did
+  --csv       print name,calls,skipped,mismatched,recorded_us,replayed_us rows
+)";
+        for (int argi = 1; argi < argc; argi++) {
+            std::string arg = argv[argi];
+            if (arg == "-h" || arg == "--help") {
+                std::printf(usage, argv[0]);
+                std::exit(0);
+            } else if (arg == "--no-gaps") {
+                gaps = false;
+            } else if (arg == "--csv") {
+                csv = true;
+            } else if (path.empty() && arg[0] != '-') {
+                path = arg;
+            } else {
+                std::fprintf(stderr, usage, argv[0]);
+                std::exit(1);
+            }
+        }
+        if (path.empty()) {
+            std::fprintf(stderr, usage, argv[0]);
+            std::exit(1);
+        }
+    }
+
+    void load() {
+        std::ifstream file(path, std::ios::binary);
+        std::vector<char> data((std::istreambuf_iterator<char>(file)),
+                               std::istreambuf_iterator<char>());
+        binary_file_header header;
+        if (data.size() < sizeof(header)) {
+            fail("%s is not a binary urtrace file", path.c_str());
+        }
+        std::memcpy(&header, data.data(), sizeof(header));
+        if (std::memcmp(header.magic, BINARY_MAGIC, sizeof(BINARY_MAGIC)) ||
+            header.version != BINARY_VERSION) {
+            fail("%s is not a binary urtrace file", path.c_str());
+        }
+
+        // The records of a call are never split across the buffers of its
+        // thread, so the chunks of arguments follow their RECORD_CALL.
+        size_t offset = sizeof(header);
+        while (offset + sizeof(binary_record_header) <= data.size()) {
+            binary_record_header record;
+            std::memcpy(&record, data.data() + offset, sizeof(record));
+            offset += sizeof(record);
+            if (offset + record.size > data.size()) {
+                fail("%s is truncated", path.c_str());
+            }
+            const char *payload = data.data() + offset;
+            offset += record.size;
+
+            if (record.kind == RECORD_NAME) {
+                names[record.function_id] = std::string(payload, record.size);
+            } else if (record.kind == RECORD_CALL &&
+                       record.size >= sizeof(binary_call_record)) {
+                recorded_call call{record.function_id, {}, {}};
+                std::memcpy(&call.record, payload, sizeof(call.record));
+                calls.push_back(std::move(call));
+            } else if (record.kind == RECORD_ARGS && !calls.empty()) {
+                auto &call = calls.back();
+                call.args.insert(call.args.end(), payload,
+                                 payload + record.size);
+                call.captured = record.size < MAX_RECORD_SIZE;
+            }
+        }
+        std::stable_sort(calls.begin(), calls.end(),
+                         [](const recorded_call &a, const recorded_call &b) {
+                             return a.record.begin_ns < b.record.begin_ns;
+                         });
+    }
+
+    int run() {
+        if (urLoaderInit(0, nullptr) != UR_RESULT_SUCCESS) {
+            fail("urLoaderInit failed");
+        }
+        auto start = clock_type::now();
+        for (auto &call : calls) {
+            auto &stats = functions[call.function_id];
+            stats.calls++;
+            if (!call.captured) {
+                stats.skipped++;
+                continue;
+            }
+            if (gaps) {
+                // Keep the offset of each call from the first one, unless the
+                // replay is already behind
+                auto recorded = std::chrono::nanoseconds(
+                    call.record.begin_ns - calls.front().record.begin_ns);
+                std::this_thread::sleep_until(start + recorded);
+            }
+            arg_reader args(call.args.data(), call.args.size());
+            int32_t result = UR_RESULT_SUCCESS;
+            uint64_t replayed_ns = 0;
+            if (!replay(call.function_id, args, result, replayed_ns)) {
+                // Captured by a newer collector
+                stats.skipped++;
+                continue;
+            }
+            if (!args.ok()) {
+                fail("the arguments of a call to %s are malformed",
+                     name(call.function_id).c_str());
+            }
+            stats.recorded_ns += call.record.end_ns - call.record.begin_ns;
+            stats.replayed_ns += replayed_ns;
+            if (result != call.record.result) {
+                stats.mismatched++;
+            }
+        }
+        report();
+        urLoaderTearDown();
+        return 0;
+    }
+
+  private:
+    template <typename... Args>
+    [[noreturn]] static void fail(const char *format, Args... args) {
+        std::fprintf(stderr, "error: ");
+        std::fprintf(stderr, format, args...);
+        std::fprintf(stderr, "\n");
+        std::exit(1);
+    }
+
+    std::string name(uint32_t function_id) {
+        auto it = names.find(function_id);
+        return it != names.end() ? it->second
+                                 : "function " + std::to_string(function_id);
+    }
+
+    // Times a single call into the API
+    template <typename F> static int32_t timed(uint64_t &ns, F &&f) {
+        auto begin = clock_type::now();
+        ur_result_t result = f();
+        ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                 clock_type::now() - begin)
+                 .count();
+        return result;
+    }
+
+    template <typename T> T handle(uint64_t recorded) {
+        auto it = handles.find(recorded);
+        return static_cast<T>(it != handles.end() ? it->second : nullptr);
+    }
+
+    template <typename T> std::vector<T> handles_of(arg_reader &args) {
+        std::vector<T> values;
+        for (auto recorded : args.handles()) {
+            values.push_back(handle<T>(recorded));
+        }
+        return values;
+    }
+
+    // Maps the handle a call returned to the one it was recorded as
+    template <typename T> void map(uint64_t recorded, T replayed) {
+        if (recorded) {
+            handles[recorded] = replayed;
+        }
+    }
+
+    // Host memory of size bytes standing in for memory of the traced process.
+    // Enqueued commands may still use it after their call returns, so it is
+    // kept until the end, one allocation per size.
+    void *scratch(size_t size) {
+        auto &memory = scratch_memory[size];
+        if (!memory) {
+            memory.reset(new char[size]());
+        }
+        return memory.get();
+    }
+
+    // Translates a recorded pointer within a USM allocation, or returns
+    // scratch memory of size bytes for any other pointer
+    void *pointer(uint64_t recorded, size_t size) {
+        if (recorded == 0) {
+            return nullptr;
+        }
+        auto it = allocations.upper_bound(recorded);
+        if (it != allocations.begin()) {
+            --it;
+            if (recorded < it->first + it->second.first) {
+                return static_cast<char *>(it->second.second) +
+                       (recorded - it->first);
+            }
+        }
+        return scratch(size);
+    }
+
+    // A recorded wait list, and whether the call returned an event
+    struct event_list {
+        std::vector<ur_event_handle_t> wait;
+        uint64_t out;
+        ur_event_handle_t event = nullptr;
+
+        uint32_t size() const { return static_cast<uint32_t>(wait.size()); }
+        const ur_event_handle_t *data() const {
+            return wait.empty() ? nullptr : wait.data();
+        }
+        ur_event_handle_t *phEvent() { return out ? &event : nullptr; }
+    };
+
+    event_list events(arg_reader &args) {
+        event_list list;
+        list.wait = handles_of<ur_event_handle_t>(args);
+        list.out = args.u64();
+        return list;
+    }
+
+    static const size_t *sizes_or_null(const std::vector<size_t> &sizes) {
+        return sizes.empty() ? nullptr : sizes.data();
+    }
+
+    // The counterpart of capture_args, reading the arguments in the same
+    // order. Returns false for the functions it doesn't know.
+    bool replay(uint32_t function_id, arg_reader &args, int32_t &result,
+                uint64_t &ns) {
+        switch (static_cast<ur_function_t>(function_id)) {
+        case UR_FUNCTION_ADAPTER_GET: {
+            auto num_entries = args.u32();
+            auto recorded = args.handles();
+            std::vector<ur_adapter_handle_t> adapters(num_entries);
+            uint32_t count = 0;
+            result = timed(ns, [&] {
+                return urAdapterGet(num_entries,
+                                    num_entries ? adapters.data() : nullptr,
+                                    &count);
+            });
+            for (size_t i = 0; i < recorded.size() && i < count; i++) {
+                map(recorded[i], adapters[i]);
+            }
+        } break;
+        case UR_FUNCTION_PLATFORM_GET: {
+            auto adapters = handles_of<ur_adapter_handle_t>(args);
+            auto num_entries = args.u32();
+            auto recorded = args.handles();
+            std::vector<ur_platform_handle_t> platforms(num_entries);
+            uint32_t count = 0;
+            result = timed(ns, [&] {
+                return urPlatformGet(adapters.data(), adapters.size(),
+                                     num_entries,
+                                     num_entries ? platforms.data() : nullptr,
+                                     &count);
+            });
+            for (size_t i = 0; i < recorded.size() && i < count; i++) {
+                map(recorded[i], platforms[i]);
+            }
+        } break;
+        case UR_FUNCTION_DEVICE_GET: {
+            auto platform = handle<ur_platform_handle_t>(args.u64());
+            auto type = static_cast<ur_device_type_t>(args.u32());
+            auto num_entries = args.u32();
+            auto recorded = args.handles();
+            std::vector<ur_device_handle_t> devices(num_entries);
+            uint32_t count = 0;
+            result = timed(ns, [&] {
+                return urDeviceGet(platform, type, num_entries,
+                                   num_entries ? devices.data() : nullptr,
+                                   &count);
+            });
+            for (size_t i = 0; i < recorded.size() && i < count; i++) {
+                map(recorded[i], devices[i]);
+            }
+        } break;
+        case UR_FUNCTION_CONTEXT_CREATE: {
+            auto devices = handles_of<ur_device_handle_t>(args);
+            auto out = args.u64();
+            ur_context_handle_t context = nullptr;
+            result = timed(ns, [&] {
+                return urContextCreate(devices.size(), devices.data(), nullptr,
+                                       &context);
+            });
+            map(out, context);
+        } break;
+        case UR_FUNCTION_QUEUE_CREATE: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto device = handle<ur_device_handle_t>(args.u64());
+            ur_queue_properties_t props{UR_STRUCTURE_TYPE_QUEUE_PROPERTIES,
+                                        nullptr, args.u32()};
+            auto out = args.u64();
+            ur_queue_handle_t queue = nullptr;
+            result = timed(ns, [&] {
+                return urQueueCreate(context, device, &props, &queue);
+            });
+            map(out, queue);
+        } break;
+        case UR_FUNCTION_CONTEXT_RELEASE: {
+            auto h = handle<ur_context_handle_t>(args.u64());
+            result = timed(ns, [&] { return urContextRelease(h); });
+        } break;
+        case UR_FUNCTION_QUEUE_FINISH: {
+            auto h = handle<ur_queue_handle_t>(args.u64());
+            result = timed(ns, [&] { return urQueueFinish(h); });
+        } break;
+        case UR_FUNCTION_QUEUE_FLUSH: {
+            auto h = handle<ur_queue_handle_t>(args.u64());
+            result = timed(ns, [&] { return urQueueFlush(h); });
+        } break;
+        case UR_FUNCTION_QUEUE_RELEASE: {
+            auto h = handle<ur_queue_handle_t>(args.u64());
+            result = timed(ns, [&] { return urQueueRelease(h); });
+        } break;
+        case UR_FUNCTION_MEM_RELEASE: {
+            auto h = handle<ur_mem_handle_t>(args.u64());
+            result = timed(ns, [&] { return urMemRelease(h); });
+        } break;
+        case UR_FUNCTION_PROGRAM_RELEASE: {
+            auto h = handle<ur_program_handle_t>(args.u64());
+            result = timed(ns, [&] { return urProgramRelease(h); });
+        } break;
+        case UR_FUNCTION_KERNEL_RELEASE: {
+            auto h = handle<ur_kernel_handle_t>(args.u64());
+            result = timed(ns, [&] { return urKernelRelease(h); });
+        } break;
+        case UR_FUNCTION_EVENT_RELEASE: {
+            auto h = handle<ur_event_handle_t>(args.u64());
+            result = timed(ns, [&] { return urEventRelease(h); });
+        } break;
+        case UR_FUNCTION_USM_HOST_ALLOC:
+        case UR_FUNCTION_USM_DEVICE_ALLOC:
+        case UR_FUNCTION_USM_SHARED_ALLOC: {
+            auto id = static_cast<ur_function_t>(function_id);
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto device = id == UR_FUNCTION_USM_HOST_ALLOC
+                              ? nullptr
+                              : handle<ur_device_handle_t>(args.u64());
+            auto size = static_cast<size_t>(args.u64());
+            ur_usm_desc_t desc{UR_STRUCTURE_TYPE_USM_DESC, nullptr,
+                               UR_USM_ADVICE_FLAG_DEFAULT, args.u32()};
+            auto out = args.u64();
+            void *ptr = nullptr;
+            result = timed(ns, [&] {
+                if (id == UR_FUNCTION_USM_HOST_ALLOC) {
+                    return urUSMHostAlloc(context, &desc, nullptr, size, &ptr);
+                }
+                if (id == UR_FUNCTION_USM_DEVICE_ALLOC) {
+                    return urUSMDeviceAlloc(context, device, &desc, nullptr,
+                                            size, &ptr);
+                }
+                return urUSMSharedAlloc(context, device, &desc, nullptr, size,
+                                        &ptr);
+            });
+            if (out && ptr) {
+                allocations[out] = {size, ptr};
+            }
+        } break;
+        case UR_FUNCTION_USM_FREE: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto recorded = args.u64();
+            auto it = allocations.find(recorded);
+            void *ptr = it != allocations.end() ? it->second.second : nullptr;
+            result = timed(ns, [&] { return urUSMFree(context, ptr); });
+            if (it != allocations.end()) {
+                allocations.erase(it);
+            }
+        } break;
+        case UR_FUNCTION_MEM_BUFFER_CREATE: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto flags = static_cast<ur_mem_flags_t>(args.u32());
+            auto [host_size, host_data] = args.bytes();
+            auto size = static_cast<size_t>(args.u64());
+            auto out = args.u64();
+            ur_buffer_properties_t props{UR_STRUCTURE_TYPE_BUFFER_PROPERTIES,
+                                         nullptr, nullptr};
+            if (!host_data.empty()) {
+                // Used host pointers must outlive the buffer
+                host_memory.emplace_back(new char[host_size]);
+                std::memcpy(host_memory.back().get(), host_data.data(),
+                            host_size);
+                props.pHost = host_memory.back().get();
+            } else {
+                flags &= ~(UR_MEM_FLAG_USE_HOST_POINTER |
+                           UR_MEM_FLAG_ALLOC_COPY_HOST_POINTER);
+            }
+            ur_mem_handle_t buffer = nullptr;
+            result = timed(ns, [&] {
+                return urMemBufferCreate(context, flags, size, &props,
+                                         &buffer);
+            });
+            map(out, buffer);
+        } break;
+        case UR_FUNCTION_ENQUEUE_MEM_BUFFER_WRITE: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto buffer = handle<ur_mem_handle_t>(args.u64());
+            bool blocking = args.u8();
+            auto offset = static_cast<size_t>(args.u64());
+            auto [size, data] = args.bytes();
+            auto list = events(args);
+            const void *src = data.empty() ? scratch(size) : data.data();
+            result = timed(ns, [&] {
+                return urEnqueueMemBufferWrite(queue, buffer, blocking, offset,
+                                               size, src, list.size(),
+                                               list.data(), list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_ENQUEUE_MEM_BUFFER_READ: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto buffer = handle<ur_mem_handle_t>(args.u64());
+            bool blocking = args.u8();
+            auto offset = static_cast<size_t>(args.u64());
+            auto size = static_cast<size_t>(args.u64());
+            auto list = events(args);
+            auto *dst = scratch(size);
+            result = timed(ns, [&] {
+                return urEnqueueMemBufferRead(queue, buffer, blocking, offset,
+                                              size, dst,
+                                              list.size(), list.data(),
+                                              list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_ENQUEUE_MEM_BUFFER_COPY: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto src = handle<ur_mem_handle_t>(args.u64());
+            auto dst = handle<ur_mem_handle_t>(args.u64());
+            auto src_offset = static_cast<size_t>(args.u64());
+            auto dst_offset = static_cast<size_t>(args.u64());
+            auto size = static_cast<size_t>(args.u64());
+            auto list = events(args);
+            result = timed(ns, [&] {
+                return urEnqueueMemBufferCopy(
+                    queue, src, dst, src_offset, dst_offset, size, list.size(),
+                    list.data(), list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_ENQUEUE_MEM_BUFFER_FILL: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto buffer = handle<ur_mem_handle_t>(args.u64());
+            auto [pattern_size, pattern] = args.bytes();
+            auto offset = static_cast<size_t>(args.u64());
+            auto size = static_cast<size_t>(args.u64());
+            auto list = events(args);
+            result = timed(ns, [&] {
+                return urEnqueueMemBufferFill(
+                    queue, buffer, pattern.data(), pattern_size, offset, size,
+                    list.size(), list.data(), list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_ENQUEUE_USM_MEMCPY: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            bool blocking = args.u8();
+            auto dst_recorded = args.u64();
+            auto src_recorded = args.u64();
+            auto size = static_cast<size_t>(args.u64());
+            auto list = events(args);
+            auto *dst = pointer(dst_recorded, size);
+            auto *src = pointer(src_recorded, size);
+            result = timed(ns, [&] {
+                return urEnqueueUSMMemcpy(queue, blocking, dst, src, size,
+                                          list.size(), list.data(),
+                                          list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_ENQUEUE_USM_FILL: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto recorded = args.u64();
+            auto [pattern_size, pattern] = args.bytes();
+            auto size = static_cast<size_t>(args.u64());
+            auto list = events(args);
+            auto *ptr = pointer(recorded, size);
+            result = timed(ns, [&] {
+                return urEnqueueUSMFill(queue, ptr, pattern_size,
+                                        pattern.data(), size, list.size(),
+                                        list.data(), list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_PROGRAM_CREATE_WITH_IL: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto [length, il] = args.bytes();
+            auto out = args.u64();
+            ur_program_handle_t program = nullptr;
+            result = timed(ns, [&] {
+                return urProgramCreateWithIL(context, il.data(), length,
+                                             nullptr, &program);
+            });
+            map(out, program);
+        } break;
+        case UR_FUNCTION_PROGRAM_CREATE_WITH_BINARY: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto device = handle<ur_device_handle_t>(args.u64());
+            auto [size, binary] = args.bytes();
+            auto out = args.u64();
+            ur_program_handle_t program = nullptr;
+            result = timed(ns, [&] {
+                return urProgramCreateWithBinary(
+                    context, device, size,
+                    reinterpret_cast<const uint8_t *>(binary.data()), nullptr,
+                    &program);
+            });
+            map(out, program);
+        } break;
+        case UR_FUNCTION_PROGRAM_BUILD: {
+            auto context = handle<ur_context_handle_t>(args.u64());
+            auto program = handle<ur_program_handle_t>(args.u64());
+            std::string options;
+            bool has_options = args.string(options);
+            result = timed(ns, [&] {
+                return urProgramBuild(context, program,
+                                      has_options ? options.c_str() : nullptr);
+            });
+        } break;
+        case UR_FUNCTION_KERNEL_CREATE: {
+            auto program = handle<ur_program_handle_t>(args.u64());
+            std::string kernel_name;
+            args.string(kernel_name);
+            auto out = args.u64();
+            ur_kernel_handle_t kernel = nullptr;
+            result = timed(ns, [&] {
+                return urKernelCreate(program, kernel_name.c_str(), &kernel);
+            });
+            map(out, kernel);
+        } break;
+        case UR_FUNCTION_KERNEL_SET_ARG_VALUE: {
+            auto kernel = handle<ur_kernel_handle_t>(args.u64());
+            auto index = args.u32();
+            auto [size, value] = args.bytes();
+            result = timed(ns, [&] {
+                return urKernelSetArgValue(kernel, index, size, nullptr,
+                                           value.data());
+            });
+        } break;
+        case UR_FUNCTION_KERNEL_SET_ARG_LOCAL: {
+            auto kernel = handle<ur_kernel_handle_t>(args.u64());
+            auto index = args.u32();
+            auto size = static_cast<size_t>(args.u64());
+            result = timed(ns, [&] {
+                return urKernelSetArgLocal(kernel, index, size, nullptr);
+            });
+        } break;
+        case UR_FUNCTION_KERNEL_SET_ARG_POINTER: {
+            auto kernel = handle<ur_kernel_handle_t>(args.u64());
+            auto index = args.u32();
+            auto *ptr = pointer(args.u64(), 1);
+            result = timed(ns, [&] {
+                return urKernelSetArgPointer(kernel, index, nullptr, ptr);
+            });
+        } break;
+        case UR_FUNCTION_KERNEL_SET_ARG_MEM_OBJ: {
+            auto kernel = handle<ur_kernel_handle_t>(args.u64());
+            auto index = args.u32();
+            ur_kernel_arg_mem_obj_properties_t props{
+                UR_STRUCTURE_TYPE_KERNEL_ARG_MEM_OBJ_PROPERTIES, nullptr,
+                args.u32()};
+            auto mem = handle<ur_mem_handle_t>(args.u64());
+            result = timed(ns, [&] {
+                return urKernelSetArgMemObj(kernel, index, &props, mem);
+            });
+        } break;
+        case UR_FUNCTION_ENQUEUE_KERNEL_LAUNCH: {
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto kernel = handle<ur_kernel_handle_t>(args.u64());
+            auto dim = args.u32();
+            auto offset = args.sizes();
+            auto global = args.sizes();
+            auto local = args.sizes();
+            auto list = events(args);
+            result = timed(ns, [&] {
+                return urEnqueueKernelLaunch(
+                    queue, kernel, dim, sizes_or_null(offset),
+                    sizes_or_null(global), sizes_or_null(local), list.size(),
+                    list.data(), list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        case UR_FUNCTION_EVENT_WAIT: {
+            auto wait = handles_of<ur_event_handle_t>(args);
+            result = timed(ns, [&] {
+                return urEventWait(wait.size(), wait.data());
+            });
+        } break;
+        case UR_FUNCTION_ENQUEUE_EVENTS_WAIT:
+        case UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER: {
+            bool barrier = static_cast<ur_function_t>(function_id) ==
+                           UR_FUNCTION_ENQUEUE_EVENTS_WAIT_WITH_BARRIER;
+            auto queue = handle<ur_queue_handle_t>(args.u64());
+            auto list = events(args);
+            result = timed(ns, [&] {
+                return barrier ? urEnqueueEventsWaitWithBarrier(
+                                     queue, list.size(), list.data(),
+                                     list.phEvent())
+                               : urEnqueueEventsWait(queue, list.size(),
+                                                     list.data(),
+                                                     list.phEvent());
+            });
+            map(list.out, list.event);
+        } break;
+        default:
+            return false;
+        }
+        return true;
+    }
+
+    void report() {
+        if (csv) {
+            std::printf(
+                "name,calls,skipped,mismatched,recorded_us,replayed_us\n");
+        } else {
+            std::printf("%-40s %8s %8s %10s %14s %14s %8s\n", "function",
+                        "calls", "skipped", "mismatched", "recorded us",
+                        "replayed us", "diff");
+        }
+        for (auto &[id, stats] : functions) {
+            auto recorded_us = stats.recorded_ns / 1000.0;
+            auto replayed_us = stats.replayed_ns / 1000.0;
+            if (csv) {
+                std::printf("%s,%llu,%llu,%llu,%.3f,%.3f\n", name(id).c_str(),
+                            static_cast<unsigned long long>(stats.calls),
+                            static_cast<unsigned long long>(stats.skipped),
+                            static_cast<unsigned long long>(stats.mismatched),
+                            recorded_us, replayed_us);
+                continue;
+            }
+            std::string diff = "-";
+            if (stats.recorded_ns && stats.calls > stats.skipped) {
+                diff = std::to_string(static_cast<int>(
+                           (replayed_us - recorded_us) * 100 / recorded_us)) +
+                       "%";
+            }
+            std::printf("%-40s %8llu %8llu %10llu %14.3f %14.3f %8s\n",
+                        name(id).c_str(),
+                        static_cast<unsigned long long>(stats.calls),
+                        static_cast<unsigned long long>(stats.skipped),
+                        static_cast<unsigned long long>(stats.mismatched),
+                        recorded_us, replayed_us, diff.c_str());
+        }
+    }
+
+    std::string path;
+    bool gaps = true;
+    bool csv = false;
+
+    std::vector<recorded_call> calls;
+    std::unordered_map<uint32_t, std::string> names;
+    std::map<uint32_t, function_stats> functions;
+
+    // Recorded handles and USM allocations (base to size and replayed base)
+    std::unordered_map<uint64_t, void *> handles;
+    std::map<uint64_t, std::pair<size_t, void *>> allocations;
+    std::vector<std::unique_ptr<char[]>> host_memory;
+    std::unordered_map<size_t, std::unique_ptr<char[]>> scratch_memory;
+};
+
+} // namespace
+
+int main(int argc, const char **argv) {
+    replayer replay;
+    replay.parseArgs(argc, argv);
+    replay.load();
+    return replay.run();
+}
@@ -7,6 +7,7 @@
 import argparse
 import subprocess  # nosec B404
 import os
+import struct
 import sys
 
 def find_library(paths, name, recursive=False):
@@ -31,6 +32,60 @@ def get_dynamic_library_name(name):
     else:
         sys.exit("Unsupported platform: {}".format(sys.platform))
 
+BINARY_MAGIC = b"URTRACEB"
+BINARY_VERSION = 1
+RECORD_NAME = 1
+RECORD_CALL = 2
+
+def decode_binary_trace(path, json_output, time_unit):
+    """Decodes a trace written by the collector with --binary."""
+    with open(path, "rb") as f:
+        data = f.read()
+    magic, version, pid = struct.unpack_from("<8sII", data, 0)
+    if magic != BINARY_MAGIC or version != BINARY_VERSION:
+        sys.exit("{} is not a binary urtrace file".format(path))
+
+    names = {}
+    calls = []
+    offset = struct.calcsize("<8sII")
+    while offset + 8 <= len(data):
+        kind, size, function_id = struct.unpack_from("<HHI", data, offset)
+        offset += 8
+        payload = data[offset:offset + size]
+        offset += size
+        if kind == RECORD_NAME:
+            names[function_id] = payload.decode("utf-8", "replace")
+        elif kind == RECORD_CALL:
+            result, _, tid, begin, end = struct.unpack_from("<iIQQQ", payload)
+            calls.append((begin, end, tid, function_id, result))
+    # records from different threads are flushed in batches
+    calls.sort()
+
+    def name(function_id):
+        return names.get(function_id, "function_{}".format(function_id))
+
+    def fmt_time(ns):
+        units = [("ns", 1), ("us", 1e3), ("ms", 1e6), ("s", 1e9)]
+        if time_unit == "auto":
+            unit, div = next((u for u in units if ns < u[1] * 1000), units[-1])
+        else:
+            unit, div = next(u for u in units if u[0] == time_unit)
+        return "{:g}{}".format(ns / div, unit)
+
+    if json_output:
+        print("{\n \"traceEvents\": [")
+        print(",\n".join(
+            "{{\"cat\": \"UR\", \"ph\": \"X\", \"pid\": {}, \"tid\": {}, "
+            "\"ts\": {}, \"dur\": {}, \"name\": \"{}\", \"args\": \"(...)\"}}".format(
+                pid, tid, begin // 1000, (end - begin) // 1000, name(function_id))
+            for begin, end, tid, function_id, _ in calls))
+        print("]\n}")
+    else:
+        for begin, end, tid, function_id, result in calls:
+            result_str = "UR_RESULT_SUCCESS" if result == 0 else "ur_result_t({})".format(result)
+            print("{}(...) -> {}; ({}) [tid {}]".format(
+                name(function_id), result_str, fmt_time(end - begin), tid))
+
 parser = argparse.ArgumentParser(
     description = """Unified Runtime tracing tool.
     %(prog)s is a program that runs the specified command until its exit,
@@ -41,7 +96,10 @@ parser = argparse.ArgumentParser(
 
     %(prog)s ./myapp --myapp-arg
     %(prog)s --mock --profiling --filter ".*(Device|Platform).*" ./hello_world
-    %(prog)s --adapter libur_adapter_cuda.so --begin ./sycl_app''',
+    %(prog)s --adapter libur_adapter_cuda.so --begin ./sycl_app
+    %(prog)s --binary --file app.trace ./myapp && %(prog)s --decode app.trace
+    %(prog)s --capture --file app.trace ./myapp && urreplay app.trace
+    %(prog)s --json --device-activity --file app.json ./myapp''',
     formatter_class=argparse.RawDescriptionHelpFormatter)
 parser.add_argument("command", help="Command to run, including arguments.", nargs=argparse.REMAINDER)
 parser.add_argument("--profiling", help="Measure function execution time.", action="store_true")
@@ -49,6 +107,12 @@ parser.add_argument("--filter", help="Only trace functions that match the provid
 parser.add_argument("--mock", help="Force the use of the mock adapter.", action="store_true")
 parser.add_argument("--adapter", help="Force the use of the provided adapter.", action="append", default=[])
 parser.add_argument("--json", help="Write output in a JSON Trace Event Format.", action="store_true")
+parser.add_argument("--device-activity", help="With --json, add the commands run by Level Zero devices to the trace, on a track per engine.", action="store_true")
+parser.add_argument("--summary", help="Print a per-function table of call counts and latencies at exit instead of tracing each call.", action="store_true")
+parser.add_argument("--binary", help="Write a compact binary trace to the file given with --file. Function arguments are not recorded.", action="store_true")
+parser.add_argument("--capture", help="Like --binary, and also record the arguments of the calls urreplay can replay.", action="store_true")
+parser.add_argument("--capture-data", help="With --capture, also record host memory read by the device, such as the sources of buffer writes.", action="store_true")
+parser.add_argument("--decode", metavar="TRACE", help="Decode a binary trace into text, or JSON with --json, and exit.")
 group = parser.add_mutually_exclusive_group()
 group.add_argument("--file", help="Write trace output to a file with the given name instead of stderr.")
 group.add_argument("--stdout", help="Write trace output to stdout instead of stderr.", action="store_true")
@@ -63,8 +127,26 @@ args = parser.parse_args()
 config = vars(args)
 if args.debug:
     print(config)
+
+if args.decode:
+    decode_binary_trace(args.decode, args.json, args.time_unit)
+    sys.exit(0)
+
+if args.device_activity and not args.json:
+    sys.exit("--device-activity requires --json")
+if args.capture_data and not args.capture:
+    sys.exit("--capture-data requires --capture")
+if args.capture:
+    args.binary = True
+if args.binary and not args.file:
+    sys.exit("--binary and --capture require an output --file")
+
 env = os.environ.copy()
 
+# The buffered tracing layer doesn't pass the arguments of the calls
+if args.capture and "buffered" in env.get('UR_LAYER_TRACING_OPTIONS', ""):
+    sys.exit("--capture can't be used with the buffered tracing layer")
+
 collector_args = ""
 if args.print_begin:
     collector_args += "print_begin;"
@@ -76,17 +158,28 @@ if args.filter:
     collector_args += "filter:" + args.filter + ";"
 if args.no_args:
     collector_args += "no_args;"
-if args.json:
+if args.capture:
+    collector_args += "capture:\"" + os.path.abspath(args.file) + "\";"
+    if args.capture_data:
+        collector_args += "capture_data;"
+elif args.binary:
+    collector_args += "binary:\"" + os.path.abspath(args.file) + "\";"
+elif args.summary:
+    collector_args += "summary;"
+elif args.json:
     collector_args += "json;"
 env['UR_COLLECTOR_ARGS'] = collector_args
 
+if args.device_activity:
+    env['UR_L0_TRACE_ACTIVITY'] = "1"
+
 log_collector = ""
 if args.debug:
     log_collector += "level:debug;"
 else:
     log_collector += "level:info;"
 log_collector += f"flush:{args.flush};"
-if args.file:
+if args.file and not args.binary:
     log_collector += "output:file," + args.file + ";"
 elif args.stdout:
     log_collector += "output:stdout"